@@ -80,9 +80,7 @@ class Base_cluster : public shcore::Cpp_object_bridge {
     base_impl()->get_metadata_storage()->invalidate_cached();
 
     // Init the connection pool
-    Scoped_instance_pool ipool(
-        interactive,
-        Instance_pool::Auth_options(base_impl()->default_admin_credentials()));
+    Scoped_instance_pool ipool(base_impl()->get_instance_pool(interactive));
 
     return f();
   }
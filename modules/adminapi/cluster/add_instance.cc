@@ -35,9 +35,34 @@
 #include "mysqlshdk/libs/mysql/clone.h"
 #include "mysqlshdk/libs/textui/textui.h"
 #include "mysqlshdk/libs/utils/debug.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 
 namespace mysqlsh::dba::cluster {
 
+void Add_instance_batch::start(std::size_t index) {
+  std::unique_lock lock(m_mutex);
+  m_turn_changed.wait(lock, [this, index]() { return m_turn == index; });
+  lock.release();
+}
+
+void Add_instance_batch::finish(std::size_t index) {
+  std::unique_lock lock(m_mutex, std::adopt_lock);
+
+  if (m_turn == index) {
+    ++m_turn;
+    m_turn_changed.notify_all();
+  }
+}
+
+void Add_instance_batch::hand_over() {
+  std::unique_lock lock(m_mutex, std::adopt_lock);
+
+  ++m_turn;
+  m_turn_changed.notify_all();
+}
+
+void Add_instance_batch::resume() { m_mutex.lock(); }
+
 void Add_instance::check_cluster_members_limit() const {
   const std::vector<Instance_metadata> all_instances =
       m_cluster_impl->get_metadata_storage()->get_all_instances(
@@ -729,8 +754,24 @@ void Add_instance::do_run() {
       }
 
       // Wait until recovery done. Will throw an exception if recovery fails.
-      m_cluster_impl->wait_instance_recovery(
-          *m_target_instance, join_begin_time, m_options.get_wait_recovery());
+      if (m_batch &&
+          m_options.get_wait_recovery() != Recovery_progress_style::NOWAIT) {
+        console->print_info("* Waiting for '" + m_target_instance->descr() +
+                            "' to finish recovery in the background...");
+        console->print_info();
+
+        // let the next instance of the batch join while this one recovers
+        m_batch->hand_over();
+        shcore::Scoped_callback resume([this]() { m_batch->resume(); });
+
+        m_cluster_impl->wait_instance_recovery(
+            *m_target_instance, join_begin_time,
+            Recovery_progress_style::NOINFO);
+      } else {
+        m_cluster_impl->wait_instance_recovery(
+            *m_target_instance, join_begin_time,
+            m_options.get_wait_recovery());
+      }
 
       // When clone is used, the target instance will restart and all
       // connections are closed so we need to test if the connection to the
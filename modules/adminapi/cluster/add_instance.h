@@ -24,6 +24,10 @@
 #ifndef MODULES_ADMINAPI_CLUSTER_ADD_INSTANCE_H_
 #define MODULES_ADMINAPI_CLUSTER_ADD_INSTANCE_H_
 
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
 #include "modules/adminapi/cluster/cluster_impl.h"
 #include "modules/adminapi/common/clone_options.h"
 #include "modules/adminapi/common/group_replication_options.h"
@@ -31,18 +35,72 @@
 
 namespace mysqlsh::dba::cluster {
 
+/**
+ * Coordinates the Add_instance operations of cluster.addInstances(), each
+ * one running in its own thread.
+ *
+ * Instances are validated and joined one at a time, in the given order, but
+ * once an instance starts recovering the next one can join, so that the
+ * recovery (i.e. clone) of all the instances happens at the same time.
+ */
+class Add_instance_batch final {
+ public:
+  Add_instance_batch() = default;
+
+  Add_instance_batch(const Add_instance_batch &) = delete;
+  Add_instance_batch(Add_instance_batch &&) = delete;
+  Add_instance_batch &operator=(const Add_instance_batch &) = delete;
+  Add_instance_batch &operator=(Add_instance_batch &&) = delete;
+
+  /**
+   * Blocks until it's the turn of the instance with the given index.
+   */
+  void start(std::size_t index);
+
+  /**
+   * Passes the turn to the next instance (if not passed yet), must be called
+   * once the instance is added (or fails to be added).
+   */
+  void finish(std::size_t index);
+
+  /**
+   * Passes the turn to the next instance while this one is recovering.
+   */
+  void hand_over();
+
+  /**
+   * Waits to continue with the instance, after its recovery has finished.
+   */
+  void resume();
+
+  /**
+   * Marks the batch as failed, instances which have not started yet are
+   * skipped.
+   */
+  void abort() { m_aborted = true; }
+  bool aborted() const { return m_aborted; }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_turn_changed;
+  std::size_t m_turn = 0;
+  bool m_aborted = false;
+};
+
 class Add_instance {
  public:
   Add_instance() = delete;
 
   Add_instance(Cluster_impl *cluster,
                const std::shared_ptr<mysqlsh::dba::Instance> &target_instance,
-               const cluster::Add_instance_options &options)
+               const cluster::Add_instance_options &options,
+               Add_instance_batch *batch = nullptr)
       : m_cluster_impl(cluster),
         m_target_instance(target_instance),
         m_gr_opts(options.gr_options),
         m_clone_opts(options.clone_options),
-        m_options(options) {
+        m_options(options),
+        m_batch(batch) {
     assert(m_cluster_impl);
   };
 
@@ -95,6 +153,7 @@ class Add_instance {
 
  private:
   Add_instance_options m_options;
+  Add_instance_batch *m_batch = nullptr;
   bool m_already_member = false;
   std::string m_account_host;
 };
@@ -129,6 +129,15 @@ void Status_options::set_query_members(bool value) {
   }
 }
 
+const shcore::Option_pack_def<Monitor_options> &Monitor_options::options() {
+  static const auto opts =
+      shcore::Option_pack_def<Monitor_options>()
+          .include<Status_options>()
+          .optional(kRefreshInterval, &Monitor_options::refresh_interval);
+
+  return opts;
+}
+
 const shcore::Option_pack_def<Options_options> &Options_options::options() {
   static const auto opts = shcore::Option_pack_def<Options_options>().optional(
       kAll, &Options_options::all);
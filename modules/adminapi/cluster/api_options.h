@@ -81,6 +81,12 @@ struct Status_options {
   uint64_t extended = 0;  // By default 0 (false).
 };
 
+struct Monitor_options : public Status_options {
+  static const shcore::Option_pack_def<Monitor_options> &options();
+
+  uint64_t refresh_interval = 10;  // seconds
+};
+
 struct Options_options {
   static const shcore::Option_pack_def<Options_options> &options();
 
@@ -27,7 +27,9 @@
 #include <exception>
 #include <functional>
 #include <iostream>
+#include <list>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -1201,6 +1203,93 @@ void Cluster_impl::add_instance(
   ensure_metadata_has_server_id(target);
 }
 
+void Cluster_impl::add_instances(
+    const std::vector<Connection_options> &instance_defs,
+    const cluster::Add_instance_options &options) {
+  check_preconditions("addInstance");
+
+  // connect to all the targets at the same time
+  std::vector<std::shared_ptr<Instance>> targets(instance_defs.size());
+  std::list<std::shared_ptr<Instance>> connected;
+
+  const auto connect_errors =
+      for_each_in_parallel(instance_defs.size(), [&](std::size_t index) {
+        targets[index] =
+            connect_target_instance(instance_defs[index], true, true);
+      });
+
+  for (const auto &target : targets) {
+    if (target) connected.push_back(target);
+  }
+
+  Scoped_instance_list scoped_targets(std::move(connected));
+
+  for (const auto &error : connect_errors) {
+    if (error) std::rethrow_exception(error);
+  }
+
+  {
+    std::set<std::string> uuids;
+    for (const auto &target : targets) {
+      if (!uuids.insert(target->get_uuid()).second)
+        throw shcore::Exception::argument_error(
+            "Instance '" + target->descr() + "' was given more than once.");
+    }
+  }
+
+  // put an exclusive lock on the cluster
+  auto c_lock = get_lock_exclusive();
+
+  // put an exclusive lock on all the target instances
+  auto i_locks = get_instance_lock_exclusive(scoped_targets.list());
+
+  // The instances are validated and joined one at a time, but each one
+  // recovers in the background while the next ones are being added, so that
+  // all of them are provisioned at the same time.
+  cluster::Add_instance_batch batch;
+  std::vector<bool> skipped(targets.size(), false);
+
+  const auto errors =
+      for_each_in_parallel(targets.size(), [&](std::size_t index) {
+        batch.start(index);
+        shcore::Scoped_callback finish(
+            [&batch, index]() { batch.finish(index); });
+
+        if (batch.aborted()) {
+          skipped[index] = true;
+          return;
+        }
+
+        try {
+          Topology_executor<cluster::Add_instance>{this, targets[index],
+                                                   options, &batch}
+              .run();
+        } catch (...) {
+          batch.abort();
+          throw;
+        }
+      });
+
+  auto console = current_console();
+  std::exception_ptr first_error;
+
+  for (std::size_t index = 0; index < targets.size(); ++index) {
+    if (skipped[index]) {
+      console->print_note("Instance '" + targets[index]->descr() +
+                          "' was not added to the cluster because of a "
+                          "previous error.");
+    } else if (errors[index]) {
+      if (!first_error) first_error = errors[index];
+    } else {
+      // Verification step to ensure the server_id is an attribute on all the
+      // instances of the cluster
+      ensure_metadata_has_server_id(*targets[index]);
+    }
+  }
+
+  if (first_error) std::rethrow_exception(first_error);
+}
+
 void Cluster_impl::rejoin_instance(
     const Connection_options &instance_def,
     const cluster::Rejoin_instance_options &options) {
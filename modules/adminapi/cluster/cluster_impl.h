@@ -125,6 +125,8 @@ class Cluster_impl final : public Base_cluster_impl,
   // API functions
   void add_instance(const Connection_options &instance_def,
                     const cluster::Add_instance_options &options);
+  void add_instances(const std::vector<Connection_options> &instance_defs,
+                     const cluster::Add_instance_options &options);
   void rejoin_instance(const Connection_options &instance_def,
                        const cluster::Rejoin_instance_options &options);
   void remove_instance(const Connection_options &instance_def,
@@ -65,9 +65,11 @@ void Dissolve::prompt_to_confirm_dissolve() const {
   console->print_info(
       "The cluster still has the following registered instances:");
 
-  // Pretty print description only if wrap_json is not json/raw.
+  // Pretty print description only if wrap_json is not json/raw or json/stream.
+  const auto &wrap_json = current_shell_options()->get().wrap_json;
   bool use_pretty_print =
-      (current_shell_options()->get().wrap_json.compare("json/raw") != 0);
+      (wrap_json.compare("json/raw") != 0 &&
+       wrap_json.compare("json/stream") != 0);
   console->print_info(res.descr(use_pretty_print));
 
   console->print_warning(
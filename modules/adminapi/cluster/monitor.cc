@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/adminapi/cluster/monitor.h"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+#include "modules/adminapi/cluster/status.h"
+#include "modules/adminapi/common/common.h"
+#include "modules/adminapi/common/metadata_storage.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlsh {
+namespace dba {
+namespace cluster {
+
+namespace {
+
+// sessions kept by the monitor are closed if they were not used for this long
+constexpr std::chrono::seconds k_max_session_idle{3600};
+
+/**
+ * Replaces the dictionary stored under the given key with its copy, so that
+ * the snapshots which were already returned are not modified. Returns nullptr
+ * if there's no such dictionary.
+ */
+shcore::Dictionary_t copy_map(const shcore::Dictionary_t &parent,
+                              const std::string &key) {
+  if (!parent || parent->get_type(key) != shcore::Map) {
+    return {};
+  }
+
+  auto copy = std::make_shared<shcore::Value::Map_type>(*parent->get_map(key));
+  parent->set(key, shcore::Value(copy));
+
+  return copy;
+}
+
+}  // namespace
+
+Monitor::Monitor(const std::shared_ptr<Cluster_impl> &cluster,
+                 uint64_t extended, std::chrono::seconds refresh_interval)
+    : m_cluster(cluster),
+      m_extended(extended),
+      m_refresh_interval(refresh_interval) {}
+
+Monitor::~Monitor() { close(); }
+
+shcore::Value Monitor::status() {
+  if (!m_status ||
+      std::chrono::steady_clock::now() - m_refreshed_at >= m_refresh_interval) {
+    refresh();
+  }
+
+  return shcore::Value(m_status);
+}
+
+void Monitor::refresh() {
+  if (!m_ipool) {
+    m_ipool = std::make_shared<Instance_pool>(false);
+    m_ipool->set_keep_sessions(true);
+  }
+
+  // drops sessions which were lost and the metadata of the previous refresh
+  m_ipool->recycle(k_max_session_idle);
+  m_ipool->set_default_auth_options(m_cluster->default_admin_credentials());
+
+  Scoped_instance_pool ipool(m_ipool);
+
+  bool refreshed = false;
+
+  if (m_status) {
+    try {
+      refreshed = incremental_refresh();
+    } catch (const std::exception &e) {
+      log_info("Failed to refresh the status of the Cluster '%s': %s",
+               m_cluster->get_name().c_str(), e.what());
+    }
+  }
+
+  if (!refreshed) {
+    full_refresh();
+  }
+
+  m_refreshed_at = std::chrono::steady_clock::now();
+}
+
+void Monitor::close() {
+  m_status.reset();
+  m_view_id.clear();
+  m_members.clear();
+  m_ipool.reset();
+}
+
+void Monitor::full_refresh() {
+  log_debug("Gathering full status of the Cluster '%s'",
+            m_cluster->get_name().c_str());
+
+  m_view_id.clear();
+  m_members.clear();
+
+  m_cluster->get_metadata_storage()->invalidate_cached();
+
+  {
+    MetadataStorage::Snapshot snapshot(m_cluster->get_metadata_storage());
+    m_status = m_cluster->status(m_extended).as_map();
+
+    for (const auto &md : m_cluster->get_instances()) {
+      m_members[md.uuid] = {md.label, md.endpoint,
+                            mysqlshdk::gr::Member_state::MISSING,
+                            mysqlshdk::gr::Member_role::NONE};
+    }
+  }
+
+  std::string view_id;
+  std::vector<mysqlshdk::gr::Member> members;
+
+  try {
+    if (!read_group_members(&view_id, &members)) {
+      return;
+    }
+  } catch (const std::exception &e) {
+    log_info("Failed to read members of the Cluster '%s': %s",
+             m_cluster->get_name().c_str(), e.what());
+    return;
+  }
+
+  for (const auto &member : members) {
+    if (const auto it = m_members.find(member.uuid); it != m_members.end()) {
+      it->second.state = member.state;
+      it->second.role = member.role;
+    } else {
+      // not in the metadata, only a full refresh is going to report it
+      return;
+    }
+  }
+
+  // incremental refresh is possible only if the view is known
+  m_view_id = std::move(view_id);
+}
+
+bool Monitor::incremental_refresh() {
+  if (m_view_id.empty()) {
+    return false;
+  }
+
+  std::string view_id;
+  std::vector<mysqlshdk::gr::Member> members;
+
+  if (!read_group_members(&view_id, &members) || view_id != m_view_id) {
+    return false;
+  }
+
+  for (const auto &member : members) {
+    const auto it = m_members.find(member.uuid);
+
+    if (it == m_members.end() || it->second.state != member.state ||
+        it->second.role != member.role) {
+      return false;
+    }
+  }
+
+  // members which were in the group, but are not there anymore
+  if (members.size() !=
+      static_cast<std::size_t>(std::count_if(
+          m_members.begin(), m_members.end(), [](const auto &member) {
+            return mysqlshdk::gr::Member_state::MISSING != member.second.state;
+          }))) {
+    return false;
+  }
+
+  auto status = std::make_shared<shcore::Value::Map_type>(*m_status);
+  const auto topology = copy_map(copy_map(status, "defaultReplicaSet"),
+                                 "topology");
+
+  if (!topology) {
+    return false;
+  }
+
+  refresh_member_stats(topology);
+  refresh_replication_lag(topology);
+
+  m_status = std::move(status);
+
+  return true;
+}
+
+bool Monitor::read_group_members(
+    std::string *view_id, std::vector<mysqlshdk::gr::Member> *members) {
+  const auto group_instance = m_cluster->get_cluster_server();
+
+  if (!group_instance) {
+    return false;
+  }
+
+  bool has_quorum = false;
+  *members = mysqlshdk::gr::get_members(*group_instance, nullptr, &has_quorum,
+                                        view_id);
+
+  return has_quorum;
+}
+
+void Monitor::refresh_member_stats(const shcore::Dictionary_t &topology) {
+  if (m_extended < 2) {
+    return;
+  }
+
+  const auto result = m_cluster->get_cluster_server()->query(
+      "SELECT * FROM performance_schema.replication_group_member_stats");
+
+  while (const auto row = result->fetch_one_named()) {
+    const auto member = m_members.find(row.get_string("MEMBER_ID"));
+
+    if (member == m_members.end()) {
+      continue;
+    }
+
+    const auto channel = row.get_string("CHANNEL_NAME");
+    std::string key;
+
+    if (channel == mysqlshdk::gr::k_gr_applier_channel) {
+      key = "transactions";
+    } else if (channel == mysqlshdk::gr::k_gr_recovery_channel) {
+      key = "recovery";
+    } else {
+      continue;
+    }
+
+    if (const auto stats = copy_map(copy_map(topology, member->second.label),
+                                    key)) {
+      Status::feed_member_stats(stats, mysqlshdk::db::Row_by_name(row));
+    }
+  }
+}
+
+void Monitor::refresh_replication_lag(const shcore::Dictionary_t &topology) {
+  for (const auto &member : m_members) {
+    const auto &info = member.second;
+
+    if (mysqlshdk::gr::Member_state::ONLINE != info.state) {
+      continue;
+    }
+
+    const auto dict = topology->get_map(info.label);
+
+    if (!dict) {
+      continue;
+    }
+
+    if (dict->has_key("replicationLag")) {
+      Scoped_instance instance(
+          m_ipool->connect_unchecked_endpoint(info.endpoint));
+
+      Status::feed_replication_lag(copy_map(topology, info.label), *instance);
+    } else if (dict->has_key("replicationLagFromImmediateSource")) {
+      Scoped_instance instance(
+          m_ipool->connect_unchecked_endpoint(info.endpoint));
+
+      // PRIMARY of a REPLICA Cluster replicates from the PRIMARY Cluster
+      Status::feed_channel_lag(
+          copy_map(topology, info.label), *instance,
+          mysqlshdk::gr::Member_role::PRIMARY == info.role
+              ? k_clusterset_async_channel_name
+              : mysqlshdk::gr::k_gr_applier_channel);
+    }
+  }
+}
+
+}  // namespace cluster
+}  // namespace dba
+}  // namespace mysqlsh
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_ADMINAPI_CLUSTER_MONITOR_H_
+#define MODULES_ADMINAPI_CLUSTER_MONITOR_H_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "modules/adminapi/cluster/cluster_impl.h"
+#include "modules/adminapi/common/instance_pool.h"
+#include "mysqlshdk/libs/mysql/group_replication.h"
+
+namespace mysqlsh {
+namespace dba {
+namespace cluster {
+
+/**
+ * Keeps the status of a Cluster in memory, refreshing it incrementally.
+ *
+ * The first refresh (and any refresh after the group membership, a member
+ * state or the primary has changed) gathers the full status, exactly like
+ * Cluster.status() does. Otherwise, only the volatile fields are refreshed:
+ * membership is read from a single member, applier queue counters of all
+ * members come from a single query, and the replication lag is queried from
+ * each ONLINE member. Sessions are kept in a pool owned by the monitor, so
+ * that members are not reconnected on each refresh.
+ */
+class Monitor final {
+ public:
+  Monitor(const std::shared_ptr<Cluster_impl> &cluster, uint64_t extended,
+          std::chrono::seconds refresh_interval);
+
+  Monitor(const Monitor &) = delete;
+  Monitor(Monitor &&) = delete;
+
+  Monitor &operator=(const Monitor &) = delete;
+  Monitor &operator=(Monitor &&) = delete;
+
+  ~Monitor();
+
+  /**
+   * Returns the status of the Cluster, refreshing it first if it is older
+   * than the refresh interval.
+   */
+  shcore::Value status();
+
+  /**
+   * Refreshes the status of the Cluster.
+   */
+  void refresh();
+
+  /**
+   * Closes all the sessions, status is gathered from scratch on the next
+   * refresh.
+   */
+  void close();
+
+ private:
+  struct Member {
+    std::string label;
+    std::string endpoint;
+    mysqlshdk::gr::Member_state state;
+    mysqlshdk::gr::Member_role role;
+  };
+
+  void full_refresh();
+
+  bool incremental_refresh();
+
+  bool read_group_members(std::string *view_id,
+                          std::vector<mysqlshdk::gr::Member> *members);
+
+  void refresh_member_stats(const shcore::Dictionary_t &topology);
+
+  void refresh_replication_lag(const shcore::Dictionary_t &topology);
+
+  std::shared_ptr<Cluster_impl> m_cluster;
+  const uint64_t m_extended;
+  const std::chrono::seconds m_refresh_interval;
+
+  std::shared_ptr<Instance_pool> m_ipool;
+
+  shcore::Dictionary_t m_status;
+  std::chrono::steady_clock::time_point m_refreshed_at;
+
+  // group membership as of the last full refresh, by member UUID
+  std::string m_view_id;
+  std::unordered_map<std::string, Member> m_members;
+};
+
+}  // namespace cluster
+}  // namespace dba
+}  // namespace mysqlsh
+
+#endif  // MODULES_ADMINAPI_CLUSTER_MONITOR_H_
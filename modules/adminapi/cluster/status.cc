@@ -24,6 +24,7 @@
 #include "modules/adminapi/cluster/status.h"
 
 #include <algorithm>
+#include <exception>
 #include <optional>
 #include <string>
 
@@ -131,17 +132,33 @@ Status::~Status() = default;
 void Status::connect_to_members() {
   auto ipool = current_ipool();
 
-  for (const auto &inst : m_instances) {
-    try {
-      if (inst.instance_type == Instance_type::READ_REPLICA) {
-        m_read_replica_sessions[inst.endpoint] =
-            ipool->connect_unchecked_endpoint(inst.endpoint);
-      } else {
-        m_member_sessions[inst.endpoint] =
-            ipool->connect_unchecked_endpoint(inst.endpoint);
-      }
-    } catch (const shcore::Error &e) {
-      m_member_connect_errors[inst.endpoint] = e.format();
+  std::vector<std::shared_ptr<Instance>> sessions(m_instances.size());
+  std::vector<std::string> connect_errors(m_instances.size());
+
+  // connecting to an unreachable instance takes up to the connect timeout,
+  // instances are contacted in parallel so that the total time is bound by the
+  // slowest one, rather than being the sum of all of them
+  const auto errors = for_each_in_parallel(
+      m_instances.size(), [&](std::size_t index) {
+        try {
+          sessions[index] =
+              ipool->connect_unchecked_endpoint(m_instances[index].endpoint);
+        } catch (const shcore::Error &e) {
+          connect_errors[index] = e.format();
+        }
+      });
+
+  for (std::size_t index = 0; index < m_instances.size(); ++index) {
+    if (errors[index]) std::rethrow_exception(errors[index]);
+
+    const auto &inst = m_instances[index];
+
+    if (!sessions[index]) {
+      m_member_connect_errors[inst.endpoint] = std::move(connect_errors[index]);
+    } else if (inst.instance_type == Instance_type::READ_REPLICA) {
+      m_read_replica_sessions[inst.endpoint] = std::move(sessions[index]);
+    } else {
+      m_member_sessions[inst.endpoint] = std::move(sessions[index]);
     }
   }
 }
@@ -486,14 +503,14 @@ void Status::collect_basic_local_status(shcore::Dictionary_t dict,
   std::string sql;
 
   if (version >= Version(8, 0, 0)) {
-    if (m_cluster->is_cluster_set_member()) {
+    if (m_is_cluster_set_member) {
       // PRIMARY of PC has no relevant replication lag info
       // PRIMARY of RC shows lag from clusterset_replication channel
       // SECONDARY members show replication from gr_applier channel
       std::string channel_name;
 
       if (is_primary) {
-        if (!m_cluster->is_primary_cluster()) {
+        if (!m_is_primary_cluster) {
           channel_name = k_clusterset_async_channel_name;
         }
       } else {
@@ -501,37 +518,47 @@ void Status::collect_basic_local_status(shcore::Dictionary_t dict,
       }
 
       if (!channel_name.empty()) {
-        mysqlshdk::mysql::Replication_channel channel;
-
-        if (mysqlshdk::mysql::get_channel_status(instance, channel_name,
-                                                 &channel)) {
-          dict->set("replicationLagFromOriginalSource",
-                    shcore::Value(channel.repl_lag_from_original));
-          dict->set("replicationLagFromImmediateSource",
-                    shcore::Value(channel.repl_lag_from_immediate));
-        } else {
-          dict->set("replicationLagFromOriginalSource", shcore::Value::Null());
-          dict->set("replicationLagFromImmediateSource", shcore::Value::Null());
-        }
+        feed_channel_lag(dict, instance, channel_name);
       }
     } else {
-      auto result = instance.query(k_calculate_lag_query);
-      auto row = result->fetch_one_named();
-      if (row) {
-        std::string lag = row.get_string("cluster_member_lag", "");
-
-        if (lag == "null" || lag.empty()) {
-          (*dict)["replicationLag"] = shcore::Value::Null();
-        } else {
-          (*dict)["replicationLag"] = shcore::Value(lag);
-        }
-      }
+      feed_replication_lag(dict, instance);
     }
   }
 
 #undef TSDIFF
 }
 
+void Status::feed_replication_lag(shcore::Dictionary_t dict,
+                                  const mysqlsh::dba::Instance &instance) {
+  auto result = instance.query(k_calculate_lag_query);
+  auto row = result->fetch_one_named();
+  if (row) {
+    std::string lag = row.get_string("cluster_member_lag", "");
+
+    if (lag == "null" || lag.empty()) {
+      (*dict)["replicationLag"] = shcore::Value::Null();
+    } else {
+      (*dict)["replicationLag"] = shcore::Value(lag);
+    }
+  }
+}
+
+void Status::feed_channel_lag(shcore::Dictionary_t dict,
+                              const mysqlsh::dba::Instance &instance,
+                              const std::string &channel_name) {
+  mysqlshdk::mysql::Replication_channel channel;
+
+  if (mysqlshdk::mysql::get_channel_status(instance, channel_name, &channel)) {
+    dict->set("replicationLagFromOriginalSource",
+              shcore::Value(channel.repl_lag_from_original));
+    dict->set("replicationLagFromImmediateSource",
+              shcore::Value(channel.repl_lag_from_immediate));
+  } else {
+    dict->set("replicationLagFromOriginalSource", shcore::Value::Null());
+    dict->set("replicationLagFromImmediateSource", shcore::Value::Null());
+  }
+}
+
 /**
  * Collect per instance replication stats collected from performance_schema
  * tables.
@@ -1518,126 +1545,72 @@ shcore::Dictionary_t Status::get_topology(
   // read-replica when in multi-primary mode
   bool already_feeded_primary = false;
 
-  for (const auto &inst : instances) {
-    shcore::Dictionary_t member = shcore::make_dict();
-    mysqlshdk::gr::Member minfo(get_member(inst.actual_server_uuid));
-    mysqlshdk::gr::Member_state self_state =
-        mysqlshdk::gr::Member_state::MISSING;
+  // Anything which requires the metadata is fetched here, the sessions of the
+  // members are then queried in parallel
+  std::vector<Instance *> sessions;
+  std::vector<mysqlshdk::gr::Member> minfos;
+  std::vector<shcore::Value> join_times;
+  std::vector<Member_probe> probes(instances.size());
 
-    auto &instance = m_member_sessions[inst.md.endpoint];
-
-    std::optional<bool> super_read_only;
-    std::optional<bool> offline_mode;
-    std::vector<std::string> fence_sysvars;
-    bool auto_rejoin = false;
-
-    Replication_channel applier_channel;
-    Replication_channel recovery_channel;
+  sessions.reserve(instances.size());
+  minfos.reserve(instances.size());
+  join_times.resize(instances.size());
 
-    Parallel_applier_options parallel_applier_options;
-
-    if (instance) {
-      // Get the current parallel-applier options
-      parallel_applier_options = Parallel_applier_options(*instance);
+  for (const auto &inst : instances) {
+    const auto index = sessions.size();
+    const auto &instance = m_member_sessions[inst.md.endpoint];
+    auto &minfo = minfos.emplace_back(get_member(inst.actual_server_uuid));
+
+    sessions.emplace_back(instance.get());
+    probes[index].member = shcore::make_dict();
+
+    if (instance && m_extended.has_value() &&
+        minfo.state == Member_state::RECOVERING) {
+      // Get the join timestamp from the Metadata
+      m_cluster->get_metadata_storage()->query_instance_attribute(
+          instance->get_uuid(), k_instance_attribute_join_time,
+          &join_times[index]);
+    }
+  }
 
-      // Get super_read_only value of each instance to set the mode
-      // accurately.
-      super_read_only = instance->get_sysvar_bool("super_read_only");
+  // the ClusterSet role comes from the metadata, which must not be queried by
+  // the threads
+  m_is_cluster_set_member = m_cluster->is_cluster_set_member();
+  m_is_primary_cluster =
+      m_is_cluster_set_member && m_cluster->is_primary_cluster();
 
-      // Get offline_mode value of each instance to set the mode accurately.
-      offline_mode = instance->get_sysvar_bool("offline_mode");
+  const auto probe_errors = for_each_in_parallel(
+      instances.size(), [&](size_t index) {
+        if (const auto instance = sessions[index]; instance) {
+          probe_member(*instance, minfos[index], join_times[index],
+                       &probes[index]);
+        }
+      });
 
-      // Check if auto-rejoin is running.
-      auto_rejoin = mysqlshdk::gr::is_running_gr_auto_rejoin(*instance);
+  for (size_t index = 0; index < instances.size(); ++index) {
+    const auto &inst = instances[index];
 
-      self_state = mysqlshdk::gr::get_member_state(*instance);
+    if (probe_errors[index]) std::rethrow_exception(probe_errors[index]);
 
-      minfo.version = instance->get_version().get_base();
+    auto &probe = probes[index];
+    shcore::Dictionary_t member = probe.member;
+    mysqlshdk::gr::Member minfo(std::move(minfos[index]));
 
-      if (m_extended.has_value()) {
-        if (*m_extended >= 1) {
-          fence_sysvars = instance->get_fence_sysvars();
+    auto &instance = m_member_sessions[inst.md.endpoint];
 
-          const auto &workers =
-              parallel_applier_options.replica_parallel_workers;
-          if (workers.value_or(0) > 0) {
-            (*member)["applierWorkerThreads"] = shcore::Value(*workers);
-          }
-        }
+    const auto &super_read_only = probe.super_read_only;
+    const auto &offline_mode = probe.offline_mode;
+    const auto &fence_sysvars = probe.fence_sysvars;
+    const auto auto_rejoin = probe.auto_rejoin;
+    const auto self_state = probe.self_state;
 
-        if (*m_extended >= 3) {
-          collect_local_status(member, *instance,
-                               minfo.state == Member_state::RECOVERING);
-        }
-        if (minfo.state == Member_state::ONLINE)
-          collect_basic_local_status(member, *instance,
-                                     minfo.role == Member_role::PRIMARY);
-
-        shcore::Value recovery_info;
-        if (minfo.state == Member_state::RECOVERING) {
-          std::string status;
-          // Get the join timestamp from the Metadata
-          shcore::Value join_time;
-          m_cluster->get_metadata_storage()->query_instance_attribute(
-              instance->get_uuid(), k_instance_attribute_join_time, &join_time);
-
-          std::tie(status, recovery_info) =
-              recovery_status(*instance, join_time.get_type() == shcore::String
-                                             ? join_time.as_string()
-                                             : "");
-          if (!status.empty()) {
-            (*member)["recoveryStatusText"] = shcore::Value(status);
-          }
-        }
+    const auto &applier_channel = probe.applier_channel;
+    const auto &recovery_channel = probe.recovery_channel;
 
-        // Include recovery channel info if RECOVERING or if there's an error
-        if (mysqlshdk::mysql::get_channel_status(
-                *instance, mysqlshdk::gr::k_gr_recovery_channel,
-                &recovery_channel) &&
-            *m_extended > 0) {
-          if (minfo.state == Member_state::RECOVERING ||
-              recovery_channel.status() != Replication_channel::OFF) {
-            mysqlshdk::mysql::Replication_channel_master_info master_info;
-            mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
-
-            mysqlshdk::mysql::get_channel_info(
-                *instance, mysqlshdk::gr::k_gr_recovery_channel, &master_info,
-                &relay_info);
-
-            if (!recovery_info) recovery_info = shcore::Value::new_map();
-
-            (*recovery_info.as_map())["recoveryChannel"] = shcore::Value(
-                channel_status(&recovery_channel, &master_info, &relay_info, "",
-                               *m_extended - 1, true, false));
-          }
-        }
-        if (recovery_info) (*member)["recovery"] = recovery_info;
-
-        // Include applier channel info ONLINE and channel not ON
-        // or != RECOVERING and channel not OFF
-        if (mysqlshdk::mysql::get_channel_status(
-                *instance, mysqlshdk::gr::k_gr_applier_channel,
-                &applier_channel) &&
-            *m_extended > 0) {
-          if ((self_state == Member_state::ONLINE &&
-               applier_channel.status() != Replication_channel::ON) ||
-              (self_state != Member_state::RECOVERING &&
-               self_state != Member_state::ONLINE &&
-               applier_channel.status() != Replication_channel::OFF)) {
-            mysqlshdk::mysql::Replication_channel_master_info master_info;
-            mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
-
-            mysqlshdk::mysql::get_channel_info(
-                *instance, mysqlshdk::gr::k_gr_applier_channel, &master_info,
-                &relay_info);
-
-            (*member)["applierChannel"] = shcore::Value(
-                channel_status(&applier_channel, &master_info, &relay_info, "",
-                               *m_extended - 1, false, false));
-          }
-        }
-      }
+    const auto &parallel_applier_options = probe.parallel_applier_options;
 
+    if (instance) {
+      minfo.version = std::move(probe.version);
     } else {
       (*member)["shellConnectError"] =
           shcore::Value(m_member_connect_errors[inst.md.endpoint]);
@@ -1740,6 +1713,112 @@ shcore::Dictionary_t Status::get_topology(
   return dict;
 }
 
+void Status::probe_member(const Instance &instance,
+                          const mysqlshdk::gr::Member &minfo,
+                          const shcore::Value &join_time,
+                          Member_probe *probe) {
+  using mysqlshdk::gr::Member_role;
+  using mysqlshdk::gr::Member_state;
+  using mysqlshdk::mysql::Replication_channel;
+
+  // Get the current parallel-applier options
+  probe->parallel_applier_options = Parallel_applier_options(instance);
+
+  // Get super_read_only value of each instance to set the mode
+  // accurately.
+  probe->super_read_only = instance.get_sysvar_bool("super_read_only");
+
+  // Get offline_mode value of each instance to set the mode accurately.
+  probe->offline_mode = instance.get_sysvar_bool("offline_mode");
+
+  // Check if auto-rejoin is running.
+  probe->auto_rejoin = mysqlshdk::gr::is_running_gr_auto_rejoin(instance);
+
+  probe->self_state = mysqlshdk::gr::get_member_state(instance);
+
+  probe->version = instance.get_version().get_base();
+
+  if (m_extended.has_value()) {
+    if (*m_extended >= 1) {
+      probe->fence_sysvars = instance.get_fence_sysvars();
+
+      const auto &workers =
+          probe->parallel_applier_options.replica_parallel_workers;
+      if (workers.value_or(0) > 0) {
+        (*probe->member)["applierWorkerThreads"] = shcore::Value(*workers);
+      }
+    }
+
+    if (*m_extended >= 3) {
+      collect_local_status(probe->member, instance,
+                           minfo.state == Member_state::RECOVERING);
+    }
+    if (minfo.state == Member_state::ONLINE)
+      collect_basic_local_status(probe->member, instance,
+                                 minfo.role == Member_role::PRIMARY);
+
+    shcore::Value recovery_info;
+    if (minfo.state == Member_state::RECOVERING) {
+      std::string status;
+      std::tie(status, recovery_info) =
+          recovery_status(instance, join_time.get_type() == shcore::String
+                                         ? join_time.as_string()
+                                         : "");
+      if (!status.empty()) {
+        (*probe->member)["recoveryStatusText"] = shcore::Value(status);
+      }
+    }
+
+    // Include recovery channel info if RECOVERING or if there's an error
+    if (mysqlshdk::mysql::get_channel_status(
+            instance, mysqlshdk::gr::k_gr_recovery_channel,
+            &probe->recovery_channel) &&
+        *m_extended > 0) {
+      if (minfo.state == Member_state::RECOVERING ||
+          probe->recovery_channel.status() != Replication_channel::OFF) {
+        mysqlshdk::mysql::Replication_channel_master_info master_info;
+        mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
+
+        mysqlshdk::mysql::get_channel_info(
+            instance, mysqlshdk::gr::k_gr_recovery_channel, &master_info,
+            &relay_info);
+
+        if (!recovery_info) recovery_info = shcore::Value::new_map();
+
+        (*recovery_info.as_map())["recoveryChannel"] = shcore::Value(
+            channel_status(&probe->recovery_channel, &master_info,
+                           &relay_info, "", *m_extended - 1, true, false));
+      }
+    }
+    if (recovery_info) (*probe->member)["recovery"] = recovery_info;
+
+    // Include applier channel info ONLINE and channel not ON
+    // or != RECOVERING and channel not OFF
+    if (mysqlshdk::mysql::get_channel_status(
+            instance, mysqlshdk::gr::k_gr_applier_channel,
+            &probe->applier_channel) &&
+        *m_extended > 0) {
+      if ((probe->self_state == Member_state::ONLINE &&
+           probe->applier_channel.status() != Replication_channel::ON) ||
+          (probe->self_state != Member_state::RECOVERING &&
+           probe->self_state != Member_state::ONLINE &&
+           probe->applier_channel.status() != Replication_channel::OFF)) {
+        mysqlshdk::mysql::Replication_channel_master_info master_info;
+        mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
+
+        mysqlshdk::mysql::get_channel_info(
+            instance, mysqlshdk::gr::k_gr_applier_channel, &master_info,
+            &relay_info);
+
+        (*probe->member)["applierChannel"] = shcore::Value(
+            channel_status(&probe->applier_channel, &master_info,
+                           &relay_info, "", *m_extended - 1, false, false));
+      }
+    }
+  }
+
+}
+
 shcore::Dictionary_t Status::collect_replicaset_status() {
   shcore::Dictionary_t tmp = shcore::make_dict();
   shcore::Dictionary_t ret = shcore::make_dict();
@@ -32,9 +32,11 @@
 
 #include "modules/adminapi/cluster/cluster_impl.h"
 #include "modules/adminapi/common/async_topology.h"
+#include "modules/adminapi/common/parallel_applier_options.h"
 #include "modules/command_interface.h"
 #include "mysql/instance.h"
 #include "mysqlshdk/libs/mysql/group_replication.h"
+#include "mysqlshdk/libs/mysql/replication.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
 
 namespace mysqlsh {
@@ -101,6 +103,28 @@ class Status final : public Command_interface {
    */
   void finish() override {}
 
+  /**
+   * Sets the replicationLag of a Cluster member, as seen by its
+   * group_replication_applier channel.
+   */
+  static void feed_replication_lag(shcore::Dictionary_t dict,
+                                   const mysqlsh::dba::Instance &instance);
+
+  /**
+   * Sets the replication lag (from the original and from the immediate
+   * source) of the given channel of a ClusterSet member.
+   */
+  static void feed_channel_lag(shcore::Dictionary_t dict,
+                               const mysqlsh::dba::Instance &instance,
+                               const std::string &channel_name);
+
+  /**
+   * Sets the transaction counters of a member, using a row from
+   * performance_schema.replication_group_member_stats.
+   */
+  static void feed_member_stats(shcore::Dictionary_t dict,
+                                const mysqlshdk::db::Row_by_name &stats);
+
  private:
   std::shared_ptr<Cluster_impl> m_cluster;
 
@@ -118,10 +142,32 @@ class Status final : public Command_interface {
       m_member_connect_errors;
 
   bool m_no_quorum = false;
+  bool m_is_cluster_set_member = false;
+  bool m_is_primary_cluster = false;
   std::optional<int64_t> m_cluster_transaction_size_limit = -1;
 
+  // Data queried from the session of a Cluster member, gathered for all the
+  // members in parallel before the topology is built
+  struct Member_probe {
+    shcore::Dictionary_t member;
+    std::optional<bool> super_read_only;
+    std::optional<bool> offline_mode;
+    std::vector<std::string> fence_sysvars;
+    bool auto_rejoin = false;
+    mysqlshdk::gr::Member_state self_state =
+        mysqlshdk::gr::Member_state::MISSING;
+    std::string version;
+    mysqlshdk::mysql::Replication_channel applier_channel;
+    mysqlshdk::mysql::Replication_channel recovery_channel;
+    Parallel_applier_options parallel_applier_options;
+  };
+
   void connect_to_members();
 
+  void probe_member(const Instance &instance,
+                    const mysqlshdk::gr::Member &minfo,
+                    const shcore::Value &join_time, Member_probe *probe);
+
   shcore::Dictionary_t check_group_status(
       const mysqlsh::dba::Instance &instance,
       const std::vector<mysqlshdk::gr::Member> &members, bool has_quorum);
@@ -169,9 +215,6 @@ class Status final : public Command_interface {
                         bool is_auto_rejoin_running,
                         const shcore::Dictionary_t read_replicas);
 
-  void feed_member_stats(shcore::Dictionary_t dict,
-                         const mysqlshdk::db::Row_by_name &stats);
-
   shcore::Dictionary_t get_topology(
       const std::vector<mysqlshdk::gr::Member> &member_info);
 
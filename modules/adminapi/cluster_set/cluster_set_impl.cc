@@ -534,7 +534,14 @@ std::shared_ptr<Cluster_impl> Cluster_set_impl::get_cluster(
 
 std::shared_ptr<Cluster_impl> Cluster_set_impl::get_cluster_object(
     const Cluster_set_member_metadata &cluster_md, bool allow_unavailable) {
-  auto md = get_metadata_storage();
+  return get_cluster_object(cluster_md,
+                            connect_cluster(cluster_md, allow_unavailable));
+}
+
+Cluster_set_impl::Cluster_sessions Cluster_set_impl::connect_cluster(
+    const Cluster_set_member_metadata &cluster_md, bool allow_unavailable) {
+  Cluster_sessions sessions;
+  sessions.metadata = get_metadata_storage();
 
   auto ipool = current_ipool();
   try {
@@ -555,22 +562,38 @@ std::shared_ptr<Cluster_impl> Cluster_set_impl::get_cluster_object(
         auto md_server =
             Instance::connect(group_server->get_connection_options());
 
-        md = std::make_shared<MetadataStorage>(md_server);
+        sessions.metadata = std::make_shared<MetadataStorage>(md_server);
       }
     }
-    return std::make_shared<Cluster_impl>(
-        shared_from_this(), cluster_md.cluster, group_server, md, availability);
+
+    sessions.group_server = std::move(group_server);
+    sessions.availability = availability;
   } catch (const shcore::Exception &e) {
     if (!allow_unavailable) throw;
 
+    sessions.metadata = get_metadata_storage();
+    sessions.connect_error = e.format();
+  }
+
+  return sessions;
+}
+
+std::shared_ptr<Cluster_impl> Cluster_set_impl::get_cluster_object(
+    const Cluster_set_member_metadata &cluster_md, Cluster_sessions sessions) {
+  if (!sessions.connect_error.empty()) {
     current_console()->print_warning(shcore::str_format(
         "Could not connect to any member of cluster '%s': %s",
-        cluster_md.cluster.cluster_name.c_str(), e.format().c_str()));
+        cluster_md.cluster.cluster_name.c_str(),
+        sessions.connect_error.c_str()));
 
-    return std::make_shared<Cluster_impl>(shared_from_this(),
-                                          cluster_md.cluster, nullptr, md,
-                                          Cluster_availability::UNREACHABLE);
+    return std::make_shared<Cluster_impl>(
+        shared_from_this(), cluster_md.cluster, nullptr, sessions.metadata,
+        Cluster_availability::UNREACHABLE);
   }
+
+  return std::make_shared<Cluster_impl>(
+      shared_from_this(), cluster_md.cluster, sessions.group_server,
+      sessions.metadata, sessions.availability);
 }
 
 Cluster_channel_status Cluster_set_impl::get_replication_channel_status(
@@ -777,19 +800,18 @@ bool Cluster_set_impl::check_gtid_consistency(Cluster_impl *cluster) const {
           *cluster->get_cluster_server(), k_clusterset_async_channel_name);
 
   // exclude gtids from view changes
-  my_gtid_set.subtract(my_gtid_set.get_gtids_from(my_view_change_uuid),
-                       *cluster->get_cluster_server());
+  my_gtid_set.subtract(my_gtid_set.get_gtids_from(my_view_change_uuid));
 
   // exclude gtids that were received by the async channel, just in case we got
   // GTIDs that haven't been exposed to GTID_EXECUTED in the source yet
-  my_gtid_set.subtract(my_received_gtid_set, *cluster->get_cluster_server());
+  my_gtid_set.subtract(my_received_gtid_set);
 
   // always query GTID_EXECUTED from source after replica
   auto source_gtid_set =
       mysqlshdk::mysql::Gtid_set::from_gtid_executed(*get_primary_master());
 
   auto errants = my_gtid_set;
-  errants.subtract(source_gtid_set, *cluster->get_cluster_server());
+  errants.subtract(source_gtid_set);
 
   if (!errants.empty()) {
     log_warning(
@@ -2592,7 +2614,7 @@ void Cluster_set_impl::reconcile_view_change_gtids(
     gtid_set =
         Gtid_set::from_gtid_executed(*replica).get_gtids_from(view_change_uuid);
 
-    gtid_set.subtract(primary_gtid_set, *replica);
+    gtid_set.subtract(primary_gtid_set);
   }
 
   log_info(
@@ -2768,7 +2790,7 @@ void Cluster_set_impl::check_gtid_set_most_recent(
 
         auto view_changes = gtid_set.get_gtids_from(uuid);
         if (out_view_changes) *out_view_changes = view_changes;
-        return gtid_set.subtract(view_changes, *instance);
+        return gtid_set.subtract(view_changes);
       };
 
   mysqlshdk::mysql::Gtid_set promoted_view_changes;
@@ -2785,13 +2807,13 @@ void Cluster_set_impl::check_gtid_set_most_recent(
     if (primary->get_uuid() != promoted->get_uuid()) {
       auto gtid_set = get_filtered_gtid_set(primary.get(), nullptr);
 
-      gtid_set.subtract(promoted_view_changes, *promoted);
+      gtid_set.subtract(promoted_view_changes);
 
-      if (!promoted_gtid_set.contains(gtid_set, *promoted)) {
+      if (!promoted_gtid_set.contains(gtid_set)) {
         console->print_note("Cluster " + i->get_name() +
                             " has a more up-to-date GTID set");
 
-        promoted_gtid_set.subtract(gtid_set, *promoted);
+        promoted_gtid_set.subtract(gtid_set);
 
         console->print_info(
             "The following GTIDs are missing from the target cluster: " +
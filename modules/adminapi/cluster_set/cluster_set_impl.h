@@ -248,6 +248,30 @@ class Cluster_set_impl : public Base_cluster_impl,
       const Cluster_set_member_metadata &cluster_md,
       bool allow_unavailable = false);
 
+  /**
+   * Sessions used to create the object of a Cluster of the ClusterSet.
+   */
+  struct Cluster_sessions {
+    std::shared_ptr<Instance> group_server;
+    std::shared_ptr<MetadataStorage> metadata;
+    Cluster_availability availability = Cluster_availability::UNREACHABLE;
+    // set if none of the members could be reached
+    std::string connect_error;
+  };
+
+  /**
+   * Connects to the primary member of the given Cluster (or to the best
+   * available member, if allow_unavailable is true).
+   *
+   * Only uses the metadata cached by the current instance pool, so it can be
+   * called for several Clusters at the same time, from different threads.
+   */
+  Cluster_sessions connect_cluster(
+      const Cluster_set_member_metadata &cluster_md, bool allow_unavailable);
+
+  std::shared_ptr<Cluster_impl> get_cluster_object(
+      const Cluster_set_member_metadata &cluster_md, Cluster_sessions sessions);
+
   void reconcile_view_change_gtids(
       mysqlshdk::mysql::IInstance *replica,
       const mysqlshdk::mysql::Gtid_set &missing_view_gtids = {});
@@ -22,11 +22,14 @@
  */
 
 #include <algorithm>
+#include <exception>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "modules/adminapi/cluster_set/status.h"
 #include "modules/adminapi/common/common_status.h"
+#include "modules/adminapi/common/instance_pool.h"
 #include "modules/adminapi/common/sql.h"
 
 namespace mysqlsh {
@@ -35,6 +38,36 @@ namespace clusterset {
 
 namespace {
 
+/**
+ * Creates the objects of the given Clusters. Reaching a Cluster takes a round
+ * trip (or a connect timeout, if it's unreachable) to each of its members that
+ * is tried, so all Clusters are contacted at the same time.
+ */
+std::vector<std::shared_ptr<Cluster_impl>> get_cluster_objects(
+    Cluster_set_impl *cluster_set,
+    const std::vector<Cluster_set_member_metadata> &clusters) {
+  std::vector<Cluster_set_impl::Cluster_sessions> sessions(clusters.size());
+
+  const auto errors =
+      for_each_in_parallel(clusters.size(), [&](std::size_t index) {
+        sessions[index] = cluster_set->connect_cluster(clusters[index], true);
+      });
+
+  for (const auto &error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+
+  std::vector<std::shared_ptr<Cluster_impl>> objects;
+  objects.reserve(clusters.size());
+
+  for (std::size_t index = 0; index < clusters.size(); ++index) {
+    objects.emplace_back(cluster_set->get_cluster_object(
+        clusters[index], std::move(sessions[index])));
+  }
+
+  return objects;
+}
+
 shcore::Array_t cluster_diagnostics(
     Cluster_impl *primary_cluster, Cluster_impl *cluster,
     const mysqlshdk::mysql::Replication_channel &channel,
@@ -289,21 +322,19 @@ void check_cluster_consistency(
     const mysqlshdk::mysql::Gtid_set &cluster_received_gtid,
     const std::vector<std::string> &view_change_uuids,
     const mysqlshdk::mysql::Gtid_set &primary_gtid, int extended) {
-  auto cluster_server = cluster->get_cluster_server();
-
   mysqlshdk::mysql::Gtid_set gtid_missing = primary_gtid;
-  gtid_missing.subtract(cluster_gtid, *cluster_server);
+  gtid_missing.subtract(cluster_gtid);
 
   mysqlshdk::mysql::Gtid_set gtid_errant = cluster_gtid;
 
   // filter out GTIDs received via clusterset AR channel, so that we don't
   // report transactions that were already replicated but not yet exposed to
   // GTID_EXECUTED at the source (can happen if the primary has very high load)
-  gtid_errant.subtract(cluster_received_gtid, *cluster_server);
+  gtid_errant.subtract(cluster_received_gtid);
 
   for (const auto &uuid : view_change_uuids)
-    gtid_errant.subtract(gtid_errant.get_gtids_from(uuid), *cluster_server);
-  gtid_errant.subtract(primary_gtid, *cluster_server);
+    gtid_errant.subtract(gtid_errant.get_gtids_from(uuid));
+  gtid_errant.subtract(primary_gtid);
 
   if (extended > 0 || !gtid_errant.empty()) {
     status->set("transactionSetConsistencyStatus",
@@ -383,8 +414,11 @@ shcore::Dictionary_t cluster_set_status(Cluster_set_impl *cluster_set,
 
     std::vector<std::string> view_change_uuids;
 
-    for (const auto &cluster_md : clusters) {
-      auto cluster = cluster_set->get_cluster_object(cluster_md, true);
+    const auto cluster_objects = get_cluster_objects(cluster_set, clusters);
+
+    for (std::size_t index = 0; index < clusters.size(); ++index) {
+      const auto &cluster_md = clusters[index];
+      const auto &cluster = cluster_objects[index];
       auto cl_status = cluster_set->get_cluster_global_status(cluster.get());
 
       mysqlshdk::mysql::Gtid_set gtid_executed;
@@ -554,11 +588,14 @@ shcore::Dictionary_t cluster_set_describe(Cluster_set_impl *cluster_set) {
       cluster_set->get_id(), true, &cset, &clusters);
 
   // Populate each Cluster with its description
-  for (const auto &cluster_md : clusters) {
-    auto cluster = cluster_set->get_cluster_object(cluster_md, true);
+  const auto cluster_objects = get_cluster_objects(cluster_set, clusters);
+
+  for (std::size_t index = 0; index < clusters.size(); ++index) {
+    const auto &cluster = cluster_objects[index];
 
-    clusters_description->set(cluster->get_name(),
-                              cluster_description(cluster_md, cluster.get()));
+    clusters_description->set(
+        cluster->get_name(),
+        cluster_description(clusters[index], cluster.get()));
   }
 
   dict->set("clusters", shcore::Value(clusters_description));
@@ -43,6 +43,7 @@
 #include "modules/adminapi/common/server_features.h"
 #include "modules/adminapi/common/setup_account.h"
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/mysql/group_replication.h"
 #include "mysqlshdk/libs/mysql/replication.h"
 #include "mysqlshdk/libs/mysql/utils.h"
@@ -93,6 +94,30 @@ Base_cluster_impl::~Base_cluster_impl() { disconnect_internal(); }
 
 void Base_cluster_impl::disconnect() { disconnect_internal(); }
 
+std::shared_ptr<Instance_pool> Base_cluster_impl::get_instance_pool(
+    bool interactive) {
+  const auto max_idle = current_shell_options()->get().dba_pool_idle_timeout;
+
+  if (max_idle <= 0) {
+    m_ipool.reset();
+
+    auto ipool = std::make_shared<Instance_pool>(interactive);
+    ipool->set_default_auth_options(default_admin_credentials());
+    return ipool;
+  }
+
+  if (m_ipool) {
+    m_ipool->set_allow_password_prompt(interactive);
+    m_ipool->recycle(std::chrono::seconds(max_idle));
+  } else {
+    m_ipool = std::make_shared<Instance_pool>(interactive);
+    m_ipool->set_keep_sessions(true);
+  }
+
+  m_ipool->set_default_auth_options(default_admin_credentials());
+  return m_ipool;
+}
+
 void Base_cluster_impl::target_server_invalidated() {
   if (m_cluster_server && m_primary_master) {
     m_cluster_server->release();
@@ -1130,6 +1155,8 @@ void Base_cluster_impl::disconnect_internal() {
   if (m_metadata_storage) {
     m_metadata_storage.reset();
   }
+
+  m_ipool.reset();
 }
 
 void Base_cluster_impl::set_routing_option(const std::string &router,
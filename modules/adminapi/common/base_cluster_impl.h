@@ -44,6 +44,8 @@
 namespace mysqlsh {
 namespace dba {
 
+class Instance_pool;
+
 // User provided option for telling us to assume that the cluster was created
 // with a server where the full update history is reflected in its GTID set
 inline constexpr std::string_view k_cluster_attribute_assume_gtid_set_complete{
@@ -138,6 +140,15 @@ class Base_cluster_impl {
     return m_admin_credentials;
   }
 
+  /**
+   * Returns the pool of sessions to be used by an operation on this object.
+   *
+   * A new pool is created for each operation, unless the dba.poolIdleTimeout
+   * option is set, in which case the pool is kept between the operations and
+   * its idle sessions are reused.
+   */
+  std::shared_ptr<Instance_pool> get_instance_pool(bool interactive);
+
   virtual std::tuple<mysqlsh::dba::Instance *, mysqlshdk::mysql::Lock_scoped>
   acquire_primary_locked(
       [[maybe_unused]] mysqlshdk::mysql::Lock_mode mode,
@@ -302,6 +313,9 @@ class Base_cluster_impl {
 
   mysqlshdk::mysql::Auth_options m_admin_credentials;
 
+  // pool of sessions kept between the operations
+  std::shared_ptr<Instance_pool> m_ipool;
+
   enum class Setup_account_type { ADMIN, ROUTER };
 
   void setup_account_common(const std::string &username,
@@ -1920,7 +1920,7 @@ bool wait_for_gtid_set_safe(const mysqlshdk::mysql::IInstance &target_instance,
         mysqlshdk::mysql::Gtid_set::from_gtid_executed(target_instance);
 
     return mysqlshdk::mysql::estimate_gtid_set_size(
-        gtid_set_primary.subtract(gtid_set_target, target_instance).str());
+        gtid_set_primary.subtract(gtid_set_target).str());
   };
 
   using Progress_reporting = Shell_options::Storage::Progress_reporting;
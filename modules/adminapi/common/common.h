@@ -269,6 +269,7 @@ inline constexpr const char kRecoveryProgress[] = "recoveryProgress";
 inline constexpr const char kLabel[] = "label";
 inline constexpr const char kExtended[] = "extended";
 inline constexpr const char kQueryMembers[] = "queryMembers";
+inline constexpr const char kRefreshInterval[] = "refreshInterval";
 inline constexpr const char kOnlyUpgradeRequired[] = "onlyUpgradeRequired";
 inline constexpr const char kUpdate[] = "update";
 inline constexpr const char kUpdateTopologyMode[] = "updateTopologyMode";
@@ -23,10 +23,12 @@
 
 #include "modules/adminapi/common/global_topology.h"
 #include <algorithm>
+#include <exception>
 #include <list>
 #include <vector>
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/dba_errors.h"
+#include "modules/adminapi/common/instance_pool.h"
 #include "modules/adminapi/common/metadata_storage.h"
 #include "modules/adminapi/common/parallel_applier_options.h"
 #include "mysqlshdk/include/scripting/types.h"
@@ -422,15 +424,21 @@ void Global_topology::check_gtid_consistency(bool use_configured_primary) {
   // check that slaves have fewer transactions than the PRIMARY
   if (use_configured_primary) master_node = get_primary_master_node();
 
-  for (Node *node : nodes()) {
-    if (!use_configured_primary) master_node = node->master_node_ptr;
+  const std::vector<Node *> all_nodes(nodes().begin(), nodes().end());
 
-    if (master_node && master_node != node) {
-      if (master_node->get_primary_member()->executed_gtid_set.has_value() &&
+  // every node only updates its own errant transaction info, so all of them
+  // can be compared with their sources at the same time
+  for_each_in_parallel(all_nodes.size(), [&](std::size_t index) {
+    Node *node = all_nodes[index];
+    const Node *source_node =
+        use_configured_primary ? master_node : node->master_node_ptr;
+
+    if (source_node && source_node != node) {
+      if (source_node->get_primary_member()->executed_gtid_set.has_value() &&
           node->get_primary_member()->executed_gtid_set.has_value()) {
         try {
           Scoped_instance master(ipool->connect_unchecked_endpoint(
-              master_node->get_primary_member()->endpoint));
+              source_node->get_primary_member()->endpoint));
 
           std::string errant_gtids = master->queryf_one_string(
               0, "", "SELECT GTID_SUBTRACT(?, @@global.gtid_executed)",
@@ -440,7 +448,7 @@ void Global_topology::check_gtid_consistency(bool use_configured_primary) {
               mysqlshdk::mysql::estimate_gtid_set_size(errant_gtids);
 
           log_debug("GTIDs that exist in %s but not its source %s: '%s' (%zi)",
-                    node->label.c_str(), master_node->label.c_str(),
+                    node->label.c_str(), source_node->label.c_str(),
                     errant_gtids.c_str(), gtid_diff_size);
 
           node->errant_transactions = errant_gtids;
@@ -451,7 +459,7 @@ void Global_topology::check_gtid_consistency(bool use_configured_primary) {
         }
       }
     }
-  }
+  });
 }
 
 // -----------------------------------------------------------------------------
@@ -628,8 +636,18 @@ void Server_global_topology::check_server(Instance_id id, bool /*deep*/) {
 }
 
 void Server_global_topology::check_servers(bool deep) {
-  for (Server &g : m_servers) {
-    check_server(g.instance_id, deep);
+  std::vector<Instance_id> ids;
+  ids.reserve(m_servers.size());
+
+  for (const Server &g : m_servers) ids.push_back(g.instance_id);
+
+  // each server is checked using its own session, unreachable servers are
+  // waited for at the same time
+  const auto errors = for_each_in_parallel(
+      ids.size(), [&](std::size_t index) { check_server(ids[index], deep); });
+
+  for (const auto &error : errors) {
+    if (error) std::rethrow_exception(error);
   }
 
   // resolve cross-references across groups
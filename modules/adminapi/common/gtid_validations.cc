@@ -603,12 +603,12 @@ std::string get_only_view_change_gtids(
       replica.get_sysvar_string("group_replication_view_change_uuid", "");
 
   auto orig_gtids = Gtid_set::from_string(gtids);
-  orig_gtids.normalize(source);
+  orig_gtids.normalize();
 
   auto s_gtids = orig_gtids.get_gtids_from(s_vc);
   auto r_gtids = orig_gtids.get_gtids_from(r_vc);
 
-  return s_gtids.add(r_gtids).normalize(source).str();
+  return s_gtids.add(r_gtids).normalize().str();
 }
 
 mysqlshdk::mysql::Replica_gtid_state check_replica_group_gtid_state(
@@ -623,7 +623,7 @@ mysqlshdk::mysql::Replica_gtid_state check_replica_group_gtid_state(
 
   auto filter_vcle = [&replica](Gtid_set gtid,
                                 const std::string &view_change_uuid) {
-    return gtid.subtract(gtid.get_gtids_from(view_change_uuid), replica);
+    return gtid.subtract(gtid.get_gtids_from(view_change_uuid));
   };
 
   // Note: always query GTID_EXECUTED from the replica first to avoid races
@@ -36,6 +36,7 @@
 #include "mysqlshdk/include/scripting/types.h"  // exceptions
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/db/replay/setup.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/utils/debug.h"
 
@@ -443,6 +444,7 @@ Instance_pool::~Instance_pool() {
     }
 #endif
 
+    inst.instance->m_pool = nullptr;
     inst.instance->close_session();
   }
   m_pool.clear();
@@ -558,14 +560,19 @@ std::shared_ptr<Instance> Instance_pool::adopt(
 std::shared_ptr<Instance> Instance_pool::connect_unchecked(
     const mysqlshdk::db::Connection_options &opts) {
   DBUG_TRACE;
-  for (auto &inst : m_pool) {
-    if (!inst.leased && inst.instance->get_connection_options() == opts) {
-      inst.leased = true;
-      return inst.instance;
-    }
+  if (auto instance = lease_idle_instance([&opts](const Instance &i) {
+        return i.get_connection_options() == opts;
+      })) {
+    return instance;
   }
 
-  return Instance::connect(opts, m_allow_password_prompt);
+  if (!m_keep_sessions) return Instance::connect(opts, m_allow_password_prompt);
+
+  auto instance = std::make_shared<Instance>(
+      this, connect_session(opts, m_allow_password_prompt));
+  instance->prepare_session();
+
+  return add_leased_instance(std::move(instance));
 }
 
 std::shared_ptr<Instance> Instance_pool::connect_unchecked_endpoint(
@@ -600,14 +607,13 @@ std::shared_ptr<Instance> Instance_pool::connect_unchecked_uuid(
   DBUG_TRACE;
   Auth_options auth = m_default_auth_opts;
 
-  for (auto &inst : m_pool) {
-    Auth_options iauth;
-    iauth.get(inst.instance->get_connection_options());
+  if (auto instance = lease_idle_instance([&uuid, &auth](const Instance &i) {
+        Auth_options iauth;
+        iauth.get(i.get_connection_options());
 
-    if (!inst.leased && inst.instance->get_uuid() == uuid && iauth == auth) {
-      inst.leased = true;
-      return inst.instance;
-    }
+        return i.get_uuid() == uuid && iauth == auth;
+      })) {
+    return instance;
   }
 
   for (const auto &inst : m_mdcache->instances) {
@@ -718,7 +724,7 @@ std::shared_ptr<Instance> Instance_pool::connect_group_primary(
     // first try to find someone that was the primary last time we saw it
     for (const auto &i : m_mdcache->instances) {
       if (i.group_name == group_name) {
-        if (m_recent_primaries.find(i.uuid) != m_recent_primaries.end()) {
+        if (is_recent_primary(i.uuid)) {
           // instance was a PRIMARY last time we saw it, try using it as a
           // starting point to find the current PRIMARY
           try {
@@ -1029,15 +1035,15 @@ std::shared_ptr<Instance> Instance_pool::try_connect_primary_through_member(
         if (m.uuid == member_uuid) {
           // if this member is a primary, return it
           if (m.role == mysqlshdk::gr::Member_role::PRIMARY) {
-            m_recent_primaries.insert(member_uuid);
+            set_recent_primary(member_uuid, true);
             return instance;
           }
           // otherwise, we remove from list of recent primaries
-          m_recent_primaries.erase(member_uuid);
+          set_recent_primary(member_uuid, false);
         } else {
           // new primary is in the list of peers, return a session to it
           if (m.role == mysqlshdk::gr::Member_role::PRIMARY) {
-            m_recent_primaries.insert(m.uuid);
+            set_recent_primary(m.uuid, true);
             instance->release();
             // we don't need to check if the target is a member because we
             // just checked it from this fresh member list... there's a race
@@ -1098,23 +1104,101 @@ std::shared_ptr<Instance> Instance_pool::add_leased_instance(
   Pool_entry entry;
   entry.instance = instance;
   entry.leased = true;
+
+  std::lock_guard lock(m_mutex);
   m_pool.emplace_back(entry);
   return instance;
 }
 
 void Instance_pool::return_instance(Instance *instance) {
   DBUG_TRACE;
+  std::lock_guard lock(m_mutex);
+
   for (auto i = m_pool.begin(); i != m_pool.end(); ++i) {
     if (i->instance.get() == instance) {
       if (!i->leased) throw std::logic_error("Returning unleased instance");
       i->leased = false;
+      i->idle_since = std::chrono::steady_clock::now();
       break;
     }
   }
 }
 
+std::shared_ptr<Instance> Instance_pool::lease_idle_instance(
+    const std::function<bool(const Instance &)> &match) {
+  std::shared_ptr<Instance> instance;
+  bool check = false;
+
+  {
+    std::lock_guard lock(m_mutex);
+
+    for (auto &entry : m_pool) {
+      if (entry.leased || !match(*entry.instance)) continue;
+
+      entry.leased = true;
+      // the session was idle while no operation was using the pool (it may
+      // have been closed by the server in the meantime) or it was closed by
+      // its previous user
+      check = entry.idle_since <= m_recycled_at ||
+              !entry.instance->get_session()->is_open();
+      instance = entry.instance;
+      break;
+    }
+  }
+
+  if (!instance || !check) return instance;
+
+  try {
+    instance->reconnect_if_needed("Pooled");
+  } catch (const std::exception &e) {
+    log_info("Discarding pooled session to %s: %s", instance->descr().c_str(),
+             e.what());
+    instance->steal();
+    instance->close_session();
+
+    return lease_idle_instance(match);
+  }
+
+  return instance;
+}
+
+void Instance_pool::recycle(std::chrono::seconds max_idle) {
+  DBUG_TRACE;
+  const auto now = std::chrono::steady_clock::now();
+
+  std::lock_guard lock(m_mutex);
+
+  for (auto i = m_pool.begin(); i != m_pool.end();) {
+    if (i->leased && i->instance.use_count() == 1) {
+      // the previous operation dropped the session without releasing it
+      i->instance->refresh();
+      i->leased = false;
+      i->idle_since = now;
+    }
+
+    if (!i->leased && now - i->idle_since > max_idle) {
+      log_debug("Closing pooled session to %s, idle for more than %ds",
+                i->instance->descr().c_str(),
+                static_cast<int>(max_idle.count()));
+      i->instance->close_session();
+      i = m_pool.erase(i);
+    } else {
+      ++i;
+    }
+  }
+
+  // state of the previous operation
+  m_metadata.reset();
+  m_mdcache->instances.clear();
+  m_mdcache->clusters.clear();
+  m_recent_primaries.clear();
+  m_recycled_at = now;
+}
+
 std::shared_ptr<Instance> Instance_pool::forget_instance(Instance *instance) {
   DBUG_TRACE;
+  std::lock_guard lock(m_mutex);
+
   for (auto i = m_pool.begin(); i != m_pool.end(); ++i) {
     if (i->instance.get() == instance) {
       auto ptr = i->instance;
@@ -1125,6 +1209,20 @@ std::shared_ptr<Instance> Instance_pool::forget_instance(Instance *instance) {
   throw std::logic_error("Trying to steal non-managed instance");
 }
 
+bool Instance_pool::is_recent_primary(const std::string &uuid) const {
+  std::lock_guard lock(m_mutex);
+  return m_recent_primaries.find(uuid) != m_recent_primaries.end();
+}
+
+void Instance_pool::set_recent_primary(const std::string &uuid, bool primary) {
+  std::lock_guard lock(m_mutex);
+
+  if (primary)
+    m_recent_primaries.insert(uuid);
+  else
+    m_recent_primaries.erase(uuid);
+}
+
 std::string Instance_pool::label_for_server_uuid(const std::string &uuid) {
   DBUG_TRACE;
   for (const auto &i : m_mdcache->instances) {
@@ -1177,6 +1275,17 @@ std::shared_ptr<Instance_pool> current_ipool() {
   return g_ipool_storage.get();
 }
 
+std::size_t parallel_thread_count(std::size_t count) {
+  if (mysqlshdk::db::replay::g_replay_mode !=
+      mysqlshdk::db::replay::Mode::Direct)
+    return 1;
+
+  const auto max_concurrency = static_cast<std::size_t>(
+      current_shell_options()->get().dba_max_concurrency);
+
+  return std::min(count, max_concurrency);
+}
+
 [[nodiscard]] mysqlshdk::mysql::Lock_scoped_list get_instance_lock_shared(
     const std::list<std::shared_ptr<Instance>> &instances,
     std::chrono::seconds timeout, std::string_view skip_uuid) {
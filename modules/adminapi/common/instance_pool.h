@@ -24,10 +24,16 @@
 #ifndef MODULES_ADMINAPI_COMMON_INSTANCE_POOL_H_
 #define MODULES_ADMINAPI_COMMON_INSTANCE_POOL_H_
 
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "modules/adminapi/common/cluster_types.h"
@@ -228,6 +234,10 @@ struct Scoped_instance final {
  * connections is about to start. The pool will provide sessions as they're
  * acquired, automatically creating or recycling them as needed. All sessions
  * are closed when the pool is destroyed (after the task is done).
+ *
+ * A pool can also be kept by a Cluster, ClusterSet or ReplicaSet object between
+ * operations (see dba.poolIdleTimeout), in which case recycle() has to be
+ * called before it's used by another operation.
  */
 class Instance_pool final {
  public:
@@ -235,6 +245,16 @@ class Instance_pool final {
 
   explicit Instance_pool(bool allow_password_prompt);
 
+  void set_allow_password_prompt(bool allow) {
+    m_allow_password_prompt = allow;
+  }
+
+  /**
+   * If set, new sessions are owned by the pool and returned to it once they're
+   * no longer used, instead of being closed.
+   */
+  void set_keep_sessions(bool keep) { m_keep_sessions = keep; }
+
   void set_default_auth_options(Auth_options auth_opts);
 
   const Auth_options &default_auth_opts() const { return m_default_auth_opts; }
@@ -298,6 +318,17 @@ class Instance_pool final {
 
   void refresh_metadata_cache();
 
+  /**
+   * Prepares a pool which is kept between operations to be used by a new one.
+   *
+   * Sessions which are still leased, but no longer referenced outside of the
+   * pool, are returned to it. Closes the idle sessions which were not used for
+   * longer than max_idle. The remaining idle sessions are checked (and
+   * reconnected if needed) the next time they are leased. The metadata has to
+   * be set again.
+   */
+  void recycle(std::chrono::seconds max_idle);
+
  private:
   std::shared_ptr<MetadataStorage> m_metadata;
 
@@ -305,8 +336,12 @@ class Instance_pool final {
   struct Pool_entry {
     std::shared_ptr<Instance> instance;
     bool leased = false;
+    std::chrono::steady_clock::time_point idle_since;
   };
 
+  std::shared_ptr<Instance> lease_idle_instance(
+      const std::function<bool(const Instance &)> &match);
+
   std::shared_ptr<Instance> add_leased_instance(
       std::shared_ptr<Instance> instance);
   void return_instance(Instance *instance);
@@ -314,19 +349,29 @@ class Instance_pool final {
 
   std::string label_for_server_uuid(const std::string &uuid);
 
+  bool is_recent_primary(const std::string &uuid) const;
+  void set_recent_primary(const std::string &uuid, bool primary);
+
   std::shared_ptr<Instance> try_connect_primary_through_member(
       const std::string &member_uuid);
 
   void set_auth_opts(const Auth_options &auth,
                      mysqlshdk::db::Connection_options *opts);
 
+  // guards m_pool and m_recent_primaries, sessions may be acquired by several
+  // threads of an operation at the same time
+  mutable std::mutex m_mutex;
   std::list<Pool_entry> m_pool;
   Auth_options m_default_auth_opts;
   struct Metadata_cache;
   Metadata_cache *m_mdcache = nullptr;
   // UUID of servers that were a primary until recently
   std::set<std::string> m_recent_primaries;
+  // sessions which became idle before this point have to be checked before
+  // they're leased again
+  std::chrono::steady_clock::time_point m_recycled_at;
   bool m_allow_password_prompt;
+  bool m_keep_sessions = false;
 };
 
 /**
@@ -413,6 +458,60 @@ std::list<shcore::Dictionary_t> execute_in_parallel(
   return errors;
 }
 
+/**
+ * Returns the number of threads which should be used to process the given
+ * number of instances at the same time (1 means that they should be processed
+ * serially), as limited by the dba.maxConcurrency option.
+ *
+ * When sessions are being recorded or replayed, this is always 1, as the
+ * order in which sessions are created matters.
+ */
+std::size_t parallel_thread_count(std::size_t count);
+
+/**
+ * Calls fn(index) for each index in [0, count), spreading the calls over a
+ * number of threads, so that slow or unreachable instances are waited for at
+ * the same time instead of one after another. Each call must only modify the
+ * data associated with its own index.
+ *
+ * @returns exceptions thrown by each of the calls (nullptr if call succeeded).
+ */
+template <typename F>
+std::vector<std::exception_ptr> for_each_in_parallel(std::size_t count,
+                                                     F &&fn) {
+  std::vector<std::exception_ptr> errors(count);
+
+  const auto call = [&errors, &fn](std::size_t index) {
+    try {
+      fn(index);
+    } catch (...) {
+      errors[index] = std::current_exception();
+    }
+  };
+
+  const auto threads = parallel_thread_count(count);
+
+  if (threads < 2) {
+    for (std::size_t index = 0; index < count; ++index) call(index);
+    return errors;
+  }
+
+  std::atomic<std::size_t> next{0};
+  std::vector<std::thread> workers;
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    workers.emplace_back(spawn_scoped_thread([&next, &call, count]() {
+      mysqlsh::Mysql_thread thdinit;
+
+      for (auto index = next++; index < count; index = next++) call(index);
+    }));
+  }
+
+  for (auto &worker : workers) worker.join();
+
+  return errors;
+}
+
 /**
  * Try to acquire a shared lock on all the given instances.
  *
@@ -22,6 +22,10 @@
  */
 
 #include "modules/adminapi/common/member_recovery_monitoring.h"
+
+#include <algorithm>
+#include <chrono>
+
 #include "modules/adminapi/common/clone_progress.h"
 #include "modules/adminapi/common/dba_errors.h"
 #include "modules/adminapi/common/instance_monitoring.h"
@@ -45,6 +49,49 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
 
 namespace {
 
+/**
+ * Polling interval which starts short and doubles each time it's waited for,
+ * up to the given maximum. Should be reset whenever the polled state changes,
+ * so that the next change is detected quickly, while a state which doesn't
+ * change is queried less and less often.
+ */
+class Poll_interval final {
+ public:
+  Poll_interval(int min_ms, int max_ms)
+      : m_min_ms(min_ms), m_max_ms(std::max(min_ms, max_ms)), m_ms(min_ms) {}
+
+  void reset() { m_ms = m_min_ms; }
+
+  void wait() {
+    shcore::sleep_ms(m_ms);
+    m_ms = std::min(m_ms * 2, m_max_ms);
+  }
+
+ private:
+  int m_min_ms;
+  int m_max_ms;
+  int m_ms;
+};
+
+using Deadline = std::chrono::steady_clock::time_point;
+
+Deadline make_deadline(int timeout_sec) {
+  return std::chrono::steady_clock::now() + std::chrono::seconds(timeout_sec);
+}
+
+/**
+ * @returns number of seconds (rounded up) until the deadline, 0 if it was
+ *          reached.
+ */
+int seconds_left(const Deadline &deadline) {
+  const auto left = deadline - std::chrono::steady_clock::now();
+
+  if (left <= Deadline::duration::zero()) return 0;
+
+  return static_cast<int>(
+      std::chrono::ceil<std::chrono::seconds>(left).count());
+}
+
 void throw_clone_recovery_error(const mysqlshdk::mysql::IInstance &instance,
                                 const std::string &start_time) {
   mysqlshdk::mysql::Clone_status status;
@@ -235,7 +282,9 @@ mysqlshdk::gr::Group_member_recovery_status wait_recovery_start(
   // It's also possible that the target instance restarts during our checks.
   // In that case, the instance may or may not come back.
 
-  timeout_sec = adjust_timeout(timeout_sec, k_recovery_status_poll_interval_ms);
+  const auto deadline = make_deadline(timeout_sec);
+  Poll_interval poll_interval(k_recovery_status_min_poll_interval_ms,
+                              k_recovery_status_poll_interval_ms);
   bool reconnect = true;
 
   Scoped_instance instance;
@@ -246,7 +295,7 @@ mysqlshdk::gr::Group_member_recovery_status wait_recovery_start(
     return true;
   });
 
-  while (timeout_sec > 0 && !stop) {
+  while ((timeout_sec = seconds_left(deadline)) > 0 && !stop) {
     if (reconnect) {
       try {
         instance = Scoped_instance(wait_server_startup(
@@ -275,13 +324,13 @@ mysqlshdk::gr::Group_member_recovery_status wait_recovery_start(
           // client errors are probably a lost connection, which may mean the
           // instance is restarting
           reconnect = true;
+          poll_interval.reset();
         } else {
           throw;
         }
       }
     }
-    shcore::sleep_ms(k_recovery_status_poll_interval_ms);
-    timeout_sec--;
+    poll_interval.wait();
   }
 
   if (stop) throw stop_monitoring();
@@ -293,7 +342,7 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_clone_start(
     const mysqlshdk::db::Connection_options &instance_def,
     const std::string &begin_time, int timeout_sec) {
   // We wait in this loop until something shows up in PFS.clone_status
-  timeout_sec = adjust_timeout(timeout_sec, k_recovery_status_poll_interval_ms);
+  const auto deadline = make_deadline(timeout_sec);
 
   std::shared_ptr<mysqlsh::dba::Instance> out_instance;
 
@@ -305,10 +354,12 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_clone_start(
     return true;
   });
 
-  auto poll_interval_ms = k_recovery_status_poll_interval_ms;
-  DBUG_EXECUTE_IF("clone_rig_poll_interval", { poll_interval_ms = 10; });
+  Poll_interval poll_interval(k_recovery_status_min_poll_interval_ms,
+                              k_recovery_status_poll_interval_ms);
+  DBUG_EXECUTE_IF("clone_rig_poll_interval",
+                  { poll_interval = Poll_interval(10, 10); });
 
-  while (timeout_sec > 0 && !stop) {
+  while ((timeout_sec = seconds_left(deadline)) > 0 && !stop) {
     if (reconnect) {
       try {
         out_instance = wait_server_startup(instance_def, timeout_sec,
@@ -338,14 +389,14 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_clone_start(
           // client errors are probably a lost connection, which may mean the
           // instance is restarting
           reconnect = true;
+          poll_interval.reset();
         } else {
           throw;
         }
       }
     }
 
-    shcore::sleep_ms(poll_interval_ms);
-    timeout_sec--;
+    poll_interval.wait();
   }
 
   if (stop) throw stop_monitoring();
@@ -369,6 +420,9 @@ void monitor_distributed_recovery(const mysqlshdk::mysql::IInstance &instance,
   console->print_info("* Waiting for distributed recovery to finish...");
   bool first = true;
 
+  Poll_interval poll_interval(k_recovery_status_min_poll_interval_ms,
+                              k_recovery_status_max_poll_interval_ms);
+
   std::string last_error_time;
   while (!stop) {
     mysqlshdk::gr::Member_state state =
@@ -389,8 +443,12 @@ void monitor_distributed_recovery(const mysqlshdk::mysql::IInstance &instance,
     } else {
       mysqlshdk::mysql::Replication_channel channel;
 
-      last_error_time =
-          show_distributed_recovery_error(instance, last_error_time, &channel);
+      if (auto error_time = show_distributed_recovery_error(
+              instance, last_error_time, &channel);
+          error_time != last_error_time) {
+        last_error_time = std::move(error_time);
+        poll_interval.reset();
+      }
 
       if (first) {
         console->print_note(
@@ -402,7 +460,7 @@ void monitor_distributed_recovery(const mysqlshdk::mysql::IInstance &instance,
     }
     assert(state == mysqlshdk::gr::Member_state::RECOVERING);
 
-    shcore::sleep_ms(k_recovery_status_poll_interval_ms);
+    poll_interval.wait();
   }
 
   if (stop) throw stop_monitoring();
@@ -459,8 +517,21 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
     return true;
   });
 
-  auto poll_interval_ms = k_clone_status_poll_interval_ms;
-  DBUG_EXECUTE_IF("clone_rig_poll_interval", { poll_interval_ms = 10; });
+  Poll_interval poll_interval(k_recovery_status_min_poll_interval_ms,
+                              k_clone_status_poll_interval_ms);
+  DBUG_EXECUTE_IF("clone_rig_poll_interval",
+                  { poll_interval = Poll_interval(10, 10); });
+
+  // the clone state and stage, the poll interval is reset when they change
+  std::pair<std::string, int> last_stage{"", -1};
+  const auto check_stage = [&last_stage, &poll_interval](
+                               const mysqlshdk::mysql::Clone_status &status) {
+    if (std::pair stage{status.state, status.current_stage()};
+        stage != last_stage) {
+      last_stage = std::move(stage);
+      poll_interval.reset();
+    }
+  };
 
   bool first = true;
   console->print_info("* Waiting for clone to finish...");
@@ -512,7 +583,8 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
       break;
     }
 
-    shcore::sleep_ms(poll_interval_ms);
+    check_stage(status);
+    poll_interval.wait();
   }
   if (stop && !ignore_cancel) throw stop_monitoring();
 
@@ -551,6 +623,8 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
   }
 
   // Wait for clone recovery to finish
+  poll_interval.reset();
+
   while (!stop) {
     mysqlshdk::mysql::Clone_status status;
 
@@ -593,7 +667,9 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
       console->print_info();
       break;
     }
-    shcore::sleep_ms(k_clone_status_poll_interval_ms);
+
+    check_stage(status);
+    poll_interval.wait();
   }
   if (stop && !ignore_cancel) throw stop_monitoring();
 
@@ -618,10 +694,11 @@ void monitor_post_clone_gr_recovery_status(
   mysqlshdk::gr::Group_member_recovery_status rm =
       mysqlshdk::gr::Group_member_recovery_status::UNKNOWN;
 
-  int startup_timeout_iters =
-      adjust_timeout(startup_timeout_sec, k_recovery_status_poll_interval_ms);
+  const auto deadline = make_deadline(startup_timeout_sec);
+  Poll_interval poll_interval(k_recovery_status_min_poll_interval_ms,
+                              k_recovery_status_poll_interval_ms);
 
-  while (startup_timeout_iters > 0 && !stop) {
+  while (seconds_left(deadline) > 0 && !stop) {
     try {
       rm = mysqlshdk::gr::detect_recovery_status(*instance, begin_time);
       if (rm != mysqlshdk::gr::Group_member_recovery_status::CLONE) {
@@ -634,8 +711,7 @@ void monitor_post_clone_gr_recovery_status(
       log_warning("During post-clone recovery start check: %s", err.what());
       throw;
     }
-    shcore::sleep_ms(k_recovery_status_poll_interval_ms);
-    startup_timeout_iters--;
+    poll_interval.wait();
   }
 
   if (stop) throw stop_monitoring();
@@ -34,8 +34,12 @@
 namespace mysqlsh {
 namespace dba {
 
+// State is polled often right after a change and less often while it stays
+// the same (doubling the interval), up to the maximum intervals below.
+constexpr const int k_recovery_status_min_poll_interval_ms = 100;
 constexpr const int k_recovery_status_poll_interval_ms = 1000;
-constexpr const int k_clone_status_poll_interval_ms = 500;
+constexpr const int k_recovery_status_max_poll_interval_ms = 3000;
+constexpr const int k_clone_status_poll_interval_ms = 1000;
 
 class stop_monitoring {};
 class restart_timeout {};
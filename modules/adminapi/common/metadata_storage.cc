@@ -35,6 +35,8 @@
 #include "modules/adminapi/common/router.h"
 #include "modules/adminapi/replica_set/replica_set_impl.h"
 #include "mysql/group_replication.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlsh {
 namespace dba {
@@ -528,8 +530,102 @@ bool MetadataStorage::check_all_members_online() const {
   return ret_val;
 }
 
+struct MetadataStorage::Snapshot_data {
+  explicit Snapshot_data(mysqlshdk::db::IResult *result)
+      : columns(result->get_metadata()),
+        field_names(std::make_shared<mysqlshdk::db::Field_names>(columns)) {
+    while (const auto row = result->fetch_one()) rows.emplace_back(*row);
+  }
+
+  std::vector<mysqlshdk::db::Column> columns;
+  std::shared_ptr<mysqlshdk::db::Field_names> field_names;
+  std::vector<mysqlshdk::db::Row_copy> rows;
+};
+
+/**
+ * Reads the rows of a query result kept by a MetadataStorage::Snapshot.
+ */
+class MetadataStorage::Snapshot_result final : public mysqlshdk::db::IResult {
+ public:
+  explicit Snapshot_result(std::shared_ptr<const Snapshot_data> data)
+      : m_data(std::move(data)) {}
+
+  const mysqlshdk::db::IRow *fetch_one() override {
+    if (m_next < m_data->rows.size()) return &m_data->rows[m_next++];
+    return nullptr;
+  }
+
+  bool next_resultset() override { return false; }
+
+  std::unique_ptr<mysqlshdk::db::Warning> fetch_one_warning() override {
+    return {};
+  }
+
+  int64_t get_auto_increment_value() const override { return 0; }
+
+  bool has_resultset() override { return true; }
+
+  uint64_t get_affected_row_count() const override { return 0; }
+
+  uint64_t get_fetched_row_count() const override { return m_next; }
+
+  uint64_t get_warning_count() const override { return 0; }
+
+  std::string get_info() const override { return {}; }
+
+  const std::vector<std::string> &get_gtids() const override {
+    return m_gtids;
+  }
+
+  const std::vector<mysqlshdk::db::Column> &get_metadata() const override {
+    return m_data->columns;
+  }
+
+  std::shared_ptr<mysqlshdk::db::Field_names> field_names() const override {
+    return m_data->field_names;
+  }
+
+  void buffer() override {}
+
+  void rewind() override { m_next = 0; }
+
+ private:
+  std::shared_ptr<const Snapshot_data> m_data;
+  std::vector<std::string> m_gtids;
+  size_t m_next = 0;
+};
+
+namespace {
+
+bool is_read_only_statement(std::string_view sql) {
+  return shcore::str_ibeginswith(shcore::str_lstrip_view(sql), "SELECT ",
+                                 "SHOW ");
+}
+
+}  // namespace
+
+MetadataStorage::Snapshot::Snapshot(std::shared_ptr<MetadataStorage> md)
+    : m_md(std::move(md)) {
+  ++m_md->m_snapshots;
+}
+
+MetadataStorage::Snapshot::~Snapshot() {
+  if (0 == --m_md->m_snapshots) m_md->m_snapshot.clear();
+}
+
 std::shared_ptr<mysqlshdk::db::IResult> MetadataStorage::execute_sql(
     const std::string &sql) const {
+  const auto from_snapshot = m_snapshots > 0 && is_read_only_statement(sql);
+
+  if (from_snapshot) {
+    if (const auto it = m_snapshot.find(sql); m_snapshot.end() != it) {
+      return std::make_shared<Snapshot_result>(it->second);
+    }
+  } else {
+    // the statement may change the metadata
+    m_snapshot.clear();
+  }
+
   std::shared_ptr<mysqlshdk::db::IResult> ret_val;
 
   try {
@@ -556,6 +652,12 @@ std::shared_ptr<mysqlshdk::db::IResult> MetadataStorage::execute_sql(
     }
   }
 
+  if (from_snapshot && ret_val) {
+    const auto data = std::make_shared<const Snapshot_data>(ret_val.get());
+    m_snapshot.emplace(sql, data);
+    return std::make_shared<Snapshot_result>(data);
+  }
+
   return ret_val;
 }
 
@@ -2563,9 +2665,16 @@ Router_options_metadata fetch_router_options(
 }  // namespace
 
 Router_options_metadata MetadataStorage::get_routing_options(
-    Cluster_type type, const std::string &id) {
+    Cluster_type type, const std::string &id,
+    const std::string &router_label) {
   std::string query;
   std::map<std::string, shcore::Value> option_defaults;
+  // filtering is done by the server, to avoid fetching the options of all the
+  // routers when just one is needed
+  const std::string router_filter =
+      router_label.empty()
+          ? ""
+          : "WHERE concat(r.address, '::', r.router_name) = ? ";
 
   switch (type) {
     case Cluster_type::REPLICATED_CLUSTER:
@@ -2582,8 +2691,8 @@ Router_options_metadata MetadataStorage::get_routing_options(
       query =
           "SELECT concat(r.address, '::', r.router_name) AS router_label" +
           router_opt_select_items("r.options", k_clusterset_router_options) +
-          "FROM mysql_innodb_cluster_metadata.routers AS r UNION SELECT "
-          "NULL" +
+          "FROM mysql_innodb_cluster_metadata.routers AS r " + router_filter +
+          "UNION SELECT NULL" +
           router_opt_select_items("cs.router_options",
                                   k_clusterset_router_options) +
           "FROM mysql_innodb_cluster_metadata.clustersets AS cs WHERE "
@@ -2595,8 +2704,8 @@ Router_options_metadata MetadataStorage::get_routing_options(
 
       query = "SELECT concat(r.address, '::', r.router_name) AS router_label" +
               router_opt_select_items("r.options", k_cluster_router_options) +
-              "FROM mysql_innodb_cluster_metadata.routers AS r UNION SELECT "
-              "NULL" +
+              "FROM mysql_innodb_cluster_metadata.routers AS r " +
+              router_filter + "UNION SELECT NULL" +
               router_opt_select_items("c.router_options",
                                       k_cluster_router_options) +
               "FROM mysql_innodb_cluster_metadata.clusters AS c WHERE "
@@ -2609,8 +2718,8 @@ Router_options_metadata MetadataStorage::get_routing_options(
       query =
           "SELECT concat(r.address, '::', r.router_name) AS router_label" +
           router_opt_select_items("r.options", k_replicaset_router_options) +
-          "FROM mysql_innodb_cluster_metadata.routers AS r UNION SELECT "
-          "NULL" +
+          "FROM mysql_innodb_cluster_metadata.routers AS r " + router_filter +
+          "UNION SELECT NULL" +
           router_opt_select_items("c.router_options",
                                   k_replicaset_router_options) +
           "FROM mysql_innodb_cluster_metadata.clusters AS c WHERE "
@@ -2620,7 +2729,11 @@ Router_options_metadata MetadataStorage::get_routing_options(
       throw std::logic_error("internal error");
   }
 
-  return fetch_router_options(execute_sqlf(query, id), option_defaults);
+  const auto result = router_label.empty()
+                          ? execute_sqlf(query, id)
+                          : execute_sqlf(query, router_label, id);
+
+  return fetch_router_options(result, option_defaults);
 }
 
 shcore::Value MetadataStorage::get_global_routing_option(
@@ -460,8 +460,16 @@ class MetadataStorage {
   std::vector<Router_metadata> get_routers(const Cluster_id &cluster_id);
   std::vector<Router_metadata> get_clusterset_routers(const Cluster_set_id &cs);
 
-  Router_options_metadata get_routing_options(Cluster_type type,
-                                              const std::string &id);
+  /**
+   * Fetches the global routing options and the options of the routers.
+   *
+   * @param type type of the cluster
+   * @param id ID of the cluster
+   * @param router_label if not empty, only options of this router are fetched
+   */
+  Router_options_metadata get_routing_options(
+      Cluster_type type, const std::string &id,
+      const std::string &router_label = {});
 
   std::string get_cluster_name(const std::string &group_replication_group_name);
   std::string get_cluster_group_name(const std::string &cluster_name);
@@ -681,6 +689,30 @@ class MetadataStorage {
 #endif
   };
 
+  /**
+   * While alive, results of the queries which read the metadata are kept in
+   * memory, and the same query executed again is answered without a round
+   * trip to the metadata server. Any other statement executed through the same
+   * object discards all the kept results.
+   *
+   * Meant to be used by the commands which only read the metadata, as changes
+   * made through other sessions are not seen. Snapshots can be nested.
+   */
+  class Snapshot final {
+   public:
+    explicit Snapshot(std::shared_ptr<MetadataStorage> md);
+
+    Snapshot(const Snapshot &) = delete;
+    Snapshot(Snapshot &&) = delete;
+    Snapshot &operator=(const Snapshot &) = delete;
+    Snapshot &operator=(Snapshot &&) = delete;
+
+    ~Snapshot();
+
+   private:
+    std::shared_ptr<MetadataStorage> m_md;
+  };
+
  private:
   void begin_acl_change_record(const Cluster_id &cluster_id,
                                const char *operation, uint32_t *out_aclvid,
@@ -700,6 +732,14 @@ class MetadataStorage {
                                 Transaction_undo *undo);
 
   friend class Transaction;
+  friend class Snapshot;
+
+  struct Snapshot_data;
+  class Snapshot_result;
+
+  int m_snapshots = 0;
+  mutable std::map<std::string, std::shared_ptr<const Snapshot_data>>
+      m_snapshot;
 
   std::shared_ptr<Instance> m_md_server;
   bool m_owns_md_server = false;
@@ -22,6 +22,7 @@
  */
 
 #include <cstring>
+#include <mutex>
 #include <string>
 #include <system_error>
 #include <vector>
@@ -113,8 +114,6 @@ int ProvisioningInterface::execute_mysqlprovision(
   args_script.push_back(cmd.c_str());
   args_script.push_back(NULL);
 
-  setup_recorder_environment(cmd);
-
   // Wrap arguments to be passed to mysqlprovision
   shcore::Value wrapped_args(shcore::Value::new_array());
   shcore::Argument_map kwargs_(kwargs);
@@ -195,7 +194,16 @@ int ProvisioningInterface::execute_mysqlprovision(
   shcore::Process_launcher p(&args_script[0]);
   try {
     stage_action = "starting";
-    p.start();
+
+    {
+      // sandboxes can be deployed from several threads, environment is shared
+      // by the whole process and inherited by the child process when it starts
+      static std::mutex s_start_mutex;
+      std::lock_guard lock{s_start_mutex};
+
+      setup_recorder_environment(cmd);
+      p.start();
+    }
 
     {
       stage_action = "executing";
@@ -154,6 +154,22 @@ shcore::Value clusterset_list_routers(MetadataStorage *md,
   auto router_list = shcore::make_dict();
   auto routers_md = md->get_clusterset_routers(clusterset_id);
   std::vector<std::string> routers_needing_rebootstrap;
+  // names of the Clusters, fetched once instead of a query per each Router
+  std::map<std::string, std::string> cluster_names;
+
+  const auto cluster_name = [md, &cluster_names](const std::string &uuid) {
+    if (cluster_names.empty()) {
+      for (const auto &cluster : md->get_all_clusters(true)) {
+        cluster_names.emplace(cluster.group_name, cluster.cluster_name);
+      }
+    }
+
+    if (const auto it = cluster_names.find(uuid); cluster_names.end() != it) {
+      return it->second;
+    }
+
+    return md->get_cluster_name(uuid);
+  };
 
   for (const auto &router_md : routers_md) {
     auto label = shcore::str_format("%s::%s", router_md.hostname.c_str(),
@@ -169,7 +185,7 @@ shcore::Value clusterset_list_routers(MetadataStorage *md,
       // Translate the Cluster's UUID (group_replication_group_name) to the
       // Cluster's name
       (*r)["targetCluster"] =
-          shcore::Value(md->get_cluster_name(router_md.target_cluster.value()));
+          shcore::Value(cluster_name(router_md.target_cluster.value()));
     } else {
       (*r)["targetCluster"] = shcore::Value(*router_md.target_cluster);
     }
@@ -213,15 +229,15 @@ shcore::Dictionary_t router_options(MetadataStorage *md, Cluster_type type,
                                     const std::string &id,
                                     const std::string &router_label) {
   auto router_options = shcore::make_dict();
-  auto romd = md->get_routing_options(type, id);
+  auto romd = md->get_routing_options(type, id, router_label);
 
   if (Cluster_set_id cs_id;
       (type == Cluster_type::GROUP_REPLICATION) &&
       md->check_cluster_set(nullptr, nullptr, nullptr, &cs_id)) {
     // if the Cluster belongs to a ClusterSet, we need to replace the options in
     // the Cluster with the options in the ClusterSet
-    auto cs_romd =
-        md->get_routing_options(Cluster_type::REPLICATED_CLUSTER, cs_id);
+    auto cs_romd = md->get_routing_options(Cluster_type::REPLICATED_CLUSTER,
+                                           cs_id, router_label);
 
     for (const auto &[option, value] : cs_romd.global) {
       if (option == "tags") continue;
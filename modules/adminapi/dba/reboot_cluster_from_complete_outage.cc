@@ -29,6 +29,7 @@
 #include "modules/adminapi/cluster/rejoin_instance.h"
 #include "modules/adminapi/common/async_topology.h"
 #include "modules/adminapi/common/dba_errors.h"
+#include "modules/adminapi/common/instance_pool.h"
 #include "modules/adminapi/common/preconditions.h"
 #include "modules/adminapi/common/provision.h"
 #include "modules/adminapi/common/server_features.h"
@@ -328,32 +329,54 @@ Reboot_cluster_from_complete_outage::retrieve_instances(
                       get_member_name("forceQuorumUsingPartitionOf",
                                       shcore::current_naming_style()));
 
-  auto instances = m_cluster->impl()->get_instances();
+  std::vector<Instance_metadata> instances;
+  for (auto &i : m_cluster->impl()->get_instances()) {
+    // skip the target
+    if (i.uuid == m_target_instance->get_uuid()) continue;
+    instances.push_back(std::move(i));
+  }
+
+  // connect to and check all the members at the same time, so that the
+  // unreachable ones are waited for only once
+  std::vector<std::shared_ptr<Instance>> sessions(instances.size());
+  std::vector<TargetType::Type> instance_types(instances.size(),
+                                               TargetType::Unknown);
+
+  const auto errors =
+      for_each_in_parallel(instances.size(), [&](std::size_t index) {
+        const auto &i = instances[index];
+
+        try {
+          log_info("Opening a new session to the instance: %s",
+                   i.endpoint.c_str());
+          sessions[index] = m_cluster->impl()->connect_target_instance(
+              i.endpoint, false, false);
+        } catch (const shcore::Error &) {
+          log_info("Unable to open a connection to the instance: %s",
+                   i.endpoint.c_str());
+          return;
+        }
+
+        log_info("Checking state of instance '%s'", i.endpoint.c_str());
+
+        instance_types[index] = check_instance_type(*sessions[index], {});
+      });
 
   std::vector<std::shared_ptr<Instance>> out_instances;
   out_instances.reserve(instances.size());
 
-  for (const auto &i : instances) {
-    // skip the target
-    if (i.uuid == m_target_instance->get_uuid()) continue;
+  for (std::size_t index = 0; index < instances.size(); ++index) {
+    auto &instance = sessions[index];
 
-    std::shared_ptr<Instance> instance;
-    try {
-      log_info("Opening a new session to the instance: %s", i.endpoint.c_str());
-      instance =
-          m_cluster->impl()->connect_target_instance(i.endpoint, false, false);
-    } catch (const shcore::Error &) {
-      log_info("Unable to open a connection to the instance: %s",
-               i.endpoint.c_str());
-      if (instances_unreachable) instances_unreachable->emplace_back(i);
+    if (!instance) {
+      if (instances_unreachable)
+        instances_unreachable->emplace_back(instances[index]);
       continue;
     }
 
-    log_info("Checking state of instance '%s'", i.endpoint.c_str());
+    if (errors[index]) std::rethrow_exception(errors[index]);
 
-    auto instance_type = check_instance_type(*instance, {});
-
-    if (instance_type == TargetType::Standalone) {
+    if (instance_types[index] == TargetType::Standalone) {
       if (!m_options.get_force()) {
         throw shcore::Exception::logic_error(shcore::str_format(
             "The instance '%s' doesn't belong to the Cluster. Use option "
@@ -396,19 +419,23 @@ Reboot_cluster_from_complete_outage::pick_best_instance_gtid(
     if (is_cluster_set_member)
       channels.push_back(k_clusterset_async_channel_name);
 
-    {
-      Instance_gtid_info info;
-      info.server = m_target_instance->get_canonical_address();
-      info.gtid_executed =
-          mysqlshdk::mysql::get_total_gtid_set(*m_target_instance, channels);
-      instance_gtids.push_back(std::move(info));
-    }
+    // the GTID sets of all the instances are read at the same time, the
+    // target being the first one
+    instance_gtids.resize(instances.size() + 1);
+
+    const auto errors =
+        for_each_in_parallel(instance_gtids.size(), [&](std::size_t index) {
+          const auto &instance =
+              index == 0 ? *m_target_instance : *instances[index - 1];
 
-    for (const auto &i : instances) {
-      Instance_gtid_info info;
-      info.server = i->get_canonical_address();
-      info.gtid_executed = mysqlshdk::mysql::get_total_gtid_set(*i, channels);
-      instance_gtids.push_back(std::move(info));
+          auto &info = instance_gtids[index];
+          info.server = instance.get_canonical_address();
+          info.gtid_executed =
+              mysqlshdk::mysql::get_total_gtid_set(instance, channels);
+        });
+
+    for (const auto &error : errors) {
+      if (error) std::rethrow_exception(error);
     }
 
     assert(instance_gtids.size() == (instances.size() + 1));
@@ -1042,8 +1069,19 @@ std::shared_ptr<Cluster> Reboot_cluster_from_complete_outage::do_run() {
     istates.rehash(instances.size() + 1);
     istates[m_target_instance] =
         mysqlshdk::gr::get_member_state(*m_target_instance);
-    for (const auto &i : instances)
-      istates[i] = mysqlshdk::gr::get_member_state(*i);
+    {
+      std::vector<mysqlshdk::gr::Member_state> states(instances.size());
+
+      const auto errors =
+          for_each_in_parallel(instances.size(), [&](std::size_t index) {
+            states[index] = mysqlshdk::gr::get_member_state(*instances[index]);
+          });
+
+      for (std::size_t index = 0; index < instances.size(); ++index) {
+        if (errors[index]) std::rethrow_exception(errors[index]);
+        istates[instances[index]] = states[index];
+      }
+    }
 
     assert(instances.size() == (istates.size() - 1));
 
@@ -1162,9 +1200,17 @@ std::shared_ptr<Cluster> Reboot_cluster_from_complete_outage::do_run() {
             instance, mysqlshdk::gr::k_gr_applier_channel, timeout, false);
       };
 
-      check_cb(*m_target_instance, m_options.get_timeout());
+      // all the instances apply their transactions at the same time, so the
+      // timeout is waited for only once
+      const auto errors =
+          for_each_in_parallel(instances.size() + 1, [&](std::size_t index) {
+            check_cb(index == 0 ? *m_target_instance : *instances[index - 1],
+                     m_options.get_timeout());
+          });
 
-      for (const auto &i : instances) check_cb(*i, m_options.get_timeout());
+      for (const auto &error : errors) {
+        if (error) std::rethrow_exception(error);
+      }
     }
   }
 
@@ -24,6 +24,8 @@
 #include "modules/adminapi/mod_dba.h"
 
 #include <mysqld_error.h>
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 #include "utils/error.h"
@@ -52,6 +54,7 @@
 #include "modules/mod_utils.h"
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/include/shellcore/utils_help.h"
 #include "mysqlshdk/libs/mysql/group_replication.h"
 #include "mysqlshdk/libs/utils/logger.h"
@@ -186,6 +189,151 @@ void throw_instance_op_error(const shcore::Array_t &errors) {
   throw shcore::Exception::runtime_error(shcore::str_join(str_errors, "\n"));
 }
 
+/**
+ * Console which holds the output until it's explicitly flushed, used to keep
+ * the output of operations executed at the same time from being interleaved.
+ * Prompts are forwarded directly to the underlying console.
+ */
+class Console_with_buffer final : public IConsole {
+ public:
+  Console_with_buffer() : m_console(current_console()) {}
+
+  Console_with_buffer(const Console_with_buffer &) = delete;
+  Console_with_buffer(Console_with_buffer &&) = delete;
+
+  Console_with_buffer &operator=(const Console_with_buffer &) = delete;
+  Console_with_buffer &operator=(Console_with_buffer &&) = delete;
+
+  ~Console_with_buffer() override = default;
+
+  void raw_print(const std::string &text, Output_stream stream,
+                 bool format_json = true) const override {
+    buffer([=](const IConsole &c) { c.raw_print(text, stream, format_json); });
+  }
+
+  void print(const std::string &text) const override {
+    buffer([=](const IConsole &c) { c.print(text); });
+  }
+
+  void println(const std::string &text = "") const override {
+    buffer([=](const IConsole &c) { c.println(text); });
+  }
+
+  void print_error(const std::string &text) const override {
+    buffer([=](const IConsole &c) { c.print_error(text); });
+  }
+
+  void print_warning(const std::string &text) const override {
+    buffer([=](const IConsole &c) { c.print_warning(text); });
+  }
+
+  void print_note(const std::string &text) const override {
+    buffer([=](const IConsole &c) { c.print_note(text); });
+  }
+
+  void print_status(const std::string &text) const override {
+    buffer([=](const IConsole &c) { c.print_status(text); });
+  }
+
+  void print_info(const std::string &text = "") const override {
+    buffer([=](const IConsole &c) { c.print_info(text); });
+  }
+
+  void print_para(const std::string &text) const override {
+    buffer([=](const IConsole &c) { c.print_para(text); });
+  }
+
+  void print_value(const shcore::Value &value,
+                   const std::string &tag) const override {
+    buffer([=](const IConsole &c) { c.print_value(value, tag); });
+  }
+
+  void print_diag(const std::string &text) const override {
+    buffer([=](const IConsole &c) { c.print_diag(text); });
+  }
+
+  shcore::Prompt_result prompt(const std::string &prompt,
+                               const shcore::prompt::Prompt_options &options,
+                               std::string *out_val) const override {
+    return m_console->prompt(prompt, options, out_val);
+  }
+
+  shcore::Prompt_result prompt(
+      const std::string &prompt, std::string *out_val,
+      Validator validator = nullptr,
+      shcore::prompt::Prompt_type type = shcore::prompt::Prompt_type::TEXT,
+      const std::string &title = "",
+      const std::vector<std::string> &description = {},
+      const std::string &default_value = "") const override {
+    return m_console->prompt(prompt, out_val, validator, type, title,
+                             description, default_value);
+  }
+
+  Prompt_answer confirm(
+      const std::string &prompt, Prompt_answer def = Prompt_answer::NO,
+      const std::string &yes_label = "&Yes",
+      const std::string &no_label = "&No", const std::string &alt_label = "",
+      const std::string &title = "",
+      const std::vector<std::string> &description = {}) const override {
+    return m_console->confirm(prompt, def, yes_label, no_label, alt_label,
+                              title, description);
+  }
+
+  shcore::Prompt_result prompt_password(
+      const std::string &prompt, std::string *out_val,
+      Validator validator = nullptr, const std::string &title = "",
+      const std::vector<std::string> &description = {}) const override {
+    return m_console->prompt_password(prompt, out_val, validator, title,
+                                      description);
+  }
+
+  bool select(const std::string &prompt_text, std::string *result,
+              const std::vector<std::string> &items, size_t default_option = 0,
+              bool allow_custom = false, Validator validator = nullptr,
+              const std::string &title = "",
+              const std::vector<std::string> &description = {}) const override {
+    return m_console->select(prompt_text, result, items, default_option,
+                             allow_custom, validator, title, description);
+  }
+
+  std::shared_ptr<IPager> enable_pager() override {
+    return m_console->enable_pager();
+  }
+
+  void enable_global_pager() override { m_console->enable_global_pager(); }
+
+  void disable_global_pager() override { m_console->disable_global_pager(); }
+
+  bool is_global_pager_enabled() const override {
+    return m_console->is_global_pager_enabled();
+  }
+
+  void add_print_handler(shcore::Interpreter_print_handler *handler) override {
+    m_console->add_print_handler(handler);
+  }
+
+  void remove_print_handler(
+      shcore::Interpreter_print_handler *handler) override {
+    m_console->remove_print_handler(handler);
+  }
+
+  /**
+   * Writes the buffered output to the underlying console.
+   */
+  void flush() {
+    for (const auto &output : m_output) output(*m_console);
+    m_output.clear();
+  }
+
+ private:
+  void buffer(std::function<void(const IConsole &)> output) const {
+    m_output.emplace_back(std::move(output));
+  }
+
+  std::shared_ptr<IConsole> m_console;
+  mutable std::vector<std::function<void(const IConsole &)>> m_output;
+};
+
 }  // namespace
 
 using mysqlshdk::db::uri::formats::only_transport;
@@ -742,9 +890,15 @@ void Dba::init() {
   expose("checkInstanceConfiguration", &Dba::check_instance_configuration,
          "?instance", "?options")
       ->cli();
+  expose("checkInstancesConfiguration", &Dba::check_instances_configuration,
+         "instances", "?options")
+      ->cli(false);
   expose("deploySandboxInstance", &Dba::deploy_sandbox_instance, "port",
          "?options")
       ->cli();
+  expose("deploySandboxInstances", &Dba::deploy_sandbox_instances, "ports",
+         "?options")
+      ->cli(false);
   expose("startSandboxInstance", &Dba::start_sandbox_instance, "port",
          "?options")
       ->cli();
@@ -1824,6 +1978,182 @@ shcore::Value Dba::check_instance_configuration(
   return Topology_executor<Check_instance>{coptions, options->mycnf_path}.run();
 }
 
+REGISTER_HELP_FUNCTION(checkInstancesConfiguration, dba);
+REGISTER_HELP_FUNCTION_TEXT(DBA_CHECKINSTANCESCONFIGURATION, R"*(
+Validates several instances for MySQL InnoDB Cluster usage at the same time.
+
+@param instances List with the connection options of the target instances.
+@param options Optional data for the operation.
+
+@returns A JSON object with the aggregated result of the validations.
+
+This function performs the same validations as checkInstanceConfiguration()
+on each of the given instances. The instances are validated at the same time,
+with the maximum number of instances being validated at once limited by the
+shell.options["dba.maxConcurrency"] option. The output of the validations is
+printed in the order of the given list, once all of them complete.
+
+A failure to connect to or to validate an instance doesn't interrupt the
+validation of the remaining ones, the error is included in the result instead.
+
+The options dictionary may contain the following options:
+
+@li password: The password to get connected to the instances. Deprecated.
+
+Passwords are not prompted for, they have to be given either in the instance
+definitions or in the password option.
+
+The returned JSON object contains the following attributes:
+
+@li status: "ok" if all instances are valid for InnoDB Cluster usage, "error"
+otherwise.
+@li instances: a dictionary with the result of each instance, which has the
+same attributes as the result of checkInstanceConfiguration(), indexed by the
+instance address. If the instance could not be validated, the result contains
+the "error" attribute with the error message.
+
+@attention The password option will be removed in a future release.
+)*");
+
+/**
+ * $(DBA_CHECKINSTANCESCONFIGURATION_BRIEF)
+ *
+ * $(DBA_CHECKINSTANCESCONFIGURATION)
+ */
+#if DOXYGEN_JS
+JSON Dba::checkInstancesConfiguration(List instances, Dictionary options) {}
+#elif DOXYGEN_PY
+JSON Dba::check_instances_configuration(list instances, dict options) {}
+#endif
+shcore::Value Dba::check_instances_configuration(
+    const shcore::Array_t &instance_defs,
+    const shcore::Option_pack_ref<Check_instance_configuration_options>
+        &options) {
+  if (!instance_defs || instance_defs->empty())
+    throw shcore::Exception::argument_error(
+        "The list of instances cannot be empty.");
+
+  if (!options->mycnf_path.empty())
+    throw shcore::Exception::argument_error(
+        shcore::str_format("The options '%s' and '%s' are not supported when "
+                           "checking several instances.",
+                           kMyCnfPath, kVerifyMyCnf));
+
+  std::vector<Connection_options> targets;
+  std::vector<std::string> addresses;
+
+  for (const shcore::Value &instance_def : *instance_defs) {
+    try {
+      targets.emplace_back(mysqlsh::get_connection_options(instance_def));
+    } catch (const std::exception &err) {
+      throw shcore::Exception::argument_error(shcore::str_format(
+          "Invalid value '%s' in the list of instances: %s",
+          instance_def.descr().c_str(), err.what()));
+    }
+
+    if (targets.back().has_ssh_options())
+      throw shcore::Exception::logic_error(INNODB_SSH_NOT_SUPPORTED);
+
+    if (options->password.has_value())
+      targets.back().set_password(*options->password);
+
+    addresses.push_back(targets.back().uri_endpoint());
+
+    if (std::count(addresses.begin(), addresses.end(), addresses.back()) > 1)
+      throw shcore::Exception::argument_error(
+          "The instance '" + addresses.back() +
+          "' is included more than once in the list of instances.");
+  }
+
+  const auto count = targets.size();
+  std::vector<shcore::Dictionary_t> results(count);
+  std::vector<std::shared_ptr<Console_with_buffer>> consoles(count);
+
+  const auto set_error = [&results](std::size_t index) {
+    results[index] =
+        shcore::make_dict("status", shcore::Value("error"), "error",
+                          shcore::Value(format_active_exception()));
+  };
+
+  // connect to the instances, no password prompts as this is done at the same
+  // time for all of them
+  std::vector<std::shared_ptr<Instance>> instances(count);
+
+  auto errors = for_each_in_parallel(count, [&](std::size_t index) {
+    instances[index] = Instance::connect(targets[index], false);
+  });
+
+  Scoped_instance_pool ipool(
+      current_shell_options()->get().wizards,
+      Instance_pool::Auth_options(targets.front()));
+
+  // the preconditions use the instance pool, which is shared, check them one
+  // instance at a time
+  for (std::size_t i = 0; i < count; ++i) {
+    try {
+      if (errors[i]) std::rethrow_exception(errors[i]);
+
+      check_preconditions("Dba.checkInstanceConfiguration", instances[i]);
+
+      targets[i] = instances[i]->get_connection_options();
+    } catch (...) {
+      set_error(i);
+    }
+
+    if (instances[i]) instances[i]->close_session();
+  }
+
+  instances.clear();
+
+  // the output is buffered, so that it isn't interleaved
+  errors = for_each_in_parallel(count, [&](std::size_t index) {
+    if (results[index]) return;
+
+    consoles[index] = std::make_shared<Console_with_buffer>();
+    Scoped_console console(consoles[index]);
+
+    auto result = Topology_executor<Check_instance>{targets[index], ""}.run();
+    results[index] = result.get_type() == shcore::Map
+                         ? result.as_map()
+                         : shcore::make_dict("status", shcore::Value("ok"));
+  });
+
+  const auto console = current_console();
+  std::size_t valid = 0;
+
+  shcore::Dictionary_t report = shcore::make_dict();
+
+  for (std::size_t i = 0; i < count; ++i) {
+    if (consoles[i]) consoles[i]->flush();
+
+    if (errors[i]) {
+      try {
+        std::rethrow_exception(errors[i]);
+      } catch (...) {
+        set_error(i);
+      }
+    }
+
+    if (results[i]->has_key("error")) {
+      console->print_error("Unable to validate instance '" + addresses[i] +
+                           "': " + results[i]->get_string("error"));
+      console->print_info();
+    } else if (results[i]->get_string("status") == "ok") {
+      ++valid;
+    }
+
+    report->set(addresses[i], shcore::Value(results[i]));
+  }
+
+  console->print_info(shcore::str_format(
+      "%zu out of %zu instances are valid for InnoDB Cluster usage.", valid,
+      count));
+
+  return shcore::Value(shcore::make_dict(
+      "status", shcore::Value(valid == count ? "ok" : "error"), "instances",
+      shcore::Value(report)));
+}
+
 // -----------------------------------------------------------------------------
 
 REGISTER_HELP_FUNCTION(getReplicaSet, dba);
@@ -2280,9 +2610,25 @@ void Dba::deploy_sandbox_instance(
     console->print_info("Deploying new MySQL instance...");
   }
 
+  do_deploy_sandbox(port, opts.xport.get_safe(0), *password, opts);
+
+  if (current_shell_options()->get().wizards) {
+    console->print_info();
+    console->print_info("Instance localhost:" + std::to_string(port) +
+                        " successfully deployed and started.");
+
+    console->print_info(
+        "Use shell.connect('root@localhost:" + std::to_string(port) +
+        "') to connect to the instance.");
+    console->print_info();
+  }
+}
+
+void Dba::do_deploy_sandbox(int port, int xport, const std::string &password,
+                            const Deploy_sandbox_options &opts) {
   shcore::Array_t errors;
   int rc = _provisioning_interface.create_sandbox(
-      port, opts.xport.get_safe(0), options->sandbox_dir, *password,
+      port, xport, opts.sandbox_dir, password,
       shcore::Value(opts.mysqld_options), true, opts.ignore_ssl_error, 0, "",
       &errors);
 
@@ -2297,7 +2643,7 @@ void Dba::deploy_sandbox_instance(
   if (!opts.allow_root_from.empty()) {
     std::string uri = "root@localhost:" + std::to_string(port);
     mysqlshdk::db::Connection_options instance_def(uri);
-    instance_def.set_password(*password);
+    instance_def.set_password(password);
 
     std::shared_ptr<Instance> instance;
 
@@ -2344,15 +2690,164 @@ void Dba::deploy_sandbox_instance(
       "Sandbox instances are only suitable for deploying and running on "
       "your local machine for testing purposes and are not accessible "
       "from external networks.");
+}
 
-  if (current_shell_options()->get().wizards) {
+REGISTER_HELP_FUNCTION(deploySandboxInstances, dba);
+REGISTER_HELP_FUNCTION_TEXT(DBA_DEPLOYSANDBOXINSTANCES, R"*(
+Creates several new MySQL Server instances on localhost at the same time.
+
+@param ports List of the ports where the new instances will listen for
+connections.
+@param options Optional dictionary with options affecting the new deployed
+instances.
+
+@returns Nothing.
+
+This function deploys a new MySQL Server instance on each of the given ports,
+in the same way as deploySandboxInstance() does. The instances are initialized
+and started at the same time, with the maximum number of instances being
+deployed at once limited by the shell.options["dba.maxConcurrency"] option.
+The output of each deployment is printed in the order of the given list, once
+all of them complete.
+
+The options are the same as the ones supported by deploySandboxInstance(),
+with the exception of the portx option: each instance listens for X Protocol
+connections on a port which is 10 times the value of its MySQL port. All
+instances use the same root password, which is prompted for only once in
+interactive mode.
+
+A failure to deploy an instance doesn't interrupt the deployment of the
+remaining ones. Once all deployments complete, an error is reported if any of
+them failed.
+)*");
+
+/**
+ * $(DBA_DEPLOYSANDBOXINSTANCES_BRIEF)
+ *
+ * $(DBA_DEPLOYSANDBOXINSTANCES)
+ */
+#if DOXYGEN_JS
+Undefined Dba::deploySandboxInstances(List ports, Dictionary options) {}
+#elif DOXYGEN_PY
+None Dba::deploy_sandbox_instances(list ports, dict options) {}
+#endif
+void Dba::deploy_sandbox_instances(
+    const shcore::Array_t &ports_list,
+    const shcore::Option_pack_ref<Deploy_sandbox_options> &options) {
+  if (!ports_list || ports_list->empty())
+    throw shcore::Exception::argument_error(
+        "The list of ports cannot be empty.");
+
+  const Deploy_sandbox_options &opts = *options;
+
+  if (!opts.xport.is_null())
+    throw shcore::Exception::argument_error(
+        "The option 'portx' is not supported when deploying several "
+        "instances.");
+
+  std::vector<int> ports;
+  ports.reserve(ports_list->size());
+
+  for (const shcore::Value &value : *ports_list) {
+    if (value.get_type() != shcore::Integer &&
+        value.get_type() != shcore::UInteger)
+      throw shcore::Exception::argument_error(shcore::str_format(
+          "Invalid value '%s' in the list of ports, expected an integer.",
+          value.descr().c_str()));
+
+    const auto port = static_cast<int>(value.as_int());
+    validate_port(port, "port");
+
+    if (std::find(ports.begin(), ports.end(), port) != ports.end())
+      throw shcore::Exception::argument_error(shcore::str_format(
+          "The port %d is included more than once in the list of ports.",
+          port));
+
+    ports.push_back(port);
+  }
+
+  mysqlshdk::null_string password = opts.password;
+  const bool interactive = current_shell_options()->get().wizards;
+  const auto console = mysqlsh::current_console();
+  const auto count = ports.size();
+
+  if (interactive) {
+    console->print_info(shcore::str_format(
+        "%zu new MySQL sandbox instances will be created on this host in \n",
+        count) +
+        opts.sandbox_dir +
+        "\n\nWarning: Sandbox instances are only suitable for deploying and "
+        "\nrunning on your local machine for testing purposes and are not "
+        "\naccessible from external networks.\n");
+
+    if (password.is_null()) {
+      std::string answer;
+      if (console->prompt_password(
+              "Please enter a MySQL root password for the new instances: ",
+              &answer) == shcore::Prompt_result::Ok) {
+        password = answer;
+      } else {
+        return;
+      }
+    }
+  }
+
+  if (password.is_null()) {
+    throw shcore::Exception::argument_error(
+        "Missing root password for the deployed instances");
+  }
+
+  if (interactive) {
     console->print_info();
-    console->print_info("Instance localhost:" + std::to_string(port) +
-                        " successfully deployed and started.");
+    console->print_info("Deploying new MySQL instances...");
+  }
+
+  // each instance is initialized by its own process, the output is buffered,
+  // so that it isn't interleaved
+  std::vector<std::shared_ptr<Console_with_buffer>> consoles(count);
+
+  const auto errors = for_each_in_parallel(count, [&](std::size_t index) {
+    consoles[index] = std::make_shared<Console_with_buffer>();
+    Scoped_console scoped_console(consoles[index]);
+
+    do_deploy_sandbox(ports[index], 0, *password, opts);
+  });
+
+  std::size_t failed = 0;
+
+  for (std::size_t i = 0; i < count; ++i) {
+    if (consoles[i]) consoles[i]->flush();
+
+    const auto address = "localhost:" + std::to_string(ports[i]);
 
+    if (!errors[i]) {
+      if (interactive)
+        console->print_info("Instance " + address +
+                            " successfully deployed and started.");
+      continue;
+    }
+
+    ++failed;
+
+    try {
+      std::rethrow_exception(errors[i]);
+    } catch (...) {
+      console->print_error("Unable to deploy instance '" + address +
+                           "': " + format_active_exception());
+    }
+  }
+
+  if (1 == count && failed) std::rethrow_exception(errors.front());
+
+  if (failed)
+    throw shcore::Exception::runtime_error(shcore::str_format(
+        "Failed to deploy %zu of %zu sandbox instances.", failed, count));
+
+  if (interactive) {
+    console->print_info();
     console->print_info(
-        "Use shell.connect('root@localhost:" + std::to_string(port) +
-        "') to connect to the instance.");
+        "Use shell.connect('root@localhost:<port>') to connect to the "
+        "instances.");
     console->print_info();
   }
 }
@@ -59,6 +59,7 @@ class SHCORE_PUBLIC Dba : public shcore::Cpp_object_bridge,
   Integer verbose;
   Session session;
   JSON checkInstanceConfiguration(InstanceDef instance, Dictionary options);
+  JSON checkInstancesConfiguration(List instances, Dictionary options);
   Undefined configureReplicaSetInstance(InstanceDef instance,
                                         Dictionary options);
   Undefined configureLocalInstance(InstanceDef instance, Dictionary options);
@@ -67,6 +68,7 @@ class SHCORE_PUBLIC Dba : public shcore::Cpp_object_bridge,
   ReplicaSet createReplicaSet(String name, Dictionary options);
   Undefined deleteSandboxInstance(Integer port, Dictionary options);
   Instance deploySandboxInstance(Integer port, Dictionary options);
+  Undefined deploySandboxInstances(List ports, Dictionary options);
   Undefined dropMetadataSchema(Dictionary options);
   Cluster getCluster(String name, Dictionary options);
   ClusterSet getClusterSet();
@@ -81,6 +83,7 @@ class SHCORE_PUBLIC Dba : public shcore::Cpp_object_bridge,
   int verbose;
   Session session;
   JSON check_instance_configuration(InstanceDef instance, dict options);
+  JSON check_instances_configuration(list instances, dict options);
   None configure_replica_set_instance(InstanceDef instance, dict options);
   None configure_local_instance(InstanceDef instance, dict options);
   None configure_instance(InstanceDef instance, dict options);
@@ -88,6 +91,7 @@ class SHCORE_PUBLIC Dba : public shcore::Cpp_object_bridge,
   ReplicaSet create_replica_set(str name, dict options);
   None delete_sandbox_instance(int port, dict options);
   Instance deploy_sandbox_instance(int port, dict options);
+  None deploy_sandbox_instances(list ports, dict options);
   None drop_metadata_schema(dict options);
   Cluster get_cluster(str name, dict options);
   ClusterSet get_cluster_set();
@@ -135,10 +139,17 @@ class SHCORE_PUBLIC Dba : public shcore::Cpp_object_bridge,
       const mysqlshdk::utils::nullable<Connection_options> &instance_def = {},
       const shcore::Option_pack_ref<Check_instance_configuration_options>
           &options = {});
+  shcore::Value check_instances_configuration(
+      const shcore::Array_t &instance_defs,
+      const shcore::Option_pack_ref<Check_instance_configuration_options>
+          &options = {});
   // create and start
   void deploy_sandbox_instance(
       int port,
       const shcore::Option_pack_ref<Deploy_sandbox_options> &options = {});
+  void deploy_sandbox_instances(
+      const shcore::Array_t &ports,
+      const shcore::Option_pack_ref<Deploy_sandbox_options> &options = {});
   void stop_sandbox_instance(
       int port,
       const shcore::Option_pack_ref<Stop_sandbox_options> &options = {});
@@ -214,6 +225,13 @@ class SHCORE_PUBLIC Dba : public shcore::Cpp_object_bridge,
   void exec_instance_op(const std::string &function, int port,
                         const std::string &sandbox_dir,
                         const std::string &password = "");
+
+  /**
+   * Creates and starts a sandbox, creates the root@<allowRootFrom> account.
+   * Safe to be called from several threads at once.
+   */
+  void do_deploy_sandbox(int port, int xport, const std::string &password,
+                         const Deploy_sandbox_options &opts);
 };
 }  // namespace dba
 }  // namespace mysqlsh
@@ -30,6 +30,7 @@
 #include "db/utils_connection.h"
 
 #include "modules/adminapi/common/common.h"
+#include "modules/adminapi/common/metadata_storage.h"
 #include "modules/adminapi/mod_dba_cluster_set.h"
 #include "mysqlshdk/include/shellcore/utils_help.h"
 #include "mysqlshdk/libs/utils/debug.h"
@@ -98,12 +99,15 @@ Cluster::~Cluster() { DEBUG_OBJ_DEALLOC(Cluster); }
 void Cluster::init() {
   add_property("name", "getName");
   expose("addInstance", &Cluster::add_instance, "instance", "?options")->cli();
+  expose("addInstances", &Cluster::add_instances, "instances", "?options")
+      ->cli(false);
   expose("rejoinInstance", &Cluster::rejoin_instance, "instance", "?options")
       ->cli();
   expose("removeInstance", &Cluster::remove_instance, "instance", "?options")
       ->cli();
   expose("describe", &Cluster::describe)->cli();
   expose("status", &Cluster::status, "?options")->cli();
+  expose("monitor", &Cluster::monitor, "?options")->cli(false);
   expose("dissolve", &Cluster::dissolve, "?options")->cli();
   expose("resetRecoveryAccountsPassword",
          &Cluster::reset_recovery_accounts_password, "?options")
@@ -340,6 +344,86 @@ void Cluster::add_instance(
       false);
 }
 
+REGISTER_HELP_FUNCTION(addInstances, Cluster);
+REGISTER_HELP_FUNCTION_TEXT(CLUSTER_ADDINSTANCES, R"*(
+Adds several Instances to the cluster at the same time.
+
+@param instances List with the connection options of the target instances to
+be added.
+@param options Optional dictionary with options for the operation.
+
+@returns nothing
+
+This function adds a group of Instances to a InnoDB cluster. The instances are
+validated and joined to the cluster one at a time, in the given order, but the
+recovery of each instance (e.g. clone) runs in the background while the next
+ones are being added, and the command waits for all of them at the end.
+
+If an instance fails to be added, the instances that follow it in the list are
+not added, while the ones that already joined the cluster are waited for.
+
+The options dictionary accepts the same attributes as addInstance(), except
+for label, localAddress and certSubject, which have to be unique for each
+instance. The maximum number of instances recovering at the same time is
+limited by the shell.options["dba.maxConcurrency"] option.
+
+When more than one instance is recovering, no progress information is
+shown while waiting for the recovery to finish, if the recoveryProgress option
+is not 0.
+)*");
+
+/**
+ * $(CLUSTER_ADDINSTANCES_BRIEF)
+ *
+ * $(CLUSTER_ADDINSTANCES)
+ */
+#if DOXYGEN_JS
+Undefined Cluster::addInstances(List instances, Dictionary options) {}
+#elif DOXYGEN_PY
+None Cluster::add_instances(list instances, dict options) {}
+#endif
+void Cluster::add_instances(
+    const shcore::Array_t &instance_defs,
+    const shcore::Option_pack_ref<cluster::Add_instance_options> &options) {
+  // Throw an error if the cluster has already been dissolved
+  assert_valid("addInstances");
+
+  if (!instance_defs || instance_defs->empty())
+    throw shcore::Exception::argument_error(
+        "The list of instances cannot be empty.");
+
+  if (options->label.has_value() ||
+      options->gr_options.local_address.has_value() ||
+      !options->cert_subject.empty())
+    throw shcore::Exception::argument_error(
+        shcore::str_format("The options '%s', '%s' and '%s' are not supported "
+                           "when adding several instances.",
+                           kLabel, kLocalAddress, kCertSubject));
+
+  std::vector<Connection_options> instances;
+
+  for (const shcore::Value &instance : *instance_defs) {
+    try {
+      instances.emplace_back(mysqlsh::get_connection_options(instance));
+    } catch (const std::exception &err) {
+      throw shcore::Exception::argument_error(shcore::str_format(
+          "Invalid value '%s' in the list of instances: %s",
+          instance.descr().c_str(), err.what()));
+    }
+
+    if (options->password.has_value()) {
+      instances.back().set_password(*(options->password));
+    }
+  }
+
+  return execute_with_pool(
+      [&]() {
+        // Add the Instances to the Cluster
+        impl()->add_instances(instances, *options);
+      },
+      false);
+}
+
 REGISTER_HELP_FUNCTION(rejoinInstance, Cluster);
 REGISTER_HELP_FUNCTION_TEXT(CLUSTER_REJOININSTANCE, R"*(
 Rejoins an Instance to the cluster.
@@ -571,7 +655,12 @@ shcore::Value Cluster::describe(void) {
   // Throw an error if the cluster has already been dissolved
   assert_valid("describe");
 
-  return execute_with_pool([&]() { return impl()->describe(); }, false);
+  return execute_with_pool(
+      [&]() {
+        MetadataStorage::Snapshot snapshot(impl()->get_metadata_storage());
+        return impl()->describe();
+      },
+      false);
 }
 
 REGISTER_HELP_FUNCTION(status, Cluster);
@@ -623,8 +712,59 @@ shcore::Value Cluster::status(
   // Throw an error if the cluster has already been dissolved
   assert_valid("status");
 
-  return execute_with_pool([&]() { return impl()->status(options->extended); },
-                           false);
+  return execute_with_pool(
+      [&]() {
+        MetadataStorage::Snapshot snapshot(impl()->get_metadata_storage());
+        return impl()->status(options->extended);
+      },
+      false);
+}
+
+REGISTER_HELP_FUNCTION(monitor, Cluster);
+REGISTER_HELP_FUNCTION_TEXT(CLUSTER_MONITOR, R"*(
+Returns a monitor which keeps the Cluster status in memory.
+
+@param options Optional dictionary with options.
+
+@returns A ClusterMonitor object.
+
+This function is meant to be used by tools which check the status of the
+Cluster periodically. Instead of connecting to all the members and gathering
+the full status on each call, the returned object keeps its sessions open and
+only refreshes the replication lag and the transaction counters of the
+members, as long as the group membership, the state of the members and the
+primary member do not change. The following options may be given:
+
+@li extended: verbosity level of the status, the same as in <<<status>>>().
+@li refreshInterval: the status is returned from memory if it was refreshed
+less than this many seconds ago. Default: 10.
+)*");
+
+/**
+ * $(CLUSTER_MONITOR_BRIEF)
+ *
+ * $(CLUSTER_MONITOR)
+ */
+#if DOXYGEN_JS
+ClusterMonitor Cluster::monitor(Dictionary options) {}
+#elif DOXYGEN_PY
+ClusterMonitor Cluster::monitor(dict options) {}
+#endif
+
+std::shared_ptr<Cluster_monitor> Cluster::monitor(
+    const shcore::Option_pack_ref<cluster::Monitor_options> &options) {
+  // Throw an error if the cluster has already been dissolved
+  assert_valid("monitor");
+
+  auto monitor = std::make_shared<Cluster_monitor>(
+      std::make_unique<cluster::Monitor>(
+          impl(), options->extended,
+          std::chrono::seconds(options->refresh_interval)));
+
+  // gather the status right away, any problems are reported here
+  monitor->refresh();
+
+  return monitor;
 }
 
 REGISTER_HELP_FUNCTION(options, Cluster);
@@ -659,8 +799,12 @@ shcore::Value Cluster::options(
   // Throw an error if the cluster has already been dissolved
   assert_valid("options");
 
-  return execute_with_pool([&]() { return impl()->options(options->all); },
-                           false);
+  return execute_with_pool(
+      [&]() {
+        MetadataStorage::Snapshot snapshot(impl()->get_metadata_storage());
+        return impl()->options(options->all);
+      },
+      false);
 }
 
 REGISTER_HELP_FUNCTION(dissolve, Cluster);
@@ -37,6 +37,7 @@
 #include "modules/adminapi/cluster_set/api_options.h"
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/group_replication_options.h"
+#include "modules/adminapi/mod_dba_cluster_monitor.h"
 #include "modules/adminapi/mod_dba_cluster_set.h"
 #include "mysqlshdk/libs/db/connection_options.h"
 
@@ -55,6 +56,7 @@ class Cluster : public std::enable_shared_from_this<Cluster>,
 #if DOXYGEN_JS
   String name;  //!< $(CLUSTER_GETNAME_BRIEF)
   Undefined addInstance(InstanceDef instance, Dictionary options);
+  Undefined addInstances(List instances, Dictionary options);
   Dictionary checkInstanceState(InstanceDef instance);
   ClusterSet createClusterSet(String domainName, Dictionary options);
   ClusterSet getClusterSet();
@@ -72,6 +74,7 @@ class Cluster : public std::enable_shared_from_this<Cluster>,
   Undefined rescan(Dictionary options);
   Undefined resetRecoveryAccountsPassword(Dictionary options);
   Dictionary status(Dictionary options);
+  ClusterMonitor monitor(Dictionary options);
   Undefined switchToSinglePrimaryMode(InstanceDef instance);
   Undefined switchToMultiPrimaryMode();
   Undefined setPrimaryInstance(InstanceDef instance, Dictionary options);
@@ -89,6 +92,7 @@ class Cluster : public std::enable_shared_from_this<Cluster>,
 #elif DOXYGEN_PY
   str name;  //!< $(CLUSTER_GETNAME_BRIEF)
   None add_instance(InstanceDef instance, dict options);
+  None add_instances(list instances, dict options);
   dict check_instance_state(InstanceDef instance);
   ClusterSet create_cluster_set(str domainName, dict options);
   ClusterSet get_cluster_set();
@@ -106,6 +110,7 @@ class Cluster : public std::enable_shared_from_this<Cluster>,
   None rescan(dict options);
   None reset_recovery_accounts_password(dict options);
   dict status(dict options);
+  ClusterMonitor monitor(dict options);
   None switch_to_single_primary_mode(InstanceDef instance);
   None switch_to_multi_primary_mode();
   None set_primary_instance(InstanceDef instance, dict options);
@@ -136,6 +141,10 @@ class Cluster : public std::enable_shared_from_this<Cluster>,
   void add_instance(const Connection_options &instance_def,
                     const shcore::Option_pack_ref<cluster::Add_instance_options>
                         &options = {});
+  void add_instances(
+      const shcore::Array_t &instance_defs,
+      const shcore::Option_pack_ref<cluster::Add_instance_options> &options =
+          {});
   void rejoin_instance(
       const Connection_options &instance_def,
       const shcore::Option_pack_ref<cluster::Rejoin_instance_options> &options =
@@ -148,6 +157,8 @@ class Cluster : public std::enable_shared_from_this<Cluster>,
   shcore::Value describe(void);
   shcore::Value status(
       const shcore::Option_pack_ref<cluster::Status_options> &options);
+  std::shared_ptr<Cluster_monitor> monitor(
+      const shcore::Option_pack_ref<cluster::Monitor_options> &options);
   void dissolve(
       const shcore::Option_pack_ref<Force_interactive_options> &options);
   shcore::Value check_instance_state(const Connection_options &instance_def);
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/adminapi/mod_dba_cluster_monitor.h"
+
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/utils_help.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+
+namespace mysqlsh {
+namespace dba {
+
+// Documentation of the ClusterMonitor Class
+REGISTER_HELP_CLASS(ClusterMonitor, adminapi);
+REGISTER_HELP_CLASS_TEXT(CLUSTERMONITOR, R"*(
+Keeps the status of an InnoDB Cluster in memory.
+
+The cluster monitor object is created with Cluster.<<<monitor>>>() and is meant
+to be used by tools which frequently check the status of a Cluster. It keeps
+the sessions to the Cluster members open between the calls and refreshes the
+status incrementally.
+
+For more help on a specific function, use the \\help shell command, e.g.:
+\\help ClusterMonitor.<<<status>>>
+)*");
+
+Cluster_monitor::Cluster_monitor(std::unique_ptr<cluster::Monitor> monitor)
+    : m_monitor(std::move(monitor)) {
+  init();
+}
+
+void Cluster_monitor::init() {
+  expose("status", &Cluster_monitor::status);
+  expose("refresh", &Cluster_monitor::refresh);
+  expose("close", &Cluster_monitor::close);
+}
+
+void Cluster_monitor::assert_open(const std::string &function_name) const {
+  if (!m_monitor) {
+    throw shcore::Exception::runtime_error(
+        "Can't call function '" + get_function_name(function_name, false) +
+        "' on a closed ClusterMonitor. Please use <Cluster>." +
+        shcore::get_member_name("monitor", shcore::current_naming_style()) +
+        "() to create a new one.");
+  }
+}
+
+REGISTER_HELP_FUNCTION(status, ClusterMonitor);
+REGISTER_HELP_FUNCTION_TEXT(CLUSTERMONITOR_STATUS, R"*(
+Returns the status of the Cluster.
+
+@returns A JSON object describing the status of the Cluster.
+
+The returned object has the same format as the one returned by
+Cluster.<<<status>>>(). If the status was refreshed less than refreshInterval
+seconds ago, it is returned from memory, without contacting the Cluster,
+otherwise it is refreshed first.
+
+A refresh gathers the full status of the Cluster only the first time, or if the
+group membership, the state of a member or the primary member has changed
+since the previous refresh. Otherwise, only the replication lag and, if the
+extended option is 2 or greater, the transaction counters of the members are
+refreshed. The remaining information is reported as of the last full refresh.
+)*");
+
+/**
+ * $(CLUSTERMONITOR_STATUS_BRIEF)
+ *
+ * $(CLUSTERMONITOR_STATUS)
+ */
+#if DOXYGEN_JS
+Dictionary Cluster_monitor::status() {}
+#elif DOXYGEN_PY
+dict Cluster_monitor::status() {}
+#endif
+
+shcore::Value Cluster_monitor::status() {
+  assert_open("status");
+
+  return m_monitor->status();
+}
+
+REGISTER_HELP_FUNCTION(refresh, ClusterMonitor);
+REGISTER_HELP_FUNCTION_TEXT(CLUSTERMONITOR_REFRESH, R"*(
+Refreshes the status of the Cluster.
+
+@returns Nothing.
+
+Refreshes the status of the Cluster, regardless of when it was last refreshed.
+)*");
+
+/**
+ * $(CLUSTERMONITOR_REFRESH_BRIEF)
+ *
+ * $(CLUSTERMONITOR_REFRESH)
+ */
+#if DOXYGEN_JS
+Undefined Cluster_monitor::refresh() {}
+#elif DOXYGEN_PY
+None Cluster_monitor::refresh() {}
+#endif
+
+void Cluster_monitor::refresh() {
+  assert_open("refresh");
+
+  m_monitor->refresh();
+}
+
+REGISTER_HELP_FUNCTION(close, ClusterMonitor);
+REGISTER_HELP_FUNCTION_TEXT(CLUSTERMONITOR_CLOSE, R"*(
+Closes the monitor.
+
+@returns Nothing.
+
+Closes all the sessions opened by the monitor. The monitor cannot be used
+afterwards.
+)*");
+
+/**
+ * $(CLUSTERMONITOR_CLOSE_BRIEF)
+ *
+ * $(CLUSTERMONITOR_CLOSE)
+ */
+#if DOXYGEN_JS
+Undefined Cluster_monitor::close() {}
+#elif DOXYGEN_PY
+None Cluster_monitor::close() {}
+#endif
+
+void Cluster_monitor::close() { m_monitor.reset(); }
+
+}  // namespace dba
+}  // namespace mysqlsh
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_ADMINAPI_MOD_DBA_CLUSTER_MONITOR_H_
+#define MODULES_ADMINAPI_MOD_DBA_CLUSTER_MONITOR_H_
+
+#include <memory>
+#include <string>
+
+#include "scripting/types.h"
+#include "scripting/types_cpp.h"
+
+#include "modules/adminapi/cluster/monitor.h"
+
+namespace mysqlsh {
+namespace dba {
+
+/**
+ * \ingroup AdminAPI
+ * $(CLUSTERMONITOR_BRIEF)
+ *
+ * $(CLUSTERMONITOR_DETAIL)
+ */
+class Cluster_monitor : public shcore::Cpp_object_bridge {
+ public:
+#if DOXYGEN_JS
+  Dictionary status();
+  Undefined refresh();
+  Undefined close();
+#elif DOXYGEN_PY
+  dict status();
+  None refresh();
+  None close();
+#endif
+
+  explicit Cluster_monitor(std::unique_ptr<cluster::Monitor> monitor);
+
+  Cluster_monitor(const Cluster_monitor &) = delete;
+  Cluster_monitor(Cluster_monitor &&) = delete;
+
+  Cluster_monitor &operator=(const Cluster_monitor &) = delete;
+  Cluster_monitor &operator=(Cluster_monitor &&) = delete;
+
+  ~Cluster_monitor() override = default;
+
+  std::string class_name() const override { return "ClusterMonitor"; }
+
+  shcore::Value status();
+
+  void refresh();
+
+  void close();
+
+ private:
+  void init();
+
+  void assert_open(const std::string &function_name) const;
+
+  std::unique_ptr<cluster::Monitor> m_monitor;
+};
+
+}  // namespace dba
+}  // namespace mysqlsh
+
+#endif  // MODULES_ADMINAPI_MOD_DBA_CLUSTER_MONITOR_H_
@@ -23,6 +23,7 @@
 
 #include "modules/adminapi/mod_dba_cluster_set.h"
 #include "modules/adminapi/common/accounts.h"
+#include "modules/adminapi/common/metadata_storage.h"
 #include "modules/adminapi/mod_dba_cluster.h"
 #include "modules/mod_utils.h"
 #include "mysqlshdk/include/scripting/type_info/custom.h"
@@ -461,6 +462,7 @@ shcore::Value ClusterSet::status(
   return execute_with_pool(
       [&]() {
         impl()->connect_primary();
+        MetadataStorage::Snapshot snapshot(impl()->get_metadata_storage());
         return shcore::Value(impl()->status(options->extended));
       },
       false);
@@ -512,6 +514,7 @@ shcore::Value ClusterSet::describe() {
   return execute_with_pool(
       [&]() {
         impl()->connect_primary();
+        MetadataStorage::Snapshot snapshot(impl()->get_metadata_storage());
         return shcore::Value(impl()->describe());
       },
       false);
@@ -775,7 +778,12 @@ shcore::Value ClusterSet::options() {
   // Throw an error if the clusterset is invalid
   assert_valid("options");
 
-  return execute_with_pool([&]() { return impl()->options(); }, false);
+  return execute_with_pool(
+      [&]() {
+        MetadataStorage::Snapshot snapshot(impl()->get_metadata_storage());
+        return impl()->options();
+      },
+      false);
 }
 
 REGISTER_HELP_FUNCTION(setOption, ClusterSet);
@@ -849,8 +857,12 @@ Dictionary ClusterSet::listRouters(String router) {}
 dict ClusterSet::list_routers(str router) {}
 #endif
 shcore::Value ClusterSet::list_routers(const std::string &router) {
-  return execute_with_pool([&]() { return impl()->list_routers(router); },
-                           false);
+  return execute_with_pool(
+      [&]() {
+        MetadataStorage::Snapshot snapshot(impl()->get_metadata_storage());
+        return impl()->list_routers(router);
+      },
+      false);
 }
 
 REGISTER_HELP_FUNCTION(setRoutingOption, ClusterSet);
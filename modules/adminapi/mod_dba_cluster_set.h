@@ -146,9 +146,8 @@ class ClusterSet : public std::enable_shared_from_this<ClusterSet>,
   template <typename TCallback>
   auto execute_with_pool(TCallback &&f, bool interactive = false) const {
     // Init the connection pool
-    Scoped_instance_pool scoped_pool(impl()->get_metadata_storage(),
-                                     interactive,
-                                     impl()->default_admin_credentials());
+    Scoped_instance_pool scoped_pool(impl()->get_instance_pool(interactive));
+    scoped_pool->set_metadata(impl()->get_metadata_storage());
 
     return f();
   }
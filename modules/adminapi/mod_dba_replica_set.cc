@@ -23,6 +23,7 @@
 
 #include "modules/adminapi/mod_dba_replica_set.h"
 
+#include "modules/adminapi/common/metadata_storage.h"
 #include "mysqlshdk/include/shellcore/utils_help.h"
 #include "mysqlshdk/libs/utils/debug.h"
 
@@ -555,7 +556,12 @@ dict ReplicaSet::describe() {}
 shcore::Value ReplicaSet::describe() {
   assert_valid("describe");
 
-  return execute_with_pool([&]() { return impl()->describe(); }, false);
+  return execute_with_pool(
+      [&]() {
+        MetadataStorage::Snapshot snapshot(impl()->get_metadata_storage());
+        return impl()->describe();
+      },
+      false);
 }
 
 REGISTER_HELP_FUNCTION(status, ReplicaSet);
@@ -603,8 +609,12 @@ shcore::Value ReplicaSet::status(
     const shcore::Option_pack_ref<replicaset::Status_options> &options) {
   assert_valid("status");
 
-  return execute_with_pool([&]() { return impl()->status(options->extended); },
-                           false);
+  return execute_with_pool(
+      [&]() {
+        MetadataStorage::Snapshot snapshot(impl()->get_metadata_storage());
+        return impl()->status(options->extended);
+      },
+      false);
 }
 
 REGISTER_HELP_FUNCTION(disconnect, ReplicaSet);
@@ -1041,7 +1051,12 @@ str ReplicaSet::options() {}
 shcore::Value ReplicaSet::options() {
   assert_valid("options");
 
-  return execute_with_pool([&]() { return impl()->options(); }, false);
+  return execute_with_pool(
+      [&]() {
+        MetadataStorage::Snapshot snapshot(impl()->get_metadata_storage());
+        return impl()->options();
+      },
+      false);
 }
 
 REGISTER_HELP_FUNCTION(setOption, ReplicaSet);
@@ -169,9 +169,8 @@ class ReplicaSet : public std::enable_shared_from_this<ReplicaSet>,
     impl()->get_metadata_storage()->invalidate_cached();
 
     while (true) {
-      Scoped_instance_pool scoped_pool(impl()->get_metadata_storage(),
-                                       interactive,
-                                       impl()->default_admin_credentials());
+      Scoped_instance_pool scoped_pool(impl()->get_instance_pool(interactive));
+      scoped_pool->set_metadata(impl()->get_metadata_storage());
 
       try {
         return f();
@@ -42,10 +42,12 @@ void Dissolve::do_run(bool force, std::chrono::seconds timeout) {
       console->print_info(
           "The ReplicaSet still has the following registered instances:");
 
-      // Pretty print description only if wrap_json is not json/raw.
+      // Pretty print description only if wrap_json is not json/raw or
+      // json/stream.
+      const auto &wrap_json = current_shell_options()->get().wrap_json;
       auto desc = Topology_executor<replicaset::Describe>{m_rset}.run();
       console->print_info(
-          desc.descr(current_shell_options()->get().wrap_json != "json/raw"));
+          desc.descr(wrap_json != "json/raw" && wrap_json != "json/stream"));
     }
 
     console->print_warning(
@@ -25,6 +25,10 @@
 
 #include <mysqld_error.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <optional>
 #include <tuple>
 #include <utility>
 
@@ -52,6 +56,7 @@
 #include "modules/adminapi/replica_set/status.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/libs/mysql/async_replication.h"
+#include "mysqlshdk/libs/mysql/clone.h"
 #include "mysqlshdk/libs/mysql/replication.h"
 #include "mysqlshdk/libs/mysql/utils.h"
 #include "mysqlshdk/libs/utils/debug.h"
@@ -988,13 +993,15 @@ void Replica_set_impl::add_instance(
       if (clone_options.clone_donor.has_value()) {
         donor = *clone_options.clone_donor;
       } else {
-        donor = pick_clone_donor(target_instance.get());
+        donor = pick_clone_donor(target_instance.get(),
+                                 *topology->topology());
       }
 
       const auto donor_instance =
           Scoped_instance(connect_target_instance(donor));
 
-      ensure_compatible_clone_donor(donor_instance, target_instance);
+      ensure_compatible_clone_donor(donor_instance, target_instance,
+                                    *topology->topology());
 
       // Do and monitor the clone
       Base_cluster_impl::handle_clone_provisioning(
@@ -1340,13 +1347,15 @@ void Replica_set_impl::rejoin_instance(const std::string &instance_def,
       if (clone_options.clone_donor.has_value()) {
         donor = *clone_options.clone_donor;
       } else {
-        donor = pick_clone_donor(target_instance.get());
+        donor = pick_clone_donor(target_instance.get(),
+                                 *topology_mng->topology());
       }
 
       const auto donor_instance =
           Scoped_instance(connect_target_instance(donor));
 
-      ensure_compatible_clone_donor(donor_instance, target_instance);
+      ensure_compatible_clone_donor(donor_instance, target_instance,
+                                    *topology_mng->topology());
 
       // Do and monitor the clone
       Base_cluster_impl::handle_clone_provisioning(
@@ -2532,6 +2541,15 @@ void Replica_set_impl::ensure_metadata_has_server_uuid(
 void Replica_set_impl::ensure_compatible_clone_donor(
     const mysqlshdk::mysql::IInstance &donor,
     const mysqlshdk::mysql::IInstance &recipient) {
+  auto topology_mng = get_topology_manager();
+
+  ensure_compatible_clone_donor(donor, recipient, *topology_mng->topology());
+}
+
+void Replica_set_impl::ensure_compatible_clone_donor(
+    const mysqlshdk::mysql::IInstance &donor,
+    const mysqlshdk::mysql::IInstance &recipient,
+    const topology::Global_topology &topology) {
   /*
    * A donor is compatible if:
    *
@@ -2557,13 +2575,10 @@ void Replica_set_impl::ensure_compatible_clone_donor(
 
   // Check if the instance is ONLINE
   {
-    auto topology_mng = get_topology_manager();
-
-    auto topology_node =
-        topology_mng->topology()->try_get_node_for_uuid(donor.get_uuid());
+    auto topology_node = topology.try_get_node_for_uuid(donor.get_uuid());
     if (!topology_node) {
-      topology_node = topology_mng->topology()->try_get_node_for_endpoint(
-          donor.get_canonical_address());
+      topology_node =
+          topology.try_get_node_for_endpoint(donor.get_canonical_address());
     }
     if (!topology_node) {
       throw shcore::Exception(
@@ -2582,23 +2597,25 @@ void Replica_set_impl::ensure_compatible_clone_donor(
 }
 
 std::string Replica_set_impl::pick_clone_donor(
-    mysqlshdk::mysql::IInstance *recipient) {
+    mysqlshdk::mysql::IInstance *recipient,
+    const topology::Global_topology &topology) {
   std::string r;
-  auto topology_mng = get_topology_manager();
-  auto topology = topology_mng->topology();
 
   // Get the ReplicaSet primary member
-  const topology::Node *primary = topology->get_primary_master_node();
+  const topology::Node *primary = topology.get_primary_master_node();
 
   // Get the ReplicaSet secondary members
   std::list<const topology::Node *> secondaries =
-      topology_mng->topology()->get_slave_nodes(primary);
+      topology.get_slave_nodes(primary);
 
   std::string full_msg;
 
   // By default, the donor must be an online secondary member. If not available,
-  // then it must be the primary
+  // then it must be the primary. If there are several suitable secondaries,
+  // the one which is the least loaded and the most responsive is used.
   if (!secondaries.empty()) {
+    std::optional<mysqlshdk::mysql::Clone_donor_probe> best;
+
     for (const auto *s : secondaries) {
       if (recipient->get_uuid() == s->get_primary_member()->uuid) continue;
 
@@ -2614,12 +2631,19 @@ std::string Replica_set_impl::pick_clone_donor(
         const auto donor_instance =
             Scoped_instance(connect_target_instance(instance_def));
 
-        ensure_compatible_clone_donor(donor_instance, *recipient);
+        ensure_compatible_clone_donor(donor_instance, *recipient, topology);
 
-        r = instance_def;
+        const auto probe = mysqlshdk::mysql::probe_clone_donor(donor_instance);
 
-        // No need to continue looking for more
-        break;
+        log_info(
+            "SECONDARY '%s' is a suitable clone donor: latency %.3f ms, "
+            "load %" PRIu64,
+            instance_def.c_str(), probe.latency_ms, probe.load);
+
+        if (!best || probe.score() < best->score()) {
+          best = probe;
+          r = instance_def;
+        }
       } catch (const shcore::Exception &e) {
         std::string msg = "SECONDARY '" + instance_def +
                           "' is not a suitable clone donor: " + e.what();
@@ -2628,6 +2652,10 @@ std::string Replica_set_impl::pick_clone_donor(
         continue;
       }
     }
+
+    if (!r.empty()) {
+      log_info("Selected SECONDARY '%s' as the clone donor", r.c_str());
+    }
   }
 
   // If no secondary is suitable, use the primary
@@ -2644,7 +2672,7 @@ std::string Replica_set_impl::pick_clone_donor(
       const auto donor_instance =
           Scoped_instance(connect_target_instance(instance_def));
 
-      ensure_compatible_clone_donor(donor_instance, *recipient);
+      ensure_compatible_clone_donor(donor_instance, *recipient, topology);
 
       r = instance_def;
     } catch (const shcore::Exception &e) {
@@ -2775,28 +2803,51 @@ std::list<std::shared_ptr<Instance>> Replica_set_impl::connect_all_members(
   std::vector<Instance_metadata> instances =
       get_metadata_storage()->get_all_instances(get_id());
 
+  instances.erase(std::remove_if(instances.begin(), instances.end(),
+                                 [skip_primary](const Instance_metadata &i) {
+                                   return (i.primary_master && skip_primary) ||
+                                          i.invalidated;
+                                 }),
+                  instances.end());
+
   auto console = current_console();
   std::list<std::shared_ptr<Instance>> r;
   auto ipool = current_ipool();
 
-  for (const auto &i : instances) {
-    if ((i.primary_master && skip_primary) || i.invalidated) continue;
+  // connect to all members at the same time, so that unreachable members are
+  // waited for only once, the results are then reported in the original order
+  std::vector<std::shared_ptr<Instance>> sessions(instances.size());
 
-    try {
-      try {
-        mysqlshdk::db::Connection_options opts(i.endpoint);
-        ipool->default_auth_opts().set(&opts);
-        // The read timeout will allow commands that block at the server but
-        // have no server-side timeouts to not block the shell indefinitely.
-        if (read_timeout > 0) opts.set_net_read_timeout(read_timeout * 1000);
+  const auto errors =
+      for_each_in_parallel(instances.size(), [&](std::size_t index) {
+        const auto &i = instances[index];
 
-        if (!silent)
-          console->print_info(
-              shcore::str_format("** Connecting to %s", i.label.c_str()));
+        try {
+          mysqlshdk::db::Connection_options opts(i.endpoint);
+          ipool->default_auth_opts().set(&opts);
+          // The read timeout will allow commands that block at the server but
+          // have no server-side timeouts to not block the shell indefinitely.
+          if (read_timeout > 0) opts.set_net_read_timeout(read_timeout * 1000);
 
-        r.emplace_back(ipool->connect_unchecked(opts));
-      }
-      CATCH_AND_THROW_CONNECTION_ERROR(i.endpoint)
+          sessions[index] = ipool->connect_unchecked(opts);
+        }
+        CATCH_AND_THROW_CONNECTION_ERROR(i.endpoint)
+      });
+
+  for (std::size_t index = 0; index < instances.size(); ++index) {
+    const auto &i = instances[index];
+
+    if (!silent)
+      console->print_info(
+          shcore::str_format("** Connecting to %s", i.label.c_str()));
+
+    if (!errors[index]) {
+      r.emplace_back(std::move(sessions[index]));
+      continue;
+    }
+
+    try {
+      std::rethrow_exception(errors[index]);
     } catch (const shcore::Exception &e) {
       // Client errors are likely because the server is unreachable/crashed
       if (e.is_mysql() && mysqlshdk::db::is_mysql_client_error(e.code())) {
@@ -239,7 +239,13 @@ class Replica_set_impl final : public Base_cluster_impl {
 
   void ensure_metadata_has_server_uuid(const mysqlsh::dba::Instance &instance);
 
-  std::string pick_clone_donor(mysqlshdk::mysql::IInstance *recipient);
+  std::string pick_clone_donor(mysqlshdk::mysql::IInstance *recipient,
+                               const topology::Global_topology &topology);
+
+  void ensure_compatible_clone_donor(
+      const mysqlshdk::mysql::IInstance &donor,
+      const mysqlshdk::mysql::IInstance &recipient,
+      const topology::Global_topology &topology);
 
   void revert_topology_changes(mysqlshdk::mysql::IInstance *target_server,
                                bool remove_user, bool dry_run);
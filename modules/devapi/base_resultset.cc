@@ -67,6 +67,13 @@ std::vector<std::string> ShellBaseResult::get_members() const {
   assert(pos != members.end());
   if (pos != members.end()) members.erase(pos);
 
+  // The Arrow export functions are only implemented in Python, they are
+  // removed in other languages (which use the camelCase naming style)
+  for (const auto &name : {"toArrow", "toPandas"}) {
+    pos = std::find(members.begin(), members.end(), name);
+    if (pos != members.end()) members.erase(pos);
+  }
+
   return members;
 }
 
@@ -108,6 +115,63 @@ shcore::Dictionary_t ShellBaseResult::fetch_one_object() const {
   return {};
 }
 
+shcore::Array_t ShellBaseResult::fetch_many(uint64_t count) const {
+  auto array = shcore::make_array();
+
+  // NOTE: the Python bridge has its own implementation of this function (see
+  // python_object_wrapper.cc), which creates the tuples directly from the
+  // row data
+  auto result = has_data() ? get_result() : nullptr;
+
+  if (result) {
+    while (array->size() < count) {
+      const auto row = result->fetch_one();
+      if (!row) break;
+
+      array->emplace_back(
+          std::make_shared<shcore::Value::Array_type>(get_row_values(*row)));
+    }
+  }
+
+  return array;
+}
+
+bool ShellBaseResult::fetch_one_into(
+    const std::shared_ptr<mysqlsh::Row> &target) const {
+  if (!target) {
+    throw shcore::Exception::argument_error(
+        "Argument #1 is expected to be a Row object");
+  }
+
+  auto result = has_data() ? get_result() : nullptr;
+  if (!result) return false;
+
+  const auto columns = get_column_names();
+
+  if (target->names != columns &&
+      (!columns || *target->names != *columns)) {
+    throw shcore::Exception::argument_error(
+        "Argument #1 has to be a Row with the same columns as this result");
+  }
+
+  const auto row = result->fetch_one();
+  if (!row) return false;
+
+  target->set_values(*row);
+
+  return true;
+}
+
+// NOTE: these functions are implemented by the Python bridge (see
+// python_object_wrapper.cc), as they return pyarrow/pandas objects
+shcore::Value ShellBaseResult::to_arrow(uint64_t) const {
+  throw std::runtime_error("This function is only available in Python.");
+}
+
+shcore::Value ShellBaseResult::to_pandas(uint64_t) const {
+  throw std::runtime_error("This function is only available in Python.");
+}
+
 std::shared_ptr<std::vector<std::string>> ShellBaseResult::get_column_names()
     const {
   update_column_cache();
@@ -289,6 +353,11 @@ Row::Row(std::shared_ptr<std::vector<std::string>> names_,
   value_array = get_row_values(row);
 }
 
+void Row::set_values(const mysqlshdk::db::IRow &row) {
+  assert(row.num_fields() == names->size());
+  get_row_values(row, &value_array);
+}
+
 shcore::Dictionary_t Row::as_object() {
   auto ret_val = shcore::make_dict();
 
@@ -41,7 +41,8 @@
 namespace mysqlsh {
 class Row;
 // This is the Shell Common Base Class for all the resultset classes
-class ShellBaseResult : public shcore::Cpp_object_bridge {
+class ShellBaseResult : public shcore::Cpp_object_bridge,
+                        public mysqlshdk::db::IResult_source {
  public:
   ShellBaseResult();
 
@@ -49,7 +50,7 @@ class ShellBaseResult : public shcore::Cpp_object_bridge {
   std::string class_name() const override { return "ShellBaseResult"; }
 
   bool operator==(const Object_bridge &other) const override;
-  virtual mysqlshdk::db::IResult *get_result() const = 0;
+  mysqlshdk::db::IResult *get_result() const override = 0;
   // shcore::Value::Array_type_ref get_columns() const { return m_columns; }
   std::shared_ptr<std::vector<std::string>> get_column_names() const;
 
@@ -59,9 +60,17 @@ class ShellBaseResult : public shcore::Cpp_object_bridge {
 
   shcore::Dictionary_t fetch_one_object() const;
 
+  shcore::Array_t fetch_many(uint64_t count) const;
+
+  bool fetch_one_into(const std::shared_ptr<mysqlsh::Row> &target) const;
+
+  shcore::Value to_arrow(uint64_t batch_size) const;
+
+  shcore::Value to_pandas(uint64_t batch_size) const;
+
   void dump();
 
-  virtual bool has_data() const = 0;
+  bool has_data() const override = 0;
 
  protected:
   virtual const std::vector<mysqlshdk::db::Column> &get_metadata() const = 0;
@@ -325,6 +334,12 @@ class SHCORE_PUBLIC Row : public shcore::Cpp_object_bridge {
 
   void add_item(const std::string &key, shcore::Value value);
 
+  /**
+   * Replaces the values of this row with the ones from the given row, reusing
+   * the storage. Both rows need to have the same columns.
+   */
+  void set_values(const mysqlshdk::db::IRow &row);
+
   shcore::Dictionary_t as_object();
 };
 }  // namespace mysqlsh
@@ -31,6 +31,8 @@
 #include "modules/devapi/mod_mysqlx_expression.h"
 #include "modules/devapi/mod_mysqlx_resultset.h"
 #include "shellcore/utils_help.h"
+#include "utils/profiling.h"
+#include "utils/utils_general.h"
 #include "utils/utils_string.h"
 
 namespace mysqlsh {
@@ -38,6 +40,18 @@ namespace mysqlx {
 
 using std::placeholders::_1;
 
+namespace {
+
+// adds which are smaller than this are always sent using a single message
+constexpr std::size_t k_batch_check_threshold = 1024 * 1024;
+
+// upper bound of the size of encoded field number and length of a row
+constexpr std::size_t k_row_overhead = 16;
+
+constexpr std::size_t k_max_batches_in_flight = 4;
+
+}  // namespace
+
 REGISTER_HELP_CLASS(CollectionAdd, mysqlx);
 REGISTER_HELP(COLLECTIONADD_BRIEF,
               "Operation to insert documents into a Collection.");
@@ -242,12 +256,21 @@ REGISTER_HELP(COLLECTIONADD_EXECUTE_BRIEF,
               "Executes the add operation, the documents are added to the "
               "target collection.");
 REGISTER_HELP(COLLECTIONADD_EXECUTE_RETURNS, "@returns A Result object.");
+REGISTER_HELP(
+    COLLECTIONADD_EXECUTE_DETAIL,
+    "If the documents do not fit into a single message, as limited by the "
+    "mysqlx_max_allowed_packet system variable, they are inserted using "
+    "multiple statements. If any of these statements fails, documents "
+    "inserted by the other ones are not removed, a transaction should be used "
+    "if the whole operation needs to be atomic.");
 
 /**
  * $(COLLECTIONADD_EXECUTE_BRIEF)
  *
  * $(COLLECTIONADD_EXECUTE_RETURNS)
  *
+ * $(COLLECTIONADD_EXECUTE_DETAIL)
+ *
  * #### Method Chaining
  *
  * This function can be invoked once after:
@@ -329,8 +352,26 @@ shcore::Value CollectionAdd::execute(bool upsert) {
 
   std::shared_ptr<mysqlx::Result> result;
   if (!message_.mutable_row()->empty()) {
-    result = std::make_shared<mysqlx::Result>(safe_exec(
-        [this]() { return session()->session()->execute_crud(message_); }));
+    result = std::make_shared<mysqlx::Result>(
+        safe_exec([this]() -> std::shared_ptr<mysqlshdk::db::IResult> {
+          const auto xsession = session()->session();
+
+          // check the server limit only if message is large, as this requires
+          // a round trip
+          if (const auto size = message_.ByteSizeLong();
+              size > k_batch_check_threshold) {
+            const auto row =
+                xsession->query("SELECT @@mysqlx_max_allowed_packet")
+                    ->fetch_one_or_throw();
+            const auto max_message_size = row->get_uint(0);
+
+            if (size > max_message_size) {
+              return execute_in_batches(max_message_size);
+            }
+          }
+
+          return xsession->execute_crud(message_);
+        }));
   } else {
     result = std::make_shared<mysqlx::Result>(nullptr);
   }
@@ -339,5 +380,82 @@ shcore::Value CollectionAdd::execute(bool upsert) {
                 : shcore::Value::Null();
 }
 
+std::shared_ptr<mysqlshdk::db::IResult> CollectionAdd::execute_in_batches(
+    std::size_t max_message_size) {
+  mysqlshdk::utils::Profile_timer timer;
+  timer.stage_begin("CollectionAdd::execute_in_batches");
+
+  const auto xsession = session()->session();
+
+  // move the rows out of the message, so that it can be used as the header
+  // of each batch, rows are put back once all batches are sent
+  google::protobuf::RepeatedPtrField<Mysqlx::Crud::Insert::TypedRow> rows;
+  rows.Swap(message_.mutable_row());
+  shcore::on_leave_scope restore_rows(
+      [this, &rows]() { message_.mutable_row()->Swap(&rows); });
+
+  const auto header_size = message_.ByteSizeLong();
+  const auto max_batch_size =
+      max_message_size > header_size + k_row_overhead
+          ? max_message_size - header_size - k_row_overhead
+          : 0;
+
+  xsession->start_pipeline(k_max_batches_in_flight);
+
+  for (int begin = 0, size = rows.size(); begin < size;) {
+    int end = begin;
+    std::size_t batch_size = 0;
+
+    // batch holds at least one row, if it's too big server reports an error
+    do {
+      batch_size += rows.Get(end).ByteSizeLong() + k_row_overhead;
+      ++end;
+    } while (end < size &&
+             batch_size + rows.Get(end).ByteSizeLong() + k_row_overhead <=
+                 max_batch_size);
+
+    // rows are swapped in and out, not copied
+    for (int i = begin; i < end; ++i) {
+      message_.mutable_row()->Add()->Swap(rows.Mutable(i));
+    }
+
+    shcore::on_leave_scope restore_batch([this, &rows, begin, end]() {
+      for (int i = begin; i < end; ++i) {
+        rows.Mutable(i)->Swap(message_.mutable_row(i - begin));
+      }
+
+      message_.mutable_row()->Clear();
+    });
+
+    xsession->enqueue(message_);
+
+    begin = end;
+  }
+
+  std::shared_ptr<mysqlshdk::db::mysqlx::Result> result;
+
+  for (auto &batch : xsession->flush_pipeline()) {
+    if (batch.error) {
+      // batches are executed independently, the ones which succeeded are not
+      // rolled back
+      throw *batch.error;
+    }
+
+    auto batch_result =
+        std::static_pointer_cast<mysqlshdk::db::mysqlx::Result>(batch.result);
+
+    if (result) {
+      result->merge(batch_result.get());
+    } else {
+      result = std::move(batch_result);
+    }
+  }
+
+  timer.stage_end();
+  result->set_execution_time(timer.total_seconds_elapsed());
+
+  return result;
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
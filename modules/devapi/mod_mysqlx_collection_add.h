@@ -72,6 +72,8 @@ class CollectionAdd : public Collection_crud_definition,
  private:
   friend class Collection;
   void add_one_document(shcore::Value doc, const std::string &error_context);
+  std::shared_ptr<mysqlshdk::db::IResult> execute_in_batches(
+      std::size_t max_message_size);
   bool allow_prepared_statements() override { return false; }
 
   std::vector<std::string> last_document_ids_;
@@ -34,6 +34,7 @@
 #include "mysqlshdk/include/scripting/type_info/generic.h"
 #include "mysqlshdk/include/shellcore/base_shell.h"
 #include "mysqlshdk/include/shellcore/utils_help.h"
+#include "mysqlshdk/libs/db/arrow_batch.h"
 #include "mysqlshdk/libs/db/charset.h"
 #include "mysqlshdk/libs/db/row_copy.h"
 #include "mysqlshdk/libs/db/session.h"
@@ -454,6 +455,7 @@ DocResult::DocResult(std::shared_ptr<mysqlshdk::db::mysqlx::Result> result)
     : BaseResult(result) {
   expose("fetchOne", &DocResult::fetch_one);
   expose("fetchAll", &DocResult::fetch_all);
+  expose("fetchMany", &DocResult::fetch_many, "count");
 }
 
 // Documentation of fetchOne function
@@ -522,6 +524,43 @@ shcore::Array_t DocResult::fetch_all() const {
   return array;
 }
 
+// Documentation of fetchMany function
+REGISTER_HELP_FUNCTION(fetchMany, DocResult);
+REGISTER_HELP_FUNCTION_TEXT(DOCRESULT_FETCHMANY, R"*(
+Returns a list with up to count documents left on the result.
+
+@param count The maximum number of documents to be returned.
+
+@returns A List of DbDoc objects.
+
+Only the requested documents are read from the server, this allows processing
+large results in batches, without holding all the documents in memory.
+
+If there are no documents left on the result, an empty list is returned.
+)*");
+/**
+ * $(DOCRESULT_FETCHMANY_BRIEF)
+ *
+ * $(DOCRESULT_FETCHMANY)
+ */
+#if DOXYGEN_JS
+List DocResult::fetchMany(Integer count) {}
+#elif DOXYGEN_PY
+list DocResult::fetch_many(int count) {}
+#endif
+shcore::Array_t DocResult::fetch_many(uint64_t count) const {
+  auto array = shcore::make_array();
+
+  while (array->size() < count) {
+    auto record = fetch_one();
+    if (!record) break;
+
+    array->emplace_back(std::move(record));
+  }
+
+  return array;
+}
+
 void DocResult::append_json(shcore::JSON_dumper &dumper) const {
   dumper.start_object();
 
@@ -548,6 +587,12 @@ RowResult::RowResult(std::shared_ptr<mysqlshdk::db::mysqlx::Result> result)
 
   expose("fetchOne", &RowResult::fetch_one);
   expose("fetchAll", &RowResult::fetch_all);
+  expose("fetchMany", &RowResult::fetch_many, "count");
+  expose("fetchOneInto", &RowResult::fetch_one_into, "row");
+  expose("toArrow", &RowResult::to_arrow, "?batchSize",
+         uint64_t{mysqlshdk::db::Arrow_batch_builder::k_default_batch_size});
+  expose("toPandas", &RowResult::to_pandas, "?batchSize",
+         uint64_t{mysqlshdk::db::Arrow_batch_builder::k_default_batch_size});
   expose("fetchOneObject", &RowResult::_fetch_one_object);
 }
 
@@ -672,6 +717,36 @@ std::shared_ptr<mysqlsh::Row> RowResult::fetch_one() const {
   return ret_val;
 }
 
+// Documentation of fetchOneInto function
+REGISTER_HELP_FUNCTION(fetchOneInto, RowResult);
+REGISTER_HELP_FUNCTION_TEXT(ROWRESULT_FETCHONEINTO, R"*(
+Reads the next row of the result into the given Row object.
+
+@param row A Row object previously returned by <<<fetchOne>>>() on this
+result.
+
+@returns A boolean value indicating whether a row was read.
+
+The values of the given row are replaced with the ones of the next row, no new
+Row object is created. This allows iterating over large results without
+creating an object for each of the rows.
+
+If there are no rows left on the result, false is returned and the row is not
+modified.
+
+An error is thrown if the given row has different columns than the result.
+)*");
+/**
+ * $(ROWRESULT_FETCHONEINTO_BRIEF)
+ *
+ * $(ROWRESULT_FETCHONEINTO)
+ */
+#if DOXYGEN_JS
+Bool RowResult::fetchOneInto(Row row) {}
+#elif DOXYGEN_PY
+bool RowResult::fetch_one_into(Row row) {}
+#endif
+
 REGISTER_HELP_FUNCTION(fetchOneObject, RowResult);
 
 REGISTER_HELP_FUNCTION_TEXT(ROWRESULT_FETCHONEOBJECT, R"*(
@@ -733,6 +808,93 @@ shcore::Array_t RowResult::fetch_all() const {
   return array;
 }
 
+// Documentation of fetchMany function
+REGISTER_HELP_FUNCTION(fetchMany, RowResult);
+REGISTER_HELP_FUNCTION_TEXT(ROWRESULT_FETCHMANY, R"*(
+Returns a list with up to count rows left on the result.
+
+@param count The maximum number of rows to be returned.
+
+@returns A List of rows.
+
+Each row is a list with the values of its fields, in the same order as the
+columns of the result.
+
+In Python each row is returned as a tuple, which is created directly from the
+data received from the server, this is the fastest way to retrieve large
+results.
+
+If there are no rows left on the result, an empty list is returned.
+)*");
+/**
+ * $(ROWRESULT_FETCHMANY_BRIEF)
+ *
+ * $(ROWRESULT_FETCHMANY)
+ */
+#if DOXYGEN_JS
+List RowResult::fetchMany(Integer count) {}
+#elif DOXYGEN_PY
+list RowResult::fetch_many(int count) {}
+#endif
+
+// Documentation of the toArrow function
+REGISTER_HELP_FUNCTION_MODE(toArrow, RowResult, PYTHON);
+REGISTER_HELP_FUNCTION_TEXT(ROWRESULT_TOARROW, R"*(
+Returns the rows left on the result as a pyarrow Table.
+
+@param batchSize Optional maximum number of rows in each record batch of
+the table, default: 65536.
+
+@returns A pyarrow.Table object.
+
+The rows are read from the server in batches and written directly to the
+columnar Arrow buffers, the resulting table consists of a record batch for each
+of the batches.
+
+The columns are converted to the following Arrow types:
+
+@li integer types and BIT - int64, or uint64 if unsigned
+@li FLOAT, DOUBLE - float, double
+@li DATE - date32, zero dates are converted to nulls
+@li DATETIME, TIMESTAMP - timestamp[us], zero dates are converted to nulls
+@li TIME - duration[us]
+@li binary strings and geometry - large_binary
+@li other types (including DECIMAL) - large_string
+
+This function requires the pyarrow module.
+)*");
+/**
+ * $(ROWRESULT_TOARROW_BRIEF)
+ *
+ * $(ROWRESULT_TOARROW)
+ */
+#if DOXYGEN_PY
+pyarrow.Table RowResult::to_arrow(int batchSize) {}
+#endif
+
+// Documentation of the toPandas function
+REGISTER_HELP_FUNCTION_MODE(toPandas, RowResult, PYTHON);
+REGISTER_HELP_FUNCTION_TEXT(ROWRESULT_TOPANDAS, R"*(
+Returns the rows left on the result as a pandas DataFrame.
+
+@param batchSize Optional maximum number of rows in each record batch of
+the intermediate pyarrow Table, default: 65536.
+
+@returns A pandas.DataFrame object.
+
+Converts the pyarrow Table returned by <<<toArrow>>>() to a DataFrame.
+
+This function requires the pyarrow and pandas modules.
+)*");
+/**
+ * $(ROWRESULT_TOPANDAS_BRIEF)
+ *
+ * $(ROWRESULT_TOPANDAS)
+ */
+#if DOXYGEN_PY
+pandas.DataFrame RowResult::to_pandas(int batchSize) {}
+#endif
+
 void RowResult::append_json(shcore::JSON_dumper &dumper) const {
   bool create_object = (dumper.deep_level() == 0);
 
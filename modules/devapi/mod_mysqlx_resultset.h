@@ -165,16 +165,20 @@ class SHCORE_PUBLIC DocResult : public BaseResult {
 
   shcore::Dictionary_t fetch_one() const;
   shcore::Array_t fetch_all() const;
+  shcore::Array_t fetch_many(uint64_t count) const;
 
   std::string class_name() const override { return "DocResult"; }
+  bool has_documents() const override { return true; }
   void append_json(shcore::JSON_dumper &dumper) const override;
 
 #if DOXYGEN_JS
   Document fetchOne();
   List fetchAll();
+  List fetchMany(Integer count);
 #elif DOXYGEN_PY
   Document fetch_one();
   list fetch_all();
+  list fetch_many(int count);
 #endif
 
  private:
@@ -204,6 +208,8 @@ class SHCORE_PUBLIC RowResult : public BaseResult {
   Row fetchOne();
   Dictionary fetchOneObject();
   List fetchAll();
+  List fetchMany(Integer count);
+  Bool fetchOneInto(Row row);
 
   Integer columnCount;  //!< Same as getColumnCount()
   List columnNames;     //!< Same as getColumnNames()
@@ -216,6 +222,10 @@ class SHCORE_PUBLIC RowResult : public BaseResult {
   Row fetch_one();
   dict fetch_one_object();
   list fetch_all();
+  list fetch_many(int count);
+  bool fetch_one_into(Row row);
+  pyarrow.Table to_arrow(int batch_size);
+  pandas.DataFrame to_pandas(int batch_size);
 
   int column_count;   //!< Same as get_column_count()
   list column_names;  //!< Same as get_column_names()
@@ -25,6 +25,7 @@
 #include <sstream>
 #include <string>
 #include <vector>
+#include "db/mysqlx/expr_cache.h"
 #include "modules/devapi/mod_mysqlx_expression.h"
 #include "modules/devapi/mod_mysqlx_resultset.h"
 #include "modules/devapi/mod_mysqlx_table.h"
@@ -241,8 +242,10 @@ shcore::Value TableUpdate::set(const shcore::Argument_list &args) {
 
     // Calls set for each of the values
     if (!expr_data.empty()) {
-      ::mysqlx::Expr_parser parser(expr_data, false, false, &_placeholders);
-      operation->set_allocated_value(parser.expr().release());
+      operation->set_allocated_value(
+          ::mysqlx::Expr_cache::instance()
+              .parse(expr_data, false, &_placeholders)
+              .release());
     } else {
       operation->mutable_value()->set_type(Mysqlx::Expr::Expr::LITERAL);
       operation->mutable_value()->set_allocated_literal(
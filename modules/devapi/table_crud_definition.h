@@ -27,7 +27,7 @@
 #ifndef MODULES_DEVAPI_TABLE_CRUD_DEFINITION_H_
 #define MODULES_DEVAPI_TABLE_CRUD_DEFINITION_H_
 
-#include "db/mysqlx/expr_parser.h"
+#include "db/mysqlx/expr_cache.h"
 #include "modules/devapi/crud_definition.h"
 #include "mysqlxtest_utils.h"
 #include "scripting/common.h"
@@ -49,9 +49,7 @@ class Table_crud_definition : public Crud_definition {
  protected:
   void parse_string_expression(::Mysqlx::Expr::Expr *expr,
                                const std::string &expr_str) override {
-    ::mysqlx::Expr_parser parser(expr_str, false);
-    // FIXME the parser should be changed to encode into the provided object
-    expr->CopyFrom(*parser.expr());
+    expr->CopyFrom(*::mysqlx::Expr_cache::instance().parse(expr_str, false));
   }
 };
 }  // namespace mysqlx
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include "modules/mod_extensible_object.h"
+
+#include "modules/mod_lazy_plugin.h"
+
+#include <utility>
+
+#include "mysqlshdk/include/scripting/naming_style.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+
+namespace mysqlsh {
+
+Lazy_plugin::Lazy_plugin(
+    const std::string &name, std::function<bool()> load,
+    std::function<shcore::Value(const std::string &)> get_global)
+    : m_name(name),
+      m_load(std::move(load)),
+      m_get_global(std::move(get_global)) {}
+
+shcore::Object_bridge_ref Lazy_plugin::load(const std::string &global) {
+  if (State::PENDING == m_state) {
+    if (m_loading) {
+      throw shcore::Exception::runtime_error(
+          "The global object '" + global + "' of the plugin '" + m_name +
+          "' cannot be used while the plugin is being loaded.");
+    }
+
+    log_info("Loading plugin '%s' on first use of '%s'", m_name.c_str(),
+             global.c_str());
+
+    bool loaded = false;
+
+    m_loading = true;
+
+    try {
+      loaded = m_load();
+    } catch (...) {
+      m_loading = false;
+      m_state = State::FAILED;
+      throw;
+    }
+
+    m_loading = false;
+    m_state = loaded ? State::LOADED : State::FAILED;
+  }
+
+  if (State::FAILED == m_state) {
+    throw shcore::Exception::runtime_error(
+        "Failed to load the plugin '" + m_name +
+        "', for more details look at the log at: " +
+        shcore::current_logger()->logfile_name());
+  }
+
+  const auto value = m_get_global(global);
+
+  if (shcore::Object == value.get_type()) {
+    const auto object = value.as_object();
+
+    if (!std::dynamic_pointer_cast<Lazy_plugin_object>(object)) {
+      return object;
+    }
+  }
+
+  throw shcore::Exception::runtime_error(
+      "The plugin '" + m_name + "' did not register the global object '" +
+      global + "' declared in its manifest.");
+}
+
+Lazy_plugin_object::Lazy_plugin_object(
+    const std::string &name, const std::vector<std::string> &members,
+    const std::shared_ptr<Lazy_plugin> &plugin)
+    : m_name(name), m_members(members), m_plugin(plugin) {}
+
+shcore::Cpp_object_bridge *Lazy_plugin_object::target() const {
+  if (!m_target) {
+    const auto object = m_plugin->load(m_name);
+
+    m_target = std::dynamic_pointer_cast<shcore::Cpp_object_bridge>(object);
+
+    if (!m_target) {
+      throw shcore::Exception::runtime_error(
+          "The global object '" + m_name + "' registered by the plugin '" +
+          m_plugin->name() + "' is not an extension object.");
+    }
+  }
+
+  return m_target.get();
+}
+
+std::vector<std::string> Lazy_plugin_object::get_members() const {
+  if (m_target || m_members.empty()) {
+    return target()->get_members();
+  }
+
+  // completion does not need to load the plugin
+  std::vector<std::string> members;
+  members.reserve(m_members.size());
+
+  const auto style = shcore::current_naming_style();
+
+  for (const auto &member : m_members) {
+    members.emplace_back(shcore::NamingStyle::LowerCaseUnderscores == style
+                             ? shcore::from_camel_case(member)
+                             : member);
+  }
+
+  return members;
+}
+
+shcore::Value Lazy_plugin_object::get_member(const std::string &prop) const {
+  return target()->get_member(prop);
+}
+
+bool Lazy_plugin_object::has_member(const std::string &prop) const {
+  return target()->has_member(prop);
+}
+
+void Lazy_plugin_object::set_member(const std::string &prop,
+                                    shcore::Value value) {
+  target()->set_member(prop, std::move(value));
+}
+
+bool Lazy_plugin_object::has_method(const std::string &name) const {
+  return target()->has_method(name);
+}
+
+shcore::Value Lazy_plugin_object::call(const std::string &name,
+                                       const shcore::Argument_list &args) {
+  return target()->call(name, args);
+}
+
+shcore::Value Lazy_plugin_object::get_member_advanced(
+    const std::string &prop) const {
+  return target()->get_member_advanced(prop);
+}
+
+bool Lazy_plugin_object::has_member_advanced(const std::string &prop) const {
+  return target()->has_member_advanced(prop);
+}
+
+void Lazy_plugin_object::set_member_advanced(const std::string &prop,
+                                             shcore::Value value) {
+  target()->set_member_advanced(prop, std::move(value));
+}
+
+bool Lazy_plugin_object::has_method_advanced(const std::string &name) const {
+  return target()->has_method_advanced(name);
+}
+
+shcore::Value Lazy_plugin_object::call_advanced(
+    const std::string &name, const shcore::Argument_list &args,
+    const shcore::Dictionary_t &kwargs) {
+  return target()->call_advanced(name, args, kwargs);
+}
+
+std::string &Lazy_plugin_object::append_descr(std::string &s_out, int indent,
+                                              int quote_strings) const {
+  return target()->append_descr(s_out, indent, quote_strings);
+}
+
+std::string &Lazy_plugin_object::append_repr(std::string &s_out) const {
+  return target()->append_repr(s_out);
+}
+
+std::string Lazy_plugin_object::help(const std::string &item) {
+  return target()->help(item);
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include "modules/mod_extensible_object.h"
+
+#ifndef MODULES_MOD_LAZY_PLUGIN_H_
+#define MODULES_MOD_LAZY_PLUGIN_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/include/scripting/types_cpp.h"
+
+namespace mysqlsh {
+
+/**
+ * A plugin which provides a manifest, its initialization file is executed
+ * only when one of the global objects it declares is used for the first time.
+ */
+class Lazy_plugin final {
+ public:
+  /**
+   * @param name name of the plugin
+   * @param load executes the initialization file, returns false on errors
+   * @param get_global returns the current value of a global
+   */
+  Lazy_plugin(const std::string &name, std::function<bool()> load,
+              std::function<shcore::Value(const std::string &)> get_global);
+
+  Lazy_plugin(const Lazy_plugin &) = delete;
+  Lazy_plugin(Lazy_plugin &&) = delete;
+
+  Lazy_plugin &operator=(const Lazy_plugin &) = delete;
+  Lazy_plugin &operator=(Lazy_plugin &&) = delete;
+
+  ~Lazy_plugin() = default;
+
+  const std::string &name() const { return m_name; }
+
+  /**
+   * Whether the initialization file is being executed, the placeholder
+   * objects can be replaced only at this time.
+   */
+  bool loading() const { return m_loading; }
+
+  /**
+   * Executes the initialization file (once) and returns the global object
+   * registered by the plugin.
+   *
+   * @throws shcore::Exception if plugin could not be loaded or if it did not
+   *         register the object
+   */
+  shcore::Object_bridge_ref load(const std::string &global);
+
+ private:
+  enum class State { PENDING, LOADED, FAILED };
+
+  std::string m_name;
+  std::function<bool()> m_load;
+  std::function<shcore::Value(const std::string &)> m_get_global;
+  State m_state = State::PENDING;
+  bool m_loading = false;
+};
+
+/**
+ * Placeholder registered as a global object on behalf of a lazy plugin. On
+ * first use, the plugin is loaded and all operations are forwarded to the
+ * real object.
+ */
+class Lazy_plugin_object final : public shcore::Cpp_object_bridge {
+ public:
+  /**
+   * @param name name of the global object
+   * @param members members declared in the manifest (camelCase), used for
+   *        completion before the plugin is loaded
+   * @param plugin plugin which registers the object
+   */
+  Lazy_plugin_object(const std::string &name,
+                     const std::vector<std::string> &members,
+                     const std::shared_ptr<Lazy_plugin> &plugin);
+
+  std::string class_name() const override { return "ExtensionObject"; }
+
+  bool operator==(const Object_bridge &other) const override {
+    return this == &other;
+  }
+
+  const std::shared_ptr<Lazy_plugin> &plugin() const { return m_plugin; }
+
+  std::vector<std::string> get_members() const override;
+
+  shcore::Value get_member(const std::string &prop) const override;
+  bool has_member(const std::string &prop) const override;
+  void set_member(const std::string &prop, shcore::Value value) override;
+  bool has_method(const std::string &name) const override;
+  shcore::Value call(const std::string &name,
+                     const shcore::Argument_list &args) override;
+
+  shcore::Value get_member_advanced(const std::string &prop) const override;
+  bool has_member_advanced(const std::string &prop) const override;
+  void set_member_advanced(const std::string &prop,
+                           shcore::Value value) override;
+  bool has_method_advanced(const std::string &name) const override;
+  shcore::Value call_advanced(const std::string &name,
+                              const shcore::Argument_list &args,
+                              const shcore::Dictionary_t &kwargs = {}) override;
+
+  std::string &append_descr(std::string &s_out, int indent = -1,
+                            int quote_strings = 0) const override;
+  std::string &append_repr(std::string &s_out) const override;
+
+  std::string help(const std::string &item = {}) override;
+
+ private:
+  shcore::Cpp_object_bridge *target() const;
+
+  std::string m_name;
+  std::vector<std::string> m_members;
+  std::shared_ptr<Lazy_plugin> m_plugin;
+  mutable std::shared_ptr<shcore::Cpp_object_bridge> m_target;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_MOD_LAZY_PLUGIN_H_
@@ -33,6 +33,7 @@
 #include "mysqlshdk/include/scripting/type_info/generic.h"
 #include "mysqlshdk/include/shellcore/base_shell.h"
 #include "mysqlshdk/include/shellcore/utils_help.h"
+#include "mysqlshdk/libs/db/arrow_batch.h"
 #include "mysqlshdk/libs/db/charset.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_json.h"
@@ -70,6 +71,12 @@ ClassicResult::ClassicResult(
   expose("fetchOne", &ClassicResult::fetch_one);
   expose("fetchOneObject", &ClassicResult::_fetch_one_object);
   expose("fetchAll", &ClassicResult::fetch_all);
+  expose("fetchMany", &ClassicResult::fetch_many, "count");
+  expose("fetchOneInto", &ClassicResult::fetch_one_into, "row");
+  expose("toArrow", &ClassicResult::to_arrow, "?batchSize",
+         uint64_t{mysqlshdk::db::Arrow_batch_builder::k_default_batch_size});
+  expose("toPandas", &ClassicResult::to_pandas, "?batchSize",
+         uint64_t{mysqlshdk::db::Arrow_batch_builder::k_default_batch_size});
   expose("nextDataSet", &ClassicResult::next_data_set);
   expose("nextResult", &ClassicResult::next_result);
   expose("hasData", &ClassicResult::has_data);
@@ -111,6 +118,36 @@ std::shared_ptr<mysqlsh::Row> ClassicResult::fetch_one() const {
   return fetch_one_row();
 }
 
+// Documentation of fetchOneInto function
+REGISTER_HELP_FUNCTION(fetchOneInto, ClassicResult);
+REGISTER_HELP_FUNCTION_TEXT(CLASSICRESULT_FETCHONEINTO, R"*(
+Reads the next row of the result into the given Row object.
+
+@param row A Row object previously returned by <<<fetchOne>>>() on this
+result.
+
+@returns A boolean value indicating whether a row was read.
+
+The values of the given row are replaced with the ones of the next row, no new
+Row object is created. This allows iterating over large results without
+creating an object for each of the rows.
+
+If there are no rows left on the result, false is returned and the row is not
+modified.
+
+An error is thrown if the given row has different columns than the result.
+)*");
+/**
+ * $(CLASSICRESULT_FETCHONEINTO_BRIEF)
+ *
+ * $(CLASSICRESULT_FETCHONEINTO)
+ */
+#if DOXYGEN_JS
+Bool ClassicResult::fetchOneInto(Row row) {}
+#elif DOXYGEN_PY
+bool ClassicResult::fetch_one_into(Row row) {}
+#endif
+
 REGISTER_HELP_FUNCTION(fetchOneObject, ClassicResult);
 REGISTER_HELP_FUNCTION_TEXT(CLASSICRESULT_FETCHONEOBJECT, R"*(
 Retrieves the next Row on the result and returns it as an object.
@@ -226,6 +263,93 @@ shcore::Array_t ClassicResult::fetch_all() const {
   return array;
 }
 
+// Documentation of the fetchMany function
+REGISTER_HELP_FUNCTION(fetchMany, ClassicResult);
+REGISTER_HELP_FUNCTION_TEXT(CLASSICRESULT_FETCHMANY, R"*(
+Returns a list with up to count records left on the result.
+
+@param count The maximum number of records to be returned.
+
+@returns A List of records.
+
+Each record is a list with the values of its fields, in the same order as the
+columns of the result.
+
+In Python each record is returned as a tuple, which is created directly from
+the data received from the server, this is the fastest way to retrieve large
+results.
+
+If there are no records left on the result, an empty list is returned.
+)*");
+/**
+ * $(CLASSICRESULT_FETCHMANY_BRIEF)
+ *
+ * $(CLASSICRESULT_FETCHMANY)
+ */
+#if DOXYGEN_JS
+List ClassicResult::fetchMany(Integer count) {}
+#elif DOXYGEN_PY
+list ClassicResult::fetch_many(int count) {}
+#endif
+
+// Documentation of the toArrow function
+REGISTER_HELP_FUNCTION_MODE(toArrow, ClassicResult, PYTHON);
+REGISTER_HELP_FUNCTION_TEXT(CLASSICRESULT_TOARROW, R"*(
+Returns the records left on the result as a pyarrow Table.
+
+@param batchSize Optional maximum number of records in each record batch of
+the table, default: 65536.
+
+@returns A pyarrow.Table object.
+
+The records are read from the server in batches and written directly to the
+columnar Arrow buffers, the resulting table consists of a record batch for each
+of the batches.
+
+The columns are converted to the following Arrow types:
+
+@li integer types and BIT - int64, or uint64 if unsigned
+@li FLOAT, DOUBLE - float, double
+@li DATE - date32, zero dates are converted to nulls
+@li DATETIME, TIMESTAMP - timestamp[us], zero dates are converted to nulls
+@li TIME - duration[us]
+@li binary strings and geometry - large_binary
+@li other types (including DECIMAL) - large_string
+
+This function requires the pyarrow module.
+)*");
+/**
+ * $(CLASSICRESULT_TOARROW_BRIEF)
+ *
+ * $(CLASSICRESULT_TOARROW)
+ */
+#if DOXYGEN_PY
+pyarrow.Table ClassicResult::to_arrow(int batchSize) {}
+#endif
+
+// Documentation of the toPandas function
+REGISTER_HELP_FUNCTION_MODE(toPandas, ClassicResult, PYTHON);
+REGISTER_HELP_FUNCTION_TEXT(CLASSICRESULT_TOPANDAS, R"*(
+Returns the records left on the result as a pandas DataFrame.
+
+@param batchSize Optional maximum number of records in each record batch of
+the intermediate pyarrow Table, default: 65536.
+
+@returns A pandas.DataFrame object.
+
+Converts the pyarrow Table returned by <<<toArrow>>>() to a DataFrame.
+
+This function requires the pyarrow and pandas modules.
+)*");
+/**
+ * $(CLASSICRESULT_TOPANDAS_BRIEF)
+ *
+ * $(CLASSICRESULT_TOPANDAS)
+ */
+#if DOXYGEN_PY
+pandas.DataFrame ClassicResult::to_pandas(int batchSize) {}
+#endif
+
 // Documentation of getAffectedRowCount function
 REGISTER_HELP_PROPERTY(affectedRowCount, ClassicResult);
 REGISTER_HELP(CLASSICRESULT_AFFECTEDROWCOUNT_BRIEF,
@@ -77,6 +77,8 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
   Row fetchOne();
   Dictionary fetchOneObject();
   List fetchAll();
+  List fetchMany(Integer count);
+  Bool fetchOneInto(Row row);
   Integer getAffectedItemsCount();
   Integer getAffectedRowCount();
   Integer getColumnCount();
@@ -121,6 +123,10 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
   Row fetch_one();
   dict fetch_one_object();
   list fetch_all();
+  list fetch_many(int count);
+  bool fetch_one_into(Row row);
+  pyarrow.Table to_arrow(int batch_size);
+  pandas.DataFrame to_pandas(int batch_size);
   int get_affected_items_count();
   int get_affected_row_count();
   int get_column_count();
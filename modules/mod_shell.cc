@@ -22,13 +22,19 @@
  */
 #include "modules/mod_shell.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "modules/adminapi/common/common.h"
 #include "modules/devapi/base_database_object.h"
 #include "modules/devapi/mod_mysqlx_schema.h"
 #include "modules/devapi/mod_mysqlx_session.h"
+#include "modules/mod_lazy_plugin.h"
 #include "modules/mod_mysql_session.h"
 #include "modules/mod_utils.h"
 #include "modules/mysqlxtest_utils.h"
@@ -36,11 +42,14 @@
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
 #include "mysqlshdk/include/shellcore/base_session.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/include/shellcore/shell_notifications.h"
 #include "mysqlshdk/include/shellcore/shell_resultset_dumper.h"
 #include "mysqlshdk/include/shellcore/utils_help.h"
 #include "mysqlshdk/libs/db/utils_connection.h"
 #include "mysqlshdk/libs/ssh/ssh_common.h"
+#include "mysqlshdk/libs/utils/log_sql.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -204,6 +213,10 @@ void Shell::init() {
       ->cli(false);
   expose("dumpRows", &Shell::dump_rows, "resultset", "?format", "table")
       ->cli(false);
+  expose("dumpStatementStats", &Shell::dump_statement_stats)->cli(false);
+  expose("getMemoryStats", &Shell::get_memory_stats)->cli(false);
+  expose("parallel", &Shell::parallel, "fn", "items", "?threads")
+      ->cli(false);
   expose("connect", &Shell::connect, "connectionData", "?password")->cli(false);
   expose("disconnect", &Shell::disconnect)->cli(false);
   expose("reconnect", &Shell::reconnect)->cli(false);
@@ -2097,8 +2110,17 @@ void Shell::register_global(const std::string &name,
   // variables but should be considered as shell globals.
   bool is_global = _shell_core->is_global(name);
   if (is_global) {
-    throw shcore::Exception::argument_error("A global named '" + name +
-                                            "' already exists.");
+    // a plugin which is being loaded on demand replaces its placeholder
+    const auto current = _shell_core->get_global(name);
+    const auto placeholder =
+        shcore::Object == current.get_type()
+            ? current.as_object<Lazy_plugin_object>()
+            : nullptr;
+
+    if (!placeholder || !placeholder->plugin()->loading()) {
+      throw shcore::Exception::argument_error("A global named '" + name +
+                                              "' already exists.");
+    }
   }
 
   if (name == "mysql" || name == "mysqlx" || name == "os" || name == "sys") {
@@ -2177,6 +2199,201 @@ int Shell::dump_rows(const std::shared_ptr<ShellBaseResult> &resultset,
                               false);
 }
 
+REGISTER_HELP_FUNCTION(dumpStatementStats, shell);
+REGISTER_HELP_FUNCTION_TEXT(SHELL_DUMPSTATEMENTSTATS, R"*(
+Prints the latency statistics of the SQL statements executed by the shell.
+
+Statements are grouped by the SQL logging context (i.e. name of the API
+function which was being executed) and by the statement fingerprint, which is
+the statement with all literals replaced with '?'. For each group, the number
+of executions, the total and the average execution time and the 50th, 90th and
+99th percentiles are reported, in milliseconds.
+
+The statistics are also written to a file when the shell exits, if the
+logSql.statsFile option is set.
+)*");
+
+/**
+ * $(SHELL_DUMPSTATEMENTSTATS_BRIEF)
+ *
+ * $(SHELL_DUMPSTATEMENTSTATS)
+ */
+#if DOXYGEN_JS
+Undefined Shell::dumpStatementStats() {}
+#elif DOXYGEN_PY
+None Shell::dump_statement_stats() {}
+#endif
+void Shell::dump_statement_stats() {
+  current_console()->print(
+      shcore::current_log_sql()->statement_stats().format());
+}
+
+REGISTER_HELP_FUNCTION(getMemoryStats, shell);
+REGISTER_HELP_FUNCTION_TEXT(SHELL_GETMEMORYSTATS, R"*(
+Provides the memory used by the subsystems of the shell.
+
+@returns A dictionary with the memory statistics.
+
+The returned dictionary contains the following keys:
+
+@li <b>used</b>: memory currently used by all subsystems, in bytes.
+@li <b>peak</b>: highest memory used by all subsystems at the same time, in
+bytes.
+@li <b>subsystems</b>: a dictionary with the <b>used</b> and <b>peak</b> memory
+and the number of <b>allocations</b> of each subsystem.
+
+The following subsystems are reported:
+
+@li <b>dump</b>: buffers of the rows which are being dumped.
+@li <b>load</b>: transaction buffers and data shared between the loaders.
+@li <b>rest</b>: bodies of the responses received from the REST services.
+@li <b>virtualFs</b>: memory pages of the in-memory file system.
+@li <b>results</b>: rows of the buffered query results.
+@li <b>scripting</b>: JavaScript heap, measured after garbage collection.
+
+Only large buffers are accounted for, not every allocation made by the shell.
+The same statistics are included in the progress reported by the dump and
+load utilities, if the <b>progressFormat</b> option is set to "jsonl".
+)*");
+
+/**
+ * $(SHELL_GETMEMORYSTATS_BRIEF)
+ *
+ * $(SHELL_GETMEMORYSTATS)
+ */
+#if DOXYGEN_JS
+Dictionary Shell::getMemoryStats() {}
+#elif DOXYGEN_PY
+dict Shell::get_memory_stats() {}
+#endif
+shcore::Dictionary_t Shell::get_memory_stats() {
+  return mysqlsh::get_memory_stats();
+}
+
+REGISTER_HELP_FUNCTION(parallel, shell);
+REGISTER_HELP_FUNCTION_TEXT(SHELL_PARALLEL, R"*(
+Executes a function for each of the given items using multiple threads.
+
+@param fn The function to be executed, it receives a single item as its
+argument.
+@param items A list of items to be processed.
+@param threads Optional number of threads to be used.
+
+@returns A list with the values returned by the function, in the same order as
+the items.
+
+The function is called once for each item. If the <b>threads</b> argument is
+not given or is 0, the number of threads is equal to the number of items,
+limited by the number of CPUs available to the shell.
+
+Python functions are executed by separate threads, but share the same
+interpreter: only one thread executes Python code at a time, while the others
+wait for the shell functions, i.e. database operations, to complete. Because of
+that, this function is best suited for operations which spend most of their
+time waiting for the servers, like checks executed on multiple instances. Each
+call should open its own session using <<<openSession>>>(), as the global
+session cannot be used by multiple threads at the same time.
+
+JavaScript functions are always executed sequentially, in the current thread.
+
+If any of the calls throws an exception, the remaining items are not processed
+and the first of the exceptions is thrown once all threads finish.
+)*");
+
+/**
+ * $(SHELL_PARALLEL_BRIEF)
+ *
+ * $(SHELL_PARALLEL)
+ */
+#if DOXYGEN_JS
+List Shell::parallel(Function fn, List items, Integer threads) {}
+#elif DOXYGEN_PY
+list Shell::parallel(Function fn, list items, int threads) {}
+#endif
+shcore::Array_t Shell::parallel(const shcore::Function_base_ref &fn,
+                                const shcore::Array_t &items, int threads) {
+  if (!fn) {
+    throw shcore::Exception::argument_error("The function must not be null.");
+  }
+
+  if (threads < 0) {
+    throw shcore::Exception::argument_error(
+        "The number of threads must be a non-negative integer.");
+  }
+
+  const auto result = shcore::make_array();
+
+  if (!items || items->empty()) {
+    return result;
+  }
+
+  const auto size = items->size();
+  result->resize(size);
+
+  const auto call = [&fn, &items, &result](std::size_t index) {
+    (*result)[index] = fn->invoke({items->at(index)});
+  };
+
+  if (!fn->thread_safe()) {
+    for (std::size_t i = 0; i < size; ++i) {
+      call(i);
+    }
+
+    return result;
+  }
+
+  if (0 == threads) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  std::atomic<std::size_t> next{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  const auto worker = [&]() {
+    while (!failed) {
+      const auto index = next++;
+
+      if (index >= size) {
+        break;
+      }
+
+      try {
+        call(index);
+      } catch (...) {
+        std::lock_guard lock{error_mutex};
+
+        if (!error) {
+          error = std::current_exception();
+        }
+
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(std::min<std::size_t>(threads, size));
+
+  for (std::size_t i = 0; i < workers.capacity(); ++i) {
+    workers.emplace_back(spawn_scoped_thread([&worker]() {
+      Mysql_thread mysql_thread;
+      worker();
+    }));
+  }
+
+  for (auto &w : workers) {
+    w.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  return result;
+}
+
 REGISTER_HELP_FUNCTION(autoCompleteSql, shell);
 REGISTER_HELP_FUNCTION_TEXT(SHELL_AUTOCOMPLETESQL, R"*(
 Auto-completes the given SQL statement.
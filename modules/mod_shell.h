@@ -123,6 +123,9 @@ class SHCORE_PUBLIC Shell : public shcore::Cpp_object_bridge
                                      Dictionary definition);
   Undefined registerGlobal(String name, Object object, Dictionary definition);
   Integer dumpRows(ShellBaseResult result, String format);
+  Undefined dumpStatementStats();
+  Dictionary getMemoryStats();
+  List parallel(Function fn, List items, Integer threads);
   Dictionary autoCompleteSql(String statement, Dictionary options);
 #elif DOXYGEN_PY
   Options options;
@@ -156,6 +159,9 @@ class SHCORE_PUBLIC Shell : public shcore::Cpp_object_bridge
                                         dict definition);
   Undefined register_global(str name, Object object, dict definition);
   int dump_rows(ShellBaseResult result, str format);
+  None dump_statement_stats();
+  dict get_memory_stats();
+  list parallel(Function fn, list items, int threads);
   dict auto_complete_sql(str statement, dict options);
 #endif
 
@@ -203,6 +209,13 @@ class SHCORE_PUBLIC Shell : public shcore::Cpp_object_bridge
   int dump_rows(const std::shared_ptr<ShellBaseResult> &resultset,
                 const std::string &format);
 
+  void dump_statement_stats();
+
+  shcore::Dictionary_t get_memory_stats();
+
+  shcore::Array_t parallel(const shcore::Function_base_ref &fn,
+                           const shcore::Array_t &items, int threads = 0);
+
   shcore::Dictionary_t auto_complete_sql(
       const std::string &statement,
       const shcore::Option_pack_ref<mysqlshdk::Auto_complete_sql_options>
@@ -28,6 +28,7 @@
 #include <locale>
 #include <set>
 
+#include "modules/reports/dump_progress.h"
 #include "modules/reports/query.h"
 #include "modules/reports/thread.h"
 #include "modules/reports/threads.h"
@@ -953,7 +954,7 @@ void Report::set_options(const Options &options) {
   // Validates options are not in the reserved options for the \watch
   // command. Other options such as help and vertical(E) will be properly
   // reported as clashes with command line options
-  std::set<std::string> reserved = {"interval", "nocls", "i"};
+  std::set<std::string> reserved = {"interval", "nocls", "incremental", "i"};
 
   for (const auto &o : options) {
     validate_option(*o);
@@ -1083,6 +1084,7 @@ Shell_reports::Shell_reports(const std::string &name,
     reports::register_query_report(this);
     reports::register_threads_report(this);
     reports::register_thread_report(this);
+    reports::register_dump_progress_report(this);
   }
 }
 
@@ -36,6 +36,7 @@
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
 #include "mysqlshdk/libs/utils/fault_injection.h"
+#include "mysqlshdk/libs/utils/memory_stats.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -622,12 +623,22 @@ Connection_options get_classic_connection_options(
 }
 
 std::vector<shcore::Value> get_row_values(const mysqlshdk::db::IRow &row) {
+  std::vector<shcore::Value> value_array;
+  get_row_values(row, &value_array);
+  return value_array;
+}
+
+void get_row_values(const mysqlshdk::db::IRow &row,
+                    std::vector<shcore::Value> *values) {
   using mysqlshdk::db::Type;
   using shcore::Date;
   using shcore::Value;
-  std::vector<Value> value_array;
+  auto &value_array = *values;
+  const auto c = row.num_fields();
+  value_array.clear();
+  value_array.reserve(c);
 
-  for (uint32_t i = 0, c = row.num_fields(); i < c; i++) {
+  for (uint32_t i = 0; i < c; i++) {
     Value v;
 
     if (row.is_null(i)) {
@@ -691,8 +702,30 @@ std::vector<shcore::Value> get_row_values(const mysqlshdk::db::IRow &row) {
 
     value_array.emplace_back(std::move(v));
   }
+}
 
-  return value_array;
+shcore::Dictionary_t get_memory_stats() {
+  using shcore::Memory_stats;
+
+  auto subsystems = shcore::make_dict();
+
+  for (const auto &entry : Memory_stats::entries()) {
+    auto stats = shcore::make_dict();
+
+    stats->emplace("used", entry.used);
+    stats->emplace("peak", entry.peak);
+    stats->emplace("allocations", entry.allocations);
+
+    subsystems->emplace(std::string{entry.name}, std::move(stats));
+  }
+
+  auto result = shcore::make_dict();
+
+  result->emplace("used", Memory_stats::total_used());
+  result->emplace("peak", Memory_stats::total_peak());
+  result->emplace("subsystems", std::move(subsystems));
+
+  return result;
 }
 
 }  // namespace mysqlsh
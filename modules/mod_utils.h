@@ -171,6 +171,25 @@ Connection_options SHCORE_PUBLIC get_classic_connection_options(
  */
 std::vector<shcore::Value> get_row_values(const mysqlshdk::db::IRow &row);
 
+/**
+ * Converts SQL values from a row into shcore::Values, reusing the storage of
+ * the given vector.
+ *
+ * @param row Row to be converted.
+ * @param values Receives the converted values, existing ones are discarded.
+ */
+void get_row_values(const mysqlshdk::db::IRow &row,
+                    std::vector<shcore::Value> *values);
+
+/**
+ * Provides the memory used by the subsystems of the shell, as reported by
+ * shcore::Memory_stats.
+ *
+ * @returns dictionary with the total memory used and the high-water mark, and
+ *          the same values for each subsystem, in bytes
+ */
+shcore::Dictionary_t SHCORE_PUBLIC get_memory_stats();
+
 /**
  * Returns formatted text for current active exception.
  *
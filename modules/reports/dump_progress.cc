@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/reports/dump_progress.h"
+
+#include <string>
+#include <vector>
+
+#include "modules/mod_shell_reports.h"
+#include "modules/reports/native_report.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+
+namespace mysqlsh {
+namespace reports {
+
+namespace {
+
+class Dump_progress_report : public Native_report {
+ public:
+  class Config {
+   public:
+    static const char *name() { return "dump_progress"; }
+    static Report::Type type() { return Report::Type::REPORT; }
+    static const char *brief() {
+      return "Shows the status of a running load operation.";
+    }
+
+    static std::vector<std::string> details() {
+      return {
+          "Reads the status file published by the util.loadDump() operation "
+          "started with the <b>statusFile</b> option. The file is updated "
+          "about once per second, so that the operation can be observed from "
+          "another shell instance.",
+          "The report contains the current stage and duration of the "
+          "operation, the task executed by each worker thread, the number of "
+          "pending tasks, the tables which are being loaded along with the "
+          "number of bytes in flight, and the throughput since the previous "
+          "update.",
+          "The session is not used by this report."};
+    }
+
+    static Report::Argc argc() { return {1, 1}; }
+
+    static Report::Examples examples() {
+      return {{"Show the status of the load operation which publishes it in "
+               "the /tmp/load-status.json file.",
+               {},
+               {"/tmp/load-status.json"}}};
+    }
+  };
+
+ private:
+  void parse(const shcore::Array_t &argv,
+             const shcore::Dictionary_t &) override {
+    m_status_file = argv->at(0).as_string();
+
+    if (m_status_file.empty()) {
+      throw shcore::Exception::argument_error(
+          "The path to the status file cannot be empty.");
+    }
+  }
+
+  shcore::Array_t execute() const override {
+    std::string contents;
+
+    // the file is replaced atomically, it's always complete
+    if (!shcore::load_text_file(m_status_file, contents)) {
+      throw shcore::Exception::runtime_error(shcore::str_format(
+          "Could not read the status file '%s': %s", m_status_file.c_str(),
+          shcore::get_last_error().c_str()));
+    }
+
+    shcore::Value status;
+
+    try {
+      status = shcore::Value::parse(contents);
+    } catch (const std::exception &) {
+      status = {};
+    }
+
+    if (shcore::Value_type::Map != status.get_type()) {
+      throw shcore::Exception::runtime_error(
+          "The file '" + m_status_file + "' is not a valid status file.");
+    }
+
+    auto report = shcore::make_array();
+    report->emplace_back(std::move(status));
+
+    return report;
+  }
+
+  std::string m_status_file;
+};
+
+}  // namespace
+
+void register_dump_progress_report(Shell_reports *reports) {
+  Native_report::register_report<Dump_progress_report>(reports);
+}
+
+}  // namespace reports
+}  // namespace mysqlsh
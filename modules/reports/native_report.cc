@@ -40,15 +40,39 @@ shcore::Dictionary_t create_report_response(shcore::Array_t &&report) {
   return response;
 }
 
+std::string arguments_key(const shcore::Array_t &argv,
+                          const shcore::Dictionary_t &options) {
+  return shcore::Value(argv).repr() + shcore::Value(options).repr();
+}
+
 }  // namespace
 
 shcore::Dictionary_t Native_report::report(
     const std::shared_ptr<ShellBaseSession> &session,
     const shcore::Array_t &argv, const shcore::Dictionary_t &options) {
   m_session = session->get_core_session();
-  parse(argv, options);
+
+  // don't hold the session once report is done
+  const auto release =
+      shcore::on_leave_scope([this]() { m_session.reset(); });
+
+  if (!is_prepared(session, argv, options)) {
+    m_prepared_session.reset();
+    parse(argv, options);
+    m_prepared_session = m_session;
+    m_prepared_arguments = arguments_key(argv, options);
+  }
+
   return create_report_response(execute());
 }
 
+bool Native_report::is_prepared(
+    const std::shared_ptr<ShellBaseSession> &session,
+    const shcore::Array_t &argv, const shcore::Dictionary_t &options) const {
+  const auto prepared = m_prepared_session.lock();
+  return prepared && prepared == session->get_core_session() &&
+         m_prepared_arguments == arguments_key(argv, options);
+}
+
 }  // namespace reports
 }  // namespace mysqlsh
@@ -25,6 +25,7 @@
 #define MODULES_REPORTS_NATIVE_REPORT_H_
 
 #include <memory>
+#include <string>
 
 #include "modules/mod_shell_reports.h"
 #include "mysqlshdk/include/scripting/types.h"
@@ -50,6 +51,14 @@ class Native_report {
                               const shcore::Array_t &argv,
                               const shcore::Dictionary_t &options);
 
+  /**
+   * Checks if this report was already parsed using the given session and
+   * arguments, in which case it can be executed again without parsing.
+   */
+  bool is_prepared(const std::shared_ptr<ShellBaseSession> &session,
+                   const shcore::Array_t &argv,
+                   const shcore::Dictionary_t &options) const;
+
  protected:
   virtual void parse(const shcore::Array_t &argv,
                      const shcore::Dictionary_t &options) = 0;
@@ -59,15 +68,26 @@ class Native_report {
   std::shared_ptr<mysqlshdk::db::ISession> m_session;
 
  private:
+  std::weak_ptr<mysqlshdk::db::ISession> m_prepared_session;
+  std::string m_prepared_arguments;
+
   template <typename T>
   struct Registrar {
    public:
     static std::unique_ptr<Report> create() {
       auto report = std::make_unique<Report>(
           T::Config::name(), T::Config::type(),
-          [](const std::shared_ptr<ShellBaseSession> &session,
-             const shcore::Array_t &argv, const shcore::Dictionary_t &options) {
-            return T{}.report(session, argv, options);
+          [prepared = std::shared_ptr<T>()](
+              const std::shared_ptr<ShellBaseSession> &session,
+              const shcore::Array_t &argv,
+              const shcore::Dictionary_t &options) mutable {
+            // the same report executed repeatedly with the same arguments
+            // (i.e. by the \watch command) reuses the already built queries
+            if (!prepared || !prepared->is_prepared(session, argv, options)) {
+              prepared = std::make_shared<T>();
+            }
+
+            return prepared->report(session, argv, options);
           });
 
       report->set_brief(T::Config::brief());
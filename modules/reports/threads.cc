@@ -24,9 +24,12 @@
 #include "modules/reports/threads.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -34,6 +37,8 @@
 #include "modules/reports/native_report.h"
 #include "modules/reports/utils.h"
 #include "modules/reports/utils_options.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/libs/db/result.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -320,8 +325,109 @@ std::vector<std::string> get_details() {
   XX(desc, Bool, "Causes the output to be sorted in descending order.", "",    \
      {"If the <b>desc</b> option is not provided, output is sorted in "        \
       "ascending order."})                                                     \
-  XX(limit, Integer, "Limits the number of returned threads.", "l", {}, false, \
-     false, nullable<uint64_t>)
+  XX(limit, Integer, "Limits the number of returned threads.", "l",           \
+     {"If the <b>sample</b> option is used, limits the number of returned "    \
+      "statements, default: 10."},                                             \
+     false, false, nullable<uint64_t>)                                         \
+  XX(sample, Float,                                                            \
+     "Samples the statements executed by threads for the given number of "     \
+     "seconds and lists the most frequently observed ones.",                   \
+     "",                                                                       \
+     std::vector<std::string>(                                                 \
+         {"When the <b>sample</b> option is used, the statements currently "   \
+          "executed by the selected threads are polled repeatedly and "        \
+          "aggregated by their digest, user and state. Report lists the "      \
+          "number of times each statement was observed and its load, the "     \
+          "average number of threads executing it. Only a bounded number of "  \
+          "distinct statements is tracked, if more are observed the least "    \
+          "frequent ones are evicted and the reported values become "          \
+          "approximate.",                                                      \
+          "Allowed values are in range (0, 3600]. The <b>format</b>, "         \
+          "<b>where</b>, <b>order-by</b> and <b>desc</b> options cannot be "   \
+          "used with this option."}),                                          \
+     false, false, nullable<double>)                                           \
+  XX(rate, Integer,                                                            \
+     "Number of samples taken per second when the sample option is used.", "", \
+     {"Allowed values are in range [1, 1000], default: 20."},                  \
+     false, false, nullable<uint64_t>)
+
+/**
+ * Approximate counts of the most frequently observed keys, uses a fixed number
+ * of counters (Space-Saving algorithm): once all counters are in use, a new key
+ * replaces the least frequent one and inherits its count.
+ */
+class Top_counter final {
+ public:
+  struct Entry {
+    std::string key;
+    std::vector<shcore::Value> values;
+    uint64_t count;
+  };
+
+  explicit Top_counter(std::size_t capacity) : m_capacity(capacity) {
+    m_entries.reserve(m_capacity);
+  }
+
+  void add(std::string &&key, std::vector<shcore::Value> &&values) {
+    if (const auto it = m_index.find(key); m_index.end() != it) {
+      ++m_entries[it->second].count;
+      return;
+    }
+
+    std::size_t idx;
+
+    if (m_entries.size() < m_capacity) {
+      idx = m_entries.size();
+      m_entries.emplace_back(Entry{{}, {}, 1});
+    } else {
+      idx = std::min_element(m_entries.begin(), m_entries.end(),
+                             [](const Entry &l, const Entry &r) {
+                               return l.count < r.count;
+                             }) -
+            m_entries.begin();
+
+      m_index.erase(m_entries[idx].key);
+      ++m_entries[idx].count;
+    }
+
+    m_entries[idx].key = key;
+    m_entries[idx].values = std::move(values);
+    m_index.emplace(std::move(key), idx);
+  }
+
+  /**
+   * @returns up to 'n' entries with the highest counts, in descending order
+   */
+  std::vector<const Entry *> top(std::size_t n) const {
+    std::vector<const Entry *> result;
+    result.reserve(m_entries.size());
+
+    for (const auto &e : m_entries) {
+      result.emplace_back(&e);
+    }
+
+    n = std::min(n, result.size());
+
+    std::partial_sort(result.begin(), result.begin() + n, result.end(),
+                      [](const Entry *l, const Entry *r) {
+                        return l->count > r->count;
+                      });
+    result.resize(n);
+
+    return result;
+  }
+
+ private:
+  std::size_t m_capacity;
+  std::vector<Entry> m_entries;
+  std::unordered_map<std::string, std::size_t> m_index;
+};
+
+// number of distinct statements tracked when sampling
+constexpr std::size_t k_sample_capacity = 1024;
+
+constexpr uint64_t k_default_sample_limit = 10;
+constexpr uint64_t k_default_sample_rate = 20;
 
 class Threads_report : public Native_report {
  public:
@@ -383,6 +489,16 @@ class Threads_report : public Native_report {
               << co.get_user() << co.get_host();
     }
 
+    if (o.sample) {
+      parse_sample(*o.sample, o.rate, o.limit, where, options);
+      return;
+    }
+
+    if (o.rate) {
+      throw shcore::Exception::argument_error(
+          "The 'rate' parameter can only be used with the 'sample' parameter.");
+    }
+
     // format
     if (!o.format) {
       if (o.background && !o.all && !o.foreground) {
@@ -495,7 +611,123 @@ class Threads_report : public Native_report {
     }
   }
 
+  void parse_sample(double sample, const nullable<uint64_t> &rate,
+                    const nullable<uint64_t> &limit, const std::string &where,
+                    const shcore::Dictionary_t &options) {
+    static constexpr std::pair<const char *, const char *> k_incompatible[] = {
+        {"format", "format"},
+        {"where", "where"},
+        {"order_by", "order-by"},
+        {"desc", "desc"}};
+
+    for (const auto &option : k_incompatible) {
+      if (options && options->has_key(option.first)) {
+        throw shcore::Exception::argument_error(
+            std::string{"The '"} + option.second +
+            "' parameter cannot be used with the 'sample' parameter.");
+      }
+    }
+
+    if (sample <= 0.0 || sample > 3600.0) {
+      throw shcore::Exception::argument_error(
+          "The 'sample' parameter must be a number of seconds in range (0, "
+          "3600].");
+    }
+
+    m_sample_rate = rate ? *rate : k_default_sample_rate;
+
+    if (m_sample_rate < 1 || m_sample_rate > 1000) {
+      throw shcore::Exception::argument_error(
+          "The 'rate' parameter must be in range [1, 1000].");
+    }
+
+    m_sample_duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::duration<double>(sample));
+    m_sample_limit = limit ? *limit : k_default_sample_limit;
+
+    // the session used to sample is not included
+    m_sample_query =
+        "SELECT esc.DIGEST, esc.DIGEST_TEXT, t.PROCESSLIST_USER, "
+        "t.PROCESSLIST_STATE FROM performance_schema.threads AS t JOIN "
+        "performance_schema.events_statements_current AS esc ON t.THREAD_ID = "
+        "esc.THREAD_ID WHERE esc.END_EVENT_ID IS NULL AND NOT "
+        "(t.PROCESSLIST_ID <=> CONNECTION_ID()) AND (" +
+        where + ")";
+  }
+
+  shcore::Array_t execute_sample() const {
+    using std::chrono::steady_clock;
+
+    volatile bool interrupted = false;
+    shcore::Interrupt_handler inth([&interrupted]() {
+      interrupted = true;
+      return true;
+    });
+
+    Top_counter counter{k_sample_capacity};
+    const auto get = [](const mysqlshdk::db::IRow *row, uint32_t idx) {
+      return row->is_null(idx) ? shcore::Value::Null()
+                               : shcore::Value(row->get_string(idx));
+    };
+
+    const auto interval = std::chrono::milliseconds{1000} / m_sample_rate;
+    const auto start = steady_clock::now();
+    const auto end = start + m_sample_duration;
+    auto next = start;
+    uint64_t samples = 0;
+
+    do {
+      const auto result = m_session->query(m_sample_query);
+      ++samples;
+
+      while (const auto row = result->fetch_one()) {
+        std::vector<shcore::Value> values{get(row, 0), get(row, 1),
+                                          get(row, 2), get(row, 3)};
+        std::string key;
+
+        // digest identifies the statement, its text is just displayed
+        for (const auto idx : {0, 2, 3}) {
+          key.append(values[idx].repr()).push_back('\0');
+        }
+
+        counter.add(std::move(key), std::move(values));
+      }
+
+      next += interval;
+      const auto now = steady_clock::now();
+
+      if (next > now && next < end) {
+        shcore::sleep_ms(
+            std::chrono::duration_cast<std::chrono::milliseconds>(next - now)
+                .count());
+      }
+    } while (!interrupted && steady_clock::now() < end);
+
+    auto report = shcore::make_array();
+    report->emplace_back(shcore::make_array("digest", "digesttxt", "user",
+                                            "state", "samples", "load"));
+
+    for (const auto entry : counter.top(m_sample_limit)) {
+      auto row = shcore::make_array();
+
+      for (const auto &value : entry->values) {
+        row->emplace_back(value);
+      }
+
+      row->emplace_back(entry->count);
+      row->emplace_back(
+          std::round(100.0 * entry->count / samples) / 100.0);
+      report->emplace_back(std::move(row));
+    }
+
+    return report;
+  }
+
   shcore::Array_t execute() const override {
+    if (!m_sample_query.empty()) {
+      return execute_sample();
+    }
+
     std::vector<Column_definition> columns;
 
     for (size_t idx = 0, size = m_format_columns.size(); idx < size; ++idx) {
@@ -572,6 +804,11 @@ class Threads_report : public Native_report {
   std::vector<std::string> m_format_names;
   std::string m_conditions;
   std::vector<std::unique_ptr<std::string>> m_string_cache;
+
+  std::string m_sample_query;
+  std::chrono::milliseconds m_sample_duration{0};
+  uint64_t m_sample_rate = 0;
+  uint64_t m_sample_limit = 0;
 };
 
 }  // namespace
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/binlog/binlog_dump_info.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <stdexcept>
+
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+namespace binlog {
+
+namespace {
+
+using rapidjson::Document;
+using rapidjson::StringRef;
+using rapidjson::Type;
+using rapidjson::Value;
+
+auto refs(const std::string &s) {
+  return rapidjson::StringRef(s.c_str(), s.length());
+}
+
+Value to_json(const Binlog_position &position,
+              Document::AllocatorType &a) {
+  Value json{Type::kObjectType};
+
+  json.AddMember(StringRef("file"), refs(position.file), a);
+  json.AddMember(StringRef("position"), position.position, a);
+
+  return json;
+}
+
+std::string get_string(const Value &v, const char *name) {
+  const auto it = v.FindMember(name);
+  return v.MemberEnd() != it && it->value.IsString()
+             ? std::string{it->value.GetString(), it->value.GetStringLength()}
+             : std::string{};
+}
+
+uint64_t get_uint(const Value &v, const char *name) {
+  const auto it = v.FindMember(name);
+  return v.MemberEnd() != it && it->value.IsUint64() ? it->value.GetUint64()
+                                                      : 0;
+}
+
+const Value &get_array(const Value &v, const char *name) {
+  static const Value k_empty{Type::kArrayType};
+  const auto it = v.FindMember(name);
+  return v.MemberEnd() != it && it->value.IsArray() ? it->value : k_empty;
+}
+
+Binlog_position get_position(const Value &v, const char *name) {
+  Binlog_position position;
+
+  if (const auto it = v.FindMember(name);
+      v.MemberEnd() != it && it->value.IsObject()) {
+    position.file = get_string(it->value, "file");
+    position.position = get_uint(it->value, "position");
+  }
+
+  return position;
+}
+
+}  // namespace
+
+void write_dump_info(const Binlog_dump_info &info,
+                     const mysqlshdk::storage::IDirectory &dir) {
+  Document doc{Type::kObjectType};
+  auto &a = doc.GetAllocator();
+
+  doc.AddMember(StringRef("dumper"), refs(info.dumper), a);
+  doc.AddMember(StringRef("version"), refs(info.version), a);
+  doc.AddMember(StringRef("hostname"), refs(info.hostname), a);
+  doc.AddMember(StringRef("serverUuid"), refs(info.server_uuid), a);
+  doc.AddMember(StringRef("serverVersion"), refs(info.server_version), a);
+  doc.AddMember(StringRef("begin"), refs(info.begin), a);
+  doc.AddMember(StringRef("end"), refs(info.end), a);
+  doc.AddMember(StringRef("compression"), refs(info.compression), a);
+  doc.AddMember(StringRef("binlogStart"), to_json(info.start, a), a);
+  doc.AddMember(StringRef("binlogEnd"), to_json(info.stop, a), a);
+  doc.AddMember(StringRef("gtidSetBefore"), refs(info.gtid_set_before), a);
+  doc.AddMember(StringRef("gtidSet"), refs(info.gtid_set), a);
+  doc.AddMember(StringRef("gtidExecuted"), refs(info.gtid_executed), a);
+  doc.AddMember(StringRef("dataBytes"), info.data_bytes, a);
+  doc.AddMember(StringRef("transactions"), info.transactions, a);
+
+  Value files{Type::kArrayType};
+
+  for (const auto &file : info.files) {
+    Value f{Type::kObjectType};
+
+    f.AddMember(StringRef("name"), refs(file.name), a);
+    f.AddMember(StringRef("begin"), file.begin, a);
+    f.AddMember(StringRef("end"), file.end, a);
+    f.AddMember(StringRef("gtidSet"), refs(file.gtid_set), a);
+    f.AddMember(StringRef("dataBytes"), file.data_bytes, a);
+    f.AddMember(StringRef("transactions"), file.transactions, a);
+
+    Value chunks{Type::kArrayType};
+
+    for (const auto &chunk : file.chunks) {
+      Value c{Type::kObjectType};
+
+      c.AddMember(StringRef("name"), refs(chunk.name), a);
+      c.AddMember(StringRef("dataBytes"), chunk.data_bytes, a);
+      c.AddMember(StringRef("transactions"), chunk.transactions, a);
+
+      chunks.PushBack(std::move(c), a);
+    }
+
+    f.AddMember(StringRef("chunks"), std::move(chunks), a);
+
+    files.PushBack(std::move(f), a);
+  }
+
+  doc.AddMember(StringRef("binlogs"), std::move(files), a);
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+  doc.Accept(writer);
+
+  const auto file = dir.file(k_binlog_dump_metadata);
+  file->open(mysqlshdk::storage::Mode::WRITE);
+  file->write(buffer.GetString(), buffer.GetSize());
+  file->close();
+}
+
+Binlog_dump_info read_dump_info(const mysqlshdk::storage::IDirectory &dir) {
+  const auto location = dir.full_path().masked();
+  const auto file = dir.file(k_binlog_dump_metadata);
+
+  if (!file->exists()) {
+    throw std::invalid_argument("The location '" + location +
+                                "' does not contain a complete dump of "
+                                "binary logs.");
+  }
+
+  file->open(mysqlshdk::storage::Mode::READ);
+  const auto data = mysqlshdk::storage::read_file(file.get());
+  file->close();
+
+  Document doc;
+  doc.Parse(data.c_str(), data.length());
+
+  if (doc.HasParseError() || !doc.IsObject()) {
+    throw std::runtime_error("Failed to parse the '" +
+                             std::string{k_binlog_dump_metadata} +
+                             "' metadata file of the dump at '" + location +
+                             "'.");
+  }
+
+  Binlog_dump_info info;
+
+  info.dumper = get_string(doc, "dumper");
+  info.version = get_string(doc, "version");
+  info.hostname = get_string(doc, "hostname");
+  info.server_uuid = get_string(doc, "serverUuid");
+  info.server_version = get_string(doc, "serverVersion");
+  info.begin = get_string(doc, "begin");
+  info.end = get_string(doc, "end");
+  info.compression = get_string(doc, "compression");
+  info.start = get_position(doc, "binlogStart");
+  info.stop = get_position(doc, "binlogEnd");
+  info.gtid_set_before = get_string(doc, "gtidSetBefore");
+  info.gtid_set = get_string(doc, "gtidSet");
+  info.gtid_executed = get_string(doc, "gtidExecuted");
+  info.data_bytes = get_uint(doc, "dataBytes");
+  info.transactions = get_uint(doc, "transactions");
+
+  for (const auto &f : get_array(doc, "binlogs").GetArray()) {
+    if (!f.IsObject()) {
+      continue;
+    }
+
+    auto &file_info = info.files.emplace_back();
+
+    file_info.name = get_string(f, "name");
+    file_info.begin = get_uint(f, "begin");
+    file_info.end = get_uint(f, "end");
+    file_info.gtid_set = get_string(f, "gtidSet");
+    file_info.data_bytes = get_uint(f, "dataBytes");
+    file_info.transactions = get_uint(f, "transactions");
+
+    for (const auto &c : get_array(f, "chunks").GetArray()) {
+      if (!c.IsObject()) {
+        continue;
+      }
+
+      auto &chunk = file_info.chunks.emplace_back();
+
+      chunk.name = get_string(c, "name");
+      chunk.data_bytes = get_uint(c, "dataBytes");
+      chunk.transactions = get_uint(c, "transactions");
+    }
+  }
+
+  return info;
+}
+
+}  // namespace binlog
+}  // namespace mysqlsh
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_BINLOG_BINLOG_DUMP_INFO_H_
+#define MODULES_UTIL_BINLOG_BINLOG_DUMP_INFO_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/idirectory.h"
+
+namespace mysqlsh {
+namespace binlog {
+
+/**
+ * Name of the file which holds the metadata of a dump of binary logs, it is
+ * written once the dump is complete.
+ */
+constexpr const char *k_binlog_dump_metadata = "@.binlogs.json";
+
+/**
+ * Version of the format of the dump of binary logs.
+ */
+constexpr const char *k_binlog_dump_version = "1.0.0";
+
+struct Binlog_position {
+  std::string file;
+  uint64_t position = 0;
+};
+
+/**
+ * A file holding a part of a binary log file. It starts with the format
+ * description event, followed by complete transactions.
+ */
+struct Binlog_chunk {
+  std::string name;
+  // size of the events, before compression
+  uint64_t data_bytes = 0;
+  uint64_t transactions = 0;
+};
+
+/**
+ * Dumped part of a binary log file.
+ */
+struct Binlog_file {
+  std::string name;
+  // position of the first and past the last dumped event
+  uint64_t begin = 0;
+  uint64_t end = 0;
+  std::string gtid_set;
+  uint64_t data_bytes = 0;
+  uint64_t transactions = 0;
+  std::vector<Binlog_chunk> chunks;
+};
+
+struct Binlog_dump_info {
+  std::string dumper;
+  std::string version;
+  std::string hostname;
+  std::string server_uuid;
+  std::string server_version;
+  std::string begin;
+  std::string end;
+  // compression of the chunk files
+  std::string compression;
+  Binlog_position start;
+  Binlog_position stop;
+  // transactions executed before the first dumped transaction, need to be
+  // applied before the dump is loaded
+  std::string gtid_set_before;
+  // transactions stored in the dump
+  std::string gtid_set;
+  // all transactions executed by the source instance once the dump is
+  // loaded, a subsequent dump can start here
+  std::string gtid_executed;
+  std::vector<Binlog_file> files;
+  uint64_t data_bytes = 0;
+  uint64_t transactions = 0;
+};
+
+/**
+ * Writes the metadata of a dump of binary logs.
+ */
+void write_dump_info(const Binlog_dump_info &info,
+                     const mysqlshdk::storage::IDirectory &dir);
+
+/**
+ * Reads the metadata of a dump of binary logs.
+ *
+ * @throws std::invalid_argument if directory does not contain a complete dump
+ *         of binary logs
+ * @throws std::runtime_error if metadata cannot be parsed
+ */
+Binlog_dump_info read_dump_info(const mysqlshdk::storage::IDirectory &dir);
+
+}  // namespace binlog
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_BINLOG_BINLOG_DUMP_INFO_H_
@@ -0,0 +1,1111 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/binlog/binlog_event.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/utils/crc32c.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+namespace binlog {
+
+namespace {
+
+// row events are replayed using BINLOG statements of about this size
+constexpr std::size_t k_max_row_events_size = 1024 * 1024;
+
+// offset of the flags in the event header
+constexpr std::size_t k_event_flags_offset = 17;
+
+// binary log file was not closed properly, set in the format description event
+constexpr char k_event_binlog_in_use_flag = 0x1;
+
+// the statement end flag of the rows events
+constexpr uint16_t k_rows_stmt_end_flag = 0x1;
+
+// bits of the Q_FLAGS2_CODE status variable
+constexpr uint32_t k_option_auto_is_null = 1u << 14;
+constexpr uint32_t k_option_not_autocommit = 1u << 19;
+constexpr uint32_t k_option_no_foreign_key_checks = 1u << 26;
+constexpr uint32_t k_option_relaxed_unique_checks = 1u << 27;
+
+// fields of the header of the transaction payload event
+constexpr uint64_t k_payload_end_mark = 0;
+constexpr uint64_t k_payload_size_field = 1;
+constexpr uint64_t k_payload_compression_field = 2;
+constexpr uint64_t k_payload_uncompressed_size_field = 3;
+
+constexpr uint64_t k_payload_compression_zstd = 0;
+constexpr uint64_t k_payload_compression_none = 255;
+
+/**
+ * Reads little-endian values from the body of an event.
+ */
+class Reader final {
+ public:
+  Reader(std::string_view data, const char *context)
+      : m_data(data), m_context(context) {}
+
+  std::size_t remaining() const { return m_data.size(); }
+
+  uint64_t fixed(std::size_t bytes) {
+    const auto data = this->bytes(bytes);
+    uint64_t value = 0;
+
+    for (std::size_t i = bytes; i > 0; --i) {
+      value = (value << 8) | static_cast<uint8_t>(data[i - 1]);
+    }
+
+    return value;
+  }
+
+  /**
+   * Reads a length-encoded integer.
+   */
+  uint64_t packed() {
+    const auto first = fixed(1);
+
+    switch (first) {
+      case 251:
+        return 0;
+
+      case 252:
+        return fixed(2);
+
+      case 253:
+        return fixed(3);
+
+      case 254:
+        return fixed(8);
+
+      default:
+        return first;
+    }
+  }
+
+  std::string_view bytes(std::size_t length) {
+    if (length > m_data.size()) {
+      throw std::runtime_error(shcore::str_format(
+          "Malformed binary log event: %s is truncated", m_context));
+    }
+
+    const auto result = m_data.substr(0, length);
+    m_data.remove_prefix(length);
+    return result;
+  }
+
+  void skip(std::size_t length) { bytes(length); }
+
+  std::string_view rest() { return bytes(m_data.size()); }
+
+ private:
+  std::string_view m_data;
+  const char *m_context;
+};
+
+std::string_view event_body(std::string_view event, bool checksum) {
+  const auto trailer = checksum ? k_event_checksum_size : 0;
+
+  if (event.size() < k_event_header_size + trailer) {
+    throw std::runtime_error("Malformed binary log event: event is truncated");
+  }
+
+  return event.substr(k_event_header_size,
+                      event.size() - k_event_header_size - trailer);
+}
+
+uint32_t stored_checksum(std::string_view event) {
+  return static_cast<uint32_t>(
+      Reader{event.substr(event.size() - k_event_checksum_size), "checksum"}
+          .fixed(k_event_checksum_size));
+}
+
+bool has_valid_checksum(std::string_view event) {
+  if (event.size() < k_event_header_size + k_event_checksum_size) {
+    return false;
+  }
+
+  return stored_checksum(event) ==
+         mysqlshdk::utils::crc32(event.data(),
+                                 event.size() - k_event_checksum_size);
+}
+
+std::string uuid_to_string(std::string_view sid) {
+  std::string uuid;
+  uuid.reserve(36);
+
+  for (std::size_t i = 0; i < sid.size(); ++i) {
+    if (4 == i || 6 == i || 8 == i || 10 == i) {
+      uuid += '-';
+    }
+
+    uuid += shcore::str_format("%02x", static_cast<uint8_t>(sid[i]));
+  }
+
+  return uuid;
+}
+
+void write_uint32(uint32_t value, char *out) {
+  for (int i = 0; i < 4; ++i) {
+    out[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+  }
+}
+
+void add_interval(std::map<uint64_t, uint64_t> *intervals, uint64_t begin,
+                  uint64_t end) {
+  auto next = intervals->upper_bound(begin);
+
+  if (next != intervals->begin()) {
+    const auto prev = std::prev(next);
+
+    if (prev->second + 1 >= begin) {
+      if (prev->second >= end) {
+        return;
+      }
+
+      begin = prev->first;
+      intervals->erase(prev);
+    }
+  }
+
+  while (next != intervals->end() && next->first <= end + 1) {
+    end = std::max(end, next->second);
+    next = intervals->erase(next);
+  }
+
+  intervals->emplace(begin, end);
+}
+
+}  // namespace
+
+Event_header read_event_header(std::string_view event) {
+  Reader reader{event, "event header"};
+  Event_header header;
+
+  header.timestamp = static_cast<uint32_t>(reader.fixed(4));
+  header.type = static_cast<Event_type>(reader.fixed(1));
+  header.server_id = static_cast<uint32_t>(reader.fixed(4));
+  header.size = static_cast<uint32_t>(reader.fixed(4));
+  header.log_pos = static_cast<uint32_t>(reader.fixed(4));
+  header.flags = static_cast<uint16_t>(reader.fixed(2));
+
+  if (header.size != event.size()) {
+    throw std::runtime_error(shcore::str_format(
+        "Malformed binary log event: size of the event is %" PRIu32
+        ", expected %zu",
+        header.size, event.size()));
+  }
+
+  return header;
+}
+
+std::string_view next_event(std::string_view *data) {
+  if (data->size() < k_event_header_size) {
+    throw std::runtime_error("Malformed binary log: event is truncated");
+  }
+
+  const auto size = static_cast<std::size_t>(
+      Reader{data->substr(9, 4), "event size"}.fixed(4));
+
+  if (size < k_event_header_size || size > data->size()) {
+    throw std::runtime_error("Malformed binary log: event is truncated");
+  }
+
+  const auto event = data->substr(0, size);
+  data->remove_prefix(size);
+  return event;
+}
+
+Format_description parse_format_description(std::string_view event) {
+  const auto header = read_event_header(event);
+
+  if (Event_type::FORMAT_DESCRIPTION != header.type) {
+    throw std::runtime_error(
+        "Malformed binary log: expected a format description event");
+  }
+
+  Format_description format;
+
+  // checksum is computed with the "binary log in use" flag cleared, the flag
+  // is not meaningful outside of the binary log file, it's cleared in the copy
+  format.event = std::string{event};
+  format.event[k_event_flags_offset] &= ~k_event_binlog_in_use_flag;
+
+  // the checksum algorithm is stored in the byte which precedes the checksum
+  const auto body = event_body(event, true);
+
+  if (body.empty()) {
+    throw std::runtime_error(
+        "Malformed binary log: format description event is truncated");
+  }
+
+  Reader reader{body, "format description event"};
+  reader.skip(2);  // binlog version
+
+  {
+    const auto version = reader.bytes(50);
+    format.server_version =
+        std::string{version.substr(0, version.find('\0'))};
+  }
+
+  switch (static_cast<uint8_t>(body.back())) {
+    case 0:
+      format.checksum = false;
+      break;
+
+    case 1:
+      format.checksum = true;
+
+      if (!has_valid_checksum(format.event)) {
+        throw std::runtime_error(
+            "Checksum of the format description event does not match");
+      }
+      break;
+
+    default:
+      throw std::runtime_error(
+          "Unsupported binary log checksum algorithm: " +
+          std::to_string(static_cast<uint8_t>(body.back())));
+  }
+
+  return format;
+}
+
+Gtid_event parse_gtid(std::string_view event, bool checksum) {
+  const auto header = read_event_header(event);
+
+  switch (header.type) {
+    case Event_type::GTID:
+      break;
+
+    case Event_type::ANONYMOUS_GTID:
+      throw std::runtime_error(
+          "Anonymous transactions are not supported, GTID_MODE needs to be "
+          "ON");
+
+    case Event_type::GTID_TAGGED:
+      throw std::runtime_error("Transactions with tagged GTIDs are not "
+                               "supported");
+
+    default:
+      throw std::runtime_error("Malformed binary log: expected a GTID event");
+  }
+
+  Reader reader{event_body(event, checksum), "GTID event"};
+  Gtid_event gtid;
+
+  reader.skip(1);  // flags
+  gtid.uuid = uuid_to_string(reader.bytes(16));
+  gtid.gno = reader.fixed(8);
+
+  // logical timestamps are written by 5.7+
+  if (reader.remaining() >= 17 && 2 == reader.fixed(1)) {
+    gtid.last_committed = static_cast<int64_t>(reader.fixed(8));
+    gtid.sequence_number = static_cast<int64_t>(reader.fixed(8));
+  }
+
+  return gtid;
+}
+
+std::string parse_rotate(std::string_view event, bool checksum) {
+  const auto header = read_event_header(event);
+
+  if (Event_type::ROTATE != header.type) {
+    throw std::runtime_error("Malformed binary log: expected a rotate event");
+  }
+
+  // artificial rotate events may not match the format of the binary log file
+  // which is being read, checksum is detected by validating it
+  if (header.flags & k_event_artificial_flag) {
+    checksum = has_valid_checksum(event);
+  }
+
+  Reader reader{event_body(event, checksum), "rotate event"};
+  reader.skip(8);  // position
+
+  return std::string{reader.rest()};
+}
+
+std::string decode_decimal(std::string_view *data, uint32_t precision,
+                           uint32_t scale) {
+  static constexpr uint32_t k_digits_per_group = 9;
+  static constexpr std::size_t k_group_size = 4;
+  static constexpr std::size_t k_bytes[k_digits_per_group + 1] = {
+      0, 1, 1, 2, 2, 3, 3, 4, 4, 4};
+
+  if (scale > precision) {
+    throw std::runtime_error("Malformed DECIMAL value: scale is too big");
+  }
+
+  const auto intg = precision - scale;
+  const auto intg_groups = intg / k_digits_per_group;
+  const auto intg_digits = intg % k_digits_per_group;
+  const auto frac_groups = scale / k_digits_per_group;
+  const auto frac_digits = scale % k_digits_per_group;
+  const auto size = intg_groups * k_group_size + k_bytes[intg_digits] +
+                    frac_groups * k_group_size + k_bytes[frac_digits];
+
+  if (data->size() < size) {
+    throw std::runtime_error("Malformed DECIMAL value: value is truncated");
+  }
+
+  if (0 == size) {
+    return "0";
+  }
+
+  std::string bin{data->substr(0, size)};
+  data->remove_prefix(size);
+
+  // the sign bit is set for positive numbers, negative numbers have all bits
+  // inverted
+  const bool negative = !(bin[0] & 0x80);
+  bin[0] ^= 0x80;
+
+  std::size_t offset = 0;
+
+  const auto read_group = [&](std::size_t bytes, uint32_t digits) {
+    uint32_t value = 0;
+
+    for (std::size_t i = 0; i < bytes; ++i) {
+      auto byte = static_cast<uint8_t>(bin[offset++]);
+
+      if (negative) {
+        byte = ~byte;
+      }
+
+      value = (value << 8) | byte;
+    }
+
+    return shcore::str_format("%0*" PRIu32, static_cast<int>(digits), value);
+  };
+
+  std::string integer;
+
+  if (intg_digits) {
+    integer += read_group(k_bytes[intg_digits], intg_digits);
+  }
+
+  for (uint32_t i = 0; i < intg_groups; ++i) {
+    integer += read_group(k_group_size, k_digits_per_group);
+  }
+
+  integer.erase(0, std::min(integer.find_first_not_of('0'), integer.size()));
+
+  std::string result;
+
+  if (negative) {
+    result += '-';
+  }
+
+  result += integer.empty() ? "0" : integer;
+
+  if (scale) {
+    result += '.';
+
+    for (uint32_t i = 0; i < frac_groups; ++i) {
+      result += read_group(k_group_size, k_digits_per_group);
+    }
+
+    if (frac_digits) {
+      result += read_group(k_bytes[frac_digits], frac_digits);
+    }
+  }
+
+  return result;
+}
+
+Gtid_intervals::Gtid_intervals(const mysqlshdk::mysql::Gtid_set &set) {
+  // only normalized sets can be enumerated
+  mysqlshdk::mysql::Gtid_set{set}.normalize().enumerate_ranges(
+      [this](const mysqlshdk::mysql::Gtid_range &range) {
+        add_interval(&m_intervals[shcore::str_lower(range.uuid_tag)],
+                     range.begin, range.end);
+      });
+}
+
+bool Gtid_intervals::contains(const std::string &uuid, uint64_t gno) const {
+  const auto intervals = m_intervals.find(uuid);
+
+  if (m_intervals.end() == intervals) {
+    return false;
+  }
+
+  auto it = intervals->second.upper_bound(gno);
+
+  if (intervals->second.begin() == it) {
+    return false;
+  }
+
+  return gno <= std::prev(it)->second;
+}
+
+void Gtid_intervals::add(const std::string &uuid, uint64_t gno) {
+  add_interval(&m_intervals[uuid], gno, gno);
+}
+
+uint64_t Gtid_intervals::count() const {
+  uint64_t result = 0;
+
+  for (const auto &uuid : m_intervals) {
+    for (const auto &interval : uuid.second) {
+      result += interval.second - interval.first + 1;
+    }
+  }
+
+  return result;
+}
+
+mysqlshdk::mysql::Gtid_set Gtid_intervals::to_gtid_set() const {
+  std::string set;
+
+  for (const auto &uuid : m_intervals) {
+    if (!set.empty()) {
+      set += ',';
+    }
+
+    set += uuid.first;
+
+    for (const auto &interval : uuid.second) {
+      set += ':';
+      set += std::to_string(interval.first);
+
+      if (interval.first != interval.second) {
+        set += '-';
+        set += std::to_string(interval.second);
+      }
+    }
+  }
+
+  return mysqlshdk::mysql::Gtid_set::from_normalized_string(std::move(set));
+}
+
+Transaction_builder::Transaction_builder(const Collations *collations)
+    : m_collations(collations) {}
+
+bool Transaction_builder::add(std::string_view event) {
+  const auto header = read_event_header(event);
+
+  if (m_format && m_format->checksum &&
+      Event_type::FORMAT_DESCRIPTION != header.type &&
+      !has_valid_checksum(event)) {
+    throw std::runtime_error(shcore::str_format(
+        "Checksum of the binary log event at position %" PRIu32
+        " does not match",
+        header.log_pos));
+  }
+
+  switch (header.type) {
+    case Event_type::FORMAT_DESCRIPTION:
+      if (m_in_transaction) {
+        throw std::runtime_error(
+            "Malformed binary log: format description event found within a "
+            "transaction");
+      }
+
+      m_format = std::make_shared<Format_description>(
+          parse_format_description(event));
+      return false;
+
+    case Event_type::GTID:
+    case Event_type::ANONYMOUS_GTID:
+    case Event_type::GTID_TAGGED:
+      if (m_in_transaction) {
+        throw std::runtime_error(
+            "Malformed binary log: transaction " + m_transaction.gtid.gtid() +
+            " is not complete");
+      }
+
+      if (!m_format) {
+        throw std::runtime_error(
+            "Malformed binary log: format description event is missing");
+      }
+
+      m_transaction = {};
+      m_transaction.gtid = parse_gtid(event, m_format->checksum);
+      m_transaction.format = m_format;
+      m_transaction.bytes = header.size;
+
+      m_in_transaction = true;
+      m_completed = false;
+      m_explicit_begin = false;
+      m_session_state.clear();
+      m_database.clear();
+      return false;
+
+    case Event_type::STOP:
+    case Event_type::ROTATE:
+    case Event_type::HEARTBEAT:
+    case Event_type::HEARTBEAT_V2:
+    case Event_type::PREVIOUS_GTIDS:
+      return false;
+
+    default:
+      break;
+  }
+
+  if (!m_in_transaction) {
+    throw std::runtime_error(shcore::str_format(
+        "Malformed binary log: event of type %d found outside of a "
+        "transaction",
+        static_cast<int>(header.type)));
+  }
+
+  m_transaction.bytes += header.size;
+  add_event(event, header);
+
+  return m_completed;
+}
+
+Transaction Transaction_builder::take() {
+  m_completed = false;
+  return std::exchange(m_transaction, {});
+}
+
+void Transaction_builder::add_event(std::string_view event,
+                                    const Event_header &header) {
+  switch (header.type) {
+    case Event_type::QUERY:
+      add_query(body(event), header);
+      break;
+
+    case Event_type::INTVAR:
+      add_intvar(body(event));
+      break;
+
+    case Event_type::RAND:
+      add_rand(body(event));
+      break;
+
+    case Event_type::USER_VAR:
+      add_user_var(body(event));
+      break;
+
+    case Event_type::TABLE_MAP:
+    case Event_type::WRITE_ROWS_V1:
+    case Event_type::UPDATE_ROWS_V1:
+    case Event_type::DELETE_ROWS_V1:
+    case Event_type::WRITE_ROWS:
+    case Event_type::UPDATE_ROWS:
+    case Event_type::DELETE_ROWS:
+    case Event_type::PARTIAL_UPDATE_ROWS:
+      add_row_event(event, body(event), header);
+      break;
+
+    case Event_type::XID:
+      flush_row_events();
+      m_transaction.statements.emplace_back("COMMIT");
+      complete();
+      break;
+
+    case Event_type::TRANSACTION_PAYLOAD:
+      add_payload(body(event));
+      break;
+
+    case Event_type::ROWS_QUERY:
+    case Event_type::TRANSACTION_CONTEXT:
+    case Event_type::VIEW_CHANGE:
+    case Event_type::IGNORABLE:
+      break;
+
+    case Event_type::INCIDENT:
+      throw std::runtime_error(
+          "The binary log contains an incident event in transaction " +
+          m_transaction.gtid.gtid() +
+          ", the source instance may have lost some changes");
+
+    case Event_type::XA_PREPARE:
+      throw std::runtime_error("XA transactions are not supported, found in "
+                               "transaction " +
+                               m_transaction.gtid.gtid());
+
+    case Event_type::BEGIN_LOAD_QUERY:
+    case Event_type::EXECUTE_LOAD_QUERY:
+      throw std::runtime_error(
+          "LOAD DATA statements logged in the statement format are not "
+          "supported, found in transaction " +
+          m_transaction.gtid.gtid());
+
+    default:
+      if (!(header.flags & k_event_ignorable_flag)) {
+        throw std::runtime_error(shcore::str_format(
+            "Unsupported binary log event of type %d found in transaction %s",
+            static_cast<int>(header.type), m_transaction.gtid.gtid().c_str()));
+      }
+      break;
+  }
+}
+
+void Transaction_builder::add_query(std::string_view body,
+                                    const Event_header &header) {
+  Reader reader{body, "query event"};
+
+  const auto thread_id = reader.fixed(4);
+  reader.skip(4);  // execution time
+  const auto db_length = reader.fixed(1);
+  reader.skip(2);  // error code
+  const auto status_length = reader.fixed(2);
+
+  Reader status{reader.bytes(status_length), "query event status variables"};
+  const auto db = reader.bytes(db_length);
+  reader.skip(1);  // database name is null-terminated
+  const auto query = reader.rest();
+
+  if ("BEGIN" == query) {
+    m_explicit_begin = true;
+    m_transaction.statements.emplace_back(query);
+    return;
+  }
+
+  flush_row_events();
+
+  if ("COMMIT" == query || "ROLLBACK" == query) {
+    m_transaction.statements.emplace_back(query);
+    complete();
+    return;
+  }
+
+  if (shcore::str_ibeginswith(query, "XA ")) {
+    throw std::runtime_error(
+        "XA transactions are not supported, found in transaction " +
+        m_transaction.gtid.gtid());
+  }
+
+  std::vector<std::string> variables;
+  uint64_t microseconds = 0;
+  bool has_microseconds = false;
+
+  const auto set = [&variables](const char *name, const auto &value) {
+    std::string var = "@@session.";
+    var += name;
+    var += '=';
+
+    if constexpr (std::is_arithmetic_v<std::decay_t<decltype(value)>>) {
+      var += std::to_string(value);
+    } else {
+      var += value;
+    }
+
+    variables.emplace_back(std::move(var));
+  };
+
+  bool done = false;
+
+  while (!done && status.remaining() > 0) {
+    switch (status.fixed(1)) {
+      case 0: {  // Q_FLAGS2_CODE
+        const auto flags = status.fixed(4);
+        set("foreign_key_checks",
+            (flags & k_option_no_foreign_key_checks) ? 0 : 1);
+        set("sql_auto_is_null", (flags & k_option_auto_is_null) ? 1 : 0);
+        set("unique_checks", (flags & k_option_relaxed_unique_checks) ? 0 : 1);
+        set("autocommit", (flags & k_option_not_autocommit) ? 0 : 1);
+        break;
+      }
+
+      case 1:  // Q_SQL_MODE_CODE
+        set("sql_mode", status.fixed(8));
+        break;
+
+      case 2:  // Q_CATALOG_CODE
+        status.skip(status.fixed(1) + 1);
+        break;
+
+      case 3:  // Q_AUTO_INCREMENT
+        set("auto_increment_increment", status.fixed(2));
+        set("auto_increment_offset", status.fixed(2));
+        break;
+
+      case 4:  // Q_CHARSET_CODE
+        set("character_set_client", status.fixed(2));
+        set("collation_connection", status.fixed(2));
+        set("collation_server", status.fixed(2));
+        break;
+
+      case 5:  // Q_TIME_ZONE_CODE
+        set("time_zone", shcore::quote_sql_string(
+                             std::string{status.bytes(status.fixed(1))}));
+        break;
+
+      case 6:  // Q_CATALOG_NZ_CODE
+        status.skip(status.fixed(1));
+        break;
+
+      case 7:  // Q_LC_TIME_NAMES_CODE
+        set("lc_time_names", status.fixed(2));
+        break;
+
+      case 8: {  // Q_CHARSET_DATABASE_CODE
+        const auto collation = status.fixed(2);
+
+        if (collation) {
+          set("collation_database", collation);
+        } else {
+          set("collation_database", "DEFAULT");
+        }
+        break;
+      }
+
+      case 9:  // Q_TABLE_MAP_FOR_UPDATE_CODE
+        status.skip(8);
+        break;
+
+      case 10:  // Q_MASTER_DATA_WRITTEN_CODE
+        status.skip(4);
+        break;
+
+      case 11:  // Q_INVOKER
+        status.skip(status.fixed(1));
+        status.skip(status.fixed(1));
+        break;
+
+      case 12: {  // Q_UPDATED_DB_NAMES
+        const auto count = status.fixed(1);
+
+        // 254 means that there were too many databases to be listed
+        if (254 != count) {
+          for (uint64_t i = 0; i < count; ++i) {
+            while (status.fixed(1) != 0) {
+            }
+          }
+        }
+        break;
+      }
+
+      case 13:  // Q_MICROSECONDS
+        microseconds = status.fixed(3);
+        has_microseconds = true;
+        break;
+
+      case 16:  // Q_EXPLICIT_DEFAULTS_FOR_TIMESTAMP
+        set("explicit_defaults_for_timestamp", status.fixed(1));
+        break;
+
+      case 17:  // Q_DDL_LOGGED_WITH_XID
+        status.skip(8);
+        break;
+
+      case 18:  // Q_DEFAULT_COLLATION_FOR_UTF8MB4
+        set("default_collation_for_utf8mb4", status.fixed(2));
+        break;
+
+      case 19:  // Q_SQL_REQUIRE_PRIMARY_KEY
+        set("sql_require_primary_key", status.fixed(1));
+        break;
+
+      case 20:  // Q_DEFAULT_TABLE_ENCRYPTION
+        set("default_table_encryption", status.fixed(1));
+        break;
+
+      default:
+        // the server also stops at the first unknown status variable
+        done = true;
+        break;
+    }
+  }
+
+  set("pseudo_thread_id", thread_id);
+
+  std::string state = "SET TIMESTAMP=" + std::to_string(header.timestamp);
+
+  if (has_microseconds) {
+    state += shcore::str_format(".%06" PRIu64, microseconds);
+  }
+
+  for (const auto &var : variables) {
+    state += ", ";
+    state += var;
+  }
+
+  if (state != m_session_state) {
+    m_transaction.statements.emplace_back(state);
+    m_session_state = std::move(state);
+  }
+
+  if (!db.empty() && db != m_database) {
+    m_database = db;
+    m_transaction.statements.emplace_back("USE " +
+                                          shcore::quote_identifier(m_database));
+  }
+
+  m_transaction.statements.emplace_back(query);
+
+  // statements which are not enclosed within BEGIN/COMMIT are transactions
+  // on their own (i.e. DDL)
+  if (!m_explicit_begin) {
+    complete();
+  }
+}
+
+void Transaction_builder::add_intvar(std::string_view body) {
+  Reader reader{body, "intvar event"};
+  const auto type = reader.fixed(1);
+  const auto value = reader.fixed(8);
+
+  switch (type) {
+    case 1:
+      m_transaction.statements.emplace_back("SET LAST_INSERT_ID=" +
+                                            std::to_string(value));
+      break;
+
+    case 2:
+      m_transaction.statements.emplace_back("SET INSERT_ID=" +
+                                            std::to_string(value));
+      break;
+
+    default:
+      throw std::runtime_error("Malformed binary log event: unknown type of "
+                               "the intvar event: " +
+                               std::to_string(type));
+  }
+}
+
+void Transaction_builder::add_rand(std::string_view body) {
+  Reader reader{body, "rand event"};
+  const auto seed1 = reader.fixed(8);
+  const auto seed2 = reader.fixed(8);
+
+  m_transaction.statements.emplace_back(
+      "SET @@RAND_SEED1=" + std::to_string(seed1) +
+      ", @@RAND_SEED2=" + std::to_string(seed2));
+}
+
+void Transaction_builder::add_user_var(std::string_view body) {
+  Reader reader{body, "user variable event"};
+
+  const auto name = reader.bytes(reader.fixed(4));
+  std::string statement =
+      "SET @" + shcore::quote_identifier(std::string{name}) + ":=";
+
+  if (reader.fixed(1)) {
+    statement += "NULL";
+  } else {
+    const auto type = reader.fixed(1);
+    const auto charset = static_cast<uint32_t>(reader.fixed(4));
+    auto value = reader.bytes(reader.fixed(4));
+    const auto flags = reader.remaining() > 0 ? reader.fixed(1) : 0;
+
+    switch (type) {
+      case 0: {  // STRING_RESULT
+        const auto collation = m_collations->find(charset);
+
+        if (m_collations->end() == collation) {
+          throw std::runtime_error(
+              "Value of the user variable '" + std::string{name} +
+              "' uses a collation with ID " + std::to_string(charset) +
+              " which is not known to the target instance");
+        }
+
+        statement += '_';
+        statement += collation->second.charset;
+        statement += " X'";
+        statement += shcore::string_to_hex(value, false);
+        statement += "' COLLATE ";
+        statement += shcore::quote_identifier(collation->second.collation);
+        break;
+      }
+
+      case 1: {  // REAL_RESULT
+        const auto bits = Reader{value, "REAL value"}.fixed(8);
+        double real;
+        static_assert(sizeof(real) == sizeof(bits));
+        memcpy(&real, &bits, sizeof(real));
+        statement += shcore::str_format("%.17g", real);
+        break;
+      }
+
+      case 2: {  // INT_RESULT
+        const auto integer = Reader{value, "INT value"}.fixed(8);
+
+        // UNSIGNED_F
+        if (flags & 0x1) {
+          statement += std::to_string(integer);
+        } else {
+          statement += std::to_string(static_cast<int64_t>(integer));
+        }
+        break;
+      }
+
+      case 4: {  // DECIMAL_RESULT
+        Reader decimal{value, "DECIMAL value"};
+        const auto precision = static_cast<uint32_t>(decimal.fixed(1));
+        const auto scale = static_cast<uint32_t>(decimal.fixed(1));
+        value = decimal.rest();
+        statement += decode_decimal(&value, precision, scale);
+        break;
+      }
+
+      default:
+        throw std::runtime_error("Unsupported type of the user variable '" +
+                                 std::string{name} +
+                                 "': " + std::to_string(type));
+    }
+  }
+
+  m_transaction.statements.emplace_back(std::move(statement));
+}
+
+void Transaction_builder::add_row_event(std::string_view event,
+                                        std::string_view body,
+                                        const Event_header &header) {
+  bool statement_end = false;
+
+  if (Event_type::TABLE_MAP != header.type) {
+    Reader reader{body, "rows event"};
+    reader.skip(6);  // table ID
+    statement_end = reader.fixed(2) & k_rows_stmt_end_flag;
+  }
+
+  m_row_events.append(event);
+  m_transaction.has_row_events = true;
+
+  if (statement_end || m_row_events.size() >= k_max_row_events_size) {
+    flush_row_events();
+  }
+}
+
+void Transaction_builder::add_payload(std::string_view body) {
+  Reader reader{body, "transaction payload event"};
+  uint64_t compression = k_payload_compression_none;
+  uint64_t payload_size = 0;
+  uint64_t uncompressed_size = 0;
+
+  while (true) {
+    const auto type = reader.packed();
+
+    if (k_payload_end_mark == type) {
+      break;
+    }
+
+    Reader field{reader.bytes(reader.packed()), "transaction payload header"};
+
+    switch (type) {
+      case k_payload_size_field:
+        payload_size = field.packed();
+        break;
+
+      case k_payload_compression_field:
+        compression = field.packed();
+        break;
+
+      case k_payload_uncompressed_size_field:
+        uncompressed_size = field.packed();
+        break;
+
+      default:
+        // unknown fields are skipped
+        break;
+    }
+  }
+
+  const auto payload = reader.bytes(payload_size);
+  std::string uncompressed;
+  std::string_view events;
+
+  switch (compression) {
+    case k_payload_compression_zstd:
+      mysqlshdk::storage::decompress(mysqlshdk::storage::Compression::ZSTD,
+                                     payload.data(), payload.size(),
+                                     uncompressed_size, &uncompressed);
+      events = uncompressed;
+      break;
+
+    case k_payload_compression_none:
+      events = payload;
+      break;
+
+    default:
+      throw std::runtime_error(
+          "Unsupported compression of the transaction payload event: " +
+          std::to_string(compression));
+  }
+
+  std::string copy;
+
+  while (!events.empty()) {
+    auto event = next_event(&events);
+    auto header = read_event_header(event);
+
+    if (Event_type::TRANSACTION_PAYLOAD == header.type) {
+      throw std::runtime_error(
+          "Malformed binary log: nested transaction payload event");
+    }
+
+    // events stored in the payload do not have checksums, they are added, so
+    // that the BINLOG statement can use the current format description
+    if (m_format->checksum) {
+      copy.assign(event);
+      copy.resize(copy.size() + k_event_checksum_size);
+      header.size = static_cast<uint32_t>(copy.size());
+      write_uint32(header.size, copy.data() + 9);
+      write_uint32(
+          mysqlshdk::utils::crc32(copy.data(), header.size -
+                                                   k_event_checksum_size),
+          copy.data() + header.size - k_event_checksum_size);
+      event = copy;
+    }
+
+    add_event(event, header);
+  }
+}
+
+void Transaction_builder::flush_row_events() {
+  if (m_row_events.empty()) {
+    return;
+  }
+
+  std::string encoded;
+
+  if (!shcore::encode_base64(
+          reinterpret_cast<const unsigned char *>(m_row_events.data()),
+          static_cast<int>(m_row_events.size()), &encoded)) {
+    throw std::runtime_error("Failed to encode the row events");
+  }
+
+  m_transaction.statements.emplace_back("BINLOG '" + encoded + "'");
+  m_row_events.clear();
+}
+
+void Transaction_builder::complete() {
+  flush_row_events();
+  m_in_transaction = false;
+  m_completed = true;
+}
+
+std::string_view Transaction_builder::body(std::string_view event) const {
+  return event_body(event, m_format->checksum);
+}
+
+}  // namespace binlog
+}  // namespace mysqlsh
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_BINLOG_BINLOG_EVENT_H_
+#define MODULES_UTIL_BINLOG_BINLOG_EVENT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "mysqlshdk/libs/mysql/gtid_utils.h"
+
+namespace mysqlsh {
+namespace binlog {
+
+/**
+ * Types of the binary log events which are handled explicitly.
+ */
+enum class Event_type : uint8_t {
+  QUERY = 2,
+  STOP = 3,
+  ROTATE = 4,
+  INTVAR = 5,
+  RAND = 13,
+  USER_VAR = 14,
+  FORMAT_DESCRIPTION = 15,
+  XID = 16,
+  BEGIN_LOAD_QUERY = 17,
+  EXECUTE_LOAD_QUERY = 18,
+  TABLE_MAP = 19,
+  WRITE_ROWS_V1 = 23,
+  UPDATE_ROWS_V1 = 24,
+  DELETE_ROWS_V1 = 25,
+  INCIDENT = 26,
+  HEARTBEAT = 27,
+  IGNORABLE = 28,
+  ROWS_QUERY = 29,
+  WRITE_ROWS = 30,
+  UPDATE_ROWS = 31,
+  DELETE_ROWS = 32,
+  GTID = 33,
+  ANONYMOUS_GTID = 34,
+  PREVIOUS_GTIDS = 35,
+  TRANSACTION_CONTEXT = 36,
+  VIEW_CHANGE = 37,
+  XA_PREPARE = 38,
+  PARTIAL_UPDATE_ROWS = 39,
+  TRANSACTION_PAYLOAD = 40,
+  HEARTBEAT_V2 = 41,
+  GTID_TAGGED = 42,
+};
+
+// size of the common header of each event (binary log version 4)
+constexpr std::size_t k_event_header_size = 19;
+
+// size of the CRC32 checksum which follows each event, if enabled
+constexpr std::size_t k_event_checksum_size = 4;
+
+// event was generated by the server and is not stored in the binary log
+constexpr uint16_t k_event_artificial_flag = 0x20;
+
+// event can be ignored if it's not recognized
+constexpr uint16_t k_event_ignorable_flag = 0x80;
+
+/**
+ * The common header of an event.
+ */
+struct Event_header {
+  uint32_t timestamp = 0;
+  Event_type type{};
+  uint32_t server_id = 0;
+  // size of the whole event, including the header and the checksum
+  uint32_t size = 0;
+  // position of the end of this event in the binary log file
+  uint32_t log_pos = 0;
+  uint16_t flags = 0;
+};
+
+/**
+ * Reads the header of the given event.
+ *
+ * @throws std::runtime_error if event is too short or its size does not match
+ */
+Event_header read_event_header(std::string_view event);
+
+/**
+ * Removes the first event from the given data.
+ *
+ * @param data Data holding a sequence of events, on return holds the
+ *        remaining events.
+ *
+ * @returns the first event
+ *
+ * @throws std::runtime_error if data ends with an incomplete event
+ */
+std::string_view next_event(std::string_view *data);
+
+/**
+ * Format description event, it describes the format of the events which
+ * follow it.
+ */
+struct Format_description {
+  // the whole event, as stored in the binary log
+  std::string event;
+  std::string server_version;
+  // whether events are followed by a CRC32 checksum
+  bool checksum = false;
+};
+
+/**
+ * Parses a format description event.
+ *
+ * @throws std::runtime_error if event is malformed
+ */
+Format_description parse_format_description(std::string_view event);
+
+/**
+ * GTID event, it starts each transaction.
+ */
+struct Gtid_event {
+  // text representation of the UUID, lower case
+  std::string uuid;
+  uint64_t gno = 0;
+  // sequence number of the most recent transaction this one does not conflict
+  // with, all transactions up to this one need to be committed first
+  int64_t last_committed = 0;
+  // commit order of this transaction within the binary log file, 0 if
+  // unknown
+  int64_t sequence_number = 0;
+
+  std::string gtid() const { return uuid + ':' + std::to_string(gno); }
+};
+
+/**
+ * Parses a GTID event.
+ *
+ * @throws std::runtime_error if event is malformed, anonymous or tagged
+ */
+Gtid_event parse_gtid(std::string_view event, bool checksum);
+
+/**
+ * Parses a rotate event.
+ *
+ * @returns name of the next binary log file
+ */
+std::string parse_rotate(std::string_view event, bool checksum);
+
+/**
+ * Converts a DECIMAL value stored in the binary format to text.
+ *
+ * @param data Binary value, on return points past the value.
+ * @param precision Number of digits.
+ * @param scale Number of digits after the decimal point.
+ *
+ * @throws std::runtime_error if data is too short
+ */
+std::string decode_decimal(std::string_view *data, uint32_t precision,
+                           uint32_t scale);
+
+/**
+ * A set of GTIDs without tags, optimized for checking if it holds a single
+ * transaction and for adding transactions one by one.
+ */
+class Gtid_intervals final {
+ public:
+  Gtid_intervals() = default;
+
+  explicit Gtid_intervals(const mysqlshdk::mysql::Gtid_set &set);
+
+  Gtid_intervals(const Gtid_intervals &) = default;
+  Gtid_intervals(Gtid_intervals &&) = default;
+
+  Gtid_intervals &operator=(const Gtid_intervals &) = default;
+  Gtid_intervals &operator=(Gtid_intervals &&) = default;
+
+  ~Gtid_intervals() = default;
+
+  bool contains(const std::string &uuid, uint64_t gno) const;
+
+  void add(const std::string &uuid, uint64_t gno);
+
+  bool empty() const { return m_intervals.empty(); }
+
+  uint64_t count() const;
+
+  mysqlshdk::mysql::Gtid_set to_gtid_set() const;
+
+ private:
+  // UUID -> first GNO of an interval -> last GNO of that interval
+  std::map<std::string, std::map<uint64_t, uint64_t>> m_intervals;
+};
+
+/**
+ * Character set and collation, keyed by ID of the collation.
+ */
+struct Collation {
+  std::string charset;
+  std::string collation;
+};
+
+using Collations = std::unordered_map<uint32_t, Collation>;
+
+/**
+ * A transaction read from the binary log, converted to SQL statements.
+ */
+struct Transaction {
+  Gtid_event gtid;
+  // format of the events, needs to be set (via the BINLOG statement) in the
+  // session before statements which hold the row events are executed
+  std::shared_ptr<const Format_description> format;
+  // statements which need to be executed after GTID_NEXT is set
+  std::vector<std::string> statements;
+  // whether any of the statements is a BINLOG statement
+  bool has_row_events = false;
+  // total size of the events
+  uint64_t bytes = 0;
+};
+
+/**
+ * Converts a stream of binary log events into transactions. Row events are
+ * replayed using the BINLOG statement, statement events are converted to SQL
+ * which sets the session state captured by the event and executes the
+ * original query.
+ */
+class Transaction_builder final {
+ public:
+  /**
+   * Creates the builder.
+   *
+   * @param collations Collations known to the target instance, used to
+   *        convert the string values of user variables. Needs to outlive the
+   *        builder.
+   */
+  explicit Transaction_builder(const Collations *collations);
+
+  Transaction_builder(const Transaction_builder &) = delete;
+  Transaction_builder(Transaction_builder &&) = delete;
+
+  Transaction_builder &operator=(const Transaction_builder &) = delete;
+  Transaction_builder &operator=(Transaction_builder &&) = delete;
+
+  ~Transaction_builder() = default;
+
+  /**
+   * Processes the next event.
+   *
+   * @returns true if the event completed a transaction, it can be obtained
+   *          using take()
+   *
+   * @throws std::runtime_error if event is malformed or not supported
+   */
+  bool add(std::string_view event);
+
+  /**
+   * Provides the most recently completed transaction.
+   */
+  Transaction take();
+
+  /**
+   * Whether a transaction was started and not yet completed.
+   */
+  bool in_transaction() const { return m_in_transaction; }
+
+  /**
+   * Current format of the events.
+   */
+  const std::shared_ptr<const Format_description> &format() const {
+    return m_format;
+  }
+
+ private:
+  void add_event(std::string_view event, const Event_header &header);
+
+  void add_query(std::string_view body, const Event_header &header);
+
+  void add_intvar(std::string_view body);
+
+  void add_rand(std::string_view body);
+
+  void add_user_var(std::string_view body);
+
+  void add_row_event(std::string_view event, std::string_view body,
+                     const Event_header &header);
+
+  void add_payload(std::string_view body);
+
+  void flush_row_events();
+
+  void complete();
+
+  std::string_view body(std::string_view event) const;
+
+  const Collations *m_collations;
+  std::shared_ptr<const Format_description> m_format;
+
+  bool m_in_transaction = false;
+  bool m_completed = false;
+  bool m_explicit_begin = false;
+  Transaction m_transaction;
+
+  // session state which was set within the current transaction
+  std::string m_session_state;
+  std::string m_database;
+
+  // row events which are going to be replayed by a single BINLOG statement
+  std::string m_row_events;
+};
+
+}  // namespace binlog
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_BINLOG_BINLOG_EVENT_H_
@@ -0,0 +1,837 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/binlog/dump_binlogs.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <mysql.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/shexcept.h"
+#include "mysqlshdk/include/scripting/type_info/custom.h"
+#include "mysqlshdk/include/scripting/type_info/generic.h"
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/mysql/binlog_utils.h"
+#include "mysqlshdk/libs/mysql/instance.h"
+#include "mysqlshdk/libs/mysql/replication.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+#include "modules/mod_utils.h"
+#include "modules/util/binlog/binlog_dump_info.h"
+#include "modules/util/binlog/binlog_event.h"
+#include "modules/util/dump/progress_thread.h"
+
+namespace mysqlsh {
+namespace binlog {
+
+namespace {
+
+using mysqlshdk::mysql::Gtid_set;
+using mysqlshdk::storage::Mode;
+
+constexpr auto k_default_bytes_per_chunk = "64M";
+
+constexpr auto k_minimum_chunk_size = "128k";
+
+// position of the first event in a binary log file
+constexpr uint64_t k_binlog_first_event = 4;
+
+// dump thread sends EOF instead of waiting for new events at the end of the
+// current binary log
+constexpr unsigned int k_binlog_dump_non_block = 1;
+
+/**
+ * Binary log file of the source instance.
+ */
+struct Source_binlog {
+  std::string name;
+  uint64_t size = 0;
+};
+
+/**
+ * Part of a binary log file which is going to be dumped.
+ */
+struct Dump_task {
+  std::size_t source;
+  // transactions which start before this position are not dumped
+  uint64_t begin;
+  // dump stops at this position, 0 if whole file is dumped
+  uint64_t end;
+};
+
+[[noreturn]] void throw_mysql_error(MYSQL *mysql) {
+  throw mysqlshdk::db::Error(mysql_error(mysql), mysql_errno(mysql),
+                             mysql_sqlstate(mysql));
+}
+
+class Binlog_dumper final {
+ public:
+  Binlog_dumper(const std::shared_ptr<mysqlshdk::db::ISession> &session,
+                const std::string &output_url,
+                const Dump_binlogs_options &options)
+      : m_session(session),
+        m_connection_options(get_classic_connection_options(session)),
+        m_output_url(output_url),
+        m_options(options),
+        m_progress_thread("Dump binary logs", options.show_progress()) {}
+
+  Binlog_dumper(const Binlog_dumper &) = delete;
+  Binlog_dumper(Binlog_dumper &&) = delete;
+
+  Binlog_dumper &operator=(const Binlog_dumper &) = delete;
+  Binlog_dumper &operator=(Binlog_dumper &&) = delete;
+
+  ~Binlog_dumper() = default;
+
+  void run() {
+    check_instance();
+    find_binlogs();
+    find_start();
+    create_tasks();
+
+    if (m_options.dry_run()) {
+      current_console()->print_info("dryRun enabled, no data will be dumped.");
+      return;
+    }
+
+    create_output();
+    dump();
+    write_metadata();
+    summarize();
+  }
+
+  void interrupt() { m_interrupted = true; }
+
+ private:
+  void check_instance() {
+    const auto result = m_session->query(
+        "SELECT @@GLOBAL.log_bin, @@GLOBAL.gtid_mode, @@server_uuid, "
+        "@@hostname");
+    const auto row = result->fetch_one_or_throw();
+
+    if (!row->get_int(0)) {
+      throw std::runtime_error(
+          "Binary logging is disabled on the source instance.");
+    }
+
+    if (const auto gtid_mode = row->get_string(1); "ON" != gtid_mode) {
+      throw std::runtime_error(
+          "The source instance has GTID_MODE set to '" + gtid_mode +
+          "', binary logs can be dumped only if it's set to 'ON'.");
+    }
+
+    m_info.server_uuid = row->get_string(2);
+    m_info.hostname = row->get_string(3);
+    m_info.server_version = m_session->get_server_version().get_full();
+  }
+
+  void find_binlogs() {
+    {
+      const auto result = m_session->query(shcore::str_format(
+          "SHOW %s STATUS", mysqlshdk::mysql::get_binary_logs_keyword(
+                                m_session->get_server_version(), true)
+                                .c_str()));
+      const auto row = result->fetch_one_or_throw();
+
+      m_info.stop.file = row->get_string(0);    // File
+      m_info.stop.position = row->get_uint(1);  // Position
+      m_gtid_executed = Gtid_set::from_string(
+          shcore::str_replace(row->get_string(4), "\n", ""));
+    }
+
+    {
+      const auto result = m_session->query("SHOW BINARY LOGS");
+
+      while (const auto row = result->fetch_one()) {
+        auto name = row->get_string(0);
+        const auto last = name == m_info.stop.file;
+
+        m_binlogs.push_back({std::move(name), row->get_uint(1)});
+
+        // binary log could have been rotated in the meantime
+        if (last) {
+          break;
+        }
+      }
+    }
+
+    if (m_binlogs.empty() || m_binlogs.back().name != m_info.stop.file) {
+      throw std::runtime_error(
+          "Could not find the current binary log file '" + m_info.stop.file +
+          "' of the source instance.");
+    }
+  }
+
+  Gtid_set previous_gtids(std::size_t binlog) const {
+    Gtid_set result;
+    const mysqlshdk::mysql::Instance instance{m_session};
+
+    mysqlshdk::mysql::list_binlog_events(
+        instance, m_binlogs[binlog].name,
+        [&result](const mysqlshdk::mysql::Gtid &,
+                  const mysqlshdk::mysql::Binlog_event &event) {
+          if ("Previous_gtids" == event.event_type) {
+            result = Gtid_set::from_string(
+                shcore::str_replace(event.info, "\n", ""));
+            return false;
+          }
+
+          return true;
+        },
+        {}, 3);
+
+    return result;
+  }
+
+  void find_start() {
+    if (!m_options.since().empty()) {
+      find_start_since();
+    } else {
+      find_start_from();
+    }
+  }
+
+  void find_start_since() {
+    using mysqlshdk::storage::make_directory;
+    const auto dir =
+        make_directory(m_options.since(), m_options.storage_config());
+    const auto location = dir->full_path().masked();
+    std::string gtid_executed;
+
+    if (dir->file(k_binlog_dump_metadata)->exists()) {
+      gtid_executed = read_dump_info(*dir).gtid_executed;
+    } else {
+      const auto read_gtid_executed = [&dir, &location]() {
+        const auto file = dir->file("@.json");
+
+        if (!file->exists()) {
+          throw std::invalid_argument(
+              "The location '" + location +
+              "' given in the 'since' option does not contain a dump.");
+        }
+
+        if (!dir->file("@.done.json")->exists()) {
+          throw std::invalid_argument(
+              "The dump at '" + location +
+              "' given in the 'since' option is not complete.");
+        }
+
+        file->open(Mode::READ);
+        const auto data = mysqlshdk::storage::read_file(file.get());
+        file->close();
+
+        const auto doc = shcore::Value::parse(data).as_map();
+        return doc->get_string("gtidExecuted", "");
+      };
+
+      gtid_executed = read_gtid_executed();
+    }
+
+    if (gtid_executed.empty()) {
+      throw std::invalid_argument(
+          "The dump at '" + location +
+          "' given in the 'since' option does not contain the value of "
+          "gtid_executed.");
+    }
+
+    auto since = Gtid_set::from_string(std::move(gtid_executed));
+    since.normalize();
+
+    if (auto unknown = Gtid_set{since}.subtract(m_gtid_executed);
+        !unknown.empty()) {
+      throw std::invalid_argument(
+          "The dump at '" + location +
+          "' given in the 'since' option contains transactions which were "
+          "not executed by the source instance: " +
+          unknown.str());
+    }
+
+    // find the most recent binary log file which does not contain any of the
+    // transactions executed after the dump was taken
+    std::size_t start = m_binlogs.size();
+    Gtid_set missing;
+
+    for (auto i = m_binlogs.size(); i > 0; --i) {
+      auto previous = previous_gtids(i - 1);
+
+      if (since.contains(previous)) {
+        start = i - 1;
+        break;
+      }
+
+      missing = std::move(previous.subtract(since));
+    }
+
+    if (m_binlogs.size() == start) {
+      throw std::invalid_argument(
+          "The binary logs of the source instance do not contain all the "
+          "transactions executed after the dump at '" +
+          location +
+          "' given in the 'since' option was taken, missing transactions: " +
+          missing.str());
+    }
+
+    m_start = start;
+    m_info.start = {m_binlogs[start].name, k_binlog_first_event};
+    m_info.gtid_set_before = since.str();
+    m_skip = Gtid_intervals{since};
+
+    log_info("Dumping transactions executed after %s, starting at %s",
+             since.str().c_str(), m_binlogs[start].name.c_str());
+  }
+
+  void find_start_from() {
+    const auto it =
+        std::find_if(m_binlogs.begin(), m_binlogs.end(), [this](const auto &b) {
+          return b.name == m_options.start_file();
+        });
+
+    if (m_binlogs.end() == it) {
+      throw std::invalid_argument(
+          "The binary log file '" + m_options.start_file() +
+          "' given in the 'startFrom' option does not exist.");
+    }
+
+    m_start = it - m_binlogs.begin();
+    m_info.start = {m_options.start_file(),
+                    std::max(m_options.start_position(), k_binlog_first_event)};
+
+    if (m_info.start.file == m_info.stop.file &&
+        m_info.start.position > m_info.stop.position) {
+      throw std::invalid_argument(
+          "The position given in the 'startFrom' option is past the end of "
+          "the binary log.");
+    }
+
+    // transactions which precede the start position are added once the first
+    // file is dumped
+    m_info.gtid_set_before = previous_gtids(m_start).normalize().str();
+  }
+
+  void create_tasks() {
+    const auto console = current_console();
+
+    for (auto i = m_start; i < m_binlogs.size(); ++i) {
+      Dump_task task;
+
+      task.source = i;
+      task.begin = i == m_start ? m_info.start.position : k_binlog_first_event;
+      task.end = i + 1 == m_binlogs.size() ? m_info.stop.position : 0;
+
+      m_total_bytes += (task.end ? task.end : m_binlogs[i].size) - task.begin;
+
+      m_tasks.emplace_back(task);
+    }
+
+    m_info.files.resize(m_tasks.size());
+
+    console->print_info(shcore::str_format(
+        "Dumping %zu binary log file(s) of the instance %s, from %s:%" PRIu64
+        " to %s:%" PRIu64 " (%s)",
+        m_tasks.size(), m_info.hostname.c_str(), m_info.start.file.c_str(),
+        m_info.start.position, m_info.stop.file.c_str(), m_info.stop.position,
+        mysqlshdk::utils::format_bytes(m_total_bytes).c_str()));
+  }
+
+  void create_output() {
+    using mysqlshdk::storage::make_directory;
+    m_output_dir = make_directory(m_output_url, m_options.storage_config());
+
+    if (m_output_dir->exists()) {
+      if (!m_output_dir->list_files(true).empty()) {
+        throw std::invalid_argument(
+            "Cannot proceed with the dump, the specified directory '" +
+            m_output_url + "' already exists at the target location " +
+            m_output_dir->full_path().masked() + " and is not empty.");
+      }
+    } else {
+      m_output_dir->create();
+    }
+  }
+
+  void dump() {
+    dump::Progress_thread::Throughput_config config;
+
+    config.space_before_item = false;
+    config.current = [this]() -> uint64_t { return m_bytes_read; };
+    config.total = [this]() -> uint64_t { return m_total_bytes; };
+
+    m_progress_thread.start_stage("Dumping binary logs", std::move(config));
+
+    const auto threads = std::max<uint64_t>(
+        1, std::min<uint64_t>(m_options.threads(), m_tasks.size()));
+
+    log_info("Dumping %zu binary log file(s) using %" PRIu64 " thread(s)",
+             m_tasks.size(), threads);
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (uint64_t i = 0; i < threads; ++i) {
+      workers.emplace_back(
+          mysqlsh::spawn_scoped_thread([this]() { worker(); }));
+    }
+
+    for (auto &worker : workers) {
+      worker.join();
+    }
+
+    if (m_error || m_interrupted) {
+      m_progress_thread.terminate();
+    } else {
+      m_progress_thread.finish();
+    }
+
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+
+    if (m_interrupted) {
+      throw shcore::cancelled("Interrupted by user");
+    }
+  }
+
+  void worker() {
+    mysqlsh::Mysql_thread mysql_thread;
+
+    while (!m_interrupted) {
+      const auto task = m_next_task++;
+
+      if (task >= m_tasks.size()) {
+        break;
+      }
+
+      try {
+        dump_file(task);
+      } catch (...) {
+        set_error(std::current_exception());
+      }
+    }
+  }
+
+  void set_error(std::exception_ptr error) {
+    {
+      std::lock_guard lock{m_error_mutex};
+
+      if (!m_error) {
+        m_error = std::move(error);
+      }
+    }
+
+    m_interrupted = true;
+  }
+
+  void dump_file(std::size_t index) {
+    const auto &task = m_tasks[index];
+    const auto &name = m_binlogs[task.source].name;
+    auto &file = m_info.files[index];
+
+    file.name = name;
+    file.begin = task.begin;
+
+    log_info("Dumping binary log file %s", name.c_str());
+
+    const auto session =
+        std::dynamic_pointer_cast<mysqlshdk::db::mysql::Session>(
+            establish_mysql_session(m_connection_options, false));
+
+    // dump thread sends events with checksums only to the clients which
+    // declare that they can handle them
+    session->execute(
+        "SET @source_binlog_checksum=@@GLOBAL.binlog_checksum, "
+        "@master_binlog_checksum=@@GLOBAL.binlog_checksum");
+
+    const auto mysql = session->get_handle();
+    MYSQL_RPL rpl{};
+
+    rpl.file_name_length = name.length();
+    rpl.file_name = name.c_str();
+    rpl.start_position = k_binlog_first_event;
+    rpl.server_id = 0;
+    rpl.flags = k_binlog_dump_non_block | MYSQL_RPL_SKIP_HEARTBEAT;
+
+    if (mysql_binlog_open(mysql, &rpl)) {
+      throw_mysql_error(mysql);
+    }
+
+    shcore::on_leave_scope close_connection{[&rpl, &session, mysql]() {
+      mysql_binlog_close(mysql, &rpl);
+      session->close();
+    }};
+
+    std::unique_ptr<mysqlshdk::storage::IFile> output;
+    const auto extension = mysqlshdk::storage::get_extension(
+        m_options.compression());
+
+    const auto write = [&output, &file, this](std::string_view data) {
+      output->write(data.data(), data.size());
+      file.chunks.back().data_bytes += data.size();
+      file.data_bytes += data.size();
+    };
+
+    const auto finish_chunk = [&output]() {
+      if (output) {
+        output->close();
+        output.reset();
+      }
+    };
+
+    Format_description format;
+    Gtid_intervals dumped;
+    Gtid_intervals before;
+    // events which are not a part of a dumped transaction are skipped
+    bool skip = true;
+    uint64_t position = task.begin;
+    uint64_t read = 0;
+
+    const auto update_progress = [&read, &position, this](
+                                     uint64_t log_pos) {
+      if (log_pos > position) {
+        m_bytes_read += log_pos - position;
+        read += log_pos - position;
+        position = log_pos;
+      }
+    };
+
+    while (!m_interrupted) {
+      if (mysql_binlog_fetch(mysql, &rpl)) {
+        throw_mysql_error(mysql);
+      }
+
+      // end of the current binary log
+      if (0 == rpl.size) {
+        break;
+      }
+
+      // the first byte is the OK packet marker
+      const std::string_view event{
+          reinterpret_cast<const char *>(rpl.buffer) + 1, rpl.size - 1};
+      const auto header = read_event_header(event);
+      bool done = false;
+
+      switch (header.type) {
+        case Event_type::ROTATE:
+          // rotate to the next file marks the end of the current one
+          done = parse_rotate(event, format.checksum) != name;
+          break;
+
+        case Event_type::FORMAT_DESCRIPTION:
+          format = parse_format_description(event);
+          break;
+
+        case Event_type::GTID:
+        case Event_type::ANONYMOUS_GTID:
+        case Event_type::GTID_TAGGED: {
+          const auto gtid = parse_gtid(event, format.checksum);
+
+          if (header.log_pos - header.size < task.begin) {
+            skip = true;
+            before.add(gtid.uuid, gtid.gno);
+          } else if (m_skip.contains(gtid.uuid, gtid.gno)) {
+            skip = true;
+          } else {
+            skip = false;
+
+            if (output && file.chunks.back().data_bytes >=
+                              m_options.bytes_per_chunk()) {
+              finish_chunk();
+            }
+
+            if (!output) {
+              auto &chunk = file.chunks.emplace_back();
+              chunk.name = shcore::str_format(
+                  "%s@%zu%s", name.c_str(), file.chunks.size() - 1,
+                  extension.c_str());
+
+              output = mysqlshdk::storage::make_file(
+                  m_output_dir->file(chunk.name), m_options.compression(),
+                  m_options.compression_options());
+              output->open(Mode::WRITE);
+
+              write(format.event);
+            }
+
+            write(event);
+            dumped.add(gtid.uuid, gtid.gno);
+            ++file.chunks.back().transactions;
+            ++file.transactions;
+          }
+          break;
+        }
+
+        case Event_type::STOP:
+        case Event_type::PREVIOUS_GTIDS:
+        case Event_type::HEARTBEAT:
+        case Event_type::HEARTBEAT_V2:
+          skip = true;
+          break;
+
+        default:
+          if (!skip) {
+            write(event);
+          }
+          break;
+      }
+
+      if (done) {
+        break;
+      }
+
+      if (!(header.flags & k_event_artificial_flag)) {
+        update_progress(header.log_pos);
+
+        if (task.end && header.log_pos >= task.end) {
+          break;
+        }
+      }
+    }
+
+    finish_chunk();
+
+    file.end = position;
+    file.gtid_set = dumped.to_gtid_set().str();
+
+    if (!before.empty()) {
+      std::lock_guard lock{m_error_mutex};
+      m_info.gtid_set_before = Gtid_set::from_string(m_info.gtid_set_before)
+                                   .add(before.to_gtid_set())
+                                   .normalize()
+                                   .str();
+    }
+
+    // the whole file was read, even if its size has changed in the meantime
+    const auto expected = (task.end ? task.end : m_binlogs[task.source].size) -
+                          task.begin;
+
+    if (read < expected) {
+      m_bytes_read += expected - read;
+    }
+
+    log_info("Dumped %" PRIu64 " transaction(s) from binary log file %s",
+             file.transactions, name.c_str());
+  }
+
+  void write_metadata() {
+    Gtid_set gtid_set;
+
+    for (const auto &file : m_info.files) {
+      gtid_set.add(Gtid_set::from_normalized_string(file.gtid_set));
+      m_info.data_bytes += file.data_bytes;
+      m_info.transactions += file.transactions;
+    }
+
+    gtid_set.normalize();
+
+    m_info.dumper = std::string("mysqlsh ") + shcore::get_long_version();
+    m_info.version = k_binlog_dump_version;
+    m_info.begin = m_progress_thread.duration().started_at();
+    m_info.end = m_progress_thread.duration().finished_at();
+    m_info.compression = mysqlshdk::storage::to_string(m_options.compression());
+    m_info.gtid_set = gtid_set.str();
+    m_info.gtid_executed = Gtid_set::from_string(m_info.gtid_set_before)
+                               .add(gtid_set)
+                               .normalize()
+                               .str();
+
+    write_dump_info(m_info, *m_output_dir);
+  }
+
+  void summarize() const {
+    using mysqlshdk::utils::format_bytes;
+    using mysqlshdk::utils::format_seconds;
+    using mysqlshdk::utils::format_throughput_bytes;
+
+    const auto seconds = m_progress_thread.duration().seconds();
+    const auto console = current_console();
+
+    console->print_status(shcore::str_format(
+        "Dumped %" PRIu64 " transaction(s) (%s) from %zu binary log file(s) "
+        "in %s; Throughput: %s",
+        m_info.transactions, format_bytes(m_info.data_bytes).c_str(),
+        m_info.files.size(), format_seconds(seconds).c_str(),
+        format_throughput_bytes(m_bytes_read, seconds).c_str()));
+    console->print_status("GTID set of the dumped transactions: " +
+                          (m_info.gtid_set.empty() ? std::string{"(empty)"}
+                                                   : m_info.gtid_set));
+  }
+
+  std::shared_ptr<mysqlshdk::db::ISession> m_session;
+  const mysqlshdk::db::Connection_options m_connection_options;
+  const std::string m_output_url;
+  const Dump_binlogs_options &m_options;
+
+  dump::Progress_thread m_progress_thread;
+  std::unique_ptr<mysqlshdk::storage::IDirectory> m_output_dir;
+
+  Binlog_dump_info m_info;
+  Gtid_set m_gtid_executed;
+  std::vector<Source_binlog> m_binlogs;
+  std::size_t m_start = 0;
+  Gtid_intervals m_skip;
+
+  std::vector<Dump_task> m_tasks;
+  std::atomic<std::size_t> m_next_task = 0;
+  uint64_t m_total_bytes = 0;
+  std::atomic<uint64_t> m_bytes_read = 0;
+
+  std::mutex m_error_mutex;
+  std::exception_ptr m_error;
+  std::atomic<bool> m_interrupted = false;
+};
+
+}  // namespace
+
+Dump_binlogs_options::Dump_binlogs_options()
+    : m_bytes_per_chunk(
+          mysqlshdk::utils::expand_to_bytes(k_default_bytes_per_chunk)),
+      m_show_progress(isatty(fileno(stdout)) ? true : false),
+      m_blob_storage_options{
+          mysqlshdk::azure::Blob_storage_options::Operation::WRITE} {}
+
+const shcore::Option_pack_def<Dump_binlogs_options>
+    &Dump_binlogs_options::options() {
+  static const auto opts =
+      shcore::Option_pack_def<Dump_binlogs_options>()
+          .optional("since", &Dump_binlogs_options::m_since)
+          .optional("startFrom", &Dump_binlogs_options::set_string_option)
+          .optional("threads", &Dump_binlogs_options::m_threads)
+          .optional("bytesPerChunk", &Dump_binlogs_options::set_string_option)
+          .optional("compression", &Dump_binlogs_options::set_string_option)
+          .optional("showProgress", &Dump_binlogs_options::m_show_progress)
+          .optional("dryRun", &Dump_binlogs_options::m_dry_run)
+          .include(&Dump_binlogs_options::m_oci_bucket_options)
+          .include(&Dump_binlogs_options::m_s3_bucket_options)
+          .include(&Dump_binlogs_options::m_blob_storage_options)
+          .on_done(&Dump_binlogs_options::on_unpacked_options);
+
+  return opts;
+}
+
+void Dump_binlogs_options::set_string_option(const std::string &option,
+                                             const std::string &value) {
+  if (value.empty()) {
+    throw std::invalid_argument("The option '" + option +
+                                "' cannot be set to an empty string.");
+  }
+
+  if (option == "startFrom") {
+    const auto colon = value.rfind(':');
+
+    if (std::string::npos != colon && colon + 1 < value.length() &&
+        std::all_of(value.begin() + colon + 1, value.end(), ::isdigit)) {
+      m_start_file = value.substr(0, colon);
+      m_start_position = std::stoull(value.substr(colon + 1));
+    } else {
+      m_start_file = value;
+      m_start_position = 0;
+    }
+  } else if (option == "bytesPerChunk") {
+    m_bytes_per_chunk = mysqlshdk::utils::expand_to_bytes(value);
+  } else if (option == "compression") {
+    m_compression =
+        mysqlshdk::storage::to_compression(value, &m_compression_options);
+  } else {
+    // This function should only be called with the options above.
+    assert(false);
+  }
+}
+
+void Dump_binlogs_options::on_unpacked_options() {
+  m_s3_bucket_options.throw_on_conflict(m_oci_bucket_options);
+  m_s3_bucket_options.throw_on_conflict(m_blob_storage_options);
+  m_blob_storage_options.throw_on_conflict(m_oci_bucket_options);
+
+  if (m_oci_bucket_options) {
+    m_storage_config = m_oci_bucket_options.config();
+  }
+
+  if (m_s3_bucket_options) {
+    m_storage_config = m_s3_bucket_options.config();
+  }
+
+  if (m_blob_storage_options) {
+    m_storage_config = m_blob_storage_options.config();
+  }
+
+  if (0 == m_threads) {
+    throw std::invalid_argument(
+        "The value of 'threads' option must be greater than 0.");
+  }
+
+  if (m_bytes_per_chunk <
+      mysqlshdk::utils::expand_to_bytes(k_minimum_chunk_size)) {
+    throw std::invalid_argument(
+        "The value of 'bytesPerChunk' option must be greater than or equal "
+        "to " +
+        std::string(k_minimum_chunk_size) + ".");
+  }
+
+  if (!m_since.empty() && !m_start_file.empty()) {
+    throw std::invalid_argument(
+        "The 'since' and 'startFrom' options cannot be both set.");
+  }
+
+  if (m_since.empty() && m_start_file.empty()) {
+    throw std::invalid_argument(
+        "One of the 'since' or 'startFrom' options must be set.");
+  }
+}
+
+void dump_binlogs(const std::shared_ptr<mysqlshdk::db::ISession> &session,
+                  const std::string &output_url,
+                  const Dump_binlogs_options &options) {
+  Binlog_dumper dumper{session, output_url, options};
+
+  shcore::Interrupt_handler intr_handler([&dumper]() -> bool {
+    dumper.interrupt();
+    return false;
+  });
+
+  dumper.run();
+}
+
+}  // namespace binlog
+}  // namespace mysqlsh
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_BINLOG_DUMP_BINLOGS_H_
+#define MODULES_UTIL_BINLOG_DUMP_BINLOGS_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/libs/aws/s3_bucket_options.h"
+#include "mysqlshdk/libs/azure/blob_storage_options.h"
+#include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/oci/oci_bucket_options.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/config.h"
+
+namespace mysqlsh {
+namespace binlog {
+
+class Dump_binlogs_options final {
+ public:
+  Dump_binlogs_options();
+
+  Dump_binlogs_options(const Dump_binlogs_options &) = default;
+  Dump_binlogs_options(Dump_binlogs_options &&) = default;
+
+  Dump_binlogs_options &operator=(const Dump_binlogs_options &) = default;
+  Dump_binlogs_options &operator=(Dump_binlogs_options &&) = default;
+
+  ~Dump_binlogs_options() = default;
+
+  static const shcore::Option_pack_def<Dump_binlogs_options> &options();
+
+  /**
+   * URL of a dump created by one of the dump utilities, transactions which
+   * were executed before that dump was taken are not dumped.
+   */
+  const std::string &since() const { return m_since; }
+
+  /**
+   * Name of the binary log file the dump starts at, used if since() is not
+   * set.
+   */
+  const std::string &start_file() const { return m_start_file; }
+
+  /**
+   * Position in the start_file() where the dump starts.
+   */
+  uint64_t start_position() const { return m_start_position; }
+
+  /**
+   * Number of threads, each thread reads a binary log file using a separate
+   * connection.
+   */
+  uint64_t threads() const { return m_threads; }
+
+  /**
+   * Transactions of each binary log file are written to chunks of about this
+   * size.
+   */
+  uint64_t bytes_per_chunk() const { return m_bytes_per_chunk; }
+
+  mysqlshdk::storage::Compression compression() const { return m_compression; }
+
+  const mysqlshdk::storage::Compression_options &compression_options() const {
+    return m_compression_options;
+  }
+
+  bool show_progress() const { return m_show_progress; }
+
+  bool dry_run() const { return m_dry_run; }
+
+  const mysqlshdk::storage::Config_ptr &storage_config() const {
+    return m_storage_config;
+  }
+
+ private:
+  void on_unpacked_options();
+
+  void set_string_option(const std::string &option, const std::string &value);
+
+  std::string m_since;
+  std::string m_start_file;
+  uint64_t m_start_position = 0;
+  uint64_t m_threads = 4;
+  uint64_t m_bytes_per_chunk;
+  mysqlshdk::storage::Compression m_compression =
+      mysqlshdk::storage::Compression::ZSTD;
+  mysqlshdk::storage::Compression_options m_compression_options;
+  bool m_show_progress;
+  bool m_dry_run = false;
+
+  mysqlshdk::oci::Oci_bucket_options m_oci_bucket_options;
+  mysqlshdk::aws::S3_bucket_options m_s3_bucket_options;
+  mysqlshdk::azure::Blob_storage_options m_blob_storage_options;
+  mysqlshdk::storage::Config_ptr m_storage_config;
+};
+
+/**
+ * Dumps the binary logs of the given instance.
+ *
+ * Each binary log file is read by a separate thread, using the replication
+ * protocol. Transactions are written to compressed chunks, each chunk starts
+ * with the format description event of its binary log file, followed by the
+ * events of complete transactions. GTIDs of the dumped transactions are
+ * stored in the metadata, so that the dump can be loaded on top of an
+ * instance restored from the dump given in the 'since' option.
+ *
+ * @param session Session to the source instance.
+ * @param output_url Where the dump is going to be written.
+ * @param options Dump options.
+ */
+void dump_binlogs(const std::shared_ptr<mysqlshdk::db::ISession> &session,
+                  const std::string &output_url,
+                  const Dump_binlogs_options &options);
+
+}  // namespace binlog
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_BINLOG_DUMP_BINLOGS_H_
@@ -0,0 +1,645 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/binlog/load_binlogs.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/shexcept.h"
+#include "mysqlshdk/include/scripting/type_info/custom.h"
+#include "mysqlshdk/include/scripting/type_info/generic.h"
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/db/result.h"
+#include "mysqlshdk/libs/mysql/gtid_utils.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "mysqlshdk/libs/utils/version.h"
+
+#include "modules/mod_utils.h"
+#include "modules/util/binlog/binlog_dump_info.h"
+#include "modules/util/binlog/binlog_event.h"
+#include "modules/util/dump/progress_thread.h"
+
+namespace mysqlsh {
+namespace binlog {
+
+namespace {
+
+using mysqlshdk::mysql::Gtid_set;
+using mysqlshdk::storage::Mode;
+
+// how long the threads wait before checking if load was interrupted
+constexpr auto k_wait_interval = std::chrono::milliseconds(100);
+
+/**
+ * A transaction which is going to be applied by one of the workers.
+ */
+struct Load_task {
+  Transaction transaction;
+  // chunk which holds the transaction
+  std::string chunk;
+};
+
+class Binlog_loader final {
+ public:
+  Binlog_loader(const std::shared_ptr<mysqlshdk::db::ISession> &session,
+                const std::string &url, const Load_binlogs_options &options)
+      : m_session(session),
+        m_connection_options(get_classic_connection_options(session)),
+        m_url(url),
+        m_options(options),
+        m_progress_thread("Load binary logs", options.show_progress()) {}
+
+  Binlog_loader(const Binlog_loader &) = delete;
+  Binlog_loader(Binlog_loader &&) = delete;
+
+  Binlog_loader &operator=(const Binlog_loader &) = delete;
+  Binlog_loader &operator=(Binlog_loader &&) = delete;
+
+  ~Binlog_loader() = default;
+
+  void run() {
+    read_metadata();
+    check_instance();
+    check_gtids();
+
+    if (m_options.dry_run()) {
+      current_console()->print_info("dryRun enabled, no data will be loaded.");
+      return;
+    }
+
+    if (m_to_load.empty()) {
+      current_console()->print_info(
+          "All transactions in the dump were already executed by the target "
+          "instance, nothing to load.");
+      return;
+    }
+
+    fetch_collations();
+    load();
+    summarize();
+  }
+
+  void interrupt() { m_interrupted = true; }
+
+ private:
+  void read_metadata() {
+    using mysqlshdk::storage::make_directory;
+    m_dir = make_directory(m_url, m_options.storage_config());
+    m_info = read_dump_info(*m_dir);
+
+    if (mysqlshdk::utils::Version(m_info.version).get_major() >
+        mysqlshdk::utils::Version(k_binlog_dump_version).get_major()) {
+      throw std::invalid_argument(
+          "The dump of binary logs at '" + m_dir->full_path().masked() +
+          "' was created with a newer version of MySQL Shell (format version " +
+          m_info.version + "), it cannot be loaded by this version.");
+    }
+
+    m_compression = mysqlshdk::storage::to_compression(m_info.compression);
+  }
+
+  void check_instance() {
+    const auto result = m_session->query(
+        "SELECT @@GLOBAL.gtid_mode, @@GLOBAL.gtid_executed, @@hostname");
+    const auto row = result->fetch_one_or_throw();
+
+    if (const auto gtid_mode = row->get_string(0); "ON" != gtid_mode) {
+      throw std::runtime_error(
+          "The target instance has GTID_MODE set to '" + gtid_mode +
+          "', binary logs can be loaded only if it's set to 'ON'.");
+    }
+
+    m_gtid_executed = Gtid_set::from_string(
+        shcore::str_replace(row->get_string(1), "\n", ""));
+    m_gtid_executed.normalize();
+    m_hostname = row->get_string(2);
+    m_server_version = m_session->get_server_version();
+  }
+
+  void check_gtids() {
+    const auto console = current_console();
+
+    if (auto missing = Gtid_set::from_string(m_info.gtid_set_before)
+                           .subtract(m_gtid_executed);
+        !missing.empty()) {
+      const auto msg =
+          "The target instance is missing transactions which were executed "
+          "by the source instance before the first transaction in the dump: " +
+          missing.str();
+
+      if (!m_options.ignore_gtid_gap()) {
+        throw std::invalid_argument(msg +
+                                    ". Load the dump these transactions belong "
+                                    "to or enable the 'ignoreGtidGap' option.");
+      }
+
+      console->print_warning(msg);
+    }
+
+    m_to_load = Gtid_set::from_string(m_info.gtid_set);
+    m_to_load.subtract(m_gtid_executed);
+    m_skip = Gtid_intervals{m_gtid_executed};
+
+    const auto skipped = Gtid_set::from_string(m_info.gtid_set)
+                             .intersect(m_gtid_executed)
+                             .count();
+
+    if (!m_options.stop_before().empty()) {
+      const auto gtid =
+          mysqlshdk::mysql::Gtid_range::from_gtid(m_options.stop_before());
+      const auto colon = gtid.uuid_tag.find(':');
+
+      m_stop_uuid = shcore::str_lower(gtid.uuid_tag.substr(0, colon));
+      m_stop_gno = gtid.begin;
+    }
+
+    console->print_info(shcore::str_format(
+        "Loading %" PRIu64 " transaction(s) (%s) from %zu binary log file(s) "
+        "dumped from the instance %s into the instance %s",
+        m_to_load.count(),
+        mysqlshdk::utils::format_bytes(m_info.data_bytes).c_str(),
+        m_info.files.size(), m_info.hostname.c_str(), m_hostname.c_str()));
+
+    if (skipped) {
+      console->print_info(shcore::str_format(
+          "%" PRIu64
+          " transaction(s) were already executed by the target instance and "
+          "will be skipped",
+          skipped));
+    }
+  }
+
+  void fetch_collations() {
+    const auto result = m_session->query(
+        "SELECT ID, CHARACTER_SET_NAME, COLLATION_NAME FROM "
+        "information_schema.COLLATIONS");
+
+    while (const auto row = result->fetch_one()) {
+      m_collations.emplace(static_cast<uint32_t>(row->get_uint(0)),
+                           Collation{row->get_string(1), row->get_string(2)});
+    }
+  }
+
+  void load() {
+    dump::Progress_thread::Throughput_config config;
+
+    config.space_before_item = false;
+    config.current = [this]() -> uint64_t { return m_bytes_loaded; };
+    config.total = [this]() -> uint64_t { return m_info.data_bytes; };
+
+    m_progress_thread.start_stage("Loading binary logs", std::move(config));
+
+    const auto threads = std::max<uint64_t>(1, m_options.threads());
+
+    log_info("Loading binary logs using %" PRIu64 " thread(s)", threads);
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (uint64_t i = 0; i < threads; ++i) {
+      workers.emplace_back(
+          mysqlsh::spawn_scoped_thread([this]() { worker(); }));
+    }
+
+    try {
+      read_transactions();
+    } catch (...) {
+      set_error(std::current_exception());
+    }
+
+    {
+      std::lock_guard lock{m_mutex};
+      m_reading_done = true;
+    }
+
+    m_cv.notify_all();
+
+    for (auto &worker : workers) {
+      worker.join();
+    }
+
+    if (m_error || m_interrupted) {
+      m_progress_thread.terminate();
+    } else {
+      m_progress_thread.finish();
+    }
+
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+
+    if (m_interrupted) {
+      throw shcore::cancelled("Interrupted by user");
+    }
+  }
+
+  void read_transactions() {
+    Transaction_builder builder{&m_collations};
+
+    for (const auto &file : m_info.files) {
+      // sequence numbers are valid only within a single binary log file
+      wait_for_workers();
+
+      for (const auto &chunk : file.chunks) {
+        if (m_interrupted) {
+          return;
+        }
+
+        log_info("Loading chunk %s", chunk.name.c_str());
+
+        const auto input = mysqlshdk::storage::make_file(
+            m_dir->file(chunk.name), m_compression);
+        input->open(Mode::READ);
+        const auto data = mysqlshdk::storage::read_file(input.get());
+        input->close();
+
+        std::string_view events{data};
+        uint64_t transaction_bytes = 0;
+
+        while (!events.empty() && !m_interrupted) {
+          if (!builder.add(next_event(&events))) {
+            continue;
+          }
+
+          auto transaction = builder.take();
+          const auto &gtid = transaction.gtid;
+
+          if (!m_stop_uuid.empty() && gtid.gno == m_stop_gno &&
+              gtid.uuid == m_stop_uuid) {
+            m_stopped = true;
+            return;
+          }
+
+          transaction_bytes += transaction.bytes;
+
+          if (m_skip.contains(gtid.uuid, gtid.gno)) {
+            ++m_skipped;
+            m_bytes_loaded += transaction.bytes;
+          } else {
+            schedule({std::move(transaction), chunk.name});
+          }
+        }
+
+        if (builder.in_transaction()) {
+          throw std::runtime_error("The chunk '" + chunk.name +
+                                   "' ends with an incomplete transaction.");
+        }
+
+        // format description event and any other events outside of
+        // transactions
+        if (chunk.data_bytes > transaction_bytes) {
+          m_bytes_loaded += chunk.data_bytes - transaction_bytes;
+        }
+      }
+    }
+  }
+
+  bool can_start(const Gtid_event &gtid) const {
+    if (m_in_flight.empty()) {
+      return true;
+    }
+
+    // transaction with unknown commit order is applied serially
+    if (0 == gtid.sequence_number) {
+      return false;
+    }
+
+    // all transactions which have to be committed before this one was
+    // prepared on the source need to be committed
+    return *m_in_flight.begin() > gtid.last_committed;
+  }
+
+  void schedule(Load_task task) {
+    std::unique_lock lock{m_mutex};
+
+    while (!m_interrupted && (m_queue.size() >= m_options.threads() ||
+                              !can_start(task.transaction.gtid))) {
+      m_cv.wait_for(lock, k_wait_interval);
+    }
+
+    if (m_interrupted) {
+      return;
+    }
+
+    // transaction with unknown commit order blocks all subsequent ones
+    m_in_flight.emplace(task.transaction.gtid.sequence_number);
+    m_queue.emplace_back(std::move(task));
+
+    lock.unlock();
+    m_cv.notify_all();
+  }
+
+  void wait_for_workers() {
+    std::unique_lock lock{m_mutex};
+
+    while (!m_interrupted && !m_in_flight.empty()) {
+      m_cv.wait_for(lock, k_wait_interval);
+    }
+  }
+
+  void worker() {
+    mysqlsh::Mysql_thread mysql_thread;
+
+    try {
+      const auto session =
+          establish_mysql_session(m_connection_options, false);
+
+      shcore::on_leave_scope close_session{[&session]() { session->close(); }};
+
+      // allows to execute the BINLOG statements and to set the session
+      // variables captured by the query events
+      session->execute(
+          m_server_version < mysqlshdk::utils::Version(8, 0, 26)
+              ? "SET @@SESSION.pseudo_slave_mode=1"
+              : "SET @@SESSION.pseudo_replica_mode=1");
+
+      std::shared_ptr<const Format_description> format;
+
+      while (true) {
+        Load_task task;
+
+        {
+          std::unique_lock lock{m_mutex};
+
+          while (!m_interrupted && !m_reading_done && m_queue.empty()) {
+            m_cv.wait_for(lock, k_wait_interval);
+          }
+
+          if (m_interrupted || m_queue.empty()) {
+            break;
+          }
+
+          task = std::move(m_queue.front());
+          m_queue.pop_front();
+        }
+
+        m_cv.notify_all();
+
+        apply(session.get(), task, &format);
+
+        {
+          std::lock_guard lock{m_mutex};
+          m_in_flight.erase(
+              m_in_flight.find(task.transaction.gtid.sequence_number));
+        }
+
+        m_cv.notify_all();
+      }
+
+      session->execute("SET GTID_NEXT='AUTOMATIC'");
+    } catch (...) {
+      set_error(std::current_exception());
+    }
+  }
+
+  void apply(mysqlshdk::db::ISession *session, const Load_task &task,
+             std::shared_ptr<const Format_description> *format) {
+    const auto &transaction = task.transaction;
+    const auto gtid = transaction.gtid.gtid();
+
+    try {
+      if (transaction.has_row_events && *format != transaction.format) {
+        std::string encoded;
+
+        if (!shcore::encode_base64(reinterpret_cast<const unsigned char *>(
+                                       transaction.format->event.data()),
+                                   static_cast<int>(
+                                       transaction.format->event.size()),
+                                   &encoded)) {
+          throw std::runtime_error(
+              "Failed to encode the format description event");
+        }
+
+        session->execute("BINLOG '" + encoded + "'");
+        *format = transaction.format;
+      }
+
+      session->execute("SET GTID_NEXT='" + gtid + "'");
+
+      for (const auto &statement : transaction.statements) {
+        session->execute(statement);
+      }
+    } catch (const shcore::Error &e) {
+      log_error("Failed to apply transaction %s from chunk %s: %s",
+                gtid.c_str(), task.chunk.c_str(), e.format().c_str());
+
+      try {
+        session->execute("ROLLBACK");
+        session->execute("SET GTID_NEXT='AUTOMATIC'");
+      } catch (const std::exception &ex) {
+        log_warning("Failed to roll back transaction %s: %s", gtid.c_str(),
+                    ex.what());
+      }
+
+      throw std::runtime_error("Failed to apply transaction " + gtid +
+                               " from the chunk '" + task.chunk +
+                               "': " + e.format());
+    }
+
+    ++m_loaded;
+    m_bytes_loaded += transaction.bytes;
+  }
+
+  void set_error(std::exception_ptr error) {
+    {
+      std::lock_guard lock{m_mutex};
+
+      if (!m_error) {
+        m_error = std::move(error);
+      }
+    }
+
+    m_interrupted = true;
+    m_cv.notify_all();
+  }
+
+  void summarize() const {
+    using mysqlshdk::utils::format_bytes;
+    using mysqlshdk::utils::format_seconds;
+    using mysqlshdk::utils::format_throughput_bytes;
+
+    const auto seconds = m_progress_thread.duration().seconds();
+    const auto console = current_console();
+
+    console->print_status(shcore::str_format(
+        "Loaded %" PRIu64 " transaction(s) (%s) in %s; Throughput: %s",
+        static_cast<uint64_t>(m_loaded),
+        format_bytes(m_bytes_loaded).c_str(), format_seconds(seconds).c_str(),
+        format_throughput_bytes(m_bytes_loaded, seconds).c_str()));
+
+    if (m_skipped) {
+      console->print_status(shcore::str_format(
+          "%" PRIu64
+          " transaction(s) already executed by the target instance were "
+          "skipped",
+          m_skipped));
+    }
+
+    if (!m_options.stop_before().empty()) {
+      if (m_stopped) {
+        console->print_status("Load was stopped before transaction " +
+                              m_options.stop_before());
+      } else {
+        console->print_warning("Transaction " + m_options.stop_before() +
+                               " given in the 'stopBefore' option was not "
+                               "found in the dump.");
+      }
+    }
+  }
+
+  std::shared_ptr<mysqlshdk::db::ISession> m_session;
+  const mysqlshdk::db::Connection_options m_connection_options;
+  const std::string m_url;
+  const Load_binlogs_options &m_options;
+
+  dump::Progress_thread m_progress_thread;
+  std::unique_ptr<mysqlshdk::storage::IDirectory> m_dir;
+
+  Binlog_dump_info m_info;
+  mysqlshdk::storage::Compression m_compression;
+  std::string m_hostname;
+  mysqlshdk::utils::Version m_server_version;
+  Gtid_set m_gtid_executed;
+  Gtid_set m_to_load;
+  Gtid_intervals m_skip;
+  Collations m_collations;
+
+  std::string m_stop_uuid;
+  uint64_t m_stop_gno = 0;
+  bool m_stopped = false;
+
+  // sequence numbers of the transactions which were scheduled but not yet
+  // committed
+  std::multiset<int64_t> m_in_flight;
+  std::deque<Load_task> m_queue;
+  bool m_reading_done = false;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+
+  uint64_t m_skipped = 0;
+  std::atomic<uint64_t> m_loaded = 0;
+  std::atomic<uint64_t> m_bytes_loaded = 0;
+
+  std::exception_ptr m_error;
+  std::atomic<bool> m_interrupted = false;
+};
+
+}  // namespace
+
+Load_binlogs_options::Load_binlogs_options()
+    : m_show_progress(isatty(fileno(stdout)) ? true : false),
+      m_blob_storage_options{
+          mysqlshdk::azure::Blob_storage_options::Operation::READ} {}
+
+const shcore::Option_pack_def<Load_binlogs_options>
+    &Load_binlogs_options::options() {
+  static const auto opts =
+      shcore::Option_pack_def<Load_binlogs_options>()
+          .optional("threads", &Load_binlogs_options::m_threads)
+          .optional("stopBefore", &Load_binlogs_options::m_stop_before)
+          .optional("ignoreGtidGap", &Load_binlogs_options::m_ignore_gtid_gap)
+          .optional("showProgress", &Load_binlogs_options::m_show_progress)
+          .optional("dryRun", &Load_binlogs_options::m_dry_run)
+          .include(&Load_binlogs_options::m_oci_bucket_options)
+          .include(&Load_binlogs_options::m_s3_bucket_options)
+          .include(&Load_binlogs_options::m_blob_storage_options)
+          .on_done(&Load_binlogs_options::on_unpacked_options);
+
+  return opts;
+}
+
+void Load_binlogs_options::on_unpacked_options() {
+  m_s3_bucket_options.throw_on_conflict(m_oci_bucket_options);
+  m_s3_bucket_options.throw_on_conflict(m_blob_storage_options);
+  m_blob_storage_options.throw_on_conflict(m_oci_bucket_options);
+
+  if (m_oci_bucket_options) {
+    m_storage_config = m_oci_bucket_options.config();
+  }
+
+  if (m_s3_bucket_options) {
+    m_storage_config = m_s3_bucket_options.config();
+  }
+
+  if (m_blob_storage_options) {
+    m_storage_config = m_blob_storage_options.config();
+  }
+
+  if (0 == m_threads) {
+    throw std::invalid_argument(
+        "The value of 'threads' option must be greater than 0.");
+  }
+
+  if (!m_stop_before.empty()) {
+    const auto gtid = mysqlshdk::mysql::Gtid_range::from_gtid(m_stop_before);
+
+    if (!gtid || !gtid.is_single() ||
+        std::string::npos != gtid.uuid_tag.find(':')) {
+      throw std::invalid_argument(
+          "The value of 'stopBefore' option must be a single GTID without a "
+          "tag.");
+    }
+  }
+}
+
+void load_binlogs(const std::shared_ptr<mysqlshdk::db::ISession> &session,
+                  const std::string &url, const Load_binlogs_options &options) {
+  Binlog_loader loader{session, url, options};
+
+  shcore::Interrupt_handler intr_handler([&loader]() -> bool {
+    loader.interrupt();
+    return false;
+  });
+
+  loader.run();
+}
+
+}  // namespace binlog
+}  // namespace mysqlsh
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_BINLOG_LOAD_BINLOGS_H_
+#define MODULES_UTIL_BINLOG_LOAD_BINLOGS_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/libs/aws/s3_bucket_options.h"
+#include "mysqlshdk/libs/azure/blob_storage_options.h"
+#include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/oci/oci_bucket_options.h"
+#include "mysqlshdk/libs/storage/config.h"
+
+namespace mysqlsh {
+namespace binlog {
+
+class Load_binlogs_options final {
+ public:
+  Load_binlogs_options();
+
+  Load_binlogs_options(const Load_binlogs_options &) = default;
+  Load_binlogs_options(Load_binlogs_options &&) = default;
+
+  Load_binlogs_options &operator=(const Load_binlogs_options &) = default;
+  Load_binlogs_options &operator=(Load_binlogs_options &&) = default;
+
+  ~Load_binlogs_options() = default;
+
+  static const shcore::Option_pack_def<Load_binlogs_options> &options();
+
+  /**
+   * Number of threads which apply the transactions, each thread uses a
+   * separate connection.
+   */
+  uint64_t threads() const { return m_threads; }
+
+  /**
+   * Load stops before the transaction with this GTID is applied.
+   */
+  const std::string &stop_before() const { return m_stop_before; }
+
+  /**
+   * Whether transactions which were executed by the source instance before
+   * the dump was taken are allowed to be missing in the target instance.
+   */
+  bool ignore_gtid_gap() const { return m_ignore_gtid_gap; }
+
+  bool show_progress() const { return m_show_progress; }
+
+  bool dry_run() const { return m_dry_run; }
+
+  const mysqlshdk::storage::Config_ptr &storage_config() const {
+    return m_storage_config;
+  }
+
+ private:
+  void on_unpacked_options();
+
+  uint64_t m_threads = 4;
+  std::string m_stop_before;
+  bool m_ignore_gtid_gap = false;
+  bool m_show_progress;
+  bool m_dry_run = false;
+
+  mysqlshdk::oci::Oci_bucket_options m_oci_bucket_options;
+  mysqlshdk::aws::S3_bucket_options m_s3_bucket_options;
+  mysqlshdk::azure::Blob_storage_options m_blob_storage_options;
+  mysqlshdk::storage::Config_ptr m_storage_config;
+};
+
+/**
+ * Loads a dump of binary logs created by dump_binlogs() into the given
+ * instance.
+ *
+ * Chunks are read in order, events are converted to SQL statements (row
+ * events are replayed using the BINLOG statement) which are executed with
+ * GTID_NEXT set to the GTID of the original transaction. Transactions are
+ * applied in parallel, using the commit dependencies (logical clock) stored
+ * in the GTID events. Transactions which were already executed by the target
+ * instance are skipped.
+ *
+ * @param session Session to the target instance.
+ * @param url Location of the dump.
+ * @param options Load options.
+ */
+void load_binlogs(const std::shared_ptr<mysqlshdk::db::ISession> &session,
+                  const std::string &url, const Load_binlogs_options &options);
+
+}  // namespace binlog
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_BINLOG_LOAD_BINLOGS_H_
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMMON_CONSOLE_WITH_PREFIX_H_
+#define MODULES_UTIL_COMMON_CONSOLE_WITH_PREFIX_H_
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/console.h"
+
+namespace mysqlsh {
+
+/**
+ * Forwards the output to the current console, prepending each message with
+ * the given prefix. Used when several operations print to the same console.
+ */
+class Console_with_prefix final : public IConsole {
+ public:
+  Console_with_prefix() = delete;
+
+  explicit Console_with_prefix(const std::string &prefix)
+      : m_prefix(prefix), m_console(current_console()) {}
+
+  Console_with_prefix(const Console_with_prefix &) = delete;
+  Console_with_prefix(Console_with_prefix &&) = delete;
+
+  Console_with_prefix &operator=(const Console_with_prefix &) = delete;
+  Console_with_prefix &operator=(Console_with_prefix &&) = delete;
+
+  ~Console_with_prefix() override = default;
+
+  void raw_print(const std::string &text, Output_stream stream,
+                 bool format_json = true) const override {
+    m_console->raw_print(get_text(text), stream, format_json);
+  }
+
+  void print(const std::string &text) const override {
+    m_console->print(get_text(text));
+  }
+
+  void println(const std::string &text = "") const override {
+    m_console->println(get_text(text));
+  }
+
+  void print_error(const std::string &text) const override {
+    m_console->print_error(get_text(text));
+  }
+
+  void print_warning(const std::string &text) const override {
+    m_console->print_warning(get_text(text));
+  }
+
+  void print_note(const std::string &text) const override {
+    m_console->print_note(get_text(text));
+  }
+
+  void print_status(const std::string &text) const override {
+    m_console->print_status(get_text(text));
+  }
+
+  void print_info(const std::string &text = "") const override {
+    m_console->print_info(get_text(text));
+  }
+
+  void print_para(const std::string &text) const override {
+    m_console->print_para(get_text(text));
+  }
+
+  void print_value(const shcore::Value &, const std::string &) const override {
+    throw std::logic_error("Console_with_prefix::print_value() not supported");
+  }
+
+  void print_diag(const std::string &text) const override {
+    m_console->print_diag(get_text(text));
+  }
+
+  shcore::Prompt_result prompt(const std::string &prompt,
+                               const shcore::prompt::Prompt_options &options,
+                               std::string *out_val) const override {
+    return m_console->prompt(get_text(prompt), options, out_val);
+  }
+
+  shcore::Prompt_result prompt(
+      const std::string &prompt, std::string *out_val,
+      Validator validator = nullptr,
+      shcore::prompt::Prompt_type type = shcore::prompt::Prompt_type::TEXT,
+      const std::string &title = "",
+      const std::vector<std::string> &description = {},
+      const std::string &default_value = "") const override {
+    return m_console->prompt(get_text(prompt), out_val, validator, type, title,
+                             description, default_value);
+  }
+
+  Prompt_answer confirm(
+      const std::string &prompt, Prompt_answer def = Prompt_answer::NO,
+      const std::string &yes_label = "&Yes",
+      const std::string &no_label = "&No", const std::string &alt_label = "",
+      const std::string &title = "",
+      const std::vector<std::string> &description = {}) const override {
+    return m_console->confirm(get_text(prompt), def, yes_label, no_label,
+                              alt_label, title, description);
+  }
+
+  shcore::Prompt_result prompt_password(
+      const std::string &prompt, std::string *out_val,
+      Validator validator = nullptr, const std::string &title = "",
+      const std::vector<std::string> &description = {}) const override {
+    return m_console->prompt_password(get_text(prompt), out_val, validator,
+                                      title, description);
+  }
+
+  bool select(const std::string &prompt_text, std::string *result,
+              const std::vector<std::string> &items, size_t default_option = 0,
+              bool allow_custom = false, Validator validator = nullptr,
+              const std::string &title = "",
+              const std::vector<std::string> &description = {}) const override {
+    return m_console->select(get_text(prompt_text), result, items,
+                             default_option, allow_custom, validator, title,
+                             description);
+  }
+
+  std::shared_ptr<IPager> enable_pager() override {
+    return m_console->enable_pager();
+  }
+
+  void enable_global_pager() override { m_console->enable_global_pager(); }
+
+  void disable_global_pager() override { m_console->disable_global_pager(); }
+
+  bool is_global_pager_enabled() const override {
+    return m_console->is_global_pager_enabled();
+  }
+
+  void add_print_handler(shcore::Interpreter_print_handler *handler) override {
+    m_console->add_print_handler(handler);
+  }
+
+  void remove_print_handler(
+      shcore::Interpreter_print_handler *handler) override {
+    m_console->remove_print_handler(handler);
+  }
+
+ private:
+  std::string get_text(const std::string &text) const {
+    return m_prefix + ' ' + text;
+  }
+
+  std::string m_prefix;
+  std::shared_ptr<IConsole> m_console;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_CONSOLE_WITH_PREFIX_H_
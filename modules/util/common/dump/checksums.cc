@@ -23,10 +23,12 @@
 
 #include "modules/util/common/dump/checksums.h"
 
+#include <openssl/evp.h>
 #include <rapidjson/error/en.h>
 #include <rapidjson/reader.h>
 #include <rapidjson/stream.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
 #include <functional>
@@ -49,7 +51,11 @@ namespace common {
 
 namespace {
 
-const mysqlshdk::utils::Version k_current_version{1, 0, 0};
+const mysqlshdk::utils::Version k_current_version{1, 1, 0};
+
+// version written if the streaming algorithm is not used, so that such files
+// can still be read by the older versions
+const mysqlshdk::utils::Version k_bit_xor_version{1, 0, 0};
 
 inline std::string quote(std::string_view object) {
   return shcore::quote_identifier(object);
@@ -63,6 +69,9 @@ std::string to_string(Checksums::Algorithm algorithm) {
   switch (algorithm) {
     case Checksums::Algorithm::BIT_XOR:
       return "bit_xor";
+
+    case Checksums::Algorithm::STREAMING:
+      return "streaming";
   }
 
   throw std::logic_error("to_string(Algorithm)");
@@ -71,6 +80,36 @@ std::string to_string(Checksums::Algorithm algorithm) {
 std::optional<Checksums::Algorithm> to_algorithm(std::string_view value) {
   if (shcore::str_caseeq(value, "bit_xor")) {
     return Checksums::Algorithm::BIT_XOR;
+  } else if (shcore::str_caseeq(value, "streaming")) {
+    return Checksums::Algorithm::STREAMING;
+  } else {
+    return {};
+  }
+}
+
+std::string to_string(Checksums::Binary_encoding encoding) {
+  switch (encoding) {
+    case Checksums::Binary_encoding::NONE:
+      return "none";
+
+    case Checksums::Binary_encoding::BASE64:
+      return "base64";
+
+    case Checksums::Binary_encoding::HEX:
+      return "hex";
+  }
+
+  throw std::logic_error("to_string(Binary_encoding)");
+}
+
+std::optional<Checksums::Binary_encoding> to_binary_encoding(
+    std::string_view value) {
+  if (shcore::str_caseeq(value, "none")) {
+    return Checksums::Binary_encoding::NONE;
+  } else if (shcore::str_caseeq(value, "base64")) {
+    return Checksums::Binary_encoding::BASE64;
+  } else if (shcore::str_caseeq(value, "hex")) {
+    return Checksums::Binary_encoding::HEX;
   } else {
     return {};
   }
@@ -120,8 +159,148 @@ int bits(Checksums::Hash hash) {
   throw std::logic_error("bits(Hash)");
 }
 
+const EVP_MD *digest(Checksums::Hash hash) {
+  switch (hash) {
+    case Checksums::Hash::SHA_224:
+      return EVP_sha224();
+    case Checksums::Hash::SHA_256:
+      return EVP_sha256();
+    case Checksums::Hash::SHA_384:
+      return EVP_sha384();
+    case Checksums::Hash::SHA_512:
+      return EVP_sha512();
+  }
+
+  throw std::logic_error("digest(Hash)");
+}
+
+std::string to_hex(const std::string &binary) {
+  constexpr std::string_view k_digits = "0123456789ABCDEF";
+  std::string hex;
+  hex.reserve(2 * binary.length());
+
+  for (const auto c : binary) {
+    const auto byte = static_cast<unsigned char>(c);
+    hex += k_digits[byte >> 4];
+    hex += k_digits[byte & 0xF];
+  }
+
+  return hex;
+}
+
+std::string from_hex(const std::string &hex) {
+  const auto digit = [](char c) -> int {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    throw std::runtime_error("Invalid hexadecimal checksum");
+  };
+
+  if (hex.length() % 2) {
+    throw std::runtime_error("Invalid length of a hexadecimal checksum");
+  }
+
+  std::string binary;
+  binary.reserve(hex.length() / 2);
+
+  for (std::size_t i = 0; i < hex.length(); i += 2) {
+    binary += static_cast<char>(digit(hex[i]) << 4 | digit(hex[i + 1]));
+  }
+
+  return binary;
+}
+
 }  // namespace
 
+class Checksums::Row_hasher::Context final {
+ public:
+  explicit Context(Hash hash) : m_md(digest(hash)), m_ctx(EVP_MD_CTX_new()) {
+    if (!m_ctx) {
+      throw std::runtime_error("Failed to create a digest context");
+    }
+  }
+
+  Context(const Context &) = delete;
+  Context(Context &&) = delete;
+
+  Context &operator=(const Context &) = delete;
+  Context &operator=(Context &&) = delete;
+
+  ~Context() { EVP_MD_CTX_free(m_ctx); }
+
+  inline std::size_t size() const { return EVP_MD_size(m_md); }
+
+  void hash(const std::string &data, unsigned char *out) {
+    if (1 != EVP_DigestInit_ex(m_ctx, m_md, nullptr) ||
+        1 != EVP_DigestUpdate(m_ctx, data.data(), data.length()) ||
+        1 != EVP_DigestFinal_ex(m_ctx, out, nullptr)) {
+      throw std::runtime_error("Failed to compute hash of a row");
+    }
+  }
+
+ private:
+  const EVP_MD *m_md;
+  EVP_MD_CTX *m_ctx;
+};
+
+Checksums::Row_hasher::Row_hasher(Hash hash)
+    : m_context(std::make_unique<Context>(hash)) {
+  m_digest.resize(m_context->size(), '\0');
+}
+
+Checksums::Row_hasher::Row_hasher(Row_hasher &&) = default;
+
+Checksums::Row_hasher &Checksums::Row_hasher::operator=(Row_hasher &&) =
+    default;
+
+Checksums::Row_hasher::~Row_hasher() = default;
+
+void Checksums::Row_hasher::add_null() {
+  // NULL values are distinguished from empty strings
+  m_row += '\0';
+}
+
+void Checksums::Row_hasher::add_field(const char *data, std::size_t length) {
+  // length is stored to detect mismatches like ('ab', 'c') vs ('a', 'bc')
+  const uint64_t l = length;
+
+  m_row += '\1';
+  m_row.append(reinterpret_cast<const char *>(&l), sizeof(l));
+  m_row.append(data, length);
+}
+
+void Checksums::Row_hasher::end_row() {
+  unsigned char hash[EVP_MAX_MD_SIZE];
+  m_context->hash(m_row, hash);
+
+  for (std::size_t i = 0, size = m_digest.length(); i < size; ++i) {
+    m_digest[i] ^= static_cast<char>(hash[i]);
+  }
+
+  m_row.clear();
+  ++m_count;
+}
+
+void Checksums::Row_hasher::add_row(const mysqlshdk::db::IRow *row) {
+  const char *data;
+  std::size_t length;
+
+  for (uint32_t i = 0, size = row->num_fields(); i < size; ++i) {
+    if (row->is_null(i)) {
+      add_null();
+    } else {
+      row->get_raw_data(i, &data, &length);
+      add_field(data, length);
+    }
+  }
+
+  end_row();
+}
+
+Checksums::Checksum_result Checksums::Row_hasher::result() const {
+  return {to_hex(m_digest), m_count};
+}
+
 Checksums::Checksum_data::Checksum_data(const Checksums *parent,
                                         const Table_info *info,
                                         std::string_view partition,
@@ -161,6 +340,31 @@ std::pair<bool, Checksums::Checksum_result> Checksums::Checksum_data::validate(
   return {valid, std::move(result)};
 }
 
+void Checksums::Checksum_data::update(const Row_hasher &hasher) {
+  assert(Algorithm::STREAMING == m_parent->m_algorithm);
+
+  auto result = hasher.result();
+
+  if (!m_result.checksum.empty()) {
+    auto current = from_hex(m_result.checksum);
+    const auto other = from_hex(result.checksum);
+
+    assert(current.length() == other.length());
+
+    for (std::size_t i = 0, size = current.length(); i < size; ++i) {
+      current[i] ^= other[i];
+    }
+
+    result.checksum = to_hex(current);
+    result.count += m_result.count;
+  }
+
+  m_result = std::move(result);
+
+  log_debug("Checksum of %s: %s (%" PRIu64 " rows)", m_id.c_str(),
+            m_result.checksum.c_str(), m_result.count);
+}
+
 Checksums::Checksum_result Checksums::Checksum_data::compute_checksum(
     const std::shared_ptr<mysqlshdk::db::ISession> &session,
     const std::string &query_comment) const {
@@ -194,7 +398,9 @@ Checksums::Checksum_result Checksums::Checksum_data::compute_checksum(
   const auto q = query() + query_comment;
   Checksum_result r;
 
-  if (const auto result = session->query(q)) {
+  if (Algorithm::STREAMING == m_parent->m_algorithm) {
+    r = compute_streaming_checksum(session, q);
+  } else if (const auto result = session->query(q)) {
     if (const auto row = result->fetch_one()) {
       r.count = row->get_uint(0);
       r.checksum = shcore::str_upper(row->get_string(1));
@@ -212,11 +418,28 @@ Checksums::Checksum_result Checksums::Checksum_data::compute_checksum(
   }
 }
 
+Checksums::Checksum_result
+Checksums::Checksum_data::compute_streaming_checksum(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    const std::string &query) const {
+  Row_hasher hasher{m_parent->m_hash};
+  const auto result = session->query(query);
+
+  while (const auto row = result->fetch_one()) {
+    hasher.add_row(row);
+  }
+
+  return hasher.result();
+}
+
 std::string Checksums::Checksum_data::query() const {
   std::string q;
   q.reserve(256);
 
-  q += "SELECT count(*),";
+  // streaming algorithm reads the rows and computes the checksum on the client
+  // side
+  q += Algorithm::STREAMING == m_parent->m_algorithm ? "SELECT "
+                                                      : "SELECT count(*),";
   q += m_info->query.select_expr;
   q += " FROM ";
   q += m_info->query.from;
@@ -260,7 +483,9 @@ void Checksums::configure(
   m_generator_template =
       "sha2(concat_ws('#',{})," + std::to_string(bits(m_hash)) + ')';
 
-  if (Schema_dumper(session).server_version().is_8_0) {
+  if (Algorithm::STREAMING == m_algorithm) {
+    // rows are hashed on the client side, no need to prepare the query
+  } else if (Schema_dumper(session).server_version().is_8_0) {
     m_select_expr_template = "hex(bit_xor(unhex({})))";
   } else {
     // versions older than 8.0 can only use 64bit unsigned integers in bit_xor()
@@ -378,6 +603,11 @@ void Checksums::initialize_table(const std::string &schema,
     if (column->nullable) {
       ti.null_columns.emplace_back(column->name);
     }
+
+    if (Algorithm::STREAMING == m_algorithm &&
+        Binary_encoding::NONE != m_binary_encoding && column->csv_unsafe) {
+      ti.encoded_columns.emplace_back(column->name);
+    }
   }
 
   initialize(&ti);
@@ -480,11 +710,19 @@ void Checksums::serialize(
   json.append("config");  // -> State::CONFIG_START
   json.start_object();    // -> State::CONFIG
   // -> State::STRING_CONVERSION -> State::CONFIG
-  json.append("version", k_current_version.get_full());
+  json.append("version", (Algorithm::STREAMING == m_algorithm
+                              ? k_current_version
+                              : k_bit_xor_version)
+                             .get_full());
   // -> State::STRING_CONVERSION -> State::CONFIG
   json.append("algorithm", to_string(m_algorithm));
   // -> State::STRING_CONVERSION -> State::CONFIG
   json.append("hash", to_string(m_hash));
+
+  if (Algorithm::STREAMING == m_algorithm) {
+    // -> State::STRING_CONVERSION -> State::CONFIG
+    json.append("binaryEncoding", to_string(m_binary_encoding));
+  }
   json.end_object();  // -> State::GLOBAL
 
   json.append("data");  // -> State::DATA_START
@@ -536,6 +774,17 @@ void Checksums::serialize(
         json.end_array();  // -> State::TABLE
       }
 
+      if (!table.second.encoded_columns.empty()) {
+        json.append("encodedColumns");  // -> State::ENCODED_COLUMNS_START
+        json.start_array();             // -> State::ARRAY
+
+        for (const auto &column : table.second.encoded_columns) {
+          json.append(column);  // -> State::ARRAY
+        }
+
+        json.end_array();  // -> State::TABLE
+      }
+
       json.append("partitions");  // -> State::PARTITIONS
       json.start_object();        // -> State::PARTITION_NAME
 
@@ -780,6 +1029,22 @@ void Checksums::deserialize(std::unique_ptr<mysqlshdk::storage::IFile> file) {
                   msg += value;
                   return msg;
                 });
+          } else if ("binaryEncoding" == key) {
+            return expect_string_conversion(
+                [this](std::string_view value) {
+                  if (const auto converted = to_binary_encoding(value);
+                      converted.has_value()) {
+                    m_parent->m_binary_encoding = *converted;
+                    return true;
+                  } else {
+                    return false;
+                  }
+                },
+                [](std::string_view value) {
+                  std::string msg = "Unsupported binary encoding: ";
+                  msg += value;
+                  return msg;
+                });
           } else {
             break;
           }
@@ -813,6 +1078,9 @@ void Checksums::deserialize(std::unique_ptr<mysqlshdk::storage::IFile> file) {
           } else if ("nullColumns" == key) {
             m_state = State::NULL_COLUMNS_START;
             return true;
+          } else if ("encodedColumns" == key) {
+            m_state = State::ENCODED_COLUMNS_START;
+            return true;
           } else if ("partitions" == key) {
             m_state = State::PARTITIONS;
             return true;
@@ -921,6 +1189,9 @@ void Checksums::deserialize(std::unique_ptr<mysqlshdk::storage::IFile> file) {
         case State::NULL_COLUMNS_START:
           return expect_array(&m_current_table->null_columns, State::TABLE);
 
+        case State::ENCODED_COLUMNS_START:
+          return expect_array(&m_current_table->encoded_columns, State::TABLE);
+
         default:
           m_error = "Unexpected start of an array";
           return false;
@@ -959,6 +1230,7 @@ void Checksums::deserialize(std::unique_ptr<mysqlshdk::storage::IFile> file) {
       COLUMNS_START,
       INDEX_COLUMNS_START,
       NULL_COLUMNS_START,
+      ENCODED_COLUMNS_START,
       PARTITIONS,
       PARTITION_NAME,
       PARTITION_START,
@@ -1043,6 +1315,30 @@ void Checksums::deserialize(std::unique_ptr<mysqlshdk::storage::IFile> file) {
 }
 
 void Checksums::initialize(Table_info *info) const {
+  info->query.from = quote(info->schema, info->table);
+
+  if (Algorithm::STREAMING == m_algorithm) {
+    // columns are selected in the same way as when data is dumped, order of
+    // rows does not matter
+    const auto encoding = Binary_encoding::BASE64 == m_binary_encoding
+                              ? "TO_BASE64("
+                              : "HEX(";
+
+    info->query.select_expr = shcore::str_join(
+        info->columns, ",", [info, encoding](const auto &column) {
+          const auto &encoded = info->encoded_columns;
+
+          if (std::find(encoded.begin(), encoded.end(), column) !=
+              encoded.end()) {
+            return encoding + quote(column) + ")";
+          } else {
+            return quote(column);
+          }
+        });
+
+    return;
+  }
+
   std::vector<std::string> values;
 
   values.reserve(info->columns.size() + (info->null_columns.empty() ? 0 : 1));
@@ -1064,7 +1360,6 @@ void Checksums::initialize(Table_info *info) const {
   }
 
   info->query.select_expr = select_expr(values);
-  info->query.from = quote(info->schema, info->table);
   info->query.order_by = shcore::str_join(
       info->index_columns, ",", [](const auto &c) { return quote(c); });
 }
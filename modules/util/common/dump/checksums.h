@@ -24,6 +24,7 @@
 #ifndef MODULES_UTIL_COMMON_DUMP_CHECKSUMS_H_
 #define MODULES_UTIL_COMMON_DUMP_CHECKSUMS_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -53,6 +54,8 @@ class Checksums {
  public:
   enum class Algorithm {
     BIT_XOR,
+    // rows are hashed on the client side, while they are being read
+    STREAMING,
   };
 
   enum class Hash {
@@ -62,6 +65,16 @@ class Checksums {
     SHA_512,
   };
 
+  /**
+   * Encoding of the binary columns, used by the STREAMING algorithm, needs to
+   * match the encoding used when data is dumped.
+   */
+  enum class Binary_encoding {
+    NONE,
+    BASE64,
+    HEX,
+  };
+
   /**
    * Holds result of a checksum operation.
    */
@@ -72,6 +85,59 @@ class Checksums {
     bool operator==(const Checksum_result &) const = default;
   };
 
+  /**
+   * Computes checksum of rows on the client side, rows can be added in any
+   * order. Used by the STREAMING algorithm.
+   */
+  class Row_hasher final {
+   public:
+    Row_hasher() = delete;
+
+    explicit Row_hasher(Hash hash);
+
+    Row_hasher(const Row_hasher &) = delete;
+    Row_hasher(Row_hasher &&);
+
+    Row_hasher &operator=(const Row_hasher &) = delete;
+    Row_hasher &operator=(Row_hasher &&);
+
+    ~Row_hasher();
+
+    /**
+     * Adds a NULL value to the current row.
+     */
+    void add_null();
+
+    /**
+     * Adds a value to the current row.
+     */
+    void add_field(const char *data, std::size_t length);
+
+    /**
+     * Finishes the current row, its hash is combined with hashes of all the
+     * other rows.
+     */
+    void end_row();
+
+    /**
+     * Adds all values of the given row and finishes it.
+     */
+    void add_row(const mysqlshdk::db::IRow *row);
+
+    /**
+     * Provides checksum of all the rows added so far.
+     */
+    Checksum_result result() const;
+
+   private:
+    class Context;
+
+    std::unique_ptr<Context> m_context;
+    std::string m_row;
+    std::string m_digest;
+    uint64_t m_count = 0;
+  };
+
   /**
    * Holds information about a checksum.
    */
@@ -108,6 +174,14 @@ class Checksums {
         const std::shared_ptr<mysqlshdk::db::ISession> &session,
         const std::string &query_comment) const;
 
+    /**
+     * Combines checksum computed by the given hasher with the current
+     * checksum. Used by the STREAMING algorithm.
+     *
+     * @param hasher - Hasher which was fed the rows of this table data.
+     */
+    void update(const Row_hasher &hasher);
+
     inline std::string_view schema() const noexcept { return m_info->schema; }
 
     inline std::string_view table() const noexcept { return m_info->table; }
@@ -128,6 +202,10 @@ class Checksums {
         const std::shared_ptr<mysqlshdk::db::ISession> &session,
         const std::string &query_comment) const;
 
+    Checksum_result compute_streaming_checksum(
+        const std::shared_ptr<mysqlshdk::db::ISession> &session,
+        const std::string &query) const;
+
     std::string query() const;
 
     friend class Checksums;
@@ -153,6 +231,18 @@ class Checksums {
   Checksums &operator=(const Checksums &) = default;
   Checksums &operator=(Checksums &&) = default;
 
+  inline Hash hash() const noexcept { return m_hash; }
+
+  inline Algorithm algorithm() const noexcept { return m_algorithm; }
+
+  /**
+   * Sets encoding of binary columns, needs to be called before any tables are
+   * initialized.
+   */
+  void set_binary_encoding(Binary_encoding encoding) {
+    m_binary_encoding = encoding;
+  }
+
   /**
    * Configures checksum for interaction with the given MySQL instance.
    */
@@ -262,6 +352,7 @@ class Checksums {
     std::vector<std::string> columns;
     std::vector<std::string> index_columns;
     std::vector<std::string> null_columns;
+    std::vector<std::string> encoded_columns;
 
     Partitions_t partitions;
   };
@@ -269,6 +360,7 @@ class Checksums {
   // read from the file
   Hash m_hash;
   Algorithm m_algorithm;
+  Binary_encoding m_binary_encoding = Binary_encoding::NONE;
   Schemas_t m_schemas;
   mysqlshdk::utils::Version m_version;
 
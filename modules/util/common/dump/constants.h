@@ -25,6 +25,7 @@
 #define MODULES_UTIL_COMMON_DUMP_CONSTANTS_H_
 
 #include <array>
+#include <cstdint>
 
 namespace mysqlsh {
 namespace dump {
@@ -54,6 +55,16 @@ constexpr inline std::array k_mhs_excluded_schemas = {
     "mysql_firewall",
 };
 
+/**
+ * The first entry of an .idx file which holds the checkpoints. Such file
+ * contains (row count, compressed offset, uncompressed offset) triples, each
+ * one marking a row boundary at which data can be decompressed independently.
+ * The last entry is always the total uncompressed size, all values are stored
+ * in the network byte order. Value is not a valid data offset, so it can be
+ * distinguished from the files which contain only the offsets.
+ */
+constexpr inline uint64_t k_index_checkpoints_marker = 0xFFFFFFFF4D534831;
+
 }  // namespace common
 }  // namespace dump
 }  // namespace mysqlsh
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "modules/util/common/dump/session_compression.h"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+#include "mysqlshdk/libs/db/result.h"
+#include "mysqlshdk/libs/db/utils_connection.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+namespace {
+
+using mysqlshdk::db::Connection_options;
+
+// connections with a higher round-trip time are considered to be slow
+constexpr auto k_slow_rtt = std::chrono::milliseconds(2);
+
+// connections with a lower throughput (bytes per second) are considered to be
+// slow
+constexpr double k_slow_throughput = 100.0 * 1024 * 1024;
+
+// size of the payload used to measure the throughput
+constexpr std::size_t k_probe_size = 1024 * 1024;
+
+constexpr int k_rtt_probes = 3;
+
+using Clock = std::chrono::steady_clock;
+
+void clear_compression(Connection_options *options) {
+  if (options->has_compression()) {
+    options->remove(mysqlshdk::db::kCompression);
+  }
+
+  if (options->has_compression_algorithms()) {
+    options->remove(mysqlshdk::db::kCompressionAlgorithms);
+  }
+}
+
+void use_algorithm(const char *algorithm, Connection_options *options) {
+  clear_compression(options);
+  // falls back to uncompressed connection if server does not support the
+  // given algorithm
+  options->set_compression_algorithms(std::string{algorithm} +
+                                      ",uncompressed");
+}
+
+bool is_slow_connection(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session) {
+  auto rtt = Clock::duration::max();
+
+  for (int i = 0; i < k_rtt_probes; ++i) {
+    const auto start = Clock::now();
+    session->query("SELECT 1")->fetch_one();
+    rtt = std::min(rtt, Clock::now() - start);
+  }
+
+  const auto probe = "SELECT REPEAT('x', " + std::to_string(k_probe_size) + ")";
+  const auto start = Clock::now();
+  session->query(probe)->fetch_one();
+  const auto transfer =
+      std::max<Clock::duration>(Clock::now() - start - rtt,
+                                std::chrono::microseconds(1));
+  const auto throughput =
+      k_probe_size / std::chrono::duration<double>(transfer).count();
+
+  log_info("Connection round-trip time: %.3f ms, throughput: %.1f MB/s",
+           std::chrono::duration<double, std::milli>(rtt).count(),
+           throughput / 1000000);
+
+  return rtt >= k_slow_rtt || throughput < k_slow_throughput;
+}
+
+}  // namespace
+
+Session_compression to_session_compression(const std::string &value) {
+  const auto v = shcore::str_lower(value);
+
+  if ("auto" == v) return Session_compression::AUTO;
+  if ("off" == v) return Session_compression::OFF;
+  if ("zstd" == v) return Session_compression::ZSTD;
+  if ("zlib" == v) return Session_compression::ZLIB;
+
+  throw std::invalid_argument(
+      "The value of the 'sessionCompression' option must be set to one of: "
+      "'auto', 'off', 'zstd', 'zlib'.");
+}
+
+std::string to_string(Session_compression compression) {
+  switch (compression) {
+    case Session_compression::AUTO:
+      return "auto";
+
+    case Session_compression::OFF:
+      return "off";
+
+    case Session_compression::ZSTD:
+      return "zstd";
+
+    case Session_compression::ZLIB:
+      return "zlib";
+  }
+
+  throw std::logic_error("Unknown value of Session_compression");
+}
+
+void set_session_compression(
+    Session_compression compression,
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    Connection_options *options) {
+  switch (compression) {
+    case Session_compression::AUTO:
+      if (options->has_compression() || options->has_compression_algorithms()) {
+        // user has decided
+        return;
+      }
+
+      if (options->has_transport_type() &&
+          mysqlshdk::db::Transport_type::Tcp != options->get_transport_type()) {
+        // local connection
+        return;
+      }
+
+      try {
+        if (!is_slow_connection(session)) {
+          return;
+        }
+      } catch (const std::exception &e) {
+        log_warning("Failed to measure the connection: %s", e.what());
+        return;
+      }
+
+      log_info("Enabling zstd compression of the worker sessions");
+      use_algorithm("zstd", options);
+      break;
+
+    case Session_compression::OFF:
+      clear_compression(options);
+      options->clear_compression_level();
+      break;
+
+    case Session_compression::ZSTD:
+      use_algorithm("zstd", options);
+      break;
+
+    case Session_compression::ZLIB:
+      use_algorithm("zlib", options);
+      break;
+  }
+}
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#ifndef MODULES_UTIL_COMMON_DUMP_SESSION_COMPRESSION_H_
+#define MODULES_UTIL_COMMON_DUMP_SESSION_COMPRESSION_H_
+
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/session.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+/**
+ * Protocol compression of the worker sessions.
+ */
+enum class Session_compression {
+  // compression is enabled if the network is slow, unless it was explicitly
+  // configured by the user
+  AUTO,
+  OFF,
+  ZSTD,
+  ZLIB,
+};
+
+/**
+ * Converts value of the 'sessionCompression' option.
+ *
+ * @throws std::invalid_argument if value is not valid
+ */
+Session_compression to_session_compression(const std::string &value);
+
+std::string to_string(Session_compression compression);
+
+/**
+ * Modifies the connection options of the worker sessions, so that they use
+ * the given compression.
+ *
+ * In case of Session_compression::AUTO, round-trip time and throughput of the
+ * given session are measured, compression is enabled if the connection is
+ * slow.
+ *
+ * @param compression Requested compression.
+ * @param session Session used to measure the connection.
+ * @param options Connection options to be modified.
+ */
+void set_session_compression(
+    Session_compression compression,
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    mysqlshdk::db::Connection_options *options);
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_DUMP_SESSION_COMPRESSION_H_
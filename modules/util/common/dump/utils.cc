@@ -23,12 +23,15 @@
 
 #include "modules/util/common/dump/utils.h"
 
+#include <charconv>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "modules/util/dump/dump_manifest_config.h"
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/storage/backend/oci_par_directory_config.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlsh {
@@ -128,6 +131,165 @@ std::string get_table_data_filename(const std::string &basename,
          std::to_string(index) + "." + ext;
 }
 
+std::string get_compression_dictionary_filename(const std::string &basename) {
+  return basename + ".zdict";
+}
+
+std::string get_tablespace_basename(const std::string &basename,
+                                    size_t index) {
+  return basename + k_separator + k_separator + std::to_string(index);
+}
+
+std::string encode_server_filename(const std::string &name) {
+  std::string result;
+  result.reserve(name.length());
+
+  for (const auto c : name) {
+    const auto u = static_cast<unsigned char>(c);
+
+    if (u >= 0x80) {
+      throw std::invalid_argument("Name '" + name +
+                                  "' contains non-ASCII characters.");
+    }
+
+    if ((u >= '0' && u <= '9') || (u >= 'a' && u <= 'z') ||
+        (u >= 'A' && u <= 'Z') || '_' == u) {
+      result += c;
+    } else {
+      // remaining ASCII characters are stored as @ followed by four hex digits
+      result += shcore::str_format("@%04x", u);
+    }
+  }
+
+  return result;
+}
+
+std::string get_metadata_index_filename() { return "@.metadata.ndjson"; }
+
+std::string metadata_index_entry(const std::string &filename,
+                                 const std::string &contents) {
+  // file names are encoded, they never contain characters which would have to
+  // be escaped
+  std::string entry;
+  entry.reserve(filename.length() + contents.length() + 6);
+
+  entry += "[\"";
+  entry += filename;
+  entry += "\",";
+  entry += contents;
+  entry += "]\n";
+
+  return entry;
+}
+
+std::unordered_map<std::string, std::string_view> parse_metadata_index(
+    std::string_view index) {
+  std::unordered_map<std::string, std::string_view> result;
+  std::size_t line_number = 0;
+
+  while (!index.empty()) {
+    const auto eol = index.find('\n');
+    const auto line = index.substr(0, eol);
+
+    index.remove_prefix(std::string_view::npos == eol ? index.size() : eol + 1);
+    ++line_number;
+
+    if (line.empty()) {
+      continue;
+    }
+
+    const auto name_end = line.find('"', 2);
+
+    if (!line.starts_with("[\"") || !line.ends_with(']') ||
+        std::string_view::npos == name_end || name_end + 3 >= line.length() ||
+        ',' != line[name_end + 1]) {
+      throw std::runtime_error("Malformed entry in line " +
+                               std::to_string(line_number) +
+                               " of the metadata index");
+    }
+
+    result.emplace(line.substr(2, name_end - 2),
+                   line.substr(name_end + 2, line.length() - name_end - 3));
+  }
+
+  return result;
+}
+
+std::string get_journal_segment_filename(uint64_t segment) {
+  return "@.journal." + std::to_string(segment) + ".ndjson";
+}
+
+uint64_t get_journal_segment(std::string_view filename) {
+  static constexpr std::string_view k_prefix = "@.journal.";
+  static constexpr std::string_view k_suffix = ".ndjson";
+
+  if (!filename.starts_with(k_prefix) || !filename.ends_with(k_suffix)) {
+    return 0;
+  }
+
+  filename.remove_prefix(k_prefix.length());
+  filename.remove_suffix(k_suffix.length());
+
+  uint64_t segment = 0;
+  const auto end = filename.data() + filename.length();
+
+  if (const auto [ptr, ec] = std::from_chars(filename.data(), end, segment);
+      std::errc{} != ec || end != ptr) {
+    return 0;
+  }
+
+  return segment;
+}
+
+std::string journal_entry(const std::string &filename, std::size_t size) {
+  // file names are encoded, they never contain characters which would have to
+  // be escaped
+  return "[\"" + filename + "\"," + std::to_string(size) + "]\n";
+}
+
+std::vector<std::pair<std::string, std::size_t>> parse_journal_segment(
+    std::string_view segment) {
+  std::vector<std::pair<std::string, std::size_t>> result;
+  std::size_t line_number = 0;
+
+  while (!segment.empty()) {
+    const auto eol = segment.find('\n');
+    const auto line = segment.substr(0, eol);
+
+    segment.remove_prefix(std::string_view::npos == eol ? segment.size()
+                                                        : eol + 1);
+    ++line_number;
+
+    if (line.empty()) {
+      continue;
+    }
+
+    const auto name_end = line.find('"', 2);
+    std::size_t size = 0;
+    bool valid = line.starts_with("[\"") && line.ends_with(']') &&
+                 std::string_view::npos != name_end &&
+                 name_end + 3 < line.length() && ',' == line[name_end + 1];
+
+    if (valid) {
+      const auto begin = line.data() + name_end + 2;
+      const auto end = line.data() + line.length() - 1;
+      const auto [ptr, ec] = std::from_chars(begin, end, size);
+
+      valid = std::errc{} == ec && end == ptr;
+    }
+
+    if (!valid) {
+      throw std::runtime_error("Malformed entry in line " +
+                               std::to_string(line_number) +
+                               " of the journal segment");
+    }
+
+    result.emplace_back(line.substr(2, name_end - 2), size);
+  }
+
+  return result;
+}
+
 void parse_schema_and_object(const std::string &str, const std::string &context,
                              const std::string &object_type,
                              std::string *out_schema, std::string *out_table) {
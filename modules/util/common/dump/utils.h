@@ -24,8 +24,12 @@
 #ifndef MODULES_UTIL_COMMON_DUMP_UTILS_H_
 #define MODULES_UTIL_COMMON_DUMP_UTILS_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "mysqlshdk/libs/oci/oci_par.h"
@@ -61,6 +65,74 @@ std::string get_table_data_filename(const std::string &basename,
                                     const std::string &ext, size_t index,
                                     bool last_chunk);
 
+std::string get_compression_dictionary_filename(const std::string &basename);
+
+/**
+ * Basename of the files which hold a copy of a tablespace file of a table, used
+ * by the physical dumps.
+ *
+ * @param basename Basename of the table.
+ * @param index Ordinal number of the tablespace file.
+ */
+std::string get_tablespace_basename(const std::string &basename, size_t index);
+
+/**
+ * Encodes the name of a schema or a table the same way the server does when
+ * naming the files in its data directory. Only ASCII names are supported.
+ *
+ * @throws std::invalid_argument If name contains non-ASCII characters.
+ */
+std::string encode_server_filename(const std::string &name);
+
+// Metadata index holds copies of all schema and table metadata files, one line
+// per file: ["<file name>",<compact JSON contents>]
+
+std::string get_metadata_index_filename();
+
+std::string metadata_index_entry(const std::string &filename,
+                                 const std::string &contents);
+
+/**
+ * Splits the metadata index into entries, contents of the files are not
+ * parsed.
+ *
+ * @param index Contents of the metadata index, needs to outlive the result.
+ *
+ * @returns file name -> contents of the file
+ *
+ * @throws std::runtime_error if index is malformed
+ */
+std::unordered_map<std::string, std::string_view> parse_metadata_index(
+    std::string_view index);
+
+// Journal lists the files of a dump in the order in which they were
+// completely written. It is split into numbered segments (starting with 1),
+// which are never modified once written, one line per file:
+// ["<file name>",<file size>]
+
+std::string get_journal_segment_filename(uint64_t segment);
+
+/**
+ * Extracts the number of the journal segment from its file name.
+ *
+ * @returns Number of the segment, 0 if this is not a journal segment.
+ */
+uint64_t get_journal_segment(std::string_view filename);
+
+std::string journal_entry(const std::string &filename, std::size_t size);
+
+/**
+ * Splits the journal segment into entries.
+ *
+ * @param segment Contents of the journal segment.
+ *
+ * @returns file name and file size, in the order in which they were written
+ *
+ * @throws std::runtime_error if segment is malformed
+ */
+std::vector<std::pair<std::string, std::size_t>> parse_journal_segment(
+    std::string_view segment);
+
 void parse_schema_and_object(const std::string &str, const std::string &context,
                              const std::string &object_type,
                              std::string *out_schema, std::string *out_table);
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/common/parquet/compression.h"
+
+#include <lz4.h>
+
+#include <cstring>
+#include <utility>
+
+#include "modules/util/common/parquet/format.h"
+#include "modules/util/common/parquet/utils.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+namespace mysqlsh {
+namespace parquet {
+
+namespace {
+
+/**
+ * Decompresses the data using the LZ4 block format.
+ */
+void lz4_raw_decompress(const char *data, std::size_t length,
+                        std::size_t uncompressed_length, std::string *out) {
+  out->resize(uncompressed_length);
+
+  const auto result =
+      LZ4_decompress_safe(data, &(*out)[0], static_cast<int>(length),
+                          static_cast<int>(uncompressed_length));
+
+  if (result < 0 || static_cast<std::size_t>(result) != uncompressed_length) {
+    corrupted("page: LZ4 decompression failed");
+  }
+}
+
+/**
+ * Decompresses the data using the deprecated LZ4 codec, which was written
+ * either using the Hadoop framing or the LZ4 block format.
+ */
+void lz4_decompress(const char *data, std::size_t length,
+                    std::size_t uncompressed_length, std::string *out) {
+  // Hadoop framing: big-endian uncompressed and compressed sizes, followed by
+  // an LZ4 block, repeated
+  std::string result;
+  std::string block;
+  std::size_t offset = 0;
+
+  while (length - offset >= 8) {
+    const auto block_uncompressed = read_be32(data + offset);
+    const auto block_compressed = read_be32(data + offset + 4);
+    offset += 8;
+
+    if (block_compressed > length - offset ||
+        result.size() + block_uncompressed > uncompressed_length) {
+      break;
+    }
+
+    block.resize(block_uncompressed);
+
+    if (static_cast<int>(block_uncompressed) !=
+        LZ4_decompress_safe(data + offset, &block[0],
+                            static_cast<int>(block_compressed),
+                            static_cast<int>(block_uncompressed))) {
+      break;
+    }
+
+    result.append(block);
+    offset += block_compressed;
+
+    if (offset == length && result.size() == uncompressed_length) {
+      *out = std::move(result);
+      return;
+    }
+  }
+
+  lz4_raw_decompress(data, length, uncompressed_length, out);
+}
+
+/**
+ * Decompresses the data using the Snappy format.
+ */
+void snappy_decompress(const char *data, std::size_t length,
+                       std::size_t uncompressed_length, std::string *out) {
+  Byte_reader in{data, length};
+
+  if (in.uleb128() != uncompressed_length) {
+    corrupted("page: Snappy length mismatch");
+  }
+
+  out->resize(uncompressed_length);
+
+  auto dst = &(*out)[0];
+  std::size_t written = 0;
+
+  while (in.remaining() > 0) {
+    const auto tag = in.byte();
+    std::size_t size;
+    std::size_t offset = 0;
+
+    switch (tag & 0x03) {
+      case 0: {
+        // literal
+        size = tag >> 2;
+
+        if (size >= 60) {
+          size = in.le(static_cast<int>(size - 59));
+        }
+
+        ++size;
+
+        if (size > uncompressed_length - written) {
+          corrupted("page: Snappy literal is too long");
+        }
+
+        ::memcpy(dst + written, in.bytes(size).data(), size);
+        written += size;
+        continue;
+      }
+
+      case 1:
+        size = ((tag >> 2) & 0x07) + 4;
+        offset = (static_cast<std::size_t>(tag >> 5) << 8) | in.byte();
+        break;
+
+      case 2:
+        size = (tag >> 2) + 1;
+        offset = in.le(2);
+        break;
+
+      default:
+        size = (tag >> 2) + 1;
+        offset = in.le(4);
+        break;
+    }
+
+    if (0 == offset || offset > written ||
+        size > uncompressed_length - written) {
+      corrupted("page: invalid Snappy copy");
+    }
+
+    // regions may overlap
+    for (auto src = dst + written - offset; size > 0; --size) {
+      dst[written++] = *src++;
+    }
+  }
+
+  if (written != uncompressed_length) {
+    corrupted("page: Snappy length mismatch");
+  }
+}
+
+}  // namespace
+
+void decompress(int32_t codec, std::string_view data,
+                std::size_t uncompressed_length, std::string *out) {
+  switch (codec) {
+    case UNCOMPRESSED:
+      out->assign(data);
+      return;
+
+    case SNAPPY:
+      snappy_decompress(data.data(), data.length(), uncompressed_length, out);
+      return;
+
+    case GZIP:
+      mysqlshdk::storage::decompress(mysqlshdk::storage::Compression::GZIP,
+                                     data.data(), data.length(),
+                                     uncompressed_length, out);
+      return;
+
+    case LZ4:
+      lz4_decompress(data.data(), data.length(), uncompressed_length, out);
+      return;
+
+    case ZSTD:
+      mysqlshdk::storage::decompress(mysqlshdk::storage::Compression::ZSTD,
+                                     data.data(), data.length(),
+                                     uncompressed_length, out);
+      return;
+
+    case LZ4_RAW:
+      lz4_raw_decompress(data.data(), data.length(), uncompressed_length, out);
+      return;
+  }
+
+  unsupported("Compression codec " + std::to_string(codec));
+}
+
+}  // namespace parquet
+}  // namespace mysqlsh
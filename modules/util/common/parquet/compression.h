@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMMON_PARQUET_COMPRESSION_H_
+#define MODULES_UTIL_COMMON_PARQUET_COMPRESSION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace mysqlsh {
+namespace parquet {
+
+/**
+ * Decompresses a page compressed using the given Parquet codec.
+ *
+ * @param codec Compression codec (parquet::Compression_codec).
+ * @param data Compressed data.
+ * @param uncompressed_length Expected length of the decompressed data.
+ * @param out Receives the decompressed data.
+ *
+ * @throws std::runtime_error if data cannot be decompressed, its length does
+ *         not match the expected one or codec is not supported
+ */
+void decompress(int32_t codec, std::string_view data,
+                std::size_t uncompressed_length, std::string *out);
+
+}  // namespace parquet
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_PARQUET_COMPRESSION_H_
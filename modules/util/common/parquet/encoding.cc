@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/common/parquet/encoding.h"
+
+#include <algorithm>
+
+namespace mysqlsh {
+namespace parquet {
+
+namespace {
+
+bool starts_run(const uint32_t *values, std::size_t idx, std::size_t count) {
+  constexpr std::size_t k_min_run = 8;
+
+  if (idx + k_min_run > count) {
+    return false;
+  }
+
+  for (std::size_t i = idx + 1; i < idx + k_min_run; ++i) {
+    if (values[i] != values[idx]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+uint64_t Bit_reader::read(int width) {
+  uint64_t value = 0;
+
+  for (int shift = 0; shift < width;) {
+    const auto byte = m_bit >> 3;
+    const auto bit = static_cast<int>(m_bit & 0x07);
+    const auto bits = std::min(8 - bit, width - shift);
+    // missing bits of the last group are treated as zeros
+    const uint64_t current = byte < m_length ? m_data[byte] : 0;
+
+    value |= ((current >> bit) & ((1u << bits) - 1)) << shift;
+
+    shift += bits;
+    m_bit += bits;
+  }
+
+  return value;
+}
+
+Rle_decoder::Rle_decoder(const char *data, std::size_t length, int bit_width)
+    : m_in(data, length), m_bit_width(bit_width) {
+  if (bit_width < 0 || bit_width > 32) {
+    corrupted("page: invalid bit width");
+  }
+}
+
+void Rle_decoder::decode(std::size_t count, uint32_t *out) {
+  while (count > 0) {
+    if (0 == m_remaining) {
+      next_run();
+    }
+
+    const auto n = std::min<std::size_t>(count, m_remaining);
+
+    if (m_packed) {
+      for (std::size_t i = 0; i < n; ++i) {
+        out[i] = static_cast<uint32_t>(m_packed->read(m_bit_width));
+      }
+    } else {
+      std::fill_n(out, n, m_value);
+    }
+
+    out += n;
+    count -= n;
+    m_remaining -= n;
+  }
+}
+
+void Rle_decoder::next_run() {
+  if (0 == m_in.remaining()) {
+    corrupted("page: not enough encoded values");
+  }
+
+  const auto header = m_in.uleb128();
+
+  if (header & 1) {
+    const auto groups = header >> 1;
+    const auto bytes =
+        std::min<uint64_t>(groups * m_bit_width, m_in.remaining());
+
+    m_packed.emplace(m_in.current(), bytes);
+    m_in.skip(bytes);
+    m_remaining = groups * 8;
+  } else {
+    m_packed.reset();
+    m_value = static_cast<uint32_t>(m_in.le((m_bit_width + 7) / 8));
+    m_remaining = header >> 1;
+  }
+}
+
+int bit_width(uint32_t max_value) {
+  int width = 0;
+
+  while (max_value) {
+    ++width;
+    max_value >>= 1;
+  }
+
+  return width;
+}
+
+void encode_hybrid(const uint32_t *values, std::size_t count, int width,
+                   std::string *out) {
+  // keeps the header of bit-packed runs in a single byte
+  constexpr std::size_t k_max_groups = 63;
+  const auto byte_width = (width + 7) / 8;
+  std::size_t i = 0;
+
+  while (i < count) {
+    if (starts_run(values, i, count)) {
+      std::size_t run = 8;
+
+      while (i + run < count && values[i + run] == values[i]) {
+        ++run;
+      }
+
+      write_uleb128(run << 1, out);
+      write_le(values[i], byte_width, out);
+
+      i += run;
+    } else {
+      const auto begin = i;
+      std::size_t groups = 0;
+
+      do {
+        // only the very last group can be incomplete
+        i = std::min(i + 8, count);
+        ++groups;
+      } while (i < count && groups < k_max_groups &&
+               !starts_run(values, i, count));
+
+      write_uleb128((groups << 1) | 1, out);
+
+      uint64_t buffer = 0;
+      int bits = 0;
+
+      for (std::size_t v = begin; v < begin + groups * 8; ++v) {
+        buffer |= static_cast<uint64_t>(v < i ? values[v] : 0) << bits;
+        bits += width;
+
+        while (bits >= 8) {
+          out->push_back(static_cast<char>(buffer & 0xFF));
+          buffer >>= 8;
+          bits -= 8;
+        }
+      }
+    }
+  }
+}
+
+std::vector<int64_t> decode_delta_binary_packed(Byte_reader *in,
+                                                std::size_t max_values) {
+  const auto block_size = in->uleb128();
+  const auto miniblocks = in->uleb128();
+  const auto total = in->uleb128();
+  auto last = static_cast<uint64_t>(unzigzag(in->uleb128()));
+
+  if (0 == block_size || 0 == miniblocks || block_size % miniblocks ||
+      (block_size / miniblocks) % 8) {
+    corrupted("page: invalid DELTA_BINARY_PACKED header");
+  }
+
+  if (total > max_values) {
+    corrupted("page: too many encoded values");
+  }
+
+  const auto values_per_miniblock = block_size / miniblocks;
+
+  std::vector<int64_t> values;
+  values.reserve(total);
+
+  if (total > 0) {
+    values.emplace_back(static_cast<int64_t>(last));
+  }
+
+  while (values.size() < total) {
+    const auto min_delta = static_cast<uint64_t>(unzigzag(in->uleb128()));
+    const auto widths = in->bytes(miniblocks);
+
+    for (std::size_t m = 0; m < miniblocks && values.size() < total; ++m) {
+      const auto width = static_cast<uint8_t>(widths[m]);
+
+      if (width > 64) {
+        corrupted("page: invalid bit width");
+      }
+
+      // miniblocks are padded, each one holds the same number of bytes; check
+      // is written this way to avoid an overflow
+      if (width > 0 && values_per_miniblock / 8 > in->remaining() / width) {
+        corrupted("page: unexpected end of DELTA_BINARY_PACKED data");
+      }
+
+      const auto bytes = values_per_miniblock / 8 * width;
+      Bit_reader packed{in->current(), bytes};
+
+      for (uint64_t i = 0; i < values_per_miniblock && values.size() < total;
+           ++i) {
+        // arithmetic wraps around
+        last += min_delta + packed.read(width);
+        values.emplace_back(static_cast<int64_t>(last));
+      }
+
+      in->skip(bytes);
+    }
+  }
+
+  return values;
+}
+
+std::vector<std::string_view> decode_delta_length_byte_array(
+    Byte_reader *in, std::size_t max_values) {
+  const auto lengths = decode_delta_binary_packed(in, max_values);
+  std::vector<std::string_view> values;
+  values.reserve(lengths.size());
+
+  for (const auto length : lengths) {
+    if (length < 0) {
+      corrupted("page: negative length");
+    }
+
+    values.emplace_back(in->bytes(length));
+  }
+
+  return values;
+}
+
+void encode_decimal(const char *data, std::size_t length, std::string *out) {
+  // DECIMAL(65) needs 28 bytes, extra one is for the sign bit
+  uint8_t magnitude[30] = {0};
+  std::size_t used = 0;
+  bool negative = false;
+
+  for (auto end = data + length; data != end; ++data) {
+    if ('-' == *data) {
+      negative = true;
+    } else if (*data >= '0' && *data <= '9') {
+      uint32_t carry = *data - '0';
+
+      for (std::size_t i = 0; i < used; ++i) {
+        const uint32_t v = magnitude[i] * 10 + carry;
+        magnitude[i] = v & 0xFF;
+        carry = v >> 8;
+      }
+
+      if (carry && used < sizeof(magnitude) - 1) {
+        magnitude[used++] = static_cast<uint8_t>(carry);
+      }
+    }
+  }
+
+  // space for the sign bit
+  ++used;
+
+  if (negative) {
+    uint32_t carry = 1;
+
+    for (std::size_t i = 0; i < used; ++i) {
+      const uint32_t v = static_cast<uint8_t>(~magnitude[i]) + carry;
+      magnitude[i] = v & 0xFF;
+      carry = v >> 8;
+    }
+  }
+
+  // remove redundant sign bytes
+  while (used > 1 &&
+         ((0x00 == magnitude[used - 1] && !(magnitude[used - 2] & 0x80)) ||
+          (0xFF == magnitude[used - 1] && (magnitude[used - 2] & 0x80)))) {
+    --used;
+  }
+
+  write_le(used, 4, out);
+
+  for (std::size_t i = used; i > 0; --i) {
+    out->push_back(static_cast<char>(magnitude[i - 1]));
+  }
+}
+
+}  // namespace parquet
+}  // namespace mysqlsh
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMMON_PARQUET_ENCODING_H_
+#define MODULES_UTIL_COMMON_PARQUET_ENCODING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "modules/util/common/parquet/utils.h"
+
+namespace mysqlsh {
+namespace parquet {
+
+/**
+ * Reads bit-packed values, least significant bits first.
+ */
+class Bit_reader final {
+ public:
+  Bit_reader(const char *data, std::size_t length)
+      : m_data(reinterpret_cast<const uint8_t *>(data)), m_length(length) {}
+
+  /**
+   * Reads a value of the given width (up to 64 bits), bits past the end of the
+   * data are read as zeros.
+   */
+  uint64_t read(int width);
+
+ private:
+  const uint8_t *m_data;
+  std::size_t m_length;
+  std::size_t m_bit = 0;
+};
+
+/**
+ * Decodes values written using the RLE/bit-packing hybrid encoding.
+ */
+class Rle_decoder final {
+ public:
+  Rle_decoder(const char *data, std::size_t length, int bit_width);
+
+  /**
+   * Decodes the given number of values.
+   *
+   * @throws std::runtime_error if there are not enough encoded values
+   */
+  void decode(std::size_t count, uint32_t *out);
+
+ private:
+  void next_run();
+
+  Byte_reader m_in;
+  int m_bit_width;
+  uint64_t m_remaining = 0;
+  std::optional<Bit_reader> m_packed;
+  uint32_t m_value = 0;
+};
+
+/**
+ * Number of bits needed to store the given value.
+ */
+int bit_width(uint32_t max_value);
+
+/**
+ * Encodes values using the RLE/bit-packing hybrid encoding. Repeated values are
+ * RLE-encoded, groups of 8 values are bit-packed otherwise.
+ */
+void encode_hybrid(const uint32_t *values, std::size_t count, int width,
+                   std::string *out);
+
+/**
+ * Decodes values written using the DELTA_BINARY_PACKED encoding.
+ *
+ * @param in Encoded data, positioned after the decoded values on return.
+ * @param max_values Maximum number of values expected in the data.
+ *
+ * @throws std::runtime_error if data is corrupted or holds more values than
+ *         expected
+ */
+std::vector<int64_t> decode_delta_binary_packed(Byte_reader *in,
+                                                std::size_t max_values);
+
+/**
+ * Decodes values written using the DELTA_LENGTH_BYTE_ARRAY encoding, returned
+ * values point to the input data.
+ */
+std::vector<std::string_view> decode_delta_length_byte_array(
+    Byte_reader *in, std::size_t max_values);
+
+/**
+ * Converts a decimal number to its unscaled value, stored as a big-endian two's
+ * complement number using minimum number of bytes, prefixed with its 4-byte
+ * little-endian length (plain-encoded BYTE_ARRAY).
+ */
+void encode_decimal(const char *data, std::size_t length, std::string *out);
+
+}  // namespace parquet
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_PARQUET_ENCODING_H_
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMMON_PARQUET_FORMAT_H_
+#define MODULES_UTIL_COMMON_PARQUET_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mysqlsh {
+namespace parquet {
+
+// values defined by the Parquet format specification (parquet.thrift)
+
+enum Type : int32_t {
+  BOOLEAN = 0,
+  INT32 = 1,
+  INT64 = 2,
+  INT96 = 3,
+  FLOAT = 4,
+  DOUBLE = 5,
+  BYTE_ARRAY = 6,
+  FIXED_LEN_BYTE_ARRAY = 7,
+};
+
+enum Converted_type : int32_t {
+  NONE = -1,
+  UTF8 = 0,
+  DECIMAL = 5,
+  DATE = 6,
+  TIME_MILLIS = 7,
+  TIME_MICROS = 8,
+  TIMESTAMP_MILLIS = 9,
+  TIMESTAMP_MICROS = 10,
+  UINT_8 = 11,
+  UINT_16 = 12,
+  UINT_32 = 13,
+  UINT_64 = 14,
+  JSON = 19,
+  INTERVAL = 21,
+};
+
+// IDs of the fields of the LogicalType union
+enum Logical_type : int16_t {
+  LOGICAL_NONE = 0,
+  LOGICAL_DECIMAL = 5,
+  LOGICAL_DATE = 6,
+  LOGICAL_TIME = 7,
+  LOGICAL_TIMESTAMP = 8,
+  LOGICAL_INTEGER = 10,
+  LOGICAL_FLOAT16 = 15,
+};
+
+// IDs of the fields of the TimeUnit union
+enum Time_unit : int16_t {
+  MILLIS = 1,
+  MICROS = 2,
+  NANOS = 3,
+};
+
+enum Field_repetition_type : int32_t {
+  REQUIRED = 0,
+  OPTIONAL = 1,
+  REPEATED = 2,
+};
+
+enum Encoding : int32_t {
+  PLAIN = 0,
+  PLAIN_DICTIONARY = 2,
+  RLE = 3,
+  DELTA_BINARY_PACKED = 5,
+  DELTA_LENGTH_BYTE_ARRAY = 6,
+  DELTA_BYTE_ARRAY = 7,
+  RLE_DICTIONARY = 8,
+  BYTE_STREAM_SPLIT = 9,
+};
+
+enum Compression_codec : int32_t {
+  UNCOMPRESSED = 0,
+  SNAPPY = 1,
+  GZIP = 2,
+  LZ4 = 5,
+  ZSTD = 6,
+  LZ4_RAW = 7,
+};
+
+enum Page_type : int32_t {
+  DATA_PAGE = 0,
+  DICTIONARY_PAGE = 2,
+  DATA_PAGE_V2 = 3,
+};
+
+constexpr char k_magic[] = "PAR1";
+constexpr char k_encrypted_magic[] = "PARE";
+constexpr std::size_t k_magic_length = sizeof(k_magic) - 1;
+
+}  // namespace parquet
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_PARQUET_FORMAT_H_
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/common/parquet/thrift_compact.h"
+
+#include <cassert>
+
+namespace mysqlsh {
+namespace parquet {
+
+void Thrift_compact_reader::begin_struct() {
+  if (m_last_field_ids.size() > k_max_depth) {
+    corrupted("metadata: nesting is too deep");
+  }
+
+  m_last_field_ids.emplace_back(m_last_field_id);
+  m_last_field_id = 0;
+}
+
+void Thrift_compact_reader::end_struct() {
+  m_last_field_id = m_last_field_ids.back();
+  m_last_field_ids.pop_back();
+}
+
+bool Thrift_compact_reader::next_field(int16_t *id, uint8_t *type) {
+  const auto header = m_in.byte();
+
+  if (0 == header) {
+    return false;
+  }
+
+  *type = header & 0x0F;
+
+  if (const auto delta = header >> 4) {
+    m_last_field_id += delta;
+  } else {
+    m_last_field_id = static_cast<int16_t>(unzigzag(m_in.uleb128()));
+  }
+
+  *id = m_last_field_id;
+
+  return true;
+}
+
+int64_t Thrift_compact_reader::read_int(uint8_t type) {
+  switch (type) {
+    case thrift::k_byte:
+      return static_cast<int8_t>(m_in.byte());
+
+    case thrift::k_i16:
+    case thrift::k_i32:
+    case thrift::k_i64:
+      return unzigzag(m_in.uleb128());
+
+    default:
+      corrupted("metadata: expected an integer");
+  }
+}
+
+std::string_view Thrift_compact_reader::read_binary(uint8_t type) {
+  if (thrift::k_binary != type) {
+    corrupted("metadata: expected a binary");
+  }
+
+  return m_in.bytes(m_in.uleb128());
+}
+
+std::size_t Thrift_compact_reader::read_list(uint8_t type,
+                                             uint8_t *element_type) {
+  if (thrift::k_list != type && thrift::k_set != type) {
+    corrupted("metadata: expected a list");
+  }
+
+  const auto header = m_in.byte();
+  *element_type = header & 0x0F;
+
+  std::size_t size = header >> 4;
+
+  if (15 == size) {
+    size = m_in.uleb128();
+  }
+
+  // each element takes at least one byte (or nothing, if it's an empty
+  // struct, which still needs the stop field)
+  if (size > m_in.remaining()) {
+    corrupted("metadata: list is too long");
+  }
+
+  return size;
+}
+
+void Thrift_compact_reader::skip(uint8_t type, bool is_field) {
+  switch (type) {
+    case thrift::k_bool_true:
+    case thrift::k_bool_false:
+      // boolean fields store the value in the type
+      if (!is_field) {
+        m_in.byte();
+      }
+      break;
+
+    case thrift::k_byte:
+      m_in.byte();
+      break;
+
+    case thrift::k_i16:
+    case thrift::k_i32:
+    case thrift::k_i64:
+      m_in.uleb128();
+      break;
+
+    case thrift::k_double:
+      m_in.skip(8);
+      break;
+
+    case thrift::k_binary:
+      m_in.skip(m_in.uleb128());
+      break;
+
+    case thrift::k_list:
+    case thrift::k_set: {
+      uint8_t element_type;
+
+      for (auto size = read_list(type, &element_type); size > 0; --size) {
+        skip(element_type, false);
+      }
+
+      break;
+    }
+
+    case thrift::k_map: {
+      const auto size = m_in.uleb128();
+
+      if (size > 0) {
+        const auto types = m_in.byte();
+
+        for (uint64_t i = 0; i < size; ++i) {
+          skip(types >> 4, false);
+          skip(types & 0x0F, false);
+        }
+      }
+
+      break;
+    }
+
+    case thrift::k_struct: {
+      begin_struct();
+
+      int16_t id;
+      uint8_t field_type;
+
+      while (next_field(&id, &field_type)) {
+        skip(field_type, true);
+      }
+
+      end_struct();
+      break;
+    }
+
+    default:
+      corrupted("metadata: unknown type " + std::to_string(type));
+  }
+}
+
+void Thrift_compact_writer::field_list(int16_t id, uint8_t element_type,
+                                       std::size_t size) {
+  field_header(id, thrift::k_list);
+
+  if (size < 15) {
+    byte((size << 4) | element_type);
+  } else {
+    byte(0xF0 | element_type);
+    write_uleb128(size, m_out);
+  }
+}
+
+void Thrift_compact_writer::begin_struct() {
+  m_last_field_ids.emplace_back(m_last_field_id);
+  m_last_field_id = 0;
+}
+
+void Thrift_compact_writer::end_struct() {
+  // stop field
+  byte(0);
+
+  assert(!m_last_field_ids.empty());
+  m_last_field_id = m_last_field_ids.back();
+  m_last_field_ids.pop_back();
+}
+
+void Thrift_compact_writer::field_header(int16_t id, uint8_t type) {
+  const auto delta = id - m_last_field_id;
+
+  if (delta > 0 && delta <= 15) {
+    byte((delta << 4) | type);
+  } else {
+    byte(type);
+    write_uleb128(zigzag(id), m_out);
+  }
+
+  m_last_field_id = id;
+}
+
+}  // namespace parquet
+}  // namespace mysqlsh
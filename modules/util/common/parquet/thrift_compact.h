@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMMON_PARQUET_THRIFT_COMPACT_H_
+#define MODULES_UTIL_COMMON_PARQUET_THRIFT_COMPACT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "modules/util/common/parquet/utils.h"
+
+namespace mysqlsh {
+namespace parquet {
+
+/**
+ * Types of the Thrift compact protocol.
+ */
+namespace thrift {
+
+constexpr uint8_t k_bool_true = 1;
+constexpr uint8_t k_bool_false = 2;
+constexpr uint8_t k_byte = 3;
+constexpr uint8_t k_i16 = 4;
+constexpr uint8_t k_i32 = 5;
+constexpr uint8_t k_i64 = 6;
+constexpr uint8_t k_double = 7;
+constexpr uint8_t k_binary = 8;
+constexpr uint8_t k_list = 9;
+constexpr uint8_t k_set = 10;
+constexpr uint8_t k_map = 11;
+constexpr uint8_t k_struct = 12;
+
+}  // namespace thrift
+
+/**
+ * Reads structures written using the Thrift compact protocol. Input is not
+ * trusted, all reads are bounds-checked and throw std::runtime_error if data
+ * is corrupted.
+ */
+class Thrift_compact_reader final {
+ public:
+  Thrift_compact_reader(const char *data, std::size_t length)
+      : m_in(data, length) {}
+
+  std::size_t offset() const { return m_in.offset(); }
+
+  /**
+   * Starts a top-level struct, a struct field or an element of a list.
+   */
+  void begin_struct();
+
+  void end_struct();
+
+  /**
+   * Reads the header of the next field, returns false if the struct has no more
+   * fields.
+   */
+  bool next_field(int16_t *id, uint8_t *type);
+
+  /**
+   * Reads an integer field of any width.
+   */
+  int64_t read_int(uint8_t type);
+
+  int32_t read_i32(uint8_t type) {
+    return static_cast<int32_t>(read_int(type));
+  }
+
+  /**
+   * Reads a boolean field, value is stored in the type.
+   */
+  static bool read_bool(uint8_t type) { return thrift::k_bool_true == type; }
+
+  std::string_view read_binary(uint8_t type);
+
+  /**
+   * Reads the header of a list, returns its size.
+   */
+  std::size_t read_list(uint8_t type, uint8_t *element_type);
+
+  void skip(uint8_t type) { skip(type, true); }
+
+ private:
+  static constexpr std::size_t k_max_depth = 64;
+
+  void skip(uint8_t type, bool is_field);
+
+  Byte_reader m_in;
+  int16_t m_last_field_id = 0;
+  std::vector<int16_t> m_last_field_ids;
+};
+
+/**
+ * Calls the given function for each field of a struct, function returns false
+ * if field was not handled and should be skipped.
+ */
+template <typename F>
+void read_struct(Thrift_compact_reader *reader, F &&f) {
+  reader->begin_struct();
+
+  int16_t id;
+  uint8_t type;
+
+  while (reader->next_field(&id, &type)) {
+    if (!f(id, type)) {
+      reader->skip(type);
+    }
+  }
+
+  reader->end_struct();
+}
+
+/**
+ * Calls the given function for each struct held by a list.
+ */
+template <typename F>
+void read_struct_list(Thrift_compact_reader *reader, uint8_t type, F &&f) {
+  uint8_t element_type;
+  const auto size = reader->read_list(type, &element_type);
+
+  if (size > 0 && thrift::k_struct != element_type) {
+    corrupted("metadata: expected a list of structs");
+  }
+
+  for (std::size_t i = 0; i < size; ++i) {
+    f(i);
+  }
+}
+
+/**
+ * Writes structures using the Thrift compact protocol.
+ */
+class Thrift_compact_writer final {
+ public:
+  explicit Thrift_compact_writer(std::string *out) : m_out(out) {}
+
+  void field_i32(int16_t id, int32_t value) {
+    field_header(id, thrift::k_i32);
+    write_uleb128(zigzag(value), m_out);
+  }
+
+  void field_i64(int16_t id, int64_t value) {
+    field_header(id, thrift::k_i64);
+    write_uleb128(zigzag(value), m_out);
+  }
+
+  void field_binary(int16_t id, const std::string &value) {
+    field_header(id, thrift::k_binary);
+    binary(value);
+  }
+
+  void field_list(int16_t id, uint8_t element_type, std::size_t size);
+
+  void field_struct(int16_t id) {
+    field_header(id, thrift::k_struct);
+    begin_struct();
+  }
+
+  /**
+   * Starts a top-level struct or an element of a list.
+   */
+  void begin_struct();
+
+  void end_struct();
+
+  void element_i32(int32_t value) { write_uleb128(zigzag(value), m_out); }
+
+  void element_binary(const std::string &value) { binary(value); }
+
+ private:
+  void field_header(int16_t id, uint8_t type);
+
+  void byte(uint64_t b) { m_out->push_back(static_cast<char>(b & 0xFF)); }
+
+  void binary(const std::string &value) {
+    write_uleb128(value.length(), m_out);
+    m_out->append(value);
+  }
+
+  std::string *m_out;
+  int16_t m_last_field_id = 0;
+  std::vector<int16_t> m_last_field_ids;
+};
+
+}  // namespace parquet
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_PARQUET_THRIFT_COMPACT_H_
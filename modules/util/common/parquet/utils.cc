@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/common/parquet/utils.h"
+
+#include <stdexcept>
+
+namespace mysqlsh {
+namespace parquet {
+
+void corrupted(const std::string &what) {
+  throw std::runtime_error("corrupted " + what);
+}
+
+void unsupported(const std::string &what) {
+  throw std::runtime_error(what + " is not supported");
+}
+
+uint64_t Byte_reader::uleb128() {
+  uint64_t value = 0;
+
+  for (int shift = 0; shift < 64; shift += 7) {
+    const auto b = byte();
+    value |= static_cast<uint64_t>(b & 0x7F) << shift;
+
+    if (!(b & 0x80)) {
+      return value;
+    }
+  }
+
+  corrupted("varint");
+}
+
+}  // namespace parquet
+}  // namespace mysqlsh
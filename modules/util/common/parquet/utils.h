@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMMON_PARQUET_UTILS_H_
+#define MODULES_UTIL_COMMON_PARQUET_UTILS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace mysqlsh {
+namespace parquet {
+
+/**
+ * Throws std::runtime_error: "corrupted <what>".
+ */
+[[noreturn]] void corrupted(const std::string &what);
+
+/**
+ * Throws std::runtime_error: "<what> is not supported".
+ */
+[[noreturn]] void unsupported(const std::string &what);
+
+inline uint64_t read_le(const char *data, int bytes) {
+  uint64_t value = 0;
+
+  for (int i = 0; i < bytes; ++i) {
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (8 * i);
+  }
+
+  return value;
+}
+
+inline uint32_t read_be32(const char *data) {
+  uint32_t value = 0;
+
+  for (int i = 0; i < 4; ++i) {
+    value = (value << 8) | static_cast<uint8_t>(data[i]);
+  }
+
+  return value;
+}
+
+inline void write_le(uint64_t value, int bytes, std::string *out) {
+  for (int i = 0; i < bytes; ++i) {
+    out->push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+inline void write_uleb128(uint64_t v, std::string *out) {
+  while (v >= 0x80) {
+    out->push_back(static_cast<char>((v & 0x7F) | 0x80));
+    v >>= 7;
+  }
+
+  out->push_back(static_cast<char>(v));
+}
+
+inline uint64_t zigzag(int64_t v) {
+  return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+inline int64_t unzigzag(uint64_t v) {
+  return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+}
+
+/**
+ * Sequentially reads the bytes of a buffer, all reads are bounds-checked.
+ */
+class Byte_reader final {
+ public:
+  Byte_reader(const char *data, std::size_t length)
+      : m_data(data), m_length(length) {}
+
+  std::size_t offset() const { return m_offset; }
+
+  std::size_t remaining() const { return m_length - m_offset; }
+
+  const char *current() const { return m_data + m_offset; }
+
+  uint8_t byte() {
+    need(1);
+    return static_cast<uint8_t>(m_data[m_offset++]);
+  }
+
+  /**
+   * Reads an unsigned LEB128 varint.
+   *
+   * @throws std::runtime_error if varint is truncated or longer than 64 bits
+   */
+  uint64_t uleb128();
+
+  uint64_t le(int bytes) {
+    need(bytes);
+    const auto value = read_le(current(), bytes);
+    m_offset += bytes;
+    return value;
+  }
+
+  std::string_view bytes(std::size_t length) {
+    need(length);
+    std::string_view value{current(), length};
+    m_offset += length;
+    return value;
+  }
+
+  void skip(std::size_t length) {
+    need(length);
+    m_offset += length;
+  }
+
+ private:
+  void need(std::size_t length) const {
+    if (length > remaining()) {
+      corrupted("data: unexpected end of buffer");
+    }
+  }
+
+  const char *m_data;
+  std::size_t m_length;
+  std::size_t m_offset = 0;
+};
+
+}  // namespace parquet
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_PARQUET_UTILS_H_
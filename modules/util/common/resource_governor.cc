@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/common/resource_governor.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+
+namespace {
+
+/**
+ * Distributes the limit between the requests: none of them gets more than it
+ * asked for, the unused part of a share is split between the remaining ones.
+ * Each request gets at least one unit.
+ *
+ * @param limit Limit to distribute, 0 if there's no limit.
+ * @param requests Requested amounts, 0 if a request is not limited.
+ */
+std::vector<uint64_t> fair_shares(uint64_t limit,
+                                  const std::vector<uint64_t> &requests) {
+  constexpr auto k_unlimited = std::numeric_limits<uint64_t>::max();
+  const auto requested = [&requests](std::size_t i) {
+    return 0 == requests[i] ? k_unlimited : requests[i];
+  };
+
+  std::vector<uint64_t> result(requests.size());
+
+  if (0 == limit) {
+    std::copy(requests.begin(), requests.end(), result.begin());
+    return result;
+  }
+
+  std::vector<std::size_t> order(requests.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&requested](auto l, auto r) {
+    return requested(l) < requested(r);
+  });
+
+  auto remaining = limit;
+
+  for (std::size_t i = 0, size = order.size(); i < size; ++i) {
+    const auto idx = order[i];
+    const auto share = std::max<uint64_t>(1, remaining / (size - i));
+    const auto value = std::min(requested(idx), share);
+
+    result[idx] = value;
+    remaining -= std::min(remaining, value);
+  }
+
+  return result;
+}
+
+std::string rate_to_string(uint64_t rate) {
+  return 0 == rate ? "unlimited"
+                   : mysqlshdk::utils::format_bytes(rate) + "/s";
+}
+
+}  // namespace
+
+Resource_governor::Lease::Lease(Resource_governor *governor,
+                                const std::string &operation,
+                                uint64_t threads, uint64_t rate)
+    : m_governor(governor),
+      m_operation(operation),
+      m_requested_threads(std::max<uint64_t>(1, threads)),
+      m_requested_rate(rate),
+      m_threads(m_requested_threads),
+      m_rate_limit(std::make_shared<mysqlshdk::utils::Shared_rate_limit>(
+          static_cast<int64_t>(rate))) {}
+
+Resource_governor::Lease::~Lease() { m_governor->release(this); }
+
+Resource_governor::Resource_governor(std::function<Limits()> limits)
+    : m_limits(std::move(limits)) {}
+
+Resource_governor &Resource_governor::instance() {
+  static Resource_governor s_instance{[]() {
+    Limits limits;
+    const auto &options = current_shell_options()->get();
+
+    limits.threads = static_cast<uint64_t>(options.util.max_threads);
+
+    if (!options.util.max_rate.empty()) {
+      limits.rate = mysqlshdk::utils::expand_to_bytes(options.util.max_rate);
+    }
+
+    return limits;
+  }};
+
+  return s_instance;
+}
+
+std::unique_ptr<Resource_governor::Lease> Resource_governor::acquire(
+    const std::string &operation, uint64_t threads, uint64_t rate) {
+  std::unique_ptr<Lease> lease{new Lease(this, operation, threads, rate)};
+
+  {
+    std::lock_guard lock{m_mutex};
+    m_leases.emplace_back(lease.get());
+    rebalance();
+  }
+
+  if (lease->threads() < lease->m_requested_threads) {
+    current_console()->print_note(shcore::str_format(
+        "%s is going to use %" PRIu64 " out of %" PRIu64
+        " requested threads, as the limit set by the util.maxThreads option "
+        "is shared with other operations which are currently running.",
+        operation.c_str(), lease->threads(), lease->m_requested_threads));
+  }
+
+  return lease;
+}
+
+std::size_t Resource_governor::operations() const {
+  std::lock_guard lock{m_mutex};
+  return m_leases.size();
+}
+
+void Resource_governor::release(Lease *lease) {
+  std::lock_guard lock{m_mutex};
+
+  m_leases.erase(std::remove(m_leases.begin(), m_leases.end(), lease),
+                 m_leases.end());
+  rebalance();
+}
+
+void Resource_governor::rebalance() {
+  if (m_leases.empty()) {
+    return;
+  }
+
+  const auto limits = m_limits();
+
+  std::vector<uint64_t> threads;
+  std::vector<uint64_t> rates;
+
+  threads.reserve(m_leases.size());
+  rates.reserve(m_leases.size());
+
+  for (const auto lease : m_leases) {
+    threads.emplace_back(lease->m_requested_threads);
+    rates.emplace_back(lease->m_requested_rate);
+  }
+
+  threads = fair_shares(limits.threads, threads);
+  rates = fair_shares(limits.rate, rates);
+
+  for (std::size_t i = 0, size = m_leases.size(); i < size; ++i) {
+    const auto lease = m_leases[i];
+
+    lease->m_threads = threads[i];
+    lease->m_rate_limit->set_limit(static_cast<int64_t>(rates[i]));
+
+    log_info("Resource share of %s: %" PRIu64 " threads, rate: %s",
+             lease->m_operation.c_str(), threads[i],
+             rate_to_string(rates[i]).c_str());
+  }
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMMON_RESOURCE_GOVERNOR_H_
+#define MODULES_UTIL_COMMON_RESOURCE_GOVERNOR_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/rate_limit.h"
+
+namespace mysqlsh {
+
+/**
+ * Process-wide budget shared by all the utility operations which are executed
+ * concurrently (i.e. in different threads of the same shell). Each operation
+ * takes a lease, which grants it a fair share of the global limits. Shares are
+ * recalculated whenever an operation starts or finishes.
+ */
+class Resource_governor final {
+ public:
+  struct Limits {
+    // maximum number of threads, 0 if not limited
+    uint64_t threads = 0;
+    // maximum rate in bytes per second, 0 if not limited
+    uint64_t rate = 0;
+  };
+
+  class Lease final {
+   public:
+    Lease() = delete;
+
+    Lease(const Lease &) = delete;
+    Lease(Lease &&) = delete;
+
+    Lease &operator=(const Lease &) = delete;
+    Lease &operator=(Lease &&) = delete;
+
+    ~Lease();
+
+    const std::string &operation() const { return m_operation; }
+
+    /**
+     * Current number of threads this operation is allowed to use, can change
+     * while the operation is running.
+     */
+    uint64_t threads() const { return m_threads; }
+
+    /**
+     * Rate limit which should be used by all threads of this operation, it is
+     * never null, the limit can change while the operation is running.
+     */
+    const std::shared_ptr<mysqlshdk::utils::Shared_rate_limit> &rate_limit()
+        const {
+      return m_rate_limit;
+    }
+
+   private:
+    friend class Resource_governor;
+
+    Lease(Resource_governor *governor, const std::string &operation,
+          uint64_t threads, uint64_t rate);
+
+    Resource_governor *m_governor;
+    std::string m_operation;
+    uint64_t m_requested_threads;
+    uint64_t m_requested_rate;
+    std::atomic<uint64_t> m_threads;
+    std::shared_ptr<mysqlshdk::utils::Shared_rate_limit> m_rate_limit;
+  };
+
+  /**
+   * @param limits Provides the current global limits.
+   */
+  explicit Resource_governor(std::function<Limits()> limits);
+
+  Resource_governor(const Resource_governor &) = delete;
+  Resource_governor(Resource_governor &&) = delete;
+
+  Resource_governor &operator=(const Resource_governor &) = delete;
+  Resource_governor &operator=(Resource_governor &&) = delete;
+
+  ~Resource_governor() = default;
+
+  /**
+   * Governor shared by the whole process, uses the util.maxThreads and
+   * util.maxRate shell options as the global limits.
+   */
+  static Resource_governor &instance();
+
+  /**
+   * Takes a share of the global resources, which is returned when lease is
+   * destroyed.
+   *
+   * @param operation Name of the operation.
+   * @param threads Number of threads requested by the operation.
+   * @param rate Rate limit requested by the operation, 0 if not limited.
+   */
+  std::unique_ptr<Lease> acquire(const std::string &operation,
+                                 uint64_t threads, uint64_t rate = 0);
+
+  /**
+   * Number of operations which are currently holding a lease.
+   */
+  std::size_t operations() const;
+
+ private:
+  void release(Lease *lease);
+
+  void rebalance();
+
+  std::function<Limits()> m_limits;
+  mutable std::mutex m_mutex;
+  std::vector<Lease *> m_leases;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_RESOURCE_GOVERNOR_H_
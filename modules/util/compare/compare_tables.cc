@@ -0,0 +1,765 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "modules/util/compare/compare_tables.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "mysqlshdk/include/scripting/naming_style.h"
+#include "mysqlshdk/include/scripting/shexcept.h"
+#include "mysqlshdk/include/scripting/type_info/custom.h"
+#include "mysqlshdk/include/scripting/type_info/generic.h"
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/db/utils/diff.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+#include "modules/mod_utils.h"
+#include "modules/util/common/dump/checksums.h"
+#include "modules/util/common/dump/filtering_options.h"
+#include "modules/util/dump/indexes.h"
+#include "modules/util/dump/instance_cache.h"
+
+namespace mysqlsh {
+
+namespace {
+
+using mysqlsh::dump::Instance_cache;
+using mysqlsh::dump::common::Checksums;
+
+// number of sub-ranges a range which differs is split into
+constexpr uint64_t k_range_fanout = 16;
+
+// signed values are stored with a flipped sign bit, this preserves their order
+constexpr uint64_t k_sign_bit = uint64_t{1} << 63;
+
+enum Side { SOURCE = 0, TARGET = 1 };
+
+constexpr std::size_t k_sides = 2;
+
+struct Compared_table;
+
+struct Range {
+  Compared_table *table;
+  int64_t id;
+  // if set, range holds the whole table, begin and end are not used
+  bool whole_table;
+  // inclusive bounds of the values of the first column of the index, signed
+  // values are encoded
+  uint64_t begin;
+  uint64_t end;
+  Checksums::Checksum_data *checksums[k_sides];
+  // number of checksums which were not yet computed
+  std::size_t pending = k_sides;
+};
+
+struct Compared_table {
+  std::string name;
+  std::string quoted_name;
+  const Instance_cache::Table *info = nullptr;
+  // unique index on NOT NULL columns, used to identify the rows
+  const Instance_cache::Index *index = nullptr;
+  // set if the first column of the index is an integer, ranges of its values
+  // are compared
+  bool split = false;
+  bool is_signed = false;
+  std::string select;
+  std::vector<uint32_t> key_fields;
+  // holds all the ranges, deque does not invalidate the pointers
+  std::deque<Range> ranges;
+
+  bool identical = true;
+  std::optional<Checksums::Checksum_result> rows[k_sides];
+  uint64_t ranges_compared = 0;
+  uint64_t rows_compared = 0;
+  shcore::Array_t differences = shcore::make_array();
+  bool truncated = false;
+  std::string warning;
+};
+
+struct Task {
+  enum class Type { CHECKSUM, ROWS };
+
+  Type type;
+  Range *range;
+  Side side;
+};
+
+using Sessions = std::array<std::shared_ptr<mysqlshdk::db::ISession>, k_sides>;
+
+class Table_comparer final {
+ public:
+  Table_comparer(const std::shared_ptr<mysqlshdk::db::ISession> &source,
+                 const mysqlshdk::db::Connection_options &target,
+                 const std::string &schema,
+                 const std::vector<std::string> &tables,
+                 const Compare_tables_options &options)
+      : m_schema(schema), m_tables(tables.size()), m_options(options) {
+    m_sessions[SOURCE] = source;
+    m_sessions[TARGET] =
+        establish_session(target, current_shell_options()->get().wizards);
+
+    for (std::size_t i = 0; i < tables.size(); ++i) {
+      m_tables[i].name = tables[i];
+      m_tables[i].quoted_name = shcore::quote_identifier(schema) + "." +
+                                shcore::quote_identifier(tables[i]);
+    }
+  }
+
+  Table_comparer(const Table_comparer &) = delete;
+  Table_comparer(Table_comparer &&) = delete;
+
+  Table_comparer &operator=(const Table_comparer &) = delete;
+  Table_comparer &operator=(Table_comparer &&) = delete;
+
+  ~Table_comparer() = default;
+
+  shcore::Dictionary_t run() {
+    prepare();
+    compare();
+    return summarize();
+  }
+
+  void interrupt() {
+    m_interrupted = true;
+    m_tasks_cv.notify_all();
+  }
+
+ private:
+  void prepare() {
+    dump::common::Filtering_options filters;
+    filters.schemas().include(m_schema);
+
+    for (const auto &table : m_tables) {
+      filters.tables().include(m_schema, table.name);
+    }
+
+    for (std::size_t side = 0; side < k_sides; ++side) {
+      m_caches[side] =
+          dump::Instance_cache_builder(m_sessions[side], filters, {})
+              .metadata({})
+              .build();
+      m_checksums[side].configure(m_sessions[side]);
+    }
+
+    const auto find_table =
+        [this](std::size_t side,
+               const std::string &table) -> const Instance_cache::Table * {
+      const auto schema = m_caches[side].schemas.find(m_schema);
+
+      if (m_caches[side].schemas.end() == schema) {
+        return nullptr;
+      }
+
+      const auto t = schema->second.tables.find(table);
+      return schema->second.tables.end() == t ? nullptr : &t->second;
+    };
+
+    for (auto &table : m_tables) {
+      table.info = find_table(SOURCE, table.name);
+
+      if (!table.info) {
+        throw std::invalid_argument("The table " + table.quoted_name +
+                                    " does not exist in the source instance.");
+      }
+
+      const auto target = find_table(TARGET, table.name);
+
+      if (!target) {
+        table.identical = false;
+        table.warning = "Table does not exist in the target instance.";
+        continue;
+      }
+
+      if (!same_columns(*table.info, *target)) {
+        table.identical = false;
+        table.warning =
+            "Columns of the table are different in the source and in the "
+            "target instances.";
+        continue;
+      }
+
+      if (const auto [index, unique] = dump::select_index(*table.info);
+          index && unique) {
+        table.index = index;
+
+        const auto first = index->columns().front();
+        table.split = mysqlshdk::db::Type::Integer == first->type ||
+                      mysqlshdk::db::Type::UInteger == first->type;
+        table.is_signed = mysqlshdk::db::Type::Integer == first->type;
+      }
+
+      const auto &columns = table.info->columns;
+
+      for (std::size_t i = 0; i < columns.size(); ++i) {
+        if (i > 0) {
+          table.select += ',';
+        }
+
+        table.select += columns[i]->quoted_name;
+
+        if (table.index) {
+          const auto &key = table.index->columns();
+
+          if (key.end() != std::find(key.begin(), key.end(), columns[i])) {
+            table.key_fields.emplace_back(static_cast<uint32_t>(i));
+          }
+        }
+      }
+
+      for (auto &checksums : m_checksums) {
+        checksums.initialize_table(m_schema, table.name, table.info,
+                                   table.index, {});
+      }
+
+      push_checksums(new_range(&table, true, 0, 0));
+    }
+  }
+
+  static bool same_columns(const Instance_cache::Table &source,
+                           const Instance_cache::Table &target) {
+    if (source.columns.size() != target.columns.size()) {
+      return false;
+    }
+
+    for (std::size_t i = 0; i < source.columns.size(); ++i) {
+      if (source.columns[i]->name != target.columns[i]->name) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  Range *new_range(Compared_table *table, bool whole_table, uint64_t begin,
+                   uint64_t end) {
+    // called with m_tasks_mutex locked (or before the workers are started)
+    auto &range = table->ranges.emplace_back();
+
+    range.table = table;
+    range.id = static_cast<int64_t>(table->ranges.size());
+    range.whole_table = whole_table;
+    range.begin = begin;
+    range.end = end;
+
+    const auto b = boundary(range);
+
+    for (std::size_t side = 0; side < k_sides; ++side) {
+      range.checksums[side] = m_checksums[side].prepare_checksum(
+          m_schema, table->name, {}, range.id, b);
+    }
+
+    return &range;
+  }
+
+  void push_checksums(Range *range) {
+    for (std::size_t side = 0; side < k_sides; ++side) {
+      m_tasks.emplace_back(
+          Task{Task::Type::CHECKSUM, range, static_cast<Side>(side)});
+    }
+  }
+
+  std::string value(const Compared_table &table, uint64_t v) const {
+    return table.is_signed
+               ? std::to_string(static_cast<int64_t>(v ^ k_sign_bit))
+               : std::to_string(v);
+  }
+
+  std::string boundary(const Range &range) const {
+    if (range.whole_table) {
+      return {};
+    }
+
+    const auto &table = *range.table;
+    const auto &column = table.index->columns().front()->quoted_name;
+
+    if (range.begin == range.end) {
+      return column + '=' + value(table, range.begin);
+    }
+
+    return "(" + column + " BETWEEN " + value(table, range.begin) + " AND " +
+           value(table, range.end) + ")";
+  }
+
+  std::string query_comment(const Range &range, const char *context) const {
+    return "/* mysqlsh " +
+           shcore::get_member_name("compareTables",
+                                   shcore::current_naming_style()) +
+           ", " + context + " table " +
+           shcore::str_replace(range.table->quoted_name, "*/", "*\\/") +
+           ", ID: " + std::to_string(range.id) + " */";
+  }
+
+  void compare() {
+    if (m_tasks.empty()) {
+      return;
+    }
+
+    const auto threads = std::max<uint64_t>(
+        1, std::min<uint64_t>(m_options.threads(), m_tasks.size()));
+
+    log_info("Comparing %zu table(s) using %" PRIu64 " thread(s)",
+             m_tables.size(), threads);
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (uint64_t i = 0; i < threads; ++i) {
+      workers.emplace_back(
+          mysqlsh::spawn_scoped_thread([this]() { worker(); }));
+    }
+
+    for (auto &worker : workers) {
+      worker.join();
+    }
+
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+
+    if (m_interrupted) {
+      throw shcore::cancelled("Interrupted by user");
+    }
+  }
+
+  void worker() {
+    mysqlsh::Mysql_thread mysql_thread;
+    Sessions sessions;
+
+    try {
+      for (std::size_t side = 0; side < k_sides; ++side) {
+        sessions[side] = establish_session(
+            m_sessions[side]->get_connection_options(), false);
+      }
+    } catch (...) {
+      set_error(std::current_exception());
+      return;
+    }
+
+    while (true) {
+      Task task;
+
+      {
+        std::unique_lock lock{m_tasks_mutex};
+
+        m_tasks_cv.wait(lock, [this]() {
+          return !m_tasks.empty() || !m_active || m_interrupted || m_error;
+        });
+
+        if (m_tasks.empty() || m_interrupted || m_error) {
+          break;
+        }
+
+        task = m_tasks.front();
+        m_tasks.pop_front();
+        ++m_active;
+      }
+
+      try {
+        execute(task, sessions);
+      } catch (...) {
+        set_error(std::current_exception());
+      }
+
+      {
+        std::lock_guard lock{m_tasks_mutex};
+        --m_active;
+      }
+
+      m_tasks_cv.notify_all();
+    }
+
+    for (const auto &session : sessions) {
+      session->close();
+    }
+  }
+
+  void set_error(std::exception_ptr error) {
+    {
+      std::lock_guard lock{m_tasks_mutex};
+
+      if (!m_error) {
+        m_error = std::move(error);
+      }
+    }
+
+    m_tasks_cv.notify_all();
+  }
+
+  void execute(const Task &task, const Sessions &sessions) {
+    auto &range = *task.range;
+
+    {
+      std::lock_guard lock{m_tasks_mutex};
+
+      if (range.table->truncated) {
+        // enough differences were found
+        return;
+      }
+    }
+
+    switch (task.type) {
+      case Task::Type::CHECKSUM: {
+        range.checksums[task.side]->compute(sessions[task.side],
+                                            query_comment(range, "comparing"));
+
+        bool computed;
+
+        {
+          std::lock_guard lock{m_tasks_mutex};
+          computed = 0 == --range.pending;
+        }
+
+        if (computed) {
+          checksums_computed(&range, sessions);
+        }
+
+        break;
+      }
+
+      case Task::Type::ROWS:
+        compare_rows(&range, sessions);
+        break;
+    }
+  }
+
+  void checksums_computed(Range *range, const Sessions &sessions) {
+    auto &table = *range->table;
+    const auto &source = range->checksums[SOURCE]->result();
+    const auto &target = range->checksums[TARGET]->result();
+    const auto identical = source == target;
+
+    {
+      std::lock_guard lock{m_tasks_mutex};
+
+      ++table.ranges_compared;
+
+      if (range->whole_table) {
+        table.rows[SOURCE] = source;
+        table.rows[TARGET] = target;
+      }
+
+      if (!identical) {
+        table.identical = false;
+      }
+    }
+
+    if (identical) {
+      return;
+    }
+
+    if (!table.index) {
+      std::lock_guard lock{m_tasks_mutex};
+      table.warning =
+          "Table has no primary key or a unique index on NOT NULL columns, "
+          "rows which differ cannot be identified.";
+      return;
+    }
+
+    const auto rows = std::max(source.count, target.count);
+
+    if (!table.split || rows <= m_options.range_rows() ||
+        (!range->whole_table && range->begin == range->end)) {
+      compare_rows(range, sessions);
+      return;
+    }
+
+    uint64_t begin = range->begin;
+    uint64_t end = range->end;
+
+    if (range->whole_table && !find_bounds(table, sessions, &begin, &end)) {
+      compare_rows(range, sessions);
+      return;
+    }
+
+    // split the range, each sub-range holds (almost) the same number of values
+    const auto span = end - begin;
+    const auto parts = span < k_range_fanout ? span + 1 : k_range_fanout;
+    const auto step = span / parts + 1;
+
+    {
+      std::lock_guard lock{m_tasks_mutex};
+
+      for (uint64_t offset = 0;; offset += step) {
+        const auto last = span - offset < step;
+
+        push_checksums(new_range(&table, false, begin + offset,
+                                 last ? end : begin + offset + step - 1));
+
+        if (last) {
+          break;
+        }
+      }
+    }
+
+    m_tasks_cv.notify_all();
+  }
+
+  bool find_bounds(const Compared_table &table, const Sessions &sessions,
+                   uint64_t *begin, uint64_t *end) const {
+    const auto &column = table.index->columns().front()->quoted_name;
+    bool found = false;
+
+    for (const auto &session : sessions) {
+      const auto row =
+          session
+              ->query("SELECT MIN(" + column + "),MAX(" + column + ") FROM " +
+                      table.quoted_name)
+              ->fetch_one_or_throw();
+
+      if (row->is_null(0)) {
+        continue;
+      }
+
+      uint64_t min;
+      uint64_t max;
+
+      if (table.is_signed) {
+        min = static_cast<uint64_t>(row->get_int(0)) ^ k_sign_bit;
+        max = static_cast<uint64_t>(row->get_int(1)) ^ k_sign_bit;
+      } else {
+        min = row->get_uint(0);
+        max = row->get_uint(1);
+      }
+
+      *begin = found ? std::min(*begin, min) : min;
+      *end = found ? std::max(*end, max) : max;
+      found = true;
+    }
+
+    return found;
+  }
+
+  void compare_rows(Range *range, const Sessions &sessions) {
+    auto &table = *range->table;
+    const auto b = boundary(*range);
+
+    std::string order_by;
+
+    for (const auto &column : table.index->columns()) {
+      if (!order_by.empty()) {
+        order_by += ',';
+      }
+
+      order_by += column->quoted_name;
+    }
+
+    const auto query = "SELECT " + table.select + " FROM " +
+                       table.quoted_name + (b.empty() ? "" : " WHERE " + b) +
+                       " ORDER BY " + order_by +
+                       query_comment(*range, "comparing rows of");
+
+    const auto left = sessions[SOURCE]->query(query);
+    const auto right = sessions[TARGET]->query(query);
+
+    const auto key = [&table](const mysqlshdk::db::IRow *row) {
+      const auto values = get_row_values(*row);
+      auto result = shcore::make_dict();
+
+      for (const auto idx : table.key_fields) {
+        result->emplace(table.info->columns[idx]->name, values[idx]);
+      }
+
+      return result;
+    };
+
+    const auto rows = mysqlshdk::db::find_different_rows_with_key_indexes(
+        left.get(), right.get(), table.key_fields,
+        [&](const mysqlshdk::db::IRow *l, const mysqlshdk::db::IRow *r,
+            mysqlshdk::db::Row_difference difference) {
+          using mysqlshdk::db::Row_difference;
+
+          if (Row_difference::Identical == difference) {
+            return true;
+          }
+
+          auto diff = shcore::make_dict();
+
+          switch (difference) {
+            case Row_difference::Identical:
+              break;
+
+            case Row_difference::Fields_differ:
+              diff->emplace("type", "different");
+              diff->emplace("key", key(l));
+              break;
+
+            case Row_difference::Row_missing:
+              diff->emplace("type", "missing");
+              diff->emplace("key", key(l));
+              break;
+
+            case Row_difference::Row_added:
+              diff->emplace("type", "extra");
+              diff->emplace("key", key(r));
+              break;
+          }
+
+          std::lock_guard lock{m_tasks_mutex};
+
+          if (table.differences->size() >= m_options.max_differences()) {
+            table.truncated = true;
+            return false;
+          }
+
+          table.differences->emplace_back(std::move(diff));
+          return !m_interrupted;
+        });
+
+    std::lock_guard lock{m_tasks_mutex};
+    table.rows_compared += rows;
+  }
+
+  shcore::Dictionary_t summarize() const {
+    const auto console = current_console();
+    auto result = shcore::make_dict();
+    auto tables = shcore::make_dict();
+    bool identical = true;
+
+    for (const auto &table : m_tables) {
+      auto t = shcore::make_dict();
+
+      t->emplace("identical", table.identical);
+
+      if (table.rows[SOURCE].has_value()) {
+        t->emplace("sourceRows", table.rows[SOURCE]->count);
+        t->emplace("targetRows", table.rows[TARGET]->count);
+      }
+
+      t->emplace("rangesCompared", table.ranges_compared);
+      t->emplace("rowsCompared", table.rows_compared);
+      t->emplace("differences", table.differences);
+      t->emplace("truncated", table.truncated);
+
+      if (!table.warning.empty()) {
+        t->emplace("warning", table.warning);
+      }
+
+      if (table.identical) {
+        console->print_info("Table " + table.quoted_name + " is identical.");
+      } else if (!table.warning.empty()) {
+        console->print_warning("Table " + table.quoted_name +
+                               " differs: " + table.warning);
+      } else {
+        console->print_info(shcore::str_format(
+            "Table %s differs, %s%zu row difference%s found after comparing "
+            "%" PRIu64 " range%s.",
+            table.quoted_name.c_str(), table.truncated ? "at least " : "",
+            table.differences->size(),
+            1 == table.differences->size() ? "" : "s", table.ranges_compared,
+            1 == table.ranges_compared ? "" : "s"));
+      }
+
+      identical &= table.identical;
+      tables->emplace(table.name, std::move(t));
+    }
+
+    result->emplace("identical", identical);
+    result->emplace("tables", std::move(tables));
+
+    return result;
+  }
+
+  const std::string m_schema;
+  std::vector<Compared_table> m_tables;
+  const Compare_tables_options &m_options;
+
+  Sessions m_sessions;
+  Instance_cache m_caches[k_sides];
+  Checksums m_checksums[k_sides];
+
+  std::mutex m_tasks_mutex;
+  std::condition_variable m_tasks_cv;
+  std::deque<Task> m_tasks;
+  std::size_t m_active = 0;
+  std::exception_ptr m_error;
+  std::atomic<bool> m_interrupted = false;
+};
+
+}  // namespace
+
+const shcore::Option_pack_def<Compare_tables_options>
+    &Compare_tables_options::options() {
+  static const auto opts =
+      shcore::Option_pack_def<Compare_tables_options>()
+          .optional("maxDifferences",
+                    &Compare_tables_options::m_max_differences)
+          .optional("rangeRows", &Compare_tables_options::m_range_rows)
+          .optional("threads", &Compare_tables_options::m_threads)
+          .on_done(&Compare_tables_options::on_unpacked_options);
+
+  return opts;
+}
+
+void Compare_tables_options::on_unpacked_options() {
+  if (0 == m_threads) {
+    throw std::invalid_argument(
+        "The value of 'threads' option must be greater than 0.");
+  }
+
+  if (0 == m_range_rows) {
+    throw std::invalid_argument(
+        "The value of 'rangeRows' option must be greater than 0.");
+  }
+}
+
+shcore::Dictionary_t compare_tables(
+    const std::shared_ptr<mysqlshdk::db::ISession> &source,
+    const mysqlshdk::db::Connection_options &target, const std::string &schema,
+    const std::vector<std::string> &tables,
+    const Compare_tables_options &options) {
+  if (tables.empty()) {
+    throw std::invalid_argument("The tables parameter cannot be empty.");
+  }
+
+  Table_comparer comparer{source, target, schema, tables, options};
+
+  shcore::Interrupt_handler intr_handler([&comparer]() -> bool {
+    comparer.interrupt();
+    return false;
+  });
+
+  return comparer.run();
+}
+
+}  // namespace mysqlsh
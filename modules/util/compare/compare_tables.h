@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#ifndef MODULES_UTIL_COMPARE_COMPARE_TABLES_H_
+#define MODULES_UTIL_COMPARE_COMPARE_TABLES_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/session.h"
+
+namespace mysqlsh {
+
+class Compare_tables_options final {
+ public:
+  Compare_tables_options() = default;
+
+  Compare_tables_options(const Compare_tables_options &) = default;
+  Compare_tables_options(Compare_tables_options &&) = default;
+
+  Compare_tables_options &operator=(const Compare_tables_options &) = default;
+  Compare_tables_options &operator=(Compare_tables_options &&) = default;
+
+  ~Compare_tables_options() = default;
+
+  static const shcore::Option_pack_def<Compare_tables_options> &options();
+
+  /**
+   * Number of threads, each thread uses a session to each of the instances.
+   */
+  uint64_t threads() const { return m_threads; }
+
+  /**
+   * Ranges which hold at most this many rows are compared row by row.
+   */
+  uint64_t range_rows() const { return m_range_rows; }
+
+  /**
+   * Maximum number of differences reported for each table.
+   */
+  uint64_t max_differences() const { return m_max_differences; }
+
+ private:
+  void on_unpacked_options();
+
+  uint64_t m_threads = 4;
+  uint64_t m_range_rows = 1000;
+  uint64_t m_max_differences = 100;
+};
+
+/**
+ * Compares contents of the given tables in the source and the target
+ * instances.
+ *
+ * Checksum of each table is computed on both instances. If they differ and
+ * table has a primary key (or an equivalent index) whose first column is an
+ * integer, values of that column are split into ranges, and checksums of each
+ * range are compared. Ranges which differ are split further, until a range
+ * holds few enough rows to be compared row by row. The number of queries is
+ * thus proportional to the number of differences, not to the size of the
+ * table.
+ *
+ * @param source Session to the source instance.
+ * @param target Connection options of the target instance.
+ * @param schema Schema which holds the tables.
+ * @param tables Tables to be compared.
+ * @param options Comparison options.
+ *
+ * @returns dictionary with the result of comparison of each table
+ */
+shcore::Dictionary_t compare_tables(
+    const std::shared_ptr<mysqlshdk::db::ISession> &source,
+    const mysqlshdk::db::Connection_options &target, const std::string &schema,
+    const std::vector<std::string> &tables,
+    const Compare_tables_options &options);
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMPARE_COMPARE_TABLES_H_
@@ -30,6 +30,7 @@
 #include <mutex>
 #include <string_view>
 
+#include "modules/util/common/console_with_prefix.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/interrupt_handler.h"
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
@@ -37,7 +38,10 @@
 #include "mysqlshdk/libs/storage/backend/in_memory/virtual_config.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/textui/textui.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlsh {
@@ -51,148 +55,26 @@ std::unique_ptr<mysqlshdk::storage::IDirectory> directory(
   return mysqlshdk::storage::make_directory(k_directory_name, config);
 }
 
-class Console_with_prefix final : public IConsole {
- public:
-  Console_with_prefix() = delete;
-
-  explicit Console_with_prefix(const std::string &prefix)
-      : m_prefix(prefix), m_console(current_console()) {}
-
-  Console_with_prefix(const Console_with_prefix &) = delete;
-  Console_with_prefix(Console_with_prefix &&) = delete;
-
-  Console_with_prefix &operator=(const Console_with_prefix &) = delete;
-  Console_with_prefix &operator=(Console_with_prefix &&) = delete;
-
-  ~Console_with_prefix() override = default;
-
-  void raw_print(const std::string &text, Output_stream stream,
-                 bool format_json = true) const override {
-    m_console->raw_print(get_text(text), stream, format_json);
-  }
-
-  void print(const std::string &text) const override {
-    m_console->print(get_text(text));
-  }
-
-  void println(const std::string &text = "") const override {
-    m_console->println(get_text(text));
-  }
-
-  void print_error(const std::string &text) const override {
-    m_console->print_error(get_text(text));
-  }
-
-  void print_warning(const std::string &text) const override {
-    m_console->print_warning(get_text(text));
-  }
-
-  void print_note(const std::string &text) const override {
-    m_console->print_note(get_text(text));
-  }
-
-  void print_status(const std::string &text) const override {
-    m_console->print_status(get_text(text));
-  }
-
-  void print_info(const std::string &text = "") const override {
-    m_console->print_info(get_text(text));
-  }
-
-  void print_para(const std::string &text) const override {
-    m_console->print_para(get_text(text));
-  }
-
-  void print_value(const shcore::Value &, const std::string &) const override {
-    throw std::logic_error("Console_with_prefix::print_value() not supported");
-  }
-
-  void print_diag(const std::string &text) const override {
-    m_console->print_diag(get_text(text));
-  }
-
-  shcore::Prompt_result prompt(const std::string &prompt,
-                               const shcore::prompt::Prompt_options &options,
-                               std::string *out_val) const override {
-    return m_console->prompt(get_text(prompt), options, out_val);
-  }
-
-  shcore::Prompt_result prompt(
-      const std::string &prompt, std::string *out_val,
-      Validator validator = nullptr,
-      shcore::prompt::Prompt_type type = shcore::prompt::Prompt_type::TEXT,
-      const std::string &title = "",
-      const std::vector<std::string> &description = {},
-      const std::string &default_value = "") const override {
-    return m_console->prompt(get_text(prompt), out_val, validator, type, title,
-                             description, default_value);
-  }
-
-  Prompt_answer confirm(
-      const std::string &prompt, Prompt_answer def = Prompt_answer::NO,
-      const std::string &yes_label = "&Yes",
-      const std::string &no_label = "&No", const std::string &alt_label = "",
-      const std::string &title = "",
-      const std::vector<std::string> &description = {}) const override {
-    return m_console->confirm(get_text(prompt), def, yes_label, no_label,
-                              alt_label, title, description);
-  }
-
-  shcore::Prompt_result prompt_password(
-      const std::string &prompt, std::string *out_val,
-      Validator validator = nullptr, const std::string &title = "",
-      const std::vector<std::string> &description = {}) const override {
-    return m_console->prompt_password(get_text(prompt), out_val, validator,
-                                      title, description);
-  }
-
-  bool select(const std::string &prompt_text, std::string *result,
-              const std::vector<std::string> &items, size_t default_option = 0,
-              bool allow_custom = false, Validator validator = nullptr,
-              const std::string &title = "",
-              const std::vector<std::string> &description = {}) const override {
-    return m_console->select(get_text(prompt_text), result, items,
-                             default_option, allow_custom, validator, title,
-                             description);
-  }
-
-  std::shared_ptr<IPager> enable_pager() override {
-    return m_console->enable_pager();
-  }
-
-  void enable_global_pager() override { m_console->enable_global_pager(); }
-
-  void disable_global_pager() override { m_console->disable_global_pager(); }
-
-  bool is_global_pager_enabled() const override {
-    return m_console->is_global_pager_enabled();
-  }
-
-  void add_print_handler(shcore::Interpreter_print_handler *handler) override {
-    m_console->add_print_handler(handler);
-  }
-
-  void remove_print_handler(
-      shcore::Interpreter_print_handler *handler) override {
-    m_console->remove_print_handler(handler);
-  }
-
- private:
-  std::string get_text(const std::string &text) const {
-    return m_prefix + ' ' + text;
-  }
-
-  std::string m_prefix;
-  std::shared_ptr<IConsole> m_console;
-};
-
 }  // namespace
 
 std::pair<std::shared_ptr<mysqlshdk::storage::in_memory::Virtual_config>,
           std::unique_ptr<mysqlshdk::storage::IDirectory>>
-setup_virtual_storage() {
+setup_virtual_storage(std::size_t memory_limit,
+                      const std::string &spill_directory) {
   auto config = std::make_shared<mysqlshdk::storage::in_memory::Virtual_config>(
       32 * 1024 * 1024);  // 32MB
+
+  if (memory_limit) {
+    // each copy uses its own scratch directory, it's removed along with the
+    // virtual FS
+    config->fs()->set_memory_limit(
+        memory_limit,
+        shcore::path::join_path(
+            spill_directory,
+            "mysqlsh-copy-" + shcore::get_random_string(
+                                  8, "abcdefghijklmnopqrstuvwxyz0123456789")));
+  }
+
   config->fs()->set_uses_synchronized_io([](std::string_view name) {
     // this is intended to be used by the copy*() utilities, data files are not
     // compressed and use the .tsv extension
@@ -336,6 +218,19 @@ void copy(dump::Ddl_dumper *dumper, Dump_loader *loader,
     std::rethrow_exception(current_exception);
   }
 
+  {
+    const auto fs = storage->fs();
+    auto usage = "Peak memory used by the copy buffers: " +
+                 mysqlshdk::utils::format_bytes(fs->peak_memory());
+
+    if (const auto spilled = fs->spilled_bytes()) {
+      usage += ", spilled to disk: " + mysqlshdk::utils::format_bytes(spilled);
+    }
+
+    log_info("%s", usage.c_str());
+    current_console()->print_info(usage);
+  }
+
   // show metadata at the end, making sure it doesn't disappear in the noise
   loader->show_metadata(true);
 }
@@ -46,7 +46,8 @@ namespace copy {
 
 std::pair<std::shared_ptr<mysqlshdk::storage::in_memory::Virtual_config>,
           std::unique_ptr<mysqlshdk::storage::IDirectory>>
-setup_virtual_storage();
+setup_virtual_storage(std::size_t memory_limit,
+                      const std::string &spill_directory);
 
 void copy(dump::Ddl_dumper *dumper, Dump_loader *loader,
           const std::shared_ptr<mysqlshdk::storage::in_memory::Virtual_config>
@@ -65,7 +66,8 @@ void copy(const mysqlshdk::db::Connection_options &connection_options,
                                 e.format());
   }
 
-  auto [storage, output] = setup_virtual_storage();
+  auto [storage, output] = setup_virtual_storage(
+      copy_options->memory_limit(), copy_options->spill_directory());
 
   copy_options->dump_options()->set_storage_config(storage);
   copy_options->dump_options()->set_output_url(output->full_path().real());
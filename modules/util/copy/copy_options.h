@@ -25,10 +25,14 @@
 #define MODULES_UTIL_COPY_COPY_OPTIONS_H_
 
 #include <limits>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 
 #include "modules/util/dump/ddl_dumper_options.h"
 #include "modules/util/load/load_dump_options.h"
@@ -55,12 +59,22 @@ class Copy_options {
             .template ignore<mysqlshdk::aws::S3_bucket_options>()
             .template ignore<mysqlshdk::azure::Blob_storage_options>()
             .template ignore<import_table::Dialect>()
-            .ignore({"backgroundThreads", "characterSet", "compression",
-                     "createInvisiblePKs", "loadData", "loadDdl", "loadUsers",
-                     "ocimds", "progressFile", "resetProgress", "showMetadata",
-                     "targetVersion", "waitDumpTimeout"})
+            .ignore({"backgroundThreads", "characterSet", "chunkWindow",
+                     "compression", "compressionDictionary",
+                     "compressionThreads", "createInvisiblePKs",
+                     "deferTableAnalysis", "dropPageCache", "fastLoad",
+                     "format", "incrementalBase", "indexBufferSize",
+                     "indexThreads", "loadData", "loadDdl",
+                     "loadUsers", "maxMemory", "minThreads", "ocimds",
+                     "performanceReport", "prefetchMemory", "progressFd",
+                     "progressFile", "progressFormat", "rawBinary",
+                     "readReplicas", "resetProgress", "showMetadata",
+                     "statusFile", "streamingChecksum", "targetVersion",
+                     "waitDumpTimeout", "watermarkColumns"})
             .include(&Copy_options::m_dump_options)
             .include(&Copy_options::m_load_options)
+            .optional("memoryLimit", &Copy_options::set_memory_limit)
+            .optional("spillDirectory", &Copy_options::set_spill_directory)
             .on_done(&Copy_options::on_unpacked_options);
 
     return opts;
@@ -69,6 +83,16 @@ class Copy_options {
   T *dump_options() { return &m_dump_options; }
   Load_dump_options *load_options() { return &m_load_options; }
 
+  /**
+   * Maximum memory used by the in-memory dump files, 0 - no limit.
+   */
+  std::size_t memory_limit() const { return m_memory_limit; }
+
+  /**
+   * Directory which holds the files which do not fit in memory.
+   */
+  const std::string &spill_directory() const { return m_spill_directory; }
+
  protected:
   Copy_options() {
     on_unpacked_options();
@@ -97,6 +121,24 @@ class Copy_options {
   }
 
  private:
+  void set_memory_limit(const std::string &value) {
+    if (value.empty()) {
+      throw std::invalid_argument(
+          "The option 'memoryLimit' cannot be set to an empty string.");
+    }
+
+    m_memory_limit = mysqlshdk::utils::expand_to_bytes(value);
+  }
+
+  void set_spill_directory(const std::string &value) {
+    if (value.empty()) {
+      throw std::invalid_argument(
+          "The option 'spillDirectory' cannot be set to an empty string.");
+    }
+
+    m_spill_directory = value;
+  }
+
   void on_unpacked_options() {
     // dumper in the dry run mode writes all the files, because loader needs
     // these files to simulate the load
@@ -112,10 +154,16 @@ class Copy_options {
     m_load_options.set_load_data(m_dump_options.dump_data());
     m_load_options.set_load_ddl(m_dump_options.dump_ddl());
     m_load_options.set_load_users(m_dump_options.dump_users());
+
+    // rows are streamed directly to the loader, binary data does not have to
+    // be encoded with TO_BASE64() and decoded with FROM_BASE64()
+    m_dump_options.enable_raw_binary_if_supported();
   }
 
   T m_dump_options;
   Load_dump_options m_load_options;
+  std::size_t m_memory_limit = 0;
+  std::string m_spill_directory = shcore::path::tmpdir();
 };
 
 }  // namespace copy
@@ -34,6 +34,10 @@ namespace {
 using mysqlshdk::utils::Version;
 
 const std::string k_partition_awareness_capability = "partition_awareness";
+const std::string k_physical_tablespaces_capability = "physical_tablespaces";
+const std::string k_table_data_references_capability = "table_data_references";
+const std::string k_compression_dictionary_capability =
+    "compression_dictionary";
 
 }  // namespace
 
@@ -41,6 +45,15 @@ std::string id(Capability capability) {
   switch (capability) {
     case Capability::PARTITION_AWARENESS:
       return k_partition_awareness_capability;
+
+    case Capability::PHYSICAL_TABLESPACES:
+      return k_physical_tablespaces_capability;
+
+    case Capability::TABLE_DATA_REFERENCES:
+      return k_table_data_references_capability;
+
+    case Capability::COMPRESSION_DICTIONARY:
+      return k_compression_dictionary_capability;
   }
 
   throw std::logic_error("Should not happen");
@@ -51,6 +64,18 @@ std::string description(Capability capability) {
     case Capability::PARTITION_AWARENESS:
       return "Partition awareness - dumper treats each partition as a separate "
              "table, improving both dump and load times.";
+
+    case Capability::PHYSICAL_TABLESPACES:
+      return "Physical tablespaces - data of the tables is stored as copies of "
+             "their InnoDB tablespace files, which are imported when loading.";
+
+    case Capability::TABLE_DATA_REFERENCES:
+      return "Table data references - data of the tables which did not change "
+             "is stored in a previous dump, which is accessed when loading.";
+
+    case Capability::COMPRESSION_DICTIONARY:
+      return "Compression dictionary - data of the tables is compressed using "
+             "per-table dictionaries, which are stored in the .zdict files.";
   }
 
   throw std::logic_error("Should not happen");
@@ -60,13 +85,21 @@ Version version_required(Capability capability) {
   switch (capability) {
     case Capability::PARTITION_AWARENESS:
       return Version(8, 0, 27);
+
+    case Capability::PHYSICAL_TABLESPACES:
+    case Capability::TABLE_DATA_REFERENCES:
+    case Capability::COMPRESSION_DICTIONARY:
+      return Version(8, 3, 0);
   }
 
   throw std::logic_error("Should not happen");
 }
 
 bool is_supported(const std::string &id) {
-  if (k_partition_awareness_capability == id) {
+  if (k_partition_awareness_capability == id ||
+      k_physical_tablespaces_capability == id ||
+      k_table_data_references_capability == id ||
+      k_compression_dictionary_capability == id) {
     return true;
   } else {
     return false;
@@ -33,6 +33,9 @@ namespace dump {
 
 enum class Capability {
   PARTITION_AWARENESS,
+  PHYSICAL_TABLESPACES,
+  TABLE_DATA_REFERENCES,
+  COMPRESSION_DICTIONARY,
 };
 
 namespace capability {
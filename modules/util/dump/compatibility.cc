@@ -1105,6 +1105,39 @@ Deferred_statements check_create_table_for_indexes(
   return ret;
 }
 
+std::string_view foreign_key_referenced_table(std::string_view fk) {
+  SQL_iterator it(fk, 0, false);
+
+  while (it.valid()) {
+    if (shcore::str_caseeq(it.next_token(), "REFERENCES")) {
+      // qualified name is a single token
+      return it.valid() ? it.next_token() : std::string_view{};
+    }
+  }
+
+  return {};
+}
+
+std::string add_foreign_keys_statement(
+    std::string_view table, std::span<const std::string> definitions) {
+  assert(!definitions.empty());
+
+  std::string q = "ALTER TABLE ";
+  q += table;
+  q += ' ';
+
+  for (const auto &fk : definitions) {
+    q += "ADD ";
+    q += fk;
+    q += ',';
+  }
+
+  // remove last comma
+  q.pop_back();
+
+  return q;
+}
+
 std::string check_create_user_for_authentication_plugin(
     const std::string &create_user, const std::set<std::string> &plugins) {
   SQL_iterator it(create_user, 0, false);
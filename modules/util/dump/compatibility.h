@@ -26,6 +26,7 @@
 
 #include <functional>
 #include <set>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_set>
@@ -118,6 +119,24 @@ Deferred_statements check_create_table_for_indexes(
     const std::string &statement, const std::string &table_name,
     bool fulltext_only);
 
+/**
+ * Extracts name of the referenced table from the definition of a foreign key,
+ * as stored in Deferred_statements::foreign_keys.
+ *
+ * @returns quoted (and possibly qualified) name of the table, or an empty
+ *          string if the definition does not reference a table
+ */
+std::string_view foreign_key_referenced_table(std::string_view fk);
+
+/**
+ * Creates an ALTER TABLE statement which adds all the given foreign keys.
+ *
+ * @param table Quoted name of the table.
+ * @param definitions Definitions of the foreign keys, cannot be empty.
+ */
+std::string add_foreign_keys_statement(
+    std::string_view table, std::span<const std::string> definitions);
+
 std::string check_create_user_for_authentication_plugin(
     const std::string &create_user,
     const std::set<std::string> &plugins =
@@ -23,13 +23,19 @@
 
 #include "modules/util/dump/ddl_dumper_options.h"
 
+#include <algorithm>
+#include <array>
+#include <string_view>
 #include <vector>
 
 #include "modules/util/common/dump/utils.h"
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/libs/storage/backend/object_storage_config.h"
 #include "mysqlshdk/libs/storage/backend/oci_par_directory_config.h"
+#include "mysqlshdk/libs/storage/backend/stream_archive.h"
+#include "mysqlshdk/libs/storage/utils.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -53,13 +59,38 @@ constexpr auto k_minimum_chunk_size = "128k";
 // side.
 constexpr auto k_default_chunk_size = "64M";
 
+constexpr auto k_default_mirror_max_lag = "64M";
+
+bool is_raw_binary_safe(const std::string &character_set) {
+  // bytes of the binary data are not going to be misinterpreted as a part of
+  // a multibyte character, if none of the ASCII characters can appear there
+  static constexpr std::array<std::string_view, 6> k_safe_character_sets = {
+      "ascii", "binary", "latin1", "utf8", "utf8mb3", "utf8mb4"};
+
+  return std::any_of(k_safe_character_sets.begin(), k_safe_character_sets.end(),
+                     [&character_set](std::string_view cs) {
+                       return shcore::str_caseeq(cs, character_set);
+                     });
+}
+
+using Object_storage_config_ptr =
+    std::shared_ptr<mysqlshdk::storage::backend::object_storage::Config>;
+
+Object_storage_config_ptr with_background_uploads(
+    Object_storage_config_ptr config) {
+  // parts of the dump files are uploaded while the next ones are written
+  config->enable_background_uploads();
+  return config;
+}
+
 }  // namespace
 
 Ddl_dumper_options::Ddl_dumper_options()
     : Dump_options(),
       m_blob_storage_options{
           mysqlshdk::azure::Blob_storage_options::Operation::WRITE},
-      m_bytes_per_chunk(expand_to_bytes(k_default_chunk_size)) {}
+      m_bytes_per_chunk(expand_to_bytes(k_default_chunk_size)),
+      m_mirror_max_lag(expand_to_bytes(k_default_mirror_max_lag)) {}
 
 const shcore::Option_pack_def<Ddl_dumper_options>
     &Ddl_dumper_options::options() {
@@ -68,6 +99,11 @@ const shcore::Option_pack_def<Ddl_dumper_options>
           .include<Dump_options>()
           .optional("chunking", &Ddl_dumper_options::m_split)
           .optional("bytesPerChunk", &Ddl_dumper_options::set_bytes_per_chunk)
+          .optional("adaptiveChunking",
+                    &Ddl_dumper_options::m_adaptive_chunking)
+          .optional("stealChunks", &Ddl_dumper_options::m_steal_chunks)
+          .optional("compressionDictionary",
+                    &Ddl_dumper_options::m_compression_dictionary)
           .optional("threads", &Ddl_dumper_options::set_threads)
           .optional("triggers", &Ddl_dumper_options::m_dump_triggers)
           .optional("tzUtc", &Ddl_dumper_options::m_timezone_utc)
@@ -86,7 +122,21 @@ const shcore::Option_pack_def<Ddl_dumper_options>
                    &common::Filtering_options::triggers)
           .optional("where", &Ddl_dumper_options::set_where_clause)
           .optional("partitions", &Ddl_dumper_options::set_partitions)
+          .optional("watermarkColumns",
+                    &Ddl_dumper_options::set_watermark_columns)
+          .optional("incrementalBase",
+                    &Ddl_dumper_options::set_incremental_base_str)
+          .optional("previousDump", &Ddl_dumper_options::set_previous_dump_str)
           .optional("checksum", &Ddl_dumper_options::m_checksum)
+          .optional("streamingChecksum",
+                    &Ddl_dumper_options::m_streaming_checksum)
+          .optional("performanceReport",
+                    &Ddl_dumper_options::m_performance_report)
+          .optional("rawBinary", &Ddl_dumper_options::m_raw_binary)
+          .optional("readReplicas", &Ddl_dumper_options::set_read_replicas)
+          .optional("mirrorOutputUrls",
+                    &Ddl_dumper_options::set_mirror_output_urls)
+          .optional("mirrorMaxLag", &Ddl_dumper_options::set_mirror_max_lag)
           .include(&Ddl_dumper_options::m_dump_manifest_options)
           .include(&Ddl_dumper_options::m_s3_bucket_options)
           .include(&Ddl_dumper_options::m_blob_storage_options)
@@ -134,15 +184,17 @@ void Ddl_dumper_options::on_unpacked_options() {
   m_blob_storage_options.throw_on_conflict(m_dump_manifest_options);
 
   if (m_dump_manifest_options) {
-    set_storage_config(m_dump_manifest_options.config());
+    set_storage_config(
+        with_background_uploads(m_dump_manifest_options.config()));
   }
 
   if (m_s3_bucket_options) {
-    set_storage_config(m_s3_bucket_options.config());
+    set_storage_config(with_background_uploads(m_s3_bucket_options.config()));
   }
 
   if (m_blob_storage_options) {
-    set_storage_config(m_blob_storage_options.config());
+    set_storage_config(
+        with_background_uploads(m_blob_storage_options.config()));
   }
 
   if (m_bytes_per_chunk < expand_to_bytes(k_minimum_chunk_size)) {
@@ -152,6 +204,57 @@ void Ddl_dumper_options::on_unpacked_options() {
         std::string(k_minimum_chunk_size) + ".");
   }
 
+  if (m_adaptive_chunking && !split()) {
+    throw std::invalid_argument(
+        "The option 'adaptiveChunking' cannot be used if the 'chunking' "
+        "option is set to false.");
+  }
+
+  if (m_steal_chunks && !split()) {
+    throw std::invalid_argument(
+        "The option 'stealChunks' cannot be used if the 'chunking' option is "
+        "set to false.");
+  }
+
+  if (m_steal_chunks && m_checksum) {
+    throw std::invalid_argument(
+        "The 'stealChunks' and 'checksum' options cannot be both set to "
+        "true.");
+  }
+
+  if (m_streaming_checksum && !m_checksum) {
+    throw std::invalid_argument(
+        "The option 'streamingChecksum' cannot be used if the 'checksum' "
+        "option is set to false.");
+  }
+
+  if (m_streaming_checksum && !m_timezone_utc) {
+    throw std::invalid_argument(
+        "The option 'streamingChecksum' cannot be used if the 'tzUtc' option "
+        "is set to false.");
+  }
+
+  if (m_raw_binary) {
+    if (dialect().fields_escaped_by.empty()) {
+      throw std::invalid_argument(
+          "The option 'rawBinary' cannot be used if the 'fieldsEscapedBy' "
+          "option is set to an empty string.");
+    }
+
+    if (!is_raw_binary_safe(character_set())) {
+      throw std::invalid_argument(
+          "The option 'rawBinary' cannot be used with the '" +
+          character_set() + "' character set.");
+    }
+  }
+
+  if (m_compression_dictionary &&
+      mysqlshdk::storage::Compression::ZSTD != compression()) {
+    throw std::invalid_argument(
+        "The 'compressionDictionary' option can only be used with the 'zstd' "
+        "compression.");
+  }
+
   if (0 == m_threads) {
     throw std::invalid_argument(
         "The value of 'threads' option must be greater than 0.");
@@ -162,6 +265,39 @@ void Ddl_dumper_options::on_unpacked_options() {
         "The 'ddlOnly' and 'dataOnly' options cannot be both set to true.");
   }
 
+  if (is_incremental()) {
+    if (m_ddl_only) {
+      throw std::invalid_argument(
+          "The 'incrementalBase' option cannot be used if the 'ddlOnly' option "
+          "is set to true.");
+    }
+
+    // incremental dump contains only the rows which have changed since the
+    // base dump, DDL is expected to be already loaded
+    m_data_only = true;
+  }
+
+  if (!previous_dump().empty()) {
+    const auto incompatible = [](const char *option) {
+      throw std::invalid_argument(shcore::str_format(
+          "The 'previousDump' option cannot be used together with the '%s' "
+          "option.",
+          option));
+    };
+
+    if (m_ddl_only) {
+      incompatible("ddlOnly");
+    }
+
+    if (is_incremental()) {
+      incompatible("incrementalBase");
+    }
+
+    if (m_checksum) {
+      incompatible("checksum");
+    }
+  }
+
   if (compatibility_options().is_set(
           Compatibility_option::CREATE_INVISIBLE_PKS) &&
       compatibility_options().is_set(
@@ -191,10 +327,33 @@ void Ddl_dumper_options::set_bytes_per_chunk(const std::string &value) {
   m_bytes_per_chunk = expand_to_bytes(value);
 }
 
+void Ddl_dumper_options::set_incremental_base_str(const std::string &url) {
+  if (url.empty()) {
+    throw std::invalid_argument(
+        "The option 'incrementalBase' cannot be set to an empty string.");
+  }
+
+  set_incremental_base(url);
+}
+
+void Ddl_dumper_options::set_previous_dump_str(const std::string &url) {
+  if (url.empty()) {
+    throw std::invalid_argument(
+        "The option 'previousDump' cannot be set to an empty string.");
+  }
+
+  set_previous_dump(url);
+}
+
 void Ddl_dumper_options::enable_mds_compatibility_checks() {
   enable_mds_compatibility();
 }
 
+void Ddl_dumper_options::enable_raw_binary_if_supported() {
+  m_raw_binary = !dialect().fields_escaped_by.empty() &&
+                 is_raw_binary_safe(character_set());
+}
+
 void Ddl_dumper_options::set_dry_run(bool dry_run) {
   set_dry_run_mode(dry_run ? Dry_run::DONT_WRITE_ANY_FILES : Dry_run::DISABLED);
 }
@@ -206,6 +365,69 @@ void Ddl_dumper_options::set_threads(uint64_t threads) {
   m_worker_threads = threads;
 }
 
+void Ddl_dumper_options::set_read_replicas(
+    const std::vector<std::string> &replicas) {
+  m_read_replicas.clear();
+  m_read_replicas.reserve(replicas.size());
+
+  for (const auto &replica : replicas) {
+    try {
+      m_read_replicas.emplace_back(replica);
+    } catch (const std::exception &e) {
+      throw std::invalid_argument(
+          "Invalid value of the 'readReplicas' option, failed to parse '" +
+          replica + "': " + e.what());
+    }
+  }
+}
+
+void Ddl_dumper_options::set_mirror_output_urls(
+    const std::vector<std::string> &urls) {
+  m_mirror_outputs.clear();
+  m_mirror_outputs.reserve(urls.size());
+
+  for (const auto &url : urls) {
+    if (url.empty()) {
+      throw std::invalid_argument(
+          "The option 'mirrorOutputUrls' cannot contain an empty string.");
+    }
+
+    auto &mirror = m_mirror_outputs.emplace_back();
+    mirror.url = url;
+
+    if (const auto par = dump::common::parse_par(url);
+        par.type() != mysqlshdk::oci::PAR_type::NONE) {
+      if (par.type() != mysqlshdk::oci::PAR_type::PREFIX) {
+        throw std::invalid_argument(
+            "Invalid value of the 'mirrorOutputUrls' option, the URL '" +
+            mysqlshdk::oci::hide_par_secret(url) + "' is not a prefix PAR.");
+      }
+
+      mirror.storage_config = dump::common::get_par_config(par);
+    } else if (const auto scheme = mysqlshdk::storage::utils::get_scheme(url);
+               !scheme.empty() &&
+               !mysqlshdk::storage::utils::scheme_matches(scheme, "file")) {
+      throw std::invalid_argument(
+          "Invalid value of the 'mirrorOutputUrls' option, the URL '" + url +
+          "' uses an unsupported protocol: " + scheme + ".");
+    }
+  }
+}
+
+void Ddl_dumper_options::set_mirror_max_lag(const std::string &value) {
+  if (value.empty()) {
+    throw std::invalid_argument(
+        "The option 'mirrorMaxLag' cannot be set to an empty string.");
+  }
+
+  m_mirror_max_lag = expand_to_bytes(value);
+
+  if (0 == m_mirror_max_lag) {
+    throw std::invalid_argument(
+        "The value of the 'mirrorMaxLag' option must be greater than zero.");
+  }
+}
+
 const Object_storage_options *Ddl_dumper_options::object_storage_options()
     const {
   if (m_dump_manifest_options) {
@@ -240,6 +462,16 @@ void Ddl_dumper_options::set_output_url(const std::string &url) {
         throw std::invalid_argument("The given URL is not a prefix PAR.");
       }
     }
+  } else if (mysqlshdk::storage::backend::is_stream_archive(url)) {
+    if (const auto options = object_storage_options()) {
+      throw std::invalid_argument(shcore::str_format(
+          "The option '%s' can not be used when using a stream archive as the "
+          "target output url.",
+          options->get_main_option()));
+    }
+
+    set_storage_config(
+        mysqlshdk::storage::backend::stream_archive_writer_config(url));
   }
 
   Dump_options::set_output_url(url);
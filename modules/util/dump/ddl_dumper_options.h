@@ -30,6 +30,7 @@
 
 #include "mysqlshdk/libs/aws/s3_bucket_options.h"
 #include "mysqlshdk/libs/azure/blob_storage_options.h"
+#include "mysqlshdk/libs/db/connection_options.h"
 
 #include "modules/util/dump/dump_manifest_options.h"
 #include "modules/util/dump/dump_options.h"
@@ -56,6 +57,14 @@ class Ddl_dumper_options : public Dump_options {
 
   uint64_t bytes_per_chunk() const override { return m_bytes_per_chunk; }
 
+  bool adaptive_chunking() const override { return m_adaptive_chunking; }
+
+  bool steal_chunks() const override { return m_steal_chunks; }
+
+  bool compression_dictionary() const override {
+    return m_compression_dictionary;
+  }
+
   std::size_t threads() const override { return m_threads; }
 
   std::size_t worker_threads() const override { return m_worker_threads; }
@@ -86,7 +95,31 @@ class Ddl_dumper_options : public Dump_options {
 
   bool checksum() const override { return m_checksum; }
 
+  bool streaming_checksum() const override { return m_streaming_checksum; }
+
+  bool performance_report() const override { return m_performance_report; }
+
+  bool raw_binary() const override { return m_raw_binary; }
+
+  const std::vector<mysqlshdk::db::Connection_options> &read_replicas()
+      const override {
+    return m_read_replicas;
+  }
+
+  const std::vector<Mirror_output> &mirror_outputs() const override {
+    return m_mirror_outputs;
+  }
+
+  std::size_t mirror_max_lag() const override { return m_mirror_max_lag; }
+
   void enable_mds_compatibility_checks();
+
+  /**
+   * Stores binary columns as-is, if the dialect and the character set allow
+   * for that, otherwise they are going to be encoded.
+   */
+  void enable_raw_binary_if_supported();
+
   using Dump_options::set_target_version;
   void set_output_url(const std::string &url) override;
 
@@ -104,7 +137,12 @@ class Ddl_dumper_options : public Dump_options {
   void set_compatibility_options(const std::vector<std::string> &options);
   void set_target_version_str(const std::string &value);
   void set_dry_run(bool dry_run);
+  void set_incremental_base_str(const std::string &url);
+  void set_previous_dump_str(const std::string &url);
   void set_threads(uint64_t threads);
+  void set_read_replicas(const std::vector<std::string> &replicas);
+  void set_mirror_output_urls(const std::vector<std::string> &urls);
+  void set_mirror_max_lag(const std::string &value);
   const Object_storage_options *object_storage_options() const;
 
   Dump_manifest_options m_dump_manifest_options;
@@ -115,6 +153,9 @@ class Ddl_dumper_options : public Dump_options {
 
   bool m_split = true;
   uint64_t m_bytes_per_chunk;
+  bool m_adaptive_chunking = false;
+  bool m_steal_chunks = false;
+  bool m_compression_dictionary = false;
 
   // Number of threads requested by the user (or default)
   // At most this number of database connections will be used in the dump
@@ -131,6 +172,12 @@ class Ddl_dumper_options : public Dump_options {
   bool m_consistent_dump = true;
   bool m_skip_consistency_checks = false;
   bool m_checksum = false;
+  bool m_streaming_checksum = false;
+  bool m_performance_report = false;
+  bool m_raw_binary = false;
+  std::vector<mysqlshdk::db::Connection_options> m_read_replicas;
+  std::vector<Mirror_output> m_mirror_outputs;
+  std::size_t m_mirror_max_lag;
 };
 
 }  // namespace dump
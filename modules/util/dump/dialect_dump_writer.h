@@ -24,12 +24,15 @@
 #ifndef MODULES_UTIL_DUMP_DIALECT_DUMP_WRITER_H_
 #define MODULES_UTIL_DUMP_DIALECT_DUMP_WRITER_H_
 
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "mysqlshdk/libs/utils/find_first_of.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 
 #include "modules/util/dump/dump_writer.h"
@@ -120,8 +123,20 @@ class Dialect_dump_writer : public Dump_writer {
   }
 
   void store_row(const mysqlshdk::db::IRow *row) override {
+    const char *data = nullptr;
+    std::size_t length = 0;
+
     for (uint32_t idx = 0; idx < m_num_fields; ++idx) {
-      store_field(row, idx);
+      row->get_raw_data(idx, &data, &length);
+      store_field(idx, data, length);
+    }
+
+    finish_row();
+  }
+
+  void store_row(const Raw_row &row) override {
+    for (uint32_t idx = 0; idx < m_num_fields; ++idx) {
+      store_field(idx, row.data[idx], row.lengths[idx]);
     }
 
     finish_row();
@@ -180,15 +195,11 @@ class Dialect_dump_writer : public Dump_writer {
     buffer()->set_fixed_length(fixed_length);
   }
 
-  void store_field(const mysqlshdk::db::IRow *row, uint32_t idx) {
+  inline void store_field(uint32_t idx, const char *data, std::size_t length) {
     if (0 != idx) {
       buffer()->append_fixed(T::fields_terminated_by[0]);
     }
 
-    const char *data = nullptr;
-    std::size_t length = 0;
-    row->get_raw_data(idx, &data, &length);
-
     bool is_null = nullptr == data;
 
     if (!is_null) {
@@ -242,72 +253,68 @@ class Dialect_dump_writer : public Dump_writer {
     // FIELDS ESCAPED BY character is specified, escape the string
     buffer()->will_write(2 * length);
     const auto end = data + length;
+    auto p = data;
 
-    for (auto p = data; p != end; ++p) {
-      const auto c = *p;
-      char to_write = 0;
+    while (true) {
+      // spans which do not need to be escaped are copied in bulk
+      const auto next = find_escaped_character(p, end);
+      buffer()->append(p, next - p);
 
-      // note: this doesn't produce output consistent with SELECT .. INTO
-      // OUTFILE (i.e. tabs are escaped), but LOAD DATA INFILE handles
-      // this correctly and escaping i.e. carriage return characters helps
-      // with readability
+      if (next == end) {
+        break;
+      }
 
-      switch (c) {
-        case '\0':
-          to_write = '0';
-          break;
+      buffer()->append(T::fields_escaped_by[0]);
+      buffer()->append(escape(*next));
 
-        case '\b':
-          to_write = 'b';
-          break;
+      p = next + 1;
+    }
+  }
 
-        case '\n':
-          to_write = 'n';
-          break;
+  static inline const char *find_escaped_character(const char *p,
+                                                   const char *end) {
+    if (end - p < s_vectorized_search_min_length) {
+      while (p != end && !s_needs_escape[static_cast<unsigned char>(*p)]) {
+        ++p;
+      }
 
-        case '\r':
-          to_write = 'r';
-          break;
+      return p;
+    }
 
-        case '\t':
-          to_write = 't';
-          break;
+    return mysqlshdk::utils::find_first_of(
+        p, end, s_escaped_characters, shcore::array_size(s_escaped_characters));
+  }
 
-        case 0x1A:  // ASCII 26
-          to_write = 'Z';
-          break;
+  static inline char escape(char c) {
+    // note: this doesn't produce output consistent with SELECT .. INTO
+    // OUTFILE (i.e. tabs are escaped), but LOAD DATA INFILE handles
+    // this correctly and escaping i.e. carriage return characters helps
+    // with readability
 
-        default:
-          if (c == T::fields_escaped_by[0] || c == T::fields_terminated_by[0] ||
-              c == T::lines_terminated_by[0] || should_escape(c)) {
-            to_write = c;
-          }
-          break;
-      }
+    switch (c) {
+      case '\0':
+        return '0';
 
-      if (0 != to_write) {
-        buffer()->append(T::fields_escaped_by[0]);
-        buffer()->append(to_write);
-      } else {
-        buffer()->append(c);
-      }
-    }
-  }
+      case '\b':
+        return 'b';
 
-  inline bool should_escape(char c) {
-    return should_escape<s_fields_enclosed_by_length>(c);
-  }
+      case '\n':
+        return 'n';
 
-  template <int N, std::enable_if_t<0 == N, int> = 0>
-  inline bool should_escape(char) {
-    // FIELDS ENCLOSED BY character is not specified, nothing to do
-    return false;
-  }
+      case '\r':
+        return 'r';
 
-  template <int N, std::enable_if_t<1 == N, int> = 0>
-  inline bool should_escape(char c) {
-    // FIELDS ENCLOSED BY character is specified, escape it
-    return c == T::fields_enclosed_by[0];
+      case '\t':
+        return 't';
+
+      case 0x1A:  // ASCII 26
+        return 'Z';
+
+      default:
+        // FIELDS ESCAPED BY, FIELDS TERMINATED BY, LINES TERMINATED BY and
+        // FIELDS ENCLOSED BY characters are written as is
+        return c;
+    }
   }
 
   inline void quote_field(uint32_t idx) {
@@ -373,6 +380,34 @@ class Dialect_dump_writer : public Dump_writer {
   static constexpr size_t s_fields_enclosed_by_length =
       shcore::array_size(T::fields_enclosed_by) - 1;
 
+  // characters which need to be escaped if FIELDS ESCAPED BY character is
+  // specified, if FIELDS ENCLOSED BY character is not specified, it's going to
+  // be '\0'
+  static constexpr char s_escaped_characters[] = {
+      '\0',
+      '\b',
+      '\n',
+      '\r',
+      '\t',
+      0x1A,
+      T::fields_escaped_by[0],
+      T::fields_terminated_by[0],
+      T::lines_terminated_by[0],
+      T::fields_enclosed_by[0]};
+
+  static constexpr std::array<bool, 256> s_needs_escape = []() {
+    std::array<bool, 256> needs_escape{};
+
+    for (const auto c : s_escaped_characters) {
+      needs_escape[static_cast<unsigned char>(c)] = true;
+    }
+
+    return needs_escape;
+  }();
+
+  // shorter strings are searched using a lookup table
+  static constexpr std::ptrdiff_t s_vectorized_search_min_length = 16;
+
   uint32_t m_num_fields;
 
   // not using vectors of bool here, as they are not very efficient on access
@@ -182,7 +182,17 @@
   "Dump contains one or more invalid views. Fix them manually, or use the " \
   "'excludeTables' option to exclude them."
 
-#define SHERR_DUMP_LAST 52039
+#define SHERR_DUMP_READ_REPLICA_SYNC_TIMEOUT 52040
+#define SHERR_DUMP_READ_REPLICA_SYNC_TIMEOUT_MSG                             \
+  "Timeout while waiting for the read replica '%s' to apply the transactions " \
+  "of the source instance (%d seconds)."
+
+#define SHERR_DUMP_READ_REPLICA_ERRANT_TRANSACTIONS 52041
+#define SHERR_DUMP_READ_REPLICA_ERRANT_TRANSACTIONS_MSG                     \
+  "The read replica '%s' has executed transactions which were not executed " \
+  "by the source instance: '%s'."
+
+#define SHERR_DUMP_LAST 52041
 
 #define SHERR_DUMP_MAX 52999
 
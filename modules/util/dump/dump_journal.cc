@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/dump_journal.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+#include "modules/util/common/dump/utils.h"
+
+namespace mysqlsh {
+namespace dump {
+
+using mysqlshdk::storage::IFile;
+using mysqlshdk::storage::Mode;
+
+class Dump_journal::Tracked_file final : public IFile {
+ public:
+  Tracked_file(Dump_journal *journal, std::unique_ptr<IFile> file)
+      : m_journal(journal), m_file(std::move(file)) {}
+
+  Tracked_file(const Tracked_file &) = delete;
+  Tracked_file(Tracked_file &&) = delete;
+
+  Tracked_file &operator=(const Tracked_file &) = delete;
+  Tracked_file &operator=(Tracked_file &&) = delete;
+
+  ~Tracked_file() override = default;
+
+  void open(Mode m) override {
+    m_file->open(m);
+
+    m_written = Mode::READ != m;
+    m_recorded = false;
+    m_offset = Mode::APPEND == m ? m_file->file_size() : 0;
+    m_size = m_offset;
+  }
+
+  bool is_open() const override { return m_file->is_open(); }
+
+  int error() const override { return m_file->error(); }
+
+  void close() override {
+    m_file->close();
+
+    if (m_written && !m_recorded) {
+      m_journal->add(m_file->filename(), m_size);
+      m_recorded = true;
+    }
+  }
+
+  size_t file_size() const override { return m_file->file_size(); }
+
+  mysqlshdk::Masked_string full_path() const override {
+    return m_file->full_path();
+  }
+
+  std::string filename() const override { return m_file->filename(); }
+
+  bool exists() const override { return m_file->exists(); }
+
+  std::unique_ptr<mysqlshdk::storage::IDirectory> parent() const override {
+    return m_file->parent();
+  }
+
+  off64_t seek(off64_t offset) override {
+    m_offset = m_file->seek(offset);
+    return m_offset;
+  }
+
+  off64_t tell() const override { return m_file->tell(); }
+
+  ssize_t read(void *buffer, size_t length) override {
+    const auto bytes = m_file->read(buffer, length);
+
+    if (bytes > 0) {
+      m_offset += bytes;
+    }
+
+    return bytes;
+  }
+
+  ssize_t write(const void *buffer, size_t length) override {
+    const auto bytes = m_file->write(buffer, length);
+
+    if (bytes > 0) {
+      m_offset += bytes;
+      m_size = std::max(m_size, static_cast<std::size_t>(m_offset));
+    }
+
+    return bytes;
+  }
+
+  bool flush() override { return m_file->flush(); }
+
+  ssize_t pread(void *buffer, size_t length, off64_t offset) override {
+    return m_file->pread(buffer, length, offset);
+  }
+
+  bool supports_pread() const override { return m_file->supports_pread(); }
+
+  bool is_compressed() const override { return m_file->is_compressed(); }
+
+  bool is_local() const override { return m_file->is_local(); }
+
+  void rename(const std::string &new_name) override {
+    m_file->rename(new_name);
+
+    // file was already recorded under its old name, record the new one
+    if (m_recorded) {
+      m_journal->add(m_file->filename(), m_size);
+    }
+  }
+
+  void remove() override { m_file->remove(); }
+
+ private:
+  Dump_journal *m_journal;
+  std::unique_ptr<IFile> m_file;
+  // whether file was opened for writing
+  bool m_written = false;
+  // whether file was recorded in the journal
+  bool m_recorded = false;
+  off64_t m_offset = 0;
+  std::size_t m_size = 0;
+};
+
+Dump_journal::Dump_journal(mysqlshdk::storage::IDirectory *directory,
+                           std::chrono::milliseconds interval)
+    : m_directory(directory), m_interval(interval) {
+  m_thread = mysqlsh::spawn_scoped_thread([this]() { run(); });
+}
+
+Dump_journal::~Dump_journal() {
+  {
+    std::lock_guard lock{m_mutex};
+    m_pending.clear();
+    m_stop = true;
+  }
+
+  m_cv.notify_all();
+
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+std::unique_ptr<IFile> Dump_journal::track(std::unique_ptr<IFile> file) {
+  return std::make_unique<Tracked_file>(this, std::move(file));
+}
+
+void Dump_journal::add(const std::string &filename, std::size_t size) {
+  const auto entry = common::journal_entry(filename, size);
+
+  std::lock_guard lock{m_mutex};
+
+  if (!m_stop) {
+    m_pending += entry;
+  }
+}
+
+void Dump_journal::close() {
+  {
+    std::lock_guard lock{m_mutex};
+    m_stop = true;
+  }
+
+  m_cv.notify_all();
+
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+
+  if (m_error) {
+    std::rethrow_exception(std::exchange(m_error, nullptr));
+  }
+}
+
+uint64_t Dump_journal::last_segment() const {
+  std::lock_guard lock{m_mutex};
+  return m_last_segment;
+}
+
+void Dump_journal::run() {
+  std::unique_lock lock{m_mutex};
+
+  while (true) {
+    m_cv.wait_for(lock, m_interval, [this]() { return m_stop; });
+
+    if (m_pending.empty()) {
+      if (m_stop) {
+        break;
+      }
+
+      continue;
+    }
+
+    const auto contents = std::exchange(m_pending, {});
+    const auto segment = m_last_segment + 1;
+
+    lock.unlock();
+
+    std::exception_ptr error;
+
+    try {
+      write_segment(segment, contents);
+    } catch (const std::exception &e) {
+      log_error("Failed to write the dump journal: %s", e.what());
+      error = std::current_exception();
+    }
+
+    lock.lock();
+
+    if (error) {
+      // loader reads the segments in order, the remaining ones cannot be
+      // written
+      m_error = error;
+      m_pending.clear();
+      m_stop = true;
+      break;
+    }
+
+    m_last_segment = segment;
+  }
+}
+
+void Dump_journal::write_segment(uint64_t segment,
+                                 const std::string &contents) const {
+  const auto file =
+      m_directory->file(common::get_journal_segment_filename(segment));
+
+  file->open(Mode::WRITE);
+
+  if (file->write(contents.data(), contents.length()) !=
+      static_cast<ssize_t>(contents.length())) {
+    throw std::runtime_error("Failed to write " + file->full_path().masked());
+  }
+
+  file->close();
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_DUMP_JOURNAL_H_
+#define MODULES_UTIL_DUMP_DUMP_JOURNAL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+namespace dump {
+
+/**
+ * Records the files of a dump in the order in which they were completely
+ * written, allowing the loader to find new files without listing the whole
+ * directory.
+ *
+ * Storage backends may not support appending (i.e. object storage services),
+ * so the journal is written in numbered segments: files written since the
+ * previous segment are written to the next one by a background thread, at
+ * most once per the given interval. Segments are never modified once written.
+ */
+class Dump_journal final {
+ public:
+  Dump_journal() = delete;
+
+  /**
+   * Creates the journal.
+   *
+   * @param directory Directory where the segments are written to, needs to
+   *        outlive the journal.
+   * @param interval Minimum time between the writes of segments.
+   */
+  Dump_journal(mysqlshdk::storage::IDirectory *directory,
+               std::chrono::milliseconds interval);
+
+  Dump_journal(const Dump_journal &) = delete;
+  Dump_journal(Dump_journal &&) = delete;
+
+  Dump_journal &operator=(const Dump_journal &) = delete;
+  Dump_journal &operator=(Dump_journal &&) = delete;
+
+  /**
+   * Stops the background thread, files which were not written to a segment
+   * yet are not recorded.
+   */
+  ~Dump_journal();
+
+  /**
+   * Wraps the given file, so that it's recorded in the journal once it's
+   * written and closed, or renamed after it was written.
+   */
+  std::unique_ptr<mysqlshdk::storage::IFile> track(
+      std::unique_ptr<mysqlshdk::storage::IFile> file);
+
+  /**
+   * Records a file which was completely written. Thread-safe.
+   */
+  void add(const std::string &filename, std::size_t size);
+
+  /**
+   * Writes all the recorded files which were not written yet and stops the
+   * background thread.
+   *
+   * @throws std::exception If writing any of the segments has failed.
+   */
+  void close();
+
+  /**
+   * Number of the last segment which was written.
+   */
+  uint64_t last_segment() const;
+
+ private:
+  class Tracked_file;
+
+  void run();
+
+  void write_segment(uint64_t segment, const std::string &contents) const;
+
+  mysqlshdk::storage::IDirectory *m_directory;
+  const std::chrono::milliseconds m_interval;
+
+  // entries which were not written yet, guarded by m_mutex
+  std::string m_pending;
+  // guarded by m_mutex
+  uint64_t m_last_segment = 0;
+  // guarded by m_mutex
+  bool m_stop = false;
+  // guarded by m_mutex
+  std::exception_ptr m_error;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::thread m_thread;
+};
+
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_DUMP_JOURNAL_H_
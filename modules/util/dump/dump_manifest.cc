@@ -338,7 +338,7 @@ Manifest_writer::Manifest_writer(
             //   mean time
             if (last_count == 0 ||
                 (waited_for >= five_seconds &&
-                 last_count < m_par_cache.size()) ||
+                 last_count < m_par_count) ||
                 is_complete()) {
               last_update = std::chrono::system_clock::now();
               try {
@@ -348,7 +348,7 @@ Manifest_writer::Manifest_writer(
                     "Error flushing dump manifest: %s", error.what());
                 break;
               }
-              last_count = m_par_cache.size();
+              last_count = m_par_count;
               wait_for = five_seconds;
             } else {
               wait_for = five_seconds - waited_for;
@@ -361,20 +361,10 @@ Manifest_writer::Manifest_writer(
 void Manifest_writer::cache_par(mysqlshdk::oci::PAR &&par) {
   if (!par.name.empty()) {
     if (shcore::str_endswith(par.name, k_at_done_json)) m_complete = true;
-    m_par_cache.emplace_back(std::move(par));
-  }
-}
-
-std::string Manifest_writer::serialize() const {
-  shcore::JSON_dumper json(true);
 
-  // Starts the manifest object
-  json.start_object();
-  json.append_string("contents");
+    // manifest is rewritten periodically, serialize each entry only once
+    shcore::JSON_dumper json;
 
-  // Starts the contents array
-  json.start_array();
-  for (const auto &par : m_par_cache) {
     json.start_object();
     json.append_string("parId");
     json.append_string(par.id);
@@ -383,11 +373,21 @@ std::string Manifest_writer::serialize() const {
     json.append_string("objectName");
     json.append_string(par.object_name);
     json.append_string("objectSize");
-    json.append_int(static_cast<int>(par.size));
+    json.append_uint64(par.size);
     json.end_object();
+
+    if (m_par_count++) {
+      m_serialized_pars += ',';
+    }
+
+    m_serialized_pars += json.str();
   }
-  // contents array
-  json.end_array();
+}
+
+std::string Manifest_writer::serialize() const {
+  shcore::JSON_dumper json;
+
+  json.start_object();
   auto last_update = shcore::current_time_rfc3339();
   json.append_string("expireTime");
   json.append_string(m_par_expire_time);
@@ -399,16 +399,25 @@ std::string Manifest_writer::serialize() const {
     json.append_string("endTime");
     json.append_string(last_update);
   }
-
-  // Ends the manifest object
   json.end_object();
 
-  return json.str();
+  const auto &fields = json.str();
+  std::string manifest;
+  manifest.reserve(m_serialized_pars.length() + fields.length() + 16);
+
+  // contents array holds the already serialized entries, remaining fields of
+  // the manifest object follow it
+  manifest += R"({"contents":[)";
+  manifest += m_serialized_pars;
+  manifest += "],";
+  manifest.append(fields, 1);
+
+  return manifest;
 }
 
 void Manifest_writer::flush() {
   // Avoids creating an empty manifest file
-  if (m_par_cache.empty()) return;
+  if (0 == m_par_count) return;
 
   std::string data = serialize();
 
@@ -471,7 +480,7 @@ void Manifest_reader::unserialize(const std::string &data) {
     m_objects.emplace(
         std::move(object_name),
         File_info{entry->get_string("parUrl"),
-                  static_cast<size_t>(entry->get_int("objectSize"))});
+                  static_cast<size_t>(entry->get_uint("objectSize"))});
 
     // When the @.done.json is found on the manifest, it's fully loaded
     if (done_found) m_complete = true;
@@ -95,7 +95,9 @@ class Manifest_writer final : public Manifest_base {
 
  private:
   std::string m_par_expire_time;
-  std::vector<mysqlshdk::oci::PAR> m_par_cache;
+  // entries of the contents array, each PAR is serialized once it arrives
+  std::string m_serialized_pars;
+  std::size_t m_par_count = 0;
   std::unique_ptr<std::thread> m_par_thread;
   std::string m_par_thread_error;
   std::string m_start_time;
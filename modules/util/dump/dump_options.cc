@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 
 #include "modules/util/common/dump/utils.h"
 #include "mysqlshdk/include/scripting/type_info/custom.h"
@@ -54,8 +55,18 @@ const shcore::Option_pack_def<Dump_options> &Dump_options::options() {
       shcore::Option_pack_def<Dump_options>()
           .on_start(&Dump_options::on_start_unpack)
           .optional("maxRate", &Dump_options::set_string_option)
+          .optional("maxTotalRate", &Dump_options::set_string_option)
           .optional("showProgress", &Dump_options::m_show_progress)
+          .optional("progressFormat", &Dump_options::m_progress_format,
+                    {{"text", Progress_format::TEXT},
+                     {"jsonl", Progress_format::JSONL}})
+          .optional("progressFd", &Dump_options::set_progress_fd)
+          .optional("pipelinedFetch", &Dump_options::m_pipelined_fetch)
+          .optional("sessionCompression", &Dump_options::set_string_option)
+          .optional("dropPageCache", &Dump_options::m_drop_page_cache)
           .optional("compression", &Dump_options::set_string_option)
+          .optional("compressionThreads",
+                    &Dump_options::set_compression_threads)
           .optional("defaultCharacterSet", &Dump_options::m_character_set)
           .include(&Dump_options::m_dialect_unpacker)
           .on_done(&Dump_options::on_unpacked_options)
@@ -79,19 +90,43 @@ void Dump_options::set_string_option(const std::string &option,
     if (!value.empty()) {
       m_max_rate = mysqlshdk::utils::expand_to_bytes(value);
     }
+  } else if (option == "maxTotalRate") {
+    if (!value.empty()) {
+      if (const auto rate = mysqlshdk::utils::expand_to_bytes(value);
+          rate > 0) {
+        m_total_rate_limit =
+            std::make_shared<mysqlshdk::utils::Shared_rate_limit>(rate);
+      }
+    }
   } else if (option == "compression") {
     if (value.empty()) {
       throw std::invalid_argument(
           "The option 'compression' cannot be set to an empty string.");
     }
 
-    m_compression = mysqlshdk::storage::to_compression(value);
+    m_compression =
+        mysqlshdk::storage::to_compression(value, &m_compression_options);
+  } else if (option == "sessionCompression") {
+    m_session_compression = common::to_session_compression(value);
   } else {
     // This function should only be called with the options above.
     assert(false);
   }
 }
 
+void Dump_options::set_compression_threads(uint64_t threads) {
+  if (threads > static_cast<uint64_t>(std::numeric_limits<int>::max())) {
+    throw std::invalid_argument(
+        "The value of 'compressionThreads' option is too big.");
+  }
+
+  m_compression_options.threads = static_cast<int>(threads);
+}
+
+void Dump_options::set_progress_fd(int64_t fd) {
+  m_progress_fd = to_progress_fd(fd);
+}
+
 void Dump_options::set_storage_config(
     std::shared_ptr<mysqlshdk::storage::Config> storage_config) {
   m_storage_config = std::move(storage_config);
@@ -114,6 +149,21 @@ void Dump_options::on_unpacked_options() {
   if (import_table::Dialect::json() == dialect()) {
     throw std::invalid_argument("The 'json' dialect is not supported.");
   }
+
+  if (m_compression_options.threads > 0 &&
+      mysqlshdk::storage::Compression::ZSTD != m_compression &&
+      mysqlshdk::storage::Compression::GZIP != m_compression) {
+    throw std::invalid_argument(
+        "The 'compressionThreads' option can only be used with the 'zstd' or "
+        "'gzip' compression.");
+  }
+
+  if (m_progress_fd.has_value() &&
+      Progress_format::JSONL != m_progress_format) {
+    throw std::invalid_argument(
+        "The 'progressFd' option requires the 'progressFormat' option to be "
+        "set to 'jsonl'.");
+  }
 }
 
 void Dump_options::validate() const {
@@ -130,6 +180,26 @@ void Dump_options::validate() const {
 
   validate_partitions();
 
+  if (Data_format::PARQUET == m_data_format &&
+      !(import_table::Dialect::default_() == dialect())) {
+    throw std::invalid_argument(
+        "The 'dialect' and 'fields*'/'lines*' options cannot be used if the "
+        "'format' option is set to 'parquet'.");
+  }
+
+  if (Data_format::PARQUET == m_data_format &&
+      mysqlshdk::storage::Compression::LZ4 == m_compression) {
+    throw std::invalid_argument(
+        "The 'lz4' compression cannot be used if the 'format' option is set "
+        "to 'parquet'.");
+  }
+
+  if (Data_format::PARQUET == m_data_format && compression_dictionary()) {
+    throw std::invalid_argument(
+        "The 'compressionDictionary' option cannot be used if the 'format' "
+        "option is set to 'parquet'.");
+  }
+
   validate_options();
 }
 
@@ -238,6 +308,29 @@ void Dump_options::set_where_clause(const std::string &schema,
   m_where[schema][table] = '(' + where + ')';
 }
 
+void Dump_options::set_watermark_columns(
+    const std::map<std::string, std::string> &columns) {
+  std::string schema;
+  std::string table;
+
+  for (const auto &c : columns) {
+    schema.clear();
+    table.clear();
+
+    common::parse_schema_and_object(
+        c.first, "table name key of the 'watermarkColumns' option", "table",
+        &schema, &table);
+
+    if (c.second.empty()) {
+      throw std::invalid_argument(
+          "The watermark column of table '" + schema + "'.'" + table +
+          "' given in the 'watermarkColumns' option cannot be empty.");
+    }
+
+    m_watermark_columns[schema][table] = c.second;
+  }
+}
+
 void Dump_options::set_partitions(
     const std::map<std::string, std::unordered_set<std::string>> &partitions) {
   std::string schema;
@@ -284,6 +377,25 @@ const std::string &Dump_options::where(const std::string &schema,
   return t->second;
 }
 
+const std::string &Dump_options::watermark_column(
+    const std::string &schema, const std::string &table) const {
+  static std::string def;
+
+  const auto s = m_watermark_columns.find(schema);
+
+  if (m_watermark_columns.end() == s) {
+    return def;
+  }
+
+  const auto t = s->second.find(table);
+
+  if (s->second.end() == t) {
+    return def;
+  }
+
+  return t->second;
+}
+
 void Dump_options::validate_partitions() const {
   bool valid = true;
   const auto console = current_console();
@@ -32,18 +32,23 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "mysqlshdk/include/scripting/types.h"
 #include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/config.h"
+#include "mysqlshdk/libs/utils/rate_limit.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/version.h"
 
 #include "modules/util/common/dump/filtering_options.h"
+#include "modules/util/common/dump/session_compression.h"
 #include "modules/util/dump/compatibility_option.h"
 #include "modules/util/dump/instance_cache.h"
+#include "modules/util/dump/progress_thread.h"
 #include "modules/util/import_table/dialect.h"
 
 namespace mysqlsh {
@@ -55,8 +60,21 @@ enum class Dry_run {
   DONT_WRITE_ANY_FILES,
 };
 
+enum class Data_format {
+  TEXT,
+  PARQUET,
+};
+
 class Dump_options {
  public:
+  /**
+   * Location which receives a copy of the dump.
+   */
+  struct Mirror_output {
+    std::string url;
+    mysqlshdk::storage::Config_ptr storage_config;
+  };
+
   Dump_options();
 
   Dump_options(const Dump_options &) = default;
@@ -100,16 +118,53 @@ class Dump_options {
 
   int64_t max_rate() const { return m_max_rate; }
 
+  /**
+   * Limit shared by all the threads, not set if there's no limit.
+   */
+  const std::shared_ptr<mysqlshdk::utils::Shared_rate_limit>
+      &total_rate_limit() const {
+    return m_total_rate_limit;
+  }
+
   bool show_progress() const { return m_show_progress; }
 
+  Progress_format progress_format() const { return m_progress_format; }
+
+  /**
+   * File descriptor the progress events are written to, used if progress
+   * format is JSONL.
+   */
+  int progress_fd() const { return m_progress_fd.value_or(2); }
+
+  bool pipelined_fetch() const { return m_pipelined_fetch; }
+
+  /**
+   * Protocol compression of the worker sessions.
+   */
+  common::Session_compression session_compression() const {
+    return m_session_compression;
+  }
+
+  /**
+   * Whether local files which were written should be evicted from the page
+   * cache.
+   */
+  bool drop_page_cache() const { return m_drop_page_cache; }
+
   mysqlshdk::storage::Compression compression() const { return m_compression; }
 
+  const mysqlshdk::storage::Compression_options &compression_options() const {
+    return m_compression_options;
+  }
+
   const std::shared_ptr<mysqlshdk::db::ISession> &session() const {
     return m_session;
   }
 
   const import_table::Dialect &dialect() const { return m_dialect; }
 
+  Data_format data_format() const { return m_data_format; }
+
   const mysqlshdk::storage::Config_ptr &storage_config() const {
     return m_storage_config;
   }
@@ -144,6 +199,19 @@ class Dump_options {
   const std::string &where(const std::string &schema,
                            const std::string &table) const;
 
+  bool has_where() const { return !m_where.empty(); }
+
+  const std::string &watermark_column(const std::string &schema,
+                                      const std::string &table) const;
+
+  bool has_watermark_columns() const { return !m_watermark_columns.empty(); }
+
+  const std::string &incremental_base() const { return m_incremental_base; }
+
+  bool is_incremental() const { return !m_incremental_base.empty(); }
+
+  const std::string &previous_dump() const { return m_previous_dump; }
+
   Dry_run dry_run_mode() const { return m_dry_run_mode; }
 
   bool is_dry_run() const { return Dry_run::DISABLED != m_dry_run_mode; }
@@ -156,6 +224,12 @@ class Dump_options {
 
   virtual uint64_t bytes_per_chunk() const = 0;
 
+  virtual bool adaptive_chunking() const { return false; }
+
+  virtual bool steal_chunks() const { return false; }
+
+  virtual bool compression_dictionary() const { return false; }
+
   virtual std::size_t threads() const = 0;
 
   virtual std::size_t worker_threads() const { return threads(); }
@@ -188,6 +262,39 @@ class Dump_options {
 
   virtual bool checksum() const = 0;
 
+  virtual bool streaming_checksum() const { return false; }
+
+  virtual bool performance_report() const { return false; }
+
+  virtual bool raw_binary() const { return false; }
+
+  /**
+   * Replicas of the source instance which are used to read the table data.
+   */
+  virtual const std::vector<mysqlshdk::db::Connection_options> &read_replicas()
+      const {
+    static const std::vector<mysqlshdk::db::Connection_options> k_none;
+    return k_none;
+  }
+
+  /**
+   * Additional locations which receive a copy of each file of the dump.
+   */
+  virtual const std::vector<Mirror_output> &mirror_outputs() const {
+    static const std::vector<Mirror_output> k_none;
+    return k_none;
+  }
+
+  /**
+   * Maximum number of bytes which can be buffered for each mirrored file.
+   */
+  virtual std::size_t mirror_max_lag() const { return 0; }
+
+  /**
+   * Data of the tables is dumped by copying their tablespace files.
+   */
+  virtual bool physical() const { return false; }
+
  protected:
   void enable_mds_compatibility() { m_is_mds = true; }
 
@@ -203,6 +310,15 @@ class Dump_options {
   void set_where_clause(const std::string &schema, const std::string &table,
                         const std::string &where);
 
+  void set_watermark_columns(
+      const std::map<std::string, std::string> &columns);
+
+  void set_incremental_base(const std::string &url) {
+    m_incremental_base = url;
+  }
+
+  void set_previous_dump(const std::string &url) { m_previous_dump = url; }
+
   void set_partitions(
       const std::map<std::string, std::unordered_set<std::string>> &partitions);
 
@@ -225,6 +341,9 @@ class Dump_options {
 
   mutable bool m_filter_conflicts = false;
 
+  // currently used by dumpTables() and exportTable()
+  Data_format m_data_format = Data_format::TEXT;
+
  protected:
   void on_start_unpack(const shcore::Dictionary_t &options);
 
@@ -242,6 +361,10 @@ class Dump_options {
 
   void set_string_option(const std::string &option, const std::string &value);
 
+  void set_compression_threads(uint64_t threads);
+
+  void set_progress_fd(int64_t fd);
+
   std::set<std::string> find_missing_impl(
       const std::string &subquery,
       const std::unordered_set<std::string> &objects) const;
@@ -260,9 +383,17 @@ class Dump_options {
 
   // common options
   int64_t m_max_rate = 0;
+  std::shared_ptr<mysqlshdk::utils::Shared_rate_limit> m_total_rate_limit;
   bool m_show_progress;
+  Progress_format m_progress_format = Progress_format::TEXT;
+  std::optional<int> m_progress_fd;
+  bool m_pipelined_fetch = false;
+  common::Session_compression m_session_compression =
+      common::Session_compression::AUTO;
+  bool m_drop_page_cache = false;
   mysqlshdk::storage::Compression m_compression =
       mysqlshdk::storage::Compression::ZSTD;
+  mysqlshdk::storage::Compression_options m_compression_options;
   mysqlshdk::storage::Config_ptr m_storage_config;
 
   std::string m_character_set = "utf8mb4";
@@ -280,6 +411,16 @@ class Dump_options {
   std::unordered_map<std::string, std::unordered_map<std::string, std::string>>
       m_where;
 
+  // schema -> table -> watermark column
+  std::unordered_map<std::string, std::unordered_map<std::string, std::string>>
+      m_watermark_columns;
+
+  // location of the dump used as a base of an incremental dump
+  std::string m_incremental_base;
+
+  // location of the dump whose data files are reused for unchanged tables
+  std::string m_previous_dump;
+
   // schema -> table -> partitions
   Instance_cache_builder::Partition_filters m_partitions;
 
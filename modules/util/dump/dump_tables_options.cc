@@ -27,6 +27,8 @@
 
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlsh {
@@ -38,6 +40,10 @@ const shcore::Option_pack_def<Dump_tables_options>
       shcore::Option_pack_def<Dump_tables_options>()
           .include<Ddl_dumper_options>()
           .optional("all", &Dump_tables_options::m_dump_all)
+          .optional("format", &Dump_tables_options::m_data_format,
+                    {{"text", Data_format::TEXT},
+                     {"parquet", Data_format::PARQUET}})
+          .optional("physical", &Dump_tables_options::m_physical)
           .on_log(&Dump_tables_options::on_log_options);
 
   return opts;
@@ -94,6 +100,70 @@ void Dump_tables_options::validate_options() const {
           }));
     }
   }
+
+  if (m_physical) {
+    validate_physical();
+  }
+}
+
+void Dump_tables_options::validate_physical() const {
+  const auto incompatible = [](const char *option) {
+    throw std::invalid_argument(shcore::str_format(
+        "The '%s' option cannot be used if the 'physical' option is set to "
+        "true.",
+        option));
+  };
+
+  if (Data_format::PARQUET == data_format()) {
+    incompatible("format");
+  }
+
+  if (has_where()) {
+    incompatible("where");
+  }
+
+  if (!included_partitions().empty()) {
+    incompatible("partitions");
+  }
+
+  if (is_incremental()) {
+    incompatible("incrementalBase");
+  }
+
+  if (!previous_dump().empty()) {
+    incompatible("previousDump");
+  }
+
+  if (mds_compatibility()) {
+    incompatible("ocimds");
+  }
+
+  if (!compatibility_options().empty()) {
+    incompatible("compatibility");
+  }
+
+  if (checksum()) {
+    incompatible("checksum");
+  }
+
+  if (!dump_ddl()) {
+    incompatible("dataOnly");
+  }
+
+  if (session()) {
+    // tablespace files are read directly from the data directory
+    const auto datadir = session()
+                             ->query("SELECT @@datadir")
+                             ->fetch_one_or_throw()
+                             ->get_string(0);
+
+    if (!shcore::is_folder(datadir)) {
+      throw std::invalid_argument(
+          "The data directory of the server '" + datadir +
+          "' is not accessible, the 'physical' option requires the shell to "
+          "run on the same host as the server.");
+    }
+  }
 }
 
 }  // namespace dump
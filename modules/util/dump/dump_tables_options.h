@@ -57,11 +57,16 @@ class Dump_tables_options : public Ddl_dumper_options {
 
   bool dump_users() const override { return false; }
 
+  bool physical() const override { return m_physical; }
+
  private:
   void validate_options() const override;
 
+  void validate_physical() const;
+
   bool m_dump_all = false;
   bool m_has_tables = false;
+  bool m_physical = false;
 
   std::string m_schema;
 
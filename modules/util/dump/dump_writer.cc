@@ -23,13 +23,19 @@
 
 #include "modules/util/dump/dump_writer.h"
 
+#include <condition_variable>
 #include <exception>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <utility>
+#include <vector>
 
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
 
+#include "modules/util/common/dump/constants.h"
 #include "modules/util/dump/dump_errors.h"
 
 namespace mysqlsh {
@@ -48,6 +54,7 @@ Dump_write_result &Dump_write_result::operator+=(const Dump_write_result &rhs) {
   m_data_bytes += rhs.m_data_bytes;
   m_bytes_written += rhs.m_bytes_written;
   m_rows_written += rhs.m_rows_written;
+  m_write_time += rhs.m_write_time;
 
   return *this;
 }
@@ -99,6 +106,7 @@ void Dump_writer::Buffer::resize(std::size_t requested_capacity) {
     m_capacity = new_capacity;
     m_data = std::move(new_data);
     m_ptr = m_data.get() + m_length;
+    m_memory.resize(new_capacity);
   }
 }
 
@@ -130,8 +138,273 @@ void Dump_writer::Buffer::write_base64_data(const char *data,
   }
 }
 
+/**
+ * Double buffer: rows are appended to one buffer, while the other one is
+ * written to the output file by a background thread.
+ *
+ * Checkpoints are recorded at the current position of the buffer which is
+ * being filled, the background thread ends the compression frame and writes
+ * the checkpoint to the index file once all the preceding data is written,
+ * so that the caller doesn't have to wait for the write in progress.
+ */
+class Dump_writer::Async_writer final {
+ public:
+  explicit Async_writer(std::size_t size)
+      : m_size(size),
+        m_filling(std::make_unique<Buffer>()),
+        m_writing(std::make_unique<Buffer>()) {
+    m_filling->will_write(m_size);
+    m_writing->will_write(m_size);
+  }
+
+  Async_writer(const Async_writer &) = delete;
+  Async_writer(Async_writer &&) = delete;
+
+  Async_writer &operator=(const Async_writer &) = delete;
+  Async_writer &operator=(Async_writer &&) = delete;
+
+  ~Async_writer() {
+    {
+      std::lock_guard lock{m_mutex};
+      m_stop = true;
+    }
+
+    m_cv.notify_all();
+
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+  }
+
+  /**
+   * Appends data to the buffer, returns true if it's full.
+   */
+  bool append(const char *data, std::size_t length) {
+    m_filling->will_write(length);
+    m_filling->append(data, length);
+    return m_filling->length() >= m_size;
+  }
+
+  /**
+   * Records a checkpoint at the current position of the buffer.
+   */
+  void checkpoint(uint64_t rows_written, uint64_t data_offset) {
+    m_filling_checkpoints.emplace_back(
+        Checkpoint{m_filling->length(), rows_written, data_offset});
+  }
+
+  /**
+   * Waits for the previous write, then hands the current buffer to the
+   * background thread.
+   */
+  void flush(IFile *output, mysqlshdk::storage::Compressed_file *compressed,
+             IFile *index, bool measure_write_time) {
+    if (0 == m_filling->length() && m_filling_checkpoints.empty()) {
+      return;
+    }
+
+    {
+      std::unique_lock lock{m_mutex};
+      wait(&lock);
+
+      std::swap(m_filling, m_writing);
+      std::swap(m_filling_checkpoints, m_writing_checkpoints);
+      m_output = output;
+      m_compressed = compressed;
+      m_index = index;
+      m_measure_write_time = measure_write_time;
+      m_pending = true;
+    }
+
+    m_filling->clear();
+    m_filling_checkpoints.clear();
+
+    if (!m_thread.joinable()) {
+      m_thread = mysqlsh::spawn_scoped_thread([this]() { run(); });
+    }
+
+    m_cv.notify_all();
+  }
+
+  /**
+   * Waits for the background write to finish, returns bytes written and time
+   * spent since the last call.
+   */
+  Dump_write_result wait() {
+    std::unique_lock lock{m_mutex};
+    wait(&lock);
+
+    return take_completed();
+  }
+
+  /**
+   * Returns bytes written and time spent since the last call, doesn't wait.
+   */
+  Dump_write_result completed() {
+    std::lock_guard lock{m_mutex};
+
+    if (m_error) {
+      std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+
+    return take_completed();
+  }
+
+  /**
+   * Waits for the background write to finish, errors are reported by the
+   * subsequent calls.
+   */
+  void wait_idle() noexcept {
+    std::unique_lock lock{m_mutex};
+    m_cv.wait(lock, [this]() { return !m_pending; });
+  }
+
+  void discard() noexcept {
+    m_filling->clear();
+    m_filling_checkpoints.clear();
+
+    std::unique_lock lock{m_mutex};
+    m_cv.wait(lock, [this]() { return !m_pending; });
+    m_error = nullptr;
+  }
+
+ private:
+  void wait(std::unique_lock<std::mutex> *lock) {
+    m_cv.wait(*lock, [this]() { return !m_pending; });
+
+    if (m_error) {
+      std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+  }
+
+  Dump_write_result take_completed() {
+    Dump_write_result result;
+    std::swap(result, m_completed);
+    return result;
+  }
+
+  void run() {
+    std::unique_lock lock{m_mutex};
+
+    while (true) {
+      m_cv.wait(lock, [this]() { return m_pending || m_stop; });
+
+      if (!m_pending) {
+        break;
+      }
+
+      lock.unlock();
+
+      Dump_write_result result;
+      std::exception_ptr error;
+
+      try {
+        write(&result);
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      lock.lock();
+
+      m_completed += result;
+      m_error = error;
+      m_pending = false;
+
+      m_cv.notify_all();
+    }
+  }
+
+  struct Checkpoint {
+    std::size_t position;
+    uint64_t rows_written;
+    uint64_t data_offset;
+  };
+
+  void write(Dump_write_result *result) {
+    const auto started = m_measure_write_time
+                             ? std::chrono::steady_clock::now()
+                             : std::chrono::steady_clock::time_point{};
+    std::size_t position = 0;
+
+    for (const auto &checkpoint : m_writing_checkpoints) {
+      write(position, checkpoint.position, result);
+      position = checkpoint.position;
+
+      if (m_compressed) {
+        // data written after the checkpoint needs to be in a separate frame
+        m_compressed->end_frame();
+        written(m_compressed->latest_io_size(), result);
+      }
+
+      const uint64_t entry[] = {
+          mysqlshdk::utils::host_to_network(checkpoint.rows_written),
+          mysqlshdk::utils::host_to_network(m_compressed_offset),
+          mysqlshdk::utils::host_to_network(checkpoint.data_offset),
+      };
+      m_index->write(entry, sizeof(entry));
+    }
+
+    write(position, m_writing->length(), result);
+
+    if (m_measure_write_time) {
+      result->write_time(std::chrono::steady_clock::now() - started);
+    }
+  }
+
+  void write(std::size_t begin, std::size_t end, Dump_write_result *result) {
+    if (begin == end) {
+      return;
+    }
+
+    const auto bytes_written =
+        m_output->write(m_writing->data() + begin, end - begin);
+
+    if (bytes_written < 0) {
+      THROW_ERROR(SHERR_DUMP_DW_WRITE_FAILED, "rows",
+                  m_output->full_path().masked().c_str());
+    }
+
+    written(m_compressed ? m_compressed->latest_io_size() : bytes_written,
+            result);
+  }
+
+  void written(uint64_t bytes, Dump_write_result *result) {
+    result->write_bytes(bytes);
+    m_compressed_offset += bytes;
+  }
+
+  const std::size_t m_size;
+
+  std::unique_ptr<Buffer> m_filling;
+  std::unique_ptr<Buffer> m_writing;
+
+  std::vector<Checkpoint> m_filling_checkpoints;
+  std::vector<Checkpoint> m_writing_checkpoints;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::thread m_thread;
+  bool m_pending = false;
+  bool m_stop = false;
+
+  IFile *m_output = nullptr;
+  mysqlshdk::storage::Compressed_file *m_compressed = nullptr;
+  IFile *m_index = nullptr;
+  bool m_measure_write_time = false;
+
+  // accessed only by the background thread
+  uint64_t m_compressed_offset = 0;
+
+  Dump_write_result m_completed;
+  std::exception_ptr m_error;
+};
+
 Dump_writer::Dump_writer() : m_buffer(std::make_unique<Buffer>()) {}
 
+Dump_writer::Dump_writer(Dump_writer &&) = default;
+
+Dump_writer &Dump_writer::operator=(Dump_writer &&) = default;
+
 Dump_writer::~Dump_writer() {
   try {
     close();
@@ -140,6 +413,16 @@ Dump_writer::~Dump_writer() {
   }
 }
 
+void Dump_writer::buffer_writes(std::size_t size) {
+  m_async_writer = size ? std::make_unique<Async_writer>(size) : nullptr;
+}
+
+void Dump_writer::discard_writes() noexcept {
+  if (m_async_writer) {
+    m_async_writer->discard();
+  }
+}
+
 void Dump_writer::set_output_file(mysqlshdk::storage::IFile *output) {
   m_output = output;
   m_compressed = dynamic_cast<mysqlshdk::storage::Compressed_file *>(m_output);
@@ -153,10 +436,24 @@ void Dump_writer::set_index_file(
 void Dump_writer::open() {
   if (m_index && !m_index->is_open()) {
     m_index->open(Mode::WRITE);
+
+    // checkpoints are written if it's possible to seek to them
+    m_write_checkpoints = !m_compressed || m_compressed->supports_frames();
+
+    if (m_write_checkpoints) {
+      const auto marker = mysqlshdk::utils::host_to_network(
+          common::k_index_checkpoints_marker);
+      m_index->write(&marker, sizeof(uint64_t));
+    }
   }
 }
 
 void Dump_writer::close() {
+  if (m_async_writer) {
+    // checkpoints are written to the index file by the background thread
+    m_async_writer->wait_idle();
+  }
+
   if (m_index && m_index->is_open()) {
     // write the total uncompressed size
     write_index();
@@ -175,13 +472,29 @@ Dump_write_result Dump_writer::write_preamble(
 Dump_write_result Dump_writer::write_row(const mysqlshdk::db::IRow *row) {
   buffer()->clear();
   store_row(row);
+  return write_row_buffer();
+}
+
+Dump_write_result Dump_writer::write_row(const Raw_row &row) {
+  buffer()->clear();
+  store_row(row);
+  return write_row_buffer();
+}
+
+Dump_write_result Dump_writer::write_row_buffer() {
   auto result = write_buffer("row", true);
 
   m_bytes_written += result.data_bytes();
   m_bytes_written_per_idx += result.data_bytes();
+  ++m_rows_written;
 
   if (m_index && m_bytes_written_per_idx >= k_write_idx_every) {
-    write_index();
+    if (m_write_checkpoints) {
+      write_checkpoint(&result);
+    } else {
+      write_index();
+    }
+
     // make sure offsets are written when close to the k_write_idx_every
     m_bytes_written_per_idx %= k_write_idx_every;
   }
@@ -192,11 +505,14 @@ Dump_write_result Dump_writer::write_row(const mysqlshdk::db::IRow *row) {
 Dump_write_result Dump_writer::write_postamble() {
   buffer()->clear();
   store_postamble();
-  return write_buffer("postamble");
+
+  auto result = write_buffer("postamble");
+  flush_writes(&result);
+
+  return result;
 }
 
-Dump_write_result Dump_writer::write_buffer(const char *context,
-                                            bool row) const {
+Dump_write_result Dump_writer::write_buffer(const char *context, bool row) {
   assert(m_output);
 
   Dump_write_result result;
@@ -207,10 +523,24 @@ Dump_write_result Dump_writer::write_buffer(const char *context,
     result.write_row();
   }
 
-  if (result.data_bytes() > 0) {
+  if (m_async_writer) {
+    if (m_async_writer->append(buffer()->data(), result.data_bytes())) {
+      m_async_writer->flush(m_output, m_compressed, m_index.get(),
+                            m_measure_write_time);
+    }
+
+    result += m_async_writer->completed();
+  } else if (result.data_bytes() > 0) {
+    const auto started = m_measure_write_time
+                             ? std::chrono::steady_clock::now()
+                             : std::chrono::steady_clock::time_point{};
     const auto bytes_written =
         m_output->write(buffer()->data(), result.data_bytes());
 
+    if (m_measure_write_time) {
+      result.write_time(std::chrono::steady_clock::now() - started);
+    }
+
     if (bytes_written < 0) {
       THROW_ERROR(SHERR_DUMP_DW_WRITE_FAILED, context,
                   m_output->full_path().masked().c_str());
@@ -220,6 +550,9 @@ Dump_write_result Dump_writer::write_buffer(const char *context,
                                     : bytes_written);
   }
 
+  m_data_offset += result.data_bytes();
+  m_compressed_offset += result.bytes_written();
+
   return result;
 }
 
@@ -231,5 +564,53 @@ void Dump_writer::write_index() {
   m_index->write(&offset, sizeof(uint64_t));
 }
 
+void Dump_writer::write_checkpoint(Dump_write_result *result) {
+  assert(m_index);
+
+  if (m_async_writer) {
+    // frame is ended once all the data written so far is in the current one
+    m_async_writer->checkpoint(m_rows_written, m_data_offset);
+    return;
+  }
+
+  if (m_compressed) {
+    const auto started = m_measure_write_time
+                             ? std::chrono::steady_clock::now()
+                             : std::chrono::steady_clock::time_point{};
+
+    // data written after the checkpoint needs to be in a separate frame
+    m_compressed->end_frame();
+
+    if (m_measure_write_time) {
+      result->write_time(std::chrono::steady_clock::now() - started);
+    }
+
+    const auto bytes = m_compressed->latest_io_size();
+    result->write_bytes(bytes);
+    m_compressed_offset += bytes;
+  }
+
+  const uint64_t checkpoint[] = {
+      mysqlshdk::utils::host_to_network(m_rows_written),
+      mysqlshdk::utils::host_to_network(m_compressed_offset),
+      mysqlshdk::utils::host_to_network(m_data_offset),
+  };
+  m_index->write(checkpoint, sizeof(checkpoint));
+}
+
+void Dump_writer::flush_writes(Dump_write_result *result) {
+  if (!m_async_writer) {
+    return;
+  }
+
+  m_async_writer->flush(m_output, m_compressed, m_index.get(),
+                        m_measure_write_time);
+
+  const auto written = m_async_writer->wait();
+  result->write_bytes(written.bytes_written());
+  result->write_time(written.write_time());
+  m_compressed_offset += written.bytes_written();
+}
+
 }  // namespace dump
 }  // namespace mysqlsh
@@ -25,6 +25,7 @@
 #define MODULES_UTIL_DUMP_DUMP_WRITER_H_
 
 #include <cassert>
+#include <chrono>
 #include <cstring>
 #include <memory>
 #include <string>
@@ -34,6 +35,7 @@
 #include "mysqlshdk/libs/db/row.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/memory_stats.h"
 
 namespace mysqlsh {
 namespace dump {
@@ -54,7 +56,10 @@ class Dump_write_result final {
 
   Dump_write_result &operator+=(const Dump_write_result &rhs);
 
-  void reset() noexcept { m_data_bytes = m_bytes_written = m_rows_written = 0; }
+  void reset() noexcept {
+    m_data_bytes = m_bytes_written = m_rows_written = 0;
+    m_write_time = {};
+  }
 
   void write_data(uint64_t bytes) noexcept { m_data_bytes += bytes; }
 
@@ -68,23 +73,45 @@ class Dump_write_result final {
 
   uint64_t rows_written() const noexcept { return m_rows_written; }
 
+  void write_time(std::chrono::steady_clock::duration time) noexcept {
+    m_write_time += time;
+  }
+
+  /**
+   * Time spent writing to the output file, including compression. Measured
+   * only if requested by Dump_writer::measure_write_time().
+   */
+  std::chrono::steady_clock::duration write_time() const noexcept {
+    return m_write_time;
+  }
+
  private:
   uint64_t m_data_bytes = 0;
   uint64_t m_bytes_written = 0;
   uint64_t m_rows_written = 0;
+  std::chrono::steady_clock::duration m_write_time{};
 };
 
 class Dump_writer {
  public:
   enum class Encoding_type { NONE, BASE64, HEX };
 
+  /**
+   * Row as returned by the classic protocol client library, holds values of
+   * all the fields (nullptr if value is NULL) and their lengths.
+   */
+  struct Raw_row {
+    const char *const *data;
+    const unsigned long *lengths;
+  };
+
   Dump_writer();
 
   Dump_writer(const Dump_writer &) = delete;
-  Dump_writer(Dump_writer &&) = default;
+  Dump_writer(Dump_writer &&);
 
   Dump_writer &operator=(const Dump_writer &) = delete;
-  Dump_writer &operator=(Dump_writer &&) = default;
+  Dump_writer &operator=(Dump_writer &&);
 
   virtual ~Dump_writer();
 
@@ -92,6 +119,25 @@ class Dump_writer {
 
   void set_index_file(std::unique_ptr<mysqlshdk::storage::IFile> index);
 
+  void measure_write_time() { m_measure_write_time = true; }
+
+  /**
+   * Rows are coalesced into buffers of (at least) the given size. A full
+   * buffer is written (and compressed) by a background thread, while the next
+   * one is being filled. Checkpoints are written to the index file by the
+   * background thread, once the data preceding them is written. Pending data
+   * is written out by write_postamble(), bytes written by the background
+   * thread are reported by the subsequent calls.
+   */
+  void buffer_writes(std::size_t size);
+
+  /**
+   * Waits for the background write to finish, discards the data which was not
+   * written yet. Needs to be called if output file is going to be destroyed
+   * before the writer, without calling write_postamble().
+   */
+  void discard_writes() noexcept;
+
   void open();
 
   void close();
@@ -102,6 +148,8 @@ class Dump_writer {
 
   Dump_write_result write_row(const mysqlshdk::db::IRow *row);
 
+  Dump_write_result write_row(const Raw_row &row);
+
   Dump_write_result write_postamble();
 
  protected:
@@ -159,34 +207,58 @@ class Dump_writer {
     std::size_t m_fixed_length_remaining = 0;
     std::unique_ptr<char[]> m_data;
     char *m_ptr = nullptr;
+    shcore::Tracked_memory m_memory{shcore::Memory_tag::DUMP, m_capacity};
   };
 
   inline Buffer *buffer() const noexcept { return m_buffer.get(); }
 
  private:
+  class Async_writer;
+
   virtual void store_preamble(
       const std::vector<mysqlshdk::db::Column> &metadata,
       const std::vector<Encoding_type> &pre_encoded_columns) = 0;
 
   virtual void store_row(const mysqlshdk::db::IRow *row) = 0;
 
+  virtual void store_row(const Raw_row &row) = 0;
+
   virtual void store_postamble() = 0;
 
-  Dump_write_result write_buffer(const char *context, bool row = false) const;
+  Dump_write_result write_buffer(const char *context, bool row = false);
+
+  Dump_write_result write_row_buffer();
 
   void write_index();
 
+  void write_checkpoint(Dump_write_result *result);
+
+  void flush_writes(Dump_write_result *result);
+
   mysqlshdk::storage::IFile *m_output;
 
   std::unique_ptr<mysqlshdk::storage::IFile> m_index;
 
   std::unique_ptr<Buffer> m_buffer;
 
+  std::unique_ptr<Async_writer> m_async_writer;
+
   mysqlshdk::storage::Compressed_file *m_compressed = nullptr;
 
   uint64_t m_bytes_written = 0;
 
   uint64_t m_bytes_written_per_idx = 0;
+
+  bool m_write_checkpoints = false;
+
+  bool m_measure_write_time = false;
+
+  uint64_t m_rows_written = 0;
+
+  // offsets of all the data written to the output file
+  uint64_t m_data_offset = 0;
+
+  uint64_t m_compressed_offset = 0;
 };
 
 }  // namespace dump
@@ -26,9 +26,11 @@
 #include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <optional>
 #include <set>
 #include <type_traits>
 #include <utility>
@@ -43,11 +45,17 @@
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/db/mysql/row_block.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
 #include "mysqlshdk/libs/mysql/binlog_utils.h"
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
+#include "mysqlshdk/libs/mysql/instance.h"
+#include "mysqlshdk/libs/mysql/replication.h"
+#include "mysqlshdk/libs/storage/backend/tee_directory.h"
+#include "mysqlshdk/libs/storage/checksummed_file.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/utils.h"
 #include "mysqlshdk/libs/textui/textui.h"
@@ -57,7 +65,9 @@
 #include "mysqlshdk/libs/utils/profiling.h"
 #include "mysqlshdk/libs/utils/rate_limit.h"
 #include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/tracing.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
@@ -65,6 +75,7 @@
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 #include "modules/mod_utils.h"
+#include "modules/util/common/dump/session_compression.h"
 #include "modules/util/common/dump/utils.h"
 #include "modules/util/dump/compatibility_option.h"
 #include "modules/util/dump/console_with_progress.h"
@@ -73,6 +84,7 @@
 #include "modules/util/dump/dump_errors.h"
 #include "modules/util/dump/dump_manifest.h"
 #include "modules/util/dump/indexes.h"
+#include "modules/util/dump/parquet_dump_writer.h"
 #include "modules/util/dump/schema_dumper.h"
 #include "modules/util/dump/text_dump_writer.h"
 #include "modules/util/upgrade_check.h"
@@ -91,6 +103,37 @@ namespace {
 static constexpr const int k_mysql_server_net_write_timeout = 30 * 60;
 static constexpr const int k_mysql_server_wait_timeout = 365 * 24 * 60 * 60;
 
+// maximum size of the trained compression dictionary
+constexpr std::size_t k_compression_dictionary_size = 64 * 1024;
+
+// amount of data used to train the compression dictionary
+constexpr std::size_t k_compression_dictionary_samples_size =
+    100 * k_compression_dictionary_size;
+
+// number of tables whose DDL is written by a single worker task
+constexpr std::size_t k_tables_per_ddl_task = 64;
+
+// maximum number of sessions used to fetch metadata of objects
+constexpr std::size_t k_max_metadata_sessions = 4;
+
+// maximum time to wait for a read replica to catch up with the source
+constexpr int k_read_replica_sync_timeout = 60;
+
+// number of concurrent uploads of DDL and metadata files per worker thread,
+// used when dumping to a remote storage
+constexpr uint64_t k_small_file_writers_per_thread = 4;
+
+// size of the buffer rows are coalesced into before they are written to a
+// data file, matches the interval between checkpoints in the index files
+constexpr std::size_t k_write_buffer_size = 1024 * 1024;
+
+// minimum interval between the writes of the dump journal segments
+constexpr std::chrono::seconds k_journal_interval{1};
+
+// number of server-side prepared statements cached by each session, metadata
+// of every dumped object is fetched using the same query templates
+constexpr std::size_t k_prepared_statement_cache_size = 32;
+
 FI_DEFINE(dumper, [](const mysqlshdk::utils::FI::Args &args) {
   const auto op = args.get_string("op");
 
@@ -136,6 +179,13 @@ std::string to_string(rapidjson::Document *doc) {
   return std::string{buffer.GetString(), buffer.GetSize()};
 }
 
+std::string to_compact_string(rapidjson::Document *doc) {
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  doc->Accept(writer);
+  return std::string{buffer.GetString(), buffer.GetSize()};
+}
+
 void write_json(std::unique_ptr<mysqlshdk::storage::IFile> file,
                 rapidjson::Document *doc) {
   const auto json = to_string(doc);
@@ -412,6 +462,11 @@ class Dumper::Dump_writer_controller {
     return update_stats(m_writer->write_row(row));
   }
 
+  virtual Dump_write_result write_row(const Dump_writer::Raw_row &row) {
+    assert(m_output);
+    return update_stats(m_writer->write_row(row));
+  }
+
   virtual Dump_write_result finish_writing() {
     assert(m_output);
 
@@ -437,6 +492,9 @@ class Dumper::Dump_writer_controller {
     (*stats)[output_filename()] += m_total_written.data_bytes();
   }
 
+  virtual void update_checksums(
+      std::unordered_map<std::string, uint32_t> *) const {}
+
  protected:
   explicit Dump_writer_controller(std::unique_ptr<Dump_writer> writer)
       : m_writer(std::move(writer)) {}
@@ -453,6 +511,12 @@ class Dumper::Dump_writer_controller {
 
   void close_output() { m_close_output = true; }
 
+  void discard_writes() noexcept {
+    if (m_writer) {
+      m_writer->discard_writes();
+    }
+  }
+
   Dump_write_result update_stats(Dump_write_result result) {
     m_total_written += result;
     m_written_per_update += result;
@@ -520,7 +584,10 @@ class Dumper::Default_writer_controller : public Dump_writer_controller {
       delete;
   Default_writer_controller &operator=(Default_writer_controller &&) = default;
 
-  ~Default_writer_controller() = default;
+  ~Default_writer_controller() override {
+    // output file is destroyed before the writer, make sure it's not used
+    discard_writes();
+  }
 
   void prepare_for_writing() override {
     auto filename = output_filename();
@@ -542,17 +609,40 @@ class Dumper::Default_writer_controller : public Dump_writer_controller {
       m_output->rename(output_filename());
     }
 
+    m_checksum = checksum(m_output.get());
     m_output.reset();
 
     return result;
   }
 
+  void update_checksums(
+      std::unordered_map<std::string, uint32_t> *checksums) const override {
+    if (m_checksum.has_value()) {
+      (*checksums)[output_filename()] = *m_checksum;
+    }
+  }
+
  private:
+  static std::optional<uint32_t> checksum(mysqlshdk::storage::IFile *file) {
+    if (const auto compressed =
+            dynamic_cast<mysqlshdk::storage::Compressed_file *>(file)) {
+      file = compressed->file();
+    }
+
+    if (const auto checksummed =
+            dynamic_cast<mysqlshdk::storage::Checksummed_file *>(file)) {
+      return checksummed->checksum();
+    }
+
+    return {};
+  }
+
   static constexpr std::string_view k_dump_in_progress_ext = ".dumping";
 
   Create_file m_create_file;
   bool m_add_suffix;
   std::unique_ptr<mysqlshdk::storage::IFile> m_output;
+  std::optional<uint32_t> m_checksum;
 };
 
 class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
@@ -566,11 +656,13 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
   Multi_file_writer_controller(Create_controller create_controller,
                                const std::string &basename,
                                const std::string &extension,
-                               uint64_t bytes_per_file)
+                               uint64_t bytes_per_file,
+                               std::shared_ptr<Table_chunks> slices = {})
       : Dump_writer_controller(std::unique_ptr<Dump_writer>{}),
         m_create_controller(std::move(create_controller)),
         m_extension(extension),
-        m_bytes_per_file(bytes_per_file) {
+        m_bytes_per_file(bytes_per_file),
+        m_slices(std::move(slices)) {
     set_output_filename(basename);
   }
 
@@ -597,19 +689,11 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
   }
 
   Dump_write_result write_row(const mysqlshdk::db::IRow *row) override {
-    Dump_write_result result;
-
-    if (!m_controller) {
-      result += initialize_controller(false);
-    }
-
-    result += update_stats(m_controller->write_row(row));
-
-    if (m_controller->total_stats().data_bytes() >= m_bytes_per_file) {
-      result += finalize_controller();
-    }
+    return write_row_impl(row);
+  }
 
-    return result;
+  Dump_write_result write_row(const Dump_writer::Raw_row &row) override {
+    return write_row_impl(row);
   }
 
   Dump_write_result finish_writing() override {
@@ -619,9 +703,12 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
       result += finalize_controller();
     }
 
-    // create an empty final chunk
-    result += initialize_controller(true);
-    result += finalize_controller();
+    if (!m_slices) {
+      // create an empty final chunk, slices create it once all of them are
+      // written
+      result += initialize_controller(true);
+      result += finalize_controller();
+    }
 
     return result;
   }
@@ -633,10 +720,35 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
     }
   }
 
+  void update_checksums(
+      std::unordered_map<std::string, uint32_t> *checksums) const override {
+    for (const auto &file : m_checksums) {
+      (*checksums)[file.first] = file.second;
+    }
+  }
+
  private:
+  template <typename Row>
+  Dump_write_result write_row_impl(const Row &row) {
+    Dump_write_result result;
+
+    if (!m_controller) {
+      result += initialize_controller(false);
+    }
+
+    result += update_stats(m_controller->write_row(row));
+
+    if (m_controller->total_stats().data_bytes() >= m_bytes_per_file) {
+      result += finalize_controller();
+    }
+
+    return result;
+  }
+
   void create_controller(bool last_chunk) {
     m_controller = m_create_controller(common::get_table_data_filename(
-        output_filename(), m_extension, m_index++, last_chunk));
+        output_filename(), m_extension,
+        m_slices ? m_slices->create_file() : m_index++, last_chunk));
     m_controller->prepare_for_writing();
   }
 
@@ -654,6 +766,7 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
     auto result = update_stats(m_controller->finish_writing());
     m_file_stats.emplace(m_controller->output_filename(),
                          m_controller->total_stats());
+    m_controller->update_checksums(&m_checksums);
     m_controller.reset();
     return result;
   }
@@ -662,10 +775,72 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
   std::string m_extension;
   uint64_t m_bytes_per_file;
   std::size_t m_index = 0;
+  // set if this is one of the slices of a table, which share the file indexes
+  std::shared_ptr<Table_chunks> m_slices;
   std::unique_ptr<Dump_writer_controller> m_controller;
   std::vector<mysqlshdk::db::Column> m_metadata;
   std::vector<Dump_writer::Encoding_type> m_pre_encoded_columns;
   std::unordered_map<std::string, Dump_write_result> m_file_stats;
+  std::unordered_map<std::string, uint32_t> m_checksums;
+};
+
+/**
+ * Range of a chunk which is being dumped, holds the information needed to
+ * create a new chunk if it's split.
+ */
+class Dumper::Chunk_split final : public Chunk_range {
+ public:
+  Chunk_split(const Table_task &table, std::shared_ptr<Table_chunks> chunks,
+              std::string boundary, std::size_t column_idx,
+              const Instance_cache::Column *column, uint64_t begin,
+              uint64_t end)
+      : Chunk_range(std::move(chunks), begin, end),
+        m_table(table),
+        m_boundary(std::move(boundary)),
+        m_column(column),
+        m_column_idx(column_idx),
+        m_is_signed(mysqlshdk::db::Type::Integer == column->type) {}
+
+  Chunk_split(const Chunk_split &) = delete;
+  Chunk_split(Chunk_split &&) = delete;
+
+  Chunk_split &operator=(const Chunk_split &) = delete;
+  Chunk_split &operator=(Chunk_split &&) = delete;
+
+  ~Chunk_split() override = default;
+
+  inline const Table_task &table() const { return m_table; }
+
+  inline const std::string &boundary() const { return m_boundary; }
+
+  inline const Instance_cache::Column *column() const { return m_column; }
+
+  inline std::size_t column_idx() const { return m_column_idx; }
+
+  inline bool is_signed() const { return m_is_signed; }
+
+  /**
+   * Checks if row belongs to this chunk, handles split requests. Rows are
+   * expected to be ordered by the column.
+   *
+   * @returns false if row (and all subsequent rows) are outside of the chunk
+   */
+  bool accept(const mysqlshdk::db::IRow *row) {
+    if (row->is_null(m_column_idx)) {
+      return true;
+    }
+
+    return Chunk_range::accept(m_is_signed
+                                   ? to_ordered(row->get_int(m_column_idx))
+                                   : row->get_uint(m_column_idx));
+  }
+
+ private:
+  const Table_task m_table;
+  const std::string m_boundary;
+  const Instance_cache::Column *m_column;
+  const std::size_t m_column_idx;
+  const bool m_is_signed;
 };
 
 class Dumper::Table_worker final {
@@ -702,6 +877,9 @@ class Dumper::Table_worker final {
                                   {{"op", "WORKER_SLEEP_AT_START"},
                                    {"id", std::to_string(m_id)}}));
 
+      // pin the thread before any buffers are allocated
+      mysqlshdk::utils::pin_worker_thread(m_dumper->m_thread_affinity, m_id);
+
       mysqlsh::Mysql_thread mysql_thread;
       m_rate_limit =
           mysqlshdk::utils::Rate_limit(m_dumper->m_options.max_rate());
@@ -714,11 +892,18 @@ class Dumper::Table_worker final {
         }
 
         if (!work.task) {
+          // all tasks were produced, help other threads with their chunks
+          while (m_dumper->m_options.steal_chunks() &&
+                 !m_dumper->m_worker_interrupt && steal_chunk()) {
+          }
+
           break;
         }
 
         context = std::move(work.info);
 
+        mysqlshdk::tracing::Span span{"dump", context};
+
         m_session = m_dumper->session_pool().pop();
         shcore::on_leave_scope session_releaser(
             [this]() { release_session(); });
@@ -752,6 +937,8 @@ class Dumper::Table_worker final {
  private:
   friend class Dumper;
 
+  struct Chunking_info;
+
   inline std::shared_ptr<mysqlshdk::db::IResult> query(
       const std::string &sql) const {
     return Dumper::query(m_session, sql);
@@ -761,10 +948,11 @@ class Dumper::Table_worker final {
       const Table_data_task &table,
       std::vector<Dump_writer::Encoding_type> *out_pre_encoded_columns) const {
     const auto base64 = m_dumper->m_options.use_base64();
+    const auto encode = m_dumper->encode_binary_columns();
     std::string query = "SELECT SQL_NO_CACHE ";
 
     for (const auto &column : table.info->columns) {
-      if (column->csv_unsafe) {
+      if (encode && column->csv_unsafe) {
         query += (base64 ? "TO_BASE64(" : "HEX(") + column->quoted_name + ")";
 
         out_pre_encoded_columns->push_back(
@@ -803,6 +991,160 @@ class Dumper::Table_worker final {
     return query;
   }
 
+  static void hash_row(const Dump_writer::Raw_row &row, std::size_t fields,
+                       common::Checksums::Row_hasher *hasher) {
+    for (std::size_t i = 0; i < fields; ++i) {
+      if (row.data[i]) {
+        hasher->add_field(row.data[i], row.lengths[i]);
+      } else {
+        hasher->add_null();
+      }
+    }
+
+    hasher->end_row();
+  }
+
+  void row_written(Dump_writer_controller *controller) {
+    constexpr uint64_t update_every = 2000;
+
+    if (1 == controller->total_stats().rows_written()) {
+      m_first_row.finish();
+    }
+
+    if (update_every == controller->progress_stats().rows_written()) {
+      m_dumper->update_progress(controller->progress_stats());
+
+      // we don't know how much data was read from the server, number of
+      // bytes written to the dump file is a good approximation
+      if (m_rate_limit.enabled()) {
+        m_rate_limit.throttle(controller->progress_stats().data_bytes());
+      }
+
+      // limit shared by all threads, also enforces the global limit
+      m_dumper->m_resources->rate_limit()->throttle(
+          controller->progress_stats().data_bytes());
+
+      controller->reset_progress();
+    }
+  }
+
+  /**
+   * Rows are fetched from the server by a separate thread and copied into
+   * blocks, which are then written by the current thread. This allows to
+   * overlap network round trips with formatting and compression of the data.
+   *
+   * @returns false if dump was interrupted
+   */
+  bool pipelined_dump(mysqlshdk::db::mysql::Result *result, Chunk_split *split,
+                      Dump_writer_controller *controller,
+                      common::Checksums::Row_hasher *hasher) {
+    // maximum number of blocks in flight, bounds the memory usage
+    constexpr std::size_t k_blocks = 4;
+
+    const auto fields = result->get_metadata().size();
+    using mysqlshdk::db::mysql::Row_block;
+
+    std::vector<Row_block> blocks;
+    shcore::Synchronized_queue<Row_block *> free_blocks;
+    shcore::Synchronized_queue<Row_block *> full_blocks;
+
+    blocks.reserve(k_blocks);
+
+    for (std::size_t i = 0; i < k_blocks; ++i) {
+      free_blocks.push(&blocks.emplace_back(fields));
+    }
+
+    std::exception_ptr fetch_exception;
+    std::atomic<bool> writer_stopped{false};
+
+    auto fetcher = mysqlsh::spawn_scoped_thread([&]() {
+      mysqlsh::Mysql_thread mysql_thread;
+      // nullptr signals that writer has stopped
+      auto block = free_blocks.pop();
+
+      try {
+        while (block) {
+          if (writer_stopped || m_dumper->m_worker_interrupt) {
+            break;
+          }
+
+          if (!split) {
+            if (0 == result->fetch_block(block)) {
+              // no more rows
+              break;
+            }
+          } else {
+            const auto row = result->fetch_one();
+
+            if (!row || !split->accept(row)) {
+              // no more rows, or remaining rows were taken over by another
+              // thread
+              break;
+            }
+
+            if (const auto raw = result->client_row(row)) {
+              block->add(raw->raw_data(), raw->raw_lengths());
+            } else {
+              block->add(row);
+            }
+          }
+
+          if (block->full()) {
+            block->seal();
+            full_blocks.push(block);
+            block = free_blocks.pop();
+          }
+        }
+      } catch (...) {
+        fetch_exception = std::current_exception();
+      }
+
+      if (block && !block->empty()) {
+        block->seal();
+        full_blocks.push(block);
+      }
+
+      // nullptr signals that all rows were fetched
+      full_blocks.push(nullptr);
+    });
+
+    shcore::on_leave_scope join_fetcher([&]() {
+      writer_stopped = true;
+      // unblock the fetcher if it's waiting for a block
+      free_blocks.push(nullptr);
+      fetcher.join();
+    });
+
+    while (const auto block = full_blocks.pop()) {
+      if (m_dumper->m_worker_interrupt) {
+        return false;
+      }
+
+      for (std::size_t i = 0, size = block->rows(); i < size; ++i) {
+        const Dump_writer::Raw_row row{block->data(i), block->lengths(i)};
+
+        controller->write_row(row);
+
+        if (hasher) {
+          hash_row(row, fields, hasher);
+        }
+
+        row_written(controller);
+      }
+
+      block->clear();
+      free_blocks.push(block);
+    }
+
+    join_fetcher.call();
+
+    if (fetch_exception) {
+      std::rethrow_exception(fetch_exception);
+    }
+
+    return !m_dumper->m_worker_interrupt;
+  }
+
   void dump_table_data(const Table_data_task &table) {
     log_debug(
         "%sDumping %s (%s) using boundary: %s, filter: %s", m_log_id.c_str(),
@@ -816,35 +1158,87 @@ class Dumper::Table_worker final {
     std::vector<Dump_writer::Encoding_type> pre_encoded_columns;
     const auto full_query = prepare_query(table, &pre_encoded_columns);
     const auto controller = table.controller.get();
+    const auto split = table.split.get();
+
+    if (split) {
+      m_dumper->register_chunk_split(table.split);
+    }
+
+    shcore::on_leave_scope finish_split([this, &table]() {
+      if (table.split) {
+        table.split->finish();
+        m_dumper->unregister_chunk_split(table.split);
+      }
+    });
+
+    std::optional<common::Checksums::Row_hasher> hasher;
+
+    if (table.checksum) {
+      hasher.emplace(m_dumper->m_checksum->hash());
+    }
 
     try {
       controller->prepare_for_writing();
 
       if (Dry_run::DISABLED == m_dumper->m_options.dry_run_mode()) {
+        m_first_row.start();
+
         const auto result = query(full_query);
+        // if there are no rows, this is the time it took to execute the query
+        m_first_row.finish();
+        // rows read using the classic protocol are passed to the writer
+        // without any virtual calls to access their fields
+        const auto classic_result =
+            dynamic_cast<mysqlshdk::db::mysql::Result *>(result.get());
 
         controller->start_writing(result->get_metadata(), pre_encoded_columns);
 
-        while (const auto row = result->fetch_one()) {
-          if (m_dumper->m_worker_interrupt) {
+        if (classic_result && m_dumper->m_options.pipelined_fetch()) {
+          if (!pipelined_dump(classic_result, split, controller,
+                              hasher ? &*hasher : nullptr)) {
             return;
           }
+        } else {
+          const auto fields = pre_encoded_columns.size();
+
+          while (const auto row = result->fetch_one()) {
+            if (m_dumper->m_worker_interrupt) {
+              return;
+            }
 
-          controller->write_row(row);
+            if (split && !split->accept(row)) {
+              // remaining rows were taken over by another thread
+              break;
+            }
+
+            if (const auto raw = classic_result
+                                     ? classic_result->client_row(row)
+                                     : nullptr) {
+              const Dump_writer::Raw_row raw_row{raw->raw_data(),
+                                                 raw->raw_lengths()};
 
-          constexpr uint64_t update_every = 2000;
-          if (update_every == controller->progress_stats().rows_written()) {
-            m_dumper->update_progress(controller->progress_stats());
+              controller->write_row(raw_row);
 
-            // we don't know how much data was read from the server, number of
-            // bytes written to the dump file is a good approximation
-            if (m_rate_limit.enabled()) {
-              m_rate_limit.throttle(controller->progress_stats().data_bytes());
+              if (hasher) {
+                hash_row(raw_row, fields, &*hasher);
+              }
+            } else {
+              controller->write_row(row);
+
+              if (hasher) {
+                hasher->add_row(row);
+              }
             }
 
-            controller->reset_progress();
+            row_written(controller);
           }
         }
+
+        if (split && split->stopped()) {
+          // don't transfer rows which are going to be dumped by another thread,
+          // unread part of the result is discarded before the next query
+          m_dumper->kill_query(m_session);
+        }
       }
     } catch (const mysqlshdk::db::Error &e) {
       log_error("%sFailed to dump %s (%s) using query: %s, error: %s",
@@ -855,8 +1249,18 @@ class Dumper::Table_worker final {
 
     release_session();
 
+    mysqlshdk::utils::Duration finish;
+    finish.start();
+
     controller->finish_writing();
 
+    finish.finish();
+
+    if (table.checksum) {
+      std::lock_guard lock{m_dumper->m_checksums_mutex};
+      table.checksum->update(*hasher);
+    }
+
     duration.finish();
 
     log_info("%sDump of %s (%s) into '%s' took %f seconds, written %" PRIu64
@@ -868,6 +1272,36 @@ class Dumper::Table_worker final {
 
     m_dumper->update_progress(controller->progress_stats());
     m_dumper->finish_writing(table.schema, table.name, controller);
+    m_dumper->chunk_dumped(table, controller->total_stats(),
+                           duration.seconds_elapsed());
+
+    if (m_dumper->m_options.performance_report()) {
+      Chunk_performance performance;
+
+      performance.chunk = table.chunk;
+      performance.file = controller->output_filename();
+      performance.worker = m_id;
+      performance.seconds = duration.seconds_elapsed();
+      performance.first_row_seconds = m_first_row.seconds_elapsed();
+      performance.stats = controller->total_stats();
+      // closing the file flushes the remaining data
+      performance.stats.write_time(finish.elapsed());
+
+      m_dumper->chunk_performance(table, std::move(performance));
+    }
+
+    if (split) {
+      if (const auto idx = split->chunks()->chunk_finished()) {
+        create_and_push_final_chunk_task(split->table(), *idx);
+      }
+    }
+
+    if (table.slices) {
+      if (const auto idx = table.slices->chunk_finished()) {
+        create_and_push_final_chunk_task(table, *idx);
+      }
+    }
+
     m_dumper->data_task_finished();
   }
 
@@ -887,7 +1321,8 @@ class Dumper::Table_worker final {
     data_task.chunk = chunk;
 
     if (!filename.empty()) {
-      data_task.controller = m_dumper->table_dump_controller(filename);
+      data_task.controller =
+          m_dumper->table_dump_controller(filename, table.compression);
     }
 
     return data_task;
@@ -907,16 +1342,86 @@ class Dumper::Table_worker final {
     Table_data_task data_task = create_table_data_task(table, {});
 
     data_task.id = "whole table split in chunks";
-    data_task.controller =
-        m_dumper->table_dump_multi_file_controller(table.basename);
+    data_task.controller = m_dumper->table_dump_multi_file_controller(
+        table.basename, table.compression);
 
     m_dumper->push_table_data_task(std::move(data_task));
   }
 
+  /**
+   * Expression which assigns each row of a table without an index to one of
+   * the slices. CONCAT_WS() skips the NULL values, this does not matter, as
+   * the same row always has the same hash.
+   */
+  static std::string slice_hash(const Table_task &table) {
+    std::vector<const Instance_cache::Column *> columns;
+
+    for (const auto c : table.info->columns) {
+      // large values are expensive to hash, use them if there's nothing else
+      if (mysqlshdk::db::Type::Bytes != c->type &&
+          mysqlshdk::db::Type::Geometry != c->type &&
+          mysqlshdk::db::Type::Json != c->type) {
+        columns.emplace_back(c);
+      }
+    }
+
+    if (columns.empty()) {
+      columns = table.info->columns;
+    }
+
+    // columns are converted to binary strings to avoid collation conflicts
+    return "CRC32(CONCAT_WS(''," +
+           shcore::str_join(columns, ",",
+                            [](const Instance_cache::Column *c) {
+                              return "CAST(" + c->quoted_name + " AS BINARY)";
+                            }) +
+           "))";
+  }
+
+  /**
+   * Each slice is dumped by a separate thread, into multiple files. Slices
+   * share the file indexes, the last slice which is written creates the empty
+   * final chunk.
+   */
+  void create_and_push_table_data_slice_tasks(const Table_task &table,
+                                              uint64_t count) {
+    const auto hash = slice_hash(table);
+    const auto slices = std::make_shared<Table_chunks>();
+
+    for (uint64_t i = 0; i < count; ++i) {
+      slices->create_slice();
+
+      Table_data_task data_task = create_table_data_task(table, {});
+
+      data_task.id = "slice " + std::to_string(i);
+      data_task.boundary = "(MOD(" + hash + "," + std::to_string(count) +
+                           ")=" + std::to_string(i) + ")";
+      data_task.controller = m_dumper->table_dump_multi_file_controller(
+          table.basename, table.compression, slices);
+      data_task.slices = slices;
+      data_task.slice = i;
+
+      m_dumper->push_table_data_task(std::move(data_task));
+    }
+
+    if (const auto idx = slices->finish_chunking()) {
+      create_and_push_final_chunk_task(table, *idx);
+    }
+  }
+
   void create_and_push_table_data_chunk_task(const Table_task &table,
                                              const std::string &boundary,
                                              const std::string &id,
                                              std::size_t idx, bool last_chunk) {
+    m_dumper->push_table_data_task(
+        create_table_data_chunk_task(table, boundary, id, idx, last_chunk));
+  }
+
+  Table_data_task create_table_data_chunk_task(const Table_task &table,
+                                               const std::string &boundary,
+                                               const std::string &id,
+                                               std::size_t idx,
+                                               bool last_chunk) {
     Table_data_task data_task = create_table_data_task(
         table,
         m_dumper->get_table_data_filename(table.basename, idx, last_chunk),
@@ -942,7 +1447,98 @@ class Dumper::Table_worker final {
       data_task.boundary = "(" + data_task.boundary + ")";
     }
 
-    m_dumper->push_table_data_task(std::move(data_task));
+    return data_task;
+  }
+
+  template <typename T>
+  void create_and_push_table_data_chunk_task(const Chunking_info &info,
+                                             const T &begin, const T &end,
+                                             const std::string &id,
+                                             std::size_t idx, bool last_chunk) {
+    if constexpr (std::is_integral_v<T>) {
+      if (info.chunks) {
+        // chunk can be split, last chunk is going to be created once all
+        // chunks of this table are dumped
+        const auto index = info.chunks->create_chunk();
+        auto data_task = create_table_data_chunk_task(
+            *info.table, between(info, begin, end), id, index, false);
+
+        data_task.split = std::make_shared<Chunk_split>(
+            *info.table, info.chunks, info.boundary, info.split_column_idx,
+            info.table->index.info->columns()[info.index_column],
+            to_ordered(begin), to_ordered(end));
+
+        m_dumper->push_table_data_task(std::move(data_task));
+        return;
+      }
+    }
+
+    create_and_push_table_data_chunk_task(
+        *info.table, between(info, begin, end), id, idx, last_chunk);
+  }
+
+  void create_and_push_final_chunk_task(const Table_task &table,
+                                        std::size_t idx) {
+    create_and_push_table_data_chunk_task(table, "1=0", std::to_string(idx),
+                                          idx, true);
+  }
+
+  static uint64_t to_ordered(int64_t v) { return Chunk_split::to_ordered(v); }
+
+  static uint64_t to_ordered(uint64_t v) { return v; }
+
+  bool steal_chunk() {
+    for (const auto &split : m_dumper->chunk_split_candidates()) {
+      uint64_t begin;
+      uint64_t end;
+      std::size_t idx;
+
+      if (!split->split(&begin, &end, &idx)) {
+        continue;
+      }
+
+      const auto &table = split->table();
+      const auto &column = split->column()->quoted_name;
+      auto boundary = split->boundary();
+
+      if (!boundary.empty()) {
+        boundary += " AND ";
+      }
+
+      if (split->is_signed()) {
+        boundary += between(column, Chunk_split::from_ordered(begin),
+                            Chunk_split::from_ordered(end));
+      } else {
+        boundary += between(column, begin, end);
+      }
+
+      auto data_task = create_table_data_chunk_task(
+          table, boundary, std::to_string(idx), idx, false);
+
+      data_task.split = std::make_shared<Chunk_split>(
+          table, split->chunks(), split->boundary(), split->column_idx(),
+          split->column(), begin, end);
+
+      log_info("%sSplit chunk of %s, rows matching %s are going to be dumped "
+               "to a new chunk %zu",
+               m_log_id.c_str(), table.task_name.c_str(), boundary.c_str(),
+               idx);
+
+      // task is executed immediately by this thread
+      ++m_dumper->m_data_tasks_total;
+      ++m_dumper->m_num_threads_dumping;
+
+      m_session = m_dumper->session_pool().pop();
+      shcore::on_leave_scope session_releaser([this]() { release_session(); });
+
+      dump_table_data(data_task);
+
+      --m_dumper->m_num_threads_dumping;
+
+      return true;
+    }
+
+    return false;
   }
 
   void checksum_table_data(const Checksum_task &task) {
@@ -972,6 +1568,10 @@ class Dumper::Table_worker final {
   }
 
   void write_table_metadata(const Table_task &table) {
+    if (!table.watermark_column.empty() || table.count_rows) {
+      record_watermark(table);
+    }
+
     log_info("%sWriting metadata for table %s", m_log_id.c_str(),
              table.quoted_name.c_str());
 
@@ -982,33 +1582,245 @@ class Dumper::Table_worker final {
     m_dumper->validate_dump_consistency(m_session);
   }
 
-  void create_table_data_tasks(const Table_task &table) {
-    auto ranges = create_ranged_tasks(table);
+  /**
+   * Compares the table with its copy in the previous dump, this is executed in
+   * the same transaction as the data dump. Data of unchanged tables is not
+   * dumped again, metadata points to the data files of the previous dump.
+   */
+  void dump_if_changed(const Table_task &table) {
+    const auto unchanged = m_dumper->record_table_fingerprint(
+        table, m_dumper->table_fingerprint(table, m_session));
 
-    if (0 == ranges) {
-      create_and_push_whole_table_data_task(table);
-      ++ranges;
-    }
+    write_table_metadata(table);
 
-    log_info("%sData dump for table %s will be written to %zu file%s",
-             m_log_id.c_str(), table.task_name.c_str(), ranges,
-             ranges > 1 ? "s" : "");
+    if (unchanged) {
+      log_info("%sTable %s has not changed since the previous dump, its data "
+               "is not going to be dumped",
+               m_log_id.c_str(), table.quoted_name.c_str());
+    } else {
+      auto copy = table;
+      m_dumper->push_table_task(std::move(copy));
+    }
 
     m_dumper->chunking_task_finished();
   }
 
-  template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
-  static std::string quote(const T &v) {
-    return std::to_string(v);
-  }
-
-  static std::string quote(const Decimal &d) {
-    return '\'' + d.to_string() + '\'';
-  }
+  /**
+   * Records the maximum value of the watermark column and the number of rows
+   * in the table, this is executed in the same transaction as the data dump,
+   * so all rows which are going to be dumped have values less than or equal
+   * to the recorded one.
+   */
+  void record_watermark(const Table_task &table) {
+    std::string columns;
 
-  template <typename T>
-  static std::string between(const std::string &column, T begin, T end) {
-    assert(begin <= end);
+    if (!table.watermark_column.empty()) {
+      columns =
+          "MAX(" + shcore::quote_identifier(table.watermark_column) + "),";
+    }
+
+    columns += table.count_rows ? "COUNT(*)" : "NULL";
+
+    // if rows are counted, the incremental filter is the only filter and it's
+    // not applied; without new rows this yields a value which is not greater
+    // than the one recorded by the base dump, next incremental dump is going
+    // to include some of the rows again
+    const auto result =
+        query("SELECT " + columns + " FROM " + table.quoted_name +
+              (table.count_rows ? std::string{} : where(table, {})));
+    const auto row = result->fetch_one();
+    Watermark watermark;
+
+    if (!table.watermark_column.empty() && row && !row->is_null(0)) {
+      watermark.column = table.watermark_column;
+      watermark.value = row->get_as_string(0);
+    } else if (const auto &base = m_dumper->m_incremental_base;
+               base && !table.watermark_column.empty()) {
+      // there are no new rows, carry over the watermark of the base dump
+      const auto schema = base->watermarks.find(table.schema);
+
+      if (base->watermarks.end() != schema) {
+        const auto t = schema->second.find(table.name);
+
+        if (schema->second.end() != t &&
+            shcore::str_caseeq(t->second.column, table.watermark_column)) {
+          watermark = t->second;
+        }
+      }
+    }
+
+    std::lock_guard lock{m_dumper->m_watermarks_mutex};
+
+    if (table.count_rows && row) {
+      const auto rows = row->get_uint(table.watermark_column.empty() ? 0 : 1);
+
+      log_info("%sTable %s has %" PRIu64 " rows", m_log_id.c_str(),
+               table.task_name.c_str(), rows);
+
+      m_dumper->m_source_rows[table.schema][table.name] = rows;
+    }
+
+    if (table.watermark_column.empty()) {
+      return;
+    }
+
+    if (watermark.column.empty()) {
+      log_info("%sTable %s is empty, watermark was not recorded",
+               m_log_id.c_str(), table.task_name.c_str());
+      return;
+    }
+
+    log_info("%sWatermark of table %s: %s = %s", m_log_id.c_str(),
+             table.task_name.c_str(), watermark.column.c_str(),
+             watermark.value.c_str());
+
+    m_dumper->m_watermarks[table.schema][table.name] = std::move(watermark);
+  }
+
+  void create_table_data_tasks(const Table_task &table) {
+    mysqlshdk::utils::Duration duration;
+    duration.start();
+
+    if (m_dumper->m_options.compression_dictionary() &&
+        Dry_run::DISABLED == m_dumper->m_options.dry_run_mode()) {
+      auto task = table;
+      task.compression.dictionary = train_compression_dictionary(task);
+      create_table_data_tasks_impl(task);
+    } else {
+      create_table_data_tasks_impl(table);
+    }
+
+    duration.finish();
+
+    if (m_dumper->m_options.performance_report()) {
+      m_dumper->table_chunked(table, m_id, duration.seconds_elapsed());
+    }
+
+    m_dumper->chunking_task_finished();
+  }
+
+  /**
+   * Trains the compression dictionary using data from the beginning of the
+   * table, writes it to a file stored next to the data files.
+   *
+   * @returns trained dictionary or nullptr if dictionary could not be trained
+   */
+  std::shared_ptr<const std::string> train_compression_dictionary(
+      const Table_task &table) {
+    mysqlshdk::utils::Duration duration;
+    duration.start();
+
+    const auto task = create_table_data_task(table, {});
+    std::vector<Dump_writer::Encoding_type> pre_encoded_columns;
+    const auto average_row_length = std::max<uint64_t>(
+        table.partitions.empty() ? table.info->average_row_length
+                                 : table.partitions[0].info->average_row_length,
+        1);
+    const auto full_query =
+        prepare_query(task, &pre_encoded_columns) + " LIMIT " +
+        std::to_string(
+            k_compression_dictionary_samples_size / average_row_length + 1);
+
+    Memory_file samples{""};
+    samples.open(Mode::WRITE);
+
+    std::vector<std::size_t> sample_sizes;
+    std::size_t preamble_size = 0;
+    std::size_t total_size = 0;
+
+    {
+      const auto writer = m_dumper->m_writer_creator();
+      writer->set_output_file(&samples);
+
+      const auto result = query(full_query);
+      preamble_size =
+          writer->write_preamble(result->get_metadata(), pre_encoded_columns)
+              .bytes_written();
+
+      while (const auto row = result->fetch_one()) {
+        if (m_dumper->m_worker_interrupt) {
+          return {};
+        }
+
+        const auto size = writer->write_row(row).bytes_written();
+
+        if (size > 0) {
+          sample_sizes.emplace_back(size);
+          total_size += size;
+        }
+
+        if (total_size >= k_compression_dictionary_samples_size) {
+          // query uses a LIMIT, the remaining rows are going to be discarded
+          break;
+        }
+      }
+
+      writer->write_postamble();
+    }
+
+    samples.close();
+
+    auto dictionary = mysqlshdk::storage::compression::train_zstd_dictionary(
+        samples.content().substr(preamble_size, total_size), sample_sizes,
+        k_compression_dictionary_size);
+
+    duration.finish();
+
+    if (dictionary.empty()) {
+      log_info(
+          "%sCould not train compression dictionary for %s using %zu rows "
+          "(%zu bytes), data will be compressed without it",
+          m_log_id.c_str(), table.task_name.c_str(), sample_sizes.size(),
+          total_size);
+      return {};
+    }
+
+    const auto file = m_dumper->make_file(
+        common::get_compression_dictionary_filename(table.basename));
+    file->open(Mode::WRITE);
+
+    if (file->write(dictionary.data(), dictionary.size()) !=
+        static_cast<ssize_t>(dictionary.size())) {
+      throw std::runtime_error("Failed to write the compression dictionary " +
+                               file->full_path().masked());
+    }
+
+    file->close();
+
+    log_info(
+        "%sTrained compression dictionary for %s using %zu rows (%zu "
+        "bytes), dictionary size: %zu bytes, took %f seconds",
+        m_log_id.c_str(), table.task_name.c_str(), sample_sizes.size(),
+        total_size, dictionary.size(), duration.seconds_elapsed());
+
+    return std::make_shared<const std::string>(std::move(dictionary));
+  }
+
+  void create_table_data_tasks_impl(const Table_task &table) {
+    auto ranges = create_ranged_tasks(table);
+
+    if (0 == ranges) {
+      create_and_push_whole_table_data_task(table);
+      ++ranges;
+    }
+
+    log_info("%sData dump for table %s will be written to %zu file%s",
+             m_log_id.c_str(), table.task_name.c_str(), ranges,
+             ranges > 1 ? "s" : "");
+  }
+
+  template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  static std::string quote(const T &v) {
+    return std::to_string(v);
+  }
+
+  static std::string quote(const Decimal &d) {
+    return '\'' + d.to_string() + '\'';
+  }
+
+  template <typename T>
+  static std::string between(const std::string &column, T begin, T end) {
+    assert(begin <= end);
 
     if (begin == end) {
       return column + "=" + quote(begin);
@@ -1021,6 +1833,8 @@ class Dumper::Table_worker final {
     const Table_task *table;
     uint64_t row_count;
     uint64_t rows_per_chunk;
+    // initial value of rows_per_chunk, computed using the table statistics
+    uint64_t estimated_rows_per_chunk;
     uint64_t accuracy;
     int explain_rows_idx;
     std::string partition;
@@ -1028,6 +1842,10 @@ class Dumper::Table_worker final {
     std::string order_by;
     std::string order_by_desc;
     std::size_t index_column;
+    // set if chunks can be split while they're being dumped
+    std::shared_ptr<Table_chunks> chunks;
+    // position of the index column in the result of the dump query
+    std::size_t split_column_idx;
   };
 
   static std::string compare(const Chunking_info &info, const Row &value,
@@ -1278,6 +2096,97 @@ class Dumper::Table_worker final {
     return ensure_not_zero(middle - from);
   }
 
+  std::vector<Histogram_bucket> fetch_histogram(const Chunking_info &info) {
+    const auto &table = *info.table;
+
+    // histograms describe the whole table, they cannot be used if only a subset
+    // of rows is dumped
+    if (!m_dumper->m_cache.server_version.is_8_0 || !info.partition.empty() ||
+        !table.extra_filter.empty() || 0 != info.index_column) {
+      return {};
+    }
+
+    const auto &column = table.index.info->columns()[info.index_column]->name;
+    const auto &histograms = table.info->histograms;
+
+    if (std::none_of(histograms.begin(), histograms.end(),
+                     [&column](const auto &h) { return h.column == column; })) {
+      return {};
+    }
+
+    try {
+      const auto result = query(shcore::sqlformat(
+          "SELECT JSON_UNQUOTE(JSON_EXTRACT(HISTOGRAM,'$.\"histogram-type\"')),"
+          "JSON_EXTRACT(HISTOGRAM,'$.buckets') FROM "
+          "information_schema.column_statistics WHERE SCHEMA_NAME=? AND "
+          "TABLE_NAME=? AND COLUMN_NAME=? " +
+              get_query_comment(table, "histogram"),
+          table.schema, table.name, column));
+
+      if (const auto row = result->fetch_one();
+          row && !row->is_null(0) && !row->is_null(1)) {
+        return parse_histogram_buckets(row->get_string(0), row->get_string(1));
+      }
+    } catch (const mysqlshdk::db::Error &e) {
+      log_warning("%sFailed to fetch histogram of %s.%s: %s", m_log_id.c_str(),
+                  table.task_name.c_str(),
+                  shcore::quote_identifier(column).c_str(), e.format().c_str());
+    }
+
+    return {};
+  }
+
+  /**
+   * Computes upper boundaries of chunks using the histogram of the first
+   * column of the index, no queries are executed if histogram is not
+   * available.
+   *
+   * @returns Strictly increasing boundaries, each within [min, max), upper
+   *          boundary of the last chunk is not included. Empty if histogram
+   *          does not exist or is not usable.
+   */
+  template <typename T>
+  std::vector<T> histogram_boundaries(const Chunking_info &info, const T &min,
+                                      const T &max) {
+    if constexpr (std::is_integral_v<T>) {
+      if (0 == info.row_count || 0 == info.rows_per_chunk) {
+        return {};
+      }
+
+      return dump::histogram_boundaries(
+          fetch_histogram(info), info.rows_per_chunk, info.row_count, min, max,
+          m_dumper->m_worker_interrupt);
+    } else {
+      return {};
+    }
+  }
+
+  template <typename T>
+  std::size_t chunk_using_boundaries(const Chunking_info &info, const T &min,
+                                     const T &max,
+                                     const std::vector<T> &boundaries) {
+    std::size_t ranges_count = 0;
+    auto begin = min;
+
+    for (const auto &boundary : boundaries) {
+      if (m_dumper->m_worker_interrupt) {
+        return ranges_count;
+      }
+
+      create_and_push_table_data_chunk_task(info, begin, boundary,
+                                            std::to_string(ranges_count),
+                                            ranges_count, false);
+      ++ranges_count;
+
+      begin = boundary + 1;
+    }
+
+    create_and_push_table_data_chunk_task(
+        info, begin, max, std::to_string(ranges_count), ranges_count, true);
+
+    return ++ranges_count;
+  }
+
   template <typename T>
   std::size_t chunk_integer_column(const Chunking_info &info, const T &min,
                                    const T &max) {
@@ -1303,20 +2212,39 @@ class Dumper::Table_worker final {
              ? index_range - info.row_count
              : info.row_count - index_range) <= row_count_accuracy;
 
+    // boundaries computed using a histogram cannot be adjusted while chunking
+    if (!use_constant_step && !m_dumper->m_options.adaptive_chunking()) {
+      if (const auto boundaries = histogram_boundaries(info, min, max);
+          !boundaries.empty()) {
+        log_info("%sChunking %s using integer algorithm with histogram",
+                 m_log_id.c_str(), info.table->task_name.c_str());
+
+        m_chunking_method = "histogram";
+
+        return chunk_using_boundaries(info, min, max, boundaries);
+      }
+    }
+
+    m_chunking_method = use_constant_step ? "constant step" : "adaptive step";
+
     std::string chunk_id;
+    // rows per chunk may change during chunking if adaptive chunking is
+    // enabled
+    auto current_info = info;
     const auto next_step =
         use_constant_step
             ? std::function<step_t(const step_t &, const step_t &)>(
                   constant_step<T>)
             // using the default capture [&] below results in problems with
             // GCC 5.4.0 (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=80543)
-            : [&info, &max, &chunk_id, this](const auto &from,
-                                             const auto &step) {
-                return this->adaptive_step(from, step, max, info, chunk_id);
+            : [&current_info, &max, &chunk_id, this](const auto &from,
+                                                     const auto &step) {
+                return this->adaptive_step(from, step, max, current_info,
+                                           chunk_id);
               };
 
     auto current = min;
-    const auto step = estimated_step;
+    auto step = estimated_step;
 
     log_info("%sChunking %s using integer algorithm with %s step",
              m_log_id.c_str(), info.table->task_name.c_str(),
@@ -1329,6 +2257,12 @@ class Dumper::Table_worker final {
         return ranges_count;
       }
 
+      if (update_rows_per_chunk(&current_info)) {
+        const auto chunks =
+            std::max(info.row_count / current_info.rows_per_chunk, UINT64_C(1));
+        step = cast<step_t>(ensure_not_zero(index_range / chunks));
+      }
+
       chunk_id = std::to_string(ranges_count);
       const auto begin = current;
       auto new_step = next_step(current, step);
@@ -1341,8 +2275,7 @@ class Dumper::Table_worker final {
 
       last_chunk = (current >= max);
 
-      create_and_push_table_data_chunk_task(*info.table,
-                                            between(info, begin, end), chunk_id,
+      create_and_push_table_data_chunk_task(info, begin, end, chunk_id,
                                             ranges_count++, last_chunk);
 
       ++current;
@@ -1381,6 +2314,8 @@ class Dumper::Table_worker final {
     log_info("%sChunking %s using non-integer algorithm", m_log_id.c_str(),
              info.table->task_name.c_str());
 
+    m_chunking_method = "non-integer";
+
     std::size_t ranges_count = 0;
 
     Row range_begin = begin;
@@ -1394,9 +2329,11 @@ class Dumper::Table_worker final {
 
     const auto select = "SELECT SQL_NO_CACHE " + index + " FROM " +
                         info.table->quoted_name + info.partition + " ";
-    const auto order_by_and_limit = info.order_by + " LIMIT " +
-                                    std::to_string(info.rows_per_chunk - 1) +
-                                    ",2 ";
+    const auto order_by_and_limit = [&info](uint64_t rows_per_chunk) {
+      return info.order_by + " LIMIT " + std::to_string(rows_per_chunk - 1) +
+             ",2 ";
+    };
+    auto current_info = info;
 
     const auto fetch =
         [&end](const std::shared_ptr<mysqlshdk::db::IResult> &res) {
@@ -1411,7 +2348,10 @@ class Dumper::Table_worker final {
       const auto chunk_id = std::to_string(ranges_count);
       const auto comment = get_query_comment(*info.table, chunk_id);
 
-      result = query(select + condition + order_by_and_limit + comment);
+      update_rows_per_chunk(&current_info);
+
+      result = query(select + condition +
+                     order_by_and_limit(current_info.rows_per_chunk) + comment);
 
       if (m_dumper->m_worker_interrupt) {
         return 0;
@@ -1429,13 +2369,65 @@ class Dumper::Table_worker final {
     return ranges_count;
   }
 
+  static uint64_t accuracy(uint64_t rows_per_chunk) {
+    return std::max(rows_per_chunk / 10, UINT64_C(10));
+  }
+
+  /**
+   * Updates the number of rows per chunk using the throughput of the chunks of
+   * this table which were already dumped, if adaptive chunking is enabled.
+   *
+   * @returns true if the number of rows per chunk has changed.
+   */
+  bool update_rows_per_chunk(Chunking_info *info) const {
+    if (!m_dumper->m_options.adaptive_chunking()) {
+      return false;
+    }
+
+    const auto rows_per_chunk = m_dumper->adaptive_rows_per_chunk(
+        *info->table, info->estimated_rows_per_chunk);
+
+    if (rows_per_chunk == info->rows_per_chunk) {
+      return false;
+    }
+
+    log_debug("%sChunking %s, rows per chunk changed from %" PRIu64
+              " to %" PRIu64,
+              m_log_id.c_str(), info->table->task_name.c_str(),
+              info->rows_per_chunk, rows_per_chunk);
+
+    info->rows_per_chunk = rows_per_chunk;
+    info->accuracy = accuracy(rows_per_chunk);
+
+    return true;
+  }
+
   std::size_t chunk_column(const Chunking_info &info) {
     if (!info.table->index.info) {
+      const auto chunks = info.row_count / info.rows_per_chunk + 1;
+      const auto slices =
+          std::min<uint64_t>(chunks, m_dumper->m_options.threads());
+
+      if (slices > 1) {
+        log_info(
+            "%sTable %s does not have a valid index, rows are going to be "
+            "dumped in %" PRIu64 " slices, selected using a hash of the row",
+            m_log_id.c_str(), info.table->task_name.c_str(), slices);
+
+        m_chunking_method = "hash";
+
+        create_and_push_table_data_slice_tasks(*info.table, slices);
+        // number of chunks is estimated, plus an empty final chunk
+        return chunks + 1;
+      }
+
       log_info(
           "%sTable %s does not have a valid index, number of chunks is "
           "estimated",
           m_log_id.c_str(), info.table->task_name.c_str());
 
+      m_chunking_method = "estimation";
+
       create_and_push_whole_table_data_in_chunks_task(*info.table);
       // we add one because we create an empty final chunk, plus we don't want
       // to return zero here
@@ -1545,7 +2537,8 @@ class Dumper::Table_worker final {
     info.row_count = partition ? partition->row_count : table.info->row_count;
     info.rows_per_chunk =
         m_dumper->m_options.bytes_per_chunk() / average_row_length;
-    info.accuracy = std::max(info.rows_per_chunk / 10, UINT64_C(10));
+    info.estimated_rows_per_chunk = info.rows_per_chunk;
+    info.accuracy = accuracy(info.rows_per_chunk);
     info.explain_rows_idx = m_dumper->m_cache.explain_rows_idx;
     info.partition = std::move(partition_clause);
 
@@ -1569,6 +2562,19 @@ class Dumper::Table_worker final {
             return c->quoted_name + " DESC";
           });
       info.index_column = 0;
+
+      if (m_dumper->m_options.steal_chunks()) {
+        const auto column = table.index.info->columns()[info.index_column];
+        const auto &columns = table.info->columns;
+        const auto it = std::find(columns.begin(), columns.end(), column);
+
+        if ((mysqlshdk::db::Type::Integer == column->type ||
+             mysqlshdk::db::Type::UInteger == column->type) &&
+            columns.end() != it) {
+          info.chunks = std::make_shared<Table_chunks>();
+          info.split_column_idx = std::distance(columns.begin(), it);
+        }
+      }
     }
 
     log_info("%sChunking %s, rows: %" PRIu64 ", average row length: %" PRIu64
@@ -1576,11 +2582,23 @@ class Dumper::Table_worker final {
              m_log_id.c_str(), task_name.c_str(), info.row_count,
              average_row_length, info.rows_per_chunk);
 
-    const auto ranges_count = chunk_column(info);
+    m_chunking_method = "none";
+
+    auto ranges_count = chunk_column(info);
+
+    if (info.chunks) {
+      if (const auto idx = info.chunks->finish_chunking()) {
+        create_and_push_final_chunk_task(table, *idx);
+        ++ranges_count;
+      }
+    }
 
     duration.finish();
-    log_debug("%sChunking of %s took %f seconds", m_log_id.c_str(),
-              task_name.c_str(), duration.seconds_elapsed());
+    log_info("%sChunking of %s using %s method took %f seconds, created %zu "
+             "chunk%s",
+             m_log_id.c_str(), task_name.c_str(), m_chunking_method,
+             duration.seconds_elapsed(), ranges_count,
+             1 == ranges_count ? "" : "s");
 
     return ranges_count;
   }
@@ -1602,8 +2620,9 @@ class Dumper::Table_worker final {
              schema.quoted_name.c_str());
 
     const auto dumper = m_dumper->schema_dumper(m_session);
+    const auto memory = m_dumper->memory_dumper(dumper.get());
 
-    m_dumper->write_ddl(*m_dumper->dump_schema(dumper.get(), schema.name),
+    m_dumper->write_ddl(m_dumper->dump_schema(memory.get(), schema.name),
                         common::get_schema_filename(schema.basename));
 
     ++m_dumper->m_ddl_written;
@@ -1611,27 +2630,44 @@ class Dumper::Table_worker final {
     m_dumper->validate_dump_consistency(m_session);
   }
 
-  void dump_table_ddl(const Schema_info &schema,
+  /**
+   * Writes DDL of multiple tables using the same schema dumper, this allows to
+   * skip the statements which setup the session before each table.
+   */
+  void dump_tables_ddl(const Schema_info &schema,
+                       const std::vector<const Table_info *> &tables) const {
+    const auto dumper = m_dumper->schema_dumper(m_session);
+    // buffer is reused by all the tables
+    const auto memory = m_dumper->memory_dumper(dumper.get());
+
+    for (const auto table : tables) {
+      if (m_dumper->m_worker_interrupt) {
+        return;
+      }
+
+      dump_table_ddl(dumper.get(), memory.get(), schema, *table);
+    }
+
+    m_dumper->validate_dump_consistency(m_session);
+  }
+
+  void dump_table_ddl(Schema_dumper *dumper, Memory_dumper *memory,
+                      const Schema_info &schema,
                       const Table_info &table) const {
     log_info("%sWriting DDL for table %s", m_log_id.c_str(),
              table.quoted_name.c_str());
 
-    const auto dumper = m_dumper->schema_dumper(m_session);
-
-    m_dumper->write_ddl(
-        *m_dumper->dump_table(dumper.get(), schema.name, table.name),
-        common::get_table_filename(table.basename));
+    m_dumper->write_ddl(m_dumper->dump_table(memory, schema.name, table.name),
+                        common::get_table_filename(table.basename));
 
     if (m_dumper->m_options.dump_triggers() &&
         dumper->count_triggers_for_table(schema.name, table.name) > 0) {
       m_dumper->write_ddl(
-          *m_dumper->dump_triggers(dumper.get(), schema.name, table.name),
+          m_dumper->dump_triggers(memory, schema.name, table.name),
           common::get_table_data_filename(table.basename, "triggers.sql"));
     }
 
     ++m_dumper->m_ddl_written;
-
-    m_dumper->validate_dump_consistency(m_session);
   }
 
   void dump_view_ddl(const Schema_info &schema, const View_info &view) const {
@@ -1639,15 +2675,16 @@ class Dumper::Table_worker final {
              view.quoted_name.c_str());
 
     const auto dumper = m_dumper->schema_dumper(m_session);
+    const auto memory = m_dumper->memory_dumper(dumper.get());
 
     // DDL file with the temporary table
     m_dumper->write_ddl(
-        *m_dumper->dump_temporary_view(dumper.get(), schema.name, view.name),
+        m_dumper->dump_temporary_view(memory.get(), schema.name, view.name),
         common::get_table_data_filename(view.basename, "pre.sql"));
 
     // DDL file with the view structure
     m_dumper->write_ddl(
-        *m_dumper->dump_view(dumper.get(), schema.name, view.name),
+        m_dumper->dump_view(memory.get(), schema.name, view.name),
         common::get_table_filename(view.basename));
 
     ++m_dumper->m_ddl_written;
@@ -1665,7 +2702,11 @@ class Dumper::Table_worker final {
   Dumper *m_dumper;
   Exception_strategy m_strategy;
   mysqlshdk::utils::Rate_limit m_rate_limit;
+  // method used to chunk the current table, for logging purposes
+  const char *m_chunking_method = "none";
   std::shared_ptr<mysqlshdk::db::ISession> m_session;
+  // time it takes to receive the first row of the chunk being dumped
+  mysqlshdk::utils::Duration m_first_row;
 };
 
 // template specialization of a static method must be defined outside of a class
@@ -1683,25 +2724,33 @@ class Dumper::Memory_dumper final {
  public:
   Memory_dumper() = delete;
 
-  explicit Memory_dumper(Schema_dumper *dumper)
-      : m_dumper(dumper), m_file("/dev/null") {}
+  Memory_dumper(const Dumper *owner, Schema_dumper *dumper)
+      : m_owner(owner), m_dumper(dumper), m_file("/dev/null") {}
 
   Memory_dumper(const Memory_dumper &) = delete;
-  Memory_dumper(Memory_dumper &&) = default;
+  Memory_dumper(Memory_dumper &&) = delete;
 
   Memory_dumper &operator=(const Memory_dumper &) = delete;
-  Memory_dumper &operator=(Memory_dumper &&) = default;
+  Memory_dumper &operator=(Memory_dumper &&) = delete;
 
-  ~Memory_dumper() = default;
+  ~Memory_dumper() { m_owner->ddl_memory_released(m_allocated); }
 
   const std::vector<Schema_dumper::Issue> &dump(
       const std::function<void(Memory_dumper *)> &func) {
     m_issues.clear();
 
+    // opening the file truncates the contents, but keeps the memory, so that
+    // the next object does not have to allocate it again
     m_file.open(Mode::WRITE);
     func(this);
     m_file.close();
 
+    if (const auto capacity = m_file.content().capacity();
+        capacity > m_allocated) {
+      m_owner->ddl_memory_allocated(capacity - m_allocated);
+      m_allocated = capacity;
+    }
+
     return issues();
   }
 
@@ -1727,13 +2776,141 @@ class Dumper::Memory_dumper final {
   }
 
  private:
+  const Dumper *m_owner;
   Schema_dumper *m_dumper;
   Memory_file m_file;
   std::vector<Schema_dumper::Issue> m_issues;
+  std::size_t m_allocated = 0;
 };
 
+std::size_t worker_instance(std::size_t worker, std::size_t read_replicas) {
+  return worker % (1 + read_replicas);
+}
+
+void start_consistent_snapshots(
+    const std::vector<std::shared_ptr<mysqlshdk::db::ISession>> &sessions) {
+  std::vector<std::exception_ptr> errors(sessions.size());
+  std::vector<std::thread> threads;
+  threads.reserve(sessions.size());
+
+  for (std::size_t i = 0; i < sessions.size(); ++i) {
+    threads.emplace_back(
+        mysqlsh::spawn_scoped_thread([&sessions, &errors, i]() {
+          mysqlsh::Mysql_thread mysql_thread;
+
+          try {
+            sessions[i]->execute("START TRANSACTION WITH CONSISTENT SNAPSHOT;");
+          } catch (...) {
+            errors[i] = std::current_exception();
+          }
+        }));
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (const auto &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+std::string worker_session_setup(const std::string &character_set,
+                                 bool use_timezone_utc) {
+  // all variables are set using a single statement, each worker session is
+  // initialized this way and every round trip counts on high latency links
+  auto sql = shcore::sqlformat(
+      "SET SQL_MODE = '', NAMES ?, "
+      // The amount of time the server should wait for us to read data from
+      // it like resultsets. Result reading can be delayed by slow uploads.
+      "SESSION net_write_timeout = ?, "
+      // Amount of time before server disconnects idle clients.
+      "SESSION wait_timeout = ?",
+      character_set, k_mysql_server_net_write_timeout,
+      k_mysql_server_wait_timeout);
+
+  if (use_timezone_utc) {
+    sql += ", TIME_ZONE = '+00:00'";
+  }
+
+  return sql;
+}
+
+std::vector<Histogram_bucket> parse_histogram_buckets(const std::string &type,
+                                                      const std::string &json) {
+  std::vector<Histogram_bucket> result;
+  bool singleton;
+
+  if ("singleton" == type) {
+    singleton = true;
+  } else if ("equi-height" == type) {
+    singleton = false;
+  } else {
+    return result;
+  }
+
+  rapidjson::Document doc;
+  doc.Parse(json.c_str(), json.length());
+
+  if (doc.HasParseError() || !doc.IsArray()) {
+    return result;
+  }
+
+  const auto to_number = [](const rapidjson::Value &v, long double *out) {
+    if (v.IsInt64()) {
+      *out = v.GetInt64();
+    } else if (v.IsUint64()) {
+      *out = v.GetUint64();
+    } else {
+      return false;
+    }
+
+    return true;
+  };
+
+  const rapidjson::SizeType expected_size = singleton ? 2 : 4;
+  double previous = 0.0;
+
+  for (const auto &b : doc.GetArray()) {
+    if (!b.IsArray() || b.Size() < expected_size) {
+      return {};
+    }
+
+    Histogram_bucket bucket;
+
+    if (!to_number(b[0], &bucket.lower) ||
+        !to_number(b[singleton ? 0 : 1], &bucket.upper)) {
+      return {};
+    }
+
+    const auto &frequency = b[singleton ? 1 : 2];
+
+    if (!frequency.IsNumber()) {
+      return {};
+    }
+
+    bucket.frequency = frequency.GetDouble();
+
+    if (bucket.upper < bucket.lower || bucket.frequency < previous ||
+        (!result.empty() && bucket.lower <= result.back().upper)) {
+      // histogram is malformed
+      return {};
+    }
+
+    previous = bucket.frequency;
+    result.emplace_back(bucket);
+  }
+
+  return result;
+}
+
 Dumper::Dumper(const Dump_options &options)
-    : m_options(options), m_progress_thread("Dump", options.show_progress()) {
+    : m_options(options),
+      m_progress_thread(
+          "Dump", options.show_progress() &&
+                      Progress_format::TEXT == options.progress_format()) {
   if (m_options.use_single_file()) {
     {
       using mysqlshdk::storage::utils::get_scheme;
@@ -1758,7 +2935,7 @@ Dumper::Dumper(const Dump_options &options)
     using mysqlshdk::storage::make_file;
     m_output_file =
         make_file(make_file(m_options.output_url(), m_options.storage_config()),
-                  m_options.compression());
+                  data_file_compression(), m_options.compression_options());
     m_output_dir = m_output_file->parent();
 
     if (m_output_dir->is_local() && !m_output_dir->exists()) {
@@ -1768,48 +2945,81 @@ Dumper::Dumper(const Dump_options &options)
           m_output_dir->full_path().masked() + "'.");
     }
   } else {
+    const auto validate_directory =
+        [](const mysqlshdk::storage::IDirectory &dir, const std::string &url,
+           const mysqlshdk::storage::Config_ptr &config) {
+          if (!dir.exists()) {
+            return;
+          }
+
+          const auto files = dir.list_files_sorted(true);
+
+          if (files.empty()) {
+            return;
+          }
+
+          std::vector<std::string> file_data;
+          const auto full_path = dir.full_path();
+
+          for (const auto &file : files) {
+            file_data.push_back(shcore::str_format(
+                "%s [size %zu]",
+                dir.join_path(full_path.masked(), file.name()).c_str(),
+                file.size()));
+          }
+
+          log_error(
+              "Unable to dump to %s, the directory exists and is not "
+              "empty:\n  %s",
+              full_path.masked().c_str(),
+              shcore::str_join(file_data, "\n  ").c_str());
+
+          if (config && config->valid()) {
+            throw std::invalid_argument(
+                "Cannot proceed with the dump, " + config->description() +
+                " already contains files with the specified prefix '" + url +
+                "'.");
+          } else {
+            throw std::invalid_argument(
+                "Cannot proceed with the dump, the specified directory '" +
+                url + "' already exists at the target location " +
+                full_path.masked() + " and is not empty.");
+          }
+        };
+
     using mysqlshdk::storage::make_directory;
     m_output_dir =
         make_directory(m_options.output_url(), m_options.storage_config());
 
-    if (m_output_dir->exists()) {
-      const auto files = m_output_dir->list_files_sorted(true);
+    validate_directory(*m_output_dir, m_options.output_url(),
+                       m_options.storage_config());
 
-      if (!files.empty()) {
-        std::vector<std::string> file_data;
-        const auto full_path = m_output_dir->full_path();
+    if (const auto &outputs = m_options.mirror_outputs(); !outputs.empty()) {
+      std::vector<std::unique_ptr<mysqlshdk::storage::IDirectory>> mirrors;
+      mirrors.reserve(outputs.size());
 
-        for (const auto &file : files) {
-          file_data.push_back(shcore::str_format(
-              "%s [size %zu]",
-              m_output_dir->join_path(full_path.masked(), file.name()).c_str(),
-              file.size()));
-        }
+      for (const auto &output : outputs) {
+        auto &mirror = mirrors.emplace_back(
+            make_directory(output.url, output.storage_config));
 
-        log_error(
-            "Unable to dump to %s, the directory exists and is not empty:\n  "
-            "%s",
-            full_path.masked().c_str(),
-            shcore::str_join(file_data, "\n  ").c_str());
-
-        if (m_options.storage_config() && m_options.storage_config()->valid()) {
-          throw std::invalid_argument(
-              "Cannot proceed with the dump, " +
-              m_options.storage_config()->description() +
-              " already contains files with the specified prefix '" +
-              m_options.output_url() + "'.");
-        } else {
-          throw std::invalid_argument(
-              "Cannot proceed with the dump, the specified directory '" +
-              m_options.output_url() +
-              "' already exists at the target location " + full_path.masked() +
-              " and is not empty.");
-        }
+        validate_directory(*mirror, output.url, output.storage_config);
       }
+
+      // each file is written to the primary location and copied to all the
+      // mirrors by the background threads
+      using mysqlshdk::storage::backend::Tee_directory;
+      m_output_dir = std::make_unique<Tee_directory>(
+          std::move(m_output_dir), std::move(mirrors),
+          m_options.mirror_max_lag());
     }
   }
 
-  if (import_table::Dialect::default_() == m_options.dialect()) {
+  if (Data_format::PARQUET == m_options.data_format()) {
+    m_writer_creator = [compression = m_options.compression()]() {
+      return std::make_unique<Parquet_dump_writer>(compression);
+    };
+    m_table_data_extension = "parquet";
+  } else if (import_table::Dialect::default_() == m_options.dialect()) {
     m_writer_creator = []() { return std::make_unique<Default_dump_writer>(); };
     m_table_data_extension = "tsv";
   } else if (import_table::Dialect::json() == m_options.dialect()) {
@@ -1833,8 +3043,16 @@ Dumper::Dumper(const Dump_options &options)
     m_table_data_extension = "txt";
   }
 
+  if (m_options.performance_report()) {
+    m_writer_creator = [creator = std::move(m_writer_creator)]() {
+      auto writer = creator();
+      writer->measure_write_time();
+      return writer;
+    };
+  }
+
   m_table_data_extension +=
-      mysqlshdk::storage::get_extension(m_options.compression());
+      mysqlshdk::storage::get_extension(data_file_compression());
 
   if (m_options.compatibility_options().is_set(
           Compatibility_option::STRIP_DEFINERS) &&
@@ -1848,7 +3066,20 @@ Dumper::Dumper(const Dump_options &options)
   }
 
   if (m_options.checksum()) {
-    m_checksum = std::make_unique<common::Checksums>();
+    if (m_options.streaming_checksum()) {
+      using common::Checksums;
+
+      m_checksum = std::make_unique<Checksums>(Checksums::Hash::SHA_256,
+                                               Checksums::Algorithm::STREAMING);
+      // needs to match the encoding used by Table_worker::prepare_query()
+      m_checksum->set_binary_encoding(
+          !encode_binary_columns()
+              ? Checksums::Binary_encoding::NONE
+              : (m_options.use_base64() ? Checksums::Binary_encoding::BASE64
+                                        : Checksums::Binary_encoding::HEX));
+    } else {
+      m_checksum = std::make_unique<common::Checksums>();
+    }
   }
 }
 
@@ -1859,23 +3090,52 @@ void Dumper::run() {
         "created.");
   }
 
+  {
+    const auto &total = m_options.total_rate_limit();
+    m_resources = Resource_governor::instance().acquire(
+        shcore::str_format("util.%s()", name()), m_options.worker_threads(),
+        total ? total->limit() : 0);
+  }
+
+  shcore::on_leave_scope release_resources([this]() { m_resources.reset(); });
+
   try {
     do_run();
   } catch (...) {
     kill_workers();
+    remove_incomplete_files();
     translate_current_exception(m_progress_thread);
   }
 
   if (m_worker_interrupt) {
+    remove_incomplete_files();
     // m_worker_interrupt is also used to signal exceptions from workers,
     // if we're here, then no exceptions were thrown and user pressed ^C
     throw shcore::cancelled("Interrupted by user");
   }
 }
 
-void Dumper::interrupt() {
-  current_console()->print_warning("Interrupted by user. Canceling...");
-  abort();
+void Dumper::remove_incomplete_files() const {
+  // if a single file is written, its directory may contain other files which
+  // do not belong to this dump
+  if (!directory() || directory()->is_local() || m_options.use_single_file() ||
+      Dry_run::DONT_WRITE_ANY_FILES == m_options.dry_run_mode()) {
+    return;
+  }
+
+  // multipart uploads which were not aborted by the writers (i.e. because of
+  // a network error) are not visible, but still use the storage
+  try {
+    directory()->remove_incomplete_files();
+  } catch (const std::exception &e) {
+    log_warning("Failed to abort pending multipart uploads in '%s': %s",
+                directory()->full_path().masked().c_str(), e.what());
+  }
+}
+
+void Dumper::interrupt() {
+  current_console()->print_warning("Interrupted by user. Canceling...");
+  abort();
 }
 
 void Dumper::abort() {
@@ -1897,6 +3157,9 @@ void Dumper::do_run() {
   //       2.2.2. else
   //         2.2.2.1. error and abort
   // start up sequence (consistent dump):
+  // 0. create worker sessions which use the source instance, initialize them
+  //    and set their transaction isolation level, so that the read locks are
+  //    held for as short as possible
   // 1. acquire read locks:
   //   1.1. if user is able to execute FTWRL:
   //     1.1.1. FLUSH TABLES WITH READ LOCK
@@ -1907,9 +3170,12 @@ void Dumper::do_run() {
   //     1.2.4. create one or more new sessions and LOCK dumped TABLES
   //     1.2.5. if there are any errors, abort
   // 2. start a transaction
-  // 3. create worker threads, each thread:
-  //   3.1. creates a new session
-  //   3.2. starts a transaction
+  // 3. create worker sessions:
+  //   3.1. if read replicas are used, sessions are distributed between the
+  //        source and the replicas, replicas are synchronized with the source
+  //        while read locks are held, replica sessions are created now
+  //   3.2. all sessions start their transactions concurrently
+  //   3.3. create worker threads
   // 4. gather information about objects to be dumped:
   //   4.1. if 1.2.3. was not executed, do this now
   //   4.2. fetch server metadata (i.e. gtid_executed, binlog file and position)
@@ -1935,16 +3201,34 @@ void Dumper::do_run() {
 
   {
     m_worker_interrupt = false;
+    publish_progress();
     m_progress_thread.start();
     shcore::on_leave_scope cleanup_progress([this]() { shutdown_progress(); });
     m_current_stage = m_progress_thread.start_stage("Initializing");
 
+    read_incremental_base();
+
+    read_previous_dump();
+
     open_session();
 
     throw_if_cannot_dump_users();
 
     fetch_user_privileges();
 
+    shcore::on_leave_scope close_worker_sessions([this]() {
+      // closes the sessions which were not handed over to the workers
+      for (const auto &s : m_worker_sessions) {
+        if (s) {
+          s->close();
+        }
+      }
+
+      m_worker_sessions.clear();
+    });
+
+    open_worker_sessions();
+
     {
       shcore::on_leave_scope read_locks([this]() { release_read_locks(); });
 
@@ -1954,8 +3238,12 @@ void Dumper::do_run() {
         return;
       }
 
+      open_read_replicas();
+
       create_worker_sessions();
 
+      check_in_flight_transactions();
+
       create_worker_threads();
 
       m_current_stage->finish();
@@ -1992,6 +3280,7 @@ void Dumper::do_run() {
 
     create_schema_tasks();
 
+    validate_incremental_dump();
     validate_privileges();
     initialize_counters();
     validate_mds();
@@ -2042,6 +3331,7 @@ void Dumper::do_run() {
 
     maybe_push_shutdown_tasks();
     wait_for_all_tasks();
+    unlock_tablespaces();
 
     if (!m_worker_interrupt) {
       finalize_dump();
@@ -2097,20 +3387,13 @@ void Dumper::on_init_thread_session(
     const std::shared_ptr<mysqlshdk::db::ISession> &session) const {
   // transaction cannot be started here, as the main thread has to acquire read
   // locks first
-  execute(session, "SET SQL_MODE = '';");
-  executef(session, "SET NAMES ?;", m_options.character_set());
+  execute(session, worker_session_setup(m_options.character_set(),
+                                        m_options.use_timezone_utc()));
 
-  // The amount of time the server should wait for us to read data from it
-  // like resultsets. Result reading can be delayed by slow uploads.
-  executef(session, "SET SESSION net_write_timeout = ?",
-           k_mysql_server_net_write_timeout);
-
-  // Amount of time before server disconnects idle clients.
-  executef(session, "SET SESSION wait_timeout = ?",
-           k_mysql_server_wait_timeout);
-
-  if (m_options.use_timezone_utc()) {
-    execute(session, "SET TIME_ZONE = '+00:00';");
+  if (const auto classic =
+          std::dynamic_pointer_cast<mysqlshdk::db::mysql::Session>(session)) {
+    classic->set_prepared_statement_cache_size(
+        k_prepared_statement_cache_size);
   }
 }
 
@@ -2142,6 +3425,11 @@ void Dumper::open_session() {
 }
 
 void Dumper::close_session() {
+  if (m_export_session) {
+    m_export_session->close();
+    m_export_session.reset();
+  }
+
   if (m_session) {
     m_session->close();
   }
@@ -2402,6 +3690,11 @@ void Dumper::acquire_read_locks() {
     }
   }
 
+  if (m_ftwrl_used && !m_options.is_dry_run()) {
+    m_read_locks_acquired = true;
+    m_read_locks_duration.start();
+  }
+
   if (!m_ftwrl_used) {
     current_console()->print_warning(
         "The current user lacks privileges to acquire a global read lock "
@@ -2419,6 +3712,11 @@ void Dumper::acquire_read_locks() {
     try {
       lock_all_tables();
 
+      if (!m_options.is_dry_run()) {
+        m_read_locks_acquired = true;
+        m_read_locks_duration.start();
+      }
+
       current_console()->print_info("Table locks acquired");
     } catch (const mysqlshdk::db::Error &e) {
       handle_error(e.format());
@@ -2434,7 +3732,7 @@ void Dumper::acquire_read_locks() {
   start_transaction(session());
 }
 
-void Dumper::release_read_locks() const {
+void Dumper::release_read_locks() {
   if (!m_options.consistent_dump()) {
     return;
   }
@@ -2452,6 +3750,14 @@ void Dumper::release_read_locks() const {
     execute("UNLOCK TABLES;");
   }
 
+  if (m_read_locks_acquired) {
+    m_read_locks_acquired = false;
+    m_read_locks_duration.finish();
+
+    log_info("Read locks were held for %.3f ms",
+             m_read_locks_duration.milliseconds_elapsed());
+  }
+
   if (!m_worker_interrupt) {
     // we've been interrupted, we still need to release locks, but don't
     // inform the user
@@ -2459,11 +3765,19 @@ void Dumper::release_read_locks() const {
   }
 }
 
-void Dumper::start_transaction(
+void Dumper::prepare_transaction(
     const std::shared_ptr<mysqlshdk::db::ISession> &session) const {
   if (m_options.consistent_dump() && !m_options.is_dry_run()) {
     execute(session,
             "SET SESSION TRANSACTION ISOLATION LEVEL REPEATABLE READ;");
+  }
+}
+
+void Dumper::start_transaction(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session) const {
+  prepare_transaction(session);
+
+  if (m_options.consistent_dump() && !m_options.is_dry_run()) {
     execute(session, "START TRANSACTION WITH CONSISTENT SNAPSHOT;");
   }
 }
@@ -2547,10 +3861,29 @@ void Dumper::initialize_instance_cache() {
   m_current_stage = m_progress_thread.start_stage("Gathering information");
   shcore::on_leave_scope finish_stage([this]() { m_current_stage->finish(); });
 
+  Instance_cache_builder::Sessions sessions;
+  shcore::on_leave_scope close_sessions([&sessions]() {
+    for (const auto &s : sessions) {
+      s->close();
+    }
+  });
+
+  if (m_cache.schemas.size() > 1) {
+    // main session is also used to fetch metadata
+    const auto count =
+        std::min(m_options.threads(), k_max_metadata_sessions) - 1;
+
+    for (std::size_t i = 0; i < count; ++i) {
+      auto s = establish_session(session()->get_connection_options(), false);
+      on_init_thread_session(s);
+      sessions.emplace_back(std::move(s));
+    }
+  }
+
   auto builder = Instance_cache_builder(session(), m_options.filters(),
                                         std::move(m_cache));
 
-  builder.metadata(m_options.included_partitions());
+  builder.metadata(m_options.included_partitions(), sessions);
 
   if (dump_users()) {
     builder.users();
@@ -2629,6 +3962,18 @@ void Dumper::create_schema_tasks() {
   if (has_partitions) {
     m_used_capabilities.emplace(Capability::PARTITION_AWARENESS);
   }
+
+  if (m_options.physical() && m_options.dump_data()) {
+    m_used_capabilities.emplace(Capability::PHYSICAL_TABLESPACES);
+  }
+
+  if (m_previous_dump && m_options.dump_data()) {
+    m_used_capabilities.emplace(Capability::TABLE_DATA_REFERENCES);
+  }
+
+  if (m_options.compression_dictionary() && m_options.dump_data()) {
+    m_used_capabilities.emplace(Capability::COMPRESSION_DICTIONARY);
+  }
 }
 
 void Dumper::validate_mds() const {
@@ -2673,36 +4018,37 @@ void Dumper::validate_mds() const {
   shcore::on_leave_scope finish_stage([this]() { m_current_stage->finish(); });
 
   const auto issues = [&status](const auto &memory) {
-    status.set(show_issues(memory->issues()));
+    status.set(show_issues(memory.issues()));
   };
 
   const auto dumper = schema_dumper(session());
+  const auto memory = memory_dumper(dumper.get());
 
   if (dump_users()) {
-    issues(dump_users(dumper.get()));
+    issues(dump_users(memory.get()));
   }
 
   if (m_options.dump_ddl()) {
     for (const auto &schema : m_schema_infos) {
-      issues(dump_schema(dumper.get(), schema.name));
+      issues(dump_schema(memory.get(), schema.name));
       ++objects_checked;
     }
 
     for (const auto &schema : m_schema_infos) {
       for (const auto &table : schema.tables) {
-        issues(dump_table(dumper.get(), schema.name, table.name));
+        issues(dump_table(memory.get(), schema.name, table.name));
 
         if (m_options.dump_triggers() &&
             dumper->count_triggers_for_table(schema.name, table.name) > 0) {
-          issues(dump_triggers(dumper.get(), schema.name, table.name));
+          issues(dump_triggers(memory.get(), schema.name, table.name));
         }
 
         ++objects_checked;
       }
 
       for (const auto &view : schema.views) {
-        issues(dump_temporary_view(dumper.get(), schema.name, view.name));
-        issues(dump_view(dumper.get(), schema.name, view.name));
+        issues(dump_temporary_view(memory.get(), schema.name, view.name));
+        issues(dump_view(memory.get(), schema.name, view.name));
 
         ++objects_checked;
       }
@@ -2825,6 +4171,7 @@ void Dumper::initialize_counters() {
   m_bytes_written = 0;
   m_data_bytes = 0;
   m_table_data_stats.clear();
+  m_performance.clear();
 
   m_data_throughput = std::make_unique<mysqlshdk::textui::Throughput>();
   m_bytes_throughput = std::make_unique<mysqlshdk::textui::Throughput>();
@@ -2834,6 +4181,8 @@ void Dumper::initialize_counters() {
   m_num_threads_dumping = 0;
 
   m_ddl_written = 0;
+  m_ddl_memory = 0;
+  m_ddl_memory_peak = 0;
   m_schema_metadata_written = 0;
   m_table_metadata_to_write = 0;
   m_table_metadata_written = 0;
@@ -2845,7 +4194,9 @@ void Dumper::initialize_dump() {
   }
 
   create_output_directory();
+  open_journal();
   write_metadata();
+  open_metadata_index();
 }
 
 void Dumper::finalize_dump() {
@@ -2854,7 +4205,12 @@ void Dumper::finalize_dump() {
   }
 
   write_checksum_metadata();
+  write_performance_report();
+  // index has to be complete before the dump is marked as finished
+  close_metadata_index();
   write_dump_finished_metadata();
+  // @.done.json is the last file in the journal
+  close_journal();
   close_output_directory();
 }
 
@@ -2885,28 +4241,191 @@ void Dumper::close_output_directory() {
   m_output_dir.reset();
 }
 
-void Dumper::create_worker_sessions() {
+void Dumper::open_read_replicas() {
+  m_read_replicas.clear();
+
+  const auto &replicas = m_options.read_replicas();
+
+  if (replicas.empty()) {
+    return;
+  }
+
+  const auto console = current_console();
+  const auto consistent = m_options.consistent_dump();
+
+  if (consistent && !m_gtid_enabled) {
+    throw std::invalid_argument(
+        "The 'readReplicas' option requires GTIDs to be enabled on the source "
+        "instance when the 'consistent' option is set to true.");
+  }
+
+  const auto &source_co = session()->get_connection_options();
+  const auto source_uuid = mysqlshdk::mysql::Instance(session()).get_uuid();
+  std::string source_gtid_set;
+
+  if (consistent) {
+    // read locks are held, gtid_executed is not going to change, workers which
+    // use the replicas are going to see the same data as the ones which use
+    // the source
+    source_gtid_set = Gtid_set::from_string(
+                          mysqlshdk::mysql::get_executed_gtid_set(
+                              mysqlshdk::mysql::Instance(session())))
+                          .normalize()
+                          .str();
+  }
+
+  for (auto co : replicas) {
+    const auto address = co.uri_endpoint();
+
+    if (!co.has_user() && source_co.has_user()) {
+      co.set_user(source_co.get_user());
+    }
+
+    if (!co.has_password() && source_co.has_password() &&
+        co.get_user() == source_co.get_user()) {
+      co.set_password(source_co.get_password());
+    }
+
+    if (!co.has_net_read_timeout()) {
+      co.set_net_read_timeout(source_co.get_net_read_timeout());
+    }
+
+    if (!co.has(mysqlshdk::db::kMaxAllowedPacket) &&
+        source_co.has(mysqlshdk::db::kMaxAllowedPacket)) {
+      co.set(mysqlshdk::db::kMaxAllowedPacket,
+             source_co.get(mysqlshdk::db::kMaxAllowedPacket));
+    }
+
+    std::shared_ptr<mysqlshdk::db::ISession> replica;
+
+    try {
+      replica = establish_session(co, false);
+    } catch (const mysqlshdk::db::Error &e) {
+      throw std::runtime_error("Could not connect to the read replica '" +
+                               address + "': " + e.format());
+    }
+
+    shcore::on_leave_scope close_replica([&replica]() { replica->close(); });
+
+    const mysqlshdk::mysql::Instance instance{replica};
+
+    if (instance.get_uuid() == source_uuid) {
+      throw std::invalid_argument("The read replica '" + address +
+                                  "' refers to the source instance.");
+    }
+
+    if (consistent && !m_options.is_dry_run()) {
+      console->print_info("Waiting for the read replica '" + address +
+                          "' to apply the transactions of the source");
+
+      if (!source_gtid_set.empty() &&
+          !mysqlshdk::mysql::wait_for_gtid_set(instance, source_gtid_set,
+                                               k_read_replica_sync_timeout)) {
+        THROW_ERROR(SHERR_DUMP_READ_REPLICA_SYNC_TIMEOUT, address.c_str(),
+                    k_read_replica_sync_timeout);
+      }
+
+      if (m_ftwrl_used) {
+        // source is not going to execute any new transactions, any extra
+        // GTIDs on the replica were not executed by the source
+        const auto errant =
+            Gtid_set::from_string(
+                mysqlshdk::mysql::get_executed_gtid_set(instance))
+                .normalize()
+                .subtract(Gtid_set::from_normalized_string(source_gtid_set));
+
+        if (!errant.empty()) {
+          THROW_ERROR(SHERR_DUMP_READ_REPLICA_ERRANT_TRANSACTIONS,
+                      address.c_str(), errant.str().c_str());
+        }
+      }
+    }
+
+    console->print_info("Table data is going to be read also from '" +
+                        address + "'");
+
+    m_read_replicas.emplace_back(std::move(co));
+  }
+
+  if (m_options.threads() <= m_read_replicas.size()) {
+    console->print_note(shcore::str_format(
+        "The number of threads (%" PRIu64
+        ") is not greater than the number of read replicas (%zu), some of the "
+        "instances are not going to be used.",
+        static_cast<uint64_t>(m_options.threads()), m_read_replicas.size()));
+  }
+}
+
+void Dumper::open_worker_sessions() {
+  m_worker_sessions.clear();
+  m_worker_sessions.reserve(m_options.threads());
+
+  auto co = session()->get_connection_options();
+  common::set_session_compression(m_options.session_compression(), session(),
+                                  &co);
+
+  // if read replicas are used, workers are distributed evenly between the
+  // source and the replicas, replicas are not synchronized yet, sessions which
+  // use them are opened later on
+  const auto replicas = m_options.read_replicas().size();
+
   for (std::size_t i = 0; i < m_options.threads(); ++i) {
-    auto worker_session =
-        establish_session(session()->get_connection_options(), false);
+    auto &worker_session = m_worker_sessions.emplace_back();
+
+    if (0 == worker_instance(i, replicas)) {
+      worker_session = establish_session(co, false);
+      on_init_thread_session(worker_session);
+      prepare_transaction(worker_session);
+    }
+  }
+}
+
+void Dumper::create_worker_sessions() {
+  assert(m_worker_sessions.size() == m_options.threads());
+
+  for (std::size_t i = 0; i < m_worker_sessions.size(); ++i) {
+    auto &worker_session = m_worker_sessions[i];
+
+    if (!worker_session) {
+      auto co =
+          m_read_replicas[worker_instance(i, m_read_replicas.size()) - 1];
+      common::set_session_compression(m_options.session_compression(),
+                                      session(), &co);
+
+      worker_session = establish_session(co, false);
+      on_init_thread_session(worker_session);
+      prepare_transaction(worker_session);
+    }
+  }
 
-    start_transaction(worker_session);
-    on_init_thread_session(worker_session);
+  if (m_options.consistent_dump() && !m_options.is_dry_run()) {
+    // read locks are held, all snapshots are started at the same time
+    start_consistent_snapshots(m_worker_sessions);
+  }
 
+  for (auto &worker_session : m_worker_sessions) {
     m_session_pool.push(std::move(worker_session));
   }
+
+  m_worker_sessions.clear();
 }
 
 void Dumper::create_worker_threads() {
   m_worker_exceptions.clear();
-  m_worker_exceptions.resize(m_options.worker_threads());
+  // number of threads may be limited by the global budget
+  const auto threads = m_resources->threads();
+  m_worker_exceptions.resize(threads);
+  m_thread_affinity = mysqlshdk::utils::to_thread_affinity(
+      current_shell_options()->get().util.thread_affinity);
 
-  for (std::size_t i = 0; i < m_options.worker_threads(); ++i) {
+  for (std::size_t i = 0; i < threads; ++i) {
     auto t = mysqlsh::spawn_scoped_thread(
         &Table_worker::run,
         Table_worker{i, this, Table_worker::Exception_strategy::ABORT});
     m_workers.emplace_back(std::move(t));
   }
+
+  start_small_file_writer();
 }
 
 void Dumper::maybe_push_shutdown_tasks() {
@@ -2944,6 +4463,18 @@ void Dumper::wait_for_all_tasks() {
     worker.join();
   }
 
+  // all the DDL and metadata files need to be written before the dump is
+  // finalized
+  wait_for_small_file_writer();
+
+  if (!m_output_parts.empty()) {
+    if (m_worker_interrupt) {
+      remove_output_parts();
+    } else {
+      write_output_parts();
+    }
+  }
+
   // when using a single file as an output, it's not closed until the whole
   // dump is done
   if (m_output_file && m_output_file->is_open()) {
@@ -2953,6 +4484,72 @@ void Dumper::wait_for_all_tasks() {
   m_workers.clear();
 }
 
+void Dumper::write_output_parts() {
+  m_current_stage = m_progress_thread.start_stage("Writing the output file");
+  shcore::on_leave_scope finish_stage([this]() { m_current_stage->finish(); });
+  // parts are removed as soon as they are copied, this removes the remaining
+  // ones in case of an error
+  shcore::on_leave_scope cleanup([this]() { remove_output_parts(); });
+
+  std::string buffer;
+  buffer.resize(4 * 1024 * 1024);
+
+  m_output_file->open(Mode::WRITE);
+
+  for (const auto &name : m_output_parts) {
+    const auto part = make_file(name, true);
+
+    part->open(Mode::READ);
+
+    while (true) {
+      const auto bytes = part->read(buffer.data(), buffer.size());
+
+      if (bytes < 0) {
+        throw std::runtime_error("Failed to read from '" +
+                                 part->full_path().masked() +
+                                 "', error: " + std::to_string(part->error()));
+      }
+
+      if (0 == bytes) {
+        break;
+      }
+
+      if (m_output_file->write(buffer.data(), bytes) != bytes) {
+        throw std::runtime_error("Failed to write to '" +
+                                 m_output_file->full_path().masked() + "'");
+      }
+
+      if (m_worker_interrupt) {
+        break;
+      }
+    }
+
+    part->close();
+    part->remove();
+
+    if (m_worker_interrupt) {
+      break;
+    }
+  }
+
+  m_output_file->close();
+}
+
+void Dumper::remove_output_parts() {
+  for (const auto &name : m_output_parts) {
+    try {
+      if (const auto part = make_file(name, false); part->exists()) {
+        part->remove();
+      }
+    } catch (const std::exception &e) {
+      log_warning("Failed to remove the part file '%s': %s", name.c_str(),
+                  e.what());
+    }
+  }
+
+  m_output_parts.clear();
+}
+
 void Dumper::dump_ddl() const {
   if (!m_options.dump_ddl()) {
     return;
@@ -3000,8 +4597,9 @@ void Dumper::dump_users_ddl() const {
   current_console()->print_status("Writing users DDL");
 
   const auto dumper = schema_dumper(session());
+  const auto memory = memory_dumper(dumper.get());
 
-  write_ddl(*dump_users(dumper.get()), "@.users.sql");
+  write_ddl(dump_users(memory.get()), "@.users.sql");
 }
 
 void Dumper::write_ddl(const Memory_dumper &in_memory,
@@ -3021,28 +4619,85 @@ void Dumper::write_ddl(const Memory_dumper &in_memory,
     return;
   }
 
-  const auto output = make_file(file);
-  output->open(Mode::WRITE);
+  write_small_file(file, in_memory.content());
+}
 
-  const auto &content = in_memory.content();
-  output->write(content.c_str(), content.length());
+void Dumper::write_small_file(const std::string &filename,
+                              std::string contents) const {
+  if (m_small_file_writer) {
+    m_small_file_writer->write(filename, std::move(contents));
+  } else {
+    write_file(filename, contents);
+  }
+}
 
+void Dumper::write_file(const std::string &filename,
+                        const std::string &contents) const {
+  const auto output = make_file(filename);
+  output->open(Mode::WRITE);
+  output->write(contents.c_str(), contents.length());
   output->close();
 }
 
-std::unique_ptr<Dumper::Memory_dumper> Dumper::dump_ddl(
-    Schema_dumper *dumper,
-    const std::function<void(Memory_dumper *)> &func) const {
-  auto memory = std::make_unique<Memory_dumper>(dumper);
+void Dumper::start_small_file_writer() {
+  if (Dry_run::DONT_WRITE_ANY_FILES == m_options.dry_run_mode() ||
+      !directory() || directory()->is_local()) {
+    return;
+  }
+
+  // each file is a separate request to the remote storage, these are issued
+  // concurrently, so that latency of a request is not paid for every file
+  m_small_file_writer = std::make_unique<Small_file_writer>(
+      m_workers.size() * k_small_file_writers_per_thread,
+      [this](const std::string &filename, const std::string &contents) {
+        try {
+          write_file(filename, contents);
+        } catch (const std::exception &e) {
+          current_console()->print_error("Error while writing '" + filename +
+                                         "': " + e.what());
+          throw;
+        }
+      });
+}
+
+void Dumper::wait_for_small_file_writer() {
+  if (!m_small_file_writer) {
+    return;
+  }
+
+  if (m_worker_interrupt) {
+    m_small_file_writer->terminate();
+  }
+
+  try {
+    m_small_file_writer->wait();
+  } catch (const std::exception &e) {
+    log_error("Writing of the DDL and metadata files has failed: %s",
+              e.what());
+    m_worker_exceptions.emplace_back(std::current_exception());
+    m_worker_exception_thrown = true;
+    emergency_shutdown();
+  }
+
+  m_small_file_writer.reset();
+}
+
+std::unique_ptr<Dumper::Memory_dumper> Dumper::memory_dumper(
+    Schema_dumper *dumper) const {
+  return std::make_unique<Memory_dumper>(this, dumper);
+}
 
+const Dumper::Memory_dumper &Dumper::dump_ddl(
+    Memory_dumper *memory,
+    const std::function<void(Memory_dumper *)> &func) const {
   memory->dump(func);
 
-  return memory;
+  return *memory;
 }
 
-std::unique_ptr<Dumper::Memory_dumper> Dumper::dump_schema(
-    Schema_dumper *dumper, const std::string &schema) const {
-  return dump_ddl(dumper, [&schema, this](Memory_dumper *m) {
+const Dumper::Memory_dumper &Dumper::dump_schema(
+    Memory_dumper *memory, const std::string &schema) const {
+  return dump_ddl(memory, [&schema, this](Memory_dumper *m) {
     m->dump(&Schema_dumper::write_comment, schema, std::string{});
     m->dump(&Schema_dumper::dump_schema_ddl, schema);
 
@@ -3056,50 +4711,63 @@ std::unique_ptr<Dumper::Memory_dumper> Dumper::dump_schema(
   });
 }
 
-std::unique_ptr<Dumper::Memory_dumper> Dumper::dump_table(
-    Schema_dumper *dumper, const std::string &schema,
+const Dumper::Memory_dumper &Dumper::dump_table(
+    Memory_dumper *memory, const std::string &schema,
     const std::string &table) const {
-  return dump_ddl(dumper, [&schema, &table](Memory_dumper *m) {
+  return dump_ddl(memory, [&schema, &table](Memory_dumper *m) {
     m->dump(&Schema_dumper::write_comment, schema, table);
     m->dump(&Schema_dumper::dump_table_ddl, schema, table);
   });
 }
 
-std::unique_ptr<Dumper::Memory_dumper> Dumper::dump_triggers(
-    Schema_dumper *dumper, const std::string &schema,
+const Dumper::Memory_dumper &Dumper::dump_triggers(
+    Memory_dumper *memory, const std::string &schema,
     const std::string &table) const {
-  return dump_ddl(dumper, [&schema, &table](Memory_dumper *m) {
+  return dump_ddl(memory, [&schema, &table](Memory_dumper *m) {
     m->dump(&Schema_dumper::write_comment, schema, table);
     m->dump(&Schema_dumper::dump_triggers_for_table_ddl, schema, table);
   });
 }
 
-std::unique_ptr<Dumper::Memory_dumper> Dumper::dump_temporary_view(
-    Schema_dumper *dumper, const std::string &schema,
+const Dumper::Memory_dumper &Dumper::dump_temporary_view(
+    Memory_dumper *memory, const std::string &schema,
     const std::string &view) const {
-  return dump_ddl(dumper, [&schema, &view](Memory_dumper *m) {
+  return dump_ddl(memory, [&schema, &view](Memory_dumper *m) {
     m->dump(&Schema_dumper::write_comment, schema, view);
     m->dump(&Schema_dumper::dump_temporary_view_ddl, schema, view);
   });
 }
 
-std::unique_ptr<Dumper::Memory_dumper> Dumper::dump_view(
-    Schema_dumper *dumper, const std::string &schema,
+const Dumper::Memory_dumper &Dumper::dump_view(
+    Memory_dumper *memory, const std::string &schema,
     const std::string &view) const {
-  return dump_ddl(dumper, [&schema, &view](Memory_dumper *m) {
+  return dump_ddl(memory, [&schema, &view](Memory_dumper *m) {
     m->dump(&Schema_dumper::write_comment, schema, view);
     m->dump(&Schema_dumper::dump_view_ddl, schema, view);
   });
 }
 
-std::unique_ptr<Dumper::Memory_dumper> Dumper::dump_users(
-    Schema_dumper *dumper) const {
-  return dump_ddl(dumper, [this](Memory_dumper *m) {
+const Dumper::Memory_dumper &Dumper::dump_users(
+    Memory_dumper *memory) const {
+  return dump_ddl(memory, [this](Memory_dumper *m) {
     m->dump(&Schema_dumper::write_comment, std::string{}, std::string{});
     m->dump(&Schema_dumper::dump_grants, m_options.filters());
   });
 }
 
+void Dumper::ddl_memory_allocated(std::size_t bytes) const {
+  const auto current = m_ddl_memory += bytes;
+  auto peak = m_ddl_memory_peak.load();
+
+  while (current > peak &&
+         !m_ddl_memory_peak.compare_exchange_weak(peak, current)) {
+  }
+}
+
+void Dumper::ddl_memory_released(std::size_t bytes) const {
+  m_ddl_memory -= bytes;
+}
+
 void Dumper::create_schema_metadata_tasks() {
   if (Dry_run::DONT_WRITE_ANY_FILES == m_options.dry_run_mode() ||
       m_options.is_export_only()) {
@@ -3149,10 +4817,31 @@ void Dumper::create_schema_ddl_tasks() {
                           shcore::Queue_priority::HIGH);
     }
 
-    for (const auto &table : schema.tables) {
-      m_worker_tasks.push({"writing DDL of " + table.quoted_name,
-                           [&schema, &table](Table_worker *worker) {
-                             worker->dump_table_ddl(schema, table);
+    // tables are processed in batches, so that schemas with lots of tables
+    // do not generate a separate task (and session setup) for each one of
+    // them, while still being distributed between all the worker threads
+    for (std::size_t i = 0; i < schema.tables.size();
+         i += k_tables_per_ddl_task) {
+      std::vector<const Table_info *> tables;
+      const auto end =
+          std::min(schema.tables.size(), i + k_tables_per_ddl_task);
+
+      tables.reserve(end - i);
+
+      for (auto j = i; j < end; ++j) {
+        tables.emplace_back(&schema.tables[j]);
+      }
+
+      std::string info = "writing DDL of " + tables.front()->quoted_name;
+
+      if (tables.size() > 1) {
+        info += " and " + std::to_string(tables.size() - 1) + " more tables";
+      }
+
+      m_worker_tasks.push({std::move(info),
+                           [&schema, tables = std::move(tables)](
+                               Table_worker *worker) {
+                             worker->dump_tables_ddl(schema, tables);
                            }},
                           shcore::Queue_priority::HIGH);
     }
@@ -3189,12 +4878,19 @@ void Dumper::create_table_tasks() {
                                                     std::move(config));
   }
 
-  const auto console = current_console();
+  std::vector<Table_task> tasks;
 
   for (const auto &schema : m_schema_infos) {
     for (const auto &table : schema.tables) {
       auto task = create_table_task(schema, table);
 
+      if (write_metadata && m_previous_dump && m_options.dump_data()) {
+        // metadata is written once it's known if table has changed
+        ++m_table_metadata_to_write;
+        push_fingerprint_task(std::move(task));
+        continue;
+      }
+
       if (write_metadata) {
         ++m_table_metadata_to_write;
 
@@ -3210,19 +4906,29 @@ void Dumper::create_table_tasks() {
                                      task.index.info, task.extra_filter);
       }
 
-      push_table_task(std::move(task));
+      tasks.emplace_back(std::move(task));
     }
 
     // BUG#34663934 - allow exporting data from views
     if (m_options.is_export_only()) {
       for (const auto &view : schema.views) {
-        push_table_task(create_table_task(schema, view));
+        tasks.emplace_back(create_table_task(schema, view));
       }
     }
   }
 
   m_all_table_metadata_tasks_scheduled = true;
 
+  sort_largest_first(&tasks);
+
+  if (m_options.physical()) {
+    push_tablespace_tasks(std::move(tasks));
+  } else {
+    for (auto &task : tasks) {
+      push_table_task(std::move(task));
+    }
+  }
+
   m_main_thread_finished_producing_chunking_tasks = true;
 }
 
@@ -3238,6 +4944,33 @@ Dumper::Table_task Dumper::create_table_task(const Schema_info &schema,
   std::tie(task.index.info, task.index.is_pke) = select_index(*table.info);
   task.partitions = table.partitions;
   task.extra_filter = m_options.where(schema.name, table.name);
+  task.compression = m_options.compression_options();
+  task.watermark_column = m_options.watermark_column(schema.name, table.name);
+
+  if (!task.watermark_column.empty() || m_incremental_base) {
+    // loader compares the number of rows with the target table to detect rows
+    // which were deleted, this is not possible if only some of them are dumped
+    const auto &partitions = m_options.included_partitions();
+    const auto p = partitions.find(schema.name);
+
+    task.count_rows =
+        task.extra_filter.empty() &&
+        (partitions.end() == p || !p->second.count(table.name));
+  }
+
+  if (m_options.physical() && m_options.dump_data()) {
+    task.tablespaces = find_tablespaces(schema, table);
+  }
+
+  if (const auto filter =
+          incremental_filter(schema.name, table.name, task.watermark_column);
+      !filter.empty()) {
+    if (task.extra_filter.empty()) {
+      task.extra_filter = filter;
+    } else {
+      task.extra_filter += " AND " + filter;
+    }
+  }
 
   on_create_table_task(task.schema, task.name, task.info);
 
@@ -3254,6 +4987,7 @@ Dumper::Table_task Dumper::create_table_task(const Schema_info &schema,
   task.basename = view.basename;
   task.info = view.info;
   task.extra_filter = m_options.where(schema.name, view.name);
+  task.compression = m_options.compression_options();
 
   on_create_table_task(task.schema, task.name, task.info);
 
@@ -3295,7 +5029,8 @@ void Dumper::push_table_task(Table_task &&task) {
     if (!index) {
       log_info(
           "Could not select columns to be used as an index for table %s. Data "
-          "will be dumped to multiple files by a single thread.",
+          "will be dumped to multiple files, rows will be split between the "
+          "threads using a hash.",
           task.quoted_name.c_str());
     } else {
       log_info("The %s will be %s using %s", context.c_str(),
@@ -3315,7 +5050,10 @@ void Dumper::push_table_task(Table_task &&task) {
   std::vector<Table_task> tasks;
   tasks.reserve(task.partitions.size());
 
-  if (m_options.is_export_only() || task.partitions.empty()) {
+  // export to a single file which is written by one thread uses one query for
+  // all the partitions
+  if ((m_options.is_export_only() && !m_options.split()) ||
+      task.partitions.empty()) {
     tasks.emplace_back(std::move(task));
   } else {
     for (const auto &partition : task.partitions) {
@@ -3329,6 +5067,8 @@ void Dumper::push_table_task(Table_task &&task) {
 
       tasks.emplace_back(std::move(copy));
     }
+
+    sort_largest_first(&tasks);
   }
 
   for (auto &t : tasks) {
@@ -3340,11 +5080,218 @@ void Dumper::push_table_task(Table_task &&task) {
   }
 }
 
+std::vector<Dumper::Tablespace_file> Dumper::find_tablespaces(
+    const Schema_info &schema, const Table_info &table) {
+  if (m_datadir.empty()) {
+    m_datadir = query("SELECT @@datadir")->fetch_one_or_throw()->get_string(0);
+  }
+
+  std::string name;
+
+  try {
+    name = common::encode_server_filename(schema.name) + "/" +
+           common::encode_server_filename(table.name);
+  } catch (const std::invalid_argument &e) {
+    throw std::runtime_error("Cannot dump the table " + table.quoted_name +
+                             " in physical mode: " + e.what());
+  }
+
+  // partitions use separate files, names are: table#p#partition
+  const auto partitions = shcore::str_replace(name, "_", "\\_") + "#p#%";
+  const auto result = session()->queryf(
+      "SELECT d.PATH FROM information_schema.INNODB_TABLES t JOIN "
+      "information_schema.INNODB_DATAFILES d ON t.SPACE = d.SPACE WHERE "
+      "t.SPACE_TYPE = 'Single' AND (t.NAME = ? OR t.NAME LIKE ?) ORDER BY "
+      "d.PATH",
+      name, partitions);
+
+  std::vector<Tablespace_file> tablespaces;
+
+  while (const auto row = result->fetch_one()) {
+    auto path = row->get_string(0);
+
+    if (shcore::str_beginswith(path, "./")) {
+      path = shcore::path::join_path(m_datadir, path.substr(2));
+    }
+
+    if (!shcore::is_file(path)) {
+      throw std::runtime_error(
+          "Cannot dump the table " + table.quoted_name +
+          " in physical mode, its tablespace file '" + path +
+          "' is not accessible, the shell has to run on the same host as the "
+          "server.");
+    }
+
+    auto &tablespace = tablespaces.emplace_back();
+    // strip the .ibd extension
+    tablespace.path = path.substr(0, path.length() - 4);
+    tablespace.name = shcore::path::basename(tablespace.path);
+  }
+
+  if (tablespaces.empty()) {
+    throw std::runtime_error("Cannot dump the table " + table.quoted_name +
+                             " in physical mode, it does not use a "
+                             "file-per-table InnoDB tablespace.");
+  }
+
+  for (std::size_t i = 0; i < tablespaces.size(); ++i) {
+    tablespaces[i].basename =
+        common::get_tablespace_basename(table.basename, i);
+  }
+
+  return tablespaces;
+}
+
+void Dumper::push_tablespace_tasks(std::vector<Table_task> &&tasks) {
+  if (!m_options.dump_data() || m_options.is_dry_run()) {
+    return;
+  }
+
+  std::string tables;
+
+  for (const auto &task : tasks) {
+    if (!tables.empty()) {
+      tables += ", ";
+    }
+
+    tables += task.quoted_name;
+  }
+
+  if (tables.empty()) {
+    return;
+  }
+
+  // all tables are locked at the same time, so that their copies are
+  // consistent with each other, lock is held until all files are copied
+  m_export_session =
+      establish_session(session()->get_connection_options(), false);
+  on_init_thread_session(m_export_session);
+
+  log_info("Locking tables for export: %s", tables.c_str());
+  execute(m_export_session, "FLUSH TABLES " + tables + " FOR EXPORT");
+
+  for (auto &task : tasks) {
+    const auto table = std::make_shared<Table_task>(std::move(task));
+
+    for (std::size_t i = 0; i < table->tablespaces.size(); ++i) {
+      ++m_data_tasks_total;
+
+      m_worker_tasks.push(
+          {"copying tablespace " + table->tablespaces[i].name + " of " +
+               table->task_name,
+           [table, i](Table_worker *worker) {
+             const auto dumper = worker->m_dumper;
+
+             ++dumper->m_num_threads_dumping;
+
+             dumper->dump_tablespace(*table, table->tablespaces[i], worker);
+
+             --dumper->m_num_threads_dumping;
+
+             dumper->data_task_finished();
+           }},
+          shcore::Queue_priority::LOW);
+    }
+  }
+}
+
+void Dumper::dump_tablespace(const Table_task &table,
+                             const Tablespace_file &tablespace,
+                             Table_worker *worker) {
+  log_info("%sCopying tablespace file %s of table %s", worker->m_log_id.c_str(),
+           tablespace.path.c_str(), table.quoted_name.c_str());
+
+  constexpr std::size_t k_buffer_size = 4 * 1024 * 1024;
+  std::string buffer;
+  buffer.resize(k_buffer_size);
+
+  // the .cfg file holds the metadata used when importing the tablespace
+  for (const auto ext : {"ibd", "cfg"}) {
+    const auto source_path = tablespace.path + "." + ext;
+    const auto source = mysqlshdk::storage::make_file(source_path);
+    source->open(mysqlshdk::storage::Mode::READ);
+
+    auto raw_output =
+        make_file(common::get_table_data_filename(tablespace.basename, ext) +
+                  mysqlshdk::storage::get_extension(data_file_compression()));
+    const auto raw_output_ptr = raw_output.get();
+    const auto output = mysqlshdk::storage::make_file(
+        std::move(raw_output), data_file_compression(), table.compression);
+    output->open(mysqlshdk::storage::Mode::WRITE);
+
+    ssize_t bytes;
+
+    while ((bytes = source->read(buffer.data(), buffer.size())) > 0) {
+      if (m_worker_interrupt) {
+        return;
+      }
+
+      output->write(buffer.data(), bytes);
+
+      if (worker->m_rate_limit.enabled()) {
+        worker->m_rate_limit.throttle(bytes);
+      }
+
+      Dump_write_result progress;
+      progress.write_data(bytes);
+      update_progress(progress);
+    }
+
+    if (bytes < 0) {
+      throw std::runtime_error("Failed to read the file '" + source_path +
+                               "'");
+    }
+
+    source->close();
+    output->close();
+
+    Dump_write_result progress;
+    progress.write_bytes(raw_output_ptr->file_size());
+    update_progress(progress);
+  }
+}
+
+void Dumper::unlock_tablespaces() {
+  if (m_export_session) {
+    execute(m_export_session, "UNLOCK TABLES");
+    m_export_session->close();
+    m_export_session.reset();
+  }
+}
+
+void Dumper::sort_largest_first(std::vector<Table_task> *tasks) {
+  const auto data_size = [](const Table_task &task) -> uint64_t {
+    if (task.partitions.empty()) {
+      return task.info->row_count * task.info->average_row_length;
+    }
+
+    uint64_t size = 0;
+
+    for (const auto &partition : task.partitions) {
+      size += partition.info->row_count * partition.info->average_row_length;
+    }
+
+    return size;
+  };
+
+  // keep the original order of tasks which have the same size
+  std::stable_sort(tasks->begin(), tasks->end(),
+                   [&data_size](const Table_task &l, const Table_task &r) {
+                     return data_size(l) > data_size(r);
+                   });
+}
+
 void Dumper::push_table_data_task(Table_data_task &&task) {
   ++m_data_tasks_total;
 
   if (m_checksum) {
-    push_checksum_task(create_checksum_task(task));
+    if (m_options.streaming_checksum()) {
+      // checksum is computed from the rows which are being dumped
+      task.checksum = create_checksum_task(task).checksum;
+    } else if (!task.slices || 0 == task.slice) {
+      // all slices share the checksum of the whole table
+      push_checksum_task(create_checksum_task(task));
+    }
   }
 
   std::string info = "dumping " + task.task_name;
@@ -3390,12 +5337,20 @@ Dumper::Checksum_task Dumper::create_checksum_task(
   task.name = table.task_name;
   task.id = table.id;
 
+  // rows of a slice are written to several files, its checksum cannot be
+  // associated with a single chunk, slices use the checksum of the whole
+  // table instead
+  if (table.slices) {
+    task.id = table.partitions.empty() ? "whole table" : "whole partition";
+  }
+
   {
     std::lock_guard lock{m_checksums_mutex};
     task.checksum = m_checksum->prepare_checksum(
         table.schema, table.name,
         table.partitions.empty() ? "" : table.partitions.front().info->name,
-        table.chunk, table.boundary);
+        table.slices ? -1 : table.chunk,
+        table.slices ? "" : table.boundary);
   }
 
   return task;
@@ -3435,16 +5390,38 @@ void Dumper::push_checksum_task(Checksum_task &&task) {
 }
 
 std::unique_ptr<Dumper::Dump_writer_controller> Dumper::table_dump_controller(
-    const std::string &filename) const {
-  if (m_options.use_single_file()) {
-    return std::make_unique<Single_file_writer_controller>(m_writer_creator(),
+    const std::string &filename,
+    const mysqlshdk::storage::Compression_options &compression) const {
+  auto writer = m_writer_creator();
+  writer->buffer_writes(k_write_buffer_size);
+
+  if (m_options.use_single_file() && m_options.split()) {
+    std::string part;
+
+    {
+      std::lock_guard lock{m_output_parts_mutex};
+      part = m_output_file->filename() + "." +
+             std::to_string(m_output_parts.size()) + ".part";
+      m_output_parts.emplace_back(part);
+    }
+
+    // parts are not compressed, output file is compressed when they are merged
+    return std::make_unique<Default_writer_controller>(
+        std::move(writer),
+        [this](const std::string &name) { return make_file(name, true); },
+        Dump_writer_controller::Create_file{}, part, false);
+  } else if (m_options.use_single_file()) {
+    return std::make_unique<Single_file_writer_controller>(std::move(writer),
                                                            m_output_file.get());
   } else {
     return std::make_unique<Default_writer_controller>(
-        m_writer_creator(),
-        [this](const std::string &name) {
-          return mysqlshdk::storage::make_file(make_file(name, true),
-                                               m_options.compression());
+        std::move(writer),
+        [this, compression](const std::string &name) {
+          // checksum covers the data which is actually stored
+          return mysqlshdk::storage::make_file(
+              std::make_unique<mysqlshdk::storage::Checksummed_file>(
+                  make_file(name, true)),
+              data_file_compression(), compression);
         },
         m_options.write_index_files()
             ? [this](const std::string &name) { return make_file(name); }
@@ -3459,10 +5436,16 @@ std::unique_ptr<Dumper::Dump_writer_controller> Dumper::table_dump_controller(
 }
 
 std::unique_ptr<Dumper::Dump_writer_controller>
-Dumper::table_dump_multi_file_controller(const std::string &basename) const {
+Dumper::table_dump_multi_file_controller(
+    const std::string &basename,
+    const mysqlshdk::storage::Compression_options &compression,
+    std::shared_ptr<Table_chunks> slices) const {
   return std::make_unique<Multi_file_writer_controller>(
-      [this](const std::string &name) { return table_dump_controller(name); },
-      basename, m_table_data_extension, m_options.bytes_per_chunk());
+      [this, compression](const std::string &name) {
+        return table_dump_controller(name, compression);
+      },
+      basename, m_table_data_extension, m_options.bytes_per_chunk(),
+      std::move(slices));
 }
 
 void Dumper::finish_writing(const std::string &schema, const std::string &table,
@@ -3470,9 +5453,128 @@ void Dumper::finish_writing(const std::string &schema, const std::string &table,
   std::lock_guard<std::mutex> lock(m_table_data_stats_mutex);
 
   controller->update_uncompressed_file_size(&m_chunk_file_bytes);
+  controller->update_checksums(&m_chunk_file_checksums);
   m_table_data_stats[schema][table] += controller->total_stats();
 }
 
+void Dumper::register_chunk_split(const std::shared_ptr<Chunk_split> &split) {
+  std::lock_guard<std::mutex> lock(m_chunk_splits_mutex);
+  m_chunk_splits.emplace_back(split);
+}
+
+void Dumper::unregister_chunk_split(
+    const std::shared_ptr<Chunk_split> &split) {
+  std::lock_guard<std::mutex> lock(m_chunk_splits_mutex);
+  m_chunk_splits.erase(
+      std::remove(m_chunk_splits.begin(), m_chunk_splits.end(), split),
+      m_chunk_splits.end());
+}
+
+std::vector<std::shared_ptr<Dumper::Chunk_split>>
+Dumper::chunk_split_candidates() const {
+  std::vector<std::pair<double, std::shared_ptr<Chunk_split>>> candidates;
+
+  {
+    std::lock_guard<std::mutex> lock(m_chunk_splits_mutex);
+
+    for (const auto &split : m_chunk_splits) {
+      if (const auto remaining = split->remaining(); remaining > 0.0) {
+        candidates.emplace_back(remaining, split);
+      }
+    }
+  }
+
+  // chunks with the biggest part remaining to be dumped go first
+  std::stable_sort(
+      candidates.begin(), candidates.end(),
+      [](const auto &l, const auto &r) { return l.first > r.first; });
+
+  std::vector<std::shared_ptr<Chunk_split>> result;
+  result.reserve(candidates.size());
+
+  for (auto &c : candidates) {
+    result.emplace_back(std::move(c.second));
+  }
+
+  return result;
+}
+
+void Dumper::chunk_dumped(const Table_data_task &table,
+                          const Dump_write_result &stats, double seconds) {
+  if (!m_options.adaptive_chunking()) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_chunk_throughput_mutex);
+
+  auto &t = m_chunk_throughput[table.task_name];
+  t.rows += stats.rows_written();
+  t.bytes += stats.data_bytes();
+  t.seconds += seconds;
+
+  m_total_chunk_throughput.rows += stats.rows_written();
+  m_total_chunk_throughput.bytes += stats.data_bytes();
+  m_total_chunk_throughput.seconds += seconds;
+}
+
+void Dumper::table_chunked(const Table_task &table, std::size_t worker,
+                           double seconds) {
+  std::lock_guard lock{m_performance_mutex};
+
+  auto &performance =
+      m_performance[table.schema][table.name]
+                   [table.partitions.empty() ? ""
+                                             : table.partitions[0].info->name];
+  performance.chunking_seconds = seconds;
+  performance.chunking_worker = worker;
+}
+
+void Dumper::chunk_performance(const Table_data_task &table,
+                               Chunk_performance performance) {
+  std::lock_guard lock{m_performance_mutex};
+
+  m_performance[table.schema][table.name]
+               [table.partitions.empty() ? "" : table.partitions[0].info->name]
+                   .chunks.emplace_back(std::move(performance));
+}
+
+uint64_t Dumper::adaptive_rows_per_chunk(const Table_task &table,
+                                         uint64_t estimated) const {
+  // measurements of short chunks are not reliable
+  constexpr double k_min_seconds = 1.0;
+  // maximum factor by which the estimated value can be changed
+  constexpr uint64_t k_max_factor = 16;
+
+  Chunk_throughput t;
+  Chunk_throughput total;
+
+  {
+    std::lock_guard<std::mutex> lock(m_chunk_throughput_mutex);
+
+    const auto it = m_chunk_throughput.find(table.task_name);
+
+    if (m_chunk_throughput.end() == it) {
+      return estimated;
+    }
+
+    t = it->second;
+    total = m_total_chunk_throughput;
+  }
+
+  if (0 == t.rows || t.seconds < k_min_seconds || 0 == total.bytes) {
+    return estimated;
+  }
+
+  // time it takes to dump bytesPerChunk at the average throughput of all the
+  // chunks dumped so far, chunks of this table should take as much time
+  const auto target_seconds =
+      m_options.bytes_per_chunk() * total.seconds / total.bytes;
+  const auto rows = static_cast<uint64_t>(target_seconds * t.rows / t.seconds);
+
+  return std::clamp(rows, std::max(estimated / k_max_factor, UINT64_C(1)),
+                    std::max(estimated, UINT64_C(1)) * k_max_factor);
+}
+
 void Dumper::write_metadata() const {
   if (m_options.is_export_only()) {
     return;
@@ -3604,6 +5706,51 @@ void Dumper::write_dump_started_metadata() const {
 
   doc.AddMember(StringRef("checksum"), m_options.checksum(), a);
 
+  if (m_journal) {
+    doc.AddMember(StringRef("journal"), true, a);
+  }
+
+  if (m_incremental_base) {
+    Value base{Type::kObjectType};
+
+    base.AddMember(StringRef("location"), refs(m_incremental_base->location),
+                   a);
+    base.AddMember(StringRef("begin"), refs(m_incremental_base->begin), a);
+    base.AddMember(StringRef("binlogFile"),
+                   refs(m_incremental_base->binlog_file), a);
+    base.AddMember(StringRef("binlogPosition"),
+                   m_incremental_base->binlog_position, a);
+    base.AddMember(StringRef("gtidExecuted"),
+                   refs(m_incremental_base->gtid_executed), a);
+
+    // loader compares these with the target tables, before the dump is loaded
+    Value source_rows{Type::kObjectType};
+
+    for (const auto &schema : m_schema_infos) {
+      const auto s = m_incremental_base->source_rows.find(schema.name);
+
+      if (m_incremental_base->source_rows.end() == s) {
+        continue;
+      }
+
+      Value tables{Type::kObjectType};
+
+      for (const auto &table : schema.tables) {
+        if (const auto t = s->second.find(table.name); s->second.end() != t) {
+          tables.AddMember(refs(table.name), t->second, a);
+        }
+      }
+
+      if (!tables.ObjectEmpty()) {
+        source_rows.AddMember(refs(schema.name), std::move(tables), a);
+      }
+    }
+
+    base.AddMember(StringRef("sourceRows"), std::move(source_rows), a);
+
+    doc.AddMember(StringRef("incrementalBase"), std::move(base), a);
+  }
+
   doc.AddMember(StringRef("begin"),
                 refs(m_progress_thread.duration().started_at()), a);
 
@@ -3634,7 +5781,9 @@ void Dumper::write_dump_finished_metadata() const {
   // summary will include the time it takes.
   doc.AddMember(StringRef("end"),
                 {Progress_thread::Duration::current_time().c_str(), a}, a);
-  doc.AddMember(StringRef("dataBytes"), m_data_bytes.load(), a);
+  std::lock_guard fingerprints_lock{m_table_fingerprints_mutex};
+  // data of the tables stored in other dumps is loaded as well
+  uint64_t referenced_bytes = 0;
 
   {
     Value bytes{Type::kObjectType};
@@ -3644,37 +5793,298 @@ void Dumper::write_dump_finished_metadata() const {
       Value table_bytes{Type::kObjectType};
       Value table_rows{Type::kObjectType};
 
-      for (const auto &table : schema.second) {
-        table_bytes.AddMember(refs(table.first), table.second.data_bytes(), a);
-        table_rows.AddMember(refs(table.first), table.second.rows_written(), a);
-      }
+      for (const auto &table : schema.second) {
+        table_bytes.AddMember(refs(table.first), table.second.data_bytes(), a);
+        table_rows.AddMember(refs(table.first), table.second.rows_written(), a);
+      }
+
+      bytes.AddMember(refs(schema.first), std::move(table_bytes), a);
+      rows.AddMember(refs(schema.first), std::move(table_rows), a);
+    }
+
+    for (const auto &schema : m_table_fingerprints) {
+      for (const auto &table : schema.second) {
+        if (table.second.location.empty()) {
+          continue;
+        }
+
+        if (!bytes.HasMember(schema.first.c_str())) {
+          bytes.AddMember(refs(schema.first), Value{Type::kObjectType}, a);
+          rows.AddMember(refs(schema.first), Value{Type::kObjectType}, a);
+        }
+
+        bytes[schema.first.c_str()].AddMember(refs(table.first),
+                                              table.second.data_bytes, a);
+        rows[schema.first.c_str()].AddMember(refs(table.first),
+                                             table.second.rows, a);
+
+        referenced_bytes += table.second.data_bytes;
+      }
+    }
+
+    doc.AddMember(StringRef("tableDataBytes"), std::move(bytes), a);
+    doc.AddMember(StringRef("tableRows"), std::move(rows), a);
+  }
+
+  doc.AddMember(StringRef("dataBytes"), m_data_bytes.load() + referenced_bytes,
+                a);
+
+  if (!m_table_fingerprints.empty()) {
+    // used by the subsequent dumps to detect unchanged tables
+    Value fingerprints{Type::kObjectType};
+
+    for (const auto &schema : m_table_fingerprints) {
+      Value tables{Type::kObjectType};
+
+      for (const auto &table : schema.second) {
+        Value fingerprint{Type::kObjectType};
+
+        fingerprint.AddMember(StringRef("fingerprint"),
+                              refs(table.second.fingerprint), a);
+
+        if (!table.second.location.empty()) {
+          fingerprint.AddMember(StringRef("location"),
+                                refs(table.second.location), a);
+        }
+
+        fingerprint.AddMember(StringRef("basename"),
+                              refs(table.second.basename), a);
+
+        Value basenames{Type::kObjectType};
+
+        for (const auto &partition : table.second.basenames) {
+          basenames.AddMember(refs(partition.first), refs(partition.second),
+                              a);
+        }
+
+        fingerprint.AddMember(StringRef("basenames"), std::move(basenames), a);
+
+        tables.AddMember(refs(table.first), std::move(fingerprint), a);
+      }
+
+      fingerprints.AddMember(refs(schema.first), std::move(tables), a);
+    }
+
+    doc.AddMember(StringRef("tableFingerprints"), std::move(fingerprints), a);
+  }
+
+  {
+    Value files{Type::kObjectType};
+
+    for (const auto &file : m_chunk_file_bytes)
+      files.AddMember(refs(file.first), file.second, a);
+
+    doc.AddMember(StringRef("chunkFileBytes"), std::move(files), a);
+  }
+
+  {
+    Value files{Type::kObjectType};
+
+    for (const auto &file : m_chunk_file_checksums)
+      files.AddMember(refs(file.first), file.second, a);
+
+    doc.AddMember(StringRef("chunkFileCrc32c"), std::move(files), a);
+  }
+
+  {
+    std::lock_guard lock{m_watermarks_mutex};
+
+    if (!m_watermarks.empty()) {
+      Value watermarks{Type::kObjectType};
+
+      for (const auto &schema : m_watermarks) {
+        Value tables{Type::kObjectType};
+
+        for (const auto &table : schema.second) {
+          Value watermark{Type::kObjectType};
+
+          watermark.AddMember(StringRef("column"), refs(table.second.column),
+                              a);
+          watermark.AddMember(StringRef("value"), refs(table.second.value), a);
+
+          tables.AddMember(refs(table.first), std::move(watermark), a);
+        }
+
+        watermarks.AddMember(refs(schema.first), std::move(tables), a);
+      }
+
+      doc.AddMember(StringRef("watermarks"), std::move(watermarks), a);
+    }
+
+    if (!m_source_rows.empty()) {
+      Value source_rows{Type::kObjectType};
+
+      for (const auto &schema : m_source_rows) {
+        Value tables{Type::kObjectType};
+
+        for (const auto &table : schema.second) {
+          tables.AddMember(refs(table.first), table.second, a);
+        }
+
+        source_rows.AddMember(refs(schema.first), std::move(tables), a);
+      }
+
+      doc.AddMember(StringRef("sourceRows"), std::move(source_rows), a);
+    }
+  }
+
+  write_json(make_file("@.done.json"), &doc);
+}
+
+void Dumper::write_performance_report() const {
+  if (!m_options.performance_report()) {
+    return;
+  }
+
+  using rapidjson::Document;
+  using rapidjson::StringRef;
+  using rapidjson::Type;
+  using rapidjson::Value;
+
+  Document doc{Type::kObjectType};
+  auto &a = doc.GetAllocator();
+
+  const auto to_seconds = [](std::chrono::steady_clock::duration d) {
+    return std::chrono::duration<double>(d).count();
+  };
+  const auto per_second = [](uint64_t value, double seconds) {
+    return seconds > 0.0 ? value / seconds : 0.0;
+  };
+  const auto ratio = [](const Dump_write_result &stats) {
+    return stats.bytes_written() > 0
+               ? static_cast<double>(stats.data_bytes()) / stats.bytes_written()
+               : 0.0;
+  };
+  const auto add_stats = [&](double seconds, const Dump_write_result &stats,
+                             Value *v) {
+    v->AddMember(StringRef("rows"), stats.rows_written(), a);
+    v->AddMember(StringRef("dataBytes"), stats.data_bytes(), a);
+    v->AddMember(StringRef("bytesWritten"), stats.bytes_written(), a);
+    v->AddMember(StringRef("seconds"), seconds, a);
+    v->AddMember(StringRef("rowsPerSecond"),
+                 per_second(stats.rows_written(), seconds), a);
+    v->AddMember(StringRef("bytesPerSecond"),
+                 per_second(stats.data_bytes(), seconds), a);
+    v->AddMember(StringRef("compressionRatio"), ratio(stats), a);
+    v->AddMember(StringRef("writeSeconds"), to_seconds(stats.write_time()), a);
+  };
+
+  doc.AddMember(StringRef("threads"),
+                static_cast<uint64_t>(m_options.threads()), a);
+
+  Value schemas{Type::kObjectType};
+
+  {
+    std::lock_guard lock{m_performance_mutex};
+
+    for (const auto &schema : m_performance) {
+      Value tables{Type::kObjectType};
+
+      for (const auto &table : schema.second) {
+        Value partitions{Type::kObjectType};
+
+        for (const auto &partition : table.second) {
+          const auto &performance = partition.second;
+          Value p{Type::kObjectType};
+          Value chunks{Type::kArrayType};
+          Dump_write_result total;
+          double seconds = 0.0;
+          double first_row_seconds = 0.0;
+
+          p.AddMember(StringRef("chunkingSeconds"),
+                      performance.chunking_seconds, a);
+          p.AddMember(StringRef("chunkingWorker"),
+                      static_cast<uint64_t>(performance.chunking_worker), a);
+
+          for (const auto &chunk : performance.chunks) {
+            Value c{Type::kObjectType};
+
+            c.AddMember(StringRef("chunk"), chunk.chunk, a);
+            c.AddMember(StringRef("file"), refs(chunk.file), a);
+            c.AddMember(StringRef("worker"),
+                        static_cast<uint64_t>(chunk.worker), a);
+            c.AddMember(StringRef("firstRowSeconds"), chunk.first_row_seconds,
+                        a);
+            add_stats(chunk.seconds, chunk.stats, &c);
+
+            chunks.PushBack(std::move(c), a);
+
+            total += chunk.stats;
+            seconds += chunk.seconds;
+            first_row_seconds += chunk.first_row_seconds;
+          }
+
+          p.AddMember(StringRef("firstRowSeconds"), first_row_seconds, a);
+          add_stats(seconds, total, &p);
+          p.AddMember(StringRef("chunks"), std::move(chunks), a);
+
+          partitions.AddMember(refs(partition.first), std::move(p), a);
+        }
+
+        tables.AddMember(refs(table.first), std::move(partitions), a);
+      }
+
+      schemas.AddMember(refs(schema.first), std::move(tables), a);
+    }
+  }
+
+  doc.AddMember(StringRef("schemas"), std::move(schemas), a);
+
+  write_json(make_file("@.perf.json"), &doc);
+}
+
+void Dumper::write_checksum_metadata() const {
+  if (!m_checksum) {
+    return;
+  }
 
-      bytes.AddMember(refs(schema.first), std::move(table_bytes), a);
-      rows.AddMember(refs(schema.first), std::move(table_rows), a);
-    }
+  m_checksum->serialize(make_file("@.checksums.json"));
+}
 
-    doc.AddMember(StringRef("tableDataBytes"), std::move(bytes), a);
-    doc.AddMember(StringRef("tableRows"), std::move(rows), a);
+void Dumper::open_metadata_index() {
+  if (m_options.is_export_only()) {
+    return;
   }
 
-  {
-    Value files{Type::kObjectType};
+  m_metadata_index = make_file(common::get_metadata_index_filename());
+  m_metadata_index->open(Mode::WRITE);
+}
 
-    for (const auto &file : m_chunk_file_bytes)
-      files.AddMember(refs(file.first), file.second, a);
+void Dumper::close_metadata_index() {
+  if (m_metadata_index) {
+    m_metadata_index->close();
+    m_metadata_index.reset();
+  }
+}
 
-    doc.AddMember(StringRef("chunkFileBytes"), std::move(files), a);
+void Dumper::open_journal() {
+  // listing a local directory is cheap, journal is not needed; when the PAR
+  // manifest is written, loader finds new files using the manifest
+  if (m_options.is_export_only() || m_options.par_manifest() ||
+      directory()->is_local()) {
+    return;
   }
 
-  write_json(make_file("@.done.json"), &doc);
+  m_journal = std::make_unique<Dump_journal>(directory(), k_journal_interval);
 }
 
-void Dumper::write_checksum_metadata() const {
-  if (!m_checksum) {
+void Dumper::close_journal() {
+  if (m_journal) {
+    m_journal->close();
+    m_journal.reset();
+  }
+}
+
+void Dumper::add_to_metadata_index(const std::string &filename,
+                                   const std::string &contents) const {
+  if (!m_metadata_index) {
     return;
   }
 
-  m_checksum->serialize(make_file("@.checksums.json"));
+  const auto entry = common::metadata_index_entry(filename, contents);
+
+  std::lock_guard lock{m_metadata_index_mutex};
+  m_metadata_index->write(entry.c_str(), entry.length());
 }
 
 void Dumper::write_schema_metadata(const Schema_info &schema) const {
@@ -3771,8 +6181,9 @@ void Dumper::write_schema_metadata(const Schema_info &schema) const {
     doc.AddMember(StringRef("basenames"), std::move(basenames), a);
   }
 
-  write_json(make_file(common::get_schema_filename(schema.basename, "json")),
-             &doc);
+  const auto filename = common::get_schema_filename(schema.basename, "json");
+  add_to_metadata_index(filename, to_compact_string(&doc));
+  write_small_file(filename, to_string(&doc));
 }
 
 void Dumper::write_table_metadata(
@@ -3803,7 +6214,7 @@ void Dumper::write_table_metadata(
     for (const auto &c : table.info->columns) {
       cols.PushBack(refs(c->name), a);
 
-      if (c->csv_unsafe) {
+      if (c->csv_unsafe && encode_binary_columns()) {
         decode.AddMember(
             refs(c->name),
             StringRef(m_options.use_base64() ? "FROM_BASE64" : "UNHEX"), a);
@@ -3866,14 +6277,16 @@ void Dumper::write_table_metadata(
   }
 
   doc.AddMember(StringRef("includesData"),
-                m_options.dump_data() && should_dump_data(table), a);
+                m_options.dump_data() && !m_options.physical() &&
+                    should_dump_data(table),
+                a);
   doc.AddMember(StringRef("includesDdl"), m_options.dump_ddl(), a);
 
   doc.AddMember(StringRef("extension"), refs(m_table_data_extension), a);
   doc.AddMember(StringRef("chunking"), m_options.split(), a);
   doc.AddMember(
       StringRef("compression"),
-      {mysqlshdk::storage::to_string(m_options.compression()).c_str(), a}, a);
+      {mysqlshdk::storage::to_string(data_file_compression()).c_str(), a}, a);
 
   {
     Value primary{Type::kArrayType};
@@ -3910,6 +6323,22 @@ void Dumper::write_table_metadata(
     doc.AddMember(StringRef("basenames"), std::move(basenames), a);
   }
 
+  if (!table.tablespaces.empty()) {
+    // list of tablespace files
+    Value tablespaces{Type::kArrayType};
+
+    for (const auto &tablespace : table.tablespaces) {
+      Value t{Type::kObjectType};
+
+      t.AddMember(StringRef("name"), refs(tablespace.name), a);
+      t.AddMember(StringRef("basename"), refs(tablespace.basename), a);
+
+      tablespaces.PushBack(std::move(t), a);
+    }
+
+    doc.AddMember(StringRef("tablespaces"), std::move(tablespaces), a);
+  }
+
   {
     const auto &where = m_options.where(table.schema, table.name);
 
@@ -3918,8 +6347,58 @@ void Dumper::write_table_metadata(
     }
   }
 
-  write_json(make_file(common::get_table_data_filename(table.basename, "json")),
-             &doc);
+  {
+    std::lock_guard lock{m_table_fingerprints_mutex};
+    const auto schema = m_table_fingerprints.find(table.schema);
+
+    if (m_table_fingerprints.end() != schema) {
+      const auto t = schema->second.find(table.name);
+
+      if (schema->second.end() != t && !t->second.location.empty()) {
+        // data files of this table are stored in another dump
+        Value reference{Type::kObjectType};
+
+        reference.AddMember(StringRef("location"), refs(t->second.location),
+                            a);
+        reference.AddMember(StringRef("basename"), refs(t->second.basename),
+                            a);
+
+        Value basenames{Type::kObjectType};
+
+        for (const auto &partition : t->second.basenames) {
+          basenames.AddMember(refs(partition.first), refs(partition.second),
+                              a);
+        }
+
+        reference.AddMember(StringRef("basenames"), std::move(basenames), a);
+
+        doc.AddMember(StringRef("dataReference"), std::move(reference), a);
+      }
+    }
+  }
+
+  {
+    std::lock_guard lock{m_watermarks_mutex};
+    const auto schema = m_watermarks.find(table.schema);
+
+    if (m_watermarks.end() != schema) {
+      const auto t = schema->second.find(table.name);
+
+      if (schema->second.end() != t) {
+        Value watermark{Type::kObjectType};
+
+        watermark.AddMember(StringRef("column"), refs(t->second.column), a);
+        watermark.AddMember(StringRef("value"), refs(t->second.value), a);
+
+        doc.AddMember(StringRef("watermark"), std::move(watermark), a);
+      }
+    }
+  }
+
+  const auto filename =
+      common::get_table_data_filename(table.basename, "json");
+  add_to_metadata_index(filename, to_compact_string(&doc));
+  write_small_file(filename, to_string(&doc));
 }
 
 void Dumper::summarize() const {
@@ -3952,6 +6431,11 @@ void Dumper::summarize() const {
   if (!m_options.is_export_only()) {
     console->print_status("Schemas dumped: " + std::to_string(m_total_schemas));
     console->print_status("Tables dumped: " + std::to_string(m_total_tables));
+
+    if (m_ddl_memory_peak > 0) {
+      console->print_status("Peak DDL memory: " +
+                            mysqlshdk::utils::format_bytes(m_ddl_memory_peak));
+    }
   }
 
   if (m_options.dump_data()) {
@@ -3965,6 +6449,11 @@ void Dumper::summarize() const {
       console->print_status(shcore::str_format(
           "Compression ratio: %.1f",
           m_data_bytes / std::max(static_cast<double>(m_bytes_written), 1.0)));
+
+      if (const auto &tuner = m_options.compression_options().level_tuner) {
+        console->print_status("Final compression level: " +
+                              std::to_string(tuner->level()));
+      }
     }
 
     console->print_status("Rows written: " + std::to_string(m_rows_written));
@@ -4106,6 +6595,32 @@ void Dumper::update_progress(const Dump_write_result &progress) {
   }
 }
 
+void Dumper::publish_progress() {
+  if (Progress_format::JSONL != m_options.progress_format()) {
+    return;
+  }
+
+  m_progress_thread.publish_events(m_options.progress_fd());
+  m_progress_thread.set_status_details([this]() {
+    auto details = shcore::make_dict();
+
+    details->emplace("rowsWritten", m_rows_written.load());
+    details->emplace("bytesWritten", m_bytes_written.load());
+    details->emplace("dataBytes", m_data_bytes.load());
+
+    auto threads = shcore::make_dict();
+    threads->emplace("total", static_cast<uint64_t>(m_options.threads()));
+    threads->emplace("dumping", m_num_threads_dumping.load());
+    threads->emplace("chunking", m_num_threads_chunking.load());
+    threads->emplace("checksumming", m_num_threads_checksumming.load());
+    details->emplace("threads", std::move(threads));
+
+    details->emplace("memory", get_memory_stats());
+
+    return details;
+  });
+}
+
 void Dumper::shutdown_progress() {
   if (m_worker_interrupt) {
     m_progress_thread.terminate();
@@ -4138,8 +6653,21 @@ std::unique_ptr<mysqlshdk::storage::IFile> Dumper::make_file(
   });
 
   mysqlshdk::storage::File_options options;
-  if (use_mmap) options["file.mmap"] = s_mmap_mode;
-  return directory()->file(filename, options);
+
+  if (m_options.drop_page_cache()) {
+    // data written through mmap() cannot be evicted from the page cache
+    options["file.page_cache"] = "drop";
+  } else if (use_mmap) {
+    options["file.mmap"] = s_mmap_mode;
+  }
+
+  auto file = directory()->file(filename, options);
+
+  if (m_journal) {
+    file = m_journal->track(std::move(file));
+  }
+
+  return file;
 }
 
 std::string Dumper::get_basename(const std::string &basename) {
@@ -4164,12 +6692,28 @@ std::string Dumper::get_basename(const std::string &basename) {
 }
 
 bool Dumper::compressed() const {
-  return mysqlshdk::storage::Compression::NONE != m_options.compression();
+  return mysqlshdk::storage::Compression::NONE != data_file_compression();
+}
+
+mysqlshdk::storage::Compression Dumper::data_file_compression() const {
+  // Parquet files compress their pages, the files themselves are not
+  // compressed
+  return Data_format::PARQUET == m_options.data_format()
+             ? mysqlshdk::storage::Compression::NONE
+             : m_options.compression();
+}
+
+bool Dumper::encode_binary_columns() const {
+  // binary data is stored as-is in the Parquet files, text files store it as-is
+  // only if requested, escaping the special characters
+  return Data_format::PARQUET != m_options.data_format() &&
+         !m_options.raw_binary();
 }
 
-void Dumper::kill_query() const {
-  const auto &s = session();
+void Dumper::kill_query() const { kill_query(session()); }
 
+void Dumper::kill_query(
+    const std::shared_ptr<mysqlshdk::db::ISession> &s) const {
   if (s) {
     try {
       // establish_session() cannot be used here, as it's going to create
@@ -4471,8 +7015,7 @@ void Dumper::validate_dump_consistency(
         const auto set =
             Gtid_set::from_normalized_string(gtid_executed)
                 .subtract(
-                    Gtid_set::from_normalized_string(m_cache.gtid_executed),
-                    instance);
+                    Gtid_set::from_normalized_string(m_cache.gtid_executed));
 
         consistent = check_if_transactions_are_ddl_safe(
             instance, m_cache.binlog, dumper->binlog(true), set);
@@ -4521,6 +7064,437 @@ void Dumper::validate_dump_consistency(
   }
 }
 
+void Dumper::read_incremental_base() {
+  if (!m_options.is_incremental()) {
+    return;
+  }
+
+  using mysqlshdk::storage::make_directory;
+  const auto dir =
+      make_directory(m_options.incremental_base(), m_options.storage_config());
+  const auto location = dir->full_path().masked();
+
+  const auto read_metadata = [&dir, &location](const std::string &name) {
+    const auto file = dir->file(name);
+
+    if (!file->exists()) {
+      if ("@.json" == name) {
+        throw std::invalid_argument(
+            "The location '" + location +
+            "' given in the 'incrementalBase' option does not contain a dump.");
+      } else {
+        throw std::invalid_argument(
+            "The dump at '" + location +
+            "' given in the 'incrementalBase' option is not complete.");
+      }
+    }
+
+    file->open(Mode::READ);
+    const auto data = mysqlshdk::storage::read_file(file.get());
+    file->close();
+
+    rapidjson::Document doc;
+    doc.Parse(data.c_str(), data.length());
+
+    if (doc.HasParseError() || !doc.IsObject()) {
+      throw std::runtime_error("Failed to parse the '" + name +
+                               "' metadata file of the base dump at '" +
+                               location + "'.");
+    }
+
+    return doc;
+  };
+
+  const auto get_string = [](const rapidjson::Value &v, const char *name) {
+    const auto it = v.FindMember(name);
+    return v.MemberEnd() != it && it->value.IsString()
+               ? std::string{it->value.GetString(),
+                             it->value.GetStringLength()}
+               : std::string{};
+  };
+
+  auto base = std::make_unique<Incremental_base>();
+  base->location = location;
+
+  {
+    const auto doc = read_metadata("@.json");
+
+    base->begin = get_string(doc, "begin");
+    base->binlog_file = get_string(doc, "binlogFile");
+    base->gtid_executed = get_string(doc, "gtidExecuted");
+
+    if (const auto it = doc.FindMember("binlogPosition");
+        doc.MemberEnd() != it && it->value.IsUint64()) {
+      base->binlog_position = it->value.GetUint64();
+    }
+  }
+
+  {
+    const auto doc = read_metadata("@.done.json");
+
+    if (const auto watermarks = doc.FindMember("watermarks");
+        doc.MemberEnd() != watermarks && watermarks->value.IsObject()) {
+      for (const auto &schema : watermarks->value.GetObject()) {
+        if (!schema.value.IsObject()) {
+          continue;
+        }
+
+        auto &tables = base->watermarks[schema.name.GetString()];
+
+        for (const auto &table : schema.value.GetObject()) {
+          if (!table.value.IsObject()) {
+            continue;
+          }
+
+          tables[table.name.GetString()] = {get_string(table.value, "column"),
+                                            get_string(table.value, "value")};
+        }
+      }
+    }
+
+    if (const auto source_rows = doc.FindMember("sourceRows");
+        doc.MemberEnd() != source_rows && source_rows->value.IsObject()) {
+      for (const auto &schema : source_rows->value.GetObject()) {
+        if (!schema.value.IsObject()) {
+          continue;
+        }
+
+        auto &tables = base->source_rows[schema.name.GetString()];
+
+        for (const auto &table : schema.value.GetObject()) {
+          if (table.value.IsUint64()) {
+            tables[table.name.GetString()] = table.value.GetUint64();
+          }
+        }
+      }
+    }
+  }
+
+  current_console()->print_info(
+      "Dumping rows which have changed since the dump started at " +
+      base->begin + ", located at: " + base->location);
+
+  m_incremental_base = std::move(base);
+}
+
+void Dumper::read_previous_dump() {
+  if (m_options.previous_dump().empty()) {
+    return;
+  }
+
+  using mysqlshdk::storage::make_directory;
+  const auto dir =
+      make_directory(m_options.previous_dump(), m_options.storage_config());
+  const auto location = dir->full_path().masked();
+
+  const auto read_metadata = [&dir, &location](const std::string &name) {
+    const auto file = dir->file(name);
+
+    if (!file->exists()) {
+      if ("@.json" == name) {
+        throw std::invalid_argument(
+            "The location '" + location +
+            "' given in the 'previousDump' option does not contain a dump.");
+      } else {
+        throw std::invalid_argument(
+            "The dump at '" + location +
+            "' given in the 'previousDump' option is not complete.");
+      }
+    }
+
+    file->open(Mode::READ);
+    const auto data = mysqlshdk::storage::read_file(file.get());
+    file->close();
+
+    rapidjson::Document doc;
+    doc.Parse(data.c_str(), data.length());
+
+    if (doc.HasParseError() || !doc.IsObject()) {
+      throw std::runtime_error("Failed to parse the '" + name +
+                               "' metadata file of the previous dump at '" +
+                               location + "'.");
+    }
+
+    return doc;
+  };
+
+  const auto get_string = [](const rapidjson::Value &v, const char *name) {
+    const auto it = v.FindMember(name);
+    return v.MemberEnd() != it && it->value.IsString()
+               ? std::string{it->value.GetString(),
+                             it->value.GetStringLength()}
+               : std::string{};
+  };
+
+  const auto get_uint = [](const rapidjson::Value &v, const char *schema,
+                           const char *table) -> uint64_t {
+    if (const auto s = v.FindMember(schema);
+        v.MemberEnd() != s && s->value.IsObject()) {
+      if (const auto t = s->value.FindMember(table);
+          s->value.MemberEnd() != t && t->value.IsUint64()) {
+        return t->value.GetUint64();
+      }
+    }
+
+    return 0;
+  };
+
+  auto previous = std::make_unique<Previous_dump>();
+  // data files are accessed by the loader, real location is needed
+  previous->location = dir->full_path().real();
+
+  read_metadata("@.json");
+
+  {
+    const auto doc = read_metadata("@.done.json");
+    const auto bytes = doc.FindMember("tableDataBytes");
+    const auto rows = doc.FindMember("tableRows");
+
+    if (const auto fingerprints = doc.FindMember("tableFingerprints");
+        doc.MemberEnd() != fingerprints && fingerprints->value.IsObject()) {
+      for (const auto &schema : fingerprints->value.GetObject()) {
+        if (!schema.value.IsObject()) {
+          continue;
+        }
+
+        auto &tables = previous->tables[schema.name.GetString()];
+
+        for (const auto &table : schema.value.GetObject()) {
+          if (!table.value.IsObject()) {
+            continue;
+          }
+
+          auto &fingerprint = tables[table.name.GetString()];
+
+          fingerprint.fingerprint = get_string(table.value, "fingerprint");
+          fingerprint.location = get_string(table.value, "location");
+          fingerprint.basename = get_string(table.value, "basename");
+
+          if (const auto basenames = table.value.FindMember("basenames");
+              table.value.MemberEnd() != basenames &&
+              basenames->value.IsObject()) {
+            for (const auto &partition : basenames->value.GetObject()) {
+              if (partition.value.IsString()) {
+                fingerprint.basenames[partition.name.GetString()] =
+                    partition.value.GetString();
+              }
+            }
+          }
+
+          if (doc.MemberEnd() != bytes) {
+            fingerprint.data_bytes = get_uint(
+                bytes->value, schema.name.GetString(), table.name.GetString());
+          }
+
+          if (doc.MemberEnd() != rows) {
+            fingerprint.rows = get_uint(rows->value, schema.name.GetString(),
+                                        table.name.GetString());
+          }
+        }
+      }
+    }
+  }
+
+  current_console()->print_info(
+      "Data of the tables which did not change since the previous dump is "
+      "going to be reused, previous dump is located at: " +
+      location);
+
+  m_previous_dump = std::move(previous);
+}
+
+std::string Dumper::table_fingerprint(
+    const Table_task &table,
+    const std::shared_ptr<mysqlshdk::db::ISession> &session) const {
+  // CHECKSUM TABLE reads all the rows, but it's still much cheaper than
+  // converting and writing them
+  const auto row =
+      query(session, "CHECKSUM TABLE " + table.quoted_name)->fetch_one();
+
+  if (!row || row->is_null(1)) {
+    return {};
+  }
+
+  std::string columns;
+
+  for (const auto &c : table.info->columns) {
+    columns += shcore::quote_identifier(c->name);
+    columns += ',';
+  }
+
+  std::string partitions;
+
+  for (const auto &partition : table.partitions) {
+    partitions += partition.info->quoted_name;
+    partitions += ',';
+  }
+
+  const auto &dialect = m_options.dialect();
+  const auto fields = shcore::str_join(
+      std::vector<std::string>{dialect.fields_terminated_by,
+                               dialect.fields_enclosed_by,
+                               dialect.fields_optionally_enclosed ? "1" : "0",
+                               dialect.fields_escaped_by,
+                               dialect.lines_terminated_by},
+      "|");
+  const auto binary = encode_binary_columns()
+                          ? (m_options.use_base64() ? "base64" : "hex")
+                          : "none";
+
+  // contents of the data files depend on the options as well
+  const auto fingerprint = shcore::make_dict(
+      "checksum", row->get_as_string(1), "columns", std::move(columns),
+      "partitions", std::move(partitions), "where",
+      m_options.where(table.schema, table.name), "extension",
+      m_table_data_extension, "chunking", m_options.split(), "characterSet",
+      m_options.character_set(), "binary", binary, "dialect", fields);
+
+  return shcore::Value(fingerprint).json();
+}
+
+bool Dumper::record_table_fingerprint(const Table_task &table,
+                                      std::string fingerprint) {
+  Table_fingerprint current;
+  bool unchanged = false;
+
+  if (const auto s = m_previous_dump->tables.find(table.schema);
+      !fingerprint.empty() && m_previous_dump->tables.end() != s) {
+    if (const auto t = s->second.find(table.name);
+        s->second.end() != t && t->second.fingerprint == fingerprint &&
+        !t->second.basename.empty()) {
+      current = t->second;
+
+      if (current.location.empty()) {
+        // data files were written by the previous dump
+        current.location = m_previous_dump->location;
+      }
+
+      unchanged = true;
+    }
+  }
+
+  if (!unchanged) {
+    current.fingerprint = std::move(fingerprint);
+    current.basename = table.basename;
+
+    for (const auto &partition : table.partitions) {
+      current.basenames.emplace(partition.info->name, partition.basename);
+    }
+  }
+
+  std::lock_guard lock{m_table_fingerprints_mutex};
+  m_table_fingerprints[table.schema][table.name] = std::move(current);
+
+  return unchanged;
+}
+
+void Dumper::push_fingerprint_task(Table_task &&task) {
+  // counted as a chunking task, as it may produce data tasks
+  ++m_chunking_tasks_total;
+
+  std::string info = "comparing " + task.task_name + " with previous dump";
+  m_worker_tasks.push({std::move(info),
+                       [task = std::move(task)](Table_worker *worker) {
+                         worker->dump_if_changed(task);
+                       }},
+                      shcore::Queue_priority::HIGH);
+}
+
+void Dumper::validate_incremental_dump() const {
+  for (const auto &schema : m_schema_infos) {
+    for (const auto &table : schema.tables) {
+      const auto &column = m_options.watermark_column(schema.name, table.name);
+
+      if (!column.empty() &&
+          std::none_of(table.info->all_columns.begin(),
+                       table.info->all_columns.end(), [&column](const auto &c) {
+                         return shcore::str_caseeq(c.name, column);
+                       })) {
+        throw std::invalid_argument(
+            "The column '" + column +
+            "' given in the 'watermarkColumns' option does not exist in "
+            "table " +
+            table.quoted_name + ".");
+      }
+
+      if (m_incremental_base && !table.info->primary_key &&
+          table.info->primary_key_equivalents.empty()) {
+        throw std::invalid_argument(
+            "Table " + table.quoted_name +
+            " does not have a primary key or an equivalent unique index, its "
+            "rows cannot be dumped incrementally. Use the 'excludeTables' "
+            "option to exclude it from the dump.");
+      }
+    }
+  }
+}
+
+void Dumper::check_in_flight_transactions() const {
+  if (!m_options.consistent_dump() || m_options.is_dry_run() ||
+      !m_options.has_watermark_columns()) {
+    return;
+  }
+
+  uint64_t transactions = 0;
+
+  try {
+    // transactions of the dump do not modify any rows
+    transactions = query(
+                       "SELECT COUNT(*) FROM information_schema.innodb_trx "
+                       "WHERE trx_rows_modified > 0")
+                       ->fetch_one()
+                       ->get_uint(0);
+  } catch (const mysqlshdk::db::Error &e) {
+    log_warning("Failed to check for transactions in progress: %s",
+                e.format().c_str());
+    return;
+  }
+
+  if (transactions > 0) {
+    current_console()->print_warning(
+        std::to_string(transactions) +
+        " transaction(s) which have modified data were in progress when the "
+        "consistent snapshot was created. Rows they commit are not included in "
+        "this dump and may have lower watermark values than the recorded ones, "
+        "in which case incremental dumps based on this one are not going to "
+        "include them either.");
+  }
+}
+
+std::string Dumper::incremental_filter(const std::string &schema,
+                                       const std::string &table,
+                                       const std::string &column) const {
+  if (!m_incremental_base || column.empty()) {
+    // tables without a watermark are dumped in full, loader replaces the
+    // existing rows
+    return {};
+  }
+
+  const auto s = m_incremental_base->watermarks.find(schema);
+
+  if (m_incremental_base->watermarks.end() == s) {
+    return {};
+  }
+
+  const auto t = s->second.find(table);
+
+  if (s->second.end() == t) {
+    return {};
+  }
+
+  if (!shcore::str_caseeq(t->second.column, column)) {
+    log_warning(
+        "The watermark of table %s.%s recorded by the base dump uses a "
+        "different column %s, the whole table is going to be dumped",
+        shcore::quote_identifier(schema).c_str(),
+        shcore::quote_identifier(table).c_str(),
+        shcore::quote_identifier(t->second.column).c_str());
+    return {};
+  }
+
+  return (shcore::sqlstring("(! > ?)", 0) << column << t->second.value).str();
+}
+
 void Dumper::fetch_server_information() {
   const auto instance = mysqlshdk::mysql::Instance(session());
 
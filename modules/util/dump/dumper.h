@@ -24,42 +24,166 @@
 #ifndef MODULES_UTIL_DUMP_DUMPER_H_
 #define MODULES_UTIL_DUMP_DUMPER_H_
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/mysql/user_privileges.h"
 #include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
+#include "mysqlshdk/libs/utils/profiling.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/thread_affinity.h"
 #include "mysqlshdk/libs/utils/version.h"
 
 #include "modules/util/common/dump/checksums.h"
+#include "modules/util/common/resource_governor.h"
 #include "modules/util/dump/capability.h"
+#include "modules/util/dump/dump_journal.h"
 #include "modules/util/dump/dump_options.h"
 #include "modules/util/dump/dump_writer.h"
 #include "modules/util/dump/instance_cache.h"
 #include "modules/util/dump/progress_thread.h"
+#include "modules/util/dump/small_file_writer.h"
+#include "modules/util/dump/table_chunks.h"
 
 namespace mysqlsh {
 namespace dump {
 
 class Schema_dumper;
 
+/**
+ * Returns the index of the instance used by the given worker: 0 is the source
+ * instance, N is the N-th read replica. Workers are distributed evenly between
+ * all the instances.
+ */
+std::size_t worker_instance(std::size_t worker, std::size_t read_replicas);
+
+/**
+ * Starts a transaction with a consistent snapshot in each of the given
+ * sessions, all sessions start their transactions concurrently. Once all of
+ * them are done, rethrows the first error, if any.
+ */
+void start_consistent_snapshots(
+    const std::vector<std::shared_ptr<mysqlshdk::db::ISession>> &sessions);
+
+/**
+ * Returns the statement which sets all the session variables of a worker
+ * session.
+ *
+ * @param character_set Character set used by the session.
+ * @param use_timezone_utc Whether the session uses the UTC time zone.
+ */
+std::string worker_session_setup(const std::string &character_set,
+                                 bool use_timezone_utc);
+
+struct Histogram_bucket {
+  long double lower = 0;
+  long double upper = 0;
+  // cumulative frequency of values in this and all of the preceding buckets
+  double frequency = 0.0;
+};
+
+/**
+ * Parses buckets of a histogram stored in the COLUMN_STATISTICS table, only
+ * histograms of integer columns are supported.
+ *
+ * @param type Type of the histogram.
+ * @param json Buckets of the histogram.
+ *
+ * @returns Parsed buckets, empty if histogram could not be used.
+ */
+std::vector<Histogram_bucket> parse_histogram_buckets(const std::string &type,
+                                                      const std::string &json);
+
+/**
+ * Computes upper boundaries of chunks using the histogram of the first column
+ * of the index.
+ *
+ * @param buckets Buckets of the histogram.
+ * @param rows_per_chunk Expected number of rows in a single chunk.
+ * @param row_count Estimated number of rows in the table.
+ * @param min Minimum value of the column.
+ * @param max Maximum value of the column.
+ * @param interrupted Checked after each bucket, result is empty if it's set.
+ *
+ * @returns Strictly increasing boundaries, each within [min, max), upper
+ *          boundary of the last chunk is not included. Empty if histogram is
+ *          not usable.
+ */
+template <typename T>
+std::vector<T> histogram_boundaries(
+    const std::vector<Histogram_bucket> &buckets, uint64_t rows_per_chunk,
+    uint64_t row_count, const T &min, const T &max,
+    const volatile bool &interrupted) {
+  static_assert(std::is_integral_v<T>);
+
+  std::vector<T> result;
+
+  if (0 == row_count || 0 == rows_per_chunk || buckets.empty() ||
+      buckets.back().frequency <= 0.0) {
+    return result;
+  }
+
+  // frequencies are normalized, NULL values are not included
+  const auto step =
+      buckets.back().frequency *
+      std::min(1.0, static_cast<double>(rows_per_chunk) / row_count);
+  const long double low = min;
+  const long double high = max;
+  auto target = step;
+  double previous = 0.0;
+
+  const auto add = [&result, &max, low, high](long double value) {
+    if (value < low || value >= high) {
+      return;
+    }
+
+    const auto boundary = static_cast<T>(value);
+
+    if (boundary < max && (result.empty() || boundary > result.back())) {
+      result.emplace_back(boundary);
+    }
+  };
+
+  for (const auto &bucket : buckets) {
+    if (interrupted) {
+      return {};
+    }
+
+    while (target < bucket.frequency) {
+      // assume uniform distribution of values within a bucket
+      const auto position =
+          (target - previous) / (bucket.frequency - previous);
+      add(bucket.lower + position * (bucket.upper - bucket.lower));
+      target += step;
+    }
+
+    previous = bucket.frequency;
+  }
+
+  return result;
+}
+
 class Dumper {
  public:
   Dumper() = delete;
@@ -154,18 +278,90 @@ class Dumper {
     std::vector<View_info> views;
   };
 
+  struct Tablespace_file {
+    // path to the file in the data directory, without the extension
+    std::string path;
+    // name of the file, without the extension
+    std::string name;
+    // basename of the copies of the file in the dump
+    std::string basename;
+  };
+
   struct Table_task : Table_info {
     std::string task_name;
     std::string schema;
     std::string extra_filter;
     Index_info index;
+    // used when creating the data files
+    mysqlshdk::storage::Compression_options compression;
+    // set if the maximum value of this column is recorded
+    std::string watermark_column;
+    // set if the number of rows is recorded
+    bool count_rows = false;
+    // set if this is a physical dump
+    std::vector<Tablespace_file> tablespaces;
   };
 
+  class Chunk_split;
+
   struct Table_data_task : Table_task {
     std::unique_ptr<Dump_writer_controller> controller;
     std::string id;
     int64_t chunk;
     std::string boundary;
+    // set if chunk can be split while it's being dumped
+    std::shared_ptr<Chunk_split> split;
+    // set if checksum is computed while data is being dumped
+    common::Checksums::Checksum_data *checksum = nullptr;
+    // set if this is one of the slices of a table without an index
+    std::shared_ptr<Table_chunks> slices;
+    std::size_t slice = 0;
+  };
+
+  struct Watermark {
+    std::string column;
+    std::string value;
+  };
+
+  // schema -> table -> watermark
+  using Watermarks = std::unordered_map<
+      std::string, std::unordered_map<std::string, Watermark>>;
+
+  // schema -> table -> number of rows
+  using Row_counts = std::unordered_map<
+      std::string, std::unordered_map<std::string, uint64_t>>;
+
+  struct Incremental_base {
+    std::string location;
+    std::string begin;
+    std::string binlog_file;
+    uint64_t binlog_position = 0;
+    std::string gtid_executed;
+    Watermarks watermarks;
+    Row_counts source_rows;
+  };
+
+  struct Table_fingerprint {
+    // checksum of the table combined with the options which affect its data
+    std::string fingerprint;
+    // location of the dump which holds the data files, empty if table was
+    // dumped by this dump
+    std::string location;
+    // basenames of the data files, in the dump which holds them
+    std::string basename;
+    // partition -> basename
+    std::map<std::string, std::string> basenames;
+    uint64_t data_bytes = 0;
+    uint64_t rows = 0;
+  };
+
+  // schema -> table -> fingerprint
+  using Table_fingerprints = std::unordered_map<
+      std::string, std::unordered_map<std::string, Table_fingerprint>>;
+
+  struct Previous_dump {
+    std::string location;
+    Table_fingerprints tables;
   };
 
   struct Checksum_task {
@@ -216,10 +412,15 @@ class Dumper {
 
   void acquire_read_locks();
 
-  void release_read_locks() const;
+  void release_read_locks();
+
+  void open_read_replicas();
 
   void lock_all_tables();
 
+  void prepare_transaction(
+      const std::shared_ptr<mysqlshdk::db::ISession> &session) const;
+
   void start_transaction(
       const std::shared_ptr<mysqlshdk::db::ISession> &session) const;
 
@@ -246,6 +447,8 @@ class Dumper {
 
   void close_output_directory();
 
+  void open_worker_sessions();
+
   void create_worker_sessions();
 
   void create_worker_threads();
@@ -262,6 +465,12 @@ class Dumper {
 
   void wait_for_all_tasks();
 
+  void remove_incomplete_files() const;
+
+  void write_output_parts();
+
+  void remove_output_parts();
+
   void dump_ddl() const;
 
   void dump_global_ddl() const;
@@ -270,30 +479,54 @@ class Dumper {
 
   void write_ddl(const Memory_dumper &in_memory, const std::string &file) const;
 
-  std::unique_ptr<Memory_dumper> dump_ddl(
-      Schema_dumper *dumper,
-      const std::function<void(Memory_dumper *)> &func) const;
+  /**
+   * Writes a small (DDL or metadata) file. When dumping to a remote storage,
+   * file is written asynchronously by the small file writer.
+   */
+  void write_small_file(const std::string &filename,
+                        std::string contents) const;
+
+  void write_file(const std::string &filename,
+                  const std::string &contents) const;
+
+  void start_small_file_writer();
 
-  std::unique_ptr<Memory_dumper> dump_schema(Schema_dumper *dumper,
-                                             const std::string &schema) const;
+  void wait_for_small_file_writer();
+
+  /**
+   * Creates an in-memory buffer for the DDL. The same buffer should be reused
+   * for multiple objects, its memory is kept between the calls.
+   */
+  std::unique_ptr<Memory_dumper> memory_dumper(Schema_dumper *dumper) const;
+
+  const Memory_dumper &dump_ddl(
+      Memory_dumper *memory,
+      const std::function<void(Memory_dumper *)> &func) const;
 
-  std::unique_ptr<Memory_dumper> dump_table(Schema_dumper *dumper,
-                                            const std::string &schema,
-                                            const std::string &table) const;
+  const Memory_dumper &dump_schema(Memory_dumper *memory,
+                                   const std::string &schema) const;
 
-  std::unique_ptr<Memory_dumper> dump_triggers(Schema_dumper *dumper,
-                                               const std::string &schema,
-                                               const std::string &table) const;
+  const Memory_dumper &dump_table(Memory_dumper *memory,
+                                  const std::string &schema,
+                                  const std::string &table) const;
 
-  std::unique_ptr<Memory_dumper> dump_temporary_view(
-      Schema_dumper *dumper, const std::string &schema,
-      const std::string &view) const;
+  const Memory_dumper &dump_triggers(Memory_dumper *memory,
+                                     const std::string &schema,
+                                     const std::string &table) const;
 
-  std::unique_ptr<Memory_dumper> dump_view(Schema_dumper *dumper,
+  const Memory_dumper &dump_temporary_view(Memory_dumper *memory,
                                            const std::string &schema,
                                            const std::string &view) const;
 
-  std::unique_ptr<Memory_dumper> dump_users(Schema_dumper *dumper) const;
+  const Memory_dumper &dump_view(Memory_dumper *memory,
+                                 const std::string &schema,
+                                 const std::string &view) const;
+
+  const Memory_dumper &dump_users(Memory_dumper *memory) const;
+
+  void ddl_memory_allocated(std::size_t bytes) const;
+
+  void ddl_memory_released(std::size_t bytes) const;
 
   void create_schema_metadata_tasks();
 
@@ -309,6 +542,31 @@ class Dumper {
 
   void push_table_task(Table_task &&task);
 
+  /**
+   * Finds the tablespace files of the given table in the data directory of the
+   * server.
+   */
+  std::vector<Tablespace_file> find_tablespaces(const Schema_info &schema,
+                                                const Table_info &table);
+
+  /**
+   * Executes FLUSH TABLES ... FOR EXPORT for all the tables at once, using a
+   * dedicated session, and schedules the copying of their tablespace files.
+   */
+  void push_tablespace_tasks(std::vector<Table_task> &&tasks);
+
+  void dump_tablespace(const Table_task &table,
+                       const Tablespace_file &tablespace, Table_worker *worker);
+
+  void unlock_tablespaces();
+
+  /**
+   * Sorts the tasks using the estimated size of their data, largest first.
+   * Scheduling the longest tasks first allows the shorter ones to fill the
+   * idle worker threads near the end of the dump.
+   */
+  static void sort_largest_first(std::vector<Table_task> *tasks);
+
   void push_table_chunking_task(Table_task &&task);
 
   void push_table_data_task(Table_data_task &&task);
@@ -322,14 +580,49 @@ class Dumper {
   bool should_dump_data(const Table_task &table) const;
 
   std::unique_ptr<Dump_writer_controller> table_dump_controller(
-      const std::string &filename) const;
+      const std::string &filename,
+      const mysqlshdk::storage::Compression_options &compression) const;
 
   std::unique_ptr<Dump_writer_controller> table_dump_multi_file_controller(
-      const std::string &basename) const;
+      const std::string &basename,
+      const mysqlshdk::storage::Compression_options &compression,
+      std::shared_ptr<Table_chunks> slices = {}) const;
 
   void finish_writing(const std::string &schema, const std::string &table,
                       const Dump_writer_controller *controller);
 
+  void register_chunk_split(const std::shared_ptr<Chunk_split> &split);
+
+  void unregister_chunk_split(const std::shared_ptr<Chunk_split> &split);
+
+  std::vector<std::shared_ptr<Chunk_split>> chunk_split_candidates() const;
+
+  void kill_query(const std::shared_ptr<mysqlshdk::db::ISession> &s) const;
+
+  void chunk_dumped(const Table_data_task &table,
+                    const Dump_write_result &stats, double seconds);
+
+  struct Chunk_performance {
+    int64_t chunk = -1;
+    std::string file;
+    std::size_t worker = 0;
+    double seconds = 0.0;
+    // time between sending the query and receiving the first row
+    double first_row_seconds = 0.0;
+    Dump_write_result stats;
+  };
+
+  void table_chunked(const Table_task &table, std::size_t worker,
+                     double seconds);
+
+  void chunk_performance(const Table_data_task &table,
+                         Chunk_performance performance);
+
+  void write_performance_report() const;
+
+  uint64_t adaptive_rows_per_chunk(const Table_task &table,
+                                   uint64_t estimated) const;
+
   void write_metadata() const;
 
   void write_dump_started_metadata() const;
@@ -338,6 +631,17 @@ class Dumper {
 
   void write_checksum_metadata() const;
 
+  void open_metadata_index();
+
+  void close_metadata_index();
+
+  void open_journal();
+
+  void close_journal();
+
+  void add_to_metadata_index(const std::string &filename,
+                             const std::string &contents) const;
+
   void write_schema_metadata(const Schema_info &schema) const;
 
   void write_table_metadata(
@@ -364,6 +668,8 @@ class Dumper {
 
   void update_progress(const Dump_write_result &progress);
 
+  void publish_progress();
+
   void shutdown_progress();
 
   std::string throughput() const;
@@ -377,6 +683,10 @@ class Dumper {
 
   bool compressed() const;
 
+  mysqlshdk::storage::Compression data_file_compression() const;
+
+  bool encode_binary_columns() const;
+
   void kill_query() const;
 
   std::string get_query_comment(const std::string &quoted_name,
@@ -401,6 +711,41 @@ class Dumper {
 
   void fetch_server_information();
 
+  void read_incremental_base();
+
+  void read_previous_dump();
+
+  /**
+   * Computes fingerprint of the given table, tables whose fingerprints have
+   * not changed since the previous dump are not dumped again.
+   */
+  std::string table_fingerprint(
+      const Table_task &table,
+      const std::shared_ptr<mysqlshdk::db::ISession> &session) const;
+
+  /**
+   * Records fingerprint of the given table, returns true if table has not
+   * changed since the previous dump and its data files are going to be reused.
+   */
+  bool record_table_fingerprint(const Table_task &table,
+                                std::string fingerprint);
+
+  void push_fingerprint_task(Table_task &&task);
+
+  void validate_incremental_dump() const;
+
+  /**
+   * Warns about transactions which have modified data and were not committed
+   * when the consistent snapshot was created, rows they commit are not
+   * visible to this dump and may have lower watermark values than the
+   * recorded ones.
+   */
+  void check_in_flight_transactions() const;
+
+  std::string incremental_filter(const std::string &schema,
+                                 const std::string &table,
+                                 const std::string &column) const;
+
   // returns true in case of errors
   bool check_for_upgrade_errors() const;
 
@@ -416,6 +761,15 @@ class Dumper {
   // session
   std::shared_ptr<mysqlshdk::db::ISession> m_session;
   std::vector<std::shared_ptr<mysqlshdk::db::ISession>> m_lock_sessions;
+  // holds the locks of the tables whose tablespaces are being copied
+  std::shared_ptr<mysqlshdk::db::ISession> m_export_session;
+  // data directory of the server, used by the physical dumps
+  std::string m_datadir;
+  // worker sessions opened before the read locks were acquired, nullptr if
+  // session is going to use a read replica
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> m_worker_sessions;
+  // replicas used by the worker sessions, synchronized with the source
+  std::vector<mysqlshdk::db::Connection_options> m_read_replicas;
   Instance_cache::Server_version m_server_version;
   bool m_binlog_enabled = false;
   bool m_gtid_enabled = false;
@@ -431,15 +785,24 @@ class Dumper {
   const Dump_options &m_options;
   std::unique_ptr<mysqlshdk::storage::IDirectory> m_output_dir;
   std::unique_ptr<mysqlshdk::storage::IFile> m_output_file;
+  // when single output file is written by multiple threads, each chunk is
+  // written to a separate part file, these are merged once dump is done
+  mutable std::vector<std::string> m_output_parts;
+  mutable std::mutex m_output_parts_mutex;
   Instance_cache m_cache;
   std::vector<Schema_info> m_schema_infos;
   std::unordered_map<std::string, std::size_t> m_truncated_basenames;
   std::string m_table_data_extension;
+  std::unique_ptr<Incremental_base> m_incremental_base;
+  std::unique_ptr<Previous_dump> m_previous_dump;
 
   // status variables
   bool m_instance_locked = false;
   // whether FLUSH TABLES WITH READ LOCK was used
   bool m_ftwrl_used = false;
+  // time between acquiring and releasing the read locks
+  mysqlshdk::utils::Duration m_read_locks_duration;
+  bool m_read_locks_acquired = false;
   std::unordered_set<Capability> m_used_capabilities;
 
   // counters
@@ -458,6 +821,10 @@ class Dumper {
   std::atomic<uint64_t> m_num_threads_dumping;
   std::atomic<uint64_t> m_ddl_written;
 
+  // memory held by the in-memory DDL buffers
+  mutable std::atomic<uint64_t> m_ddl_memory;
+  mutable std::atomic<uint64_t> m_ddl_memory_peak;
+
   std::atomic<uint64_t> m_schema_metadata_written;
 
   std::atomic<uint64_t> m_table_metadata_to_write;
@@ -474,12 +841,70 @@ class Dumper {
                      std::unordered_map<std::string, Dump_write_result>>
       m_table_data_stats;
 
+  mutable std::mutex m_watermarks_mutex;
+  // guarded by m_watermarks_mutex
+  Watermarks m_watermarks;
+  // guarded by m_watermarks_mutex
+  Row_counts m_source_rows;
+
+  mutable std::mutex m_table_fingerprints_mutex;
+  Table_fingerprints m_table_fingerprints;
+
+  // copies of all schema and table metadata files, written as a single file,
+  // so that loader does not have to fetch each one of them
+  mutable std::mutex m_metadata_index_mutex;
+  std::unique_ptr<mysqlshdk::storage::IFile> m_metadata_index;
+
+  // files which were completely written, in order, so that loader which runs
+  // concurrently with the dump does not have to list the whole directory
+  std::unique_ptr<Dump_journal> m_journal;
+
   // path -> uncompressed bytes
   std::unordered_map<std::string, uint64_t> m_chunk_file_bytes;
 
+  // path -> CRC-32C of the file contents
+  std::unordered_map<std::string, uint32_t> m_chunk_file_checksums;
+
+  struct Chunk_throughput {
+    uint64_t rows = 0;
+    uint64_t bytes = 0;
+    double seconds = 0.0;
+  };
+
+  mutable std::mutex m_chunk_throughput_mutex;
+  // table task name -> throughput of its dumped chunks
+  std::unordered_map<std::string, Chunk_throughput> m_chunk_throughput;
+  Chunk_throughput m_total_chunk_throughput;
+
+  struct Table_performance {
+    double chunking_seconds = 0.0;
+    std::size_t chunking_worker = 0;
+    std::vector<Chunk_performance> chunks;
+  };
+
+  mutable std::mutex m_performance_mutex;
+  // schema -> table -> partition -> performance
+  std::unordered_map<
+      std::string,
+      std::unordered_map<std::string,
+                         std::unordered_map<std::string, Table_performance>>>
+      m_performance;
+
+  mutable std::mutex m_chunk_splits_mutex;
+  // chunks which are currently being dumped and can be split
+  std::vector<std::shared_ptr<Chunk_split>> m_chunk_splits;
+
   // threads
   std::vector<std::thread> m_workers;
   std::vector<std::exception_ptr> m_worker_exceptions;
+  mysqlshdk::utils::Thread_affinity m_thread_affinity =
+      mysqlshdk::utils::Thread_affinity::NONE;
+
+  // writes DDL and metadata files concurrently, used with remote storages
+  std::unique_ptr<Small_file_writer> m_small_file_writer;
+
+  // resources granted by the process-wide governor
+  std::unique_ptr<Resource_governor::Lease> m_resources;
   std::atomic<bool> m_worker_exception_thrown = false;
   shcore::Synchronized_queue<Task_info> m_worker_tasks;
   std::atomic<uint64_t> m_chunking_tasks_total;
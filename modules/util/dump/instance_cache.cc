@@ -26,11 +26,16 @@
 #include <mysqld_error.h>
 
 #include <algorithm>
+#include <exception>
 #include <iterator>
+#include <numeric>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/libs/db/mysql/result.h"
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/logger.h"
@@ -60,8 +65,10 @@ class Profiler final {
  public:
   Profiler() = delete;
 
-  explicit Profiler(const char *msg) : m_msg(msg) {
-    log_debug("-> %s", m_msg);
+  explicit Profiler(const char *msg,
+                    shcore::Logger::LOG_LEVEL level = shcore::Logger::LOG_DEBUG)
+      : m_msg(msg), m_level(level) {
+    shcore::Logger::log(m_level, "-> %s", m_msg);
 
     m_duration.start();
   }
@@ -75,12 +82,15 @@ class Profiler final {
   ~Profiler() {
     m_duration.finish();
 
-    log_debug("<- %s took %f seconds", m_msg, m_duration.seconds_elapsed());
+    shcore::Logger::log(m_level, "<- %s took %f seconds", m_msg,
+                        m_duration.seconds_elapsed());
   }
 
  private:
   const char *m_msg = nullptr;
 
+  shcore::Logger::LOG_LEVEL m_level;
+
   mysqlshdk::utils::Duration m_duration;
 };
 
@@ -318,13 +328,13 @@ Instance_cache_builder::Instance_cache_builder(
 }
 
 Instance_cache_builder &Instance_cache_builder::metadata(
-    const Partition_filters &partitions) {
-  fetch_metadata(partitions);
+    const Partition_filters &partitions, const Sessions &sessions) {
+  fetch_metadata(partitions, sessions);
   return *this;
 }
 
 Instance_cache_builder &Instance_cache_builder::users() {
-  Profiler profiler{"fetching users"};
+  Profiler profiler{"fetching users", shcore::Logger::LOG_INFO};
 
   Schema_dumper sd{m_session};
 
@@ -339,7 +349,7 @@ Instance_cache_builder &Instance_cache_builder::users() {
 }
 
 Instance_cache_builder &Instance_cache_builder::events() {
-  Profiler profiler{"fetching events"};
+  Profiler profiler{"fetching events", shcore::Logger::LOG_INFO};
 
   Iterate_schema info;
   info.schema_column = "EVENT_SCHEMA";  // NOT NULL
@@ -366,7 +376,7 @@ Instance_cache_builder &Instance_cache_builder::events() {
 }
 
 Instance_cache_builder &Instance_cache_builder::routines() {
-  Profiler profiler{"fetching routines"};
+  Profiler profiler{"fetching routines", shcore::Logger::LOG_INFO};
 
   Iterate_schema info;
   info.schema_column = "ROUTINE_SCHEMA";  // NOT NULL
@@ -400,7 +410,7 @@ Instance_cache_builder &Instance_cache_builder::routines() {
 }
 
 Instance_cache_builder &Instance_cache_builder::triggers() {
-  Profiler profiler{"fetching triggers"};
+  Profiler profiler{"fetching triggers", shcore::Logger::LOG_INFO};
 
   if (has_tables()) {
     Iterate_table info;
@@ -552,11 +562,21 @@ void Instance_cache_builder::filter_tables() {
 }
 
 void Instance_cache_builder::fetch_metadata(
-    const Partition_filters &partitions) {
-  Profiler profiler{"fetching metadata"};
+    const Partition_filters &partitions, const Sessions &sessions) {
+  Profiler profiler{"fetching metadata", shcore::Logger::LOG_INFO};
 
   fetch_ndbinfo();
   fetch_server_metadata();
+
+  if (sessions.empty() || m_cache.schemas.size() < 2) {
+    fetch_object_metadata(partitions);
+  } else {
+    fetch_object_metadata(partitions, sessions);
+  }
+}
+
+void Instance_cache_builder::fetch_object_metadata(
+    const Partition_filters &partitions) {
   fetch_view_metadata();
   fetch_columns();
   fetch_table_indexes();
@@ -564,6 +584,97 @@ void Instance_cache_builder::fetch_metadata(
   fetch_table_partitions(partitions);
 }
 
+void Instance_cache_builder::fetch_object_metadata(
+    const Partition_filters &partitions, const Sessions &sessions) {
+  Profiler profiler{"fetching object metadata in parallel",
+                    shcore::Logger::LOG_INFO};
+
+  // main session is also used
+  const auto groups = std::min(sessions.size() + 1, m_cache.schemas.size());
+
+  log_info("Fetching metadata of %zu schemas using %zu sessions",
+           m_cache.schemas.size(), groups);
+
+  // split the schemas into groups, each one holding similar number of objects,
+  // schemas are moved between caches without reallocating, so that pointers
+  // to columns remain valid
+  using Node = decltype(m_cache.schemas)::node_type;
+  std::vector<Node> nodes;
+  nodes.reserve(m_cache.schemas.size());
+
+  while (!m_cache.schemas.empty()) {
+    nodes.emplace_back(m_cache.schemas.extract(m_cache.schemas.begin()));
+  }
+
+  const auto objects = [](const Node &node) {
+    return node.mapped().tables.size() + node.mapped().views.size();
+  };
+
+  std::sort(nodes.begin(), nodes.end(),
+            [&objects](const Node &l, const Node &r) {
+              return objects(l) > objects(r);
+            });
+
+  std::vector<Instance_cache> caches(groups);
+  std::vector<std::size_t> load(groups, 0);
+
+  for (auto &node : nodes) {
+    const auto group = std::distance(
+        load.begin(), std::min_element(load.begin(), load.end()));
+
+    // schemas without any objects still need to be queried
+    load[group] += objects(node) + 1;
+    caches[group].schemas.insert(std::move(node));
+  }
+
+  std::vector<Instance_cache_builder> builders;
+  builders.reserve(groups);
+
+  for (std::size_t i = 0; i < groups; ++i) {
+    caches[i].server_version = m_cache.server_version;
+
+    builders.emplace_back(0 == i ? m_session : sessions[i - 1], m_filters,
+                          std::move(caches[i]));
+    builders.back().restrict_schema_filter();
+  }
+
+  std::vector<std::exception_ptr> exceptions(groups);
+  std::vector<std::thread> threads;
+  threads.reserve(groups - 1);
+
+  const auto fetch = [&builders, &exceptions, &partitions](std::size_t i) {
+    try {
+      builders[i].fetch_object_metadata(partitions);
+    } catch (...) {
+      exceptions[i] = std::current_exception();
+    }
+  };
+
+  for (std::size_t i = 1; i < groups; ++i) {
+    threads.emplace_back(mysqlsh::spawn_scoped_thread([&fetch, i]() {
+      mysqlsh::Mysql_thread mysql_thread;
+      fetch(i);
+    }));
+  }
+
+  // main thread handles the first group
+  fetch(0);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (auto &builder : builders) {
+    m_cache.schemas.merge(builder.m_cache.schemas);
+  }
+
+  for (const auto &exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+}
+
 void Instance_cache_builder::fetch_version() {
   Profiler profiler{"fetching version"};
 
@@ -576,7 +687,7 @@ void Instance_cache_builder::fetch_explain_select_rows_index() {
 }
 
 void Instance_cache_builder::fetch_server_metadata() {
-  Profiler profiler{"fetching server metadata"};
+  Profiler profiler{"fetching server metadata", shcore::Logger::LOG_INFO};
 
   const auto &co = m_session->get_connection_options();
 
@@ -614,7 +725,7 @@ void Instance_cache_builder::fetch_ndbinfo() {
 }
 
 void Instance_cache_builder::fetch_view_metadata() {
-  Profiler profiler{"fetching view metadata"};
+  Profiler profiler{"fetching view metadata", shcore::Logger::LOG_INFO};
 
   if (!has_views()) {
     return;
@@ -638,7 +749,7 @@ void Instance_cache_builder::fetch_view_metadata() {
 }
 
 void Instance_cache_builder::fetch_columns() {
-  Profiler profiler{"fetching columns"};
+  Profiler profiler{"fetching columns", shcore::Logger::LOG_INFO};
 
   if (!has_tables() && !has_views()) {
     return;
@@ -657,19 +768,13 @@ void Instance_cache_builder::fetch_columns() {
   };
   info.table_name = "columns";
 
-  // schema -> table -> columns
-  std::unordered_map<
-      std::string, std::unordered_map<
-                       std::string, std::map<uint64_t, Instance_cache::Column>>>
-      table_columns;
-  // schema -> view -> columns
-  std::unordered_map<
-      std::string, std::unordered_map<
-                       std::string, std::map<uint64_t, Instance_cache::Column>>>
-      view_columns;
-
-  const auto create_column = [](const mysqlshdk::db::IRow *row) {
-    Instance_cache::Column column;
+  // columns are stored directly in their tables, ordinal positions are kept
+  // separately, as rows are not sorted
+  std::unordered_map<Instance_cache::Table *, std::vector<uint64_t>> positions;
+
+  const auto add_column = [&positions](Instance_cache::Table *table,
+                                       const mysqlshdk::db::IRow *row) {
+    auto &column = table->all_columns.emplace_back();
     // these can be NULL in 8.0, as per output of 'SHOW COLUMNS', but it's
     // not likely, as they're NOT NULL in definition of mysql.columns hidden
     // table
@@ -687,58 +792,44 @@ void Instance_cache_builder::fetch_columns() {
     column.nullable = shcore::str_caseeq(row->get_string(5),
                                          "YES");  // IS_NULLABLE
 
-    return column;
+    positions[table].emplace_back(row->get_uint(4));  // ORDINAL_POSITION
   };
 
   const auto warnings = iterate_tables_and_views(
       info,
-      [&table_columns, &create_column](
-          const std::string &schema_name, const std::string &table_name,
-          Instance_cache::Table *, const mysqlshdk::db::IRow *row) {
-        table_columns[schema_name][table_name].emplace(
-            row->get_uint(4),  // ORDINAL_POSITION
-            create_column(row));
-      },
-      [&view_columns, &create_column](
-          const std::string &schema_name, const std::string &view_name,
-          Instance_cache::View *, const mysqlshdk::db::IRow *row) {
-        view_columns[schema_name][view_name].emplace(
-            row->get_uint(4),  // ORDINAL_POSITION
-            create_column(row));
+      [&add_column](const std::string &, const std::string &,
+                    Instance_cache::Table *table,
+                    const mysqlshdk::db::IRow *row) { add_column(table, row); },
+      [&add_column](const std::string &, const std::string &,
+                    Instance_cache::View *view,
+                    const mysqlshdk::db::IRow *row) { add_column(view, row); });
+
+  for (auto &[table, position] : positions) {
+    auto &columns = table->all_columns;
+
+    if (!std::is_sorted(position.begin(), position.end())) {
+      std::vector<std::size_t> order(columns.size());
+      std::iota(order.begin(), order.end(), 0);
+      std::sort(order.begin(), order.end(), [&position](auto l, auto r) {
+        return position[l] < position[r];
       });
 
-  for (auto &schema : table_columns) {
-    auto &s = m_cache.schemas.at(schema.first);
-
-    for (auto &table : schema.second) {
-      auto &t = s.tables.at(table.first);
-
-      t.all_columns.reserve(table.second.size());
-
-      for (auto &column : table.second) {
-        t.all_columns.emplace_back(std::move(column.second));
+      std::vector<Instance_cache::Column> sorted;
+      sorted.reserve(columns.size());
 
-        if (!t.all_columns.back().generated) {
-          t.columns.emplace_back(&t.all_columns.back());
-        }
+      for (const auto idx : order) {
+        sorted.emplace_back(std::move(columns[idx]));
       }
-    }
-  }
-
-  for (auto &schema : view_columns) {
-    auto &s = m_cache.schemas.at(schema.first);
-
-    for (auto &view : schema.second) {
-      auto &v = s.views.at(view.first);
 
-      v.all_columns.reserve(view.second.size());
-
-      for (auto &column : view.second) {
-        v.all_columns.emplace_back(std::move(column.second));
+      columns = std::move(sorted);
+    } else {
+      columns.shrink_to_fit();
+    }
 
-        if (!v.all_columns.back().generated) {
-          v.columns.emplace_back(&v.all_columns.back());
-        }
+    // columns are not modified from now on, pointers remain valid
+    for (const auto &column : columns) {
+      if (!column.generated) {
+        table->columns.emplace_back(&column);
       }
     }
   }
@@ -762,7 +853,7 @@ void Instance_cache_builder::fetch_columns() {
 }
 
 void Instance_cache_builder::fetch_table_indexes() {
-  Profiler profiler{"fetching table indexes"};
+  Profiler profiler{"fetching table indexes", shcore::Logger::LOG_INFO};
 
   if (!has_tables()) {
     return;
@@ -783,17 +874,16 @@ void Instance_cache_builder::fetch_table_indexes() {
   struct Index_info {
     std::vector<Instance_cache::Column *> columns;
   };
-  // schema -> table -> index name -> index info
+  // table -> index name -> index info
   // indexes are ordered to ensure repeatability of the selection algorithm
-  std::unordered_map<
-      std::string,
-      std::unordered_map<std::string, std::map<std::string, Index_info>>>
+  std::unordered_map<Instance_cache::Table *,
+                     std::map<std::string, Index_info>>
       indexes;
 
   iterate_tables(
-      info,
-      [&indexes](const std::string &schema_name, const std::string &table_name,
-                 Instance_cache::Table *t, const mysqlshdk::db::IRow *row) {
+      info, [&indexes](const std::string &, const std::string &,
+                       Instance_cache::Table *t,
+                       const mysqlshdk::db::IRow *row) {
         // INDEX_NAME can be NULL in 8.0, as per output of 'SHOW COLUMNS', but
         // it's not likely, as it's NOT NULL in definition of mysql.indexes
         // hidden table
@@ -808,8 +898,8 @@ void Instance_cache_builder::fetch_table_indexes() {
         // column will not be found if user is missing SELECT privilege and it
         // was not possible to fetch column information
         if (t->all_columns.end() != column) {
-          auto &index_info = indexes[schema_name][table_name]
-                                    [row->get_string(2, {})];  // INDEX_NAME
+          auto &index_info =
+              indexes[t][row->get_string(2, {})];  // INDEX_NAME
           const auto seq = row->get_uint(4);                   // SEQ_IN_INDEX
 
           // SEQ_IN_INDEX is 1-based
@@ -823,36 +913,32 @@ void Instance_cache_builder::fetch_table_indexes() {
         }
       });
 
-  for (const auto &schema : indexes) {
-    for (const auto &table : schema.second) {
-      auto &t = m_cache.schemas.at(schema.first).tables.at(table.first);
-
-      for (const auto &index : table.second) {
-        Instance_cache::Index new_index;
-        bool nullable = false;
+  for (const auto &[t, table_indexes] : indexes) {
+    for (const auto &index : table_indexes) {
+      Instance_cache::Index new_index;
+      bool nullable = false;
 
-        for (const auto &column : index.second.columns) {
-          new_index.add_column(column);
-          nullable |= column->nullable;
-        }
+      for (const auto &column : index.second.columns) {
+        new_index.add_column(column);
+        nullable |= column->nullable;
+      }
 
-        auto ptr =
-            &t.indexes.emplace(index.first, std::move(new_index)).first->second;
+      auto ptr =
+          &t->indexes.emplace(index.first, std::move(new_index)).first->second;
 
-        if (k_primary_index == index.first) {
-          t.primary_key = ptr;
-        } else if (!nullable) {
-          t.primary_key_equivalents.emplace_back(ptr);
-        } else {
-          t.unique_keys.emplace_back(ptr);
-        }
+      if (k_primary_index == index.first) {
+        t->primary_key = ptr;
+      } else if (!nullable) {
+        t->primary_key_equivalents.emplace_back(ptr);
+      } else {
+        t->unique_keys.emplace_back(ptr);
       }
     }
   }
 }
 
 void Instance_cache_builder::fetch_table_histograms() {
-  Profiler profiler{"fetching table histograms"};
+  Profiler profiler{"fetching table histograms", shcore::Logger::LOG_INFO};
 
   if (!has_tables() || !m_cache.server_version.is_8_0) {
     return;
@@ -896,7 +982,7 @@ void Instance_cache_builder::fetch_table_histograms() {
 
 void Instance_cache_builder::fetch_table_partitions(
     const Partition_filters &partitions) {
-  Profiler profiler{"fetching table partitions"};
+  Profiler profiler{"fetching table partitions", shcore::Logger::LOG_INFO};
 
   if (!has_tables()) {
     return;
@@ -1151,6 +1237,26 @@ void Instance_cache_builder::set_table_filter() {
   }
 }
 
+void Instance_cache_builder::restrict_schema_filter() {
+  if (m_cache.schemas.empty()) {
+    return;
+  }
+
+  if (!m_schema_filter.empty()) {
+    m_schema_filter += " AND ";
+  }
+
+  std::vector<std::string> schemas;
+  schemas.reserve(m_cache.schemas.size());
+
+  for (const auto &schema : m_cache.schemas) {
+    schemas.emplace_back(schema.first);
+  }
+
+  m_schema_filter +=
+      QH::case_sensitive_compare(k_schema_template, schemas, true);
+}
+
 std::string Instance_cache_builder::schema_filter(
     const std::string &schema_column) const {
   return shcore::str_subvars(
@@ -182,6 +182,8 @@ class Instance_cache_builder final {
       std::string,
       std::unordered_map<std::string, std::unordered_set<std::string>>>;
 
+  using Sessions = std::vector<std::shared_ptr<mysqlshdk::db::ISession>>;
+
   Instance_cache_builder() = delete;
 
   Instance_cache_builder(
@@ -196,7 +198,15 @@ class Instance_cache_builder final {
   Instance_cache_builder &operator=(const Instance_cache_builder &) = delete;
   Instance_cache_builder &operator=(Instance_cache_builder &&) = delete;
 
-  Instance_cache_builder &metadata(const Partition_filters &partitions);
+  /**
+   * Fetches metadata of tables and views.
+   *
+   * @param partitions Partitions to be included.
+   * @param sessions Additional sessions, if given, schemas are split into
+   *        groups and metadata of each group is fetched in a separate thread.
+   */
+  Instance_cache_builder &metadata(const Partition_filters &partitions,
+                                   const Sessions &sessions = {});
 
   Instance_cache_builder &users();
 
@@ -231,7 +241,13 @@ class Instance_cache_builder final {
 
   void filter_tables();
 
-  void fetch_metadata(const Partition_filters &partitions);
+  void fetch_metadata(const Partition_filters &partitions,
+                      const Sessions &sessions);
+
+  void fetch_object_metadata(const Partition_filters &partitions);
+
+  void fetch_object_metadata(const Partition_filters &partitions,
+                             const Sessions &sessions);
 
   void fetch_version();
 
@@ -289,6 +305,8 @@ class Instance_cache_builder final {
 
   void set_table_filter();
 
+  void restrict_schema_filter();
+
   std::string schema_filter(const std::string &schema_column) const;
 
   std::string schema_filter(const Iterate_schema &info) const;
@@ -0,0 +1,689 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/parquet_dump_writer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "modules/util/common/parquet/encoding.h"
+#include "modules/util/common/parquet/format.h"
+#include "modules/util/common/parquet/thrift_compact.h"
+#include "modules/util/common/parquet/utils.h"
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+using parquet::bit_width;
+using parquet::encode_decimal;
+using parquet::encode_hybrid;
+using parquet::read_le;
+using parquet::Thrift_compact_writer;
+using parquet::write_le;
+
+// approximate size of the data page
+constexpr std::size_t k_page_size = 1024 * 1024;
+
+// maximum size of the dictionary, if it's exceeded, plain encoding is used
+constexpr std::size_t k_max_dictionary_size = 1024 * 1024;
+
+// maximum size of the buffered data, if it's exceeded, a new row group is
+// created
+constexpr std::size_t k_max_row_group_size = 128 * 1024 * 1024;
+
+parquet::Compression_codec to_codec(mysqlshdk::storage::Compression c) {
+  switch (c) {
+    case mysqlshdk::storage::Compression::NONE:
+      return parquet::UNCOMPRESSED;
+
+    case mysqlshdk::storage::Compression::GZIP:
+      return parquet::GZIP;
+
+    case mysqlshdk::storage::Compression::ZSTD:
+      return parquet::ZSTD;
+
+    case mysqlshdk::storage::Compression::LZ4:
+      // LZ4 frame format is not supported by the Parquet readers
+      break;
+  }
+
+  throw std::logic_error("Unhandled compression type: " +
+                         mysqlshdk::storage::to_string(c));
+}
+
+}  // namespace
+
+struct Parquet_dump_writer::Column_chunk {
+  uint64_t file_offset = 0;
+  uint64_t data_page_offset = 0;
+  uint64_t dictionary_page_offset = 0;
+  uint64_t num_values = 0;
+  uint64_t uncompressed_size = 0;
+  uint64_t compressed_size = 0;
+  bool dictionary = false;
+};
+
+struct Parquet_dump_writer::Row_group {
+  std::vector<Column_chunk> columns;
+  uint64_t num_rows = 0;
+  uint64_t total_byte_size = 0;
+};
+
+/**
+ * Buffers values of a single column for the current row group.
+ */
+class Parquet_dump_writer::Column final {
+ public:
+  enum class Kind { INT64, UINT64, BIT, FLOAT, DOUBLE, DECIMAL, BYTE_ARRAY };
+
+  explicit Column(const mysqlshdk::db::Column &metadata)
+      : m_name(metadata.get_column_label()) {
+    using mysqlshdk::db::Type;
+
+    switch (metadata.get_type()) {
+      case Type::Integer:
+        m_kind = Kind::INT64;
+        m_type = parquet::INT64;
+        break;
+
+      case Type::UInteger:
+        m_kind = Kind::UINT64;
+        m_type = parquet::INT64;
+        m_converted_type = parquet::UINT_64;
+        break;
+
+      case Type::Bit:
+        m_kind = Kind::BIT;
+        m_type = parquet::INT64;
+        m_converted_type = parquet::UINT_64;
+        break;
+
+      case Type::Float:
+        m_kind = Kind::FLOAT;
+        m_type = parquet::FLOAT;
+        break;
+
+      case Type::Double:
+        m_kind = Kind::DOUBLE;
+        m_type = parquet::DOUBLE;
+        break;
+
+      case Type::Decimal: {
+        m_kind = Kind::DECIMAL;
+        m_type = parquet::BYTE_ARRAY;
+        m_converted_type = parquet::DECIMAL;
+        m_scale = std::max(metadata.get_fractional(), 0);
+
+        // length includes the sign and the decimal point
+        auto precision = static_cast<int32_t>(metadata.get_length());
+
+        if (m_scale > 0) {
+          --precision;
+        }
+
+        if (!metadata.is_unsigned()) {
+          --precision;
+        }
+
+        m_precision = std::clamp(precision, std::max(m_scale, 1), 65);
+        break;
+      }
+
+      case Type::Bytes:
+      case Type::Geometry:
+        m_kind = Kind::BYTE_ARRAY;
+        m_type = parquet::BYTE_ARRAY;
+        break;
+
+      case Type::Json:
+        m_kind = Kind::BYTE_ARRAY;
+        m_type = parquet::BYTE_ARRAY;
+        m_converted_type = parquet::JSON;
+        break;
+
+      default:
+        // strings, temporal types, enums and sets are written as UTF-8
+        // strings
+        m_kind = Kind::BYTE_ARRAY;
+        m_type = parquet::BYTE_ARRAY;
+        m_converted_type = parquet::UTF8;
+        break;
+    }
+  }
+
+  Column(const Column &) = delete;
+  Column(Column &&) = delete;
+
+  Column &operator=(const Column &) = delete;
+  Column &operator=(Column &&) = delete;
+
+  ~Column() = default;
+
+  inline const std::string &name() const { return m_name; }
+
+  inline parquet::Type type() const { return m_type; }
+
+  inline parquet::Converted_type converted_type() const {
+    return m_converted_type;
+  }
+
+  inline int32_t precision() const { return m_precision; }
+
+  inline int32_t scale() const { return m_scale; }
+
+  inline const std::vector<uint32_t> &definition_levels() const {
+    return m_definition_levels;
+  }
+
+  inline const std::string &values() const { return m_values; }
+
+  inline bool use_dictionary() const { return m_use_dictionary; }
+
+  inline std::size_t dictionary_size() const { return m_dictionary.size(); }
+
+  inline const std::string &dictionary_values() const {
+    return m_dictionary_values;
+  }
+
+  inline const std::vector<uint32_t> &indices() const { return m_indices; }
+
+  /**
+   * Size of the plain-encoded value stored at the given position.
+   */
+  inline std::size_t value_size(std::size_t pos) const {
+    switch (m_type) {
+      case parquet::FLOAT:
+        return 4;
+
+      case parquet::INT64:
+      case parquet::DOUBLE:
+        return 8;
+
+      case parquet::BYTE_ARRAY:
+        return 4 + read_le(m_values.data() + pos, 4);
+
+      default:
+        break;
+    }
+
+    return 0;
+  }
+
+  /**
+   * Appends a value, nullptr represents a NULL value.
+   */
+  void append(const char *data, std::size_t length) {
+    if (!data) {
+      m_definition_levels.emplace_back(0);
+      return;
+    }
+
+    m_definition_levels.emplace_back(1);
+
+    const auto start = m_values.length();
+    encode(data, length);
+
+    if (m_use_dictionary) {
+      add_to_dictionary(start);
+    }
+  }
+
+  void clear() {
+    m_definition_levels.clear();
+    m_values.clear();
+    m_use_dictionary = true;
+    m_dictionary.clear();
+    m_dictionary_values.clear();
+    m_indices.clear();
+  }
+
+ private:
+  void encode(const char *data, std::size_t length) {
+    // numbers are copied, as the data is not guaranteed to be null-terminated
+    char number[128];
+    const auto number_length = std::min(length, sizeof(number) - 1);
+
+    if (Kind::BYTE_ARRAY != m_kind && Kind::BIT != m_kind &&
+        Kind::DECIMAL != m_kind) {
+      memcpy(number, data, number_length);
+      number[number_length] = '\0';
+    }
+
+    switch (m_kind) {
+      case Kind::INT64:
+        write_le(static_cast<uint64_t>(std::strtoll(number, nullptr, 10)), 8,
+                 &m_values);
+        break;
+
+      case Kind::UINT64:
+        write_le(std::strtoull(number, nullptr, 10), 8, &m_values);
+        break;
+
+      case Kind::BIT: {
+        // BIT values are transferred as big-endian binary data
+        uint64_t value = 0;
+
+        for (std::size_t i = 0; i < length; ++i) {
+          value = (value << 8) | static_cast<unsigned char>(data[i]);
+        }
+
+        write_le(value, 8, &m_values);
+        break;
+      }
+
+      case Kind::FLOAT: {
+        const float value = std::strtof(number, nullptr);
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        write_le(bits, 4, &m_values);
+        break;
+      }
+
+      case Kind::DOUBLE: {
+        const double value = std::strtod(number, nullptr);
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        write_le(bits, 8, &m_values);
+        break;
+      }
+
+      case Kind::DECIMAL:
+        encode_decimal(data, length, &m_values);
+        break;
+
+      case Kind::BYTE_ARRAY:
+        write_le(length, 4, &m_values);
+        m_values.append(data, length);
+        break;
+    }
+  }
+
+  void add_to_dictionary(std::size_t start) {
+    m_key.assign(m_values, start, std::string::npos);
+
+    const auto it = m_dictionary.find(m_key);
+
+    if (m_dictionary.end() != it) {
+      m_indices.emplace_back(it->second);
+      return;
+    }
+
+    if (m_dictionary_values.length() + m_key.length() > k_max_dictionary_size) {
+      // too many distinct values, use plain encoding
+      m_use_dictionary = false;
+      m_dictionary = {};
+      m_dictionary_values = {};
+      m_indices = {};
+      return;
+    }
+
+    const auto idx = static_cast<uint32_t>(m_dictionary.size());
+
+    m_dictionary.emplace(m_key, idx);
+    m_dictionary_values.append(m_key);
+    m_indices.emplace_back(idx);
+  }
+
+  std::string m_name;
+  Kind m_kind;
+  parquet::Type m_type;
+  parquet::Converted_type m_converted_type = parquet::NONE;
+  int32_t m_precision = 0;
+  int32_t m_scale = 0;
+
+  // 0 - NULL, 1 - value is set
+  std::vector<uint32_t> m_definition_levels;
+
+  // plain-encoded values
+  std::string m_values;
+
+  bool m_use_dictionary = true;
+  std::unordered_map<std::string, uint32_t> m_dictionary;
+  // plain-encoded values of the dictionary
+  std::string m_dictionary_values;
+  std::vector<uint32_t> m_indices;
+
+  std::string m_key;
+};
+
+Parquet_dump_writer::Parquet_dump_writer(
+    mysqlshdk::storage::Compression compression)
+    : m_compression(compression) {}
+
+Parquet_dump_writer::Parquet_dump_writer(Parquet_dump_writer &&) = default;
+
+Parquet_dump_writer &Parquet_dump_writer::operator=(Parquet_dump_writer &&) =
+    default;
+
+Parquet_dump_writer::~Parquet_dump_writer() = default;
+
+void Parquet_dump_writer::store_preamble(
+    const std::vector<mysqlshdk::db::Column> &metadata,
+    const std::vector<Encoding_type> &) {
+  m_columns.clear();
+
+  for (const auto &column : metadata) {
+    m_columns.emplace_back(std::make_unique<Column>(column));
+  }
+
+  m_row_groups.clear();
+  m_offset = 0;
+  m_rows = 0;
+  m_total_rows = 0;
+  m_buffered_bytes = 0;
+
+  write(parquet::k_magic, parquet::k_magic_length);
+}
+
+void Parquet_dump_writer::store_row(const mysqlshdk::db::IRow *row) {
+  const char *data = nullptr;
+  std::size_t length = 0;
+  uint32_t idx = 0;
+
+  for (const auto &column : m_columns) {
+    row->get_raw_data(idx++, &data, &length);
+    column->append(data, length);
+    m_buffered_bytes += length;
+  }
+
+  finish_row();
+}
+
+void Parquet_dump_writer::store_row(const Raw_row &row) {
+  uint32_t idx = 0;
+
+  for (const auto &column : m_columns) {
+    column->append(row.data[idx], row.lengths[idx]);
+    m_buffered_bytes += row.lengths[idx];
+    ++idx;
+  }
+
+  finish_row();
+}
+
+void Parquet_dump_writer::store_postamble() {
+  write_row_group();
+
+  std::string metadata;
+  Thrift_compact_writer t{&metadata};
+
+  t.begin_struct();
+
+  // version
+  t.field_i32(1, 1);
+
+  // schema
+  t.field_list(2, parquet::thrift::k_struct, m_columns.size() + 1);
+
+  t.begin_struct();
+  t.field_binary(4, "schema");
+  t.field_i32(5, static_cast<int32_t>(m_columns.size()));
+  t.end_struct();
+
+  for (const auto &column : m_columns) {
+    t.begin_struct();
+    t.field_i32(1, column->type());
+    t.field_i32(3, parquet::OPTIONAL);
+    t.field_binary(4, column->name());
+
+    if (parquet::NONE != column->converted_type()) {
+      t.field_i32(6, column->converted_type());
+    }
+
+    if (parquet::DECIMAL == column->converted_type()) {
+      t.field_i32(7, column->scale());
+      t.field_i32(8, column->precision());
+    }
+
+    t.end_struct();
+  }
+
+  // num_rows
+  t.field_i64(3, m_total_rows);
+
+  // row_groups
+  t.field_list(4, parquet::thrift::k_struct, m_row_groups.size());
+
+  for (const auto &group : m_row_groups) {
+    t.begin_struct();
+
+    t.field_list(1, parquet::thrift::k_struct, group.columns.size());
+
+    for (std::size_t i = 0; i < group.columns.size(); ++i) {
+      const auto &column = m_columns[i];
+      const auto &chunk = group.columns[i];
+
+      t.begin_struct();
+      t.field_i64(2, chunk.file_offset);
+
+      // meta_data
+      t.field_struct(3);
+      t.field_i32(1, column->type());
+
+      if (chunk.dictionary) {
+        t.field_list(2, parquet::thrift::k_i32, 3);
+        t.element_i32(parquet::PLAIN_DICTIONARY);
+      } else {
+        t.field_list(2, parquet::thrift::k_i32, 2);
+      }
+
+      t.element_i32(parquet::PLAIN);
+      t.element_i32(parquet::RLE);
+
+      t.field_list(3, parquet::thrift::k_binary, 1);
+      t.element_binary(column->name());
+
+      t.field_i32(4, to_codec(m_compression));
+      t.field_i64(5, chunk.num_values);
+      t.field_i64(6, chunk.uncompressed_size);
+      t.field_i64(7, chunk.compressed_size);
+      t.field_i64(9, chunk.data_page_offset);
+
+      if (chunk.dictionary) {
+        t.field_i64(11, chunk.dictionary_page_offset);
+      }
+
+      t.end_struct();
+
+      t.end_struct();
+    }
+
+    t.field_i64(2, group.total_byte_size);
+    t.field_i64(3, group.num_rows);
+
+    t.end_struct();
+  }
+
+  // created_by
+  t.field_binary(6, "MySQL Shell " MYSH_VERSION);
+
+  t.end_struct();
+
+  write(metadata.data(), metadata.length());
+
+  std::string footer;
+  write_le(metadata.length(), 4, &footer);
+  footer.append(parquet::k_magic, parquet::k_magic_length);
+
+  write(footer.data(), footer.length());
+}
+
+void Parquet_dump_writer::finish_row() {
+  ++m_rows;
+
+  if (m_buffered_bytes >= k_max_row_group_size) {
+    write_row_group();
+  }
+}
+
+void Parquet_dump_writer::write_row_group() {
+  if (0 == m_rows) {
+    return;
+  }
+
+  Row_group group;
+  group.num_rows = m_rows;
+
+  for (const auto &column : m_columns) {
+    group.columns.emplace_back(write_column_chunk(column.get()));
+    group.total_byte_size += group.columns.back().uncompressed_size;
+
+    column->clear();
+  }
+
+  m_row_groups.emplace_back(std::move(group));
+
+  m_total_rows += m_rows;
+  m_rows = 0;
+  m_buffered_bytes = 0;
+}
+
+Parquet_dump_writer::Column_chunk Parquet_dump_writer::write_column_chunk(
+    Column *column) {
+  Column_chunk chunk;
+  chunk.file_offset = m_offset;
+  chunk.num_values = m_rows;
+  // dictionary is empty if all values are NULL
+  chunk.dictionary =
+      column->use_dictionary() && column->dictionary_size() > 0;
+
+  std::string header;
+  std::string page;
+
+  const auto write_page = [&](parquet::Page_type type, std::size_t num_values,
+                              parquet::Encoding encoding) {
+    std::string compressed;
+    const std::string *data = &page;
+
+    if (mysqlshdk::storage::Compression::NONE != m_compression) {
+      mysqlshdk::storage::compress(m_compression, page.data(), page.length(),
+                                   &compressed);
+      data = &compressed;
+    }
+
+    header.clear();
+    Thrift_compact_writer t{&header};
+
+    t.begin_struct();
+    t.field_i32(1, type);
+    t.field_i32(2, static_cast<int32_t>(page.length()));
+    t.field_i32(3, static_cast<int32_t>(data->length()));
+
+    if (parquet::DATA_PAGE == type) {
+      t.field_struct(5);
+      t.field_i32(1, static_cast<int32_t>(num_values));
+      t.field_i32(2, encoding);
+      t.field_i32(3, parquet::RLE);
+      t.field_i32(4, parquet::RLE);
+      t.end_struct();
+    } else {
+      t.field_struct(7);
+      t.field_i32(1, static_cast<int32_t>(num_values));
+      t.field_i32(2, encoding);
+      t.end_struct();
+    }
+
+    t.end_struct();
+
+    write(header.data(), header.length());
+    write(data->data(), data->length());
+
+    chunk.uncompressed_size += header.length() + page.length();
+    chunk.compressed_size += header.length() + data->length();
+  };
+
+  if (chunk.dictionary) {
+    chunk.dictionary_page_offset = m_offset;
+
+    page = column->dictionary_values();
+    write_page(parquet::DICTIONARY_PAGE, column->dictionary_size(),
+               parquet::PLAIN_DICTIONARY);
+  }
+
+  chunk.data_page_offset = m_offset;
+
+  const auto &levels = column->definition_levels();
+  const auto &values = column->values();
+  const auto rows = levels.size();
+  const auto width = chunk.dictionary
+                         ? std::max(bit_width(static_cast<uint32_t>(
+                                        column->dictionary_size() - 1)),
+                                    1)
+                         : 0;
+  std::string encoded_levels;
+  std::size_t row = 0;
+  std::size_t value = 0;
+  std::size_t value_pos = 0;
+
+  while (row < rows) {
+    const auto first_row = row;
+    const auto first_value = value;
+    const auto first_value_pos = value_pos;
+
+    while (row < rows && value_pos - first_value_pos < k_page_size) {
+      if (levels[row]) {
+        value_pos += column->value_size(value_pos);
+        ++value;
+      }
+
+      ++row;
+    }
+
+    encoded_levels.clear();
+    encode_hybrid(levels.data() + first_row, row - first_row, 1,
+                  &encoded_levels);
+
+    page.clear();
+    write_le(encoded_levels.length(), 4, &page);
+    page.append(encoded_levels);
+
+    if (chunk.dictionary) {
+      page.push_back(static_cast<char>(width));
+      encode_hybrid(column->indices().data() + first_value,
+                    value - first_value, width, &page);
+    } else {
+      page.append(values, first_value_pos, value_pos - first_value_pos);
+    }
+
+    write_page(parquet::DATA_PAGE, row - first_row,
+               chunk.dictionary ? parquet::PLAIN_DICTIONARY : parquet::PLAIN);
+  }
+
+  return chunk;
+}
+
+void Parquet_dump_writer::write(const char *data, std::size_t length) {
+  buffer()->will_write(length);
+  buffer()->append(data, length);
+  m_offset += length;
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
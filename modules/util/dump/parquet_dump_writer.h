@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_PARQUET_DUMP_WRITER_H_
+#define MODULES_UTIL_DUMP_PARQUET_DUMP_WRITER_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+#include "modules/util/dump/dump_writer.h"
+
+namespace mysqlsh {
+namespace dump {
+
+/**
+ * Writes data in the Apache Parquet format. All rows written to a single file
+ * are stored in one row group, unless size of the buffered data exceeds the
+ * limit, then multiple row groups are created.
+ *
+ * Columns use the dictionary encoding, unless dictionary grows too big, then
+ * the plain encoding is used. Pages are compressed using the given codec, the
+ * output file should not be compressed.
+ */
+class Parquet_dump_writer : public Dump_writer {
+ public:
+  Parquet_dump_writer() = delete;
+  explicit Parquet_dump_writer(mysqlshdk::storage::Compression compression);
+
+  Parquet_dump_writer(const Parquet_dump_writer &) = delete;
+  Parquet_dump_writer(Parquet_dump_writer &&);
+
+  Parquet_dump_writer &operator=(const Parquet_dump_writer &) = delete;
+  Parquet_dump_writer &operator=(Parquet_dump_writer &&);
+
+  ~Parquet_dump_writer() override;
+
+ private:
+  class Column;
+  struct Column_chunk;
+  struct Row_group;
+
+  void store_preamble(
+      const std::vector<mysqlshdk::db::Column> &metadata,
+      const std::vector<Encoding_type> &pre_encoded_columns) override;
+
+  void store_row(const mysqlshdk::db::IRow *row) override;
+
+  void store_row(const Raw_row &row) override;
+
+  void store_postamble() override;
+
+  void finish_row();
+
+  void write_row_group();
+
+  Column_chunk write_column_chunk(Column *column);
+
+  void write(const char *data, std::size_t length);
+
+  mysqlshdk::storage::Compression m_compression;
+
+  std::vector<std::unique_ptr<Column>> m_columns;
+
+  std::vector<Row_group> m_row_groups;
+
+  // offset in the output file
+  uint64_t m_offset = 0;
+
+  // rows in the current row group
+  uint64_t m_rows = 0;
+
+  // rows in all row groups
+  uint64_t m_total_rows = 0;
+
+  // bytes buffered by all the columns
+  std::size_t m_buffered_bytes = 0;
+};
+
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_PARQUET_DUMP_WRITER_H_
@@ -23,12 +23,27 @@
 
 #include "modules/util/dump/progress_thread.h"
 
+#ifdef _WIN32
+#include <io.h>
+#else  // !_WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif  // !_WIN32
+
+#include <algorithm>
+#include <cerrno>
 #include <cinttypes>
+#include <climits>
 
 #include <limits>
+#include <stdexcept>
 
 #include "mysqlshdk/libs/textui/progress.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 #include "modules/util/dump/console_with_progress.h"
@@ -41,6 +56,17 @@ namespace {
 constexpr auto k_ellipsis = "...";
 constexpr auto k_done = "- done";
 constexpr uint32_t k_update_every_ms = 250;
+constexpr uint32_t k_status_every_ms = 1000;
+// how long to wait for a slow reader once operation is finished
+constexpr uint32_t k_final_flush_ms = 1000;
+// progress events which were not picked up by the reader are dropped once
+// their size exceeds this value
+constexpr std::size_t k_max_buffered_events = 1024 * 1024;
+#ifdef _WIN32
+constexpr std::size_t k_events_write_size = 4096;
+#else   // !_WIN32
+constexpr std::size_t k_events_write_size = PIPE_BUF;
+#endif  // !_WIN32
 
 std::string format_seconds(double seconds) {
   const auto sec = static_cast<unsigned long long int>(seconds);
@@ -80,6 +106,8 @@ class Numeric_progress : public Spinner_progress {
     const auto total_ready =
         m_config.is_total_known ? m_config.is_total_known() : true;
 
+    set_progress(0, current, total);
+
     m_label.resize(k_max_size);
     // space at the end is there to compensate for the optional tilde before the
     // total value
@@ -145,6 +173,8 @@ class Throughput_progress : public Progress_thread::Stage {
     const auto left_label = m_config.left_label ? m_config.left_label() : "";
     const auto right_label = m_config.right_label ? m_config.right_label() : "";
 
+    set_progress(initial, current, total);
+
     if (m_progress) {
       std::lock_guard<std::recursive_mutex> lock(*m_progress_mutex);
       m_progress->set_total(total, initial);
@@ -189,6 +219,43 @@ class Throughput_progress : public Progress_thread::Stage {
 
 }  // namespace
 
+int to_progress_fd(int64_t fd) {
+  const auto valid = fd >= 0 && fd <= std::numeric_limits<int>::max() &&
+#ifdef _WIN32
+                     -1 != ::_get_osfhandle(static_cast<int>(fd));
+#else   // !_WIN32
+                     -1 != ::fcntl(static_cast<int>(fd), F_GETFD);
+#endif  // !_WIN32
+
+  if (!valid) {
+    throw std::invalid_argument(
+        "The value of 'progressFd' option must be an open file descriptor.");
+  }
+
+  return static_cast<int>(fd);
+}
+
+Progress_counter::Progress_counter(std::size_t slots)
+    : m_slots(std::max<std::size_t>(slots, 1)) {}
+
+std::size_t Progress_counter::load() const {
+  std::size_t sum = 0;
+
+  for (const auto &s : m_slots) {
+    sum += s.value.load(std::memory_order_relaxed);
+  }
+
+  return sum;
+}
+
+void Progress_counter::store(std::size_t value) {
+  for (auto &s : m_slots) {
+    s.value.store(0, std::memory_order_relaxed);
+  }
+
+  m_slots[0].value = value;
+}
+
 std::string Progress_thread::Duration::current_time() {
   return mysqlshdk::utils::fmttime("%Y-%m-%d %T");
 }
@@ -251,6 +318,8 @@ void Progress_thread::Stage::start() {
   }
 
   m_duration.start();
+  m_started = std::chrono::steady_clock::now();
+  m_span.begin("stage", description());
 }
 
 void Progress_thread::Stage::finish(bool wait) {
@@ -267,6 +336,7 @@ void Progress_thread::Stage::finish(bool wait) {
 
   if (has_finished) {
     m_duration.finish();
+    m_span.end();
     m_finished_cv.notify_one();
 
     if (wait) {
@@ -280,10 +350,22 @@ void Progress_thread::Stage::finish(bool wait) {
       if (!m_show_progress) {
         current_console()->print_status(description() + " " + k_done);
       }
+
+      if (m_owner) {
+        m_owner->on_stage_finished(*this);
+      }
     }
   }
 }
 
+void Progress_thread::Stage::set_progress(uint64_t initial, uint64_t current,
+                                          uint64_t total) {
+  m_initial = initial;
+  m_current = current;
+  m_total = total;
+  m_has_progress = true;
+}
+
 void Progress_thread::Stage::display() {
   on_display_started();
 
@@ -398,6 +480,26 @@ void Progress_thread::start() {
       }));
 
   m_total_duration.start();
+
+  start_status_thread();
+}
+
+void Progress_thread::publish_status(const std::string &path) {
+  assert(!m_progress_thread);
+
+  m_status_file = path;
+}
+
+void Progress_thread::publish_events(int fd) {
+  assert(!m_progress_thread);
+
+  m_events_fd = fd;
+}
+
+void Progress_thread::set_status_details(
+    std::function<shcore::Dictionary_t()> &&details) {
+  std::lock_guard lock{m_status_details_mutex};
+  m_status_details = std::move(details);
 }
 
 Progress_thread::Stage *Progress_thread::start_stage(
@@ -420,13 +522,27 @@ Progress_thread::Stage *Progress_thread::start_stage(
 void Progress_thread::finish() {
   shutdown();
   wait_for_thread();
+
+  const auto publishing = stop_status_thread();
   m_total_duration.finish();
+
+  if (publishing) {
+    publish(m_exception ? "failed" : "completed", "finished",
+            std::chrono::milliseconds(k_final_flush_ms));
+  }
+
   rethrow();
 }
 
 void Progress_thread::terminate() {
+  const auto publishing = stop_status_thread();
   m_total_duration.finish();
   kill_thread();
+
+  if (publishing) {
+    publish("interrupted", "finished",
+            std::chrono::milliseconds(k_final_flush_ms));
+  }
 }
 
 void Progress_thread::show() { toggle_visibility(true); }
@@ -446,7 +562,9 @@ Progress_thread::Stage *Progress_thread::start_stage(
 
   m_stages.emplace_back(std::move(stage_ptr));
 
+  stage->m_owner = this;
   stage->start();
+  on_stage_started(*stage);
   m_schedule.push(stage);
 
   return stage;
@@ -488,6 +606,7 @@ void Progress_thread::rethrow() {
 void Progress_thread::kill_thread() {
   emergency_shutdown();
   wait_for_thread();
+  stop_status_thread();
 }
 
 void Progress_thread::toggle_visibility(bool show) {
@@ -505,5 +624,245 @@ void Progress_thread::toggle_visibility(bool show) {
   }
 }
 
+bool Progress_thread::is_publishing() const {
+  return !m_status_file.empty() || m_events_fd >= 0;
+}
+
+void Progress_thread::start_status_thread() {
+  if (!is_publishing() || m_status_thread) {
+    return;
+  }
+
+  m_status_done = false;
+  m_status_thread =
+      std::make_unique<std::thread>(mysqlsh::spawn_scoped_thread([this]() {
+        std::unique_lock lock{m_status_mutex};
+
+        while (!m_status_done) {
+          lock.unlock();
+          publish("running", "progress", std::chrono::milliseconds::zero());
+          lock.lock();
+
+          m_status_cv.wait_for(lock,
+                               std::chrono::milliseconds(k_status_every_ms),
+                               [this]() { return m_status_done; });
+        }
+      }));
+}
+
+bool Progress_thread::stop_status_thread() {
+  if (!m_status_thread) {
+    return false;
+  }
+
+  {
+    std::lock_guard lock{m_status_mutex};
+    m_status_done = true;
+  }
+
+  m_status_cv.notify_one();
+  m_status_thread->join();
+  m_status_thread.reset();
+
+  return true;
+}
+
+void Progress_thread::publish(const char *state, const char *event,
+                              std::chrono::milliseconds timeout) {
+  const auto current = status(state);
+
+  if (!m_status_file.empty()) {
+    write_status(current);
+  }
+
+  if (m_events_fd >= 0) {
+    push_event(event, std::make_shared<shcore::Value::Map_type>(*current));
+    flush_events(timeout);
+  }
+}
+
+shcore::Dictionary_t Progress_thread::status(const char *state) {
+  const auto status = shcore::make_dict();
+
+  status->emplace("operation", m_description);
+  status->emplace("state", state);
+  status->emplace("startedAt", m_total_duration.started_at());
+  status->emplace("updatedAt", Duration::current_time());
+  status->emplace("elapsed", m_total_duration.current());
+
+  if (const auto stage = m_current_stage.load()) {
+    const auto elapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      stage->m_started)
+            .count();
+
+    status->emplace("stage", stage->description());
+    status->emplace("stageElapsed", elapsed);
+
+    if (stage->m_has_progress) {
+      const uint64_t initial = stage->m_initial;
+      const uint64_t current = stage->m_current;
+      const uint64_t total = stage->m_total;
+      const auto rate = elapsed > 0 && current > initial
+                            ? (current - initial) / elapsed
+                            : 0.0;
+      const auto progress = shcore::make_dict();
+
+      progress->emplace("current", current);
+      progress->emplace("total", total);
+      progress->emplace("percent",
+                        total ? 100.0 * std::min(current, total) / total : 0.0);
+      progress->emplace("rate", rate);
+
+      if (current >= total) {
+        progress->emplace("eta", 0.0);
+      } else if (rate > 0) {
+        progress->emplace("eta", (total - current) / rate);
+      }
+
+      status->emplace("progress", progress);
+    }
+  }
+
+  {
+    std::lock_guard lock{m_status_details_mutex};
+
+    if (m_status_details) {
+      try {
+        status->emplace("details", m_status_details());
+      } catch (const std::exception &e) {
+        log_warning("Failed to obtain details of the %s operation: %s",
+                    m_description.c_str(), e.what());
+      }
+    }
+  }
+
+  return status;
+}
+
+void Progress_thread::write_status(const shcore::Dictionary_t &status) {
+  try {
+    // write to a temporary file first, readers always see a complete document
+    const auto tmp_file = m_status_file + ".tmp";
+
+    if (!shcore::create_file(tmp_file, shcore::Value(status).json(true))) {
+      throw std::runtime_error(shcore::get_last_error());
+    }
+
+    shcore::rename_file(tmp_file, m_status_file);
+  } catch (const std::exception &e) {
+    // status is informative, failing to write it does not stop the operation
+    if (!m_status_error_reported) {
+      m_status_error_reported = true;
+      current_console()->print_warning(
+          shcore::str_format("Failed to write the status file '%s': %s",
+                             m_status_file.c_str(), e.what()));
+    }
+  }
+}
+
+void Progress_thread::on_stage_started(const Stage &stage) {
+  if (m_events_fd >= 0) {
+    const auto data = shcore::make_dict();
+    data->emplace("stage", stage.description());
+    push_event("stageStarted", data);
+  }
+}
+
+void Progress_thread::on_stage_finished(const Stage &stage) {
+  if (m_events_fd >= 0) {
+    const auto data = shcore::make_dict();
+    data->emplace("stage", stage.description());
+    data->emplace("seconds", stage.duration().seconds());
+    push_event("stageFinished", data);
+  }
+}
+
+void Progress_thread::push_event(const char *event,
+                                 const shcore::Dictionary_t &data) {
+  if (m_events_failed) {
+    return;
+  }
+
+  // existing values are not replaced
+  data->emplace("event", event);
+  data->emplace("operation", m_description);
+  data->emplace("time", Duration::current_time());
+
+  std::lock_guard lock{m_status_mutex};
+
+  if (m_events.size() >= k_max_buffered_events) {
+    // reader is too slow, events are dropped instead of using more memory
+    ++m_events_dropped;
+    return;
+  }
+
+  if (m_events_dropped) {
+    data->emplace("dropped", static_cast<uint64_t>(m_events_dropped));
+    m_events_dropped = 0;
+  }
+
+  m_events.append(shcore::Value(data).json(false)).append("\n");
+}
+
+void Progress_thread::flush_events(std::chrono::milliseconds timeout) {
+  if (m_events_failed) {
+    return;
+  }
+
+  if (m_events_pending.empty()) {
+    std::lock_guard lock{m_status_mutex};
+    std::swap(m_events, m_events_pending);
+  }
+
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+  while (!m_events_pending.empty()) {
+    const auto size = std::min(m_events_pending.size(), k_events_write_size);
+
+#ifdef _WIN32
+    (void)deadline;
+    const auto written = ::_write(m_events_fd, m_events_pending.data(),
+                                  static_cast<unsigned int>(size));
+#else   // !_WIN32
+    // events are written only if descriptor is ready, so that a slow reader
+    // does not block this thread, unwritten events are kept for later
+    const auto wait = std::max<int64_t>(
+        0, std::chrono::duration_cast<std::chrono::milliseconds>(
+               deadline - std::chrono::steady_clock::now())
+               .count());
+    pollfd fd{m_events_fd, POLLOUT, 0};
+    const auto ready = ::poll(&fd, 1, static_cast<int>(wait));
+
+    if (0 == ready) {
+      break;
+    }
+
+    if (ready < 0 && EINTR == errno) {
+      continue;
+    }
+
+    // writes of up to PIPE_BUF bytes do not block once descriptor is ready
+    const auto written =
+        ready < 0 ? ready
+                  : ::write(m_events_fd, m_events_pending.data(), size);
+
+    if (written < 0 && (EINTR == errno || EAGAIN == errno)) {
+      continue;
+    }
+#endif  // !_WIN32
+
+    if (written < 0) {
+      m_events_failed = true;
+      current_console()->print_warning(shcore::str_format(
+          "Failed to write the progress events to the file descriptor %d: %s",
+          m_events_fd, shcore::errno_to_string(errno).c_str()));
+      return;
+    }
+
+    m_events_pending.erase(0, static_cast<std::size_t>(written));
+  }
+}
+
 }  // namespace dump
 }  // namespace mysqlsh
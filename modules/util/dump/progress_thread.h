@@ -25,6 +25,8 @@
 #define MODULES_UTIL_DUMP_PROGRESS_THREAD_H_
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -32,14 +34,98 @@
 #include <thread>
 #include <vector>
 
+#include "mysqlshdk/include/scripting/types.h"
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
 #include "mysqlshdk/libs/utils/profiling.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/tracing.h"
 
 namespace mysqlsh {
 namespace dump {
 
+/**
+ * A counter which is updated by multiple threads and read by the progress
+ * thread. Each thread updates its own slot, stored in a separate cache line,
+ * so that the threads do not contend for the same memory location. Reading
+ * the counter sums all of its slots.
+ */
+class Progress_counter final {
+ public:
+  Progress_counter() = delete;
+
+  /**
+   * Initializes the counter.
+   *
+   * @param slots Number of slots, usually the number of threads which are
+   *        going to update this counter.
+   */
+  explicit Progress_counter(std::size_t slots);
+
+  Progress_counter(const Progress_counter &) = delete;
+  Progress_counter(Progress_counter &&) = delete;
+
+  Progress_counter &operator=(const Progress_counter &) = delete;
+  Progress_counter &operator=(Progress_counter &&) = delete;
+
+  ~Progress_counter() = default;
+
+  /**
+   * Provides the slot which is going to be updated by the given thread.
+   *
+   * @param id ID of the thread.
+   *
+   * @returns slot of the thread
+   */
+  std::atomic<std::size_t> *slot(std::size_t id) {
+    return &m_slots[id % m_slots.size()].value;
+  }
+
+  /**
+   * Provides the current value of the counter.
+   *
+   * @returns sum of all the slots
+   */
+  std::size_t load() const;
+
+  /**
+   * Sets the value of the counter. Must not be called while any of the slots
+   * is being updated.
+   *
+   * @param value New value.
+   */
+  void store(std::size_t value);
+
+ private:
+  // typical size of a cache line
+  static constexpr std::size_t k_cache_line_size = 64;
+
+  struct alignas(k_cache_line_size) Slot {
+    std::atomic<std::size_t> value{0};
+  };
+
+  std::vector<Slot> m_slots;
+};
+
+/**
+ * Format of the progress information.
+ */
+enum class Progress_format {
+  TEXT,   //!< Progress is displayed on the console.
+  JSONL,  //!< Progress events are written as JSON documents, one per line.
+};
+
+/**
+ * Validates value of the 'progressFd' option.
+ *
+ * @param fd File descriptor.
+ *
+ * @returns validated file descriptor
+ *
+ * @throws std::invalid_argument if file descriptor is not valid
+ */
+int to_progress_fd(int64_t fd);
+
 /**
  * Displays progress of various stages of a complete process using a separate
  * thread. The current_console() object is set up, so that any operation which
@@ -197,6 +283,16 @@ class Progress_thread final {
      */
     virtual void on_update();
 
+    /**
+     * Records the numeric progress of this stage, so that it can be published
+     * by the progress thread.
+     *
+     * @param initial The initial number of items.
+     * @param current The current number of items.
+     * @param total The total number of items.
+     */
+    void set_progress(uint64_t initial, uint64_t current, uint64_t total);
+
    private:
     friend class Progress_thread;
 
@@ -214,6 +310,8 @@ class Progress_thread final {
 
     // information about the stage
     Duration m_duration;
+
+    mysqlshdk::tracing::Span m_span;
     std::string m_description;
     std::atomic<bool> m_show_progress;
 
@@ -227,6 +325,14 @@ class Progress_thread final {
     volatile bool m_display_done = false;
 
     volatile bool m_terminated = false;
+
+    // publishing-related variables
+    Progress_thread *m_owner = nullptr;
+    std::chrono::steady_clock::time_point m_started;
+    std::atomic<bool> m_has_progress = false;
+    std::atomic<uint64_t> m_initial = 0;
+    std::atomic<uint64_t> m_current = 0;
+    std::atomic<uint64_t> m_total = 0;
   };
 
   /**
@@ -330,6 +436,37 @@ class Progress_thread final {
 
   ~Progress_thread();
 
+  /**
+   * Publishes the status of the operation in the given file, as a JSON
+   * document. The file is replaced atomically about once per second while the
+   * operation is running, so it can be read at any time by other processes.
+   * Needs to be called before start().
+   *
+   * @param path Path to the status file.
+   */
+  void publish_status(const std::string &path);
+
+  /**
+   * Writes the progress events to the given file descriptor, as JSON
+   * documents, one per line: start and end of each stage, progress of the
+   * operation about once per second, and the final state of the operation.
+   * Events are written by a separate thread, if the reader is slow they are
+   * buffered and eventually dropped, the operation is never blocked. Needs to
+   * be called before start().
+   *
+   * @param fd File descriptor to write to.
+   */
+  void publish_events(int fd);
+
+  /**
+   * Sets the callback which provides details of the operation, included in
+   * the published status and progress events. It is called from a separate
+   * thread, can be set at any time.
+   *
+   * @param details Provides details of the operation.
+   */
+  void set_status_details(std::function<shcore::Dictionary_t()> &&details);
+
   /**
    * Starts handling of the registered stages. Each of them is going to be
    * displayed one by one, after the previous one finishes execution. If not
@@ -431,6 +568,27 @@ class Progress_thread final {
 
   void toggle_visibility(bool show);
 
+  bool is_publishing() const;
+
+  void start_status_thread();
+
+  bool stop_status_thread();
+
+  void publish(const char *state, const char *event,
+               std::chrono::milliseconds timeout);
+
+  shcore::Dictionary_t status(const char *state);
+
+  void write_status(const shcore::Dictionary_t &status);
+
+  void on_stage_started(const Stage &stage);
+
+  void on_stage_finished(const Stage &stage);
+
+  void push_event(const char *event, const shcore::Dictionary_t &data);
+
+  void flush_events(std::chrono::milliseconds timeout);
+
   // configuration
   std::string m_description;
   std::atomic<bool> m_show_progress = false;
@@ -451,6 +609,25 @@ class Progress_thread final {
   // animated progress
   std::unique_ptr<mysqlshdk::textui::Base_progress> m_progress;
   std::recursive_mutex m_progress_mutex;
+
+  // status file and progress events
+  std::string m_status_file;
+  bool m_status_error_reported = false;
+  std::mutex m_status_details_mutex;
+  std::function<shcore::Dictionary_t()> m_status_details;
+  std::unique_ptr<std::thread> m_status_thread;
+  std::mutex m_status_mutex;
+  std::condition_variable m_status_cv;
+  bool m_status_done = false;
+
+  int m_events_fd = -1;
+  std::atomic<bool> m_events_failed = false;
+  // events which were not yet picked up by the writer, guarded by
+  // m_status_mutex
+  std::string m_events;
+  std::size_t m_events_dropped = 0;
+  // events which are being written, owned by the writer
+  std::string m_events_pending;
 };
 
 }  // namespace dump
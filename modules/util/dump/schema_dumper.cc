@@ -559,15 +559,26 @@ void Schema_dumper::fetch_db_collation(const std::string &db,
   @returns  whether there was an error or not
 */
 void Schema_dumper::switch_character_set_results(const char *cs_name) {
+  if (m_current_character_set_results == cs_name) {
+    return;
+  }
+
   try {
     m_mysql->executef("SET SESSION character_set_results = ?", cs_name);
   } catch (const mysqlshdk::db::Error &e) {
     THROW_ERROR(SHERR_DUMP_SD_CHARACTER_SET_RESULTS_ERROR, cs_name);
   }
+
+  m_current_character_set_results = cs_name;
 }
 
 void Schema_dumper::use(const std::string &db) const {
+  if (m_current_db == db) {
+    return;
+  }
+
   m_mysql->executef("USE !", db);
+  m_current_db = db;
 }
 
 void Schema_dumper::unescape(IFile *file, std::string_view s) {
@@ -1218,7 +1229,11 @@ std::vector<Schema_dumper::Issue> Schema_dumper::get_table_structure(
 
   result_table = shcore::quote_identifier(table);
 
-  if (!execute_no_throw("SET SQL_QUOTE_SHOW_CREATE=1")) {
+  if (!m_quote_show_create_set) {
+    m_quote_show_create_set = !execute_no_throw("SET SQL_QUOTE_SHOW_CREATE=1");
+  }
+
+  if (m_quote_show_create_set) {
     /* using SHOW CREATE statement */
     if (!skip_ddl) {
       /* Make an sql-file, if path was given iow. option -T was given */
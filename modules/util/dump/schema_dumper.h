@@ -214,6 +214,12 @@ class Schema_dumper {
   std::shared_ptr<mysqlshdk::db::ISession> m_mysql;
   const std::vector<std::string> m_mysqlaas_supported_charsets;
 
+  // state of the session, used to skip statements which would not change it,
+  // this matters when DDL of many objects is dumped using the same instance
+  mutable std::string m_current_db;
+  std::string m_current_character_set_results;
+  bool m_quote_show_create_set = false;
+
   bool stats_tables_included = false;
 
   /**
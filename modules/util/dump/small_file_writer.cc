@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/small_file_writer.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace mysqlsh {
+namespace dump {
+
+Small_file_writer::Small_file_writer(uint64_t threads, Write write)
+    : m_write(std::move(write)), m_pool(threads ? threads : 1) {
+  m_pool.start_threads();
+  m_state = &m_pool.process_async();
+}
+
+void Small_file_writer::write(const std::string &filename,
+                              std::string contents) {
+  if (aborted()) {
+    throw std::runtime_error("Cannot write '" + filename +
+                             "', writing of the DDL and metadata files has "
+                             "been aborted");
+  }
+
+  m_pool.add_task(
+      [this, filename, contents = std::move(contents)]() {
+        m_write(filename, contents);
+        return std::string{};
+      },
+      [](std::string &&) {}, shcore::Thread_pool::Priority::MEDIUM,
+      shcore::Thread_pool::Processing::PARALLEL);
+}
+
+void Small_file_writer::terminate() {
+  m_terminated = true;
+  m_pool.terminate();
+}
+
+void Small_file_writer::wait() {
+  if (!m_waited) {
+    m_waited = true;
+
+    if (!m_terminated) {
+      m_pool.tasks_done();
+    }
+  }
+
+  m_pool.wait_for_process();
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
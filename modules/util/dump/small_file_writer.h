@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_SMALL_FILE_WRITER_H_
+#define MODULES_UTIL_DUMP_SMALL_FILE_WRITER_H_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "mysqlshdk/libs/utils/thread_pool.h"
+
+namespace mysqlsh {
+namespace dump {
+
+/**
+ * Writes small files (i.e. DDL and metadata) concurrently, so that latency of
+ * a request to a remote storage is not paid for every file. Number of writes
+ * in flight is bounded by the number of threads.
+ *
+ * Once a write fails, the remaining ones are abandoned.
+ */
+class Small_file_writer final {
+ public:
+  using Write = std::function<void(const std::string &filename,
+                                   const std::string &contents)>;
+
+  Small_file_writer() = delete;
+
+  /**
+   * Creates the writer and starts its threads.
+   *
+   * @param threads Number of concurrent writes.
+   * @param write Writes the contents to the given file, called concurrently.
+   */
+  Small_file_writer(uint64_t threads, Write write);
+
+  Small_file_writer(const Small_file_writer &) = delete;
+  Small_file_writer(Small_file_writer &&) = delete;
+
+  Small_file_writer &operator=(const Small_file_writer &) = delete;
+  Small_file_writer &operator=(Small_file_writer &&) = delete;
+
+  /**
+   * Stops the threads, files which were not written yet are abandoned.
+   */
+  ~Small_file_writer() = default;
+
+  /**
+   * Schedules a write of the given file.
+   *
+   * @throws std::runtime_error If writing was aborted.
+   */
+  void write(const std::string &filename, std::string contents);
+
+  /**
+   * Abandons the writes which have not been started yet.
+   */
+  void terminate();
+
+  /**
+   * Waits for all the scheduled writes to finish, no writes can be scheduled
+   * afterwards.
+   *
+   * @throws std::exception If any of the writes has failed.
+   */
+  void wait();
+
+  /**
+   * Whether writing was aborted, either due to an error or a call to
+   * terminate().
+   */
+  bool aborted() const {
+    return shcore::Thread_pool::Async_state::TERMINATED == *m_state;
+  }
+
+ private:
+  Write m_write;
+  shcore::Thread_pool m_pool;
+  volatile const shcore::Thread_pool::Async_state *m_state;
+  bool m_terminated = false;
+  bool m_waited = false;
+};
+
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_SMALL_FILE_WRITER_H_
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/table_chunks.h"
+
+#include <utility>
+
+namespace mysqlsh {
+namespace dump {
+
+Chunk_range::Chunk_range(std::shared_ptr<Table_chunks> chunks, uint64_t begin,
+                         uint64_t end)
+    : m_chunks(std::move(chunks)),
+      m_begin(begin),
+      m_end_initial(end),
+      m_current(begin),
+      m_end(end) {}
+
+bool Chunk_range::accept(uint64_t key) {
+  m_current.store(key, std::memory_order_relaxed);
+
+  if (m_split_requested.load(std::memory_order_acquire)) {
+    handle_split_request(key);
+  }
+
+  if (key > m_end.load(std::memory_order_relaxed)) {
+    m_stopped = true;
+    return false;
+  }
+
+  return true;
+}
+
+void Chunk_range::finish() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_finished = true;
+    m_split_requested = false;
+  }
+
+  m_split_handled.notify_all();
+}
+
+double Chunk_range::remaining() const {
+  const auto current = m_current.load(std::memory_order_relaxed);
+  const auto end = m_end.load(std::memory_order_relaxed);
+
+  if (current >= end || m_end_initial == m_begin) {
+    return 0.0;
+  }
+
+  return static_cast<double>(end - current) /
+         static_cast<double>(m_end_initial - m_begin);
+}
+
+bool Chunk_range::split(uint64_t *out_begin, uint64_t *out_end,
+                        std::size_t *out_index) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+
+  if (m_finished || m_split_requested) {
+    return false;
+  }
+
+  m_split = false;
+  m_split_requested = true;
+
+  if (!m_split_handled.wait_for(lock, k_split_timeout, [this]() {
+        return m_finished || !m_split_requested;
+      })) {
+    // owner did not read a row in time, cancel the request
+    m_split_requested = false;
+    return false;
+  }
+
+  if (!m_split) {
+    return false;
+  }
+
+  *out_begin = m_stolen_begin;
+  *out_end = m_stolen_end;
+  *out_index = m_stolen_index;
+
+  return true;
+}
+
+void Chunk_range::handle_split_request(uint64_t key) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_split_requested) {
+      // request was cancelled
+      return;
+    }
+
+    const auto end = m_end.load(std::memory_order_relaxed);
+
+    if (key < end && end - key >= k_min_split_range) {
+      const auto middle = key + (end - key) / 2;
+
+      // new chunk needs to be pending before the owner can finish this one,
+      // otherwise final chunk could be created while the new one is still
+      // being dumped
+      m_stolen_index = m_chunks->create_chunk();
+
+      m_stolen_begin = middle + 1;
+      m_stolen_end = end;
+      m_end.store(middle, std::memory_order_relaxed);
+      m_split = true;
+    }
+
+    m_split_requested = false;
+  }
+
+  m_split_handled.notify_all();
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_TABLE_CHUNKS_H_
+#define MODULES_UTIL_DUMP_TABLE_CHUNKS_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace mysqlsh {
+namespace dump {
+
+/**
+ * Tracks the chunks of a table which are dumped by multiple threads, decides
+ * when the final (empty) chunk is created.
+ */
+struct Table_chunks {
+  std::mutex mutex;
+  std::size_t next_index = 0;
+  // number of chunks which were created, but were not dumped yet
+  std::size_t pending = 0;
+  bool chunking_finished = false;
+  bool final_chunk_created = false;
+
+  std::size_t create_chunk() {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++pending;
+    return next_index++;
+  }
+
+  /**
+   * Creates a slice of a table, which is written to multiple files.
+   */
+  void create_slice() {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++pending;
+  }
+
+  /**
+   * Returns index of the next file written by a slice.
+   */
+  std::size_t create_file() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return next_index++;
+  }
+
+  /**
+   * Marks the given event, returns index of the final (empty) chunk if it
+   * should be created now.
+   */
+  std::optional<std::size_t> chunk_finished() {
+    std::lock_guard<std::mutex> lock(mutex);
+    --pending;
+    return maybe_create_final_chunk();
+  }
+
+  std::optional<std::size_t> finish_chunking() {
+    std::lock_guard<std::mutex> lock(mutex);
+    chunking_finished = true;
+    return maybe_create_final_chunk();
+  }
+
+ private:
+  std::optional<std::size_t> maybe_create_final_chunk() {
+    // final chunk is not needed if no chunks were created
+    if (chunking_finished && 0 == pending && next_index > 0 &&
+        !final_chunk_created) {
+      final_chunk_created = true;
+      return next_index++;
+    }
+
+    return {};
+  }
+};
+
+/**
+ * Integer range of a chunk which is being dumped, which can be split by an idle
+ * thread. Signed values are mapped to unsigned ones, preserving the order.
+ *
+ * The thread which dumps the chunk checks for split requests before each row
+ * is written and decides where the split happens, this guarantees that rows are
+ * not duplicated or lost.
+ */
+class Chunk_range {
+ public:
+  Chunk_range() = delete;
+
+  Chunk_range(std::shared_ptr<Table_chunks> chunks, uint64_t begin,
+              uint64_t end);
+
+  Chunk_range(const Chunk_range &) = delete;
+  Chunk_range(Chunk_range &&) = delete;
+
+  Chunk_range &operator=(const Chunk_range &) = delete;
+  Chunk_range &operator=(Chunk_range &&) = delete;
+
+  virtual ~Chunk_range() = default;
+
+  static uint64_t to_ordered(int64_t v) {
+    return static_cast<uint64_t>(v) ^ (UINT64_C(1) << 63);
+  }
+
+  static int64_t from_ordered(uint64_t v) {
+    return static_cast<int64_t>(v ^ (UINT64_C(1) << 63));
+  }
+
+  inline const std::shared_ptr<Table_chunks> &chunks() const {
+    return m_chunks;
+  }
+
+  /**
+   * Checks if key belongs to this chunk, handles split requests. Keys are
+   * expected to be ordered.
+   *
+   * @returns false if key (and all subsequent keys) are outside of the chunk
+   */
+  bool accept(uint64_t key);
+
+  /**
+   * Whether owner has stopped before reading all of the rows.
+   */
+  inline bool stopped() const { return m_stopped; }
+
+  /**
+   * Called by the owner once chunk is dumped, chunk cannot be split after
+   * this.
+   */
+  void finish();
+
+  /**
+   * Fraction of the range which was not dumped yet.
+   */
+  double remaining() const;
+
+  /**
+   * Requests a split of this chunk, waits until request is handled.
+   *
+   * Index of the new chunk is reserved by the owner while the split is
+   * handled, so the final chunk of the table cannot be created before the
+   * new chunk is dumped.
+   *
+   * @param out_begin Beginning of the range taken from this chunk.
+   * @param out_end End of the range taken from this chunk.
+   * @param out_index Index of the new chunk.
+   *
+   * @returns true if chunk was split
+   */
+  bool split(uint64_t *out_begin, uint64_t *out_end, std::size_t *out_index);
+
+ private:
+  static constexpr std::chrono::milliseconds k_split_timeout{1000};
+
+  // ranges smaller than this are not split
+  static constexpr uint64_t k_min_split_range = 1000;
+
+  void handle_split_request(uint64_t key);
+
+  const std::shared_ptr<Table_chunks> m_chunks;
+  const uint64_t m_begin;
+  const uint64_t m_end_initial;
+  std::atomic<uint64_t> m_current;
+  std::atomic<uint64_t> m_end;
+  bool m_stopped = false;
+
+  std::mutex m_mutex;
+  std::condition_variable m_split_handled;
+  std::atomic<bool> m_split_requested = false;
+  bool m_finished = false;
+  bool m_split = false;
+  uint64_t m_stolen_begin = 0;
+  uint64_t m_stolen_end = 0;
+  std::size_t m_stolen_index = 0;
+};
+
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_TABLE_CHUNKS_H_
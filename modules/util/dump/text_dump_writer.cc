@@ -97,10 +97,24 @@ void Text_dump_writer::store_preamble(
 }
 
 void Text_dump_writer::store_row(const mysqlshdk::db::IRow *row) {
+  const char *data = nullptr;
+  std::size_t length = 0;
+
+  start_row();
+
+  for (uint32_t idx = 0; idx < m_num_fields; ++idx) {
+    row->get_raw_data(idx, &data, &length);
+    store_field(idx, data, length);
+  }
+
+  finish_row();
+}
+
+void Text_dump_writer::store_row(const Raw_row &row) {
   start_row();
 
   for (uint32_t idx = 0; idx < m_num_fields; ++idx) {
-    store_field(row, idx);
+    store_field(idx, row.data[idx], row.lengths[idx]);
   }
 
   finish_row();
@@ -165,8 +179,8 @@ void Text_dump_writer::start_row() {
   buffer()->append_fixed(m_dialect.lines_starting_by);
 }
 
-void Text_dump_writer::store_field(const mysqlshdk::db::IRow *row,
-                                   uint32_t idx) {
+void Text_dump_writer::store_field(uint32_t idx, const char *data,
+                                   std::size_t length) {
   // TODO(pawel): implement a fixed-row format:
   //              https://dev.mysql.com/doc/refman/8.0/en/load-data.html
 
@@ -174,10 +188,6 @@ void Text_dump_writer::store_field(const mysqlshdk::db::IRow *row,
     buffer()->append_fixed(m_dialect.fields_terminated_by);
   }
 
-  const char *data = nullptr;
-  std::size_t length = 0;
-  row->get_raw_data(idx, &data, &length);
-
   bool is_null = nullptr == data;
 
   if (!is_null) {
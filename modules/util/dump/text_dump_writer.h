@@ -54,6 +54,8 @@ class Text_dump_writer : public Dump_writer {
 
   void store_row(const mysqlshdk::db::IRow *row) override;
 
+  void store_row(const Raw_row &row) override;
+
   void store_postamble() override;
 
   void read_metadata(const std::vector<mysqlshdk::db::Column> &metadata,
@@ -61,7 +63,7 @@ class Text_dump_writer : public Dump_writer {
 
   void start_row();
 
-  void store_field(const mysqlshdk::db::IRow *row, uint32_t idx);
+  void store_field(uint32_t idx, const char *data, std::size_t length);
 
   void quote_field(uint32_t idx);
 
@@ -0,0 +1,957 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/arrow_ipc_reader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+namespace {
+
+// values defined by the Arrow format specification (Schema.fbs, Message.fbs,
+// File.fbs)
+namespace arrow {
+
+enum Type : uint8_t {
+  NULL_TYPE = 1,
+  INT = 2,
+  FLOATING_POINT = 3,
+  BINARY = 4,
+  UTF8 = 5,
+  BOOL = 6,
+  DECIMAL = 7,
+  DATE = 8,
+  TIME = 9,
+  TIMESTAMP = 10,
+  FIXED_SIZE_BINARY = 15,
+  LARGE_BINARY = 19,
+  LARGE_UTF8 = 20,
+};
+
+enum Precision : int16_t {
+  HALF = 0,
+  SINGLE = 1,
+  DOUBLE = 2,
+};
+
+enum Date_unit : int16_t {
+  DAY = 0,
+  MILLISECOND = 1,
+};
+
+enum Time_unit : int16_t {
+  SECOND = 0,
+  MILLI = 1,
+  MICRO = 2,
+  NANO = 3,
+};
+
+enum Endianness : int16_t {
+  LITTLE = 0,
+};
+
+enum Message_header : uint8_t {
+  DICTIONARY_BATCH = 2,
+  RECORD_BATCH = 3,
+};
+
+enum Compression_type : int8_t {
+  LZ4_FRAME = 0,
+  ZSTD = 1,
+};
+
+constexpr char k_magic[] = "ARROW1";
+constexpr std::size_t k_magic_length = sizeof(k_magic) - 1;
+
+constexpr uint32_t k_continuation = 0xFFFFFFFF;
+
+// size of the Block struct
+constexpr std::size_t k_block_size = 24;
+
+// size of the FieldNode and Buffer structs
+constexpr std::size_t k_node_size = 16;
+constexpr std::size_t k_buffer_size = 16;
+
+}  // namespace arrow
+
+[[noreturn]] void corrupted(const std::string &what) {
+  throw std::runtime_error("corrupted " + what);
+}
+
+[[noreturn]] void unsupported(const std::string &what) {
+  throw std::runtime_error(what + " is not supported");
+}
+
+inline uint64_t read_le(const char *data, std::size_t bytes) {
+  uint64_t value = 0;
+
+  for (std::size_t i = 0; i < bytes; ++i) {
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (8 * i);
+  }
+
+  return value;
+}
+
+inline int64_t sign_extend(uint64_t value, std::size_t bytes) {
+  const auto shift = 64 - 8 * bytes;
+  return static_cast<int64_t>(value << shift) >> shift;
+}
+
+inline int64_t floor_div(int64_t value, int64_t divisor) {
+  const auto result = value / divisor;
+  return result * divisor > value ? result - 1 : result;
+}
+
+int64_t units_per_second(int64_t unit) {
+  switch (unit) {
+    case arrow::MILLI:
+      return 1000;
+
+    case arrow::MICRO:
+      return 1000000;
+
+    case arrow::NANO:
+      return 1000000000;
+
+    default:
+      return 1;
+  }
+}
+
+/**
+ * Reads a table of a flatbuffer.
+ */
+class Flatbuffer_table final {
+ public:
+  /**
+   * Reads the root table of the given buffer.
+   */
+  static Flatbuffer_table root(std::string_view buffer) {
+    return Flatbuffer_table{buffer, offset_at(buffer, 0)};
+  }
+
+  Flatbuffer_table(std::string_view buffer, std::size_t position)
+      : m_buffer(buffer), m_position(position) {
+    check(m_buffer, m_position, 4);
+
+    const auto vtable =
+        static_cast<int64_t>(m_position) -
+        sign_extend(read_le(m_buffer.data() + m_position, 4), 4);
+
+    if (vtable < 0) {
+      corrupted("metadata: invalid vtable");
+    }
+
+    m_vtable = static_cast<std::size_t>(vtable);
+    check(m_buffer, m_vtable, 2);
+    m_vtable_size = read_le(m_buffer.data() + m_vtable, 2);
+    check(m_buffer, m_vtable, m_vtable_size);
+  }
+
+  std::string_view buffer() const { return m_buffer; }
+
+  int64_t integer(int field, std::size_t bytes, int64_t default_value) const {
+    const auto p = field_position(field);
+
+    if (0 == p) {
+      return default_value;
+    }
+
+    check(m_buffer, p, bytes);
+
+    return sign_extend(read_le(m_buffer.data() + p, bytes), bytes);
+  }
+
+  bool boolean(int field, bool default_value) const {
+    return 0 != integer(field, 1, default_value ? 1 : 0);
+  }
+
+  std::optional<Flatbuffer_table> table(int field) const {
+    const auto p = field_position(field);
+
+    if (0 == p) {
+      return {};
+    }
+
+    return Flatbuffer_table{m_buffer, offset_at(m_buffer, p)};
+  }
+
+  std::string_view string(int field) const {
+    const auto [position, length] = vector(field, 1);
+    return m_buffer.substr(position, length);
+  }
+
+  /**
+   * Returns the position of the first element and the number of elements.
+   */
+  std::pair<std::size_t, std::size_t> vector(int field,
+                                             std::size_t element_size) const {
+    const auto p = field_position(field);
+
+    if (0 == p) {
+      return {0, 0};
+    }
+
+    const auto v = offset_at(m_buffer, p);
+    check(m_buffer, v, 4);
+
+    const auto size = read_le(m_buffer.data() + v, 4);
+    check(m_buffer, v + 4, size * element_size);
+
+    return {v + 4, size};
+  }
+
+  /**
+   * Reads a table which is an element of a vector.
+   */
+  Flatbuffer_table element(std::size_t position) const {
+    return Flatbuffer_table{m_buffer, offset_at(m_buffer, position)};
+  }
+
+ private:
+  static void check(std::string_view buffer, std::size_t position,
+                    std::size_t length) {
+    if (position > buffer.size() || length > buffer.size() - position) {
+      corrupted("metadata: offset out of range");
+    }
+  }
+
+  static std::size_t offset_at(std::string_view buffer, std::size_t position) {
+    check(buffer, position, 4);
+    return position + read_le(buffer.data() + position, 4);
+  }
+
+  std::size_t field_position(int field) const {
+    const std::size_t entry = 4 + 2 * field;
+
+    if (entry + 2 > m_vtable_size) {
+      return 0;
+    }
+
+    const auto offset = read_le(m_buffer.data() + m_vtable + entry, 2);
+
+    return 0 == offset ? 0 : m_position + offset;
+  }
+
+  std::string_view m_buffer;
+  std::size_t m_position;
+  std::size_t m_vtable;
+  std::size_t m_vtable_size;
+};
+
+using Layout = Arrow_ipc_reader::Layout;
+
+/**
+ * Reads the layout of the given type, returns false if type is not supported.
+ */
+bool read_layout(int64_t type_id, const Flatbuffer_table &type,
+                 Layout *layout) {
+  using Kind = Column_type::Kind;
+
+  const auto fixed = [layout](int64_t bits, Kind kind) {
+    if (bits <= 0 || bits % 8 || bits > 256) {
+      return false;
+    }
+
+    layout->kind = Layout::Kind::FIXED;
+    layout->byte_width = static_cast<uint32_t>(bits / 8);
+    layout->type.kind = kind;
+
+    return true;
+  };
+
+  switch (type_id) {
+    case arrow::NULL_TYPE:
+      layout->kind = Layout::Kind::NONE;
+      layout->type.kind = Kind::NONE;
+      return true;
+
+    case arrow::INT: {
+      const auto bits = type.integer(0, 4, 0);
+      layout->is_signed = type.boolean(1, false);
+
+      return bits <= 64 &&
+             fixed(bits, layout->is_signed ? Kind::SIGNED : Kind::UNSIGNED);
+    }
+
+    case arrow::FLOATING_POINT:
+      switch (type.integer(0, 2, arrow::HALF)) {
+        case arrow::SINGLE:
+          return fixed(32, Kind::FLOAT);
+
+        case arrow::DOUBLE:
+          return fixed(64, Kind::DOUBLE);
+      }
+
+      return false;
+
+    case arrow::BINARY:
+    case arrow::UTF8:
+      layout->kind = Layout::Kind::BINARY;
+      layout->type.kind = Kind::BYTES;
+      return true;
+
+    case arrow::LARGE_BINARY:
+    case arrow::LARGE_UTF8:
+      layout->kind = Layout::Kind::LARGE_BINARY;
+      layout->type.kind = Kind::BYTES;
+      return true;
+
+    case arrow::BOOL:
+      layout->kind = Layout::Kind::BOOLEAN;
+      layout->type.kind = Kind::BOOLEAN;
+      return true;
+
+    case arrow::DECIMAL:
+      layout->type.scale = static_cast<int32_t>(type.integer(1, 4, 0));
+      return fixed(type.integer(2, 4, 128), Kind::DECIMAL);
+
+    case arrow::DATE:
+      if (arrow::DAY == type.integer(0, 2, arrow::MILLISECOND)) {
+        return fixed(32, Kind::DATE);
+      }
+
+      layout->divisor = 86400000;
+      return fixed(64, Kind::DATE);
+
+    case arrow::TIME: {
+      const auto bits = type.integer(1, 4, 32);
+      layout->type.units_per_second =
+          units_per_second(type.integer(0, 2, arrow::MILLI));
+
+      return (32 == bits || 64 == bits) && fixed(bits, Kind::TIME);
+    }
+
+    case arrow::TIMESTAMP:
+      layout->type.units_per_second =
+          units_per_second(type.integer(0, 2, arrow::SECOND));
+      // values of timestamps with a time zone are normalized to UTC
+      layout->type.utc = !type.string(1).empty();
+      return fixed(64, Kind::TIMESTAMP);
+
+    case arrow::FIXED_SIZE_BINARY: {
+      const auto bytes = type.integer(0, 4, 0);
+
+      if (bytes <= 0) {
+        return false;
+      }
+
+      layout->kind = Layout::Kind::FIXED;
+      layout->byte_width = static_cast<uint32_t>(bytes);
+      layout->type.kind = Kind::BYTES;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+std::size_t buffer_count(const Layout &layout) {
+  switch (layout.kind) {
+    case Layout::Kind::NONE:
+      return 0;
+
+    case Layout::Kind::BOOLEAN:
+    case Layout::Kind::FIXED:
+      return 2;
+
+    case Layout::Kind::BINARY:
+    case Layout::Kind::LARGE_BINARY:
+      return 3;
+  }
+
+  return 0;
+}
+
+/**
+ * Message read from a file, owns the data.
+ */
+struct Message {
+  std::string data;
+  // decompressed buffers
+  std::vector<std::string> decompressed;
+};
+
+struct Record_batch {
+  uint64_t length = 0;
+  // number of values in each column
+  std::vector<uint64_t> nodes;
+  std::vector<std::string_view> buffers;
+};
+
+/**
+ * Reads the header of the message, returns its type.
+ */
+int64_t read_message(const Message &message, uint64_t metadata_length,
+                     std::optional<Flatbuffer_table> *header,
+                     std::string_view *body) {
+  const std::string_view data = message.data;
+
+  if (data.size() < 8 || metadata_length > data.size()) {
+    corrupted("message: message is too short");
+  }
+
+  std::size_t position = 4;
+  auto size = read_le(data.data(), 4);
+
+  if (arrow::k_continuation == size) {
+    size = read_le(data.data() + 4, 4);
+    position = 8;
+  }
+
+  if (metadata_length < position || size > metadata_length - position) {
+    corrupted("message: invalid metadata length");
+  }
+
+  const auto flatbuffer = Flatbuffer_table::root(data.substr(position, size));
+
+  *header = flatbuffer.table(2);
+  *body = data.substr(metadata_length);
+
+  if (!header->has_value()) {
+    corrupted("message: missing header");
+  }
+
+  return flatbuffer.integer(1, 1, 0);
+}
+
+Record_batch read_record_batch(const Flatbuffer_table &batch,
+                               std::string_view body, Message *message) {
+  Record_batch result;
+
+  result.length = batch.integer(0, 8, 0);
+
+  {
+    const auto [first, count] = batch.vector(1, arrow::k_node_size);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      result.nodes.emplace_back(read_le(
+          batch.buffer().data() + first + i * arrow::k_node_size, 8));
+    }
+  }
+
+  std::optional<int64_t> codec;
+
+  if (const auto compression = batch.table(3)) {
+    codec = compression->integer(0, 1, arrow::LZ4_FRAME);
+
+    if (arrow::LZ4_FRAME != *codec && arrow::ZSTD != *codec) {
+      unsupported("Compression codec " + std::to_string(*codec));
+    }
+  }
+
+  const auto [first, count] = batch.vector(2, arrow::k_buffer_size);
+
+  // views into decompressed buffers need to remain valid
+  message->decompressed.reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto buffer =
+        batch.buffer().data() + first + i * arrow::k_buffer_size;
+    const auto offset = read_le(buffer, 8);
+    const auto length = read_le(buffer + 8, 8);
+
+    if (offset > body.size() || length > body.size() - offset) {
+      corrupted("record batch: buffer out of range");
+    }
+
+    auto data = body.substr(offset, length);
+
+    if (codec.has_value() && !data.empty()) {
+      if (data.size() < 8) {
+        corrupted("record batch: compressed buffer is too short");
+      }
+
+      const auto uncompressed = static_cast<int64_t>(read_le(data.data(), 8));
+      data.remove_prefix(8);
+
+      // -1 means that buffer is not compressed
+      if (-1 != uncompressed) {
+        if (uncompressed < 0) {
+          corrupted("record batch: invalid buffer length");
+        }
+
+        auto &out = message->decompressed.emplace_back();
+        mysqlshdk::storage::decompress(
+            arrow::ZSTD == *codec ? mysqlshdk::storage::Compression::ZSTD
+                                  : mysqlshdk::storage::Compression::LZ4,
+            data.data(), data.size(), uncompressed, &out);
+        data = out;
+      }
+    }
+
+    result.buffers.emplace_back(data);
+  }
+
+  return result;
+}
+
+/**
+ * Reads values of a single column of a record batch.
+ */
+class Arrow_column_cursor final : public Column_cursor {
+ public:
+  Arrow_column_cursor(const Layout &layout, uint64_t length,
+                      std::vector<std::string_view> buffers,
+                      std::shared_ptr<Message> message,
+                      std::shared_ptr<const Encoded_values> dictionary,
+                      std::string context)
+      : m_layout(layout),
+        m_length(length),
+        m_buffers(std::move(buffers)),
+        m_message(std::move(message)),
+        m_dictionary(std::move(dictionary)),
+        m_context(std::move(context)) {
+    validate();
+  }
+
+  void next(std::string *out) override {
+    if (m_row >= m_length) {
+      throw std::runtime_error(m_context +
+                               "corrupted record batch: not enough values");
+    }
+
+    if (!is_valid(m_row)) {
+      encode::null(out);
+    } else if (m_dictionary) {
+      const auto index = integer(m_row);
+
+      if (index < 0 || static_cast<uint64_t>(index) >= m_dictionary->size()) {
+        throw std::runtime_error(
+            m_context +
+            "corrupted record batch: dictionary index out of range");
+      }
+
+      m_dictionary->append(index, out);
+    } else {
+      encode_value(m_row, out);
+    }
+
+    ++m_row;
+  }
+
+ private:
+  void validate() const {
+    if (m_buffers.size() != buffer_count(m_layout)) {
+      corrupted("record batch: invalid number of buffers");
+    }
+
+    if (m_buffers.empty()) {
+      return;
+    }
+
+    // sizes are compared using divisions, length is not trusted and
+    // multiplying it could overflow
+    const auto bitmap_size = m_length / 8 + (m_length % 8 ? 1 : 0);
+
+    // validity bitmap is omitted if there are no NULL values
+    if (!m_buffers[0].empty() && m_buffers[0].size() < bitmap_size) {
+      corrupted("record batch: validity bitmap is too short");
+    }
+
+    const auto size = m_buffers[1].size();
+    bool too_short;
+
+    switch (m_layout.kind) {
+      case Layout::Kind::FIXED:
+        too_short = m_length > size / m_layout.byte_width;
+        break;
+
+      case Layout::Kind::BINARY:
+        // length + 1 offsets
+        too_short = m_length > 0 && m_length >= size / 4;
+        break;
+
+      case Layout::Kind::LARGE_BINARY:
+        too_short = m_length > 0 && m_length >= size / 8;
+        break;
+
+      default:
+        too_short = size < bitmap_size;
+        break;
+    }
+
+    if (too_short) {
+      corrupted("record batch: buffer is too short");
+    }
+  }
+
+  bool is_valid(uint64_t row) const {
+    if (Layout::Kind::NONE == m_layout.kind) {
+      return false;
+    }
+
+    const auto &validity = m_buffers[0];
+
+    return validity.empty() ||
+           ((static_cast<uint8_t>(validity[row / 8]) >> (row % 8)) & 1);
+  }
+
+  int64_t integer(uint64_t row) const {
+    const auto width = m_layout.byte_width;
+    const auto value =
+        read_le(m_buffers[1].data() + row * width, std::min(width, 8u));
+
+    return m_layout.is_signed && width < 8 ? sign_extend(value, width)
+                                           : static_cast<int64_t>(value);
+  }
+
+  void encode_value(uint64_t row, std::string *out) const {
+    const auto &type = m_layout.type;
+
+    switch (m_layout.kind) {
+      case Layout::Kind::NONE:
+        encode::null(out);
+        return;
+
+      case Layout::Kind::BOOLEAN:
+        encode::boolean(
+            (static_cast<uint8_t>(m_buffers[1][row / 8]) >> (row % 8)) & 1,
+            out);
+        return;
+
+      case Layout::Kind::BINARY:
+      case Layout::Kind::LARGE_BINARY: {
+        const std::size_t width =
+            Layout::Kind::BINARY == m_layout.kind ? 4 : 8;
+        const auto offsets = m_buffers[1].data() + row * width;
+        const auto begin = read_le(offsets, width);
+        const auto end = read_le(offsets + width, width);
+        const auto &data = m_buffers[2];
+
+        if (begin > end || end > data.size()) {
+          throw std::runtime_error(m_context +
+                                   "corrupted record batch: invalid offset");
+        }
+
+        encode::bytes(type, data.substr(begin, end - begin), out);
+        return;
+      }
+
+      case Layout::Kind::FIXED:
+        break;
+    }
+
+    const auto width = m_layout.byte_width;
+    const auto value = m_buffers[1].data() + row * width;
+
+    switch (type.kind) {
+      case Column_type::Kind::FLOAT: {
+        float f;
+        ::memcpy(&f, value, sizeof(f));
+        encode::floating(f, out);
+        break;
+      }
+
+      case Column_type::Kind::DOUBLE: {
+        double d;
+        ::memcpy(&d, value, sizeof(d));
+        encode::floating(d, out);
+        break;
+      }
+
+      case Column_type::Kind::DECIMAL: {
+        // little-endian two's complement
+        std::string big_endian{value, width};
+        std::reverse(big_endian.begin(), big_endian.end());
+        encode::bytes(type, big_endian, out);
+        break;
+      }
+
+      case Column_type::Kind::BYTES:
+        encode::bytes(type, std::string_view{value, width}, out);
+        break;
+
+      default: {
+        auto v = integer(row);
+
+        if (m_layout.divisor > 1) {
+          v = floor_div(v, m_layout.divisor);
+        }
+
+        encode::integer(type, v, out);
+        break;
+      }
+    }
+  }
+
+  const Layout m_layout;
+  const uint64_t m_length;
+  const std::vector<std::string_view> m_buffers;
+  // owns the buffers
+  const std::shared_ptr<Message> m_message;
+  const std::shared_ptr<const Encoded_values> m_dictionary;
+  const std::string m_context;
+  uint64_t m_row = 0;
+};
+
+}  // namespace
+
+Arrow_ipc_reader::Arrow_ipc_reader(mysqlshdk::storage::IFile *file)
+    : m_file(file) {
+  try {
+    read_metadata();
+  } catch (const std::runtime_error &e) {
+    throw_error(*m_file, e.what());
+  }
+}
+
+void Arrow_ipc_reader::read_metadata() {
+  const uint64_t file_size = m_file->file_size();
+  // magic (padded to 8 bytes), footer length, magic
+  const auto min_size = 8 + 4 + arrow::k_magic_length;
+
+  if (file_size < min_size) {
+    corrupted("file: file is too small");
+  }
+
+  const auto head = read_range(m_file, 0, arrow::k_magic_length);
+  const auto tail = read_range(m_file, file_size - 4 - arrow::k_magic_length,
+                               4 + arrow::k_magic_length);
+
+  if (0 != ::memcmp(head.data(), arrow::k_magic, arrow::k_magic_length) ||
+      0 != ::memcmp(tail.data() + 4, arrow::k_magic, arrow::k_magic_length)) {
+    corrupted("file: not an Arrow IPC file");
+  }
+
+  const auto footer_length = read_le(tail.data(), 4);
+
+  if (footer_length > file_size - min_size) {
+    corrupted("file: invalid footer length");
+  }
+
+  const auto footer_data = read_range(
+      m_file, file_size - 4 - arrow::k_magic_length - footer_length,
+      footer_length);
+  const auto footer = Flatbuffer_table::root(footer_data);
+  const auto schema = footer.table(1);
+
+  if (!schema.has_value()) {
+    corrupted("metadata: missing schema");
+  }
+
+  if (arrow::LITTLE != schema->integer(0, 2, arrow::LITTLE)) {
+    unsupported("Big-endian data");
+  }
+
+  const auto [first_field, field_count] = schema->vector(1, 4);
+
+  for (std::size_t i = 0; i < field_count; ++i) {
+    const auto field = schema->element(first_field + 4 * i);
+    auto &info = m_fields.emplace_back();
+
+    info.name = field.string(0);
+
+    const auto type = field.table(3);
+
+    if (field.vector(5, 4).second > 0 || !type.has_value() ||
+        !read_layout(field.integer(2, 1, 0), *type, &info.values)) {
+      throw std::runtime_error("column '" + info.name +
+                               "' has a type which is not supported");
+    }
+
+    if (const auto dictionary = field.table(4)) {
+      info.dictionary_id = dictionary->integer(0, 8, 0);
+
+      // index type defaults to int32
+      int64_t bits = 32;
+      bool is_signed = true;
+
+      if (const auto index = dictionary->table(1)) {
+        bits = index->integer(0, 4, 32);
+        is_signed = index->boolean(1, false);
+      }
+
+      if (8 != bits && 16 != bits && 32 != bits && 64 != bits) {
+        corrupted("metadata: invalid dictionary index type");
+      }
+
+      info.indices.kind = Layout::Kind::FIXED;
+      info.indices.byte_width = static_cast<uint32_t>(bits / 8);
+      info.indices.is_signed = is_signed;
+      info.indices.type.kind =
+          is_signed ? Column_type::Kind::SIGNED : Column_type::Kind::UNSIGNED;
+    }
+
+    m_columns.emplace_back(info.name);
+  }
+
+  const auto read_blocks = [&footer, file_size](int field,
+                                                std::vector<Block> *blocks) {
+    const auto [first, count] = footer.vector(field, arrow::k_block_size);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto data =
+          footer.buffer().data() + first + i * arrow::k_block_size;
+      auto &block = blocks->emplace_back();
+
+      block.offset = read_le(data, 8);
+      block.metadata_length = read_le(data + 8, 4);
+      block.body_length = read_le(data + 16, 8);
+
+      if (block.offset > file_size ||
+          block.metadata_length > file_size - block.offset ||
+          block.body_length >
+              file_size - block.offset - block.metadata_length) {
+        corrupted("metadata: block out of range");
+      }
+    }
+  };
+
+  read_blocks(2, &m_dictionary_blocks);
+  read_blocks(3, &m_record_batches);
+
+  for (const auto &block : m_record_batches) {
+    m_chunk_bytes.emplace_back(block.metadata_length + block.body_length);
+  }
+
+  distribute_bytes(file_size, &m_chunk_bytes);
+}
+
+void Arrow_ipc_reader::read_dictionaries() {
+  for (const auto &block : m_dictionary_blocks) {
+    const auto message = std::make_shared<Message>();
+    message->data = read_range(m_file, block.offset,
+                               block.metadata_length + block.body_length);
+
+    std::optional<Flatbuffer_table> header;
+    std::string_view body;
+
+    if (arrow::DICTIONARY_BATCH !=
+        read_message(*message, block.metadata_length, &header, &body)) {
+      corrupted("file: expected a dictionary batch");
+    }
+
+    const auto id = header->integer(0, 8, 0);
+    const auto data = header->table(1);
+    const auto is_delta = header->boolean(2, false);
+
+    const auto field = std::find_if(
+        m_fields.begin(), m_fields.end(),
+        [id](const Field_info &f) { return id == f.dictionary_id; });
+
+    if (m_fields.end() == field || !data.has_value()) {
+      corrupted("file: unexpected dictionary batch");
+    }
+
+    const auto batch = read_record_batch(*data, body, message.get());
+
+    if (batch.nodes.empty()) {
+      corrupted("file: empty dictionary batch");
+    }
+
+    Arrow_column_cursor cursor{field->values, batch.nodes[0], batch.buffers,
+                               message,       nullptr,        ""};
+    auto &dictionary = m_dictionaries[id];
+
+    if (!dictionary || !is_delta) {
+      dictionary = std::make_shared<Encoded_values>();
+    }
+
+    for (uint64_t i = 0; i < batch.nodes[0]; ++i) {
+      cursor.next(dictionary->data());
+      dictionary->finish();
+    }
+  }
+}
+
+Columnar_chunk Arrow_ipc_reader::read_chunk(std::size_t chunk) {
+  try {
+    if (!m_dictionaries_read) {
+      read_dictionaries();
+      m_dictionaries_read = true;
+    }
+
+    const auto &block = m_record_batches.at(chunk);
+    const auto message = std::make_shared<Message>();
+    message->data = read_range(m_file, block.offset,
+                               block.metadata_length + block.body_length);
+
+    std::optional<Flatbuffer_table> header;
+    std::string_view body;
+
+    if (arrow::RECORD_BATCH !=
+        read_message(*message, block.metadata_length, &header, &body)) {
+      corrupted("file: expected a record batch");
+    }
+
+    const auto batch = read_record_batch(*header, body, message.get());
+
+    if (batch.nodes.size() != m_fields.size()) {
+      corrupted("record batch: invalid number of columns");
+    }
+
+    Columnar_chunk result;
+    result.rows = batch.length;
+
+    std::size_t buffer = 0;
+
+    for (std::size_t i = 0; i < m_fields.size(); ++i) {
+      const auto &field = m_fields[i];
+      const auto is_dictionary = field.dictionary_id >= 0;
+      const auto &layout = is_dictionary ? field.indices : field.values;
+      const auto count = buffer_count(layout);
+      std::shared_ptr<const Encoded_values> dictionary;
+
+      if (is_dictionary) {
+        const auto it = m_dictionaries.find(field.dictionary_id);
+
+        if (m_dictionaries.end() == it) {
+          corrupted("file: missing dictionary");
+        }
+
+        dictionary = it->second;
+      }
+
+      if (batch.buffers.size() - buffer < count) {
+        corrupted("record batch: not enough buffers");
+      }
+
+      result.columns.emplace_back(std::make_unique<Arrow_column_cursor>(
+          layout, batch.nodes[i],
+          std::vector<std::string_view>(batch.buffers.begin() + buffer,
+                                        batch.buffers.begin() + buffer + count),
+          message, std::move(dictionary),
+          "Failed to read column '" + field.name + "' of '" +
+              m_file->full_path().masked() + "': "));
+
+      buffer += count;
+    }
+
+    return result;
+  } catch (const std::runtime_error &e) {
+    throw_error(*m_file, e.what());
+  }
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
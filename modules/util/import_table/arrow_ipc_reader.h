@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_IMPORT_TABLE_ARROW_IPC_READER_H_
+#define MODULES_UTIL_IMPORT_TABLE_ARROW_IPC_READER_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "modules/util/import_table/columnar_reader.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+/**
+ * Reads files in the Arrow IPC file format (Feather V2) with a flat schema,
+ * each record batch is a separate chunk.
+ *
+ * Supports dictionary-encoded columns and buffers compressed using LZ4 or ZSTD.
+ */
+class Arrow_ipc_reader final : public Columnar_reader {
+ public:
+  Arrow_ipc_reader() = delete;
+
+  explicit Arrow_ipc_reader(mysqlshdk::storage::IFile *file);
+
+  Arrow_ipc_reader(const Arrow_ipc_reader &) = delete;
+  Arrow_ipc_reader(Arrow_ipc_reader &&) = delete;
+
+  Arrow_ipc_reader &operator=(const Arrow_ipc_reader &) = delete;
+  Arrow_ipc_reader &operator=(Arrow_ipc_reader &&) = delete;
+
+  ~Arrow_ipc_reader() override = default;
+
+  const std::vector<std::string> &columns() const override {
+    return m_columns;
+  }
+
+  const std::vector<uint64_t> &chunk_bytes() const override {
+    return m_chunk_bytes;
+  }
+
+  Columnar_chunk read_chunk(std::size_t chunk) override;
+
+  /**
+   * Physical layout of values of a column.
+   */
+  struct Layout {
+    enum class Kind {
+      // no buffers, all values are NULL
+      NONE,
+      // validity and bitmap of values
+      BOOLEAN,
+      // validity and values of a fixed width
+      FIXED,
+      // validity, 32-bit offsets and data
+      BINARY,
+      // validity, 64-bit offsets and data
+      LARGE_BINARY,
+    };
+
+    Kind kind = Kind::NONE;
+    uint32_t byte_width = 0;
+    bool is_signed = true;
+    // values are divided by this number (milliseconds to days)
+    int64_t divisor = 1;
+    Column_type type;
+  };
+
+  struct Field_info {
+    std::string name;
+    Layout values;
+    // ID of the dictionary, or -1 if column is not dictionary-encoded
+    int64_t dictionary_id = -1;
+    Layout indices;
+  };
+
+ private:
+  struct Block {
+    uint64_t offset = 0;
+    uint64_t metadata_length = 0;
+    uint64_t body_length = 0;
+  };
+
+  void read_metadata();
+
+  void read_dictionaries();
+
+  mysqlshdk::storage::IFile *m_file;
+  std::vector<std::string> m_columns;
+  std::vector<uint64_t> m_chunk_bytes;
+  std::vector<Field_info> m_fields;
+  std::vector<Block> m_dictionary_blocks;
+  std::vector<Block> m_record_batches;
+  bool m_dictionaries_read = false;
+  std::unordered_map<int64_t, std::shared_ptr<Encoded_values>> m_dictionaries;
+};
+
+}  // namespace import_table
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_IMPORT_TABLE_ARROW_IPC_READER_H_
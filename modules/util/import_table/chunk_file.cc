@@ -24,10 +24,22 @@
 #include "modules/util/import_table/chunk_file.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/storage/backend/file.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 
 namespace mysqlsh {
 namespace import_table {
@@ -203,35 +215,197 @@ void Chunk_file::set_chunk_size(const size_t bytes) {
 }
 
 void Chunk_file::start() {
-  File_handler fh{m_handle_creator()};
+  auto file = m_handle_creator();
+
+  if (const auto local = dynamic_cast<mysqlshdk::storage::backend::File *>(
+          file.get())) {
+    // local, uncompressed file, try to map it into memory
+    mysqlshdk::storage::backend::File::Options options;
+    options.mmap = mysqlshdk::storage::backend::Mmap_preference::ON;
+
+    mysqlshdk::storage::backend::File mapped{local->full_path().real(),
+                                             options};
+    mapped.open(mysqlshdk::storage::Mode::READ);
+
+    size_t size = 0;
+
+    if (const auto data = reinterpret_cast<const uint8_t *>(
+            mapped.mmap_will_read(&size))) {
+      log_debug("Chunking mmapped file %s",
+                mapped.full_path().masked().c_str());
+
+      file.reset();
+
+      chunk([data, size](const auto &callback) {
+        callback(Mapped_file_iterator{data, data + size, data},
+                 Mapped_file_iterator{data, data + size, data + size});
+      });
+
+      mapped.close();
+      return;
+    }
+
+    mapped.close();
+  }
+
+  file.reset();
+
+  // each thread reads the file using its own handle
+  chunk([this](const auto &callback) {
+    File_handler fh{m_handle_creator()};
+    auto [first, last] = fh.iterators(m_dialect.lines_terminated_by.size());
+    callback(first, last);
+  });
+}
+
+template <typename Iter>
+Iter Chunk_file::skip_rows(Iter first, Iter last) const {
+  if (m_skip_rows_count > 0) {
+    if (m_dialect.fields_escaped_by.empty()) {
+      first = import_table::skip_rows(
+          first, last, m_dialect.lines_terminated_by, m_skip_rows_count);
+    } else {
+      first = import_table::skip_rows(first, last,
+                                      m_dialect.lines_terminated_by,
+                                      m_skip_rows_count,
+                                      m_dialect.fields_escaped_by[0]);
+    }
+  }
+
+  return first;
+}
+
+template <typename Iter>
+Iter Chunk_file::skip_to_row_end(Iter first, Iter last) const {
+  if (m_dialect.fields_escaped_by.empty()) {
+    return import_table::skip_to_row_end(first, last,
+                                         m_dialect.lines_terminated_by);
+  } else {
+    return import_table::skip_to_row_end(first, last,
+                                         m_dialect.lines_terminated_by,
+                                         m_dialect.fields_escaped_by[0]);
+  }
+}
+
+template <typename Open>
+void Chunk_file::chunk(const Open &open) {
+  std::size_t begin = 0;
+  std::size_t end = 0;
+
+  open([this, &begin, &end](auto first, auto last) {
+    begin = skip_rows(first, last).offset();
+    end = last.offset();
+  });
+
+  if (begin >= end) {
+    return;
+  }
+
+  // probe i starts at begin + (i + 1) * chunk size, it's resolved once it
+  // finds the beginning of the next row
+  const auto probes = (end - begin - 1) / m_chunk_size;
+  std::vector<std::optional<std::size_t>> boundaries(probes);
+  std::atomic<std::size_t> next_probe{0};
+  std::atomic<bool> cancelled{false};
+  std::exception_ptr exception;
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  const auto probe = [&, this]() {
+    try {
+      open([&, this](auto first, auto last) {
+        for (auto i = next_probe++; i < probes && !cancelled;
+             i = next_probe++) {
+          first.force_offset(begin + (i + 1) * m_chunk_size);
+          first = skip_to_row_end(first, last);
+
+          {
+            std::lock_guard lock{mutex};
+            boundaries[i] = first.offset();
+          }
+
+          cv.notify_all();
+        }
+      });
+    } catch (...) {
+      {
+        std::lock_guard lock{mutex};
+
+        if (!exception) {
+          exception = std::current_exception();
+        }
+      }
+
+      cancelled = true;
+      cv.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  shcore::on_leave_scope join_threads([&threads, &cancelled]() {
+    cancelled = true;
+
+    for (auto &t : threads) {
+      t.join();
+    }
+  });
+
+  for (std::size_t i = 0, size = std::min(m_threads, probes); i < size; ++i) {
+    threads.emplace_back(mysqlsh::spawn_scoped_thread(probe));
+  }
+
+  // the last range is held back, so that it can be marked as such
+  std::optional<File_import_info> pending;
+  const auto push_pending = [this, &pending](bool last) {
+    if (pending) {
+      pending->last_range = last;
+      m_queue->push(std::move(*pending));
+      pending.reset();
+    }
+  };
+  const auto on_new_chunk = [this, &pending, &push_pending](size_t b,
+                                                            size_t e) {
+    push_pending(false);
 
-  auto [first, last] = fh.iterators(m_dialect.lines_terminated_by.size());
-  const auto on_new_chunk = [this](size_t begin, size_t end) {
     File_import_info info;
     info.file = m_handle_creator();
     info.range_read = true;
-    info.range = std::make_pair(begin, end);
+    info.range = std::make_pair(b, e);
+    info.context = " @ file bytes range [" + std::to_string(b) + ", " +
+                   std::to_string(e) + ")";
     info.is_guard = false;
 
-    m_queue->push(std::move(info));
+    pending = std::move(info);
   };
 
-  if (m_dialect.fields_escaped_by.empty()) {
-    if (m_skip_rows_count > 0) {
-      first = skip_rows(first, last, m_dialect.lines_terminated_by,
-                        m_skip_rows_count);
+  auto current = begin;
+
+  for (std::size_t i = 0; i < probes; ++i) {
+    std::size_t boundary;
+
+    {
+      std::unique_lock lock{mutex};
+      cv.wait(lock, [&]() { return exception || boundaries[i].has_value(); });
+
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+
+      boundary = *boundaries[i];
     }
-    chunk_by_max_bytes(first, last, m_dialect.lines_terminated_by, m_chunk_size,
-                       on_new_chunk);
-  } else {
-    if (m_skip_rows_count > 0) {
-      first = skip_rows(first, last, m_dialect.lines_terminated_by,
-                        m_skip_rows_count, m_dialect.fields_escaped_by[0]);
+
+    // rows longer than the chunk size can span multiple probes
+    if (boundary > current) {
+      on_new_chunk(current, boundary);
+      current = boundary;
     }
-    chunk_by_max_bytes(first, last, m_dialect.lines_terminated_by,
-                       m_dialect.fields_escaped_by[0], m_chunk_size,
-                       on_new_chunk);
   }
+
+  if (current < end) {
+    on_new_chunk(current, end);
+  }
+
+  push_pending(true);
 }
 
 }  // namespace import_table
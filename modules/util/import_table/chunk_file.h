@@ -24,9 +24,11 @@
 #ifndef MODULES_UTIL_IMPORT_TABLE_CHUNK_FILE_H_
 #define MODULES_UTIL_IMPORT_TABLE_CHUNK_FILE_H_
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <condition_variable>
+#include <cstring>
 #include <exception>
 #include <functional>
 #include <memory>
@@ -242,12 +244,79 @@ class File_handler final {
   size_t m_file_size = 0;
 };
 
+/**
+ * Iterator over a file which is mapped into memory. Provides the same
+ * interface as File_iterator.
+ */
+class Mapped_file_iterator final {
+ public:
+  using difference_type = ssize_t;
+  using value_type = uint8_t;
+  using pointer = const uint8_t *;
+  using reference = const uint8_t &;
+  using iterator_category = std::forward_iterator_tag;
+
+  Mapped_file_iterator() = delete;
+
+  Mapped_file_iterator(const uint8_t *begin, const uint8_t *end,
+                       const uint8_t *ptr)
+      : m_begin(begin), m_end(end), m_ptr(ptr) {}
+
+  Mapped_file_iterator(const Mapped_file_iterator &other) = default;
+  Mapped_file_iterator(Mapped_file_iterator &&other) = default;
+
+  Mapped_file_iterator &operator=(const Mapped_file_iterator &other) = default;
+  Mapped_file_iterator &operator=(Mapped_file_iterator &&other) = default;
+
+  ~Mapped_file_iterator() = default;
+
+  bool operator!=(const Mapped_file_iterator &other) const {
+    return !(*this == other);
+  }
+
+  bool operator==(const Mapped_file_iterator &other) const {
+    return m_ptr == other.m_ptr;
+  }
+
+  uint8_t operator*() const { return *m_ptr; }
+
+  Mapped_file_iterator &operator++() {
+    ++m_ptr;
+    return *this;
+  }
+
+  /**
+   * Same as pre-increment, provided for compatibility with File_iterator.
+   */
+  Mapped_file_iterator &operator++(int) { return ++(*this); }
+
+  Mapped_file_iterator &operator--(int) {
+    --m_ptr;
+    return *this;
+  }
+
+  size_t offset() const { return m_ptr - m_begin; }
+
+  void force_offset(size_t start_from_offset) {
+    m_ptr = m_begin + std::min<size_t>(start_from_offset, m_end - m_begin);
+  }
+
+  const uint8_t *ptr() const { return m_ptr; }
+
+ private:
+  const uint8_t *m_begin;
+  const uint8_t *m_end;
+  const uint8_t *m_ptr;
+};
+
 struct File_import_info {
   std::unique_ptr<mysqlshdk::storage::IFile> file;
   bool range_read = false;
   std::pair<size_t, size_t> range{0, 0};
   std::string context;
   bool is_guard = true;
+  // false if there are more ranges of the same file
+  bool last_range = true;
 };
 
 /**
@@ -312,6 +381,11 @@ ForwardIt find(ForwardIt first, ForwardIt last, ForwardIt2 needle_first,
                Find_context<typename ForwardIt::value_type> *context) {
   assert(context);
   for (;; ++first) {
+    if (first == last) {
+      context->needle_found = false;
+      return last;
+    }
+
     context->last_element = *first;
     ForwardIt it = first;
     for (ForwardIt2 needle_it = needle_first;; it++, ++needle_it) {
@@ -332,6 +406,52 @@ ForwardIt find(ForwardIt first, ForwardIt last, ForwardIt2 needle_first,
   }
 }
 
+/**
+ * Overload of the above for the memory-mapped files, the whole range is
+ * accessible, so the first element of the needle is located using memchr().
+ */
+inline Mapped_file_iterator find(Mapped_file_iterator first,
+                                 Mapped_file_iterator last,
+                                 std::string::const_iterator needle_first,
+                                 std::string::const_iterator needle_last,
+                                 Find_context<uint8_t> *context) {
+  assert(context);
+  assert(needle_first != needle_last);
+
+  const auto begin = first.ptr();
+  const auto end = last.ptr();
+  const auto needle = &*needle_first;
+  const auto needle_length =
+      static_cast<std::size_t>(needle_last - needle_first);
+  auto p = begin;
+
+  while (static_cast<std::size_t>(end - p) >= needle_length) {
+    p = static_cast<const uint8_t *>(::memchr(p, *needle, end - p));
+
+    if (!p || static_cast<std::size_t>(end - p) < needle_length) {
+      break;
+    }
+
+    if (0 == ::memcmp(p + 1, needle + 1, needle_length - 1)) {
+      if (p != begin) {
+        context->preceding_element_set = true;
+        context->preceding_element = *(p - 1);
+      }
+
+      context->last_element = *p;
+      context->needle_found = true;
+
+      first.force_offset(first.offset() + (p - begin) + needle_length);
+      return first;
+    }
+
+    ++p;
+  }
+
+  context->needle_found = false;
+  return last;
+}
+
 /**
  * Skip count lines/rows delimited by needle.
  *
@@ -398,6 +518,73 @@ Iter skip_rows(Iter first, Iter last, const std::string &needle,
   return first;
 }
 
+/**
+ * Moves to the end of the current row, the first row terminator which is not
+ * escaped.
+ *
+ * @tparam Iter Forward iterator.
+ * @param first Iterator to first element in range, escape state of the element
+ *              preceding it is unknown.
+ * @param last Iterator to last element in range.
+ * @param needle Line terminator string.
+ * @param escape_char Escape character.
+ * @return Returns iterator to the first element of the next row, or last if
+ * there are no more rows.
+ */
+template <typename Iter>
+Iter skip_to_row_end(Iter first, Iter last, const std::string &needle,
+                     char escape_char) {
+  Find_context<typename Iter::value_type> context{};
+
+  first = find(first, last, needle.begin(), needle.end(), &context);
+
+  // needle found, but is escaped or escape state is unknown
+  auto escaped = [&]() -> bool {
+    return context.needle_found &&
+           ((context.preceding_element_set &&
+             context.preceding_element == escape_char) ||
+            (!context.preceding_element_set));
+  };
+
+  while (escaped()) {
+    context.preceding_element_set = true;
+    context.preceding_element = context.last_element;
+    first = find(first, last, needle.begin(), needle.end(), &context);
+  }
+
+  return first;
+}
+
+/**
+ * Moves to the end of the current row, the first row terminator whose escape
+ * state is known.
+ *
+ * @tparam Iter Forward iterator.
+ * @param first Iterator to first element in range, escape state of the element
+ *              preceding it is unknown.
+ * @param last Iterator to last element in range.
+ * @param needle Line terminator string.
+ * @return Returns iterator to the first element of the next row, or last if
+ * there are no more rows.
+ */
+template <typename Iter>
+Iter skip_to_row_end(Iter first, Iter last, const std::string &needle) {
+  Find_context<typename Iter::value_type> context{};
+
+  first = find(first, last, needle.begin(), needle.end(), &context);
+
+  // needle found, but escape state is unknown
+  auto escaped = [&]() -> bool {
+    return context.needle_found && !context.preceding_element_set;
+  };
+
+  while (escaped()) {
+    first = find(first, last, needle.begin(), needle.end(), &context);
+  }
+
+  return first;
+}
+
 /**
  * Fill QueueContainer with file chunks offset that are roughly
  * max_bytes_per_chunk in size.
@@ -421,23 +608,7 @@ void chunk_by_max_bytes(
     const size_t prev_offset = current_offset;
     const size_t next_offset = current_offset + max_bytes_per_chunk;
     first.force_offset(next_offset);
-    Find_context<typename Iter::value_type> context{};
-
-    first = find(first, last, needle.begin(), needle.end(), &context);
-
-    // needle found, but is escaped or escape state is unknown
-    auto escaped = [&]() -> bool {
-      return context.needle_found &&
-             ((context.preceding_element_set &&
-               context.preceding_element == escape_char) ||
-              (!context.preceding_element_set));
-    };
-
-    while (escaped()) {
-      context.preceding_element_set = true;
-      context.preceding_element = context.last_element;
-      first = find(first, last, needle.begin(), needle.end(), &context);
-    }
+    first = skip_to_row_end(first, last, needle, escape_char);
 
     current_offset = first.offset();
     on_new_chunk(prev_offset, current_offset);
@@ -466,18 +637,7 @@ void chunk_by_max_bytes(
     size_t prev_offset = current_offset;
     const size_t next_offset = current_offset + max_bytes_per_chunk;
     first.force_offset(next_offset);
-    Find_context<typename Iter::value_type> context{};
-
-    first = find(first, last, needle.begin(), needle.end(), &context);
-
-    // needle found, but escape state is unknown
-    auto escaped = [&]() -> bool {
-      return context.needle_found && !context.preceding_element_set;
-    };
-
-    while (escaped()) {
-      first = find(first, last, needle.begin(), needle.end(), &context);
-    }
+    first = skip_to_row_end(first, last, needle);
 
     current_offset = first.offset();
     on_new_chunk(prev_offset, current_offset);
@@ -510,10 +670,43 @@ class Chunk_file final {
     m_queue = queue;
   }
 
+  /**
+   * Number of threads used to find the chunk boundaries.
+   */
+  void set_threads(const std::size_t threads) {
+    m_threads = std::max<std::size_t>(threads, 1);
+  }
+
+  /**
+   * Splits the file into chunks. Local uncompressed files are mapped into
+   * memory, other files are read using the File_handler.
+   *
+   * Boundaries of chunks are found in parallel: file is probed at offsets
+   * spaced evenly every chunk size bytes, each probe moves to the beginning of
+   * the next row. Chunks are pushed to the output queue in order, as soon as
+   * their boundaries are known.
+   */
   void start();
 
  private:
+  /**
+   * Splits the file into chunks.
+   *
+   * @param open Callback which opens the file and calls its argument with a
+   *             pair of iterators to the beginning and the end of the file,
+   *             called once by each thread.
+   */
+  template <typename Open>
+  void chunk(const Open &open);
+
+  template <typename Iter>
+  Iter skip_rows(Iter first, Iter last) const;
+
+  template <typename Iter>
+  Iter skip_to_row_end(Iter first, Iter last) const;
+
   size_t m_chunk_size = 2 * BUFFER_SIZE;
+  std::size_t m_threads = 1;
   Dialect m_dialect;
   uint64_t m_skip_rows_count = 0;
   shcore::Synchronized_queue<File_import_info> *m_queue = nullptr;
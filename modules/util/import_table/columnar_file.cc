@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/columnar_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "modules/util/import_table/columnar_reader.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+namespace {
+
+// minimum number of bytes encoded at once
+constexpr std::size_t k_encoded_block_size = 64 * 1024;
+
+}  // namespace
+
+class Columnar_chunk_file::Impl final {
+ public:
+  Impl(Dialect::Format format, mysqlshdk::storage::IFile *file)
+      : m_reader(Columnar_reader::create(format, file)) {}
+
+  /**
+   * Reads the chunk, returns false if it was already read.
+   */
+  bool load(std::size_t chunk) {
+    if (m_loaded) {
+      return false;
+    }
+
+    m_chunk = m_reader->read_chunk(chunk);
+    m_loaded = true;
+
+    return true;
+  }
+
+  bool has_more_rows() const { return m_row < m_chunk.rows; }
+
+  /**
+   * Encodes the subsequent rows, until at least the given number of bytes is
+   * appended to the output or there are no more rows.
+   */
+  void encode(std::size_t bytes, std::string *out) {
+    const auto limit = out->size() + bytes;
+    const auto &columns = m_chunk.columns;
+
+    while (m_row < m_chunk.rows && out->size() < limit) {
+      for (std::size_t c = 0; c < columns.size(); ++c) {
+        if (c > 0) {
+          out->push_back('\t');
+        }
+
+        columns[c]->next(out);
+      }
+
+      out->push_back('\n');
+      ++m_row;
+    }
+  }
+
+ private:
+  std::unique_ptr<Columnar_reader> m_reader;
+  bool m_loaded = false;
+  Columnar_chunk m_chunk;
+  uint64_t m_row = 0;
+};
+
+Columnar_file_info read_columnar_file_info(Dialect::Format format,
+                                           mysqlshdk::storage::IFile *file) {
+  const auto opened = file->is_open();
+
+  if (!opened) {
+    file->open(mysqlshdk::storage::Mode::READ);
+  }
+
+  shcore::on_leave_scope close_file([file, opened]() {
+    if (!opened && file->is_open()) {
+      file->close();
+    }
+  });
+
+  const auto reader = Columnar_reader::create(format, file);
+  Columnar_file_info info;
+
+  info.columns = reader->columns();
+  info.chunks = reader->chunk_bytes();
+
+  return info;
+}
+
+Columnar_chunk_file::Columnar_chunk_file(
+    Dialect::Format format, std::unique_ptr<mysqlshdk::storage::IFile> file,
+    std::size_t chunk, uint64_t chunk_bytes)
+    : m_format(format),
+      m_file(std::move(file)),
+      m_chunk(chunk),
+      m_chunk_bytes(chunk_bytes) {}
+
+Columnar_chunk_file::~Columnar_chunk_file() = default;
+
+void Columnar_chunk_file::open(mysqlshdk::storage::Mode m) {
+  if (mysqlshdk::storage::Mode::READ != m) {
+    throw std::logic_error("Columnar_chunk_file can only be read");
+  }
+
+  if (!m_file->is_open()) {
+    m_file->open(m);
+  }
+
+  m_impl = std::make_unique<Impl>(m_format, m_file.get());
+  m_data.clear();
+  m_data_offset = 0;
+  m_offset = 0;
+}
+
+bool Columnar_chunk_file::is_open() const { return nullptr != m_impl; }
+
+std::unique_ptr<mysqlshdk::storage::IDirectory> Columnar_chunk_file::parent()
+    const {
+  return m_file->parent();
+}
+
+void Columnar_chunk_file::close() {
+  m_impl.reset();
+
+  if (m_file->is_open()) {
+    m_file->close();
+  }
+
+  m_data.clear();
+  m_data.shrink_to_fit();
+  m_data_offset = 0;
+}
+
+off64_t Columnar_chunk_file::seek(off64_t offset) {
+  if (offset != m_offset) {
+    throw std::logic_error("Columnar_chunk_file::seek() is not supported");
+  }
+
+  return m_offset;
+}
+
+ssize_t Columnar_chunk_file::read(void *buffer, size_t length) {
+  m_latest_io_size = 0;
+
+  if (m_impl->load(m_chunk)) {
+    m_latest_io_size = m_chunk_bytes;
+  }
+
+  if (m_data.size() - m_data_offset < length && m_impl->has_more_rows()) {
+    m_data.erase(0, m_data_offset);
+    m_data_offset = 0;
+    m_impl->encode(std::max(length - m_data.size(), k_encoded_block_size),
+                   &m_data);
+  }
+
+  const auto bytes = std::min(length, m_data.size() - m_data_offset);
+  ::memcpy(buffer, m_data.data() + m_data_offset, bytes);
+  m_data_offset += bytes;
+  m_offset += bytes;
+
+  return static_cast<ssize_t>(bytes);
+}
+
+ssize_t Columnar_chunk_file::write(const void *, size_t) {
+  throw std::logic_error("Columnar_chunk_file::write() is not supported");
+}
+
+void Columnar_chunk_file::rename(const std::string &) {
+  throw std::logic_error("Columnar_chunk_file::rename() is not supported");
+}
+
+void Columnar_chunk_file::remove() {
+  throw std::logic_error("Columnar_chunk_file::remove() is not supported");
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
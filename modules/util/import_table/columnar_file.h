@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_IMPORT_TABLE_COLUMNAR_FILE_H_
+#define MODULES_UTIL_IMPORT_TABLE_COLUMNAR_FILE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "modules/util/import_table/dialect.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+/**
+ * Metadata of a file in a columnar format.
+ */
+struct Columnar_file_info {
+  // names of the columns, in the same order as they are written
+  std::vector<std::string> columns;
+  // number of file bytes holding each chunk (Parquet row group or Arrow record
+  // batch), these sum up to the size of the file
+  std::vector<uint64_t> chunks;
+};
+
+/**
+ * Reads the metadata of a file in a columnar format.
+ *
+ * @param format Format of the file.
+ * @param file File to be read.
+ *
+ * @returns metadata of the file
+ *
+ * @throws std::runtime_error if file cannot be read, or has columns of types
+ *         which are not supported
+ */
+Columnar_file_info read_columnar_file_info(Dialect::Format format,
+                                           mysqlshdk::storage::IFile *file);
+
+/**
+ * Provides rows of a single chunk of a file in a columnar format, encoded using
+ * the default dialect (tab-separated, backslash-escaped, LF line endings,
+ * NULL values written as \N). Rows are encoded as the data is being read.
+ */
+class Columnar_chunk_file final : public mysqlshdk::storage::IFile {
+ public:
+  Columnar_chunk_file() = delete;
+
+  /**
+   * Creates a file which provides the rows of the given chunk.
+   *
+   * @param format Format of the file.
+   * @param file File in a columnar format.
+   * @param chunk Index of the chunk.
+   * @param chunk_bytes Number of file bytes holding the chunk.
+   */
+  Columnar_chunk_file(Dialect::Format format,
+                      std::unique_ptr<mysqlshdk::storage::IFile> file,
+                      std::size_t chunk, uint64_t chunk_bytes);
+
+  Columnar_chunk_file(const Columnar_chunk_file &) = delete;
+  Columnar_chunk_file(Columnar_chunk_file &&) = delete;
+
+  Columnar_chunk_file &operator=(const Columnar_chunk_file &) = delete;
+  Columnar_chunk_file &operator=(Columnar_chunk_file &&) = delete;
+
+  ~Columnar_chunk_file() override;
+
+  void open(mysqlshdk::storage::Mode m) override;
+
+  bool is_open() const override;
+
+  int error() const override { return 0; }
+
+  void close() override;
+
+  /**
+   * Number of file bytes holding the chunk.
+   */
+  size_t file_size() const override { return m_chunk_bytes; }
+
+  mysqlshdk::Masked_string full_path() const override {
+    return m_file->full_path();
+  }
+
+  std::string filename() const override { return m_file->filename(); }
+
+  bool exists() const override { return m_file->exists(); }
+
+  std::unique_ptr<mysqlshdk::storage::IDirectory> parent() const override;
+
+  /**
+   * @throws std::logic_error Encoded data can only be read sequentially.
+   */
+  off64_t seek(off64_t offset) override;
+
+  off64_t tell() const override { return m_offset; }
+
+  ssize_t read(void *buffer, size_t length) override;
+
+  ssize_t write(const void *buffer, size_t length) override;
+
+  bool flush() override { return false; }
+
+  bool is_local() const override { return m_file->is_local(); }
+
+  void rename(const std::string &new_name) override;
+
+  void remove() override;
+
+  /**
+   * Number of file bytes read by the latest call to read().
+   */
+  std::size_t latest_io_size() const { return m_latest_io_size; }
+
+ private:
+  class Impl;
+
+  Dialect::Format m_format;
+  std::unique_ptr<mysqlshdk::storage::IFile> m_file;
+  std::size_t m_chunk;
+  uint64_t m_chunk_bytes;
+
+  std::unique_ptr<Impl> m_impl;
+
+  // encoded rows, the ones before m_data_offset were already read
+  std::string m_data;
+  std::size_t m_data_offset = 0;
+  // number of encoded bytes read so far
+  off64_t m_offset = 0;
+  std::size_t m_latest_io_size = 0;
+};
+
+}  // namespace import_table
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_IMPORT_TABLE_COLUMNAR_FILE_H_
@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/columnar_reader.h"
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+#include "modules/util/import_table/arrow_ipc_reader.h"
+#include "modules/util/import_table/parquet_reader.h"
+#include "mysqlshdk/libs/utils/dtoa.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+namespace {
+
+template <typename T>
+void append_number(T value, std::string *out) {
+  char buffer[24];
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  out->append(buffer, result.ptr);
+}
+
+void append_padded(int64_t value, int width, std::string *out) {
+  char buffer[24];
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  const auto length = result.ptr - buffer;
+
+  if (length < width) {
+    out->append(width - length, '0');
+  }
+
+  out->append(buffer, result.ptr);
+}
+
+inline int64_t floor_div(int64_t value, int64_t divisor) {
+  const auto result = value / divisor;
+  return result * divisor > value ? result - 1 : result;
+}
+
+/**
+ * Appends YYYY-MM-DD, days are counted since the UNIX epoch.
+ */
+void append_date(int64_t days, std::string *out) {
+  // civil_from_days() by Howard Hinnant
+  days += 719468;
+  const auto era = floor_div(days, 146097);
+  const auto doe = days - era * 146097;
+  const auto yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const auto doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const auto mp = (5 * doy + 2) / 153;
+  const auto day = doy - (153 * mp + 2) / 5 + 1;
+  const auto month = mp < 10 ? mp + 3 : mp - 9;
+  const auto year = yoe + era * 400 + (month <= 2 ? 1 : 0);
+
+  append_padded(year, 4, out);
+  out->push_back('-');
+  append_padded(month, 2, out);
+  out->push_back('-');
+  append_padded(day, 2, out);
+}
+
+/**
+ * Appends HH:MM:SS[.ffffff], given the number of units since midnight.
+ */
+void append_time(int64_t value, int64_t units_per_second, std::string *out) {
+  const auto seconds = floor_div(value, units_per_second);
+  const auto fraction = value - seconds * units_per_second;
+
+  append_padded(seconds / 3600, 2, out);
+  out->push_back(':');
+  append_padded(seconds / 60 % 60, 2, out);
+  out->push_back(':');
+  append_padded(seconds % 60, 2, out);
+
+  if (units_per_second > 1) {
+    // MySQL supports up to microseconds
+    const auto micros = units_per_second > 1000000
+                            ? fraction / (units_per_second / 1000000)
+                            : fraction * (1000000 / units_per_second);
+    out->push_back('.');
+    append_padded(micros, 6, out);
+  }
+}
+
+void append_timestamp(int64_t value, int64_t units_per_second, bool utc,
+                      std::string *out) {
+  const auto units_per_day = units_per_second * 86400;
+  const auto days = floor_div(value, units_per_day);
+
+  append_date(days, out);
+  out->push_back(' ');
+  append_time(value - days * units_per_day, units_per_second, out);
+
+  if (utc) {
+    out->append("+00:00");
+  }
+}
+
+/**
+ * Appends the decimal number, given its digits (without leading zeros).
+ */
+void append_scaled(bool negative, std::string_view digits, int32_t scale,
+                   std::string *out) {
+  if (digits.empty()) {
+    digits = "0";
+    negative = false;
+  }
+
+  if (negative) {
+    out->push_back('-');
+  }
+
+  if (scale <= 0) {
+    out->append(digits);
+
+    if (scale < 0 && digits != "0") {
+      out->append(-scale, '0');
+    }
+
+    return;
+  }
+
+  const auto length = static_cast<int64_t>(digits.length());
+
+  if (length <= scale) {
+    out->append("0.");
+    out->append(scale - length, '0');
+    out->append(digits);
+  } else {
+    out->append(digits.substr(0, length - scale));
+    out->push_back('.');
+    out->append(digits.substr(length - scale));
+  }
+}
+
+void append_decimal(int64_t value, int32_t scale, std::string *out) {
+  const auto negative = value < 0;
+  // avoids overflow when negating the minimum value
+  auto magnitude = static_cast<uint64_t>(value);
+
+  if (negative) {
+    magnitude = 0 - magnitude;
+  }
+
+  char buffer[24];
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), magnitude);
+
+  append_scaled(negative, std::string_view(buffer, result.ptr - buffer), scale,
+                out);
+}
+
+/**
+ * Appends a decimal number stored as big-endian two's complement.
+ */
+void append_decimal(std::string_view value, int32_t scale, std::string *out) {
+  std::string magnitude{value};
+  const auto negative =
+      !magnitude.empty() && (static_cast<uint8_t>(magnitude[0]) & 0x80);
+
+  if (negative) {
+    // two's complement: invert and add one
+    bool carry = true;
+
+    for (auto it = magnitude.rbegin(); it != magnitude.rend(); ++it) {
+      auto byte = static_cast<uint8_t>(~static_cast<uint8_t>(*it));
+
+      if (carry) {
+        ++byte;
+        carry = 0 == byte;
+      }
+
+      *it = static_cast<char>(byte);
+    }
+  }
+
+  // repeatedly divide by 10^9, collecting the remainders
+  constexpr uint32_t k_base = 1000000000;
+  std::vector<uint32_t> groups;
+  std::size_t first = 0;
+
+  while (first < magnitude.size()) {
+    uint64_t remainder = 0;
+
+    for (std::size_t i = first; i < magnitude.size(); ++i) {
+      const auto current =
+          (remainder << 8) | static_cast<uint8_t>(magnitude[i]);
+      magnitude[i] = static_cast<char>(current / k_base);
+      remainder = current % k_base;
+    }
+
+    groups.emplace_back(static_cast<uint32_t>(remainder));
+
+    while (first < magnitude.size() && 0 == magnitude[first]) {
+      ++first;
+    }
+  }
+
+  while (!groups.empty() && 0 == groups.back()) {
+    groups.pop_back();
+  }
+
+  std::string digits;
+
+  for (auto it = groups.rbegin(); it != groups.rend(); ++it) {
+    if (digits.empty()) {
+      append_number(*it, &digits);
+    } else {
+      append_padded(*it, 9, &digits);
+    }
+  }
+
+  append_scaled(negative, digits, scale, out);
+}
+
+void append_escaped(std::string_view value, std::string *out) {
+  for (const auto c : value) {
+    switch (c) {
+      case '\\':
+        out->append("\\\\");
+        break;
+
+      case '\t':
+        out->append("\\t");
+        break;
+
+      case '\n':
+        out->append("\\n");
+        break;
+
+      case '\0':
+        out->append("\\0");
+        break;
+
+      default:
+        out->push_back(c);
+        break;
+    }
+  }
+}
+
+}  // namespace
+
+namespace encode {
+
+void null(std::string *out) { out->append("\\N"); }
+
+void boolean(bool value, std::string *out) {
+  out->push_back(value ? '1' : '0');
+}
+
+void integer(const Column_type &type, int64_t value, std::string *out) {
+  switch (type.kind) {
+    case Column_type::Kind::UNSIGNED:
+      append_number(static_cast<uint64_t>(value), out);
+      break;
+
+    case Column_type::Kind::DECIMAL:
+      append_decimal(value, type.scale, out);
+      break;
+
+    case Column_type::Kind::DATE:
+      append_date(value, out);
+      break;
+
+    case Column_type::Kind::TIME:
+      append_time(value, type.units_per_second, out);
+      break;
+
+    case Column_type::Kind::TIMESTAMP:
+      append_timestamp(value, type.units_per_second, type.utc, out);
+      break;
+
+    default:
+      append_number(value, out);
+      break;
+  }
+}
+
+void floating(float value, std::string *out) {
+  out->append(shcore::ftoa(value));
+}
+
+void floating(double value, std::string *out) {
+  out->append(shcore::dtoa(value));
+}
+
+void bytes(const Column_type &type, std::string_view value, std::string *out) {
+  if (Column_type::Kind::DECIMAL == type.kind) {
+    append_decimal(value, type.scale, out);
+  } else {
+    append_escaped(value, out);
+  }
+}
+
+}  // namespace encode
+
+std::unique_ptr<Columnar_reader> Columnar_reader::create(
+    Dialect::Format format, mysqlshdk::storage::IFile *file) {
+  switch (format) {
+    case Dialect::Format::PARQUET:
+      return std::make_unique<Parquet_reader>(file);
+
+    case Dialect::Format::ARROW:
+      return std::make_unique<Arrow_ipc_reader>(file);
+
+    case Dialect::Format::TEXT:
+      break;
+  }
+
+  throw std::logic_error("Columnar_reader::create(): unsupported format");
+}
+
+void Columnar_reader::throw_error(const mysqlshdk::storage::IFile &file,
+                                  const std::string &error) {
+  throw std::runtime_error("Failed to read '" + file.full_path().masked() +
+                           "': " + error);
+}
+
+std::string Columnar_reader::read_range(mysqlshdk::storage::IFile *file,
+                                        uint64_t offset, uint64_t length) {
+  std::string result;
+  result.resize(length);
+
+  file->seek(offset);
+
+  std::size_t total = 0;
+
+  while (total < length) {
+    const auto bytes = file->read(&result[total], length - total);
+
+    if (bytes < 0) {
+      throw std::runtime_error("read error: " + std::to_string(file->error()));
+    }
+
+    if (0 == bytes) {
+      throw std::runtime_error("unexpected end of file");
+    }
+
+    total += bytes;
+  }
+
+  return result;
+}
+
+void Columnar_reader::distribute_bytes(uint64_t file_size,
+                                       std::vector<uint64_t> *chunk_bytes) {
+  if (chunk_bytes->empty()) {
+    return;
+  }
+
+  uint64_t total = 0;
+
+  for (const auto bytes : *chunk_bytes) {
+    total += bytes;
+  }
+
+  // headers and footers are assigned to the last chunk
+  if (total < file_size) {
+    chunk_bytes->back() += file_size - total;
+  } else if (total > file_size) {
+    // metadata is corrupted, this will fail when chunks are read
+    chunk_bytes->back() -= std::min(chunk_bytes->back(), total - file_size);
+  }
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
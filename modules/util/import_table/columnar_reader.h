@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_IMPORT_TABLE_COLUMNAR_READER_H_
+#define MODULES_UTIL_IMPORT_TABLE_COLUMNAR_READER_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "modules/util/import_table/dialect.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+/**
+ * Type of the values stored in a column, determines how they are converted to
+ * text.
+ */
+struct Column_type {
+  enum class Kind {
+    // all values are NULL
+    NONE,
+    BOOLEAN,
+    SIGNED,
+    UNSIGNED,
+    FLOAT,
+    DOUBLE,
+    BYTES,
+    // integers or big-endian two's complement numbers, scaled
+    DECIMAL,
+    // days since the UNIX epoch
+    DATE,
+    // units since midnight
+    TIME,
+    // units since the UNIX epoch
+    TIMESTAMP,
+  };
+
+  Kind kind = Kind::BYTES;
+  int32_t scale = 0;
+  int64_t units_per_second = 1;
+  // timestamp is normalized to UTC, written with an explicit time zone
+  bool utc = false;
+};
+
+/**
+ * Appends values to the output, encoded using the default dialect.
+ */
+namespace encode {
+
+void null(std::string *out);
+
+void boolean(bool value, std::string *out);
+
+/**
+ * Appends an integer value of one of the integer, decimal or temporal types.
+ */
+void integer(const Column_type &type, int64_t value, std::string *out);
+
+void floating(float value, std::string *out);
+
+void floating(double value, std::string *out);
+
+/**
+ * Appends a binary value, decimal values hold big-endian two's complement
+ * numbers.
+ */
+void bytes(const Column_type &type, std::string_view value, std::string *out);
+
+}  // namespace encode
+
+/**
+ * Text representation of a sequence of values, encoded using the default
+ * dialect.
+ */
+class Encoded_values final {
+ public:
+  void clear() {
+    m_data.clear();
+    m_ends.clear();
+  }
+
+  std::size_t size() const { return m_ends.size(); }
+
+  /**
+   * Output for the current value.
+   */
+  std::string *data() { return &m_data; }
+
+  /**
+   * Marks the end of the current value.
+   */
+  void finish() { m_ends.emplace_back(m_data.size()); }
+
+  /**
+   * Appends the value with the given index to the output.
+   */
+  void append(std::size_t index, std::string *out) const {
+    const auto begin = 0 == index ? 0 : m_ends[index - 1];
+    out->append(m_data, begin, m_ends[index] - begin);
+  }
+
+ private:
+  std::string m_data;
+  std::vector<std::size_t> m_ends;
+};
+
+/**
+ * Provides the values of a single column of a chunk.
+ */
+class Column_cursor {
+ public:
+  Column_cursor() = default;
+
+  Column_cursor(const Column_cursor &) = delete;
+  Column_cursor(Column_cursor &&) = delete;
+
+  Column_cursor &operator=(const Column_cursor &) = delete;
+  Column_cursor &operator=(Column_cursor &&) = delete;
+
+  virtual ~Column_cursor() = default;
+
+  /**
+   * Appends the next value to the output, encoded using the default dialect.
+   */
+  virtual void next(std::string *out) = 0;
+};
+
+/**
+ * A chunk of a file in a columnar format (Parquet row group or Arrow record
+ * batch).
+ */
+struct Columnar_chunk {
+  uint64_t rows = 0;
+  std::vector<std::unique_ptr<Column_cursor>> columns;
+};
+
+/**
+ * Reads files in a columnar format.
+ */
+class Columnar_reader {
+ public:
+  Columnar_reader() = default;
+
+  Columnar_reader(const Columnar_reader &) = delete;
+  Columnar_reader(Columnar_reader &&) = delete;
+
+  Columnar_reader &operator=(const Columnar_reader &) = delete;
+  Columnar_reader &operator=(Columnar_reader &&) = delete;
+
+  virtual ~Columnar_reader() = default;
+
+  /**
+   * Creates a reader of the given format, reads the metadata of the file.
+   *
+   * @param format Format of the file.
+   * @param file An open file, needs to outlive the reader.
+   *
+   * @throws std::runtime_error if file is not valid or has columns of types
+   *         which are not supported
+   */
+  static std::unique_ptr<Columnar_reader> create(
+      Dialect::Format format, mysqlshdk::storage::IFile *file);
+
+  /**
+   * Names of the columns.
+   */
+  virtual const std::vector<std::string> &columns() const = 0;
+
+  /**
+   * Number of file bytes holding each chunk, these sum up to the size of the
+   * file.
+   */
+  virtual const std::vector<uint64_t> &chunk_bytes() const = 0;
+
+  /**
+   * Reads the given chunk.
+   */
+  virtual Columnar_chunk read_chunk(std::size_t chunk) = 0;
+
+ protected:
+  /**
+   * Throws an exception which includes the path to the file.
+   */
+  [[noreturn]] static void throw_error(const mysqlshdk::storage::IFile &file,
+                                       const std::string &error);
+
+  /**
+   * Reads the given range of the file.
+   *
+   * @throws std::runtime_error if range cannot be read
+   */
+  static std::string read_range(mysqlshdk::storage::IFile *file,
+                                uint64_t offset, uint64_t length);
+
+  /**
+   * Distributes the bytes which are not a part of any chunk (headers, footers)
+   * so that all bytes of the file are assigned to a chunk.
+   */
+  static void distribute_bytes(uint64_t file_size,
+                               std::vector<uint64_t> *chunk_bytes);
+};
+
+}  // namespace import_table
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_IMPORT_TABLE_COLUMNAR_READER_H_
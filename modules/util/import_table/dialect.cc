@@ -65,15 +65,20 @@ void Dialect::set_dialect(const std::string & /*option*/,
       *this = json();
     } else if (shcore::str_caseeq(name, "csv-unix")) {
       *this = csv_unix();
+    } else if (shcore::str_caseeq(name, "parquet")) {
+      *this = parquet();
+    } else if (shcore::str_caseeq(name, "arrow")) {
+      *this = arrow();
     } else {
       throw shcore::Exception::argument_error(
-          "dialect value must be default, csv, tsv, json or csv-unix.");
+          "dialect value must be default, csv, tsv, json, csv-unix, parquet or "
+          "arrow.");
     }
   }
 }
 
 bool Dialect::operator==(const Dialect &d) const {
-  return lines_terminated_by == d.lines_terminated_by &&
+  return format == d.format && lines_terminated_by == d.lines_terminated_by &&
          fields_escaped_by == d.fields_escaped_by &&
          fields_terminated_by == d.fields_terminated_by &&
          fields_enclosed_by == d.fields_enclosed_by &&
@@ -163,6 +168,18 @@ Dialect Dialect::csv_unix() {
   return dialect;
 }
 
+Dialect Dialect::parquet() {
+  Dialect dialect;
+  dialect.format = Format::PARQUET;
+  return dialect;
+}
+
+Dialect Dialect::arrow() {
+  Dialect dialect;
+  dialect.format = Format::ARROW;
+  return dialect;
+}
+
 std::string Dialect::build_sql() const {
   using sqlstring = shcore::sqlstring;
   std::string sql =
@@ -182,6 +199,18 @@ std::string Dialect::build_sql() const {
 }
 
 void Dialect::on_unpacked_options() {
+  if (is_columnar()) {
+    Dialect expected;
+    expected.format = format;
+
+    if (!(*this == expected)) {
+      throw std::invalid_argument(
+          "The fieldsTerminatedBy, fieldsEnclosedBy, fieldsOptionallyEnclosed, "
+          "fieldsEscapedBy and linesTerminatedBy options cannot be used with "
+          "the parquet and arrow dialects.");
+    }
+  }
+
   validate();
 
   // TODO(pawel): values provided by the user should not be altered, instead
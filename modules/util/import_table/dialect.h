@@ -41,8 +41,16 @@ namespace import_table {
  * Store field- and line-handling options for LOAD DATA INFILE
  */
 struct Dialect {
+  /**
+   * Format of the input files. Text files are described by the options below,
+   * rows of files in a columnar format are converted into the default dialect.
+   */
+  enum class Format { TEXT, PARQUET, ARROW };
+
   static const shcore::Option_pack_def<Dialect> &options();
 
+  Format format = Format::TEXT;
+
   std::string lines_terminated_by{"\n"};   // string
   std::string fields_escaped_by{"\\"};     // char
   std::string fields_terminated_by{"\t"};  // string
@@ -90,6 +98,23 @@ struct Dialect {
    */
   static Dialect csv_unix();
 
+  /**
+   * Returns dialect for LOAD DATA FILE that describes Apache Parquet files,
+   * these are converted into the default dialect.
+   */
+  static Dialect parquet();
+
+  /**
+   * Returns dialect for LOAD DATA FILE that describes Apache Arrow IPC files,
+   * these are converted into the default dialect.
+   */
+  static Dialect arrow();
+
+  /**
+   * Whether input files are in a columnar format.
+   */
+  bool is_columnar() const { return Format::TEXT != format; }
+
  private:
   void on_unpacked_options();
   /**
@@ -27,31 +27,103 @@
 #include <array>
 #include <cstring>
 #include <limits>
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
+#include "modules/util/dump/compatibility.h"
 #include "modules/util/dump/console_with_progress.h"
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/storage/backend/in_memory/allocated_file.h"
 #include "mysqlshdk/libs/storage/backend/in_memory/allocator.h"
 #include "mysqlshdk/libs/storage/backend/in_memory/threaded_file.h"
 #include "mysqlshdk/libs/storage/backend/in_memory/virtual_file_adapter.h"
+#include "mysqlshdk/libs/storage/backend/stdin_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/natural_compare.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
 
 #include "modules/util/import_table/chunk_file.h"
+#include "modules/util/import_table/columnar_file.h"
 #include "modules/util/import_table/load_data.h"
 #include "modules/util/import_table/scanner.h"
 
 namespace mysqlsh {
 namespace import_table {
 
+namespace {
+
+std::string index_name(const std::string &definition) {
+  mysqlshdk::utils::SQL_iterator it(definition, 0, false);
+
+  while (it.valid()) {
+    const auto token = it.next_token();
+
+    if (!token.empty() && '`' == token[0]) {
+      return std::string{token};
+    }
+  }
+
+  throw std::logic_error("Could not find the name of the index: " +
+                         definition);
+}
+
+std::vector<std::string> recreate_indexes_statements(
+    const std::string &table,
+    const compatibility::Deferred_statements::Index_info &indexes) {
+  const auto append = [&table](const std::string &definition,
+                              std::string *batch) {
+    *batch += batch->empty() ? "ALTER TABLE " + table + " " : ",";
+    *batch += "ADD ";
+    *batch += definition;
+  };
+
+  std::string first_batch;
+
+  for (const auto &definition : indexes.regular) {
+    append(definition, &first_batch);
+  }
+
+  for (const auto &definition : indexes.spatial) {
+    append(definition, &first_batch);
+  }
+
+  // fulltext indexes need to be added one at a time
+  auto fulltext = indexes.fulltext.begin();
+
+  if (indexes.fulltext.end() != fulltext) {
+    append(*fulltext++, &first_batch);
+  }
+
+  std::vector<std::string> batches;
+
+  if (!first_batch.empty()) {
+    batches.emplace_back(std::move(first_batch));
+  }
+
+  for (; indexes.fulltext.end() != fulltext; ++fulltext) {
+    append(*fulltext, &batches.emplace_back());
+  }
+
+  return batches;
+}
+
+}  // namespace
+
 Import_table::Import_table(const Import_table_options &options)
-    : m_opt(options),
+    : m_prog_sent_bytes(options.threads_size()),
+      m_prog_file_bytes(options.threads_size()),
+      m_opt(options),
       m_interrupt(nullptr),
       m_progress_thread("Import table", options.show_progress()) {
   m_thread_exception.resize(options.threads_size(), nullptr);
@@ -93,7 +165,7 @@ void Import_table::progress_setup() {
   dump::Progress_thread::Throughput_config config;
 
   config.space_before_item = false;
-  config.current = [this]() -> uint64_t { return m_prog_file_bytes; };
+  config.current = [this]() -> uint64_t { return m_prog_file_bytes.load(); };
   config.total = [this]() {
     return m_prog_total_file_bytes.value_or(m_total_file_size);
   };
@@ -139,31 +211,75 @@ void Import_table::progress_shutdown() {
 void Import_table::spawn_workers() {
   const int64_t num_workers = m_opt.threads_size();
   for (int64_t i = 0; i < num_workers; i++) {
-    Load_data_worker worker(m_opt, i, &m_prog_sent_bytes, &m_prog_file_bytes,
-                            m_interrupt, &m_range_queue, &m_thread_exception,
-                            &m_stats);
+    Load_data_worker worker(m_opt, i, m_prog_sent_bytes.slot(i),
+                            m_prog_file_bytes.slot(i), m_interrupt,
+                            &m_range_queue, &m_thread_exception, &m_stats);
     std::thread t = mysqlsh::spawn_scoped_thread(&Load_data_worker::operator(),
                                                  std::move(worker));
     m_threads.emplace_back(std::move(t));
   }
 }
 
-void Import_table::chunk_file() {
+void Import_table::chunk_file(const std::string &path) {
   Chunk_file chunk;
   chunk.set_chunk_size(m_opt.bytes_per_chunk());
   chunk.set_handle_creator(
-      [this]() { return m_opt.create_file_handle(m_opt.single_file()); });
+      [this, &path]() { return m_opt.create_file_handle(path); });
   chunk.set_dialect(m_opt.dialect());
   chunk.set_rows_to_skip(m_opt.skip_rows_count());
   chunk.set_output_queue(&m_range_queue);
+  chunk.set_threads(m_opt.threads_size());
   chunk.start();
-
-  m_range_queue.shutdown(m_opt.threads_size());
 }
 
 void Import_table::build_queue() {
   m_total_file_size = 0;
 
+  struct Queued_file {
+    std::unique_ptr<mysqlshdk::storage::IFile> file;
+    std::size_t size;
+    bool chunked;
+    // sizes of chunks of a file in a columnar format
+    std::vector<uint64_t> columnar_chunks;
+  };
+
+  std::vector<Queued_file> files;
+  const auto chunk_size = m_opt.bytes_per_chunk();
+  const auto &dialect = m_opt.dialect();
+  const auto add_file = [&, this](
+                            std::unique_ptr<mysqlshdk::storage::IFile> file,
+                            std::size_t size) {
+    if (dialect.is_columnar()) {
+      // each chunk (row group, record batch) is loaded separately, rows are
+      // encoded, so the amount of data sent differs from the size of the file
+      auto chunks = read_columnar_file_info(dialect.format, file.get()).chunks;
+
+      if (chunks.empty()) {
+        log_info("File %s does not contain any rows, skipping",
+                 file->full_path().masked().c_str());
+        return;
+      }
+
+      m_total_file_size += size;
+      m_has_compressed_files = true;
+
+      files.emplace_back(
+          Queued_file{std::move(file), size, false, std::move(chunks)});
+      return;
+    }
+
+    m_total_file_size += size;
+    m_has_compressed_files |= file->is_compressed();
+
+    // big local files which are not compressed are split into ranges, just
+    // like a single file would be
+    const auto chunked = m_opt.dialect_supports_chunking() &&
+                         size > chunk_size && file->is_local() &&
+                         !file->is_compressed();
+
+    files.emplace_back(Queued_file{std::move(file), size, chunked, {}});
+  };
+
   for (const auto &glob_item : m_opt.filelist_from_user()) {
     if (glob_item.find('*') != std::string::npos ||
         glob_item.find('?') != std::string::npos) {
@@ -181,31 +297,79 @@ void Import_table::build_queue() {
           dir->filter_files_sorted(shcore::path::basename(glob_item));
 
       for (const auto &file_info : list_files) {
+        add_file(m_opt.create_file_handle(dir->file(file_info.name())),
+                 file_info.size());
+      }
+    } else {
+      auto file = m_opt.create_file_handle(glob_item);
+
+      if (!file->exists()) {
+        std::string errmsg{"File " + file->full_path().masked() +
+                           " does not exist."};
+        current_console()->print_error(errmsg);
+        noncritical_errors.emplace_back(std::move(errmsg));
+        continue;
+      }
+
+      const auto size = file->file_size();
+      add_file(std::move(file), size);
+    }
+  }
+
+  // Biggest units of work are scheduled first, so that the small files keep
+  // all the threads busy till the end, instead of a single thread loading a
+  // big file after all other threads are done. Files which cannot be chunked
+  // are a single unit of work, ranges of chunked files are at most
+  // bytesPerChunk big.
+  const auto work_size = [chunk_size](const Queued_file &f) -> std::size_t {
+    if (!f.columnar_chunks.empty()) {
+      return *std::max_element(f.columnar_chunks.begin(),
+                               f.columnar_chunks.end());
+    }
+
+    return f.chunked ? chunk_size : f.size;
+  };
+
+  std::stable_sort(files.begin(), files.end(),
+                   [&work_size](const Queued_file &l, const Queued_file &r) {
+                     const auto lsize = work_size(l);
+                     const auto rsize = work_size(r);
+                     return lsize == rsize ? l.size > r.size : lsize > rsize;
+                   });
+
+  for (auto &f : files) {
+    if (interrupted()) {
+      break;
+    }
+
+    if (f.chunked) {
+      log_debug("Chunking file %s", f.file->full_path().masked().c_str());
+      chunk_file(f.file->full_path().real());
+    } else if (dialect.is_columnar()) {
+      const auto path = f.file->full_path().real();
+      const auto chunks = f.columnar_chunks.size();
+      const auto chunk_name = Dialect::Format::PARQUET == dialect.format
+                                  ? " @ row group "
+                                  : " @ record batch ";
+
+      for (std::size_t i = 0; i < chunks; ++i) {
         File_import_info task;
-        task.file = m_opt.create_file_handle(dir->file(file_info.name()));
+        task.file = std::make_unique<Columnar_chunk_file>(
+            dialect.format, m_opt.create_file_handle(path), i,
+            f.columnar_chunks[i]);
         task.range_read = false;
+        task.context = chunk_name + std::to_string(i);
         task.is_guard = false;
+        task.last_range = i + 1 == chunks;
 
-        m_total_file_size += file_info.size();
-        m_has_compressed_files |= task.file->is_compressed();
         m_range_queue.push(std::move(task));
       }
     } else {
       File_import_info task;
-      task.file = m_opt.create_file_handle(glob_item);
+      task.file = std::move(f.file);
       task.range_read = false;
       task.is_guard = false;
 
-      if (!task.file->exists()) {
-        std::string errmsg{"File " + task.file->full_path().masked() +
-                           " does not exist."};
-        current_console()->print_error(errmsg);
-        noncritical_errors.emplace_back(std::move(errmsg));
-        continue;
-      }
-
-      m_total_file_size += task.file->file_size();
-      m_has_compressed_files |= task.file->is_compressed();
       m_range_queue.push(std::move(task));
     }
   }
@@ -214,6 +378,23 @@ void Import_table::build_queue() {
 }
 
 void Import_table::import() {
+  drop_deferred_indexes();
+
+  try {
+    load_files();
+  } catch (...) {
+    recreate_deferred_indexes_after_error();
+    throw;
+  }
+
+  if (any_exception()) {
+    recreate_deferred_indexes_after_error();
+  } else {
+    recreate_deferred_indexes();
+  }
+}
+
+void Import_table::load_files() {
   progress_setup();
   shcore::on_leave_scope cleanup_progress([this]() { progress_shutdown(); });
   spawn_workers();
@@ -234,6 +415,129 @@ void Import_table::import() {
   join_workers();
 }
 
+std::shared_ptr<mysqlshdk::db::mysql::Session> Import_table::connect() const {
+  auto connection_options = m_opt.connection_options();
+  // this session does not load any data
+  connection_options.remove(mysqlshdk::db::kLocalInfile);
+
+  auto session = mysqlshdk::db::mysql::Session::create();
+  session->connect(connection_options);
+
+  return session;
+}
+
+std::string Import_table::quoted_table() const {
+  return shcore::quote_identifier(m_opt.schema()) + "." +
+         shcore::quote_identifier(m_opt.table());
+}
+
+void Import_table::drop_deferred_indexes() {
+  using Defer_index_mode = Import_table_options::Defer_index_mode;
+
+  const auto mode = m_opt.defer_table_indexes();
+
+  if (Defer_index_mode::OFF == mode) {
+    return;
+  }
+
+  const auto session = connect();
+  const auto table = quoted_table();
+  auto deferred = compatibility::check_create_table_for_indexes(
+      session->query("SHOW CREATE TABLE " + table)
+          ->fetch_one_or_throw()
+          ->get_string(1),
+      table, Defer_index_mode::FULLTEXT == mode);
+  auto &regular = deferred.index_info.regular;
+
+  if (!deferred.foreign_keys.empty()) {
+    // indexes may be required by the foreign keys
+    regular.clear();
+  } else {
+    // unique indexes are used to detect the duplicate rows
+    regular.erase(std::remove_if(regular.begin(), regular.end(),
+                                 [](const std::string &definition) {
+                                   return shcore::str_ibeginswith(definition,
+                                                                  "UNIQUE");
+                                 }),
+                  regular.end());
+  }
+
+  if (deferred.index_info.empty()) {
+    log_info("Table %s does not have any indexes which can be deferred",
+             table.c_str());
+    return;
+  }
+
+  std::string query;
+
+  for (const auto *indexes :
+       {&deferred.index_info.regular, &deferred.index_info.spatial,
+        &deferred.index_info.fulltext}) {
+    for (const auto &definition : *indexes) {
+      query += query.empty() ? "ALTER TABLE " + table + " " : ",";
+      query += "DROP INDEX " + index_name(definition);
+    }
+  }
+
+  current_console()->print_info(shcore::str_format(
+      "Dropping %zu secondary indexes of table %s, they will be recreated "
+      "after the import.",
+      deferred.index_info.size(), table.c_str()));
+  log_info("Executing: %s", query.c_str());
+
+  session->execute(query);
+
+  m_deferred_indexes = recreate_indexes_statements(table, deferred.index_info);
+}
+
+void Import_table::recreate_deferred_indexes() {
+  if (m_deferred_indexes.empty()) {
+    return;
+  }
+
+  const auto console = current_console();
+
+  console->print_info("Recreating indexes of table " + quoted_table());
+
+  const auto session = connect();
+  mysqlshdk::utils::Duration duration;
+  duration.start();
+
+  while (!m_deferred_indexes.empty()) {
+    const auto &query = m_deferred_indexes.front();
+
+    log_info("Executing: %s", query.c_str());
+    session->execute(query);
+
+    m_deferred_indexes.erase(m_deferred_indexes.begin());
+  }
+
+  duration.finish();
+
+  console->print_info("Indexes were recreated in " +
+                      mysqlshdk::utils::format_seconds(
+                          duration.seconds_elapsed()));
+}
+
+void Import_table::recreate_deferred_indexes_after_error() noexcept {
+  try {
+    recreate_deferred_indexes();
+  } catch (const std::exception &e) {
+    std::string statements;
+
+    for (const auto &query : m_deferred_indexes) {
+      statements += "\n  " + query + ";";
+    }
+
+    current_console()->print_error(
+        "Failed to recreate the indexes which were dropped before the "
+        "import: " +
+        std::string{e.what()} +
+        ". Use the following statements to recreate them manually:" +
+        statements);
+  }
+}
+
 std::string Import_table::import_summary() const {
   using mysqlshdk::utils::format_bytes;
   using mysqlshdk::utils::format_seconds;
@@ -288,10 +592,11 @@ void Import_table::scan_file() {
   using mysqlshdk::storage::in_memory::Threaded_file_config;
   using mysqlshdk::storage::in_memory::Virtual_file_adapter;
 
-  // if file is big enough, we fetch it in 1MB chunks
+  // if file is big enough (or size is unknown), we fetch it in 1MB chunks
   static constexpr std::size_t k_one_mb = 1024 * 1024;
+  const auto is_stdin = m_opt.is_stdin();
   const std::size_t block_size =
-      m_opt.file_size() >= k_one_mb * m_opt.threads_size() &&
+      (is_stdin || m_opt.file_size() >= k_one_mb * m_opt.threads_size()) &&
               m_opt.bytes_per_chunk() >= k_one_mb
           ? k_one_mb
           : 8192;
@@ -302,8 +607,10 @@ void Import_table::scan_file() {
 
   Threaded_file_config config;
   config.file_path = m_opt.single_file();
-  config.config = m_opt.storage_config();
+  config.config = is_stdin ? mysqlshdk::storage::backend::stdin_config()
+                           : m_opt.storage_config();
   config.threads = m_opt.threads_size();
+  config.sequential = is_stdin;
   config.max_memory = m_opt.bytes_per_chunk();
   config.allocator = m_allocator.get();
 
@@ -360,7 +667,8 @@ void Import_table::scan_file() {
   // regarding the size of compressed reads). We set it here to zero and update
   // it once its known. When total is zero, progress is displayed as follows:
   //   ?% (58.11 MB / ?), 28.15 MB/s
-  if (m_has_compressed_files) {
+  // Same applies to the standard input, its size is not known in advance.
+  if (m_has_compressed_files || is_stdin) {
     m_prog_total_file_bytes = 0;
   }
 
@@ -424,10 +732,14 @@ void Import_table::scan_file() {
     }
   }
 
-  if (m_has_compressed_files) {
+  if (m_has_compressed_files || is_stdin) {
     m_prog_total_file_bytes = total_size;
   }
 
+  if (is_stdin) {
+    m_total_file_size = total_size;
+  }
+
   m_range_queue.shutdown(m_opt.threads_size());
 }
 
@@ -101,24 +101,36 @@ class Import_table final {
   std::string rows_affected_info();
 
  private:
+  void load_files();
   void spawn_workers();
   void join_workers();
-  void chunk_file();
+  void chunk_file(const std::string &path);
   void build_queue();
   void progress_setup();
   void progress_shutdown();
   void scan_file();
 
+  std::shared_ptr<mysqlshdk::db::mysql::Session> connect() const;
+  std::string quoted_table() const;
+  void drop_deferred_indexes();
+  void recreate_deferred_indexes();
+  void recreate_deferred_indexes_after_error() noexcept;
+
   inline bool interrupted() const {
     return (m_interrupt && *m_interrupt) || any_exception();
   }
 
-  std::atomic<size_t> m_prog_sent_bytes{0};
-  std::atomic<size_t> m_prog_file_bytes{0};
+  // each worker updates its own slot
+  dump::Progress_counter m_prog_sent_bytes;
+  dump::Progress_counter m_prog_file_bytes;
   std::optional<size_t> m_prog_total_file_bytes;
   size_t m_total_file_size = 0;
   bool m_has_compressed_files = false;
 
+  // ALTER TABLE statements which recreate the indexes dropped before the
+  // import
+  std::vector<std::string> m_deferred_indexes;
+
   std::unique_ptr<mysqlshdk::storage::in_memory::Allocator> m_allocator;
 
   shcore::Synchronized_queue<File_import_info> m_range_queue;
@@ -30,18 +30,21 @@
 #include <utility>
 
 #include "modules/mod_utils.h"
+#include "modules/util/import_table/columnar_file.h"
 #include "modules/util/import_table/helpers.h"
 #include "mysqlshdk/include/scripting/types.h"
 #include "mysqlshdk/include/shellcore/base_session.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/storage/backend/stdin_file.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace {
 template <typename FwdIter>
@@ -130,6 +133,8 @@ const shcore::Option_pack_def<Import_table_option_pack>
           .optional("replaceDuplicates",
                     &Import_table_option_pack::m_replace_duplicates)
           .optional("maxRate", &Import_table_option_pack::set_max_rate)
+          .optional("maxTotalRate",
+                    &Import_table_option_pack::set_max_total_rate)
           .optional("showProgress", &Import_table_option_pack::m_show_progress)
           .optional("skipRows", &Import_table_option_pack::m_skip_rows_count)
           .optional("decodeColumns",
@@ -137,6 +142,13 @@ const shcore::Option_pack_def<Import_table_option_pack>
           .optional("characterSet", &Import_table_option_pack::m_character_set)
           .optional("sessionInitSql",
                     &Import_table_option_pack::m_session_init_sql)
+          .optional("fallbackToInsert",
+                    &Import_table_option_pack::m_fallback_to_insert)
+          .optional("deferTableIndexes",
+                    &Import_table_option_pack::m_defer_table_indexes,
+                    {{"off", Defer_index_mode::OFF},
+                     {"all", Defer_index_mode::ALL},
+                     {"fulltext", Defer_index_mode::FULLTEXT}})
           .include(&Import_table_option_pack::m_dialect)
           .include(&Import_table_option_pack::m_oci_bucket_options)
           .include(&Import_table_option_pack::m_s3_bucket_options)
@@ -168,7 +180,7 @@ void Import_table_option_pack::set_filenames(
 
     // If loading single file, table name is taken from the file if not
     // specified by the user.
-    if (m_table.empty()) {
+    if (m_table.empty() && !is_stdin()) {
       m_table = std::get<0>(
           shcore::path::split_extension(shcore::path::basename(single_file())));
     }
@@ -236,6 +248,11 @@ bool Import_table_option_pack::check_if_multifile() {
   return true;
 }
 
+bool Import_table_option_pack::is_stdin() const {
+  return !is_multifile() &&
+         mysqlshdk::storage::backend::is_stdin(m_filelist_from_user[0]);
+}
+
 bool Import_table_option_pack::is_compressed(const std::string &path) const {
   using mysqlshdk::storage::Compression;
   using mysqlshdk::storage::get_extension;
@@ -243,7 +260,8 @@ bool Import_table_option_pack::is_compressed(const std::string &path) const {
   const auto extension = std::get<1>(shcore::path::split_extension(path));
 
   return extension == get_extension(Compression::GZIP) ||
-         extension == get_extension(Compression::ZSTD);
+         extension == get_extension(Compression::ZSTD) ||
+         extension == get_extension(Compression::LZ4);
 }
 
 Import_table_options::Import_table_options(
@@ -282,19 +300,50 @@ void Import_table_options::validate() {
     auto local_infile_value = row->get_string(1);
 
     if (shcore::str_caseeq(local_infile_value, "off")) {
-      mysqlsh::current_console()->print_error(
-          "The 'local_infile' global system variable must be set to ON in "
-          "the target server, after the server is verified to be trusted.");
-      throw std::runtime_error("Invalid preconditions");
+      if (m_fallback_to_insert) {
+        mysqlsh::current_console()->print_note(
+            "The 'local_infile' global system variable is set to OFF in the "
+            "target server, data is going to be loaded using INSERT "
+            "statements.");
+        m_use_insert_statements = true;
+      } else {
+        mysqlsh::current_console()->print_error(
+            "The 'local_infile' global system variable must be set to ON in "
+            "the target server, after the server is verified to be trusted.");
+        throw std::runtime_error("Invalid preconditions");
+      }
     }
   }
 
+  if (m_use_insert_statements) {
+    validate_insert_statements();
+  }
+
+  if (m_dialect.is_columnar()) {
+    validate_columnar();
+  }
+
   if (is_multifile()) {
     if (m_bytes_per_chunk.has_value()) {
       throw std::runtime_error(
           "The 'bytesPerChunk' option cannot be used when loading from "
           "multiple files.");
     }
+
+    if (std::any_of(m_filelist_from_user.begin(), m_filelist_from_user.end(),
+                    mysqlshdk::storage::backend::is_stdin)) {
+      throw std::runtime_error(
+          "The standard input cannot be loaded together with other files.");
+    }
+  } else if (is_stdin()) {
+    if (m_storage_config) {
+      throw std::runtime_error(
+          "The standard input cannot be loaded from a remote storage.");
+    }
+
+    // size of the data is unknown
+    m_file_size = 0;
+    m_full_path = "stdin";
   } else {
     const auto handle = create_file_handle(single_file());
     // open the file to check if it's readable
@@ -311,6 +360,11 @@ void Import_table_options::validate() {
 std::unique_ptr<mysqlshdk::storage::IFile>
 Import_table_option_pack::create_file_handle(
     const std::string &filepath) const {
+  if (mysqlshdk::storage::backend::is_stdin(filepath)) {
+    return mysqlshdk::storage::make_file(
+        filepath, mysqlshdk::storage::backend::stdin_config());
+  }
+
   return create_file_handle(
       mysqlshdk::storage::make_file(filepath, storage_config()));
 }
@@ -334,7 +388,7 @@ size_t Import_table_options::calc_thread_size() {
 
   if (!is_multifile()) {
     if (dialect_supports_chunking()) {
-      if (!is_compressed(single_file())) {
+      if (!is_compressed(single_file()) && !is_stdin()) {
         // We do not need to spawn more threads than file chunks
         const size_t calculated_threads = (m_file_size / bytes_per_chunk()) + 1;
         if (calculated_threads <
@@ -343,13 +397,35 @@ size_t Import_table_options::calc_thread_size() {
               std::min(threads_size, static_cast<int64_t>(calculated_threads));
         }
       }
-    } else {
+    } else if (!m_dialect.is_columnar()) {
+      // chunks of files in a columnar format are loaded in parallel
       threads_size = 1;
     }
   }
   return threads_size;
 }
 
+void Import_table_options::validate_insert_statements() const {
+  if (m_columns) {
+    for (const auto &c : *m_columns) {
+      if (c.get_type() != shcore::Value_type::String) {
+        throw std::runtime_error(
+            "User variable bindings in the 'columns' option are not supported "
+            "when data is loaded using INSERT statements.");
+      }
+    }
+  }
+
+  for (const auto &decode : m_decode_columns) {
+    if (!decode.second.empty() && decode.second != "UNHEX" &&
+        decode.second != "FROM_BASE64") {
+      throw std::runtime_error(
+          "Only the UNHEX and FROM_BASE64 methods in the 'decodeColumns' "
+          "option are supported when data is loaded using INSERT statements.");
+    }
+  }
+}
+
 uint64_t Import_table_option_pack::max_rate() const { return m_max_rate; }
 
 void Import_table_option_pack::set_max_rate(const std::string &value) {
@@ -358,6 +434,15 @@ void Import_table_option_pack::set_max_rate(const std::string &value) {
   }
 }
 
+void Import_table_option_pack::set_max_total_rate(const std::string &value) {
+  if (!value.empty()) {
+    if (const auto rate = mysqlshdk::utils::expand_to_bytes(value); rate > 0) {
+      m_total_rate_limit =
+          std::make_shared<mysqlshdk::utils::Shared_rate_limit>(rate);
+    }
+  }
+}
+
 void Import_table_option_pack::on_unpacked_options() {
   m_s3_bucket_options.throw_on_conflict(m_oci_bucket_options);
   m_s3_bucket_options.throw_on_conflict(m_blob_storage_options);
@@ -465,8 +550,65 @@ std::string Import_table_options::target_import_info() const {
   return info_msg;
 }
 
+void Import_table_options::validate_columnar() {
+  const auto dialect =
+      Dialect::Format::PARQUET == m_dialect.format ? "parquet" : "arrow";
+
+  if (m_skip_rows_count > 0) {
+    throw std::runtime_error(shcore::str_format(
+        "The 'skipRows' option cannot be used with the %s dialect.", dialect));
+  }
+
+  if (std::any_of(m_filelist_from_user.begin(), m_filelist_from_user.end(),
+                  mysqlshdk::storage::backend::is_stdin)) {
+    throw std::runtime_error(shcore::str_format(
+        "The standard input cannot be loaded using the %s dialect.", dialect));
+  }
+
+  if (m_columns && !m_columns->empty()) {
+    return;
+  }
+
+  // columns are matched by name, names are taken from the first file
+  for (const auto &item : m_filelist_from_user) {
+    std::unique_ptr<mysqlshdk::storage::IFile> file;
+
+    if (item.find('*') != std::string::npos ||
+        item.find('?') != std::string::npos) {
+      const auto dir = create_file_handle(item)->parent();
+
+      if (!dir->exists()) {
+        continue;
+      }
+
+      const auto files = dir->filter_files_sorted(shcore::path::basename(item));
+
+      if (files.empty()) {
+        continue;
+      }
+
+      file = create_file_handle(dir->file(files.front().name()));
+    } else {
+      file = create_file_handle(item);
+
+      if (!file->exists()) {
+        continue;
+      }
+    }
+
+    m_columns = shcore::make_array();
+
+    for (auto &column :
+         read_columnar_file_info(m_dialect.format, file.get()).columns) {
+      m_columns->emplace_back(std::move(column));
+    }
+
+    break;
+  }
+}
+
 bool Import_table_options::dialect_supports_chunking() const {
-  return !m_dialect.lines_terminated_by.empty() &&
+  return !m_dialect.is_columnar() && !m_dialect.lines_terminated_by.empty() &&
          m_dialect.lines_terminated_by != m_dialect.fields_terminated_by;
 }
 
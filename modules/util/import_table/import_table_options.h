@@ -48,6 +48,7 @@
 #include "mysqlshdk/libs/oci/oci_bucket_options.h"
 #include "mysqlshdk/libs/storage/config.h"
 #include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/rate_limit.h"
 
 namespace mysqlsh {
 namespace import_table {
@@ -56,6 +57,8 @@ using Connection_options = mysqlshdk::db::Connection_options;
 
 class Import_table_option_pack {
  public:
+  enum class Defer_index_mode { OFF, FULLTEXT, ALL };
+
   Import_table_option_pack()
       : m_blob_storage_options{
             mysqlshdk::azure::Blob_storage_options::Operation::READ} {};
@@ -88,8 +91,26 @@ class Import_table_option_pack {
     return m_filelist_from_user[0];
   }
 
+  /**
+   * Whether data is read from the standard input ("-").
+   */
+  bool is_stdin() const;
+
   uint64_t max_rate() const;
 
+  /**
+   * Limit shared by all the threads, not set if there's no limit.
+   */
+  const std::shared_ptr<mysqlshdk::utils::Shared_rate_limit>
+      &total_rate_limit() const {
+    return m_total_rate_limit;
+  }
+
+  void set_total_rate_limit(
+      std::shared_ptr<mysqlshdk::utils::Shared_rate_limit> limit) {
+    m_total_rate_limit = std::move(limit);
+  }
+
   bool replace_duplicates() const { return m_replace_duplicates; }
 
   void set_replace_duplicates(bool flag) { m_replace_duplicates = flag; }
@@ -141,10 +162,33 @@ class Import_table_option_pack {
     return m_session_init_sql;
   }
 
+  /**
+   * Whether data is loaded using INSERT statements, instead of
+   * LOAD DATA LOCAL INFILE.
+   */
+  bool use_insert_statements() const { return m_use_insert_statements; }
+
+  void set_use_insert_statements(bool flag) { m_use_insert_statements = flag; }
+
+  /**
+   * Which secondary indexes are dropped before the import and recreated once
+   * all the data is loaded.
+   */
+  Defer_index_mode defer_table_indexes() const { return m_defer_table_indexes; }
+
+  /**
+   * Whether the base session was already set up to load data into the target
+   * schema, in which case the session setup statements are not executed.
+   */
+  bool session_ready() const { return m_session_ready; }
+
+  void set_session_ready(bool ready) { m_session_ready = ready; }
+
  private:
   void set_max_transaction_size(const std::string &value);
   void set_bytes_per_chunk(const std::string &value);
   void set_max_rate(const std::string &value);
+  void set_max_total_rate(const std::string &value);
   void on_unpacked_options();
   bool check_if_multifile();
 
@@ -162,6 +206,7 @@ class Import_table_option_pack {
   std::map<std::string, std::string> m_decode_columns;
   bool m_replace_duplicates = false;
   uint64_t m_max_rate = 0;
+  std::shared_ptr<mysqlshdk::utils::Shared_rate_limit> m_total_rate_limit;
   bool m_show_progress = isatty(fileno(stdout)) ? true : false;
   uint64_t m_skip_rows_count = 0;
   Dialect m_dialect;
@@ -172,6 +217,14 @@ class Import_table_option_pack {
   bool m_verbose = true;
 
   std::vector<std::string> m_session_init_sql;
+
+  // whether INSERT statements can be used if local_infile is disabled
+  bool m_fallback_to_insert = false;
+  bool m_use_insert_statements = false;
+
+  Defer_index_mode m_defer_table_indexes = Defer_index_mode::OFF;
+
+  bool m_session_ready = false;
 };
 
 class Import_table_options : public Import_table_option_pack {
@@ -201,9 +254,15 @@ class Import_table_options : public Import_table_option_pack {
 
   bool dialect_supports_chunking() const;
 
+  void set_threads_size(int64_t threads) { m_threads_size = threads; }
+
  private:
   size_t calc_thread_size();
 
+  void validate_insert_statements() const;
+
+  void validate_columnar();
+
   std::shared_ptr<mysqlshdk::db::ISession> m_base_session;
   size_t m_file_size;
   std::string m_full_path;
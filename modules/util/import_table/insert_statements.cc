@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/insert_statements.h"
+
+#include <cstring>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+namespace {
+
+char unescape(char c) {
+  switch (c) {
+    case '0':
+      return '\0';
+
+    case 'b':
+      return '\b';
+
+    case 'n':
+      return '\n';
+
+    case 'r':
+      return '\r';
+
+    case 't':
+      return '\t';
+
+    case 'Z':
+      return '\032';
+
+    default:
+      return c;
+  }
+}
+
+}  // namespace
+
+Insert_statements::Insert_statements(const Dialect &dialect,
+                                     const std::string &into,
+                                     std::vector<Column> columns,
+                                     std::size_t max_statement_size)
+    : m_lines_starting_by(dialect.lines_starting_by),
+      m_lines_terminated_by(dialect.lines_terminated_by),
+      m_fields_terminated_by(dialect.fields_terminated_by),
+      m_columns(std::move(columns)),
+      m_max_statement_size(max_statement_size) {
+  if (!dialect.fields_enclosed_by.empty()) {
+    m_has_enclosed_char = true;
+    m_enclosed_char = dialect.fields_enclosed_by[0];
+  }
+
+  // when ESCAPED BY == ENCLOSED BY, server only allows for doubled-up
+  // characters, which are handled as the enclosing ones
+  if (!dialect.fields_escaped_by.empty() &&
+      (!m_has_enclosed_char ||
+       dialect.fields_escaped_by[0] != m_enclosed_char)) {
+    m_has_escaped_char = true;
+    m_escaped_char = dialect.fields_escaped_by[0];
+  }
+
+  m_prefix = into + " (";
+  bool first = true;
+
+  for (const auto &column : m_columns) {
+    if (column.name.empty()) {
+      continue;
+    }
+
+    if (!first) {
+      m_prefix += ',';
+    }
+
+    m_prefix += column.name;
+    first = false;
+  }
+
+  m_prefix += ") VALUES ";
+}
+
+void Insert_statements::append(const char *data, std::size_t length) {
+  m_buffer.append(data, length);
+
+  while (parse_row(false)) {
+    add_row();
+  }
+
+  // keep only the data which was not parsed
+  m_buffer.erase(0, m_position);
+  m_position = 0;
+}
+
+void Insert_statements::finish() {
+  while (parse_row(true)) {
+    add_row();
+  }
+
+  flush();
+
+  m_buffer.clear();
+  m_position = 0;
+}
+
+bool Insert_statements::parse_row(bool at_end) {
+  const auto size = m_buffer.size();
+  auto pos = m_position;
+
+  if (pos >= size) {
+    return false;
+  }
+
+  if (!m_lines_starting_by.empty()) {
+    // prefix and anything before it is skipped, lines without a prefix are
+    // skipped as well
+    const auto prefix = m_buffer.find(m_lines_starting_by, pos);
+
+    if (std::string::npos == prefix) {
+      if (at_end) {
+        m_position = size;
+      }
+
+      return false;
+    }
+
+    pos = prefix + m_lines_starting_by.length();
+  }
+
+  m_field_count = 0;
+
+  while (true) {
+    if (m_fields.size() == m_field_count) {
+      m_fields.emplace_back();
+    }
+
+    auto &field = m_fields[m_field_count++];
+    field.value.clear();
+    field.is_null = false;
+
+    if (pos >= size && !at_end) {
+      return false;
+    }
+
+    const bool was_enclosed = m_has_enclosed_char && pos < size &&
+                              m_buffer[pos] == m_enclosed_char;
+    bool enclosed = was_enclosed;
+    // set if field starts with the \N sequence
+    bool escaped_null = false;
+    bool end_of_line = false;
+
+    if (enclosed) {
+      ++pos;
+    }
+
+    while (true) {
+      if (pos >= size) {
+        if (!at_end) {
+          return false;
+        }
+
+        end_of_line = true;
+        break;
+      }
+
+      const auto c = m_buffer[pos];
+
+      if (m_has_escaped_char && c == m_escaped_char) {
+        if (pos + 1 >= size) {
+          if (!at_end) {
+            return false;
+          }
+
+          // escape character at the end of data is taken literally
+          field.value += c;
+          ++pos;
+          continue;
+        }
+
+        const auto next = m_buffer[pos + 1];
+
+        if ('N' == next && field.value.empty() && !was_enclosed) {
+          escaped_null = true;
+        }
+
+        field.value += unescape(next);
+        pos += 2;
+        continue;
+      }
+
+      if (enclosed) {
+        if (c == m_enclosed_char) {
+          if (pos + 1 >= size && !at_end) {
+            return false;
+          }
+
+          if (pos + 1 < size && m_buffer[pos + 1] == m_enclosed_char) {
+            // doubled ENCLOSED BY character
+            field.value += c;
+            pos += 2;
+            continue;
+          }
+
+          // closing character has to be followed by one of the terminators
+          const auto t = terminator(pos + 1, at_end);
+
+          if (Terminator::INCOMPLETE == t) {
+            return false;
+          }
+
+          if (Terminator::NONE != t || pos + 1 >= size) {
+            enclosed = false;
+            ++pos;
+            continue;
+          }
+        }
+
+        field.value += c;
+        ++pos;
+        continue;
+      }
+
+      const auto t = terminator(pos, at_end);
+
+      if (Terminator::INCOMPLETE == t) {
+        return false;
+      }
+
+      if (Terminator::LINE == t) {
+        pos += m_lines_terminated_by.length();
+        end_of_line = true;
+        break;
+      }
+
+      if (Terminator::FIELD == t) {
+        pos += m_fields_terminated_by.length();
+        break;
+      }
+
+      field.value += c;
+      ++pos;
+    }
+
+    if (!was_enclosed) {
+      field.is_null = (escaped_null && 1 == field.value.length()) ||
+                      (m_has_enclosed_char && "NULL" == field.value);
+    }
+
+    if (end_of_line) {
+      break;
+    }
+  }
+
+  m_position = pos;
+
+  return true;
+}
+
+Insert_statements::Terminator Insert_statements::terminator(
+    std::size_t pos, bool at_end) const {
+  const auto available = m_buffer.size() - pos;
+  const auto data = m_buffer.data() + pos;
+  bool incomplete = false;
+
+  // LINES TERMINATED BY is checked first, it can be the same as FIELDS
+  // TERMINATED BY
+  for (const auto &[sequence, type] :
+       {std::make_pair(&m_lines_terminated_by, Terminator::LINE),
+        std::make_pair(&m_fields_terminated_by, Terminator::FIELD)}) {
+    const auto length = sequence->length();
+
+    if (!length) {
+      continue;
+    }
+
+    if (available >= length) {
+      if (0 == ::memcmp(data, sequence->data(), length)) {
+        return type;
+      }
+    } else if (!at_end && 0 == ::memcmp(data, sequence->data(), available)) {
+      incomplete = true;
+    }
+  }
+
+  return incomplete ? Terminator::INCOMPLETE : Terminator::NONE;
+}
+
+void Insert_statements::add_row() {
+  if (m_rows_to_skip > 0) {
+    --m_rows_to_skip;
+    return;
+  }
+
+  m_row = '(';
+  bool first = true;
+
+  for (std::size_t i = 0; i < m_columns.size(); ++i) {
+    const auto &column = m_columns[i];
+
+    if (column.name.empty()) {
+      continue;
+    }
+
+    if (!first) {
+      m_row += ',';
+    }
+
+    first = false;
+
+    if (i >= m_field_count) {
+      // missing fields are set to their default values
+      m_row += "DEFAULT";
+    } else if (m_fields[i].is_null) {
+      m_row += "NULL";
+    } else {
+      if (!column.decode.empty()) {
+        m_row += column.decode;
+        m_row += '(';
+      }
+
+      m_row += '\'';
+      m_row += shcore::escape_sql_string(m_fields[i].value);
+      m_row += '\'';
+
+      if (!column.decode.empty()) {
+        m_row += ')';
+      }
+    }
+  }
+
+  m_row += ')';
+
+  if (m_statement_rows > 0 &&
+      m_statement.length() + 1 + m_row.length() > m_max_statement_size) {
+    flush();
+  }
+
+  if (0 == m_statement_rows) {
+    m_statement = m_prefix;
+  } else {
+    m_statement += ',';
+  }
+
+  m_statement += m_row;
+  ++m_statement_rows;
+  ++m_rows;
+}
+
+void Insert_statements::flush() {
+  if (0 == m_statement_rows) {
+    return;
+  }
+
+  const auto rows = m_statement_rows;
+  m_statement_rows = 0;
+
+  m_on_statement(m_statement, rows);
+  m_statement.clear();
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_IMPORT_TABLE_INSERT_STATEMENTS_H_
+#define MODULES_UTIL_IMPORT_TABLE_INSERT_STATEMENTS_H_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "modules/util/import_table/dialect.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+/**
+ * Parses the data written using the given dialect and converts it into
+ * multi-row INSERT statements. Used when LOAD DATA LOCAL INFILE cannot be
+ * executed, follows the rules used by the server when reading the input file.
+ */
+class Insert_statements final {
+ public:
+  /**
+   * Target of a single field of a row.
+   */
+  struct Column {
+    // quoted name of the column, if empty, field is discarded
+    std::string name;
+    // function used to decode the value (i.e. UNHEX), can be empty
+    std::string decode;
+  };
+
+  /**
+   * Called with a complete statement and number of rows it holds.
+   */
+  using Statement_callback =
+      std::function<void(const std::string &statement, std::size_t rows)>;
+
+  Insert_statements() = delete;
+
+  /**
+   * Creates the converter.
+   *
+   * @param dialect Dialect of the data.
+   * @param into Beginning of each statement, up to the column list, i.e.
+   *        INSERT INTO `schema`.`table`
+   * @param columns Targets of the fields of each row.
+   * @param max_statement_size Statements are not going to be longer than this,
+   *        unless a single row exceeds it.
+   */
+  Insert_statements(const Dialect &dialect, const std::string &into,
+                    std::vector<Column> columns,
+                    std::size_t max_statement_size);
+
+  Insert_statements(const Insert_statements &) = delete;
+  Insert_statements(Insert_statements &&) = default;
+
+  Insert_statements &operator=(const Insert_statements &) = delete;
+  Insert_statements &operator=(Insert_statements &&) = default;
+
+  ~Insert_statements() = default;
+
+  /**
+   * Sets the callback which executes the statements.
+   */
+  void on_statement(Statement_callback callback) {
+    m_on_statement = std::move(callback);
+  }
+
+  /**
+   * Sets the number of rows to be skipped, applies to the data which is going
+   * to be appended.
+   */
+  void set_rows_to_skip(uint64_t rows) { m_rows_to_skip = rows; }
+
+  /**
+   * Parses the next block of data, rows may span multiple blocks. Complete
+   * statements are passed to the callback.
+   */
+  void append(const char *data, std::size_t length);
+
+  /**
+   * Handles the end of data, the last row does not have to be terminated.
+   * Remaining rows are passed to the callback.
+   */
+  void finish();
+
+  /**
+   * Number of rows converted so far.
+   */
+  uint64_t rows() const { return m_rows; }
+
+ private:
+  struct Field {
+    std::string value;
+    bool is_null = false;
+  };
+
+  enum class Terminator {
+    NONE,
+    FIELD,
+    LINE,
+    INCOMPLETE,
+  };
+
+  /**
+   * Parses a single row, starting at the current position.
+   *
+   * @param at_end Whether there is no more data.
+   *
+   * @returns true if row was parsed, false if more data is needed
+   */
+  bool parse_row(bool at_end);
+
+  /**
+   * Checks if data at the given position holds one of the terminators.
+   */
+  Terminator terminator(std::size_t pos, bool at_end) const;
+
+  void add_row();
+
+  void flush();
+
+  std::string m_lines_starting_by;
+  std::string m_lines_terminated_by;
+  std::string m_fields_terminated_by;
+  bool m_has_escaped_char = false;
+  char m_escaped_char = 0;
+  bool m_has_enclosed_char = false;
+  char m_enclosed_char = 0;
+
+  std::vector<Column> m_columns;
+  std::string m_prefix;
+  std::size_t m_max_statement_size;
+
+  Statement_callback m_on_statement;
+  uint64_t m_rows_to_skip = 0;
+  uint64_t m_rows = 0;
+
+  // data which was not parsed yet
+  std::string m_buffer;
+  std::size_t m_position = 0;
+
+  // fields of the current row
+  std::vector<Field> m_fields;
+  std::size_t m_field_count = 0;
+
+  std::string m_row;
+  std::string m_statement;
+  std::size_t m_statement_rows = 0;
+};
+
+}  // namespace import_table
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_IMPORT_TABLE_INSERT_STATEMENTS_H_
@@ -42,6 +42,7 @@ using off64_t = off_t;
 #include <algorithm>
 #include <cinttypes>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "modules/util/import_table/helpers.h"
@@ -52,7 +53,9 @@ using off64_t = off_t;
 #include "mysqlshdk/libs/storage/backend/in_memory/synchronized_file.h"
 #include "mysqlshdk/libs/storage/backend/in_memory/virtual_file.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
+#include "mysqlshdk/libs/utils/version.h"
 
 namespace mysqlsh {
 namespace import_table {
@@ -200,6 +203,12 @@ int Transaction_buffer::consume(char *buffer, unsigned int length) {
 }
 
 int Transaction_buffer::read(char *buffer, unsigned int length) {
+  const auto bytes = do_read(buffer, length);
+  m_memory.resize(m_data.capacity());
+  return bytes;
+}
+
+int Transaction_buffer::do_read(char *buffer, unsigned int length) {
   if (m_options.max_trx_size == 0) {
     // regular read if truncation is not enabled
     return m_file->read(buffer, length);
@@ -227,6 +236,15 @@ int Transaction_buffer::read(char *buffer, unsigned int length) {
     return bytes;
   };
 
+  if (m_trx_end_offset == 0 && !m_eof && m_data.length() < length &&
+      trx_bytes_left() > static_cast<int64_t>(length)) {
+    // whatever is read cannot fill the transaction, read the data directly
+    // into the output buffer
+    if (int bytes; read_in_place(buffer, length, &bytes)) {
+      return bytes;
+    }
+  }
+
   // return as many bytes as we can from the data we have, as long as we know
   // it will fit in the transaction
 
@@ -242,7 +260,7 @@ retry:
       static_cast<int64_t>(m_data.length()) >= trx_bytes_left()) {
     // calculate the last row that will fit
     auto last_row_end =
-        (this->*find_last_row_boundary_before)(trx_bytes_left());
+        (this->*find_last_row_boundary_before)(m_data, trx_bytes_left());
     if (last_row_end > 0) {
       set_trx_end_offset(last_row_end);
     }
@@ -259,7 +277,7 @@ retry:
         // we've already read more data than will fit in the transaction, so
         // just find the last row that will fit whole
         auto last_row_end =
-            (this->*find_last_row_boundary_before)(trx_bytes_left());
+            (this->*find_last_row_boundary_before)(m_data, trx_bytes_left());
 
         // if we don't find a newline here, it has to mean the row doesn't fit
         // in the transaction (otherwise there's a bug)
@@ -277,7 +295,7 @@ retry:
         }
       }
 
-      auto row_end = (this->*find_first_row_boundary_after)();
+      auto row_end = (this->*find_first_row_boundary_after)(m_data);
       if (row_end > 0) {
         // we found EOR, send the rest of the row and flush
         set_trx_end_offset(row_end);
@@ -292,7 +310,8 @@ retry:
       return consume(buffer, length);
     } else {
       // otherwise, send data at a row boundary to allow safe flushing
-      auto last_row_end = (this->*find_last_row_boundary_before)(length);
+      auto last_row_end =
+          (this->*find_last_row_boundary_before)(m_data, length);
       if (last_row_end > 0) {
         // EOR found, if we sent a partial row, it's complete now
         m_partial_row_sent = false;
@@ -302,7 +321,8 @@ retry:
 
       // there's a full row in the buffer, but more data than we can return at
       // once
-      last_row_end = (this->*find_last_row_boundary_before)(trx_bytes_left());
+      last_row_end =
+          (this->*find_last_row_boundary_before)(m_data, trx_bytes_left());
       if (last_row_end > 0) {
         return consume(buffer, std::min<unsigned int>(length, last_row_end));
       }
@@ -336,102 +356,150 @@ retry:
   }
 }
 
-uint64_t Transaction_buffer::find_first_row_boundary_after_impl_default()
-    const {
+bool Transaction_buffer::read_in_place(char *buffer, unsigned int length,
+                                       int *out_bytes) {
+  // partial row which was left from the previous read goes first
+  const auto carry_over = m_data.length();
+  memcpy(buffer, m_data.data(), carry_over);
+
+  const auto bytes = m_file->read(buffer + carry_over, length - carry_over);
+
+  if (bytes < 0) {
+    *out_bytes = bytes;
+    return true;
+  }
+
+  if (0 == bytes) {
+    m_eof = true;
+  }
+
+  const auto total = carry_over + bytes;
+  const auto last_row_end =
+      (this->*find_last_row_boundary_before)({buffer, total}, total);
+
+  if (last_row_end > 0) {
+    // EOR found, if we sent a partial row, it's complete now; the trailing
+    // partial row is kept for the next read
+    m_partial_row_sent = false;
+    m_data.assign(buffer + last_row_end, total - last_row_end);
+    m_trx_size += last_row_end;
+    *out_bytes = last_row_end;
+    return true;
+  }
+
+  if (m_trx_size == 0 || m_partial_row_sent) {
+    // there are no full rows in the buffer, only the current partial row, it
+    // is the first row of the transaction or it was already being sent
+    m_partial_row_sent = true;
+    m_data.clear();
+    m_trx_size += total;
+    *out_bytes = total;
+    return true;
+  }
+
+  // we don't know yet if the partial row will fit in the transaction, it has
+  // to be buffered
+  m_data.assign(buffer, total);
+  return false;
+}
+
+uint64_t Transaction_buffer::find_first_row_boundary_after_impl_default(
+    std::string_view data) const {
   assert(m_dialect == Dialect::default_());
 
   const char needle = m_dialect.lines_terminated_by[0];
-  const auto p = m_data.find(needle);
+  const auto p = data.find(needle);
 
-  if (p >= m_data.length()) return 0;
+  if (p >= data.length()) return 0;
 
   return p + 1;
 }
 
 uint64_t Transaction_buffer::find_last_row_boundary_before_impl_default(
-    uint64_t limit) {
+    std::string_view data, uint64_t limit) const {
   assert(m_dialect == Dialect::default_());
 
   const char needle = m_dialect.lines_terminated_by[0];
-  auto p = limit < m_data.length() ? static_cast<size_t>(limit - 1)
-                                   : m_data.length();
+  auto p = limit < data.length() ? static_cast<size_t>(limit - 1)
+                                 : data.length();
 
   if (p == 0) return 0;
 
-  p = m_data.rfind(needle, p);
+  p = data.rfind(needle, p);
 
-  if (p >= m_data.length()) return 0;
+  if (p >= data.length()) return 0;
 
   return p + 1;
 }
 
-uint64_t Transaction_buffer::find_first_row_boundary_after_impl_no_escape()
-    const {
+uint64_t Transaction_buffer::find_first_row_boundary_after_impl_no_escape(
+    std::string_view data) const {
   assert(m_dialect.lines_terminated_by.size());
   assert(!m_dialect.fields_escaped_by.size());
 
   const auto &needle = m_dialect.lines_terminated_by;
-  const auto p = m_data.find(needle);
+  const auto p = data.find(needle);
 
-  if (p >= m_data.length()) return 0;
+  if (p >= data.length()) return 0;
 
   return p + needle.size();
 }
 
 uint64_t Transaction_buffer::find_last_row_boundary_before_impl_no_escape(
-    uint64_t limit) {
+    std::string_view data, uint64_t limit) const {
   assert(m_dialect.lines_terminated_by.size());
   assert(!m_dialect.fields_escaped_by.size());
 
   const auto &needle = m_dialect.lines_terminated_by;
-  auto p = limit < m_data.length() ? static_cast<size_t>(limit - 1)
-                                   : m_data.length();
+  auto p = limit < data.length() ? static_cast<size_t>(limit - 1)
+                                 : data.length();
 
   if (p < needle.size()) return 0;
 
-  p = m_data.rfind(needle, p);
+  p = data.rfind(needle, p);
 
-  if (p >= m_data.length()) return 0;
+  if (p >= data.length()) return 0;
 
   return p + needle.size();
 }
 
-uint64_t Transaction_buffer::find_first_row_boundary_after_impl_escape() const {
+uint64_t Transaction_buffer::find_first_row_boundary_after_impl_escape(
+    std::string_view data) const {
   assert(m_dialect.lines_terminated_by.size());
   assert(m_dialect.fields_escaped_by.size());
 
   const auto &needle = m_dialect.lines_terminated_by;
-  auto p = m_data.find(needle);
+  auto p = data.find(needle);
 
-  while (p != std::string::npos) {
-    if (!(p > 0 && m_data[p - 1] == m_dialect.fields_escaped_by[0])) {
-      assert(p < m_data.length());
+  while (p != std::string_view::npos) {
+    if (!(p > 0 && data[p - 1] == m_dialect.fields_escaped_by[0])) {
+      assert(p < data.length());
       return p + needle.size();
     }
 
     p += needle.size();
-    p = m_data.find(needle, p);
+    p = data.find(needle, p);
   }
 
   return 0;
 }
 
 uint64_t Transaction_buffer::find_last_row_boundary_before_impl_escape(
-    uint64_t limit) {
+    std::string_view data, uint64_t limit) const {
   assert(m_dialect.lines_terminated_by.size());
   assert(m_dialect.fields_escaped_by.size());
 
   const auto &needle = m_dialect.lines_terminated_by;
-  auto p = limit < m_data.length() ? static_cast<size_t>(limit - 1)
-                                   : m_data.length();
+  auto p = limit < data.length() ? static_cast<size_t>(limit - 1)
+                                 : data.length();
 
   if (p < needle.size()) return 0;
 
-  p = m_data.rfind(needle, p);
+  p = data.rfind(needle, p);
 
-  while (p != std::string::npos) {
-    if (!(p > 0 && m_data[p - 1] == m_dialect.fields_escaped_by[0])) {
-      assert(p < m_data.length());
+  while (p != std::string_view::npos) {
+    if (!(p > 0 && data[p - 1] == m_dialect.fields_escaped_by[0])) {
+      assert(p < data.length());
       return p + needle.size();
     }
 
@@ -440,7 +508,7 @@ uint64_t Transaction_buffer::find_last_row_boundary_before_impl_escape(
     }
 
     p -= needle.size();
-    p = m_data.rfind(needle, p);
+    p = data.rfind(needle, p);
   }
 
   return 0;
@@ -523,6 +591,8 @@ int local_infile_init(void **buffer, const char * /* filename */,
   file_info->compressed_file =
       dynamic_cast<mysqlshdk::storage::Compressed_file *>(
           file_info->filehandler.get());
+  file_info->columnar_file =
+      dynamic_cast<Columnar_chunk_file *>(file_info->filehandler.get());
   file_info->data_bytes = 0;
   file_info->file_bytes = 0;
   file_info->rate_limit = mysqlshdk::utils::Rate_limit(file_info->max_rate);
@@ -557,6 +627,8 @@ int local_infile_read(void *userdata, char *buffer,
 
       if (file_info->compressed_file) {
         file_bytes = file_info->compressed_file->latest_io_size();
+      } else if (file_info->columnar_file) {
+        file_bytes = file_info->columnar_file->latest_io_size();
       } else {
         file_bytes = bytes;
       }
@@ -580,6 +652,10 @@ int local_infile_read(void *userdata, char *buffer,
     file_info->rate_limit.throttle(bytes);
   }
 
+  if (file_info->total_rate_limit) {
+    file_info->total_rate_limit->throttle(bytes);
+  }
+
   if (*file_info->user_interrupt) {
     return -1;
   }
@@ -676,38 +752,14 @@ void Load_data_worker::execute(
     fi.prog_file_bytes = m_prog_file_bytes;
     fi.user_interrupt = &m_interrupt;
     fi.max_rate = m_opt.max_rate();
+    fi.total_rate_limit = m_opt.total_rate_limit().get();
     fi.on_infile_read_end = [this]() { set_state(Thread_state::COMMITTING); };
     uint64_t max_trx_size = 0;
     const auto query = [&session](const auto &sql) {
       return session->query(sql);
     };
-    const auto execute = [&session](const auto &sql) { session->execute(sql); };
-    const auto executef = [&session](const auto &sql, auto &&... args) {
-      session->executef(sql, std::forward<decltype(args)>(args)...);
-    };
-
-    // this sets the character_set_database and collation_database server
-    // variables to the values the schema has
-    executef("USE !;", m_opt.schema());
-
-    // SQL mode:
-    //  - no_auto_value_on_zero - normally, 0 generates the next sequence
-    //    number, use this mode to prevent this behaviour (solves problems if
-    //    dump has 0 stored in an AUTO_INCREMENT column)
-    execute("SET SQL_MODE = 'no_auto_value_on_zero';");
 
-    // if user has specified the character set, set the session variables
-    // related to the client connection
-    if (!m_opt.character_set().empty()) {
-      executef("SET NAMES ?;", m_opt.character_set());
-    }
-
-    // BUG#34173126, BUG#33360787 - loading when global auto-commit is OFF fails
-    execute("SET autocommit = 1");
-    // set session variables
-    execute("SET unique_checks = 0");
-    execute("SET foreign_key_checks = 0");
-    execute("SET SESSION TRANSACTION ISOLATION LEVEL READ UNCOMMITTED");
+    setup_session(session);
 
     session->set_local_infile_userdata(static_cast<void *>(&fi));
     session->set_local_infile_init(local_infile_init);
@@ -730,16 +782,6 @@ void Load_data_worker::execute(
             : "PARTITION (" + shcore::quote_identifier(m_opt.partition()) +
                   ") ";
 
-    try {
-      for (const auto &s : m_opt.session_init_sql()) {
-        log_info("Executing custom session init SQL: %s", s.c_str());
-        session->execute(s);
-      }
-    } catch (const shcore::Error &e) {
-      throw shcore::Exception::runtime_error(
-          "Error while executing sessionInitSql: " + e.format());
-    }
-
     const std::string query_body =
         on_duplicate_rows + "INTO TABLE " +
         shcore::quote_identifier(m_opt.schema()) + '.' +
@@ -808,6 +850,13 @@ void Load_data_worker::execute(
       query_columns.pop_back();  // strip the last ,
     }
 
+    // set if LOAD DATA LOCAL INFILE cannot be used
+    std::optional<Insert_statements> insert_statements;
+
+    if (m_opt.use_insert_statements()) {
+      insert_statements.emplace(create_insert_statements(session));
+    }
+
     uint64_t subchunk = 0;
     while (true) {
       if (!fi.continuation) {
@@ -847,6 +896,7 @@ void Load_data_worker::execute(
 
             fi.filehandler = std::move(r.file);
             fi.range_read = r.range_read;
+            fi.last_range = r.last_range;
 
             if (r.range_read) {
               fi.bytes_left = r.range.second - r.range.first;
@@ -896,7 +946,13 @@ void Load_data_worker::execute(
       const std::string query_prefix = shcore::sqlformat(
           "LOAD DATA LOCAL INFILE ? ", fi.filehandler->full_path().masked());
       const std::string full_query =
-          query_prefix + query_body + query_ignore_lines + query_columns;
+          insert_statements
+              ? "INSERT INTO " + shcore::quote_identifier(m_opt.schema()) +
+                    '.' + shcore::quote_identifier(m_opt.table()) +
+                    " using data from " + fi.filehandler->full_path().masked()
+              : query_prefix + query_body + query_ignore_lines + query_columns;
+      // summary of the INSERT statements, in the LOAD DATA format
+      std::string insert_info;
 
 #ifndef NDEBUG
       log_debug("%s %s %i", worker_name.c_str(), full_query.c_str(),
@@ -911,17 +967,75 @@ void Load_data_worker::execute(
         }
       });
 
+      // show first k warnings, where k = warnings_to_show, log the remaining
+      // ones
+      constexpr std::size_t warnings_to_show = 5;
+      std::size_t warnings_shown = 0;
+      std::size_t remaining_warnings_count = 0;
+
+      const auto report_warnings = [&](mysqlshdk::db::IResult *result) {
+        if (!result || 0 == result->get_warning_count()) {
+          return;
+        }
+
+        while (const auto w = result->fetch_one_warning()) {
+          const std::string msg =
+              task + " error " + std::to_string(w->code) + ": " + w->msg;
+
+          if (warnings_shown < warnings_to_show) {
+            ++warnings_shown;
+
+            switch (w->level) {
+              case mysqlshdk::db::Warning::Level::Error:
+                mysqlsh::current_console()->print_error(msg);
+                break;
+              case mysqlshdk::db::Warning::Level::Warn:
+                mysqlsh::current_console()->print_warning(msg);
+                break;
+              case mysqlshdk::db::Warning::Level::Note:
+                mysqlsh::current_console()->print_note(msg);
+                break;
+            }
+          } else {
+            ++remaining_warnings_count;
+
+            switch (w->level) {
+              case mysqlshdk::db::Warning::Level::Error:
+                log_error("%s", msg.c_str());
+                break;
+              case mysqlshdk::db::Warning::Level::Warn:
+                log_warning("%s", msg.c_str());
+                break;
+              case mysqlshdk::db::Warning::Level::Note:
+                log_info("%s", msg.c_str());
+                break;
+            }
+          }
+        }
+      };
+
       try {
         set_state(Thread_state::READING);
         fi.buffer.before_query();
-        load_result = query(m_query_comment + full_query);
+
+        if (insert_statements) {
+          // rows are skipped only if LOAD DATA would skip them
+          insert_statements->set_rows_to_skip(
+              query_ignore_lines.empty() ? 0 : m_opt.skip_rows_count());
+          insert_info = insert_data(session, &fi, &*insert_statements,
+                                    report_warnings);
+        } else {
+          load_result = query(m_query_comment + full_query);
+        }
+
         set_state(Thread_state::IDLE);
         fi.buffer.flush_done(&fi.continuation);
         m_stats.total_data_bytes += fi.data_bytes;
         m_stats.total_file_bytes += fi.file_bytes;
 
-        if (!fi.continuation) {
-          // increase the counter only when there are no more subchunks
+        if (!fi.continuation && fi.last_range) {
+          // increase the counter only when there are no more subchunks and
+          // ranges of this file
           ++m_stats.total_files_processed;
         }
       } catch (const mysqlshdk::db::Error &e) {
@@ -949,11 +1063,10 @@ void Load_data_worker::execute(
         throw std::exception(e);
       }
 
-      const auto warnings_num =
-          load_result ? load_result->get_warning_count() : 0;
-
       {
-        const char *mysql_info = session->get_mysql_info();
+        const char *mysql_info = insert_statements
+                                     ? insert_info.c_str()
+                                     : session->get_mysql_info();
         const auto status =
             worker_name + task + ": " + (mysql_info ? mysql_info : "ERROR") +
             ((options.max_trx_size == 0 && max_trx_size == 0)
@@ -969,70 +1082,14 @@ void Load_data_worker::execute(
           log_info("%s", status.c_str());
         }
 
-        if (mysql_info) {
-          size_t records = 0;
-          size_t deleted = 0;
-          size_t skipped = 0;
-          size_t warnings = 0;
-
-          sscanf(mysql_info,
-                 "Records: %zu  Deleted: %zu  Skipped: %zu  Warnings: %zu\n",
-                 &records, &deleted, &skipped, &warnings);
-          m_stats.total_records += records;
-          m_stats.total_deleted += deleted;
-          m_stats.total_skipped += skipped;
-          m_stats.total_warnings += warnings;
-        }
-
-        if (warnings_num > 0) {
-          // show first k warnings, where k = warnings_to_show
-          constexpr int warnings_to_show = 5;
-          auto w = load_result->fetch_one_warning();
-
-          for (int i = 0; w && i < warnings_to_show;
-               w = load_result->fetch_one_warning(), i++) {
-            const std::string msg =
-                task + " error " + std::to_string(w->code) + ": " + w->msg;
-
-            switch (w->level) {
-              case mysqlshdk::db::Warning::Level::Error:
-                mysqlsh::current_console()->print_error(msg);
-                break;
-              case mysqlshdk::db::Warning::Level::Warn:
-                mysqlsh::current_console()->print_warning(msg);
-                break;
-              case mysqlshdk::db::Warning::Level::Note:
-                mysqlsh::current_console()->print_note(msg);
-                break;
-            }
-          }
-
-          // log remaining warnings
-          size_t remaining_warnings_count = 0;
-          for (; w; w = load_result->fetch_one_warning()) {
-            remaining_warnings_count++;
-            const std::string msg =
-                task + " error " + std::to_string(w->code) + ": " + w->msg;
-
-            switch (w->level) {
-              case mysqlshdk::db::Warning::Level::Error:
-                log_error("%s", msg.c_str());
-                break;
-              case mysqlshdk::db::Warning::Level::Warn:
-                log_warning("%s", msg.c_str());
-                break;
-              case mysqlshdk::db::Warning::Level::Note:
-                log_info("%s", msg.c_str());
-                break;
-            }
-          }
+        update_stats(mysql_info);
+        report_warnings(load_result.get());
 
-          if (remaining_warnings_count > 0) {
-            mysqlsh::current_console()->print_info(
-                "Check mysqlsh.log for " +
-                std::to_string(remaining_warnings_count) + " more warning" +
-                (remaining_warnings_count == 1 ? "" : "s") + ".");
-          }
+        if (remaining_warnings_count > 0) {
+          mysqlsh::current_console()->print_info(
+              "Check mysqlsh.log for " +
+              std::to_string(remaining_warnings_count) + " more warning" +
+              (remaining_warnings_count == 1 ? "" : "s") + ".");
         }
       }
 
@@ -1048,6 +1105,300 @@ void Load_data_worker::execute(
   }
 }
 
+bool Load_data_worker::execute_bulk(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    const Bulk_load_options &options, int *out_error_code) {
+  const auto worker_name =
+      shcore::str_format("[Worker%03" PRId64 "]: ", m_thread_id);
+
+  setup_session(session);
+
+  const auto query = bulk_load_query(options);
+
+#ifndef NDEBUG
+  log_debug("%s %s", worker_name.c_str(), query.c_str());
+#endif
+
+  try {
+    set_state(Thread_state::READING);
+    session->execute(m_query_comment + query);
+    set_state(Thread_state::IDLE);
+  } catch (const mysqlshdk::db::Error &e) {
+    set_state(Thread_state::IDLE);
+    log_info("%sBulk load of %s.%s has failed: %s", worker_name.c_str(),
+             shcore::quote_identifier(m_opt.schema()).c_str(),
+             shcore::quote_identifier(m_opt.table()).c_str(),
+             e.format().c_str());
+
+    if (out_error_code) {
+      *out_error_code = e.code();
+    }
+
+    return false;
+  }
+
+  *m_prog_sent_bytes += options.data_bytes;
+  *m_prog_file_bytes += options.file_bytes;
+
+  m_stats.total_data_bytes += options.data_bytes;
+  m_stats.total_file_bytes += options.file_bytes;
+  ++m_stats.total_files_processed;
+
+  const char *mysql_info = session->get_mysql_info();
+
+  log_info("%s%s: %s (bulk load)", worker_name.c_str(),
+           options.url.c_str(), mysql_info ? mysql_info : "");
+
+  update_stats(mysql_info);
+
+  return true;
+}
+
+std::string Load_data_worker::bulk_load_query(
+    const Bulk_load_options &options) const {
+  std::string query = shcore::sqlformat("LOAD DATA FROM URL ? ", options.url);
+
+  if (options.in_primary_key_order) {
+    query += "IN PRIMARY KEY ORDER ";
+  }
+
+  query += "INTO TABLE " + shcore::quote_identifier(m_opt.schema()) + '.' +
+           shcore::quote_identifier(m_opt.table()) + ' ';
+
+  if (!m_opt.character_set().empty()) {
+    query += "CHARACTER SET " +
+             shcore::quote_sql_string(m_opt.character_set()) + ' ';
+  }
+
+  if (mysqlshdk::storage::Compression::ZSTD == options.compression) {
+    query += "COMPRESSION = 'ZSTD' ";
+  }
+
+  query += m_opt.dialect().build_sql();
+
+  if (const auto columns = m_opt.columns().get();
+      columns && !columns->empty()) {
+    query += " (" +
+             shcore::str_join(*columns, ", ",
+                              [](const shcore::Value &c) {
+                                return shcore::quote_identifier(c.as_string());
+                              }) +
+             ")";
+  }
+
+  query += " ALGORITHM = BULK";
+
+  return query;
+}
+
+Insert_statements Load_data_worker::create_insert_statements(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session) const {
+  const auto &decode_columns = m_opt.decode_columns();
+  std::vector<Insert_statements::Column> columns;
+
+  const auto add_column = [&decode_columns, &columns](const std::string &name) {
+    Insert_statements::Column column;
+    const auto decode = decode_columns.find(name);
+
+    if (decode_columns.end() == decode) {
+      column.name = shcore::quote_identifier(name);
+    } else if (!decode->second.empty()) {
+      // custom expressions were rejected during validation
+      column.name = shcore::quote_identifier(name);
+      column.decode = decode->second;
+    }
+    // else: field is discarded
+
+    columns.emplace_back(std::move(column));
+  };
+
+  if (const auto c = m_opt.columns().get(); c && !c->empty()) {
+    for (const auto &column : *c) {
+      add_column(column.as_string());
+    }
+  } else {
+    // LOAD DATA without a column list uses all columns which can be written to
+    const auto result = session->queryf(
+        "SELECT COLUMN_NAME FROM information_schema.columns WHERE "
+        "TABLE_SCHEMA=? AND TABLE_NAME=? AND EXTRA NOT LIKE '%GENERATED%' AND "
+        "EXTRA NOT LIKE '%INVISIBLE%' ORDER BY ORDINAL_POSITION",
+        m_opt.schema(), m_opt.table());
+
+    while (const auto row = result->fetch_one()) {
+      add_column(row->get_string(0));
+    }
+  }
+
+  // statements need to fit in the max_allowed_packet
+  std::size_t max_statement_size = 16 * 1024 * 1024;
+
+  {
+    const auto result = session->query("SELECT @@max_allowed_packet");
+
+    if (const auto row = result->fetch_one()) {
+      max_statement_size =
+          std::min<std::size_t>(max_statement_size, row->get_uint(0) / 2);
+    }
+  }
+
+  std::string into = (m_opt.replace_duplicates() ? "REPLACE" : "INSERT IGNORE");
+  into += " INTO " + shcore::quote_identifier(m_opt.schema()) + '.' +
+          shcore::quote_identifier(m_opt.table());
+
+  if (!m_opt.partition().empty()) {
+    into += " PARTITION (" + shcore::quote_identifier(m_opt.partition()) + ")";
+  }
+
+  return Insert_statements{m_opt.dialect(), into, std::move(columns),
+                           max_statement_size};
+}
+
+std::string Load_data_worker::insert_data(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    File_info *fi, Insert_statements *statements,
+    const std::function<void(mysqlshdk::db::IResult *)> &on_result) {
+  size_t records = 0;
+  size_t deleted = 0;
+  size_t skipped = 0;
+  size_t warnings = 0;
+
+  statements->on_statement(
+      [&, this](const std::string &statement, std::size_t rows) {
+        const auto result = session->query(m_query_comment + statement);
+        const auto affected = result->get_affected_row_count();
+
+        records += rows;
+
+        if (m_opt.replace_duplicates()) {
+          // each replaced row is reported as two affected rows
+          deleted += affected - rows;
+        } else {
+          skipped += rows - affected;
+        }
+
+        warnings += result->get_warning_count();
+        on_result(result.get());
+      });
+
+  void *handle = nullptr;
+  local_infile_init(&handle, nullptr, fi);
+
+  session->execute("BEGIN");
+
+  try {
+    // same size LOAD DATA LOCAL INFILE uses to read the data
+    std::string buffer;
+    buffer.resize(128 * 1024);
+
+    int bytes;
+
+    while ((bytes = local_infile_read(fi, buffer.data(), buffer.size())) > 0) {
+      statements->append(buffer.data(), bytes);
+    }
+
+    if (bytes < 0) {
+      char error[512];
+      const auto code = local_infile_error(fi, error, sizeof(error));
+      throw mysqlshdk::db::Error(error, code);
+    }
+
+    statements->finish();
+    local_infile_end(fi);
+
+    session->execute("COMMIT");
+  } catch (...) {
+    try {
+      session->execute("ROLLBACK");
+    } catch (const std::exception &e) {
+      log_warning("Failed to rollback the transaction: %s", e.what());
+    }
+
+    throw;
+  }
+
+  return shcore::str_format(
+      "Records: %zu  Deleted: %zu  Skipped: %zu  Warnings: %zu", records,
+      deleted, skipped, warnings);
+}
+
+void Load_data_worker::setup_session(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session) const {
+  const auto execute = [&session](const auto &sql) { session->execute(sql); };
+  const auto executef = [&session](const auto &sql, auto &&... args) {
+    session->executef(sql, std::forward<decltype(args)>(args)...);
+  };
+
+  if (m_opt.session_ready()) {
+    // state of the session already matches, don't waste the round trips
+    return;
+  }
+
+  // this sets the character_set_database and collation_database server
+  // variables to the values the schema has
+  executef("USE !;", m_opt.schema());
+
+  // session variables are set using a single statement, this is executed for
+  // each chunk of data and tiny chunks are dominated by the round trips
+  auto sql = std::string{
+      // SQL mode:
+      //  - no_auto_value_on_zero - normally, 0 generates the next sequence
+      //    number, use this mode to prevent this behaviour (solves problems if
+      //    dump has 0 stored in an AUTO_INCREMENT column)
+      "SET SQL_MODE = 'no_auto_value_on_zero', "
+      // BUG#34173126, BUG#33360787 - loading when global auto-commit is OFF
+      // fails
+      "autocommit = 1, unique_checks = 0, foreign_key_checks = 0"};
+
+  // if user has specified the character set, set the session variables
+  // related to the client connection
+  if (!m_opt.character_set().empty()) {
+    sql += shcore::sqlformat(", NAMES ?", m_opt.character_set());
+  }
+
+  // transaction_isolation is available since 5.7.20
+  const auto isolation_variable =
+      session->get_server_version() >= mysqlshdk::utils::Version(5, 7, 20);
+
+  if (isolation_variable) {
+    sql += ", SESSION transaction_isolation = 'READ-UNCOMMITTED'";
+  }
+
+  execute(sql);
+
+  if (!isolation_variable) {
+    execute("SET SESSION TRANSACTION ISOLATION LEVEL READ UNCOMMITTED");
+  }
+
+  try {
+    for (const auto &s : m_opt.session_init_sql()) {
+      log_info("Executing custom session init SQL: %s", s.c_str());
+      session->execute(s);
+    }
+  } catch (const shcore::Error &e) {
+    throw shcore::Exception::runtime_error(
+        "Error while executing sessionInitSql: " + e.format());
+  }
+}
+
+void Load_data_worker::update_stats(const char *mysql_info) {
+  if (!mysql_info) {
+    return;
+  }
+
+  size_t records = 0;
+  size_t deleted = 0;
+  size_t skipped = 0;
+  size_t warnings = 0;
+
+  sscanf(mysql_info,
+         "Records: %zu  Deleted: %zu  Skipped: %zu  Warnings: %zu\n", &records,
+         &deleted, &skipped, &warnings);
+  m_stats.total_records += records;
+  m_stats.total_deleted += deleted;
+  m_stats.total_skipped += skipped;
+  m_stats.total_warnings += warnings;
+}
+
 void Load_data_worker::handle_exception() {
   set_state(Thread_state::ERROR);
   m_thread_exception[m_thread_id] = std::current_exception();
@@ -30,16 +30,20 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "modules/util/import_table/chunk_file.h"
+#include "modules/util/import_table/columnar_file.h"
 #include "modules/util/import_table/import_table.h"
 #include "modules/util/import_table/import_table_options.h"
+#include "modules/util/import_table/insert_statements.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
+#include "mysqlshdk/libs/utils/memory_stats.h"
 #include "mysqlshdk/libs/utils/rate_limit.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 
@@ -54,6 +58,18 @@ struct Transaction_options {
   bool fast_sub_chunking = false;
 };
 
+/**
+ * Options of the server-side bulk load, data is read directly by the server.
+ */
+struct Bulk_load_options {
+  std::string url;  //< location of the file, must be reachable by the server
+  mysqlshdk::storage::Compression compression =
+      mysqlshdk::storage::Compression::NONE;
+  bool in_primary_key_order = false;  //< rows are sorted by the primary key
+  uint64_t data_bytes = 0;            //< size of the uncompressed data
+  uint64_t file_bytes = 0;            //< size of the file
+};
+
 class Transaction_buffer {
  public:
   Transaction_buffer() = default;
@@ -82,23 +98,35 @@ class Transaction_buffer {
   }
 
  private:
+  int do_read(char *buffer, unsigned int length);
+
   int fast_sub_chunking(char *buffer, unsigned int length);
 
   int consume(char *buffer, unsigned int length);
 
   int64_t trx_bytes_left() const { return m_options.max_trx_size - m_trx_size; }
 
-  uint64_t (Transaction_buffer::*find_first_row_boundary_after)() const;
-  uint64_t (Transaction_buffer::*find_last_row_boundary_before)(uint64_t);
+  bool read_in_place(char *buffer, unsigned int length, int *out_bytes);
 
-  uint64_t find_first_row_boundary_after_impl_default() const;
-  uint64_t find_last_row_boundary_before_impl_default(uint64_t limit);
+  uint64_t (Transaction_buffer::*find_first_row_boundary_after)(
+      std::string_view data) const;
+  uint64_t (Transaction_buffer::*find_last_row_boundary_before)(
+      std::string_view data, uint64_t limit) const;
 
-  uint64_t find_first_row_boundary_after_impl_no_escape() const;
-  uint64_t find_last_row_boundary_before_impl_no_escape(uint64_t limit);
+  uint64_t find_first_row_boundary_after_impl_default(
+      std::string_view data) const;
+  uint64_t find_last_row_boundary_before_impl_default(std::string_view data,
+                                                      uint64_t limit) const;
 
-  uint64_t find_first_row_boundary_after_impl_escape() const;
-  uint64_t find_last_row_boundary_before_impl_escape(uint64_t limit);
+  uint64_t find_first_row_boundary_after_impl_no_escape(
+      std::string_view data) const;
+  uint64_t find_last_row_boundary_before_impl_no_escape(std::string_view data,
+                                                        uint64_t limit) const;
+
+  uint64_t find_first_row_boundary_after_impl_escape(
+      std::string_view data) const;
+  uint64_t find_last_row_boundary_before_impl_escape(std::string_view data,
+                                                     uint64_t limit) const;
 
   void set_trx_end_offset(uint64_t end) { m_trx_end_offset = m_trx_size + end; }
 
@@ -113,6 +141,7 @@ class Transaction_buffer {
   bool m_eof = false;
 
   std::string m_data;
+  shcore::Tracked_memory m_memory{shcore::Memory_tag::LOAD};
 
   uint64_t m_oversized_rows = 0;
 
@@ -125,12 +154,16 @@ class Transaction_buffer {
  */
 struct File_info {
   mysqlshdk::utils::Rate_limit rate_limit{};  //< Rate limiter
+  //< Rate limiter shared by all threads
+  mysqlshdk::utils::Shared_rate_limit *total_rate_limit = nullptr;
   int64_t max_rate = 0;    //< Max rate value for rate limiter
   int64_t worker_id = -1;  //< Thread worker id
   std::unique_ptr<mysqlshdk::storage::IFile> filehandler = nullptr;
   mysqlshdk::storage::Compressed_file *compressed_file = nullptr;
+  Columnar_chunk_file *columnar_file = nullptr;
   size_t bytes_left = 0;    //< Bytes left to read from file
   bool range_read = false;  //< Reading whole file vs chunk range
+  bool last_range = true;   //< False if there are more ranges of this file
 
   size_t data_bytes = 0;  //< bytes send to MySQL server
   size_t file_bytes = 0;  //< bytes read from the file
@@ -181,7 +214,54 @@ class Load_data_worker final {
                std::unique_ptr<mysqlshdk::storage::IFile> file,
                const Transaction_options &options = {});
 
+  /**
+   * Loads the data using the server-side bulk loader.
+   *
+   * @param session Session used to load the data.
+   * @param options Bulk load options.
+   * @param out_error_code If load fails, set to the error reported by server.
+   *
+   * @returns true if data was loaded, false if the server failed to load it,
+   *          in which case the data can be loaded using execute().
+   */
+  bool execute_bulk(
+      const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+      const Bulk_load_options &options, int *out_error_code = nullptr);
+
  private:
+  void setup_session(
+      const std::shared_ptr<mysqlshdk::db::mysql::Session> &session) const;
+
+  void update_stats(const char *mysql_info);
+
+  /**
+   * Creates the LOAD DATA statement executed by the server-side bulk loader.
+   */
+  std::string bulk_load_query(const Bulk_load_options &options) const;
+
+  /**
+   * Creates the converter used to load the data using INSERT statements.
+   */
+  Insert_statements create_insert_statements(
+      const std::shared_ptr<mysqlshdk::db::mysql::Session> &session) const;
+
+  /**
+   * Loads the data using INSERT statements, reads it the same way as
+   * LOAD DATA LOCAL INFILE does. All statements are executed in a single
+   * transaction.
+   *
+   * @param session Session used to load the data.
+   * @param fi Information about the file.
+   * @param statements Converts the data into statements.
+   * @param on_result Called with the result of each statement.
+   *
+   * @returns summary in the same format as the one reported by LOAD DATA
+   */
+  std::string insert_data(
+      const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+      File_info *fi, Insert_statements *statements,
+      const std::function<void(mysqlshdk::db::IResult *)> &on_result);
+
   void handle_exception();
 
   void set_state(Thread_state new_state);
@@ -196,6 +276,11 @@ class Load_data_worker final {
   Stats &m_stats;
   std::string m_query_comment;
   Thread_state m_state;
+
+#ifdef FRIEND_TEST
+  FRIEND_TEST(import_table, session_setup);
+  FRIEND_TEST(import_table, bulk_load_query);
+#endif
 };
 
 }  // namespace import_table
@@ -0,0 +1,1124 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/parquet_reader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "modules/util/common/parquet/compression.h"
+#include "modules/util/common/parquet/encoding.h"
+#include "modules/util/common/parquet/format.h"
+#include "modules/util/common/parquet/thrift_compact.h"
+#include "modules/util/common/parquet/utils.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+namespace {
+
+using parquet::Byte_reader;
+using parquet::corrupted;
+using parquet::decode_delta_binary_packed;
+using parquet::decode_delta_length_byte_array;
+using parquet::decompress;
+using parquet::read_le;
+using parquet::read_struct;
+using parquet::read_struct_list;
+using parquet::Rle_decoder;
+using parquet::Thrift_compact_reader;
+using parquet::unsupported;
+
+// number of days between the Julian day 0 and the UNIX epoch
+constexpr int64_t k_julian_epoch_day = 2440588;
+
+constexpr int64_t k_nanos_per_day = 86400LL * 1000000000LL;
+
+struct Logical_type {
+  int16_t kind = parquet::LOGICAL_NONE;
+  int32_t scale = 0;
+  bool utc = false;
+  int16_t unit = parquet::MILLIS;
+  int32_t bit_width = 64;
+  bool is_signed = true;
+};
+
+struct Schema_element {
+  int32_t type = -1;
+  int32_t type_length = 0;
+  int32_t repetition = parquet::REQUIRED;
+  std::string name;
+  int32_t num_children = 0;
+  int32_t converted_type = parquet::NONE;
+  int32_t scale = 0;
+  Logical_type logical;
+};
+
+int16_t read_time_unit(Thrift_compact_reader *reader) {
+  int16_t unit = parquet::MILLIS;
+
+  read_struct(reader, [&](int16_t id, uint8_t type) {
+    unit = id;
+    reader->skip(type);
+    return true;
+  });
+
+  return unit;
+}
+
+Logical_type read_logical_type(Thrift_compact_reader *reader) {
+  Logical_type logical;
+
+  // union, a single field is set
+  read_struct(reader, [&](int16_t kind, uint8_t) {
+    logical.kind = kind;
+
+    read_struct(reader, [&](int16_t id, uint8_t type) {
+      switch (kind) {
+        case parquet::LOGICAL_DECIMAL:
+          if (1 == id) {
+            logical.scale = reader->read_i32(type);
+            return true;
+          }
+          break;
+
+        case parquet::LOGICAL_TIME:
+        case parquet::LOGICAL_TIMESTAMP:
+          if (1 == id) {
+            logical.utc = Thrift_compact_reader::read_bool(type);
+            return true;
+          } else if (2 == id) {
+            logical.unit = read_time_unit(reader);
+            return true;
+          }
+          break;
+
+        case parquet::LOGICAL_INTEGER:
+          if (1 == id) {
+            logical.bit_width = reader->read_i32(type);
+            return true;
+          } else if (2 == id) {
+            logical.is_signed = Thrift_compact_reader::read_bool(type);
+            return true;
+          }
+          break;
+      }
+
+      return false;
+    });
+
+    return true;
+  });
+
+  return logical;
+}
+
+Schema_element read_schema_element(Thrift_compact_reader *reader) {
+  Schema_element element;
+
+  read_struct(reader, [&](int16_t id, uint8_t type) {
+    switch (id) {
+      case 1:
+        element.type = reader->read_i32(type);
+        return true;
+
+      case 2:
+        element.type_length = reader->read_i32(type);
+        return true;
+
+      case 3:
+        element.repetition = reader->read_i32(type);
+        return true;
+
+      case 4:
+        element.name = reader->read_binary(type);
+        return true;
+
+      case 5:
+        element.num_children = reader->read_i32(type);
+        return true;
+
+      case 6:
+        element.converted_type = reader->read_i32(type);
+        return true;
+
+      case 7:
+        element.scale = reader->read_i32(type);
+        return true;
+
+      case 10:
+        element.logical = read_logical_type(reader);
+        return true;
+    }
+
+    return false;
+  });
+
+  return element;
+}
+
+int64_t units_per_second(int16_t unit) {
+  switch (unit) {
+    case parquet::MICROS:
+      return 1000000;
+
+    case parquet::NANOS:
+      return 1000000000;
+
+    default:
+      return 1000;
+  }
+}
+
+/**
+ * Maps the type of a column to the type of its values, returns false if type
+ * is not supported.
+ */
+bool column_type(const Schema_element &element, Column_type *type) {
+  using Kind = Column_type::Kind;
+  const auto &logical = element.logical;
+  const auto converted = element.converted_type;
+
+  const auto is_decimal = parquet::LOGICAL_DECIMAL == logical.kind ||
+                          parquet::DECIMAL == converted;
+
+  if (is_decimal) {
+    type->kind = Kind::DECIMAL;
+    type->scale = parquet::LOGICAL_DECIMAL == logical.kind ? logical.scale
+                                                            : element.scale;
+  }
+
+  switch (element.type) {
+    case parquet::BOOLEAN:
+      type->kind = Kind::BOOLEAN;
+      return true;
+
+    case parquet::INT32:
+    case parquet::INT64:
+      if (is_decimal) {
+        return true;
+      }
+
+      if (parquet::LOGICAL_DATE == logical.kind || parquet::DATE == converted) {
+        type->kind = Kind::DATE;
+      } else if (parquet::LOGICAL_TIME == logical.kind) {
+        type->kind = Kind::TIME;
+        type->units_per_second = units_per_second(logical.unit);
+      } else if (parquet::TIME_MILLIS == converted ||
+                 parquet::TIME_MICROS == converted) {
+        type->kind = Kind::TIME;
+        type->units_per_second =
+            units_per_second(parquet::TIME_MILLIS == converted
+                                 ? parquet::MILLIS
+                                 : parquet::MICROS);
+      } else if (parquet::LOGICAL_TIMESTAMP == logical.kind) {
+        type->kind = Kind::TIMESTAMP;
+        type->units_per_second = units_per_second(logical.unit);
+        type->utc = logical.utc;
+      } else if (parquet::TIMESTAMP_MILLIS == converted ||
+                 parquet::TIMESTAMP_MICROS == converted) {
+        type->kind = Kind::TIMESTAMP;
+        type->units_per_second =
+            units_per_second(parquet::TIMESTAMP_MILLIS == converted
+                                 ? parquet::MILLIS
+                                 : parquet::MICROS);
+        // legacy converted types are always adjusted to UTC
+        type->utc = true;
+      } else if ((parquet::LOGICAL_INTEGER == logical.kind &&
+                  !logical.is_signed) ||
+                 (converted >= parquet::UINT_8 &&
+                  converted <= parquet::UINT_64)) {
+        type->kind = Kind::UNSIGNED;
+      } else {
+        type->kind = Kind::SIGNED;
+      }
+
+      return true;
+
+    case parquet::INT96:
+      // legacy timestamp, nanoseconds of the day and a Julian day
+      type->kind = Kind::TIMESTAMP;
+      type->units_per_second = 1000000000;
+      return true;
+
+    case parquet::FLOAT:
+      type->kind = Kind::FLOAT;
+      return true;
+
+    case parquet::DOUBLE:
+      type->kind = Kind::DOUBLE;
+      return true;
+
+    case parquet::BYTE_ARRAY:
+    case parquet::FIXED_LEN_BYTE_ARRAY:
+      if (parquet::LOGICAL_FLOAT16 == logical.kind ||
+          parquet::INTERVAL == converted) {
+        return false;
+      }
+
+      if (!is_decimal) {
+        type->kind = Kind::BYTES;
+      }
+
+      return true;
+  }
+
+  return false;
+}
+
+struct Page_header {
+  int32_t type = -1;
+  int32_t uncompressed_size = 0;
+  int32_t compressed_size = 0;
+  int32_t num_values = 0;
+  int32_t encoding = parquet::PLAIN;
+  int32_t definition_level_encoding = parquet::RLE;
+  // data page v2
+  int32_t definition_levels_length = 0;
+  int32_t repetition_levels_length = 0;
+  bool is_compressed = true;
+};
+
+Page_header read_page_header(Thrift_compact_reader *reader) {
+  Page_header header;
+
+  read_struct(reader, [&](int16_t id, uint8_t type) {
+    switch (id) {
+      case 1:
+        header.type = reader->read_i32(type);
+        return true;
+
+      case 2:
+        header.uncompressed_size = reader->read_i32(type);
+        return true;
+
+      case 3:
+        header.compressed_size = reader->read_i32(type);
+        return true;
+
+      case 5:
+        // data_page_header
+        read_struct(reader, [&](int16_t field, uint8_t field_type) {
+          switch (field) {
+            case 1:
+              header.num_values = reader->read_i32(field_type);
+              return true;
+
+            case 2:
+              header.encoding = reader->read_i32(field_type);
+              return true;
+
+            case 3:
+              header.definition_level_encoding = reader->read_i32(field_type);
+              return true;
+          }
+
+          return false;
+        });
+        return true;
+
+      case 7:
+        // dictionary_page_header
+        read_struct(reader, [&](int16_t field, uint8_t field_type) {
+          switch (field) {
+            case 1:
+              header.num_values = reader->read_i32(field_type);
+              return true;
+
+            case 2:
+              header.encoding = reader->read_i32(field_type);
+              return true;
+          }
+
+          return false;
+        });
+        return true;
+
+      case 8:
+        // data_page_header_v2
+        read_struct(reader, [&](int16_t field, uint8_t field_type) {
+          switch (field) {
+            case 1:
+              header.num_values = reader->read_i32(field_type);
+              return true;
+
+            case 4:
+              header.encoding = reader->read_i32(field_type);
+              return true;
+
+            case 5:
+              header.definition_levels_length = reader->read_i32(field_type);
+              return true;
+
+            case 6:
+              header.repetition_levels_length = reader->read_i32(field_type);
+              return true;
+
+            case 7:
+              header.is_compressed =
+                  Thrift_compact_reader::read_bool(field_type);
+              return true;
+          }
+
+          return false;
+        });
+        return true;
+    }
+
+    return false;
+  });
+
+  if (header.compressed_size < 0 || header.uncompressed_size < 0 ||
+      header.num_values < 0 || header.definition_levels_length < 0 ||
+      header.repetition_levels_length < 0) {
+    corrupted("page header");
+  }
+
+  return header;
+}
+
+std::string encoding_name(int32_t encoding) {
+  switch (encoding) {
+    case parquet::PLAIN:
+      return "PLAIN";
+
+    case parquet::RLE:
+      return "RLE";
+
+    case parquet::DELTA_BINARY_PACKED:
+      return "DELTA_BINARY_PACKED";
+
+    case parquet::DELTA_LENGTH_BYTE_ARRAY:
+      return "DELTA_LENGTH_BYTE_ARRAY";
+
+    case parquet::DELTA_BYTE_ARRAY:
+      return "DELTA_BYTE_ARRAY";
+
+    case parquet::BYTE_STREAM_SPLIT:
+      return "BYTE_STREAM_SPLIT";
+  }
+
+  return std::to_string(encoding);
+}
+
+/**
+ * Reads values of a single column chunk, page by page.
+ */
+class Parquet_column_cursor final : public Column_cursor {
+ public:
+  Parquet_column_cursor(const Parquet_reader::Column_info &column,
+                        const Parquet_reader::Column_chunk_info &chunk,
+                        std::string data, std::string context)
+      : m_column(column),
+        m_codec(chunk.codec),
+        m_data(std::move(data)),
+        m_context(std::move(context)) {}
+
+  void next(std::string *out) override {
+    try {
+      while (m_value >= m_page_values) {
+        read_page();
+      }
+
+      if (m_column.optional && !m_defined[m_value]) {
+        encode::null(out);
+      } else if (m_use_dictionary) {
+        const auto index = m_indices[m_present++];
+
+        if (index >= m_dictionary.size()) {
+          corrupted("page: dictionary index out of range");
+        }
+
+        m_dictionary.append(index, out);
+      } else {
+        m_values.append(m_present++, out);
+      }
+
+      ++m_value;
+    } catch (const std::runtime_error &e) {
+      throw std::runtime_error(m_context + e.what());
+    }
+  }
+
+ private:
+  void read_page() {
+    if (m_offset >= m_data.size()) {
+      corrupted("column chunk: not enough values");
+    }
+
+    Thrift_compact_reader reader{m_data.data() + m_offset,
+                                 m_data.size() - m_offset};
+    const auto header = read_page_header(&reader);
+
+    m_offset += reader.offset();
+
+    if (static_cast<std::size_t>(header.compressed_size) >
+        m_data.size() - m_offset) {
+      corrupted("page: unexpected end of column chunk");
+    }
+
+    const std::string_view page{m_data.data() + m_offset,
+                                static_cast<std::size_t>(
+                                    header.compressed_size)};
+    m_offset += header.compressed_size;
+
+    switch (header.type) {
+      case parquet::DICTIONARY_PAGE:
+        read_dictionary_page(header, page);
+        break;
+
+      case parquet::DATA_PAGE:
+        read_data_page(header, page);
+        break;
+
+      case parquet::DATA_PAGE_V2:
+        read_data_page_v2(header, page);
+        break;
+
+      default:
+        // index pages are skipped
+        break;
+    }
+  }
+
+  void read_dictionary_page(const Page_header &header, std::string_view page) {
+    if (parquet::PLAIN != header.encoding &&
+        parquet::PLAIN_DICTIONARY != header.encoding) {
+      unsupported("Dictionary encoding " + encoding_name(header.encoding));
+    }
+
+    decompress(m_codec, page, header.uncompressed_size, &m_buffer);
+
+    Byte_reader in{m_buffer.data(), m_buffer.size()};
+    m_dictionary.clear();
+    decode_plain(&in, header.num_values, &m_dictionary);
+  }
+
+  void read_data_page(const Page_header &header, std::string_view page) {
+    decompress(m_codec, page, header.uncompressed_size, &m_buffer);
+
+    Byte_reader in{m_buffer.data(), m_buffer.size()};
+    std::size_t present = header.num_values;
+
+    if (m_column.optional) {
+      if (parquet::RLE != header.definition_level_encoding) {
+        unsupported("Definition level encoding " +
+                    encoding_name(header.definition_level_encoding));
+      }
+
+      const auto length = in.le(4);
+      present = read_definition_levels(in.bytes(length), header.num_values);
+    }
+
+    read_values(header, &in, present);
+  }
+
+  void read_data_page_v2(const Page_header &header, std::string_view page) {
+    const std::size_t levels_length = header.repetition_levels_length +
+                                      header.definition_levels_length;
+
+    if (levels_length > page.length() ||
+        levels_length > static_cast<std::size_t>(header.uncompressed_size)) {
+      corrupted("page: invalid length of levels");
+    }
+
+    const auto levels = page.substr(0, levels_length);
+    page.remove_prefix(levels_length);
+
+    if (header.is_compressed) {
+      decompress(m_codec, page, header.uncompressed_size - levels_length,
+                 &m_buffer);
+    } else {
+      m_buffer.assign(page);
+    }
+
+    std::size_t present = header.num_values;
+
+    if (m_column.optional) {
+      present = read_definition_levels(
+          levels.substr(header.repetition_levels_length), header.num_values);
+    }
+
+    Byte_reader in{m_buffer.data(), m_buffer.size()};
+    read_values(header, &in, present);
+  }
+
+  /**
+   * Reads the definition levels, returns number of non-NULL values.
+   */
+  std::size_t read_definition_levels(std::string_view data,
+                                     std::size_t count) {
+    m_levels.resize(count);
+    Rle_decoder{data.data(), data.length(), 1}.decode(count, m_levels.data());
+
+    m_defined.resize(count);
+    std::size_t present = 0;
+
+    for (std::size_t i = 0; i < count; ++i) {
+      m_defined[i] = 0 != m_levels[i];
+      present += m_defined[i];
+    }
+
+    return present;
+  }
+
+  void read_values(const Page_header &header, Byte_reader *in,
+                   std::size_t count) {
+    m_page_values = header.num_values;
+    m_value = 0;
+    m_present = 0;
+    m_use_dictionary = false;
+
+    switch (header.encoding) {
+      case parquet::PLAIN_DICTIONARY:
+      case parquet::RLE_DICTIONARY: {
+        const auto bit_width = count > 0 ? in->byte() : 0;
+
+        m_indices.resize(count);
+        Rle_decoder{in->current(), in->remaining(), bit_width}.decode(
+            count, m_indices.data());
+        m_use_dictionary = true;
+        return;
+      }
+
+      default:
+        break;
+    }
+
+    m_values.clear();
+
+    switch (header.encoding) {
+      case parquet::PLAIN:
+        decode_plain(in, count, &m_values);
+        return;
+
+      case parquet::RLE:
+        if (parquet::BOOLEAN == m_column.physical_type) {
+          read_rle_boolean(in, count);
+          return;
+        }
+        break;
+
+      case parquet::DELTA_BINARY_PACKED:
+        if (parquet::INT32 == m_column.physical_type ||
+            parquet::INT64 == m_column.physical_type) {
+          read_delta_binary_packed(in, count);
+          return;
+        }
+        break;
+
+      case parquet::DELTA_LENGTH_BYTE_ARRAY:
+        if (parquet::BYTE_ARRAY == m_column.physical_type) {
+          read_delta_length_byte_array(in, count);
+          return;
+        }
+        break;
+
+      case parquet::DELTA_BYTE_ARRAY:
+        if (parquet::BYTE_ARRAY == m_column.physical_type ||
+            parquet::FIXED_LEN_BYTE_ARRAY == m_column.physical_type) {
+          read_delta_byte_array(in, count);
+          return;
+        }
+        break;
+
+      case parquet::BYTE_STREAM_SPLIT:
+        if (parquet::BOOLEAN != m_column.physical_type &&
+            parquet::BYTE_ARRAY != m_column.physical_type) {
+          read_byte_stream_split(in, count);
+          return;
+        }
+        break;
+    }
+
+    unsupported("Encoding " + encoding_name(header.encoding));
+  }
+
+  std::size_t value_width() const {
+    switch (m_column.physical_type) {
+      case parquet::INT32:
+      case parquet::FLOAT:
+        return 4;
+
+      case parquet::INT64:
+      case parquet::DOUBLE:
+        return 8;
+
+      case parquet::INT96:
+        return 12;
+
+      case parquet::FIXED_LEN_BYTE_ARRAY:
+        return m_column.type_length;
+    }
+
+    return 0;
+  }
+
+  /**
+   * Encodes a fixed-width value stored as little-endian bytes.
+   */
+  void encode_fixed(const char *value, Encoded_values *values) const {
+    const auto out = values->data();
+    const auto &type = m_column.type;
+
+    switch (m_column.physical_type) {
+      case parquet::INT32: {
+        const auto v = static_cast<uint32_t>(read_le(value, 4));
+
+        if (Column_type::Kind::UNSIGNED == type.kind) {
+          encode::integer(type, v, out);
+        } else {
+          encode::integer(type, static_cast<int32_t>(v), out);
+        }
+
+        break;
+      }
+
+      case parquet::INT64:
+        encode::integer(type, static_cast<int64_t>(read_le(value, 8)), out);
+        break;
+
+      case parquet::INT96: {
+        const auto nanos = static_cast<int64_t>(read_le(value, 8));
+        const auto day = static_cast<int32_t>(read_le(value + 8, 4));
+
+        encode::integer(type, (day - k_julian_epoch_day) * k_nanos_per_day +
+                                  nanos,
+                        out);
+        break;
+      }
+
+      case parquet::FLOAT: {
+        const auto v = static_cast<uint32_t>(read_le(value, 4));
+        float f;
+        ::memcpy(&f, &v, sizeof(f));
+        encode::floating(f, out);
+        break;
+      }
+
+      case parquet::DOUBLE: {
+        const auto v = read_le(value, 8);
+        double d;
+        ::memcpy(&d, &v, sizeof(d));
+        encode::floating(d, out);
+        break;
+      }
+
+      case parquet::FIXED_LEN_BYTE_ARRAY:
+        encode::bytes(type, std::string_view{value, value_width()}, out);
+        break;
+    }
+
+    values->finish();
+  }
+
+  void encode_bytes(std::string_view value, Encoded_values *values) const {
+    encode::bytes(m_column.type, value, values->data());
+    values->finish();
+  }
+
+  void decode_plain(Byte_reader *in, std::size_t count,
+                    Encoded_values *values) const {
+    switch (m_column.physical_type) {
+      case parquet::BOOLEAN: {
+        const auto bits = in->bytes((count + 7) / 8);
+
+        for (std::size_t i = 0; i < count; ++i) {
+          encode::boolean((static_cast<uint8_t>(bits[i / 8]) >> (i % 8)) & 1,
+                          values->data());
+          values->finish();
+        }
+
+        return;
+      }
+
+      case parquet::BYTE_ARRAY:
+        for (std::size_t i = 0; i < count; ++i) {
+          encode_bytes(in->bytes(in->le(4)), values);
+        }
+
+        return;
+    }
+
+    const auto width = value_width();
+
+    if (0 == width) {
+      corrupted("column: invalid type length");
+    }
+
+    const auto data = in->bytes(count * width).data();
+
+    for (std::size_t i = 0; i < count; ++i) {
+      encode_fixed(data + i * width, values);
+    }
+  }
+
+  void read_rle_boolean(Byte_reader *in, std::size_t count) {
+    const auto length = in->le(4);
+    const auto data = in->bytes(length);
+
+    m_levels.resize(count);
+    Rle_decoder{data.data(), data.length(), 1}.decode(count, m_levels.data());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      encode::boolean(0 != m_levels[i], m_values.data());
+      m_values.finish();
+    }
+  }
+
+  void read_delta_binary_packed(Byte_reader *in, std::size_t count) {
+    const auto decoded = decode_delta_binary_packed(in, count);
+
+    if (decoded.size() < count) {
+      corrupted("page: not enough encoded values");
+    }
+
+    char value[8];
+
+    for (std::size_t i = 0; i < count; ++i) {
+      for (int b = 0; b < 8; ++b) {
+        value[b] = static_cast<char>((static_cast<uint64_t>(decoded[i]) >>
+                                      (8 * b)) &
+                                     0xFF);
+      }
+
+      encode_fixed(value, &m_values);
+    }
+  }
+
+  void read_delta_length_byte_array(Byte_reader *in, std::size_t count) {
+    const auto decoded = decode_delta_length_byte_array(in, count);
+
+    if (decoded.size() < count) {
+      corrupted("page: not enough encoded values");
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+      encode_bytes(decoded[i], &m_values);
+    }
+  }
+
+  void read_delta_byte_array(Byte_reader *in, std::size_t count) {
+    const auto prefixes = decode_delta_binary_packed(in, count);
+    const auto suffixes = decode_delta_length_byte_array(in, count);
+
+    if (prefixes.size() < count || suffixes.size() < count) {
+      corrupted("page: not enough encoded values");
+    }
+
+    std::string value;
+
+    for (std::size_t i = 0; i < count; ++i) {
+      if (prefixes[i] < 0 ||
+          static_cast<uint64_t>(prefixes[i]) > value.length()) {
+        corrupted("page: invalid prefix length");
+      }
+
+      value.resize(prefixes[i]);
+      value.append(suffixes[i]);
+
+      if (parquet::FIXED_LEN_BYTE_ARRAY == m_column.physical_type) {
+        if (value.length() != value_width()) {
+          corrupted("page: invalid value length");
+        }
+
+        encode_fixed(value.data(), &m_values);
+      } else {
+        encode_bytes(value, &m_values);
+      }
+    }
+  }
+
+  void read_byte_stream_split(Byte_reader *in, std::size_t count) {
+    const auto width = value_width();
+
+    if (0 == width) {
+      corrupted("column: invalid type length");
+    }
+
+    const auto data = in->bytes(count * width).data();
+    std::string value;
+    value.resize(width);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      for (std::size_t b = 0; b < width; ++b) {
+        value[b] = data[b * count + i];
+      }
+
+      encode_fixed(value.data(), &m_values);
+    }
+  }
+
+  const Parquet_reader::Column_info &m_column;
+  const int32_t m_codec;
+  // compressed pages of the column chunk
+  const std::string m_data;
+  const std::string m_context;
+  std::size_t m_offset = 0;
+
+  // decompressed page
+  std::string m_buffer;
+  std::vector<uint32_t> m_levels;
+
+  Encoded_values m_dictionary;
+  Encoded_values m_values;
+  std::vector<uint32_t> m_indices;
+  bool m_use_dictionary = false;
+
+  // whether each value of the current page is not NULL
+  std::vector<uint8_t> m_defined;
+  // number of values (including NULLs) in the current page
+  std::size_t m_page_values = 0;
+  // index of the next value in the current page
+  std::size_t m_value = 0;
+  // index of the next non-NULL value in the current page
+  std::size_t m_present = 0;
+};
+
+Parquet_reader::Column_chunk_info read_column_chunk(
+    Thrift_compact_reader *reader, uint64_t file_size) {
+  Parquet_reader::Column_chunk_info chunk;
+  int64_t data_page_offset = -1;
+  int64_t dictionary_page_offset = -1;
+  int64_t length = -1;
+
+  read_struct(reader, [&](int16_t id, uint8_t) {
+    switch (id) {
+      case 1:
+        unsupported("Column chunk stored in an external file");
+
+      case 3:
+        // meta_data
+        read_struct(reader, [&](int16_t field, uint8_t field_type) {
+          switch (field) {
+            case 4:
+              chunk.codec = reader->read_i32(field_type);
+              return true;
+
+            case 7:
+              length = reader->read_int(field_type);
+              return true;
+
+            case 9:
+              data_page_offset = reader->read_int(field_type);
+              return true;
+
+            case 11:
+              dictionary_page_offset = reader->read_int(field_type);
+              return true;
+          }
+
+          return false;
+        });
+        return true;
+    }
+
+    return false;
+  });
+
+  // some writers incorrectly set the dictionary offset to 0
+  const auto offset =
+      dictionary_page_offset > 0 && dictionary_page_offset < data_page_offset
+          ? dictionary_page_offset
+          : data_page_offset;
+
+  if (offset < 0 || length < 0 || static_cast<uint64_t>(offset) > file_size ||
+      static_cast<uint64_t>(length) > file_size - offset) {
+    corrupted("metadata: invalid column chunk");
+  }
+
+  chunk.offset = offset;
+  chunk.length = length;
+
+  return chunk;
+}
+
+}  // namespace
+
+Parquet_reader::Parquet_reader(mysqlshdk::storage::IFile *file)
+    : m_file(file) {
+  try {
+    read_metadata();
+  } catch (const std::runtime_error &e) {
+    throw_error(*m_file, e.what());
+  }
+}
+
+void Parquet_reader::read_metadata() {
+  const uint64_t file_size = m_file->file_size();
+
+  if (file_size < 2 * parquet::k_magic_length + 4) {
+    corrupted("file: file is too small");
+  }
+
+  const auto tail = read_range(m_file, file_size - parquet::k_magic_length - 4,
+                               parquet::k_magic_length + 4);
+
+  if (0 == ::memcmp(tail.data() + 4, parquet::k_encrypted_magic,
+                    parquet::k_magic_length)) {
+    unsupported("Encrypted footer");
+  }
+
+  if (0 != ::memcmp(tail.data() + 4, parquet::k_magic,
+                    parquet::k_magic_length)) {
+    corrupted("file: not a Parquet file");
+  }
+
+  const auto footer_length = read_le(tail.data(), 4);
+
+  if (footer_length > file_size - 2 * parquet::k_magic_length - 4) {
+    corrupted("file: invalid footer length");
+  }
+
+  const auto footer = read_range(
+      m_file, file_size - parquet::k_magic_length - 4 - footer_length,
+      footer_length);
+  Thrift_compact_reader reader{footer.data(), footer.size()};
+  std::vector<Schema_element> schema;
+
+  read_struct(&reader, [&](int16_t id, uint8_t type) {
+    switch (id) {
+      case 2:
+        read_struct_list(&reader, type, [&](std::size_t) {
+          schema.emplace_back(read_schema_element(&reader));
+        });
+        return true;
+
+      case 4:
+        read_struct_list(&reader, type, [&](std::size_t) {
+          auto &row_group = m_row_groups.emplace_back();
+
+          read_struct(&reader, [&](int16_t rg_id, uint8_t rg_type) {
+            switch (rg_id) {
+              case 1:
+                read_struct_list(&reader, rg_type, [&](std::size_t) {
+                  row_group.columns.emplace_back(
+                      read_column_chunk(&reader, file_size));
+                });
+                return true;
+
+              case 3:
+                row_group.rows = reader.read_int(rg_type);
+                return true;
+            }
+
+            return false;
+          });
+        });
+        return true;
+    }
+
+    return false;
+  });
+
+  if (schema.empty()) {
+    corrupted("metadata: schema is empty");
+  }
+
+  // first element is the root of the schema
+  const auto column_count = static_cast<std::size_t>(schema[0].num_children);
+
+  if (column_count + 1 != schema.size()) {
+    unsupported("Nested schema");
+  }
+
+  for (std::size_t i = 1; i < schema.size(); ++i) {
+    const auto &element = schema[i];
+
+    if (element.num_children > 0 || parquet::REPEATED == element.repetition) {
+      throw std::runtime_error("column '" + element.name +
+                               "' has a nested type, which is not supported");
+    }
+
+    if (parquet::FIXED_LEN_BYTE_ARRAY == element.type &&
+        element.type_length <= 0) {
+      corrupted("metadata: invalid type length");
+    }
+
+    auto &column = m_column_info.emplace_back();
+    column.name = element.name;
+    column.physical_type = element.type;
+    column.type_length = element.type_length;
+    column.optional = parquet::OPTIONAL == element.repetition;
+
+    if (!column_type(element, &column.type)) {
+      throw std::runtime_error("column '" + element.name +
+                               "' has a type which is not supported");
+    }
+
+    m_columns.emplace_back(element.name);
+  }
+
+  for (const auto &row_group : m_row_groups) {
+    if (row_group.columns.size() != m_columns.size()) {
+      corrupted("metadata: row group has invalid number of columns");
+    }
+
+    if (row_group.rows < 0) {
+      corrupted("metadata: row group has invalid number of rows");
+    }
+
+    uint64_t bytes = 0;
+
+    for (const auto &column : row_group.columns) {
+      bytes += column.length;
+    }
+
+    m_chunk_bytes.emplace_back(bytes);
+  }
+
+  distribute_bytes(file_size, &m_chunk_bytes);
+}
+
+Columnar_chunk Parquet_reader::read_chunk(std::size_t chunk) {
+  const auto &row_group = m_row_groups.at(chunk);
+  Columnar_chunk result;
+
+  result.rows = row_group.rows;
+
+  for (std::size_t i = 0; i < m_column_info.size(); ++i) {
+    const auto &column = row_group.columns[i];
+    std::string data;
+
+    try {
+      data = read_range(m_file, column.offset, column.length);
+    } catch (const std::runtime_error &e) {
+      throw_error(*m_file, e.what());
+    }
+
+    result.columns.emplace_back(std::make_unique<Parquet_column_cursor>(
+        m_column_info[i], column, std::move(data),
+        "Failed to read column '" + m_columns[i] + "' of '" +
+            m_file->full_path().masked() + "': "));
+  }
+
+  return result;
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
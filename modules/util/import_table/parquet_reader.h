@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_IMPORT_TABLE_PARQUET_READER_H_
+#define MODULES_UTIL_IMPORT_TABLE_PARQUET_READER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "modules/util/import_table/columnar_reader.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+/**
+ * Reads Parquet files with a flat schema, each row group is a separate chunk.
+ *
+ * Supports data pages (v1 and v2) using the PLAIN, dictionary, RLE, DELTA_* and
+ * BYTE_STREAM_SPLIT encodings, compressed using SNAPPY, GZIP, ZSTD or LZ4.
+ */
+class Parquet_reader final : public Columnar_reader {
+ public:
+  Parquet_reader() = delete;
+
+  explicit Parquet_reader(mysqlshdk::storage::IFile *file);
+
+  Parquet_reader(const Parquet_reader &) = delete;
+  Parquet_reader(Parquet_reader &&) = delete;
+
+  Parquet_reader &operator=(const Parquet_reader &) = delete;
+  Parquet_reader &operator=(Parquet_reader &&) = delete;
+
+  ~Parquet_reader() override = default;
+
+  const std::vector<std::string> &columns() const override {
+    return m_columns;
+  }
+
+  const std::vector<uint64_t> &chunk_bytes() const override {
+    return m_chunk_bytes;
+  }
+
+  Columnar_chunk read_chunk(std::size_t chunk) override;
+
+  struct Column_info {
+    std::string name;
+    int32_t physical_type = 0;
+    int32_t type_length = 0;
+    bool optional = false;
+    Column_type type;
+  };
+
+  struct Column_chunk_info {
+    int32_t codec = 0;
+    // offset of the first page
+    uint64_t offset = 0;
+    uint64_t length = 0;
+  };
+
+ private:
+  struct Row_group_info {
+    int64_t rows = 0;
+    std::vector<Column_chunk_info> columns;
+  };
+
+  void read_metadata();
+
+  mysqlshdk::storage::IFile *m_file;
+  std::vector<std::string> m_columns;
+  std::vector<uint64_t> m_chunk_bytes;
+  std::vector<Column_info> m_column_info;
+  std::vector<Row_group_info> m_row_groups;
+};
+
+}  // namespace import_table
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_IMPORT_TABLE_PARQUET_READER_H_
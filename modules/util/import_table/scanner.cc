@@ -28,6 +28,8 @@
 #include <limits>
 #include <stdexcept>
 
+#include "mysqlshdk/libs/utils/find_first_of.h"
+
 namespace mysqlsh {
 namespace import_table {
 
@@ -40,6 +42,12 @@ int first_char(const std::string &s) { return s.length() ? s[0] : k_not_used; }
 
 inline bool used(int c) noexcept { return k_not_used != c; }
 
+void append_if_used(int c, std::string *chars) {
+  if (used(c) && std::string::npos == chars->find(static_cast<char>(c))) {
+    chars->push_back(static_cast<char>(c));
+  }
+}
+
 }  // namespace
 
 Scanner::Sequence::Sequence(const std::string &s) {
@@ -76,6 +84,17 @@ Scanner::Scanner(const Dialect &dialect, uint64_t skip_rows)
       std::max({m_fields_terminated_by.length + 1, m_lines_starting_by.length,
                 m_lines_terminated_by.length + 1}));
   m_stack_bottom = m_stack_position = m_stack.data();
+
+  append_if_used(m_escaped_char, &m_row_chars);
+  append_if_used(m_lines_terminated_by.first, &m_row_chars);
+
+  append_if_used(m_lines_starting_by.first, &m_line_start_chars);
+
+  m_field_chars = m_row_chars;
+  append_if_used(m_fields_terminated_by.first, &m_field_chars);
+
+  append_if_used(m_escaped_char, &m_enclosed_field_chars);
+  append_if_used(m_enclosed_char, &m_enclosed_field_chars);
 }
 
 int64_t Scanner::scan(const char *data, std::size_t length) noexcept {
@@ -201,10 +220,28 @@ bool Scanner::contains(const Sequence &s) noexcept {
   return false;
 }
 
+void Scanner::skip_to_any_of(const std::string &chars) noexcept {
+  if (m_stack_position != m_stack_bottom || !m_length) {
+    return;
+  }
+
+  const auto next = mysqlshdk::utils::find_first_of(m_data, m_data + m_length,
+                                                    chars.data(), chars.size());
+
+  m_length -= next - m_data;
+  m_data = next;
+}
+
 bool Scanner::skip_row() noexcept {
   int chr;
 
   while (m_length) {
+    skip_to_any_of(m_row_chars);
+
+    if (!m_length) {
+      break;
+    }
+
     chr = get();
 
     // check for escaped LINES TERMINATED BY sequences
@@ -240,6 +277,12 @@ bool Scanner::skip_line_start() noexcept {
   int chr;
 
   while (m_length) {
+    skip_to_any_of(m_line_start_chars);
+
+    if (!m_length) {
+      break;
+    }
+
     chr = get();
 
     if (chr == m_lines_starting_by.first && contains(m_lines_starting_by)) {
@@ -269,7 +312,18 @@ Scanner::Field_status Scanner::scan_field() noexcept {
     }                                 \
   } while (false)
 
+  // the set of characters which need to be processed does not change while
+  // the field is scanned
+  const auto &chars =
+      used(m_found_enclosed_char) ? m_enclosed_field_chars : m_field_chars;
+
   while (m_length) {
+    skip_to_any_of(chars);
+
+    if (!m_length) {
+      break;
+    }
+
     chr = get();
 
     if (chr == m_escaped_char) {
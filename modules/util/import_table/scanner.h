@@ -119,6 +119,14 @@ class Scanner {
    */
   bool contains(const Sequence &s) noexcept;
 
+  /**
+   * Skips the characters of the block which are not one of the given
+   * characters. Does nothing if there are characters which were pushed back.
+   *
+   * @param chars Characters to look for.
+   */
+  void skip_to_any_of(const std::string &chars) noexcept;
+
   /**
    * Skips characters, looks only for LINES TERMINATED BY sequence, first
    * character of this sequence cannot be escaped.
@@ -151,6 +159,15 @@ class Scanner {
   int m_enclosed_char;
   int m_escaped_char;
 
+  // characters which need to be processed by skip_row()
+  std::string m_row_chars;
+  // characters which need to be processed by skip_line_start()
+  std::string m_line_start_chars;
+  // characters which need to be processed by scan_field()
+  std::string m_field_chars;
+  // same as above, if the field is enclosed
+  std::string m_enclosed_field_chars;
+
   std::string m_stack;
   char *m_stack_bottom;
   char *m_stack_position;
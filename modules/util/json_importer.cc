@@ -27,9 +27,15 @@
 #else
 #include <poll.h>
 #endif
+#include <algorithm>
+#include <condition_variable>
 #include <deque>
+#include <exception>
 #include <istream>
+#include <mutex>
+#include <thread>
 #include <utility>
+#include <vector>
 #include "mysqlshdk/libs/db/mysqlx/session.h"
 #include "mysqlshdk/libs/db/mysqlx/util/setter_any.h"
 #include "mysqlshdk/libs/utils/utils_buffered_input.h"
@@ -37,6 +43,7 @@
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 #include "scripting/shexcept.h"
+#include "shellcore/scoped_contexts.h"
 #include "shellcore/interrupt_handler.h"
 
 namespace mysqlsh {
@@ -181,118 +188,135 @@ Json_importer Prepare_json_import::build() {
  */
 static constexpr const int k_inserts_per_transaction = 8;
 
-Json_importer::Json_importer(
-    const std::shared_ptr<mysqlshdk::db::mysqlx::Session> &session)
-    : m_session(session) {
-  // Safe bandwidth by disabling gtids tracking
-  session->execute("set session session_track_gtids=OFF");
-  auto result = session->query("SELECT @@mysqlx_max_allowed_packet");
-  auto row = result->fetch_one();
-  if (!row)
-    throw std::logic_error("Query result returned fewer rows than expected");
-  m_packet_size_tracker.max_packet = row->get_uint(0);
-}
-
-void Json_importer::set_target_table(const std::string &schema,
-                                     const std::string &table,
-                                     const std::string &column) {
-  m_batch_insert.mutable_collection()->set_name(table);
-  m_batch_insert.mutable_collection()->set_schema(schema);
-  m_batch_insert.mutable_projection()->Add()->set_name(column);
-  m_batch_insert.set_data_model(Mysqlx::Crud::TABLE);
-}
-
-void Json_importer::set_target_collection(const std::string &schema,
-                                          const std::string &collection) {
-  m_batch_insert.mutable_collection()->set_name(collection);
-  m_batch_insert.mutable_collection()->set_schema(schema);
-  m_batch_insert.set_data_model(Mysqlx::Crud::DOCUMENT);
-}
+/*
+ * Number of insert messages which can be sent without waiting for their
+ * responses, hides the network round-trip time.
+ */
+static constexpr const int k_max_pending_inserts = 4;
+
+class Json_importer::Inserter final {
+ public:
+  Inserter(const std::shared_ptr<mysqlshdk::db::mysqlx::Session> &session,
+           const ::Mysqlx::Crud::Insert &target,
+           const std::function<void(uint64_t)> &on_imported)
+      : m_batch_insert(target), m_session(session), m_on_imported(on_imported) {
+    // Safe bandwidth by disabling gtids tracking
+    session->execute("set session session_track_gtids=OFF");
+    auto result = session->query("SELECT @@mysqlx_max_allowed_packet");
+    auto row = result->fetch_one();
+    if (!row)
+      throw std::logic_error("Query result returned fewer rows than expected");
+    m_packet_size_tracker.max_packet = row->get_uint(0);
+
+    // schema and collection target are already set here, so we can cache
+    // mysqlx::crud::insert header size here
+    m_packet_size_tracker.crud_insert_overhead_bytes =
+        m_batch_insert.ByteSizeLong();
+  }
 
-void Json_importer::set_print_callback(
-    const std::function<void(const std::string &)> &callback) {
-  m_print = callback;
-}
+  Inserter(const Inserter &) = delete;
+  Inserter(Inserter &&) = delete;
 
-void Json_importer::print_stats() {
-  using mysqlshdk::utils::format_bytes;
-  using mysqlshdk::utils::format_seconds;
-  using mysqlshdk::utils::format_throughput_items;
+  Inserter &operator=(const Inserter &) = delete;
+  Inserter &operator=(Inserter &&) = delete;
 
-  m_stats.timer.stage_end();
-  double import_time_seconds = m_stats.timer.total_seconds_elapsed();
+  ~Inserter() = default;
 
-  if (m_print) {
-    auto human_bytes = format_bytes(m_stats.bytes_processed);
-    auto human_time = format_seconds(import_time_seconds);
-    const std::string msg =
-        "\nProcessed " + human_bytes + " in " +
-        std::to_string(m_stats.items_processed) +
-        (m_stats.items_processed == 1 ? " document" : " documents") + " in " +
-        human_time + " (" +
-        format_throughput_items("document", "documents",
-                                m_stats.items_processed, import_time_seconds) +
-        ")" + "\nTotal successfully imported documents " +
-        std::to_string(m_stats.documents_successfully_imported) + " (" +
-        format_throughput_items("document", "documents",
-                                m_stats.documents_successfully_imported,
-                                import_time_seconds) +
-        ")\n";
-    m_print(msg);
+  void begin() {
+    m_packet_size_tracker.inserts_in_this_transaction = 0;
+    m_session->execute("START TRANSACTION");
   }
-}
 
-void Json_importer::load_from(const shcore::Document_reader_options &options) {
-  shcore::Buffered_input input{};
-  m_stats.timer.stage_begin("Importing documents");
+  void put(const std::string &item);
 
-  if (!m_file_path.empty()) {
-    auto full_path = shcore::path::expand_user(m_file_path);
-    input.open(full_path);
+  void finish() {
+    flush();
+    commit(true);
   }
 
-  load_from(&input, options);
-}
-
-void Json_importer::load_from(shcore::Buffered_input *input,
-                              const shcore::Document_reader_options &options) {
-  m_stats.items_processed = 0;
-  m_stats.bytes_processed = 0;
-  m_packet_size_tracker.inserts_in_this_transaction = 0;
-
-  // schema and collection target are already set here, so we can cache
-  // mysqlx::crud::insert header size here
-  m_packet_size_tracker.crud_insert_overhead_bytes =
-      m_batch_insert.ByteSizeLong();
+ private:
+  bool recv_response(bool block = false);
+  void recv_all_responses();
+  void flush();
+  void commit(bool final_commit = false);
+  void add_to_request(const std::string &doc);
+  void update_statistics(xcl::XQuery_result *xquery_result);
+
+  ::Mysqlx::Crud::Insert m_batch_insert;
+  std::shared_ptr<mysqlshdk::db::mysqlx::Session> m_session;
+  std::function<void(uint64_t)> m_on_imported;
+
+  struct Packet_size_tracker {
+    /**
+     * Returns protobuf crud insert packet size after new document append with
+     * `doc_size` size.
+     *
+     * @param doc_size Size of document
+     * @return Size of protobuf crud insert packet after new document append
+     * with `doc_size` size.
+     */
+    size_t packet_size(size_t doc_size) const {
+      return packet_size() + doc_size + k_overhead_per_document_bytes;
+    }
 
-  m_session->execute("START TRANSACTION");
+    size_t packet_size() const {
+      return crud_insert_overhead_bytes + bytes_in_insert +
+             rows_in_insert * k_overhead_per_document_bytes;
+    }
 
-  bool cancel = false;
-  shcore::Interrupt_handler intr_handler([&cancel]() -> bool {
-    cancel = true;
-    return false;
-  });
+    /**
+     * Check if we exceed size of mysqlx_max_packet_size after add new document
+     * of size `doc_size`.
+     *
+     * @param doc_size Size of new document.
+     * @return true if packet size exceed mysqlx_max_allowed_packet value, false
+     * otherwise.
+     */
+    bool will_overflow(size_t doc_size) const {
+      size_t packet_size = this->packet_size(doc_size);
+      bool will_overflow_max_packet = packet_size > max_packet;
+      if (rows_in_insert == 0 && will_overflow_max_packet) {
+        constexpr int64_t k_one_gigabyte = 1024 * 1024 * 1024;
+        if (k_one_gigabyte < packet_size) {
+          throw std::invalid_argument(
+              "JSON document is too large. JSON document packet size is "
+              "greater than maximum allowed value for max_allowed_packet and "
+              "mysqlx_max_allowed_packet.");
+        }
+        throw std::invalid_argument(
+            "JSON document is too large. Increase mysqlx_max_allowed_packet "
+            "value to at least " +
+            std::to_string(packet_size + 1) + " bytes.");
+      }
+      return will_overflow_max_packet;
+    }
 
-  shcore::Json_reader reader(input, options);
-  reader.parse_bom();
+    /// Protobuf Crud Insert document header size. This value depend on document
+    /// size, therefore we set this to maximum observed header size.
+    static constexpr size_t k_overhead_per_document_bytes = 44;
 
-  while (!reader.eof() && !cancel) {
-    std::string jd = reader.next();
+    /// Max packet size accepted by target MySQL Server
+    size_t max_packet;
 
-    if (!jd.empty()) {
-      // todo(kg): move jd string all the way to protobuf's
-      // Scalar_String::set_value
-      put(std::move(jd));
-    }
-  }
+    size_t rows_in_insert = 0;
+    size_t bytes_in_insert = 0;
+    int inserts_in_this_transaction = 0;
 
-  flush();
-  commit(true);
+    size_t crud_insert_overhead_bytes = 0;
+  } m_packet_size_tracker;
 
-  if (cancel) throw shcore::cancelled("JSON documents import cancelled.");
-}
+// todo(kg): JSON import to MySQL Server for Windows stuck on vio_ssl_write when
+// MySQL Shell for Windows has SSL and interleave mode enabled. Therefore we
+// disable interleave mode until we fix that problem.
+#ifdef _WIN32
+  const bool m_proto_interleaved = false;
+#else
+  const bool m_proto_interleaved = true;
+#endif
+  int m_pending_response = 0;
+};
 
-void Json_importer::put(const std::string &item) {
+void Json_importer::Inserter::put(const std::string &item) {
   if (m_packet_size_tracker.will_overflow(item.size())) {
     flush();
     if (m_packet_size_tracker.inserts_in_this_transaction >=
@@ -301,25 +325,21 @@ void Json_importer::put(const std::string &item) {
     }
   }
 
-  m_stats.bytes_processed += item.size();
-  m_stats.items_processed++;
   add_to_request(item);
 }
 
-void Json_importer::update_statistics(xcl::XQuery_result *xquery_result) {
+void Json_importer::Inserter::update_statistics(
+    xcl::XQuery_result *xquery_result) {
   if (xquery_result == nullptr) return;
 
   uint64_t affected_rows = 0;
   bool ret = xquery_result->try_get_affected_rows(&affected_rows);
   if (ret) {
-    m_stats.documents_successfully_imported += affected_rows;
-    if (m_print) {
-      m_print(".. " + std::to_string(m_stats.documents_successfully_imported));
-    }
+    m_on_imported(affected_rows);
   }
 }
 
-void Json_importer::recv_response(bool block) {
+bool Json_importer::Inserter::recv_response(bool block) {
   if (m_pending_response > 0) {
     bool should_receive = false;
 
@@ -349,15 +369,28 @@ void Json_importer::recv_response(bool block) {
       update_statistics(result.get());
       if (error) throw mysqlshdk::db::Error(error.what(), error.error());
       m_pending_response--;
+      return true;
     }
   }
+
+  return false;
 }
 
-void Json_importer::flush() {
+void Json_importer::Inserter::recv_all_responses() {
+  while (m_pending_response > 0) recv_response(true);
+}
+
+void Json_importer::Inserter::flush() {
   if (m_packet_size_tracker.rows_in_insert > 0) {
     xcl::XError error;
     if (m_proto_interleaved) {
-      recv_response(true);
+      // consume the responses which have already arrived, wait only if there
+      // are too many inserts in flight
+      while (recv_response(false)) {
+      }
+
+      while (m_pending_response >= k_max_pending_inserts) recv_response(true);
+
       error = m_session->get_driver_obj()->get_protocol().send(m_batch_insert);
       m_pending_response++;
     } else {
@@ -373,10 +406,13 @@ void Json_importer::flush() {
   }
 }
 
-void Json_importer::commit(bool final_commit) {
+void Json_importer::Inserter::commit(bool final_commit) {
   if (m_proto_interleaved) {
     xcl::XError error;
-    recv_response(true);
+    // all inserts need to succeed before the transaction is committed, if any
+    // of them fails, the error is reported here and transaction is rolled back
+    // when session is closed
+    recv_all_responses();
 
     ::Mysqlx::Sql::StmtExecute stmt;
     stmt.set_stmt(!final_commit ? "COMMIT AND CHAIN" : "COMMIT");
@@ -386,7 +422,7 @@ void Json_importer::commit(bool final_commit) {
 
     m_pending_response++;
     if (final_commit) {
-      while (m_pending_response > 0) recv_response(true);
+      recv_all_responses();
     }
   } else {
     m_session->execute(!final_commit ? "COMMIT AND CHAIN" : "COMMIT");
@@ -394,11 +430,278 @@ void Json_importer::commit(bool final_commit) {
   m_packet_size_tracker.inserts_in_this_transaction = 0;
 }
 
-void Json_importer::add_to_request(const std::string &doc) {
+void Json_importer::Inserter::add_to_request(const std::string &doc) {
   auto fields = m_batch_insert.mutable_row()->Add()->mutable_field();
   mysqlshdk::db::mysqlx::util::set_scalar(*fields->Add(), doc);
 
   m_packet_size_tracker.bytes_in_insert += doc.size();
   m_packet_size_tracker.rows_in_insert++;
 }
+
+Json_importer::Json_importer(
+    const std::shared_ptr<mysqlshdk::db::mysqlx::Session> &session)
+    : m_session(session) {}
+
+void Json_importer::set_target_table(const std::string &schema,
+                                     const std::string &table,
+                                     const std::string &column) {
+  m_batch_insert.mutable_collection()->set_name(table);
+  m_batch_insert.mutable_collection()->set_schema(schema);
+  m_batch_insert.mutable_projection()->Add()->set_name(column);
+  m_batch_insert.set_data_model(Mysqlx::Crud::TABLE);
+}
+
+void Json_importer::set_target_collection(const std::string &schema,
+                                          const std::string &collection) {
+  m_batch_insert.mutable_collection()->set_name(collection);
+  m_batch_insert.mutable_collection()->set_schema(schema);
+  m_batch_insert.set_data_model(Mysqlx::Crud::DOCUMENT);
+}
+
+void Json_importer::set_print_callback(
+    const std::function<void(const std::string &)> &callback) {
+  m_print = callback;
+}
+
+void Json_importer::set_threads(uint64_t threads,
+                                const Session_factory &create_session) {
+  m_threads = std::max<uint64_t>(threads, 1);
+  m_create_session = create_session;
+}
+
+void Json_importer::print_stats() {
+  using mysqlshdk::utils::format_bytes;
+  using mysqlshdk::utils::format_seconds;
+  using mysqlshdk::utils::format_throughput_items;
+
+  m_stats.timer.stage_end();
+  double import_time_seconds = m_stats.timer.total_seconds_elapsed();
+
+  if (m_print) {
+    auto human_bytes = format_bytes(m_stats.bytes_processed);
+    auto human_time = format_seconds(import_time_seconds);
+    const std::string msg =
+        "\nProcessed " + human_bytes + " in " +
+        std::to_string(m_stats.items_processed) +
+        (m_stats.items_processed == 1 ? " document" : " documents") + " in " +
+        human_time + " (" +
+        format_throughput_items("document", "documents",
+                                m_stats.items_processed, import_time_seconds) +
+        ")" + "\nTotal successfully imported documents " +
+        std::to_string(m_stats.documents_successfully_imported) + " (" +
+        format_throughput_items("document", "documents",
+                                m_stats.documents_successfully_imported,
+                                import_time_seconds) +
+        ")\n";
+    m_print(msg);
+  }
+}
+
+void Json_importer::load_from(const shcore::Document_reader_options &options) {
+  shcore::Buffered_input input{};
+  m_stats.timer.stage_begin("Importing documents");
+
+  if (!m_file_path.empty()) {
+    auto full_path = shcore::path::expand_user(m_file_path);
+    input.open(full_path);
+  }
+
+  load_from(&input, options);
+}
+
+void Json_importer::load_from(shcore::Buffered_input *input,
+                              const shcore::Document_reader_options &options) {
+  m_stats.items_processed = 0;
+  m_stats.bytes_processed = 0;
+
+  bool cancel = false;
+  shcore::Interrupt_handler intr_handler([&cancel]() -> bool {
+    cancel = true;
+    return false;
+  });
+
+  shcore::Json_reader reader(input, options);
+  reader.parse_bom();
+
+  if (m_threads > 1) {
+    load_from_parallel(&reader, cancel);
+  } else {
+    load_from(&reader, cancel);
+  }
+
+  if (cancel) throw shcore::cancelled("JSON documents import cancelled.");
+}
+
+void Json_importer::load_from(shcore::Json_reader *reader,
+                              const bool &cancel) {
+  Inserter inserter{m_session, m_batch_insert,
+                    [this](uint64_t count) { on_documents_imported(count); }};
+
+  inserter.begin();
+
+  while (!reader->eof() && !cancel) {
+    std::string jd = reader->next();
+
+    if (!jd.empty()) {
+      m_stats.bytes_processed += jd.size();
+      m_stats.items_processed++;
+      // todo(kg): move jd string all the way to protobuf's
+      // Scalar_String::set_value
+      inserter.put(std::move(jd));
+    }
+  }
+
+  inserter.finish();
+}
+
+void Json_importer::load_from_parallel(shcore::Json_reader *reader,
+                                       const bool &cancel) {
+  // documents are handed to the inserting threads in batches of this size
+  static constexpr std::size_t k_batch_size = 1024 * 1024;
+
+  struct {
+    std::deque<std::vector<std::string>> batches;
+    bool eof = false;
+    bool stop = false;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable has_batch;
+    std::condition_variable has_space;
+  } state;
+
+  // at most two batches wait for each thread
+  const auto max_batches = 2 * m_threads;
+  std::mutex stats_mutex;
+
+  const auto fail = [&state]() {
+    std::lock_guard lock{state.mutex};
+
+    if (!state.error) {
+      state.error = std::current_exception();
+    }
+
+    state.stop = true;
+    state.has_batch.notify_all();
+    state.has_space.notify_all();
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(m_threads);
+
+  for (uint64_t i = 0; i < m_threads; ++i) {
+    workers.emplace_back(mysqlsh::spawn_scoped_thread([&, i]() {
+      try {
+        Inserter inserter{0 == i ? m_session : m_create_session(),
+                          m_batch_insert, [&](uint64_t count) {
+                            std::lock_guard lock{stats_mutex};
+                            on_documents_imported(count);
+                          }};
+
+        inserter.begin();
+
+        while (true) {
+          std::vector<std::string> batch;
+
+          {
+            std::unique_lock lock{state.mutex};
+            state.has_batch.wait(lock, [&state]() {
+              return state.stop || state.eof || !state.batches.empty();
+            });
+
+            if (state.stop) {
+              return;
+            }
+
+            if (state.batches.empty()) {
+              break;
+            }
+
+            batch = std::move(state.batches.front());
+            state.batches.pop_front();
+          }
+
+          state.has_space.notify_one();
+
+          for (auto &doc : batch) {
+            inserter.put(std::move(doc));
+          }
+        }
+
+        inserter.finish();
+      } catch (...) {
+        fail();
+      }
+    }));
+  }
+
+  const auto push_batch = [&](std::vector<std::string> &&batch) {
+    std::unique_lock lock{state.mutex};
+    state.has_space.wait(lock, [&]() {
+      return state.stop || state.batches.size() < max_batches;
+    });
+
+    if (!state.stop) {
+      state.batches.emplace_back(std::move(batch));
+      state.has_batch.notify_one();
+    }
+
+    return !state.stop;
+  };
+
+  try {
+    std::vector<std::string> batch;
+    std::size_t batch_size = 0;
+
+    while (!reader->eof() && !cancel) {
+      std::string jd = reader->next();
+
+      if (!jd.empty()) {
+        m_stats.bytes_processed += jd.size();
+        m_stats.items_processed++;
+
+        batch_size += jd.size();
+        batch.emplace_back(std::move(jd));
+
+        if (batch_size >= k_batch_size) {
+          if (!push_batch(std::move(batch))) {
+            break;
+          }
+
+          batch.clear();
+          batch_size = 0;
+        }
+      }
+    }
+
+    if (!batch.empty()) {
+      push_batch(std::move(batch));
+    }
+  } catch (...) {
+    fail();
+  }
+
+  {
+    std::lock_guard lock{state.mutex};
+    state.eof = true;
+  }
+
+  state.has_batch.notify_all();
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  if (state.error) {
+    std::rethrow_exception(state.error);
+  }
+}
+
+void Json_importer::on_documents_imported(uint64_t count) {
+  m_stats.documents_successfully_imported += count;
+
+  if (m_print) {
+    m_print(".. " + std::to_string(m_stats.documents_successfully_imported));
+  }
+}
+
 }  // namespace mysqlsh
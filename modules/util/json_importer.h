@@ -24,6 +24,7 @@
 #ifndef MODULES_UTIL_JSON_IMPORTER_H_
 #define MODULES_UTIL_JSON_IMPORTER_H_
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -183,6 +184,9 @@ class Prepare_json_import {
 
 class Json_importer {
  public:
+  using Session_factory =
+      std::function<std::shared_ptr<mysqlshdk::db::mysqlx::Session>()>;
+
   explicit Json_importer(
       const std::shared_ptr<mysqlshdk::db::mysqlx::Session> &session);
   ~Json_importer() {}
@@ -199,91 +203,37 @@ class Json_importer {
    * @param path Path to JSON document. Empty path enables read from stdin.
    */
   void set_path(const std::string &path) { m_file_path = path; }
+
+  /**
+   * Sets number of threads inserting the documents.
+   *
+   * @param threads Number of threads, each one uses its own session.
+   * @param create_session Creates the sessions used by the additional
+   *        threads, the first thread uses the session given to the
+   *        constructor.
+   */
+  void set_threads(uint64_t threads, const Session_factory &create_session);
+
   void load_from(const shcore::Document_reader_options &options);
 
   void print_stats();
 
  private:
+  class Inserter;
+
   void load_from(shcore::Buffered_input *input,
                  const shcore::Document_reader_options &options);
-  void put(const std::string &item);
-  void recv_response(bool block = false);
-  void flush();
-  void commit(bool final_commit = false);
-  void add_to_request(const std::string &doc);
-  void update_statistics(xcl::XQuery_result *xquery_result);
+  void load_from(shcore::Json_reader *reader, const bool &cancel);
+  void load_from_parallel(shcore::Json_reader *reader, const bool &cancel);
+  void on_documents_imported(uint64_t count);
 
+  /// Holds the target of the import, copied by each inserter.
   ::Mysqlx::Crud::Insert m_batch_insert;
   std::shared_ptr<mysqlshdk::db::mysqlx::Session> m_session;
 
-  struct Packet_size_tracker {
-    /**
-     * Returns protobuf crud insert packet size after new document append with
-     * `doc_size` size.
-     *
-     * @param doc_size Size of document
-     * @return Size of protobuf crud insert packet after new document append
-     * with `doc_size` size.
-     */
-    size_t packet_size(size_t doc_size) const {
-      return packet_size() + doc_size + k_overhead_per_document_bytes;
-    }
-
-    size_t packet_size() const {
-      return crud_insert_overhead_bytes + bytes_in_insert +
-             rows_in_insert * k_overhead_per_document_bytes;
-    }
-
-    /**
-     * Check if we exceed size of mysqlx_max_packet_size after add new document
-     * of size `doc_size`.
-     *
-     * @param doc_size Size of new document.
-     * @return true if packet size exceed mysqlx_max_allowed_packet value, false
-     * otherwise.
-     */
-    bool will_overflow(size_t doc_size) const {
-      size_t packet_size = this->packet_size(doc_size);
-      bool will_overflow_max_packet = packet_size > max_packet;
-      if (rows_in_insert == 0 && will_overflow_max_packet) {
-        constexpr int64_t k_one_gigabyte = 1024 * 1024 * 1024;
-        if (k_one_gigabyte < packet_size) {
-          throw std::invalid_argument(
-              "JSON document is too large. JSON document packet size is "
-              "greater than maximum allowed value for max_allowed_packet and "
-              "mysqlx_max_allowed_packet.");
-        }
-        throw std::invalid_argument(
-            "JSON document is too large. Increase mysqlx_max_allowed_packet "
-            "value to at least " +
-            std::to_string(packet_size + 1) + " bytes.");
-      }
-      return will_overflow_max_packet;
-    }
+  uint64_t m_threads = 1;
+  Session_factory m_create_session;
 
-    /// Protobuf Crud Insert document header size. This value depend on document
-    /// size, therefore we set this to maximum observed header size.
-    static constexpr size_t k_overhead_per_document_bytes = 44;
-
-    /// Max packet size accepted by target MySQL Server
-    size_t max_packet;
-
-    size_t rows_in_insert = 0;
-    size_t bytes_in_insert = 0;
-    int inserts_in_this_transaction = 0;
-
-    size_t crud_insert_overhead_bytes = 0;
-  } m_packet_size_tracker;
-
-// todo(kg): JSON import to MySQL Server for Windows stuck on vio_ssl_write when
-// MySQL Shell for Windows has SSL and interleave mode enabled. Therefore we
-// disable interleave mode until we fix that problem.
-#ifdef _WIN32
-  const bool m_proto_interleaved = false;
-#else
-  const bool m_proto_interleaved = true;
-#endif
-  int m_pending_response = 0;
   std::function<void(const std::string &)> m_print = nullptr;
 
   struct {
@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/chunk_prefetcher.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+
+namespace mysqlsh {
+
+using mysqlshdk::storage::IFile;
+using mysqlshdk::storage::Mode;
+
+struct Chunk_prefetcher::Entry {
+  enum class Status {
+    QUEUED,
+    FETCHING,
+    READY,
+    FAILED,
+    CANCELLED,
+  };
+
+  std::unique_ptr<IFile> file;
+  std::size_t size = 0;
+  Status status = Status::QUEUED;
+  std::string data;
+  // set once the memory reserved by this entry is returned
+  bool released = false;
+  // memory reserved from the shared budget
+  Memory_budget::Reservation reservation;
+  // set if file handle was destroyed while file was being fetched
+  bool discard = false;
+};
+
+struct Chunk_prefetcher::State {
+  State(std::size_t memory, Memory_budget *b)
+      : max_memory(memory), budget(b) {}
+
+  void release(Entry *entry) {
+    if (!entry->released) {
+      entry->released = true;
+      memory_used -= entry->size;
+      entry->reservation.reset();
+    }
+  }
+
+  const std::size_t max_memory;
+  Memory_budget *const budget;
+  std::size_t memory_used = 0;
+  // set when prefetcher is being destroyed, queued files are not fetched
+  bool stopped = false;
+
+  shcore::Synchronized_queue<std::shared_ptr<Entry>> queue;
+  // entries which were scheduled, but not yet obtained
+  std::unordered_map<std::string, std::shared_ptr<Entry>> entries;
+
+  mutable std::mutex mutex;
+  std::condition_variable cv;
+};
+
+class Chunk_prefetcher::Prefetched_file final : public IFile {
+ public:
+  Prefetched_file(std::shared_ptr<State> state, std::shared_ptr<Entry> entry)
+      : m_state(std::move(state)), m_entry(std::move(entry)) {}
+
+  Prefetched_file(const Prefetched_file &) = delete;
+  Prefetched_file(Prefetched_file &&) = delete;
+
+  Prefetched_file &operator=(const Prefetched_file &) = delete;
+  Prefetched_file &operator=(Prefetched_file &&) = delete;
+
+  ~Prefetched_file() override {
+    if (is_open()) {
+      close();
+    } else {
+      cancel();
+    }
+  }
+
+  void open(Mode m) override {
+    if (Mode::READ != m) {
+      throw std::invalid_argument(
+          "Prefetched_file: only READ mode is supported");
+    }
+
+    {
+      std::unique_lock lock{m_state->mutex};
+
+      if (Entry::Status::QUEUED == m_entry->status) {
+        // download did not start yet, read the file directly
+        m_entry->status = Entry::Status::CANCELLED;
+        m_state->release(m_entry.get());
+      }
+
+      m_state->cv.wait(lock, [this]() {
+        return Entry::Status::FETCHING != m_entry->status;
+      });
+
+      m_direct = Entry::Status::READY != m_entry->status;
+
+      if (m_direct) {
+        m_state->release(m_entry.get());
+      }
+    }
+
+    if (m_direct) {
+      m_entry->file->open(m);
+    }
+
+    m_offset = 0;
+    m_is_open = true;
+  }
+
+  bool is_open() const override { return m_is_open; }
+
+  int error() const override { return m_direct ? m_entry->file->error() : 0; }
+
+  void close() override {
+    if (m_direct) {
+      m_entry->file->close();
+    }
+
+    m_is_open = false;
+
+    std::lock_guard lock{m_state->mutex};
+    std::string().swap(m_entry->data);
+    m_state->release(m_entry.get());
+  }
+
+  size_t file_size() const override { return m_entry->size; }
+
+  mysqlshdk::Masked_string full_path() const override {
+    return m_entry->file->full_path();
+  }
+
+  std::string filename() const override { return m_entry->file->filename(); }
+
+  bool exists() const override { return true; }
+
+  std::unique_ptr<mysqlshdk::storage::IDirectory> parent() const override {
+    return m_entry->file->parent();
+  }
+
+  off64_t seek(off64_t offset) override {
+    if (m_direct) {
+      return m_entry->file->seek(offset);
+    }
+
+    m_offset = std::min(static_cast<std::size_t>(offset), m_entry->data.size());
+    return m_offset;
+  }
+
+  off64_t tell() const override {
+    return m_direct ? m_entry->file->tell() : m_offset;
+  }
+
+  ssize_t read(void *buffer, size_t length) override {
+    if (m_direct) {
+      return m_entry->file->read(buffer, length);
+    }
+
+    length = std::min(length, m_entry->data.size() - m_offset);
+    ::memcpy(buffer, m_entry->data.data() + m_offset, length);
+    m_offset += length;
+
+    return length;
+  }
+
+  ssize_t write(const void *, size_t) override {
+    throw std::logic_error("Prefetched_file::write() - not supported");
+  }
+
+  bool flush() override {
+    throw std::logic_error("Prefetched_file::flush() - not supported");
+  }
+
+  bool is_local() const override { return m_entry->file->is_local(); }
+
+  void rename(const std::string &) override {
+    throw std::logic_error("Prefetched_file::rename() - not supported");
+  }
+
+  void remove() override {
+    throw std::logic_error("Prefetched_file::remove() - not supported");
+  }
+
+ private:
+  void cancel() {
+    std::lock_guard lock{m_state->mutex};
+
+    if (Entry::Status::QUEUED == m_entry->status) {
+      m_entry->status = Entry::Status::CANCELLED;
+    }
+
+    if (Entry::Status::FETCHING == m_entry->status) {
+      // memory is going to be released once download is done
+      m_entry->discard = true;
+    } else {
+      std::string().swap(m_entry->data);
+      m_state->release(m_entry.get());
+    }
+  }
+
+  std::shared_ptr<State> m_state;
+  std::shared_ptr<Entry> m_entry;
+  bool m_is_open = false;
+  // true if the download has failed or was cancelled
+  bool m_direct = false;
+  std::size_t m_offset = 0;
+};
+
+Chunk_prefetcher::Chunk_prefetcher(std::size_t threads, std::size_t memory,
+                                   Memory_budget *budget)
+    : m_state(std::make_shared<State>(memory, budget)) {
+  if (0 == threads) {
+    throw std::invalid_argument("Chunk_prefetcher: need at least one thread");
+  }
+
+  m_workers.reserve(threads);
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    m_workers.emplace_back(mysqlsh::spawn_scoped_thread([this]() {
+      while (const auto entry = m_state->queue.pop()) {
+        fetch(entry.get());
+      }
+    }));
+  }
+}
+
+Chunk_prefetcher::~Chunk_prefetcher() {
+  {
+    std::lock_guard lock{m_state->mutex};
+    m_state->stopped = true;
+  }
+
+  m_state->queue.shutdown(m_workers.size());
+
+  for (auto &worker : m_workers) {
+    worker.join();
+  }
+}
+
+bool Chunk_prefetcher::prefetch(std::unique_ptr<IFile> file,
+                                std::size_t size) {
+  auto name = file->filename();
+  std::shared_ptr<Entry> entry;
+
+  {
+    std::lock_guard lock{m_state->mutex};
+
+    if (m_state->entries.count(name) ||
+        m_state->memory_used + size > m_state->max_memory) {
+      return false;
+    }
+
+    Memory_budget::Reservation reservation;
+
+    if (m_state->budget &&
+        !(reservation = m_state->budget->try_acquire(size))) {
+      return false;
+    }
+
+    entry = std::make_shared<Entry>();
+    entry->file = std::move(file);
+    entry->size = size;
+    entry->reservation = std::move(reservation);
+
+    m_state->memory_used += size;
+    m_state->entries.emplace(std::move(name), entry);
+  }
+
+  m_state->queue.push(std::move(entry));
+
+  return true;
+}
+
+bool Chunk_prefetcher::is_prefetched(const std::string &name) const {
+  std::lock_guard lock{m_state->mutex};
+  return m_state->entries.count(name) > 0;
+}
+
+std::unique_ptr<IFile> Chunk_prefetcher::file(const std::string &name) {
+  std::shared_ptr<Entry> entry;
+
+  {
+    std::lock_guard lock{m_state->mutex};
+    const auto it = m_state->entries.find(name);
+
+    if (m_state->entries.end() == it) {
+      return nullptr;
+    }
+
+    entry = std::move(it->second);
+    m_state->entries.erase(it);
+  }
+
+  return std::make_unique<Prefetched_file>(m_state, std::move(entry));
+}
+
+std::size_t Chunk_prefetcher::memory_used() const {
+  std::lock_guard lock{m_state->mutex};
+  return m_state->memory_used;
+}
+
+void Chunk_prefetcher::fetch(Entry *entry) {
+  {
+    std::lock_guard lock{m_state->mutex};
+
+    if (Entry::Status::QUEUED != entry->status) {
+      return;
+    }
+
+    if (m_state->stopped) {
+      entry->status = Entry::Status::CANCELLED;
+      m_state->release(entry);
+      return;
+    }
+
+    entry->status = Entry::Status::FETCHING;
+  }
+
+  std::string data;
+  auto status = Entry::Status::READY;
+
+  try {
+    const auto file = entry->file.get();
+
+    file->open(Mode::READ);
+
+    data.resize(entry->size);
+    std::size_t offset = 0;
+
+    while (true) {
+      if (offset == data.size()) {
+        // file could have grown, make sure there's some space for more data
+        data.resize(data.size() + std::max<std::size_t>(data.size() / 2, 4096));
+      }
+
+      const auto bytes = file->read(data.data() + offset, data.size() - offset);
+
+      if (bytes < 0) {
+        throw std::runtime_error("Failed to read '" +
+                                 file->full_path().masked() +
+                                 "', error: " + std::to_string(file->error()));
+      }
+
+      if (0 == bytes) {
+        break;
+      }
+
+      offset += bytes;
+    }
+
+    file->close();
+    data.resize(offset);
+  } catch (const std::exception &e) {
+    // the file is going to be read directly when it's opened
+    log_warning("Failed to prefetch '%s': %s",
+                entry->file->full_path().masked().c_str(), e.what());
+
+    if (entry->file->is_open()) {
+      entry->file->close();
+    }
+
+    std::string().swap(data);
+    status = Entry::Status::FAILED;
+  }
+
+  {
+    std::lock_guard lock{m_state->mutex};
+
+    if (entry->discard) {
+      // file was destroyed while it was being fetched
+      std::string().swap(data);
+    }
+
+    entry->data = std::move(data);
+    entry->status = status;
+
+    if (Entry::Status::READY != status || entry->discard) {
+      m_state->release(entry);
+    }
+  }
+
+  m_state->cv.notify_all();
+}
+
+}  // namespace mysqlsh
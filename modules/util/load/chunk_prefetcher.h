@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_CHUNK_PREFETCHER_H_
+#define MODULES_UTIL_LOAD_CHUNK_PREFETCHER_H_
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "modules/util/load/memory_budget.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+
+/**
+ * Downloads the data files in the background, before they are loaded, so that
+ * the loader threads do not have to wait for the first byte of the file to
+ * arrive from the remote storage.
+ *
+ * Contents of the files are held in memory, total size of files which are
+ * being prefetched is limited. Files which do not fit in the memory budget
+ * are not prefetched.
+ */
+class Chunk_prefetcher final {
+ public:
+  Chunk_prefetcher() = delete;
+
+  /**
+   * Creates the prefetcher.
+   *
+   * @param threads Number of threads used to download the files.
+   * @param memory Maximum amount of memory held by the prefetched files.
+   * @param budget If set, memory of the prefetched files is also reserved
+   *        from this budget, files are not prefetched if it runs out. Must
+   *        outlive the prefetcher and the files it provides.
+   */
+  Chunk_prefetcher(std::size_t threads, std::size_t memory,
+                   Memory_budget *budget = nullptr);
+
+  Chunk_prefetcher(const Chunk_prefetcher &) = delete;
+  Chunk_prefetcher(Chunk_prefetcher &&) = delete;
+
+  Chunk_prefetcher &operator=(const Chunk_prefetcher &) = delete;
+  Chunk_prefetcher &operator=(Chunk_prefetcher &&) = delete;
+
+  ~Chunk_prefetcher();
+
+  /**
+   * Schedules the given file to be downloaded, if it's not already scheduled
+   * and it fits in the memory budget.
+   *
+   * @param file File to be downloaded.
+   * @param size Size of the file.
+   *
+   * @returns true if file was scheduled
+   */
+  bool prefetch(std::unique_ptr<mysqlshdk::storage::IFile> file,
+                std::size_t size);
+
+  /**
+   * Checks if the given file was scheduled to be downloaded.
+   *
+   * @param name Name of the file.
+   */
+  bool is_prefetched(const std::string &name) const;
+
+  /**
+   * Provides handle of a file which was scheduled to be downloaded. File can
+   * be obtained only once. Opening the file waits for the download to finish,
+   * if the download is still queued, it's cancelled and the file is read
+   * directly. Memory is released once the file is closed.
+   *
+   * @param name Name of the file.
+   *
+   * @returns file handle, or nullptr if file was not scheduled
+   */
+  std::unique_ptr<mysqlshdk::storage::IFile> file(const std::string &name);
+
+  /**
+   * Memory currently held by the prefetched files.
+   */
+  std::size_t memory_used() const;
+
+ private:
+  struct Entry;
+
+  struct State;
+
+  class Prefetched_file;
+
+  void fetch(Entry *entry);
+
+  std::shared_ptr<State> m_state;
+  std::vector<std::thread> m_workers;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_CHUNK_PREFETCHER_H_
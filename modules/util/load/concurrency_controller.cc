@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/concurrency_controller.h"
+
+#include <algorithm>
+#include <exception>
+
+#include "mysqlshdk/libs/db/result.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlsh {
+
+namespace {
+
+// long history list slows down the queries and means that purge is lagging
+constexpr uint64_t k_max_history_length = 1000000;
+
+// allowed replication lag, in seconds
+constexpr uint64_t k_max_replica_lag = 30;
+
+}  // namespace
+
+Concurrency_controller::Concurrency_controller(uint64_t min, uint64_t max)
+    : m_min(std::max<uint64_t>(min, 1)),
+      m_max(std::max(m_min, max)),
+      m_limit(m_min) {}
+
+std::string Concurrency_controller::update(const Metrics &metrics) {
+  auto reason = pressure(metrics);
+
+  if (metrics.buffer_pool_wait_free.has_value()) {
+    m_buffer_pool_wait_free = metrics.buffer_pool_wait_free;
+  }
+
+  if (reason.empty()) {
+    m_limit = std::min(m_max, m_limit + 1);
+  } else {
+    m_limit = std::max(m_min, m_limit / 2);
+  }
+
+  return reason;
+}
+
+std::string Concurrency_controller::pressure(const Metrics &metrics) const {
+  if (metrics.history_length.value_or(0) > k_max_history_length) {
+    return "history list length is " +
+           std::to_string(*metrics.history_length);
+  }
+
+  if (metrics.buffer_pool_wait_free.has_value() &&
+      m_buffer_pool_wait_free.has_value() &&
+      *metrics.buffer_pool_wait_free > *m_buffer_pool_wait_free) {
+    return "threads are waiting for free pages in the buffer pool";
+  }
+
+  if (metrics.checkpoint_age.has_value() &&
+      metrics.max_checkpoint_age.value_or(0) > 0 &&
+      *metrics.checkpoint_age > *metrics.max_checkpoint_age) {
+    return "checkpoint age is " + std::to_string(*metrics.checkpoint_age);
+  }
+
+  if (metrics.replica_lag.value_or(0) > k_max_replica_lag) {
+    return "replication lag is " + std::to_string(*metrics.replica_lag) +
+           " seconds";
+  }
+
+  return {};
+}
+
+Concurrency_controller::Metrics Concurrency_controller::sample(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    const mysqlshdk::utils::Version &version) {
+  Metrics metrics;
+
+  try {
+    // these metrics are enabled by default
+    const auto result = session->query(
+        "SELECT NAME, COUNT FROM information_schema.INNODB_METRICS WHERE NAME "
+        "IN ('trx_rseg_history_len', 'log_lsn_checkpoint_age', "
+        "'log_max_modified_age_async') AND STATUS = 'enabled'");
+
+    while (const auto row = result->fetch_one()) {
+      const auto name = row->get_string(0);
+      const auto count =
+          static_cast<uint64_t>(std::max<int64_t>(row->get_int(1), 0));
+
+      if ("trx_rseg_history_len" == name) {
+        metrics.history_length = count;
+      } else if ("log_lsn_checkpoint_age" == name) {
+        metrics.checkpoint_age = count;
+      } else {
+        metrics.max_checkpoint_age = count;
+      }
+    }
+  } catch (const std::exception &e) {
+    log_debug("Failed to read InnoDB metrics: %s", e.what());
+  }
+
+  try {
+    if (const auto row = session->query(
+                             "SHOW GLOBAL STATUS LIKE "
+                             "'Innodb_buffer_pool_wait_free'")
+                             ->fetch_one()) {
+      metrics.buffer_pool_wait_free = row->get_uint(1);
+    }
+  } catch (const std::exception &e) {
+    log_debug("Failed to read Innodb_buffer_pool_wait_free: %s", e.what());
+  }
+
+  try {
+    const auto replica = version >= mysqlshdk::utils::Version(8, 0, 22);
+    const auto result =
+        session->query(replica ? "SHOW REPLICA STATUS" : "SHOW SLAVE STATUS");
+    const auto column =
+        replica ? "Seconds_Behind_Source" : "Seconds_Behind_Master";
+
+    // multiple rows if there are many replication channels
+    while (const auto row = result->fetch_one_named()) {
+      if (!row.is_null(column)) {
+        metrics.replica_lag =
+            std::max(metrics.replica_lag.value_or(0), row.get_uint(column));
+      }
+    }
+  } catch (const std::exception &e) {
+    log_debug("Failed to read replication status: %s", e.what());
+  }
+
+  return metrics;
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_CONCURRENCY_CONTROLLER_H_
+#define MODULES_UTIL_LOAD_CONCURRENCY_CONTROLLER_H_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/utils/version.h"
+
+namespace mysqlsh {
+
+/**
+ * Adjusts the number of threads which are allowed to load the data, based on
+ * the back-pressure reported by the target instance. Number of threads is
+ * halved if the instance is under pressure, and increased by one otherwise.
+ */
+class Concurrency_controller final {
+ public:
+  /**
+   * Metrics sampled from the target instance, unset if not available.
+   */
+  struct Metrics {
+    // length of the InnoDB history list
+    std::optional<uint64_t> history_length;
+    // cumulative value of Innodb_buffer_pool_wait_free
+    std::optional<uint64_t> buffer_pool_wait_free;
+    // current checkpoint age, and the age at which async flushing starts
+    std::optional<uint64_t> checkpoint_age;
+    std::optional<uint64_t> max_checkpoint_age;
+    // Seconds_Behind_Source, if target is a replica
+    std::optional<uint64_t> replica_lag;
+  };
+
+  Concurrency_controller() = delete;
+
+  /**
+   * Creates the controller, initial limit is set to the minimum value.
+   *
+   * @param min Minimum number of threads.
+   * @param max Maximum number of threads.
+   */
+  Concurrency_controller(uint64_t min, uint64_t max);
+
+  Concurrency_controller(const Concurrency_controller &) = delete;
+  Concurrency_controller(Concurrency_controller &&) = default;
+
+  Concurrency_controller &operator=(const Concurrency_controller &) = delete;
+  Concurrency_controller &operator=(Concurrency_controller &&) = default;
+
+  ~Concurrency_controller() = default;
+
+  /**
+   * Current number of threads allowed to execute tasks.
+   */
+  uint64_t limit() const { return m_limit; }
+
+  /**
+   * Adjusts the limit using the given metrics.
+   *
+   * @param metrics Metrics of the target instance.
+   *
+   * @returns reason of the back-pressure, empty if there's none
+   */
+  std::string update(const Metrics &metrics);
+
+  /**
+   * Samples the metrics of the target instance, metrics which cannot be read
+   * are not set.
+   */
+  static Metrics sample(
+      const std::shared_ptr<mysqlshdk::db::ISession> &session,
+      const mysqlshdk::utils::Version &version);
+
+ private:
+  std::string pressure(const Metrics &metrics) const;
+
+  uint64_t m_min;
+  uint64_t m_max;
+  uint64_t m_limit;
+
+  std::optional<uint64_t> m_buffer_pool_wait_free;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_CONCURRENCY_CONTROLLER_H_
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/ddl_batch.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace mysqlsh {
+
+std::size_t Ddl_batch::tables_to_add(std::size_t pending_tables,
+                                     uint64_t threads) {
+  return std::min(k_max_tables - 1,
+                  pending_tables / static_cast<std::size_t>(
+                                       std::max<uint64_t>(threads, 1)));
+}
+
+void Ddl_batch::add(
+    const std::string &script, const Transform &transform,
+    const mysqlshdk::utils::Sql_splitter::Error_callback &on_error) {
+  std::stringstream stream(script);
+  auto count = statements();
+
+  mysqlshdk::utils::iterate_sql_stream(
+      &stream, 1024 * 64,
+      [this, &transform, &count](std::string_view s, std::string_view, size_t,
+                                 size_t) {
+        std::string new_stmt;
+
+        if (transform && transform(s, &new_stmt)) s = new_stmt;
+
+        if (!s.empty()) {
+          m_sql += s;
+          // statement may end with a comment
+          m_sql += "\n;\n";
+          ++count;
+        }
+
+        return true;
+      },
+      on_error);
+
+  m_statements.emplace_back(count);
+}
+
+std::size_t Ddl_batch::failed_script(std::size_t executed) const {
+  return static_cast<std::size_t>(
+      std::upper_bound(m_statements.begin(), m_statements.end(), executed) -
+      m_statements.begin());
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_DDL_BATCH_H_
+#define MODULES_UTIL_LOAD_DDL_BATCH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
+
+namespace mysqlsh {
+
+/**
+ * Joins the DDL scripts of several tables into a single multi-statement query,
+ * keeping track of the script each statement came from.
+ */
+class Ddl_batch final {
+ public:
+  /**
+   * Transforms a statement, returns true if the statement was modified.
+   */
+  using Transform = std::function<bool(std::string_view, std::string *)>;
+
+  // maximum number of tables whose DDL is executed using a single query
+  static constexpr std::size_t k_max_tables = 16;
+
+  Ddl_batch() = default;
+
+  Ddl_batch(const Ddl_batch &) = delete;
+  Ddl_batch(Ddl_batch &&) = default;
+
+  Ddl_batch &operator=(const Ddl_batch &) = delete;
+  Ddl_batch &operator=(Ddl_batch &&) = default;
+
+  ~Ddl_batch() = default;
+
+  /**
+   * Provides the number of tables which should be added to a batch of the
+   * given table, so that the remaining tables of its schema are still
+   * distributed between all the threads.
+   *
+   * @param pending_tables Number of other tables of the same schema which are
+   *        waiting for their DDL to be executed.
+   * @param threads Number of threads executing the DDL.
+   */
+  static std::size_t tables_to_add(std::size_t pending_tables,
+                                   uint64_t threads);
+
+  /**
+   * Adds all the statements of a script, empty statements are skipped.
+   *
+   * @param script Script to be added.
+   * @param transform Applied to each statement.
+   * @param on_error Called if script cannot be split into statements.
+   */
+  void add(const std::string &script, const Transform &transform,
+           const mysqlshdk::utils::Sql_splitter::Error_callback &on_error);
+
+  /**
+   * The multi-statement query.
+   */
+  const std::string &sql() const { return m_sql; }
+
+  /**
+   * Number of scripts in the batch.
+   */
+  std::size_t scripts() const { return m_statements.size(); }
+
+  /**
+   * Number of statements in the batch.
+   */
+  std::size_t statements() const {
+    return m_statements.empty() ? 0 : m_statements.back();
+  }
+
+  /**
+   * Provides the index of a script which contains the statement that follows
+   * the given number of statements, i.e. script which failed if this many
+   * statements were successfully executed.
+   */
+  std::size_t failed_script(std::size_t executed) const;
+
+ private:
+  std::string m_sql;
+  // number of statements up to (and including) the given script
+  std::vector<std::size_t> m_statements;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_DDL_BATCH_H_
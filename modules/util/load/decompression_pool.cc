@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/decompression_pool.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+
+namespace mysqlsh {
+
+using mysqlshdk::storage::IFile;
+using mysqlshdk::storage::Mode;
+
+struct Decompression_pool::Entry {
+  std::unique_ptr<IFile> file;
+
+  // decompressed data which was not yet consumed by the reader
+  std::deque<std::string> buffers;
+  // set while entry is queued or being filled by one of the pool threads
+  bool scheduled = false;
+  bool eof = false;
+  // set when reader is closed, buffers are no longer filled
+  bool cancelled = false;
+  std::exception_ptr error;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+};
+
+struct Decompression_pool::State {
+  State(std::size_t b, std::size_t size)
+      : buffers(std::max<std::size_t>(b, 1)),
+        buffer_size(std::max<std::size_t>(size, 1)) {}
+
+  const std::size_t buffers;
+  const std::size_t buffer_size;
+
+  shcore::Synchronized_queue<std::shared_ptr<Entry>> queue;
+};
+
+class Decompression_pool::Read_ahead_file final : public IFile {
+ public:
+  Read_ahead_file(std::shared_ptr<State> state, std::shared_ptr<Entry> entry)
+      : m_state(std::move(state)), m_entry(std::move(entry)) {}
+
+  Read_ahead_file(const Read_ahead_file &) = delete;
+  Read_ahead_file(Read_ahead_file &&) = delete;
+
+  Read_ahead_file &operator=(const Read_ahead_file &) = delete;
+  Read_ahead_file &operator=(Read_ahead_file &&) = delete;
+
+  ~Read_ahead_file() override {
+    if (is_open()) {
+      close();
+    }
+  }
+
+  void open(Mode m) override {
+    if (Mode::READ != m) {
+      throw std::invalid_argument(
+          "Read_ahead_file: only READ mode is supported");
+    }
+
+    m_entry->file->open(m);
+
+    m_entry->buffers.clear();
+    m_entry->eof = false;
+    m_entry->cancelled = false;
+    m_entry->error = nullptr;
+
+    m_current.clear();
+    m_current_offset = 0;
+    m_offset = 0;
+    m_started = false;
+    m_is_open = true;
+  }
+
+  bool is_open() const override { return m_is_open; }
+
+  int error() const override { return 0; }
+
+  void close() override {
+    {
+      std::unique_lock lock{m_entry->mutex};
+
+      m_entry->cancelled = true;
+      // wait for the pool thread to stop using the file
+      m_entry->cv.wait(lock, [this]() { return !m_entry->scheduled; });
+
+      m_entry->buffers.clear();
+    }
+
+    std::string().swap(m_current);
+    m_is_open = false;
+
+    m_entry->file->close();
+  }
+
+  size_t file_size() const override { return m_entry->file->file_size(); }
+
+  mysqlshdk::Masked_string full_path() const override {
+    return m_entry->file->full_path();
+  }
+
+  std::string filename() const override { return m_entry->file->filename(); }
+
+  bool exists() const override { return m_entry->file->exists(); }
+
+  std::unique_ptr<mysqlshdk::storage::IDirectory> parent() const override {
+    return m_entry->file->parent();
+  }
+
+  off64_t seek(off64_t offset) override {
+    if (m_started) {
+      throw std::logic_error(
+          "Read_ahead_file::seek() - not supported once reading has started");
+    }
+
+    m_offset = m_entry->file->seek(offset);
+    return m_offset;
+  }
+
+  off64_t tell() const override { return m_offset; }
+
+  ssize_t read(void *buffer, size_t length) override {
+    if (!m_started) {
+      m_started = true;
+      schedule();
+    }
+
+    if (m_current_offset == m_current.size() && !next_buffer()) {
+      return 0;
+    }
+
+    length = std::min(length, m_current.size() - m_current_offset);
+    ::memcpy(buffer, m_current.data() + m_current_offset, length);
+    m_current_offset += length;
+    m_offset += length;
+
+    return length;
+  }
+
+  ssize_t write(const void *, size_t) override {
+    throw std::logic_error("Read_ahead_file::write() - not supported");
+  }
+
+  bool flush() override {
+    throw std::logic_error("Read_ahead_file::flush() - not supported");
+  }
+
+  bool is_local() const override { return m_entry->file->is_local(); }
+
+  void rename(const std::string &) override {
+    throw std::logic_error("Read_ahead_file::rename() - not supported");
+  }
+
+  void remove() override {
+    throw std::logic_error("Read_ahead_file::remove() - not supported");
+  }
+
+ private:
+  void schedule() {
+    {
+      std::lock_guard lock{m_entry->mutex};
+
+      if (m_entry->scheduled || m_entry->eof || m_entry->error) {
+        return;
+      }
+
+      m_entry->scheduled = true;
+    }
+
+    m_state->queue.push(m_entry);
+  }
+
+  bool next_buffer() {
+    {
+      std::unique_lock lock{m_entry->mutex};
+
+      m_entry->cv.wait(lock, [this]() {
+        return !m_entry->buffers.empty() || m_entry->error ||
+               (m_entry->eof && !m_entry->scheduled);
+      });
+
+      if (m_entry->buffers.empty()) {
+        if (m_entry->error) {
+          std::rethrow_exception(m_entry->error);
+        }
+
+        return false;
+      }
+
+      m_current = std::move(m_entry->buffers.front());
+      m_entry->buffers.pop_front();
+      m_current_offset = 0;
+    }
+
+    // a buffer was freed, decompress some more data
+    schedule();
+
+    return true;
+  }
+
+  std::shared_ptr<State> m_state;
+  std::shared_ptr<Entry> m_entry;
+  bool m_is_open = false;
+  // set once the first read is issued
+  bool m_started = false;
+  // buffer which is currently being consumed
+  std::string m_current;
+  std::size_t m_current_offset = 0;
+  // offset of the decompressed data
+  off64_t m_offset = 0;
+};
+
+Decompression_pool::Decompression_pool(std::size_t threads,
+                                       std::size_t buffers,
+                                       std::size_t buffer_size)
+    : m_state(std::make_shared<State>(buffers, buffer_size)) {
+  if (0 == threads) {
+    throw std::invalid_argument("Decompression_pool: need at least one thread");
+  }
+
+  m_workers.reserve(threads);
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    m_workers.emplace_back(mysqlsh::spawn_scoped_thread([this]() {
+      while (const auto entry = m_state->queue.pop()) {
+        fill(entry);
+      }
+    }));
+  }
+}
+
+Decompression_pool::~Decompression_pool() {
+  m_state->queue.shutdown(m_workers.size());
+
+  for (auto &worker : m_workers) {
+    worker.join();
+  }
+}
+
+std::unique_ptr<IFile> Decompression_pool::wrap(std::unique_ptr<IFile> file) {
+  auto entry = std::make_shared<Entry>();
+  entry->file = std::move(file);
+
+  return std::make_unique<Read_ahead_file>(m_state, std::move(entry));
+}
+
+std::size_t Decompression_pool::memory_per_file() const {
+  return m_state->buffers * m_state->buffer_size;
+}
+
+void Decompression_pool::fill(const std::shared_ptr<Entry> &entry) {
+  {
+    std::lock_guard lock{entry->mutex};
+
+    if (entry->cancelled) {
+      entry->scheduled = false;
+      entry->cv.notify_all();
+      return;
+    }
+  }
+
+  std::string data;
+  std::exception_ptr error;
+  bool eof = false;
+
+  try {
+    data.resize(m_state->buffer_size);
+    std::size_t offset = 0;
+
+    while (offset < data.size()) {
+      const auto bytes =
+          entry->file->read(data.data() + offset, data.size() - offset);
+
+      if (bytes < 0) {
+        throw std::runtime_error(
+            "Failed to read '" + entry->file->full_path().masked() +
+            "', error: " + std::to_string(entry->file->error()));
+      }
+
+      if (0 == bytes) {
+        eof = true;
+        break;
+      }
+
+      offset += bytes;
+    }
+
+    data.resize(offset);
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  bool reschedule = false;
+
+  {
+    std::lock_guard lock{entry->mutex};
+
+    if (!entry->cancelled) {
+      if (!data.empty()) {
+        entry->buffers.emplace_back(std::move(data));
+      }
+
+      entry->eof = eof;
+      entry->error = error;
+
+      reschedule = !eof && !error && entry->buffers.size() < m_state->buffers;
+    }
+
+    entry->scheduled = reschedule;
+  }
+
+  entry->cv.notify_all();
+
+  if (reschedule) {
+    m_state->queue.push(entry);
+  }
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_DECOMPRESSION_POOL_H_
+#define MODULES_UTIL_LOAD_DECOMPRESSION_POOL_H_
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+
+/**
+ * Decompresses the data files ahead of the reader, using a separate set of
+ * threads, so that the loader threads which feed the data to the server do
+ * not have to wait for the decompression.
+ *
+ * Each file holds a small ring of decompressed buffers, a pool thread refills
+ * it once the reader consumes a buffer.
+ */
+class Decompression_pool final {
+ public:
+  Decompression_pool() = delete;
+
+  /**
+   * Creates the pool.
+   *
+   * @param threads Number of threads used to decompress the files.
+   * @param buffers Number of decompressed buffers held by each file.
+   * @param buffer_size Size of a single buffer.
+   */
+  explicit Decompression_pool(std::size_t threads, std::size_t buffers = 4,
+                              std::size_t buffer_size = 1024 * 1024);
+
+  Decompression_pool(const Decompression_pool &) = delete;
+  Decompression_pool(Decompression_pool &&) = delete;
+
+  Decompression_pool &operator=(const Decompression_pool &) = delete;
+  Decompression_pool &operator=(Decompression_pool &&) = delete;
+
+  ~Decompression_pool();
+
+  /**
+   * Wraps the given (compressed) file, its contents are going to be read
+   * ahead by the pool threads once the first read is issued. The returned
+   * file supports only the READ mode, seek() is forwarded to the wrapped file
+   * only before the first read. The pool must outlive the returned file.
+   *
+   * @param file File to be read.
+   *
+   * @returns file handle
+   */
+  std::unique_ptr<mysqlshdk::storage::IFile> wrap(
+      std::unique_ptr<mysqlshdk::storage::IFile> file);
+
+  /**
+   * Maximum amount of memory held by the buffers of a single file.
+   */
+  std::size_t memory_per_file() const;
+
+ private:
+  struct Entry;
+
+  struct State;
+
+  class Read_ahead_file;
+
+  void fill(const std::shared_ptr<Entry> &entry);
+
+  std::shared_ptr<State> m_state;
+  std::vector<std::thread> m_workers;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_DECOMPRESSION_POOL_H_
@@ -25,34 +25,53 @@
 
 #include <mysqld_error.h>
 
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
 #include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <iterator>
 #include <list>
+#include <map>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
 #include "modules/mod_utils.h"
+#include "modules/util/common/dump/constants.h"
+#include "modules/util/common/dump/utils.h"
 #include "modules/util/dump/capability.h"
 #include "modules/util/dump/schema_dumper.h"
 #include "modules/util/import_table/load_data.h"
+#include "modules/util/load/ddl_batch.h"
 #include "modules/util/load/load_errors.h"
 #include "modules/util/load/load_progress_log.h"
+#include "modules/util/load/prefetch_queue.h"
 #include "mysqlshdk/include/scripting/shexcept.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/mysql/utils.h"
+#include "mysqlshdk/libs/storage/backend/object_storage.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/fault_injection.h"
 #include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/thread_affinity.h"
+#include "mysqlshdk/libs/utils/tracing.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/version.h"
 
 namespace mysqlsh {
@@ -81,8 +100,116 @@ static constexpr const int k_supported_dump_version_minor = 0;
 // before we enable sub-chunking for it.
 static constexpr const auto k_chunk_size_overshoot_tolerance = 1.5;
 
+// How often the load of the target instance is checked, if the number of
+// threads is adjusted automatically.
+static constexpr const auto k_concurrency_check_interval =
+    std::chrono::seconds{10};
+
+// Memory reserved for each chunk which is being loaded, in addition to the
+// transaction buffer: read buffers of the file and of the decompressor.
+static constexpr const std::size_t k_chunk_load_memory = 1024 * 1024;
+
+// Maximum number of threads which analyze tables after the load is complete,
+// when the analysis is deferred.
+static constexpr const std::size_t k_deferred_analyze_threads = 1;
+
+// Maximum number of table DDL scripts (per thread) which are fetched and
+// pre-processed ahead of their execution.
+static constexpr const std::size_t k_table_ddl_prefetch_depth =
+    2 * Ddl_batch::k_max_tables;
+
 namespace {
 
+/**
+ * Measures the time spent opening and reading the given file.
+ */
+class Timed_file final : public mysqlshdk::storage::IFile {
+ public:
+  Timed_file(std::unique_ptr<mysqlshdk::storage::IFile> file,
+             std::atomic<uint64_t> *nanoseconds)
+      : m_file(std::move(file)), m_nanoseconds(nanoseconds) {}
+
+  Timed_file(const Timed_file &) = delete;
+  Timed_file(Timed_file &&) = delete;
+
+  Timed_file &operator=(const Timed_file &) = delete;
+  Timed_file &operator=(Timed_file &&) = delete;
+
+  ~Timed_file() override = default;
+
+  void open(mysqlshdk::storage::Mode m) override {
+    timed([this, m]() { m_file->open(m); });
+  }
+
+  bool is_open() const override { return m_file->is_open(); }
+
+  int error() const override { return m_file->error(); }
+
+  void close() override { m_file->close(); }
+
+  size_t file_size() const override { return m_file->file_size(); }
+
+  mysqlshdk::Masked_string full_path() const override {
+    return m_file->full_path();
+  }
+
+  std::string filename() const override { return m_file->filename(); }
+
+  bool exists() const override { return m_file->exists(); }
+
+  std::unique_ptr<mysqlshdk::storage::IDirectory> parent() const override {
+    return m_file->parent();
+  }
+
+  off64_t seek(off64_t offset) override {
+    off64_t result;
+    timed([this, offset, &result]() { result = m_file->seek(offset); });
+    return result;
+  }
+
+  off64_t tell() const override { return m_file->tell(); }
+
+  ssize_t read(void *buffer, size_t length) override {
+    ssize_t result;
+    timed([this, buffer, length, &result]() {
+      result = m_file->read(buffer, length);
+    });
+    return result;
+  }
+
+  ssize_t write(const void *buffer, size_t length) override {
+    return m_file->write(buffer, length);
+  }
+
+  bool flush() override { return m_file->flush(); }
+
+  bool is_compressed() const override { return m_file->is_compressed(); }
+
+  bool is_local() const override { return m_file->is_local(); }
+
+  void rename(const std::string &new_name) override {
+    m_file->rename(new_name);
+  }
+
+  void remove() override { m_file->remove(); }
+
+ private:
+  template <typename F>
+  void timed(F &&f) {
+    const auto start = std::chrono::steady_clock::now();
+    shcore::on_leave_scope add_time([this, start]() {
+      *m_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+    });
+
+    f();
+  }
+
+  std::unique_ptr<mysqlshdk::storage::IFile> m_file;
+  std::atomic<uint64_t> *m_nanoseconds;
+};
+
 bool histograms_supported(const Version &version) {
   return version > Version(8, 0, 0);
 }
@@ -250,6 +377,65 @@ class Index_file {
     return m_data_size;
   }
 
+  /**
+   * Provides frames which start at the checkpoints, returns an empty list if
+   * idx file does not contain them.
+   */
+  std::vector<mysqlshdk::storage::Compressed_file::Frame> frames() {
+    std::vector<mysqlshdk::storage::Compressed_file::Frame> result;
+
+    if (!m_idx_file->exists()) {
+      return result;
+    }
+
+    const auto file_size = m_idx_file->file_size();
+
+    // marker + checkpoints + total size
+    if (file_size < 2 * k_entry_size ||
+        (file_size - 2 * k_entry_size) % k_checkpoint_size != 0) {
+      return result;
+    }
+
+    std::vector<uint64_t> entries;
+    entries.resize(file_size / k_entry_size);
+
+    m_idx_file->open(mysqlshdk::storage::Mode::READ);
+
+    auto buffer = reinterpret_cast<char *>(entries.data());
+    std::size_t remaining = file_size;
+
+    while (remaining > 0) {
+      const auto bytes = m_idx_file->read(buffer, remaining);
+
+      if (bytes <= 0) {
+        break;
+      }
+
+      buffer += bytes;
+      remaining -= bytes;
+    }
+
+    m_idx_file->close();
+
+    if (remaining > 0 || dump::common::k_index_checkpoints_marker !=
+                             mysqlshdk::utils::network_to_host(entries[0])) {
+      return result;
+    }
+
+    const auto checkpoints = (file_size - 2 * k_entry_size) / k_checkpoint_size;
+    result.reserve(checkpoints);
+
+    for (std::size_t i = 0; i < checkpoints; ++i) {
+      // each checkpoint holds: rows, compressed offset, uncompressed offset
+      const auto entry = 1 + i * (k_checkpoint_size / k_entry_size);
+      result.push_back(
+          {mysqlshdk::utils::network_to_host(entries[entry + 1]),
+           mysqlshdk::utils::network_to_host(entries[entry + 2])});
+    }
+
+    return result;
+  }
+
  private:
   void load_metadata() {
     if (m_metadata_loaded) {
@@ -278,6 +464,8 @@ class Index_file {
 
   static constexpr uint64_t k_entry_size = sizeof(uint64_t);
 
+  static constexpr uint64_t k_checkpoint_size = 3 * k_entry_size;
+
   std::unique_ptr<mysqlshdk::storage::IFile> m_idx_file;
 
   std::size_t m_file_size = 0;
@@ -398,6 +586,10 @@ bool Dump_loader::Worker::Schema_ddl_task::execute(
 bool Dump_loader::Worker::Table_ddl_task::execute(
     const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
     Worker *worker, Dump_loader *loader) {
+  if (!m_batch.empty()) {
+    return execute_batch(session, worker, loader);
+  }
+
   log_debug("%swill execute DDL file for table %s", log_id(), key().c_str());
 
   loader->post_worker_event(worker, Worker_event::TABLE_DDL_START);
@@ -428,9 +620,192 @@ bool Dump_loader::Worker::Table_ddl_task::execute(
   return true;
 }
 
+Dump_loader::Worker::Table_ddl_task *
+Dump_loader::Worker::Table_ddl_task::batched_task(
+    const shcore::Dictionary_t &details) {
+  if (!details || !details->has_key("batch")) {
+    return this;
+  }
+
+  return m_batch[details->get_uint("batch")].get();
+}
+
+bool Dump_loader::Worker::Table_ddl_task::execute_batch(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    Worker *worker, Dump_loader *loader) {
+  log_debug("%swill execute DDL files for %zu tables, starting with %s",
+            log_id(), m_batch.size() + 1, key().c_str());
+
+  std::vector<Table_ddl_task *> tasks;
+  tasks.reserve(m_batch.size() + 1);
+  tasks.emplace_back(this);
+
+  for (const auto &task : m_batch) {
+    task->m_id = m_id;
+    task->m_log_id = m_log_id;
+    tasks.emplace_back(task.get());
+  }
+
+  const auto post_event = [worker, loader](Worker_event::Event event,
+                                           std::size_t index) {
+    shcore::Dictionary_t details;
+
+    if (index > 0) {
+      details = shcore::make_dict("batch", uint64_t{index - 1});
+    }
+
+    loader->post_worker_event(worker, event, std::move(details));
+  };
+
+  for (std::size_t i = 0; i < tasks.size(); ++i) {
+    post_event(Worker_event::TABLE_DDL_START, i);
+  }
+
+  Table_ddl_task *current = this;
+
+  try {
+    for (const auto task : tasks) {
+      current = task;
+      task->pre_process(loader);
+    }
+
+    current = this;
+
+    if (!loader->m_options.dry_run()) {
+      // this is here to detect if data is loaded into a non-existing schema
+      Dump_loader::executef(session, "use !", m_schema.c_str());
+    }
+
+    load_ddl_batch(session, loader, tasks, &current);
+
+    for (const auto task : tasks) {
+      current = task;
+      task->post_process(session, loader);
+    }
+  } catch (const std::exception &e) {
+    handle_current_exception(
+        worker, loader,
+        shcore::str_format("While executing DDL script for %s: %s",
+                           current->key().c_str(), e.what()));
+    return false;
+  }
+
+  log_debug("%sdone", log_id());
+
+  for (std::size_t i = 0; i < tasks.size(); ++i) {
+    ++loader->m_ddl_executed;
+    post_event(Worker_event::TABLE_DDL_END, i);
+  }
+
+  return true;
+}
+
+void Dump_loader::Worker::Table_ddl_task::load_ddl_batch(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    Dump_loader *loader, const std::vector<Table_ddl_task *> &tasks,
+    Table_ddl_task **current) {
+  std::vector<Table_ddl_task *> to_execute;
+
+  for (const auto task : tasks) {
+    if (task->should_load_ddl(loader)) {
+      to_execute.emplace_back(task);
+    }
+  }
+
+  if (loader->m_options.dry_run()) {
+    return;
+  }
+
+  const auto execute_one_by_one = [&session, loader, &to_execute,
+                                   current](std::size_t first) {
+    for (auto i = first; i < to_execute.size(); ++i) {
+      *current = to_execute[i];
+      to_execute[i]->execute_ddl(session, loader);
+    }
+  };
+
+  if (to_execute.size() < 2) {
+    execute_one_by_one(0);
+    return;
+  }
+
+  Ddl_batch batch;
+  const auto transform = [loader](std::string_view s, std::string *out) {
+    return loader->m_default_sql_transforms(s, out);
+  };
+
+  for (const auto task : to_execute) {
+    batch.add(task->m_script, transform,
+              [task](std::string_view err) {
+                THROW_ERROR(SHERR_LOAD_SPLITTING_DDL_FAILED,
+                            task->key().c_str(), std::string{err}.c_str());
+              });
+  }
+
+  if (0 == batch.statements()) {
+    return;
+  }
+
+  std::size_t executed = 0;
+  std::optional<mysqlshdk::db::Error> error;
+
+  session->set_multi_statements(true);
+
+  try {
+    const auto result = session->query(batch.sql());
+    ++executed;
+
+    while (result->next_resultset()) {
+      ++executed;
+    }
+  } catch (const mysqlshdk::db::Error &e) {
+    error = e;
+  }
+
+  session->set_multi_statements(false);
+
+  if (error) {
+    // statements which follow the failed one were not executed, scripts are
+    // executed again starting with the table which has failed, reporting the
+    // errors the same way as in case of a single table
+    const auto failed = batch.failed_script(executed);
+
+    log_info(
+        "%sBatched DDL failed after %zu statements while processing %s: %s, "
+        "executing remaining DDL scripts one by one",
+        log_id(), executed, to_execute[failed]->key().c_str(),
+        error->format().c_str());
+
+    execute_one_by_one(failed);
+  }
+}
+
+void Dump_loader::Worker::Table_ddl_task::prepare(Dump_loader *loader) {
+  try {
+    pre_process(loader);
+  } catch (...) {
+    m_prepare_error = std::current_exception();
+  }
+
+  m_prepared = true;
+}
+
 void Dump_loader::Worker::Table_ddl_task::pre_process(Dump_loader *loader) {
-  if (!m_placeholder && (loader->m_options.load_ddl() ||
-                         loader->m_options.load_deferred_indexes())) {
+  if (m_prepared) {
+    // script was already processed when it was fetched
+    if (m_prepare_error) {
+      std::rethrow_exception(m_prepare_error);
+    }
+
+    return;
+  }
+
+  // tablespace which is going to be imported has to match the table definition,
+  // indexes cannot be deferred and primary key cannot be added
+  if (!m_placeholder &&
+      loader->m_dump->tablespaces(m_schema, m_table).empty() &&
+      (loader->m_options.load_ddl() ||
+       loader->m_options.load_deferred_indexes())) {
     if (loader->m_options.defer_table_indexes() !=
         Load_dump_options::Defer_index_mode::OFF) {
       extract_deferred_statements(loader);
@@ -463,6 +838,90 @@ void Dump_loader::Worker::Table_ddl_task::post_process(
       m_deferred_statements && !m_deferred_statements->empty()) {
     remove_duplicate_deferred_statements(session, loader);
   }
+
+  if (!m_placeholder && m_status != Load_progress_log::DONE && !m_exists &&
+      loader->m_options.load_ddl() && !loader->m_options.dry_run() &&
+      !loader->m_dump->tablespaces(m_schema, m_table).empty()) {
+    import_tablespaces(session, loader);
+  }
+}
+
+void Dump_loader::Worker::Table_ddl_task::import_tablespaces(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    Dump_loader *loader) {
+  const auto &tablespaces = loader->m_dump->tablespaces(m_schema, m_table);
+  const auto datadir = Dump_loader::query(session, "SELECT @@datadir")
+                           ->fetch_one_or_throw()
+                           ->get_string(0);
+  std::string schema_dir;
+
+  try {
+    schema_dir = shcore::path::join_path(
+        datadir, dump::common::encode_server_filename(m_schema));
+  } catch (const std::invalid_argument &e) {
+    throw std::runtime_error("Cannot import the tablespace of the table " +
+                             key() + ": " + e.what());
+  }
+
+  if (!shcore::is_folder(schema_dir)) {
+    throw std::runtime_error(
+        "Cannot import the tablespace of the table " + key() +
+        ", the directory '" + schema_dir +
+        "' is not accessible, the shell has to run on the same host as the "
+        "server.");
+  }
+
+  log_info("%sImporting %zu tablespace file(s) of %s", log_id(),
+           tablespaces.size(), key().c_str());
+
+  Dump_loader::executef(session, "ALTER TABLE !.! DISCARD TABLESPACE",
+                        m_schema.c_str(), m_table.c_str());
+
+  constexpr std::size_t k_buffer_size = 4 * 1024 * 1024;
+  std::string buffer;
+  buffer.resize(k_buffer_size);
+
+  for (const auto &tablespace : tablespaces) {
+    for (const auto &[name, ext] :
+         {std::make_pair(&tablespace.ibd, ".ibd"),
+          std::make_pair(&tablespace.cfg, ".cfg")}) {
+      const auto target_path =
+          shcore::path::join_path(schema_dir, tablespace.name + ext);
+      const auto source =
+          loader->m_dump->tablespace_file(m_schema, m_table, *name);
+      source->open(mysqlshdk::storage::Mode::READ);
+
+      const auto target = mysqlshdk::storage::make_file(target_path);
+      target->open(mysqlshdk::storage::Mode::WRITE);
+
+      ssize_t bytes;
+
+      while ((bytes = source->read(buffer.data(), buffer.size())) > 0) {
+        if (loader->m_worker_interrupt) {
+          return;
+        }
+
+        target->write(buffer.data(), bytes);
+      }
+
+      if (bytes < 0) {
+        throw std::runtime_error("Failed to read the file '" +
+                                 source->full_path().masked() + "'");
+      }
+
+      source->close();
+      target->close();
+    }
+  }
+
+  Dump_loader::executef(session, "ALTER TABLE !.! IMPORT TABLESPACE",
+                        m_schema.c_str(), m_table.c_str());
+
+  // .cfg files are not removed by the server
+  for (const auto &tablespace : tablespaces) {
+    shcore::delete_file(
+        shcore::path::join_path(schema_dir, tablespace.name + ".cfg"));
+  }
 }
 
 void Dump_loader::Worker::Table_ddl_task::remove_duplicate_deferred_statements(
@@ -540,8 +999,15 @@ void Dump_loader::Worker::Table_ddl_task::remove_duplicate_deferred_statements(
 void Dump_loader::Worker::Table_ddl_task::load_ddl(
     const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
     Dump_loader *loader) {
+  if (should_load_ddl(loader) && !loader->m_options.dry_run()) {
+    execute_ddl(session, loader);
+  }
+}
+
+bool Dump_loader::Worker::Table_ddl_task::should_load_ddl(
+    Dump_loader *loader) const {
   if (m_status == Load_progress_log::DONE || !loader->m_options.load_ddl()) {
-    return;
+    return false;
   }
 
   log_debug("%sExecuting %stable DDL for %s", log_id(),
@@ -560,19 +1026,23 @@ void Dump_loader::Worker::Table_ddl_task::load_ddl(
     // BUG#35102738: do not recreate existing tables due to BUG#35154429
     log_info("%sskipping DDL script for %s, table already exists", log_id(),
              key().c_str());
-    return;
+    return false;
   }
 
-  if (!loader->m_options.dry_run()) {
-    try {
-      // execute sql
-      execute_script(session, m_script,
-                     shcore::str_format("%sError processing table %s", log_id(),
-                                        key().c_str()),
-                     loader->m_default_sql_transforms);
-    } catch (const std::exception &e) {
-      if (!loader->m_options.force()) throw;
-    }
+  return true;
+}
+
+void Dump_loader::Worker::Table_ddl_task::execute_ddl(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    Dump_loader *loader) {
+  try {
+    // execute sql
+    execute_script(session, m_script,
+                   shcore::str_format("%sError processing table %s", log_id(),
+                                      key().c_str()),
+                   loader->m_default_sql_transforms);
+  } catch (const std::exception &e) {
+    if (!loader->m_options.force()) throw;
   }
 }
 
@@ -639,6 +1109,57 @@ bool Dump_loader::Worker::Load_chunk_task::execute(
   return true;
 }
 
+bool Dump_loader::Worker::Load_chunk_task::bulk_load(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    Dump_loader *loader, mysqlshdk::storage::Compression compression,
+    import_table::Load_data_worker *op) {
+  // server-side bulk loader reads the file directly, rows need to be sorted
+  // by the primary key and the table needs to be loaded by a single statement
+  if (loader->m_bulk_load_disabled ||
+      !loader->m_options.bulk_load_supported() ||
+      !loader->m_options.is_prefix_par() || m_resume || m_bytes_to_skip > 0 ||
+      !partition().empty() ||
+      (mysqlshdk::storage::Compression::NONE != compression &&
+       mysqlshdk::storage::Compression::ZSTD != compression) ||
+      m_compression_options.dictionary ||
+      !loader->m_dump->has_primary_key(schema(), table()) ||
+      !loader->m_dump->single_data_file(schema(), table(), partition())) {
+    return false;
+  }
+
+  if (const auto decode = m_options->find("decodeColumns");
+      m_options->end() != decode && !decode->second.as_map()->empty()) {
+    return false;
+  }
+
+  import_table::Bulk_load_options options;
+  options.url = m_file->full_path().real();
+  options.compression = compression;
+  options.in_primary_key_order = true;
+  options.file_bytes = m_file->file_size();
+
+  bool valid = false;
+  options.data_bytes = loader->m_dump->chunk_size(m_file->filename(), &valid);
+
+  if (!valid) {
+    options.data_bytes = Index_file{m_file.get()}.data_size();
+  }
+
+  int error = 0;
+
+  if (op->execute_bulk(session, options, &error)) {
+    return true;
+  }
+
+  if (ER_PARSE_ERROR == error || ER_NOT_SUPPORTED_YET == error) {
+    log_info("Server-side bulk load is not available, falling back to LOAD "
+             "DATA LOCAL INFILE for all tables");
+    loader->m_bulk_load_disabled = true;
+  }
+
+  return false;
+}
+
 void Dump_loader::Worker::Load_chunk_task::load(
     const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
     Dump_loader *loader, Worker *worker) {
@@ -656,6 +1177,18 @@ void Dump_loader::Worker::Load_chunk_task::load(
 
   import_options.set_partition(partition());
 
+  import_options.set_use_insert_statements(
+      loader->m_options.use_insert_statements());
+
+  import_options.set_session_ready(
+      worker->m_data_session.has_value() &&
+      worker->m_data_session->schema == import_options.schema() &&
+      worker->m_data_session->character_set ==
+          import_options.character_set());
+
+  // limit shared by all threads, also enforces the global limit
+  import_options.set_total_rate_limit(loader->m_resources->rate_limit());
+
   import_table::Stats stats;
   if (m_resume) {
     // Truncate the table if its not chunked, but if it's chunked leave it
@@ -672,10 +1205,11 @@ void Dump_loader::Worker::Load_chunk_task::load(
   }
 
   std::atomic<size_t> num_file_bytes_loaded{0};
+  bool session_set_up = false;
   import_table::Load_data_worker op(
-      import_options, id(), &loader->m_num_bytes_loaded, &num_file_bytes_loaded,
-      &loader->m_worker_hard_interrupt, nullptr, &loader->m_thread_exceptions,
-      &stats, query_comment());
+      import_options, id(), loader->m_num_bytes_loaded.slot(id()),
+      &num_file_bytes_loaded, &loader->m_worker_hard_interrupt, nullptr,
+      &loader->m_thread_exceptions, &stats, query_comment());
 
   loader->m_num_threads_loading++;
 
@@ -818,13 +1352,98 @@ void Dump_loader::Worker::Load_chunk_task::load(
 
     options.skip_bytes = m_bytes_to_skip;
 
-    op.execute(session, mysqlshdk::storage::make_file(std::move(m_file), compr),
-               options);
+    if (bulk_load(session, loader, compr, &op)) {
+      m_file.reset();
+      session_set_up = true;
+    }
+
+    std::unique_ptr<mysqlshdk::storage::IFile> file;
+
+    if (m_file && 0 == m_bytes_to_skip &&
+        loader->m_options.shared_chunk_cache()) {
+      // dump is loaded into several instances, decompressed data is shared
+      // with the other loaders
+      bool valid = false;
+      auto data_size = loader->m_dump->chunk_size(m_file->filename(), &valid);
+
+      if (!valid) {
+        data_size = idx_file.data_size();
+      }
+
+      file = loader->m_options.shared_chunk_cache()->file(
+          &m_file, data_size, compr, m_compression_options);
+
+      if (file) {
+        compr = mysqlshdk::storage::Compression::NONE;
+      }
+    }
+
+    if (!file) {
+      if (m_file && !m_file->is_local()) {
+        // local files are not wrapped, zstd reads them using mmap()
+        m_file = std::make_unique<Timed_file>(
+            std::move(m_file), &loader->m_worker_stats[id()].storage_wait);
+      }
+
+      file = m_file ? mysqlshdk::storage::make_file(
+                          std::move(m_file), compr, m_compression_options)
+                    : nullptr;
+
+      if (file && m_bytes_to_skip > 0) {
+        if (const auto compressed =
+                dynamic_cast<mysqlshdk::storage::Compressed_file *>(
+                    file.get());
+            compressed && compressed->supports_frames()) {
+          // allows to start decompressing at the checkpoint which precedes
+          // the resume point, instead of at the beginning of the file
+          compressed->set_frames(idx_file.frames());
+        }
+      }
+    }
+
+    Memory_budget::Reservation memory;
+    Memory_budget::Reservation read_ahead_memory;
+
+    if (file) {
+      // transaction buffer holds the data of a whole subchunk
+      memory = loader->m_memory_budget.acquire(
+          k_chunk_load_memory +
+          (options.fast_sub_chunking ? 0 : options.max_trx_size));
+
+      if (!memory) {
+        throw shcore::cancelled("Interrupted");
+      }
+    }
+
+    if (file && mysqlshdk::storage::Compression::NONE != compr &&
+        loader->m_decompression_pool) {
+      // decompress the data ahead of the LOAD DATA reads, if there's enough
+      // memory, otherwise the data is decompressed by this thread
+      read_ahead_memory = loader->m_memory_budget.try_acquire(
+          loader->m_decompression_pool->memory_per_file());
+
+      if (read_ahead_memory) {
+        file = loader->m_decompression_pool->wrap(std::move(file));
+      } else {
+        log_debug("%snot enough memory to decompress %s ahead", log_id(),
+                  file->full_path().masked().c_str());
+      }
+    }
+
+    if (file) {
+      op.execute(session, std::move(file), options);
+      session_set_up = true;
+    }
   }
 
   if (loader->m_thread_exceptions[id()])
     std::rethrow_exception(loader->m_thread_exceptions[id()]);
 
+  if (session_set_up) {
+    worker->m_data_session = Data_session_state{
+        import_options.schema(), import_options.character_set()};
+  }
+
   bytes_loaded = m_bytes_to_skip + stats.total_data_bytes;
   rows_loaded = stats.total_records;
   loader->m_num_raw_bytes_loaded += raw_bytes_loaded;
@@ -952,6 +1571,43 @@ bool Dump_loader::Worker::Index_recreation_task::execute(
     }
 
     try {
+      // session variables which are modified by this task
+      std::vector<std::string> ddl_variables;
+
+      {
+        std::string settings;
+
+        if (m_ddl_threads > 0) {
+          ddl_variables.emplace_back("innodb_ddl_threads");
+          settings += ",innodb_ddl_threads=" + std::to_string(m_ddl_threads);
+        }
+
+        if (const auto size = loader->m_options.index_buffer_size()) {
+          ddl_variables.emplace_back("innodb_ddl_buffer_size");
+          settings += ",innodb_ddl_buffer_size=" + std::to_string(*size);
+        }
+
+        if (!settings.empty()) {
+          execute_statement(session, "SET SESSION " + settings.substr(1),
+                            "While recreating indexes for table " + key());
+        }
+      }
+
+      shcore::on_leave_scope restore_variables([&session, &ddl_variables]() {
+        if (ddl_variables.empty()) return;
+
+        try {
+          session->execute("SET SESSION " +
+                           shcore::str_join(ddl_variables, ",",
+                                            [](const std::string &v) {
+                                              return v + "=DEFAULT";
+                                            }));
+        } catch (const std::exception &e) {
+          log_warning("Failed to restore the DDL session variables: %s",
+                      e.what());
+        }
+      });
+
       auto current = batches.begin();
       const auto end = batches.end();
 
@@ -1082,11 +1738,17 @@ void Dump_loader::Worker::do_run() {
     return;
   }
 
+  auto &stats = m_owner->m_worker_stats[m_id];
+
   for (;;) {
     m_owner->post_worker_event(this, Worker_event::READY);
 
+    const auto idle_start = std::chrono::steady_clock::now();
     // wait for signal that there's work to do... false means stop worker
     bool work = m_work_ready.pop();
+    const auto task_start = std::chrono::steady_clock::now();
+    stats.idle += task_start - idle_start;
+
     if (!work || m_owner->m_worker_interrupt) {
       m_owner->post_worker_event(this, Worker_event::EXIT);
       break;
@@ -1094,15 +1756,45 @@ void Dump_loader::Worker::do_run() {
 
     assert(std::numeric_limits<size_t>::max() != m_task->id());
 
-    if (!m_task->execute(m_session, this, m_owner)) break;
+    const auto type = static_cast<std::size_t>(m_task->type());
+
+    if (Task::Type::LOAD_CHUNK != m_task->type()) {
+      // other tasks may change the state of the session
+      m_data_session.reset();
+    }
+
+    mysqlshdk::tracing::Span span{"load", Worker_stats::k_task_names[type]};
+    span.add_arg("table", m_task->key());
+
+    stats.current_task = type;
+    const auto success = m_task->execute(m_session, this, m_owner);
+    stats.current_task = Worker_stats::k_task_types;
+
+    span.end();
+
+    stats.busy[type] += std::chrono::steady_clock::now() - task_start;
+    ++stats.tasks[type];
+
+    if (!success) break;
   }
 }
 
 void Dump_loader::Worker::stop() { m_work_ready.push(false); }
 
+std::chrono::nanoseconds Dump_loader::Worker_stats::total_busy() const {
+  std::chrono::nanoseconds total{0};
+
+  for (const auto &t : busy) {
+    total += t;
+  }
+
+  return total;
+}
+
 void Dump_loader::Worker::connect() {
-  m_session = m_owner->create_session();
+  m_session = m_owner->create_session(m_owner->m_worker_connection_options);
   m_connection_id = m_session->get_connection_id();
+  m_data_session.reset();
 }
 
 void Dump_loader::Worker::schedule(std::unique_ptr<Task> task) {
@@ -1130,35 +1822,28 @@ void Dump_loader::Worker::handle_current_exception(Dump_loader *loader,
 
 Dump_loader::Dump_loader(const Load_dump_options &options)
     : m_options(options),
+      m_memory_budget(options.max_memory()),
       m_num_threads_loading(0),
       m_num_threads_recreating_indexes(0),
       m_character_set(options.character_set()),
       m_num_rows_loaded(0),
-      m_num_bytes_loaded(0),
+      m_num_bytes_loaded(options.threads_count()),
       m_num_raw_bytes_loaded(0),
       m_num_chunks_loaded(0),
       m_num_warnings(0),
       m_num_errors(0),
-      m_progress_thread("Load dump", options.show_progress()) {}
+      m_progress_thread("Load dump", options.show_progress() &&
+                                         dump::Progress_format::TEXT ==
+                                             options.progress_format()) {}
 
 Dump_loader::~Dump_loader() {}
 
-std::shared_ptr<mysqlshdk::db::mysql::Session> Dump_loader::create_session() {
-  auto session = establish_session(m_options.connection_options(), false);
-
-  // Set timeouts to larger values since worker threads may get stuck
-  // downloading data for some time before they have a chance to get back to
-  // doing MySQL work.
-  executef(session, "SET SESSION net_read_timeout = ?",
-           k_mysql_server_net_read_timeout);
-
-  // This is the time until the server kicks out idle connections. Our
-  // connections should last for as long as the dump lasts even if they're
-  // idle.
-  executef(session, "SET SESSION wait_timeout = ?",
-           k_mysql_server_wait_timeout);
+std::shared_ptr<mysqlshdk::db::mysql::Session> Dump_loader::create_session(
+    const mysqlshdk::db::Connection_options &options) {
+  auto session = establish_session(options, false);
 
-  // Disable binlog if requested by user
+  // Disable binlog if requested by user, this is done separately, as it
+  // requires additional privileges and has its own error message
   if (m_options.skip_binlog()) {
     try {
       execute(session, "SET sql_log_bin=0");
@@ -1167,16 +1852,29 @@ std::shared_ptr<mysqlshdk::db::mysql::Session> Dump_loader::create_session() {
     }
   }
 
-  execute(session, "SET foreign_key_checks = 0");
-  execute(session, "SET unique_checks = 0");
-
-  // Make sure we don't get affected by user customizations of sql_mode
-  execute(session, "SET SQL_MODE = 'NO_AUTO_VALUE_ON_ZERO'");
-
-  if (!m_character_set.empty())
-    executef(session, "SET NAMES ?", m_character_set);
+  // the remaining variables are set using a single statement, each worker
+  // session is initialized this way and every round trip counts on high
+  // latency links
+  auto sql = shcore::sqlformat(
+      "SET "
+      // Set timeouts to larger values since worker threads may get stuck
+      // downloading data for some time before they have a chance to get back
+      // to doing MySQL work.
+      "SESSION net_read_timeout = ?, "
+      // This is the time until the server kicks out idle connections. Our
+      // connections should last for as long as the dump lasts even if they're
+      // idle.
+      "SESSION wait_timeout = ?, "
+      "foreign_key_checks = 0, unique_checks = 0, "
+      // Make sure we don't get affected by user customizations of sql_mode
+      "SQL_MODE = 'NO_AUTO_VALUE_ON_ZERO'",
+      k_mysql_server_net_read_timeout, k_mysql_server_wait_timeout);
+
+  if (!m_character_set.empty()) {
+    sql += shcore::sqlformat(", NAMES ?", m_character_set);
+  }
 
-  if (m_dump->tz_utc()) execute(session, "SET TIME_ZONE='+00:00'");
+  if (m_dump->tz_utc()) sql += ", TIME_ZONE='+00:00'";
 
   if (m_options.load_ddl() && m_options.auto_create_pks_supported()) {
     // target server supports automatic creation of primary keys, we need to
@@ -1191,11 +1889,13 @@ std::shared_ptr<mysqlshdk::db::mysql::Session> Dump_loader::create_session() {
     // compatibility option during the dump and this variable is not going to be
     // toggled
     if (m_options.sql_generate_invisible_primary_key() != create_pks) {
-      executef(session, "SET @@SESSION.sql_generate_invisible_primary_key=?",
-               create_pks);
+      sql += shcore::sqlformat(
+          ", @@SESSION.sql_generate_invisible_primary_key=?", create_pks);
     }
   }
 
+  execute(session, sql);
+
   try {
     for (const auto &s : m_options.session_init_sql()) {
       log_info("Executing custom session init SQL: %s", s.c_str());
@@ -1338,13 +2038,16 @@ void Dump_loader::on_dump_end() {
           if (!m_options.dry_run()) {
             executef(query, m_dump->gtid_executed());
           }
+        } else if (m_gtid_set_to_append.empty()) {
+          console->print_status(
+              "Incremental dump does not contain new transactions, "
+              "GTID_PURGED was not changed");
         } else {
           console->print_status("Appending dumped gtid set to GTID_PURGED");
-          log_info("Appending %s to GTID_PURGED",
-                   m_dump->gtid_executed().c_str());
+          log_info("Appending %s to GTID_PURGED", m_gtid_set_to_append.c_str());
 
           if (!m_options.dry_run()) {
-            executef(query, "+" + m_dump->gtid_executed());
+            executef(query, "+" + m_gtid_set_to_append);
           }
         }
         m_load_log->end_gtid_update();
@@ -1359,6 +2062,12 @@ void Dump_loader::on_dump_end() {
     }
   }
 
+  restore_durability();
+
+  if (m_options.load_data() && m_dump->is_incremental()) {
+    check_deleted_rows();
+  }
+
   // check if redo log is disabled and print a reminder if so
   auto res = query(
       "SELECT VARIABLE_VALUE = 'OFF' FROM "
@@ -1374,6 +2083,80 @@ void Dump_loader::on_dump_end() {
   }
 }
 
+void Dump_loader::disable_durability() {
+  const auto console = current_console();
+
+  const auto redo_log_enabled =
+      query(
+          "SELECT VARIABLE_VALUE = 'ON' FROM "
+          "performance_schema.global_status "
+          "WHERE variable_name = 'Innodb_redo_log_enabled'")
+          ->fetch_one_or_throw()
+          ->get_int(0, 0);
+
+  if (redo_log_enabled) {
+    log_info("Disabling the redo log");
+    execute("ALTER INSTANCE DISABLE INNODB REDO_LOG");
+    m_redo_log_disabled = true;
+
+    console->print_warning(
+        "The redo log has been disabled, MySQL is not crash safe until the "
+        "load completes and the redo log is enabled again. Do not use this "
+        "instance until then.");
+  } else {
+    console->print_note(
+        "The redo log is already disabled, it will not be enabled once the "
+        "load completes.");
+  }
+
+  // innodb_doublewrite is dynamic since 8.0.30, DETECT_ONLY stops writing the
+  // data pages to the doublewrite buffer, and can be reverted without a restart
+  if (m_options.target_server_version() >= Version(8, 0, 30)) {
+    const auto doublewrite = query("SELECT @@GLOBAL.innodb_doublewrite")
+                                 ->fetch_one_or_throw()
+                                 ->get_string(0);
+
+    if (shcore::str_caseeq(doublewrite, "ON")) {
+      log_info("Setting innodb_doublewrite to DETECT_ONLY");
+      execute("SET GLOBAL innodb_doublewrite = 'DETECT_ONLY'");
+      m_doublewrite_to_restore = doublewrite;
+    }
+  }
+}
+
+void Dump_loader::restore_durability() {
+  const auto console = current_console();
+
+  if (!m_doublewrite_to_restore.empty()) {
+    try {
+      log_info("Restoring innodb_doublewrite to %s",
+               m_doublewrite_to_restore.c_str());
+      executef("SET GLOBAL innodb_doublewrite = ?", m_doublewrite_to_restore);
+    } catch (const std::exception &e) {
+      console->print_warning(shcore::str_format(
+          "Failed to restore the innodb_doublewrite system variable to '%s': "
+          "%s",
+          m_doublewrite_to_restore.c_str(), e.what()));
+    }
+
+    m_doublewrite_to_restore.clear();
+  }
+
+  if (m_redo_log_disabled) {
+    m_redo_log_disabled = false;
+
+    try {
+      console->print_status("Enabling the redo log");
+      execute("ALTER INSTANCE ENABLE INNODB REDO_LOG");
+    } catch (const std::exception &e) {
+      console->print_warning(
+          std::string("Failed to enable the redo log: ") + e.what() +
+          ". Execute 'ALTER INSTANCE ENABLE INNODB REDO_LOG' before putting "
+          "this instance in production.");
+    }
+  }
+}
+
 void Dump_loader::on_schema_end(const std::string &schema) {
   if (m_options.load_deferred_indexes()) {
     const auto &fks = m_dump->deferred_schema_fks(schema);
@@ -1381,15 +2164,64 @@ void Dump_loader::on_schema_end(const std::string &schema) {
       log_info("Recreating FOREIGN KEY constraints for schema %s",
                shcore::quote_identifier(schema).c_str());
       if (!m_options.dry_run()) {
-        for (const auto &q : fks) {
+        // tables referencing the same table are processed one after another,
+        // so that the referenced index is still in the buffer pool
+        std::vector<std::pair<std::string_view,
+                              const Dump_reader::Deferred_foreign_keys *>>
+            tables;
+        tables.reserve(fks.size());
+
+        for (const auto &fk : fks) {
+          tables.emplace_back(compatibility::foreign_key_referenced_table(
+                                  fk.definitions.front()),
+                              &fk);
+        }
+
+        std::stable_sort(
+            tables.begin(), tables.end(),
+            [](const auto &l, const auto &r) { return l.first < r.first; });
+
+        const auto add_fks = [this, &schema](const std::string &table,
+                                             auto begin, auto end) {
+          const auto q = compatibility::add_foreign_keys_statement(
+              table, std::span<const std::string>{begin, end});
+
           try {
             execute(q);
           } catch (const std::exception &e) {
-            current_console()->print_error(
-                "Error while restoring FOREIGN KEY constraint in schema `" +
-                schema + "` with query: " + q);
+            if (std::next(begin) == end) {
+              current_console()->print_error(
+                  "Error while restoring FOREIGN KEY constraint in schema `" +
+                  schema + "` with query: " + q);
+            } else {
+              log_info(
+                  "Failed to add FOREIGN KEY constraints in a single "
+                  "statement, adding them one at a time, query: %s, error: %s",
+                  q.c_str(), e.what());
+            }
+
             throw;
           }
+        };
+
+        for (const auto &table : tables) {
+          const auto fk = table.second;
+          const auto begin = fk->definitions.begin();
+          const auto end = fk->definitions.end();
+
+          // all constraints of a table are added at once, so that table is
+          // altered only once
+          try {
+            add_fks(fk->table, begin, end);
+          } catch (const std::exception &) {
+            if (std::next(begin) == end) {
+              throw;
+            }
+
+            for (auto it = begin; it != end; ++it) {
+              add_fks(fk->table, it, std::next(it));
+            }
+          }
         }
       }
     }
@@ -1499,6 +2331,7 @@ bool Dump_loader::handle_table_data() {
   std::string table;
   std::string partition;
   shcore::Dictionary_t options;
+  mysqlshdk::storage::Compression_options compression_options;
 
   // Note: job scheduling should preferably load different tables per thread,
   //       each partition is treated as a different table
@@ -1510,13 +2343,14 @@ bool Dump_loader::handle_table_data() {
     }
     if (m_dump->next_table_chunk(tables_being_loaded, &schema, &table,
                                  &partition, &chunked, &index, &total,
-                                 &data_file, &size, &options)) {
+                                 &data_file, &size, &options,
+                                 &compression_options)) {
       const auto chunk = chunked ? index : -1;
       auto status =
           m_load_log->table_chunk_status(schema, table, partition, chunk);
 
       if (status == Load_progress_log::DONE) {
-        m_dump->on_chunk_loaded(schema, table, partition);
+        m_dump->on_chunk_loaded(schema, table, partition, chunk);
       }
 
       log_debug("Table data for %s (%s)",
@@ -1551,9 +2385,14 @@ bool Dump_loader::handle_table_data() {
         if (status != Load_progress_log::DONE) {
           scheduled = schedule_table_chunk(
               schema, table, partition, chunk, std::move(data_file), size,
-              options, status == Load_progress_log::INTERRUPTED, bytes_to_skip);
+              options, compression_options,
+              status == Load_progress_log::INTERRUPTED, bytes_to_skip);
         }
       }
+
+      if (!scheduled && status != Load_progress_log::DONE) {
+        m_dump->on_chunk_skipped(schema, table, partition, chunk);
+      }
     } else {
       scheduled = false;
 
@@ -1573,7 +2412,9 @@ bool Dump_loader::schedule_table_chunk(
     const std::string &schema, const std::string &table,
     const std::string &partition, ssize_t chunk_index,
     std::unique_ptr<mysqlshdk::storage::IFile> file, size_t size,
-    shcore::Dictionary_t options, bool resuming, uint64_t bytes_to_skip) {
+    shcore::Dictionary_t options,
+    const mysqlshdk::storage::Compression_options &compression_options,
+    bool resuming, uint64_t bytes_to_skip) {
   {
     std::lock_guard<std::recursive_mutex> lock(m_skip_schemas_mutex);
 
@@ -1595,7 +2436,8 @@ bool Dump_loader::schedule_table_chunk(
             file->full_path().masked().c_str());
 
   push_pending_task(load_chunk_file(schema, table, partition, std::move(file),
-                                    chunk_index, size, options, resuming,
+                                    chunk_index, size, options,
+                                    compression_options, resuming,
                                     bytes_to_skip));
 
   return true;
@@ -1644,7 +2486,6 @@ size_t Dump_loader::handle_worker_events(
   };
 
   std::list<Worker *> idle_workers;
-  const auto thread_count = m_options.threads_count();
 
   while (idle_workers.size() < m_workers.size()) {
     Worker_event event;
@@ -1652,6 +2493,8 @@ size_t Dump_loader::handle_worker_events(
     // Wait for events from workers, but update progress and check for ^C
     // every now and then
     for (;;) {
+      adjust_concurrency(&idle_workers);
+
       auto event_opt = m_worker_events.try_pop(std::chrono::seconds{1});
       if (event_opt && event_opt->worker) {
         event = std::move(*event_opt);
@@ -1720,16 +2563,18 @@ size_t Dump_loader::handle_worker_events(
       }
 
       case Worker_event::TABLE_DDL_START: {
-        auto task =
-            static_cast<Worker::Table_ddl_task *>(event.worker->current_task());
+        const auto task =
+            static_cast<Worker::Table_ddl_task *>(event.worker->current_task())
+                ->batched_task(event.details);
 
         on_table_ddl_start(task->schema(), task->table(), task->placeholder());
         break;
       }
 
       case Worker_event::TABLE_DDL_END: {
-        auto task =
-            static_cast<Worker::Table_ddl_task *>(event.worker->current_task());
+        const auto task =
+            static_cast<Worker::Table_ddl_task *>(event.worker->current_task())
+                ->batched_task(event.details);
 
         on_table_ddl_end(task->schema(), task->table(), task->placeholder(),
                          task->steal_deferred_statements());
@@ -1744,6 +2589,7 @@ size_t Dump_loader::handle_worker_events(
 
       case Worker_event::INDEX_END: {
         const auto task = event.worker->current_task();
+        m_index_weight -= task->weight();
         on_index_end(task->schema(), task->table());
         break;
       }
@@ -1805,12 +2651,21 @@ size_t Dump_loader::handle_worker_events(
         assert(!m_pending_tasks.empty());
 
         const auto pending_weight = m_pending_tasks.top()->weight();
-
-        if (m_current_weight + pending_weight > thread_count) {
+        // share of the global budget can change while data is being loaded
+        const auto thread_count =
+            std::min(m_concurrency ? m_concurrency->limit()
+                                   : m_options.threads_count(),
+                     m_resources->threads());
+
+        // a task heavier than the current limit is executed once all the
+        // other tasks are done
+        if (m_current_weight > 0 &&
+            m_current_weight + pending_weight > thread_count) {
           // the task is too heavy, wait till more threads are idle
           idle_workers.push_back(event.worker);
         } else {
           event.worker->schedule(m_pending_tasks.pop_top());
+          m_num_pending_tasks = m_pending_tasks.size();
           m_current_weight += pending_weight;
         }
       }
@@ -1827,6 +2682,14 @@ size_t Dump_loader::handle_worker_events(
 }
 
 bool Dump_loader::schedule_next_task() {
+  if (schedule_early_index_task()) {
+    return true;
+  }
+
+  if (schedule_early_checksum_task()) {
+    return true;
+  }
+
   if (!handle_table_data()) {
     std::string schema;
     std::string table;
@@ -1842,14 +2705,17 @@ bool Dump_loader::schedule_next_task() {
 
       if (m_dump->next_deferred_index(&schema, &table, &indexes)) {
         assert(indexes != nullptr);
-        push_pending_task(recreate_indexes(schema, table, indexes));
+        auto task = recreate_indexes(schema, table, indexes);
+        m_index_weight += task->weight();
+        push_pending_task(std::move(task));
         return true;
       }
     }
 
     const auto analyze_tables = m_options.analyze_tables();
 
-    if (Load_dump_options::Analyze_table_mode::OFF != analyze_tables) {
+    if (Load_dump_options::Analyze_table_mode::OFF != analyze_tables &&
+        !m_options.defer_table_analysis()) {
       setup_analyze_tables_progress();
 
       std::vector<Dump_reader::Histogram> histograms;
@@ -1899,6 +2765,91 @@ bool Dump_loader::schedule_next_task() {
   }
 }
 
+bool Dump_loader::schedule_early_index_task() {
+  if (!m_options.load_deferred_indexes() || !m_options.load_data() ||
+      is_data_load_complete()) {
+    // once all data is loaded, indexes are recreated using all the threads
+    return false;
+  }
+
+  const auto index_threads = m_options.index_threads();
+
+  if (m_index_weight >= index_threads) {
+    return false;
+  }
+
+  // tables are checked only if some chunks were loaded since the last check
+  const auto chunks_loaded = m_dump->chunks_loaded();
+
+  if (chunks_loaded == m_index_check_chunks_loaded) {
+    return false;
+  }
+
+  std::string schema;
+  std::string table;
+  compatibility::Deferred_statements::Index_info *indexes = nullptr;
+
+  if (!m_dump->next_deferred_index(&schema, &table, &indexes)) {
+    m_index_check_chunks_loaded = chunks_loaded;
+    return false;
+  }
+
+  assert(indexes != nullptr);
+  setup_create_indexes_progress();
+
+  auto task =
+      recreate_indexes(schema, table, indexes, index_threads - m_index_weight);
+  m_index_weight += task->weight();
+  push_pending_task(std::move(task));
+
+  return true;
+}
+
+bool Dump_loader::schedule_early_checksum_task() {
+  if (!m_options.checksum() || !m_options.load_data() ||
+      is_data_load_complete()) {
+    // once all data is loaded, checksums are verified using all the threads
+    return false;
+  }
+
+  // checksums have lower priority than data, only a fraction of threads is
+  // allowed to verify them while data is being loaded
+  const auto checksum_threads =
+      std::max<uint64_t>(1, m_options.threads_count() / 4);
+
+  if (m_checksum_tasks_to_complete - m_checksum_tasks_completed >=
+      checksum_threads) {
+    return false;
+  }
+
+  // tables are checked only if some chunks were loaded since the last check
+  const auto chunks_loaded = m_dump->chunks_loaded();
+
+  if (chunks_loaded == m_checksum_check_chunks_loaded) {
+    return false;
+  }
+
+  const dump::common::Checksums::Checksum_data *checksum;
+
+  do {
+    if (!m_dump->next_chunk_checksum(&checksum)) {
+      m_checksum_check_chunks_loaded = chunks_loaded;
+      return false;
+    }
+
+    setup_checksum_tables_progress();
+
+    if (maybe_push_checksum_task(checksum)) {
+      ++m_checksum_tasks_to_complete;
+      return true;
+    } else {
+      // task was not scheduled, mark it as complete
+      m_dump->on_checksum_end(checksum->schema(), checksum->table(),
+                              checksum->partition());
+    }
+  } while (true);
+}
+
 void Dump_loader::interrupt() {
   // 1st ^C does a soft interrupt (stop new tasks but let current work finish)
   // 2nd ^C sends kill to all workers
@@ -1922,10 +2873,19 @@ void Dump_loader::hard_interrupt() {
 void Dump_loader::abort() {
   m_worker_interrupt = true;
   m_worker_hard_interrupt = true;
+  m_memory_budget.interrupt();
 }
 
 void Dump_loader::run() {
   try {
+    if (!m_options.status_file().empty()) {
+      m_progress_thread.publish_status(m_options.status_file());
+    }
+
+    if (dump::Progress_format::JSONL == m_options.progress_format()) {
+      m_progress_thread.publish_events(m_options.progress_fd());
+    }
+
     m_progress_thread.start();
     shcore::on_leave_scope cleanup_progress([this]() {
       if (m_worker_interrupt) {
@@ -1937,8 +2897,20 @@ void Dump_loader::run() {
 
     open_dump();
 
+    {
+      const auto &total = m_options.total_rate_limit();
+      m_resources = Resource_governor::instance().acquire(
+          "util.loadDump()", m_options.threads_count(),
+          total ? total->limit() : 0);
+    }
+
+    shcore::on_leave_scope release_resources(
+        [this]() { m_resources.reset(); });
+
     spawn_workers();
 
+    publish_status();
+
     {
       shcore::on_leave_scope cleanup_workers([this]() { join_workers(); });
       execute_tasks();
@@ -1947,6 +2919,8 @@ void Dump_loader::run() {
     translate_current_exception(m_progress_thread);
   }
 
+  write_performance_report();
+
   show_summary();
 
   if (m_worker_interrupt && !m_abort) {
@@ -1961,6 +2935,213 @@ void Dump_loader::run() {
   }
 }
 
+void Dump_loader::write_performance_report() const {
+  if (m_options.performance_report().empty() || m_worker_stats.empty()) {
+    return;
+  }
+
+  using rapidjson::Document;
+  using rapidjson::StringRef;
+  using rapidjson::Type;
+  using rapidjson::Value;
+
+  Document doc{Type::kObjectType};
+  auto &a = doc.GetAllocator();
+
+  const auto to_seconds = [](std::chrono::nanoseconds d) {
+    return std::chrono::duration<double>(d).count();
+  };
+  const auto add_times = [&](std::chrono::nanoseconds busy,
+                             std::chrono::nanoseconds idle,
+                             uint64_t storage_wait, Value *v) {
+    const auto total = busy + idle;
+
+    v->AddMember(StringRef("busySeconds"), to_seconds(busy), a);
+    v->AddMember(StringRef("idleSeconds"), to_seconds(idle), a);
+    v->AddMember(StringRef("storageSeconds"),
+                 to_seconds(std::chrono::nanoseconds{storage_wait}), a);
+    v->AddMember(StringRef("utilization"),
+                 total.count() > 0
+                     ? static_cast<double>(busy.count()) / total.count()
+                     : 0.0,
+                 a);
+  };
+  const auto add_tasks = [&](const Worker_stats &stats, Value *v) {
+    Value tasks{Type::kObjectType};
+
+    for (std::size_t i = 0; i < Worker_stats::k_task_types; ++i) {
+      Value t{Type::kObjectType};
+
+      t.AddMember(StringRef("count"), stats.tasks[i], a);
+      t.AddMember(StringRef("seconds"), to_seconds(stats.busy[i]), a);
+
+      tasks.AddMember(StringRef(Worker_stats::k_task_names[i]), std::move(t),
+                      a);
+    }
+
+    v->AddMember(StringRef("tasks"), std::move(tasks), a);
+  };
+
+  Worker_stats total;
+  Value workers{Type::kArrayType};
+
+  for (std::size_t i = 0; i < m_worker_stats.size(); ++i) {
+    const auto &stats = m_worker_stats[i];
+    const auto storage_wait = stats.storage_wait.load();
+    Value w{Type::kObjectType};
+
+    w.AddMember(StringRef("worker"), static_cast<uint64_t>(i), a);
+    add_times(stats.total_busy(), stats.idle, storage_wait, &w);
+    add_tasks(stats, &w);
+
+    workers.PushBack(std::move(w), a);
+
+    total.idle += stats.idle;
+    total.storage_wait += storage_wait;
+
+    for (std::size_t t = 0; t < Worker_stats::k_task_types; ++t) {
+      total.busy[t] += stats.busy[t];
+      total.tasks[t] += stats.tasks[t];
+    }
+  }
+
+  doc.AddMember(StringRef("threads"),
+                static_cast<uint64_t>(m_worker_stats.size()), a);
+  doc.AddMember(StringRef("seconds"), m_progress_thread.duration().seconds(),
+                a);
+  add_times(total.total_busy(), total.idle, total.storage_wait, &doc);
+  add_tasks(total, &doc);
+  doc.AddMember(StringRef("workers"), std::move(workers), a);
+
+  try {
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    doc.Accept(writer);
+
+    const auto file =
+        mysqlshdk::storage::make_file(m_options.performance_report());
+    file->open(mysqlshdk::storage::Mode::WRITE);
+    file->write(buffer.GetString(), buffer.GetSize());
+    file->close();
+  } catch (const std::exception &e) {
+    current_console()->print_warning(
+        "Failed to write the performance report to '" +
+        m_options.performance_report() + "': " + e.what());
+  }
+}
+
+void Dump_loader::publish_status() {
+  m_progress_thread.set_status_details(
+      [this, last_bytes = m_num_bytes_loaded.load(),
+       last_rows = m_num_rows_loaded.load(),
+       last_time = std::chrono::steady_clock::now()]() mutable {
+        auto details = status_details();
+
+        // throughput since the previous update
+        const auto now = std::chrono::steady_clock::now();
+        const auto seconds =
+            std::chrono::duration<double>(now - last_time).count();
+        const auto bytes = m_num_bytes_loaded.load();
+        const auto rows = m_num_rows_loaded.load();
+
+        if (seconds > 0) {
+          auto throughput = shcore::make_dict();
+          throughput->emplace("bytesPerSecond",
+                              (bytes - last_bytes) / seconds);
+          throughput->emplace("rowsPerSecond", (rows - last_rows) / seconds);
+          details->emplace("throughput", std::move(throughput));
+        }
+
+        last_bytes = bytes;
+        last_rows = rows;
+        last_time = now;
+
+        return details;
+      });
+}
+
+shcore::Dictionary_t Dump_loader::status_details() {
+  auto details = shcore::make_dict();
+
+  details->emplace("bytesLoaded",
+                   static_cast<uint64_t>(m_num_bytes_loaded.load()));
+  details->emplace("rowsLoaded",
+                   static_cast<uint64_t>(m_num_rows_loaded.load()));
+  details->emplace("chunksLoaded",
+                   static_cast<uint64_t>(m_num_chunks_loaded.load()));
+  details->emplace("pendingTasks",
+                   static_cast<uint64_t>(m_num_pending_tasks.load()));
+  details->emplace("dataLoaded", m_data_loaded.load());
+
+  {
+    auto threads = shcore::make_dict();
+    threads->emplace("total", static_cast<uint64_t>(m_worker_stats.size()));
+    threads->emplace("loading",
+                     static_cast<uint64_t>(m_num_threads_loading.load()));
+    threads->emplace(
+        "indexing",
+        static_cast<uint64_t>(m_num_threads_recreating_indexes.load()));
+    threads->emplace(
+        "checksumming",
+        static_cast<uint64_t>(m_num_threads_checksumming.load()));
+    details->emplace("threads", std::move(threads));
+  }
+
+  {
+    auto workers = shcore::make_array();
+
+    for (std::size_t i = 0; i < m_worker_stats.size(); ++i) {
+      const auto task = m_worker_stats[i].current_task.load();
+      auto worker = shcore::make_dict();
+
+      worker->emplace("id", static_cast<uint64_t>(i));
+      worker->emplace("task", task < Worker_stats::k_task_types
+                                  ? Worker_stats::k_task_names[task]
+                                  : "idle");
+
+      workers->emplace_back(std::move(worker));
+    }
+
+    details->emplace("workers", std::move(workers));
+  }
+
+  details->emplace("memory", get_memory_stats());
+
+  {
+    // chunks of each table and partition which are scheduled or being loaded
+    std::map<std::string, std::pair<uint64_t, uint64_t>> in_flight;
+
+    {
+      std::lock_guard<std::mutex> lock(m_tables_being_loaded_mutex);
+
+      for (const auto &t : m_tables_being_loaded) {
+        auto &entry = in_flight[t.first];
+        ++entry.first;
+        entry.second += t.second;
+      }
+    }
+
+    uint64_t bytes_in_flight = 0;
+    auto tables = shcore::make_array();
+
+    for (const auto &t : in_flight) {
+      auto table = shcore::make_dict();
+
+      table->emplace("table", t.first);
+      table->emplace("chunks", t.second.first);
+      table->emplace("bytes", t.second.second);
+      bytes_in_flight += t.second.second;
+
+      tables->emplace_back(std::move(table));
+    }
+
+    details->emplace("bytesInFlight", bytes_in_flight);
+    details->emplace("tablesInFlight", std::move(tables));
+  }
+
+  return details;
+}
+
 void Dump_loader::show_summary() {
   using mysqlshdk::utils::format_bytes;
   using mysqlshdk::utils::format_items;
@@ -2033,6 +3214,36 @@ void Dump_loader::show_summary() {
                            m_num_index_retries.load()));
   }
 
+  {
+    std::chrono::nanoseconds busy{0};
+    std::chrono::nanoseconds idle{0};
+    uint64_t storage_wait = 0;
+
+    for (const auto &stats : m_worker_stats) {
+      busy += stats.total_busy();
+      idle += stats.idle;
+      storage_wait += stats.storage_wait;
+    }
+
+    if (const auto total = (busy + idle).count(); total > 0) {
+      const auto percent = [total](uint64_t value) {
+        return 100.0 * value / total;
+      };
+
+      console->print_info(shcore::str_format(
+          "Thread utilization: %.1f%% busy, %.1f%% idle, %.1f%% spent reading "
+          "remote data files.",
+          percent(busy.count()), percent(idle.count()),
+          percent(storage_wait)));
+    }
+  }
+
+  if (m_memory_budget.limit() > 0) {
+    console->print_info("Peak memory usage of the data buffers: " +
+                        format_bytes(m_memory_budget.peak()) + " (limit: " +
+                        format_bytes(m_memory_budget.limit()) + ").");
+  }
+
   if (!m_options.dry_run()) {
     if (m_checksum_tasks_completed) {
       assert(m_checksum_tables_stage);
@@ -2064,7 +3275,8 @@ void Dump_loader::open_dump() { open_dump(m_options.create_dump_handle()); }
 void Dump_loader::open_dump(
     std::unique_ptr<mysqlshdk::storage::IDirectory> dumpdir) {
   auto console = current_console();
-  m_dump = std::make_unique<Dump_reader>(std::move(dumpdir), m_options);
+  m_dump = std::make_unique<Dump_reader>(std::move(dumpdir), m_options,
+                                         &m_memory_budget);
 
   console->print_status("Opening dump...");
   auto status = m_dump->open();
@@ -2114,6 +3326,13 @@ void Dump_loader::open_dump(
   }
 
   if (status != Dump_reader::Status::COMPLETE) {
+    if (m_dump->has_capability(dump::Capability::PHYSICAL_TABLESPACES)) {
+      console->print_error(
+          "Dump is not yet finished. Dumps which contain copies of the "
+          "tablespace files can only be loaded once they are complete.");
+      THROW_ERROR(SHERR_LOAD_INCOMPLETE_DUMP);
+    }
+
     if (m_options.dump_wait_timeout_ms() > 0) {
       console->print_note(
           "Dump is still ongoing, data will be loaded as it becomes "
@@ -2150,10 +3369,32 @@ void Dump_loader::check_server_version() {
 
   console->print_info(msg);
 
+  if (m_dump->is_incremental()) {
+    console->print_note(
+        "Loading an incremental dump, it contains only the rows which have "
+        "changed since its base dump was created and should be loaded into an "
+        "instance which already contains the base dump.");
+  }
+
   if (target_server < Version(5, 7, 0)) {
     THROW_ERROR(SHERR_LOAD_UNSUPPORTED_SERVER_VERSION);
   }
 
+  if (m_dump->has_capability(dump::Capability::PHYSICAL_TABLESPACES)) {
+    // format of the tablespace files may change between the server versions
+    if (mds || source_server.get_major() != target_server.get_major() ||
+        source_server.get_minor() != target_server.get_minor()) {
+      msg =
+          "Dump contains copies of the InnoDB tablespace files, it can only be "
+          "loaded into a MySQL " +
+          source_server.get_short() +
+          " instance which is running on the same host as the shell.";
+
+      console->print_error(msg);
+      throw std::runtime_error(msg);
+    }
+  }
+
   if (m_options.ignore_version() ||
       (Version(5, 7, 0) <= source_server && source_server < Version(8, 0, 0) &&
        Version(8, 0, 0) <= target_server && target_server < Version(9, 0, 0))) {
@@ -2265,7 +3506,20 @@ void Dump_loader::check_server_version() {
         THROW_ERROR(SHERR_LOAD_UPDATE_GTID_REPLACE_REQUIRES_EMPTY_VARIABLES);
       }
     } else {
-      const char *g = m_dump->gtid_executed().c_str();
+      m_gtid_set_to_append = m_dump->gtid_executed();
+
+      if (m_dump->is_incremental() &&
+          m_options.update_gtid_set() ==
+              Load_dump_options::Update_gtid_set::APPEND) {
+        // incremental dump stores gtid_executed of the whole instance, the
+        // transactions of the base dump were already appended when it was
+        // loaded
+        m_gtid_set_to_append = session.queryf_one_string(
+            0, "", "SELECT GTID_SUBTRACT(?, ?)", m_dump->gtid_executed(),
+            m_dump->base_gtid_executed());
+      }
+
+      const char *g = m_gtid_set_to_append.c_str();
       if (m_options.update_gtid_set() ==
           Load_dump_options::Update_gtid_set::REPLACE) {
         if (!session.queryf_one_int(
@@ -2406,6 +3660,27 @@ std::shared_ptr<mysqlshdk::db::IResult> query_names(
   }
 }
 
+/**
+ * Returns the number of rows in the given table, or nothing if it does not
+ * exist.
+ */
+std::optional<uint64_t> count_rows(mysqlshdk::db::ISession *session,
+                                   const std::string &schema,
+                                   const std::string &table) {
+  try {
+    return session
+        ->query("SELECT COUNT(*) FROM " + schema_object_key(schema, table))
+        ->fetch_one()
+        ->get_uint(0);
+  } catch (const mysqlshdk::db::Error &e) {
+    if (ER_BAD_DB_ERROR == e.code() || ER_NO_SUCH_TABLE == e.code()) {
+      return {};
+    }
+
+    throw;
+  }
+}
+
 }  // namespace
 
 bool Dump_loader::report_duplicates(
@@ -2593,6 +3868,83 @@ void Dump_loader::check_existing_objects() {
   }
 }
 
+void Dump_loader::check_incremental_base() {
+  const auto base_rows = m_dump->base_source_rows();
+
+  if (base_rows.empty()) {
+    return;
+  }
+
+  const auto console = current_console();
+
+  console->print_status(
+      "Checking the rows of the tables loaded from the base dump...");
+
+  bool has_deleted_rows = false;
+
+  for (const auto &schema : base_rows) {
+    for (const auto &table : schema.second) {
+      // missing tables are reported when their data is loaded
+      const auto rows = count_rows(m_session.get(), schema.first, table.first);
+
+      // rows are never removed by the load operation, if there are fewer rows
+      // than the base dump recorded, rows were deleted from the target instance
+      if (rows.has_value() && *rows < table.second) {
+        console->print_error(
+            "Table " + schema_object_key(schema.first, table.first) +
+            " contains " + std::to_string(*rows) + " rows, fewer than the " +
+            std::to_string(table.second) +
+            " rows recorded by the base dump, rows were deleted from it after "
+            "the base dump was loaded.");
+        has_deleted_rows = true;
+      }
+    }
+  }
+
+  if (has_deleted_rows) {
+    throw std::runtime_error(
+        "The incremental dump cannot be loaded into tables whose rows were "
+        "deleted, load the base dump again or use util.loadBinlogs() to apply "
+        "the changes captured by util.dumpBinlogs().");
+  }
+}
+
+void Dump_loader::check_deleted_rows() {
+  const auto source_rows = m_dump->source_rows();
+
+  if (source_rows.empty()) {
+    return;
+  }
+
+  const auto console = current_console();
+  uint64_t tables = 0;
+
+  for (const auto &schema : source_rows) {
+    for (const auto &table : schema.second) {
+      const auto rows = count_rows(m_session.get(), schema.first, table.first);
+
+      if (rows.has_value() && *rows > table.second) {
+        console->print_warning(
+            "Table " + schema_object_key(schema.first, table.first) +
+            " contains " + std::to_string(*rows) + " rows, while the source "
+            "table contained " +
+            std::to_string(table.second) +
+            " rows when the incremental dump was created.");
+        ++tables;
+      }
+    }
+  }
+
+  if (tables > 0) {
+    console->print_warning(
+        std::to_string(tables) +
+        " table(s) contain rows which were deleted from the source instance "
+        "after the base dump was created, incremental dumps do not remove such "
+        "rows. Use util.dumpBinlogs() and util.loadBinlogs() to replicate the "
+        "deletes.");
+  }
+}
+
 void Dump_loader::setup_progress_file(bool *out_is_resuming) {
   auto console = current_console();
 
@@ -2602,10 +3954,19 @@ void Dump_loader::setup_progress_file(bool *out_is_resuming) {
       !m_options.progress_file()->empty()) {
     auto progress_file = m_dump->create_progress_file_handle();
     const auto path = progress_file->full_path().masked();
-    bool rewrite_on_flush = !progress_file->is_local();
+    using mysqlshdk::storage::backend::object_storage::Object;
+    auto mode = Load_progress_log::Write_mode::APPEND;
+
+    if (!progress_file->is_local()) {
+      // object storage backends can create the segments next to the
+      // progress file, other remote files (i.e. PARs) are rewritten
+      mode = dynamic_cast<Object *>(progress_file.get())
+                 ? Load_progress_log::Write_mode::SEGMENTED
+                 : Load_progress_log::Write_mode::REWRITE;
+    }
 
-    auto progress = m_load_log->init(std::move(progress_file),
-                                     m_options.dry_run(), rewrite_on_flush);
+    auto progress =
+        m_load_log->init(std::move(progress_file), m_options.dry_run(), mode);
     if (progress.status != Load_progress_log::PENDING) {
       if (!m_options.reset_progress()) {
         console->print_note(
@@ -2684,7 +4045,26 @@ void Dump_loader::execute_table_ddl_tasks() {
   const auto pool = thread_pool_ptr.get();
   shcore::Synchronized_queue<std::unique_ptr<Worker::Task>> worker_tasks;
 
-  const auto handle_ddl_files = [this, pool, &worker_tasks, &ddl_to_execute](
+  // table DDL scripts are fetched and pre-processed by the thread pool, only a
+  // limited number of them is fetched ahead of the execution, the rest waits
+  // here
+  const auto prefetch_depth =
+      m_options.threads_count() * k_table_ddl_prefetch_depth;
+  Prefetch_queue table_ddl_fetches{prefetch_depth};
+  bool pool_tasks_done = false;
+
+  const auto fetch_table_ddl = [pool, &table_ddl_fetches, &pool_tasks_done,
+                                &all_tasks_scheduled]() {
+    table_ddl_fetches.start();
+
+    if (all_tasks_scheduled && table_ddl_fetches.empty() && !pool_tasks_done) {
+      pool_tasks_done = true;
+      pool->tasks_done();
+    }
+  };
+
+  const auto handle_ddl_files = [this, pool, &worker_tasks, &ddl_to_execute,
+                                 &table_ddl_fetches](
                                     const std::string &s,
                                     std::list<Dump_reader::Name_and_file> *list,
                                     bool placeholder,
@@ -2718,20 +4098,30 @@ void Dump_loader::execute_table_ddl_tasks() {
 
         ++ddl_to_execute;
 
-        pool->add_task(
-            [file = std::move(item.second), s, table = item.first]() {
-              log_debug("Fetching table DDL for %s.%s", s.c_str(),
-                        table.c_str());
-              file->open(mysqlshdk::storage::Mode::READ);
-              auto script = mysqlshdk::storage::read_file(file.get());
-              file->close();
-              return script;
-            },
-            [s, table = item.first, placeholder, &worker_tasks, status,
-             exists](std::string &&data) {
-              worker_tasks.push(std::make_unique<Worker::Table_ddl_task>(
-                  s, table, std::move(data), placeholder, status, exists));
-            });
+        table_ddl_fetches.push([this, pool, &worker_tasks,
+                                file = std::move(item.second), s,
+                                table = item.first, placeholder, status,
+                                exists]() {
+          pool->add_task(
+              [file, s, table]() {
+                log_debug("Fetching table DDL for %s.%s", s.c_str(),
+                          table.c_str());
+                file->open(mysqlshdk::storage::Mode::READ);
+                auto script = mysqlshdk::storage::read_file(file.get());
+                file->close();
+                return script;
+              },
+              [this, s, table, placeholder, &worker_tasks, status,
+               exists](std::string &&data) {
+                auto task = std::make_unique<Worker::Table_ddl_task>(
+                    s, table, std::move(data), placeholder, status, exists);
+                // parse the script while it waits for execution
+                task->prepare(this);
+                worker_tasks.push(std::move(task));
+              },
+              shcore::Thread_pool::Priority::MEDIUM,
+              shcore::Thread_pool::Processing::PARALLEL);
+        });
       }
     }
 #if __GNUC__ >= 12 && !defined(__clang__)
@@ -2786,18 +4176,22 @@ void Dump_loader::execute_table_ddl_tasks() {
     m_schema_ddl_ready[schema] = is_schema_ready;
 
     handle_ddl_files(schema, &tables, false, schema_load_status);
+
+    // start fetching the scripts while remaining schemas are being scheduled
+    fetch_table_ddl();
   }
 
   all_tasks_scheduled = true;
   auto pending_tasks = ddl_to_execute.load();
-  pool->tasks_done();
+  fetch_table_ddl();
 
   {
     std::list<std::unique_ptr<Worker::Task>> schema_tasks;
     std::list<std::unique_ptr<Worker::Task>> table_tasks;
 
     execute_threaded([this, &pool_status, &worker_tasks, &pending_tasks,
-                      &schema_tasks, &table_tasks]() {
+                      &schema_tasks, &table_tasks, &fetch_table_ddl,
+                      &table_ddl_fetches]() {
       while (!m_worker_interrupt) {
         // if there was an exception in the thread pool, interrupt the process
         if (pool_status == shcore::Thread_pool::Async_state::TERMINATED) {
@@ -2805,10 +4199,14 @@ void Dump_loader::execute_table_ddl_tasks() {
           break;
         }
 
+        fetch_table_ddl();
+
         std::unique_ptr<Worker::Task> work;
 
-        // don't fetch too many tasks at once, as we may starve worker threads
-        auto tasks_to_fetch = m_options.threads_count();
+        // don't fetch too many tasks at once, as we may starve worker threads,
+        // fetch enough of them to fill the batches
+        auto tasks_to_fetch =
+            m_options.threads_count() * Ddl_batch::k_max_tables;
 
         // move tasks from the queue in the processing thread to the main thread
         while (pending_tasks > 0 && tasks_to_fetch > 0) {
@@ -2856,12 +4254,39 @@ void Dump_loader::execute_table_ddl_tasks() {
           }
 
           if (end != best) {
+            const auto s = (*best)->schema();
             // mark the schema as being loaded
-            ++m_ddl_in_progress_per_schema[(*best)->schema()];
+            ++m_ddl_in_progress_per_schema[s];
             // schedule task for execution
             work = std::move(*best);
             // remove the task
             table_tasks.erase(best);
+            // make room for the next script to be fetched
+            table_ddl_fetches.consumed();
+
+            // if there are more tables of this schema than threads, execute
+            // DDL of some of them in a single query, to save round trips
+            const auto batch =
+                static_cast<Worker::Table_ddl_task *>(work.get());
+            auto batch_size = Ddl_batch::tables_to_add(
+                static_cast<std::size_t>(std::count_if(
+                    table_tasks.begin(), table_tasks.end(),
+                    [&s](const auto &t) { return t->schema() == s; })),
+                m_options.threads_count());
+
+            for (auto it = table_tasks.begin();
+                 batch_size > 0 && it != table_tasks.end();) {
+              if ((*it)->schema() == s) {
+                ++m_ddl_in_progress_per_schema[s];
+                batch->add_to_batch(std::unique_ptr<Worker::Table_ddl_task>(
+                    static_cast<Worker::Table_ddl_task *>(it->release())));
+                it = table_tasks.erase(it);
+                table_ddl_fetches.consumed();
+                --batch_size;
+              } else {
+                ++it;
+              }
+            }
           }
         }
 
@@ -3020,7 +4445,7 @@ void Dump_loader::execute_tasks() {
 
   check_server_version();
 
-  m_session = create_session();
+  m_session = create_session(m_options.connection_options());
 
   log_server_version();
 
@@ -3032,10 +4457,25 @@ void Dump_loader::execute_tasks() {
 
   handle_schema_option();
 
-  if (!m_resuming && m_options.load_ddl()) check_existing_objects();
+  // incremental dumps are loaded on top of the existing objects
+  if (!m_resuming && m_options.load_ddl() && !m_dump->is_incremental())
+    check_existing_objects();
+
+  if (!m_resuming && m_options.load_data() && m_dump->is_incremental())
+    check_incremental_base();
 
   check_tables_without_primary_key();
 
+  if (m_options.fast_load() && !m_options.dry_run()) {
+    disable_durability();
+  }
+
+  // restores durability settings if load is interrupted or fails, this is a
+  // no-op if they were already restored by on_dump_end()
+  shcore::on_leave_scope restore_settings([this]() { restore_durability(); });
+
+  setup_concurrency();
+
   size_t num_idle_workers = 0;
 
   do {
@@ -3100,12 +4540,77 @@ void Dump_loader::execute_tasks() {
 
   if (!m_worker_interrupt) {
     on_dump_end();
+
+    if (m_options.defer_table_analysis()) {
+      execute_deferred_analyze_tasks();
+    }
+  }
+
+  if (!m_worker_interrupt) {
     m_load_log->cleanup();
   }
 
   log_debug("Import done");
 }
 
+void Dump_loader::execute_deferred_analyze_tasks() {
+  m_data_loaded = true;
+  m_load_log->data_loaded();
+
+  const auto threads = std::min<std::size_t>(k_deferred_analyze_threads,
+                                             m_options.threads_count());
+  const auto console = current_console();
+
+  console->print_status(
+      "Data and indexes are loaded, the database is ready to be used.");
+  console->print_status(shcore::str_format(
+      "Analyzing tables in the background using %zu thread%s", threads,
+      1 == threads ? "" : "s"));
+
+  setup_analyze_tables_progress();
+
+  const auto analyze_all = Load_dump_options::Analyze_table_mode::ON ==
+                           m_options.analyze_tables();
+  std::string schema;
+  std::string table;
+  std::vector<Dump_reader::Histogram> histograms;
+
+  execute_threaded([&, this]() {
+    while (!m_worker_interrupt) {
+      // tables are analyzed using a limited number of threads, in order not to
+      // compete with the application
+      if (m_tables_to_analyze - m_tables_analyzed >= threads) {
+        return false;
+      }
+
+      if (!m_dump->next_table_analyze(&schema, &table, &histograms)) {
+        m_all_analyze_tasks_scheduled = true;
+        return false;
+      }
+
+      // if Analyze_table_mode is HISTOGRAM, only analyze tables with
+      // histogram info in the dump
+      if (!analyze_all && histograms.empty()) {
+        continue;
+      }
+
+      if (Load_progress_log::DONE ==
+          m_load_log->analyze_table_status(schema, table)) {
+        log_info("Table `%s`.`%s` was already analyzed", schema.c_str(),
+                 table.c_str());
+        m_dump->on_analyze_end(schema, table);
+        continue;
+      }
+
+      ++m_tables_to_analyze;
+      push_pending_task(analyze_table(schema, table, histograms));
+      return true;
+    }
+
+    return false;
+  });
+}
+
 void Dump_loader::wait_for_metadata() {
   const auto start_time = std::chrono::steady_clock::now();
   const auto console = current_console();
@@ -3197,9 +4702,12 @@ void Dump_loader::wait_for_dump(
   if (m_options.dump_wait_timeout_ms() < 1000) {
     shcore::sleep_ms(m_options.dump_wait_timeout_ms());
   } else {
-    // wait for at most 5s at a time and try again
+    // wait for at most 5s at a time and try again, reading the journal is
+    // cheap, so it's checked every second
+    const uint64_t max_wait = m_dump->has_journal() ? 1000 : 5000;
+
     for (uint64_t j = 0;
-         j < std::min<uint64_t>(5000, m_options.dump_wait_timeout_ms()) &&
+         j < std::min<uint64_t>(max_wait, m_options.dump_wait_timeout_ms()) &&
          !m_worker_interrupt;
          j += 1000) {
       shcore::sleep_ms(1000);
@@ -3207,19 +4715,82 @@ void Dump_loader::wait_for_dump(
   }
 }
 
+void Dump_loader::setup_concurrency() {
+  const auto min_threads = m_options.min_threads();
+
+  if (!min_threads.has_value() || *min_threads >= m_options.threads_count()) {
+    return;
+  }
+
+  m_concurrency.emplace(*min_threads, m_options.threads_count());
+  m_next_concurrency_check = std::chrono::steady_clock::now();
+
+  current_console()->print_note(shcore::str_format(
+      "The number of threads is going to be adjusted between %" PRIu64
+      " and %" PRIu64 ", depending on the load of the target instance.",
+      *min_threads, m_options.threads_count()));
+}
+
+void Dump_loader::adjust_concurrency(std::list<Worker *> *idle_workers) {
+  if (!m_concurrency) {
+    return;
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+
+  if (now < m_next_concurrency_check) {
+    return;
+  }
+
+  m_next_concurrency_check = now + k_concurrency_check_interval;
+
+  const auto previous = m_concurrency->limit();
+  const auto reason = m_concurrency->update(Concurrency_controller::sample(
+      m_session, m_options.target_server_version()));
+  const auto limit = m_concurrency->limit();
+
+  if (limit != previous) {
+    log_info("Number of threads changed from %" PRIu64 " to %" PRIu64 "%s",
+             previous, limit, reason.empty() ? "" : (", " + reason).c_str());
+  }
+
+  // wake up the idle workers, so they can pick up more work
+  for (auto added = limit > previous ? limit - previous : 0;
+       added > 0 && !idle_workers->empty(); --added) {
+    m_worker_events.push({Worker_event::READY, idle_workers->front(), {}});
+    idle_workers->pop_front();
+  }
+}
+
 void Dump_loader::spawn_workers() {
   m_thread_exceptions.resize(m_options.threads_count());
+  m_worker_stats = std::vector<Worker_stats>(m_options.threads_count());
+
+  m_decompression_pool =
+      std::make_unique<Decompression_pool>(m_options.threads_count());
+
+  m_worker_connection_options = m_options.connection_options();
+  dump::common::set_session_compression(m_options.session_compression(),
+                                        m_options.base_session(),
+                                        &m_worker_connection_options);
+
+  const auto affinity = mysqlshdk::utils::to_thread_affinity(
+      current_shell_options()->get().util.thread_affinity);
 
   for (uint64_t i = 0; i < m_options.threads_count(); i++) {
     m_workers.emplace_back(i, this);
 
     Worker &worker = m_workers.back();
 
-    m_worker_threads.push_back(mysqlsh::spawn_scoped_thread([&worker]() {
-      mysqlsh::Mysql_thread mysql_thread;
+    m_worker_threads.push_back(
+        mysqlsh::spawn_scoped_thread([&worker, affinity, i]() {
+          // pin the thread before any buffers are allocated
+          mysqlshdk::utils::pin_worker_thread(affinity, i);
+
+          mysqlsh::Mysql_thread mysql_thread;
 
-      worker.run();
-    }));
+          worker.run();
+        }));
   }
 }
 
@@ -3230,6 +4801,8 @@ void Dump_loader::join_workers() {
   for (auto &t : m_worker_threads)
     if (t.joinable()) t.join();
   log_debug("All worker threads stopped");
+
+  m_decompression_pool.reset();
 }
 
 void Dump_loader::clear_worker(Worker *worker) {
@@ -3290,7 +4863,7 @@ void Dump_loader::on_chunk_load_end(const std::string &schema,
   m_load_log->end_table_chunk(schema, table, partition, index, bytes_loaded,
                               raw_bytes_loaded, rows_loaded);
 
-  m_dump->on_chunk_loaded(schema, table, partition);
+  m_dump->on_chunk_loaded(schema, table, partition, index);
 
   m_unique_tables_loaded.insert(
       schema_table_object_key(schema, table, partition));
@@ -3400,34 +4973,52 @@ void Dump_loader::Sql_transform::add_strip_removed_sql_modes() {
   // does in 5.7
 
   add([](std::string_view sql, std::string *out_new_sql) {
-    static std::regex re(
-        R"*((\/\*![0-9]+\s+)?(SET\s+sql_mode\s*=\s*')(.*)('.*))*",
-        std::regex::icase | std::regex::optimize);
+    mysqlshdk::utils::SQL_iterator it(sql, 0, false);
+
+    if (!it.consume_tokens("SET", "sql_mode", "=")) {
+      return false;
+    }
+
+    const auto [modes, offset] = it.next_token_and_offset();
+
+    if (modes.length() < 2 || '\'' != modes.front() || '\'' != modes.back()) {
+      return false;
+    }
 
-    std::cmatch m;
-    if (std::regex_match(sql.data(), sql.data() + sql.size(), m, re)) {
-      auto modes = shcore::str_split(m[3].str(), ",");
-      std::string new_modes;
-      for (const auto &mode : modes) {
-        if (mode != "NO_AUTO_CREATE_USER")
-          new_modes.append(mode).append(1, ',');
+    std::string new_modes;
+    bool changed = false;
+
+    for (const auto &mode :
+         shcore::str_split(modes.substr(1, modes.length() - 2), ",")) {
+      if (mode == "NO_AUTO_CREATE_USER") {
+        changed = true;
+      } else {
+        new_modes.append(mode).append(1, ',');
       }
-      if (!new_modes.empty()) new_modes.pop_back();  // strip last ,
+    }
 
-      *out_new_sql = m[1].str() + m[2].str() + new_modes + m[4].str();
-    } else {
-      *out_new_sql = sql;
+    if (!changed) {
+      return false;
     }
+
+    if (!new_modes.empty()) new_modes.pop_back();  // strip last ,
+
+    const auto end = offset + modes.length() - 1;
+
+    out_new_sql->clear();
+    out_new_sql->reserve(sql.length());
+    out_new_sql->append(sql.substr(0, offset + 1));
+    out_new_sql->append(new_modes);
+    out_new_sql->append(sql.substr(end));
+
+    return true;
   });
 }
 
 void Dump_loader::Sql_transform::add_execute_conditionally(
     std::function<bool(std::string_view, const std::string &)> f) {
   add([f = std::move(f)](std::string_view sql, std::string *out_new_sql) {
-    *out_new_sql = sql;
-
-    std::string sql_str{sql};
-    mysqlshdk::utils::SQL_iterator it(sql_str, 0, false);
+    mysqlshdk::utils::SQL_iterator it(sql, 0, false);
 
     while (it.valid()) {
       auto token = it.next_token();
@@ -3478,20 +5069,21 @@ void Dump_loader::Sql_transform::add_execute_conditionally(
 
         if (!f(type, object_name)) {
           out_new_sql->clear();
+          return true;
         }
       }
 
-      return;
+      return false;
     }
+
+    return false;
   });
 }
 
 void Dump_loader::Sql_transform::add_rename_schema(std::string_view new_name) {
   add([new_name = std::string{new_name}](std::string_view sql,
                                          std::string *out_new_sql) {
-    std::string sql_str{sql};
-
-    mysqlshdk::utils::SQL_iterator it(sql_str, 0, false);
+    mysqlshdk::utils::SQL_iterator it(sql, 0, false);
     const auto token = it.next_token();
 
     if (shcore::str_caseeq(token, "CREATE")) {
@@ -3507,17 +5099,17 @@ void Dump_loader::Sql_transform::add_rename_schema(std::string_view new_name) {
           schema = it.next_token();
         }
 
-        *out_new_sql = sql_str.substr(0, it.position() - schema.length()) +
-                       shcore::quote_identifier(new_name) +
-                       sql_str.substr(it.position());
-        return;
+        *out_new_sql = sql.substr(0, it.position() - schema.length());
+        *out_new_sql += shcore::quote_identifier(new_name);
+        *out_new_sql += sql.substr(it.position());
+        return true;
       }
     } else if (shcore::str_caseeq(token, "USE")) {
       *out_new_sql = "USE " + shcore::quote_identifier(new_name);
-      return;
+      return true;
     }
 
-    *out_new_sql = std::move(sql_str);
+    return false;
   });
 }
 
@@ -3561,7 +5153,7 @@ void Dump_loader::setup_load_data_progress() {
       }
     }
 
-    return m_num_bytes_loaded;
+    return m_num_bytes_loaded.load();
   };
   config.total = [this]() { return m_dump->filtered_data_size(); };
 
@@ -3693,7 +5285,7 @@ void Dump_loader::on_ddl_done_for_schema(const std::string &schema) {
 
 bool Dump_loader::is_data_load_complete() const {
   return Dump_reader::Status::COMPLETE == m_dump->status() &&
-         m_num_bytes_loaded >= m_dump->filtered_data_size();
+         m_num_bytes_loaded.load() >= m_dump->filtered_data_size();
 }
 
 void Dump_loader::log_server_version() const {
@@ -3714,14 +5306,16 @@ void Dump_loader::push_pending_task(Task_ptr task) {
   }
 
   m_pending_tasks.emplace(std::move(task));
+  m_num_pending_tasks = m_pending_tasks.size();
 }
 
 Dump_loader::Task_ptr Dump_loader::load_chunk_file(
     const std::string &schema, const std::string &table,
     const std::string &partition,
     std::unique_ptr<mysqlshdk::storage::IFile> file, ssize_t chunk_index,
-    size_t chunk_size, const shcore::Dictionary_t &options, bool resuming,
-    uint64_t bytes_to_skip) const {
+    size_t chunk_size, const shcore::Dictionary_t &options,
+    const mysqlshdk::storage::Compression_options &compression_options,
+    bool resuming, uint64_t bytes_to_skip) const {
   log_debug("Loading data for %s",
             format_table(schema, table, partition, chunk_index).c_str());
   assert(!schema.empty());
@@ -3735,8 +5329,8 @@ Dump_loader::Task_ptr Dump_loader::load_chunk_file(
   // chunk needs to be scheduled.
 
   auto task = std::make_unique<Worker::Load_chunk_task>(
-      schema, table, partition, chunk_index, std::move(file), options, resuming,
-      bytes_to_skip);
+      schema, table, partition, chunk_index, std::move(file), options,
+      compression_options, resuming, bytes_to_skip);
   task->raw_bytes_loaded = chunk_size;
 
   return task;
@@ -3744,7 +5338,8 @@ Dump_loader::Task_ptr Dump_loader::load_chunk_file(
 
 Dump_loader::Task_ptr Dump_loader::recreate_indexes(
     const std::string &schema, const std::string &table,
-    compatibility::Deferred_statements::Index_info *indexes) const {
+    compatibility::Deferred_statements::Index_info *indexes,
+    uint64_t max_weight) const {
   log_debug("Recreating indexes for `%s`.`%s`", schema.c_str(), table.c_str());
   assert(!schema.empty());
   assert(!table.empty());
@@ -3765,8 +5360,23 @@ Dump_loader::Task_ptr Dump_loader::recreate_indexes(
 
   DBUG_EXECUTE_IF("dump_loader_force_index_weight", { weight = 4; });
 
+  // weight is capped in push_pending_task(), do it here, so that the weight of
+  // the task is known
+  weight = std::min<uint64_t>(weight, m_options.threads_count());
+  uint64_t ddl_threads = 0;
+
+  if (max_weight > 0) {
+    // task is executed while data is being loaded, limit the number of threads
+    // used by the server, so that it does not exceed the weight of the task
+    weight = std::min(weight, max_weight);
+
+    if (m_options.target_server_version() >= Version(8, 0, 27)) {
+      ddl_threads = weight;
+    }
+  }
+
   return std::make_unique<Worker::Index_recreation_task>(schema, table, indexes,
-                                                         weight);
+                                                         weight, ddl_threads);
 }
 
 Dump_loader::Task_ptr Dump_loader::analyze_table(
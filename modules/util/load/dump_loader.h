@@ -24,11 +24,14 @@
 #ifndef MODULES_UTIL_LOAD_DUMP_LOADER_H_
 #define MODULES_UTIL_LOAD_DUMP_LOADER_H_
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <exception>
 #include <limits>
 #include <list>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <regex>
 #include <set>
@@ -40,12 +43,16 @@
 #include <utility>
 #include <vector>
 
+#include "modules/util/common/resource_governor.h"
 #include "modules/util/dump/compatibility.h"
 #include "modules/util/dump/progress_thread.h"
 
+#include "modules/util/load/concurrency_controller.h"
+#include "modules/util/load/decompression_pool.h"
 #include "modules/util/load/dump_reader.h"
 #include "modules/util/load/load_dump_options.h"
 #include "modules/util/load/load_progress_log.h"
+#include "modules/util/load/memory_budget.h"
 
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/storage/ifile.h"
@@ -54,6 +61,10 @@
 
 namespace mysqlsh {
 
+namespace import_table {
+class Load_data_worker;
+}  // namespace import_table
+
 class Dump_loader {
  public:
   Dump_loader() = delete;
@@ -84,6 +95,15 @@ class Dump_loader {
    public:
     class Task {
      public:
+      enum class Type {
+        SCHEMA_DDL,
+        TABLE_DDL,
+        LOAD_CHUNK,
+        ANALYZE_TABLE,
+        INDEX_RECREATION,
+        CHECKSUM,
+      };
+
       Task(std::string_view schema, std::string_view table)
           : m_schema(schema),
             m_table(table),
@@ -94,6 +114,8 @@ class Dump_loader {
           const std::shared_ptr<mysqlshdk::db::mysql::Session> &, Worker *,
           Dump_loader *) = 0;
 
+      virtual Type type() const = 0;
+
       size_t id() const { return m_id; }
       const char *log_id() const { return m_log_id.c_str(); }
       const std::string &schema() const { return m_schema; }
@@ -133,6 +155,8 @@ class Dump_loader {
       bool execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
                    Worker *, Dump_loader *) override;
 
+      Type type() const override { return Type::SCHEMA_DDL; }
+
      private:
       std::string m_script;
       bool m_resuming;
@@ -152,6 +176,8 @@ class Dump_loader {
       bool execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
                    Worker *, Dump_loader *) override;
 
+      Type type() const override { return Type::TABLE_DDL; }
+
       std::unique_ptr<compatibility::Deferred_statements>
       steal_deferred_statements() {
         return std::move(m_deferred_statements);
@@ -159,9 +185,44 @@ class Dump_loader {
 
       bool placeholder() const { return m_placeholder; }
 
+      /**
+       * Adds a task of another table from the same schema, DDL of all tables
+       * in a batch is executed using a single query.
+       */
+      void add_to_batch(std::unique_ptr<Table_ddl_task> task) {
+        m_batch.emplace_back(std::move(task));
+      }
+
+      /**
+       * Provides the task identified by the details of a worker event.
+       */
+      Table_ddl_task *batched_task(const shcore::Dictionary_t &details);
+
+      /**
+       * Pre-processes the script before the task is scheduled for execution,
+       * can be called from any thread. Errors are reported once the task is
+       * executed.
+       */
+      void prepare(Dump_loader *loader);
+
      private:
+      bool execute_batch(
+          const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+          Worker *worker, Dump_loader *loader);
+
+      void load_ddl_batch(
+          const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+          Dump_loader *loader, const std::vector<Table_ddl_task *> &tasks,
+          Table_ddl_task **current);
+
       void pre_process(Dump_loader *loader);
 
+      bool should_load_ddl(Dump_loader *loader) const;
+
+      void execute_ddl(
+          const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+          Dump_loader *loader);
+
       void load_ddl(
           const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
           Dump_loader *loader);
@@ -176,6 +237,14 @@ class Dump_loader {
           const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
           Dump_loader *loader);
 
+      /**
+       * Replaces the tablespace of a newly created table with the copy of
+       * the tablespace stored in a physical dump.
+       */
+      void import_tablespaces(
+          const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+          Dump_loader *loader);
+
      private:
       std::string m_script;
       bool m_placeholder = false;
@@ -184,6 +253,11 @@ class Dump_loader {
       std::unique_ptr<compatibility::Deferred_statements> m_deferred_statements;
 
       bool m_exists = false;
+
+      bool m_prepared = false;
+      std::exception_ptr m_prepare_error;
+
+      std::vector<std::unique_ptr<Table_ddl_task>> m_batch;
     };
 
     class Table_data_task : public Task {
@@ -213,11 +287,13 @@ class Dump_loader {
       Load_chunk_task(std::string_view schema, std::string_view table,
                       std::string_view partition, ssize_t chunk_index,
                       std::unique_ptr<mysqlshdk::storage::IFile> file,
-                      shcore::Dictionary_t options, bool resume,
-                      uint64_t bytes_to_skip)
+                      shcore::Dictionary_t options,
+                      mysqlshdk::storage::Compression_options compression,
+                      bool resume, uint64_t bytes_to_skip)
           : Table_data_task(schema, table, partition, chunk_index),
             m_file(std::move(file)),
             m_options(options),
+            m_compression_options(std::move(compression)),
             m_resume(resume),
             m_bytes_to_skip(bytes_to_skip) {}
 
@@ -228,12 +304,20 @@ class Dump_loader {
       bool execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
                    Worker *, Dump_loader *) override;
 
+      Type type() const override { return Type::LOAD_CHUNK; }
+
       void load(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
                 Dump_loader *, Worker *);
 
      private:
+      bool bulk_load(
+          const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+          Dump_loader *loader, mysqlshdk::storage::Compression compression,
+          import_table::Load_data_worker *op);
+
       std::unique_ptr<mysqlshdk::storage::IFile> m_file;
       shcore::Dictionary_t m_options;
+      mysqlshdk::storage::Compression_options m_compression_options;
       bool m_resume = false;
       uint64_t m_bytes_to_skip = 0;
     };
@@ -247,6 +331,8 @@ class Dump_loader {
       bool execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
                    Worker *, Dump_loader *) override;
 
+      Type type() const override { return Type::ANALYZE_TABLE; }
+
      private:
       std::vector<Dump_reader::Histogram> m_histograms;
     };
@@ -256,16 +342,22 @@ class Dump_loader {
       Index_recreation_task(
           std::string_view schema, std::string_view table,
           compatibility::Deferred_statements::Index_info *indexes,
-          uint64_t weight)
-          : Task(schema, table), m_indexes(indexes) {
+          uint64_t weight, uint64_t ddl_threads = 0)
+          : Task(schema, table),
+            m_indexes(indexes),
+            m_ddl_threads(ddl_threads) {
         set_weight(weight);
       }
 
       bool execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
                    Worker *, Dump_loader *) override;
 
+      Type type() const override { return Type::INDEX_RECREATION; }
+
      private:
       compatibility::Deferred_statements::Index_info *m_indexes;
+      // if non-zero, value of innodb_ddl_threads used by this task
+      uint64_t m_ddl_threads;
     };
 
     class Checksum_task : public Table_data_task {
@@ -281,6 +373,8 @@ class Dump_loader {
       bool execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
                    Worker *, Dump_loader *) override;
 
+      Type type() const override { return Type::CHECKSUM; }
+
       const dump::common::Checksums::Checksum_data *checksum_info()
           const noexcept {
         return m_checksum;
@@ -326,6 +420,39 @@ class Dump_loader {
     std::unique_ptr<Task> m_task;
 
     shcore::Synchronized_queue<bool> m_work_ready;
+
+    // state of the session which was set up to load the data, session setup
+    // is skipped if consecutive chunks are loaded into the same schema
+    struct Data_session_state {
+      std::string schema;
+      std::string character_set;
+    };
+
+    std::optional<Data_session_state> m_data_session;
+  };
+
+  struct Worker_stats {
+    static constexpr std::size_t k_task_types =
+        static_cast<std::size_t>(Worker::Task::Type::CHECKSUM) + 1;
+
+    // names of the task types, indexed by the task type
+    static constexpr std::array<const char *, k_task_types> k_task_names = {
+        "schemaDdl",       "tableDdl", "loadChunk", "analyzeTable",
+        "recreateIndexes", "checksum"};
+
+    // time spent waiting for a task to be scheduled
+    std::chrono::nanoseconds idle{0};
+    // time spent executing the tasks, indexed by the task type
+    std::array<std::chrono::nanoseconds, k_task_types> busy{};
+    std::array<uint64_t, k_task_types> tasks{};
+    // time spent opening and reading the remote data files, in nanoseconds,
+    // these can be read by the decompression threads as well
+    std::atomic<uint64_t> storage_wait{0};
+    // type of the task which is currently executed, k_task_types if idle, can
+    // be read by the progress thread
+    std::atomic<std::size_t> current_task{k_task_types};
+
+    std::chrono::nanoseconds total_busy() const;
   };
 
   using Task_ptr = std::unique_ptr<Worker::Task>;
@@ -374,18 +501,36 @@ class Dump_loader {
   void execute_tasks();
   void execute_table_ddl_tasks();
   void execute_view_ddl_tasks();
+  void execute_deferred_analyze_tasks();
 
   void wait_for_metadata();
   bool scan_for_more_data(bool wait = true);
   void wait_for_dump(std::chrono::steady_clock::time_point start_time);
 
-  std::shared_ptr<mysqlshdk::db::mysql::Session> create_session();
+  std::shared_ptr<mysqlshdk::db::mysql::Session> create_session(
+      const mysqlshdk::db::Connection_options &options);
 
   void show_summary();
 
+  void write_performance_report() const;
+
+  void publish_status();
+
+  shcore::Dictionary_t status_details();
+
   void on_dump_begin();
   void on_dump_end();
 
+  /**
+   * Disables the redo log and the doublewrite buffer, used by fastLoad.
+   */
+  void disable_durability();
+
+  /**
+   * Restores the redo log and the doublewrite buffer, if they were disabled.
+   */
+  void restore_durability();
+
   bool handle_table_data();
   void handle_schema_post_scripts();
 
@@ -397,14 +542,43 @@ class Dump_loader {
                             const std::string &partition, ssize_t chunk_index,
                             std::unique_ptr<mysqlshdk::storage::IFile> file,
                             size_t size, shcore::Dictionary_t options,
+                            const mysqlshdk::storage::Compression_options &
+                                compression_options,
                             bool resuming, uint64_t bytes_to_skip);
 
   bool schedule_next_task();
+
+  /**
+   * Schedules recreation of indexes of a table which has all its data loaded,
+   * while data of other tables is still being loaded. Number of threads used
+   * by such tasks is limited by the indexThreads option.
+   */
+  bool schedule_early_index_task();
+
+  /**
+   * Schedules verification of checksums of chunks which were already loaded,
+   * while data of other chunks is still being loaded. Up to a quarter of
+   * threads can be used by such tasks.
+   */
+  bool schedule_early_checksum_task();
+
   size_t handle_worker_events(const std::function<bool()> &schedule_next);
 
   void execute_threaded(const std::function<bool()> &schedule_next);
 
   void check_existing_objects();
+
+  /**
+   * Refuses to load an incremental dump if rows were deleted from the tables
+   * which were loaded from its base dump.
+   */
+  void check_incremental_base();
+
+  /**
+   * Warns about tables which contain rows deleted from the source instance,
+   * these are not removed when an incremental dump is loaded.
+   */
+  void check_deleted_rows();
   bool report_duplicates(const std::string &what, const std::string &schema,
                          std::list<Dump_reader::Object_info *> *objects,
                          mysqlshdk::db::IResult *result);
@@ -412,6 +586,10 @@ class Dump_loader {
   void open_dump();
   void open_dump(std::unique_ptr<mysqlshdk::storage::IDirectory> dumpdir);
   void setup_progress_file(bool *out_is_resuming);
+  void setup_concurrency();
+
+  void adjust_concurrency(std::list<Worker *> *idle_workers);
+
   void spawn_workers();
   void join_workers();
 
@@ -528,12 +706,15 @@ class Dump_loader {
                            const std::string &partition,
                            std::unique_ptr<mysqlshdk::storage::IFile> file,
                            ssize_t chunk_index, size_t chunk_size,
-                           const shcore::Dictionary_t &options, bool resuming,
-                           uint64_t bytes_to_skip) const;
+                           const shcore::Dictionary_t &options,
+                           const mysqlshdk::storage::Compression_options
+                               &compression_options,
+                           bool resuming, uint64_t bytes_to_skip) const;
 
   Task_ptr recreate_indexes(
       const std::string &schema, const std::string &table,
-      compatibility::Deferred_statements::Index_info *indexes) const;
+      compatibility::Deferred_statements::Index_info *indexes,
+      uint64_t max_weight = 0) const;
 
   Task_ptr analyze_table(
       const std::string &schema, const std::string &table,
@@ -556,14 +737,23 @@ class Dump_loader {
     bool operator()(std::string_view sql, std::string *out_new_sql) const {
       if (m_ops.empty()) return false;
 
-      std::string orig_sql(sql);
+      std::string current_sql;
       std::string new_sql;
+      bool changed = false;
 
+      // statement is copied only if it's modified by one of the transforms
       for (const auto &f : m_ops) {
-        f(orig_sql, &new_sql);
-        orig_sql = std::move(new_sql);
+        if (f(changed ? current_sql : sql, &new_sql)) {
+          current_sql = std::move(new_sql);
+          changed = true;
+        }
+      }
+
+      if (changed) {
+        *out_new_sql = std::move(current_sql);
+      } else {
+        *out_new_sql = sql;
       }
-      *out_new_sql = std::move(orig_sql);
 
       return true;
     }
@@ -588,25 +778,57 @@ class Dump_loader {
     void add_rename_schema(std::string_view new_name);
 
    private:
-    void add(std::function<void(std::string_view, std::string *)> f) {
+    /**
+     * Adds a transform, it should return true if the statement was modified
+     * and written to the output argument.
+     */
+    void add(std::function<bool(std::string_view, std::string *)> f) {
       m_ops.emplace_back(std::move(f));
     }
 
-    std::list<std::function<void(std::string_view, std::string *)>> m_ops;
+    std::list<std::function<bool(std::string_view, std::string *)>> m_ops;
   };
 
   const Load_dump_options &m_options;
 
+  // shared by the buffers of all the threads, needs to outlive them
+  Memory_budget m_memory_budget;
+
   std::unique_ptr<Dump_reader> m_dump;
   std::unique_ptr<Load_progress_log> m_load_log;
   bool m_resuming = false;
+  // GTID set appended to GTID_PURGED when updateGtidSet is set to "append"
+  std::string m_gtid_set_to_append;
 
   std::shared_ptr<mysqlshdk::db::ISession> m_session;
 
   std::vector<std::thread> m_worker_threads;
   std::list<Worker> m_workers;
+  // indexed by the worker ID, each entry is written by its worker thread
+  std::vector<Worker_stats> m_worker_stats;
+
+  // connection options of the worker sessions
+  mysqlshdk::db::Connection_options m_worker_connection_options;
+  // decompresses the data files for the worker threads
+  std::unique_ptr<Decompression_pool> m_decompression_pool;
+  // adjusts the number of active threads, if minThreads option is set
+  std::optional<Concurrency_controller> m_concurrency;
+  // resources granted by the process-wide governor
+  std::unique_ptr<Resource_governor::Lease> m_resources;
+  std::chrono::steady_clock::time_point m_next_concurrency_check;
   Queue m_pending_tasks;
+  // size of m_pending_tasks, can be read by the progress thread
+  std::atomic<std::size_t> m_num_pending_tasks{0};
   uint64_t m_current_weight = 0;
+  // weight of the index recreation tasks which are currently executed
+  uint64_t m_index_weight = 0;
+  // number of loaded chunks when tables were last checked for indexes to be
+  // recreated while data is being loaded
+  uint64_t m_index_check_chunks_loaded = std::numeric_limits<uint64_t>::max();
+  // number of loaded chunks when tables were last checked for checksums to be
+  // verified while data is being loaded
+  uint64_t m_checksum_check_chunks_loaded =
+      std::numeric_limits<uint64_t>::max();
 
   std::mutex m_tables_being_loaded_mutex;
   std::unordered_multimap<std::string, size_t> m_tables_being_loaded;
@@ -622,6 +844,8 @@ class Dump_loader {
   std::unordered_set<std::string> m_skip_schemas;
   std::unordered_set<std::string> m_skip_tables;
   std::vector<std::exception_ptr> m_thread_exceptions;
+  // set if server-side bulk load is not available
+  std::atomic<bool> m_bulk_load_disabled{false};
   volatile bool m_worker_hard_interrupt = false;
   bool m_worker_interrupt = false;
   bool m_abort = false;
@@ -629,6 +853,11 @@ class Dump_loader {
   std::string m_character_set;
 
   bool m_init_done = false;
+
+  // set if redo log was disabled by the fastLoad option
+  bool m_redo_log_disabled = false;
+  // original value of innodb_doublewrite, if it was changed by fastLoad
+  std::string m_doublewrite_to_restore;
   bool m_workers_killed = false;
 
   // tables and partitions loaded
@@ -638,7 +867,8 @@ class Dump_loader {
   size_t m_num_bytes_previously_loaded = 0;
   std::atomic<size_t> m_num_rows_loaded;
   std::atomic<size_t> m_num_rows_deleted = 0;
-  std::atomic<size_t> m_num_bytes_loaded;
+  // updated by the worker threads, each one has its own slot
+  dump::Progress_counter m_num_bytes_loaded;
   std::atomic<size_t> m_num_raw_bytes_loaded;
   std::atomic<size_t> m_num_chunks_loaded;
   std::atomic<size_t> m_num_warnings;
@@ -653,6 +883,8 @@ class Dump_loader {
   std::atomic<uint64_t> m_tables_analyzed;
   uint64_t m_tables_to_analyze = 0;
   bool m_all_analyze_tasks_scheduled = false;
+  // data and indexes are loaded, deferred table analysis is in progress
+  std::atomic<bool> m_data_loaded = false;
 
   uint64_t m_checksum_tasks_completed = 0;
   uint64_t m_checksum_tasks_to_complete = 0;
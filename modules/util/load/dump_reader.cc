@@ -32,6 +32,7 @@
 #include "modules/util/dump/schema_dumper.h"
 #include "modules/util/load/load_errors.h"
 #include "mysqlshdk/libs/db/mysql/result.h"
+#include "mysqlshdk/libs/storage/checksummed_file.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
@@ -89,8 +90,16 @@ auto to_vector_of_strings(const shcore::Array_t &arr) {
 
 Dump_reader::Dump_reader(
     std::unique_ptr<mysqlshdk::storage::IDirectory> dump_dir,
-    const Load_dump_options &options)
-    : m_dir(std::move(dump_dir)), m_options(options) {}
+    const Load_dump_options &options, Memory_budget *memory_budget)
+    : m_dir(std::move(dump_dir)), m_options(options) {
+  // files shared with loaders of other instances are downloaded once, by the
+  // first loader which needs them
+  if (!m_dir->is_local() && m_options.prefetch_memory() > 0 &&
+      m_options.load_data() && !m_options.shared_chunk_cache()) {
+    m_prefetcher = std::make_unique<Chunk_prefetcher>(
+        m_options.threads_count(), m_options.prefetch_memory(), memory_budget);
+  }
+}
 
 Dump_reader::Status Dump_reader::open() {
   shcore::Dictionary_t md(fetch_metadata(m_dir.get(), "@.json"));
@@ -142,6 +151,24 @@ Dump_reader::Status Dump_reader::open() {
         md->get_bool("gtidExecutedInconsistent");
   }
 
+  if (md->has_key("incrementalBase")) {
+    const auto base = md->get_map("incrementalBase");
+
+    m_contents.incremental = true;
+
+    if (base->has_key("gtidExecuted"))
+      m_contents.base_gtid_executed = base->get_string("gtidExecuted");
+
+    if (base->has_key("sourceRows")) {
+      for (const auto &schema : *base->get_map("sourceRows")) {
+        for (const auto &table : *schema.second.as_map()) {
+          m_contents.base_source_rows[schema.first][table.first] =
+              table.second.as_uint();
+        }
+      }
+    }
+  }
+
   if (md->has_key("tzUtc")) m_contents.tz_utc = md->get_bool("tzUtc");
 
   if (md->has_key("mdsCompatibility"))
@@ -190,6 +217,10 @@ Dump_reader::Status Dump_reader::open() {
   } else {
     log_info("@.done.json: not found");
     m_dump_status = Status::DUMPING;
+
+    if (md->has_key("journal") && md->get_bool("journal")) {
+      m_journal.emplace();
+    }
   }
 
   return m_dump_status;
@@ -342,10 +373,10 @@ void Dump_reader::schema_table_triggers(
   }
 }
 
-const std::vector<std::string> &Dump_reader::deferred_schema_fks(
-    const std::string &schema) const {
+const std::vector<Dump_reader::Deferred_foreign_keys> &
+Dump_reader::deferred_schema_fks(const std::string &schema) const {
   const auto &s = m_contents.schemas.at(schema);
-  return s->foreign_key_queries;
+  return s->foreign_keys;
 }
 
 const std::vector<std::string> &Dump_reader::queries_on_schema_end(
@@ -389,6 +420,36 @@ bool Dump_reader::has_primary_key(const std::string &schema,
               ->primary_index.empty();
 }
 
+bool Dump_reader::single_data_file(std::string_view schema,
+                                   std::string_view table,
+                                   std::string_view partition) const {
+  const auto info = find_partition(schema, table, partition, "data file");
+  return !info->chunked ||
+         (info->last_chunk_seen && 1 == info->available_chunks.size());
+}
+
+bool Dump_reader::has_capability(dump::Capability capability) const {
+  const auto id = dump::capability::id(capability);
+
+  return std::any_of(
+      m_contents.capabilities.begin(), m_contents.capabilities.end(),
+      [&id](const Capability_info &info) { return info.id == id; });
+}
+
+const std::vector<Dump_reader::Tablespace_file> &Dump_reader::tablespaces(
+    std::string_view schema, std::string_view table) const {
+  return find_table(schema, table, "tablespaces are being checked")
+      ->tablespaces;
+}
+
+std::unique_ptr<mysqlshdk::storage::IFile> Dump_reader::tablespace_file(
+    std::string_view schema, std::string_view table,
+    const std::string &name) const {
+  return mysqlshdk::storage::make_file(
+      data_file(name),
+      find_table(schema, table, "tablespace is being loaded")->compression);
+}
+
 std::string Dump_reader::fetch_schema_script(const std::string &schema) const {
   std::string script;
 
@@ -421,40 +482,41 @@ std::string Dump_reader::fetch_schema_script(const std::string &schema) const {
 // Thus, smaller tables must get fewer threads allocated so they take longer
 // to load, while bigger threads get more, with the hope that the total time
 // to load all tables is minimized.
-Dump_reader::Candidate Dump_reader::schedule_chunk_proportionally(
+//
+// If chunk window is set, tables whose next chunk is too far from the oldest
+// chunk of that table which is still being loaded are not considered, so that
+// the rows are inserted close to each other in the primary key order.
+Dump_reader::Table_data_info *Dump_reader::schedule_chunk_proportionally(
     const std::unordered_multimap<std::string, size_t> &tables_being_loaded,
-    std::unordered_set<Dump_reader::Table_data_info *> *tables_with_data,
-    uint64_t max_concurrent_tables) {
-  if (tables_with_data->empty()) return tables_with_data->end();
+    const Tables_with_data &tables_with_data, uint64_t max_concurrent_tables,
+    const std::optional<uint64_t> &chunk_window) {
+  if (tables_with_data.empty()) return nullptr;
 
-  std::vector<Candidate> tables_in_progress;
+  const auto &tables_in_progress = tables_with_data.in_progress();
 
-  // first check if there's any table that's not being loaded
+  // first check if there's any table that's not being loaded, tables which
+  // were previously scheduled have precedence over the ones which were not
   {
-    const auto end = tables_with_data->end();
-    auto best = end;
+    Table_data_info *best = nullptr;
 
-    for (auto it = tables_with_data->begin(); it != end; ++it) {
-      if ((*it)->chunks_consumed) {
-        tables_in_progress.emplace_back(it);
+    for (const auto table : tables_in_progress) {
+      if (tables_being_loaded.find(table->key()) == tables_being_loaded.end() &&
+          table->within_window(chunk_window) &&
+          (!best || table->bytes_available() > best->bytes_available())) {
+        best = table;
       }
+    }
 
-      if (tables_being_loaded.find((*it)->key()) == tables_being_loaded.end()) {
-        // table is better if it's bigger and in the same state as the current
-        // best, or if it was previously scheduled and current best was not
-        if (best == end ||
-            ((*it)->bytes_available() > (*best)->bytes_available() &&
-             !(*it)->chunks_consumed == !(*best)->chunks_consumed) ||
-            ((*it)->chunks_consumed && !(*best)->chunks_consumed))
-          best = it;
-      }
+    if (best) {
+      return best;
     }
 
     // schedule a new table only if we're not exceeding the maximum number of
     // concurrent tables that can be loaded at the same time
-    if (best != end && (tables_in_progress.size() < max_concurrent_tables ||
-                        (*best)->chunks_consumed)) {
-      return best;
+    if (tables_in_progress.size() < max_concurrent_tables) {
+      if (const auto table = tables_with_data.largest_not_started()) {
+        return table;
+      }
     }
   }
 
@@ -477,31 +539,45 @@ Dump_reader::Candidate Dump_reader::schedule_chunk_proportionally(
     }
   }
 
-  std::vector<std::pair<Candidate, double>> candidate_weights;
+  assert(!tables_in_progress.empty());
+
+  std::vector<Table_data_info *> candidates;
+  candidates.reserve(tables_in_progress.size());
+
+  for (const auto table : tables_in_progress) {
+    if (table->within_window(chunk_window)) {
+      candidates.emplace_back(table);
+    }
+  }
+
+  if (candidates.empty()) {
+    // all tables have reached their window, wait for the chunks to be loaded
+    return nullptr;
+  }
+
+  std::vector<std::pair<Table_data_info *, double>> candidate_weights;
 
   // calc ratio of data available per table / total data available
   double total_bytes_available = std::accumulate(
-      tables_in_progress.begin(), tables_in_progress.end(),
-      static_cast<size_t>(0),
-      [](size_t size, auto it) { return size + (*it)->bytes_available(); });
+      candidates.begin(), candidates.end(), static_cast<size_t>(0),
+      [](size_t size, auto table) { return size + table->bytes_available(); });
   if (total_bytes_available > 0) {
-    for (auto it = tables_in_progress.begin(); it != tables_in_progress.end();
-         ++it) {
+    for (const auto table : candidates) {
       candidate_weights.emplace_back(
-          *it, static_cast<double>((**it)->bytes_available()) /
-                   total_bytes_available);
+          table, static_cast<double>(table->bytes_available()) /
+                     total_bytes_available);
     }
   } else {
     // it's possible that all files loaded so far are empty, return any table
-    return tables_in_progress.front();
+    return candidates.front();
   }
 
   // pick a chunk from the table that has the biggest difference between both
   double best_diff = 0;
-  Candidate best = tables_in_progress.front();
+  Table_data_info *best = candidates.front();
 
   for (const auto &cand : candidate_weights) {
-    const auto it = worker_weights.find((*cand.first)->key());
+    const auto it = worker_weights.find(cand.first->key());
     const auto weight = it == worker_weights.end() ? 0.0 : it->second;
     const auto d = cand.second - weight;
 
@@ -519,24 +595,26 @@ bool Dump_reader::next_table_chunk(
     std::string *out_schema, std::string *out_table, std::string *out_partition,
     bool *out_chunked, size_t *out_chunk_index, size_t *out_chunks_total,
     std::unique_ptr<mysqlshdk::storage::IFile> *out_file,
-    size_t *out_chunk_size, shcore::Dictionary_t *out_options) {
-  auto iter = schedule_chunk_proportionally(
-      tables_being_loaded, &m_tables_with_data, m_options.threads_count());
-
-  if (iter != m_tables_with_data.end()) {
-    *out_schema = (*iter)->owner->schema;
-    *out_table = (*iter)->owner->name;
-    *out_partition = (*iter)->partition;
-    *out_chunked = (*iter)->chunked;
-    *out_chunk_index = (*iter)->chunks_consumed;
-
-    if ((*iter)->last_chunk_seen) {
-      *out_chunks_total = (*iter)->available_chunks.size();
+    size_t *out_chunk_size, shcore::Dictionary_t *out_options,
+    mysqlshdk::storage::Compression_options *out_compression_options) {
+  const auto table = schedule_chunk_proportionally(
+      tables_being_loaded, m_tables_with_data, m_options.threads_count(),
+      m_options.chunk_window());
+
+  if (table) {
+    *out_schema = table->owner->schema;
+    *out_table = table->owner->name;
+    *out_partition = table->partition;
+    *out_chunked = table->chunked;
+    *out_chunk_index = table->chunks_consumed;
+
+    if (table->last_chunk_seen) {
+      *out_chunks_total = table->available_chunks.size();
     } else {
       *out_chunks_total = 0;
     }
 
-    const auto &info = (*iter)->available_chunks[*out_chunk_index];
+    const auto &info = table->available_chunks[*out_chunk_index];
 
     if (!info.has_value()) {
       throw std::logic_error(
@@ -545,12 +623,29 @@ bool Dump_reader::next_table_chunk(
           " which is not yet available");
     }
 
-    *out_file = m_dir->file(info->name());
+    if (m_prefetcher) {
+      *out_file = m_prefetcher->file(info->name());
+    }
+
+    if (!*out_file) {
+      *out_file = data_file(*table, info->name());
+    }
+
     *out_chunk_size = info->size();
-    *out_options = (*iter)->owner->options;
+    *out_options = table->owner->options;
+    out_compression_options->dictionary = table->compression_dictionary;
+
+    table->chunks_in_flight.emplace(*out_chunk_index);
+    m_tables_with_data.consume_chunk(table);
 
-    (*iter)->consume_chunk();
-    if (!(*iter)->has_data_available()) m_tables_with_data.erase(iter);
+    if (m_prefetcher) {
+      prefetch_chunks(*table);
+
+      // first chunk of the table which is going to be scheduled next
+      if (const auto next = m_tables_with_data.largest_not_started()) {
+        prefetch_chunks(*next);
+      }
+    }
 
     return true;
   }
@@ -558,6 +653,86 @@ bool Dump_reader::next_table_chunk(
   return false;
 }
 
+std::unique_ptr<mysqlshdk::storage::IFile> Dump_reader::data_file(
+    const std::string &name) const {
+  mysqlshdk::storage::File_options options;
+
+  if (m_options.drop_page_cache()) {
+    options["file.page_cache"] = "drop";
+  }
+
+  auto file = m_dir->file(name, options);
+
+  if (const auto it = m_contents.chunk_checksums.find(name);
+      m_contents.chunk_checksums.end() != it) {
+    // contents are verified as they are loaded, without reading them again
+    file = std::make_unique<mysqlshdk::storage::Checksummed_file>(
+        std::move(file), it->second);
+  }
+
+  return file;
+}
+
+std::unique_ptr<mysqlshdk::storage::IFile> Dump_reader::data_file(
+    const Table_data_info &table, const std::string &name) {
+  if (table.owner->data_location.empty()) {
+    return data_file(name);
+  }
+
+  mysqlshdk::storage::File_options options;
+
+  if (m_options.drop_page_cache()) {
+    options["file.page_cache"] = "drop";
+  }
+
+  return referenced_dump(table.owner->data_location).dir->file(name, options);
+}
+
+const Dump_reader::Referenced_dump &Dump_reader::referenced_dump(
+    const std::string &location) {
+  if (const auto it = m_referenced_dumps.find(location);
+      m_referenced_dumps.end() != it) {
+    return it->second;
+  }
+
+  Referenced_dump dump;
+  dump.dir =
+      mysqlshdk::storage::make_directory(location, m_options.storage_config());
+
+  if (!dump.dir->exists()) {
+    throw std::runtime_error(
+        "The dump at '" + dump.dir->full_path().masked() +
+        "', which holds data of the tables that did not change, does not "
+        "exist.");
+  }
+
+  log_info("Listing files of the dump at '%s', which holds data of the tables "
+           "that did not change",
+           dump.dir->full_path().masked().c_str());
+
+  dump.files = dump.dir->list_files();
+
+  return m_referenced_dumps.emplace(location, std::move(dump)).first->second;
+}
+
+void Dump_reader::prefetch_chunks(const Table_data_info &table) {
+  assert(m_prefetcher);
+
+  // keep enough chunks of this table to feed all the threads
+  for (auto i = table.chunks_consumed,
+            end = std::min(table.available_chunks.size(),
+                           i + m_options.threads_count());
+       i < end && table.available_chunks[i].has_value(); ++i) {
+    const auto &chunk = *table.available_chunks[i];
+
+    if (!m_prefetcher->is_prefetched(chunk.name()) &&
+        !m_prefetcher->prefetch(data_file(table, chunk.name()), chunk.size())) {
+      // memory budget is exhausted
+      break;
+    }
+  }
+}
+
 bool Dump_reader::next_deferred_index(
     std::string *out_schema, std::string *out_table,
     compatibility::Deferred_statements::Index_info **out_indexes) {
@@ -600,7 +775,10 @@ bool Dump_reader::next_table_checksum(
 
   for (auto &schema : m_contents.schemas) {
     for (auto &table : schema.second->tables) {
-      if (table.second->indexes_created && table.second->analyze_finished) {
+      // deferred analysis is executed after the checksums are verified
+      if (table.second->indexes_created &&
+          (table.second->analyze_finished ||
+           m_options.defer_table_analysis())) {
         for (auto &partition : table.second->data_info) {
           if (!partition.checksums.empty() &&
               (!m_options.load_data() || partition.data_loaded())) {
@@ -616,6 +794,43 @@ bool Dump_reader::next_table_checksum(
   return false;
 }
 
+bool Dump_reader::next_chunk_checksum(
+    const dump::common::Checksums::Checksum_data **out_checksum) {
+  assert(out_checksum);
+
+  if (!m_options.load_data()) {
+    return false;
+  }
+
+  for (auto &schema : m_contents.schemas) {
+    for (auto &table : schema.second->tables) {
+      // don't compete with the indexes which are being created
+      if (table.second->indexes_scheduled && !table.second->indexes_created) {
+        continue;
+      }
+
+      for (auto &partition : table.second->data_info) {
+        for (auto it = partition.checksums.begin(),
+                  end = partition.checksums.end();
+             it != end; ++it) {
+          // checksum without a boundary covers the whole table
+          const auto loaded = (*it)->boundary().empty()
+                                  ? partition.data_loaded()
+                                  : partition.chunk_loaded((*it)->chunk());
+
+          if (loaded) {
+            *out_checksum = *it;
+            partition.checksums.erase(it);
+            return true;
+          }
+        }
+      }
+    }
+  }
+
+  return false;
+}
+
 bool Dump_reader::data_available() const { return !m_tables_with_data.empty(); }
 
 bool Dump_reader::data_pending() const {
@@ -639,7 +854,8 @@ bool Dump_reader::work_available() const {
     for (const auto &table : schema.second->tables) {
       if ((m_options.load_data() && !table.second->all_data_scheduled()) ||
           !table.second->indexes_scheduled ||
-          !table.second->analyze_scheduled ||
+          (!table.second->analyze_scheduled &&
+           !m_options.defer_table_analysis()) ||
           !table.second->all_data_verified()) {
         return true;
       }
@@ -708,32 +924,45 @@ void Dump_reader::compute_filtered_data_size() {
 
 // Scan directory for new files and adds them to the pending file list
 void Dump_reader::rescan(dump::Progress_thread *progress_thread) {
-  Files files;
-
-  {
-    dump::Progress_thread::Stage *stage = nullptr;
-    shcore::on_leave_scope finish_stage([&stage]() {
-      if (stage) {
-        stage->finish();
-      }
-    });
-
-    if (!m_dir->is_local()) {
-      current_console()->print_status(
-          "Fetching dump data from remote location...");
-
-      if (progress_thread) {
-        stage = progress_thread->start_stage("Listing files");
+  if (m_journal) {
+    if (m_journal->listed) {
+      read_journal();
+    } else {
+      // files written so far are listed, journal is read starting with the
+      // first segment which was not listed; files which were written before
+      // that segment, but were missed by the listing, are found once the dump
+      // is complete and the directory is listed again
+      m_journal->files = list_files(progress_thread);
+      m_journal->listed = true;
+
+      for (const auto &file : m_journal->files) {
+        m_journal->segment =
+            std::max(m_journal->segment,
+                     dump::common::get_journal_segment(file.name()));
       }
     }
+  }
 
-    files = m_dir->list_files();
+  Files listed;
+
+  if (!m_journal) {
+    listed = list_files(progress_thread);
   }
 
+  const auto &files = m_journal ? m_journal->files : listed;
+
   log_debug("Finished listing files, starting rescan");
 
+  if (!m_contents.md_done) {
+    load_metadata_index(files);
+  }
+
   m_contents.rescan(m_dir.get(), files, this, progress_thread);
 
+  if (m_contents.md_done) {
+    release_metadata_index();
+  }
+
   log_debug("Rescan done");
 
   if (m_dump_status != Status::COMPLETE &&
@@ -746,6 +975,111 @@ void Dump_reader::rescan(dump::Progress_thread *progress_thread) {
   compute_filtered_data_size();
 }
 
+Dump_reader::Files Dump_reader::list_files(
+    dump::Progress_thread *progress_thread) {
+  dump::Progress_thread::Stage *stage = nullptr;
+  shcore::on_leave_scope finish_stage([&stage]() {
+    if (stage) {
+      stage->finish();
+    }
+  });
+
+  if (!m_dir->is_local()) {
+    current_console()->print_status(
+        "Fetching dump data from remote location...");
+
+    if (progress_thread) {
+      stage = progress_thread->start_stage("Listing files");
+    }
+  }
+
+  return m_dir->list_files();
+}
+
+void Dump_reader::read_journal() {
+  assert(m_journal);
+
+  try {
+    while (true) {
+      const auto name =
+          dump::common::get_journal_segment_filename(m_journal->segment + 1);
+
+      if (!m_dir->file(name)->exists()) {
+        break;
+      }
+
+      bool complete = false;
+
+      for (auto &[file, size] :
+           dump::common::parse_journal_segment(fetch_file(m_dir.get(), name))) {
+        if ("@.done.json" == file) {
+          complete = true;
+        }
+
+        m_journal->files.emplace(std::move(file), size);
+      }
+
+      ++m_journal->segment;
+
+      if (complete) {
+        log_debug("Journal reports that the dump is complete");
+        m_journal.reset();
+        break;
+      }
+    }
+  } catch (const std::exception &e) {
+    log_warning(
+        "Failed to read the dump journal, falling back to listing the files: "
+        "%s",
+        e.what());
+    m_journal.reset();
+  }
+}
+
+void Dump_reader::load_metadata_index(const Files &files) {
+  if (m_metadata_index_loaded) {
+    return;
+  }
+
+  const auto name = dump::common::get_metadata_index_filename();
+
+  // index is complete only when the whole dump is complete
+  if (files.find({"@.done.json"}) == files.end() ||
+      files.find({name}) == files.end()) {
+    return;
+  }
+
+  m_metadata_index_loaded = true;
+
+  try {
+    m_metadata_index_data = fetch_file(m_dir.get(), name);
+    m_metadata_index =
+        dump::common::parse_metadata_index(m_metadata_index_data);
+
+    log_info("Using metadata index with %zu entries", m_metadata_index.size());
+  } catch (const std::exception &e) {
+    log_warning("Failed to read the metadata index, metadata files are going "
+                "to be fetched individually: %s",
+                e.what());
+    release_metadata_index();
+  }
+}
+
+void Dump_reader::release_metadata_index() {
+  m_metadata_index.clear();
+  m_metadata_index_data.clear();
+  m_metadata_index_data.shrink_to_fit();
+}
+
+std::string Dump_reader::fetch_metadata_file(const std::string &name) const {
+  if (const auto it = m_metadata_index.find(name);
+      m_metadata_index.end() != it) {
+    return std::string{it->second};
+  }
+
+  return fetch_file(m_dir.get(), name);
+}
+
 uint64_t Dump_reader::add_deferred_statements(
     const std::string &schema, const std::string &table,
     compatibility::Deferred_statements &&stmts) {
@@ -769,11 +1103,10 @@ uint64_t Dump_reader::add_deferred_statements(
       !m_options.load_deferred_indexes() || stmts.index_info.empty();
   t->second->indexes = std::move(stmts.index_info);
 
-  const auto table_name = schema_object_key(schema, table);
-
-  for (const auto &fk : stmts.foreign_keys) {
-    s->second->foreign_key_queries.emplace_back("ALTER TABLE " + table_name +
-                                                " ADD " + fk);
+  if (!stmts.foreign_keys.empty()) {
+    auto &fks = s->second->foreign_keys.emplace_back();
+    fks.table = schema_object_key(schema, table);
+    fks.definitions = std::move(stmts.foreign_keys);
   }
 
   if (!stmts.secondary_engine.empty()) {
@@ -938,8 +1271,41 @@ void Dump_reader::Table_info::update_metadata(const std::string &data,
   }
 
   di.extension = md->get_string("extension", "tsv");
+
+  if (shcore::str_beginswith(di.extension, "parquet")) {
+    throw std::runtime_error("Table " + schema_object_key(schema, name) +
+                             " was dumped using the Parquet format, loading "
+                             "of such dumps is not supported.");
+  }
   di.chunked = md->get_bool("chunking", false);
 
+  std::string reference_basename;
+  shcore::Dictionary_t reference_basenames;
+
+  if (const auto reference = md->get_map("dataReference")) {
+    data_location = reference->get_string("location");
+    reference_basename = reference->get_string("basename");
+    reference_basenames = reference->get_map("basenames");
+  }
+
+  if (const auto tablespace_list = md->get_array("tablespaces")) {
+    compression =
+        mysqlshdk::storage::to_compression(md->get_string("compression"));
+    const auto extension = mysqlshdk::storage::get_extension(compression);
+
+    for (const auto &t : *tablespace_list) {
+      const auto tablespace = t.as_map();
+      const auto ts_basename = tablespace->get_string("basename");
+      auto &file = tablespaces.emplace_back();
+
+      file.name = tablespace->get_string("name");
+      file.ibd = dump::common::get_table_data_filename(ts_basename, "ibd") +
+                 extension;
+      file.cfg = dump::common::get_table_data_filename(ts_basename, "cfg") +
+                 extension;
+    }
+  }
+
   if (md->has_key("primaryIndex")) {
     primary_index = to_vector_of_strings(md->get_array("primaryIndex"));
   }
@@ -983,13 +1349,16 @@ void Dump_reader::Table_info::update_metadata(const std::string &data,
         auto copy = di;
 
         copy.partition = p.first;
-        copy.basename = p.second.as_string();
+        copy.basename = reference_basenames
+                            ? reference_basenames->get_string(p.first)
+                            : p.second.as_string();
         copy.initialize_checksums(reader->m_contents.checksum.get());
 
         data_info.emplace_back(std::move(copy));
       }
     } else {
-      di.basename = basename;
+      di.basename =
+          data_location.empty() ? basename : std::move(reference_basename);
       di.initialize_checksums(reader->m_contents.checksum.get());
 
       data_info.emplace_back(std::move(di));
@@ -1049,9 +1418,31 @@ bool Dump_reader::Table_info::all_data_verification_scheduled() const {
   return true;
 }
 
-void Dump_reader::Table_data_info::rescan_data(const Files &files,
+void Dump_reader::Table_data_info::rescan_data(const Files &dump_files,
                                                Dump_reader *reader) {
   bool found_data = false;
+  auto dir = reader->m_dir.get();
+  auto data_files = &dump_files;
+
+  if (!owner->data_location.empty()) {
+    // data files of an unchanged table are stored in another dump
+    const auto &referenced = reader->referenced_dump(owner->data_location);
+    dir = referenced.dir.get();
+    data_files = &referenced.files;
+  }
+
+  const auto &files = *data_files;
+
+  if (!compression_dictionary) {
+    // dictionary is written before any of the data files
+    const auto dictionary =
+        dump::common::get_compression_dictionary_filename(basename);
+
+    if (files.find(dictionary) != files.end()) {
+      compression_dictionary =
+          std::make_shared<const std::string>(fetch_file(dir, dictionary));
+    }
+  }
 
   const auto try_to_add_chunk = [&files, reader, &found_data,
                                  this](auto &&... params) {
@@ -1121,6 +1512,40 @@ void Dump_reader::Table_data_info::rescan_data(const Files &files,
   if (found_data) reader->m_tables_with_data.insert(this);
 }
 
+void Dump_reader::Tables_with_data::insert(Table_data_info *table) {
+  if (table->chunks_consumed > 0) {
+    m_in_progress.emplace(table);
+  } else {
+    // size of a table which was not scheduled yet changes when new chunks are
+    // found, it needs to be updated
+    erase(table);
+
+    const auto size = table->bytes_available();
+    m_not_started.emplace(size, table);
+    m_not_started_size.emplace(table, size);
+  }
+}
+
+void Dump_reader::Tables_with_data::erase(Table_data_info *table) {
+  if (const auto it = m_not_started_size.find(table);
+      m_not_started_size.end() != it) {
+    m_not_started.erase({it->second, table});
+    m_not_started_size.erase(it);
+  } else {
+    m_in_progress.erase(table);
+  }
+}
+
+void Dump_reader::Tables_with_data::consume_chunk(Table_data_info *table) {
+  erase(table);
+
+  table->consume_chunk();
+
+  if (table->has_data_available()) {
+    insert(table);
+  }
+}
+
 void Dump_reader::Table_data_info::initialize_checksums(
     const dump::common::Checksums *info) {
   if (!info) {
@@ -1303,8 +1728,8 @@ void Dump_reader::Schema_info::rescan(mysqlshdk::storage::IDirectory *dir,
           ++files_to_fetch;
 
           pool->add_task(
-              [dir, mdpath = t.second->metadata_name()]() {
-                return fetch_file(dir, mdpath);
+              [reader, mdpath = t.second->metadata_name()]() {
+                return reader->fetch_metadata_file(mdpath);
               },
               [table = t.second.get(), &files, reader](std::string &&data) {
                 table->update_metadata(data, reader);
@@ -1448,8 +1873,8 @@ void Dump_reader::Dump_info::rescan_metadata(
         ++task_producers;
 
         pool->add_task(
-            [dir, mdpath = s.second->metadata_name()]() {
-              return fetch_file(dir, mdpath);
+            [reader, mdpath = s.second->metadata_name()]() {
+              return reader->fetch_metadata_file(mdpath);
             },
             [&maybe_shutdown, schema = s.second.get(), dir, &files, reader,
              pool](std::string &&data) {
@@ -1533,6 +1958,21 @@ void Dump_reader::Dump_info::parse_done_metadata(
         chunk_sizes[file.first] = file.second.as_uint();
       }
     }
+
+    if (metadata->has_key("chunkFileCrc32c")) {
+      for (const auto &file : *metadata->get_map("chunkFileCrc32c")) {
+        chunk_checksums[file.first] =
+            static_cast<uint32_t>(file.second.as_uint());
+      }
+    }
+
+    if (metadata->has_key("sourceRows")) {
+      for (const auto &schema : *metadata->get_map("sourceRows")) {
+        for (const auto &table : *schema.second.as_map()) {
+          source_rows[schema.first][table.first] = table.second.as_uint();
+        }
+      }
+    }
   } else {
     log_warning("Dump metadata file @.done.json is invalid");
   }
@@ -1650,10 +2090,46 @@ const std::string &Dump_reader::override_schema(const std::string &s) const {
   return value.first == s ? value.second : s;
 }
 
+Dump_reader::Row_counts Dump_reader::loaded_row_counts(
+    const Row_counts &rows) const {
+  Row_counts result;
+
+  for (const auto &schema : m_contents.schemas) {
+    const auto s = rows.find(override_schema(schema.first));
+
+    if (rows.end() == s) {
+      continue;
+    }
+
+    for (const auto &table : schema.second->tables) {
+      if (const auto t = s->second.find(table.second->name);
+          s->second.end() != t) {
+        result[schema.first][t->first] = t->second;
+      }
+    }
+  }
+
+  return result;
+}
+
 void Dump_reader::on_chunk_loaded(const std::string &schema,
                                   const std::string &table,
-                                  const std::string &partition) {
-  ++find_partition(schema, table, partition, "chunk was loaded")->chunks_loaded;
+                                  const std::string &partition,
+                                  ssize_t index) {
+  const auto info =
+      find_partition(schema, table, partition, "chunk was loaded");
+
+  ++info->chunks_loaded;
+  info->chunks_in_flight.erase(index < 0 ? 0 : index);
+  ++m_chunks_loaded;
+}
+
+void Dump_reader::on_chunk_skipped(const std::string &schema,
+                                   const std::string &table,
+                                   const std::string &partition,
+                                   ssize_t index) {
+  find_partition(schema, table, partition, "chunk was skipped")
+      ->chunks_in_flight.erase(index < 0 ? 0 : index);
 }
 
 void Dump_reader::on_index_end(const std::string &schema,
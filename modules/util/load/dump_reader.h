@@ -24,25 +24,31 @@
 #ifndef MODULES_UTIL_LOAD_DUMP_READER_H_
 #define MODULES_UTIL_LOAD_DUMP_READER_H_
 
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "modules/util/common/dump/checksums.h"
+#include "modules/util/dump/capability.h"
 #include "modules/util/dump/compatibility.h"
 #include "modules/util/dump/progress_thread.h"
 
 #include "modules/util/import_table/dialect.h"
+#include "modules/util/load/chunk_prefetcher.h"
 
 #include "modules/util/load/load_dump_options.h"
+#include "modules/util/load/memory_budget.h"
 
+#include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/utils/thread_pool.h"
@@ -59,7 +65,8 @@ class Dump_reader {
   struct Object_info;
 
   Dump_reader(std::unique_ptr<mysqlshdk::storage::IDirectory> dump_dir,
-              const Load_dump_options &options);
+              const Load_dump_options &options,
+              Memory_budget *memory_budget = nullptr);
 
   const std::string &default_character_set() const {
     return m_contents.default_charset;
@@ -93,6 +100,37 @@ class Dump_reader {
     return m_contents.gtid_executed_inconsistent;
   }
 
+  /**
+   * Whether this is an incremental dump, which contains only the rows which
+   * have changed since the base dump was created.
+   */
+  bool is_incremental() const { return m_contents.incremental; }
+
+  const std::string &base_gtid_executed() const {
+    return m_contents.base_gtid_executed;
+  }
+
+  // schema -> table -> number of rows
+  using Row_counts = std::unordered_map<
+      std::string, std::unordered_map<std::string, uint64_t>>;
+
+  /**
+   * Number of rows of the tables which are going to be loaded, recorded by the
+   * base dump of an incremental dump. Tables which were not counted are not
+   * included.
+   */
+  Row_counts base_source_rows() const {
+    return loaded_row_counts(m_contents.base_source_rows);
+  }
+
+  /**
+   * Number of rows of the tables which are going to be loaded, recorded when
+   * the dump was created. Available once the dump is complete.
+   */
+  Row_counts source_rows() const {
+    return loaded_row_counts(m_contents.source_rows);
+  }
+
   bool tz_utc() const { return m_contents.tz_utc; }
 
   /**
@@ -139,7 +177,14 @@ class Dump_reader {
   void schema_table_triggers(const std::string &schema,
                              std::list<Name_and_file> *out_table_triggers);
 
-  const std::vector<std::string> &deferred_schema_fks(
+  struct Deferred_foreign_keys {
+    // quoted name of the table
+    std::string table;
+    // definitions of the foreign keys, in order of the CREATE TABLE statement
+    std::vector<std::string> definitions;
+  };
+
+  const std::vector<Deferred_foreign_keys> &deferred_schema_fks(
       const std::string &schema) const;
 
   const std::vector<std::string> &queries_on_schema_end(
@@ -153,13 +198,46 @@ class Dump_reader {
   bool has_primary_key(const std::string &schema,
                        const std::string &table) const;
 
+  /**
+   * Whether all data of the given table (partition) is stored in a single file.
+   */
+  bool single_data_file(std::string_view schema, std::string_view table,
+                        std::string_view partition) const;
+
+  /**
+   * Copy of an InnoDB tablespace file, written by a physical dump.
+   */
+  struct Tablespace_file {
+    // name of the tablespace file on the source server, without extension
+    std::string name;
+    // name of the dump file holding the .ibd file
+    std::string ibd;
+    // name of the dump file holding the .cfg file
+    std::string cfg;
+  };
+
+  /**
+   * Tablespace files of the given table, empty if it was dumped logically.
+   */
+  const std::vector<Tablespace_file> &tablespaces(std::string_view schema,
+                                                  std::string_view table) const;
+
+  /**
+   * Creates handle of a file which holds a copy of a tablespace file, contents
+   * are decompressed as the file is read.
+   */
+  std::unique_ptr<mysqlshdk::storage::IFile> tablespace_file(
+      std::string_view schema, std::string_view table,
+      const std::string &name) const;
+
   bool next_table_chunk(
       const std::unordered_multimap<std::string, size_t> &tables_being_loaded,
       std::string *out_schema, std::string *out_table,
       std::string *out_partition, bool *out_chunked, size_t *out_chunk_index,
       size_t *out_chunks_total,
       std::unique_ptr<mysqlshdk::storage::IFile> *out_file,
-      size_t *out_chunk_size, shcore::Dictionary_t *out_options);
+      size_t *out_chunk_size, shcore::Dictionary_t *out_options,
+      mysqlshdk::storage::Compression_options *out_compression_options);
 
   struct Histogram {
     std::string column;
@@ -176,6 +254,13 @@ class Dump_reader {
   bool next_table_checksum(
       const dump::common::Checksums::Checksum_data **out_checksum);
 
+  /**
+   * Provides checksum of a chunk which was already loaded, while the rest of
+   * the table is still being loaded.
+   */
+  bool next_chunk_checksum(
+      const dump::common::Checksums::Checksum_data **out_checksum);
+
   bool data_available() const;
 
   bool data_pending() const;
@@ -225,6 +310,11 @@ class Dump_reader {
 
   Status status() const { return m_dump_status; }
 
+  /**
+   * Whether new files are found by reading the journal written by the dumper.
+   */
+  bool has_journal() const { return m_journal.has_value(); }
+
   Status open();
 
   std::unique_ptr<mysqlshdk::storage::IFile> create_progress_file_handle()
@@ -242,6 +332,12 @@ class Dump_reader {
 
   uint64_t metadata_parsed() { return m_metadata_parsed; }
 
+  /**
+   * Provides contents of a metadata file, uses the metadata index if it's
+   * available.
+   */
+  std::string fetch_metadata_file(const std::string &name) const;
+
   struct Table_info;
 
   void on_table_metadata_parsed(const Table_info &info);
@@ -259,7 +355,18 @@ class Dump_reader {
                        const std::string &trigger) const;
 
   void on_chunk_loaded(const std::string &schema, const std::string &table,
-                       const std::string &partition);
+                       const std::string &partition, ssize_t index);
+
+  /**
+   * Chunk returned by next_table_chunk() is not going to be loaded.
+   */
+  void on_chunk_skipped(const std::string &schema, const std::string &table,
+                        const std::string &partition, ssize_t index);
+
+  /**
+   * Total number of chunks which were loaded so far.
+   */
+  uint64_t chunks_loaded() const { return m_chunks_loaded; }
 
   void on_index_end(const std::string &schema, const std::string &table);
 
@@ -286,6 +393,8 @@ class Dump_reader {
     return m_contents.capabilities;
   }
 
+  bool has_capability(dump::Capability capability) const;
+
   struct Object_info {
     std::string name;
     std::optional<bool> exists{};
@@ -313,6 +422,9 @@ class Dump_reader {
     std::string basename;
     std::string extension;
 
+    // compression dictionary used by all the data files, if any
+    std::shared_ptr<const std::string> compression_dictionary;
+
     bool has_data = true;
     bool chunked = false;
     bool last_chunk_seen = false;
@@ -324,6 +436,8 @@ class Dump_reader {
     size_t chunks_consumed = 0;
     // number of chunks which were loaded
     size_t chunks_loaded = 0;
+    // chunks which were scheduled, but not yet loaded
+    std::set<size_t> chunks_in_flight;
 
     std::list<const dump::common::Checksums::Checksum_data *> checksums;
     size_t checksums_verified = 0;
@@ -338,6 +452,15 @@ class Dump_reader {
              available_chunks[chunks_consumed].has_value();
     }
 
+    /**
+     * Checks if the next chunk is no further than the given number of chunks
+     * from the oldest chunk which is still being loaded.
+     */
+    bool within_window(const std::optional<uint64_t> &window) const {
+      return !window.has_value() || chunks_in_flight.empty() ||
+             chunks_consumed < *chunks_in_flight.begin() + *window;
+    }
+
     size_t bytes_available() const {
       size_t total = 0;
 
@@ -354,6 +477,18 @@ class Dump_reader {
 
     bool data_loaded() const { return all_chunks_are(chunks_loaded); }
 
+    /**
+     * Checks if data covered by the given checksum was already loaded.
+     */
+    bool chunk_loaded(int64_t index) const {
+      if (index < 0 || !chunked) {
+        return data_loaded();
+      }
+
+      const auto idx = static_cast<size_t>(index);
+      return idx < chunks_consumed && !chunks_in_flight.contains(idx);
+    }
+
     bool data_verification_scheduled() const noexcept {
       return checksums.empty();
     }
@@ -380,6 +515,80 @@ class Dump_reader {
     mutable std::string m_key;
   };
 
+  /**
+   * Tables and partitions that are ready to be loaded, indexed so that the
+   * scheduler does not have to scan all of them each time a chunk is picked.
+   */
+  class Tables_with_data final {
+   public:
+    Tables_with_data() = default;
+
+    Tables_with_data(const Tables_with_data &) = default;
+    Tables_with_data(Tables_with_data &&) = default;
+
+    Tables_with_data &operator=(const Tables_with_data &) = default;
+    Tables_with_data &operator=(Tables_with_data &&) = default;
+
+    ~Tables_with_data() = default;
+
+    /**
+     * Adds the table, or updates its state if it's already added.
+     */
+    void insert(Table_data_info *table);
+
+    void erase(Table_data_info *table);
+
+    /**
+     * Marks the next chunk of the table as consumed, removes the table if it
+     * does not have any more data available.
+     */
+    void consume_chunk(Table_data_info *table);
+
+    bool empty() const noexcept {
+      return m_not_started.empty() && m_in_progress.empty();
+    }
+
+    std::size_t size() const noexcept {
+      return m_not_started.size() + m_in_progress.size();
+    }
+
+    /**
+     * The biggest table which was not scheduled yet, nullptr if there's none.
+     */
+    Table_data_info *largest_not_started() const {
+      return m_not_started.empty() ? nullptr : m_not_started.begin()->second;
+    }
+
+    /**
+     * Tables which had at least one chunk scheduled. The number of such tables
+     * is limited by the number of concurrent tables being loaded.
+     */
+    const std::unordered_set<Table_data_info *> &in_progress() const {
+      return m_in_progress;
+    }
+
+    template <typename F>
+    void for_each(F &&f) const {
+      for (const auto &table : m_not_started) {
+        f(table.second);
+      }
+
+      for (const auto table : m_in_progress) {
+        f(table);
+      }
+    }
+
+   private:
+    using Sized_table = std::pair<std::size_t, Table_data_info *>;
+
+    // tables which were not scheduled yet, biggest first
+    std::set<Sized_table, std::greater<Sized_table>> m_not_started;
+    // size used as a key in m_not_started
+    std::unordered_map<Table_data_info *, std::size_t> m_not_started_size;
+
+    std::unordered_set<Table_data_info *> m_in_progress;
+  };
+
   struct Table_info : public Object_info {
     std::string schema;
     std::string basename;
@@ -402,6 +611,14 @@ class Dump_reader {
 
     std::vector<Table_data_info> data_info;
 
+    std::vector<Tablespace_file> tablespaces;
+    mysqlshdk::storage::Compression compression =
+        mysqlshdk::storage::Compression::NONE;
+
+    // location of the dump which holds the data files, empty if these are
+    // stored in this dump
+    std::string data_location;
+
     std::string script_name() const;
     std::string triggers_script_name() const;
 
@@ -432,7 +649,7 @@ class Dump_reader {
     std::vector<Object_info> functions;
     std::vector<Object_info> procedures;
     std::vector<Object_info> events;
-    std::vector<std::string> foreign_key_queries;
+    std::vector<Deferred_foreign_keys> foreign_keys;
     std::vector<std::string> queries_on_schema_end;
 
     volatile bool md_loaded = false;
@@ -479,6 +696,11 @@ class Dump_reader {
     uint64_t binlog_position = 0;
     std::string gtid_executed;
     bool gtid_executed_inconsistent = false;
+    bool incremental = false;
+    std::string base_gtid_executed;
+    // tables are not filtered and use the original schema names
+    Row_counts base_source_rows;
+    Row_counts source_rows;
     bool tz_utc = true;
     bool mds_compatibility = false;
     bool partial_revokes = false;
@@ -490,6 +712,8 @@ class Dump_reader {
     std::string origin;
     uint64_t bytes_per_chunk = 0;
     std::unordered_map<std::string, uint64_t> chunk_sizes;
+    // CRC-32C of the contents of chunk files
+    std::unordered_map<std::string, uint32_t> chunk_checksums;
 
     volatile bool md_done = false;
 
@@ -533,6 +757,8 @@ class Dump_reader {
  private:
   const std::string &override_schema(const std::string &s) const;
 
+  Row_counts loaded_row_counts(const Row_counts &rows) const;
+
   const Table_info *find_table(std::string_view schema, std::string_view table,
                                const char *context) const;
 
@@ -555,8 +781,56 @@ class Dump_reader {
   View_info *find_view(std::string_view schema, std::string_view view,
                        const char *context);
 
+  /**
+   * Starts downloading the chunks which are going to be loaded next.
+   */
+  void prefetch_chunks(const Table_data_info &table);
+
+  /**
+   * Creates handle of a data file.
+   */
+  std::unique_ptr<mysqlshdk::storage::IFile> data_file(
+      const std::string &name) const;
+
+  /**
+   * Creates handle of a data file of the given table, which may be stored in
+   * another dump.
+   */
+  std::unique_ptr<mysqlshdk::storage::IFile> data_file(
+      const Table_data_info &table, const std::string &name);
+
+  struct Referenced_dump {
+    std::unique_ptr<mysqlshdk::storage::IDirectory> dir;
+    Files files;
+  };
+
+  /**
+   * Provides a dump which holds data of the unchanged tables of this dump,
+   * its files are listed once, as it is complete.
+   */
+  const Referenced_dump &referenced_dump(const std::string &location);
+
+  /**
+   * Fetches the metadata index of a complete dump, if it's available.
+   */
+  void load_metadata_index(const Files &files);
+
+  void release_metadata_index();
+
+  Files list_files(dump::Progress_thread *progress_thread);
+
+  /**
+   * Reads the journal segments which were written since the previous call.
+   * Journal is no longer used once it reports that the dump is complete, or
+   * if it cannot be read.
+   */
+  void read_journal();
+
   std::unique_ptr<mysqlshdk::storage::IDirectory> m_dir;
 
+  // location -> dump which holds data of the unchanged tables
+  std::unordered_map<std::string, Referenced_dump> m_referenced_dumps;
+
   const Load_dump_options &m_options;
 
   Status m_dump_status = Status::INVALID;
@@ -564,7 +838,10 @@ class Dump_reader {
   size_t m_filtered_data_size = 0;
 
   // Tables and partitions that are ready to be loaded
-  std::unordered_set<Table_data_info *> m_tables_with_data;
+  Tables_with_data m_tables_with_data;
+
+  // downloads the data files before they are loaded, used with remote dumps
+  std::unique_ptr<Chunk_prefetcher> m_prefetcher;
 
   // tables which have data to be loaded (possibly partitioned)
   std::atomic<uint64_t> m_tables_to_load{0};
@@ -572,24 +849,43 @@ class Dump_reader {
   // tables and partitions which have data to be loaded
   std::atomic<uint64_t> m_tables_and_partitions_to_load{0};
 
+  uint64_t m_chunks_loaded = 0;
+
   bool m_dump_has_partitions = false;
 
   std::atomic<uint64_t> m_metadata_available{0};
   std::atomic<uint64_t> m_metadata_parsed{0};
 
+  // contents of the metadata index, kept until all metadata is parsed
+  std::string m_metadata_index_data;
+  // file name -> contents of the file
+  std::unordered_map<std::string, std::string_view> m_metadata_index;
+  bool m_metadata_index_loaded = false;
+
+  struct Journal {
+    // whether the initial listing was done
+    bool listed = false;
+    // number of the last journal segment which was read
+    uint64_t segment = 0;
+    // all the files found so far
+    Files files;
+  };
+
+  // set if dump writes the journal and was not complete when it was opened
+  std::optional<Journal> m_journal;
+
   // new schema name -> old schema name
   std::optional<std::pair<std::string, std::string>> m_schema_override;
 
-  using Candidate =
-      std::unordered_set<Dump_reader::Table_data_info *>::iterator;
-
-  static Candidate schedule_chunk_proportionally(
+  static Table_data_info *schedule_chunk_proportionally(
       const std::unordered_multimap<std::string, size_t> &tables_being_loaded,
-      std::unordered_set<Dump_reader::Table_data_info *> *tables_with_data,
-      uint64_t max_concurrent_tables);
+      const Tables_with_data &tables_with_data, uint64_t max_concurrent_tables,
+      const std::optional<uint64_t> &chunk_window);
 
 #ifdef FRIEND_TEST
   FRIEND_TEST(Dump_scheduler, load_scheduler);
+  FRIEND_TEST(Dump_scheduler, load_scheduler_many_tables);
+  FRIEND_TEST(Dump_scheduler, load_scheduler_chunk_window);
 #endif
 };
 
@@ -41,6 +41,7 @@
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/oci/oci_par.h"
 #include "mysqlshdk/libs/storage/backend/oci_par_directory_config.h"
+#include "mysqlshdk/libs/storage/backend/stream_archive.h"
 #include "mysqlshdk/libs/storage/utils.h"
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/strformat.h"
@@ -66,9 +67,15 @@ const shcore::Option_pack_def<Load_dump_options> &Load_dump_options::options() {
   static const auto opts =
       shcore::Option_pack_def<Load_dump_options>()
           .optional("threads", &Load_dump_options::m_threads_count)
+          .optional("minThreads", &Load_dump_options::m_min_threads)
+          .optional("chunkWindow", &Load_dump_options::m_chunk_window)
           .optional("backgroundThreads",
                     &Load_dump_options::m_background_threads_count)
           .optional("showProgress", &Load_dump_options::m_show_progress)
+          .optional("progressFormat", &Load_dump_options::m_progress_format,
+                    {{"text", dump::Progress_format::TEXT},
+                     {"jsonl", dump::Progress_format::JSONL}})
+          .optional("progressFd", &Load_dump_options::set_progress_fd)
           .optional("waitDumpTimeout", &Load_dump_options::set_wait_timeout)
           .optional("loadData", &Load_dump_options::m_load_data)
           .optional("loadDdl", &Load_dump_options::m_load_ddl)
@@ -76,6 +83,9 @@ const shcore::Option_pack_def<Load_dump_options> &Load_dump_options::options() {
           .optional("dryRun", &Load_dump_options::m_dry_run)
           .optional("resetProgress", &Load_dump_options::m_reset_progress)
           .optional("progressFile", &Load_dump_options::set_progress_file)
+          .optional("performanceReport",
+                    &Load_dump_options::m_performance_report)
+          .optional("statusFile", &Load_dump_options::m_status_file)
           .include(&Load_dump_options::m_filtering_options,
                    &dump::common::Filtering_options::events)
           .include(&Load_dump_options::m_filtering_options,
@@ -95,12 +105,17 @@ const shcore::Option_pack_def<Load_dump_options> &Load_dump_options::options() {
                     {{"histogram", Analyze_table_mode::HISTOGRAM},
                      {"on", Analyze_table_mode::ON},
                      {"off", Analyze_table_mode::OFF}})
+          .optional("deferTableAnalysis",
+                    &Load_dump_options::m_defer_table_analysis)
           .optional("deferTableIndexes",
                     &Load_dump_options::m_defer_table_indexes,
                     {{"off", Defer_index_mode::OFF},
                      {"all", Defer_index_mode::ALL},
                      {"fulltext", Defer_index_mode::FULLTEXT}})
           .optional("loadIndexes", &Load_dump_options::m_load_indexes)
+          .optional("indexThreads", &Load_dump_options::m_index_threads)
+          .optional("indexBufferSize",
+                    &Load_dump_options::set_index_buffer_size)
           .optional("schema", &Load_dump_options::m_target_schema)
           .include(&Load_dump_options::m_filtering_options,
                    &dump::common::Filtering_options::users)
@@ -117,6 +132,15 @@ const shcore::Option_pack_def<Load_dump_options> &Load_dump_options::options() {
           .optional("handleGrantErrors",
                     &Load_dump_options::set_handle_grant_errors)
           .optional("checksum", &Load_dump_options::m_checksum)
+          .optional("prefetchMemory", &Load_dump_options::set_prefetch_memory)
+          .optional("maxMemory", &Load_dump_options::set_max_memory)
+          .optional("maxTotalRate", &Load_dump_options::set_max_total_rate)
+          .optional("sessionCompression",
+                    &Load_dump_options::set_session_compression)
+          .optional("fastLoad", &Load_dump_options::m_fast_load)
+          .optional("dropPageCache", &Load_dump_options::m_drop_page_cache)
+          .optional("fallbackToInsert",
+                    &Load_dump_options::m_fallback_to_insert)
           .include(&Load_dump_options::m_oci_bucket_options)
           .include(&Load_dump_options::m_s3_bucket_options)
           .include(&Load_dump_options::m_blob_storage_options)
@@ -133,6 +157,10 @@ void Load_dump_options::set_wait_timeout(const double &timeout_seconds) {
   }
 }
 
+void Load_dump_options::set_progress_fd(int64_t fd) {
+  m_progress_fd = dump::to_progress_fd(fd);
+}
+
 void Load_dump_options::set_max_bytes_per_transaction(
     const std::string &value) {
   if (value.empty()) {
@@ -152,6 +180,49 @@ void Load_dump_options::set_max_bytes_per_transaction(
   }
 }
 
+void Load_dump_options::set_prefetch_memory(const std::string &value) {
+  if (value.empty()) {
+    throw std::invalid_argument(
+        "The option 'prefetchMemory' cannot be set to an empty string.");
+  }
+
+  m_prefetch_memory = mysqlshdk::utils::expand_to_bytes(value);
+}
+
+void Load_dump_options::set_max_total_rate(const std::string &value) {
+  if (value.empty()) {
+    throw std::invalid_argument(
+        "The option 'maxTotalRate' cannot be set to an empty string.");
+  }
+
+  if (const auto rate = mysqlshdk::utils::expand_to_bytes(value); rate > 0) {
+    m_total_rate_limit =
+        std::make_shared<mysqlshdk::utils::Shared_rate_limit>(rate);
+  }
+}
+
+void Load_dump_options::set_session_compression(const std::string &value) {
+  m_session_compression = dump::common::to_session_compression(value);
+}
+
+void Load_dump_options::set_max_memory(const std::string &value) {
+  if (value.empty()) {
+    throw std::invalid_argument(
+        "The option 'maxMemory' cannot be set to an empty string.");
+  }
+
+  m_max_memory = mysqlshdk::utils::expand_to_bytes(value);
+}
+
+void Load_dump_options::set_index_buffer_size(const std::string &value) {
+  if (value.empty()) {
+    throw std::invalid_argument(
+        "The option 'indexBufferSize' cannot be set to an empty string.");
+  }
+
+  m_index_buffer_size = mysqlshdk::utils::expand_to_bytes(value);
+}
+
 void Load_dump_options::set_progress_file(const std::string &value) {
   m_progress_file = value;
 
@@ -278,9 +349,32 @@ void Load_dump_options::set_session(
     m_partial_revokes =
         instance.get_sysvar_bool("partial_revokes").value_or(false);
   }
+
+  if (m_target_server_version >= Version(8, 0, 0)) {
+    // server-side bulk loader is available if its variables are present
+    m_bulk_load_supported =
+        query(
+            "SELECT COUNT(*) FROM performance_schema.global_variables WHERE "
+            "VARIABLE_NAME LIKE 'bulk\\_loader.%'")
+            ->fetch_one_or_throw()
+            ->get_uint(0) > 0;
+  }
 }
 
 void Load_dump_options::validate() {
+  if (mysqlshdk::storage::backend::is_stream_archive(m_url)) {
+    if (m_storage_config && m_storage_config->valid()) {
+      throw shcore::Exception::argument_error(
+          "The object storage options cannot be used when loading a stream "
+          "archive.");
+    }
+
+    // wait for the dump to start
+    set_storage_config(
+        mysqlshdk::storage::backend::stream_archive_reader_config(m_url,
+                                                                  "@.json"));
+  }
+
   if (!m_storage_config || !m_storage_config->valid()) {
     auto config = dump::common::get_par_config(m_url);
 
@@ -297,6 +391,9 @@ void Load_dump_options::validate() {
               "When using a PAR to load a dump, the progressFile option must "
               "be defined");
         }
+
+        // data files are reachable by the server
+        m_prefix_par = mysqlshdk::oci::PAR_type::PREFIX == config->par().type();
       } else {
         current_console()->print_warning(
             "The given URL is not a prefix PAR or a PAR to the @.manifest.json "
@@ -313,18 +410,78 @@ void Load_dump_options::validate() {
     const auto local_infile_value = row->get_string(1);
 
     if (shcore::str_caseeq(local_infile_value, "off")) {
-      mysqlsh::current_console()->print_error(
-          "The 'local_infile' global system variable must be set to ON in "
-          "the target server, after the server is verified to be trusted.");
-      THROW_ERROR(SHERR_LOAD_LOCAL_INFILE_DISABLED);
+      if (m_fallback_to_insert) {
+        mysqlsh::current_console()->print_note(
+            "The 'local_infile' global system variable is set to OFF in the "
+            "target server, data is going to be loaded using INSERT "
+            "statements.");
+        m_use_insert_statements = true;
+      } else {
+        mysqlsh::current_console()->print_error(
+            "The 'local_infile' global system variable must be set to ON in "
+            "the target server, after the server is verified to be trusted.");
+        THROW_ERROR(SHERR_LOAD_LOCAL_INFILE_DISABLED);
+      }
     }
   }
 
+  if (m_index_buffer_size.has_value() &&
+      m_target_server_version < Version(8, 0, 27)) {
+    throw std::invalid_argument(
+        "The 'indexBufferSize' option requires the target server to be MySQL "
+        "8.0.27 or newer.");
+  }
+
+  if (m_fast_load) {
+    validate_fast_load();
+  }
+
   if (!m_progress_file.has_value()) {
     m_default_progress_file = "load-progress." + m_server_uuid + ".json";
   }
 }
 
+void Load_dump_options::validate_fast_load() const {
+  if (is_mds()) {
+    throw std::invalid_argument(
+        "The 'fastLoad' option is not supported when loading into a MySQL "
+        "HeatWave Service DB System.");
+  }
+
+  if (m_target_server_version < Version(8, 0, 21)) {
+    throw std::invalid_argument(
+        "The 'fastLoad' option requires the target server to be MySQL 8.0.21 "
+        "or newer.");
+  }
+
+  // disabling the redo log makes the instance not crash safe, refuse to do
+  // this if instance is used by anybody else
+  const auto row =
+      query(
+          "SELECT "
+          "COUNT(IF(PROCESSLIST_COMMAND LIKE 'Binlog Dump%', 1, NULL)), "
+          "COUNT(IF(PROCESSLIST_COMMAND LIKE 'Binlog Dump%', NULL, 1)) "
+          "FROM performance_schema.threads "
+          "WHERE NAME = 'thread/sql/one_connection' "
+          "AND PROCESSLIST_ID <> CONNECTION_ID()")
+          ->fetch_one_or_throw();
+  const auto replicas = row->get_uint(0, 0);
+  const auto connections = row->get_uint(1, 0);
+
+  if (replicas > 0) {
+    throw std::invalid_argument(
+        "The 'fastLoad' option cannot be used, the target instance is a source "
+        "of " +
+        std::to_string(replicas) + " replica(s).");
+  }
+
+  if (connections > 0) {
+    throw std::invalid_argument(
+        "The 'fastLoad' option cannot be used, the target instance has " +
+        std::to_string(connections) + " other client connection(s).");
+  }
+}
+
 std::string Load_dump_options::target_import_info(
     const char *operation, const std::string &extra) const {
   std::string action;
@@ -420,6 +577,25 @@ void Load_dump_options::on_unpacked_options() {
         "enabled");
   }
 
+  if (m_min_threads.has_value() &&
+      (0 == *m_min_threads || *m_min_threads > m_threads_count)) {
+    throw std::invalid_argument(
+        "The value of the 'minThreads' option must be a positive integer not "
+        "greater than the value of the 'threads' option.");
+  }
+
+  if (m_chunk_window.has_value() && 0 == *m_chunk_window) {
+    throw std::invalid_argument(
+        "The value of the 'chunkWindow' option must be a positive integer.");
+  }
+
+  if (m_progress_fd.has_value() &&
+      dump::Progress_format::JSONL != m_progress_format) {
+    throw std::invalid_argument(
+        "The 'progressFd' option requires the 'progressFormat' option to be "
+        "set to 'jsonl'.");
+  }
+
   if (!m_load_indexes && m_defer_table_indexes == Defer_index_mode::OFF) {
     throw std::invalid_argument(
         "'deferTableIndexes' option needs to be enabled when "
@@ -29,6 +29,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "mysqlshdk/include/scripting/types.h"
@@ -39,6 +40,7 @@
 #include "mysqlshdk/libs/storage/config.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/rate_limit.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
@@ -46,7 +48,10 @@
 
 #include "modules/mod_utils.h"
 #include "modules/util/common/dump/filtering_options.h"
+#include "modules/util/common/dump/session_compression.h"
+#include "modules/util/dump/progress_thread.h"
 #include "modules/util/import_table/helpers.h"
+#include "modules/util/load/shared_chunk_cache.h"
 
 namespace mysqlsh {
 
@@ -149,8 +154,44 @@ class Load_dump_options {
 
   void set_show_progress(bool show) { m_show_progress = show; }
 
+  dump::Progress_format progress_format() const { return m_progress_format; }
+
+  /**
+   * File descriptor the progress events are written to, used if progress
+   * format is JSONL.
+   */
+  int progress_fd() const { return m_progress_fd.value_or(2); }
+
   uint64_t threads_count() const { return m_threads_count; }
 
+  /**
+   * Minimum number of threads which load the data, if set, number of threads
+   * is adjusted between this value and threads_count(), depending on the load
+   * of the target instance.
+   */
+  std::optional<uint64_t> min_threads() const { return m_min_threads; }
+
+  /**
+   * If set, chunks of a table are scheduled only if their index is lower than
+   * the index of the oldest chunk of that table which is being loaded plus
+   * this value.
+   */
+  std::optional<uint64_t> chunk_window() const { return m_chunk_window; }
+
+  /**
+   * If not empty, path to the local file where the performance report is
+   * written.
+   */
+  const std::string &performance_report() const {
+    return m_performance_report;
+  }
+
+  /**
+   * If not empty, path to the local file where the status of the running load
+   * is published.
+   */
+  const std::string &status_file() const { return m_status_file; }
+
   uint64_t background_threads_count(uint64_t def) const {
     return m_background_threads_count.value_or(def);
   }
@@ -161,6 +202,18 @@ class Load_dump_options {
 
   uint64_t threads_per_add_index() const { return m_threads_per_add_index; }
 
+  /**
+   * Maximum number of threads used to recreate indexes while table data is
+   * still being loaded.
+   */
+  uint64_t index_threads() const {
+    return m_index_threads.value_or((m_threads_count + 1) / 2);
+  }
+
+  std::optional<uint64_t> index_buffer_size() const {
+    return m_index_buffer_size;
+  }
+
   uint64_t dump_wait_timeout_ms() const { return m_wait_dump_timeout_ms; }
 
   void set_dump_wait_timeout_ms(uint64_t timeout_ms) {
@@ -209,6 +262,11 @@ class Load_dump_options {
 
   Analyze_table_mode analyze_tables() const { return m_analyze_tables; }
 
+  bool defer_table_analysis() const {
+    return m_defer_table_analysis &&
+           m_analyze_tables != Analyze_table_mode::OFF;
+  }
+
   Update_gtid_set update_gtid_set() const { return m_update_gtid_set; }
 
   const std::string &target_schema() const { return m_target_schema; }
@@ -249,17 +307,80 @@ class Load_dump_options {
 
   bool partial_revokes() const { return m_partial_revokes; }
 
+  bool bulk_load_supported() const { return m_bulk_load_supported; }
+
+  bool is_prefix_par() const { return m_prefix_par; }
+
   bool fast_sub_chunking() const { return m_use_fast_sub_chunking; }
 
   void enable_fast_sub_chunking() { m_use_fast_sub_chunking = true; }
 
   inline bool checksum() const noexcept { return m_checksum; }
 
+  uint64_t prefetch_memory() const { return m_prefetch_memory; }
+
+  uint64_t max_memory() const { return m_max_memory; }
+
+  /**
+   * Limit shared by all the threads, not set if there's no limit.
+   */
+  const std::shared_ptr<mysqlshdk::utils::Shared_rate_limit>
+      &total_rate_limit() const {
+    return m_total_rate_limit;
+  }
+
+  /**
+   * Cache of the data files shared with the loaders of the other instances,
+   * not set if dump is loaded into a single instance.
+   */
+  const std::shared_ptr<Shared_chunk_cache> &shared_chunk_cache() const {
+    return m_shared_chunk_cache;
+  }
+
+  void set_shared_chunk_cache(std::shared_ptr<Shared_chunk_cache> cache) {
+    m_shared_chunk_cache = std::move(cache);
+  }
+
+  bool fast_load() const { return m_fast_load; }
+
+  /**
+   * Protocol compression of the sessions which load the data.
+   */
+  dump::common::Session_compression session_compression() const {
+    return m_session_compression;
+  }
+
+  /**
+   * Whether local data files which were loaded should be evicted from the page
+   * cache.
+   */
+  bool drop_page_cache() const { return m_drop_page_cache; }
+
+  /**
+   * Whether data is loaded using INSERT statements, instead of
+   * LOAD DATA LOCAL INFILE.
+   */
+  bool use_insert_statements() const { return m_use_insert_statements; }
+
  private:
   void set_wait_timeout(const double &timeout_seconds);
 
+  void set_progress_fd(int64_t fd);
+
   void set_max_bytes_per_transaction(const std::string &value);
 
+  void set_prefetch_memory(const std::string &value);
+
+  void set_max_memory(const std::string &value);
+
+  void set_max_total_rate(const std::string &value);
+
+  void set_session_compression(const std::string &value);
+
+  void set_index_buffer_size(const std::string &value);
+
+  void validate_fast_load() const;
+
   void set_handle_grant_errors(const std::string &action);
 
   inline std::shared_ptr<mysqlshdk::db::IResult> query(
@@ -277,8 +398,14 @@ class Load_dump_options {
 
   std::string m_url;
   uint64_t m_threads_count = 4;
+  std::optional<uint64_t> m_min_threads;
+  std::optional<uint64_t> m_chunk_window;
+  std::string m_performance_report;
+  std::string m_status_file;
   std::optional<uint64_t> m_background_threads_count;
   bool m_show_progress = isatty(fileno(stdout)) ? true : false;
+  dump::Progress_format m_progress_format = dump::Progress_format::TEXT;
+  std::optional<int> m_progress_fd;
 
   mysqlshdk::oci::Oci_bucket_options m_oci_bucket_options;
   mysqlshdk::aws::S3_bucket_options m_s3_bucket_options;
@@ -299,6 +426,7 @@ class Load_dump_options {
   bool m_load_ddl = true;
   bool m_load_users = false;
   Analyze_table_mode m_analyze_tables = Analyze_table_mode::OFF;
+  bool m_defer_table_analysis = false;
   bool m_dry_run = false;
   bool m_force = false;
   bool m_skip_binlog = false;
@@ -326,12 +454,42 @@ class Load_dump_options {
   // how many threads are used by the server per one ALTER TABLE ... ADD INDEX
   uint64_t m_threads_per_add_index = 1;
 
+  std::optional<uint64_t> m_index_threads;
+  std::optional<uint64_t> m_index_buffer_size;
+
   bool m_checksum = false;
 
+  // memory used to prefetch data files from a remote location
+  uint64_t m_prefetch_memory = 256 * 1024 * 1024;
+  // 0 - memory used by the data buffers is not limited
+  uint64_t m_max_memory = 0;
+
+  std::shared_ptr<mysqlshdk::utils::Shared_rate_limit> m_total_rate_limit;
+
+  std::shared_ptr<Shared_chunk_cache> m_shared_chunk_cache;
+
+  dump::common::Session_compression m_session_compression =
+      dump::common::Session_compression::AUTO;
+
+  // whether redo log and doublewrite buffer are disabled during the load
+  bool m_fast_load = false;
+
+  bool m_drop_page_cache = false;
+
   // whether partial revokes are enabled
   bool m_partial_revokes = false;
 
+  // whether the server-side bulk loader is available
+  bool m_bulk_load_supported = false;
+
+  // whether dump is loaded using a prefix PAR
+  bool m_prefix_par = false;
+
   bool m_use_fast_sub_chunking = false;
+
+  // whether INSERT statements can be used if local_infile is disabled
+  bool m_fallback_to_insert = false;
+  bool m_use_insert_statements = false;
 };
 
 }  // namespace mysqlsh
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/load_dump_to_instances.h"
+
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+
+#include "modules/mod_utils.h"
+#include "modules/util/common/console_with_prefix.h"
+#include "modules/util/load/dump_loader.h"
+#include "modules/util/load/shared_chunk_cache.h"
+
+namespace mysqlsh {
+
+Load_dump_to_instances_options::Load_dump_to_instances_options() {
+  on_unpacked_options();
+}
+
+const shcore::Option_pack_def<Load_dump_to_instances_options>
+    &Load_dump_to_instances_options::options() {
+  static const auto opts =
+      shcore::Option_pack_def<Load_dump_to_instances_options>()
+          .ignore({"performanceReport", "progressFd", "progressFile",
+                   "progressFormat", "showProgress", "statusFile"})
+          .include(&Load_dump_to_instances_options::m_load_options)
+          .optional("cacheMemory",
+                    &Load_dump_to_instances_options::set_cache_memory)
+          .on_done(&Load_dump_to_instances_options::on_unpacked_options);
+
+  return opts;
+}
+
+void Load_dump_to_instances_options::set_cache_memory(
+    const std::string &value) {
+  if (value.empty()) {
+    throw std::invalid_argument(
+        "The option 'cacheMemory' cannot be set to an empty string.");
+  }
+
+  m_cache_memory = mysqlshdk::utils::expand_to_bytes(value);
+}
+
+void Load_dump_to_instances_options::on_unpacked_options() {
+  // progress of several loaders cannot be displayed at the same time
+  m_load_options.set_show_progress(false);
+}
+
+void load_dump_to_instances(
+    const std::string &url,
+    const std::vector<mysqlshdk::db::Connection_options> &instances,
+    const Load_dump_to_instances_options &options) {
+  const auto count = instances.size();
+
+  if (0 == count) {
+    throw std::invalid_argument("The list of instances cannot be empty.");
+  }
+
+  const auto cache =
+      std::make_shared<Shared_chunk_cache>(count, options.cache_memory());
+
+  std::vector<std::string> addresses;
+  std::vector<Load_dump_options> load_options;
+
+  addresses.reserve(count);
+  load_options.reserve(count);
+
+  const auto console = current_console();
+
+  for (const auto &instance : instances) {
+    std::shared_ptr<mysqlshdk::db::ISession> session;
+
+    addresses.emplace_back(instance.uri_endpoint());
+
+    try {
+      session =
+          establish_session(instance, current_shell_options()->get().wizards);
+    } catch (const mysqlshdk::db::Error &e) {
+      throw std::invalid_argument("Could not connect to the instance '" +
+                                  addresses.back() + "': " + e.format());
+    }
+
+    auto &opt = load_options.emplace_back(options.load_options());
+    opt.set_url(url);
+    opt.set_session(session);
+    opt.set_shared_chunk_cache(cache);
+
+    for (std::size_t i = 0; i + 1 < load_options.size(); ++i) {
+      if (load_options[i].server_uuid() == opt.server_uuid()) {
+        throw std::invalid_argument("The instances '" + addresses[i] +
+                                    "' and '" + addresses.back() +
+                                    "' refer to the same server.");
+      }
+    }
+
+    opt.validate();
+
+    console->print_info(addresses.back() + ": " + opt.target_import_info());
+  }
+
+  std::mutex loaders_mutex;
+  std::vector<Dump_loader *> loaders(count, nullptr);
+  std::vector<std::exception_ptr> errors(count);
+
+  shcore::Interrupt_handler intr_handler([&loaders_mutex, &loaders]() -> bool {
+    std::lock_guard lock{loaders_mutex};
+
+    for (const auto loader : loaders) {
+      if (loader) {
+        loader->interrupt();
+      }
+    }
+
+    return false;
+  });
+
+  std::vector<std::thread> threads;
+  threads.reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    threads.emplace_back(mysqlsh::spawn_scoped_thread([&, i]() {
+      mysqlsh::Mysql_thread mysql_thread;
+      mysqlsh::Scoped_console prefixed_console{
+          std::make_shared<Console_with_prefix>(addresses[i] + ":")};
+
+      // files which are not going to be read by this loader can be released
+      shcore::on_leave_scope finished(
+          [&cache]() { cache->consumer_finished(); });
+
+      try {
+        Dump_loader loader{load_options[i]};
+
+        {
+          std::lock_guard lock{loaders_mutex};
+          loaders[i] = &loader;
+        }
+
+        shcore::on_leave_scope unregister([&loaders_mutex, &loaders, i]() {
+          std::lock_guard lock{loaders_mutex};
+          loaders[i] = nullptr;
+        });
+
+        loader.run();
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    }));
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  if (const auto reused = cache->bytes_reused()) {
+    const auto usage = shcore::str_format(
+        "Data shared between the loaders: %s, peak memory used by the shared "
+        "data: %s",
+        mysqlshdk::utils::format_bytes(reused).c_str(),
+        mysqlshdk::utils::format_bytes(cache->peak_memory()).c_str());
+
+    log_info("%s", usage.c_str());
+    console->print_info(usage);
+  }
+
+  std::size_t failed = 0;
+
+  for (std::size_t i = 0; i < count; ++i) {
+    if (!errors[i]) {
+      console->print_info(addresses[i] + ": Load completed.");
+      continue;
+    }
+
+    ++failed;
+
+    try {
+      std::rethrow_exception(errors[i]);
+    } catch (const std::exception &e) {
+      console->print_error(addresses[i] + ": Load failed: " + e.what());
+    } catch (...) {
+      console->print_error(addresses[i] + ": Load failed.");
+    }
+  }
+
+  if (1 == count && failed) {
+    std::rethrow_exception(errors.front());
+  }
+
+  if (failed) {
+    throw std::runtime_error(shcore::str_format(
+        "Failed to load the dump into %zu of %zu instances, use the same "
+        "command to resume the load.",
+        failed, count));
+  }
+}
+
+}  // namespace mysqlsh
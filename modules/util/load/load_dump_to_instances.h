@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_LOAD_DUMP_TO_INSTANCES_H_
+#define MODULES_UTIL_LOAD_LOAD_DUMP_TO_INSTANCES_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/libs/db/connection_options.h"
+
+#include "modules/util/load/load_dump_options.h"
+
+namespace mysqlsh {
+
+class Load_dump_to_instances_options final {
+ public:
+  Load_dump_to_instances_options();
+
+  Load_dump_to_instances_options(const Load_dump_to_instances_options &) =
+      default;
+  Load_dump_to_instances_options(Load_dump_to_instances_options &&) = default;
+
+  Load_dump_to_instances_options &operator=(
+      const Load_dump_to_instances_options &) = default;
+  Load_dump_to_instances_options &operator=(Load_dump_to_instances_options &&) =
+      default;
+
+  ~Load_dump_to_instances_options() = default;
+
+  static const shcore::Option_pack_def<Load_dump_to_instances_options>
+      &options();
+
+  /**
+   * Options used by the loaders of all instances.
+   */
+  const Load_dump_options &load_options() const { return m_load_options; }
+
+  /**
+   * Maximum memory held by the data files shared between the loaders.
+   */
+  std::size_t cache_memory() const { return m_cache_memory; }
+
+ private:
+  void set_cache_memory(const std::string &value);
+
+  void on_unpacked_options();
+
+  Load_dump_options m_load_options;
+  std::size_t m_cache_memory = 1024 * 1024 * 1024;
+};
+
+/**
+ * Loads the dump into all the given instances at the same time. Each data file
+ * is read and decompressed once, and then loaded into each instance by its own
+ * loader. Loaders use separate progress files and fail independently, the load
+ * into the remaining instances continues if one of them fails.
+ *
+ * @param url Location of the dump.
+ * @param instances Target instances.
+ * @param options Load options.
+ *
+ * @throws std::runtime_error if load into any of the instances has failed
+ */
+void load_dump_to_instances(
+    const std::string &url,
+    const std::vector<mysqlshdk::db::Connection_options> &instances,
+    const Load_dump_to_instances_options &options);
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_LOAD_DUMP_TO_INSTANCES_H_
@@ -32,6 +32,7 @@
 #include <utility>
 
 #include "modules/util/load/load_errors.h"
+#include "modules/util/load/segmented_progress_file.h"
 #include "mysqlshdk/include/scripting/types.h"
 #include "mysqlshdk/libs/storage/backend/memory_file.h"
 #include "mysqlshdk/libs/storage/ifile.h"
@@ -49,20 +50,37 @@ class Load_progress_log final {
     uint64_t raw_bytes_completed;
   };
 
+  enum class Write_mode {
+    // file supports appending and flushing partially written contents
+    APPEND,
+    // whole file is rewritten on each flush
+    REWRITE,
+    // new entries are written to small segments, which are merged in the
+    // background
+    SEGMENTED,
+  };
+
   Progress_status init(std::unique_ptr<mysqlshdk::storage::IFile> file,
-                       bool dry_run, bool rewrite_on_flush) {
+                       bool dry_run, Write_mode mode) {
     mysqlshdk::storage::IFile *existing_file = file.get();
 
-    // rewrite_on_flush is meant for storage backends that do not support
-    // neither appending nor flushing partially written contents (e.g. REST
-    // based storage services). In that case, we write to an in-memory file
-    // and every time we need to flush, we rewrite the entire file remotely.
-    if (rewrite_on_flush) {
+    // REWRITE and SEGMENTED modes are meant for storage backends that do not
+    // support neither appending nor flushing partially written contents (e.g.
+    // REST based storage services).
+    if (Write_mode::REWRITE == mode) {
+      // we write to an in-memory file and every time we need to flush, we
+      // rewrite the entire file remotely
       m_real_file = std::move(file);
       auto mem_file =
           std::make_unique<mysqlshdk::storage::backend::Memory_file>("");
       m_memfile_contents = &mem_file->content();
       m_file = std::move(mem_file);
+    } else if (Write_mode::SEGMENTED == mode) {
+      // every flush uploads just the most recent segment, segments are merged
+      // when file is read
+      m_file = std::make_unique<Segmented_progress_file>(std::move(file));
+      existing_file = m_file.get();
+      m_segmented = true;
     } else {
       m_file = std::move(file);
     }
@@ -137,6 +155,11 @@ class Load_progress_log final {
     if (dry_run) {
       m_file.reset();
       m_real_file.reset();
+    } else if (m_segmented && !data.empty()) {
+      // existing segments are kept, new entries are appended after them
+      m_file->open(mysqlshdk::storage::Mode::APPEND);
+      m_file->write("\n", 1);  // separator for new attempt
+      flush();
     } else {
       m_file->open(mysqlshdk::storage::Mode::WRITE);
       if (!data.empty()) {
@@ -254,6 +277,12 @@ class Load_progress_log final {
     return it->second.status;
   }
 
+  Status data_loaded_status() const {
+    auto it = m_last_state.find("DATA-LOADED");
+    if (it == m_last_state.end()) return Status::PENDING;
+    return it->second.status;
+  }
+
   void set_server_uuid(const std::string &uuid) {
     const auto saved_uuid = server_uuid();
 
@@ -360,6 +389,15 @@ class Load_progress_log final {
       log(true, "TABLE-ANALYZE", schema, table);
   }
 
+  // data and indexes are loaded, only the deferred table analysis remains
+  void data_loaded() {
+    if (data_loaded_status() != Status::DONE) {
+      // an entry is complete only if both start and end are logged
+      log(false, "DATA-LOADED");
+      log(true, "DATA-LOADED");
+    }
+  }
+
  private:
   using Dumper = shcore::JSON_dumper;
   using Callback = std::function<void(Dumper *)>;
@@ -372,6 +410,7 @@ class Load_progress_log final {
   std::unique_ptr<mysqlshdk::storage::IFile> m_file;
   std::unique_ptr<mysqlshdk::storage::IFile> m_real_file;
   const std::string *m_memfile_contents = nullptr;
+  bool m_segmented = false;
 
   std::unordered_map<std::string, Status_details> m_last_state;
 
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "modules/util/load/memory_budget.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace mysqlsh {
+
+Memory_budget::Reservation &Memory_budget::Reservation::operator=(
+    Reservation &&other) {
+  if (this != &other) {
+    reset();
+
+    m_budget = std::exchange(other.m_budget, nullptr);
+    m_bytes = std::exchange(other.m_bytes, 0);
+    m_blocking = std::exchange(other.m_blocking, false);
+  }
+
+  return *this;
+}
+
+void Memory_budget::Reservation::reset() {
+  if (m_budget) {
+    m_budget->release(m_bytes, m_blocking);
+
+    m_budget = nullptr;
+    m_bytes = 0;
+    m_blocking = false;
+  }
+}
+
+Memory_budget::Reservation Memory_budget::acquire(std::size_t bytes) {
+  {
+    std::unique_lock lock{m_mutex};
+
+    m_cv.wait(lock, [this, bytes]() {
+      return m_interrupted || fits(bytes) || 0 == m_blocking;
+    });
+
+    if (m_interrupted) {
+      return {};
+    }
+
+    reserve(bytes, true);
+  }
+
+  return Reservation{this, bytes, true};
+}
+
+Memory_budget::Reservation Memory_budget::try_acquire(std::size_t bytes) {
+  {
+    std::lock_guard lock{m_mutex};
+
+    if (!fits(bytes)) {
+      return {};
+    }
+
+    reserve(bytes, false);
+  }
+
+  return Reservation{this, bytes, false};
+}
+
+void Memory_budget::interrupt() {
+  {
+    std::lock_guard lock{m_mutex};
+    m_interrupted = true;
+  }
+
+  m_cv.notify_all();
+}
+
+std::size_t Memory_budget::used() const {
+  std::lock_guard lock{m_mutex};
+  return m_used;
+}
+
+std::size_t Memory_budget::peak() const {
+  std::lock_guard lock{m_mutex};
+  return m_peak;
+}
+
+void Memory_budget::reserve(std::size_t bytes, bool blocking) {
+  m_used += bytes;
+  m_peak = std::max(m_peak, m_used);
+
+  if (blocking) {
+    ++m_blocking;
+  }
+}
+
+void Memory_budget::release(std::size_t bytes, bool blocking) {
+  {
+    std::lock_guard lock{m_mutex};
+
+    m_used -= bytes;
+
+    if (blocking) {
+      --m_blocking;
+    }
+  }
+
+  m_cv.notify_all();
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#ifndef MODULES_UTIL_LOAD_MEMORY_BUDGET_H_
+#define MODULES_UTIL_LOAD_MEMORY_BUDGET_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+namespace mysqlsh {
+
+/**
+ * Limits the total amount of memory held by the buffers of a load operation.
+ *
+ * Memory can be reserved either in a blocking way, by the threads which cannot
+ * proceed without it, or in the non-blocking way, by the consumers which can
+ * do their work without (some of) the memory (i.e. prefetching the files).
+ *
+ * A blocking request is granted even if it does not fit in the budget, if no
+ * other blocking reservations are held, this guarantees progress in case the
+ * whole budget is held by the non-blocking consumers, or the request is bigger
+ * than the budget.
+ */
+class Memory_budget final {
+ public:
+  /**
+   * Memory reserved from the budget, returned once the reservation is
+   * destroyed.
+   */
+  class Reservation final {
+   public:
+    Reservation() = default;
+
+    Reservation(const Reservation &) = delete;
+    Reservation(Reservation &&other) { *this = std::move(other); }
+
+    Reservation &operator=(const Reservation &) = delete;
+    Reservation &operator=(Reservation &&other);
+
+    ~Reservation() { reset(); }
+
+    explicit operator bool() const { return nullptr != m_budget; }
+
+    std::size_t bytes() const { return m_bytes; }
+
+    /**
+     * Returns the memory to the budget.
+     */
+    void reset();
+
+   private:
+    friend class Memory_budget;
+
+    Reservation(Memory_budget *budget, std::size_t bytes, bool blocking)
+        : m_budget(budget), m_bytes(bytes), m_blocking(blocking) {}
+
+    Memory_budget *m_budget = nullptr;
+    std::size_t m_bytes = 0;
+    bool m_blocking = false;
+  };
+
+  /**
+   * Creates the budget.
+   *
+   * @param limit Maximum amount of memory, 0 means there is no limit.
+   */
+  explicit Memory_budget(std::size_t limit = 0) : m_limit(limit) {}
+
+  Memory_budget(const Memory_budget &) = delete;
+  Memory_budget(Memory_budget &&) = delete;
+
+  Memory_budget &operator=(const Memory_budget &) = delete;
+  Memory_budget &operator=(Memory_budget &&) = delete;
+
+  ~Memory_budget() = default;
+
+  /**
+   * Reserves the given amount of memory, waits until it is available.
+   *
+   * @param bytes Amount of memory.
+   *
+   * @returns reservation, empty if budget was interrupted
+   */
+  Reservation acquire(std::size_t bytes);
+
+  /**
+   * Reserves the given amount of memory, if it's available.
+   *
+   * @param bytes Amount of memory.
+   *
+   * @returns reservation, empty if memory is not available
+   */
+  Reservation try_acquire(std::size_t bytes);
+
+  /**
+   * Wakes up all the threads waiting for memory, all subsequent blocking
+   * requests are going to fail.
+   */
+  void interrupt();
+
+  std::size_t limit() const { return m_limit; }
+
+  /**
+   * Memory which is currently reserved.
+   */
+  std::size_t used() const;
+
+  /**
+   * Maximum amount of memory which was reserved at the same time.
+   */
+  std::size_t peak() const;
+
+ private:
+  bool fits(std::size_t bytes) const {
+    return 0 == m_limit || m_used + bytes <= m_limit;
+  }
+
+  void reserve(std::size_t bytes, bool blocking);
+
+  void release(std::size_t bytes, bool blocking);
+
+  const std::size_t m_limit;
+  std::size_t m_used = 0;
+  std::size_t m_peak = 0;
+  // number of blocking reservations which are currently held
+  std::size_t m_blocking = 0;
+  bool m_interrupted = false;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_MEMORY_BUDGET_H_
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/prefetch_queue.h"
+
+#include <cassert>
+#include <utility>
+
+namespace mysqlsh {
+
+void Prefetch_queue::push(Fetch fetch) {
+  m_queue.emplace_back(std::move(fetch));
+}
+
+void Prefetch_queue::start() {
+  while (m_in_flight < m_depth && !m_queue.empty()) {
+    const auto fetch = std::move(m_queue.front());
+    m_queue.pop_front();
+
+    ++m_in_flight;
+    fetch();
+  }
+}
+
+void Prefetch_queue::consumed() {
+  assert(m_in_flight > 0);
+  --m_in_flight;
+}
+
+}  // namespace mysqlsh
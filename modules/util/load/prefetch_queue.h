@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_PREFETCH_QUEUE_H_
+#define MODULES_UTIL_LOAD_PREFETCH_QUEUE_H_
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+
+namespace mysqlsh {
+
+/**
+ * Starts the queued fetches in the order in which they were added, limiting
+ * the number of items which were fetched ahead of their consumers.
+ *
+ * An item counts against the limit from the moment its fetch is started, until
+ * its consumer reports that it was consumed. This class is not thread-safe.
+ */
+class Prefetch_queue final {
+ public:
+  using Fetch = std::function<void()>;
+
+  Prefetch_queue() = delete;
+
+  /**
+   * Creates the queue.
+   *
+   * @param depth Maximum number of items fetched ahead, at least one item is
+   *        always allowed.
+   */
+  explicit Prefetch_queue(std::size_t depth) : m_depth(depth ? depth : 1) {}
+
+  Prefetch_queue(const Prefetch_queue &) = delete;
+  Prefetch_queue(Prefetch_queue &&) = delete;
+
+  Prefetch_queue &operator=(const Prefetch_queue &) = delete;
+  Prefetch_queue &operator=(Prefetch_queue &&) = delete;
+
+  ~Prefetch_queue() = default;
+
+  /**
+   * Adds a fetch to the queue, it's not started until start() is called.
+   */
+  void push(Fetch fetch);
+
+  /**
+   * Starts the queued fetches, as long as the limit allows it.
+   */
+  void start();
+
+  /**
+   * Reports that an item which was fetched earlier was consumed, making room
+   * for another fetch.
+   */
+  void consumed();
+
+  /**
+   * Whether all the queued fetches were started.
+   */
+  bool empty() const { return m_queue.empty(); }
+
+  /**
+   * Number of items which were fetched (or are being fetched), but were not
+   * consumed yet.
+   */
+  std::size_t in_flight() const { return m_in_flight; }
+
+ private:
+  const std::size_t m_depth;
+  std::deque<Fetch> m_queue;
+  std::size_t m_in_flight = 0;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_PREFETCH_QUEUE_H_
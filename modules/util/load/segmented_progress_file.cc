@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/segmented_progress_file.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+
+using mysqlshdk::storage::IFile;
+using mysqlshdk::storage::Mode;
+
+namespace {
+
+constexpr std::string_view k_header_op = "SEGMENTS";
+
+std::string header(uint64_t merged_segment) {
+  return "{\"op\":\"" + std::string{k_header_op} +
+         "\",\"merged\":" + std::to_string(merged_segment) + "}\n";
+}
+
+std::string read_all(IFile *file) {
+  file->open(Mode::READ);
+  auto data = mysqlshdk::storage::read_file(file);
+  file->close();
+
+  return data;
+}
+
+}  // namespace
+
+Segmented_progress_file::Segmented_progress_file(std::unique_ptr<IFile> base,
+                                                 std::size_t segment_size,
+                                                 std::size_t max_segments)
+    : m_base(std::move(base)),
+      m_directory(m_base->parent()),
+      m_segment_size(segment_size),
+      m_max_segments(std::max<std::size_t>(max_segments, 1)) {}
+
+Segmented_progress_file::~Segmented_progress_file() {
+  try {
+    if (is_open()) {
+      close();
+    }
+  } catch (const std::exception &e) {
+    log_warning("Failed to close the progress file '%s': %s",
+                full_path().masked().c_str(), e.what());
+  }
+
+  wait_for_compaction();
+}
+
+void Segmented_progress_file::open(Mode m) {
+  if (is_open()) {
+    throw std::logic_error("Segmented_progress_file::open() - already open");
+  }
+
+  switch (m) {
+    case Mode::READ:
+      load();
+
+      m_contents = m_base_data;
+
+      for (const auto &segment : m_segments) {
+        m_contents += segment.data;
+      }
+
+      m_offset = 0;
+      break;
+
+    case Mode::WRITE:
+      wait_for_compaction();
+
+      m_base_data.clear();
+      m_merged_segment = 0;
+      m_segments.clear();
+      m_current_segment = 1;
+      m_buffer.clear();
+      m_loaded = true;
+      break;
+
+    case Mode::APPEND:
+      if (!m_loaded) {
+        load();
+      }
+
+      m_buffer.clear();
+      break;
+  }
+
+  m_dirty = false;
+  m_open_mode = m;
+}
+
+void Segmented_progress_file::close() {
+  if (Mode::READ != *m_open_mode) {
+    flush();
+  }
+
+  m_open_mode.reset();
+  std::string().swap(m_contents);
+  m_offset = 0;
+}
+
+size_t Segmented_progress_file::file_size() const {
+  if (is_open() && Mode::READ == *m_open_mode) {
+    return m_contents.size();
+  }
+
+  std::lock_guard lock{m_mutex};
+  auto size = m_base_data.size() + m_buffer.size();
+
+  for (const auto &segment : m_segments) {
+    size += segment.data.size();
+  }
+
+  return size;
+}
+
+bool Segmented_progress_file::exists() const {
+  return m_base->exists() || segment_file(1)->exists();
+}
+
+off64_t Segmented_progress_file::seek(off64_t offset) {
+  m_offset = std::min(static_cast<std::size_t>(offset), m_contents.size());
+  return m_offset;
+}
+
+ssize_t Segmented_progress_file::read(void *buffer, size_t length) {
+  length = std::min(length, m_contents.size() - m_offset);
+  ::memcpy(buffer, m_contents.data() + m_offset, length);
+  m_offset += length;
+
+  return length;
+}
+
+ssize_t Segmented_progress_file::write(const void *buffer, size_t length) {
+  m_buffer.append(static_cast<const char *>(buffer), length);
+  m_dirty = true;
+
+  return length;
+}
+
+bool Segmented_progress_file::flush() {
+  if (!m_dirty) {
+    return true;
+  }
+
+  write_segment();
+  m_dirty = false;
+
+  if (m_buffer.size() >= m_segment_size) {
+    {
+      std::lock_guard lock{m_mutex};
+      m_segments.emplace_back(Segment{m_current_segment, std::move(m_buffer)});
+    }
+
+    m_buffer.clear();
+    ++m_current_segment;
+
+    maybe_compact();
+  }
+
+  return true;
+}
+
+void Segmented_progress_file::rename(const std::string &) {
+  throw std::logic_error("Segmented_progress_file::rename() - not supported");
+}
+
+void Segmented_progress_file::remove() {
+  wait_for_compaction();
+
+  if (m_base->exists()) {
+    m_base->remove();
+  }
+
+  // segments which were merged, but could not be removed after compaction
+  for (const auto number : m_stale_segments) {
+    if (const auto file = segment_file(number); file->exists()) {
+      file->remove();
+    }
+  }
+
+  for (auto number = m_merged_segment + 1; number <= m_current_segment;
+       ++number) {
+    if (const auto file = segment_file(number); file->exists()) {
+      file->remove();
+    }
+  }
+
+  m_stale_segments.clear();
+}
+
+void Segmented_progress_file::wait_for_compaction() {
+  if (m_compaction.joinable()) {
+    m_compaction.join();
+  }
+}
+
+std::unique_ptr<IFile> Segmented_progress_file::segment_file(
+    uint64_t number) const {
+  return m_directory->file(m_base->filename() + "." + std::to_string(number));
+}
+
+void Segmented_progress_file::load() {
+  wait_for_compaction();
+
+  m_base_data.clear();
+  m_merged_segment = 0;
+  m_segments.clear();
+
+  if (m_base->exists()) {
+    m_base_data = read_all(m_base.get());
+
+    if (shcore::str_beginswith(m_base_data, "{\"op\":\"" +
+                                                std::string{k_header_op} +
+                                                "\"")) {
+      const auto eol = m_base_data.find('\n');
+      const auto entry =
+          shcore::Value::parse(std::string_view{m_base_data}.substr(0, eol))
+              .as_map();
+
+      m_merged_segment = entry->get_uint("merged");
+      m_base_data.erase(0, std::string::npos == eol ? eol : eol + 1);
+    }
+  }
+
+  auto number = m_merged_segment + 1;
+
+  for (;; ++number) {
+    const auto file = segment_file(number);
+
+    if (!file->exists()) {
+      break;
+    }
+
+    m_segments.emplace_back(Segment{number, read_all(file.get())});
+  }
+
+  m_current_segment = number;
+  m_loaded = true;
+}
+
+void Segmented_progress_file::write_segment() {
+  const auto file = segment_file(m_current_segment);
+
+  file->open(Mode::WRITE);
+  file->write(m_buffer.data(), m_buffer.size());
+  file->close();
+}
+
+void Segmented_progress_file::maybe_compact() {
+  std::vector<Segment> segments;
+
+  {
+    std::lock_guard lock{m_mutex};
+
+    if (m_compacting || m_segments.size() < m_max_segments) {
+      return;
+    }
+
+    m_compacting = true;
+    segments = std::move(m_segments);
+    m_segments.clear();
+  }
+
+  // previous compaction is done at this point
+  wait_for_compaction();
+
+  m_compaction = mysqlsh::spawn_scoped_thread(
+      [this, segments = std::move(segments)]() { compact(segments); });
+}
+
+void Segmented_progress_file::compact(const std::vector<Segment> &segments) {
+  std::string data;
+
+  {
+    std::lock_guard lock{m_mutex};
+    data = m_base_data;
+  }
+
+  for (const auto &segment : segments) {
+    data += segment.data;
+  }
+
+  const auto merged = segments.back().number;
+
+  try {
+    const auto base = m_directory->file(m_base->filename());
+    const auto contents = header(merged);
+
+    base->open(Mode::WRITE);
+    base->write(contents.data(), contents.size());
+    base->write(data.data(), data.size());
+    base->close();
+
+    {
+      std::lock_guard lock{m_mutex};
+      m_base_data = std::move(data);
+      m_merged_segment = merged;
+    }
+
+    for (const auto &segment : segments) {
+      try {
+        segment_file(segment.number)->remove();
+      } catch (const std::exception &e) {
+        log_warning("Failed to remove the progress file segment %s.%" PRIu64
+                    ": %s",
+                    full_path().masked().c_str(), segment.number, e.what());
+
+        std::lock_guard lock{m_mutex};
+        m_stale_segments.emplace_back(segment.number);
+      }
+    }
+  } catch (const std::exception &e) {
+    log_warning("Failed to compact the progress file '%s': %s",
+                full_path().masked().c_str(), e.what());
+
+    // segments are going to be merged during the next compaction
+    std::lock_guard lock{m_mutex};
+    m_segments.insert(m_segments.begin(), segments.begin(), segments.end());
+  }
+
+  std::lock_guard lock{m_mutex};
+  m_compacting = false;
+}
+
+}  // namespace mysqlsh
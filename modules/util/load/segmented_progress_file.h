@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_SEGMENTED_PROGRESS_FILE_H_
+#define MODULES_UTIL_LOAD_SEGMENTED_PROGRESS_FILE_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+
+/**
+ * Append-only file meant for storage backends which do not support appending
+ * nor flushing partially written contents (i.e. object storage services).
+ *
+ * Data is written to small numbered segments (<name>.1, <name>.2, ...), each
+ * flush uploads just the current segment. Once enough segments are written,
+ * they are merged into the base file (<name>) in a background thread. Base
+ * file starts with a header which holds the number of the last merged segment,
+ * so an interrupted compaction does not duplicate the data.
+ *
+ * Reading the file merges the base file and all the segments which follow it.
+ */
+class Segmented_progress_file final : public mysqlshdk::storage::IFile {
+ public:
+  Segmented_progress_file() = delete;
+
+  /**
+   * Creates the segmented file.
+   *
+   * @param base Handle of the base file, segments are created in the same
+   *        directory.
+   * @param segment_size Minimum size of a segment, a new one is started once
+   *        this size is exceeded.
+   * @param max_segments Number of segments which triggers the compaction.
+   */
+  explicit Segmented_progress_file(
+      std::unique_ptr<mysqlshdk::storage::IFile> base,
+      std::size_t segment_size = 32 * 1024, std::size_t max_segments = 64);
+
+  Segmented_progress_file(const Segmented_progress_file &) = delete;
+  Segmented_progress_file(Segmented_progress_file &&) = delete;
+
+  Segmented_progress_file &operator=(const Segmented_progress_file &) = delete;
+  Segmented_progress_file &operator=(Segmented_progress_file &&) = delete;
+
+  ~Segmented_progress_file() override;
+
+  /**
+   * READ - merges the base file and the segments, reads the result.
+   * WRITE - starts a new file, existing file needs to be removed first.
+   * APPEND - writes data after the existing segments.
+   */
+  void open(mysqlshdk::storage::Mode m) override;
+
+  bool is_open() const override { return m_open_mode.has_value(); }
+
+  int error() const override { return 0; }
+
+  void close() override;
+
+  size_t file_size() const override;
+
+  mysqlshdk::Masked_string full_path() const override {
+    return m_base->full_path();
+  }
+
+  std::string filename() const override { return m_base->filename(); }
+
+  bool exists() const override;
+
+  std::unique_ptr<mysqlshdk::storage::IDirectory> parent() const override {
+    return m_base->parent();
+  }
+
+  off64_t seek(off64_t offset) override;
+
+  off64_t tell() const override { return m_offset; }
+
+  ssize_t read(void *buffer, size_t length) override;
+
+  ssize_t write(const void *buffer, size_t length) override;
+
+  /**
+   * Uploads the current segment.
+   */
+  bool flush() override;
+
+  bool is_local() const override { return m_base->is_local(); }
+
+  void rename(const std::string &) override;
+
+  /**
+   * Removes the base file and all the known segments.
+   */
+  void remove() override;
+
+  /**
+   * Number of the segment which is currently written to.
+   */
+  uint64_t current_segment() const { return m_current_segment; }
+
+  /**
+   * Waits for the background compaction to finish.
+   */
+  void wait_for_compaction();
+
+ private:
+  struct Segment {
+    uint64_t number;
+    std::string data;
+  };
+
+  std::unique_ptr<mysqlshdk::storage::IFile> segment_file(
+      uint64_t number) const;
+
+  void load();
+
+  void write_segment();
+
+  void maybe_compact();
+
+  void compact(const std::vector<Segment> &segments);
+
+  std::unique_ptr<mysqlshdk::storage::IFile> m_base;
+  std::unique_ptr<mysqlshdk::storage::IDirectory> m_directory;
+  const std::size_t m_segment_size;
+  const std::size_t m_max_segments;
+
+  std::optional<mysqlshdk::storage::Mode> m_open_mode;
+
+  // merged contents, used in READ mode
+  std::string m_contents;
+  std::size_t m_offset = 0;
+
+  // data which was merged into the base file, guarded by m_mutex
+  std::string m_base_data;
+  // last segment merged into the base file, guarded by m_mutex
+  uint64_t m_merged_segment = 0;
+
+  // segments which are complete, but were not merged yet, guarded by m_mutex
+  std::vector<Segment> m_segments;
+  // segments which were merged, but could not be removed, guarded by m_mutex
+  std::vector<uint64_t> m_stale_segments;
+  uint64_t m_current_segment = 1;
+  // contents of the current segment
+  std::string m_buffer;
+  bool m_dirty = false;
+  // whether the existing data was loaded
+  bool m_loaded = false;
+
+  std::thread m_compaction;
+  // guarded by m_mutex
+  bool m_compacting = false;
+  mutable std::mutex m_mutex;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_SEGMENTED_PROGRESS_FILE_H_
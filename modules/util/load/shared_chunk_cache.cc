@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/shared_chunk_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlsh {
+
+using mysqlshdk::storage::IFile;
+using mysqlshdk::storage::Mode;
+
+namespace {
+
+constexpr std::size_t k_read_size = 1024 * 1024;
+
+std::string read_all(IFile *file, std::size_t size) {
+  std::string data;
+  data.resize(size);
+
+  std::size_t offset = 0;
+
+  file->open(Mode::READ);
+
+  while (true) {
+    if (offset == data.size()) {
+      // expected size was reached, make sure there's nothing more to read
+      data.resize(offset + k_read_size);
+    }
+
+    const auto bytes = file->read(data.data() + offset, data.size() - offset);
+
+    if (bytes < 0) {
+      throw std::runtime_error("Failed to read " +
+                               file->full_path().masked());
+    }
+
+    if (0 == bytes) {
+      break;
+    }
+
+    offset += bytes;
+  }
+
+  file->close();
+
+  data.resize(offset);
+  data.shrink_to_fit();
+
+  return data;
+}
+
+}  // namespace
+
+struct Shared_chunk_cache::Entry {
+  enum class Status {
+    READING,
+    READY,
+    FAILED,
+  };
+
+  std::string name;
+  Status status = Status::READING;
+  std::string data;
+  // number of handles which were provided
+  std::size_t handles = 0;
+  // number of handles which were closed
+  std::size_t closed = 0;
+};
+
+class Shared_chunk_cache::Cached_file final : public IFile {
+ public:
+  Cached_file(Shared_chunk_cache *cache, std::shared_ptr<Entry> entry,
+              std::unique_ptr<IFile> file)
+      : m_cache(cache), m_entry(std::move(entry)), m_file(std::move(file)) {}
+
+  Cached_file(const Cached_file &) = delete;
+  Cached_file(Cached_file &&) = delete;
+
+  Cached_file &operator=(const Cached_file &) = delete;
+  Cached_file &operator=(Cached_file &&) = delete;
+
+  ~Cached_file() override { done(); }
+
+  void open(Mode m) override {
+    if (Mode::READ != m) {
+      throw std::invalid_argument("Cached_file: only READ mode is supported");
+    }
+
+    m_offset = 0;
+    m_is_open = true;
+  }
+
+  bool is_open() const override { return m_is_open; }
+
+  int error() const override { return 0; }
+
+  void close() override {
+    m_is_open = false;
+    done();
+  }
+
+  size_t file_size() const override { return m_entry->data.size(); }
+
+  mysqlshdk::Masked_string full_path() const override {
+    return m_file->full_path();
+  }
+
+  std::string filename() const override { return m_file->filename(); }
+
+  bool exists() const override { return true; }
+
+  std::unique_ptr<mysqlshdk::storage::IDirectory> parent() const override {
+    return m_file->parent();
+  }
+
+  off64_t seek(off64_t offset) override {
+    m_offset = std::min(static_cast<std::size_t>(offset), m_entry->data.size());
+    return m_offset;
+  }
+
+  off64_t tell() const override { return m_offset; }
+
+  ssize_t read(void *buffer, size_t length) override {
+    length = std::min(length, m_entry->data.size() - m_offset);
+    ::memcpy(buffer, m_entry->data.data() + m_offset, length);
+    m_offset += length;
+
+    return length;
+  }
+
+  ssize_t write(const void *, size_t) override {
+    throw std::logic_error("Cached_file::write() - not supported");
+  }
+
+  bool flush() override {
+    throw std::logic_error("Cached_file::flush() - not supported");
+  }
+
+  bool is_local() const override { return true; }
+
+  void rename(const std::string &) override {
+    throw std::logic_error("Cached_file::rename() - not supported");
+  }
+
+  void remove() override {
+    throw std::logic_error("Cached_file::remove() - not supported");
+  }
+
+ private:
+  void done() {
+    if (!m_done) {
+      m_done = true;
+      m_cache->consumed(m_entry->name);
+    }
+  }
+
+  Shared_chunk_cache *m_cache;
+  std::shared_ptr<Entry> m_entry;
+  std::unique_ptr<IFile> m_file;
+  bool m_is_open = false;
+  bool m_done = false;
+  std::size_t m_offset = 0;
+};
+
+Shared_chunk_cache::Shared_chunk_cache(std::size_t consumers,
+                                       std::size_t memory)
+    : m_max_memory(memory), m_consumers(consumers) {
+  if (0 == consumers) {
+    throw std::invalid_argument(
+        "Shared_chunk_cache: need at least one consumer");
+  }
+}
+
+std::unique_ptr<IFile> Shared_chunk_cache::file(
+    std::unique_ptr<IFile> *file, std::size_t size,
+    mysqlshdk::storage::Compression compression,
+    const mysqlshdk::storage::Compression_options &options) {
+  auto name = (*file)->filename();
+  std::shared_ptr<Entry> entry;
+
+  {
+    std::unique_lock lock{m_mutex};
+
+    if (m_released.count(name)) {
+      return nullptr;
+    }
+
+    if (const auto it = m_entries.find(name); m_entries.end() != it) {
+      entry = it->second;
+
+      m_cv.wait(lock,
+                [&entry]() { return Entry::Status::READING != entry->status; });
+
+      if (Entry::Status::READY != entry->status) {
+        return nullptr;
+      }
+
+      ++entry->handles;
+      m_bytes_reused += entry->data.size();
+
+      return std::make_unique<Cached_file>(this, std::move(entry),
+                                           std::move(*file));
+    }
+
+    if (1 == m_consumers || m_memory_used + size > m_max_memory) {
+      return nullptr;
+    }
+
+    entry = std::make_shared<Entry>();
+    entry->name = name;
+
+    m_memory_used += size;
+    m_peak_memory = std::max(m_peak_memory, m_memory_used);
+    m_tracked_memory.resize(m_memory_used);
+    m_entries.emplace(std::move(name), entry);
+  }
+
+  // this caller is the first one, it reads the file on behalf of all loaders
+  auto data_file =
+      mysqlshdk::storage::make_file(std::move(*file), compression, options);
+  std::string data;
+
+  try {
+    data = read_all(data_file.get(), size);
+  } catch (...) {
+    {
+      std::lock_guard lock{m_mutex};
+
+      entry->status = Entry::Status::FAILED;
+      m_memory_used -= size;
+      m_tracked_memory.resize(m_memory_used);
+      m_released.emplace(entry->name);
+      m_entries.erase(entry->name);
+    }
+
+    m_cv.notify_all();
+    throw;
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
+
+    // expected size may be inaccurate
+    m_memory_used = m_memory_used - size + data.size();
+    m_peak_memory = std::max(m_peak_memory, m_memory_used);
+    m_tracked_memory.resize(m_memory_used);
+
+    entry->data = std::move(data);
+    entry->status = Entry::Status::READY;
+    ++entry->handles;
+  }
+
+  m_cv.notify_all();
+
+  log_debug("Shared %s with %zu loader(s)", entry->name.c_str(),
+            m_consumers - 1);
+
+  return std::make_unique<Cached_file>(this, std::move(entry),
+                                       std::move(data_file));
+}
+
+void Shared_chunk_cache::consumed(const std::string &name) {
+  std::lock_guard lock{m_mutex};
+
+  if (const auto it = m_entries.find(name); m_entries.end() != it) {
+    ++it->second->closed;
+    release(name);
+  }
+}
+
+void Shared_chunk_cache::consumer_finished() {
+  std::lock_guard lock{m_mutex};
+
+  if (m_consumers > 0) {
+    --m_consumers;
+  }
+
+  for (auto it = m_entries.begin(); it != m_entries.end();) {
+    // release() removes the entry
+    const auto &name = (it++)->first;
+    release(name);
+  }
+}
+
+void Shared_chunk_cache::release(const std::string &name) {
+  // mutex is held by the caller
+  const auto it = m_entries.find(name);
+  const auto &entry = it->second;
+
+  if (Entry::Status::READY != entry->status ||
+      entry->handles != entry->closed || entry->handles < m_consumers) {
+    return;
+  }
+
+  m_memory_used -= entry->data.size();
+  m_tracked_memory.resize(m_memory_used);
+  std::string().swap(entry->data);
+
+  m_released.emplace(name);
+  m_entries.erase(it);
+}
+
+std::size_t Shared_chunk_cache::memory_used() const {
+  std::lock_guard lock{m_mutex};
+  return m_memory_used;
+}
+
+std::size_t Shared_chunk_cache::peak_memory() const {
+  std::lock_guard lock{m_mutex};
+  return m_peak_memory;
+}
+
+std::size_t Shared_chunk_cache::bytes_reused() const {
+  std::lock_guard lock{m_mutex};
+  return m_bytes_reused;
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_SHARED_CHUNK_CACHE_H_
+#define MODULES_UTIL_LOAD_SHARED_CHUNK_CACHE_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/memory_stats.h"
+
+namespace mysqlsh {
+
+/**
+ * Holds decompressed contents of the data files of a dump which is loaded
+ * into several instances at the same time, so that each file is read and
+ * decompressed only once.
+ *
+ * The first loader which asks for a file reads and decompresses it, the
+ * remaining loaders wait for it to finish and then read the contents from
+ * memory. Memory is released once all the loaders have read the file. Files
+ * which do not fit in the memory limit are read directly by each loader.
+ */
+class Shared_chunk_cache final {
+ public:
+  Shared_chunk_cache() = delete;
+
+  /**
+   * Creates the cache.
+   *
+   * @param consumers Number of loaders which read the files.
+   * @param memory Maximum amount of memory held by the decompressed files.
+   */
+  Shared_chunk_cache(std::size_t consumers, std::size_t memory);
+
+  Shared_chunk_cache(const Shared_chunk_cache &) = delete;
+  Shared_chunk_cache(Shared_chunk_cache &&) = delete;
+
+  Shared_chunk_cache &operator=(const Shared_chunk_cache &) = delete;
+  Shared_chunk_cache &operator=(Shared_chunk_cache &&) = delete;
+
+  ~Shared_chunk_cache() = default;
+
+  /**
+   * Provides the decompressed contents of the given data file.
+   *
+   * If a handle is returned, it takes the ownership of the file, the returned
+   * handle is not compressed. Otherwise, the file is not modified and caller
+   * should read it directly. Exception is thrown if this caller was the one
+   * to read the file, and reading has failed.
+   *
+   * @param file Data file, as read from the dump.
+   * @param size Size of the decompressed data.
+   * @param compression Compression of the data file.
+   * @param options Compression options of the data file.
+   *
+   * @returns file handle, or nullptr if contents are not cached
+   */
+  std::unique_ptr<mysqlshdk::storage::IFile> file(
+      std::unique_ptr<mysqlshdk::storage::IFile> *file, std::size_t size,
+      mysqlshdk::storage::Compression compression,
+      const mysqlshdk::storage::Compression_options &options);
+
+  /**
+   * Called once a loader is finished (either successfully or not), the files
+   * which were read by all the remaining loaders are released.
+   */
+  void consumer_finished();
+
+  /**
+   * Memory currently held by the decompressed files.
+   */
+  std::size_t memory_used() const;
+
+  /**
+   * Maximum amount of memory which was held at the same time.
+   */
+  std::size_t peak_memory() const;
+
+  /**
+   * Number of bytes which were served from memory, instead of being read
+   * again.
+   */
+  std::size_t bytes_reused() const;
+
+ private:
+  struct Entry;
+
+  class Cached_file;
+
+  void release(const std::string &name);
+
+  void consumed(const std::string &name);
+
+  const std::size_t m_max_memory;
+  std::size_t m_consumers;
+  std::size_t m_memory_used = 0;
+  std::size_t m_peak_memory = 0;
+  std::size_t m_bytes_reused = 0;
+  shcore::Tracked_memory m_tracked_memory{shcore::Memory_tag::LOAD};
+
+  std::unordered_map<std::string, std::shared_ptr<Entry>> m_entries;
+  // files which were already released, they are not cached again
+  std::unordered_set<std::string> m_released;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_SHARED_CHUNK_CACHE_H_
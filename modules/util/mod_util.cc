@@ -29,6 +29,9 @@
 #include <vector>
 #include "modules/mod_utils.h"
 #include "modules/mysqlxtest_utils.h"
+#include "modules/util/binlog/dump_binlogs.h"
+#include "modules/util/binlog/load_binlogs.h"
+#include "modules/util/common/resource_governor.h"
 #include "modules/util/copy/copy_operation.h"
 #include "modules/util/dump/dump_instance.h"
 #include "modules/util/dump/dump_instance_options.h"
@@ -43,6 +46,7 @@
 #include "modules/util/json_importer.h"
 #include "modules/util/load/dump_loader.h"
 #include "modules/util/load/load_dump_options.h"
+#include "modules/util/load/load_dump_to_instances.h"
 #include "mysqlshdk/include/scripting/shexcept.h"
 #include "mysqlshdk/include/shellcore/base_session.h"
 #include "mysqlshdk/include/shellcore/console.h"
@@ -85,6 +89,8 @@ Util::Util(shcore::IShell_core *owner)
   expose("exportTable", &Util::export_table, "table", "outputUrl", "?options")
       ->cli();
   expose("loadDump", &Util::load_dump, "url", "?options")->cli();
+  expose("loadDumpToInstances", &Util::load_dump_to_instances, "url",
+         "instances", "?options");
   expose("copyInstance", &Util::copy_instance, "connectionData", "?options")
       ->cli();
   expose("copySchemas", &Util::copy_schemas, "schemas", "connectionData",
@@ -93,6 +99,10 @@ Util::Util(shcore::IShell_core *owner)
   expose("copyTables", &Util::copy_tables, "schema", "tables", "connectionData",
          "?options")
       ->cli();
+  expose("compareTables", &Util::compare_tables, "schema", "tables",
+         "connectionData", "?options");
+  expose("dumpBinlogs", &Util::dump_binlogs, "outputUrl", "?options")->cli();
+  expose("loadBinlogs", &Util::load_binlogs, "url", "?options")->cli();
 }
 
 REGISTER_HELP_FUNCTION(checkForServerUpgrade, util);
@@ -122,9 +132,13 @@ REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL4,
               "(default=" MYSH_VERSION ")");
 
 REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL5,
+              "@li threads - number of concurrent sessions used to execute the "
+              "checks (default=1).");
+
+REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL6,
               "@li password - password for connection.");
 
-REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL6, "${TOPIC_CONNECTION_DATA}");
+REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL7, "${TOPIC_CONNECTION_DATA}");
 
 /**
  * \ingroup util
@@ -142,6 +156,7 @@ REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL6, "${TOPIC_CONNECTION_DATA}");
  * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL3)
  * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL4)
  * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL5)
+ * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL6)
  *
  * \copydoc connection_options
  *
@@ -162,6 +177,11 @@ None Util::check_for_server_upgrade(dict options);
 void Util::check_for_server_upgrade(
     const std::optional<mysqlshdk::db::Connection_options> &connection_options,
     const shcore::Option_pack_ref<Upgrade_check_options> &options) {
+  if (0 == options->threads) {
+    throw shcore::Exception::argument_error(
+        "The value of 'threads' option must be greater than 0.");
+  }
+
   mysqlshdk::db::Connection_options connection;
 
   if (connection_options.has_value()) {
@@ -230,61 +250,66 @@ REGISTER_HELP(UTIL_IMPORTJSON_DETAIL5,
               "@li tableColumn: string (default: \"doc\") - name of column in "
               "target table where the imported JSON documents will be stored.");
 REGISTER_HELP(UTIL_IMPORTJSON_DETAIL6,
+              "@li threads: int (default: 1) - number of threads, each one "
+              "using its own X Protocol session, used to insert the "
+              "documents. If greater than 1, documents are not guaranteed to "
+              "be imported in the order they appear in the file.");
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL7,
               "@li convertBsonTypes: bool (default: false) - enables the BSON "
               "data type conversion.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL7,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL8,
               "@li convertBsonOid: bool (default: the value of "
               "convertBsonTypes) - enables conversion of the BSON ObjectId "
               "values.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL8,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL9,
               "@li extractOidTime: string (default: empty) - creates a new "
               "field based on the ObjectID timestamp. Only valid if "
               "convertBsonOid is enabled.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL9,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL10,
               "The following options are valid only when convertBsonTypes is "
               "enabled. They are all boolean flags. ignoreRegexOptions is "
               "enabled by default, rest are disabled by default.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL10,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL11,
               "@li ignoreDate: disables conversion of BSON Date values");
 REGISTER_HELP(
-    UTIL_IMPORTJSON_DETAIL11,
+    UTIL_IMPORTJSON_DETAIL12,
     "@li ignoreTimestamp: disables conversion of BSON Timestamp values");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL12,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL13,
               "@li ignoreRegex: disables conversion of BSON Regex values.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL15,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL16,
               "@li ignoreRegexOptions: causes regex options to be ignored when "
               "processing a Regex BSON value. This option is only valid if "
               "ignoreRegex is disabled.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL13,
-              "@li ignoreBinary: disables conversion of BSON BinData values.");
 REGISTER_HELP(UTIL_IMPORTJSON_DETAIL14,
+              "@li ignoreBinary: disables conversion of BSON BinData values.");
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL15,
               "@li decimalAsDouble: causes BSON Decimal values to be imported "
               "as double values.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL16,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL17,
               "If the schema is not provided, an active schema on the global "
               "session, if set, will be used.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL17,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL18,
               "The collection and the table options cannot be combined. If "
               "they are not provided, the basename of the file without "
               "extension will be used as target collection name.");
 
 REGISTER_HELP(
-    UTIL_IMPORTJSON_DETAIL18,
+    UTIL_IMPORTJSON_DETAIL19,
     "If the target collection or table does not exist, they are created, "
     "otherwise the data is inserted into the existing collection or table.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL19,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL20,
               "The tableColumn implies the use of the table option and cannot "
               "be combined "
               "with the collection option.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL20, "<b>BSON Data Type Processing.</b>");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL21,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL21, "<b>BSON Data Type Processing.</b>");
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL22,
               "If only convertBsonOid is enabled, no conversion will be done "
               "on the rest of the BSON Data Types.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL22,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL23,
               "To use extractOidTime, it should be set to a name which will "
               "be used to insert an additional field into the main document. "
               "The value of the new field will be the timestamp obtained from "
@@ -292,12 +317,12 @@ REGISTER_HELP(UTIL_IMPORTJSON_DETAIL22,
               "ObjectID value associated to the '_id' field of the main "
               "document.");
 REGISTER_HELP(
-    UTIL_IMPORTJSON_DETAIL23,
+    UTIL_IMPORTJSON_DETAIL24,
     "NumberLong and NumberInt values will be converted to integer values.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL24,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL25,
               "NumberDecimal values are imported as strings, unless "
               "decimalAsDouble is enabled.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL25,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL26,
               "Regex values will be converted to strings containing the "
               "regular expression. The regular expression options are ignored "
               "unless ignoreRegexOptions is disabled. When ignoreRegexOptions "
@@ -335,6 +360,7 @@ const shcore::Option_pack_def<Import_json_options>
           .optional("collection", &Import_json_options::collection)
           .optional("table", &Import_json_options::table)
           .optional("tableColumn", &Import_json_options::table_column)
+          .optional("threads", &Import_json_options::threads)
           .include(&Import_json_options::doc_reader);
 
   return opts;
@@ -358,15 +384,14 @@ const shcore::Option_pack_def<Import_json_options>
  * $(UTIL_IMPORTJSON_DETAIL6)
  * $(UTIL_IMPORTJSON_DETAIL7)
  * $(UTIL_IMPORTJSON_DETAIL8)
- *
  * $(UTIL_IMPORTJSON_DETAIL9)
+ *
  * $(UTIL_IMPORTJSON_DETAIL10)
  * $(UTIL_IMPORTJSON_DETAIL11)
  * $(UTIL_IMPORTJSON_DETAIL12)
  * $(UTIL_IMPORTJSON_DETAIL13)
  * $(UTIL_IMPORTJSON_DETAIL14)
  * $(UTIL_IMPORTJSON_DETAIL15)
- *
  * $(UTIL_IMPORTJSON_DETAIL16)
  *
  * $(UTIL_IMPORTJSON_DETAIL17)
@@ -387,6 +412,8 @@ const shcore::Option_pack_def<Import_json_options>
  *
  * $(UTIL_IMPORTJSON_DETAIL25)
  *
+ * $(UTIL_IMPORTJSON_DETAIL26)
+ *
  * $(UTIL_IMPORTJSON_THROWS)
  * $(UTIL_IMPORTJSON_THROWS1)
  * $(UTIL_IMPORTJSON_THROWS2)
@@ -429,15 +456,24 @@ void Util::import_json(
   Connection_options connection_options =
       shell_session->get_connection_options();
 
-  std::shared_ptr<mysqlshdk::db::mysqlx::Session> xsession =
-      mysqlshdk::db::mysqlx::Session::create();
-
-  if (current_shell_options()->get().trace_protocol) {
-    xsession->enable_protocol_trace(true);
+  if (0 == options->threads) {
+    throw std::invalid_argument(
+        "The value of 'threads' option must be greater than 0.");
   }
-  xsession->connect(connection_options);
 
-  Prepare_json_import prepare{xsession};
+  const auto create_session = [&connection_options]() {
+    std::shared_ptr<mysqlshdk::db::mysqlx::Session> xsession =
+        mysqlshdk::db::mysqlx::Session::create();
+
+    if (current_shell_options()->get().trace_protocol) {
+      xsession->enable_protocol_trace(true);
+    }
+    xsession->connect(connection_options);
+
+    return xsession;
+  };
+
+  Prepare_json_import prepare{create_session()};
 
   if (!options->schema.empty()) {
     prepare.schema(options->schema);
@@ -479,6 +515,7 @@ void Util::import_json(
   importer.set_print_callback([](const std::string &msg) -> void {
     mysqlsh::current_console()->print(msg);
   });
+  importer.set_threads(options->threads, create_session);
 
   try {
     importer.load_from(options->doc_reader);
@@ -705,6 +742,17 @@ Supported transport backends are: %file://, %http://, %https://.
 If the scheme part of a filename is omitted, then %file:// transport backend
 will be chosen.
 
+When multiple files are imported, local uncompressed files which are bigger
+than 50M are split into chunks, just like a single file would be. Biggest
+units of work are loaded first, so that all threads are kept busy until the
+end of the import.
+
+If the path is set to "-", data is read from the standard input (i.e.
+zstdcat data.tsv.zst | mysqlsh -- util import-table - --table=t). The stream
+is split into chunks while it is being read, chunks are loaded in parallel by
+all the threads. The <b>table</b> option is required in this case, the
+standard input cannot be combined with other files.
+
 Supported filename formats:
 ${IMPORT_EXPORT_URL_DETAIL}
 
@@ -761,6 +809,10 @@ maxRate in bytes per second per thread.
 maxRate="0" - no limit. Unit suffixes, k - for Kilobytes (n * 1'000 bytes),
 M - for Megabytes (n * 1'000'000 bytes), G - for Gigabytes (n * 1'000'000'000
 bytes), maxRate="2k" - limit to 2 kilobytes per second.
+@li <b>maxTotalRate</b>: string (default: "0") - Limit the combined data send
+throughput of all threads to maxTotalRate in bytes per second, regardless of
+the number of threads. Can be used together with <b>maxRate</b>. Supports the
+same unit suffixes as <b>maxRate</b>. maxTotalRate="0" - no limit.
 @li <b>showProgress</b>: bool (default: true if stdout is a tty, false
 otherwise) - Enable or disable import progress information.
 @li <b>skipRows</b>: int (default: 0) - Skip first N physical lines from each of
@@ -770,7 +822,7 @@ containing column names.
 that matches specific data file format. Can be used as base dialect and
 customized with fieldsTerminatedBy, fieldsEnclosedBy, fieldsOptionallyEnclosed,
 fieldsEscapedBy and linesTerminatedBy options. Must be one of the following
-values: default, csv, tsv, json or csv-unix.
+values: default, csv, tsv, json, csv-unix, parquet or arrow.
 @li <b>decodeColumns</b>: map (default: not set) - a map between columns names
 and SQL expressions to be applied on the loaded
 data. Column value captured in 'columns' by integer is available as user
@@ -782,6 +834,18 @@ the server will use the character set indicated by the character_set_database
 system variable to interpret the information in the file.
 @li <b>sessionInitSql</b>: list of strings (default: []) - execute the given
 list of SQL statements in each session about to load data.
+@li <b>fallbackToInsert</b>: bool (default: false) - If the 'local_infile'
+global system variable is set to OFF in the target server, load the data using
+multi-row INSERT statements instead of failing. This is slower than LOAD DATA
+LOCAL INFILE. User variable bindings in the <b>columns</b> option and custom
+SQL expressions in the <b>decodeColumns</b> option are not supported in this
+mode.
+@li <b>deferTableIndexes</b>: "off", "fulltext", "all" (default: off) - If
+"all", secondary indexes of the target table, except for the UNIQUE ones, are
+dropped before the import and recreated once all the data is loaded, which in
+many cases can reduce import times. If the table has foreign keys, only the
+full-text and spatial indexes are deferred. If "fulltext", only full-text
+indexes will be deferred.
 
 ${IMPORT_EXPORT_OCI_OPTIONS_DETAIL}
 
@@ -810,6 +874,14 @@ and linesTerminatedBy (LT) in following manner:
 (LT=@<LF@>, FESC=@<empty@>, FT=@<LF@>, FE=@<empty@>, FOE=false)
 @li csv-unix: fully quoted, comma-separated, lf line endings.
 (LT=@<LF@>, FESC='\', FT=",", FE='&quot;', FOE=false)
+@li parquet: Apache Parquet files with a flat schema.
+@li arrow: Apache Arrow IPC (Feather V2) files with a flat schema.
+
+The <b>parquet</b> and <b>arrow</b> dialects cannot be customized with the field
+and line options, and cannot be used together with the <b>skipRows</b> option or
+to read from the standard input. If <b>columns</b> are not set, names of the
+columns stored in the first file are used. Each row group of a Parquet file and
+each record batch of an Arrow file is loaded as a separate chunk, in parallel.
 
 If the <b>schema</b> is not provided, an active schema on the global session, if
 set, will be used.
@@ -820,6 +892,12 @@ set <b>fieldsOptionallyEnclosed</b> to true.
 If you specify one separator that is the same as or a prefix of another, LOAD
 DATA INFILE cannot interpret the input properly.
 
+A single zstd compressed file is decompressed using multiple threads if it
+consists of multiple independent frames, i.e. it was written in the zstd
+seekable format or by a parallel compressor which writes independent frames.
+Frames of a remote file are detected only when the zstd seekable format is
+used. Other compressed files are decompressed by a single thread.
+
 Connection options set in the global session, such as compression, ssl-mode, etc.
 are used in parallel connections.
 
@@ -959,6 +1037,15 @@ void Util::import_table_files(
 
   opt.validate();
 
+  const auto resources = [&opt]() {
+    const auto &total = opt.total_rate_limit();
+    return Resource_governor::instance().acquire(
+        "util.importTable()", opt.threads_size(), total ? total->limit() : 0);
+  }();
+
+  opt.set_threads_size(static_cast<int64_t>(resources->threads()));
+  opt.set_total_rate_limit(resources->rate_limit());
+
   volatile bool interrupt = false;
   shcore::Interrupt_handler intr_handler([&interrupt]() -> bool {
     mysqlsh::current_console()->print_note(
@@ -1025,6 +1112,9 @@ the AWS settings stored in the <b>credentials</b> and <b>config</b> files
 created with the ociParManifest option
 @li <b>PAR to the dump location</b> - to load a dump from OCI Object Storage
 using a single PAR
+@li <b>stream://path</b> - to load a dump from a stream archive read from the
+given local file, pipe or FIFO, <b>stream://-</b> reads it from the standard
+input
 
 <<<loadDump>>>() will load a dump from the specified path. It transparently
 handles compressed files and directly streams data when loading from remote
@@ -1032,6 +1122,13 @@ storage (currently HTTP, OCI Object Storage, AWS S3 Object Storage and Azure
 Containers). If the 'waitDumpTimeout' option is set, it will load a dump
 on-the-fly, loading table data chunks as the dumper produces them.
 
+When loading a stream archive, files are received in the order in which they
+were written by the dumper and are kept in memory until they are loaded, data
+files are released once they are loaded. Files which do not fit in 512MB of
+memory are moved to a scratch directory in the system temporary directory. The
+'waitDumpTimeout' option should be set, so that the dump is loaded while it's
+being received.
+
 Table data will be loaded in parallel using the configured number of threads
 (4 by default). Multiple threads per table can be used if the dump was created
 with table chunking enabled. Data loads are scheduled across threads in a way
@@ -1084,16 +1181,30 @@ times that value in case on a non-local dump.
 @li <b>characterSet</b>: string (default taken from dump) - Overrides
 the character set to be used for loading dump data. By default, the same
 character set used for dumping will be used (utf8mb4 if not set on dump).
+@li <b>chunkWindow</b>: int (default: not set) - If set, a chunk of a table is
+loaded only if it is less than the given number of chunks past the oldest chunk
+of that table which is still being loaded. Chunks are dumped and loaded in the
+primary key order, limiting the window keeps the concurrent inserts close to
+each other in the clustered index, which reduces the number of page splits. Must
+be a positive integer, setting it to 1 loads chunks of each table one at a time.
 @li <b>checksum</b>: bool (default: false) - Verify tables against checksums
 that were computed during dump.
 @li <b>createInvisiblePKs</b>: bool (default taken from dump) - Automatically
 create an invisible Primary Key for each table which does not have one. By
 default, set to true if dump was created with <b>create_invisible_pks</b>
 compatibility option, false otherwise. Requires server 8.0.24 or newer.
+@li <b>deferTableAnalysis</b>: bool (default: false) - If true, tables are
+analyzed once all data and indexes are loaded and the database is ready to be
+used, using a single thread. Progress of the analysis is stored in the progress
+file, an interrupted analysis is resumed by the next load. Has no effect if
+<b>analyzeTables</b> is set to "off".
 @li <b>deferTableIndexes</b>: "off", "fulltext", "all" (default: fulltext) -
 If "all", creation of "all" indexes except PRIMARY is deferred until after
 table data is loaded, which in many cases can reduce load times. If "fulltext",
 only full-text indexes will be deferred.
+@li <b>dropPageCache</b>: bool (default: false) - Advise the operating system
+to evict the data files from the page cache once they are read, when loading a
+dump from a local directory.
 @li <b>dryRun</b>: bool (default: false) - Scans the dump and prints everything
 that would be performed, without actually doing so.
 @li <b>excludeEvents</b>: array of strings (default not set) - Skip loading
@@ -1115,6 +1226,15 @@ specified triggers from the dump. Strings are in format <b>schema</b>.<b>table</
 specified users from the dump. Each user is in the format of
 'user_name'[@'host']. If the host is not specified, all the accounts with the
 given user name are excluded.
+@li <b>fallbackToInsert</b>: bool (default: false) - If the 'local_infile'
+global system variable is set to OFF in the target server, load the data using
+multi-row INSERT statements instead of failing. This is slower than LOAD DATA
+LOCAL INFILE.
+@li <b>fastLoad</b>: bool (default: false) - Disables the InnoDB redo log and
+the doublewrite buffer for the duration of the load, both are restored once the
+load completes or is aborted. The target instance must not have any other client
+connections and must not be a replication source. Requires MySQL 8.0.21 or
+newer, the doublewrite buffer is changed only on MySQL 8.0.30 or newer.
 @li <b>handleGrantErrors</b>: "abort", "drop_account", "ignore" (default: abort)
 - Specifies action to be performed in case of errors related to the GRANT/REVOKE
 statements, "abort": throws an error and aborts the load, "drop_account":
@@ -1151,6 +1271,14 @@ default, all triggers are included.
 specified users from the dump. Each user is in the format of
 'user_name'[@'host']. If the host is not specified, all the accounts with the
 given user name are included. By default, all users are included.
+@li <b>indexBufferSize</b>: string (default not set) - Sets the
+innodb_ddl_buffer_size session variable used when recreating the deferred
+indexes. Supports unit suffixes: k (kilobytes), M (Megabytes), G (Gigabytes).
+Requires MySQL 8.0.27 or newer.
+@li <b>indexThreads</b>: int (default: half of <b>threads</b>, rounded up) -
+Maximum number of threads used to recreate the deferred indexes of tables which
+are fully loaded, while data of other tables is still being loaded. Setting it
+to 0 postpones recreation of indexes until all data is loaded.
 @li <b>loadData</b>: bool (default: true) - Loads table data from the dump.
 @li <b>loadDdl</b>: bool (default: true) - Executes DDL/SQL scripts in the
 dump.
@@ -1166,8 +1294,44 @@ LOAD DATA statement. Supports unit suffixes: k (kilobytes), M (Megabytes), G
 (Gigabytes). Minimum value: 4096. If this option is not specified explicitly,
 the value of the <b>bytesPerChunk</b> dump option is used, but only in case of
 the files with data size greater than <b>1.5 * bytesPerChunk</b>.
+@li <b>maxMemory</b>: string (default: not set) - Maximum amount of memory
+held by the data buffers of the load operation: prefetched data files,
+decompressed data and transaction buffers of the threads which load the data.
+Threads wait for the memory to become available, prefetching and decompression
+of the data ahead of the threads are skipped if there's not enough memory.
+Supports unit suffixes: k (kilobytes), M (Megabytes), G (Gigabytes). Setting it
+to 0 disables the limit.
+@li <b>maxTotalRate</b>: string (default: not set) - Limit the combined data
+throughput of all threads which load the data, measured in bytes per second,
+regardless of the number of threads. Supports unit suffixes: k (kilobytes), M
+(Megabytes), G (Gigabytes). Setting it to 0 disables the limit.
+@li <b>sessionCompression</b>: string (default: "auto") - Protocol compression
+used by the sessions which load the data. Allowed values: auto, off, zstd, zlib.
+When set to auto, zstd compression is enabled if the connection to the server is
+slow, unless compression was already configured in the connection options.
+@li <b>minThreads</b>: int (default: not set) - If set, the number of threads
+which load the data is adjusted automatically between this value and the value
+of the <b>threads</b> option, depending on the load of the target instance. The
+number of threads is reduced if the InnoDB history list grows, threads wait for
+free pages in the buffer pool, the checkpoint age is too high or, if the target
+instance is a replica, its replication lag grows, and it is increased
+otherwise.
+@li <b>performanceReport</b>: path (default: not set) - Writes a JSON report
+with the time each thread spent executing the tasks, per task type, waiting for
+the tasks to be scheduled and reading the data files from a remote storage to
+the given local file path.
+@li <b>prefetchMemory</b>: string (default: 256M) - Maximum amount of memory
+used to download the data files before they are loaded, when loading a dump
+which is not stored in a local directory. Supports unit suffixes: k (kilobytes),
+M (Megabytes), G (Gigabytes). Setting it to 0 disables prefetching.
+@li <b>progressFd</b>: int (default: 2) - File descriptor the progress events
+are written to. Can only be used if <b>progressFormat</b> is set to jsonl.
 @li <b>progressFile</b>: path (default: load-progress.@<server_uuid@>.progress)
 - Stores load progress information in the given local file path.
+@li <b>progressFormat</b>: string (default: "text") - Format of the progress
+information. Allowed values: text, jsonl. When set to jsonl, progress is not
+displayed, instead it is written as a stream of events, one JSON document per
+line, to the file descriptor specified by the <b>progressFd</b> option.
 @li <b>resetProgress</b>: bool (default: false) - Discards progress information
 of previous load attempts to the destination server and loads the whole dump
 again.
@@ -1182,6 +1346,9 @@ information stored in the dump files, i.e. binary log file name and position.
 otherwise) - Enable or disable import progress information.
 @li <b>skipBinlog</b>: bool (default: false) - Disables the binary log
 for the MySQL sessions used by the loader (set sql_log_bin=0).
+@li <b>statusFile</b>: path (default: not set) - Periodically writes the status
+of the load to the given local file path, as a JSON document which is replaced
+atomically. It can be displayed using the <b>\show dump_progress</b> report.
 @li <b>threads</b>: int (default: 4) - Number of threads to use to import table
 data.
 @li <b>updateGtidSet</b>: "off", "replace", "append" (default: off) - if set to
@@ -1317,6 +1484,87 @@ void Util::load_dump(
   loader.run();
 }
 
+REGISTER_HELP_FUNCTION(loadDumpToInstances, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_LOADDUMPTOINSTANCES, R"*(
+Loads a dump created by MySQL Shell into several instances at the same time.
+
+@param url defines the location of the dump to be loaded
+@param instances List with the connection data of the target instances.
+@param options Optional dictionary with load options
+
+Each data file of the dump is read and decompressed only once, its contents are
+held in memory and loaded into all the instances. Each instance is loaded by
+its own set of threads, so that a slow instance does not delay the remaining
+ones, unless memory used by the shared data files reaches the limit. Data files
+which do not fit in memory are read separately for each instance.
+
+Load into each instance is independent: its progress is stored in a separate
+progress file, named load-progress.@<server_uuid@>.json, in the dump location,
+and if the load into one of the instances fails, the load into the remaining
+instances continues. Executing the same command again resumes the load of all
+instances, the instances which were fully loaded are skipped.
+
+Progress of the load is not displayed, output of each loader is prefixed with
+the address of its instance.
+
+Options dictionary:
+
+@li <b>cacheMemory</b>: string (default: 1G) - Maximum amount of memory held by
+the decompressed data files which are shared between the instances. Supports
+unit suffixes: k (kilobytes), M (Megabytes), G (Gigabytes).
+
+All the options of <<<loadDump>>>() are supported, except for:
+performanceReport, progressFd, progressFile, progressFormat, showProgress and
+statusFile. Options apply to all instances.
+
+Examples:
+<br>
+@code
+util.<<<loadDumpToInstances>>>('sakila_dump',
+    ['root@replica1:3306', 'root@replica2:3306', 'root@replica3:3306'],
+    { 'threads': 8 })
+@endcode
+)*");
+/**
+ * \ingroup util
+ *
+ * $(UTIL_LOADDUMPTOINSTANCES_BRIEF)
+ *
+ * $(UTIL_LOADDUMPTOINSTANCES)
+ */
+#if DOXYGEN_JS
+Undefined Util::loadDumpToInstances(String url, List instances,
+                                    Dictionary options) {}
+#elif DOXYGEN_PY
+None Util::load_dump_to_instances(str url, list instances, dict options) {}
+#endif
+void Util::load_dump_to_instances(
+    const std::string &url, const shcore::Array_t &instance_defs,
+    const shcore::Option_pack_ref<Load_dump_to_instances_options> &options) {
+  if (!instance_defs || instance_defs->empty()) {
+    throw shcore::Exception::argument_error(
+        "The list of instances cannot be empty.");
+  }
+
+  std::vector<mysqlshdk::db::Connection_options> instances;
+  instances.reserve(instance_defs->size());
+
+  for (const auto &instance_def : *instance_defs) {
+    try {
+      instances.emplace_back(mysqlsh::get_connection_options(instance_def));
+    } catch (const std::exception &err) {
+      throw shcore::Exception::argument_error(shcore::str_format(
+          "Invalid value '%s' in the list of instances: %s",
+          instance_def.descr().c_str(), err.what()));
+    }
+  }
+
+  Scoped_log_sql log_sql{log_sql_for_dump_and_load()};
+  shcore::Log_sql_guard log_sql_context{"util.loadDumpToInstances()"};
+
+  mysqlsh::load_dump_to_instances(url, instances, *options);
+}
+
 REGISTER_HELP_TOPIC_TEXT(TOPIC_UTIL_DUMP_COMPATIBILITY_OPTION, R"*(
 <b>MySQL HeatWave Service Compatibility</b>
 
@@ -1438,6 +1686,7 @@ The value for this parameter can be either:
 @li The path to the target location in a local filesystem or one of the
 supported cloud storage buckets
 @li A Pre-Authenticated Request (PAR) to a bucket in OCI Object Storage
+@li A stream archive, using the <b>stream://</b> scheme
 
 By default, a local directory is used, and in this case <b>outputUrl</b> can be
 prefixed with <b>file://</b> scheme. If a relative path is given, the absolute
@@ -1450,6 +1699,16 @@ operating systems which support them): <b>rw-r-----</b>.
 
 For additional details on using PARs see the <b>Dumping to OCI Object Storage
 using Pre-Authenticated Request (PAR)</b> section.
+
+If the <b>stream://</b> scheme is used, all dump files are multiplexed into a
+single stream, which is written to the local file, pipe or FIFO given after the
+scheme, i.e. <b>stream:///dev/fd/3</b>. Such stream can be loaded while it is
+being created, using the same URL and the 'waitDumpTimeout' option of the load
+dump utility. If <b>stream://-</b> is used, the stream is written to the
+standard output and messages are printed to the standard error while the dump
+is running. This allows to pipe the dump to another instance of the shell,
+which loads it using the same URL. Standard streams are not supported on
+Windows.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS, R"*(
@@ -1476,8 +1735,29 @@ csv, tsv or csv-unix.
 @li <b>maxRate</b>: string (default: "0") - Limit data read throughput to
 maximum rate, measured in bytes per second per thread. Use maxRate="0" to set no
 limit.
+@li <b>maxTotalRate</b>: string (default: "0") - Limit the combined data read
+throughput of all threads, measured in bytes per second, regardless of the
+number of threads. Can be used together with <b>maxRate</b>. Use
+maxTotalRate="0" to set no limit.
 @li <b>showProgress</b>: bool (default: true if stdout is a TTY device, false
 otherwise) - Enable or disable dump progress information.
+@li <b>progressFormat</b>: string (default: "text") - Format of the progress
+information. Allowed values: text, jsonl. When set to jsonl, progress is not
+displayed, instead it is written as a stream of events, one JSON document per
+line, to the file descriptor specified by the <b>progressFd</b> option.
+@li <b>progressFd</b>: int (default: 2) - File descriptor the progress events
+are written to. Can only be used if <b>progressFormat</b> is set to jsonl.
+@li <b>pipelinedFetch</b>: bool (default: false) - Use an additional thread for
+each dump thread to fetch rows from the server, while the dump thread writes the
+previously fetched rows. Has no effect if the X Protocol is used.
+@li <b>sessionCompression</b>: string (default: "auto") - Protocol compression
+used by the sessions which read the data. Allowed values: auto, off, zstd, zlib.
+When set to auto, zstd compression is enabled if the connection to the server is
+slow, unless compression was already configured in the connection options.
+@li <b>dropPageCache</b>: bool (default: false) - Advise the operating system
+to evict the data files from the page cache once they are written, so that a
+dump to a local directory does not push out other cached data. Dump is written
+without using mmap(). Has no effect on the remote storage.
 @li <b>defaultCharacterSet</b>: string (default: "utf8mb4") - Character set used
 for the dump.)*");
 
@@ -1517,6 +1797,16 @@ used to filter the data being exported.
 @li <b>partitions</b>: dictionary (default: not set) - A key-value pair of a
 table name in the format of <b>schema.table</b> and a list of valid partition
 names used to limit the data export to just the specified partitions.
+@li <b>watermarkColumns</b>: dictionary (default: not set) - A key-value pair
+of a table name in the format of <b>schema.table</b> and a name of a column
+which is updated each time a row is inserted or modified, maximum value of this
+column is recorded in the dump.
+@li <b>incrementalBase</b>: string (default: not set) - Location of a complete
+dump, only the data which has changed since that dump was created is going to
+be dumped.
+@li <b>previousDump</b>: string (default: not set) - Location of a complete
+dump, data of the tables which did not change since that dump was created is not
+dumped again.
 
 @li <b>tzUtc</b>: bool (default: true) - Convert TIMESTAMP data to UTC.
 
@@ -1531,6 +1821,21 @@ backup lock cannot not be acquired.
 @li <b>dataOnly</b>: bool (default: false) - Only dump data from the database.
 @li <b>checksum</b>: bool (default: false) - Compute and include checksum of the
 dumped data.
+@li <b>streamingChecksum</b>: bool (default: false) - Compute the checksums
+from the rows which are being dumped, instead of using separate queries,
+requires <b>checksum</b>.
+@li <b>performanceReport</b>: bool (default: false) - Write the
+@.perf.json file with timings and throughput of each table, partition and
+chunk.
+@li <b>rawBinary</b>: bool (default: false) - Write the contents of binary
+columns as-is, escaping only the special characters, instead of encoding them
+using base64.
+@li <b>readReplicas</b>: list of strings (default: not set) - URIs of the
+replicas of the source instance which are used to read the table data.
+@li <b>mirrorOutputUrls</b>: list of strings (default: not set) - Additional
+locations which receive a copy of each file of the dump.
+@li <b>mirrorMaxLag</b>: string (default: "64M") - Maximum number of bytes
+buffered for each file written to a mirror location.
 @li <b>dryRun</b>: bool (default: false) - Print information about what would be
 dumped, but do not dump anything. If <b>ocimds</b> is enabled, also checks for
 compatibility issues with MySQL HeatWave Service.
@@ -1538,13 +1843,45 @@ compatibility issues with MySQL HeatWave Service.
 @li <b>chunking</b>: bool (default: true) - Enable chunking of the tables.
 @li <b>bytesPerChunk</b>: string (default: "64M") - Sets average estimated
 number of bytes to be written to each chunk file, enables <b>chunking</b>.
+@li <b>adaptiveChunking</b>: bool (default: false) - Adjust the number of rows
+in each chunk using the throughput measured on the already dumped chunks of the
+same table, so that all chunks take a similar amount of time to dump.
+@li <b>stealChunks</b>: bool (default: false) - Allow threads which have no more
+work to take over the unread part of the chunks which are being dumped by other
+threads, writing it to new chunk files.
 @li <b>threads</b>: int (default: 4) - Use N threads to dump data chunks from
 the server.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_DDL_COMPRESSION, R"*(
 @li <b>compression</b>: string (default: "zstd") - Compression used when writing
-the data dump files, one of: "none", "gzip", "zstd".
+the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression level
+may be specified as an option, i.e.: "zstd;level=9". Level of the "zstd"
+compression may be set to "auto", it is then adjusted while the data is dumped,
+depending on whether compressing or writing the data takes longer.
+@li <b>compressionThreads</b>: int (default: 0) - Number of threads used by each
+dump thread to compress the data, if set to 0, data is compressed by the dump
+thread. Can only be used with the "zstd" or "gzip" compression. Gzip files are
+then written as multiple independently compressed members.
+@li <b>compressionDictionary</b>: bool (default: false) - Train a compression
+dictionary for each table using its initial rows, and use it to compress all
+data files of that table. Can only be used with the "zstd" compression.
+)*");
+
+REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_FORMAT_OPTION, R"*(
+@li <b>format</b>: enum (default: "text") - Format of the data dump files, one
+of: "text", "parquet".
+)*");
+
+REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_FORMAT_OPTION_DETAILS, R"*(
+If the <b>format</b> option is set to "parquet", table data is written using
+the Apache Parquet format, each data file holds a single row group. Columns use
+the dictionary encoding, unless the dictionary grows too big, then the plain
+encoding is used. The data pages are compressed using the codec specified by the
+<b>compression</b> option, the data files themselves are not compressed. This
+format cannot be used together with the <b>dialect</b>, <b>fields*</b> and
+<b>lines*</b> options. Dumps which use this format cannot be loaded using the
+util.<<<loadDump>>>() function.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_MDS_COMMON_OPTIONS, R"*(
@@ -1675,6 +2012,74 @@ index), data is dumped to multiple files using a single thread.
 
 The value of the <b>threads</b> option must be a positive number.
 
+The <b>stealChunks</b> option can only be used with tables which are chunked
+using an integer column, and cannot be used together with the <b>checksum</b>
+option. Chunk files of such tables are followed by an additional empty chunk
+file.
+
+The <b>streamingChecksum</b> option hashes the rows while they are being
+written, so the tables are scanned only once. Such dumps can only be loaded by
+a version of the Shell which supports this checksum algorithm. It cannot be used
+if the <b>tzUtc</b> option is set to false.
+
+The <b>performanceReport</b> option records, for each table and partition,
+the time it took to chunk it and the worker which did it. For each chunk, it
+records the worker which dumped it, the time to receive the first row, rows and
+bytes per second, the compression ratio and the time spent writing to the output
+file.
+
+The <b>rawBinary</b> option avoids the size overhead of base64 encoding and the
+cost of encoding and decoding the BINARY, VARBINARY, BLOB, BIT and GEOMETRY
+columns. It can only be used if the <b>defaultCharacterSet</b> option is set to
+one of: ascii, binary, latin1, utf8, utf8mb3, utf8mb4, and the
+<b>fieldsEscapedBy</b> option is not empty.
+
+The <b>readReplicas</b> option spreads the worker threads between the source
+instance and its replicas. When running a consistent dump, each replica has to
+apply all the transactions of the source while the global read lock is held,
+before the workers start their transactions, so all the workers see the same
+data. This requires GTIDs to be enabled. If a replica URI does not specify the
+user or the password, the ones of the source connection are used.
+
+The <b>mirrorOutputUrls</b> option writes the same dump to multiple locations
+at the same time, each of them can be a local directory or an OCI prefix PAR.
+Data is read from the source instance only once, each mirror is written by a
+separate background thread. If a mirror falls behind by more than
+<b>mirrorMaxLag</b> bytes, the dump waits until it catches up. The dump fails
+if any of the locations cannot be written.
+
+The <b>compressionDictionary</b> option improves the compression ratio of dumps
+with many small chunk files. The dictionary of each table is stored in a
+separate file, which is required to load the data files of that table.
+
+The <b>incrementalBase</b> option creates an incremental dump, which contains
+only the table data and is meant to be loaded into an instance which already
+contains the data of the base dump. The base dump is read using the same storage
+options as the output location. Tables whose watermark was recorded by the base
+dump include only the rows with the value of the watermark column greater than
+the recorded one, remaining tables are dumped in full. All tables need to have a
+primary key or an equivalent unique index, rows which already exist are replaced
+when the dump is loaded. The watermark column should be indexed, i.e. a
+TIMESTAMP column with the ON UPDATE CURRENT_TIMESTAMP attribute.
+
+Incremental dumps do not capture deleted rows, nor the rows committed by
+transactions which were in progress when the base dump was created, if their
+watermark values are lower than the recorded ones. The number of rows in each
+table is recorded: the load operation refuses to load an incremental dump into
+tables whose rows were deleted, and warns about tables which still contain rows
+deleted from the source instance. Use util.<<<dumpBinlogs>>>() and
+util.<<<loadBinlogs>>>() to capture and apply all the changes, deletes included,
+from the binary log.
+
+The <b>previousDump</b> option compares each table with its copy in a complete
+dump created earlier. Fingerprint of a table is computed using the CHECKSUM
+TABLE statement and the options which affect the contents of the data files.
+Data of the tables whose fingerprints did not change is not dumped again,
+metadata of such tables refers to the data files of the previous dump, which has
+to be available when the new dump is loaded, using the same storage options.
+This option cannot be used together with the <b>ddlOnly</b>,
+<b>incrementalBase</b> and <b>checksum</b> options.
+
 ${TOPIC_UTIL_DUMP_EXPORT_DIALECT_OPTION_DETAILS}
 
 Both the <b>bytesPerChunk</b> and <b>maxRate</b> options support unit suffixes:
@@ -1815,10 +2220,25 @@ to be overwritten. The output file is created with the following access rights
 used to filter the data being exported.
 @li <b>partitions</b>: list of strings (default: not set) - A list of valid
 partition names used to limit the data export to just the specified partitions.
+@li <b>threads</b>: int (default: 1) - Use N threads to export the data. If
+greater than 1, the table is divided into chunks which are exported in parallel
+to temporary part files, these are merged into the output file once all the
+data is exported. Cannot be used with the "parquet" format.
+@li <b>bytesPerChunk</b>: string (default: "64M") - Sets average estimated
+number of bytes to be written to each chunk, used if <b>threads</b> is greater
+than 1.
+${TOPIC_UTIL_DUMP_FORMAT_OPTION}
 
 ${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
 @li <b>compression</b>: string (default: "none") - Compression used when writing
-the data dump files, one of: "none", "gzip", "zstd".
+the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression level
+may be specified as an option, i.e.: "zstd;level=9". Level of the "zstd"
+compression may be set to "auto", it is then adjusted while the data is dumped,
+depending on whether compressing or writing the data takes longer.
+@li <b>compressionThreads</b>: int (default: 0) - Number of threads used by each
+dump thread to compress the data, if set to 0, data is compressed by the dump
+thread. Can only be used with the "zstd" or "gzip" compression. Gzip files are
+then written as multiple independently compressed members.
 
 ${TOPIC_UTIL_DUMP_OCI_COMMON_OPTIONS}
 
@@ -1832,12 +2252,20 @@ ${TOPIC_UTIL_DUMP_EXPORT_COMMON_REQUIREMENTS}
 
 This operation writes table data dump to the specified by the user files.
 
+If the <b>threads</b> option is greater than 1, each thread uses its own
+session to read the data and the export is not consistent if the table is
+modified while it is being exported. Part files are written to the directory of
+the output file, which needs to have enough space to hold both the parts and the
+output file.
+
 ${TOPIC_UTIL_DUMP_SESSION_DETAILS}
 
 <b>Options</b>
 
 ${TOPIC_UTIL_DUMP_EXPORT_DIALECT_OPTION_DETAILS}
 
+${TOPIC_UTIL_DUMP_FORMAT_OPTION_DETAILS}
+
 The <b>maxRate</b> option supports unit suffixes:
 @li k - for kilobytes,
 @li M - for Megabytes,
@@ -1919,6 +2347,9 @@ ${TOPIC_UTIL_DUMP_DDL_COMMON_PARAMETERS}
 <b>The following options are supported:</b>
 @li <b>all</b>: bool (default: false) - Dump all views and tables from the
 specified schema.
+${TOPIC_UTIL_DUMP_FORMAT_OPTION}
+@li <b>physical</b>: bool (default: false) - Dump the data of the tables as
+copies of their InnoDB tablespace files, instead of as text files.
 
 ${TOPIC_UTIL_DUMP_MDS_COMMON_OPTIONS}
 
@@ -1959,6 +2390,22 @@ to an empty array, all views and tables from the specified schema are going to
 be dumped. If the <b>tables</b> parameter is not set to an empty array, an
 exception is thrown.
 
+${TOPIC_UTIL_DUMP_FORMAT_OPTION_DETAILS}
+
+If the <b>physical</b> option is set to true, the tables are locked using FLUSH
+TABLES ... FOR EXPORT and their InnoDB tablespace files are copied to the dump,
+while the tables remain locked. The shell has to run on the same host as the
+server, and all tables need to use file-per-table tablespaces. This option
+cannot be used together with the <b>format</b>, <b>where</b>, <b>partitions</b>,
+<b>checksum</b>, <b>dataOnly</b>, <b>ocimds</b>, <b>compatibility</b>,
+<b>incrementalBase</b> and <b>previousDump</b> options.
+
+When such dump is loaded, the tables are created, their tablespaces are
+discarded and replaced with the dumped copies using ALTER TABLE ... IMPORT
+TABLESPACE. The shell has to run on the same host as the target server, the
+target server needs to have the same major and minor version as the source
+server, and the dump needs to be complete before it is loaded.
+
 ${TOPIC_UTIL_DUMP_DDL_COMMON_OPTION_DETAILS}
 ${TOPIC_UTIL_DUMP_COMPATIBILITY_OPTION}
 ${TOPIC_UTIL_DUMP_OCI_COMMON_OPTION_DETAILS}
@@ -2295,6 +2742,12 @@ MySQL HeatWave Service, also checks for compatibility issues.
 @li <b>chunking</b>: bool (default: true) - Enable chunking of the tables.
 @li <b>bytesPerChunk</b>: string (default: "64M") - Sets average estimated
 number of bytes to be copied in each chunk, enables <b>chunking</b>.
+@li <b>adaptiveChunking</b>: bool (default: false) - Adjust the number of rows
+in each chunk using the throughput measured on the already copied chunks of the
+same table, so that all chunks take a similar amount of time to copy.
+@li <b>stealChunks</b>: bool (default: false) - Allow threads which have no more
+work to take over the uncopied part of the chunks which are being copied by
+other threads.
 
 @li <b>threads</b>: int (default: 4) - Use N threads to read the data from
 the source server and additional N threads to write the data to the target
@@ -2303,10 +2756,33 @@ server.
 @li <b>maxRate</b>: string (default: "0") - Limit data read throughput to
 maximum rate, measured in bytes per second per thread. Use maxRate="0" to set no
 limit.
+@li <b>maxTotalRate</b>: string (default: "0") - Limit the combined data read
+throughput of all threads, measured in bytes per second, regardless of the
+number of threads. Can be used together with <b>maxRate</b>. Use
+maxTotalRate="0" to set no limit.
 @li <b>showProgress</b>: bool (default: true if stdout is a TTY device, false
 otherwise) - Enable or disable copy progress information.
+@li <b>pipelinedFetch</b>: bool (default: false) - Use an additional thread for
+each thread reading the data to fetch rows from the source server, while that
+thread writes the previously fetched rows. Has no effect if the X Protocol is
+used.
+@li <b>sessionCompression</b>: string (default: "auto") - Protocol compression
+used by the sessions which read the data from the source instance and by the
+sessions which load it into the target instance. Allowed values: auto, off,
+zstd, zlib. When set to auto, zstd compression is enabled if the connection to
+the server is slow, unless compression was already configured in the connection
+options.
 @li <b>defaultCharacterSet</b>: string (default: "utf8mb4") - Character set used
 for the copy.
+@li <b>memoryLimit</b>: string (default: "0") - Limits the memory used to hold
+the DDL and metadata files which are waiting to be loaded. Once the limit is
+reached, contents of these files are moved to a scratch directory. Table data
+is streamed directly to the target instance and is not subject to this limit.
+Supports unit suffixes: k (kilobytes), M (Megabytes), G (Gigabytes). Use
+memoryLimit="0" to set no limit.
+@li <b>spillDirectory</b>: string (default: the system temporary directory) -
+Directory where the scratch files are created once <b>memoryLimit</b> is
+reached. They are removed when the copy finishes.
 
 @li <b>analyzeTables</b>: "off", "on", "histogram" (default: off) - If 'on',
 executes ANALYZE TABLE for all tables, once copied. If set to 'histogram', only
@@ -2522,4 +2998,263 @@ void Util::copy_tables(
   copy::copy<mysqlsh::dump::Dump_tables>(connection_options, &copy_options);
 }
 
+REGISTER_HELP_FUNCTION(compareTables, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_COMPARETABLES, R"*(
+Compares contents of tables in the source instance with the same tables in the
+target instance. Requires an open global Shell session to the source instance,
+if there is none, an exception is raised.
+
+@param schema Name of the schema that contains the tables to be compared.
+@param tables List of strings with names of tables to be compared.
+@param connectionData Specifies the connection information required to establish
+a connection to the target instance.
+@param options Optional dictionary with the comparison options.
+
+@returns A dictionary with the result of the comparison.
+
+Checksum of each table is computed in both instances at the same time. If the
+checksums differ and the table has a primary key, or a unique index on NOT NULL
+columns, whose first column is an integer, values of that column are split into
+ranges and checksums of these ranges are compared. Ranges which differ are
+split further, until a range holds at most <b>rangeRows</b> rows, then rows of
+that range are compared one by one. Time needed to find the differences is
+proportional to the number of differences, rather than to the size of the
+table. Tables should not be modified while they are being compared.
+
+Rows of tables which differ and have a suitable unique index, whose first
+column is not an integer, are compared one by one. Rows of tables without such
+index cannot be identified, only the checksums of these tables are compared.
+
+The returned dictionary holds the following keys:
+
+@li <b>identical</b>: bool - true if all tables are identical.
+@li <b>tables</b>: dictionary - result of comparison of each table, with the
+following keys: <b>identical</b>, <b>sourceRows</b>, <b>targetRows</b>,
+<b>rangesCompared</b>, <b>rowsCompared</b>, <b>differences</b>,
+<b>truncated</b> and, if the table could not be fully compared, <b>warning</b>.
+
+Each entry in the list of <b>differences</b> holds the <b>key</b> of the row,
+that is the values of the columns of the unique index, and the <b>type</b> of
+the difference: "missing" if the row exists only in the source instance,
+"extra" if it exists only in the target instance, "different" if values of the
+row differ.
+
+<b>The following options are supported:</b>
+@li <b>maxDifferences</b>: int (default: 100) - Maximum number of differences
+reported for each table, once it is reached, comparison of that table stops and
+its <b>truncated</b> key is set to true.
+@li <b>rangeRows</b>: int (default: 1000) - Ranges which hold at most this many
+rows are compared row by row.
+@li <b>threads</b>: int (default: 4) - Use N threads to compute the checksums
+and compare the rows, each thread uses one connection to each instance.
+
+Examples:
+<br>
+@code
+util.<<<compareTables>>>('sakila', ['actor', 'film'], 'root@replica:3306')
+@endcode
+)*");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_COMPARETABLES_BRIEF)
+ *
+ * $(UTIL_COMPARETABLES)
+ */
+#if DOXYGEN_JS
+Dictionary Util::compareTables(String schema, List tables,
+                               ConnectionData connectionData,
+                               Dictionary options);
+#elif DOXYGEN_PY
+dict Util::compare_tables(str schema, list tables,
+                          ConnectionData connectionData, dict options);
+#endif
+shcore::Dictionary_t Util::compare_tables(
+    const std::string &schema, const std::vector<std::string> &tables,
+    const mysqlshdk::db::Connection_options &connection_options,
+    const shcore::Option_pack_ref<Compare_tables_options> &options) {
+  const auto session = _shell_core.get_dev_session();
+
+  if (!session || !session->is_open()) {
+    throw std::runtime_error(
+        "An open session is required to perform this operation.");
+  }
+
+  shcore::Log_sql_guard log_sql_context{"util.compareTables()"};
+
+  return mysqlsh::compare_tables(session->get_core_session(),
+                                 connection_options, schema, tables, *options);
+}
+
+REGISTER_HELP_FUNCTION(dumpBinlogs, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_DUMPBINLOGS, R"*(
+Dumps binary logs generated since a specific point in time to the given local
+or remote directory.
+
+@param outputUrl Target directory to store the dump files.
+@param options Optional dictionary with the dump options.
+
+The starting point of the dump is given either by the <b>since</b> option,
+which points to a dump created by one of the dump utilities, including
+<<<dumpBinlogs>>>(), or by the <b>startFrom</b> option, which specifies a
+binary log file and, optionally, a position in that file. When the
+<b>since</b> option is used, only transactions which were not executed at the
+time the given dump was taken are dumped, allowing for point-in-time recovery
+when the dumps are loaded one after another.
+
+Binary log files are read using the replication protocol, each file is read
+by a separate thread. Dump ends at the current position of the binary log.
+
+Requirements:
+@li The source instance must have binary logging enabled and GTID_MODE set to
+ON.
+@li The user account used to connect to the source instance needs to have the
+REPLICATION SLAVE privilege.
+@li Binary logs which hold the dumped transactions must not be purged.
+
+<b>The following options are supported:</b>
+@li <b>since</b>: string (default: not set) - URL of a dump created by one of
+the dump utilities, transactions executed after that dump was taken are
+dumped. Cannot be used with the <b>startFrom</b> option.
+@li <b>startFrom</b>: string (default: not set) - Name of the binary log file
+to start the dump at, optionally followed by a colon and a position in that
+file, i.e. "binlog.000003:1234". Cannot be used with the <b>since</b> option.
+@li <b>threads</b>: int (default: 4) - Use N threads to read the binary log
+files.
+@li <b>bytesPerChunk</b>: string (default: "64M") - Transactions of each binary
+log file are written to multiple chunk files, each holding approximately this
+many bytes. The minimum allowed value is 128k.
+@li <b>compression</b>: string (default: "zstd") - Compression used when writing
+the chunk files, one of: "none", "gzip", "zstd", "lz4". Compression level may
+be specified as an option, i.e.: "zstd;level=9".
+@li <b>showProgress</b>: bool (default: true if stdout is a TTY device, false
+otherwise) - Enable or disable dump progress information.
+@li <b>dryRun</b>: bool (default: false) - Print information about the binary
+log files which would be dumped, but do not dump anything.
+
+${TOPIC_UTIL_DUMP_OCI_COMMON_OPTIONS}
+
+${TOPIC_UTIL_AWS_COMMON_OPTIONS}
+
+${TOPIC_UTIL_AZURE_COMMON_OPTIONS}
+
+Examples:
+<br>
+@code
+util.<<<dumpBinlogs>>>('/backups/binlogs-1', {'since': '/backups/instance'})
+util.<<<dumpBinlogs>>>('/backups/binlogs-2', {'since': '/backups/binlogs-1'})
+@endcode
+)*");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_DUMPBINLOGS_BRIEF)
+ *
+ * $(UTIL_DUMPBINLOGS)
+ */
+#if DOXYGEN_JS
+Undefined Util::dumpBinlogs(String outputUrl, Dictionary options);
+#elif DOXYGEN_PY
+None Util::dump_binlogs(str outputUrl, dict options);
+#endif
+void Util::dump_binlogs(
+    const std::string &output_url,
+    const shcore::Option_pack_ref<binlog::Dump_binlogs_options> &options) {
+  const auto session = _shell_core.get_dev_session();
+
+  if (!session || !session->is_open()) {
+    throw std::runtime_error(
+        "An open session is required to perform this operation.");
+  }
+
+  Scoped_log_sql log_sql{log_sql_for_dump_and_load()};
+  shcore::Log_sql_guard log_sql_context{"util.dumpBinlogs()"};
+
+  binlog::dump_binlogs(session->get_core_session(), output_url, *options);
+}
+
+REGISTER_HELP_FUNCTION(loadBinlogs, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_LOADBINLOGS, R"*(
+Loads binary log dumps created by MySQL Shell from a local or remote
+directory.
+
+@param url URL or path to the dump directory.
+@param options Optional dictionary with the load options.
+
+Dumps created by <<<dumpBinlogs>>>() are loaded on top of an instance which was
+restored from the dump given in the <b>since</b> option of that call. Events
+are replayed as SQL statements, row events are replayed using the BINLOG
+statement. Each transaction is executed with GTID_NEXT set to its original
+GTID, transactions already executed by the target instance are skipped.
+
+Transactions are applied in parallel, using the commit dependencies recorded
+in the binary logs by the source instance.
+
+Requirements:
+@li The target instance must have GTID_MODE set to ON.
+@li The user account used to connect to the target instance needs to have the
+privileges required to execute the dumped transactions, and to set GTID_NEXT
+and execute the BINLOG statement, i.e. REPLICATION_APPLIER or
+SYSTEM_VARIABLES_ADMIN and BINLOG_ADMIN.
+@li Transactions which were executed by the source instance before the first
+dumped transaction must be executed by the target instance.
+
+Transactions using XA or LOAD DATA in statement-based format, and transactions
+with tagged GTIDs are not supported.
+
+<b>The following options are supported:</b>
+@li <b>threads</b>: int (default: 4) - Use N threads to apply the transactions.
+@li <b>stopBefore</b>: string (default: not set) - GTID of a transaction, load
+stops before that transaction is applied.
+@li <b>ignoreGtidGap</b>: bool (default: false) - Load the dump even if the
+target instance is missing transactions which were executed by the source
+instance before the first dumped transaction.
+@li <b>showProgress</b>: bool (default: true if stdout is a TTY device, false
+otherwise) - Enable or disable load progress information.
+@li <b>dryRun</b>: bool (default: false) - Print information about the
+transactions which would be loaded, but do not load anything.
+
+${TOPIC_UTIL_DUMP_OCI_COMMON_OPTIONS}
+
+${TOPIC_UTIL_AWS_COMMON_OPTIONS}
+
+${TOPIC_UTIL_AZURE_COMMON_OPTIONS}
+
+Examples:
+<br>
+@code
+util.<<<loadBinlogs>>>('/backups/binlogs-1')
+@endcode
+)*");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_LOADBINLOGS_BRIEF)
+ *
+ * $(UTIL_LOADBINLOGS)
+ */
+#if DOXYGEN_JS
+Undefined Util::loadBinlogs(String url, Dictionary options);
+#elif DOXYGEN_PY
+None Util::load_binlogs(str url, dict options);
+#endif
+void Util::load_binlogs(
+    const std::string &url,
+    const shcore::Option_pack_ref<binlog::Load_binlogs_options> &options) {
+  const auto session = _shell_core.get_dev_session();
+
+  if (!session || !session->is_open()) {
+    throw std::runtime_error(
+        "An open session is required to perform this operation.");
+  }
+
+  Scoped_log_sql log_sql{log_sql_for_dump_and_load()};
+  shcore::Log_sql_guard log_sql_context{"util.loadBinlogs()"};
+
+  binlog::load_binlogs(session->get_core_session(), url, *options);
+}
+
 }  // namespace mysqlsh
@@ -30,6 +30,9 @@
 #include <vector>
 
 #include "modules/mod_extensible_object.h"
+#include "modules/util/binlog/dump_binlogs.h"
+#include "modules/util/binlog/load_binlogs.h"
+#include "modules/util/compare/compare_tables.h"
 #include "modules/util/copy/copy_instance_options.h"
 #include "modules/util/copy/copy_schemas_options.h"
 #include "modules/util/copy/copy_tables_options.h"
@@ -39,6 +42,7 @@
 #include "modules/util/dump/export_table_options.h"
 #include "modules/util/import_table/import_table_options.h"
 #include "modules/util/load/load_dump_options.h"
+#include "modules/util/load/load_dump_to_instances.h"
 #include "modules/util/upgrade_check.h"
 #include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/utils/document_parser.h"
@@ -54,6 +58,7 @@ struct Import_json_options {
   std::string table;
   std::string collection;
   std::string table_column;
+  uint64_t threads = 1;
   shcore::Document_reader_options doc_reader;
 
   static const shcore::Option_pack_def<Import_json_options> &options();
@@ -114,6 +119,16 @@ class SHCORE_PUBLIC Util : public Extensible_object {
   void load_dump(const std::string &url,
                  const shcore::Option_pack_ref<Load_dump_options> &options);
 
+#if DOXYGEN_JS
+  Undefined loadDumpToInstances(String url, List instances,
+                                Dictionary options);
+#elif DOXYGEN_PY
+  None load_dump_to_instances(str url, list instances, dict options);
+#endif
+  void load_dump_to_instances(
+      const std::string &url, const shcore::Array_t &instances,
+      const shcore::Option_pack_ref<Load_dump_to_instances_options> &options);
+
 #if DOXYGEN_JS
   Undefined exportTable(String table, String outputUrl, Dictionary options);
 #elif DOXYGEN_PY
@@ -184,6 +199,38 @@ class SHCORE_PUBLIC Util : public Extensible_object {
       const mysqlshdk::db::Connection_options &connection_options,
       const shcore::Option_pack_ref<copy::Copy_tables_options> &options = {});
 
+#if DOXYGEN_JS
+  Dictionary compareTables(String schema, List tables,
+                           ConnectionData connectionData, Dictionary options);
+#elif DOXYGEN_PY
+  dict compare_tables(str schema, list tables, ConnectionData connectionData,
+                      dict options);
+#endif
+  shcore::Dictionary_t compare_tables(
+      const std::string &schema, const std::vector<std::string> &tables,
+      const mysqlshdk::db::Connection_options &connection_options,
+      const shcore::Option_pack_ref<Compare_tables_options> &options = {});
+
+#if DOXYGEN_JS
+  Undefined dumpBinlogs(String outputUrl, Dictionary options);
+#elif DOXYGEN_PY
+  None dump_binlogs(str outputUrl, dict options);
+#endif
+  void dump_binlogs(
+      const std::string &output_url,
+      const shcore::Option_pack_ref<binlog::Dump_binlogs_options> &options =
+          {});
+
+#if DOXYGEN_JS
+  Undefined loadBinlogs(String url, Dictionary options);
+#elif DOXYGEN_PY
+  None load_binlogs(str url, dict options);
+#endif
+  void load_binlogs(
+      const std::string &url,
+      const shcore::Option_pack_ref<binlog::Load_binlogs_options> &options =
+          {});
+
  private:
   shcore::IShell_core &_shell_core;
 };
@@ -23,20 +23,26 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <exception>
 #include <map>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
+#include "modules/mod_utils.h"
 #include "modules/util/upgrade_check.h"
 #include "modules/util/upgrade_check_formatter.h"
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/libs/config/config_file.h"
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/parser/mysql_parser_utils.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
@@ -98,6 +104,7 @@ const shcore::Option_pack_def<Upgrade_check_options>
           .optional("outputFormat", &Upgrade_check_options::output_format)
           .optional("targetVersion", &Upgrade_check_options::set_target_version)
           .optional("configPath", &Upgrade_check_options::config_path)
+          .optional("threads", &Upgrade_check_options::threads)
           .optional("password", &Upgrade_check_options::password, "",
                     shcore::Option_extract_mode::CASE_SENSITIVE,
                     shcore::Option_scope::CLI_DISABLED);
@@ -119,6 +126,43 @@ void Upgrade_check_options::set_target_version(const std::string &value) {
   }
 }
 
+std::shared_ptr<const Upgrade_check_query_cache::Rows>
+Upgrade_check_query_cache::query(mysqlshdk::db::ISession *session,
+                                 const std::string &sql) {
+  std::promise<std::shared_ptr<const Rows>> promise;
+  std::shared_future<std::shared_ptr<const Rows>> rows;
+  bool execute = false;
+
+  {
+    std::lock_guard lock{m_mutex};
+
+    if (const auto it = m_results.find(sql); m_results.end() != it) {
+      rows = it->second;
+    } else {
+      rows = promise.get_future().share();
+      m_results.emplace(sql, rows);
+      execute = true;
+    }
+  }
+
+  if (execute) {
+    try {
+      auto copy = std::make_shared<Rows>();
+      const auto result = session->query(sql);
+
+      while (const auto row = result->fetch_one()) {
+        copy->emplace_back(*row);
+      }
+
+      promise.set_value(std::move(copy));
+    } catch (...) {
+      promise.set_exception(std::current_exception());
+    }
+  }
+
+  return rows.get();
+}
+
 Upgrade_check::Collection Upgrade_check::s_available_checks;
 
 std::vector<std::unique_ptr<Upgrade_check>> Upgrade_check::create_checklist(
@@ -277,10 +321,18 @@ std::vector<Upgrade_issue> Sql_upgrade_check::run(
 
   std::vector<Upgrade_issue> issues;
   for (const auto &query : m_queries) {
-    auto result = session->query(query);
-    const mysqlshdk::db::IRow *row = nullptr;
-    while ((row = result->fetch_one()) != nullptr) {
-      add_issue(row, &issues);
+    // set up statements may change the results, these are not shared
+    if (server_info.query_cache && m_set_up.empty()) {
+      for (const auto &row :
+           *server_info.query_cache->query(session.get(), query)) {
+        add_issue(&row, &issues);
+      }
+    } else {
+      auto result = session->query(query);
+      const mysqlshdk::db::IRow *row = nullptr;
+      while ((row = result->fetch_one()) != nullptr) {
+        add_issue(row, &issues);
+      }
     }
   }
 
@@ -420,7 +472,7 @@ class Routine_syntax_check : public Upgrade_check {
 
   std::vector<Upgrade_issue> run(
       const std::shared_ptr<mysqlshdk::db::ISession> &session,
-      const Upgrade_info & /*server_info*/) override {
+      const Upgrade_info &server_info) override {
     struct Check_info {
       const char *names_query;
       const char *show_query;
@@ -447,15 +499,24 @@ class Routine_syntax_check : public Upgrade_check {
 
     std::vector<Upgrade_issue> issues;
     for (const auto &obj : object_info) {
-      auto result = session->queryf(obj.names_query);
-
-      // fetch all results because we need to query again in process_item()
-      result->buffer();
-
-      while (auto row = result->fetch_one()) {
+      const auto process = [&](const mysqlshdk::db::IRow *row) {
         auto issue =
             process_item(row, obj.show_query, obj.code_field, session.get());
         if (!issue.description.empty()) issues.push_back(std::move(issue));
+      };
+
+      if (server_info.query_cache) {
+        for (const auto &row :
+             *server_info.query_cache->query(session.get(), obj.names_query)) {
+          process(&row);
+        }
+      } else {
+        auto result = session->queryf(obj.names_query);
+
+        // fetch all results because we need to query again in process_item()
+        result->buffer();
+
+        while (auto row = result->fetch_one()) process(row);
       }
     }
     return issues;
@@ -2213,7 +2274,7 @@ bool UNUSED_VARIABLE(register_get_deprecated_router_auth_method_check) =
 }
 
 Upgrade_check_config::Upgrade_check_config(const Upgrade_check_options &options)
-    : m_output_format(options.output_format) {
+    : m_output_format(options.output_format), m_threads(options.threads) {
   m_upgrade_info.target_version = options.get_target_version();
   m_upgrade_info.explicit_target_version = options.target_version.has_value();
   m_upgrade_info.config_path = options.config_path;
@@ -2289,8 +2350,11 @@ bool check_for_upgrade(const Upgrade_check_config &config) {
                     config.upgrade_info().target_version.get_base(),
                     config.upgrade_info().explicit_target_version);
 
+  auto info = config.upgrade_info();
+  info.query_cache = std::make_shared<Upgrade_check_query_cache>();
+
   const auto checklist =
-      Upgrade_check::create_checklist(config.upgrade_info(), config.targets());
+      Upgrade_check::create_checklist(info, config.targets());
 
   int errors = 0, warnings = 0, notices = 0;
   const auto update_counts = [&errors, &warnings,
@@ -2312,13 +2376,34 @@ bool check_for_upgrade(const Upgrade_check_config &config) {
   // up to 5.7.39
   config.session()->execute("USE mysql;");
 
-  for (const auto &check : checklist)
+  std::vector<std::size_t> runnable;
+
+  for (std::size_t i = 0; i < checklist.size(); ++i) {
+    if (checklist[i]->is_runnable()) runnable.emplace_back(i);
+  }
+
+  std::vector<std::vector<Upgrade_issue>> results(checklist.size());
+  std::vector<std::exception_ptr> failures(checklist.size());
+
+  const auto run_check = [&](std::size_t idx,
+                             const std::shared_ptr<mysqlshdk::db::ISession>
+                                 &session) {
+    try {
+      results[idx] = config.filter_issues(checklist[idx]->run(session, info));
+    } catch (...) {
+      failures[idx] = std::current_exception();
+    }
+  };
+
+  const auto print_check = [&](std::size_t idx) {
+    const auto &check = checklist[idx];
+
     if (check->is_runnable()) {
       try {
-        const auto issues = config.filter_issues(
-            check->run(config.session(), config.upgrade_info()));
-        for (const auto &issue : issues) update_counts(issue.level);
-        print->check_results(*check, issues);
+        if (failures[idx]) std::rethrow_exception(failures[idx]);
+
+        for (const auto &issue : results[idx]) update_counts(issue.level);
+        print->check_results(*check, results[idx]);
       } catch (const Upgrade_check::Check_configuration_error &e) {
         print->check_error(*check, e.what(), false);
       } catch (const std::exception &e) {
@@ -2328,6 +2413,62 @@ bool check_for_upgrade(const Upgrade_check_config &config) {
       update_counts(check->get_level());
       print->manual_check(*check);
     }
+  };
+
+  const auto threads = std::min<std::size_t>(
+      std::max<uint64_t>(config.threads(), 1), runnable.size());
+
+  if (threads <= 1) {
+    for (std::size_t i = 0; i < checklist.size(); ++i) {
+      if (checklist[i]->is_runnable()) run_check(i, config.session());
+      print_check(i);
+    }
+  } else {
+    // each thread uses its own session, checks are picked in order and their
+    // results are printed in order as soon as they are available
+    std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions{
+        config.session()};
+    const auto co = config.session()->get_connection_options();
+
+    for (std::size_t i = 1; i < threads; ++i) {
+      auto session = establish_session(co, false);
+      session->execute("USE mysql;");
+      sessions.emplace_back(std::move(session));
+    }
+
+    std::atomic<std::size_t> next{0};
+    shcore::Synchronized_queue<std::size_t> finished;
+    std::vector<std::thread> workers;
+
+    for (const auto &session : sessions) {
+      workers.emplace_back(mysqlsh::spawn_scoped_thread([&, session]() {
+        mysqlsh::Mysql_thread mysql_thread;
+
+        for (auto i = next++; i < runnable.size(); i = next++) {
+          run_check(runnable[i], session);
+          finished.push(runnable[i]);
+        }
+      }));
+    }
+
+    std::vector<bool> done(checklist.size(), false);
+
+    for (std::size_t i = 0; i < checklist.size(); ++i) {
+      if (!checklist[i]->is_runnable()) done[i] = true;
+    }
+
+    std::size_t printed = 0;
+
+    for (std::size_t i = 0; i < runnable.size(); ++i) {
+      done[finished.pop()] = true;
+
+      while (printed < checklist.size() && done[printed]) {
+        print_check(printed++);
+      }
+    }
+
+    for (auto &worker : workers) worker.join();
+  }
 
   std::string summary;
   if (errors > 0) {
@@ -27,13 +27,17 @@
 #include <forward_list>
 #include <functional>
 #include <map>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/libs/db/row_copy.h"
 #include "mysqlshdk/libs/mysql/user_privileges.h"
 #include "mysqlshdk/libs/utils/enumset.h"
 #include "mysqlshdk/libs/utils/version.h"
@@ -73,6 +77,7 @@ struct Upgrade_check_options {
   std::string config_path;
   std::string output_format;
   std::optional<std::string> password;
+  uint64_t threads = 1;
 
   mysqlshdk::utils::Version get_target_version() const;
 
@@ -85,6 +90,30 @@ struct Upgrade_check_options {
 
 std::string upgrade_issue_to_string(const Upgrade_issue &problem);
 
+/**
+ * Holds the rows returned by the queries executed by the checks, so that
+ * checks which run the same query read its result only once, even when they
+ * are executed concurrently using different sessions.
+ */
+class Upgrade_check_query_cache final {
+ public:
+  using Rows = std::vector<mysqlshdk::db::Row_copy>;
+
+  /**
+   * Returns the rows of the given query, executing it using the given session
+   * if it was not executed yet. If the same query is being executed by another
+   * thread, waits for its result.
+   */
+  std::shared_ptr<const Rows> query(mysqlshdk::db::ISession *session,
+                                    const std::string &sql);
+
+ private:
+  std::mutex m_mutex;
+  std::unordered_map<std::string,
+                     std::shared_future<std::shared_ptr<const Rows>>>
+      m_results;
+};
+
 class Upgrade_check {
  public:
   struct Upgrade_info {
@@ -94,6 +123,8 @@ class Upgrade_check {
     std::string server_os;
     std::string config_path;
     bool explicit_target_version;
+    // optional, shared by all checks executed by check_for_upgrade()
+    std::shared_ptr<Upgrade_check_query_cache> query_cache;
   };
 
   enum class Target {
@@ -398,6 +429,13 @@ class Upgrade_check_config final {
 
   Upgrade_check::Target_flags targets() const { return m_target_flags; }
 
+  void set_threads(uint64_t threads) { m_threads = threads; }
+
+  /**
+   * Number of sessions used to execute the checks concurrently.
+   */
+  uint64_t threads() const { return m_threads; }
+
  private:
   Upgrade_check::Upgrade_info m_upgrade_info;
   std::shared_ptr<mysqlshdk::db::ISession> m_session;
@@ -407,6 +445,7 @@ class Upgrade_check_config final {
   Upgrade_check::Target_flags m_target_flags =
       Upgrade_check::Target_flags::all().unset(
           Upgrade_check::Target::MDS_SPECIFIC);
+  uint64_t m_threads = 1;
 };
 
 /**
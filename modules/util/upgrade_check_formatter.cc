@@ -295,7 +295,9 @@ class JSON_upgrade_checker_output : public Upgrade_check_output_formatter {
     m_json_document.AddMember("manualChecks", m_manual_checks, m_allocator);
 
     rapidjson::StringBuffer buffer;
-    if (mysqlsh::current_shell_options()->get().wrap_json == "json/raw") {
+    if (const auto &wrap_json =
+            mysqlsh::current_shell_options()->get().wrap_json;
+        wrap_json == "json/raw" || wrap_json == "json/stream") {
       rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
       m_json_document.Accept(writer);
     } else {
@@ -47,6 +47,16 @@ class SHCORE_PUBLIC JScript_context {
   JScript_context(Object_registry *registry);
   ~JScript_context();
 
+  /**
+   * Creates the startup snapshot, which holds the global context with the core
+   * module already loaded. Executed at build time by mysqlsh_js_snapshot, the
+   * shell restores the global context from this snapshot instead of creating
+   * it from scratch.
+   *
+   * @returns contents of the snapshot file
+   */
+  static std::string create_startup_snapshot();
+
   std::pair<Value, bool> execute(const std::string &code,
                                  const std::string &source = "");
   std::pair<Value, bool> execute_interactive(const std::string &code,
@@ -27,6 +27,12 @@
 #include "scripting/python_utils.h"
 #include "scripting/types.h"
 
+namespace mysqlshdk {
+namespace db {
+class IRow;
+}  // namespace db
+}  // namespace mysqlshdk
+
 namespace shcore {
 
 class Python_context;
@@ -45,6 +51,12 @@ void set_item(const Dictionary_t &map, PyObject *key, PyObject *value,
 
 py::Release convert(const Value &value, Python_context *context = nullptr);
 
+/**
+ * Converts the given row into a tuple, the values are created directly from the
+ * row data, without intermediate shcore::Value objects.
+ */
+py::Release convert(const mysqlshdk::db::IRow &row);
+
 }  // namespace py
 }  // namespace shcore
 
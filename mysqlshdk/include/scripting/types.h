@@ -134,38 +134,40 @@ struct SHCORE_PUBLIC Value final {
 
   class SHCORE_PUBLIC Map_type final {
    public:
-    typedef std::map<std::string, Value> container_type;
+    // transparent comparator allows to look up the keys without creating
+    // temporary std::string objects, i.e. when using string literals
+    typedef std::map<std::string, Value, std::less<>> container_type;
     typedef container_type::const_iterator const_iterator;
     typedef container_type::iterator iterator;
     using value_type = container_type::value_type;
     using reverse_iterator = container_type::reverse_iterator;
     using const_reverse_iterator = container_type::const_reverse_iterator;
 
-    inline bool has_key(const std::string &k) const { return find(k) != end(); }
+    inline bool has_key(std::string_view k) const { return find(k) != end(); }
 
-    Value_type get_type(const std::string &k) const;
+    Value_type get_type(std::string_view k) const;
 
-    bool is_null(const std::string &k) const {
+    bool is_null(std::string_view k) const {
       return get_type(k) == shcore::Null;
     }
 
-    std::string get_string(const std::string &k,
+    std::string get_string(std::string_view k,
                            const std::string &def = "") const;
-    bool get_bool(const std::string &k, bool def = false) const;
-    int64_t get_int(const std::string &k, int64_t def = 0) const;
-    uint64_t get_uint(const std::string &k, uint64_t def = 0) const;
-    double get_double(const std::string &k, double def = 0.0) const;
+    bool get_bool(std::string_view k, bool def = false) const;
+    int64_t get_int(std::string_view k, int64_t def = 0) const;
+    uint64_t get_uint(std::string_view k, uint64_t def = 0) const;
+    double get_double(std::string_view k, double def = 0.0) const;
     std::shared_ptr<Value::Map_type> get_map(
-        const std::string &k,
+        std::string_view k,
         std::shared_ptr<Map_type> def = std::shared_ptr<Map_type>()) const;
     std::shared_ptr<Value::Array_type> get_array(
-        const std::string &k,
+        std::string_view k,
         std::shared_ptr<Array_type> def = std::shared_ptr<Array_type>()) const;
     void merge_contents(std::shared_ptr<Map_type> source, bool overwrite);
 
     template <class C>
     std::shared_ptr<C> get_object(
-        const std::string &k,
+        std::string_view k,
         std::shared_ptr<C> def = std::shared_ptr<C>()) const {
       const_iterator iter = find(k);
       if (iter == end()) return def;
@@ -173,10 +175,15 @@ struct SHCORE_PUBLIC Value final {
       return iter->second.as_object<C>();
     }
 
-    const_iterator find(const std::string &k) const { return _map.find(k); }
-    iterator find(const std::string &k) { return _map.find(k); }
+    const_iterator find(std::string_view k) const { return _map.find(k); }
+    iterator find(std::string_view k) { return _map.find(k); }
 
-    size_t erase(const std::string &k) { return _map.erase(k); }
+    size_t erase(std::string_view k) {
+      const auto it = _map.find(k);
+      if (it == _map.end()) return 0;
+      _map.erase(it);
+      return 1;
+    }
     iterator erase(const_iterator it) { return _map.erase(it); }
     iterator erase(iterator it) { return _map.erase(it); }
     void clear() { _map.clear(); }
@@ -199,8 +206,10 @@ struct SHCORE_PUBLIC Value final {
 
     void set(const std::string &k, const shcore::Value &v) { _map[k] = v; }
 
-    const container_type::mapped_type &at(const std::string &k) const {
-      return _map.at(k);
+    const container_type::mapped_type &at(std::string_view k) const {
+      const auto it = _map.find(k);
+      if (it == _map.end()) throw std::out_of_range("map::at");
+      return it->second;
     }
     container_type::mapped_type &operator[](const std::string &k) {
       return _map[k];
@@ -217,7 +226,7 @@ struct SHCORE_PUBLIC Value final {
 
     bool empty() const { return _map.empty(); }
     size_t size() const { return _map.size(); }
-    size_t count(const std::string &k) const { return _map.count(k); }
+    size_t count(std::string_view k) const { return _map.count(k); }
 
     template <class T>
     std::pair<iterator, bool> emplace(const std::string &key, T &&v) {
@@ -920,7 +929,7 @@ class Option_unpacker {
 
  protected:
   Dictionary_t m_options;
-  std::set<std::string> m_unknown;
+  std::set<std::string, std::less<>> m_unknown;
   std::set<std::string> m_missing;
   std::unordered_set<std::string_view> m_ignored;
 
@@ -945,6 +954,9 @@ class Option_unpacker {
                            bool case_insensitive = false);
 
   void validate(std::string_view context = "");
+
+ private:
+  void mark_known(std::string_view name);
 };
 
 class JSON_dumper;
@@ -1043,6 +1055,9 @@ class SHCORE_PUBLIC Function_base {
   // arglist must match the signature
   virtual Value invoke(const Argument_list &args) = 0;
 
+  //! Whether the function can be invoked from any thread
+  virtual bool thread_safe() const { return false; }
+
   virtual std::string &append_descr(std::string *s_out, int indent = -1,
                                     int quote_strings = 0) const;
 
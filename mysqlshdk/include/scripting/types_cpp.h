@@ -49,8 +49,8 @@ namespace shcore {
 class SHCORE_PUBLIC Cpp_property_name {
  public:
   explicit Cpp_property_name(const std::string &name, bool constant = false);
-  std::string name(NamingStyle style) const;
-  std::string base_name() const;
+  const std::string &name(NamingStyle style) const;
+  const std::string &base_name() const;
 
  private:
   // Each instance holds it's names on the different styles
@@ -1603,7 +1603,24 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
   template <typename T>
   using to_function_t = typename to_function<T>::type;
 
-  std::multimap<std::string, std::shared_ptr<Cpp_function>> _funcs;
+  using Function_map =
+      std::multimap<std::string, std::shared_ptr<Cpp_function>>;
+
+  Function_map _funcs;
+
+  // Names of the functions and properties on each naming style, mapped to the
+  // name they were registered with (functions) or to their position in
+  // _properties, so the lookups done on every member access from the
+  // scripting languages do not need to scan all the members
+  std::array<std::unordered_map<std::string, std::string>, 2> m_function_index;
+  std::array<std::unordered_map<std::string, size_t>, 2> m_property_index;
+
+  void index_function(Function_map::const_iterator func);
+  void unindex_function(const std::string &name);
+  void index_property(size_t index);
+
+  Function_map::const_iterator find_function(const std::string &name) const;
+  const Cpp_property_name *find_property(const std::string &name) const;
 
   // Returns the base name of the given member
   std::string get_base_name(const std::string &member) const;
@@ -1734,7 +1751,7 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
     const auto registered_name = name.substr(0, name.find("|"));
     detect_overload_conflicts(registered_name, md);
 
-    _funcs.emplace(
+    index_function(_funcs.emplace(
         registered_name,
         std::shared_ptr<Cpp_function>(
             new Cpp_function(&md, [&md, func = std::forward<F>(func),
@@ -1752,7 +1769,7 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
                 return call<R, F, A...>(func, args, defs,
                                         std::index_sequence_for<A...>{});
               });
-            })));
+            }))));
 
     return &md;
   }
@@ -69,6 +69,9 @@ class SHCORE_PUBLIC Python_function final : public Function_base {
 
   Value invoke(const Argument_list &args) override;
 
+  // GIL is acquired when the function is invoked
+  bool thread_safe() const override { return true; }
+
  private:
   Python_context *_py{nullptr};
   py::Store m_function;
@@ -120,6 +120,8 @@ class SHCORE_PUBLIC Base_shell {
   std::shared_ptr<shcore::completer::Object_registry>
       _completer_object_registry;
   std::shared_ptr<shcore::completer::Provider_sql> _provider_sql;
+  // if set, finish_init() does not initialize any scripting language
+  bool m_skip_initial_mode = false;
 
   virtual void process_sql_result(
       const std::shared_ptr<mysqlshdk::db::IResult> &result,
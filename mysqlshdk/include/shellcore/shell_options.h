@@ -30,6 +30,8 @@
 #define SN_SHELL_OPTION_CHANGED "SN_SHELL_OPTION_CHANGED"
 
 #define SHCORE_RESULT_FORMAT "resultFormat"
+#define SHCORE_TABLE_SAMPLE_ROWS "resultFormat.tableSampleRows"
+#define SHCORE_TABLE_OVERFLOW "resultFormat.tableOverflow"
 #define SHCORE_INTERACTIVE "interactive"
 #define SHCORE_SHOW_WARNINGS "showWarnings"
 #define SHCORE_BATCH_CONTINUE_ON_ERROR "batchContinueOnError"
@@ -39,11 +41,16 @@
 #define SHCORE_DBA_GTID_WAIT_TIMEOUT "dba.gtidWaitTimeout"
 #define SHCORE_DBA_RESTART_WAIT_TIMEOUT "dba.restartWaitTimeout"
 #define SHCORE_DBA_LOG_SQL "dba.logSql"
+#define SHCORE_DBA_MAX_CONCURRENCY "dba.maxConcurrency"
+#define SHCORE_DBA_POOL_IDLE_TIMEOUT "dba.poolIdleTimeout"
 #define SHCORE_DBA_CONNECTIVITY_CHECKS "dba.connectivityChecks"
 #define SHCORE_LOG_FILE_NAME "logFile"
+#define SHCORE_LOG_ASYNC "logAsync"
+#define SHCORE_TRACE "trace"
 #define SHCORE_LOG_SQL "logSql"
 #define SHCORE_LOG_SQL_IGNORE "logSql.ignorePattern"
 #define SHCORE_LOG_SQL_IGNORE_UNSAFE "logSql.ignorePatternUnsafe"
+#define SHCORE_LOG_SQL_STATS_FILE "logSql.statsFile"
 
 #define SHCORE_HISTORY_MAX_SIZE "history.maxSize"
 #define SHCORE_HISTIGNORE "history.sql.ignorePattern"
@@ -66,6 +73,8 @@
 
 #define SHCORE_PROGRESS_REPORTING "progressReporting"
 
+#define SHCORE_SOURCE_BATCH_SIZE "sourceBatchSize"
+
 #include <stdlib.h>
 #include <array>
 #include <iostream>
@@ -98,10 +107,18 @@ class Shell_options final : public shcore::Options {
     std::string config_file;
     int timeout = 10;
     unsigned int buffer_size = 10240;
+    int tunnel_sessions = 1;
     std::string uri;
     std::string pwd;
     mysqlshdk::ssh::Ssh_connection_options uri_data;
   };
+  struct Util_settings {
+    // global limits shared by all utility operations, 0/empty if not limited
+    int max_threads = 0;
+    std::string max_rate;
+    // placement of the worker threads on the CPUs
+    std::string thread_affinity = "none";
+  };
   struct Storage {
     shcore::IShell_core::Mode initial_mode = shcore::IShell_core::Mode::None;
     std::string run_file;
@@ -117,9 +134,12 @@ class Shell_options final : public shcore::Options {
 
     mysqlshdk::db::Connection_options connection_data;
     Ssh_settings ssh;
+    Util_settings util;
 
     std::string result_format;
     std::string wrap_json;
+    int table_sample_rows = 1000;
+    std::string table_overflow;
     bool force = false;
     bool interactive = false;
     bool full_interactive = false;
@@ -139,12 +159,20 @@ class Shell_options final : public shcore::Options {
     int dba_gtid_wait_timeout = 60;
     int dba_restart_wait_timeout = 60;
     int dba_log_sql = 0;
+    // maximum number of instances AdminAPI contacts at the same time
+    int dba_max_concurrency = 16;
+    // seconds an idle AdminAPI session is kept between operations
+    int dba_pool_idle_timeout = 0;
     bool dba_connectivity_checks = false;
     std::string log_sql;  //< Global SQL logging level
     std::string log_sql_ignore;
     std::string log_sql_ignore_unsafe;
+    std::string log_sql_stats_file;
     shcore::Logger::LOG_LEVEL log_level = shcore::Logger::LOG_INFO;
     std::string log_file;
+    std::string log_async = "off";
+    // path to the trace file, tracing is disabled if empty
+    std::string trace;
     int verbose_level = 0;
     bool wizards = true;
     bool admin_mode = false;
@@ -169,8 +197,12 @@ class Shell_options final : public shcore::Options {
     std::string pager;
     Quiet_start quiet_start = Quiet_start::NOT_SET;
     bool show_column_type_info = false;
+    // maximum size of a batch of DML statements executed by SQL scripts
+    int source_batch_size = 0;
     bool default_compress = false;
     std::string dbug_options;
+    // prints how long each of the startup stages took
+    bool debug_startup = false;
 
     // override default plugin search path ; separated in windows, : elsewhere
     mysqlshdk::null_string plugins_path;
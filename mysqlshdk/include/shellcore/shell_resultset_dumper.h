@@ -35,6 +35,10 @@
 #include "mysqlshdk/libs/db/result.h"
 #include "mysqlshdk/libs/utils/enumset.h"
 
+namespace shcore {
+class JSON_dumper;
+}  // namespace shcore
+
 namespace mysqlsh {
 namespace mysqlx {
 class SqlResult;
@@ -101,6 +105,19 @@ class Resultset_printer {
   virtual std::string data() const { return ""; }
 };
 
+/**
+ * Determines how values which do not fit in a column of the table output are
+ * printed.
+ */
+enum class Table_overflow {
+  // value is printed in full, breaking the alignment of the table
+  EXPAND,
+  // value is truncated
+  TRUNCATE,
+  // value is wrapped into multiple lines
+  WRAP,
+};
+
 #define RESULTSET_DUMPER_FORMATS \
   "table, tabbed, vertical, json, ndjson, json/raw, json/array, json/pretty"
 /**
@@ -117,6 +134,13 @@ class Resultset_dumper_base {
                   (", " + format + ", ").c_str()) != nullptr;
   }
 
+  /**
+   * Converts the value of the resultFormat.tableOverflow option.
+   *
+   * @throws std::invalid_argument if value is not valid
+   */
+  static Table_overflow to_table_overflow(const std::string &value);
+
  protected:
   Resultset_dumper_base(mysqlshdk::db::IResult *target,
                         std::unique_ptr<Resultset_printer> printer,
@@ -131,6 +155,8 @@ class Resultset_dumper_base {
   std::string format_json(const std::string &item_label, bool is_doc_result,
                           bool pretty, int *count);
   virtual size_t dump_json(const std::string &item_label, bool is_doc_result);
+  size_t stream_json(const std::string &item_label, bool is_doc_result);
+  void append_json_summary(shcore::JSON_dumper *dumper, bool is_doc_result);
   void dump_warnings();
   std::string format_json_metadata(bool pretty);
   void dump_metadata();
@@ -139,6 +165,10 @@ class Resultset_dumper_base {
                          size_t min_label_width);
 
   mysqlshdk::db::IResult *m_result;
+  // number of rows used to calculate widths of the table columns, if 0,
+  // column metadata is used instead
+  size_t m_table_sample_rows;
+  Table_overflow m_table_overflow = Table_overflow::EXPAND;
   std::string m_wrap_json;
   std::string m_format;
   bool m_cancelled = false;
@@ -37,6 +37,14 @@
 #include "shellcore/ishell_core.h"
 #include "shellcore/shell_core.h"
 
+namespace mysqlshdk {
+namespace db {
+namespace mysql {
+class Session;
+}  // namespace mysql
+}  // namespace db
+}  // namespace mysqlshdk
+
 namespace shcore {
 
 struct Sql_result_info {
@@ -97,6 +105,26 @@ class SHCORE_PUBLIC Shell_sql : public Shell_language {
     mysqlshdk::utils::Sql_splitter *old_splitter;
   };
 
+  /**
+   * Consecutive statements of a script which are sent to the server in a
+   * single multi-statement request.
+   */
+  struct Sql_batch {
+    void add(std::string_view stmt, size_t line_num);
+
+    void clear();
+
+    bool empty() const { return lines.empty(); }
+
+    size_t size() const { return lines.size(); }
+
+    std::string sql;
+    // offsets of the statements in the sql
+    std::vector<size_t> offsets;
+    // line numbers of the statements
+    std::vector<size_t> lines;
+  };
+
   std::string *m_buffer = nullptr;
   mysqlshdk::utils::Sql_splitter *m_splitter = nullptr;
   Context m_base_context;
@@ -109,6 +137,10 @@ class SHCORE_PUBLIC Shell_sql : public Shell_language {
                    std::shared_ptr<mysqlshdk::db::ISession> session,
                    mysqlshdk::utils::Sql_splitter *splitter);
 
+  bool process_batch(
+      const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+      const Sql_batch &batch);
+
   std::pair<size_t, bool> handle_command(const char *p, size_t len, bool bol);
 
   void cmd_process_file(const std::vector<std::string> &params);
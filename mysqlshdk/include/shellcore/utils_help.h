@@ -332,8 +332,26 @@ class Help_registry {
   std::unique_lock<std::recursive_mutex> ensure_lock_threaded();
 
  private:
+  /**
+   * Help data registered in the global context, which is not yet stored in
+   * m_help_data.
+   */
+  struct Pending_help {
+    std::string token;
+    std::string data;
+    // if true, data needs to be split, token is the prefix
+    bool split;
+    bool auto_brief;
+    bool nosuffix;
+    bool is_shell_command;
+  };
+
   // Options will be stored on a MAP
-  Data_registry m_help_data;
+  mutable Data_registry m_help_data;
+
+  // Most of the help is registered at startup, but it is rarely used, help
+  // texts are split and stored once any of the help data is requested.
+  mutable std::vector<Pending_help> m_pending_help;
 
   // Holds all the registered topics
   std::deque<Help_topic> m_topics;
@@ -352,7 +370,7 @@ class Help_registry {
 
   Keyword_case_sensitive_registry m_cs_keywords;
 
-  std::recursive_mutex m_mutex;
+  mutable std::recursive_mutex m_mutex;
 
   std::recursive_mutex m_th_help;
 
@@ -380,6 +398,15 @@ class Help_registry {
 
   static bool icomp(const std::string &lhs, const std::string &rhs);
 
+  void split_help(const std::string &prefix, const std::string &data,
+                  bool auto_brief, bool nosuffix, bool is_shell_command) const;
+
+  void add_global_help(const std::string &token, const std::string &data);
+
+  void set_help_data(const std::string &token, const std::string &data) const;
+
+  void load_pending_help() const;
+
   // Helper functions for add_help_topic
   void register_topic(Help_topic *topic, bool new_topic,
                       IShell_core::Mode_mask mode);
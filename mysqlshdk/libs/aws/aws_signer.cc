@@ -42,6 +42,8 @@ namespace {
 const std::string k_empty_payload_hash =
     "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
 
+const std::string k_unsigned_payload = "UNSIGNED-PAYLOAD";
+
 const std::string k_authorization_header = "Authorization";
 const std::string k_host_header = "Host";
 const std::string k_date_header = "x-amz-date";
@@ -82,6 +84,10 @@ std::string hex_sha256(const char *data, size_t size) {
 Aws_signer::Aws_signer(const S3_bucket_config &config)
     : m_host(config.host()),
       m_region(config.region()),
+      // SigV4 allows to skip hashing of the payload, this is safe if the
+      // payload is sent over an encrypted connection
+      m_unsigned_payload(
+          shcore::str_ibeginswith(config.service_endpoint(), "https://")),
       m_credentials_provider(config.credentials_provider()) {
   update_credentials();
 }
@@ -116,9 +122,11 @@ rest::Headers Aws_signer::sign_request(const rest::Signed_request *request,
   }
 
   // hash of the payload - Hex(SHA256Hash(<payload>)
-  const auto &payload_hash = request->size
-                                 ? hex_sha256(request->body, request->size)
-                                 : k_empty_payload_hash;
+  const auto &payload_hash =
+      request->size ? (m_unsigned_payload
+                           ? k_unsigned_payload
+                           : hex_sha256(request->body, request->size))
+                    : k_empty_payload_hash;
 
   // add required headers
   result[k_host_header] = m_host;
@@ -227,20 +235,9 @@ rest::Headers Aws_signer::sign_request(const rest::Signed_request *request,
       hex_sha256(canonical_request.c_str(), canonical_request.length());
 
   // calculate signature
-  // DateKey = HMAC-SHA256("AWS4"+"<SecretAccessKey>", "<YYYYMMDD>")
-  const auto date_key =
-      shcore::ssl::hmac_sha256(m_secret_access_key, short_date);
-  // DateRegionKey = HMAC-SHA256(<DateKey>, "<aws-region>")
-  const auto date_region_key = shcore::ssl::hmac_sha256(date_key, m_region);
-  // DateRegionServiceKey = HMAC-SHA256(<DateRegionKey>, "<aws-service>")
-  const auto date_region_service_key =
-      shcore::ssl::hmac_sha256(date_region_key, m_service);
-  // SigningKey = HMAC-SHA256(<DateRegionServiceKey>, "aws4_request")
-  const auto signing_key =
-      shcore::ssl::hmac_sha256(date_region_service_key, "aws4_request");
   // signature = Hex(HMAC-SHA256(SigningKey, StringToSign))
-  const auto signature =
-      hex(shcore::ssl::hmac_sha256(signing_key, string_to_sign));
+  const auto signature = hex(shcore::ssl::hmac_sha256(
+      signing_key(short_date, scope), string_to_sign));
 
   // add Authorization header:
   // AWS4-HMAC-SHA256 Credential=<access key ID>/<Scope>,
@@ -265,6 +262,31 @@ rest::Headers Aws_signer::sign_request(const rest::Signed_request *request,
   return result;
 }
 
+std::vector<unsigned char> Aws_signer::signing_key(
+    const std::string &short_date, const std::string &scope) const {
+  std::vector<unsigned char> signing_key;
+
+  if (m_signing_key.get(scope, &signing_key)) {
+    return signing_key;
+  }
+
+  // DateKey = HMAC-SHA256("AWS4"+"<SecretAccessKey>", "<YYYYMMDD>")
+  const auto date_key =
+      shcore::ssl::hmac_sha256(m_secret_access_key, short_date);
+  // DateRegionKey = HMAC-SHA256(<DateKey>, "<aws-region>")
+  const auto date_region_key = shcore::ssl::hmac_sha256(date_key, m_region);
+  // DateRegionServiceKey = HMAC-SHA256(<DateRegionKey>, "<aws-service>")
+  const auto date_region_service_key =
+      shcore::ssl::hmac_sha256(date_region_key, m_service);
+  // SigningKey = HMAC-SHA256(<DateRegionServiceKey>, "aws4_request")
+  signing_key =
+      shcore::ssl::hmac_sha256(date_region_service_key, "aws4_request");
+
+  m_signing_key.set(scope, signing_key);
+
+  return signing_key;
+}
+
 bool Aws_signer::refresh_auth_data() { return update_credentials(); }
 
 bool Aws_signer::auth_data_expired(time_t now) const {
@@ -318,6 +340,9 @@ void Aws_signer::set_credentials(std::shared_ptr<Aws_credentials> credentials) {
 
   memcpy(m_secret_access_key.data(), "AWS4", prefix_size);
   memcpy(m_secret_access_key.data() + prefix_size, key.c_str(), key.size());
+
+  // key was derived using the previous secret
+  m_signing_key.clear();
 }
 
 }  // namespace aws
@@ -24,6 +24,7 @@
 #ifndef MYSQLSHDK_LIBS_AWS_AWS_SIGNER_H_
 #define MYSQLSHDK_LIBS_AWS_AWS_SIGNER_H_
 
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -42,7 +43,7 @@ namespace aws {
  * NOTE: this is currently tuned for S3:
  *  - CanonicalURI is URI-encoded once
  *  - CanonicalHeaders include: host, Content-Type (if specified), all x-amz-*.
- *  - Payload is signed.
+ *  - Payload is signed, unless requests are sent using HTTPS.
  *
  * Signer also assumes that query string parameters of the URI are listed
  * alphabetically and are already URI-encoded.
@@ -76,19 +77,75 @@ class Aws_signer : public rest::Signer {
   friend class Aws_signer_test;
 #endif  // FRIEND_TEST
 
+  /**
+   * Holds the signing key derived for the given scope. Copies start empty.
+   */
+  class Signing_key_cache final {
+   public:
+    Signing_key_cache() = default;
+
+    Signing_key_cache(const Signing_key_cache &) {}
+    Signing_key_cache(Signing_key_cache &&) {}
+
+    Signing_key_cache &operator=(const Signing_key_cache &) {
+      clear();
+      return *this;
+    }
+
+    Signing_key_cache &operator=(Signing_key_cache &&) {
+      clear();
+      return *this;
+    }
+
+    ~Signing_key_cache() = default;
+
+    bool get(const std::string &scope, std::vector<unsigned char> *key) const {
+      std::lock_guard lock{m_mutex};
+
+      if (scope != m_scope) return false;
+
+      *key = m_key;
+      return true;
+    }
+
+    void set(const std::string &scope, const std::vector<unsigned char> &key) {
+      std::lock_guard lock{m_mutex};
+      m_scope = scope;
+      m_key = key;
+    }
+
+    void clear() {
+      std::lock_guard lock{m_mutex};
+      m_scope.clear();
+      m_key.clear();
+    }
+
+   private:
+    mutable std::mutex m_mutex;
+    std::string m_scope;
+    std::vector<unsigned char> m_key;
+  };
+
   Aws_signer() = default;
 
   bool update_credentials();
 
   void set_credentials(std::shared_ptr<Aws_credentials> credentials);
 
+  std::vector<unsigned char> signing_key(const std::string &short_date,
+                                         const std::string &scope) const;
+
   std::string m_host;
   std::string m_region;
   std::string m_service = "s3";
   bool m_sign_all_headers = false;
+  // if true, payload is not hashed, its integrity is protected by TLS
+  bool m_unsigned_payload = false;
   Aws_credentials_provider *m_credentials_provider;
   std::shared_ptr<Aws_credentials> m_credentials;
   std::vector<unsigned char> m_secret_access_key;
+  // signing key changes once a day, it's derived using four HMAC operations
+  mutable Signing_key_cache m_signing_key;
 };
 
 }  // namespace aws
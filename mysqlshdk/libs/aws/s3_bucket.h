@@ -70,13 +70,16 @@ class S3_bucket : public storage::backend::object_storage::Container {
 
   void delete_objects(const std::vector<Object_details> &list);
 
-  void delete_objects(const std::vector<std::string> &list);
+  /**
+   * Uses the DeleteObjects request, which removes up to 1000 objects at once.
+   */
+  void delete_objects(const std::vector<std::string> &list) override;
 
  private:
   rest::Signed_request list_objects_request(
       const std::string &prefix, size_t limit, bool recursive,
-      const Object_details::Fields_mask &fields,
-      const std::string &start_from) override;
+      const Object_details::Fields_mask &fields, const std::string &start_from,
+      const std::string &start_after) override;
 
   std::vector<Object_details> parse_list_objects(
       const rest::Base_response_buffer &buffer, std::string *next_start_from,
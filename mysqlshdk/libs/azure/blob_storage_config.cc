@@ -69,6 +69,9 @@ Blob_storage_config::Blob_storage_config(const Blob_storage_options &options,
       m_account_name(options.m_storage_account),
       m_sas_token(options.m_storage_sas_token),
       m_operation(options.m_operation) {
+  m_background_upload_concurrency = DEFAULT_BLOB_UPLOAD_CONCURRENCY;
+  set_read_concurrency(DEFAULT_BLOB_READ_CONCURRENCY);
+
   m_sas_token_source =
       shcore::str_format("the '%s' option", options.storage_sas_token_option());
 
@@ -72,7 +72,13 @@ class Blob_storage_config : public Config {
 
   std::string describe_url(const std::string &url) const override;
 
-  static constexpr std::size_t DEFAULT_BLOB_BLOCK_SIZE = 128 * 1024 * 1024;
+  // throughput of a single Azure connection is relatively low, blobs are
+  // transferred using more concurrent requests, smaller blocks keep the memory
+  // usage the same as in case of other backends; a blob can have up to 50000
+  // blocks, so its size is limited to ~3 TiB
+  static constexpr std::size_t DEFAULT_BLOB_BLOCK_SIZE = 64 * 1024 * 1024;
+  static constexpr std::size_t DEFAULT_BLOB_UPLOAD_CONCURRENCY = 4;
+  static constexpr std::size_t DEFAULT_BLOB_READ_CONCURRENCY = 8;
 
   // Signature Caching in Azure is based not only in PATH and METHOD but also
   // in the HEADERS, so it is less likely to be a time saver considering
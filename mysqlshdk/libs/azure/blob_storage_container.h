@@ -77,6 +77,8 @@ class Blob_container : public Container {
 
   bool has_object_rename() const override { return false; }
 
+  bool has_list_objects_after() const override { return false; }
+
  private:
 #ifdef FRIEND_TEST
   FRIEND_TEST(Azure_signer_test, azure_requests);
@@ -96,7 +98,8 @@ class Blob_container : public Container {
   Signed_request list_objects_request(const std::string &prefix, size_t limit,
                                       bool recursive,
                                       const Object_details::Fields_mask &fields,
-                                      const std::string &start_from) override;
+                                      const std::string &start_from,
+                                      const std::string &start_after) override;
 
   std::vector<Object_details> parse_list_objects(
       const Base_response_buffer &buffer, std::string *next_start_from,
@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/arrow_batch.h"
+
+#include <cassert>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace mysqlshdk {
+namespace db {
+
+namespace {
+
+constexpr int64_t k_usec_per_sec = 1000000;
+constexpr int64_t k_sec_per_day = 86400;
+
+struct Buffers {
+  std::vector<uint8_t> validity;
+  // values of the fixed width columns, offsets of the variable width ones
+  std::vector<uint8_t> values;
+  std::string data;
+};
+
+struct Exported_array {
+  Buffers buffers;
+  std::vector<const void *> pointers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray *> child_pointers;
+};
+
+struct Exported_schema {
+  std::string name;
+  std::vector<ArrowSchema> children;
+  std::vector<ArrowSchema *> child_pointers;
+};
+
+void release_array(ArrowArray *array) {
+  assert(array && array->release);
+
+  for (int64_t i = 0; i < array->n_children; ++i) {
+    const auto child = array->children[i];
+
+    if (child->release) child->release(child);
+  }
+
+  delete static_cast<Exported_array *>(array->private_data);
+  array->release = nullptr;
+}
+
+void release_schema(ArrowSchema *schema) {
+  assert(schema && schema->release);
+
+  for (int64_t i = 0; i < schema->n_children; ++i) {
+    const auto child = schema->children[i];
+
+    if (child->release) child->release(child);
+  }
+
+  delete static_cast<Exported_schema *>(schema->private_data);
+  schema->release = nullptr;
+}
+
+/**
+ * Number of days since 1970-01-01 of the given date in proleptic Gregorian
+ * calendar.
+ */
+int64_t days_from_civil(int64_t y, unsigned m, unsigned d) {
+  y -= m <= 2;
+  const int64_t era = (y >= 0 ? y : y - 399) / 400;
+  const auto yoe = static_cast<unsigned>(y - era * 400);
+  const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+/**
+ * Converts the fractional part of seconds (digits following the dot) to
+ * microseconds.
+ */
+int64_t fraction_to_usec(std::string_view text) {
+  const auto dot = text.find('.');
+  if (std::string_view::npos == dot) return 0;
+
+  int64_t usec = 0;
+  int digits = 0;
+
+  for (auto it = text.begin() + dot + 1;
+       it != text.end() && digits < 6 && *it >= '0' && *it <= '9';
+       ++it, ++digits) {
+    usec = usec * 10 + (*it - '0');
+  }
+
+  for (; digits < 6; ++digits) usec *= 10;
+
+  return usec;
+}
+
+/**
+ * Parses the date part of DATE/DATETIME values, fails if it's a zero date.
+ */
+bool parse_date(const std::string &text, int64_t *out_days) {
+  int year = 0;
+  unsigned month = 0;
+  unsigned day = 0;
+
+  if (3 != sscanf(text.c_str(), "%d-%u-%u", &year, &month, &day) ||
+      0 == month || 0 == day) {
+    return false;
+  }
+
+  *out_days = days_from_civil(year, month, day);
+  return true;
+}
+
+bool parse_datetime(const std::string &text, int64_t *out_usec) {
+  int64_t days = 0;
+
+  if (!parse_date(text, &days)) return false;
+
+  unsigned hour = 0;
+  unsigned minute = 0;
+  unsigned second = 0;
+
+  if (const auto space = text.find(' '); std::string::npos != space) {
+    sscanf(text.c_str() + space + 1, "%u:%u:%u", &hour, &minute, &second);
+  }
+
+  *out_usec = ((days * k_sec_per_day) + hour * 3600 + minute * 60 + second) *
+                  k_usec_per_sec +
+              fraction_to_usec(text);
+  return true;
+}
+
+bool parse_time(const std::string &text, int64_t *out_usec) {
+  const bool negative = !text.empty() && '-' == text[0];
+  unsigned hour = 0;
+  unsigned minute = 0;
+  unsigned second = 0;
+
+  if (3 != sscanf(text.c_str() + (negative ? 1 : 0), "%u:%u:%u", &hour,
+                  &minute, &second)) {
+    return false;
+  }
+
+  const int64_t usec =
+      (int64_t{hour} * 3600 + minute * 60 + second) * k_usec_per_sec +
+      fraction_to_usec(text);
+  *out_usec = negative ? -usec : usec;
+  return true;
+}
+
+}  // namespace
+
+class Arrow_batch_builder::Column_builder final {
+ public:
+  explicit Column_builder(const Column &column)
+      : m_name(column.get_column_label()), m_type(column.get_type()) {
+    switch (m_type) {
+      case Type::Null:
+        m_format = "n";
+        m_width = 0;
+        break;
+
+      case Type::Integer:
+        m_format = "l";
+        m_width = sizeof(int64_t);
+        break;
+
+      case Type::UInteger:
+      case Type::Bit:
+        m_format = "L";
+        m_width = sizeof(uint64_t);
+        break;
+
+      case Type::Float:
+        m_format = "f";
+        m_width = sizeof(float);
+        break;
+
+      case Type::Double:
+        m_format = "g";
+        m_width = sizeof(double);
+        break;
+
+      case Type::Date:
+        m_format = "tdD";
+        m_width = sizeof(int32_t);
+        break;
+
+      case Type::DateTime:
+        m_format = "tsu:";
+        m_width = sizeof(int64_t);
+        break;
+
+      case Type::Time:
+        m_format = "tDu";
+        m_width = sizeof(int64_t);
+        break;
+
+      case Type::Bytes:
+      case Type::Geometry:
+        m_format = "Z";
+        m_variable = true;
+        break;
+
+      case Type::String:
+      case Type::Decimal:
+      case Type::Json:
+      case Type::Enum:
+      case Type::Set:
+        m_format = "U";
+        m_variable = true;
+        break;
+    }
+
+    reset();
+  }
+
+  void append(const IRow &row, uint32_t index) {
+    if (row.is_null(index)) {
+      append_null();
+      return;
+    }
+
+    switch (m_type) {
+      case Type::Null:
+        append_null();
+        break;
+
+      case Type::Integer:
+        append_value(row.get_int(index));
+        break;
+
+      case Type::UInteger:
+        append_value(row.get_uint(index));
+        break;
+
+      case Type::Bit:
+        append_value(std::get<0>(row.get_bit(index)));
+        break;
+
+      case Type::Float:
+        append_value(row.get_float(index));
+        break;
+
+      case Type::Double:
+        append_value(row.get_double(index));
+        break;
+
+      case Type::Date: {
+        int64_t days = 0;
+
+        if (parse_date(row.get_string(index), &days))
+          append_value(static_cast<int32_t>(days));
+        else
+          append_null();
+        break;
+      }
+
+      case Type::DateTime: {
+        int64_t usec = 0;
+
+        if (parse_datetime(row.get_string(index), &usec))
+          append_value(usec);
+        else
+          append_null();
+        break;
+      }
+
+      case Type::Time: {
+        int64_t usec = 0;
+
+        if (parse_time(row.get_string(index), &usec))
+          append_value(usec);
+        else
+          append_null();
+        break;
+      }
+
+      case Type::Decimal: {
+        const auto value = row.get_as_string(index);
+        append_data(value.data(), value.length());
+        break;
+      }
+
+      case Type::Bytes:
+      case Type::Geometry:
+      case Type::String:
+      case Type::Json:
+      case Type::Enum:
+      case Type::Set: {
+        const auto data = row.get_string_data(index);
+        append_data(data.first, data.second);
+        break;
+      }
+    }
+  }
+
+  void export_schema(ArrowSchema *out) const {
+    const auto data = new Exported_schema();
+    data->name = m_name;
+
+    *out = {};
+    out->format = m_format;
+    out->name = data->name.c_str();
+    out->flags = ARROW_FLAG_NULLABLE;
+    out->release = release_schema;
+    out->private_data = data;
+  }
+
+  void export_array(ArrowArray *out) {
+    const auto data = new Exported_array();
+    data->buffers = std::exchange(m_buffers, {});
+
+    const auto &buffers = data->buffers;
+
+    if (Type::Null != m_type) {
+      data->pointers.emplace_back(m_null_count ? buffers.validity.data()
+                                               : nullptr);
+      data->pointers.emplace_back(buffers.values.data());
+
+      if (m_variable) data->pointers.emplace_back(buffers.data.data());
+    }
+
+    *out = {};
+    out->length = m_length;
+    out->null_count = m_null_count;
+    out->n_buffers = static_cast<int64_t>(data->pointers.size());
+    out->buffers = data->pointers.data();
+    out->release = release_array;
+    out->private_data = data;
+
+    reset();
+  }
+
+ private:
+  void reset() {
+    m_length = 0;
+    m_null_count = 0;
+    m_buffers = {};
+
+    // offsets of the variable width columns always start with 0
+    if (m_variable) append_offset();
+  }
+
+  void append_validity(bool valid) {
+    if (0 == m_length % 8) m_buffers.validity.emplace_back(0);
+    if (valid) m_buffers.validity.back() |= 1 << (m_length % 8);
+    ++m_length;
+  }
+
+  void append_null() {
+    append_validity(false);
+    ++m_null_count;
+
+    if (m_variable) {
+      append_offset();
+    } else {
+      m_buffers.values.resize(m_buffers.values.size() + m_width);
+    }
+  }
+
+  template <typename T>
+  void append_value(T value) {
+    assert(sizeof(T) == m_width);
+    append_validity(true);
+    append_bytes(&value, sizeof(value));
+  }
+
+  void append_data(const char *data, size_t length) {
+    append_validity(true);
+    m_buffers.data.append(data, length);
+    append_offset();
+  }
+
+  void append_offset() {
+    const auto offset = static_cast<int64_t>(m_buffers.data.length());
+    append_bytes(&offset, sizeof(offset));
+  }
+
+  void append_bytes(const void *data, size_t length) {
+    auto &values = m_buffers.values;
+    const auto size = values.size();
+
+    values.resize(size + length);
+    memcpy(values.data() + size, data, length);
+  }
+
+  std::string m_name;
+  Type m_type;
+  const char *m_format = nullptr;
+  size_t m_width = 0;
+  bool m_variable = false;
+
+  Buffers m_buffers;
+  int64_t m_length = 0;
+  int64_t m_null_count = 0;
+};
+
+Arrow_batch_builder::Arrow_batch_builder(const std::vector<Column> &columns) {
+  m_columns.reserve(columns.size());
+
+  for (const auto &column : columns) {
+    m_columns.emplace_back(std::make_unique<Column_builder>(column));
+  }
+}
+
+Arrow_batch_builder::~Arrow_batch_builder() = default;
+
+void Arrow_batch_builder::append(const IRow &row) {
+  assert(row.num_fields() == m_columns.size());
+
+  for (uint32_t i = 0, size = m_columns.size(); i < size; ++i) {
+    m_columns[i]->append(row, i);
+  }
+
+  ++m_size;
+}
+
+void Arrow_batch_builder::export_schema(ArrowSchema *out) const {
+  const auto data = new Exported_schema();
+  const auto size = m_columns.size();
+
+  data->children.resize(size);
+  data->child_pointers.resize(size);
+
+  for (size_t i = 0; i < size; ++i) {
+    m_columns[i]->export_schema(&data->children[i]);
+    data->child_pointers[i] = &data->children[i];
+  }
+
+  *out = {};
+  out->format = "+s";
+  out->name = "";
+  out->n_children = static_cast<int64_t>(size);
+  out->children = data->child_pointers.data();
+  out->release = release_schema;
+  out->private_data = data;
+}
+
+void Arrow_batch_builder::export_batch(ArrowArray *out) {
+  const auto data = new Exported_array();
+  const auto size = m_columns.size();
+
+  data->children.resize(size);
+  data->child_pointers.resize(size);
+
+  for (size_t i = 0; i < size; ++i) {
+    m_columns[i]->export_array(&data->children[i]);
+    data->child_pointers[i] = &data->children[i];
+  }
+
+  // struct arrays have a single buffer (validity), all rows are valid
+  data->pointers.emplace_back(nullptr);
+
+  *out = {};
+  out->length = static_cast<int64_t>(m_size);
+  out->n_buffers = 1;
+  out->buffers = data->pointers.data();
+  out->n_children = static_cast<int64_t>(size);
+  out->children = data->child_pointers.data();
+  out->release = release_array;
+  out->private_data = data;
+
+  m_size = 0;
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_DB_ARROW_BATCH_H_
+#define MYSQLSHDK_LIBS_DB_ARROW_BATCH_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row.h"
+#include "mysqlshdk_export.h"
+
+// Structures of the Arrow C data interface, as defined by the specification:
+// https://arrow.apache.org/docs/format/CDataInterface.html
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+struct ArrowSchema {
+  // Array type description
+  const char *format;
+  const char *name;
+  const char *metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema **children;
+  struct ArrowSchema *dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowSchema *);
+  // Opaque producer-specific data
+  void *private_data;
+};
+
+struct ArrowArray {
+  // Array data description
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void **buffers;
+  struct ArrowArray **children;
+  struct ArrowArray *dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowArray *);
+  // Opaque producer-specific data
+  void *private_data;
+};
+
+}  // extern "C"
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+namespace mysqlshdk {
+namespace db {
+
+/**
+ * Builds columnar Arrow record batches out of the rows of a result, the data
+ * is written directly to the Arrow buffers, and exported using the Arrow C
+ * data interface, so it can be consumed (i.e. by pyarrow) without any copies.
+ *
+ * Columns are mapped to the Arrow types as follows:
+ *  - signed/unsigned integers and BIT - int64/uint64
+ *  - FLOAT/DOUBLE - float32/float64
+ *  - DATE - date32, DATETIME/TIMESTAMP - timestamp[us], TIME - duration[us],
+ *    zero dates are exported as nulls
+ *  - binary strings and geometry - large_binary
+ *  - all the remaining types (including DECIMAL) - large_utf8
+ */
+class SHCORE_PUBLIC Arrow_batch_builder final {
+ public:
+  /**
+   * Default number of rows in a record batch.
+   */
+  static constexpr uint64_t k_default_batch_size = 65536;
+
+  explicit Arrow_batch_builder(const std::vector<Column> &columns);
+
+  Arrow_batch_builder(const Arrow_batch_builder &) = delete;
+  Arrow_batch_builder(Arrow_batch_builder &&) = default;
+
+  Arrow_batch_builder &operator=(const Arrow_batch_builder &) = delete;
+  Arrow_batch_builder &operator=(Arrow_batch_builder &&) = default;
+
+  ~Arrow_batch_builder();
+
+  /**
+   * Appends the given row to the current batch.
+   */
+  void append(const IRow &row);
+
+  /**
+   * @return Number of rows in the current batch.
+   */
+  uint64_t size() const { return m_size; }
+
+  /**
+   * Exports the schema of the record batches (a struct with a child for each
+   * column).
+   *
+   * @param out Receives the schema, caller is responsible for releasing it.
+   */
+  void export_schema(ArrowSchema *out) const;
+
+  /**
+   * Exports the current batch (a struct array with a child for each column).
+   * The ownership of the data is transferred to the exported array, and the
+   * builder is ready to start a new batch.
+   *
+   * @param out Receives the batch, caller is responsible for releasing it.
+   */
+  void export_batch(ArrowArray *out);
+
+ private:
+  class Column_builder;
+
+  std::vector<std::unique_ptr<Column_builder>> m_columns;
+  uint64_t m_size = 0;
+};
+
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_ARROW_BATCH_H_
@@ -24,8 +24,10 @@
 #include "mysqlshdk/libs/db/mysql/result.h"
 
 #include <cstdlib>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "mysqlshdk/libs/db/charset.h"
 #include "mysqlshdk/libs/db/mysql/row.h"
@@ -149,33 +151,135 @@ static std::string fieldflags2str(unsigned int f) {
   return s.str();
 }
 
-void Result::fetch_metadata() {
-  int num_fields = 0;
+std::shared_ptr<Field_names> Result_metadata::field_names() const {
+  std::lock_guard lock{m_mutex};
+
+  if (!m_field_names) {
+    m_field_names = std::make_shared<Field_names>(m_columns);
+  }
+
+  return m_field_names;
+}
+
+std::string Result_metadata_cache::signature(const MYSQL_FIELD *fields,
+                                             unsigned int count) {
+  std::string result;
+
+  const auto append_number = [&result](auto value) {
+    result.append(reinterpret_cast<const char *>(&value), sizeof(value));
+  };
+
+  const auto append_string = [&](const char *value, unsigned int length) {
+    append_number(length);
+
+    if (length) {
+      result.append(value, length);
+    }
+  };
+
+  for (unsigned int i = 0; i < count; ++i) {
+    const auto &f = fields[i];
+
+    append_string(f.catalog, f.catalog_length);
+    append_string(f.db, f.db_length);
+    append_string(f.org_table, f.org_table_length);
+    append_string(f.table, f.table_length);
+    append_string(f.org_name, f.org_name_length);
+    append_string(f.name, f.name_length);
+    append_number(f.length);
+    append_number(f.decimals);
+    append_number(f.charsetnr);
+    append_number(f.flags);
+    append_number(f.type);
+  }
+
+  return result;
+}
+
+std::shared_ptr<const Result_metadata> Result_metadata_cache::get(
+    const std::string &signature) {
+  const auto it = m_index.find(signature);
+
+  if (m_index.end() == it) {
+    return {};
+  }
+
+  // move to front, this is the most recently used entry
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+  return it->second->second;
+}
+
+void Result_metadata_cache::put(
+    std::string signature, std::shared_ptr<const Result_metadata> metadata) {
+  if (0 == m_size || m_index.count(signature)) {
+    return;
+  }
+
+  while (m_entries.size() >= m_size) {
+    m_index.erase(m_entries.back().first);
+    m_entries.pop_back();
+  }
 
-  _metadata.clear();
+  m_entries.emplace_front(std::move(signature), std::move(metadata));
+  m_index.emplace(m_entries.front().first, m_entries.begin());
+}
+
+void Result_metadata_cache::clear() {
+  m_index.clear();
+  m_entries.clear();
+}
+
+void Result::fetch_metadata() {
+  _metadata.reset();
 
   // res could be NULL on queries not returning data
   std::shared_ptr<MYSQL_RES> res = _result.lock();
 
-  if (res) {
-    num_fields = mysql_num_fields(res.get());
-    MYSQL_FIELD *fields = mysql_fetch_fields(res.get());
-
-    for (int index = 0; index < num_fields; index++) {
-      _metadata.push_back(mysqlshdk::db::Column(
-          fields[index].catalog, fields[index].db, fields[index].org_table,
-          fields[index].table, fields[index].org_name, fields[index].name,
-          fields[index].length, fields[index].decimals,
-          map_data_type(fields[index].type, fields[index].flags,
-                        fields[index].charsetnr),
-          fields[index].charsetnr,
-          static_cast<bool>(fields[index].flags & UNSIGNED_FLAG),
-          static_cast<bool>(fields[index].flags & ZEROFILL_FLAG),
-          static_cast<bool>(fields[index].flags & BINARY_FLAG),
-          fieldflags2str(fields[index].flags),
-          fieldtype2str(fields[index].type)));
+  if (!res) {
+    return;
+  }
+
+  const auto num_fields = mysql_num_fields(res.get());
+  const auto fields = mysql_fetch_fields(res.get());
+  const auto session = _session.lock();
+  std::string signature;
+
+  if (session) {
+    signature = Result_metadata_cache::signature(fields, num_fields);
+
+    if ((_metadata = session->m_metadata_cache.get(signature))) {
+      return;
     }
   }
+
+  std::vector<Column> columns;
+  columns.reserve(num_fields);
+
+  for (unsigned int index = 0; index < num_fields; index++) {
+    columns.emplace_back(
+        fields[index].catalog, fields[index].db, fields[index].org_table,
+        fields[index].table, fields[index].org_name, fields[index].name,
+        fields[index].length, fields[index].decimals,
+        map_data_type(fields[index].type, fields[index].flags,
+                      fields[index].charsetnr),
+        fields[index].charsetnr,
+        static_cast<bool>(fields[index].flags & UNSIGNED_FLAG),
+        static_cast<bool>(fields[index].flags & ZEROFILL_FLAG),
+        static_cast<bool>(fields[index].flags & BINARY_FLAG),
+        fieldflags2str(fields[index].flags), fieldtype2str(fields[index].type));
+  }
+
+  _metadata = std::make_shared<const Result_metadata>(std::move(columns));
+
+  if (session) {
+    session->m_metadata_cache.put(std::move(signature), _metadata);
+  }
+}
+
+const std::vector<Column> &Result::get_metadata() const {
+  static const std::vector<Column> k_no_columns;
+  return _metadata ? _metadata->columns() : k_no_columns;
 }
 
 Result::~Result() = default;
@@ -184,8 +288,10 @@ const IRow *Result::fetch_one() {
   if (_pre_fetched) {
     if (!_persistent_pre_fetch) {
       if (!_pre_fetched_rows.empty()) {
-        if (_fetched_row_count > 0)  // free the previously fetched row
+        if (_fetched_row_count > 0) {  // free the previously fetched row
+          m_pre_fetched_memory.shrink(_pre_fetched_rows.front().memory_size());
           _pre_fetched_rows.pop_front();
+        }
         if (!_pre_fetched_rows.empty()) {
           // return the next row, but don't pop it yet otherwise it'll be freed
           const IRow *row = &_pre_fetched_rows.front();
@@ -207,6 +313,7 @@ const IRow *Result::fetch_one() {
     if (_pre_fetched_clear_at_end) {
       assert(_pre_fetched_rows.size() == 1);
       _pre_fetched_rows.clear();
+      m_pre_fetched_memory.resize(0);
       _pre_fetched_clear_at_end = false;
     }
 
@@ -249,6 +356,32 @@ const IRow *Result::fetch_one() {
   return nullptr;
 }
 
+std::size_t Result::fetch_block(Row_block *block) {
+  assert(block->fields() == get_metadata().size());
+
+  std::size_t rows = 0;
+
+  while (!block->full()) {
+    const auto row = fetch_one();
+
+    if (!row) {
+      break;
+    }
+
+    if (const auto raw = client_row(row)) {
+      block->add(raw->raw_data(), raw->raw_lengths());
+    } else {
+      block->add(row);
+    }
+
+    ++rows;
+  }
+
+  block->seal();
+
+  return rows;
+}
+
 void Result::fetch_statement_id() {
   if (!m_statement_id.has_value()) {
     if (auto s = _session.lock()) {
@@ -327,6 +460,7 @@ void Result::reset(std::shared_ptr<MYSQL_RES> res) {
   _pre_fetched_clear_at_end = false;
   _fetched_row_count = 0;
   _pre_fetched_rows.clear();
+  m_pre_fetched_memory.resize(0);
   _result = std::move(res);
 
   if (res) {
@@ -355,6 +489,7 @@ bool Result::pre_fetch_row() {
     if (!has_resultset()) return false;
 
     _pre_fetched_rows.emplace_back(*fetch_one());
+    m_pre_fetched_memory.grow(_pre_fetched_rows.back().memory_size());
     _fetched_row_count = 0;
     _pre_fetched = true;
     _pre_fetched_clear_at_end = true;
@@ -363,14 +498,24 @@ bool Result::pre_fetch_row() {
 }
 
 bool Result::pre_fetch_rows(bool persistent) {
+  if (_pre_fetched && _persistent_pre_fetch) {
+    // all rows are already held in memory
+    return true;
+  }
+
   auto result = _result.lock();
   if (result) {
     _persistent_pre_fetch = persistent;
     _stop_pre_fetch = false;
     if (!has_resultset()) return false;
+
+    std::size_t memory = 0;
+    shcore::on_leave_scope track_memory(
+        [this, &memory]() { m_pre_fetched_memory.grow(memory); });
+
     while (auto row = fetch_one()) {
       if (_stop_pre_fetch) return true;
-      _pre_fetched_rows.emplace_back(*row);
+      memory += _pre_fetched_rows.emplace_back(*row).memory_size();
     }
     _fetched_row_count = 0;
 
@@ -381,11 +526,107 @@ bool Result::pre_fetch_rows(bool persistent) {
 
 void Result::stop_pre_fetch() { _stop_pre_fetch = true; }
 
+void Result::fetch_prepared(MYSQL_STMT *stmt,
+                            std::shared_ptr<MYSQL_RES> metadata) {
+  reset(nullptr);
+
+  if (!metadata) {
+    return;
+  }
+
+  m_prepared_metadata = std::move(metadata);
+  _result = m_prepared_metadata;
+  _has_resultset = true;
+  fetch_metadata();
+
+  // initial size of the buffers, grown if value does not fit
+  constexpr std::size_t k_buffer_size = 256;
+  const auto fields = get_metadata().size();
+  std::vector<MYSQL_BIND> binds(fields);
+  std::vector<std::string> buffers(fields, std::string(k_buffer_size, '\0'));
+  std::vector<unsigned long> lengths(fields);
+  std::vector<char *> values(fields);
+  const auto nulls = std::make_unique<bool[]>(fields);
+
+  const auto bind = [&](std::size_t i) {
+    auto &b = binds[i];
+
+    b = {};
+    b.buffer_type = MYSQL_TYPE_STRING;
+    b.buffer = buffers[i].data();
+    b.buffer_length = buffers[i].size();
+    b.length = &lengths[i];
+    b.is_null = &nulls[i];
+  };
+
+  const auto throw_error = [stmt]() {
+    throw mysqlshdk::db::Error(mysql_stmt_error(stmt), mysql_stmt_errno(stmt),
+                               mysql_stmt_sqlstate(stmt));
+  };
+
+  for (std::size_t i = 0; i < fields; ++i) {
+    bind(i);
+  }
+
+  if (mysql_stmt_bind_result(stmt, binds.data())) {
+    throw_error();
+  }
+
+  _row.reset(new Row(this));
+
+  while (true) {
+    const auto rc = mysql_stmt_fetch(stmt);
+
+    if (MYSQL_NO_DATA == rc) {
+      break;
+    }
+
+    if (1 == rc) {
+      throw_error();
+    }
+
+    if (MYSQL_DATA_TRUNCATED == rc) {
+      bool rebind = false;
+
+      for (std::size_t i = 0; i < fields; ++i) {
+        if (!nulls[i] && lengths[i] > buffers[i].size()) {
+          buffers[i].resize(lengths[i]);
+          bind(i);
+
+          if (mysql_stmt_fetch_column(stmt, &binds[i], i, 0)) {
+            throw_error();
+          }
+
+          rebind = true;
+        }
+      }
+
+      // buffers were reallocated
+      if (rebind && mysql_stmt_bind_result(stmt, binds.data())) {
+        throw_error();
+      }
+    }
+
+    for (std::size_t i = 0; i < fields; ++i) {
+      values[i] = nulls[i] ? nullptr : buffers[i].data();
+    }
+
+    _row->reset(values.data(), lengths.data());
+    m_pre_fetched_memory.grow(
+        _pre_fetched_rows.emplace_back(*_row).memory_size());
+  }
+
+  _row.reset(new Row(this));
+  _fetched_row_count = 0;
+  _pre_fetched = true;
+  _persistent_pre_fetch = true;
+  fetch_statement_id();
+}
+
 std::shared_ptr<Field_names> Result::field_names() const {
   if (!_field_names) {
-    _field_names = std::make_shared<Field_names>();
-    for (const auto &column : _metadata)
-      _field_names->add(column.get_column_label());
+    _field_names = _metadata ? _metadata->field_names()
+                             : std::make_shared<Field_names>();
   }
   return _field_names;
 }
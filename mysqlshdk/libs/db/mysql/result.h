@@ -27,13 +27,19 @@
 #ifndef MYSQLSHDK_LIBS_DB_MYSQL_RESULT_H_
 #define MYSQLSHDK_LIBS_DB_MYSQL_RESULT_H_
 
+#include "mysqlshdk/libs/db/mysql/row.h"
+#include "mysqlshdk/libs/db/mysql/row_block.h"
 #include "mysqlshdk/libs/db/result.h"
+#include "mysqlshdk/libs/utils/memory_stats.h"
 
 #include <deque>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <mysql.h>
@@ -42,7 +48,84 @@ namespace mysqlshdk {
 namespace db {
 namespace mysql {
 class Session_impl;
-class Row;
+
+/**
+ * Immutable metadata of a result set. Results which have identical columns
+ * share the same instance.
+ */
+class Result_metadata final {
+ public:
+  explicit Result_metadata(std::vector<Column> columns)
+      : m_columns(std::move(columns)) {}
+
+  Result_metadata(const Result_metadata &) = delete;
+  Result_metadata(Result_metadata &&) = delete;
+
+  Result_metadata &operator=(const Result_metadata &) = delete;
+  Result_metadata &operator=(Result_metadata &&) = delete;
+
+  const std::vector<Column> &columns() const { return m_columns; }
+
+  /**
+   * Provides the map of column labels, it's created on the first use.
+   *
+   * @throws std::invalid_argument if column labels are not unique
+   */
+  std::shared_ptr<Field_names> field_names() const;
+
+ private:
+  const std::vector<Column> m_columns;
+  mutable std::mutex m_mutex;
+  mutable std::shared_ptr<Field_names> m_field_names;
+};
+
+/**
+ * Holds the metadata of the most recently used result sets, so that results
+ * of the repeatedly executed statements do not have to recreate it.
+ *
+ * Entries are identified by a signature of all the attributes of all the
+ * columns, metadata is reused only if the server sent identical columns.
+ */
+class Result_metadata_cache final {
+ public:
+  explicit Result_metadata_cache(std::size_t size = 64) : m_size(size) {}
+
+  Result_metadata_cache(const Result_metadata_cache &) = delete;
+  Result_metadata_cache(Result_metadata_cache &&) = delete;
+
+  Result_metadata_cache &operator=(const Result_metadata_cache &) = delete;
+  Result_metadata_cache &operator=(Result_metadata_cache &&) = delete;
+
+  /**
+   * Creates signature of the given columns.
+   */
+  static std::string signature(const MYSQL_FIELD *fields, unsigned int count);
+
+  /**
+   * Finds the metadata with the given signature.
+   *
+   * @returns cached metadata, nullptr if it's not cached
+   */
+  std::shared_ptr<const Result_metadata> get(const std::string &signature);
+
+  /**
+   * Stores the metadata, evicting the least recently used entry if cache is
+   * full.
+   */
+  void put(std::string signature,
+           std::shared_ptr<const Result_metadata> metadata);
+
+  std::size_t size() const { return m_entries.size(); }
+
+  void clear();
+
+ private:
+  const std::size_t m_size;
+  // cached metadata, most recently used first
+  std::list<std::pair<std::string, std::shared_ptr<const Result_metadata>>>
+      m_entries;
+  std::unordered_map<std::string, decltype(m_entries)::iterator> m_index;
+};
 
 class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
                              public std::enable_shared_from_this<Result> {
@@ -53,6 +136,18 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
 
   // Data Retrieving
   virtual const IRow *fetch_one();
+
+  /**
+   * Fetches the rows into the given block, until it's full or there are no
+   * more rows. Values are copied into the memory of the block, which is
+   * reused, so there are no per-row allocations. Block is sealed and can be
+   * read once this method returns.
+   *
+   * @param block Block to which the rows are appended.
+   *
+   * @returns number of rows which were fetched, 0 if there are no more rows
+   */
+  std::size_t fetch_block(Row_block *block);
   virtual bool next_resultset();
   virtual std::unique_ptr<Warning> fetch_one_warning();
 
@@ -66,7 +161,7 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   virtual uint64_t get_warning_count() const;
   virtual std::string get_info() const { return _info; }
   virtual const std::vector<std::string> &get_gtids() const { return _gtids; }
-  virtual const std::vector<Column> &get_metadata() const { return _metadata; }
+  virtual const std::vector<Column> &get_metadata() const;
   virtual std::string get_statement_id() const;
 
   virtual void buffer();
@@ -74,6 +169,18 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
 
   bool is_buffered() { return m_buffered; }
 
+  /**
+   * Checks if the given row (returned by fetch_one()) was read directly from
+   * the client library, and its raw data can be accessed.
+   *
+   * @param row Row returned by fetch_one().
+   *
+   * @returns the given row, or nullptr if it was i.e. pre-fetched
+   */
+  inline const Row *client_row(const IRow *row) const {
+    return row == _row.get() ? _row.get() : nullptr;
+  }
+
  protected:
   Result(std::shared_ptr<mysqlshdk::db::mysql::Session_impl> owner,
          uint64_t affected_rows, uint64_t last_insert_id, const char *info,
@@ -81,6 +188,7 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   void reset(std::shared_ptr<MYSQL_RES> res);
 
   std::deque<mysqlshdk::db::Row_copy> _pre_fetched_rows;
+  shcore::Tracked_memory m_pre_fetched_memory{shcore::Memory_tag::RESULTS};
   // size_t _fetched_row_count = 0;
   // size_t _fetched_warning_count = 0;
   bool _stop_pre_fetch = false;
@@ -92,6 +200,13 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   bool pre_fetch_rows(bool persistent);
   void stop_pre_fetch();
 
+  /**
+   * Fetches all rows of an executed prepared statement. Values are converted
+   * to their text representation by the client library, so that rows behave
+   * the same as the ones returned by a regular query.
+   */
+  void fetch_prepared(MYSQL_STMT *stmt, std::shared_ptr<MYSQL_RES> metadata);
+
   void fetch_metadata();
   void fetch_statement_id();
   Type map_data_type(int raw_type, int flags, int collation_id);
@@ -99,7 +214,8 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   virtual std::shared_ptr<Field_names> field_names() const;
 
   std::weak_ptr<mysqlshdk::db::mysql::Session_impl> _session;
-  std::vector<Column> _metadata;
+  // shared with other results which have identical columns
+  std::shared_ptr<const Result_metadata> _metadata;
   std::unique_ptr<Row> _row;
   std::weak_ptr<MYSQL_RES> _result;
   std::vector<std::string> _gtids;
@@ -113,6 +229,8 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   bool _fetched_warnings = false;
   bool m_buffered = false;
   std::optional<std::string> m_statement_id;
+  // metadata of a prepared statement, _result refers to it
+  std::shared_ptr<MYSQL_RES> m_prepared_metadata;
 };
 }  // namespace mysql
 }  // namespace db
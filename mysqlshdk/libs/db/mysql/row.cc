@@ -26,9 +26,11 @@
 #include <climits>  // C limit constants
 #include <cmath>    // HUGE_VAL
 #include <limits>   // std::numeric_limits
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include "mysqlshdk/libs/db/mysql/result.h"
+#include "mysqlshdk/libs/utils/dtoa.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 #define bit_uint1korr(A) (*(((uint8_t *)(A))))
@@ -233,9 +235,15 @@ double Row::get_double(uint32_t index) const {
   VALIDATE_TYPE(index, (ftype == Type::Float || ftype == Type::Double ||
                         ftype == Type::Decimal));
 
-  ret_val = strtod(_row[index], nullptr);
-  if (errno == ERANGE && (ret_val == HUGE_VAL || ret_val == -HUGE_VAL))
+  try {
+    ret_val = shcore::str_to_double({_row[index], _lengths[index]});
+  } catch (const std::out_of_range &) {
     throw FIELD_ERROR(index, "double value out of the allowed range");
+  } catch (const std::invalid_argument &) {
+    // same as strtod()
+    ret_val = 0;
+  }
+
   return ret_val;
 }
 
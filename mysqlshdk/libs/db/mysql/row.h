@@ -68,6 +68,10 @@ class SHCORE_PUBLIC Row : public mysqlshdk::db::IRow {
     _lengths = lengths;
   }
 
+  inline MYSQL_ROW raw_data() const { return _row; }
+
+  inline const unsigned long *raw_lengths() const { return _lengths; }
+
  private:
   friend class Result;
   explicit Row(Result *result);
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "mysqlshdk/libs/db/mysql/row_block.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace mysql {
+
+void Row_block::add(MYSQL_ROW row, const unsigned long *lengths) {
+  for (std::size_t i = 0; i < m_fields; ++i) {
+    add_field(row[i], lengths[i]);
+  }
+
+  ++m_rows;
+}
+
+void Row_block::add(const IRow *row) {
+  const char *data;
+  std::size_t length;
+
+  for (uint32_t i = 0; i < m_fields; ++i) {
+    if (row->is_null(i)) {
+      add_field(nullptr, 0);
+    } else {
+      row->get_raw_data(i, &data, &length);
+      add_field(data, length);
+    }
+  }
+
+  ++m_rows;
+}
+
+void Row_block::seal() {
+  m_pointers.resize(m_offsets.size());
+
+  for (std::size_t i = 0, size = m_offsets.size(); i < size; ++i) {
+    m_pointers[i] =
+        k_null == m_offsets[i] ? nullptr : m_data.data() + m_offsets[i];
+  }
+}
+
+void Row_block::clear() {
+  m_data.clear();
+  m_offsets.clear();
+  m_lengths.clear();
+  m_pointers.clear();
+  m_rows = 0;
+}
+
+}  // namespace mysql
+}  // namespace db
+}  // namespace mysqlshdk
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#ifndef MYSQLSHDK_LIBS_DB_MYSQL_ROW_BLOCK_H_
+#define MYSQLSHDK_LIBS_DB_MYSQL_ROW_BLOCK_H_
+
+#include <mysql.h>
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mysqlshdk/libs/db/row.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace mysql {
+
+/**
+ * A block of rows stored contiguously: values of all fields are held in a
+ * single buffer, each field is described by its offset and length. Memory is
+ * reused when the block is cleared, so fetching a large result set in blocks
+ * does not allocate per row.
+ *
+ * Rows are accessed in the same format as the one used by the client library
+ * (array of pointers to values, array of lengths), NULL values are represented
+ * by nullptr.
+ */
+class SHCORE_PUBLIC Row_block final {
+ public:
+  // default limits, block is full once it holds this many rows or bytes
+  static constexpr std::size_t k_max_rows = 1024;
+  static constexpr std::size_t k_max_bytes = 1024 * 1024;
+
+  Row_block() = delete;
+
+  explicit Row_block(std::size_t fields, std::size_t max_rows = k_max_rows,
+                     std::size_t max_bytes = k_max_bytes)
+      : m_fields(fields), m_max_rows(max_rows), m_max_bytes(max_bytes) {}
+
+  Row_block(const Row_block &) = delete;
+  Row_block(Row_block &&) = default;
+
+  Row_block &operator=(const Row_block &) = delete;
+  Row_block &operator=(Row_block &&) = default;
+
+  ~Row_block() = default;
+
+  void add(MYSQL_ROW row, const unsigned long *lengths);
+
+  void add(const IRow *row);
+
+  bool full() const {
+    return m_rows >= m_max_rows || m_data.length() >= m_max_bytes;
+  }
+
+  bool empty() const { return 0 == m_rows; }
+
+  std::size_t rows() const { return m_rows; }
+
+  std::size_t fields() const { return m_fields; }
+
+  /**
+   * Needs to be called once all rows were added, before any of them are read.
+   */
+  void seal();
+
+  /**
+   * Values of the given row, valid until the block is modified.
+   */
+  const char *const *data(std::size_t row) const {
+    return m_pointers.data() + row * m_fields;
+  }
+
+  /**
+   * Lengths of the values of the given row.
+   */
+  const unsigned long *lengths(std::size_t row) const {
+    return m_lengths.data() + row * m_fields;
+  }
+
+  bool is_null(std::size_t row, std::size_t field) const {
+    return nullptr == data(row)[field];
+  }
+
+  std::string_view get(std::size_t row, std::size_t field) const {
+    const auto value = data(row)[field];
+    return value ? std::string_view{value, lengths(row)[field]}
+                 : std::string_view{};
+  }
+
+  /**
+   * Removes all the rows, keeps the memory.
+   */
+  void clear();
+
+ private:
+  static constexpr std::size_t k_null = std::numeric_limits<std::size_t>::max();
+
+  inline void add_field(const char *data, std::size_t length) {
+    if (data) {
+      m_offsets.emplace_back(m_data.length());
+      m_data.append(data, length);
+    } else {
+      m_offsets.emplace_back(k_null);
+    }
+
+    m_lengths.emplace_back(length);
+  }
+
+  std::size_t m_fields;
+  std::size_t m_max_rows;
+  std::size_t m_max_bytes;
+  std::size_t m_rows = 0;
+  std::string m_data;
+  std::vector<std::size_t> m_offsets;
+  std::vector<unsigned long> m_lengths;
+  std::vector<const char *> m_pointers;
+};
+
+}  // namespace mysql
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_MYSQL_ROW_BLOCK_H_
@@ -27,6 +27,8 @@
 
 #include <mutex>
 #include <regex>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 #include "mysqlshdk/libs/db/mysql/auth_plugins/common.h"
@@ -36,6 +38,8 @@
 #include "mysqlshdk/libs/utils/fault_injection.h"
 #include "mysqlshdk/libs/utils/log_sql.h"
 #include "mysqlshdk/libs/utils/profiling.h"
+#include "mysqlshdk/libs/utils/tracing.h"
+#include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 
 #ifdef _WIN32
@@ -200,6 +204,9 @@ Session_impl::Session_impl() = default;
 
 void Session_impl::connect(
     const mysqlshdk::db::Connection_options &connection_options) {
+  mysqlshdk::tracing::Span span{"db", "mysql.connect"};
+  if (span.active()) span.add_arg("uri", connection_options.uri_endpoint());
+
   long flags = CLIENT_MULTI_RESULTS | CLIENT_CAN_HANDLE_EXPIRED_PASSWORDS;
   _mysql = mysql_init(nullptr);
 
@@ -519,6 +526,10 @@ void Session_impl::close() {
   // avoid having unneeded output on the script mode
   if (_prev_result) _prev_result.reset();
 
+  // statements need to be closed while connection is still open
+  evict_prepared_statements(0);
+  m_unpreparable.clear();
+
   if (_mysql) {
     DBUG_LOG("sql", get_thread_id() << ": DISCONNECT");
     mysql_close(_mysql);
@@ -547,18 +558,16 @@ std::shared_ptr<IResult> Session_impl::run_sql(
   if (_mysql == nullptr) throw std::runtime_error("Not connected");
   mysqlshdk::utils::Profile_timer timer;
   timer.stage_begin("run_sql");
-  if (_prev_result) {
-    _prev_result.reset();
-  } else {
-    MYSQL_RES *unread_result = mysql_use_result(_mysql);
-    mysql_free_result(unread_result);
-  }
 
-  // Discards any pending result
-  while (mysql_next_result(_mysql) == 0) {
-    MYSQL_RES *trailing_result = mysql_use_result(_mysql);
-    mysql_free_result(trailing_result);
+  mysqlshdk::tracing::Span span{"db", "mysql.query"};
+
+  if (span.active()) {
+    // only the type of the statement is recorded, full statement may contain
+    // sensitive data
+    span.add_arg("statement", mysqlshdk::utils::first_keyword({sql, len}));
+    span.add_arg("length", static_cast<uint64_t>(len));
   }
+  discard_pending_results();
 
   DBUG_EXECUTE_IF("sql_test_abort", {
     static int count = std::stoi(getenv("TEST_SQL_UNTIL_CRASH"));
@@ -681,6 +690,8 @@ std::shared_ptr<IResult> Session_impl::run_sql(
 
   timer.stage_end();
   result->set_execution_time(timer.total_seconds_elapsed());
+  log_sql_handler->record(
+      {sql, len}, std::chrono::nanoseconds{timer.total_nanoseconds_elapsed()});
   return std::static_pointer_cast<IResult>(result);
 }
 
@@ -690,6 +701,220 @@ static void free_result(T *result) {
   result = NULL;
 }
 
+void Session_impl::discard_pending_results() {
+  if (_prev_result) {
+    _prev_result.reset();
+  } else {
+    MYSQL_RES *unread_result = mysql_use_result(_mysql);
+    mysql_free_result(unread_result);
+  }
+
+  // Discards any pending result
+  while (mysql_next_result(_mysql) == 0) {
+    MYSQL_RES *trailing_result = mysql_use_result(_mysql);
+    mysql_free_result(trailing_result);
+  }
+}
+
+void Session_impl::set_prepared_statement_cache_size(std::size_t size) {
+  m_statement_cache_size = size;
+  evict_prepared_statements(size);
+
+  if (0 == size) {
+    m_unpreparable.clear();
+  }
+}
+
+void Session_impl::evict_prepared_statements(std::size_t size) {
+  while (m_statements.size() > size) {
+    const auto &last = m_statements.back();
+
+    mysql_stmt_close(last.second);
+    m_statement_index.erase(last.first);
+    m_statements.pop_back();
+  }
+}
+
+void Session_impl::mark_unpreparable(const std::string &sql) {
+  // bound the memory used by the templates
+  constexpr std::size_t k_max_unpreparable = 1024;
+
+  if (m_unpreparable.size() >= k_max_unpreparable) {
+    m_unpreparable.clear();
+  }
+
+  m_unpreparable.emplace(sql);
+}
+
+MYSQL_STMT *Session_impl::prepared_statement(const std::string &sql,
+                                             std::size_t params) {
+  if (const auto it = m_statement_index.find(sql);
+      m_statement_index.end() != it) {
+    // move to the front of the list
+    m_statements.splice(m_statements.begin(), m_statements, it->second);
+    return it->second->second;
+  }
+
+  if (m_unpreparable.count(sql)) {
+    return nullptr;
+  }
+
+  {
+    // identifiers (!) cannot be bound, template needs to be formatted
+    std::size_t placeholders = 0;
+
+    for (mysqlshdk::utils::SQL_iterator it(sql); it.valid(); ++it) {
+      if ('!' == *it) {
+        mark_unpreparable(sql);
+        return nullptr;
+      }
+
+      if ('?' == *it) {
+        ++placeholders;
+      }
+    }
+
+    if (placeholders != params) {
+      // number of arguments is not valid, formatting is going to report that
+      return nullptr;
+    }
+  }
+
+  discard_pending_results();
+
+  const auto stmt = mysql_stmt_init(_mysql);
+
+  if (!stmt) {
+    throw std::runtime_error("Failed to initialize a prepared statement");
+  }
+
+  if (mysql_stmt_prepare(stmt, sql.data(), sql.length()) ||
+      mysql_stmt_param_count(stmt) != params) {
+    // statement is not supported by the prepared statement protocol, or it's
+    // invalid, it's going to be executed as a regular query, which reports
+    // the error if there is one
+    DBUG_LOG("sql", get_thread_id() << ": cannot prepare '" << sql
+                                    << "': " << mysql_stmt_error(stmt));
+    mysql_stmt_close(stmt);
+    mark_unpreparable(sql);
+    return nullptr;
+  }
+
+  evict_prepared_statements(m_statement_cache_size - 1);
+
+  m_statements.emplace_front(sql, stmt);
+  m_statement_index.emplace(sql, m_statements.begin());
+
+  return stmt;
+}
+
+std::shared_ptr<IResult> Session_impl::query_prepared(
+    const std::string &sql, const std::vector<Statement_param> &params) {
+  if (_mysql == nullptr) throw std::runtime_error("Not connected");
+
+  if (0 == m_statement_cache_size) {
+    return nullptr;
+  }
+
+  mysqlshdk::utils::Profile_timer timer;
+  timer.stage_begin("query_prepared");
+
+  const auto stmt = prepared_statement(sql, params.size());
+
+  if (!stmt) {
+    return nullptr;
+  }
+
+  discard_pending_results();
+
+  shcore::current_log_sql()->log(get_thread_id(), sql);
+
+  DBUG_LOG("sqlall", get_thread_id() << ": PREPARED: " << sql);
+
+  const auto throw_error = [this, stmt, &sql]() {
+    auto err = Error(mysql_stmt_error(stmt), mysql_stmt_errno(stmt),
+                     mysql_stmt_sqlstate(stmt));
+
+    shcore::current_log_sql()->log(get_thread_id(), sql, err);
+    DBUG_LOG("sql", get_thread_id() << ": ERROR: " << err.format()
+                                    << "\n\twhile executing: " << sql);
+
+    // statement may no longer be usable (i.e. connection was lost)
+    if (const auto it = m_statement_index.find(sql);
+        m_statement_index.end() != it) {
+      mysql_stmt_close(stmt);
+      m_statements.erase(it->second);
+      m_statement_index.erase(it);
+    }
+
+    throw err;
+  };
+
+  std::vector<MYSQL_BIND> binds(params.size());
+  std::vector<unsigned long> lengths(params.size());
+
+  for (std::size_t i = 0; i < params.size(); ++i) {
+    auto &bind = binds[i];
+
+    std::visit(
+        [&bind, &length = lengths[i]](const auto &value) {
+          using T = std::decay_t<decltype(value)>;
+
+          if constexpr (std::is_same_v<T, std::nullptr_t>) {
+            bind.buffer_type = MYSQL_TYPE_NULL;
+          } else if constexpr (std::is_same_v<T, std::string>) {
+            bind.buffer_type = MYSQL_TYPE_STRING;
+            bind.buffer = const_cast<char *>(value.data());
+            bind.buffer_length = value.length();
+            length = value.length();
+            bind.length = &length;
+          } else if constexpr (std::is_same_v<T, double>) {
+            bind.buffer_type = MYSQL_TYPE_DOUBLE;
+            bind.buffer = const_cast<double *>(&value);
+          } else {
+            bind.buffer_type = MYSQL_TYPE_LONGLONG;
+            bind.buffer = const_cast<T *>(&value);
+            bind.is_unsigned = std::is_unsigned_v<T>;
+          }
+        },
+        params[i]);
+  }
+
+  if (!binds.empty() && mysql_stmt_bind_param(stmt, binds.data())) {
+    throw_error();
+  }
+
+  if (mysql_stmt_execute(stmt)) {
+    throw_error();
+  }
+
+  std::shared_ptr<MYSQL_RES> metadata;
+
+  if (const auto res = mysql_stmt_result_metadata(stmt)) {
+    metadata = std::shared_ptr<MYSQL_RES>(res, &free_result<MYSQL_RES>);
+  }
+
+  std::shared_ptr<Result> result(
+      new Result(nullptr, mysql_stmt_affected_rows(stmt),
+                 mysql_stmt_insert_id(stmt), mysql_info(_mysql), true));
+  result->_session = shared_from_this();
+
+  try {
+    result->fetch_prepared(stmt, std::move(metadata));
+  } catch (...) {
+    mysql_stmt_free_result(stmt);
+    throw;
+  }
+
+  mysql_stmt_free_result(stmt);
+
+  timer.stage_end();
+  result->set_execution_time(timer.total_seconds_elapsed());
+  shcore::current_log_sql()->record(
+      sql, std::chrono::nanoseconds{timer.total_nanoseconds_elapsed()});
+  return std::static_pointer_cast<IResult>(result);
+}
+
 bool Session_impl::next_resultset() {
   if (_prev_result) _prev_result.reset();
 
@@ -767,6 +992,19 @@ std::optional<std::string> Session_impl::get_last_statement_id() const {
   return statement_id;
 }
 
+void Session::set_multi_statements(bool enable) {
+  const auto mysql = _impl->get_handle();
+
+  if (!mysql) throw std::runtime_error("Not connected");
+
+  const auto option = enable ? MYSQL_OPTION_MULTI_STATEMENTS_ON
+                             : MYSQL_OPTION_MULTI_STATEMENTS_OFF;
+
+  if (mysql_set_server_option(mysql, option)) {
+    throw Error(mysql_error(mysql), mysql_errno(mysql), mysql_sqlstate(mysql));
+  }
+}
+
 std::string Session::escape_string(std::string_view s) const {
   std::string res;
   res.resize(s.size() * 2 + 1);
@@ -32,10 +32,14 @@
 
 #include <cstring>
 #include <functional>
+#include <list>
 #include <memory>
 #include <set>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "mysqlshdk/libs/db/connection_options.h"
@@ -112,6 +116,16 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
 
   inline void execute(const char *sql) { execute(sql, ::strlen(sql)); }
 
+  /**
+   * Executes the query template using a cached prepared statement.
+   *
+   * @returns result of the query, nullptr if template cannot be prepared
+   */
+  std::shared_ptr<IResult> query_prepared(
+      const std::string &sql, const std::vector<Statement_param> &params);
+
+  void set_prepared_statement_cache_size(std::size_t size);
+
   void start_transaction();
   void commit();
   void rollback();
@@ -216,6 +230,14 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
 
   void setup_default_character_set();
 
+  void discard_pending_results();
+
+  MYSQL_STMT *prepared_statement(const std::string &sql, std::size_t params);
+
+  void mark_unpreparable(const std::string &sql);
+
+  void evict_prepared_statements(std::size_t size);
+
   MYSQL *get_handle() { return _mysql; }
 
   std::string _uri;
@@ -224,6 +246,18 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
   mysqlshdk::db::Connection_options _connection_options;
   std::unique_ptr<Error> m_last_error;
 
+  // maximum number of cached prepared statements, 0 disables the cache
+  std::size_t m_statement_cache_size = 0;
+  // cached statements, most recently used first
+  std::list<std::pair<std::string, MYSQL_STMT *>> m_statements;
+  std::unordered_map<std::string, decltype(m_statements)::iterator>
+      m_statement_index;
+  // templates which cannot be prepared
+  std::unordered_set<std::string> m_unpreparable;
+
+  // metadata of the recently returned results
+  Result_metadata_cache m_metadata_cache;
+
   struct Local_infile_callbacks {
     int (*init)(void **, const char *, void *) = nullptr;
     int (*read)(void *, char *, unsigned int) = nullptr;
@@ -262,6 +296,33 @@ class SHCORE_PUBLIC Session : public ISession,
     _impl->execute(sql, len);
   }
 
+  bool prepared_statement_cache_enabled() const override {
+    return _impl->m_statement_cache_size > 0;
+  }
+
+  std::shared_ptr<IResult> query_prepared(
+      const std::string &sql,
+      const std::vector<Statement_param> &params) override {
+    if (auto result = _impl->query_prepared(sql, params)) {
+      return result;
+    }
+
+    return ISession::query_prepared(sql, params);
+  }
+
+  /**
+   * Enables the cache of server-side prepared statements used by queryf()
+   * and executef(), statements are keyed by the query template. The least
+   * recently used statements are closed once more than the given number of
+   * them is cached.
+   *
+   * @param size Maximum number of cached statements, 0 disables the cache
+   *        and closes all the statements.
+   */
+  void set_prepared_statement_cache_size(std::size_t size) {
+    _impl->set_prepared_statement_cache_size(size);
+  }
+
   const char *get_ssl_cipher() const override {
     return _impl->get_ssl_cipher();
   }
@@ -342,6 +403,12 @@ class SHCORE_PUBLIC Session : public ISession,
 
   MYSQL *get_handle() { return _impl->get_handle(); }
 
+  /**
+   * Enables or disables execution of multiple statements separated by
+   * semicolons in a single query.
+   */
+  void set_multi_statements(bool enable);
+
   ~Session() override { close(); }
 
  protected:
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/mysqlx/expr_cache.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "mysqlshdk/libs/db/mysqlx/expr_parser.h"
+
+namespace mysqlx {
+
+namespace {
+
+std::string cache_key(const std::string &source, bool document_mode) {
+  std::string key;
+  key.reserve(source.size() + 1);
+  key += document_mode ? 'D' : 'T';
+  key += source;
+  return key;
+}
+
+/**
+ * Replaces positions of placeholders which refer to the given names with
+ * positions in the target list, adding the missing names.
+ */
+void remap_placeholders(Mysqlx::Expr::Expr *expr,
+                        const std::vector<std::string> &names,
+                        std::vector<std::string> *target) {
+  switch (expr->type()) {
+    case Mysqlx::Expr::Expr::PLACEHOLDER: {
+      const auto &name = names[expr->position()];
+      const auto it = std::find(target->begin(), target->end(), name);
+      auto position = static_cast<uint32_t>(it - target->begin());
+
+      if (target->end() == it) {
+        target->emplace_back(name);
+      }
+
+      expr->set_position(position);
+      break;
+    }
+
+    case Mysqlx::Expr::Expr::FUNC_CALL:
+      for (auto &param : *expr->mutable_function_call()->mutable_param()) {
+        remap_placeholders(&param, names, target);
+      }
+      break;
+
+    case Mysqlx::Expr::Expr::OPERATOR:
+      for (auto &param : *expr->mutable_operator_()->mutable_param()) {
+        remap_placeholders(&param, names, target);
+      }
+      break;
+
+    case Mysqlx::Expr::Expr::OBJECT:
+      for (auto &field : *expr->mutable_object()->mutable_fld()) {
+        remap_placeholders(field.mutable_value(), names, target);
+      }
+      break;
+
+    case Mysqlx::Expr::Expr::ARRAY:
+      for (auto &value : *expr->mutable_array()->mutable_value()) {
+        remap_placeholders(&value, names, target);
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+}  // namespace
+
+Expr_cache &Expr_cache::instance() {
+  static Expr_cache s_instance;
+  return s_instance;
+}
+
+std::unique_ptr<Mysqlx::Expr::Expr> Expr_cache::parse(
+    const std::string &source, bool document_mode,
+    std::vector<std::string> *placeholders) {
+  auto key = cache_key(source, document_mode);
+  auto expr = std::make_unique<Mysqlx::Expr::Expr>();
+  std::vector<std::string> names;
+  bool cached = false;
+
+  {
+    std::lock_guard lock{m_mutex};
+
+    if (const auto it = m_index.find(key); m_index.end() != it) {
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+      expr->CopyFrom(*it->second->expr);
+      names = it->second->placeholders;
+      cached = true;
+    }
+  }
+
+  if (!cached) {
+    Expr_parser parser(source, document_mode, false, &names);
+    expr = parser.expr();
+
+    if (parser.has_positional_placeholders()) {
+      // names of such placeholders depend on the placeholders which were
+      // already defined, these expressions are not cached
+      if (placeholders && !placeholders->empty()) {
+        return Expr_parser(source, document_mode, false, placeholders).expr();
+      }
+    } else if (m_capacity > 0) {
+      Entry entry;
+      entry.key = key;
+      entry.expr = std::make_unique<Mysqlx::Expr::Expr>(*expr);
+      entry.placeholders = names;
+
+      std::lock_guard lock{m_mutex};
+
+      if (!m_index.contains(key)) {
+        m_entries.emplace_front(std::move(entry));
+        m_index.emplace(std::move(key), m_entries.begin());
+
+        if (m_entries.size() > m_capacity) {
+          m_index.erase(m_entries.back().key);
+          m_entries.pop_back();
+        }
+      }
+    }
+  }
+
+  if (placeholders && !names.empty()) {
+    if (placeholders->empty()) {
+      // positions are the same
+      *placeholders = std::move(names);
+    } else {
+      remap_placeholders(expr.get(), names, placeholders);
+    }
+  }
+
+  return expr;
+}
+
+std::size_t Expr_cache::size() const {
+  std::lock_guard lock{m_mutex};
+  return m_entries.size();
+}
+
+void Expr_cache::clear() {
+  std::lock_guard lock{m_mutex};
+  m_index.clear();
+  m_entries.clear();
+}
+
+}  // namespace mysqlx
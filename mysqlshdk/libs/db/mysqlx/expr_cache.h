@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_DB_MYSQLX_EXPR_CACHE_H_
+#define MYSQLSHDK_LIBS_DB_MYSQLX_EXPR_CACHE_H_
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "db/mysqlx/mysqlxclient_clean.h"
+
+namespace mysqlx {
+
+/**
+ * LRU cache of parsed expressions, keyed on the expression string and the
+ * parser mode. Placeholders of a cached expression are identified by their
+ * names, positions are resolved separately for each caller.
+ */
+class Expr_cache final {
+ public:
+  /**
+   * @param capacity Maximum number of cached expressions.
+   */
+  explicit Expr_cache(std::size_t capacity = 256) : m_capacity(capacity) {}
+
+  Expr_cache(const Expr_cache &) = delete;
+  Expr_cache(Expr_cache &&) = delete;
+
+  Expr_cache &operator=(const Expr_cache &) = delete;
+  Expr_cache &operator=(Expr_cache &&) = delete;
+
+  ~Expr_cache() = default;
+
+  /**
+   * Cache shared by the whole process.
+   */
+  static Expr_cache &instance();
+
+  /**
+   * Provides the parsed expression, the result is the same as the one
+   * returned by Expr_parser::expr().
+   *
+   * @param source Expression to be parsed.
+   * @param document_mode Whether to parse the expression in document mode.
+   * @param placeholders Names of placeholders, new ones are added at the end.
+   *
+   * @throws Parser_error if expression is not valid
+   */
+  std::unique_ptr<Mysqlx::Expr::Expr> parse(
+      const std::string &source, bool document_mode,
+      std::vector<std::string> *placeholders = nullptr);
+
+  std::size_t size() const;
+
+  void clear();
+
+ private:
+  struct Entry {
+    std::string key;
+    std::unique_ptr<Mysqlx::Expr::Expr> expr;
+    // names of placeholders, indexed by position stored in the expression
+    std::vector<std::string> placeholders;
+  };
+
+  using Entries = std::list<Entry>;
+
+  const std::size_t m_capacity;
+  mutable std::mutex m_mutex;
+  // most recently used entries are at the front
+  Entries m_entries;
+  std::unordered_map<std::string, Entries::iterator> m_index;
+};
+
+}  // namespace mysqlx
+
+#endif  // MYSQLSHDK_LIBS_DB_MYSQLX_EXPR_CACHE_H_
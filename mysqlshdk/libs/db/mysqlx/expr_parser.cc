@@ -607,10 +607,12 @@ std::unique_ptr<Mysqlx::Expr::Expr> Expr_parser::placeholder() {
       placeholder_name = token.get_text();
     } else {
       placeholder_name = std::to_string(_place_holder_ref->size());
+      _positional_placeholders = true;
     }
   } else if (_tokenizer.cur_token_type_is(Token::Type::PLACEHOLDER)) {
     _tokenizer.consume_token(Token::Type::PLACEHOLDER);
     placeholder_name = std::to_string(_place_holder_ref->size());
+    _positional_placeholders = true;
   }
 
   // Adds a new placeholder if needed
@@ -76,6 +76,14 @@ class Expr_parser {
 
   bool tokens_available() const { return _tokenizer.tokens_available(); }
 
+  /**
+   * Whether the parsed expression contains placeholders which are identified
+   * by their position (i.e. '?' or ':'), rather than by their name.
+   */
+  bool has_positional_placeholders() const {
+    return _positional_placeholders;
+  }
+
  protected:
   struct operator_list {
     std::set<Token::Type> mul_div_expr_types;
@@ -122,6 +130,7 @@ class Expr_parser {
   // placeholder
   std::vector<std::string> _place_holders;
   std::vector<std::string> *_place_holder_ref;
+  bool _positional_placeholders = false;
   std::unique_ptr<Mysqlx::Expr::Expr> placeholder();
   // cast
   std::unique_ptr<Mysqlx::Expr::Expr> my_expr();
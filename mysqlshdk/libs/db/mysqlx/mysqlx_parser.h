@@ -24,6 +24,7 @@
 #ifndef _MYSQLX_PARSER_H_
 #define _MYSQLX_PARSER_H_
 
+#include "expr_cache.h"
 #include "expr_parser.h"
 #include "orderby_parser.h"
 #include "proj_parser.h"
@@ -35,8 +36,7 @@ namespace mysqlx {
 namespace parser {
 inline Mysqlx::Expr::Expr *parse_collection_filter(
     const std::string &source, std::vector<std::string> *placeholders = NULL) {
-  Expr_parser parser(source, true, false, placeholders);
-  return parser.expr().release();
+  return Expr_cache::instance().parse(source, true, placeholders).release();
 }
 
 inline Mysqlx::Expr::Expr *parse_column_identifier(const std::string &source) {
@@ -52,8 +52,7 @@ inline Mysqlx::Expr::Expr *parse_column_identifier(const std::string &source) {
 
 inline Mysqlx::Expr::Expr *parse_table_filter(
     const std::string &source, std::vector<std::string> *placeholders = NULL) {
-  Expr_parser parser(source, false, false, placeholders);
-  return parser.expr().release();
+  return Expr_cache::instance().parse(source, false, placeholders).release();
 }
 
 template <typename Container>
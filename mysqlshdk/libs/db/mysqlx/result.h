@@ -39,6 +39,7 @@
 #include "mysqlshdk/libs/db/mysqlx/mysqlxclient_clean.h"
 #include "mysqlshdk/libs/db/mysqlx/row.h"
 #include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/utils/memory_stats.h"
 
 namespace mysqlshdk {
 namespace db {
@@ -78,6 +79,13 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   // read all resultsets without affecting the prefetched rows
   void drain_resultset() const;
 
+  /**
+   * Adds the affected rows, generated document IDs and warnings of the given
+   * result to this one, used when a single operation is executed using
+   * multiple statements.
+   */
+  void merge(Result *other);
+
  protected:
   explicit Result(std::unique_ptr<xcl::XQuery_result> result);
   void fetch_metadata();
@@ -86,6 +94,7 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   std::vector<Column> _metadata;
 
   std::deque<mysqlshdk::db::Row_copy> _pre_fetched_rows;
+  shcore::Tracked_memory m_pre_fetched_memory{shcore::Memory_tag::RESULTS};
   std::unique_ptr<xcl::XQuery_result> _result;
   mutable std::shared_ptr<Field_names> _field_names;
 
@@ -98,6 +107,11 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   bool _stop_pre_fetch = false;
   bool _pre_fetched = false;
   bool _persistent_pre_fetch = false;
+
+  // data of the merged results
+  uint64_t m_merged_affected_rows = 0;
+  std::vector<std::string> m_merged_generated_ids;
+  std::vector<Warning> m_merged_warnings;
 };
 }  // namespace mysqlx
 }  // namespace db
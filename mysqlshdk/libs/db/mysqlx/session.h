@@ -29,10 +29,12 @@
 
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 #include "mysqlshdk/libs/db/mysqlx/mysqlxclient_clean.h"
 
 #include "mysqlshdk/libs/db/mysqlx/result.h"
@@ -56,6 +58,16 @@ struct GlobalNotice {
   Type type;
 };
 
+/**
+ * Outcome of a single statement executed in a pipeline.
+ */
+struct Pipeline_result {
+  // fully buffered result, nullptr if statement has failed
+  std::shared_ptr<IResult> result;
+  // set if statement has failed
+  std::optional<Error> error;
+};
+
 /*
  * Session implementation for the MySQL protocol.
  *
@@ -127,6 +139,24 @@ class XSession_impl : public std::enable_shared_from_this<XSession_impl> {
 
   void deallocate_prep_stmt(uint32_t stmt_id);
 
+  void start_pipeline(std::size_t max_in_flight);
+
+  void enqueue(const ::Mysqlx::Crud::Insert &msg);
+  void enqueue(const ::Mysqlx::Crud::Update &msg);
+  void enqueue(const ::Mysqlx::Crud::Delete &msg);
+  void enqueue(const ::Mysqlx::Sql::StmtExecute &msg);
+
+  std::vector<Pipeline_result> flush_pipeline();
+
+  bool pipeline_active() const { return m_pipeline; }
+
+  template <typename Message>
+  void pipeline_send(const Message &msg);
+
+  void pipeline_recv();
+
+  void reset_pipeline();
+
   void enable_notices(const std::vector<GlobalNotice::Type> &types);
 
   /** Registers a callback called when an async notice is received
@@ -170,6 +200,12 @@ class XSession_impl : public std::enable_shared_from_this<XSession_impl> {
       const xcl::XProtocol *, const bool /*is_global*/,
       const Mysqlx::Notice::Frame::Type type, const char *, const uint32_t);
   bool m_handler_installed = false;
+
+  bool m_pipeline = false;
+  std::size_t m_pipeline_max_in_flight = 0;
+  // number of messages which were sent, but their replies were not read yet
+  std::size_t m_pipeline_in_flight = 0;
+  std::vector<Pipeline_result> m_pipeline_results;
 };
 
 class SHCORE_PUBLIC Session : public ISession,
@@ -255,6 +291,48 @@ class SHCORE_PUBLIC Session : public ISession,
 
   void deallocate_prep_stmt(uint32_t id) { _impl->deallocate_prep_stmt(id); }
 
+  /**
+   * Starts the pipelined execution. Queued messages are sent to the server
+   * right away, without waiting for the replies of the previous ones, the
+   * replies are read (and buffered) when flush_pipeline() is called or when
+   * there are too many messages in flight.
+   *
+   * Server processes each message independently, a failed statement does not
+   * affect the following ones, its error is reported in the corresponding
+   * Pipeline_result. Client errors (i.e. lost connection) are thrown
+   * immediately and end the pipeline.
+   *
+   * Other statements cannot be executed until the pipeline is flushed.
+   *
+   * @param max_in_flight Maximum number of messages sent to the server before
+   *        their replies are read.
+   */
+  void start_pipeline(std::size_t max_in_flight = 128) {
+    _impl->start_pipeline(max_in_flight);
+  }
+
+  void enqueue(const ::Mysqlx::Crud::Insert &msg) { _impl->enqueue(msg); }
+  void enqueue(const ::Mysqlx::Crud::Update &msg) { _impl->enqueue(msg); }
+  void enqueue(const ::Mysqlx::Crud::Delete &msg) { _impl->enqueue(msg); }
+  void enqueue(const ::Mysqlx::Sql::StmtExecute &msg) { _impl->enqueue(msg); }
+
+  void enqueue(std::string_view sql) {
+    ::Mysqlx::Sql::StmtExecute stmt;
+    stmt.set_stmt(sql.data(), sql.size());
+    _impl->enqueue(stmt);
+  }
+
+  /**
+   * Waits for the replies of all the queued messages and ends the pipeline.
+   *
+   * @returns results in the order the messages were queued
+   */
+  std::vector<Pipeline_result> flush_pipeline() {
+    return _impl->flush_pipeline();
+  }
+
+  bool pipeline_active() const { return _impl->pipeline_active(); }
+
   bool is_open() const override { return _impl->valid(); };
 
   const Error *get_last_error() const override {
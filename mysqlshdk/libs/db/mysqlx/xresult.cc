@@ -203,12 +203,13 @@ uint64_t Result::get_affected_row_count() const {
   if (_result) {
     _result->try_get_affected_rows(&i);
   }
-  return i;
+  return i + m_merged_affected_rows;
 }
 
 uint64_t Result::get_warning_count() const {
-  if (_result) return _result->get_warnings().size();
-  return 0;
+  uint64_t count = m_merged_warnings.size();
+  if (_result) count += _result->get_warnings().size();
+  return count;
 }
 
 std::vector<std::string> Result::get_generated_ids() {
@@ -216,9 +217,25 @@ std::vector<std::string> Result::get_generated_ids() {
 
   _result->try_get_generated_document_ids(&ids);
 
+  ids.insert(ids.end(), m_merged_generated_ids.begin(),
+             m_merged_generated_ids.end());
+
   return ids;
 }
 
+void Result::merge(Result *other) {
+  m_merged_affected_rows += other->get_affected_row_count();
+
+  auto ids = other->get_generated_ids();
+  m_merged_generated_ids.insert(m_merged_generated_ids.end(),
+                                std::make_move_iterator(ids.begin()),
+                                std::make_move_iterator(ids.end()));
+
+  while (auto warning = other->fetch_one_warning()) {
+    m_merged_warnings.emplace_back(std::move(*warning));
+  }
+}
+
 Result::~Result() {
   // flush all
   if (_result) {
@@ -236,8 +253,10 @@ const IRow *Result::fetch_one() {
     if (!_persistent_pre_fetch) {
       if (!_pre_fetched_rows.empty()) {
         if (_fetched_row_count - m_fetched_before_prefetch >
-            0)  // free the previously fetched row
+            0) {  // free the previously fetched row
+          m_pre_fetched_memory.shrink(_pre_fetched_rows.front().memory_size());
           _pre_fetched_rows.pop_front();
+        }
         if (!_pre_fetched_rows.empty()) {
           // return the next row, but don't pop it yet otherwise it'll be freed
           const IRow *row = &_pre_fetched_rows.front();
@@ -285,10 +304,14 @@ bool Result::pre_fetch_rows(bool persistent) {
     if (!_result->has_resultset()) return false;
     Row wrapper(this);
     xcl::XError error;
+    std::size_t memory = 0;
+    shcore::on_leave_scope track_memory(
+        [this, &memory]() { m_pre_fetched_memory.grow(memory); });
+
     while (const ::xcl::XRow *row = _result->get_next_row(&error)) {
       if (_stop_pre_fetch) return true;
       wrapper.reset(row);
-      _pre_fetched_rows.emplace_back(wrapper);
+      memory += _pre_fetched_rows.emplace_back(wrapper).memory_size();
     }
     if (error) {
       std::stringstream msg;
@@ -314,6 +337,7 @@ bool Result::next_resultset() {
   bool ret_val = false;
 
   _pre_fetched_rows.clear();
+  m_pre_fetched_memory.resize(0);
   _field_names.reset();
   _pre_fetched = false;
 
@@ -350,6 +374,13 @@ std::unique_ptr<Warning> Result::fetch_one_warning() {
     _fetched_warning_count++;
     return w;
   }
+
+  if (const auto merged = _fetched_warning_count - warnings.size();
+      merged < m_merged_warnings.size()) {
+    _fetched_warning_count++;
+    return std::make_unique<Warning>(m_merged_warnings[merged]);
+  }
+
   return {};
 }
 
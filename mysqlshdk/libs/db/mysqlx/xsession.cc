@@ -23,6 +23,7 @@
 
 #include <mysqlx_version.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -33,8 +34,11 @@
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/fault_injection.h"
 #include "mysqlshdk/libs/utils/log_sql.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/profiling.h"
+#include "mysqlshdk/libs/utils/tracing.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_lexing.h"
 
 namespace mysqlshdk {
 namespace db {
@@ -148,6 +152,9 @@ XSession_impl::XSession_impl() : m_prep_stmt_count(0) {
 }
 
 void XSession_impl::connect(const mysqlshdk::db::Connection_options &data) {
+  mysqlshdk::tracing::Span span{"db", "mysqlx.connect"};
+  if (span.active()) span.add_arg("uri", data.uri_endpoint());
+
   _mysql = ::xcl::create_session();
   if (_enable_trace) _trace_handler = do_enable_trace(_mysql.get());
 
@@ -486,6 +493,19 @@ void XSession_impl::connect(const mysqlshdk::db::Connection_options &data) {
 }
 
 void XSession_impl::close() {
+  if (m_pipeline) {
+    // replies of the queued messages are discarded
+    try {
+      while (m_pipeline_in_flight > 0) {
+        pipeline_recv();
+      }
+    } catch (const std::exception &e) {
+      log_debug("Error while discarding the pipelined results: %s", e.what());
+    }
+
+    reset_pipeline();
+  }
+
   // This should be logged, for now commenting to
   // avoid having unneeded output on the script mode
   if (auto result = _prev_result.lock()) {
@@ -563,6 +583,12 @@ XSession_impl::~XSession_impl() {
 void XSession_impl::before_query() {
   if (!_mysql) throw std::logic_error("Not connected");
 
+  if (m_pipeline) {
+    throw std::logic_error(
+        "Cannot execute a statement while a pipeline is active, it needs to "
+        "be flushed first");
+  }
+
   if (auto result = _prev_result.lock()) {
     if (result->has_resultset()) {
       // buffer the previous result to remove it from the connection
@@ -593,6 +619,15 @@ std::shared_ptr<IResult> XSession_impl::query(const char *sql, size_t len,
                                               bool buffered) {
   mysqlshdk::utils::Profile_timer timer;
   timer.stage_begin("query");
+
+  mysqlshdk::tracing::Span span{"db", "mysqlx.query"};
+
+  if (span.active()) {
+    // only the type of the statement is recorded, full statement may contain
+    // sensitive data
+    span.add_arg("statement", mysqlshdk::utils::first_keyword({sql, len}));
+    span.add_arg("length", static_cast<uint64_t>(len));
+  }
   before_query();
 
   FI_TRIGGER_TRAP(mysqlx, mysqlshdk::utils::FI::Trigger_options(
@@ -619,6 +654,8 @@ std::shared_ptr<IResult> XSession_impl::query(const char *sql, size_t len,
   auto result = after_query(std::move(xresult), buffered);
   timer.stage_end();
   result->set_execution_time(timer.total_seconds_elapsed());
+  shcore::current_log_sql()->record(
+      {sql, len}, std::chrono::nanoseconds{timer.total_nanoseconds_elapsed()});
   return result;
 }
 
@@ -658,6 +695,12 @@ std::shared_ptr<IResult> XSession_impl::execute_stmt(
   auto result = after_query(std::move(xresult));
   timer.stage_end();
   result->set_execution_time(timer.total_seconds_elapsed());
+
+  if (ns.empty() || ns == "sql") {
+    shcore::current_log_sql()->record(
+        stmt, std::chrono::nanoseconds{timer.total_nanoseconds_elapsed()});
+  }
+
   return result;
 }
 
@@ -758,6 +801,114 @@ void XSession_impl::deallocate_prep_stmt(uint32_t stmt_id) {
   m_prepared_statements.erase(stmt_id);
 }
 
+void XSession_impl::start_pipeline(std::size_t max_in_flight) {
+  before_query();
+
+  m_pipeline = true;
+  m_pipeline_max_in_flight = std::max<std::size_t>(1, max_in_flight);
+  m_pipeline_in_flight = 0;
+  m_pipeline_results.clear();
+}
+
+template <typename Message>
+void XSession_impl::pipeline_send(const Message &msg) {
+  if (!m_pipeline) {
+    throw std::logic_error("Pipeline is not active");
+  }
+
+  // read some replies before sending more data, otherwise both sides could
+  // block on full socket buffers
+  while (m_pipeline_in_flight >= m_pipeline_max_in_flight) {
+    pipeline_recv();
+  }
+
+  const auto error = _mysql->get_protocol().send(msg);
+
+  if (error) {
+    // message could have been partially sent, connection is unusable
+    reset_pipeline();
+    check_error_and_throw(error);
+  }
+
+  ++m_pipeline_in_flight;
+}
+
+void XSession_impl::enqueue(const ::Mysqlx::Crud::Insert &msg) {
+  pipeline_send(msg);
+}
+
+void XSession_impl::enqueue(const ::Mysqlx::Crud::Update &msg) {
+  pipeline_send(msg);
+}
+
+void XSession_impl::enqueue(const ::Mysqlx::Crud::Delete &msg) {
+  pipeline_send(msg);
+}
+
+void XSession_impl::enqueue(const ::Mysqlx::Sql::StmtExecute &msg) {
+  auto log_sql_handler = shcore::current_log_sql();
+  log_sql_handler->log(get_thread_id(), msg.stmt());
+  DBUG_LOG("sqlall", get_thread_id() << ": QUERY: " << msg.stmt());
+
+  pipeline_send(msg);
+}
+
+std::vector<Pipeline_result> XSession_impl::flush_pipeline() {
+  if (!m_pipeline) {
+    throw std::logic_error("Pipeline is not active");
+  }
+
+  while (m_pipeline_in_flight > 0) {
+    pipeline_recv();
+  }
+
+  auto results = std::move(m_pipeline_results);
+  reset_pipeline();
+
+  return results;
+}
+
+void XSession_impl::pipeline_recv() {
+  xcl::XError error;
+  std::unique_ptr<xcl::XQuery_result> xresult(
+      _mysql->get_protocol().recv_resultset(&error));
+
+  --m_pipeline_in_flight;
+
+  Pipeline_result result;
+
+  if (!error) {
+    try {
+      std::shared_ptr<Result> res(new Result(std::move(xresult)));
+      res->fetch_metadata();
+      res->pre_fetch_rows(true);
+      res->drain_resultset();
+      result.result = std::move(res);
+    } catch (const Error &e) {
+      if (is_mysql_client_error(e.code())) {
+        reset_pipeline();
+        store_error_and_throw(e);
+      }
+
+      result.error = e;
+    }
+  } else if (is_mysql_client_error(error.error())) {
+    reset_pipeline();
+    check_error_and_throw(error);
+  } else {
+    result.error = Error(error.what(), error.error());
+  }
+
+  m_pipeline_results.emplace_back(std::move(result));
+}
+
+void XSession_impl::reset_pipeline() {
+  m_pipeline = false;
+  m_pipeline_max_in_flight = 0;
+  m_pipeline_in_flight = 0;
+  m_pipeline_results.clear();
+}
+
 void XSession_impl::enable_notices(
     const std::vector<GlobalNotice::Type> &types) {
   if (!m_handler_installed) {
@@ -115,6 +115,32 @@ class SHCORE_PUBLIC IResult {
   double m_execution_time = 0.0;
 };
 
+/**
+ * Implemented by the objects which expose a result to the scripting
+ * languages, allows the language bridges to read the rows directly, without
+ * converting them to shcore::Value first.
+ */
+class SHCORE_PUBLIC IResult_source {
+ public:
+  /**
+   * @return The result to read the rows from, may be nullptr.
+   */
+  virtual IResult *get_result() const = 0;
+
+  /**
+   * @return true if the current result has rows which can be fetched.
+   */
+  virtual bool has_data() const = 0;
+
+  /**
+   * @return true if each row holds a single JSON document, such rows should
+   *         not be converted to a sequence of field values.
+   */
+  virtual bool has_documents() const { return false; }
+
+  virtual ~IResult_source() = default;
+};
+
 }  // namespace db
 }  // namespace mysqlshdk
 #endif  // MYSQLSHDK_LIBS_DB_RESULT_H_
@@ -26,6 +26,7 @@
 #include <cassert>
 #include <climits>  // C limit constants
 #include <cmath>    // HUGE_VAL
+#include <cstring>
 #include <limits>   // std::numeric_limits
 #include <memory>
 #include <stdexcept>
@@ -51,33 +52,60 @@ namespace db {
 
 #define GET_VALIDATE_TYPE(index, TYPE_CHECK)                                  \
   if (index >= num_fields()) throw FIELD_ERROR(index, "index out of bounds"); \
-  if (_data->fields[index] == nullptr)                                        \
-    throw FIELD_ERROR(index, "field is NULL");                                \
+  if (field(index).is_null) throw FIELD_ERROR(index, "field is NULL");        \
   ftype = get_type(index);                                                    \
   if (!(TYPE_CHECK))                                                          \
     throw FIELD_ERROR1(index, "field type is %s", to_string(ftype).c_str());
 
+namespace {
+
+constexpr std::size_t k_max_row_size = std::numeric_limits<uint32_t>::max();
+
+}  // namespace
+
 Row_copy::Row_copy(const IRow &row) {
-  _data = std::make_shared<Data>();
-  _data->types.reserve(row.num_fields());
-  _data->fields.reserve(row.num_fields());
+  const auto fields = row.num_fields();
+  std::size_t values_size = 0;
+
+  for (uint32_t i = 0; i < fields; i++) {
+    if (row.is_null(i)) continue;
+
+    switch (row.get_type(i)) {
+      case Type::String:
+      case Type::Bytes:
+        values_size += row.get_string_data(i).second;
+        break;
 
-  for (uint32_t c = row.num_fields(), i = 0; i < c; i++) {
-    _data->types.emplace_back(row.get_type(i));
+      case Type::Integer:
+      case Type::UInteger:
+      case Type::Float:
+      case Type::Double:
+        values_size += sizeof(uint64_t);
+        break;
 
-    if (row.is_null(i)) {
-      _data->fields.emplace_back(nullptr);
-      continue;
+      default:
+        // an estimate, buffer grows if it's not enough
+        values_size += 32;
+        break;
     }
+  }
 
-    switch (row.get_type(i)) {
+  reset(fields, values_size);
+
+  for (uint32_t i = 0; i < fields; i++) {
+    append_field(row.get_type(i));
+  }
+
+  for (uint32_t i = 0; i < fields; i++) {
+    if (row.is_null(i)) continue;
+
+    switch (field(i).type) {
       case Type::Null:
-        _data->fields.emplace_back(nullptr);
         break;
 
       case Type::Decimal:
-        _data->fields.emplace_back(
-            std::make_unique<Field_data<std::string>>(row.get_as_string(i)));
+      case Type::Bit:
+        set_value(i, row.get_as_string(i));
         break;
 
       case Type::Date:
@@ -87,55 +115,134 @@ Row_copy::Row_copy(const IRow &row) {
       case Type::Json:
       case Type::Enum:
       case Type::Set:
-        _data->fields.emplace_back(
-            std::make_unique<Field_data<std::string>>(row.get_string(i)));
+        set_value(i, row.get_string(i));
         break;
 
       case Type::String:
-        _data->fields.emplace_back(
-            std::make_unique<Field_data<std::string>>(row.get_string(i)));
+      case Type::Bytes: {
+        const auto data = row.get_string_data(i);
+        set_value(i, data.first, data.second);
         break;
+      }
 
-      case Type::Bytes:
-        _data->fields.emplace_back(
-            std::make_unique<Field_data<std::string>>(row.get_string(i)));
+      case Type::Integer: {
+        const auto v = row.get_int(i);
+        set_value(i, &v, sizeof(v));
         break;
+      }
 
-      case Type::Integer:
-        _data->fields.emplace_back(
-            std::make_unique<Field_data<int64_t>>(row.get_int(i)));
+      case Type::UInteger: {
+        const auto v = row.get_uint(i);
+        set_value(i, &v, sizeof(v));
         break;
+      }
 
-      case Type::UInteger:
-        _data->fields.emplace_back(
-            std::make_unique<Field_data<uint64_t>>(row.get_uint(i)));
+      case Type::Float: {
+        const auto v = row.get_float(i);
+        set_value(i, &v, sizeof(v));
         break;
+      }
 
-      case Type::Float:
-        _data->fields.emplace_back(
-            std::make_unique<Field_data<float>>(row.get_float(i)));
+      case Type::Double: {
+        const auto v = row.get_double(i);
+        set_value(i, &v, sizeof(v));
         break;
+      }
+    }
+  }
+}
 
-      case Type::Double:
-        _data->fields.emplace_back(
-            std::make_unique<Field_data<double>>(row.get_double(i)));
-        break;
+void Mem_row::init(const std::vector<Type> &types) {
+  reset(static_cast<uint32_t>(types.size()), 0);
 
-      case Type::Bit:
-        _data->fields.emplace_back(
-            std::make_unique<Field_data<std::string>>(row.get_as_string(i)));
-        break;
+  for (const auto type : types) {
+    append_field(type);
+  }
+}
+
+void Mem_row::reset(uint32_t fields, std::size_t values_size) {
+  m_buffer.clear();
+  m_buffer.reserve(field_offset(fields) + values_size);
+  m_buffer.append(reinterpret_cast<const char *>(&fields), sizeof(fields));
+}
+
+void Mem_row::append_field(Type type) {
+  const Field f{type, true, 0, 0};
+  m_buffer.append(reinterpret_cast<const char *>(&f), sizeof(f));
+}
+
+void Mem_row::set_value(uint32_t index, const void *data, std::size_t size) {
+  VALIDATE_INDEX(index);
+
+  auto f = field(index);
+  const auto base = values_offset();
+  const auto old_size = f.is_null ? 0 : f.size;
+
+  if (m_buffer.size() - base - old_size + size > k_max_row_size) {
+    throw FIELD_ERROR(index, "row is too big");
+  }
+
+  if (f.is_null) {
+    // new values are appended
+    f.offset = static_cast<uint32_t>(m_buffer.size() - base);
+    m_buffer.append(static_cast<const char *>(data), size);
+  } else {
+    m_buffer.replace(base + f.offset, f.size, static_cast<const char *>(data),
+                     size);
+
+    if (size != f.size) {
+      // move the values which follow this one
+      for (uint32_t i = 0, c = num_fields(); i < c; ++i) {
+        auto other = field(i);
+
+        if (!other.is_null && other.offset > f.offset) {
+          other.offset = static_cast<uint32_t>(other.offset - f.size + size);
+          set_field_info(i, other);
+        }
+      }
     }
   }
+
+  f.is_null = false;
+  f.size = static_cast<uint32_t>(size);
+  set_field_info(index, f);
+}
+
+void Mem_row::set_null(uint32_t index) {
+  VALIDATE_INDEX(index);
+
+  auto f = field(index);
+
+  if (f.is_null) return;
+
+  m_buffer.erase(values_offset() + f.offset, f.size);
+
+  for (uint32_t i = 0, c = num_fields(); i < c; ++i) {
+    auto other = field(i);
+
+    if (!other.is_null && other.offset > f.offset) {
+      other.offset -= f.size;
+      set_field_info(i, other);
+    }
+  }
+
+  f.is_null = true;
+  f.offset = 0;
+  f.size = 0;
+  set_field_info(index, f);
 }
 
 Type Mem_row::get_type(uint32_t index) const {
   VALIDATE_INDEX(index);
-  return _data->types[index];
+  return field(index).type;
 }
 
 uint32_t Mem_row::num_fields() const {
-  return static_cast<uint32_t>(_data->types.size());
+  if (m_buffer.empty()) return 0;
+
+  uint32_t fields;
+  ::memcpy(&fields, m_buffer.data(), sizeof(fields));
+  return fields;
 }
 
 std::string Mem_row::get_as_string(uint32_t index) const {
@@ -231,9 +338,8 @@ std::string Mem_row::get_string(uint32_t index) const {
 std::pair<const char *, size_t> Mem_row::get_string_data(uint32_t index) const {
   Type ftype;
   GET_VALIDATE_TYPE(index, (ftype == Type::String || ftype == Type::Bytes));
-  const auto &s =
-      static_cast<Field_data<std::string> *>(_data->fields[index].get())->value;
-  return {s.data(), s.size()};
+  const auto v = value(index);
+  return {v.data(), v.size()};
 }
 
 void Mem_row::get_raw_data(uint32_t index, const char **out_data,
@@ -296,21 +402,29 @@ std::tuple<uint64_t, int> Mem_row::get_bit(uint32_t index) const {
 
 bool Mem_row::is_null(uint32_t index) const {
   VALIDATE_INDEX(index);
-  return _data->fields[index] == nullptr;
+  return field(index).is_null;
 }
 
 void Mem_row::add_field(Type type, uint32_t offset) {
-  if (offset > _data->types.size())
+  const auto fields = num_fields();
+
+  if (offset > fields)
     throw std::invalid_argument("Attempt to insert column past row size");
 
-  _data->types.insert(_data->types.begin() + offset, type);
-  _data->fields.insert(_data->fields.begin() + offset, nullptr);
-}
+  if (m_buffer.empty()) {
+    init({});
+  }
 
-void Mem_row::add_field(Type type) {
-  _data->types.push_back(type);
-  _data->fields.push_back(nullptr);
+  // offsets of the values are relative, they do not change
+  const Field f{type, true, 0, 0};
+  m_buffer.insert(field_offset(offset), reinterpret_cast<const char *>(&f),
+                  sizeof(f));
+
+  const uint32_t new_fields = fields + 1;
+  ::memcpy(m_buffer.data(), &new_fields, sizeof(new_fields));
 }
 
+void Mem_row::add_field(Type type) { add_field(type, num_fields()); }
+
 }  // namespace db
 }  // namespace mysqlshdk
@@ -27,9 +27,12 @@
 #define MYSQLSHDK_LIBS_DB_ROW_COPY_H_
 
 #include <cassert>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include "mysqlshdk/include/mysqlshdk_export.h"
@@ -39,6 +42,12 @@
 namespace mysqlshdk {
 namespace db {
 
+/**
+ * Row which owns its data. All the fields are packed into a single buffer,
+ * which holds the number of fields, a table with type, offset and size of each
+ * field, followed by the values of the fields. Numbers are stored in their
+ * binary form, other values as strings.
+ */
 class SHCORE_PUBLIC Mem_row : public IRow {
  public:
   Mem_row() = default;
@@ -73,35 +82,86 @@ class SHCORE_PUBLIC Mem_row : public IRow {
   void add_field(Type type);
   void add_field(Type type, uint32_t offset);
 
+  /**
+   * Memory held by the values of this row.
+   */
+  std::size_t memory_size() const noexcept { return m_buffer.capacity(); }
+
  protected:
-  struct Field_data_ {
-    virtual ~Field_data_() = default;
+  struct Field {
+    Type type;
+    bool is_null;
+    // offset of the value, relative to the beginning of the values
+    uint32_t offset;
+    uint32_t size;
   };
 
-  template <typename T>
-  struct Field_data : public Field_data_ {
-    explicit Field_data(const T &v) : value(v) {}
-    explicit Field_data(T &&v) noexcept : value(std::move(v)) {}
-    T value;
-  };
+  /**
+   * Initializes the buffer, all fields are set to null.
+   *
+   * @param types Types of the fields.
+   */
+  void init(const std::vector<Type> &types);
 
-  template <typename T>
-  const T &get(size_t field) const {
-    assert(field < _data->fields.size());
-    if (field >= _data->fields.size())
+  /**
+   * Clears the buffer and reserves the memory for the given number of fields.
+   * Fields need to be added using append_field() before values are set.
+   *
+   * @param fields Number of fields.
+   * @param values_size Expected size of all the values.
+   */
+  void reset(uint32_t fields, std::size_t values_size);
+
+  void append_field(Type type);
+
+  void set_value(uint32_t index, const void *data, std::size_t size);
+
+  void set_value(uint32_t index, std::string_view value) {
+    set_value(index, value.data(), value.size());
+  }
+
+  void set_null(uint32_t index);
+
+  Field field(uint32_t index) const {
+    Field f;
+    ::memcpy(&f, m_buffer.data() + field_offset(index), sizeof(Field));
+    return f;
+  }
+
+  std::string_view value(uint32_t index) const {
+    assert(index < num_fields());
+    if (index >= num_fields())
       throw std::invalid_argument("Attempt to access invalid field");
-    return static_cast<Field_data<T> *>(_data->fields[field].get())->value;
+    const auto f = field(index);
+    return {m_buffer.data() + values_offset() + f.offset, f.size};
   }
 
-  struct Data {
-    std::vector<Type> types;
-    std::vector<std::unique_ptr<Field_data_>> fields;
+  template <typename T>
+  T get(uint32_t index) const {
+    const auto v = value(index);
 
-    Data() = default;
-    explicit Data(std::vector<Type> types_)
-        : types(std::move(types_)), fields(types.size()) {}
-  };
-  std::shared_ptr<Data> _data;
+    if constexpr (std::is_same_v<T, std::string>) {
+      return std::string{v};
+    } else {
+      static_assert(std::is_arithmetic_v<T>);
+      assert(v.size() == sizeof(T));
+      T result;
+      ::memcpy(&result, v.data(), sizeof(T));
+      return result;
+    }
+  }
+
+  static constexpr std::size_t field_offset(uint32_t index) {
+    return sizeof(uint32_t) + index * sizeof(Field);
+  }
+
+  std::size_t values_offset() const { return field_offset(num_fields()); }
+
+  void set_field_info(uint32_t index, const Field &f) {
+    ::memcpy(m_buffer.data() + field_offset(index), &f, sizeof(Field));
+  }
+
+  std::string m_buffer;
   mutable std::string m_raw_data_cache;
 };
 
@@ -134,12 +194,12 @@ class SHCORE_PUBLIC Mutable_row : public Mem_row {
   template <class T>
   typename std::enable_if<std::is_integral<T>::value>::type set_field(
       uint32_t index, T &&arg) {
-    if (_data->types[index] == Type::Integer)
-      _data->fields[index] = std::unique_ptr<Field_data_>(
-          new Field_data<int64_t>(std::forward<T>(arg)));
-    else if (_data->types[index] == Type::UInteger)
-      _data->fields[index] = std::unique_ptr<Field_data_>(
-          new Field_data<uint64_t>(std::forward<T>(arg)));
+    const auto type = get_type(index);
+
+    if (type == Type::Integer)
+      set_number<int64_t>(index, arg);
+    else if (type == Type::UInteger)
+      set_number<uint64_t>(index, arg);
     else
       throw std::invalid_argument(
           "Attempt to write integer value to non integer field");
@@ -148,58 +208,64 @@ class SHCORE_PUBLIC Mutable_row : public Mem_row {
   template <class T>
   typename std::enable_if<std::is_floating_point<T>::value>::type set_field(
       uint32_t index, T &&arg) {
-    if (_data->types[index] != Type::Float &&
-        _data->types[index] != Type::Double)
+    const auto type = get_type(index);
+
+    if (type == Type::Float)
+      set_number<float>(index, arg);
+    else if (type == Type::Double)
+      set_number<double>(index, arg);
+    else
       throw std::invalid_argument(
           "Attempt to write floating point number to not neither float or "
           "double field.");
-    _data->fields[index] =
-        std::make_unique<Field_data<T>>(std::forward<T>(arg));
   }
 
   template <class T>
   typename std::enable_if<std::is_same<T, std::nullptr_t>::value>::type
   set_field(uint32_t index, T && /*arg*/) {
-    _data->fields[index] = nullptr;
+    set_null(index);
   }
 
   template <class T>
   typename std::enable_if<!std::is_arithmetic<T>::value &&
                           !std::is_same<T, std::nullptr_t>::value>::type
   set_field(uint32_t index, T &&arg) {
-    if (_data->types[index] >= Type::Integer &&
-        _data->types[index] <= Type::Double)
+    const auto type = get_type(index);
+
+    if (type >= Type::Integer && type <= Type::Double)
       throw std::invalid_argument(
           "Attempt to write arithmetic type to non arithmetic field");
-    _data->fields[index] = std::unique_ptr<Field_data_>(
-        new Field_data<std::string>(std::string(std::forward<T>(arg))));
+    set_value(index, std::string_view(arg));
   }
 
  private:
+  template <class N, class T>
+  void set_number(uint32_t index, T arg) {
+    const auto n = static_cast<N>(arg);
+    set_value(index, &n, sizeof(n));
+  }
+
   template <class T, class... Args>
   void set_field(uint32_t start, T &&value, Args... args) {
     set_field(start, std::forward<T>(value));
-    if (start < _data->fields.size())
-      set_field(start + 1, std::forward<Args>(args)...);
+    if (start < num_fields()) set_field(start + 1, std::forward<Args>(args)...);
   }
 
  public:
   template <class... Args>
   void set_row_values(Args... args) {
     constexpr int n = sizeof...(args);
-    if (n != _data->fields.size())
+    if (n != num_fields())
       throw std::invalid_argument(
           "The number of arguments does not match the row size");
     set_field(0, std::forward<Args>(args)...);
   }
 
-  explicit Mutable_row(const std::vector<Type> &types) {
-    _data = std::make_shared<Data>(types);
-  }
+  explicit Mutable_row(const std::vector<Type> &types) { init(types); }
 
   template <class... Args>
   Mutable_row(const std::vector<Type> &types, Args... args) {
-    _data = std::make_shared<Data>(types);
+    init(types);
     set_row_values(std::forward<Args>(args)...);
   }
 
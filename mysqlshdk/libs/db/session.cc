@@ -60,6 +60,26 @@ void ISession::close() {
   }
 }
 
+std::shared_ptr<IResult> ISession::query_prepared(
+    const std::string &sql, const std::vector<Statement_param> &params) {
+  shcore::sqlstring query{sql, 0};
+
+  for (const auto &param : params) {
+    std::visit(
+        [&query](const auto &value) {
+          if constexpr (std::is_same_v<std::decay_t<decltype(value)>,
+                                       std::nullptr_t>) {
+            query << static_cast<const char *>(nullptr);
+          } else {
+            query << value;
+          }
+        },
+        param);
+  }
+
+  return this->query(query.str(), true);
+}
+
 void ISession::refresh_sql_mode() {
   assert(is_open());
   try {
@@ -35,6 +35,10 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
 #ifdef _WIN32
 #include <winsock2.h>
 using socket_t = SOCKET;
@@ -111,6 +115,48 @@ class Error : public shcore::Error {
   std::string sqlstate_;
 };
 
+/**
+ * Value of a parameter of a prepared statement.
+ */
+using Statement_param =
+    std::variant<std::nullptr_t, int64_t, uint64_t, double, std::string>;
+
+namespace detail {
+
+/**
+ * Whether an argument of queryf()/executef() can be bound to a parameter of a
+ * prepared statement (numbers and strings), instead of being formatted.
+ */
+template <typename T>
+inline constexpr bool is_statement_param_v =
+    std::is_arithmetic_v<std::decay_t<T>> ||
+    std::is_null_pointer_v<std::decay_t<T>> ||
+    std::is_convertible_v<const std::decay_t<T> &, std::string_view>;
+
+template <typename T>
+inline Statement_param to_statement_param(const T &value) {
+  using U = std::decay_t<T>;
+
+  if constexpr (std::is_null_pointer_v<U>) {
+    return nullptr;
+  } else if constexpr (std::is_same_v<U, bool> ||
+                (std::is_integral_v<U> && std::is_signed_v<U>)) {
+    return static_cast<int64_t>(value);
+  } else if constexpr (std::is_integral_v<U>) {
+    return static_cast<uint64_t>(value);
+  } else if constexpr (std::is_floating_point_v<U>) {
+    return static_cast<double>(value);
+  } else if constexpr (std::is_pointer_v<U>) {
+    // sqlstring formats a null C string as NULL
+    return value ? Statement_param{std::string{value}}
+                 : Statement_param{nullptr};
+  } else {
+    return std::string{std::string_view{value}};
+  }
+}
+
+}  // namespace detail
+
 class SHCORE_PUBLIC ISession {
  public:
   // Connection
@@ -175,15 +221,45 @@ class SHCORE_PUBLIC ISession {
    */
   template <typename... Args>
   inline std::shared_ptr<IResult> queryf(std::string sql, Args &&... args) {
+    if constexpr ((detail::is_statement_param_v<Args> && ...)) {
+      if (prepared_statement_cache_enabled()) {
+        return query_prepared(sql, {detail::to_statement_param(args)...});
+      }
+    }
+
     return query(
         shcore::sqlformat(std::move(sql), std::forward<Args>(args)...));
   }
 
   template <typename... Args>
   inline void executef(std::string sql, Args &&... args) {
+    if constexpr ((detail::is_statement_param_v<Args> && ...)) {
+      if (prepared_statement_cache_enabled()) {
+        query_prepared(sql, {detail::to_statement_param(args)...});
+        return;
+      }
+    }
+
     execute(shcore::sqlformat(std::move(sql), std::forward<Args>(args)...));
   }
 
+  /**
+   * Whether queryf() and executef() use cached server-side prepared
+   * statements, if all their arguments can be bound as parameters.
+   */
+  virtual bool prepared_statement_cache_enabled() const { return false; }
+
+  /**
+   * Executes a query template (with ? placeholders, as in sqlstring) using a
+   * cached prepared statement, binding the given values as its parameters.
+   * Result is always buffered.
+   *
+   * Templates which cannot be prepared are formatted and executed as a
+   * regular query.
+   */
+  virtual std::shared_ptr<IResult> query_prepared(
+      const std::string &sql, const std::vector<Statement_param> &params);
+
   // Disconnection
   void close();
 
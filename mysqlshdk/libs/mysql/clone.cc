@@ -17,6 +17,9 @@
  * 02110-1301  USA
  */
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <string>
 
 #include "modules/adminapi/common/server_features.h"
@@ -181,5 +184,35 @@ Clone_status check_clone_status(const mysqlshdk::mysql::IInstance &instance,
   return status;
 }
 
+Clone_donor_probe probe_clone_donor(const mysqlshdk::mysql::IInstance &donor) {
+  constexpr int k_samples = 3;
+  Clone_donor_probe probe;
+
+  try {
+    probe.latency_ms = std::numeric_limits<double>::max();
+
+    for (int i = 0; i < k_samples; ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      donor.query("SELECT 1");
+      const std::chrono::duration<double, std::milli> elapsed =
+          std::chrono::steady_clock::now() - start;
+      probe.latency_ms = std::min(probe.latency_ms, elapsed.count());
+    }
+
+    probe.load = static_cast<uint64_t>(donor.queryf_one_int(
+        0, 0,
+        "SELECT CAST(SUM(VARIABLE_VALUE) AS UNSIGNED) FROM "
+        "performance_schema.global_status WHERE VARIABLE_NAME IN "
+        "('Threads_running', 'Innodb_data_pending_reads', "
+        "'Innodb_data_pending_writes')"));
+  } catch (const shcore::Error &e) {
+    log_info("Could not probe clone donor '%s': %s", donor.descr().c_str(),
+             e.format().c_str());
+    probe.latency_ms = std::numeric_limits<double>::max();
+  }
+
+  return probe;
+}
+
 }  // namespace mysql
 }  // namespace mysqlshdk
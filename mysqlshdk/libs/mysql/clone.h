@@ -24,6 +24,7 @@
 #ifndef MYSQLSHDK_LIBS_MYSQL_CLONE_H_
 #define MYSQLSHDK_LIBS_MYSQL_CLONE_H_
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -165,6 +166,31 @@ struct Clone_status {
   }
 };
 
+/**
+ * Load and responsiveness of a candidate clone donor.
+ */
+struct Clone_donor_probe {
+  // best round-trip time of a trivial query, in milliseconds
+  double latency_ms = 0.0;
+  // number of running threads and pending InnoDB I/O requests
+  uint64_t load = 0;
+
+  /**
+   * The lower the score, the better the donor.
+   */
+  double score() const { return latency_ms * static_cast<double>(1 + load); }
+};
+
+/**
+ * Measures the load and the responsiveness of a candidate clone donor.
+ *
+ * @param donor the candidate donor
+ *
+ * @return probe results, latency is set to the maximum value if instance could
+ *         not be probed
+ */
+Clone_donor_probe probe_clone_donor(const mysqlshdk::mysql::IInstance &donor);
+
 /**
  * Check clone progress at the given instance.
  *
@@ -24,7 +24,11 @@
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 
 #include <algorithm>
+#include <limits>
+#include <map>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/mysql/replication.h"
@@ -134,6 +138,213 @@ void iter_ranges(std::string_view gtids, auto &&cb) {
       },
       ",");
 }
+
+/*
+ * Native representation of a GTID set, used to implement the set algebra
+ * without querying the server: the GTIDs of each UUID/tag pair are kept as a
+ * sorted vector of disjoint, non-adjacent closed intervals, which allows all
+ * the operations to be implemented as linear merges.
+ */
+using Gtid_interval = std::pair<uint64_t, uint64_t>;
+using Gtid_intervals = std::vector<Gtid_interval>;
+
+struct Gtid_tsid {
+  std::string uuid;
+  std::string tag;
+
+  auto operator<=>(const Gtid_tsid &) const = default;
+};
+
+using Gtid_map = std::map<Gtid_tsid, Gtid_intervals>;
+
+// the maximum GNO accepted by the server
+constexpr uint64_t k_max_gno = std::numeric_limits<int64_t>::max();
+
+[[noreturn]] void throw_invalid_gtid_set(std::string_view gtid_set) {
+  throw std::invalid_argument(shcore::str_format(
+      "Invalid GTID set: '%.*s'", static_cast<int>(gtid_set.size()),
+      gtid_set.data()));
+}
+
+std::string to_lower(std::string_view s) {
+  std::string lower;
+  lower.reserve(s.size());
+  std::transform(s.begin(), s.end(), std::back_inserter(lower), ::tolower);
+  return lower;
+}
+
+/*
+ * Sorts the intervals and merges the ones which overlap or are adjacent.
+ */
+void coalesce(Gtid_intervals *intervals) {
+  if (intervals->size() < 2) return;
+
+  std::sort(intervals->begin(), intervals->end());
+
+  auto last = intervals->begin();
+
+  for (auto it = std::next(last); it != intervals->end(); ++it) {
+    if (it->first <= last->second + 1) {
+      last->second = std::max(last->second, it->second);
+    } else {
+      *(++last) = *it;
+    }
+  }
+
+  intervals->erase(std::next(last), intervals->end());
+}
+
+Gtid_map parse_gtid_set(std::string_view gtid_set) {
+  Gtid_map gtids;
+
+  shcore::str_itersplit(
+      gtid_set,
+      [&gtids, gtid_set](std::string_view gtid) {
+        gtid = shcore::str_strip_view(gtid);
+        if (gtid.empty()) return true;
+
+        const auto p = gtid.find(':');
+        if (p == std::string_view::npos || 0 == p ||
+            shcore::str_strip_view(gtid.substr(p + 1)).empty())
+          throw_invalid_gtid_set(gtid_set);
+
+        Gtid_tsid tsid{to_lower(shcore::str_strip_view(gtid.substr(0, p))), {}};
+        auto *intervals = &gtids[tsid];
+
+        shcore::str_itersplit(
+            gtid.substr(p + 1),
+            [&](std::string_view range) {
+              range = shcore::str_strip_view(range);
+              if (range.empty()) throw_invalid_gtid_set(gtid_set);
+
+              if (is_gtid_tag(range)) {
+                tsid.tag = to_lower(range);
+                intervals = &gtids[tsid];
+                return true;
+              }
+
+              uint64_t begin, end;
+              if (!read_range(range, &begin, &end) || 0 == begin ||
+                  end < begin || end > k_max_gno)
+                throw_invalid_gtid_set(gtid_set);
+
+              intervals->emplace_back(begin, end);
+              return true;
+            },
+            ":");
+
+        return true;
+      },
+      ",");
+
+  for (auto it = gtids.begin(); it != gtids.end();) {
+    if (it->second.empty()) {
+      it = gtids.erase(it);
+    } else {
+      coalesce(&it->second);
+      ++it;
+    }
+  }
+
+  return gtids;
+}
+
+/*
+ * Formats the GTID set the same way the server does: UUIDs in ascending
+ * order separated with ",\n", untagged GTIDs of an UUID first, followed by
+ * the tagged ones in ascending order of tags.
+ */
+std::string format_gtid_set(const Gtid_map &gtids) {
+  std::string result;
+  const std::string *uuid = nullptr;
+
+  for (const auto &[tsid, intervals] : gtids) {
+    if (!uuid || *uuid != tsid.uuid) {
+      if (uuid) result.append(",\n");
+      result.append(tsid.uuid);
+      uuid = &tsid.uuid;
+    }
+
+    if (!tsid.tag.empty()) result.append(":").append(tsid.tag);
+
+    for (const auto &[begin, end] : intervals) {
+      result.append(":").append(std::to_string(begin));
+      if (begin != end) result.append("-").append(std::to_string(end));
+    }
+  }
+
+  return result;
+}
+
+/*
+ * a = a - b
+ */
+void subtract_intervals(Gtid_intervals *a, const Gtid_intervals &b) {
+  Gtid_intervals result;
+  result.reserve(a->size() + b.size());
+
+  auto it = b.begin();
+
+  for (auto [begin, end] : *a) {
+    // skip intervals which end before this one starts
+    while (it != b.end() && it->second < begin) ++it;
+
+    for (auto cut = it; cut != b.end() && cut->first <= end; ++cut) {
+      if (cut->first > begin) result.emplace_back(begin, cut->first - 1);
+      begin = cut->second + 1;
+
+      if (begin > end) break;
+    }
+
+    if (begin <= end) result.emplace_back(begin, end);
+  }
+
+  *a = std::move(result);
+}
+
+/*
+ * a = intersection of a and b
+ */
+void intersect_intervals(Gtid_intervals *a, const Gtid_intervals &b) {
+  Gtid_intervals result;
+  result.reserve(std::max(a->size(), b.size()));
+
+  auto ia = a->begin();
+  auto ib = b.begin();
+
+  while (ia != a->end() && ib != b.end()) {
+    const auto begin = std::max(ia->first, ib->first);
+    const auto end = std::min(ia->second, ib->second);
+
+    if (begin <= end) result.emplace_back(begin, end);
+
+    // advance the interval which ends first
+    if (ia->second < ib->second) {
+      ++ia;
+    } else {
+      ++ib;
+    }
+  }
+
+  *a = std::move(result);
+}
+
+/*
+ * Checks if a contains all the intervals from b.
+ */
+bool contains_intervals(const Gtid_intervals &a, const Gtid_intervals &b) {
+  auto ia = a.begin();
+
+  for (const auto &[begin, end] : b) {
+    // intervals are disjoint and non-adjacent, so the whole interval from b
+    // needs to be contained in a single interval from a
+    while (ia != a.end() && ia->second < begin) ++ia;
+
+    if (ia == a.end() || ia->first > begin || ia->second < end) return false;
+  }
+
+  return true;
+}
 }  // namespace
 
 Gtid_range::Gtid_range(std::string_view range_uuid, std::string_view range_tag,
@@ -187,36 +398,64 @@ Gtid_set Gtid_set::from_received_transaction_set(
   return Gtid_set(get_received_gtid_set(server, channel), true);
 }
 
-Gtid_set &Gtid_set::normalize(const mysqlshdk::mysql::IInstance &server) {
+Gtid_set &Gtid_set::normalize() {
   if (!std::exchange(m_normalized, true)) {
-    m_gtid_set = server.queryf_one_string(0, "", "SELECT gtid_subtract(?, '')",
-                                          m_gtid_set);
+    m_gtid_set = format_gtid_set(parse_gtid_set(m_gtid_set));
   }
   return *this;
 }
 
-Gtid_set &Gtid_set::intersect(const Gtid_set &other,
-                              const mysqlshdk::mysql::IInstance &server) {
+Gtid_set &Gtid_set::intersect(const Gtid_set &other) {
+  m_normalized = true;
+
   if (m_gtid_set.empty() || other.m_gtid_set.empty()) {
     m_gtid_set.clear();
-    m_normalized = false;
     return *this;
   }
 
-  // a /\ b = a - (a - b)
-  m_normalized = true;
-  m_gtid_set = server.queryf_one_string(
-      0, "", "SELECT gtid_subtract(?, gtid_subtract(?, ?))", other.m_gtid_set,
-      other.m_gtid_set, m_gtid_set);
+  auto gtids = parse_gtid_set(m_gtid_set);
+  const auto other_gtids = parse_gtid_set(other.m_gtid_set);
+
+  for (auto it = gtids.begin(); it != gtids.end();) {
+    if (const auto o = other_gtids.find(it->first); o != other_gtids.end()) {
+      intersect_intervals(&it->second, o->second);
+    } else {
+      it->second.clear();
+    }
+
+    if (it->second.empty()) {
+      it = gtids.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  m_gtid_set = format_gtid_set(gtids);
 
   return *this;
 }
 
-Gtid_set &Gtid_set::subtract(const Gtid_set &other,
-                             const mysqlshdk::mysql::IInstance &server) {
+Gtid_set &Gtid_set::subtract(const Gtid_set &other) {
+  if (other.m_gtid_set.empty()) return normalize();
+
+  auto gtids = parse_gtid_set(m_gtid_set);
+  const auto other_gtids = parse_gtid_set(other.m_gtid_set);
+
+  for (auto it = gtids.begin(); it != gtids.end();) {
+    if (const auto o = other_gtids.find(it->first); o != other_gtids.end()) {
+      subtract_intervals(&it->second, o->second);
+    }
+
+    if (it->second.empty()) {
+      it = gtids.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
   m_normalized = true;
-  m_gtid_set = server.queryf_one_string(0, "", "SELECT gtid_subtract(?, ?)",
-                                        m_gtid_set, other.m_gtid_set);
+  m_gtid_set = format_gtid_set(gtids);
+
   return *this;
 }
 
@@ -302,10 +541,20 @@ Gtid_set Gtid_set::get_gtids_from(std::string_view uuid,
   return matches;
 }
 
-bool Gtid_set::contains(const Gtid_set &other,
-                        const mysqlshdk::mysql::IInstance &server) const {
-  return server.queryf_one_int(0, 0, "SELECT gtid_subtract(?, ?) = ''",
-                               other.m_gtid_set, m_gtid_set) != 0;
+bool Gtid_set::contains(const Gtid_set &other) const {
+  if (other.m_gtid_set.empty()) return true;
+  if (m_gtid_set.empty()) return false;
+
+  const auto gtids = parse_gtid_set(m_gtid_set);
+
+  for (const auto &[tsid, intervals] : parse_gtid_set(other.m_gtid_set)) {
+    const auto it = gtids.find(tsid);
+
+    if (it == gtids.end() || !contains_intervals(it->second, intervals))
+      return false;
+  }
+
+  return true;
 }
 
 uint64_t Gtid_set::count() const {
@@ -84,24 +84,27 @@ class Gtid_set {
   static Gtid_set from_received_transaction_set(
       const mysqlshdk::mysql::IInstance &server, std::string_view channel);
 
-  Gtid_set &normalize(const mysqlshdk::mysql::IInstance &server);
+  /*
+   * Merges and sorts the ranges, producing the same output as the server.
+   *
+   * Set operations are computed natively, they do not query the server.
+   * Malformed GTID sets are reported with std::invalid_argument.
+   */
+  Gtid_set &normalize();
 
-  Gtid_set &subtract(const Gtid_set &other,
-                     const mysqlshdk::mysql::IInstance &server);
+  Gtid_set &subtract(const Gtid_set &other);
 
   Gtid_set &add(const Gtid &gtid);
   Gtid_set &add(const Gtid_set &other);
   Gtid_set &add(const Gtid_range &gtids);
 
-  Gtid_set &intersect(const Gtid_set &other,
-                      const mysqlshdk::mysql::IInstance &server);
+  Gtid_set &intersect(const Gtid_set &other);
 
   Gtid_set get_gtids_tagged() const;
   Gtid_set get_gtids_from(std::string_view uuid) const;
   Gtid_set get_gtids_from(std::string_view uuid, std::string_view tag) const;
 
-  bool contains(const Gtid_set &other,
-                const mysqlshdk::mysql::IInstance &server) const;
+  bool contains(const Gtid_set &other) const;
 
   void enumerate(const std::function<void(Gtid)> &fn) const;
 
@@ -893,8 +893,8 @@ Gtid_set_relation compare_gtid_sets(const mysqlshdk::mysql::IInstance &server,
         SHERR_UNSUPPORTED_GTID_TAG);
   }
 
-  auto a_sub_b = mysqlshdk::mysql::Gtid_set{set_a}.subtract(set_b, server);
-  auto b_sub_a = mysqlshdk::mysql::Gtid_set{set_b}.subtract(set_a, server);
+  auto a_sub_b = mysqlshdk::mysql::Gtid_set{set_a}.subtract(set_b);
+  auto b_sub_a = mysqlshdk::mysql::Gtid_set{set_b}.subtract(set_a);
 
   if (out_missing_from_a) *out_missing_from_a = b_sub_a.str();
   if (out_missing_from_b) *out_missing_from_b = a_sub_b.str();
@@ -903,7 +903,7 @@ Gtid_set_relation compare_gtid_sets(const mysqlshdk::mysql::IInstance &server,
   if (a_sub_b.empty() && !b_sub_a.empty()) return Gtid_set_relation::CONTAINED;
   if (!a_sub_b.empty() && b_sub_a.empty()) return Gtid_set_relation::CONTAINS;
 
-  set_b.intersect(set_a, server);
+  set_b.intersect(set_a);
   return set_b.empty() ? Gtid_set_relation::DISJOINT
                        : Gtid_set_relation::INTERSECTS;
 }
@@ -953,32 +953,32 @@ void compute_joining_replica_gtid_state(
     auto gtids = purged_gtids.begin();
     completely_purged_gtids = *gtids;
     for (++gtids; gtids != purged_gtids.end(); ++gtids) {
-      completely_purged_gtids.intersect(*gtids, instance);
+      completely_purged_gtids.intersect(*gtids);
     }
   }
 
   // compute missing and errant trxs
   *out_missing_gtids = primary_gtids;
-  out_missing_gtids->subtract(joiner_gtids, instance);
+  out_missing_gtids->subtract(joiner_gtids);
 
   *out_errant_gtids = joiner_gtids;
-  out_errant_gtids->subtract(primary_gtids, instance);
+  out_errant_gtids->subtract(primary_gtids);
 
   // from the missing trxs, check what's non-recoverable
   *out_unrecoverable_gtids = *out_missing_gtids;
-  out_unrecoverable_gtids->intersect(completely_purged_gtids, instance);
+  out_unrecoverable_gtids->intersect(completely_purged_gtids);
 
   // missing gtids that are recoverable
-  out_missing_gtids->subtract(*out_unrecoverable_gtids, instance);
+  out_missing_gtids->subtract(*out_unrecoverable_gtids);
 
   // from the errant trxs, check what's allowed (e.g. VCLEs)
   *out_allowed_errant_gtids = Gtid_set();
   for (const auto &uuid : allowed_errant_uuids) {
     out_allowed_errant_gtids->add(out_errant_gtids->get_gtids_from(uuid));
   }
-  out_allowed_errant_gtids->normalize(instance);
+  out_allowed_errant_gtids->normalize();
 
-  out_errant_gtids->subtract(*out_allowed_errant_gtids, instance);
+  out_errant_gtids->subtract(*out_allowed_errant_gtids);
 }
 
 Replica_gtid_state check_replica_gtid_state(
@@ -91,7 +91,8 @@ Oci_bucket::Oci_bucket(const Oci_bucket_config_ptr &config)
 
 rest::Signed_request Oci_bucket::list_objects_request(
     const std::string &prefix, size_t limit, bool recursive,
-    const Object_details::Fields_mask &fields, const std::string &start_from) {
+    const Object_details::Fields_mask &fields, const std::string &start_from,
+    const std::string &start_after) {
   std::vector<std::string> parameters;
 
   if (!prefix.empty()) {
@@ -130,6 +131,9 @@ rest::Signed_request Oci_bucket::list_objects_request(
 
   if (!start_from.empty()) {
     parameters.emplace_back("start=" + pctencode_query_value(start_from));
+  } else if (!start_after.empty()) {
+    parameters.emplace_back("startAfter=" +
+                            pctencode_query_value(start_after));
   }
 
   auto path = kListObjectsPath;
@@ -90,8 +90,8 @@ class Oci_bucket : public storage::backend::object_storage::Container {
 
   rest::Signed_request list_objects_request(
       const std::string &prefix, size_t limit, bool recursive,
-      const Object_details::Fields_mask &fields,
-      const std::string &start_from) override;
+      const Object_details::Fields_mask &fields, const std::string &start_from,
+      const std::string &start_after) override;
 
   std::vector<Object_details> parse_list_objects(
       const rest::Base_response_buffer &buffer, std::string *next_start_from,
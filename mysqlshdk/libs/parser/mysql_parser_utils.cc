@@ -27,6 +27,60 @@
 namespace mysqlshdk {
 namespace parser {
 
+namespace {
+
+/**
+ * Lexer and parser which are reused by all syntax checks executed by a single
+ * thread, so that their state does not have to be recreated for each call.
+ */
+struct Thread_parser {
+  Thread_parser() : lexer(&input), tokens(&lexer), parser(&tokens) {
+    lexer.addErrorListener(&error_listener);
+  }
+
+  internal::ParserErrorListener error_listener;
+  antlr4::ANTLRInputStream input;
+  parsers::MySQLLexer lexer;
+  antlr4::CommonTokenStream tokens;
+  parsers::MySQLParser parser;
+};
+
+Thread_parser &thread_parser() {
+  thread_local Thread_parser parser;
+  return parser;
+}
+
+}  // namespace
+
+namespace internal {
+
+antlr4::tree::ParseTree *parse_query(
+    parsers::MySQLParser *parser, antlr4::ANTLRErrorListener *error_listener) {
+  const auto interpreter =
+      parser->getInterpreter<antlr4::atn::ParserATNSimulator>();
+
+  // SLL stage: errors are not reported, the first one aborts the parser
+  parser->removeErrorListeners();
+  parser->setErrorHandler(std::make_shared<antlr4::BailErrorStrategy>());
+  interpreter->setPredictionMode(antlr4::atn::PredictionMode::SLL);
+
+  try {
+    return parser->query();
+  } catch (const antlr4::ParseCancellationException &) {
+    // either a syntax error or SLL wasn't able to handle this query
+  }
+
+  // LL stage: rewind the tokens and parse again, reporting the errors
+  parser->reset();
+  parser->addErrorListener(error_listener);
+  parser->setErrorHandler(std::make_shared<antlr4::DefaultErrorStrategy>());
+  interpreter->setPredictionMode(antlr4::atn::PredictionMode::LL);
+
+  return parser->query();
+}
+
+}  // namespace internal
+
 void prepare_lexer_parser(parsers::MySQLLexer *lexer,
                           parsers::MySQLParser *parser,
                           const mysqlshdk::utils::Version &mysql_version,
@@ -51,10 +105,11 @@ void prepare_lexer_parser(parsers::MySQLLexer *lexer,
 void check_sql_syntax(const std::string &script,
                       const mysqlshdk::utils::Version &mysql_version,
                       bool ansi_quotes, bool no_backslash_escapes) {
-  antlr4::ANTLRInputStream input;
-  parsers::MySQLLexer lexer(&input);
-  antlr4::CommonTokenStream tokens(&lexer);
-  parsers::MySQLParser parser(&tokens);
+  auto &ctx = thread_parser();
+  auto &input = ctx.input;
+  auto &lexer = ctx.lexer;
+  auto &tokens = ctx.tokens;
+  auto &parser = ctx.parser;
 
   // TODO(alfredo) stop forcing ansi_quotes when parser fixed
   prepare_lexer_parser(&lexer, &parser, mysql_version, ansi_quotes || true,
@@ -65,17 +120,14 @@ void check_sql_syntax(const std::string &script,
       &stream, 4098,
       [&](std::string_view stmt, std::string_view /*delim*/, size_t /*lnum*/,
           size_t /* offs */) {
-        internal::ParserErrorListener error_listener;
         parser.reset();
         lexer.reset();
-        lexer.addErrorListener(&error_listener);
-        parser.addErrorListener(&error_listener);
         input.load(std::string(stmt));
         lexer.setInputStream(&input);
         tokens.setTokenSource(&lexer);
         parser.setTokenStream(&tokens);
 
-        parser.query();
+        internal::parse_query(&parser, &ctx.error_listener);
 
         return true;
       },
@@ -158,6 +158,14 @@ class ParserErrorListener : public antlr4::BaseErrorListener {
   }
 };
 
+/**
+ * Parses a query using the two-stage strategy: the faster SLL prediction mode
+ * is tried first, if it fails, query is parsed again using the full LL mode,
+ * which reports the syntax errors (if there are any) to the given listener.
+ */
+antlr4::tree::ParseTree *parse_query(
+    parsers::MySQLParser *parser, antlr4::ANTLRErrorListener *error_listener);
+
 }  // namespace internal
 
 void prepare_lexer_parser(parsers::MySQLLexer *lexer,
@@ -180,7 +188,6 @@ void traverse_script_ast(
 
   internal::ParserErrorListener error_listener;
   lexer.addErrorListener(&error_listener);
-  parser.addErrorListener(&error_listener);
 
   prepare_lexer_parser(&lexer, &parser, mysql_version, ansi_quotes,
                        no_backslash_escapes);
@@ -207,9 +214,10 @@ void traverse_script_ast(
         parser.setTokenStream(&tokens);
 
         on_stmt(sql, offs, true);
-        internal::do_traverse_statement_ast(rule_names, vocabulary,
-                                            parser.query(), root_data, on_rule,
-                                            on_term, on_error);
+        internal::do_traverse_statement_ast(
+            rule_names, vocabulary,
+            internal::parse_query(&parser, &error_listener), root_data,
+            on_rule, on_term, on_error);
         on_stmt(sql, offs, false);
         return true;
       },
@@ -235,7 +243,6 @@ void traverse_statement_ast(
 
   internal::ParserErrorListener error_listener;
   lexer.addErrorListener(&error_listener);
-  parser.addErrorListener(&error_listener);
 
   prepare_lexer_parser(&lexer, &parser, mysql_version, ansi_quotes,
                        no_backslash_escapes);
@@ -245,8 +252,9 @@ void traverse_statement_ast(
   auto &rule_names = parser.getRuleNames();
   auto &vocabulary = parser.getVocabulary();
 
-  internal::do_traverse_statement_ast(rule_names, vocabulary, parser.query(),
-                                      root_data, on_rule, on_term, on_error);
+  internal::do_traverse_statement_ast(
+      rule_names, vocabulary, internal::parse_query(&parser, &error_listener),
+      root_data, on_rule, on_term, on_error);
 }
 
 void check_sql_syntax(const std::string &script,
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "mysqlshdk/libs/rest/concurrency_limiter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlshdk {
+namespace rest {
+
+Concurrency_limiter::Permit &Concurrency_limiter::Permit::operator=(
+    Permit &&other) noexcept {
+  if (this != &other) {
+    release(Outcome::OTHER);
+
+    m_limiter = std::exchange(other.m_limiter, nullptr);
+    m_generation = other.m_generation;
+  }
+
+  return *this;
+}
+
+void Concurrency_limiter::Permit::release(Outcome outcome) {
+  if (m_limiter) {
+    std::exchange(m_limiter, nullptr)->release(m_generation, outcome);
+  }
+}
+
+Concurrency_limiter::Concurrency_limiter(double initial, double min,
+                                         double max)
+    : m_min(std::max(1.0, min)),
+      m_max(std::max(m_min, max)),
+      m_limit(std::clamp(initial, m_min, m_max)) {}
+
+Concurrency_limiter &Concurrency_limiter::instance() {
+  // intentionally leaked, requests may be executed after static objects are
+  // destroyed; the initial limit is high enough not to restrict anything until
+  // the first throttling response is received
+  static const auto s_limiter = new Concurrency_limiter(1024, 1, 1024);
+  return *s_limiter;
+}
+
+Concurrency_limiter::Permit Concurrency_limiter::acquire() {
+  std::unique_lock lock{m_mutex};
+
+  m_cv.wait(lock, [this]() {
+    return static_cast<double>(m_in_flight) < std::floor(m_limit);
+  });
+
+  ++m_in_flight;
+
+  return Permit{this, m_generation};
+}
+
+double Concurrency_limiter::limit() const {
+  std::lock_guard lock{m_mutex};
+  return m_limit;
+}
+
+std::size_t Concurrency_limiter::in_flight() const {
+  std::lock_guard lock{m_mutex};
+  return m_in_flight;
+}
+
+void Concurrency_limiter::release(uint64_t generation, Outcome outcome) {
+  {
+    std::lock_guard lock{m_mutex};
+
+    switch (outcome) {
+      case Outcome::SUCCESS:
+        // increase only if limit is actually reached, otherwise it would grow
+        // without bounds while there are fewer requests than allowed
+        if (static_cast<double>(m_in_flight) + 1 >= std::floor(m_limit)) {
+          m_limit = std::min(m_max, m_limit + 1.0 / m_limit);
+        }
+        break;
+
+      case Outcome::THROTTLED:
+        if (generation == m_generation) {
+          // decrease from the number of requests which caused the throttling,
+          // initial limit may be much higher than that
+          m_limit = std::max(
+              m_min, std::min(m_limit, static_cast<double>(m_in_flight)) / 2);
+          ++m_generation;
+
+          log_info("Request was throttled, limiting concurrent requests to %d",
+                   static_cast<int>(m_limit));
+        }
+        break;
+
+      case Outcome::OTHER:
+        break;
+    }
+
+    --m_in_flight;
+  }
+
+  m_cv.notify_all();
+}
+
+}  // namespace rest
+}  // namespace mysqlshdk
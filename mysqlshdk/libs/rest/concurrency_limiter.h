@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#ifndef MYSQLSHDK_LIBS_REST_CONCURRENCY_LIMITER_H_
+#define MYSQLSHDK_LIBS_REST_CONCURRENCY_LIMITER_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace mysqlshdk {
+namespace rest {
+
+/**
+ * Limits the number of concurrent requests using the additive increase,
+ * multiplicative decrease (AIMD) algorithm. Each successful request increases
+ * the limit by roughly one per window of requests, each throttling response
+ * (TOO_MANY_REQUESTS, SERVICE_UNAVAILABLE) halves the number of requests which
+ * can be in flight. Throttling responses to requests which were started
+ * before the last decrease are ignored, so that a burst of such responses
+ * decreases the limit only once.
+ */
+class Concurrency_limiter final {
+ public:
+  enum class Outcome {
+    SUCCESS,
+    THROTTLED,
+    // any other error, does not affect the limit
+    OTHER,
+  };
+
+  /**
+   * A permit to execute a single request, released when destroyed.
+   */
+  class Permit final {
+   public:
+    Permit() = default;
+
+    Permit(const Permit &) = delete;
+    Permit(Permit &&other) noexcept { *this = std::move(other); }
+
+    Permit &operator=(const Permit &) = delete;
+    Permit &operator=(Permit &&other) noexcept;
+
+    ~Permit() { release(Outcome::OTHER); }
+
+    /**
+     * Releases the permit, reporting the outcome of the request.
+     */
+    void release(Outcome outcome);
+
+   private:
+    friend class Concurrency_limiter;
+
+    Permit(Concurrency_limiter *limiter, uint64_t generation)
+        : m_limiter(limiter), m_generation(generation) {}
+
+    Concurrency_limiter *m_limiter = nullptr;
+    uint64_t m_generation = 0;
+  };
+
+  Concurrency_limiter() = delete;
+
+  /**
+   * Creates the limiter.
+   *
+   * @param initial Initial limit.
+   * @param min Limit is never decreased below this value.
+   * @param max Limit is never increased above this value.
+   */
+  Concurrency_limiter(double initial, double min, double max);
+
+  Concurrency_limiter(const Concurrency_limiter &) = delete;
+  Concurrency_limiter(Concurrency_limiter &&) = delete;
+
+  Concurrency_limiter &operator=(const Concurrency_limiter &) = delete;
+  Concurrency_limiter &operator=(Concurrency_limiter &&) = delete;
+
+  ~Concurrency_limiter() = default;
+
+  /**
+   * Limiter shared by all the services which talk to the cloud storage.
+   */
+  static Concurrency_limiter &instance();
+
+  /**
+   * Waits until the number of requests in flight is below the limit.
+   */
+  [[nodiscard]] Permit acquire();
+
+  /**
+   * Current limit.
+   */
+  double limit() const;
+
+  /**
+   * Number of requests in flight.
+   */
+  std::size_t in_flight() const;
+
+ private:
+  void release(uint64_t generation, Outcome outcome);
+
+  const double m_min;
+  const double m_max;
+  double m_limit;
+  std::size_t m_in_flight = 0;
+  // incremented each time the limit is decreased
+  uint64_t m_generation = 0;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+};
+
+}  // namespace rest
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_REST_CONCURRENCY_LIMITER_H_
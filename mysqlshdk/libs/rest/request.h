@@ -39,6 +39,7 @@
 namespace mysqlshdk {
 namespace rest {
 
+class Concurrency_limiter;
 class IRetry_strategy;
 
 enum class Type { GET, HEAD, POST, PUT, PATCH, DELETE };
@@ -100,6 +101,12 @@ struct Request {
    */
   IRetry_strategy *retry_strategy = nullptr;
 
+  /**
+   * If set, each attempt to execute the request waits for a permit from this
+   * limiter, throttling responses decrease the number of permits.
+   */
+  Concurrency_limiter *concurrency_limiter = nullptr;
+
   /**
    * Causes a PUT request to load the data from this file
    */
@@ -33,6 +33,7 @@
 #include <string_view>
 
 #include "mysqlshdk/libs/rest/headers.h"
+#include "mysqlshdk/libs/utils/memory_stats.h"
 
 namespace mysqlshdk {
 namespace rest {
@@ -239,6 +240,7 @@ class String_buffer : public Base_response_buffer {
  public:
   explicit String_buffer(size_t buffer_length = 0) {
     if (buffer_length) m_buffer.reserve(buffer_length);
+    m_memory.resize(m_buffer.capacity());
   };
 
   String_buffer(const String_buffer &other) = default;
@@ -249,6 +251,7 @@ class String_buffer : public Base_response_buffer {
 
   size_t append_data(const char *data, size_t data_size) override {
     m_buffer.append(data, data_size);
+    m_memory.resize(m_buffer.capacity());
     return data_size;
   }
 
@@ -262,6 +265,7 @@ class String_buffer : public Base_response_buffer {
 
  private:
   std::string m_buffer;
+  shcore::Tracked_memory m_memory{shcore::Memory_tag::REST};
 };
 
 /**
@@ -24,13 +24,21 @@
 #include "mysqlshdk/libs/rest/rest_service.h"
 
 #include <curl/curl.h>
+#include <atomic>
+#include <cinttypes>
+#include <functional>
+#include <mutex>
 #include <optional>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/rest/concurrency_limiter.h"
 #include "mysqlshdk/libs/rest/retry_strategy.h"
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/tracing.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -166,6 +174,7 @@ std::string format_exception(const std::exception &e) {
 }
 
 void log_failed_request(const std::string &base_url, const Request &request,
+                        const Headers &headers,
                         const std::string &context = {}) {
   std::string full_context;
 
@@ -176,7 +185,12 @@ void log_failed_request(const std::string &base_url, const Request &request,
   log_warning("Request failed: %s %s %s%s", base_url.c_str(),
               shcore::str_upper(type_name(request.type)).c_str(),
               request.full_path().masked().c_str(), full_context.c_str());
-  log_info("REQUEST HEADERS:\n%s", format_headers(request.headers()).c_str());
+  log_info("REQUEST HEADERS:\n%s", format_headers(headers).c_str());
+}
+
+void log_failed_request(const std::string &base_url, const Request &request,
+                        const std::string &context = {}) {
+  log_failed_request(base_url, request, request.headers(), context);
 }
 
 void log_failed_response(const Response &response) {
@@ -186,6 +200,250 @@ void log_failed_response(const Response &response) {
                                      : "<EMPTY>");
 }
 
+/**
+ * Process-wide pool of the CURL handles.
+ *
+ * All handles share the DNS cache and the TLS sessions. Handles of the
+ * destroyed services are kept (after being reset) together with their live
+ * connections and given to the new services, which allows them to reuse
+ * connections to the same endpoint. Each handle is used by a single thread at
+ * a time, so connections are never shared by the concurrent transfers.
+ */
+class Handle_pool final {
+ public:
+  Handle_pool(const Handle_pool &) = delete;
+  Handle_pool(Handle_pool &&) = delete;
+
+  Handle_pool &operator=(const Handle_pool &) = delete;
+  Handle_pool &operator=(Handle_pool &&) = delete;
+
+  static Handle_pool &instance() {
+    // intentionally leaked, services may be destroyed after static objects
+    static const auto s_pool = new Handle_pool();
+    return *s_pool;
+  }
+
+  static void release_handle(CURL *handle) { instance().release(handle); }
+
+  CURL *acquire() {
+    CURL *handle = nullptr;
+
+    {
+      std::lock_guard lock{m_mutex};
+
+      if (!m_handles.empty()) {
+        handle = m_handles.back();
+        m_handles.pop_back();
+      }
+    }
+
+    if (handle) {
+      ++m_reused_handles;
+    } else {
+      handle = curl_easy_init();
+      ++m_created_handles;
+    }
+
+    curl_easy_setopt(handle, CURLOPT_SHARE, m_share);
+
+    return handle;
+  }
+
+  void release(CURL *handle) {
+    if (!handle) {
+      return;
+    }
+
+    // reset the options, this keeps the live connections
+    curl_easy_reset(handle);
+
+    {
+      std::lock_guard lock{m_mutex};
+
+      if (m_handles.size() < k_max_handles) {
+        m_handles.emplace_back(handle);
+        return;
+      }
+    }
+
+    curl_easy_cleanup(handle);
+  }
+
+  void on_request(bool reused_connection) {
+    ++m_requests;
+
+    if (reused_connection) {
+      ++m_reused_connections;
+    }
+  }
+
+  std::string statistics() const {
+    const auto percent = [](uint64_t value, uint64_t total) {
+      return total ? 100.0 * value / total : 0.0;
+    };
+
+    const uint64_t reused_handles = m_reused_handles;
+    const uint64_t handles = m_created_handles + reused_handles;
+    const uint64_t reused_connections = m_reused_connections;
+    const uint64_t requests = m_requests;
+
+    return shcore::str_format(
+        "connection pool: %" PRIu64 " of %" PRIu64
+        " handles reused (%.1f%%), %" PRIu64 " of %" PRIu64
+        " requests used an existing connection (%.1f%%)",
+        reused_handles, handles, percent(reused_handles, handles),
+        reused_connections, requests, percent(reused_connections, requests));
+  }
+
+ private:
+  static constexpr std::size_t k_max_handles = 32;
+
+  Handle_pool() : m_share(curl_share_init()) {
+    curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, lock_data);
+    curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, unlock_data);
+    curl_share_setopt(m_share, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  }
+
+  static void lock_data(CURL *, curl_lock_data data, curl_lock_access,
+                        void *user) {
+    static_cast<Handle_pool *>(user)->m_data_mutex[data].lock();
+  }
+
+  static void unlock_data(CURL *, curl_lock_data data, void *user) {
+    static_cast<Handle_pool *>(user)->m_data_mutex[data].unlock();
+  }
+
+  CURLSH *m_share;
+  std::mutex m_data_mutex[CURL_LOCK_DATA_LAST];
+
+  std::vector<CURL *> m_handles;
+  std::mutex m_mutex;
+
+  std::atomic<uint64_t> m_created_handles = 0;
+  std::atomic<uint64_t> m_reused_handles = 0;
+  std::atomic<uint64_t> m_requests = 0;
+  std::atomic<uint64_t> m_reused_connections = 0;
+};
+
+/**
+ * Process-wide event loop which executes the asynchronous requests.
+ *
+ * The loop thread is started when the first request is submitted and finishes
+ * once there are no more requests to execute.
+ */
+class Event_loop final {
+ public:
+  using Callback = std::function<void(CURLcode)>;
+
+  Event_loop(const Event_loop &) = delete;
+  Event_loop(Event_loop &&) = delete;
+
+  Event_loop &operator=(const Event_loop &) = delete;
+  Event_loop &operator=(Event_loop &&) = delete;
+
+  static Event_loop &instance() {
+    // intentionally leaked, the loop thread may still be running at exit
+    static const auto s_loop = new Event_loop();
+    return *s_loop;
+  }
+
+  /**
+   * Executes the request which was prepared using the given handle. Callback
+   * is called by the loop thread once the transfer is finished, handle is no
+   * longer used by the loop at that point.
+   */
+  void submit(CURL *handle, Callback callback) {
+    std::lock_guard lock{m_mutex};
+
+    m_queue.emplace_back(handle, std::move(callback));
+
+    if (m_running) {
+#if LIBCURL_VERSION_NUM >= 0x074400
+      // curl_multi_wakeup() was added in libcurl 7.68.0
+      curl_multi_wakeup(m_multi);
+#endif
+    } else {
+      if (m_thread.joinable()) {
+        // loop has finished, but the thread was not joined yet
+        m_thread.join();
+      }
+
+      m_running = true;
+      m_thread = mysqlsh::spawn_scoped_thread([this]() { run(); });
+    }
+  }
+
+ private:
+  Event_loop() : m_multi(curl_multi_init()) {}
+
+  void run() {
+    while (true) {
+      {
+        std::lock_guard lock{m_mutex};
+
+        for (auto &transfer : m_queue) {
+          curl_multi_add_handle(m_multi, transfer.first);
+          m_active.emplace(transfer.first, std::move(transfer.second));
+        }
+
+        m_queue.clear();
+
+        if (m_active.empty()) {
+          m_running = false;
+          return;
+        }
+      }
+
+      int running = 0;
+      curl_multi_perform(m_multi, &running);
+
+      int left = 0;
+
+      while (const auto msg = curl_multi_info_read(m_multi, &left)) {
+        if (CURLMSG_DONE != msg->msg) {
+          continue;
+        }
+
+        // message is not valid once handle is removed
+        const auto handle = msg->easy_handle;
+        const auto result = msg->data.result;
+
+        curl_multi_remove_handle(m_multi, handle);
+
+        const auto it = m_active.find(handle);
+        const auto callback = std::move(it->second);
+        m_active.erase(it);
+
+        callback(result);
+      }
+
+      if (!m_active.empty()) {
+#if LIBCURL_VERSION_NUM >= 0x074400
+        // curl_multi_poll() was added in libcurl 7.66.0, use it only if
+        // submit() is able to wake it up
+        curl_multi_poll(m_multi, nullptr, 0, 1000, nullptr);
+#else
+        curl_multi_wait(m_multi, nullptr, 0, 100, nullptr);
+#endif
+      }
+    }
+  }
+
+  CURLM *m_multi;
+
+  std::mutex m_mutex;
+  // requests which were submitted, guarded by m_mutex
+  std::vector<std::pair<CURL *, Callback>> m_queue;
+  // guarded by m_mutex
+  bool m_running = false;
+  std::thread m_thread;
+
+  // requests being executed, used only by the loop thread
+  std::unordered_map<CURL *, Callback> m_active;
+};
+
 }  // namespace
 
 std::string type_name(Type method) {
@@ -212,7 +470,8 @@ class Rest_service::Impl {
    * Type of the HTTP request.
    */
   Impl(const Masked_string &base_url, bool verify, const std::string &label)
-      : m_handle(curl_easy_init(), &curl_easy_cleanup),
+      : m_handle(Handle_pool::instance().acquire(),
+                 &Handle_pool::release_handle),
         m_base_url{base_url},
         m_request_sequence(0) {
     // Disable signal handlers used by libcurl, we're potentially going to use
@@ -270,7 +529,13 @@ class Rest_service::Impl {
         5, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz1234567890");
   }
 
-  ~Impl() = default;
+  ~Impl() {
+    if (m_request_sequence > 0) {
+      log_debug("%s: %d requests, %d used an existing connection; %s",
+                m_id.c_str(), m_request_sequence, m_reused_connections,
+                Handle_pool::instance().statistics().c_str());
+    }
+  }
 
   void log_request(const Request &request) {
     if (shcore::current_logger()->get_log_level() >=
@@ -303,8 +568,39 @@ class Rest_service::Impl {
     }
   }
 
+  /**
+   * Data which needs to be alive while request is being executed.
+   */
+  struct Transfer_data {
+    std::string header_data;
+    std::unique_ptr<curl_slist, void (*)(curl_slist *)> headers{
+        nullptr, &curl_slist_free_all};
+  };
+
   Response::Status_code execute(bool synch, Request *request,
                                 Response *response = nullptr) {
+    mysqlshdk::tracing::Span span;
+
+    if (mysqlshdk::tracing::enabled()) {
+      span.begin("rest", shcore::str_upper(type_name(request->type)));
+      span.add_arg("path", request->full_path().masked());
+    }
+
+    Transfer_data data;
+
+    prepare(synch, request, response, &data);
+
+    // execute the request
+    const auto code =
+        complete(curl_easy_perform(m_handle.get()), response, data);
+
+    span.add_arg("status", static_cast<uint64_t>(code));
+
+    return code;
+  }
+
+  void prepare(bool synch, Request *request, Response *response,
+               Transfer_data *data) {
     assert(request);
 
     m_request_sequence++;
@@ -320,35 +616,55 @@ class Rest_service::Impl {
 
     set_type(request);
 
-    const auto headers_deleter =
-        set_headers(request->headers(), request->size != 0);
+    data->headers = set_headers(request->headers(), request->size != 0);
 
     // set callbacks which will receive the response
-    std::string header_data;
-    curl_easy_setopt(m_handle.get(), CURLOPT_HEADERDATA, &header_data);
+    curl_easy_setopt(m_handle.get(), CURLOPT_HEADERDATA, &data->header_data);
     curl_easy_setopt(m_handle.get(), CURLOPT_WRITEDATA,
                      response ? response->body : nullptr);
+  }
 
-    // execute the request
-    auto ret_val = curl_easy_perform(m_handle.get());
+  Response::Status_code complete(CURLcode ret_val, Response *response,
+                                 const Transfer_data &data) {
     if (ret_val != CURLE_OK) {
       log_error("%s-%d: %s (CURLcode = %i)", m_id.c_str(), m_request_sequence,
                 m_error_buffer, ret_val);
       throw Connection_error{m_error_buffer, ret_val};
     }
 
+    {
+      // number of new connections which were needed to perform the request
+      long connects = 0;
+      curl_easy_getinfo(m_handle.get(), CURLINFO_NUM_CONNECTS, &connects);
+
+      if (0 == connects) {
+        ++m_reused_connections;
+      }
+
+      Handle_pool::instance().on_request(0 == connects);
+    }
+
     const auto status = get_status_code();
 
-    log_response(m_request_sequence, status, header_data);
+    log_response(m_request_sequence, status, data.header_data);
 
     if (response) {
       response->status = status;
-      response->headers = parse_headers(header_data);
+      response->headers = parse_headers(data.header_data);
     }
 
     return status;
   }
 
+  /**
+   * Creates a copy of this service, with its own CURL handle.
+   */
+  std::unique_ptr<Impl> clone() const {
+    return std::unique_ptr<Impl>(new Impl(*this));
+  }
+
+  CURL *handle() const { return m_handle.get(); }
+
   void set_body(const char *body, size_t size, bool synch) {
     curl_easy_setopt(m_handle.get(), CURLOPT_POSTFIELDSIZE, size);
     if (synch) {
@@ -386,10 +702,27 @@ class Rest_service::Impl {
   const Masked_string &base_url() const { return m_base_url; }
 
   void reset_connection() {
-    m_handle.reset(curl_easy_duphandle(m_handle.get()));
+    // the old handle is not returned to the pool, it may hold a broken
+    // connection
+    const auto handle = curl_easy_duphandle(m_handle.get());
+    curl_easy_cleanup(m_handle.release());
+    m_handle.reset(handle);
   }
 
  private:
+  Impl(const Impl &other)
+      : m_handle(curl_easy_duphandle(other.m_handle.get()),
+                 &Handle_pool::release_handle),
+        m_base_url(other.m_base_url),
+        m_port(other.m_port),
+        m_default_headers(other.m_default_headers),
+        m_id(other.m_id + "-ASYNC"),
+        m_request_sequence(other.m_request_sequence),
+        m_default_timeout(other.m_default_timeout) {
+    // error buffer is not copied
+    curl_easy_setopt(m_handle.get(), CURLOPT_ERRORBUFFER, m_error_buffer);
+  }
+
   void verify_ssl(bool verify) {
     curl_easy_setopt(m_handle.get(), CURLOPT_SSL_VERIFYHOST, verify ? 2L : 0L);
     curl_easy_setopt(m_handle.get(), CURLOPT_SSL_VERIFYPEER, verify ? 1L : 0L);
@@ -512,6 +845,8 @@ class Rest_service::Impl {
 
   int m_request_sequence;
 
+  int m_reused_connections = 0;
+
   long m_default_timeout;
 };
 
@@ -575,6 +910,50 @@ String_response Rest_service::delete_(Request *request) {
   return execute_internal(request);
 }
 
+std::future<Response::Status_code> Rest_service::execute_async(
+    Request *request, Response *response) {
+  struct Transfer {
+    std::unique_ptr<Impl> impl;
+    Impl::Transfer_data data;
+    // headers are obtained here, request may not be thread-safe
+    Headers headers;
+    std::promise<Response::Status_code> promise;
+  };
+
+  // each asynchronous request needs its own handle
+  auto transfer = std::make_shared<Transfer>();
+  transfer->impl = m_impl->clone();
+  transfer->impl->prepare(false, request, response, &transfer->data);
+  transfer->headers = request->headers();
+
+  auto result = transfer->promise.get_future();
+
+  Event_loop::instance().submit(
+      transfer->impl->handle(), [transfer, request, response](CURLcode code) {
+        const auto &base_url = transfer->impl->base_url().masked();
+
+        try {
+          const auto status =
+              transfer->impl->complete(code, response, transfer->data);
+
+          if (Response::is_error(status)) {
+            // response was an error, log it as well
+            log_failed_request(base_url, *request, transfer->headers,
+                               format_code(status));
+            if (response) log_failed_response(*response);
+          }
+
+          transfer->promise.set_value(status);
+        } catch (const std::exception &error) {
+          log_failed_request(base_url, *request, transfer->headers,
+                             format_exception(error));
+          transfer->promise.set_exception(std::current_exception());
+        }
+      });
+
+  return result;
+}
+
 String_response Rest_service::execute_internal(Request *request) {
   String_response response;
 
@@ -603,7 +982,22 @@ Response::Status_code Rest_service::execute(Request *request,
 
   while (true) {
     try {
+      Concurrency_limiter::Permit permit;
+
+      if (request->concurrency_limiter) {
+        permit = request->concurrency_limiter->acquire();
+      }
+
       const auto code = m_impl->execute(true, request, response);
+
+      permit.release(
+          Response::Status_code::TOO_MANY_REQUESTS == code ||
+                  Response::Status_code::SERVICE_UNAVAILABLE == code
+              ? Concurrency_limiter::Outcome::THROTTLED
+              : (Response::is_error(code)
+                     ? Concurrency_limiter::Outcome::OTHER
+                     : Concurrency_limiter::Outcome::SUCCESS));
+
       std::optional<Response_error> error;
 
       if (response) {
@@ -186,6 +186,23 @@ class Rest_service {
    */
   Response::Status_code execute(Request *request, Response *response = nullptr);
 
+  /**
+   * Executes a request asynchronously. All asynchronous requests are executed
+   * concurrently by a single, process-wide event loop thread.
+   *
+   * Retry strategy of the request is not used, the first failure is reported.
+   *
+   * @param request Request to be sent, needs to be valid until the result is
+   *        available.
+   * @param response Response received, needs to be valid until the result is
+   *        available.
+   *
+   * @returns The code of the request response. Holds Connection_error in case
+   *          of any connection-related problems.
+   */
+  std::future<Response::Status_code> execute_async(
+      Request *request, Response *response = nullptr);
+
  private:
   String_response execute_internal(Request *request);
 
@@ -23,10 +23,12 @@
 
 #include "mysqlshdk/libs/rest/signed_rest_service.h"
 
+#include <cassert>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "mysqlshdk/libs/rest/concurrency_limiter.h"
 #include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -118,6 +120,17 @@ Response::Status_code Signed_rest_service::delete_(Signed_request *request) {
   return execute(request);
 }
 
+std::future<Response::Status_code> Signed_rest_service::execute_async(
+    Signed_request *request, Response *response) {
+  assert(response && response->body);
+
+  // request is signed by the calling thread
+  request->m_service = this;
+
+  return get_rest_service(m_endpoint, m_label)
+      ->execute_async(request, response);
+}
+
 void Signed_rest_service::clear_cache(time_t now) {
   if (0 == m_cache_cleared_at) {
     m_cache_cleared_at = now;
@@ -232,6 +245,12 @@ Response::Status_code Signed_rest_service::execute(Signed_request *request,
     request->retry_strategy = m_default_retry_strategy.get();
   }
 
+  if (!request->concurrency_limiter) {
+    // all the services share the same limiter, so that all threads back off
+    // when the storage starts throttling the requests
+    request->concurrency_limiter = &Concurrency_limiter::instance();
+  }
+
   request->m_service = this;
 
   rest::Response::Status_code code;
@@ -24,6 +24,7 @@
 #ifndef MYSQLSHDK_LIBS_REST_SIGNED_REST_SERVICE_H_
 #define MYSQLSHDK_LIBS_REST_SIGNED_REST_SERVICE_H_
 
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -138,6 +139,15 @@ class Signed_rest_service {
 
   Response::Status_code delete_(Signed_request *request);
 
+  /**
+   * Signs the request and executes it asynchronously, type of the request
+   * needs to be set. Authorization data is not refreshed, retry strategy is
+   * not used, both the request and the response need to be valid until the
+   * result is available.
+   */
+  std::future<Response::Status_code> execute_async(Signed_request *request,
+                                                   Response *response);
+
  private:
   friend struct Signed_request;
 
@@ -80,6 +80,14 @@ void Ssh_connection_options::set_default_data() {
     }
   }
 
+  if (const auto options = mysqlsh::current_shell_options(true)) {
+    if (options->get().ssh.buffer_size > 0) {
+      set_buffer_size(options->get().ssh.buffer_size);
+    }
+
+    set_tunnel_sessions(options->get().ssh.tunnel_sessions);
+  }
+
   preload_ssh_config();
 
   if (!has_user()) set_user(shcore::get_system_user());
@@ -142,6 +150,7 @@ void Ssh_connection_options::dump_config() const {
   log_debug2("SSH: Connection config info:");
   log_debug2("SSH: connectTimeout: %zu", m_connection_timeout);
   log_debug2("SSH: bufferSize: %zu", m_buffer_size);
+  log_debug2("SSH: tunnelSessions: %zu", m_tunnel_sessions);
   if (has_config_file())
     log_debug2("SSH: config file: %s", get_config_file().c_str());
   log_debug2("SSH: local host: %s", m_sourcehost.c_str());
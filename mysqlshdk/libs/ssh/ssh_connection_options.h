@@ -82,6 +82,10 @@ class Ssh_connection_options : public mysqlshdk::IConnection {
 
   void set_buffer_size(std::size_t buffer_size) { m_buffer_size = buffer_size; }
 
+  void set_tunnel_sessions(std::size_t sessions) {
+    m_tunnel_sessions = sessions;
+  }
+
   void set_fingerprint(const std::string &fingerprint) {
     m_fingerprint = fingerprint;
   }
@@ -156,6 +160,12 @@ class Ssh_connection_options : public mysqlshdk::IConnection {
 
   const std::size_t &get_buffer_size() const { return m_buffer_size; }
 
+  /**
+   * Number of SSH sessions opened for a tunnel, connections which use the
+   * tunnel are distributed between them.
+   */
+  std::size_t get_tunnel_sessions() const { return m_tunnel_sessions; }
+
   const std::string &get_fingerprint() const { return m_fingerprint; }
 
   std::string get_server() const {
@@ -206,8 +216,9 @@ class Ssh_connection_options : public mysqlshdk::IConnection {
   std::string m_fingerprint;
   std::string m_key_password;
 
-  // Not really an SSH option, used to pass the configured shell option
+  // Not really SSH options, used to pass the configured shell options
   std::size_t m_buffer_size = 10240;
+  std::size_t m_tunnel_sessions = 1;
 };
 }  // namespace ssh
 }  // namespace mysqlshdk
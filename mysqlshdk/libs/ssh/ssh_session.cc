@@ -172,7 +172,7 @@ Ssh_session::Ssh_session()
 Ssh_session::~Ssh_session() {}
 
 std::tuple<Ssh_return_type, std::string> Ssh_session::connect(
-    const Ssh_connection_options &config) {
+    const Ssh_connection_options &config, bool interactive) {
   if (is_connected()) {
     throw std::logic_error(
         "Unable to connect already connected SSHSession, please disconnect "
@@ -181,7 +181,7 @@ std::tuple<Ssh_return_type, std::string> Ssh_session::connect(
 
   // auto lock = lock_session();
   m_options = config;
-  m_interactive = m_options.interactive();
+  m_interactive = interactive && m_options.interactive();
   // We need to set the host before reading the config, otherwise we will get
   // error. This will be of course overridden by optionsParseconfig
   try {
@@ -568,6 +568,12 @@ void Ssh_session::authenticate_user(const ssh::Ssh_connection_options &config) {
       throw std::runtime_error(
           "Unable to authenticate, all known authentication methods failed.");
   }
+
+  // keep the credentials which were used, so that additional sessions of the
+  // same tunnel can authenticate without prompting the user again
+  if (ret_val == Ssh_auth_return::AUTH_SUCCESS) {
+    m_options = std::move(config_copy);
+  }
 }
 
 namespace {
@@ -63,11 +63,13 @@ Ssh_tunnel_handler::Ssh_tunnel_handler(uint16_t local_port, int local_socket,
                                        std::unique_ptr<Ssh_session> session)
     : m_session(std::move(session)),
       m_local_port(local_port),
-      m_local_socket(local_socket) {
+      m_local_socket(local_socket),
+      m_buffer(m_session->config().get_buffer_size(), '\0') {
   make_event();
 }
 
 Ssh_tunnel_handler::~Ssh_tunnel_handler() {
+  m_sessions.clear();
   stop();
   if (m_session) {
     cleanup_event();
@@ -128,7 +130,7 @@ void Ssh_tunnel_handler::handle_connection() {
             "retrying");
 
       for (auto &s_it : m_client_socket_list) {
-        cleanup_socket(m_event, s_it.first, std::move(s_it.second));
+        close_connection(s_it.first, std::move(s_it.second));
       }
       m_client_socket_list.clear();
 
@@ -151,7 +153,7 @@ void Ssh_tunnel_handler::handle_connection() {
         transfer_data_to_client(it->first, it->second.get());
         ++it;
       } catch (const Ssh_tunnel_exception &exc) {
-        cleanup_socket(m_event, it->first, std::move(it->second));
+        close_connection(it->first, std::move(it->second));
         it = m_client_socket_list.erase(it);
         log_error("SSH: tunnel handler: Error during data transfer: %s",
                   exc.what());
@@ -160,7 +162,7 @@ void Ssh_tunnel_handler::handle_connection() {
   } while (!m_stop);
 
   for (auto &s_it : m_client_socket_list) {
-    cleanup_socket(m_event, s_it.first, std::move(s_it.second));
+    close_connection(s_it.first, std::move(s_it.second));
   }
   m_client_socket_list.clear();
   log_debug3("SSH: tunnel handler: Tunnel handler thread stopped.");
@@ -191,16 +193,79 @@ bool Ssh_tunnel_handler::handle_new_connection(int incoming_socket) {
     log_error("SSH: tunnel handler: Failed to set SO_NOSIGPIPE on socket");
 #endif
 
-  std::lock_guard<std::recursive_mutex> guard(m_new_connection_mtx);
-  m_new_connection.push(client_sock);
+  select_session()->queue_connection(client_sock);
   log_debug3("SSH: tunnel handler: Accepted new connection.");
   return true;
 }
 
+void Ssh_tunnel_handler::open_sessions(std::size_t count) {
+  for (auto i = m_sessions.size() + 1; i < count; ++i) {
+    auto session = std::make_unique<Ssh_session>();
+    std::string error;
+
+    try {
+      // credentials were already provided when the first session was opened
+      const auto result = session->connect(m_session->config(), false);
+
+      if (Ssh_return_type::CONNECTED != std::get<0>(result)) {
+        error = std::get<1>(result);
+      }
+    } catch (const std::exception &e) {
+      error = e.what();
+    }
+
+    if (!error.empty()) {
+      log_warning(
+          "SSH: tunnel handler: Unable to open additional session, tunnel is "
+          "going to use %zu session(s): %s",
+          i, error.c_str());
+      break;
+    }
+
+    session->update_local_port(m_local_port);
+
+    auto handler = std::make_unique<Ssh_tunnel_handler>(
+        m_local_port, m_local_socket, std::move(session));
+    handler->start();
+    m_sessions.emplace_back(std::move(handler));
+  }
+
+  if (!m_sessions.empty()) {
+    log_debug("SSH: tunnel handler: Tunnel is using %zu sessions.",
+              m_sessions.size() + 1);
+  }
+}
+
+Ssh_tunnel_handler *Ssh_tunnel_handler::select_session() {
+  auto selected = this;
+
+  for (const auto &session : m_sessions) {
+    if (session->is_running() &&
+        session->m_connections < selected->m_connections) {
+      selected = session.get();
+    }
+  }
+
+  return selected;
+}
+
+void Ssh_tunnel_handler::queue_connection(int client_socket) {
+  ++m_connections;
+
+  std::lock_guard<std::recursive_mutex> guard(m_new_connection_mtx);
+  m_new_connection.push(client_socket);
+}
+
+void Ssh_tunnel_handler::close_connection(
+    int sock, std::unique_ptr<::ssh::Channel> chan) {
+  cleanup_socket(m_event, sock, std::move(chan));
+  --m_connections;
+}
+
 void Ssh_tunnel_handler::transfer_data_from_client(int sock,
                                                    ::ssh::Channel *chan) {
   ssize_t readlen = 0;
-  std::vector<char> buff(m_session->config().get_buffer_size(), '\0');
+  auto &buff = m_buffer;
 
   while (!m_stop && (readlen = recv(sock, buff.data(), buff.size(), 0)) > 0) {
     int b_written = 0;
@@ -240,7 +305,7 @@ std::string err_code_to_string(int err) {
 void Ssh_tunnel_handler::transfer_data_to_client(int sock,
                                                  ::ssh::Channel *chan) {
   ssize_t readlen = 0;
-  std::vector<char> buff(m_session->config().get_buffer_size(), '\0');
+  auto &buff = m_buffer;
   do {
     try {
       readlen = chan->readNonblocking(buff.data(), buff.size());
@@ -325,6 +390,7 @@ void Ssh_tunnel_handler::prepare_tunnel(int client_socket) {
           "event handler.");
       channel.reset();
       ssh_close_socket(client_socket);
+      --m_connections;
     } else {
       log_debug("SSH: tunnel handler: Tunnel created.");
       m_client_socket_list.insert(
@@ -332,12 +398,14 @@ void Ssh_tunnel_handler::prepare_tunnel(int client_socket) {
     }
   } catch (const ssh::Ssh_tunnel_exception &exc) {
     ssh_close_socket(client_socket);
+    --m_connections;
     log_error(
         "SSH: tunnel handler: Unable to open tunnel. Exception when opening "
         "tunnel: %s",
         exc.what());
   } catch (::ssh::SshException &exc) {
     ssh_close_socket(client_socket);
+    --m_connections;
     log_error(
         "SSH: tunnel handler: Unable to open tunnel. Exception when opening "
         "tunnel: %s",
@@ -35,6 +35,7 @@
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 #include "mysqlshdk/libs/ssh/ssh_common.h"
 #include "mysqlshdk/libs/ssh/ssh_session.h"
 
@@ -63,6 +64,17 @@ class Ssh_tunnel_handler : public Ssh_thread {
    */
   bool handle_new_connection(int incoming_socket);
 
+  /**
+   * @brief opens additional SSH sessions, using the configuration of the
+   * already connected one, each served by a separate thread. New connections
+   * are assigned to the session which handles the least number of connections.
+   * If a session cannot be opened, tunnel uses the sessions which were opened
+   * so far.
+   *
+   * @param count total number of sessions to be used by this tunnel
+   */
+  void open_sessions(std::size_t count);
+
   void use() { ++m_usage; }
   int release() {
     assert(m_usage > 0);
@@ -89,10 +101,18 @@ class Ssh_tunnel_handler : public Ssh_thread {
   void prepare_tunnel(int client_socket);
   void make_event();
   void cleanup_event();
+  Ssh_tunnel_handler *select_session();
+  void queue_connection(int client_socket);
+  void close_connection(int sock, std::unique_ptr<::ssh::Channel> chan);
 
   std::recursive_mutex m_new_connection_mtx;
   std::queue<int> m_new_connection;
   std::atomic_int m_usage = 0;
+  // connections which are either queued or forwarded by this session
+  std::atomic<std::size_t> m_connections = 0;
+  std::vector<char> m_buffer;
+  // additional sessions of this tunnel
+  std::vector<std::unique_ptr<Ssh_tunnel_handler>> m_sessions;
 };
 
 }  // namespace ssh
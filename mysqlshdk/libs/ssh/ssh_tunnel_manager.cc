@@ -141,6 +141,7 @@ std::tuple<Ssh_return_type, uint16_t> Ssh_tunnel_manager::create_tunnel(
   auto handler = std::make_unique<Ssh_tunnel_handler>(
       ret.port, ret.socket_handle, std::move(session));
   handler->start();
+  handler->open_sessions(handler->config().get_tunnel_sessions());
   {
     const auto lock = lock_socket_list();
     m_socket_list.insert(std::make_pair(ret.socket_handle, std::move(handler)));
@@ -36,11 +36,14 @@
 #endif
 
 #include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <utility>
 
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/utils.h"
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/tracing.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
@@ -53,6 +56,10 @@ namespace backend {
 // initial size of an mmapped file opened for writing
 constexpr const size_t k_initial_mmapped_file_size = 1024 * 1024;
 
+// if page cache is not used, it's released every time this many bytes is read
+// or written
+constexpr const size_t k_page_cache_window = 8 * 1024 * 1024;
+
 Mmap_preference to_mmap_preference(const std::string &s) {
   auto ls = shcore::str_lower(s);
   if (ls.empty() || ls == "off") return Mmap_preference::OFF;
@@ -62,8 +69,16 @@ Mmap_preference to_mmap_preference(const std::string &s) {
                          "', must be one of off, on or required");
 }
 
+Page_cache_preference to_page_cache_preference(const std::string &s) {
+  auto ls = shcore::str_lower(s);
+  if (ls.empty() || ls == "keep") return Page_cache_preference::KEEP;
+  if (ls == "drop") return Page_cache_preference::DROP;
+  throw std::logic_error("Invalid value '" + s +
+                         "', must be one of keep or drop");
+}
+
 File::File(const std::string &filename, const File::Options &options)
-    : m_use_mmap(options.mmap) {
+    : m_use_mmap(options.mmap), m_page_cache(options.page_cache) {
   // no mmap in < 64bits archs
   if (sizeof(void *) < 8) m_use_mmap = Mmap_preference::OFF;
 
@@ -83,6 +98,9 @@ File::~File() {
 
 void File::open(Mode m) {
   assert(!is_open());
+
+  mysqlshdk::tracing::Span span{"storage", "file.open"};
+  span.add_arg("path", m_filepath);
 #ifdef _WIN32
   const auto wpath = shcore::utf8_to_wide(m_filepath);
 #endif
@@ -135,6 +153,8 @@ void File::open(Mode m) {
                                "': " + shcore::errno_to_string(errno));
     }
   }
+
+  init_page_cache(m);
 }
 
 bool File::is_open() const { return m_file != nullptr; }
@@ -180,6 +200,7 @@ void File::do_close() {
 #endif
 
   if (m_file != nullptr) {
+    release_page_cache();
     fclose(m_file);
     m_file = nullptr;
   }
@@ -225,15 +246,69 @@ ssize_t File::read(void *buffer, size_t length) {
   if (m_mmap_ptr)
     throw std::logic_error("operation not allowed on a mmapped file");
 
-  return fread(buffer, 1, length, m_file);
+  mysqlshdk::tracing::Span span{"storage", "file.read"};
+  span.add_arg("bytes", static_cast<uint64_t>(length));
+
+  const auto bytes = fread(buffer, 1, length, m_file);
+  did_read(bytes);
+
+  return bytes;
 }
 
+#ifndef _WIN32
+ssize_t File::pread(void *buffer, size_t length, off64_t offset) {
+  assert(is_open());
+  if (m_writing) throw std::logic_error("file must be open for reading");
+
+  if (offset < 0) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  if (m_mmap_ptr) {
+    if (static_cast<size_t>(offset) >= m_mmap_available) return 0;
+
+    length = std::min(length, m_mmap_available - static_cast<size_t>(offset));
+    ::memcpy(buffer, m_mmap_ptr + offset, length);
+
+    return length;
+  }
+
+  const auto fd = fileno(m_file);
+  auto data = static_cast<char *>(buffer);
+  size_t total = 0;
+
+  // pread() may return less data than requested, even if file is not finished
+  while (total < length) {
+    const auto bytes =
+        ::pread(fd, data + total, length - total, offset + total);
+
+    if (bytes < 0) {
+      if (EINTR == errno) continue;
+      return -1;
+    }
+
+    if (0 == bytes) break;
+
+    total += bytes;
+  }
+
+  return total;
+}
+#endif
+
 ssize_t File::write(const void *buffer, size_t length) {
   assert(is_open());
   if (m_mmap_ptr)
     throw std::logic_error("operation not allowed on a mmapped file");
 
-  return fwrite(buffer, 1, length, m_file);
+  mysqlshdk::tracing::Span span{"storage", "file.write"};
+  span.add_arg("bytes", static_cast<uint64_t>(length));
+
+  const auto bytes = fwrite(buffer, 1, length, m_file);
+  did_write(bytes);
+
+  return bytes;
 }
 
 bool File::flush() {
@@ -412,6 +487,12 @@ const char *File::mmap_will_read(size_t *out_avail) {
       if (out_avail) *out_avail = 0;
       return nullptr;
     }
+
+    // mapped files are read sequentially, let the kernel read ahead
+    if (::madvise(m_mmap_ptr, m_mmap_available, MADV_SEQUENTIAL) < 0) {
+      log_debug("%s: madvise() failed: %s", m_filepath.c_str(),
+                shcore::errno_to_string(errno).c_str());
+    }
   }
 
   assert(m_mmap_offset <= m_mmap_available);
@@ -440,6 +521,117 @@ const char *File::mmap_did_read(size_t length, size_t *out_avail) {
   return m_mmap_ptr + m_mmap_offset;
 }
 
+void File::init_page_cache(Mode m) {
+  m_page_cache_pending = 0;
+  m_page_cache_released = 0;
+  m_page_cache_written = 0;
+
+  if (Page_cache_preference::DROP != m_page_cache) return;
+
+#if defined(__linux__)
+  const auto fd = fileno(m_file);
+
+  if (Mode::APPEND == m) {
+    // existing data is not touched
+    m_page_cache_released = m_page_cache_written = ::lseek(fd, 0, SEEK_END);
+  }
+
+  if (Mode::READ == m && ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL)) {
+    log_debug("%s: posix_fadvise() failed", m_filepath.c_str());
+  }
+#elif defined(__APPLE__)
+  // there's no posix_fadvise() on macOS, disable caching altogether
+  if (::fcntl(fileno(m_file), F_NOCACHE, 1) < 0) {
+    log_debug("%s: fcntl(F_NOCACHE) failed: %s", m_filepath.c_str(),
+              shcore::errno_to_string(errno).c_str());
+  }
+#else
+  (void)m;
+#endif
+}
+
+void File::did_read(size_t length) {
+#if defined(__linux__)
+  if (!drop_page_cache()) return;
+
+  m_page_cache_pending += length;
+
+  if (m_page_cache_pending < k_page_cache_window) return;
+
+  const auto offset = ftello(m_file);
+
+  if (offset > m_page_cache_released) {
+    ::posix_fadvise(fileno(m_file), m_page_cache_released,
+                    offset - m_page_cache_released, POSIX_FADV_DONTNEED);
+  }
+
+  m_page_cache_released = offset;
+  m_page_cache_pending = 0;
+#else
+  (void)length;
+#endif
+}
+
+void File::did_write(size_t length) {
+#if defined(__linux__)
+  if (!drop_page_cache()) return;
+
+  m_page_cache_pending += length;
+
+  if (m_page_cache_pending < k_page_cache_window) return;
+
+  // write-behind: start the write-back of the data which was just written,
+  // wait for the previous window to reach the disk and evict it from the page
+  // cache, this way page cache holds at most two windows of this file
+  const auto fd = fileno(m_file);
+
+  if (0 != fflush(m_file)) return;
+
+  const auto offset = ftello(m_file);
+
+  if (offset > m_page_cache_written) {
+    ::sync_file_range(fd, m_page_cache_written, offset - m_page_cache_written,
+                      SYNC_FILE_RANGE_WRITE);
+  }
+
+  if (m_page_cache_written > m_page_cache_released) {
+    const auto window = m_page_cache_written - m_page_cache_released;
+
+    ::sync_file_range(fd, m_page_cache_released, window,
+                      SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE |
+                          SYNC_FILE_RANGE_WAIT_AFTER);
+    ::posix_fadvise(fd, m_page_cache_released, window, POSIX_FADV_DONTNEED);
+  }
+
+  m_page_cache_released = m_page_cache_written;
+  m_page_cache_written = offset;
+  m_page_cache_pending = 0;
+#else
+  (void)length;
+#endif
+}
+
+void File::release_page_cache() {
+#if defined(__linux__)
+  if (!drop_page_cache()) return;
+
+  const auto fd = fileno(m_file);
+
+  if (m_writing) {
+    // dirty pages are not evicted, wait until they're written
+    if (0 != fflush(m_file) ||
+        ::sync_file_range(fd, m_page_cache_released, 0,
+                          SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE |
+                              SYNC_FILE_RANGE_WAIT_AFTER) < 0) {
+      log_debug("%s: failed to write back the data: %s", m_filepath.c_str(),
+                shcore::errno_to_string(errno).c_str());
+    }
+  }
+
+  ::posix_fadvise(fd, m_page_cache_released, 0, POSIX_FADV_DONTNEED);
+#endif
+}
+
 }  // namespace backend
 }  // namespace storage
 }  // namespace mysqlshdk
@@ -41,12 +41,22 @@ enum class Mmap_preference {
 
 Mmap_preference to_mmap_preference(const std::string &s);
 
+enum class Page_cache_preference {
+  KEEP,  // data is cached by the OS
+  DROP   // OS is advised to evict data from the page cache once it's written
+         // to the disk or read
+};
+
+Page_cache_preference to_page_cache_preference(const std::string &s);
+
 class File : public IFile {
  public:
   struct Options {
     Mmap_preference mmap;
+    Page_cache_preference page_cache;
 
-    Options() : mmap(Mmap_preference::OFF) {}
+    Options()
+        : mmap(Mmap_preference::OFF), page_cache(Page_cache_preference::KEEP) {}
   };
 
   File() = delete;
@@ -77,6 +87,12 @@ class File : public IFile {
   ssize_t write(const void *buffer, size_t length) override;
   bool flush() override;
 
+#ifndef _WIN32
+  ssize_t pread(void *buffer, size_t length, off64_t offset) override;
+
+  bool supports_pread() const override { return true; }
+#endif
+
   void rename(const std::string &new_name) override;
   void remove() override;
 
@@ -140,6 +156,18 @@ class File : public IFile {
   bool init_mmap_read();
 #endif
 
+  bool drop_page_cache() const {
+    return Page_cache_preference::DROP == m_page_cache && !m_mmap_ptr;
+  }
+
+  void init_page_cache(Mode m);
+
+  void did_read(size_t length);
+
+  void did_write(size_t length);
+
+  void release_page_cache();
+
   FILE *m_file = nullptr;
 
   std::string m_filepath;
@@ -147,6 +175,14 @@ class File : public IFile {
   Mmap_preference m_use_mmap = Mmap_preference::OFF;
   bool m_writing = false;
 
+  Page_cache_preference m_page_cache = Page_cache_preference::KEEP;
+  // number of bytes read/written since the page cache was last released
+  size_t m_page_cache_pending = 0;
+  // data before this offset was evicted from the page cache
+  off64_t m_page_cache_released = 0;
+  // write-back of data before this offset was started
+  off64_t m_page_cache_written = 0;
+
   char *m_mmap_ptr = nullptr;
   size_t m_mmap_offset = 0;
   size_t m_mmap_used = 0;
@@ -24,6 +24,7 @@
 #include "mysqlshdk/libs/storage/backend/http.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "mysqlshdk/libs/db/uri_encoder.h"
 #include "mysqlshdk/libs/rest/error_codes.h"
@@ -160,6 +161,7 @@ void Http_object::open(Mode m) {
 
   m_offset = 0;
   m_open_mode = m;
+  reset_read_ahead();
 }
 
 bool Http_object::is_open() const { return m_open_mode.has_value(); }
@@ -226,6 +228,7 @@ void Http_object::close() {
 
   m_open_mode.reset();
   m_exists = false;
+  reset_read_ahead();
 }
 
 size_t Http_object::file_size() const {
@@ -242,7 +245,15 @@ off64_t Http_object::seek(off64_t offset) {
   assert(is_open());
 
   if (Mode::READ == *m_open_mode) {
-    m_offset = std::min<off64_t>(offset, file_size());
+    offset = std::min<off64_t>(offset, file_size());
+
+    if (offset != m_offset) {
+      // not a sequential read, start with small requests again; buffered data
+      // is kept, it's still used if the new position falls within it
+      m_read_ahead_size = MIN_READ_AHEAD;
+    }
+
+    m_offset = offset;
   }
 
   return m_offset;
@@ -251,14 +262,78 @@ off64_t Http_object::seek(off64_t offset) {
 ssize_t Http_object::read(void *buffer, size_t length) {
   assert(is_open() && Mode::READ == *m_open_mode);
 
+  const auto out = static_cast<char *>(buffer);
+  ssize_t total = 0;
+
+  const auto advance = [&](size_t bytes) {
+    m_offset += bytes;
+    total += bytes;
+    length -= bytes;
+  };
+
+  const auto grow = [this]() {
+    m_read_ahead_size = std::min(2 * m_read_ahead_size, MAX_READ_AHEAD);
+  };
+
+  while (length > 0) {
+    if (m_offset >= m_read_ahead_offset &&
+        m_offset < m_read_ahead_offset +
+                       static_cast<off64_t>(m_read_ahead.size())) {
+      const size_t start = m_offset - m_read_ahead_offset;
+      const auto bytes = std::min(length, m_read_ahead.size() - start);
+
+      ::memcpy(out + total, m_read_ahead.data() + start, bytes);
+      advance(bytes);
+
+      continue;
+    }
+
+    if (m_offset >= static_cast<off64_t>(file_size())) {
+      // EOF, keep the buffered data
+      break;
+    }
+
+    if (length >= m_read_ahead_size) {
+      // large read, fetch the data directly into the caller's buffer
+      const auto bytes = pread(out + total, length, m_offset);
+
+      if (bytes > 0) {
+        advance(bytes);
+        grow();
+      }
+
+      break;
+    }
+
+    m_read_ahead.resize(m_read_ahead_size);
+    const auto bytes =
+        pread(m_read_ahead.data(), m_read_ahead.size(), m_offset);
+
+    if (bytes <= 0) {
+      m_read_ahead.clear();
+      break;
+    }
+
+    m_read_ahead.resize(bytes);
+    m_read_ahead_offset = m_offset;
+    grow();
+  }
+
+  return total;
+}
+
+ssize_t Http_object::pread(void *buffer, size_t length, off64_t offset) {
+  assert(is_open() && Mode::READ == *m_open_mode);
+
   if (!(length > 0)) return 0;
+  // size is fetched when file is opened, this does not modify the object
   const off64_t fsize = file_size();
-  if (m_offset >= fsize) return 0;
+  if (offset >= fsize) return 0;
 
-  const size_t first = m_offset;
-  const size_t last_unbounded = m_offset + length - 1;
+  const size_t first = offset;
+  const size_t last_unbounded = offset + length - 1;
   // http range request is both sides inclusive
-  const size_t last = std::min(file_size() - 1, last_unbounded);
+  const size_t last = std::min<size_t>(fsize - 1, last_unbounded);
   const std::string range =
       "bytes=" + std::to_string(first) + "-" + std::to_string(last);
   Headers h{{"range", range}};
@@ -273,7 +348,6 @@ ssize_t Http_object::read(void *buffer, size_t length) {
     }
     std::copy(content.data(), content.data() + content.size(),
               reinterpret_cast<uint8_t *>(buffer));
-    m_offset += content.size();
     return content.size();
   } else if (Response::Status_code::OK == response.status) {
     throw std::runtime_error("Range requests are not supported.");
@@ -284,6 +358,12 @@ ssize_t Http_object::read(void *buffer, size_t length) {
   return 0;
 }
 
+void Http_object::reset_read_ahead() {
+  std::string().swap(m_read_ahead);
+  m_read_ahead_offset = 0;
+  m_read_ahead_size = MIN_READ_AHEAD;
+}
+
 ssize_t Http_object::write(const void *buffer, size_t length) {
   assert(is_open() && Mode::WRITE == *m_open_mode);
 
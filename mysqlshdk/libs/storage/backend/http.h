@@ -47,6 +47,9 @@ struct Http_request : public rest::Request {
 
 class Http_object : public IFile {
  public:
+  static constexpr std::size_t MIN_READ_AHEAD = 64 * 1024;
+  static constexpr std::size_t MAX_READ_AHEAD = 4 * 1024 * 1024;
+
   Http_object() = delete;
   explicit Http_object(const std::string &full_path, bool use_retry = false);
   explicit Http_object(const Masked_string &full_path, bool use_retry = false);
@@ -86,8 +89,22 @@ class Http_object : public IFile {
     throw std::logic_error("Http_object::tell() - not implemented");
   }
 
+  /**
+   * Reads the data sequentially, small reads are served from a read-ahead
+   * buffer. The size of range requests used to fill the buffer doubles with
+   * each consecutive sequential read (up to MAX_READ_AHEAD) and is reset by a
+   * seek to a different position.
+   */
   ssize_t read(void *buffer, size_t length) override;
 
+  /**
+   * Fetches the data using a range request, each thread uses its own
+   * connection.
+   */
+  ssize_t pread(void *buffer, size_t length, off64_t offset) override;
+
+  bool supports_pread() const override { return true; }
+
   ssize_t write(const void *, size_t) override;
 
   /**
@@ -128,6 +145,14 @@ class Http_object : public IFile {
   bool m_use_retry = false;
   std::string m_buffer;
   Config_ptr m_parent_config;
+
+ private:
+  void reset_read_ahead();
+
+  // data fetched ahead of the current position, used by read()
+  std::string m_read_ahead;
+  off64_t m_read_ahead_offset = 0;
+  std::size_t m_read_ahead_size = MIN_READ_AHEAD;
 };
 
 class Http_directory : public IDirectory {
@@ -24,23 +24,35 @@
 #include "mysqlshdk/libs/storage/backend/in_memory/allocated_file.h"
 
 #include <algorithm>
+#include <cassert>
+#include <cerrno>
 #include <cstring>
 #include <stdexcept>
 #include <utility>
 
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
 namespace mysqlshdk {
 namespace storage {
 namespace in_memory {
 
 Allocated_file::Allocated_file(const std::string &name, Allocator *allocator,
-                               bool consume_if_first)
+                               bool consume_if_first, Spill_config *spill)
     : IFile(name),
       m_allocator(allocator),
       m_block_size(allocator->block_size()),
-      m_consume_if_first(consume_if_first) {}
+      m_consume_if_first(consume_if_first),
+      m_spill(spill) {}
 
 Allocated_file::~Allocated_file() {
   m_allocator->free(m_blocks.begin(), m_blocks.end());
+
+  if (is_spilled()) {
+    m_spilled.close();
+    shcore::delete_file(m_spilled_path);
+  }
 }
 
 void Allocated_file::open(bool read_mode) {
@@ -119,6 +131,10 @@ ssize_t Allocated_file::read(void *buffer, std::size_t length) {
     return 0;
   }
 
+  if (is_spilled()) {
+    return read_spilled(buffer, length);
+  }
+
   auto block_number = (m_offset - m_bytes_consumed) / m_block_size;
   auto block_offset = m_offset - m_bytes_consumed - block_number * m_block_size;
   decltype(block_offset) to_read = 0;
@@ -164,11 +180,8 @@ ssize_t Allocated_file::write(const void *buffer, std::size_t length) {
                              ", it is opened for reading");
   }
 
-  if (m_capacity - m_offset < length) {
-    for (auto block : m_allocator->allocate(length - (m_capacity - m_offset))) {
-      m_blocks.emplace_back(block);
-      m_capacity += m_block_size;
-    }
+  if (is_spilled() || !reserve(length)) {
+    return write_spilled(buffer, length);
   }
 
   auto block_number = m_offset / m_block_size;
@@ -203,6 +216,13 @@ void Allocated_file::append(Scoped_data_block block) {
                              ", not allowed");
   }
 
+  if (is_spilled()) {
+    m_offset = m_size;
+    write_spilled(block->memory, block->size);
+    m_accepts_append = block->size == m_block_size;
+    return;
+  }
+
   m_blocks.emplace_back(block->memory);
   m_size += block->size;
   m_capacity += m_block_size;
@@ -214,6 +234,100 @@ void Allocated_file::append(Scoped_data_block block) {
   block.relinquish();
 }
 
+bool Allocated_file::reserve(std::size_t length) {
+  if (m_capacity - m_offset >= length) {
+    return true;
+  }
+
+  const auto memory = length - (m_capacity - m_offset);
+  // contents can be moved to a scratch file only if nothing was consumed yet
+  const auto can_spill = m_spill && 0 == m_bytes_consumed;
+  const auto blocks = can_spill ? m_allocator->try_allocate(memory)
+                                : m_allocator->allocate(memory);
+
+  if (blocks.empty()) {
+    spill();
+    return false;
+  }
+
+  for (auto block : blocks) {
+    m_blocks.emplace_back(block);
+    m_capacity += m_block_size;
+  }
+
+  return true;
+}
+
+void Allocated_file::spill() {
+  assert(m_spill);
+  assert(0 == m_bytes_consumed);
+
+  m_spilled_path = shcore::path::join_path(
+      m_spill->directory, std::to_string(++m_spill->files) + ".spill");
+  m_spilled.open(m_spilled_path, std::ios::in | std::ios::out |
+                                     std::ios::binary | std::ios::trunc);
+
+  if (!m_spilled.is_open()) {
+    throw std::runtime_error("Unable to create scratch file: " +
+                             m_spilled_path + " for file: " + name() + ": " +
+                             shcore::errno_to_string(errno));
+  }
+
+  auto remaining = m_size;
+
+  for (auto block : m_blocks) {
+    const auto length = std::min(remaining, m_block_size);
+    m_spilled.write(block, length);
+    remaining -= length;
+  }
+
+  if (!m_spilled) {
+    throw std::runtime_error("Unable to write to scratch file: " +
+                             m_spilled_path + " for file: " + name());
+  }
+
+  m_spill->bytes += m_size;
+
+  m_allocator->free(m_blocks.begin(), m_blocks.end());
+  m_blocks.clear();
+  m_capacity = 0;
+}
+
+ssize_t Allocated_file::read_spilled(void *buffer, std::size_t length) {
+  length = std::min(length, m_size - m_offset);
+
+  m_spilled.seekg(m_offset);
+  m_spilled.read(static_cast<char *>(buffer), length);
+
+  if (!m_spilled) {
+    throw std::runtime_error("Unable to read from scratch file: " +
+                             m_spilled_path + " for file: " + name());
+  }
+
+  m_offset += length;
+
+  return length;
+}
+
+ssize_t Allocated_file::write_spilled(const void *buffer, std::size_t length) {
+  m_spilled.seekp(m_offset);
+  m_spilled.write(static_cast<const char *>(buffer), length);
+
+  if (!m_spilled) {
+    throw std::runtime_error("Unable to write to scratch file: " +
+                             m_spilled_path + " for file: " + name());
+  }
+
+  m_spill->bytes += length;
+  m_offset += length;
+
+  if (m_offset > m_size) {
+    m_size = m_offset;
+  }
+
+  return length;
+}
+
 }  // namespace in_memory
 }  // namespace storage
 }  // namespace mysqlshdk
@@ -25,6 +25,7 @@
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_IN_MEMORY_ALLOCATED_FILE_H_
 
 #include <deque>
+#include <fstream>
 #include <string>
 
 #include "mysqlshdk/libs/storage/backend/in_memory/allocator.h"
@@ -39,6 +40,10 @@ namespace in_memory {
  * the file contents once, then dynamically adds blocks of set size when writing
  * to a file. The whole file can be read only once, the blocks are released
  * while reading.
+ *
+ * If spill configuration is given and allocator runs out of memory while file
+ * is being written, the blocks are moved to a local scratch file and all
+ * subsequent operations use that file.
  */
 class Allocated_file : public Virtual_fs::IFile {
  public:
@@ -50,9 +55,11 @@ class Allocated_file : public Virtual_fs::IFile {
    * @param allocator Allocator to use.
    * @param consume_if_first Blocks are released as long as reading starts at
    * the first block.
+   * @param spill Allows to move file contents to a local scratch file, once
+   * memory limit of the allocator is reached.
    */
   Allocated_file(const std::string &name, Allocator *allocator,
-                 bool consume_if_first = false);
+                 bool consume_if_first = false, Spill_config *spill = nullptr);
 
   Allocated_file(const Allocated_file &) = delete;
   Allocated_file(Allocated_file &&) = default;
@@ -147,7 +154,29 @@ class Allocated_file : public Virtual_fs::IFile {
    */
   void append(Scoped_data_block block);
 
+  /**
+   * Whether contents of this file were moved to a local scratch file.
+   */
+  bool is_spilled() const { return m_spilled.is_open(); }
+
  private:
+  /**
+   * Allocates blocks needed to hold the given number of bytes, moves contents
+   * of this file to a scratch file if memory limit is reached.
+   *
+   * @returns true if memory was allocated
+   */
+  bool reserve(std::size_t length);
+
+  /**
+   * Moves contents of this file to a scratch file.
+   */
+  void spill();
+
+  ssize_t read_spilled(void *buffer, std::size_t length);
+
+  ssize_t write_spilled(const void *buffer, std::size_t length);
+
   Allocator *m_allocator;
   bool m_is_open = false;
   bool m_read_mode = false;
@@ -161,6 +190,9 @@ class Allocated_file : public Virtual_fs::IFile {
   std::deque<char *> m_blocks;
   bool m_consume_if_first;
   bool m_accepts_append = true;
+  Spill_config *m_spill;
+  std::string m_spilled_path;
+  std::fstream m_spilled;
 };
 
 }  // namespace in_memory
@@ -39,7 +39,8 @@ namespace in_memory {
 
 Allocator::Page::Page(std::size_t page_size, std::size_t blocks,
                       std::size_t block_size)
-    : m_memory(std::make_unique<char[]>(page_size)) {
+    : m_memory(std::make_unique<char[]>(page_size)),
+      m_tracked_memory(shcore::Memory_tag::VIRTUAL_FS, page_size) {
   auto ptr = m_memory.get() + page_size;
   m_available_blocks.reserve(blocks);
 
@@ -92,40 +93,84 @@ Allocator::~Allocator() {
 }
 
 std::vector<char *> Allocator::allocate(std::size_t memory) {
-  auto blocks = block_count(memory);
+  const auto blocks = block_count(memory);
   std::vector<char *> result;
   result.reserve(blocks);
 
+  {
+    std::unique_lock lock{m_mutex};
+    allocate(blocks, &result);
+  }
+
+  return result;
+}
+
+std::vector<char *> Allocator::try_allocate(std::size_t memory) {
+  const auto blocks = block_count(memory);
+  std::vector<char *> result;
+
   {
     std::unique_lock lock{m_mutex};
 
-    while (blocks > m_available_blocks) {
-      add_page();
+    if (m_max_blocks && m_used_blocks + blocks > m_max_blocks) {
+      return result;
     }
 
-    while (blocks > 0) {
-      auto page = m_pages.begin()->get();
+    result.reserve(blocks);
+    allocate(blocks, &result);
+  }
 
-      const auto allocated = page->use_blocks(blocks, &result);
+  return result;
+}
 
-      // there are no full pages here, at least one block should be available
-      assert(allocated > 0);
+void Allocator::set_memory_limit(std::size_t memory) {
+  std::lock_guard lock{m_mutex};
+  // round down, limit cannot be exceeded
+  m_max_blocks = memory / m_block_size;
 
-      if (m_empty_page == page) {
-        m_empty_page = nullptr;
-      }
+  if (memory && !m_max_blocks) {
+    m_max_blocks = 1;
+  }
+}
 
-      if (page->m_available_blocks.empty()) {
-        // page is now full, move it to the other container
-        m_full_pages.insert(m_pages.extract(m_pages.begin()));
-      }
+std::size_t Allocator::memory_used() const {
+  std::lock_guard lock{m_mutex};
+  return m_used_blocks * m_block_size;
+}
 
-      blocks -= allocated;
-      m_available_blocks -= allocated;
-    }
+std::size_t Allocator::peak_memory() const {
+  std::lock_guard lock{m_mutex};
+  return m_peak_used_blocks * m_block_size;
+}
+
+void Allocator::allocate(std::size_t blocks, std::vector<char *> *result) {
+  while (blocks > m_available_blocks) {
+    add_page();
   }
 
-  return result;
+  m_used_blocks += blocks;
+  m_peak_used_blocks = std::max(m_peak_used_blocks, m_used_blocks);
+
+  while (blocks > 0) {
+    auto page = m_pages.begin()->get();
+
+    const auto allocated = page->use_blocks(blocks, result);
+
+    // there are no full pages here, at least one block should be available
+    assert(allocated > 0);
+
+    if (m_empty_page == page) {
+      m_empty_page = nullptr;
+    }
+
+    if (page->m_available_blocks.empty()) {
+      // page is now full, move it to the other container
+      m_full_pages.insert(m_pages.extract(m_pages.begin()));
+    }
+
+    blocks -= allocated;
+    m_available_blocks -= allocated;
+  }
 }
 
 void Allocator::free(char *block) {
@@ -169,6 +214,7 @@ void Allocator::free_block(char *block) {
 
   page->m_available_blocks.emplace_back(block);
   ++m_available_blocks;
+  --m_used_blocks;
 
   if (m_blocks_per_page == page->m_available_blocks.size()) {
     // page is completely empty
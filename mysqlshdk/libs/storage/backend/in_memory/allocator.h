@@ -29,6 +29,8 @@
 #include <set>
 #include <vector>
 
+#include "mysqlshdk/libs/utils/memory_stats.h"
+
 namespace mysqlshdk {
 namespace storage {
 namespace in_memory {
@@ -106,6 +108,33 @@ class Allocator final {
    */
   std::vector<char *> allocate(std::size_t memory);
 
+  /**
+   * Allocates the requested memory, if this does not exceed the memory limit.
+   *
+   * @param memory Size of the memory to be allocated.
+   *
+   * @returns allocated memory blocks, or an empty container if memory limit
+   *          would be exceeded
+   */
+  std::vector<char *> try_allocate(std::size_t memory);
+
+  /**
+   * Sets the limit of memory which can be allocated using try_allocate().
+   *
+   * @param memory Maximum size of allocated memory, 0 - no limit.
+   */
+  void set_memory_limit(std::size_t memory);
+
+  /**
+   * Provides size of the currently allocated memory.
+   */
+  std::size_t memory_used() const;
+
+  /**
+   * Provides the highest size of allocated memory.
+   */
+  std::size_t peak_memory() const;
+
   /**
    * Frees a single memory block.
    *
@@ -165,6 +194,8 @@ class Allocator final {
     std::unique_ptr<char[]> m_memory;
     // blocks available for allocation
     std::vector<char *> m_available_blocks;
+    // reports the memory of this page
+    shcore::Tracked_memory m_tracked_memory;
   };
 
   /**
@@ -201,6 +232,11 @@ class Allocator final {
 
   using Pages = std::set<std::unique_ptr<Page>, Compare_pages>;
 
+  /**
+   * Allocates the requested number of blocks, mutex needs to be locked.
+   */
+  void allocate(std::size_t blocks, std::vector<char *> *result);
+
   /**
    * Adds a new page.
    */
@@ -237,8 +273,15 @@ class Allocator final {
   // number of available blocks
   std::size_t m_available_blocks = 0;
 
+  // number of allocated blocks
+  std::size_t m_used_blocks = 0;
+  // highest number of allocated blocks
+  std::size_t m_peak_used_blocks = 0;
+  // maximum number of blocks allocated by try_allocate(), 0 - no limit
+  std::size_t m_max_blocks = 0;
+
   // controls access to memory
-  std::mutex m_mutex;
+  mutable std::mutex m_mutex;
 };
 
 struct Data_block {
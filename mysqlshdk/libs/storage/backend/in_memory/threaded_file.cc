@@ -31,6 +31,8 @@
 
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/compression/zstd_file.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 
 #include "mysqlshdk/libs/storage/backend/in_memory/allocator.h"
@@ -93,6 +95,94 @@ class Compressed_config : public Config {
   mutable bool m_called = false;
 };
 
+/**
+ * Limits reads of the underlying file to the given range.
+ */
+class Range_file : public IFile {
+ public:
+  Range_file(std::unique_ptr<IFile> file, std::size_t begin, std::size_t end)
+      : m_file(std::move(file)), m_begin(begin), m_end(end) {}
+
+  Range_file(const Range_file &) = delete;
+  Range_file(Range_file &&) = default;
+
+  Range_file &operator=(const Range_file &) = delete;
+  Range_file &operator=(Range_file &&) = default;
+
+  ~Range_file() override = default;
+
+  void open(Mode m) override {
+    if (m != Mode::READ) {
+      throw std::invalid_argument("Range_file: only READ mode is supported");
+    }
+
+    m_file->open(m);
+    m_file->seek(m_begin);
+    m_offset = m_begin;
+  }
+
+  bool is_open() const override { return m_file->is_open(); }
+
+  int error() const override { return m_file->error(); }
+
+  void close() override { m_file->close(); }
+
+  size_t file_size() const override { return m_end - m_begin; }
+
+  Masked_string full_path() const override { return m_file->full_path(); }
+
+  std::string filename() const override { return m_file->filename(); }
+
+  bool exists() const override { return m_file->exists(); }
+
+  std::unique_ptr<IDirectory> parent() const override {
+    return m_file->parent();
+  }
+
+  off64_t seek(off64_t offset) override {
+    m_offset = m_file->seek(
+        std::min(m_begin + static_cast<std::size_t>(offset), m_end));
+    return m_offset - m_begin;
+  }
+
+  off64_t tell() const override { return m_offset - m_begin; }
+
+  ssize_t read(void *buffer, size_t length) override {
+    const auto result =
+        m_file->read(buffer, std::min(length, m_end - m_offset));
+
+    if (result > 0) {
+      m_offset += result;
+    }
+
+    return result;
+  }
+
+  ssize_t write(const void *, size_t) override {
+    throw std::logic_error("Range_file::write() - not supported");
+  }
+
+  bool flush() override {
+    throw std::logic_error("Range_file::flush() - not supported");
+  }
+
+  bool is_local() const override { return m_file->is_local(); }
+
+  void rename(const std::string &) override {
+    throw std::logic_error("Range_file::rename() - not supported");
+  }
+
+  void remove() override {
+    throw std::logic_error("Range_file::remove() - not supported");
+  }
+
+ private:
+  std::unique_ptr<IFile> m_file;
+  std::size_t m_begin;
+  std::size_t m_end;
+  std::size_t m_offset = 0;
+};
+
 }  // namespace
 
 Threaded_file::Threaded_file(Threaded_file_config config)
@@ -112,10 +202,39 @@ Threaded_file::Threaded_file(Threaded_file_config config)
 
   m_file = make_file(m_config.file_path, m_config.config);
   m_file_size = m_file->file_size();
-  m_compressed = dynamic_cast<Compressed_file *>(m_file.get());
+  m_sequential =
+      m_config.sequential || dynamic_cast<Compressed_file *>(m_file.get());
   m_block_size = m_config.allocator->block_size();
 }
 
+Threaded_file::Threaded_file(Threaded_file_config config,
+                             Compression compression,
+                             const std::vector<uint64_t> &frames)
+    : Threaded_file(std::move(config)) {
+  m_frames_compression = compression;
+
+  // each thread decompresses a share of the compressed data which would be
+  // fetched at once if the file was not compressed
+  const auto segment_size =
+      std::max<std::size_t>(m_config.max_memory / m_config.threads, 1);
+
+  for (auto it = frames.begin(); it != frames.end();) {
+    Segment segment;
+    // data before the first frame (if any) is not a frame, let the
+    // decompressor handle it
+    segment.begin = m_segments.empty() ? 0 : *it;
+
+    do {
+      ++it;
+    } while (frames.end() != it && *it - segment.begin < segment_size);
+
+    segment.end = frames.end() == it ? m_file_size : *it;
+    m_segments.emplace_back(std::move(segment));
+  }
+
+  m_next_segment = m_segments.begin();
+}
+
 Threaded_file::~Threaded_file() {
   if (m_file->is_open()) {
     close_impl();
@@ -129,28 +248,49 @@ void Threaded_file::open(Mode m) {
 
   m_file->open(m);
 
+  if (decompresses_frames()) {
+    m_segment_tasks = std::make_unique<shcore::Synchronized_queue<Segment *>>();
+    m_workers.resize(m_config.threads);
+
+    for (std::size_t i = 0; i < m_config.threads; ++i) {
+      m_workers[i] = mysqlsh::spawn_scoped_thread([this]() {
+        try {
+          while (const auto segment = m_segment_tasks->pop()) {
+            read_segment(segment);
+          }
+        } catch (...) {
+          on_worker_exception();
+        }
+      });
+    }
+
+    // each thread decompresses one segment, the next one is scheduled once the
+    // first segment is consumed
+    for (std::size_t i = 0; i < m_config.threads; ++i) {
+      if (!schedule_segment()) {
+        break;
+      }
+    }
+
+    return;
+  }
+
   m_tasks = std::make_unique<shcore::Synchronized_queue<Block *>>();
   m_workers.resize(m_config.threads);
 
   for (std::size_t i = 0; i < m_config.threads; ++i) {
     m_workers[i] = mysqlsh::spawn_scoped_thread([this]() {
-      const auto on_exception = [this]() {
-        bool expected = false;
-
-        if (m_has_exception.compare_exchange_strong(expected, true)) {
-          m_worker_exception = std::current_exception();
-        }
+      try {
+        // positional reads allow all workers to share the main handle
+        const auto shared = !m_sequential && m_file->supports_pread();
+        std::unique_ptr<IFile> own_file;
 
-        {
-          const auto l = lock();
-          m_cv.notify_one();
+        if (!shared) {
+          own_file = make_file(m_config.file_path, m_config.config);
+          own_file->open(Mode::READ);
         }
-      };
-
-      try {
-        const auto file = make_file(m_config.file_path, m_config.config);
 
-        file->open(Mode::READ);
+        const auto file = shared ? m_file.get() : own_file.get();
 
         while (true) {
           auto block = m_tasks->pop();
@@ -159,9 +299,9 @@ void Threaded_file::open(Mode m) {
             break;
           }
 
-          // if file is compressed, we're reading using a single thread,
-          // sequentially, no need to seek in that case
-          if (!m_compressed) {
+          // if file is compressed or streamed, we're reading using a single
+          // thread, sequentially, no need to seek in that case
+          if (!m_sequential && !shared) {
             file->seek(block->offset_in_file);
           }
 
@@ -169,7 +309,11 @@ void Threaded_file::open(Mode m) {
 
           while (bytes != m_block_size) {
             const auto result =
-                file->read(block->data.memory + bytes, m_block_size - bytes);
+                shared ? file->pread(block->data.memory + bytes,
+                                     m_block_size - bytes,
+                                     block->offset_in_file + bytes)
+                       : file->read(block->data.memory + bytes,
+                                    m_block_size - bytes);
 
             if (result < 0) {
               throw std::runtime_error(
@@ -202,9 +346,11 @@ void Threaded_file::open(Mode m) {
           }
         }
 
-        file->close();
+        if (own_file) {
+          own_file->close();
+        }
       } catch (...) {
-        on_exception();
+        on_worker_exception();
       }
     });
   }
@@ -212,7 +358,8 @@ void Threaded_file::open(Mode m) {
   std::size_t allocated = 0;
 
   while (allocated < m_config.max_memory) {
-    if (schedule_block()) {
+    // size of a streamed file is unknown, fill the whole buffer
+    if (schedule_block(m_config.sequential)) {
       allocated += m_block_size;
     } else {
       break;
@@ -225,9 +372,9 @@ ssize_t Threaded_file::read(void *buffer, size_t length) {
   auto cbuffer = static_cast<char *>(buffer);
 
   while (length > 0) {
-    if (m_compressed) {
-      // we always schedule a new block if file is compressed, because we
-      // don't know the uncompressed data size
+    if (m_sequential) {
+      // we always schedule a new block if file is read sequentially, because
+      // we don't know the size of the data
       schedule_block(true);
     }
 
@@ -254,7 +401,7 @@ ssize_t Threaded_file::read(void *buffer, size_t length) {
       m_config.allocator->free(block->data.memory);
       m_blocks.pop_front();
 
-      if (!m_compressed) {
+      if (!m_sequential) {
         schedule_block();
       }
     }
@@ -272,12 +419,17 @@ void Threaded_file::close_impl() {
     m_tasks->shutdown(m_config.threads);
   }
 
+  if (m_segment_tasks) {
+    m_segment_tasks->shutdown(m_config.threads);
+  }
+
   for (auto &worker : m_workers) {
     worker.join();
   }
 
   m_workers.clear();
   m_tasks.reset();
+  m_segment_tasks.reset();
 
   m_has_exception = false;
   m_worker_exception = nullptr;
@@ -287,6 +439,15 @@ void Threaded_file::close_impl() {
   }
 
   m_blocks.clear();
+
+  for (const auto &segment : m_segments) {
+    for (const auto &block : segment.blocks) {
+      m_config.allocator->free(block.memory);
+    }
+  }
+
+  m_segments.clear();
+  m_next_segment = m_segments.begin();
 }
 
 void Threaded_file::handle_exception() const {
@@ -295,8 +456,21 @@ void Threaded_file::handle_exception() const {
   }
 }
 
+void Threaded_file::on_worker_exception() {
+  bool expected = false;
+
+  if (m_has_exception.compare_exchange_strong(expected, true)) {
+    m_worker_exception = std::current_exception();
+  }
+
+  {
+    const auto l = lock();
+    m_cv.notify_one();
+  }
+}
+
 bool Threaded_file::schedule_block(bool force) {
-  if (m_eof) {
+  if (m_eof || decompresses_frames()) {
     return false;
   }
 
@@ -321,6 +495,10 @@ bool Threaded_file::schedule_block(bool force) {
 Threaded_file::Block *Threaded_file::front() {
   handle_exception();
 
+  if (m_blocks.empty() && decompresses_frames()) {
+    take_segment();
+  }
+
   if (m_blocks.empty() || m_read_eof) {
     return nullptr;
   }
@@ -341,6 +519,97 @@ Threaded_file::Block *Threaded_file::front() {
   return block;
 }
 
+void Threaded_file::read_segment(Segment *segment) {
+  const auto file = make_file(
+      std::make_unique<Range_file>(
+          make_file(m_config.file_path, m_config.config), segment->begin,
+          segment->end),
+      m_frames_compression);
+
+  file->open(Mode::READ);
+
+  while (true) {
+    // block is added first, so that it's released if read fails
+    segment->blocks.emplace_back();
+
+    auto &block = segment->blocks.back();
+    block.memory = m_config.allocator->allocate_block();
+
+    while (block.size != m_block_size) {
+      const auto result =
+          file->read(block.memory + block.size, m_block_size - block.size);
+
+      if (result < 0) {
+        throw std::runtime_error("Failed to read '" +
+                                 file->full_path().masked() +
+                                 "', error: " + std::to_string(file->error()));
+      }
+
+      if (0 == result) {
+        break;
+      }
+
+      block.size += result;
+    }
+
+    if (block.size != m_block_size) {
+      break;
+    }
+  }
+
+  if (0 == segment->blocks.back().size) {
+    m_config.allocator->free(segment->blocks.back().memory);
+    segment->blocks.pop_back();
+  }
+
+  file->close();
+
+  *segment->ready = true;
+
+  {
+    const auto l = lock();
+    m_cv.notify_one();
+  }
+}
+
+bool Threaded_file::schedule_segment() {
+  if (m_segments.end() == m_next_segment) {
+    return false;
+  }
+
+  m_segment_tasks->push(&*m_next_segment);
+  ++m_next_segment;
+
+  return true;
+}
+
+void Threaded_file::take_segment() {
+  while (m_blocks.empty() && !m_segments.empty()) {
+    auto segment = &m_segments.front();
+
+    if (!*segment->ready) {
+      auto l = lock();
+      m_cv.wait(l, [segment, this]() {
+        return *segment->ready || m_has_exception;
+      });
+    }
+
+    handle_exception();
+
+    for (const auto &data : segment->blocks) {
+      Block b;
+
+      b.data = data;
+      *b.ready = true;
+
+      m_blocks.emplace_back(std::move(b));
+    }
+
+    m_segments.pop_front();
+    schedule_segment();
+  }
+}
+
 Data_block Threaded_file::peek() {
   const auto block = front();
 
@@ -352,9 +621,9 @@ Data_block Threaded_file::peek() {
 }
 
 void Threaded_file::pop_front() {
-  if (m_compressed) {
-    // we always schedule a new block if file is compressed, because we
-    // don't know the uncompressed data size
+  if (m_sequential) {
+    // we always schedule a new block if file is read sequentially, because we
+    // don't know the size of the data
     schedule_block(true);
   }
 
@@ -367,15 +636,15 @@ void Threaded_file::pop_front() {
 
   m_blocks.pop_front();
 
-  if (!m_compressed) {
+  if (!m_sequential) {
     schedule_block();
   }
 }
 
 Scoped_data_block Threaded_file::extract() {
-  if (m_compressed) {
-    // we always schedule a new block if file is compressed, because we
-    // don't know the uncompressed data size
+  if (m_sequential) {
+    // we always schedule a new block if file is read sequentially, because we
+    // don't know the size of the data
     schedule_block(true);
   }
 
@@ -388,7 +657,7 @@ Scoped_data_block Threaded_file::extract() {
   auto data = std::move(block->data);
   m_blocks.pop_front();
 
-  if (!m_compressed) {
+  if (!m_sequential) {
     schedule_block();
   }
 
@@ -409,6 +678,29 @@ std::unique_ptr<Threaded_file> threaded_file(Threaded_file_config config) {
     return std::unique_ptr<Threaded_file>{new Threaded_file{std::move(config)}};
   };
 
+  if (config.sequential) {
+    // we can only read sequentially
+    config.threads = 1;
+    return file();
+  }
+
+  if (Compression::ZSTD == compression && config.threads > 1) {
+    std::vector<uint64_t> frames;
+
+    {
+      const auto compressed = make_file(config.file_path, config.config);
+
+      compressed->open(Mode::READ);
+      frames = compression::find_zstd_frames(compressed.get());
+      compressed->close();
+    }
+
+    if (frames.size() > 1) {
+      return std::unique_ptr<Threaded_file>{
+          new Threaded_file{std::move(config), compression, frames}};
+    }
+  }
+
   if (Compression::NONE != compression) {
     auto compression_config = config;
 
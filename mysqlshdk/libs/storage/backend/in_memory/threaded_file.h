@@ -26,6 +26,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <exception>
 #include <list>
 #include <memory>
@@ -37,6 +38,7 @@
 
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 
+#include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/config.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 
@@ -62,10 +64,17 @@ struct Threaded_file_config {
   std::size_t max_memory = 1024 * 1024;
   /// Allocator used to manage the allocated memory.
   Allocator *allocator = nullptr;
+  /// Whether the file can only be read sequentially (i.e. a pipe), its size is
+  /// unknown. Such file is fetched using a single thread.
+  bool sequential = false;
 };
 
 /**
  * Fetches the file using multiple threads, only for reading.
+ *
+ * Compressed files are decompressed by a single thread, unless they consist of
+ * multiple independent frames (currently: zstd) - in such case groups of frames
+ * are decompressed in parallel, data is returned in the original order.
  */
 class Threaded_file final : public IFile {
  public:
@@ -115,7 +124,9 @@ class Threaded_file final : public IFile {
     throw std::logic_error("Threaded_file::flush() - not supported");
   }
 
-  bool is_compressed() const override { return m_file->is_compressed(); }
+  bool is_compressed() const override {
+    return decompresses_frames() || m_file->is_compressed();
+  }
 
   bool is_local() const override { return m_file->is_local(); }
 
@@ -142,6 +153,19 @@ class Threaded_file final : public IFile {
         std::make_unique<std::atomic_bool>(false);
   };
 
+  /**
+   * A range of independent frames of a compressed file.
+   */
+  struct Segment {
+    // range in the compressed file
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    // decompressed data
+    std::vector<Data_block> blocks;
+    std::unique_ptr<std::atomic_bool> ready =
+        std::make_unique<std::atomic_bool>(false);
+  };
+
   friend std::unique_ptr<Threaded_file> threaded_file(Threaded_file_config);
 
   /**
@@ -153,10 +177,34 @@ class Threaded_file final : public IFile {
    */
   explicit Threaded_file(Threaded_file_config config);
 
+  /**
+   * Initializes the file which decompresses the given frames in parallel.
+   *
+   * @param config Configuration, refers to the compressed file.
+   * @param compression Compression of the file.
+   * @param frames Compressed offsets of the independent frames.
+   *
+   * @throws std::invalid_argument if configuration is not valid
+   */
+  Threaded_file(Threaded_file_config config, Compression compression,
+                const std::vector<uint64_t> &frames);
+
+  bool decompresses_frames() const {
+    return Compression::NONE != m_frames_compression;
+  }
+
+  void read_segment(Segment *segment);
+
+  bool schedule_segment();
+
+  void take_segment();
+
   auto lock() { return std::unique_lock{m_mutex}; }
 
   void handle_exception() const;
 
+  void on_worker_exception();
+
   bool schedule_block(bool force = false);
 
   void close_impl();
@@ -166,7 +214,8 @@ class Threaded_file final : public IFile {
   Threaded_file_config m_config;
 
   std::unique_ptr<IFile> m_file;
-  bool m_compressed;
+  // file is compressed or streamed, it's read using a single thread
+  bool m_sequential;
   std::size_t m_file_size;
   std::size_t m_offset = 0;
   // signals that EOF was read by the background thread
@@ -177,6 +226,14 @@ class Threaded_file final : public IFile {
   std::list<Block> m_blocks;
   std::size_t m_block_size;
 
+  // set if independent frames are decompressed in parallel
+  Compression m_frames_compression = Compression::NONE;
+  // segments which were not consumed yet
+  std::list<Segment> m_segments;
+  // first segment which was not scheduled yet
+  std::list<Segment>::iterator m_next_segment;
+  std::unique_ptr<shcore::Synchronized_queue<Segment *>> m_segment_tasks;
+
   std::vector<std::thread> m_workers;
   std::unique_ptr<shcore::Synchronized_queue<Block *>> m_tasks;
   std::atomic_bool m_has_exception = false;
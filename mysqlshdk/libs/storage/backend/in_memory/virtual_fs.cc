@@ -23,8 +23,11 @@
 
 #include "mysqlshdk/libs/storage/backend/in_memory/virtual_fs.h"
 
+#include <exception>
 #include <stdexcept>
 
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -81,8 +84,10 @@ Virtual_fs::IFile *Virtual_fs::Directory::create_file(const std::string &name) {
         .first->second.get();
   } else {
     return m_created_files
-        .emplace(name,
-                 std::make_unique<Allocated_file>(name, &m_fs->m_allocator))
+        .emplace(name, std::make_unique<Allocated_file>(
+                           name, &m_fs->m_allocator, false,
+                           m_fs->m_spill_directory_created ? &m_fs->m_spill
+                                                           : nullptr))
         .first->second.get();
   }
 }
@@ -176,6 +181,20 @@ void Virtual_fs::Directory::publish_created_file(const std::string &name) {
 Virtual_fs::Virtual_fs(std::size_t page_size, std::size_t block_size)
     : m_allocator(page_size, block_size) {}
 
+Virtual_fs::~Virtual_fs() {
+  // spilled files are removed when files are destroyed
+  m_dirs.clear();
+
+  if (m_spill_directory_created) {
+    try {
+      shcore::remove_directory(m_spill.directory, true);
+    } catch (const std::exception &e) {
+      log_warning("Failed to remove the scratch directory '%s': %s",
+                  m_spill.directory.c_str(), e.what());
+    }
+  }
+}
+
 Virtual_fs::Directory *Virtual_fs::directory(const std::string &name) const {
   std::lock_guard lock{m_mutex};
   const auto d = m_dirs.find(name);
@@ -213,6 +232,23 @@ std::vector<std::string> Virtual_fs::split_path(const std::string &path) {
 
 void Virtual_fs::interrupt() { m_interrupted = true; }
 
+void Virtual_fs::set_memory_limit(std::size_t memory,
+                                  const std::string &spill_directory) {
+  if (m_spill_directory_created) {
+    throw std::logic_error("Memory limit of the virtual FS is already set");
+  }
+
+  if (!memory) {
+    return;
+  }
+
+  shcore::create_directory(spill_directory);
+
+  m_spill.directory = spill_directory;
+  m_spill_directory_created = true;
+  m_allocator.set_memory_limit(memory);
+}
+
 void Virtual_fs::set_uses_synchronized_io(
     std::function<bool(std::string_view)> callback) {
   m_uses_synchronized_io = std::move(callback);
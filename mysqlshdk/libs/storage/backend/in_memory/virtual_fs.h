@@ -42,6 +42,19 @@ namespace mysqlshdk {
 namespace storage {
 namespace in_memory {
 
+/**
+ * Local storage used to hold contents of the in-memory files, once the memory
+ * limit is reached.
+ */
+struct Spill_config {
+  // directory which holds the spilled files
+  std::string directory;
+  // number of spilled files created so far, used to generate unique names
+  std::atomic<uint64_t> files = 0;
+  // total number of bytes written to the spilled files
+  std::atomic<std::size_t> bytes = 0;
+};
+
 /**
  * In-memory file system.
  */
@@ -255,7 +268,7 @@ class Virtual_fs final {
   Virtual_fs &operator=(const Virtual_fs &) = delete;
   Virtual_fs &operator=(Virtual_fs &&) = delete;
 
-  ~Virtual_fs() = default;
+  ~Virtual_fs();
 
   /**
    * Joins two path segments.
@@ -308,8 +321,32 @@ class Virtual_fs final {
    */
   void set_uses_synchronized_io(std::function<bool(std::string_view)> callback);
 
+  /**
+   * Limits the memory used by the files which are not using synchronized I/O
+   * operations. Once the limit is reached, contents of the files which need
+   * more memory are moved to the local scratch directory.
+   *
+   * @param memory Maximum size of memory used by the files, 0 - no limit.
+   * @param spill_directory Scratch directory, it's created if it does not
+   *        exist and removed (along with its contents) when file system is
+   *        destroyed.
+   */
+  void set_memory_limit(std::size_t memory, const std::string &spill_directory);
+
+  /**
+   * Provides the highest size of memory used by the files.
+   */
+  std::size_t peak_memory() const { return m_allocator.peak_memory(); }
+
+  /**
+   * Provides the total number of bytes written to the scratch directory.
+   */
+  std::size_t spilled_bytes() const { return m_spill.bytes; }
+
  private:
   Allocator m_allocator;
+  Spill_config m_spill;
+  bool m_spill_directory_created = false;
   std::unordered_map<std::string, std::unique_ptr<Directory>> m_dirs;
   mutable std::mutex m_mutex;
   std::atomic<bool> m_interrupted = false;
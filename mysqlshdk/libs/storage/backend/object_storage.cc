@@ -23,7 +23,11 @@
 
 #include "mysqlshdk/libs/storage/backend/object_storage.h"
 
+#include <algorithm>
+#include <cstring>
+#include <exception>
 #include <iterator>
+#include <utility>
 
 #include "mysqlshdk/libs/rest/error_codes.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -33,11 +37,23 @@ namespace storage {
 namespace backend {
 namespace object_storage {
 
+namespace {
+
+// maximum number of shards listed concurrently
+constexpr std::size_t k_max_listing_shards = 16;
+
+// listing is split into shards only if there are at least this many objects
+// per shard, smaller shards do not benefit from being listed concurrently
+constexpr std::size_t k_min_objects_per_shard = 10000;
+
+}  // namespace
+
 Directory::Directory(const Config_ptr &config, const std::string &name)
     : m_name(name),
       m_prefix(m_name.empty() ? "" : m_name + "/"),
       m_container(config->container()),
-      m_created(false) {}
+      m_created(false),
+      m_listing_cache(std::make_unique<Listing_cache>()) {}
 
 bool Directory::exists() const {
   try {
@@ -58,17 +74,26 @@ bool Directory::exists() const {
 
 void Directory::create() { m_created = true; }
 
-std::unordered_set<IDirectory::File_info> Directory::list_files(
-    bool hidden_files) const {
-  std::unordered_set<IDirectory::File_info> files;
-  std::vector<Object_details> objects;
+void Directory::remove_incomplete_files() {
+  std::size_t aborted = 0;
 
   try {
-    objects = m_container->list_objects(m_prefix, 0, false);
+    aborted = m_container->abort_multipart_uploads(m_prefix);
   } catch (const rest::Response_error &error) {
     throw rest::to_exception(error);
   }
 
+  if (aborted > 0) {
+    log_info("Aborted %zu multipart upload%s in '%s'", aborted,
+             1 == aborted ? "" : "s", m_name.c_str());
+  }
+}
+
+std::unordered_set<IDirectory::File_info> Directory::list_files(
+    bool hidden_files) const {
+  std::unordered_set<IDirectory::File_info> files;
+  auto objects = list_objects();
+
   if (m_prefix.empty()) {
     for (auto &object : objects) {
       files.emplace(std::move(object.name), object.size);
@@ -121,13 +146,7 @@ std::unordered_set<IDirectory::File_info> Directory::list_multipart_uploads()
 std::unordered_set<IDirectory::File_info> Directory::filter_files(
     const std::string &pattern) const {
   std::unordered_set<IDirectory::File_info> files;
-  std::vector<Object_details> objects;
-
-  try {
-    objects = m_container->list_objects(m_prefix, 0, false);
-  } catch (const rest::Response_error &error) {
-    throw rest::to_exception(error);
-  }
+  auto objects = list_objects();
 
   if (m_prefix.empty()) {
     for (auto &object : objects) {
@@ -147,6 +166,84 @@ std::unordered_set<IDirectory::File_info> Directory::filter_files(
   return files;
 }
 
+std::vector<Object_details> Directory::list_objects() const {
+  std::vector<std::string> boundaries;
+
+  {
+    std::lock_guard lock{m_listing_cache->mutex};
+    const auto &names = m_listing_cache->names;
+
+    if (m_container->has_list_objects_after()) {
+      // previous listing determines the shards, each one is going to hold
+      // roughly the same number of objects
+      const auto shards = std::min(k_max_listing_shards,
+                                   names.size() / k_min_objects_per_shard);
+
+      for (std::size_t i = 1; i < shards; ++i) {
+        boundaries.emplace_back(names[i * names.size() / shards]);
+      }
+    }
+  }
+
+  std::vector<Object_details> objects;
+
+  try {
+    if (boundaries.empty()) {
+      objects = m_container->list_objects(m_prefix, 0, false);
+    } else {
+      // shard i holds names in range (boundaries[i - 1], boundaries[i]], the
+      // first one has no lower bound, the last one has no upper bound
+      std::vector<mysqlshdk::utils::Scoped_future<std::vector<Object_details>>>
+          shards;
+
+      for (std::size_t i = 0; i <= boundaries.size(); ++i) {
+        shards.emplace_back(mysqlshdk::utils::scoped_async(
+            [this, start_after = 0 == i ? std::string{} : boundaries[i - 1],
+             last = boundaries.size() == i ? std::string{} : boundaries[i]]() {
+              return m_container->list_objects_range(m_prefix, start_after,
+                                                     last, false);
+            }));
+      }
+
+      std::exception_ptr exception;
+
+      for (auto &shard : shards) {
+        try {
+          auto list = shard.get();
+          std::move(list.begin(), list.end(), std::back_inserter(objects));
+        } catch (...) {
+          if (!exception) {
+            exception = std::current_exception();
+          }
+        }
+      }
+
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+    }
+  } catch (const rest::Response_error &error) {
+    throw rest::to_exception(error);
+  }
+
+  std::vector<std::string> names;
+  names.reserve(objects.size());
+
+  for (const auto &object : objects) {
+    names.emplace_back(object.name);
+  }
+
+  // boundaries of the shards are selected from a sorted list
+  std::sort(names.begin(), names.end());
+
+  {
+    std::lock_guard lock{m_listing_cache->mutex};
+    m_listing_cache->names = std::move(names);
+  }
+
+  return objects;
+}
+
 std::string Directory::join_path(const std::string &a,
                                  const std::string &b) const {
   return a.empty() ? b : a + "/" + b;
@@ -301,6 +398,18 @@ ssize_t Object::read(void *buffer, size_t length) {
   return m_reader->read(buffer, length);
 }
 
+ssize_t Object::pread(void *buffer, size_t length, off64_t offset) {
+  assert(is_open());
+
+  if (!m_reader) {
+    throw std::logic_error("Object::pread() - object must be open for reading");
+  }
+
+  if (length <= 0) return 0;
+
+  return m_reader->pread(buffer, length, offset);
+}
+
 ssize_t Object::write(const void *buffer, size_t length) {
   assert(is_open());
 
@@ -371,28 +480,23 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
   // This loops handles the upload of N number of chunks of size
   // MY_MAX_PART_SIZE including the buffered data and the incoming data
   while (to_send > MY_MAX_PART_SIZE) {
-    const char *part = nullptr;
+    std::string part;
 
     if (!m_buffer.empty()) {
       // BUFFERED DATA: fills the buffer and sends it
       const auto buffer_space = MY_MAX_PART_SIZE - m_buffer.size();
       m_buffer.append(incoming + incoming_offset, buffer_space);
 
-      part = m_buffer.data();
+      part = std::move(m_buffer);
       incoming_offset += buffer_space;
     } else {
-      // NO BUFFERED DATA: sends the data directly from the incoming buffer
-      part = incoming + incoming_offset;
+      // NO BUFFERED DATA: sends the data from the incoming buffer, it needs to
+      // be copied, as part is uploaded in the background
+      part.assign(incoming + incoming_offset, MY_MAX_PART_SIZE);
       incoming_offset += MY_MAX_PART_SIZE;
     }
 
-    try {
-      m_parts.push_back(m_object->m_container->upload_part(
-          m_multipart, m_parts.size() + 1, part, MY_MAX_PART_SIZE));
-    } catch (const rest::Response_error &error) {
-      abort_multipart_upload("failure uploading part", error.format());
-      throw rest::to_exception(error);
-    }
+    upload_part(std::move(part));
 
     m_buffer.clear();
     to_send -= MY_MAX_PART_SIZE;
@@ -413,10 +517,12 @@ void Object::Writer::close() {
     // MULTIPART UPLOAD STARTED: Sends last part if any and commits the upload
     try {
       if (!m_buffer.empty()) {
-        m_parts.push_back(m_object->m_container->upload_part(
-            m_multipart, m_parts.size() + 1, m_buffer.data(), m_buffer.size()));
+        upload_part(std::move(m_buffer));
       }
 
+      // all parts need to be uploaded before the upload is committed
+      wait_for_uploads(0);
+
       m_object->m_container->commit_multipart_upload(m_multipart, m_parts);
     } catch (const rest::Response_error &error) {
       abort_multipart_upload("failure completing the upload", error.format());
@@ -443,12 +549,61 @@ void Object::Writer::close() {
 }
 
 void Object::Writer::reset() {
-  // clean up
+  // clean up, this waits for the parts which are still being uploaded
+  m_pending.clear();
   m_is_multipart = false;
   m_buffer.clear();
   m_parts.clear();
 }
 
+void Object::Writer::upload_part(std::string data) {
+  const auto concurrency =
+      m_object->m_container->config()->upload_concurrency();
+
+  const auto number = m_parts.size() + m_pending.size() + 1;
+
+  if (0 == concurrency) {
+    try {
+      m_parts.push_back(m_object->m_container->upload_part(
+          m_multipart, number, data.data(), data.size()));
+    } catch (const rest::Response_error &error) {
+      abort_multipart_upload("failure uploading part", error.format());
+      throw rest::to_exception(error);
+    }
+
+    return;
+  }
+
+  // make room for the new part
+  wait_for_uploads(concurrency - 1);
+
+  auto &part = m_pending.emplace_back();
+  part.data = std::move(data);
+  // deque does not invalidate references to its elements when elements are
+  // added or removed at either end
+  part.uploaded = mysqlshdk::utils::scoped_async(
+      [container = m_object->m_container.get(), multipart = m_multipart,
+       number, body = part.data.data(), size = part.data.size()]() {
+        return container->upload_part(multipart, number, body, size);
+      });
+}
+
+void Object::Writer::wait_for_uploads(std::size_t max_pending) {
+  while (m_pending.size() > max_pending) {
+    try {
+      m_parts.push_back(m_pending.front().uploaded.get());
+    } catch (const rest::Response_error &error) {
+      abort_multipart_upload("failure uploading part", error.format());
+      throw rest::to_exception(error);
+    } catch (const std::exception &error) {
+      abort_multipart_upload("failure uploading part", error.what());
+      throw;
+    }
+
+    m_pending.pop_front();
+  }
+}
+
 void Object::Writer::abort_multipart_upload(const char *context,
                                             const std::string &error) {
   if (m_is_multipart) {
@@ -502,6 +657,24 @@ Object::Reader::Reader(Object *owner) : File_handler(owner), m_offset(0) {
 off64_t Object::Reader::seek(off64_t offset) {
   const off64_t fsize = m_size;
   m_offset = std::min(offset, fsize);
+
+  if (!m_parts.empty() &&
+      (m_offset < m_parts.front().offset || m_offset >= m_next_part)) {
+    clear_parts();
+  }
+
+  // drop the ranges which are behind the new offset
+  while (!m_parts.empty() && m_parts.front().offset +
+                                     static_cast<off64_t>(
+                                         m_parts.front().length) <=
+                                 m_offset) {
+    m_parts.pop_front();
+  }
+
+  if (m_parts.empty()) {
+    m_sequential_reads = 0;
+  }
+
   return m_offset;
 }
 
@@ -510,11 +683,104 @@ off64_t Object::Reader::tell() const {
 }
 
 ssize_t Object::Reader::read(void *buffer, size_t length) {
-  const size_t first = m_offset;
-  const size_t last_unbounded = m_offset + length - 1;
+  if (0 == length || m_offset >= static_cast<off64_t>(m_size)) return 0;
+
+  // the first read after object was opened or after a seek is executed
+  // directly, this avoids fetching the whole ranges if object is accessed
+  // randomly
+  if (m_parts.empty() && (0 == m_sequential_reads++ || !read_ahead())) {
+    const auto read = pread(buffer, length, m_offset);
+    m_offset += read;
+    return read;
+  }
+
+  schedule_parts();
+
+  auto cbuffer = static_cast<char *>(buffer);
+  ssize_t total = 0;
+
+  while (length > 0 && !m_parts.empty()) {
+    auto &part = m_parts.front();
+
+    if (part.fetched.valid()) {
+      try {
+        part.data.resize(part.fetched.get());
+      } catch (...) {
+        clear_parts();
+        throw;
+      }
+    }
+
+    const std::size_t skip = m_offset - part.offset;
+
+    if (skip >= part.data.size()) {
+      if (part.data.size() < part.length) {
+        // object is shorter than expected, following ranges are not valid
+        clear_parts();
+        break;
+      }
+
+      m_parts.pop_front();
+      schedule_parts();
+      continue;
+    }
+
+    const auto bytes = std::min(length, part.data.size() - skip);
+    ::memcpy(cbuffer, part.data.data() + skip, bytes);
+
+    cbuffer += bytes;
+    length -= bytes;
+    total += bytes;
+    m_offset += bytes;
+  }
+
+  return total;
+}
+
+bool Object::Reader::read_ahead() const {
+  const auto &config = m_object->m_container->config();
+  return config->read_concurrency() > 1 && m_size > config->read_part_size();
+}
+
+void Object::Reader::schedule_parts() {
+  const auto &config = m_object->m_container->config();
+  const off64_t fsize = m_size;
+
+  if (m_parts.empty()) {
+    m_next_part = m_offset;
+  }
+
+  while (m_parts.size() < config->read_concurrency() && m_next_part < fsize) {
+    auto &part = m_parts.emplace_back();
+    part.offset = m_next_part;
+    part.length = std::min<std::size_t>(config->read_part_size(),
+                                        fsize - m_next_part);
+    part.data.resize(part.length);
+    // deque does not invalidate references to its elements when elements are
+    // added or removed at either end
+    part.fetched = mysqlshdk::utils::scoped_async(
+        [this, data = part.data.data(), length = part.length,
+         offset = part.offset]() {
+          return static_cast<std::size_t>(pread(data, length, offset));
+        });
+
+    m_next_part += part.length;
+  }
+}
+
+void Object::Reader::clear_parts() {
+  // futures wait for the requests which are still in progress
+  m_parts.clear();
+  m_next_part = m_offset;
+}
+
+ssize_t Object::Reader::pread(void *buffer, size_t length,
+                              off64_t offset) const {
+  const size_t first = offset;
+  const size_t last_unbounded = offset + length - 1;
   const off64_t fsize = m_size;
 
-  if (m_offset >= fsize) return 0;
+  if (offset >= fsize) return 0;
 
   const size_t last = std::min(m_size - 1, last_unbounded);
 
@@ -522,17 +788,12 @@ ssize_t Object::Reader::read(void *buffer, size_t length) {
   rest::Static_char_ref_buffer rbuffer(reinterpret_cast<char *>(buffer),
                                        length);
 
-  size_t read = 0;
   try {
-    read = m_object->m_container->get_object(m_object->full_path().real(),
+    return m_object->m_container->get_object(m_object->full_path().real(),
                                              &rbuffer, first, last);
   } catch (const rest::Response_error &error) {
     throw rest::to_exception(error);
   }
-
-  m_offset += read;
-
-  return read;
 }
 
 }  // namespace object_storage
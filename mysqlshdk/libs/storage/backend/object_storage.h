@@ -24,12 +24,16 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_H_
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_H_
 
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/threads.h"
 
 #include "mysqlshdk/libs/storage/backend/object_storage_bucket.h"
 
@@ -93,6 +97,9 @@ class Directory : public mysqlshdk::storage::IDirectory {
    * NOTE: This function emulates non recursive listing by returning ONLY those
    * object names that reside on the emulated directory but dont have / as part
    * of their name.
+   *
+   * Names of the listed objects are cached, subsequent listings use them to
+   * split the range of names into shards which are listed concurrently.
    */
   std::unordered_set<File_info> list_files(
       bool hidden_files = false) const override;
@@ -111,6 +118,11 @@ class Directory : public mysqlshdk::storage::IDirectory {
 
   bool is_local() const override { return false; }
 
+  /**
+   * Aborts multipart uploads of objects in this directory.
+   */
+  void remove_incomplete_files() override;
+
  protected:
   std::string m_name;
   std::string m_prefix;
@@ -122,7 +134,17 @@ class Directory : public mysqlshdk::storage::IDirectory {
                         const std::string &b) const override;
 
  private:
+  struct Listing_cache {
+    std::mutex mutex;
+    // sorted names of objects found in the last listing
+    std::vector<std::string> names;
+  };
+
   std::unordered_set<IDirectory::File_info> list_multipart_uploads() const;
+
+  std::vector<Object_details> list_objects() const;
+
+  std::unique_ptr<Listing_cache> m_listing_cache;
 };
 
 /**
@@ -232,6 +254,15 @@ class Object : public mysqlshdk::storage::IFile {
    */
   ssize_t read(void *buffer, size_t length) override;
 
+  /**
+   * Fetches up to length bytes starting at the given offset using a ranged
+   * request. Internal offset is not modified, each thread uses its own
+   * connection, so the same handle can be shared by multiple threads.
+   */
+  ssize_t pread(void *buffer, size_t length, off64_t offset) override;
+
+  bool supports_pread() const override { return true; }
+
   /**
    * Appends data into the object.
    *
@@ -289,6 +320,9 @@ class Object : public mysqlshdk::storage::IFile {
 
   /**
    * Handler for write operations on an Object
+   *
+   * Parts of a multipart upload are uploaded in the background, writer waits
+   * only if the maximum number of parts is already being uploaded.
    */
   class Writer : public File_handler {
    public:
@@ -301,19 +335,35 @@ class Object : public mysqlshdk::storage::IFile {
     void close();
 
    private:
+    struct Pending_part {
+      std::string data;
+      mysqlshdk::utils::Scoped_future<Multipart_object_part> uploaded;
+    };
+
     void reset();
 
     void abort_multipart_upload(const char *context,
                                 const std::string &error = {});
 
+    void upload_part(std::string data);
+
+    void wait_for_uploads(std::size_t max_pending);
+
     std::string m_buffer;
     bool m_is_multipart;
     Multipart_object m_multipart;
+    // parts which were uploaded, in order
     std::vector<Multipart_object_part> m_parts;
+    // parts which are being uploaded, in order, declared last, so that they
+    // are waited for before the rest of the members is destroyed
+    std::deque<Pending_part> m_pending;
   };
 
   /**
    * Handler for read operations on an Object
+   *
+   * Once the object is read sequentially, the following ranges are fetched
+   * in advance, using multiple concurrent requests.
    */
   class Reader : public File_handler {
    public:
@@ -323,9 +373,30 @@ class Object : public mysqlshdk::storage::IFile {
     off64_t seek(off64_t offset);
     off64_t tell() const;
     ssize_t read(void *buffer, size_t length);
+    ssize_t pread(void *buffer, size_t length, off64_t offset) const;
 
    private:
+    struct Part {
+      off64_t offset;
+      std::size_t length;
+      std::string data;
+      // valid until the contents are fetched
+      mysqlshdk::utils::Scoped_future<std::size_t> fetched;
+    };
+
+    bool read_ahead() const;
+
+    void schedule_parts();
+
+    void clear_parts();
+
     off64_t m_offset;
+    // number of consecutive reads since the object was opened or last seek
+    std::size_t m_sequential_reads = 0;
+    // consecutive ranges which follow (and include) the current offset
+    std::deque<Part> m_parts;
+    // offset of the next range to be fetched
+    off64_t m_next_part = 0;
   };
 
   std::unique_ptr<Writer> m_writer;
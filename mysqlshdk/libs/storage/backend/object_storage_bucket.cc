@@ -23,12 +23,18 @@
 
 #include "mysqlshdk/libs/storage/backend/object_storage_bucket.h"
 
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <future>
 #include <memory>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "mysqlshdk/libs/utils/fault_injection.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlshdk {
 namespace storage {
@@ -43,6 +49,8 @@ namespace {
 
 constexpr size_t MAX_LIST_OBJECTS_LIMIT = 1000;
 
+constexpr size_t MAX_CONCURRENT_REQUESTS = 16;
+
 FI_DEFINE(os_bucket, ([](const mysqlshdk::utils::FI::Args &args) {
             throw Response_error(
                 static_cast<Response::Status_code>(args.get_int("code")),
@@ -59,6 +67,22 @@ std::vector<Object_details> Container::list_objects(
     const std::string &prefix, size_t limit, bool recursive,
     const Object_details::Fields_mask &fields,
     std::unordered_set<std::string> *out_prefixes) {
+  return list_objects(prefix, limit, recursive, fields, out_prefixes, {}, {});
+}
+
+std::vector<Object_details> Container::list_objects_range(
+    const std::string &prefix, const std::string &start_after,
+    const std::string &last, bool recursive,
+    const Object_details::Fields_mask &fields) {
+  return list_objects(prefix, 0, recursive, fields, nullptr, start_after,
+                      last);
+}
+
+std::vector<Object_details> Container::list_objects(
+    const std::string &prefix, size_t limit, bool recursive,
+    const Object_details::Fields_mask &fields,
+    std::unordered_set<std::string> *out_prefixes,
+    const std::string &start_after, const std::string &last) {
   bool done = false;
   std::vector<Object_details> result;
   std::string next_start;
@@ -70,7 +94,7 @@ std::vector<Object_details> Container::list_objects(
     // limit request
     auto request = list_objects_request(
         prefix, remaining < MAX_LIST_OBJECTS_LIMIT ? remaining : 0, recursive,
-        fields, next_start);
+        fields, next_start, start_after);
     rest::String_response response;
 
     try {
@@ -87,6 +111,30 @@ std::vector<Object_details> Container::list_objects(
       auto list =
           parse_list_objects(response.buffer, &next_start, out_prefixes);
 
+      if (!start_after.empty() && !has_list_objects_after()) {
+        // names are sorted, skip the ones which precede the range
+        list.erase(list.begin(),
+                   std::upper_bound(list.begin(), list.end(), start_after,
+                                    [](const std::string &name,
+                                       const Object_details &object) {
+                                      return name < object.name;
+                                    }));
+      }
+
+      if (!last.empty()) {
+        const auto end = std::upper_bound(
+            list.begin(), list.end(), last,
+            [](const std::string &name, const Object_details &object) {
+              return name < object.name;
+            });
+
+        if (list.end() != end) {
+          // the rest of objects is out of range
+          list.erase(end, list.end());
+          next_start.clear();
+        }
+      }
+
       if (remaining) {
         remaining -= result.size();
       }
@@ -138,6 +186,55 @@ void Container::delete_object(const std::string &object_name) {
   }
 }
 
+std::vector<size_t> Container::head_objects(
+    const std::vector<std::string> &names) {
+  std::vector<size_t> sizes(names.size());
+
+  execute_concurrently(
+      names.size(),
+      [this, &names](std::size_t i) {
+        auto request = head_object_request(names[i]);
+        request.type = rest::Type::HEAD;
+        return request;
+      },
+      [&sizes](std::size_t i, const Response &response) {
+        sizes[i] = response.content_length();
+      },
+      [this, &names, &sizes](std::size_t i) {
+        sizes[i] = head_object(names[i]);
+      });
+
+  return sizes;
+}
+
+void Container::delete_objects(const std::vector<std::string> &names) {
+  execute_concurrently(
+      names.size(),
+      [this, &names](std::size_t i) {
+        auto request = delete_object_request(names[i]);
+        request.type = rest::Type::DELETE;
+        return request;
+      },
+      [](std::size_t, const Response &) {},
+      [this, &names](std::size_t i) { delete_object(names[i]); });
+}
+
+std::size_t Container::delete_all_objects(const std::string &prefix) {
+  std::vector<std::string> names;
+
+  for (auto &object : list_objects(prefix, 0, true, Object_details::NAME)) {
+    names.emplace_back(std::move(object.name));
+  }
+
+  if (!names.empty()) {
+    delete_objects(names);
+  }
+
+  abort_multipart_uploads(prefix);
+
+  return names.size();
+}
+
 void Container::rename_object(const std::string &src_name,
                               const std::string &new_name) {
   try {
@@ -382,21 +479,106 @@ void Container::abort_multipart_upload(const Multipart_object &object) {
   }
 }
 
+std::size_t Container::abort_multipart_uploads(const std::string &prefix) {
+  std::size_t aborted = 0;
+
+  for (const auto &upload : list_multipart_uploads()) {
+    if (shcore::str_beginswith(upload.name, prefix)) {
+      abort_multipart_upload(upload);
+      ++aborted;
+    }
+  }
+
+  return aborted;
+}
+
+void Container::execute_concurrently(
+    std::size_t count,
+    const std::function<rest::Signed_request(std::size_t)> &make_request,
+    const std::function<void(std::size_t, const rest::Response &)> &on_success,
+    const std::function<void(std::size_t)> &fallback) {
+  struct In_flight {
+    In_flight(std::size_t i, rest::Signed_request r)
+        : index(i), request(std::move(r)) {}
+
+    std::size_t index;
+    rest::Signed_request request;
+    rest::String_response response;
+    std::future<Response::Status_code> status;
+  };
+
+  // request and response need to have stable addresses, deque does not move
+  // its elements when adding to the back and removing from the front
+  std::deque<In_flight> in_flight;
+  std::size_t next = 0;
+
+  const auto finish_first = [&]() {
+    auto &first = in_flight.front();
+    bool succeeded = false;
+
+    try {
+      first.status.get();
+      succeeded = !first.response.get_error().has_value();
+    } catch (const std::exception &e) {
+      log_debug2("Asynchronous request failed, retrying: %s", e.what());
+    }
+
+    if (succeeded) {
+      on_success(first.index, first.response);
+    } else {
+      // retry strategy and error handling of synchronous requests is used
+      fallback(first.index);
+    }
+
+    in_flight.pop_front();
+  };
+
+  try {
+    while (next < count || !in_flight.empty()) {
+      while (next < count && in_flight.size() < MAX_CONCURRENT_REQUESTS) {
+        auto &t = in_flight.emplace_back(next, make_request(next));
+        ++next;
+
+        try {
+          t.status =
+              ensure_connection()->execute_async(&t.request, &t.response);
+        } catch (const std::exception &e) {
+          log_debug2("Failed to start an asynchronous request: %s", e.what());
+          in_flight.pop_back();
+          fallback(next - 1);
+        }
+      }
+
+      if (!in_flight.empty()) {
+        finish_first();
+      }
+    }
+  } catch (...) {
+    // requests which are in flight refer to the data held here
+    for (auto &t : in_flight) {
+      if (t.status.valid()) {
+        t.status.wait();
+      }
+    }
+
+    throw;
+  }
+}
+
 rest::Signed_rest_service *Container::ensure_connection() {
+  // each thread uses its own REST service, this allows the same instance to be
+  // used concurrently by multiple threads (i.e. positional reads)
   static thread_local std::unordered_map<
       std::string, std::pair<std::unique_ptr<rest::Signed_rest_service>,
                              Config_ptr::weak_type>>
       services;
 
-  // need to detect when this instance was passed to another thread and replace
-  // the REST service, or we may end up sharing it across multiple threads
-  const auto current_thread = std::this_thread::get_id();
+  auto &service = services[m_config->hash()];
 
-  if (current_thread != m_rest_service_thread) {
-    m_rest_service = nullptr;
-  }
+  if (!service.first || service.second.expired()) {
+    service = std::make_pair(
+        std::make_unique<rest::Signed_rest_service>(*m_config), m_config);
 
-  if (!m_rest_service) {
     // remove stale instances
     for (auto it = services.begin(); it != services.end();) {
       if (it->second.second.expired()) {
@@ -405,19 +587,9 @@ rest::Signed_rest_service *Container::ensure_connection() {
         ++it;
       }
     }
-
-    auto &service = services[m_config->hash()];
-
-    if (!service.first) {
-      service = std::make_pair(
-          std::make_unique<rest::Signed_rest_service>(*m_config), m_config);
-    }
-
-    m_rest_service = service.first.get();
-    m_rest_service_thread = current_thread;
   }
 
-  return m_rest_service;
+  return service.first.get();
 }
 
 }  // namespace object_storage
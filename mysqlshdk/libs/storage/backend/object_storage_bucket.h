@@ -24,6 +24,7 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_BUCKET_H_
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_BUCKET_H_
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <thread>
@@ -95,6 +96,31 @@ class Container {
       const Object_details::Fields_mask &fields = Object_details::NAME_SIZE,
       std::unordered_set<std::string> *out_prefixes = nullptr);
 
+  /**
+   * Lists objects which belong to the given range of names.
+   *
+   * @param prefix: List only objects with the specified prefix.
+   * @param start_after: If not empty, list only objects with names greater
+   *                     than this one.
+   * @param last: If not empty, list only objects with names less than or equal
+   *              to this one.
+   * @param recursive: Recurse into subdirectories.
+   * @param fields: Fields to fetch.
+   *
+   * @returns A list of objects, sorted by name.
+   */
+  std::vector<Object_details> list_objects_range(
+      const std::string &prefix, const std::string &start_after,
+      const std::string &last, bool recursive = true,
+      const Object_details::Fields_mask &fields = Object_details::NAME_SIZE);
+
+  /**
+   * Determines whether the backend is able to start the listing after the
+   * given name. If not, listing of a range of names fetches all objects which
+   * precede this range.
+   */
+  virtual bool has_list_objects_after() const { return true; }
+
   /**
    * Retrieves basic information from an object in the bucket.
    *
@@ -116,6 +142,39 @@ class Container {
    */
   void delete_object(const std::string &object_name);
 
+  /**
+   * Retrieves sizes of multiple objects, executing the requests concurrently.
+   *
+   * @param names: the names of the objects.
+   *
+   * @returns Sizes of the objects, in the same order as names.
+   *
+   * @throws Response_error if any of the objects does not exist.
+   */
+  std::vector<size_t> head_objects(const std::vector<std::string> &names);
+
+  /**
+   * Deletes multiple objects from the bucket, by default the requests are
+   * executed concurrently.
+   *
+   * @param names: the names of the objects to be deleted.
+   *
+   * @throws Response_error if any of the objects does not exist.
+   */
+  virtual void delete_objects(const std::vector<std::string> &names);
+
+  /**
+   * Deletes all objects whose names start with the given prefix, and aborts
+   * multipart uploads of such objects. Objects are removed using
+   * delete_objects(), so backends which support bulk deletion remove many
+   * objects with a single request.
+   *
+   * @param prefix: Prefix of the names, if empty whole bucket is cleared.
+   *
+   * @returns Number of deleted objects.
+   */
+  std::size_t delete_all_objects(const std::string &prefix = "");
+
   /**
    * Determines whether the object renaming is allowed.
    */
@@ -236,6 +295,16 @@ class Container {
    */
   virtual void abort_multipart_upload(const Multipart_object &object);
 
+  /**
+   * Aborts multipart uploads of all objects whose names start with the given
+   * prefix.
+   *
+   * @param prefix: Prefix of the names, if empty all uploads are aborted.
+   *
+   * @returns Number of aborted uploads.
+   */
+  std::size_t abort_multipart_uploads(const std::string &prefix = "");
+
   /**
    * Provides configuration of this bucket;
    *
@@ -249,10 +318,24 @@ class Container {
   rest::Signed_rest_service *ensure_connection();
 
  private:
-  virtual rest::Signed_request list_objects_request(
+  std::vector<Object_details> list_objects(
       const std::string &prefix, size_t limit, bool recursive,
       const Object_details::Fields_mask &fields,
-      const std::string &start_from) = 0;
+      std::unordered_set<std::string> *out_prefixes,
+      const std::string &start_after, const std::string &last);
+
+  /**
+   * Creates the list request.
+   *
+   * @param start_from: Token used to fetch the next page of results.
+   * @param start_after: If not empty and start_from is empty, objects with
+   *                     names greater than this one are going to be listed.
+   *                     Ignored if has_list_objects_after() returns false.
+   */
+  virtual rest::Signed_request list_objects_request(
+      const std::string &prefix, size_t limit, bool recursive,
+      const Object_details::Fields_mask &fields, const std::string &start_from,
+      const std::string &start_after) = 0;
 
   virtual std::vector<Object_details> parse_list_objects(
       const rest::Base_response_buffer &buffer, std::string *next_start_from,
@@ -322,9 +405,24 @@ class Container {
   void handle_multipart_request(rest::Signed_request *request,
                                 rest::Response *response = nullptr);
 
+  /**
+   * Executes count requests asynchronously, keeping a limited number of them
+   * in flight. Requests which fail are repeated synchronously using the
+   * fallback, which applies the usual retry strategy and error handling.
+   *
+   * @param count Number of requests.
+   * @param make_request Creates the request with the given index.
+   * @param on_success Called with the response of a successful request.
+   * @param fallback Executes the request with the given index synchronously.
+   */
+  void execute_concurrently(
+      std::size_t count,
+      const std::function<rest::Signed_request(std::size_t)> &make_request,
+      const std::function<void(std::size_t, const rest::Response &)>
+          &on_success,
+      const std::function<void(std::size_t)> &fallback);
+
   Config_ptr m_config;
-  rest::Signed_rest_service *m_rest_service = nullptr;
-  std::thread::id m_rest_service_thread;
 };
 
 }  // namespace object_storage
@@ -24,6 +24,7 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_CONFIG_H_
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_CONFIG_H_
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <string>
@@ -41,6 +42,11 @@ class Object_storage_options;
 class Bucket_options;
 class Config : public storage::Config, public rest::Signed_rest_service_config {
  public:
+  static constexpr std::size_t DEFAULT_UPLOAD_CONCURRENCY = 2;
+  static constexpr std::size_t DEFAULT_READ_CONCURRENCY = 4;
+  // 4 MB
+  static constexpr std::size_t DEFAULT_READ_PART_SIZE = 4 * 1024 * 1024;
+
   Config() = delete;
 
   Config(const Config &) = delete;
@@ -58,6 +64,42 @@ class Config : public storage::Config, public rest::Signed_rest_service_config {
   std::size_t part_size() const { return m_part_size; }
   void set_part_size(std::size_t size) { m_part_size = size; }
 
+  /**
+   * Maximum number of multipart parts which are uploaded in the background
+   * while object is being written, 0 (default) uploads the parts
+   * synchronously. Each part being uploaded holds a buffer of part_size()
+   * bytes.
+   */
+  std::size_t upload_concurrency() const { return m_upload_concurrency; }
+  void set_upload_concurrency(std::size_t concurrency) {
+    m_upload_concurrency = concurrency;
+  }
+
+  /**
+   * Uploads the multipart parts in the background, using the default upload
+   * concurrency of this storage.
+   */
+  void enable_background_uploads() {
+    set_upload_concurrency(m_background_upload_concurrency);
+  }
+
+  /**
+   * Number of ranged requests which are executed concurrently when an object
+   * is read sequentially, 1 disables the read-ahead.
+   */
+  std::size_t read_concurrency() const { return m_read_concurrency; }
+  void set_read_concurrency(std::size_t concurrency) {
+    m_read_concurrency = std::max<std::size_t>(concurrency, 1);
+  }
+
+  /**
+   * Size of a single ranged request used by the read-ahead.
+   */
+  std::size_t read_part_size() const { return m_read_part_size; }
+  void set_read_part_size(std::size_t size) {
+    m_read_part_size = std::max<std::size_t>(size, 1);
+  }
+
   virtual const std::string &hash() const = 0;
 
   virtual std::unique_ptr<Container> container() const = 0;
@@ -68,6 +110,10 @@ class Config : public storage::Config, public rest::Signed_rest_service_config {
   std::string m_container_name;
   std::string m_config_file;
   std::size_t m_part_size;
+  std::size_t m_upload_concurrency = 0;
+  std::size_t m_background_upload_concurrency = DEFAULT_UPLOAD_CONCURRENCY;
+  std::size_t m_read_concurrency = DEFAULT_READ_CONCURRENCY;
+  std::size_t m_read_part_size = DEFAULT_READ_PART_SIZE;
 
  private:
   std::string describe_url(const std::string &url) const override;
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/backend/stdin_file.h"
+
+#include <cerrno>
+#include <cstdio>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+#include "mysqlshdk/libs/storage/idirectory.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+
+namespace {
+
+class Stdin_config final : public Config {
+ public:
+  Stdin_config() = default;
+
+  Stdin_config(const Stdin_config &) = delete;
+  Stdin_config(Stdin_config &&) = default;
+
+  Stdin_config &operator=(const Stdin_config &) = delete;
+  Stdin_config &operator=(Stdin_config &&) = default;
+
+  ~Stdin_config() override = default;
+
+  bool valid() const override { return true; }
+
+ private:
+  std::string describe_self() const override { return "standard input"; }
+
+  std::string describe_url(const std::string &) const override { return {}; }
+
+  std::unique_ptr<IFile> file(const std::string &) const override {
+    return std::make_unique<Stdin_file>();
+  }
+
+  std::unique_ptr<IDirectory> directory(const std::string &) const override {
+    throw std::logic_error("Stdin_config::directory() - not supported");
+  }
+};
+
+}  // namespace
+
+void Stdin_file::open(Mode m) {
+  if (Mode::READ != m) {
+    throw std::invalid_argument("Stdin_file: only READ mode is supported");
+  }
+
+#if defined(_WIN32)
+  _setmode(_fileno(stdin), _O_BINARY);
+#endif
+
+  m_open = true;
+}
+
+int Stdin_file::error() const { return std::ferror(stdin) ? errno : 0; }
+
+off64_t Stdin_file::seek(off64_t offset) {
+  if (offset != m_offset) {
+    throw std::logic_error("Stdin_file::seek() - not supported");
+  }
+
+  return m_offset;
+}
+
+ssize_t Stdin_file::read(void *buffer, size_t length) {
+  const auto bytes = std::fread(buffer, 1, length, stdin);
+
+  if (bytes < length && std::ferror(stdin)) {
+    return -1;
+  }
+
+  m_offset += bytes;
+  return bytes;
+}
+
+bool is_stdin(const std::string &path) { return "-" == path; }
+
+std::shared_ptr<Config> stdin_config() {
+  return std::make_shared<Stdin_config>();
+}
+
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
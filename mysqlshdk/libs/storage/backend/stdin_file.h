@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_STDIN_FILE_H_
+#define MYSQLSHDK_LIBS_STORAGE_BACKEND_STDIN_FILE_H_
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "mysqlshdk/libs/storage/config.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+
+/**
+ * Reads the data from the standard input of the process. Data can only be
+ * read sequentially, size of the data is not known in advance.
+ */
+class Stdin_file : public IFile {
+ public:
+  Stdin_file() = default;
+
+  Stdin_file(const Stdin_file &other) = delete;
+  Stdin_file(Stdin_file &&other) = default;
+
+  Stdin_file &operator=(const Stdin_file &other) = delete;
+  Stdin_file &operator=(Stdin_file &&other) = default;
+
+  ~Stdin_file() override = default;
+
+  void open(Mode m) override;
+
+  bool is_open() const override { return m_open; }
+
+  int error() const override;
+
+  void close() override { m_open = false; }
+
+  /**
+   * Size of the data is unknown, always returns 0.
+   */
+  size_t file_size() const override { return 0; }
+
+  Masked_string full_path() const override { return filename(); }
+
+  std::string filename() const override { return "stdin"; }
+
+  bool exists() const override { return true; }
+
+  std::unique_ptr<IDirectory> parent() const override {
+    throw std::logic_error("Stdin_file::parent() - not supported");
+  }
+
+  /**
+   * Only the current position is accepted.
+   */
+  off64_t seek(off64_t offset) override;
+
+  off64_t tell() const override { return m_offset; }
+
+  ssize_t read(void *buffer, size_t length) override;
+
+  ssize_t write(const void *, size_t) override {
+    throw std::logic_error("Stdin_file::write() - not supported");
+  }
+
+  bool flush() override {
+    throw std::logic_error("Stdin_file::flush() - not supported");
+  }
+
+  bool is_local() const override { return true; }
+
+  void rename(const std::string &) override {
+    throw std::logic_error("Stdin_file::rename() - not supported");
+  }
+
+  void remove() override {
+    throw std::logic_error("Stdin_file::remove() - not supported");
+  }
+
+ private:
+  bool m_open = false;
+  off64_t m_offset = 0;
+};
+
+/**
+ * Checks if the given path refers to the standard input ("-").
+ */
+bool is_stdin(const std::string &path);
+
+/**
+ * Creates configuration which provides the standard input, regardless of the
+ * requested path.
+ */
+std::shared_ptr<Config> stdin_config();
+
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_STORAGE_BACKEND_STDIN_FILE_H_
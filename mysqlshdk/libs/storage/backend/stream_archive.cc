@@ -0,0 +1,1052 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/backend/stream_archive.h"
+
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/storage/backend/in_memory/virtual_config.h"
+#include "mysqlshdk/libs/storage/backend/in_memory/virtual_directory.h"
+#include "mysqlshdk/libs/storage/backend/in_memory/virtual_file.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/storage/utils.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+
+namespace {
+
+constexpr auto k_scheme = "stream";
+
+constexpr std::string_view k_header{"MYSQLSH-STREAM-ARCHIVE\x01"};
+
+// size of a single record header: type, file ID, payload length
+constexpr std::size_t k_record_header_size = 9;
+
+// data of a file is buffered until it reaches this size
+constexpr std::size_t k_buffer_size = 256 * 1024;
+
+// size of a memory page used to hold the received files
+constexpr std::size_t k_page_size = 32 * 1024 * 1024;
+
+// received files which do not fit in this limit are moved to a scratch
+// directory
+constexpr std::size_t k_memory_limit = 512 * 1024 * 1024;
+
+// name of the in-memory directory which holds the received files
+constexpr auto k_directory_name = "stream";
+
+// path which refers to the standard input or output
+constexpr std::string_view k_standard_stream{"-"};
+
+enum class Record : uint8_t {
+  OPEN = 1,
+  DATA = 2,
+  CLOSE = 3,
+  RENAME = 4,
+  REMOVE = 5,
+  END = 6,
+};
+
+void encode(uint32_t value, char *out) {
+  out[0] = static_cast<char>((value >> 24) & 0xFF);
+  out[1] = static_cast<char>((value >> 16) & 0xFF);
+  out[2] = static_cast<char>((value >> 8) & 0xFF);
+  out[3] = static_cast<char>(value & 0xFF);
+}
+
+uint32_t decode(const char *in) {
+  const auto byte = [in](int i) {
+    return static_cast<uint32_t>(static_cast<unsigned char>(in[i]));
+  };
+
+  return (byte(0) << 24) | (byte(1) << 16) | (byte(2) << 8) | byte(3);
+}
+
+std::string archive_path(const std::string &url) {
+  auto path = utils::strip_scheme(url, k_scheme);
+
+  if (path.empty()) {
+    throw std::invalid_argument("The path of the stream archive '" + url +
+                                "' cannot be empty.");
+  }
+
+  return path;
+}
+
+#ifndef _WIN32
+
+/**
+ * Standard input or output used as a stream archive. While the archive is
+ * written to the standard output, messages of the shell are written to the
+ * standard error.
+ */
+class Standard_stream final : public IFile {
+ public:
+  explicit Standard_stream(bool output) : m_output(output) {}
+
+  Standard_stream(const Standard_stream &) = delete;
+  Standard_stream(Standard_stream &&) = delete;
+
+  Standard_stream &operator=(const Standard_stream &) = delete;
+  Standard_stream &operator=(Standard_stream &&) = delete;
+
+  ~Standard_stream() override {
+    if (is_open()) {
+      close();
+    }
+  }
+
+  void open(Mode m) override {
+    assert(!is_open());
+
+    if ((Mode::READ == m) == m_output) {
+      throw std::logic_error("Standard_stream::open() - invalid mode");
+    }
+
+    const auto fd = m_output ? STDOUT_FILENO : STDIN_FILENO;
+
+    if (isatty(fd)) {
+      throw std::runtime_error("The " + filename() +
+                               " of a terminal cannot be used as a stream "
+                               "archive");
+    }
+
+    if (!m_output) {
+      m_fd = fd;
+      return;
+    }
+
+    flush_stdout();
+
+    m_fd = ::dup(STDOUT_FILENO);
+
+    if (m_fd < 0) {
+      throw std::runtime_error("Failed to duplicate the standard output: " +
+                               shcore::errno_to_string(errno));
+    }
+
+    if (::dup2(STDERR_FILENO, STDOUT_FILENO) < 0) {
+      const auto error = errno;
+      ::close(std::exchange(m_fd, -1));
+      throw std::runtime_error("Failed to redirect the standard output: " +
+                               shcore::errno_to_string(error));
+    }
+  }
+
+  bool is_open() const override { return m_fd >= 0; }
+
+  int error() const override { return 0; }
+
+  void close() override {
+    assert(is_open());
+
+    if (m_output) {
+      flush_stdout();
+      ::dup2(m_fd, STDOUT_FILENO);
+      ::close(m_fd);
+    }
+
+    m_fd = -1;
+  }
+
+  size_t file_size() const override {
+    throw std::logic_error("Standard_stream::file_size() - not supported");
+  }
+
+  Masked_string full_path() const override { return filename(); }
+
+  std::string filename() const override {
+    return m_output ? "standard output" : "standard input";
+  }
+
+  bool exists() const override { return true; }
+
+  std::unique_ptr<IDirectory> parent() const override { return {}; }
+
+  off64_t seek(off64_t) override {
+    throw std::logic_error("Standard_stream::seek() - not supported");
+  }
+
+  off64_t tell() const override { return m_offset; }
+
+  ssize_t read(void *buffer, size_t length) override {
+    assert(is_open());
+
+    ssize_t bytes;
+
+    do {
+      bytes = ::read(m_fd, buffer, length);
+    } while (bytes < 0 && EINTR == errno);
+
+    if (bytes > 0) {
+      m_offset += bytes;
+    }
+
+    return bytes;
+  }
+
+  ssize_t write(const void *buffer, size_t length) override {
+    assert(is_open());
+
+    auto data = static_cast<const char *>(buffer);
+    auto remaining = length;
+
+    while (remaining > 0) {
+      const auto bytes = ::write(m_fd, data, remaining);
+
+      if (bytes < 0) {
+        if (EINTR == errno) {
+          continue;
+        }
+
+        return bytes;
+      }
+
+      data += bytes;
+      remaining -= bytes;
+    }
+
+    m_offset += length;
+
+    return length;
+  }
+
+  bool flush() override { return true; }
+
+  bool is_local() const override { return true; }
+
+  void rename(const std::string &) override {
+    throw std::logic_error("Standard_stream::rename() - not supported");
+  }
+
+  void remove() override {
+    throw std::logic_error("Standard_stream::remove() - not supported");
+  }
+
+ private:
+  static void flush_stdout() {
+    std::cout.flush();
+    fflush(stdout);
+  }
+
+  const bool m_output;
+  int m_fd = -1;
+  off64_t m_offset = 0;
+};
+
+#endif  // !_WIN32
+
+/**
+ * Opens the file which holds the stream archive.
+ *
+ * @param path Path to the file, or "-" to use the standard stream.
+ * @param output Whether archive is written.
+ */
+std::unique_ptr<IFile> archive_file(const std::string &path, bool output) {
+  if (k_standard_stream == path) {
+#ifdef _WIN32
+    (void)output;
+    throw std::invalid_argument(
+        "Standard streams cannot be used as a stream archive on Windows.");
+#else
+    return std::make_unique<Standard_stream>(output);
+#endif
+  }
+
+  return make_file(path);
+}
+
+/**
+ * Data files are read by the loader only once, other files (metadata, index
+ * files, compression dictionaries) are kept, as the loader checks whether
+ * they exist while the dump is still being received.
+ */
+bool is_read_once(const std::string &name) {
+  for (const auto extension : {".json", ".sql", ".idx", ".zdict"}) {
+    if (shcore::str_endswith(name, extension)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Serializes records of all files into a single stream.
+ */
+class Archive_writer final {
+ public:
+  explicit Archive_writer(std::string url)
+      : m_url(std::move(url)), m_path(archive_path(m_url)) {}
+
+  Archive_writer(const Archive_writer &) = delete;
+  Archive_writer(Archive_writer &&) = delete;
+
+  Archive_writer &operator=(const Archive_writer &) = delete;
+  Archive_writer &operator=(Archive_writer &&) = delete;
+
+  ~Archive_writer() {
+    try {
+      finish();
+    } catch (const std::exception &e) {
+      log_error("Failed to finish the stream archive %s: %s", m_url.c_str(),
+                e.what());
+    }
+  }
+
+  const std::string &url() const { return m_url; }
+
+  bool started() const {
+    std::lock_guard lock{m_mutex};
+    return !!m_sink;
+  }
+
+  void start() {
+    std::lock_guard lock{m_mutex};
+
+    if (m_sink) {
+      throw std::runtime_error("The stream archive " + m_url +
+                               " has already been started");
+    }
+
+    m_sink = archive_file(m_path, true);
+    m_sink->open(Mode::WRITE);
+
+    write_raw(k_header.data(), k_header.size());
+  }
+
+  void finish() {
+    std::lock_guard lock{m_mutex};
+
+    if (!m_sink || m_finished) {
+      return;
+    }
+
+    write_record(Record::END, 0, nullptr, 0);
+    m_sink->close();
+
+    m_finished = true;
+  }
+
+  uint32_t open(const std::string &name) {
+    std::lock_guard lock{m_mutex};
+
+    const auto id = ++m_last_id;
+    write_record(Record::OPEN, id, name.c_str(), name.length());
+
+    return id;
+  }
+
+  void write(uint32_t id, const char *data, std::size_t length) {
+    std::lock_guard lock{m_mutex};
+
+    while (length > 0) {
+      const auto size = std::min(length, k_buffer_size);
+
+      write_record(Record::DATA, id, data, size);
+
+      data += size;
+      length -= size;
+    }
+  }
+
+  void close(uint32_t id, const std::string &name, std::size_t size) {
+    std::lock_guard lock{m_mutex};
+
+    write_record(Record::CLOSE, id, nullptr, 0);
+    m_files[name] = size;
+  }
+
+  void rename(uint32_t id, const std::string &old_name,
+              const std::string &new_name) {
+    std::lock_guard lock{m_mutex};
+
+    write_record(Record::RENAME, id, new_name.c_str(), new_name.length());
+
+    if (auto node = m_files.extract(old_name)) {
+      node.key() = new_name;
+      m_files.insert(std::move(node));
+    }
+  }
+
+  void remove(uint32_t id, const std::string &name) {
+    std::lock_guard lock{m_mutex};
+
+    write_record(Record::REMOVE, id, nullptr, 0);
+    m_files.erase(name);
+  }
+
+  std::optional<std::size_t> size(const std::string &name) const {
+    std::lock_guard lock{m_mutex};
+
+    if (const auto it = m_files.find(name); m_files.end() != it) {
+      return it->second;
+    }
+
+    return {};
+  }
+
+  std::unordered_set<IDirectory::File_info> list_files(
+      const std::string &pattern) const {
+    std::lock_guard lock{m_mutex};
+    std::unordered_set<IDirectory::File_info> result;
+
+    for (const auto &file : m_files) {
+      if (pattern.empty() || shcore::match_glob(pattern, file.first)) {
+        result.emplace(file.first, file.second);
+      }
+    }
+
+    return result;
+  }
+
+ private:
+  void write_record(Record type, uint32_t id, const char *data,
+                    std::size_t length) {
+    if (!m_sink || m_finished) {
+      throw std::runtime_error("The stream archive " + m_url +
+                               " is not open for writing");
+    }
+
+    char header[k_record_header_size];
+
+    header[0] = static_cast<char>(type);
+    encode(id, header + 1);
+    encode(static_cast<uint32_t>(length), header + 5);
+
+    write_raw(header, k_record_header_size);
+
+    if (length) {
+      write_raw(data, length);
+    }
+  }
+
+  void write_raw(const char *data, std::size_t length) {
+    if (m_sink->write(data, length) != static_cast<ssize_t>(length)) {
+      throw std::runtime_error("Failed to write to the stream archive " +
+                               m_url + ": " + shcore::errno_to_string(errno));
+    }
+  }
+
+  std::string m_url;
+  std::string m_path;
+  std::unique_ptr<IFile> m_sink;
+  bool m_finished = false;
+  uint32_t m_last_id = 0;
+  // closed files and their sizes
+  std::unordered_map<std::string, std::size_t> m_files;
+  mutable std::mutex m_mutex;
+};
+
+class Archive_writer_directory;
+
+/**
+ * File which is written to the stream archive. Data is buffered and sent to
+ * the stream in records of limited size.
+ */
+class Archive_writer_file final : public IFile {
+ public:
+  Archive_writer_file(std::string name, std::shared_ptr<Archive_writer> writer)
+      : m_name(std::move(name)), m_writer(std::move(writer)) {}
+
+  Archive_writer_file(const Archive_writer_file &) = delete;
+  Archive_writer_file(Archive_writer_file &&) = delete;
+
+  Archive_writer_file &operator=(const Archive_writer_file &) = delete;
+  Archive_writer_file &operator=(Archive_writer_file &&) = delete;
+
+  ~Archive_writer_file() override {
+    if (is_open()) {
+      try {
+        close();
+      } catch (const std::exception &e) {
+        log_error("Failed to close %s: %s", full_path().masked().c_str(),
+                  e.what());
+      }
+    }
+  }
+
+  void open(Mode m) override {
+    assert(!is_open());
+
+    if (Mode::READ == m) {
+      throw std::runtime_error("Failed to open file " + full_path().masked() +
+                               " for reading, stream archive is write-only");
+    }
+
+    if (m_id || exists()) {
+      throw std::runtime_error("Failed to open file " + full_path().masked() +
+                               ", files in stream archive cannot be reopened");
+    }
+
+    m_id = m_writer->open(m_name);
+    m_open = true;
+  }
+
+  bool is_open() const override { return m_open; }
+
+  int error() const override { return 0; }
+
+  void close() override {
+    assert(is_open());
+
+    flush_buffer();
+    m_writer->close(m_id, m_name, m_offset);
+    m_open = false;
+  }
+
+  size_t file_size() const override {
+    if (is_open()) {
+      return m_offset;
+    }
+
+    if (const auto size = m_writer->size(m_name)) {
+      return *size;
+    }
+
+    throw std::runtime_error("Failed to get the file size of " +
+                             full_path().masked() + ", it does not exist");
+  }
+
+  Masked_string full_path() const override {
+    return m_writer->url() + '/' + m_name;
+  }
+
+  std::string filename() const override { return m_name; }
+
+  bool exists() const override { return m_writer->size(m_name).has_value(); }
+
+  std::unique_ptr<IDirectory> parent() const override;
+
+  off64_t seek(off64_t offset) override {
+    if (offset != tell()) {
+      throw std::logic_error("Stream archive files are not seekable");
+    }
+
+    return offset;
+  }
+
+  off64_t tell() const override {
+    assert(is_open());
+    return m_offset;
+  }
+
+  ssize_t read(void *, size_t) override {
+    throw std::logic_error("Stream archive files cannot be read");
+  }
+
+  ssize_t write(const void *buffer, size_t length) override {
+    assert(is_open());
+
+    m_buffer.append(static_cast<const char *>(buffer), length);
+    m_offset += length;
+
+    if (m_buffer.size() >= k_buffer_size) {
+      flush_buffer();
+    }
+
+    return length;
+  }
+
+  bool flush() override {
+    assert(is_open());
+
+    flush_buffer();
+
+    return true;
+  }
+
+  bool is_local() const override { return false; }
+
+  void rename(const std::string &new_name) override {
+    if (m_id) {
+      m_writer->rename(m_id, m_name, new_name);
+    }
+
+    m_name = new_name;
+  }
+
+  void remove() override {
+    if (m_id) {
+      m_writer->remove(m_id, m_name);
+    }
+  }
+
+ private:
+  void flush_buffer() {
+    if (!m_buffer.empty()) {
+      m_writer->write(m_id, m_buffer.data(), m_buffer.size());
+      m_buffer.clear();
+    }
+  }
+
+  std::string m_name;
+  std::shared_ptr<Archive_writer> m_writer;
+  uint32_t m_id = 0;
+  bool m_open = false;
+  std::size_t m_offset = 0;
+  std::string m_buffer;
+};
+
+/**
+ * Directory which is written to the stream archive. Directory which created
+ * the archive terminates the stream when it's destroyed.
+ */
+class Archive_writer_directory final : public IDirectory {
+ public:
+  explicit Archive_writer_directory(std::shared_ptr<Archive_writer> writer)
+      : m_writer(std::move(writer)) {}
+
+  Archive_writer_directory(const Archive_writer_directory &) = delete;
+  Archive_writer_directory(Archive_writer_directory &&) = default;
+
+  Archive_writer_directory &operator=(const Archive_writer_directory &) =
+      delete;
+  Archive_writer_directory &operator=(Archive_writer_directory &&) = default;
+
+  ~Archive_writer_directory() override {
+    if (m_created) {
+      try {
+        m_writer->finish();
+      } catch (const std::exception &e) {
+        log_error("Failed to finish the stream archive %s: %s",
+                  m_writer->url().c_str(), e.what());
+      }
+    }
+  }
+
+  bool exists() const override { return m_writer->started(); }
+
+  void create() override {
+    m_writer->start();
+    m_created = true;
+  }
+
+  Masked_string full_path() const override { return m_writer->url(); }
+
+  std::unordered_set<File_info> list_files(bool) const override {
+    return m_writer->list_files({});
+  }
+
+  std::unordered_set<File_info> filter_files(
+      const std::string &pattern) const override {
+    return m_writer->list_files(pattern);
+  }
+
+  std::unique_ptr<IFile> file(const std::string &name,
+                              const File_options &) const override {
+    return std::make_unique<Archive_writer_file>(name, m_writer);
+  }
+
+  bool is_local() const override { return false; }
+
+  std::string join_path(const std::string &a,
+                        const std::string &b) const override {
+    return a + '/' + b;
+  }
+
+ private:
+  std::shared_ptr<Archive_writer> m_writer;
+  bool m_created = false;
+};
+
+std::unique_ptr<IDirectory> Archive_writer_file::parent() const {
+  return std::make_unique<Archive_writer_directory>(m_writer);
+}
+
+class Archive_writer_config final : public Config {
+ public:
+  explicit Archive_writer_config(const std::string &url)
+      : m_writer(std::make_shared<Archive_writer>(url)) {}
+
+  Archive_writer_config(const Archive_writer_config &) = delete;
+  Archive_writer_config(Archive_writer_config &&) = default;
+
+  Archive_writer_config &operator=(const Archive_writer_config &) = delete;
+  Archive_writer_config &operator=(Archive_writer_config &&) = default;
+
+  ~Archive_writer_config() override = default;
+
+  bool valid() const override { return true; }
+
+ private:
+  std::string describe_self() const override {
+    return "stream archive " + m_writer->url();
+  }
+
+  std::string describe_url(const std::string &) const override { return {}; }
+
+  std::unique_ptr<IFile> file(const std::string &) const override {
+    throw std::invalid_argument(
+        "Stream archive can only be used as an output directory.");
+  }
+
+  std::unique_ptr<IDirectory> directory(const std::string &) const override {
+    return std::make_unique<Archive_writer_directory>(m_writer);
+  }
+
+  std::shared_ptr<Archive_writer> m_writer;
+};
+
+/**
+ * Reads the stream archive in a background thread and stores the received
+ * files in the in-memory file system. Once memory limit is reached, files are
+ * moved to a scratch directory. Data files are removed once they are read.
+ */
+class Archive_reader final {
+ public:
+  explicit Archive_reader(std::string url)
+      : m_url(std::move(url)),
+        m_path(archive_path(m_url)),
+        m_config(std::make_shared<in_memory::Virtual_config>(k_page_size)) {
+    // scratch directory is removed along with the virtual FS
+    const auto suffix =
+        shcore::get_random_string(8, "abcdefghijklmnopqrstuvwxyz0123456789");
+    m_config->fs()->set_memory_limit(
+        k_memory_limit, shcore::path::join_path(shcore::path::tmpdir(),
+                                                "mysqlsh-stream-" + suffix));
+    m_dir = m_config->fs()->create_directory(k_directory_name);
+  }
+
+  Archive_reader(const Archive_reader &) = delete;
+  Archive_reader(Archive_reader &&) = delete;
+
+  Archive_reader &operator=(const Archive_reader &) = delete;
+  Archive_reader &operator=(Archive_reader &&) = delete;
+
+  ~Archive_reader() = default;
+
+  static std::shared_ptr<Archive_reader> create(std::string url) {
+    auto reader = std::make_shared<Archive_reader>(std::move(url));
+
+    // thread holds a reference to the reader, as reads from a pipe cannot be
+    // interrupted, if the stream is abandoned the thread is detached
+    mysqlsh::spawn_scoped_thread([reader]() { reader->run(); }).detach();
+
+    return reader;
+  }
+
+  const std::string &url() const { return m_url; }
+
+  in_memory::Virtual_fs *fs() const { return m_config->fs(); }
+
+  in_memory::Virtual_fs::Directory *directory() const { return m_dir; }
+
+  void wait_for(const std::string &name) const {
+    std::unique_lock lock{m_mutex};
+
+    m_cv.wait(lock, [this, &name]() {
+      return m_finished || m_dir->file(name) != nullptr;
+    });
+  }
+
+  void throw_on_error() const {
+    std::lock_guard lock{m_mutex};
+
+    if (!m_error.empty()) {
+      throw std::runtime_error("Failed to read the stream archive " + m_url +
+                               ": " + m_error);
+    }
+  }
+
+ private:
+  void run() {
+    std::string error;
+
+    try {
+      read();
+    } catch (const std::exception &e) {
+      error = e.what();
+      log_error("Failed to read the stream archive %s: %s", m_url.c_str(),
+                error.c_str());
+    }
+
+    {
+      std::lock_guard lock{m_mutex};
+      m_error = std::move(error);
+      m_finished = true;
+    }
+
+    m_cv.notify_all();
+  }
+
+  void read() {
+    const auto source = archive_file(m_path, false);
+    source->open(Mode::READ);
+
+    shcore::on_leave_scope close_source([&source]() { source->close(); });
+
+    std::string buffer;
+
+    if (!read_fully(source.get(), k_header.size(), &buffer) ||
+        k_header != buffer) {
+      throw std::runtime_error("Not a stream archive");
+    }
+
+    const in_memory::Virtual_directory dir{m_dir, fs()};
+    std::unordered_map<uint32_t, std::unique_ptr<IFile>> files;
+    const auto get_file = [&files](uint32_t id) {
+      const auto it = files.find(id);
+
+      if (files.end() == it) {
+        throw std::runtime_error("Unknown file ID: " + std::to_string(id));
+      }
+
+      return it->second.get();
+    };
+
+    char header[k_record_header_size];
+
+    while (true) {
+      if (!read_fully(source.get(), k_record_header_size, &buffer)) {
+        throw std::runtime_error("Unexpected end of stream");
+      }
+
+      buffer.copy(header, k_record_header_size);
+
+      const auto type = static_cast<Record>(header[0]);
+      const auto id = decode(header + 1);
+      const auto length = decode(header + 5);
+
+      if (!read_fully(source.get(), length, &buffer)) {
+        throw std::runtime_error("Unexpected end of stream");
+      }
+
+      switch (type) {
+        case Record::OPEN: {
+          auto file = dir.file(buffer, {});
+          file->open(Mode::WRITE);
+          files[id] = std::move(file);
+          break;
+        }
+
+        case Record::DATA:
+          get_file(id)->write(buffer.data(), buffer.length());
+          break;
+
+        case Record::CLOSE: {
+          {
+            std::lock_guard lock{m_mutex};
+            get_file(id)->close();
+          }
+
+          m_cv.notify_all();
+          break;
+        }
+
+        case Record::RENAME:
+          get_file(id)->rename(buffer);
+          break;
+
+        case Record::REMOVE:
+          get_file(id)->remove();
+          files.erase(id);
+          break;
+
+        case Record::END:
+          return;
+
+        default:
+          throw std::runtime_error(
+              "Unknown record type: " +
+              std::to_string(static_cast<unsigned char>(header[0])));
+      }
+    }
+  }
+
+  static bool read_fully(IFile *source, std::size_t length,
+                         std::string *buffer) {
+    buffer->resize(length);
+
+    std::size_t offset = 0;
+
+    while (offset < length) {
+      const auto bytes =
+          source->read(buffer->data() + offset, length - offset);
+
+      if (bytes < 0) {
+        throw std::runtime_error(shcore::errno_to_string(errno));
+      }
+
+      if (0 == bytes) {
+        return false;
+      }
+
+      offset += bytes;
+    }
+
+    return true;
+  }
+
+  std::string m_url;
+  std::string m_path;
+  std::shared_ptr<in_memory::Virtual_config> m_config;
+  in_memory::Virtual_fs::Directory *m_dir;
+
+  bool m_finished = false;
+  std::string m_error;
+  mutable std::mutex m_mutex;
+  mutable std::condition_variable m_cv;
+};
+
+/**
+ * File received from the stream archive, data files are removed once they are
+ * read, so that memory used by the reader does not grow with size of the
+ * whole dump.
+ */
+class Archive_reader_file final : public in_memory::Virtual_file {
+ public:
+  using Virtual_file::Virtual_file;
+
+  void open(Mode m) override {
+    Virtual_file::open(m);
+    m_read = Mode::READ == m;
+  }
+
+  void close() override {
+    Virtual_file::close();
+
+    if (m_read && is_read_once(filename())) {
+      try {
+        remove();
+      } catch (const std::exception &e) {
+        log_warning("Failed to release %s: %s", full_path().masked().c_str(),
+                    e.what());
+      }
+    }
+  }
+
+ private:
+  bool m_read = false;
+};
+
+/**
+ * In-memory directory which reports errors of the stream archive.
+ */
+class Archive_reader_directory final : public in_memory::Virtual_directory {
+ public:
+  explicit Archive_reader_directory(std::shared_ptr<Archive_reader> reader)
+      : Virtual_directory(reader->directory(), reader->fs()),
+        m_reader(std::move(reader)) {}
+
+  std::unordered_set<File_info> list_files(bool hidden) const override {
+    m_reader->throw_on_error();
+    return Virtual_directory::list_files(hidden);
+  }
+
+  std::unordered_set<File_info> filter_files(
+      const std::string &pattern) const override {
+    m_reader->throw_on_error();
+    return Virtual_directory::filter_files(pattern);
+  }
+
+  std::unique_ptr<IFile> file(const std::string &name,
+                              const File_options &) const override {
+    m_reader->throw_on_error();
+    return std::make_unique<Archive_reader_file>(name, m_reader->fs(),
+                                                 m_reader->directory());
+  }
+
+ private:
+  std::shared_ptr<Archive_reader> m_reader;
+};
+
+class Archive_reader_config final : public Config {
+ public:
+  Archive_reader_config(const std::string &url, const std::string &wait_for)
+      : m_reader(Archive_reader::create(url)), m_wait_for(wait_for) {}
+
+  Archive_reader_config(const Archive_reader_config &) = delete;
+  Archive_reader_config(Archive_reader_config &&) = default;
+
+  Archive_reader_config &operator=(const Archive_reader_config &) = delete;
+  Archive_reader_config &operator=(Archive_reader_config &&) = default;
+
+  ~Archive_reader_config() override = default;
+
+  bool valid() const override { return true; }
+
+ private:
+  std::string describe_self() const override {
+    return "stream archive " + m_reader->url();
+  }
+
+  std::string describe_url(const std::string &) const override { return {}; }
+
+  std::unique_ptr<IFile> file(const std::string &) const override {
+    throw std::invalid_argument(
+        "Stream archive can only be used as an input directory.");
+  }
+
+  std::unique_ptr<IDirectory> directory(const std::string &) const override {
+    m_reader->wait_for(m_wait_for);
+    m_reader->throw_on_error();
+
+    return std::make_unique<Archive_reader_directory>(m_reader);
+  }
+
+  std::shared_ptr<Archive_reader> m_reader;
+  std::string m_wait_for;
+};
+
+}  // namespace
+
+bool is_stream_archive(const std::string &url) {
+  const auto scheme = utils::get_scheme(url);
+  return !scheme.empty() && utils::scheme_matches(scheme, k_scheme);
+}
+
+std::shared_ptr<Config> stream_archive_writer_config(const std::string &url) {
+  return std::make_shared<Archive_writer_config>(url);
+}
+
+std::shared_ptr<Config> stream_archive_reader_config(
+    const std::string &url, const std::string &wait_for) {
+  return std::make_shared<Archive_reader_config>(url, wait_for);
+}
+
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_STREAM_ARCHIVE_H_
+#define MYSQLSHDK_LIBS_STORAGE_BACKEND_STREAM_ARCHIVE_H_
+
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/libs/storage/config.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+
+/*
+ * Stream archive multiplexes all files of a directory into a single, ordered
+ * stream, which can be written to a pipe or a FIFO and consumed while it is
+ * being produced.
+ *
+ * The stream starts with a header, followed by records. Each record consists
+ * of a one byte type, a four byte file ID, a four byte payload length (both
+ * big-endian) and the payload. Records of multiple files are interleaved, data
+ * of a single file is split into multiple records. The stream is terminated
+ * with an end record.
+ *
+ * Stream archives use the stream:// scheme, the rest of the URL is a path to a
+ * local file which holds the stream (i.e. stream:///dev/fd/3), or "-" to use
+ * the standard input or output.
+ */
+
+/**
+ * Checks if the given URL refers to a stream archive.
+ */
+bool is_stream_archive(const std::string &url);
+
+/**
+ * Creates configuration which writes the stream archive to the given URL.
+ * Files become part of the archive as they are being written, file is
+ * considered to be complete once it's closed.
+ *
+ * @param url URL of the stream archive.
+ */
+std::shared_ptr<Config> stream_archive_writer_config(const std::string &url);
+
+/**
+ * Creates configuration which reads the stream archive from the given URL.
+ * Contents of the stream are read by a background thread and stored in memory
+ * (or in a scratch directory, if memory limit is reached), files become visible
+ * once all their data is received. Data files are released once they are read.
+ * Directories created using this configuration block until the given file is
+ * received or the stream ends.
+ *
+ * @param url URL of the stream archive.
+ * @param wait_for Name of the file to wait for.
+ */
+std::shared_ptr<Config> stream_archive_reader_config(
+    const std::string &url, const std::string &wait_for);
+
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_STORAGE_BACKEND_STREAM_ARCHIVE_H_
@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "mysqlshdk/libs/storage/backend/tee_directory.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+
+namespace {
+
+// small writes are merged into buffers of this size
+constexpr std::size_t k_buffer_size = 1024 * 1024;
+
+}  // namespace
+
+/**
+ * Writes the data to the mirrored file using a background thread.
+ */
+class Tee_file::Mirror final {
+ public:
+  Mirror(std::unique_ptr<IFile> file, std::size_t max_lag)
+      : m_file(std::move(file)), m_max_lag(std::max<std::size_t>(max_lag, 1)) {}
+
+  Mirror(const Mirror &other) = delete;
+  Mirror(Mirror &&other) = delete;
+
+  Mirror &operator=(const Mirror &other) = delete;
+  Mirror &operator=(Mirror &&other) = delete;
+
+  ~Mirror() {
+    if (m_thread.joinable()) {
+      try {
+        close();
+      } catch (const std::exception &e) {
+        log_error("Failed to close the mirrored file %s: %s",
+                  m_file->full_path().masked().c_str(), e.what());
+      }
+    }
+  }
+
+  IFile *file() const { return m_file.get(); }
+
+  void open(Mode m) {
+    m_file->open(m);
+
+    m_finished = false;
+    m_error = nullptr;
+    m_thread = mysqlsh::spawn_scoped_thread([this]() { run(); });
+  }
+
+  void write(const void *buffer, std::size_t length) {
+    const auto data = static_cast<const char *>(buffer);
+    std::unique_lock lock{m_mutex};
+
+    // wait until mirror catches up, a write which is bigger than the lag is
+    // accepted once the buffer is empty
+    m_consumed.wait(lock, [this, length]() {
+      return m_error || 0 == m_pending || m_pending + length <= m_max_lag;
+    });
+
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+
+    if (!m_buffers.empty() && m_buffers.back().size() < k_buffer_size) {
+      m_buffers.back().append(data, length);
+    } else {
+      m_buffers.emplace_back(data, length);
+    }
+
+    m_pending += length;
+    m_produced.notify_one();
+  }
+
+  void flush() {
+    std::unique_lock lock{m_mutex};
+    m_consumed.wait(lock, [this]() { return m_error || 0 == m_pending; });
+
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+
+    // background thread is idle
+    m_file->flush();
+  }
+
+  void close() {
+    {
+      std::lock_guard lock{m_mutex};
+      m_finished = true;
+    }
+
+    m_produced.notify_one();
+    m_thread.join();
+
+    m_file->close();
+
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+  }
+
+ private:
+  void run() {
+    try {
+      while (true) {
+        std::string buffer;
+
+        {
+          std::unique_lock lock{m_mutex};
+          m_produced.wait(
+              lock, [this]() { return m_finished || !m_buffers.empty(); });
+
+          if (m_buffers.empty()) {
+            return;
+          }
+
+          buffer = std::move(m_buffers.front());
+          m_buffers.pop_front();
+        }
+
+        const auto written = m_file->write(buffer.data(), buffer.size());
+
+        if (written < 0 || static_cast<std::size_t>(written) != buffer.size()) {
+          throw std::runtime_error("Failed to write to the mirrored file " +
+                                   m_file->full_path().masked());
+        }
+
+        {
+          std::lock_guard lock{m_mutex};
+          m_pending -= buffer.size();
+        }
+
+        m_consumed.notify_one();
+      }
+    } catch (...) {
+      {
+        std::lock_guard lock{m_mutex};
+        m_error = std::current_exception();
+        m_buffers.clear();
+        m_pending = 0;
+      }
+
+      m_consumed.notify_one();
+    }
+  }
+
+  std::unique_ptr<IFile> m_file;
+  const std::size_t m_max_lag;
+
+  std::mutex m_mutex;
+  std::condition_variable m_produced;
+  std::condition_variable m_consumed;
+  std::deque<std::string> m_buffers;
+  std::size_t m_pending = 0;
+  bool m_finished = false;
+  std::exception_ptr m_error;
+
+  std::thread m_thread;
+};
+
+Tee_file::Tee_file(std::unique_ptr<IFile> primary,
+                   std::vector<std::unique_ptr<IFile>> mirrors,
+                   std::size_t max_lag)
+    : m_primary(std::move(primary)) {
+  m_mirrors.reserve(mirrors.size());
+
+  for (auto &mirror : mirrors) {
+    m_mirrors.emplace_back(
+        std::make_unique<Mirror>(std::move(mirror), max_lag));
+  }
+}
+
+Tee_file::~Tee_file() = default;
+
+void Tee_file::open(Mode m) {
+  m_primary->open(m);
+
+  // mirrors are not used when reading
+  if (Mode::READ != m) {
+    for (const auto &mirror : m_mirrors) {
+      mirror->open(m);
+    }
+
+    m_mirrors_open = true;
+  }
+}
+
+void Tee_file::close() {
+  m_primary->close();
+
+  if (m_mirrors_open) {
+    m_mirrors_open = false;
+
+    std::exception_ptr error;
+
+    // close all the mirrors, even if one of them fails
+    for (const auto &mirror : m_mirrors) {
+      try {
+        mirror->close();
+      } catch (...) {
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+    }
+
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+off64_t Tee_file::seek(off64_t offset) {
+  if (m_mirrors_open) {
+    throw std::logic_error("Tee_file::seek() - not supported when writing");
+  }
+
+  return m_primary->seek(offset);
+}
+
+ssize_t Tee_file::write(const void *buffer, size_t length) {
+  const auto written = m_primary->write(buffer, length);
+
+  if (written > 0) {
+    for (const auto &mirror : m_mirrors) {
+      mirror->write(buffer, written);
+    }
+  }
+
+  return written;
+}
+
+bool Tee_file::flush() {
+  auto result = m_primary->flush();
+
+  if (m_mirrors_open) {
+    for (const auto &mirror : m_mirrors) {
+      mirror->flush();
+    }
+  }
+
+  return result;
+}
+
+bool Tee_file::is_local() const {
+  return m_primary->is_local() &&
+         std::all_of(
+             m_mirrors.begin(), m_mirrors.end(),
+             [](const auto &mirror) { return mirror->file()->is_local(); });
+}
+
+void Tee_file::rename(const std::string &new_name) {
+  m_primary->rename(new_name);
+
+  for (const auto &mirror : m_mirrors) {
+    mirror->file()->rename(new_name);
+  }
+}
+
+void Tee_file::remove() {
+  m_primary->remove();
+
+  for (const auto &mirror : m_mirrors) {
+    if (mirror->file()->exists()) {
+      mirror->file()->remove();
+    }
+  }
+}
+
+Tee_directory::Tee_directory(std::unique_ptr<IDirectory> primary,
+                             std::vector<std::unique_ptr<IDirectory>> mirrors,
+                             std::size_t max_lag)
+    : m_primary(std::move(primary)),
+      m_mirrors(std::move(mirrors)),
+      m_max_lag(max_lag) {}
+
+bool Tee_directory::exists() const {
+  return m_primary->exists() &&
+         std::all_of(m_mirrors.begin(), m_mirrors.end(),
+                     [](const auto &mirror) { return mirror->exists(); });
+}
+
+void Tee_directory::create() {
+  if (!m_primary->exists()) {
+    m_primary->create();
+  }
+
+  for (const auto &mirror : m_mirrors) {
+    if (!mirror->exists()) {
+      mirror->create();
+    }
+  }
+}
+
+std::unique_ptr<IFile> Tee_directory::file(const std::string &name,
+                                           const File_options &options) const {
+  std::vector<std::unique_ptr<IFile>> mirrors;
+  mirrors.reserve(m_mirrors.size());
+
+  for (const auto &mirror : m_mirrors) {
+    mirrors.emplace_back(mirror->file(name, options));
+  }
+
+  return std::make_unique<Tee_file>(m_primary->file(name, options),
+                                    std::move(mirrors), m_max_lag);
+}
+
+bool Tee_directory::is_local() const {
+  return m_primary->is_local() &&
+         std::all_of(m_mirrors.begin(), m_mirrors.end(),
+                     [](const auto &mirror) { return mirror->is_local(); });
+}
+
+void Tee_directory::remove_incomplete_files() {
+  m_primary->remove_incomplete_files();
+
+  for (const auto &mirror : m_mirrors) {
+    mirror->remove_incomplete_files();
+  }
+}
+
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_TEE_DIRECTORY_H_
+#define MYSQLSHDK_LIBS_STORAGE_BACKEND_TEE_DIRECTORY_H_
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+
+/**
+ * Writes the same contents to multiple files. The primary file is written
+ * synchronously, and it's the only one used when reading. Each of the mirrors
+ * is written by its own background thread, data which was not yet written to
+ * a mirror is buffered. Once the buffer of a mirror reaches the maximum lag,
+ * writes wait until the mirror catches up.
+ */
+class Tee_file final : public IFile {
+ public:
+  /**
+   * Creates the file.
+   *
+   * @param primary The primary file.
+   * @param mirrors Files which receive a copy of the data.
+   * @param max_lag Maximum number of bytes buffered for a single mirror.
+   */
+  Tee_file(std::unique_ptr<IFile> primary,
+           std::vector<std::unique_ptr<IFile>> mirrors, std::size_t max_lag);
+
+  Tee_file(const Tee_file &other) = delete;
+  Tee_file(Tee_file &&other) = delete;
+
+  Tee_file &operator=(const Tee_file &other) = delete;
+  Tee_file &operator=(Tee_file &&other) = delete;
+
+  ~Tee_file() override;
+
+  void open(Mode m) override;
+
+  bool is_open() const override { return m_primary->is_open(); }
+
+  int error() const override { return m_primary->error(); }
+
+  void close() override;
+
+  size_t file_size() const override { return m_primary->file_size(); }
+
+  Masked_string full_path() const override { return m_primary->full_path(); }
+
+  std::string filename() const override { return m_primary->filename(); }
+
+  bool exists() const override { return m_primary->exists(); }
+
+  std::unique_ptr<IDirectory> parent() const override {
+    return m_primary->parent();
+  }
+
+  off64_t seek(off64_t offset) override;
+
+  off64_t tell() const override { return m_primary->tell(); }
+
+  ssize_t read(void *buffer, size_t length) override {
+    return m_primary->read(buffer, length);
+  }
+
+  ssize_t write(const void *buffer, size_t length) override;
+
+  bool flush() override;
+
+  bool is_local() const override;
+
+  void rename(const std::string &new_name) override;
+
+  void remove() override;
+
+ private:
+  class Mirror;
+
+  std::unique_ptr<IFile> m_primary;
+  std::vector<std::unique_ptr<Mirror>> m_mirrors;
+  bool m_mirrors_open = false;
+};
+
+/**
+ * Directory which creates files that write the same contents to the primary
+ * directory and all of its mirrors. Directory exists only if the primary and
+ * all the mirrors exist, all other read-only operations use just the primary
+ * directory.
+ */
+class Tee_directory final : public IDirectory {
+ public:
+  /**
+   * Creates the directory.
+   *
+   * @param primary The primary directory.
+   * @param mirrors Directories which receive a copy of each file.
+   * @param max_lag Maximum number of bytes buffered for a single file written
+   *        to a mirror.
+   */
+  Tee_directory(std::unique_ptr<IDirectory> primary,
+                std::vector<std::unique_ptr<IDirectory>> mirrors,
+                std::size_t max_lag);
+
+  Tee_directory(const Tee_directory &other) = delete;
+  Tee_directory(Tee_directory &&other) = delete;
+
+  Tee_directory &operator=(const Tee_directory &other) = delete;
+  Tee_directory &operator=(Tee_directory &&other) = delete;
+
+  ~Tee_directory() override = default;
+
+  bool exists() const override;
+
+  void create() override;
+
+  Masked_string full_path() const override { return m_primary->full_path(); }
+
+  std::unordered_set<File_info> list_files(
+      bool hidden_files = false) const override {
+    return m_primary->list_files(hidden_files);
+  }
+
+  std::unordered_set<File_info> filter_files(
+      const std::string &pattern) const override {
+    return m_primary->filter_files(pattern);
+  }
+
+  std::unique_ptr<IFile> file(const std::string &name,
+                              const File_options &options = {}) const override;
+
+  bool is_local() const override;
+
+  std::string join_path(const std::string &a,
+                        const std::string &b) const override {
+    return m_primary->join_path(a, b);
+  }
+
+  void remove_incomplete_files() override;
+
+ private:
+  std::unique_ptr<IDirectory> m_primary;
+  std::vector<std::unique_ptr<IDirectory>> m_mirrors;
+  std::size_t m_max_lag;
+};
+
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_STORAGE_BACKEND_TEE_DIRECTORY_H_
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "mysqlshdk/libs/storage/checksummed_file.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/utils/crc32c.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace storage {
+
+Checksummed_file::Checksummed_file(std::unique_ptr<IFile> file)
+    : m_file(std::move(file)) {}
+
+Checksummed_file::Checksummed_file(std::unique_ptr<IFile> file,
+                                   uint32_t expected)
+    : m_file(std::move(file)), m_expected(expected) {}
+
+void Checksummed_file::open(Mode m) {
+  m_file->open(m);
+
+  m_mode = m;
+  m_crc = 0;
+  m_offset = 0;
+  // appended data is not going to cover the whole file
+  m_sequential = Mode::APPEND != m;
+  m_verified = false;
+}
+
+void Checksummed_file::close() {
+  const auto verify_contents =
+      Mode::READ == m_mode && m_expected.has_value() && m_sequential &&
+      !m_verified && m_offset == m_file->file_size();
+
+  m_file->close();
+
+  if (verify_contents) {
+    verify();
+  }
+}
+
+std::unique_ptr<IDirectory> Checksummed_file::parent() const {
+  return m_file->parent();
+}
+
+off64_t Checksummed_file::seek(off64_t offset) {
+  if (static_cast<uint64_t>(offset) != m_offset) {
+    m_sequential = false;
+  }
+
+  return m_file->seek(offset);
+}
+
+ssize_t Checksummed_file::read(void *buffer, size_t length) {
+  const auto bytes = m_file->read(buffer, length);
+
+  if (bytes > 0) {
+    if (m_sequential) {
+      m_crc = utils::crc32c(buffer, bytes, m_crc);
+    }
+
+    m_offset += bytes;
+  } else if (0 == bytes && length > 0 && m_expected.has_value() &&
+             m_sequential && !m_verified) {
+    verify();
+  }
+
+  return bytes;
+}
+
+ssize_t Checksummed_file::write(const void *buffer, size_t length) {
+  const auto bytes = m_file->write(buffer, length);
+
+  if (bytes > 0) {
+    if (m_sequential) {
+      m_crc = utils::crc32c(buffer, bytes, m_crc);
+    }
+
+    m_offset += bytes;
+  }
+
+  return bytes;
+}
+
+std::optional<uint32_t> Checksummed_file::checksum() const {
+  if (Mode::WRITE != m_mode || !m_sequential) {
+    return {};
+  }
+
+  return m_crc;
+}
+
+void Checksummed_file::verify() {
+  m_verified = true;
+
+  if (*m_expected != m_crc) {
+    throw std::runtime_error(shcore::str_format(
+        "Checksum mismatch of file '%s' (expected CRC-32C: %08x, actual: "
+        "%08x), the file is corrupted",
+        full_path().masked().c_str(), *m_expected, m_crc));
+  }
+}
+
+}  // namespace storage
+}  // namespace mysqlshdk
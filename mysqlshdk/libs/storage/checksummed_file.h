@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#ifndef MYSQLSHDK_LIBS_STORAGE_CHECKSUMMED_FILE_H_
+#define MYSQLSHDK_LIBS_STORAGE_CHECKSUMMED_FILE_H_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlshdk {
+namespace storage {
+
+/**
+ * Computes the CRC-32C checksum of the data which is sequentially written to
+ * or read from the wrapped file.
+ *
+ * If the expected checksum is given, once the whole file is read, the computed
+ * checksum is compared with the expected one. Verification is skipped if file
+ * is not read sequentially from the beginning.
+ */
+class Checksummed_file final : public IFile {
+ public:
+  Checksummed_file() = delete;
+
+  explicit Checksummed_file(std::unique_ptr<IFile> file);
+
+  /**
+   * Creates a file which verifies its contents when it's read.
+   *
+   * @param file File to be wrapped.
+   * @param expected Expected checksum of the contents of the file.
+   */
+  Checksummed_file(std::unique_ptr<IFile> file, uint32_t expected);
+
+  Checksummed_file(const Checksummed_file &) = delete;
+  Checksummed_file(Checksummed_file &&) = default;
+
+  Checksummed_file &operator=(const Checksummed_file &) = delete;
+  Checksummed_file &operator=(Checksummed_file &&) = default;
+
+  ~Checksummed_file() override = default;
+
+  void open(Mode m) override;
+
+  bool is_open() const override { return m_file->is_open(); }
+
+  int error() const override { return m_file->error(); }
+
+  /**
+   * @throws std::runtime_error If whole file was read and its checksum does not
+   *                            match the expected one.
+   */
+  void close() override;
+
+  size_t file_size() const override { return m_file->file_size(); }
+
+  Masked_string full_path() const override { return m_file->full_path(); }
+
+  std::string filename() const override { return m_file->filename(); }
+
+  bool exists() const override { return m_file->exists(); }
+
+  std::unique_ptr<IDirectory> parent() const override;
+
+  off64_t seek(off64_t offset) override;
+
+  off64_t tell() const override { return m_file->tell(); }
+
+  /**
+   * @throws std::runtime_error If end of file was reached and its checksum
+   *                            does not match the expected one.
+   */
+  ssize_t read(void *buffer, size_t length) override;
+
+  ssize_t write(const void *buffer, size_t length) override;
+
+  bool flush() override { return m_file->flush(); }
+
+  bool is_local() const override { return m_file->is_local(); }
+
+  void rename(const std::string &new_name) override {
+    m_file->rename(new_name);
+  }
+
+  void remove() override { m_file->remove(); }
+
+  IFile *file() const { return m_file.get(); }
+
+  /**
+   * Checksum of the data written so far, not set if file was not written
+   * sequentially.
+   */
+  std::optional<uint32_t> checksum() const;
+
+ private:
+  void verify();
+
+  std::unique_ptr<IFile> m_file;
+  std::optional<uint32_t> m_expected;
+  uint32_t m_crc = 0;
+  uint64_t m_offset = 0;
+  // set to false if data was not read/written sequentially
+  bool m_sequential = true;
+  bool m_verified = false;
+  std::optional<Mode> m_mode;
+};
+
+}  // namespace storage
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_STORAGE_CHECKSUMMED_FILE_H_
@@ -23,12 +23,18 @@
 
 #include "mysqlshdk/libs/storage/compressed_file.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <stdexcept>
 #include <utility>
 
 #include "mysqlshdk/libs/storage/compression/gz_file.h"
+#include "mysqlshdk/libs/storage/compression/lz4_file.h"
 #include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlshdk {
@@ -36,13 +42,65 @@ namespace storage {
 
 namespace {
 
-#define COMPRESSIONS     \
-  X(NONE, "none", "")    \
-  X(GZIP, "gzip", ".gz") \
-  X(ZSTD, "zstd", ".zst")
+#define COMPRESSIONS      \
+  X(NONE, "none", "")     \
+  X(GZIP, "gzip", ".gz")  \
+  X(ZSTD, "zstd", ".zst") \
+  X(LZ4, "lz4", ".lz4")
+
+// higher zstd levels are much slower, while the gains are small
+constexpr int k_auto_zstd_max_level = 9;
+
+// level is adjusted after compression and writes took this much time in total
+constexpr auto k_level_tuner_window = std::chrono::seconds(1);
 
 }  // namespace
 
+Compression_level_tuner::Compression_level_tuner(int min_level, int max_level,
+                                                 int initial_level)
+    : m_min_level(min_level),
+      m_max_level(max_level),
+      m_level(std::clamp(initial_level, min_level, max_level)) {
+  assert(min_level <= max_level);
+}
+
+void Compression_level_tuner::report(Duration compression, Duration write) {
+  std::lock_guard lock{m_mutex};
+
+  m_compression += compression;
+  m_write += write;
+
+  if (m_compression + m_write < k_level_tuner_window) {
+    return;
+  }
+
+  const auto current = level();
+  auto level = current;
+
+  if (m_compression > m_write) {
+    // compression is the bottleneck
+    level = std::max(m_min_level, current - 1);
+  } else if (2 * m_compression < m_write) {
+    // writes are the bottleneck, compression can do more work; threshold
+    // prevents the level from oscillating between two values
+    level = std::min(m_max_level, current + 1);
+  }
+
+  if (level != current) {
+    log_debug(
+        "Compression level changed from %d to %d, compression: %.3f s, writes: "
+        "%.3f s",
+        current, level,
+        std::chrono::duration<double>(m_compression).count(),
+        std::chrono::duration<double>(m_write).count());
+
+    m_level.store(level, std::memory_order_relaxed);
+  }
+
+  m_compression = Duration{0};
+  m_write = Duration{0};
+}
+
 Compressed_file::Compressed_file(std::unique_ptr<IFile> file)
     : m_file(std::move(file)) {}
 
@@ -82,6 +140,14 @@ size_t Compressed_file::latest_io_size() const {
   return m_io_finished ? m_io_size : 0;
 }
 
+void Compressed_file::end_frame() {
+  throw std::logic_error("Compressed_file::end_frame() - not supported");
+}
+
+void Compressed_file::set_frames(std::vector<Frame>) {
+  throw std::logic_error("Compressed_file::set_frames() - not supported");
+}
+
 void Compressed_file::start_io() {
   m_io_size = 0;
   m_io_finished = false;
@@ -105,6 +171,94 @@ Compression to_compression(const std::string &c) {
   throw std::invalid_argument("Unknown compression type: " + c);
 }
 
+Compression to_compression(const std::string &c, Compression_options *options) {
+  assert(options);
+
+  const auto [type, rest] = shcore::str_partition(c, ";");
+  const auto compression = to_compression(shcore::str_strip(type));
+
+  for (const auto &part : shcore::str_split(rest, ";")) {
+    const auto option = shcore::str_strip(part);
+
+    if (option.empty()) {
+      continue;
+    }
+
+    const auto [key, value] = shcore::str_partition(option, "=");
+    const auto name = shcore::str_strip(key);
+
+    if (!shcore::str_caseeq(name, "level")) {
+      throw std::invalid_argument("Unknown compression option: " + name);
+    }
+
+    int min_level = 0;
+    int max_level = 0;
+
+    switch (compression) {
+      case Compression::NONE:
+        throw std::invalid_argument(
+            "Compression option 'level' cannot be used with 'none' "
+            "compression.");
+
+      case Compression::GZIP:
+        min_level = Z_BEST_SPEED;
+        max_level = Z_BEST_COMPRESSION;
+        break;
+
+      case Compression::ZSTD:
+        min_level = 1;
+        max_level = ZSTD_maxCLevel();
+        break;
+
+      case Compression::LZ4:
+        min_level = 1;
+        max_level = LZ4F_compressionLevel_max();
+        break;
+    }
+
+    int level = 0;
+    const auto v = shcore::str_strip(value);
+
+    if (shcore::str_caseeq(v, "auto")) {
+      if (Compression::ZSTD != compression) {
+        throw std::invalid_argument(
+            "The value 'auto' of compression option 'level' can only be used "
+            "with 'zstd' compression.");
+      }
+
+      options->level.reset();
+      options->level_tuner = std::make_shared<Compression_level_tuner>(
+          min_level, std::min(max_level, k_auto_zstd_max_level), min_level);
+      continue;
+    }
+
+    try {
+      std::size_t idx = 0;
+      level = std::stoi(v, &idx);
+
+      if (idx != v.length()) {
+        throw std::invalid_argument("trailing characters");
+      }
+    } catch (const std::exception &) {
+      throw std::invalid_argument(
+          "The value of compression option 'level' must be an integer, got: " +
+          value);
+    }
+
+    if (level < min_level || level > max_level) {
+      throw std::invalid_argument(shcore::str_format(
+          "The value of compression option 'level' for '%s' compression must "
+          "be in range [%d, %d], got: %d",
+          to_string(compression).c_str(), min_level, max_level, level));
+    }
+
+    options->level = level;
+    options->level_tuner.reset();
+  }
+
+  return compression;
+}
+
 std::string to_string(Compression c) {
 #define X(value, name, ext) \
   case Compression::value:  \
@@ -141,6 +295,11 @@ Compression from_extension(const std::string &e) {
 }
 
 std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c) {
+  return make_file(std::move(file), c, {});
+}
+
+std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c,
+                                 const Compression_options &options) {
   std::unique_ptr<IFile> result;
 
   switch (c) {
@@ -149,11 +308,18 @@ std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c) {
       break;
 
     case Compression::GZIP:
-      result = std::make_unique<compression::Gz_file>(std::move(file));
+      result =
+          std::make_unique<compression::Gz_file>(std::move(file), options);
       break;
 
     case Compression::ZSTD:
-      result = std::make_unique<compression::Zstd_file>(std::move(file));
+      result =
+          std::make_unique<compression::Zstd_file>(std::move(file), options);
+      break;
+
+    case Compression::LZ4:
+      result =
+          std::make_unique<compression::Lz4_file>(std::move(file), options);
       break;
 
     default:
@@ -163,5 +329,179 @@ std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c) {
   return result;
 }
 
+void compress(Compression c, const char *data, std::size_t length,
+              std::string *out) {
+  switch (c) {
+    case Compression::NONE:
+      out->assign(data, length);
+      break;
+
+    case Compression::GZIP: {
+      z_stream stream{};
+
+      const int gzip_window_bits = 15 + 16;
+      const int mem_level = 8;
+      const int compression_level = 1;
+
+      if (Z_OK != deflateInit2(&stream, compression_level, Z_DEFLATED,
+                               gzip_window_bits, mem_level,
+                               Z_DEFAULT_STRATEGY)) {
+        throw std::runtime_error(std::string("deflate init failed: ") +
+                                 (stream.msg ? stream.msg : ""));
+      }
+
+      out->resize(deflateBound(&stream, static_cast<uLong>(length)));
+
+      stream.next_in =
+          reinterpret_cast<Bytef *>(const_cast<char *>(data));  // NOLINT
+      stream.avail_in = static_cast<uInt>(length);
+      stream.next_out = reinterpret_cast<Bytef *>(&(*out)[0]);
+      stream.avail_out = static_cast<uInt>(out->size());
+
+      const auto result = deflate(&stream, Z_FINISH);
+      const auto written = stream.total_out;
+      deflateEnd(&stream);
+
+      if (Z_STREAM_END != result) {
+        throw std::runtime_error("deflate failed: " + std::to_string(result));
+      }
+
+      out->resize(written);
+      break;
+    }
+
+    case Compression::ZSTD: {
+      out->resize(ZSTD_compressBound(length));
+
+      const auto result =
+          ZSTD_compress(&(*out)[0], out->size(), data, length, 1);
+
+      if (ZSTD_isError(result)) {
+        throw std::runtime_error(std::string("ZSTD compression failed: ") +
+                                 ZSTD_getErrorName(result));
+      }
+
+      out->resize(result);
+      break;
+    }
+
+    case Compression::LZ4: {
+      out->resize(LZ4F_compressFrameBound(length, nullptr));
+
+      const auto result =
+          LZ4F_compressFrame(&(*out)[0], out->size(), data, length, nullptr);
+
+      if (LZ4F_isError(result)) {
+        throw std::runtime_error(std::string("LZ4 compression failed: ") +
+                                 LZ4F_getErrorName(result));
+      }
+
+      out->resize(result);
+      break;
+    }
+
+    default:
+      throw std::logic_error("Unhandled compression type: " + to_string(c));
+  }
+}
+
+void decompress(Compression c, const char *data, std::size_t length,
+                std::size_t uncompressed_length, std::string *out) {
+  out->resize(uncompressed_length);
+
+  std::size_t written = 0;
+
+  switch (c) {
+    case Compression::NONE:
+      written = length;
+
+      if (length == uncompressed_length) {
+        ::memcpy(&(*out)[0], data, length);
+      }
+
+      break;
+
+    case Compression::GZIP: {
+      z_stream stream{};
+
+      // accept both gzip and zlib headers
+      const int auto_window_bits = 15 + 32;
+
+      if (Z_OK != inflateInit2(&stream, auto_window_bits)) {
+        throw std::runtime_error(std::string("inflate init failed: ") +
+                                 (stream.msg ? stream.msg : ""));
+      }
+
+      stream.next_in =
+          reinterpret_cast<Bytef *>(const_cast<char *>(data));  // NOLINT
+      stream.avail_in = static_cast<uInt>(length);
+      stream.next_out = reinterpret_cast<Bytef *>(&(*out)[0]);
+      stream.avail_out = static_cast<uInt>(out->size());
+
+      const auto result = inflate(&stream, Z_FINISH);
+      written = stream.total_out;
+      inflateEnd(&stream);
+
+      if (Z_STREAM_END != result) {
+        throw std::runtime_error("inflate failed: " + std::to_string(result));
+      }
+
+      break;
+    }
+
+    case Compression::ZSTD: {
+      const auto result =
+          ZSTD_decompress(&(*out)[0], out->size(), data, length);
+
+      if (ZSTD_isError(result)) {
+        throw std::runtime_error(std::string("ZSTD decompression failed: ") +
+                                 ZSTD_getErrorName(result));
+      }
+
+      written = result;
+      break;
+    }
+
+    case Compression::LZ4: {
+      LZ4F_dctx *context = nullptr;
+
+      if (LZ4F_isError(LZ4F_createDecompressionContext(&context,
+                                                       LZ4F_VERSION))) {
+        throw std::runtime_error("LZ4 decompression init failed");
+      }
+
+      shcore::on_leave_scope free_context(
+          [context]() { LZ4F_freeDecompressionContext(context); });
+
+      auto src_size = length;
+      auto dst_size = out->size();
+
+      const auto result = LZ4F_decompress(context, &(*out)[0], &dst_size,
+                                          data, &src_size, nullptr);
+
+      if (LZ4F_isError(result)) {
+        throw std::runtime_error(std::string("LZ4 decompression failed: ") +
+                                 LZ4F_getErrorName(result));
+      }
+
+      if (0 != result) {
+        throw std::runtime_error("LZ4 decompression failed: truncated frame");
+      }
+
+      written = dst_size;
+      break;
+    }
+
+    default:
+      throw std::logic_error("Unhandled compression type: " + to_string(c));
+  }
+
+  if (written != uncompressed_length) {
+    throw std::runtime_error(
+        "Decompressed data has unexpected length: " + std::to_string(written) +
+        ", expected: " + std::to_string(uncompressed_length));
+  }
+}
+
 }  // namespace storage
 }  // namespace mysqlshdk
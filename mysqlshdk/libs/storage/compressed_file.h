@@ -24,18 +24,114 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_COMPRESSED_FILE_H_
 #define MYSQLSHDK_LIBS_STORAGE_COMPRESSED_FILE_H_
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/storage/ifile.h"
 
 namespace mysqlshdk {
 namespace storage {
 
-enum class Compression { NONE, GZIP, ZSTD };
+enum class Compression { NONE, GZIP, ZSTD, LZ4 };
+
+/**
+ * Selects the compression level while the data is being written, shared by all
+ * files which use the same compression options.
+ *
+ * Files report the time spent compressing the data and the time spent writing
+ * the compressed data. If writes take considerably longer, compression has some
+ * headroom and level is increased, producing smaller output without lowering
+ * the throughput. If compression takes longer, it is the bottleneck and level
+ * is decreased.
+ */
+class Compression_level_tuner final {
+ public:
+  using Duration = std::chrono::steady_clock::duration;
+
+  Compression_level_tuner(int min_level, int max_level, int initial_level);
+
+  Compression_level_tuner(const Compression_level_tuner &) = delete;
+  Compression_level_tuner(Compression_level_tuner &&) = delete;
+
+  Compression_level_tuner &operator=(const Compression_level_tuner &) = delete;
+  Compression_level_tuner &operator=(Compression_level_tuner &&) = delete;
+
+  ~Compression_level_tuner() = default;
+
+  /**
+   * Level which should be used when starting a new frame.
+   */
+  inline int level() const noexcept {
+    return m_level.load(std::memory_order_relaxed);
+  }
+
+  inline int min_level() const noexcept { return m_min_level; }
+
+  inline int max_level() const noexcept { return m_max_level; }
+
+  /**
+   * Reports the time spent compressing and writing the data, level is adjusted
+   * once enough samples are gathered.
+   *
+   * @param compression Time spent compressing the data.
+   * @param write Time spent writing the compressed data.
+   */
+  void report(Duration compression, Duration write);
+
+ private:
+  const int m_min_level;
+  const int m_max_level;
+  std::atomic<int> m_level;
+
+  std::mutex m_mutex;
+  Duration m_compression{0};
+  Duration m_write{0};
+};
+
+struct Compression_options {
+  /**
+   * Compression level, if not set, the default level is used.
+   */
+  std::optional<int> level;
+
+  /**
+   * If set, compression level is adjusted while the data is written, currently
+   * only supported by zstd.
+   */
+  std::shared_ptr<Compression_level_tuner> level_tuner;
+
+  /**
+   * Number of background threads used to compress the data, if set to 0, data
+   * is compressed by the thread which is writing to the file. Compressed data
+   * is always written in the same order as the input data.
+   */
+  int threads = 0;
+
+  /**
+   * Compression dictionary, currently only supported by zstd. The same
+   * dictionary needs to be used when compressing and decompressing the data.
+   */
+  std::shared_ptr<const std::string> dictionary;
+};
 
 class Compressed_file : public IFile {
  public:
+  /**
+   * Start of an independently compressed frame.
+   */
+  struct Frame {
+    // offset in the compressed stream
+    uint64_t compressed_offset;
+    // offset in the uncompressed stream
+    uint64_t offset;
+  };
+
   Compressed_file() = delete;
   explicit Compressed_file(std::unique_ptr<IFile> file);
   Compressed_file(const Compressed_file &other) = delete;
@@ -72,6 +168,28 @@ class Compressed_file : public IFile {
    */
   size_t latest_io_size() const;
 
+  /**
+   * Whether compressed stream can be split into independent frames.
+   */
+  virtual bool supports_frames() const { return false; }
+
+  /**
+   * Finishes the current frame, data written afterwards can be decompressed
+   * without the preceding data. Compressed bytes which were written are
+   * reported by latest_io_size().
+   *
+   * @throws std::logic_error If frames are not supported.
+   */
+  virtual void end_frame();
+
+  /**
+   * Provides the frames of a file opened for reading, allows to seek() to any
+   * offset of the uncompressed stream without decompressing the whole file.
+   *
+   * @throws std::logic_error If frames are not supported.
+   */
+  virtual void set_frames(std::vector<Frame> frames);
+
  protected:
   void start_io();
 
@@ -87,6 +205,16 @@ class Compressed_file : public IFile {
 
 Compression to_compression(const std::string &c);
 
+/**
+ * Converts the given string to a compression type, string can optionally hold
+ * the compression options, i.e. "zstd;level=9". The "zstd" compression also
+ * accepts "level=auto".
+ *
+ * @param c String to be converted.
+ * @param options Receives the compression options.
+ */
+Compression to_compression(const std::string &c, Compression_options *options);
+
 std::string to_string(Compression c);
 
 std::string get_extension(Compression c);
@@ -94,6 +222,36 @@ Compression from_extension(const std::string &e);
 
 std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c);
 
+std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c,
+                                 const Compression_options &options);
+
+/**
+ * Compresses the given data as a single frame (ZSTD) or member (GZIP).
+ *
+ * @param c Compression type.
+ * @param data Data to be compressed.
+ * @param length Length of the data.
+ * @param out Receives the compressed data.
+ */
+void compress(Compression c, const char *data, std::size_t length,
+              std::string *out);
+
+/**
+ * Decompresses the given data, which holds a single frame (ZSTD, LZ4) or member
+ * (GZIP, zlib streams are also accepted).
+ *
+ * @param c Compression type.
+ * @param data Data to be decompressed.
+ * @param length Length of the data.
+ * @param uncompressed_length Expected length of the decompressed data.
+ * @param out Receives the decompressed data.
+ *
+ * @throws std::runtime_error if data cannot be decompressed or its length does
+ *         not match the expected one
+ */
+void decompress(Compression c, const char *data, std::size_t length,
+                std::size_t uncompressed_length, std::string *out);
+
 }  // namespace storage
 }  // namespace mysqlshdk
 
@@ -24,18 +24,138 @@
 #include "mysqlshdk/libs/storage/compression/gz_file.h"
 
 #include <algorithm>
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <future>
 #include <limits>
+#include <thread>
 #include <utility>
 
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/tracing.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 
 namespace mysqlshdk {
 namespace storage {
 namespace compression {
 
+namespace {
+
+constexpr int k_gzip_window_bits = 15 + 16;
+constexpr int k_mem_level = 8;
+
+void compress_member(int level, const std::string &data, std::string *out) {
+  z_stream stream{};
+
+  if (Z_OK != deflateInit2(&stream, level, Z_DEFLATED, k_gzip_window_bits,
+                           k_mem_level, Z_DEFAULT_STRATEGY)) {
+    throw std::runtime_error(std::string("deflate init failed: ") +
+                             (stream.msg ? stream.msg : ""));
+  }
+
+  out->resize(deflateBound(&stream, static_cast<uLong>(data.size())));
+
+  stream.next_in =
+      reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));  // NOLINT
+  stream.avail_in = static_cast<uInt>(data.size());
+  stream.next_out = reinterpret_cast<Bytef *>(out->data());  // NOLINT
+  stream.avail_out = static_cast<uInt>(out->size());
+
+  const auto result = deflate(&stream, Z_FINISH);
+  const auto written = stream.total_out;
+  deflateEnd(&stream);
+
+  if (Z_STREAM_END != result) {
+    throw std::runtime_error("deflate failed: " + std::to_string(result));
+  }
+
+  out->resize(written);
+}
+
+}  // namespace
+
+/**
+ * Compresses blocks of data as independent gzip members using a pool of
+ * threads. Results are collected in the order in which blocks were submitted.
+ */
+struct Gz_file::Parallel_writer {
+  struct Block {
+    std::string data;
+    std::promise<std::string> member;
+  };
+
+  Parallel_writer(int threads, int compression_level)
+      : level(compression_level),
+        max_pending(2 * static_cast<std::size_t>(threads)) {
+    block.reserve(PARALLEL_BLOCK);
+    workers.reserve(threads);
+
+    for (int i = 0; i < threads; ++i) {
+      workers.emplace_back(mysqlsh::spawn_scoped_thread([this]() {
+        while (const auto b = queue.pop()) {
+          try {
+            std::string member;
+            compress_member(level, b->data, &member);
+            b->member.set_value(std::move(member));
+          } catch (...) {
+            b->member.set_exception(std::current_exception());
+          }
+        }
+      }));
+    }
+  }
+
+  Parallel_writer(const Parallel_writer &) = delete;
+  Parallel_writer(Parallel_writer &&) = delete;
+
+  Parallel_writer &operator=(const Parallel_writer &) = delete;
+  Parallel_writer &operator=(Parallel_writer &&) = delete;
+
+  ~Parallel_writer() {
+    queue.shutdown(workers.size());
+
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  void submit() {
+    auto b = std::make_shared<Block>();
+    b->data = std::move(block);
+    pending.emplace_back(b->member.get_future());
+    queue.push(std::move(b));
+    ++members;
+
+    block = {};
+    block.reserve(PARALLEL_BLOCK);
+  }
+
+  const int level;
+  // number of blocks being compressed, before writer waits for results
+  const std::size_t max_pending;
+  // data which is going to be compressed as the next member
+  std::string block;
+  // compressed members, in order in which they are going to be written
+  std::deque<std::future<std::string>> pending;
+  std::size_t members = 0;
+  shcore::Synchronized_queue<std::shared_ptr<Block>> queue;
+  std::vector<std::thread> workers;
+};
+
 Gz_file::Gz_file(std::unique_ptr<IFile> file)
     : Compressed_file(std::move(file)) {}
 
+Gz_file::Gz_file(std::unique_ptr<IFile> file,
+                 const Compression_options &options)
+    : Compressed_file(std::move(file)), m_options(options) {}
+
+Gz_file::Gz_file(Gz_file &&other) = default;
+
+Gz_file &Gz_file::operator=(Gz_file &&other) = default;
+
 Gz_file::~Gz_file() {
   try {
     if (is_open()) do_close();
@@ -45,6 +165,9 @@ Gz_file::~Gz_file() {
 }
 
 ssize_t Gz_file::read(void *buffer, size_t length) {
+  mysqlshdk::tracing::Span span{"compression", "gz.decompress"};
+  span.add_arg("bytes", static_cast<uint64_t>(length));
+
   m_stream.next_out = static_cast<Bytef *>(buffer);
   m_stream.avail_out = length;
   int result = Z_STREAM_END;
@@ -83,7 +206,20 @@ ssize_t Gz_file::read(void *buffer, size_t length) {
       consume(consume_bytes);
       update_io(consume_bytes);
     }
-    if (result == Z_STREAM_END || result == Z_BUF_ERROR) {
+    if (result == Z_STREAM_END) {
+      // concatenated gzip members form a valid gzip stream, continue with the
+      // next one, if there's one
+      if (0 == peek(CHUNK).length) {
+        break;
+      }
+
+      m_total_in += m_stream.total_in;
+      m_total_out += m_stream.total_out;
+
+      if (Z_OK != inflateReset(&m_stream)) {
+        throw std::runtime_error("inflate: failed to reset the stream");
+      }
+    } else if (result == Z_BUF_ERROR) {
       break;
     }
   }
@@ -94,6 +230,14 @@ ssize_t Gz_file::read(void *buffer, size_t length) {
 }
 
 ssize_t Gz_file::write(const void *buffer, size_t length) {
+  mysqlshdk::tracing::Span span{"compression", "gz.compress"};
+  span.add_arg("bytes", static_cast<uint64_t>(length));
+
+  if (m_parallel) {
+    parallel_write(buffer, length);
+    return length;
+  }
+
   return do_write(static_cast<Bytef *>(const_cast<void *>(buffer)), length,
                   Z_NO_FLUSH);
 }
@@ -104,6 +248,67 @@ void Gz_file::write_finish() {
   (void)do_write(&c, 0, Z_FINISH);
 }
 
+void Gz_file::parallel_write(const void *buffer, size_t length) {
+  auto input = static_cast<const char *>(buffer);
+  auto &block = m_parallel->block;
+
+  start_io();
+
+  while (length > 0) {
+    const auto bytes = std::min(length, PARALLEL_BLOCK - block.size());
+
+    block.append(input, bytes);
+    input += bytes;
+    length -= bytes;
+    m_total_in += bytes;
+
+    if (PARALLEL_BLOCK == block.size()) {
+      m_parallel->submit();
+      write_members(m_parallel->max_pending);
+    }
+  }
+
+  // write whatever is already compressed
+  write_members(m_parallel->max_pending);
+
+  finish_io();
+}
+
+void Gz_file::parallel_write_finish() {
+  start_io();
+
+  // empty input still produces a valid gzip stream
+  if (!m_parallel->block.empty() || 0 == m_parallel->members) {
+    m_parallel->submit();
+  }
+
+  write_members(0);
+
+  finish_io();
+}
+
+void Gz_file::write_members(std::size_t max_pending) {
+  auto &pending = m_parallel->pending;
+
+  while (!pending.empty() &&
+         (pending.size() > max_pending ||
+          std::future_status::ready ==
+              pending.front().wait_for(std::chrono::seconds::zero()))) {
+    const auto member = pending.front().get();
+    pending.pop_front();
+
+    const auto size = static_cast<ssize_t>(member.size());
+    const auto write_bytes = file()->write(member.data(), member.size());
+
+    if (write_bytes != size) {
+      throw std::runtime_error("deflate: cannot write");
+    }
+
+    update_io(member.size());
+    m_total_out += member.size();
+  }
+}
+
 void Gz_file::init_read() {
   m_stream.zalloc = nullptr;
   m_stream.zfree = nullptr;
@@ -112,8 +317,7 @@ void Gz_file::init_read() {
   m_stream.avail_in = 0;
   m_stream.next_in = nullptr;
 
-  const int gzip_window_bits = 15 + 16;
-  int result = inflateInit2(&m_stream, gzip_window_bits);
+  int result = inflateInit2(&m_stream, k_gzip_window_bits);
   if (result != Z_OK) {
     throw std::runtime_error(std::string("inflate init failed: ") +
                              m_stream.msg);
@@ -122,6 +326,16 @@ void Gz_file::init_read() {
 }
 
 void Gz_file::init_write() {
+  const int compression_level = m_options.level.value_or(Z_BEST_SPEED);
+
+  if (m_options.threads > 0) {
+    // blocks are compressed by the background threads, m_stream is not used
+    m_stream = {};
+    m_parallel =
+        std::make_unique<Parallel_writer>(m_options.threads, compression_level);
+    return;
+  }
+
   m_stream.zalloc = nullptr;
   m_stream.zfree = nullptr;
   m_stream.opaque = nullptr;
@@ -129,11 +343,9 @@ void Gz_file::init_write() {
   m_stream.avail_in = 0;
   m_stream.next_in = nullptr;
 
-  const int gzip_window_bits = 15 + 16;
-  const int mem_level = 8;
-  const int compression_level = 1;  // Z_DEFAULT_COMPRESSION
   int result = deflateInit2(&m_stream, compression_level, Z_DEFLATED,
-                            gzip_window_bits, mem_level, Z_DEFAULT_STRATEGY);
+                            k_gzip_window_bits, k_mem_level,
+                            Z_DEFAULT_STRATEGY);
   if (result != Z_OK) {
     throw std::runtime_error(std::string("deflate init failed: ") +
                              m_stream.msg);
@@ -145,6 +357,9 @@ void Gz_file::open(Mode m) {
     file()->open(m);
   }
 
+  m_total_in = 0;
+  m_total_out = 0;
+
   switch (m) {
     case Mode::READ:
       init_read();
@@ -175,10 +390,17 @@ void Gz_file::do_close() {
       assert(result == Z_OK);
     } break;
     case Mode::WRITE: {
-      write_finish();
-      auto result = deflateEnd(&m_stream);
-      (void)result;
-      assert(result == Z_OK);
+      if (m_parallel) {
+        // stop the background threads even if the remaining data could not be
+        // written
+        shcore::on_leave_scope stop_threads([this]() { m_parallel.reset(); });
+        parallel_write_finish();
+      } else {
+        write_finish();
+        auto result = deflateEnd(&m_stream);
+        (void)result;
+        assert(result == Z_OK);
+      }
     } break;
     case Mode::APPEND:
       break;
@@ -27,6 +27,7 @@
 #include <zlib.h>
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -40,17 +41,29 @@ namespace mysqlshdk {
 namespace storage {
 namespace compression {
 
+/**
+ * Gzip compressed file.
+ *
+ * If Compression_options::threads is set, data being written is split into
+ * blocks, each block is compressed by one of the background threads as an
+ * independent gzip member. Members are written in the input order, result is
+ * a valid multi-member gzip stream.
+ *
+ * Reading handles both single and multi-member streams.
+ */
 class Gz_file : public Compressed_file {
  public:
   Gz_file() = delete;
 
   explicit Gz_file(std::unique_ptr<IFile> file);
 
+  Gz_file(std::unique_ptr<IFile> file, const Compression_options &options);
+
   Gz_file(const Gz_file &other) = delete;
-  Gz_file(Gz_file &&other) = default;
+  Gz_file(Gz_file &&other);
 
   Gz_file &operator=(const Gz_file &other) = delete;
-  Gz_file &operator=(Gz_file &&other) = default;
+  Gz_file &operator=(Gz_file &&other);
 
   ~Gz_file() override;
 
@@ -63,7 +76,8 @@ class Gz_file : public Compressed_file {
   }
 
   off64_t tell() const override {
-    return std::max(m_stream.total_in, m_stream.total_out);
+    return std::max(m_total_in + m_stream.total_in,
+                    m_total_out + m_stream.total_out);
   }
 
   ssize_t read(void *buffer, size_t length) override;
@@ -75,8 +89,13 @@ class Gz_file : public Compressed_file {
     size_t length;
   };
 
+  struct Parallel_writer;
+
   static constexpr const size_t CHUNK = 1 << 15;
 
+  // size of the uncompressed block compressed by a background thread
+  static constexpr const size_t PARALLEL_BLOCK = 1 << 20;
+
   static constexpr bool is_power_of_2(size_t x) {
     return ((x - 1) & x) == 0 && (x != 0);
   }
@@ -95,6 +114,9 @@ class Gz_file : public Compressed_file {
   void init_write();
   inline ssize_t do_write(void *buffer, size_t length, int flag);
   void write_finish();
+  void parallel_write(const void *buffer, size_t length);
+  void parallel_write_finish();
+  void write_members(std::size_t max_pending);
   void do_close();
 
   inline Buf_view peek(const size_t length);
@@ -103,9 +125,14 @@ class Gz_file : public Compressed_file {
     m_source.erase(m_source.begin(), m_source.begin() + length);
   }
 
-  z_stream m_stream;
+  z_stream m_stream{};
+  // totals of the preceding gzip members
+  uint64_t m_total_in = 0;
+  uint64_t m_total_out = 0;
   std::vector<uint8_t> m_source;
+  std::unique_ptr<Parallel_writer> m_parallel;
   std::optional<Mode> m_open_mode;
+  Compression_options m_options;
 };
 
 Gz_file::Buf_view Gz_file::peek(const size_t length) {
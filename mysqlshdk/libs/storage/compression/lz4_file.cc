@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/compression/lz4_file.h"
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/tracing.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+namespace {
+
+void check_lz4_status(const char *context, size_t status) {
+  if (LZ4F_isError(status)) {
+    throw std::runtime_error(std::string("lz4.") + context + ": " +
+                             LZ4F_getErrorName(status));
+  }
+}
+
+}  // namespace
+
+Lz4_file::Lz4_file(std::unique_ptr<IFile> file)
+    : Compressed_file(std::move(file)) {}
+
+Lz4_file::Lz4_file(std::unique_ptr<IFile> file,
+                   const Compression_options &options)
+    : Compressed_file(std::move(file)), m_options(options) {}
+
+Lz4_file::~Lz4_file() {
+  try {
+    if (is_open()) do_close();
+  } catch (const std::runtime_error &e) {
+    log_error("Failed to close lz4 compressed file: %s", e.what());
+  }
+}
+
+ssize_t Lz4_file::read(void *buffer, size_t length) {
+  mysqlshdk::tracing::Span span{"compression", "lz4.decompress"};
+  span.add_arg("bytes", static_cast<uint64_t>(length));
+
+  const auto out = static_cast<uint8_t *>(buffer);
+  size_t total = 0;
+
+  start_io();
+
+  while (total < length) {
+    if (m_input_offset == m_input_size) {
+      const auto bytes_read = file()->read(m_buffer.data(), m_buffer.size());
+
+      if (bytes_read < 0) {
+        throw std::runtime_error("lz4.read: error reading compressed data");
+      }
+
+      if (0 == bytes_read) {
+        break;
+      }
+
+      m_input_offset = 0;
+      m_input_size = bytes_read;
+    }
+
+    size_t out_size = length - total;
+    size_t in_size = m_input_size - m_input_offset;
+
+    check_lz4_status("read", LZ4F_decompress(m_dctx, out + total, &out_size,
+                                             m_buffer.data() + m_input_offset,
+                                             &in_size, nullptr));
+
+    m_input_offset += in_size;
+    update_io(in_size);
+    total += out_size;
+  }
+
+  finish_io();
+
+  m_offset += total;
+
+  // number of bytes being returned
+  return total;
+}
+
+ssize_t Lz4_file::write(const void *buffer, size_t length) {
+  mysqlshdk::tracing::Span span{"compression", "lz4.compress"};
+  span.add_arg("bytes", static_cast<uint64_t>(length));
+
+  auto in = static_cast<const uint8_t *>(buffer);
+  auto left = length;
+
+  start_io();
+
+  while (left > 0) {
+    const auto size = std::min(left, CHUNK);
+    const auto status = LZ4F_compressUpdate(m_cctx, m_buffer.data(),
+                                            m_buffer.size(), in, size, nullptr);
+    check_lz4_status("write", status);
+    write_output(status);
+
+    in += size;
+    left -= size;
+  }
+
+  finish_io();
+
+  m_offset += length;
+
+  return length;
+}
+
+bool Lz4_file::flush() {
+  start_io();
+
+  const auto status =
+      LZ4F_flush(m_cctx, m_buffer.data(), m_buffer.size(), nullptr);
+  check_lz4_status("flush", status);
+  write_output(status);
+
+  finish_io();
+
+  return file()->flush();
+}
+
+void Lz4_file::write_finish() {
+  start_io();
+
+  const auto status =
+      LZ4F_compressEnd(m_cctx, m_buffer.data(), m_buffer.size(), nullptr);
+  check_lz4_status("write", status);
+  write_output(status);
+
+  finish_io();
+}
+
+void Lz4_file::write_output(size_t length) {
+  if (0 == length) {
+    return;
+  }
+
+  const auto bytes_written = file()->write(m_buffer.data(), length);
+
+  if (bytes_written < 0 || static_cast<size_t>(bytes_written) != length) {
+    throw std::runtime_error("lz4.write: error writing compressed data");
+  }
+
+  update_io(length);
+}
+
+void Lz4_file::init_write() {
+  if (!m_cctx) {
+    if (LZ4F_isError(LZ4F_createCompressionContext(&m_cctx, LZ4F_VERSION))) {
+      m_cctx = nullptr;
+      throw std::runtime_error("lz4 compression context init failed");
+    }
+
+    LZ4F_preferences_t preferences{};
+    preferences.compressionLevel = m_options.level.value_or(0);
+    preferences.frameInfo.blockSizeID = LZ4F_max256KB;
+    preferences.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;
+
+    m_buffer.resize(std::max<size_t>(LZ4F_compressBound(CHUNK, &preferences),
+                                     LZ4F_HEADER_SIZE_MAX));
+
+    const auto status = LZ4F_compressBegin(m_cctx, m_buffer.data(),
+                                           m_buffer.size(), &preferences);
+    check_lz4_status("write", status);
+    write_output(status);
+  }
+}
+
+void Lz4_file::init_read() {
+  if (!m_dctx) {
+    if (LZ4F_isError(
+            LZ4F_createDecompressionContext(&m_dctx, LZ4F_VERSION))) {
+      m_dctx = nullptr;
+      throw std::runtime_error("lz4 decompression context init failed");
+    }
+
+    m_buffer.resize(READ_CHUNK);
+    m_input_offset = 0;
+    m_input_size = 0;
+  }
+}
+
+void Lz4_file::open(Mode m) {
+  if (!file()->is_open()) {
+    file()->open(m);
+  }
+
+  switch (m) {
+    case Mode::READ:
+      init_read();
+      break;
+    case Mode::WRITE:
+      init_write();
+      break;
+    case Mode::APPEND:
+      throw std::invalid_argument("append not supported for lz4 file");
+  }
+
+  m_open_mode = m;
+  m_offset = 0;
+}
+
+bool Lz4_file::is_open() const {
+  return m_open_mode.has_value() && file()->is_open();
+}
+
+void Lz4_file::close() { do_close(); }
+
+void Lz4_file::do_close() {
+  assert(is_open());
+
+  switch (*m_open_mode) {
+    case Mode::READ:
+      if (m_dctx) LZ4F_freeDecompressionContext(m_dctx);
+      m_dctx = nullptr;
+      break;
+
+    case Mode::WRITE:
+      write_finish();
+      if (m_cctx) LZ4F_freeCompressionContext(m_cctx);
+      m_cctx = nullptr;
+      break;
+
+    case Mode::APPEND:
+      break;
+  }
+
+  m_open_mode.reset();
+  m_buffer.resize(0);
+  m_input_offset = 0;
+  m_input_size = 0;
+
+  if (file()->is_open()) {
+    file()->close();
+  }
+}
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
@@ -23,20 +23,212 @@
 
 #include "mysqlshdk/libs/storage/compression/zstd_file.h"
 
+#include <zdict.h>
+
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
 #include <limits>
 #include <utility>
 
 #include "mysqlshdk/libs/storage/backend/file.h"
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/tracing.h"
 
 namespace mysqlshdk {
 namespace storage {
 namespace compression {
 
+namespace {
+
+constexpr uint32_t k_zstd_frame_magic = 0xFD2FB528;
+constexpr uint32_t k_skippable_frame_magic = 0x184D2A50;
+constexpr uint32_t k_skippable_frame_mask = 0xFFFFFFF0;
+constexpr uint32_t k_seek_table_magic = 0x184D2A5E;
+constexpr uint32_t k_seekable_magic = 0x8F92EAB1;
+// skippable frame header
+constexpr std::size_t k_skippable_header_size = 8;
+// number of frames, descriptor, magic number
+constexpr std::size_t k_seek_table_footer_size = 9;
+
+// how often timings are reported to the compression level tuner
+constexpr auto k_tuner_report_interval = std::chrono::milliseconds(100);
+
+uint32_t read_le(const uint8_t *data, std::size_t bytes) {
+  uint32_t result = 0;
+
+  for (std::size_t i = 0; i < bytes; ++i) {
+    result |= static_cast<uint32_t>(data[i]) << (8 * i);
+  }
+
+  return result;
+}
+
+bool read_at(IFile *file, uint64_t offset, void *buffer, std::size_t length) {
+  file->seek(offset);
+
+  auto ptr = static_cast<char *>(buffer);
+
+  while (length > 0) {
+    const auto bytes = file->read(ptr, length);
+
+    if (bytes <= 0) {
+      return false;
+    }
+
+    ptr += bytes;
+    length -= bytes;
+  }
+
+  return true;
+}
+
+/**
+ * Reads the seek table of the zstd seekable format, stored in a skippable
+ * frame at the end of the file.
+ */
+std::vector<uint64_t> read_seek_table(IFile *file, uint64_t size) {
+  if (size < k_skippable_header_size + k_seek_table_footer_size) {
+    return {};
+  }
+
+  uint8_t footer[k_seek_table_footer_size];
+
+  if (!read_at(file, size - sizeof(footer), footer, sizeof(footer)) ||
+      read_le(footer + 5, 4) != k_seekable_magic) {
+    return {};
+  }
+
+  const uint64_t frames = read_le(footer, 4);
+  // bit 7 - checksum flag, bits 2-6 are reserved and need to be zero
+  const auto descriptor = footer[4];
+
+  if (descriptor & 0x7C) {
+    return {};
+  }
+
+  const std::size_t entry_size = (descriptor & 0x80) ? 12 : 8;
+  const auto table_size = frames * entry_size + k_seek_table_footer_size;
+
+  if (size < table_size + k_skippable_header_size) {
+    return {};
+  }
+
+  const auto table_offset = size - table_size - k_skippable_header_size;
+  std::vector<uint8_t> table;
+  table.resize(table_size + k_skippable_header_size);
+
+  if (!read_at(file, table_offset, table.data(), table.size()) ||
+      read_le(table.data(), 4) != k_seek_table_magic ||
+      read_le(table.data() + 4, 4) != table_size) {
+    return {};
+  }
+
+  std::vector<uint64_t> result;
+  result.reserve(frames);
+  uint64_t offset = 0;
+
+  for (uint64_t i = 0; i < frames; ++i) {
+    result.emplace_back(offset);
+    offset += read_le(table.data() + k_skippable_header_size + i * entry_size,
+                      4);
+  }
+
+  if (offset != table_offset) {
+    // seek table does not describe this file
+    return {};
+  }
+
+  return result;
+}
+
+/**
+ * Finds the frames by walking the frame and block headers.
+ */
+std::vector<uint64_t> walk_frames(IFile *file, uint64_t size) {
+  std::vector<uint64_t> result;
+  uint64_t offset = 0;
+  // magic number + the largest possible frame header
+  uint8_t header[4 + 14];
+
+  while (offset < size) {
+    const auto available = static_cast<std::size_t>(
+        std::min<uint64_t>(sizeof(header), size - offset));
+
+    if (available < 8 || !read_at(file, offset, header, available)) {
+      return {};
+    }
+
+    const auto magic = read_le(header, 4);
+
+    if ((magic & k_skippable_frame_mask) == k_skippable_frame_magic) {
+      // skippable frames are not decompressed, they belong to the
+      // preceding frame
+      offset += k_skippable_header_size + read_le(header + 4, 4);
+      continue;
+    }
+
+    if (k_zstd_frame_magic != magic) {
+      return {};
+    }
+
+    result.emplace_back(offset);
+
+    const auto descriptor = header[4];
+    const auto fcs_flag = descriptor >> 6;
+    const bool single_segment = descriptor & 0x20;
+    const bool checksum = descriptor & 0x04;
+    constexpr std::size_t k_dict_id_size[] = {0, 1, 2, 4};
+    constexpr std::size_t k_fcs_size[] = {0, 2, 4, 8};
+
+    offset += 4 + 1 + (single_segment ? 0 : 1) +
+              k_dict_id_size[descriptor & 0x03] +
+              (0 == fcs_flag && single_segment ? 1 : k_fcs_size[fcs_flag]);
+
+    bool last_block = false;
+
+    while (!last_block) {
+      uint8_t block[3];
+
+      if (!read_at(file, offset, block, sizeof(block))) {
+        return {};
+      }
+
+      const auto block_header = read_le(block, 3);
+      last_block = block_header & 0x01;
+      const auto block_type = (block_header >> 1) & 0x03;
+
+      if (3 == block_type) {
+        // reserved
+        return {};
+      }
+
+      // RLE block holds a single byte
+      offset += sizeof(block) + (1 == block_type ? 1 : block_header >> 3);
+    }
+
+    if (checksum) {
+      offset += 4;
+    }
+  }
+
+  if (offset != size) {
+    return {};
+  }
+
+  return result;
+}
+
+}  // namespace
+
 Zstd_file::Zstd_file(std::unique_ptr<IFile> file)
     : Compressed_file(std::move(file)) {}
 
+Zstd_file::Zstd_file(std::unique_ptr<IFile> file,
+                     const Compression_options &options)
+    : Compressed_file(std::move(file)), m_options(options) {}
+
 Zstd_file::~Zstd_file() {
   try {
     if (is_open()) do_close();
@@ -63,6 +255,9 @@ Zstd_file::Buf_view Zstd_file::peek(const size_t length) {
 }
 
 ssize_t Zstd_file::read(void *buffer, size_t length) {
+  mysqlshdk::tracing::Span span{"compression", "zstd.decompress"};
+  span.add_arg("bytes", static_cast<uint64_t>(length));
+
   ZSTD_outBuffer obuf;
   obuf.dst = buffer;
   obuf.size = length;
@@ -135,7 +330,70 @@ ssize_t Zstd_file::do_read_mmap(ZSTD_outBuffer *obuf) {
   return obuf->pos;
 }
 
+off64_t Zstd_file::seek(off64_t offset) {
+  if (!m_open_mode.has_value() || Mode::READ != *m_open_mode ||
+      m_frames.empty() || offset < 0) {
+    throw std::logic_error("Zstd_file::seek() - not supported");
+  }
+
+  const auto target = static_cast<size_t>(offset);
+
+  // find the last frame which starts at or before the target offset
+  auto frame = std::upper_bound(
+      m_frames.begin(), m_frames.end(), target,
+      [](size_t o, const Frame &f) { return o < f.offset; });
+  const Frame start = frame == m_frames.begin() ? Frame{0, 0} : *(--frame);
+
+  if (target < m_offset || start.offset > m_offset) {
+    // current position cannot be used, start decompressing at the frame;
+    // underlying file is moved first, if it's not seekable the state of this
+    // file is not affected
+    file()->seek(start.compressed_offset);
+
+    m_buffer.clear();
+
+    const auto status = ZSTD_DCtx_reset(m_dctx, ZSTD_reset_session_only);
+
+    if (ZSTD_isError(status)) {
+      throw std::runtime_error(std::string("zstd.seek: ") +
+                               ZSTD_getErrorName(status));
+    }
+
+    m_offset = start.offset;
+  }
+
+  // decompress the remaining data within the frame
+  std::vector<char> buffer;
+  buffer.resize(std::min<size_t>(target - m_offset, CHUNK));
+
+  while (m_offset < target) {
+    if (read(buffer.data(), std::min(buffer.size(), target - m_offset)) <= 0) {
+      break;
+    }
+  }
+
+  return m_offset;
+}
+
+void Zstd_file::set_frames(std::vector<Frame> frames) {
+  std::sort(frames.begin(), frames.end(),
+            [](const Frame &l, const Frame &r) { return l.offset < r.offset; });
+  m_frames = std::move(frames);
+}
+
+void Zstd_file::end_frame() {
+  if (!m_open_mode.has_value() || Mode::WRITE != *m_open_mode) {
+    throw std::logic_error("Zstd_file::end_frame() - file is not written");
+  }
+
+  // the next write starts a new frame
+  write_finish();
+}
+
 ssize_t Zstd_file::write(const void *buffer, size_t length) {
+  mysqlshdk::tracing::Span span{"compression", "zstd.compress"};
+  span.add_arg("bytes", static_cast<uint64_t>(length));
+
   ZSTD_inBuffer ibuf;
   ibuf.size = length;
   ibuf.pos = 0;
@@ -176,13 +434,24 @@ ssize_t Zstd_file::do_write(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
 
   start_io();
 
+  const bool tuned = !!m_options.level_tuner;
+  std::chrono::steady_clock::time_point start;
+
   size_t status;
   do {
+    if (tuned) start = std::chrono::steady_clock::now();
+
     status = ZSTD_compressStream2(m_cctx, &obuf, ibuf, op);
     if (ZSTD_isError(status)) {
       throw std::runtime_error(std::string("zstd.write: ") +
                                ZSTD_getErrorName(status));
     } else {
+      if (tuned) {
+        const auto now = std::chrono::steady_clock::now();
+        m_compression_time += now - start;
+        start = now;
+      }
+
       // make sure everything is written out
       ssize_t r;
 
@@ -190,16 +459,21 @@ ssize_t Zstd_file::do_write(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
       if (r < 0)
         throw std::runtime_error("zstd.write: error writing compressed data");
 
+      if (tuned) m_write_time += std::chrono::steady_clock::now() - start;
+
       update_io(obuf.pos);
 
       obuf.pos = 0;
     }
-    // make sure the whole input buffer is consumed
-    done = (op == ZSTD_e_end) ? (status == 0) : ibuf->pos == ibuf->size;
+    // make sure the whole input buffer is consumed, when flushing make sure
+    // that there's no data left in the internal buffers
+    done = (op == ZSTD_e_continue) ? ibuf->pos == ibuf->size : (status == 0);
   } while (!done);
 
   finish_io();
 
+  if (tuned) tune_level(ZSTD_e_end == op);
+
   return ibuf->size;
 }
 
@@ -219,23 +493,39 @@ ssize_t Zstd_file::do_write_mmap(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
 
   start_io();
 
+  const bool tuned = !!m_options.level_tuner;
+  std::chrono::steady_clock::time_point start;
+
   size_t status;
   do {
+    if (tuned) start = std::chrono::steady_clock::now();
+
     status = ZSTD_compressStream2(m_cctx, &obuf, ibuf, op);
     if (ZSTD_isError(status)) {
       throw std::runtime_error(std::string("zstd.write: ") +
                                ZSTD_getErrorName(status));
     } else {
+      if (tuned) {
+        const auto now = std::chrono::steady_clock::now();
+        m_compression_time += now - start;
+        start = now;
+      }
+
       update_io(obuf.pos);
       obuf.dst = mfile->mmap_did_write(obuf.pos, &obuf.size);
       obuf.pos = 0;
+
+      if (tuned) m_write_time += std::chrono::steady_clock::now() - start;
     }
-    // make sure the whole input buffer is consumed
-    done = (op == ZSTD_e_end) ? (status == 0) : ibuf->pos == ibuf->size;
+    // make sure the whole input buffer is consumed, when flushing make sure
+    // that there's no data left in the internal buffers
+    done = (op == ZSTD_e_continue) ? ibuf->pos == ibuf->size : (status == 0);
   } while (!done);
 
   finish_io();
 
+  if (tuned) tune_level(ZSTD_e_end == op);
+
   return ibuf->size;
 }
 
@@ -245,7 +535,35 @@ void Zstd_file::init_write() {
     if (!m_cctx) {
       throw std::runtime_error("zstd compression context init failed");
     }
-    ZSTD_initCStream(m_cctx, m_clevel);
+    ZSTD_initCStream(m_cctx, m_options.level_tuner
+                                 ? m_options.level_tuner->level()
+                                 : m_options.level.value_or(1));
+
+    if (m_options.dictionary) {
+      const auto status =
+          ZSTD_CCtx_loadDictionary(m_cctx, m_options.dictionary->data(),
+                                   m_options.dictionary->size());
+
+      if (ZSTD_isError(status)) {
+        throw std::runtime_error(
+            std::string("zstd compression dictionary init failed: ") +
+            ZSTD_getErrorName(status));
+      }
+    }
+
+    if (m_options.threads > 0) {
+      // compression is done by the zstd's worker threads, data is written in
+      // order in which it was received
+      const auto status = ZSTD_CCtx_setParameter(m_cctx, ZSTD_c_nbWorkers,
+                                                 m_options.threads);
+
+      if (ZSTD_isError(status)) {
+        log_warning(
+            "Failed to enable multi-threaded zstd compression, compressing in "
+            "the current thread: %s",
+            ZSTD_getErrorName(status));
+      }
+    }
 
     auto *mfile = dynamic_cast<backend::File *>(file());
 
@@ -269,6 +587,18 @@ void Zstd_file::init_read() {
     }
     m_decompress_read_size = ZSTD_initDStream(m_dctx);
 
+    if (m_options.dictionary) {
+      const auto status =
+          ZSTD_DCtx_loadDictionary(m_dctx, m_options.dictionary->data(),
+                                   m_options.dictionary->size());
+
+      if (ZSTD_isError(status)) {
+        throw std::runtime_error(
+            std::string("zstd decompression dictionary init failed: ") +
+            ZSTD_getErrorName(status));
+      }
+    }
+
     auto *mfile = dynamic_cast<backend::File *>(file());
     // try to enable mmap if available
     if (mfile && mfile->mmap_will_read(nullptr)) {
@@ -305,6 +635,31 @@ bool Zstd_file::is_open() const {
   return m_open_mode.has_value() && file()->is_open();
 }
 
+void Zstd_file::tune_level(bool force) {
+  assert(m_options.level_tuner);
+
+  if (!force && m_compression_time + m_write_time < k_tuner_report_interval) {
+    return;
+  }
+
+  auto &tuner = *m_options.level_tuner;
+
+  tuner.report(m_compression_time, m_write_time);
+
+  m_compression_time = Compression_level_tuner::Duration{0};
+  m_write_time = Compression_level_tuner::Duration{0};
+
+  // level can be updated during compression, it's used by the next frame or,
+  // if compressing in multiple threads, by the next job
+  const auto status =
+      ZSTD_CCtx_setParameter(m_cctx, ZSTD_c_compressionLevel, tuner.level());
+
+  if (ZSTD_isError(status)) {
+    log_warning("Failed to change the zstd compression level: %s",
+                ZSTD_getErrorName(status));
+  }
+}
+
 void Zstd_file::close() { do_close(); }
 
 void Zstd_file::do_close() {
@@ -336,6 +691,53 @@ void Zstd_file::do_close() {
   }
 }
 
+std::string train_zstd_dictionary(const std::string &samples,
+                                  const std::vector<std::size_t> &sample_sizes,
+                                  std::size_t max_size) {
+  if (sample_sizes.empty()) {
+    return {};
+  }
+
+  std::string dictionary;
+  dictionary.resize(max_size);
+
+  const auto result = ZDICT_trainFromBuffer(
+      &dictionary[0], dictionary.size(), samples.data(), sample_sizes.data(),
+      static_cast<unsigned>(sample_sizes.size()));
+
+  if (ZDICT_isError(result)) {
+    log_info("Failed to train zstd dictionary: %s",
+             ZDICT_getErrorName(result));
+    return {};
+  }
+
+  dictionary.resize(result);
+
+  return dictionary;
+}
+
+std::vector<uint64_t> find_zstd_frames(IFile *file) {
+  const uint64_t size = file->file_size();
+  std::vector<uint64_t> frames;
+
+  try {
+    frames = read_seek_table(file, size);
+
+    if (frames.empty() && file->is_local()) {
+      // without a seek table, each block header needs to be read
+      frames = walk_frames(file, size);
+    }
+
+    file->seek(0);
+  } catch (const std::exception &e) {
+    log_debug("Failed to find zstd frames of '%s': %s",
+              file->full_path().masked().c_str(), e.what());
+    frames.clear();
+  }
+
+  return frames;
+}
+
 }  // namespace compression
 }  // namespace storage
 }  // namespace mysqlshdk
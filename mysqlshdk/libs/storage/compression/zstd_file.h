@@ -46,6 +46,8 @@ class Zstd_file : public Compressed_file {
 
   explicit Zstd_file(std::unique_ptr<IFile> file);
 
+  Zstd_file(std::unique_ptr<IFile> file, const Compression_options &options);
+
   Zstd_file(const Zstd_file &other) = delete;
   Zstd_file(Zstd_file &&other) = default;
 
@@ -58,9 +60,10 @@ class Zstd_file : public Compressed_file {
   bool is_open() const override;
   void close() override;
 
-  off64_t seek(off64_t) override {
-    throw std::logic_error("Zstd_file::seek() - not supported");
-  }
+  /**
+   * Seeking is supported only when reading a file whose frames were set.
+   */
+  off64_t seek(off64_t offset) override;
 
   off64_t tell() const override { return m_offset; }
 
@@ -69,6 +72,12 @@ class Zstd_file : public Compressed_file {
   ssize_t read(void *buffer, size_t length) override;
   ssize_t write(const void *buffer, size_t length) override;
 
+  bool supports_frames() const override { return true; }
+
+  void end_frame() override;
+
+  void set_frames(std::vector<Frame> frames) override;
+
  private:
   struct Buf_view {
     uint8_t *ptr;
@@ -101,6 +110,14 @@ class Zstd_file : public Compressed_file {
   void init_write();
   void write_finish();
 
+  /**
+   * Reports the collected timings to the level tuner and applies the level it
+   * selects.
+   *
+   * @param force If false, timings are reported only if enough were collected.
+   */
+  void tune_level(bool force);
+
   void do_close();
 
   ssize_t do_write(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op);
@@ -116,12 +133,44 @@ class Zstd_file : public Compressed_file {
 
   ZSTD_CStream *m_cctx = nullptr;
   ZSTD_DStream *m_dctx = nullptr;
-  int m_clevel = 1;
+  Compression_options m_options;
   std::vector<uint8_t> m_buffer;
   size_t m_decompress_read_size = 0;
   std::optional<Mode> m_open_mode;
+  // sorted by offset
+  std::vector<Frame> m_frames;
+  // timings not yet reported to the level tuner
+  Compression_level_tuner::Duration m_compression_time{0};
+  Compression_level_tuner::Duration m_write_time{0};
 };
 
+/**
+ * Trains a zstd compression dictionary.
+ *
+ * @param samples Concatenated samples.
+ * @param sample_sizes Sizes of the subsequent samples.
+ * @param max_size Maximum size of the dictionary.
+ *
+ * @returns Trained dictionary, or an empty string if dictionary could not be
+ *          trained (i.e. there were not enough samples).
+ */
+std::string train_zstd_dictionary(const std::string &samples,
+                                  const std::vector<std::size_t> &sample_sizes,
+                                  std::size_t max_size);
+
+/**
+ * Finds the independent frames of a zstd compressed file. Uses the seek table
+ * of the zstd seekable format if it is present, otherwise (local files only)
+ * walks the frame and block headers, without decompressing the data.
+ *
+ * @param file Compressed file (not the decompressing wrapper), opened for
+ *        reading. Read position is reset to the beginning.
+ *
+ * @returns compressed offsets at which the subsequent frames start, empty if
+ *          frames could not be determined
+ */
+std::vector<uint64_t> find_zstd_frames(IFile *file);
+
 }  // namespace compression
 }  // namespace storage
 }  // namespace mysqlshdk
@@ -160,6 +160,13 @@ class IDirectory {
 
   virtual std::string join_path(const std::string &a,
                                 const std::string &b) const = 0;
+
+  /**
+   * Removes leftovers of files which were not completely written (i.e.
+   * pending multipart uploads), used to clean up after an aborted operation.
+   * Completely written files are kept.
+   */
+  virtual void remove_incomplete_files() {}
 };
 
 std::unique_ptr<IDirectory> make_directory(const std::string &path);
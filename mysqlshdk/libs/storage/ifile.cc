@@ -36,6 +36,29 @@
 namespace mysqlshdk {
 namespace storage {
 
+ssize_t IFile::pread(void *buffer, size_t length, off64_t offset) {
+  const auto position = tell();
+
+  if (seek(offset) != offset) {
+    // offset is past the end of file
+    seek(position);
+    return 0;
+  }
+
+  const auto bytes = read(buffer, length);
+  seek(position);
+
+  return bytes;
+}
+
+mysqlshdk::utils::Scoped_future<ssize_t> IFile::pread_async(void *buffer,
+                                                            size_t length,
+                                                            off64_t offset) {
+  return mysqlshdk::utils::scoped_async([this, buffer, length, offset]() {
+    return pread(buffer, length, offset);
+  });
+}
+
 std::unique_ptr<IFile> make_file(const std::string &filepath,
                                  const File_options &options) {
   const auto scheme = utils::get_scheme(filepath);
@@ -51,6 +74,16 @@ std::unique_ptr<IFile> make_file(const std::string &filepath,
                                     "' for option file.mmap");
       }
     }
+
+    it = options.find("file.page_cache");
+    if (it != options.end()) {
+      try {
+        file_options.page_cache = backend::to_page_cache_preference(it->second);
+      } catch (...) {
+        throw std::invalid_argument("Invalid value '" + it->second +
+                                    "' for option file.page_cache");
+      }
+    }
     return std::make_unique<backend::File>(filepath, file_options);
   } else if (utils::scheme_matches(scheme, "http") ||
              utils::scheme_matches(scheme, "https")) {
@@ -29,6 +29,7 @@
 #include <unordered_map>
 
 #include "mysqlshdk/libs/utils/masked_value.h"
+#include "mysqlshdk/libs/utils/threads.h"
 
 #include "mysqlshdk/libs/storage/config.h"
 
@@ -75,6 +76,38 @@ class IFile {
   virtual ssize_t read(void *buffer, size_t length) = 0;
   virtual ssize_t write(const void *buffer, size_t length) = 0;
   virtual bool flush() = 0;
+
+  /**
+   * Reads up to length bytes starting at the given offset. Current position of
+   * the file is not used nor modified. File needs to be open for reading.
+   *
+   * If supports_pread() returns true, this method can be called by multiple
+   * threads at the same time, using the same handle. Default implementation
+   * uses seek() and read() and restores the previous position, such files
+   * cannot be shared between threads.
+   *
+   * @param buffer Buffer to store the data.
+   * @param length Maximum number of bytes to read.
+   * @param offset Position of the first byte to read.
+   *
+   * @returns number of bytes read, 0 if offset is past the end of file, -1 on
+   *          error
+   */
+  virtual ssize_t pread(void *buffer, size_t length, off64_t offset);
+
+  /**
+   * Whether pread() is a native, thread-safe positional read.
+   */
+  virtual bool supports_pread() const { return false; }
+
+  /**
+   * Executes pread() asynchronously. Buffer must be valid until the read is
+   * finished. Destructor of the returned future waits for the read to finish.
+   */
+  mysqlshdk::utils::Scoped_future<ssize_t> pread_async(void *buffer,
+                                                       size_t length,
+                                                       off64_t offset);
+
   virtual bool is_compressed() const { return false; }
   virtual bool is_local() const = 0;
 
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "mysqlshdk/libs/utils/crc32c.h"
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CRC32C_X86
+#include <nmmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif  // _MSC_VER
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define CRC32C_ARM
+#if defined(__linux__) && !defined(__ARM_FEATURE_CRC32)
+#include <sys/auxv.h>
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif  // HWCAP_CRC32
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#else  // !_MSC_VER
+#include <arm_acle.h>
+#endif  // !_MSC_VER
+#endif
+
+#if defined(__GNUC__)
+#define CRC32C_TARGET(x) __attribute__((target(x)))
+#else
+#define CRC32C_TARGET(x)
+#endif
+
+namespace mysqlshdk {
+namespace utils {
+
+namespace {
+
+using Crc32c = uint32_t (*)(const unsigned char *, std::size_t, uint32_t);
+
+// reflected Castagnoli polynomial
+constexpr uint32_t k_polynomial = 0x82F63B78;
+
+// reflected IEEE 802.3 polynomial
+constexpr uint32_t k_ieee_polynomial = 0xEDB88320;
+
+constexpr std::array<uint32_t, 256> make_table(uint32_t polynomial) {
+  std::array<uint32_t, 256> table{};
+
+  for (uint32_t i = 0; i < table.size(); ++i) {
+    uint32_t crc = i;
+
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ ((crc & 1) ? polynomial : 0);
+    }
+
+    table[i] = crc;
+  }
+
+  return table;
+}
+
+constexpr auto k_table = make_table(k_polynomial);
+
+constexpr auto k_ieee_table = make_table(k_ieee_polynomial);
+
+uint32_t crc32c_scalar(const unsigned char *data, std::size_t length,
+                       uint32_t crc) {
+  for (const auto end = data + length; data != end; ++data) {
+    crc = k_table[(crc ^ *data) & 0xFF] ^ (crc >> 8);
+  }
+
+  return crc;
+}
+
+#ifdef CRC32C_X86
+
+CRC32C_TARGET("sse4.2")
+uint32_t crc32c_sse42(const unsigned char *data, std::size_t length,
+                      uint32_t crc) {
+  uint64_t crc64 = crc;
+
+  for (; length >= 8; data += 8, length -= 8) {
+    uint64_t v;
+    memcpy(&v, data, sizeof(v));
+    crc64 = _mm_crc32_u64(crc64, v);
+  }
+
+  crc = static_cast<uint32_t>(crc64);
+
+  for (; length > 0; ++data, --length) {
+    crc = _mm_crc32_u8(crc, *data);
+  }
+
+  return crc;
+}
+
+bool has_sse42() {
+#ifdef _MSC_VER
+  int info[4];
+  __cpuid(info, 1);
+  return info[2] & (1 << 20);
+#else   // !_MSC_VER
+  // this is called during static initialization
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("sse4.2");
+#endif  // !_MSC_VER
+}
+
+#endif  // CRC32C_X86
+
+#ifdef CRC32C_ARM
+
+#if defined(__ARM_FEATURE_CRC32) || defined(_MSC_VER)
+#define CRC32C_ARM_TARGET
+#else
+#define CRC32C_ARM_TARGET CRC32C_TARGET("+crc")
+#endif
+
+CRC32C_ARM_TARGET
+uint32_t crc32c_arm(const unsigned char *data, std::size_t length,
+                    uint32_t crc) {
+  for (; length >= 8; data += 8, length -= 8) {
+    uint64_t v;
+    memcpy(&v, data, sizeof(v));
+    crc = __crc32cd(crc, v);
+  }
+
+  for (; length > 0; ++data, --length) {
+    crc = __crc32cb(crc, *data);
+  }
+
+  return crc;
+}
+
+bool has_arm_crc() {
+#if defined(__ARM_FEATURE_CRC32) || defined(_MSC_VER)
+  return true;
+#elif defined(__linux__)
+  return getauxval(AT_HWCAP) & HWCAP_CRC32;
+#else
+  return false;
+#endif
+}
+
+#endif  // CRC32C_ARM
+
+Crc32c select_crc32c() {
+#if defined(CRC32C_X86)
+  if (has_sse42()) {
+    return crc32c_sse42;
+  }
+#elif defined(CRC32C_ARM)
+  if (has_arm_crc()) {
+    return crc32c_arm;
+  }
+#endif
+
+  return crc32c_scalar;
+}
+
+const Crc32c g_crc32c = select_crc32c();
+
+}  // namespace
+
+uint32_t crc32c(const void *data, std::size_t length, uint32_t crc) {
+  return ~g_crc32c(static_cast<const unsigned char *>(data), length, ~crc);
+}
+
+uint32_t crc32(const void *data, std::size_t length, uint32_t crc) {
+  crc = ~crc;
+
+  for (auto p = static_cast<const unsigned char *>(data), end = p + length;
+       p != end; ++p) {
+    crc = k_ieee_table[(crc ^ *p) & 0xFF] ^ (crc >> 8);
+  }
+
+  return ~crc;
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
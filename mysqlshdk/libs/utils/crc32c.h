@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#ifndef MYSQLSHDK_LIBS_UTILS_CRC32C_H_
+#define MYSQLSHDK_LIBS_UTILS_CRC32C_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mysqlshdk {
+namespace utils {
+
+/**
+ * Computes the CRC-32C (Castagnoli) checksum of the given data. Uses the CRC
+ * instructions supported by the CPU (SSE4.2, ARMv8 CRC, detected at runtime),
+ * falls back to a table-driven implementation.
+ *
+ * The checksum can be computed incrementally, by passing the result of the
+ * previous call as the initial value.
+ *
+ * @param data Data to be checksummed.
+ * @param length Length of the data.
+ * @param crc Checksum of the preceding data, 0 for the first call.
+ *
+ * @returns Checksum of the data.
+ */
+uint32_t crc32c(const void *data, std::size_t length, uint32_t crc = 0);
+
+/**
+ * Computes the CRC-32 (IEEE 802.3, as used by zlib and the binary log)
+ * checksum of the given data, using a table-driven implementation.
+ *
+ * @param data Data to be checksummed.
+ * @param length Length of the data.
+ * @param crc Checksum of the preceding data, 0 for the first call.
+ *
+ * @returns Checksum of the data.
+ */
+uint32_t crc32(const void *data, std::size_t length, uint32_t crc = 0);
+
+}  // namespace utils
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_UTILS_CRC32C_H_
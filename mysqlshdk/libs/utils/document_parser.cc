@@ -43,6 +43,7 @@
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
 #include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/utils/dtoa.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 #include "mysqlshdk/shellcore/shell_console.h"
@@ -619,12 +620,21 @@ void Json_document_parser::get_bson_data(const std::vector<Bson_token> &tokens,
       double *number = token.ntarget;
       double temp_dbl;
       if (!number) number = &temp_dbl;
-      char *end = nullptr;
-      (*number) = std::strtod(str_number.c_str(), &end);
+      size_t consumed = 0;
+
+      try {
+        (*number) = shcore::str_to_double(str_number, &consumed);
+      } catch (const std::invalid_argument &) {
+        throw_invalid_json(missing_data, context, offset);
+      } catch (const std::out_of_range &) {
+        // same as strtod()
+        (*number) = std::strtod(str_number.c_str(), nullptr);
+        consumed = str_number.length();
+      }
 
-      // End will point to the character after the last converted character
-      // So it should be the end of the string to a complete conversion
-      if (*end != '\0') throw_invalid_json(missing_data, context, offset);
+      // The whole string has to be converted
+      if (consumed != str_number.length())
+        throw_invalid_json(missing_data, context, offset);
     }
   }
   m_source->skip_whitespaces();
@@ -857,6 +867,11 @@ void Json_document_parser::get_string(std::string *target,
   // Count holds the count of the characters read between the quotes
   bool done = false;
   while (!m_source->eof() && !done) {
+    // the regular characters are copied in bulk
+    m_source->get_until_quote_or_escape(target);
+
+    if (m_source->eof()) break;
+
     switch (m_source->peek()) {
       case '\\':
         get_char(target);
@@ -61,7 +61,21 @@
 #include <stdlib.h>
 #include <string.h>
 #include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
 #include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <version>
+
+// floating-point overloads of std::to_chars() and std::from_chars() are not
+// available in all the supported standard libraries
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define HAVE_FLOATING_POINT_CHARCONV
+#endif
 
 namespace shcore {
 
@@ -92,6 +106,14 @@ namespace shcore {
 static char *dtoa(double, int, int, int *, int *, char **, char *, size_t);
 static void dtoa_free(char *, char *, size_t);
 
+#ifdef HAVE_FLOATING_POINT_CHARCONV
+static char *shortest_dtoa(double, int, int, int *, int *, char **, char *,
+                           size_t);
+#endif  // HAVE_FLOATING_POINT_CHARCONV
+
+using Dtoa_function = char *(*)(double, int, int, int *, int *, char **, char *,
+                                size_t);
+
 /**
    @brief
    Converts a given floating point number to a zero-terminated string
@@ -155,8 +177,8 @@ static void dtoa_free(char *, char *, size_t);
      digits.
 */
 
-size_t my_gcvt(double x, my_gcvt_arg_type type, int width, char *to,
-               bool *error) {
+static size_t gcvt(double x, my_gcvt_arg_type type, int width, char *to,
+                   bool *error, Dtoa_function dtoa) {
   int decpt, sign, len, exp_len;
   char *res, *src, *end, *dst = to, *dend = dst + width;
   char buf[DTOA_BUFF_SIZE];
@@ -349,6 +371,20 @@ end:
 
   return dst - to;
 }
+
+size_t my_gcvt(double x, my_gcvt_arg_type type, int width, char *to,
+               bool *error) {
+#ifdef HAVE_FLOATING_POINT_CHARCONV
+  return gcvt(x, type, width, to, error, shortest_dtoa);
+#else   // !HAVE_FLOATING_POINT_CHARCONV
+  return gcvt(x, type, width, to, error, dtoa);
+#endif  // !HAVE_FLOATING_POINT_CHARCONV
+}
+
+size_t my_gcvt_legacy(double x, my_gcvt_arg_type type, int width, char *to,
+                      bool *error) {
+  return gcvt(x, type, width, to, error, dtoa);
+}
 #if 0
 /**
    @brief
@@ -2474,6 +2510,162 @@ ret1:
   return s0;
 }
 
+#ifdef HAVE_FLOATING_POINT_CHARCONV
+
+namespace {
+
+/**
+  Moves the digits of the output of std::to_chars() in the scientific format
+  to the beginning of the buffer, removing the trailing zeros.
+
+  @return Decimal exponent, in the format returned by dtoa().
+*/
+int scientific_to_digits(char *first, char *last, char **rve) {
+  char *exponent = std::find(first, last, 'e');
+  int decpt = 0;
+
+  std::from_chars(exponent + ('+' == exponent[1] ? 2 : 1), last, decpt);
+
+  char *dst = first + 1;
+
+  for (char *src = first + 2; src < exponent; ++src) {
+    *dst++ = *src;
+  }
+
+  while (dst > first + 1 && '0' == dst[-1]) --dst;
+
+  *dst = '\0';
+  *rve = dst;
+
+  return decpt + 1;
+}
+
+/**
+  Moves the digits of the output of std::to_chars() in the fixed format to the
+  beginning of the buffer, removing the leading and trailing zeros.
+
+  @return Decimal exponent, in the format returned by dtoa().
+*/
+int fixed_to_digits(char *first, char *last, char **rve) {
+  char *point = std::find(first, last, '.');
+  int decpt = static_cast<int>(point - first);
+  char *dst = first;
+
+  for (char *src = first; src < last; ++src) {
+    if ('.' == *src) continue;
+
+    if (dst == first && '0' == *src) {
+      --decpt;
+      continue;
+    }
+
+    *dst++ = *src;
+  }
+
+  while (dst > first && '0' == dst[-1]) --dst;
+
+  *dst = '\0';
+  *rve = dst;
+
+  return decpt;
+}
+
+}  // namespace
+
+/**
+  Replacement of dtoa(), which uses std::to_chars() to produce the digits. Only
+  the modes used by my_gcvt() are supported:
+    4 - at most ndigits significant digits
+    5 - at most ndigits digits past the decimal point
+  In both cases the shortest representation which rounds to x is returned if
+  it fits, otherwise the value is correctly rounded (ties to even) and the
+  trailing zeros are removed.
+
+  The following quirks of dtoa() are reproduced, so the output is the same:
+    - in mode 4, if ndigits <= Quick_max, dtoa() uses floating-point arithmetic
+      and returns the value rounded to ndigits, which differs from the shortest
+      representation only for denormals,
+    - if such a rounding is a tie, dtoa() falls back to the integer arithmetic
+      when x is a small integer, which does not remove the trailing zeros when
+      rounding down.
+
+  The result is always stored in the given buffer.
+*/
+static char *shortest_dtoa(double x, int mode, int ndigits, int *decpt,
+                           int *sign, char **rve, char *buf, size_t buf_size) {
+  assert(4 == mode || 5 == mode);
+
+  char *const last = buf + buf_size - 1;
+  std::to_chars_result result;
+
+  const auto to_scientific = [&](std::optional<int> precision) {
+    result = precision.has_value()
+                 ? std::to_chars(buf, last, x, std::chars_format::scientific,
+                                 *precision)
+                 : std::to_chars(buf, last, x, std::chars_format::scientific);
+    assert(std::errc{} == result.ec);
+    *decpt = scientific_to_digits(buf, result.ptr, rve);
+  };
+
+  *sign = std::signbit(x) ? 1 : 0;
+
+  if (!std::isfinite(x)) {
+    *decpt = DTOA_OVERFLOW;
+    *buf = '\0';
+    *rve = buf;
+    return buf;
+  }
+
+  x = std::fabs(x);
+
+  if (4 == mode) {
+    ndigits = std::max(ndigits, 1);
+
+    if (ndigits <= Quick_max) {
+      to_scientific(ndigits - 1);
+
+      if (x < 1e15 && x == std::trunc(x)) {
+        char exact[32];
+        result = std::to_chars(exact, exact + sizeof(exact), x,
+                               std::chars_format::fixed, 0);
+        assert(std::errc{} == result.ec);
+
+        const auto length = static_cast<int>(result.ptr - exact);
+
+        if (length > ndigits && '5' == exact[ndigits] &&
+            std::all_of(exact + ndigits + 1, result.ptr,
+                        [](char c) { return '0' == c; }) &&
+            0 == (exact[ndigits - 1] - '0') % 2) {
+          // tie rounded down, all digits are kept
+          std::copy(exact, exact + ndigits, buf);
+          buf[ndigits] = '\0';
+          *rve = buf + ndigits;
+          *decpt = length;
+        }
+      }
+    } else {
+      to_scientific({});
+
+      if (*rve - buf > ndigits) {
+        to_scientific(ndigits - 1);
+      }
+    }
+  } else {
+    to_scientific({});
+
+    if (*rve - buf - *decpt > ndigits) {
+      result = std::to_chars(buf, last, x, std::chars_format::fixed,
+                             std::max(ndigits, 0));
+      assert(std::errc{} == result.ec);
+      *decpt = fixed_to_digits(buf, result.ptr, rve);
+    }
+  }
+
+  return buf;
+}
+
+#endif  // HAVE_FLOATING_POINT_CHARCONV
+
 std::string dtoa(double x) {
   char buffer[32];
   size_t len;
@@ -2488,4 +2680,61 @@ std::string ftoa(float x) {
   return std::string(buffer, len);
 }
 
+double str_to_double(std::string_view str, size_t *consumed) {
+#ifdef HAVE_FLOATING_POINT_CHARCONV
+  const char *first = str.data();
+  const char *const last = first + str.size();
+
+  while (first < last && isspace(static_cast<unsigned char>(*first))) ++first;
+
+  // std::from_chars() does not accept the plus sign
+  if (last - first > 1 && '+' == *first && '-' != first[1] && '+' != first[1]) {
+    ++first;
+  }
+
+  double value = 0;
+  const auto result = std::from_chars(first, last, value);
+
+  if (std::errc::invalid_argument == result.ec) {
+    throw std::invalid_argument("str_to_double");
+  }
+
+  if (std::errc::result_out_of_range == result.ec) {
+    // the value is not modified, strtod() rounds it to 0 or infinity
+    value = std::strtod(std::string(first, result.ptr).c_str(), nullptr);
+
+    if (std::isinf(value)) {
+      throw std::out_of_range("str_to_double");
+    }
+  }
+
+  if (consumed) {
+    *consumed = static_cast<size_t>(result.ptr - str.data());
+  }
+
+  return value;
+#else   // !HAVE_FLOATING_POINT_CHARCONV
+  // str is not null-terminated
+  const std::string copy{str};
+  char *end = nullptr;
+
+  errno = 0;
+  const auto value = std::strtod(copy.c_str(), &end);
+
+  if (end == copy.c_str()) {
+    throw std::invalid_argument("str_to_double");
+  }
+
+  if (ERANGE == errno && std::isinf(value)) {
+    throw std::out_of_range("str_to_double");
+  }
+
+  if (consumed) {
+    *consumed = static_cast<size_t>(end - copy.c_str());
+  }
+
+  return value;
+#endif  // !HAVE_FLOATING_POINT_CHARCONV
+}
+
 }  // namespace shcore
@@ -26,16 +26,45 @@
 
 #include <cstdlib>
 #include <string>
+#include <string_view>
 
 namespace shcore {
 typedef enum { MY_GCVT_ARG_FLOAT, MY_GCVT_ARG_DOUBLE } my_gcvt_arg_type;
 
+/**
+ * Ported from the server, see dtoa.cc for the description. The digits are
+ * produced by the shortest round-trip conversion of std::to_chars(), if the
+ * standard library supports it, otherwise by my_gcvt_legacy().
+ */
 size_t my_gcvt(double x, my_gcvt_arg_type type, int width, char *to,
                bool *error);
 
+/**
+ * Same as my_gcvt(), but uses the original dtoa() conversion. The output is
+ * the same, this is kept as a reference implementation.
+ */
+size_t my_gcvt_legacy(double x, my_gcvt_arg_type type, int width, char *to,
+                      bool *error);
+
 std::string dtoa(double x);
 std::string ftoa(float x);
 
+/**
+ * Converts the initial part of the string to double, like std::strtod() but
+ * locale-independent and faster. Leading whitespace is skipped. Falls back to
+ * std::strtod() if the standard library does not support std::from_chars()
+ * for floating-point values.
+ *
+ * @param str String to be converted.
+ * @param consumed If not null, receives the number of processed characters.
+ *
+ * @returns Converted value, values which are too small are converted to 0.
+ *
+ * @throws std::invalid_argument if the string does not contain a number
+ * @throws std::out_of_range if the value is out of the range of double
+ */
+double str_to_double(std::string_view str, size_t *consumed = nullptr);
+
 }  // namespace shcore
 
 #endif  // MYSQLSHDK_LIBS_UTILS_DTOA_H_
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/find_first_of.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+    defined(_M_IX86)
+#define FIND_FIRST_OF_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif  // _MSC_VER
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define FIND_FIRST_OF_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__)
+#define FIND_FIRST_OF_TARGET(x) __attribute__((target(x)))
+#else
+#define FIND_FIRST_OF_TARGET(x)
+#endif
+
+namespace mysqlshdk {
+namespace utils {
+
+namespace {
+
+using Find_first_of = const char *(*)(const char *, const char *, const char *,
+                                      std::size_t);
+
+const char *find_first_of_scalar(const char *begin, const char *end,
+                                 const char *chars, std::size_t chars_length) {
+  const auto chars_end = chars + chars_length;
+
+  for (auto p = begin; p != end; ++p) {
+    for (auto c = chars; c != chars_end; ++c) {
+      if (*p == *c) {
+        return p;
+      }
+    }
+  }
+
+  return end;
+}
+
+#if defined(FIND_FIRST_OF_X86) || defined(FIND_FIRST_OF_NEON)
+
+inline int count_trailing_zeros(uint64_t v) {
+  assert(0 != v);
+
+#ifdef _MSC_VER
+  unsigned long idx;
+#if defined(_M_X64) || defined(_M_ARM64)
+  _BitScanForward64(&idx, v);
+#else
+  if (!_BitScanForward(&idx, static_cast<unsigned long>(v))) {
+    _BitScanForward(&idx, static_cast<unsigned long>(v >> 32));
+    idx += 32;
+  }
+#endif
+  return static_cast<int>(idx);
+#else
+  return __builtin_ctzll(v);
+#endif
+}
+
+#endif  // FIND_FIRST_OF_X86 || FIND_FIRST_OF_NEON
+
+#ifdef FIND_FIRST_OF_X86
+
+FIND_FIRST_OF_TARGET("sse4.2")
+const char *find_first_of_sse42(const char *begin, const char *end,
+                                const char *chars, std::size_t chars_length) {
+  char needles[16] = {0};
+  memcpy(needles, chars, chars_length);
+
+  const auto set = _mm_loadu_si128(reinterpret_cast<const __m128i *>(needles));
+  const auto set_length = static_cast<int>(chars_length);
+  constexpr int mode =
+      _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT;
+  auto p = begin;
+
+  for (; end - p >= 16; p += 16) {
+    const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    const auto idx = _mm_cmpestri(set, set_length, data, 16, mode);
+
+    if (idx < 16) {
+      return p + idx;
+    }
+  }
+
+  return find_first_of_scalar(p, end, chars, chars_length);
+}
+
+FIND_FIRST_OF_TARGET("avx2")
+const char *find_first_of_avx2(const char *begin, const char *end,
+                               const char *chars, std::size_t chars_length) {
+  __m256i needles[16];
+
+  for (std::size_t i = 0; i < chars_length; ++i) {
+    needles[i] = _mm256_set1_epi8(chars[i]);
+  }
+
+  auto p = begin;
+
+  for (; end - p >= 32; p += 32) {
+    const auto data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    auto matches = _mm256_cmpeq_epi8(data, needles[0]);
+
+    for (std::size_t i = 1; i < chars_length; ++i) {
+      matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(data, needles[i]));
+    }
+
+    if (const auto mask =
+            static_cast<uint32_t>(_mm256_movemask_epi8(matches))) {
+      return p + count_trailing_zeros(mask);
+    }
+  }
+
+  return find_first_of_scalar(p, end, chars, chars_length);
+}
+
+#ifdef _MSC_VER
+
+bool has_sse42() {
+  int info[4];
+  __cpuid(info, 1);
+  return info[2] & (1 << 20);
+}
+
+bool has_avx2() {
+  int info[4];
+  __cpuid(info, 0);
+
+  if (info[0] < 7) {
+    return false;
+  }
+
+  __cpuid(info, 1);
+
+  // OS needs to support saving of the YMM registers
+  constexpr int osxsave = 1 << 27;
+  constexpr int avx = 1 << 28;
+
+  if ((info[2] & (osxsave | avx)) != (osxsave | avx) ||
+      (_xgetbv(0) & 0x6) != 0x6) {
+    return false;
+  }
+
+  __cpuidex(info, 7, 0);
+  return info[1] & (1 << 5);
+}
+
+#else  // !_MSC_VER
+
+bool has_sse42() {
+  // this is called during static initialization
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("sse4.2");
+}
+
+bool has_avx2() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+}
+
+#endif  // !_MSC_VER
+
+#endif  // FIND_FIRST_OF_X86
+
+#ifdef FIND_FIRST_OF_NEON
+
+const char *find_first_of_neon(const char *begin, const char *end,
+                               const char *chars, std::size_t chars_length) {
+  uint8x16_t needles[16];
+
+  for (std::size_t i = 0; i < chars_length; ++i) {
+    needles[i] = vdupq_n_u8(static_cast<uint8_t>(chars[i]));
+  }
+
+  auto p = begin;
+
+  for (; end - p >= 16; p += 16) {
+    const auto data = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+    auto matches = vceqq_u8(data, needles[0]);
+
+    for (std::size_t i = 1; i < chars_length; ++i) {
+      matches = vorrq_u8(matches, vceqq_u8(data, needles[i]));
+    }
+
+    // narrow each byte of the result to 4 bits
+    const auto mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+
+    if (mask) {
+      return p + (count_trailing_zeros(mask) >> 2);
+    }
+  }
+
+  return find_first_of_scalar(p, end, chars, chars_length);
+}
+
+#endif  // FIND_FIRST_OF_NEON
+
+Find_first_of select_find_first_of() {
+#if defined(FIND_FIRST_OF_X86)
+  if (has_avx2()) {
+    return find_first_of_avx2;
+  }
+
+  if (has_sse42()) {
+    return find_first_of_sse42;
+  }
+#elif defined(FIND_FIRST_OF_NEON)
+  // NEON is always available on 64-bit ARM
+  return find_first_of_neon;
+#endif
+
+  return find_first_of_scalar;
+}
+
+const Find_first_of g_find_first_of = select_find_first_of();
+
+}  // namespace
+
+const char *find_first_of(const char *begin, const char *end,
+                          const char *chars, std::size_t chars_length) {
+  assert(chars_length > 0 && chars_length <= 16);
+  return g_find_first_of(begin, end, chars, chars_length);
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_FIND_FIRST_OF_H_
+#define MYSQLSHDK_LIBS_UTILS_FIND_FIRST_OF_H_
+
+#include <cstddef>
+
+namespace mysqlshdk {
+namespace utils {
+
+/**
+ * Finds the first occurrence of any of the given characters in the given
+ * range. Uses the SIMD instructions supported by the CPU (detected at runtime),
+ * falls back to a scalar implementation.
+ *
+ * @param begin Beginning of the range.
+ * @param end End of the range.
+ * @param chars Characters to look for.
+ * @param chars_length Number of characters to look for, at most 16.
+ *
+ * @returns Pointer to the first matching character or end, if none was found.
+ */
+const char *find_first_of(const char *begin, const char *end,
+                          const char *chars, std::size_t chars_length);
+
+}  // namespace utils
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_UTILS_FIND_FIRST_OF_H_
@@ -76,7 +76,13 @@ Log_sql::Log_sql(const mysqlsh::Shell_options &opts) { init(opts.get()); }
 
 Log_sql::Log_sql(const mysqlsh::Shell_options::Storage &opts) { init(opts); }
 
-Log_sql::~Log_sql() = default;
+Log_sql::~Log_sql() {
+  try {
+    write_statement_stats();
+  } catch (const std::exception &e) {
+    log_warning("%s", e.what());
+  }
+}
 
 void Log_sql::init(const mysqlsh::Shell_options::Storage &opts) {
   // only called on ctor: doesn't need protection
@@ -84,6 +90,7 @@ void Log_sql::init(const mysqlsh::Shell_options::Storage &opts) {
   m_log_sql_level = get_level_by_name(opts.log_sql);
   m_ignore_patterns = shcore::split_string(opts.log_sql_ignore, ":");
   m_ignore_patterns_all = shcore::split_string(opts.log_sql_ignore_unsafe, ":");
+  m_stats_file = opts.log_sql_stats_file;
 
   observe_notification(SN_SHELL_OPTION_CHANGED);
 }
@@ -106,6 +113,9 @@ void Log_sql::handle_notification(const std::string &name,
     std::lock_guard lock(m_mutex);
     auto v = data->get_string("value");
     m_ignore_patterns_all = shcore::split_string(v, ":");
+  } else if (option == SHCORE_LOG_SQL_STATS_FILE) {
+    std::lock_guard lock(m_mutex);
+    m_stats_file = data->get_string("value");
   }
 }
 
@@ -178,6 +188,29 @@ void Log_sql::log_connect(std::string_view endpoint_uri, uint64_t thread_id) {
   do_log(log_msg);
 }
 
+void Log_sql::record(std::string_view sql, std::chrono::nanoseconds elapsed) {
+  std::string context;
+
+  {
+    std::lock_guard lock(m_mutex);
+
+    if (!m_context_stack.empty()) context = m_context_stack.top();
+  }
+
+  m_statement_stats.record(context, sql, elapsed);
+}
+
+void Log_sql::write_statement_stats() const {
+  std::string path;
+
+  {
+    std::lock_guard lock(m_mutex);
+    path = m_stats_file;
+  }
+
+  if (!path.empty()) m_statement_stats.write(path);
+}
+
 bool Log_sql::is_off() const { return m_log_sql_level == Log_level::OFF; }
 
 std::pair<bool, bool> Log_sql::will_log(std::string_view sql, bool has_error) {
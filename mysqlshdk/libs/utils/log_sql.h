@@ -25,6 +25,7 @@
 #define MYSQLSHDK_LIBS_UTILS_LOGSQL_H_
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <stack>
 #include <string>
@@ -35,6 +36,7 @@
 #include "mysqlshdk/include/shellcore/shell_notifications.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/statement_stats.h"
 
 namespace shcore {
 
@@ -73,6 +75,19 @@ class Log_sql : public NotificationObserver {
            const shcore::Error &error);
   void log_connect(std::string_view endpoint_uri, uint64_t thread_id);
 
+  /**
+   * Records the execution time of a statement, in the current context.
+   */
+  void record(std::string_view sql, std::chrono::nanoseconds elapsed);
+
+  Statement_stats &statement_stats() { return m_statement_stats; }
+
+  /**
+   * Writes the statement statistics to the file specified by the
+   * logSql.statsFile option, if it's set.
+   */
+  void write_statement_stats() const;
+
   bool is_off() const;
 
   static Log_level parse_log_level(std::string_view tag);
@@ -93,6 +108,8 @@ class Log_sql : public NotificationObserver {
   Logger::LOG_LEVEL m_log_level = Logger::LOG_LEVEL::LOG_INFO;
   std::stack<std::string> m_context_stack;
   size_t m_num_dba_ctx{0};
+  std::string m_stats_file;
+  Statement_stats m_statement_stats;
 };
 
 // implemented in scoped_contexts.cc
@@ -37,10 +37,17 @@
 #endif  // !_WIN32
 
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdlib>
 #include <filesystem>
 #include <ios>
 #include <map>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
@@ -64,6 +71,9 @@ namespace {
  *        g_output_format but also to the file system
  *
  * NOTE: m_mutex_hooks is locked while g_mutex is locked (check do_log)
+ *
+ * In asynchronous mode messages are written to the log file without locking
+ * g_mutex, see Async_buffer.
  */
 std::recursive_mutex g_mutex;
 std::string g_output_format;
@@ -121,12 +131,137 @@ std::string check_logfile_permissions(const std::string &filepath) {
   return ret_val;
 }
 
+/**
+ * Unique ID of a logger, used to detect that thread's buffer belongs to a
+ * different logger.
+ */
+std::atomic<uint64_t> g_next_logger_id{1};
+
+/**
+ * Loggers in asynchronous mode, flushed at exit or when a fatal signal is
+ * received. Accessed from the signal handler, hence a fixed array of atomic
+ * pointers.
+ */
+constexpr std::size_t k_max_async_loggers = 16;
+std::array<std::atomic<Logger *>, k_max_async_loggers> g_async_loggers{};
+
+}  // namespace
+
+/**
+ * Single producer, single consumer ring buffer, owned by one logging thread
+ * and drained by the writer thread.
+ */
+class Logger::Async_buffer final {
+ public:
+  static constexpr std::size_t k_size = 1024;
+
+  Async_buffer() = default;
+
+  Async_buffer(const Async_buffer &) = delete;
+  Async_buffer(Async_buffer &&) = delete;
+
+  Async_buffer &operator=(const Async_buffer &) = delete;
+  Async_buffer &operator=(Async_buffer &&) = delete;
+
+  ~Async_buffer() = default;
+
+  bool push(std::string *msg) {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    const auto next = (tail + 1) % k_size;
+
+    if (next == m_head.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    m_slots[tail] = std::move(*msg);
+    m_tail.store(next, std::memory_order_release);
+
+    return true;
+  }
+
+  template <typename F>
+  std::size_t drain(F &&f) {
+    auto head = m_head.load(std::memory_order_relaxed);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    std::size_t count = 0;
+
+    while (head != tail) {
+      f(m_slots[head]);
+      m_slots[head].clear();
+      head = (head + 1) % k_size;
+      ++count;
+    }
+
+    m_head.store(head, std::memory_order_release);
+
+    return count;
+  }
+
+  std::size_t used() const {
+    const auto head = m_head.load(std::memory_order_acquire);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+
+    return (tail + k_size - head) % k_size;
+  }
+
+  /**
+   * Set when the owning thread no longer uses this buffer.
+   */
+  std::atomic<bool> closed{false};
+
+ private:
+  std::array<std::string, k_size> m_slots;
+  alignas(64) std::atomic<std::size_t> m_head{0};
+  alignas(64) std::atomic<std::size_t> m_tail{0};
+};
+
+struct Logger::Async_state {
+  Overflow_policy policy = Overflow_policy::DROP;
+
+  // protects buffers, stop
+  std::mutex mutex;
+  std::condition_variable wakeup;
+  std::condition_variable drained;
+  std::vector<std::shared_ptr<Async_buffer>> buffers;
+  bool stop = false;
+
+  std::thread writer;
+
+  // held while buffers are drained, not a mutex, as it's also used by the
+  // signal handler
+  std::atomic_flag draining = ATOMIC_FLAG_INIT;
+  std::thread::id writer_id;
+
+  std::atomic<uint64_t> dropped{0};
+  uint64_t reported_dropped = 0;
+
+  std::string write_buffer;
+};
+
+namespace {
+
+/**
+ * Buffer used by the current thread, closed when thread exits.
+ */
+struct Thread_async_buffer {
+  uint64_t logger_id = 0;
+  std::shared_ptr<void> buffer;
+  std::atomic<bool> *closed = nullptr;
+
+  ~Thread_async_buffer() {
+    if (closed) *closed = true;
+  }
+};
+
+thread_local Thread_async_buffer t_async_buffer;
+
 }  // namespace
 
 void Logger::attach_log_hook(Log_hook hook, void *user_data, bool catch_all) {
   if (hook) {
     std::lock_guard l{m_mutex_hooks};
     m_hook_list.emplace_back(hook, user_data, catch_all);
+    m_hook_count = m_hook_list.size();
   } else {
     throw std::invalid_argument("Logger::attach_log_hook: Null hook pointer");
   }
@@ -138,6 +273,7 @@ void Logger::detach_log_hook(Log_hook hook) {
     m_hook_list.remove_if([hook](const std::tuple<Log_hook, void *, bool> &i) {
       return std::get<0>(i) == hook;
     });
+    m_hook_count = m_hook_list.size();
   } else {
     throw std::invalid_argument("Logger::detach_log_hook: Null hook pointer");
   }
@@ -231,9 +367,17 @@ void Logger::do_log(const Log_entry &entry) {
 
 void Logger::do_log(const std::shared_ptr<shcore::Logger> &logger,
                     const Log_entry &entry) {
+  if (logger->m_async_enabled) {
+    if (entry.level <= logger->m_log_level) {
+      logger->log_async(entry.level, format_message(entry));
+    }
+
+    if (0 == logger->m_hook_count) return;
+  }
+
   std::lock_guard lg{g_mutex};
 
-  if (entry.level <= logger->m_log_level) {
+  if (!logger->m_async_enabled && entry.level <= logger->m_log_level) {
 #ifdef _WIN32
     if (logger->m_log_file.is_open()) {
       const auto s = format_message(entry);
@@ -260,6 +404,8 @@ void Logger::do_log(const std::shared_ptr<shcore::Logger> &logger,
 bool Logger::will_log(LOG_LEVEL level) const {
   if (level <= m_log_level) return true;
 
+  if (0 == m_hook_count) return false;
+
   std::lock_guard l{m_mutex_hooks};
 
   for (const auto &hook : m_hook_list) {
@@ -385,7 +531,8 @@ void Logger::log_to_stderr() {
 
 void Logger::stop_log_to_stderr() { detach_log_hook(&Logger::out_to_stderr); }
 
-Logger::Logger(const char *filename, bool use_stderr) : m_dont_log(0) {
+Logger::Logger(const char *filename, bool use_stderr)
+    : m_id(g_next_logger_id++), m_dont_log(0) {
   if (filename != nullptr) {
     m_log_file_name = filename;
 #ifdef _WIN32
@@ -431,6 +578,23 @@ Logger::Logger(const char *filename, bool use_stderr) : m_dont_log(0) {
 }
 
 Logger::~Logger() {
+  if (m_async) {
+    for (auto &l : g_async_loggers) {
+      auto expected = this;
+      if (l.compare_exchange_strong(expected, nullptr)) break;
+    }
+
+    {
+      std::lock_guard lock{m_async->mutex};
+      m_async->stop = true;
+    }
+
+    m_async->wakeup.notify_one();
+    m_async->writer.join();
+
+    drain_async(false);
+  }
+
 #ifdef _WIN32
   if (m_log_file.is_open()) {
     m_log_file.close();
@@ -442,6 +606,249 @@ Logger::~Logger() {
 #endif
 }
 
+void Logger::start_async(Overflow_policy policy) {
+  if (m_async || m_log_file_name.empty()) return;
+
+  m_async = std::make_unique<Async_state>();
+  m_async->policy = policy;
+
+  {
+    std::lock_guard lg{g_mutex};
+
+    static bool s_handlers_installed = false;
+
+    if (!s_handlers_installed) {
+      s_handlers_installed = true;
+      install_crash_handlers();
+    }
+  }
+
+  for (auto &l : g_async_loggers) {
+    Logger *expected = nullptr;
+    if (l.compare_exchange_strong(expected, this)) break;
+  }
+
+  m_async->writer = std::thread([this]() { writer_loop(); });
+  m_async->writer_id = m_async->writer.get_id();
+
+  m_async_enabled = true;
+}
+
+void Logger::flush() {
+  if (m_async) {
+    drain_async(false);
+  }
+}
+
+uint64_t Logger::dropped_messages() const {
+  return m_async ? m_async->dropped.load() : 0;
+}
+
+Logger::Async_buffer *Logger::async_buffer() {
+  auto &current = t_async_buffer;
+
+  if (current.logger_id != m_id) {
+    // first message of this thread, or thread switched to another logger
+    if (current.closed) *current.closed = true;
+
+    auto buffer = std::make_shared<Async_buffer>();
+
+    {
+      std::lock_guard lock{m_async->mutex};
+      m_async->buffers.emplace_back(buffer);
+    }
+
+    current.logger_id = m_id;
+    current.closed = &buffer->closed;
+    current.buffer = std::move(buffer);
+  }
+
+  return static_cast<Async_buffer *>(current.buffer.get());
+}
+
+void Logger::log_async(LOG_LEVEL level, std::string msg) {
+  const auto buffer = async_buffer();
+
+  while (!buffer->push(&msg)) {
+    if (Overflow_policy::DROP == m_async->policy) {
+      ++m_async->dropped;
+      return;
+    }
+
+    // buffer is full, wait for the writer
+    m_async->wakeup.notify_one();
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  // wake up the writer if buffer is filling up or if message is important
+  if (level <= LOG_ERROR || buffer->used() >= Async_buffer::k_size / 2) {
+    m_async->wakeup.notify_one();
+  }
+}
+
+void Logger::writer_loop() {
+  auto &state = *m_async;
+
+  while (true) {
+    {
+      std::unique_lock lock{state.mutex};
+
+      if (state.stop) break;
+
+      state.wakeup.wait_for(lock, std::chrono::milliseconds(100));
+
+      if (state.stop) break;
+    }
+
+    drain_async(false);
+  }
+}
+
+void Logger::drain_async(bool on_crash) {
+  auto &state = *m_async;
+
+  if (on_crash) {
+    // the writer thread may be in the middle of draining, give it some time
+    // to finish, unless it's the one which crashed
+    if (std::this_thread::get_id() != state.writer_id) {
+      for (int i = 0; i < 1000 && state.draining.test_and_set(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+
+    // buffers are not modified at this point, as the mutex is not locked
+    // here, the list may be in an inconsistent state, this is best effort
+    for (const auto &buffer : state.buffers) {
+      buffer->drain([this](const std::string &msg) { write_to_file(msg); });
+    }
+
+    return;
+  }
+
+  std::vector<std::shared_ptr<Async_buffer>> buffers;
+
+  {
+    std::lock_guard lock{state.mutex};
+    buffers = state.buffers;
+  }
+
+  while (state.draining.test_and_set()) {
+    std::this_thread::yield();
+  }
+
+  auto &out = state.write_buffer;
+
+  for (const auto &buffer : buffers) {
+    buffer->drain([&out](const std::string &msg) { out.append(msg); });
+  }
+
+  if (const auto dropped = state.dropped.load();
+      dropped != state.reported_dropped) {
+    const auto msg = std::to_string(dropped - state.reported_dropped) +
+                     " log messages were dropped, buffer was full";
+    out.append(format_message({"", msg, LOG_WARNING}));
+    state.reported_dropped = dropped;
+  }
+
+  if (!out.empty()) {
+    write_to_file(out);
+    out.clear();
+  }
+
+  state.draining.clear();
+
+  {
+    // remove buffers of threads which have finished
+    std::lock_guard lock{state.mutex};
+
+    state.buffers.erase(
+        std::remove_if(state.buffers.begin(), state.buffers.end(),
+                       [](const auto &b) { return b->closed && !b->used(); }),
+        state.buffers.end());
+  }
+}
+
+void Logger::write_to_file(std::string_view s) {
+#ifdef _WIN32
+  if (m_log_file.is_open()) {
+    m_log_file.write(s.data(), s.length());
+    m_log_file.flush();
+  }
+#else   // !_WIN32
+  if (m_log_file) {
+    const auto fd = fileno(m_log_file);
+
+    while (!s.empty()) {
+      const auto written = ::write(fd, s.data(), s.length());
+
+      if (written < 0) {
+        if (EINTR == errno) continue;
+        break;
+      }
+
+      s.remove_prefix(written);
+    }
+  }
+#endif  // !_WIN32
+}
+
+void Logger::flush_all_on_crash() {
+  for (auto &l : g_async_loggers) {
+    if (const auto logger = l.load()) {
+      logger->drain_async(true);
+    }
+  }
+}
+
+void Logger::install_crash_handlers() {
+  std::atexit([]() {
+    for (auto &l : g_async_loggers) {
+      if (const auto logger = l.load()) {
+        logger->drain_async(false);
+      }
+    }
+  });
+
+#ifdef _WIN32
+  static LPTOP_LEVEL_EXCEPTION_FILTER s_previous_filter =
+      SetUnhandledExceptionFilter([](EXCEPTION_POINTERS *info) -> LONG {
+        flush_all_on_crash();
+        return s_previous_filter ? s_previous_filter(info)
+                                 : EXCEPTION_CONTINUE_SEARCH;
+      });
+
+  static void (*s_previous_abort)(int) = signal(SIGABRT, [](int sig) {
+    flush_all_on_crash();
+    signal(sig, s_previous_abort);
+    raise(sig);
+  });
+#else   // !_WIN32
+  static constexpr int k_signals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL,
+                                      SIGABRT};
+  static struct sigaction s_previous[std::size(k_signals)];
+
+  struct sigaction action {};
+  action.sa_handler = [](int sig) {
+    flush_all_on_crash();
+
+    // restore the previous handler and let it handle the signal
+    for (std::size_t i = 0; i < std::size(k_signals); ++i) {
+      if (k_signals[i] == sig) {
+        sigaction(sig, &s_previous[i], nullptr);
+        break;
+      }
+    }
+
+    raise(sig);
+  };
+  sigemptyset(&action.sa_mask);
+
+  for (std::size_t i = 0; i < std::size(k_signals); ++i) {
+    sigaction(k_signals[i], &action, &s_previous[i]);
+  }
+#endif  // !_WIN32
+}
+
 Logger::LOG_LEVEL Logger::parse_log_level(const std::string &tag) {
   try {
     try {
@@ -464,6 +871,23 @@ const char *Logger::get_level_range_info() {
          "respectively.";
 }
 
+bool Logger::parse_async_mode(std::string_view value,
+                              Overflow_policy *policy) {
+  if (str_caseeq(value, "off")) return false;
+
+  if (str_caseeq(value, "drop")) {
+    *policy = Overflow_policy::DROP;
+  } else if (str_caseeq(value, "block")) {
+    *policy = Overflow_policy::BLOCK;
+  } else {
+    throw std::invalid_argument(
+        "The value of the asynchronous logging mode must be one of: off, "
+        "drop, block.");
+  }
+
+  return true;
+}
+
 void Logger::set_stderr_output_format(const std::string &format) {
   std::lock_guard l{g_mutex};
   g_output_format = format;
@@ -26,6 +26,7 @@
 
 #include <time.h>
 #include <atomic>
+#include <cstdint>
 #include <cstdarg>
 #include <fstream>
 #include <list>
@@ -74,6 +75,15 @@ class SHCORE_PUBLIC Logger final {
     LOG_LEVEL level{LOG_LEVEL::LOG_NONE};
   };
 
+  /**
+   * What happens with a message when the asynchronous buffer of the logging
+   * thread is full.
+   */
+  enum class Overflow_policy {
+    DROP,   //< message is not written, number of such messages is reported
+    BLOCK,  //< logging thread waits until there's space in the buffer
+  };
+
   using Log_hook = void (*)(const Log_entry &entry, void *);
   using Log_level_hook = void (*)(LOG_LEVEL level, void *);
 
@@ -101,6 +111,37 @@ class SHCORE_PUBLIC Logger final {
 
   void stop_log_to_stderr();
 
+  /**
+   * Switches writing to the log file to the asynchronous mode: messages are
+   * formatted by the logging thread and stored in its own lock-free buffer,
+   * a background thread drains these buffers and writes the messages to the
+   * log file. Messages logged by a single thread stay in order, messages
+   * from different threads may be written out of order. Hooks are still
+   * called synchronously.
+   *
+   * Buffers are flushed when the logger is destroyed, when the process exits
+   * or when it receives a fatal signal.
+   *
+   * Does nothing if there's no log file or asynchronous mode is already
+   * enabled.
+   *
+   * @param policy What to do when buffer of a thread is full.
+   */
+  void start_async(Overflow_policy policy);
+
+  bool is_async() const { return m_async_enabled; }
+
+  /**
+   * Writes all buffered messages to the log file, if asynchronous mode is
+   * enabled.
+   */
+  void flush();
+
+  /**
+   * Number of messages which were not written, because buffer was full.
+   */
+  uint64_t dropped_messages() const;
+
 #if __GNUC__ > 2 || (__GNUC__ == 2 && __GNUC_MINOR__ > 4)
   static void log(LOG_LEVEL level, const char *format, ...)
       __attribute__((__format__(__printf__, 2, 3)));
@@ -117,6 +158,19 @@ class SHCORE_PUBLIC Logger final {
 
   static LOG_LEVEL parse_log_level(const std::string &tag);
 
+  /**
+   * Parses value of the logAsync option.
+   *
+   * @param value One of: off, drop, block.
+   * @param policy Set to the selected policy, if value is not "off".
+   *
+   * @returns true if asynchronous mode was selected
+   *
+   * @throws std::invalid_argument if value is not valid
+   */
+  static bool parse_async_mode(std::string_view value,
+                               Overflow_policy *policy);
+
   static const char *get_level_range_info();
 
   static void set_stderr_output_format(const std::string &format);
@@ -163,6 +217,24 @@ class SHCORE_PUBLIC Logger final {
 
   bool will_log(LOG_LEVEL level) const;
 
+  class Async_buffer;
+
+  struct Async_state;
+
+  Async_buffer *async_buffer();
+
+  void log_async(LOG_LEVEL level, std::string msg);
+
+  void writer_loop();
+
+  void drain_async(bool on_crash);
+
+  void write_to_file(std::string_view s);
+
+  static void flush_all_on_crash();
+
+  static void install_crash_handlers();
+
   std::atomic<LOG_LEVEL> m_log_level{LOG_NONE};
 
 #ifdef _WIN32
@@ -175,6 +247,11 @@ class SHCORE_PUBLIC Logger final {
   mutable std::mutex m_mutex_hooks;
   std::list<std::tuple<Log_hook, void *, bool>> m_hook_list;
   std::list<std::tuple<Log_level_hook, void *>> m_level_hook_list;
+  std::atomic<std::size_t> m_hook_count{0};
+
+  const uint64_t m_id;
+  std::atomic<bool> m_async_enabled{false};
+  std::unique_ptr<Async_state> m_async;
 
   mutable std::mutex m_mutex_log_ctx;
   std::list<std::string> m_log_context;
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/memory_stats.h"
+
+#include <array>
+#include <atomic>
+
+namespace shcore {
+
+namespace {
+
+struct Counter {
+  std::atomic<uint64_t> used{0};
+  std::atomic<uint64_t> peak{0};
+  std::atomic<uint64_t> allocations{0};
+};
+
+std::array<Counter, Memory_stats::k_tags> g_counters;
+std::atomic<uint64_t> g_total_used{0};
+std::atomic<uint64_t> g_total_peak{0};
+
+constexpr std::array<std::string_view, Memory_stats::k_tags> k_names = {
+    "dump", "load", "rest", "virtualFs", "results", "scripting",
+};
+
+inline Counter &counter(Memory_tag tag) noexcept {
+  return g_counters[static_cast<std::size_t>(tag)];
+}
+
+inline void update_peak(std::atomic<uint64_t> *peak, uint64_t value) noexcept {
+  auto current = peak->load(std::memory_order_relaxed);
+
+  while (current < value &&
+         !peak->compare_exchange_weak(current, value,
+                                      std::memory_order_relaxed)) {
+  }
+}
+
+inline void add(Counter *c, uint64_t bytes) noexcept {
+  update_peak(&c->peak,
+              c->used.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+  update_peak(&g_total_peak,
+              g_total_used.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+inline void subtract(Counter *c, uint64_t bytes) noexcept {
+  c->used.fetch_sub(bytes, std::memory_order_relaxed);
+  g_total_used.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+void Memory_stats::allocated(Memory_tag tag, std::size_t bytes) noexcept {
+  auto &c = counter(tag);
+
+  c.allocations.fetch_add(1, std::memory_order_relaxed);
+  add(&c, bytes);
+}
+
+void Memory_stats::released(Memory_tag tag, std::size_t bytes) noexcept {
+  subtract(&counter(tag), bytes);
+}
+
+Memory_stats::Entry Memory_stats::entry(Memory_tag tag) noexcept {
+  const auto &c = counter(tag);
+  Entry e;
+
+  e.tag = tag;
+  e.name = name(tag);
+  e.used = c.used.load(std::memory_order_relaxed);
+  e.peak = c.peak.load(std::memory_order_relaxed);
+  e.allocations = c.allocations.load(std::memory_order_relaxed);
+
+  return e;
+}
+
+std::vector<Memory_stats::Entry> Memory_stats::entries() {
+  std::vector<Entry> result;
+  result.reserve(k_tags);
+
+  for (std::size_t i = 0; i < k_tags; ++i) {
+    result.emplace_back(entry(static_cast<Memory_tag>(i)));
+  }
+
+  return result;
+}
+
+uint64_t Memory_stats::total_used() noexcept {
+  return g_total_used.load(std::memory_order_relaxed);
+}
+
+uint64_t Memory_stats::total_peak() noexcept {
+  return g_total_peak.load(std::memory_order_relaxed);
+}
+
+void Memory_stats::reset_peak() noexcept {
+  for (auto &c : g_counters) {
+    c.peak.store(c.used.load(std::memory_order_relaxed),
+                 std::memory_order_relaxed);
+  }
+
+  g_total_peak.store(g_total_used.load(std::memory_order_relaxed),
+                     std::memory_order_relaxed);
+}
+
+std::string_view Memory_stats::name(Memory_tag tag) noexcept {
+  return k_names[static_cast<std::size_t>(tag)];
+}
+
+}  // namespace shcore
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_MEMORY_STATS_H_
+#define MYSQLSHDK_LIBS_UTILS_MEMORY_STATS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace shcore {
+
+/**
+ * Subsystems whose memory usage is accounted for.
+ */
+enum class Memory_tag {
+  DUMP,        //!< buffers of the rows which are being dumped
+  LOAD,        //!< transaction buffers and shared data of the loader
+  REST,        //!< bodies of the REST responses
+  VIRTUAL_FS,  //!< memory pages of the in-memory file system
+  RESULTS,     //!< rows of the buffered results
+  SCRIPTING,   //!< JavaScript heap, measured after garbage collection
+};
+
+/**
+ * Process-wide counters of the memory used by the main subsystems of the
+ * shell. Counters are lock-free, subsystems report their large buffers, not
+ * each individual allocation.
+ */
+class Memory_stats final {
+ public:
+  static constexpr std::size_t k_tags =
+      static_cast<std::size_t>(Memory_tag::SCRIPTING) + 1;
+
+  struct Entry {
+    Memory_tag tag;
+    std::string_view name;
+    // memory currently used
+    uint64_t used = 0;
+    // highest memory used
+    uint64_t peak = 0;
+    // number of times memory was allocated
+    uint64_t allocations = 0;
+  };
+
+  Memory_stats() = delete;
+
+  static void allocated(Memory_tag tag, std::size_t bytes) noexcept;
+
+  static void released(Memory_tag tag, std::size_t bytes) noexcept;
+
+  static Entry entry(Memory_tag tag) noexcept;
+
+  static std::vector<Entry> entries();
+
+  /**
+   * Memory currently used by all subsystems.
+   */
+  static uint64_t total_used() noexcept;
+
+  /**
+   * Highest memory used by all subsystems at the same time.
+   */
+  static uint64_t total_peak() noexcept;
+
+  /**
+   * Sets the high-water marks to the current values.
+   */
+  static void reset_peak() noexcept;
+
+  static std::string_view name(Memory_tag tag) noexcept;
+};
+
+/**
+ * Reports memory held by a buffer to the Memory_stats, memory is released
+ * when this object is destroyed. Copies report their own memory.
+ */
+class Tracked_memory final {
+ public:
+  explicit Tracked_memory(Memory_tag tag, std::size_t bytes = 0) noexcept
+      : m_tag(tag) {
+    resize(bytes);
+  }
+
+  Tracked_memory(const Tracked_memory &other) noexcept
+      : Tracked_memory(other.m_tag, other.m_bytes) {}
+
+  Tracked_memory(Tracked_memory &&other) noexcept
+      : m_tag(other.m_tag), m_bytes(other.m_bytes) {
+    other.m_bytes = 0;
+  }
+
+  Tracked_memory &operator=(const Tracked_memory &other) noexcept {
+    if (this != &other) {
+      resize(0);
+      m_tag = other.m_tag;
+      resize(other.m_bytes);
+    }
+
+    return *this;
+  }
+
+  Tracked_memory &operator=(Tracked_memory &&other) noexcept {
+    if (this != &other) {
+      resize(0);
+      m_tag = other.m_tag;
+      m_bytes = other.m_bytes;
+      other.m_bytes = 0;
+    }
+
+    return *this;
+  }
+
+  ~Tracked_memory() { resize(0); }
+
+  inline std::size_t size() const noexcept { return m_bytes; }
+
+  inline void resize(std::size_t bytes) noexcept {
+    if (bytes > m_bytes) {
+      Memory_stats::allocated(m_tag, bytes - m_bytes);
+    } else if (bytes < m_bytes) {
+      Memory_stats::released(m_tag, m_bytes - bytes);
+    }
+
+    m_bytes = bytes;
+  }
+
+  inline void grow(std::size_t bytes) noexcept { resize(m_bytes + bytes); }
+
+  inline void shrink(std::size_t bytes) noexcept {
+    resize(bytes < m_bytes ? m_bytes - bytes : 0);
+  }
+
+ private:
+  Memory_tag m_tag;
+  std::size_t m_bytes = 0;
+};
+
+}  // namespace shcore
+
+#endif  // MYSQLSHDK_LIBS_UTILS_MEMORY_STATS_H_
@@ -23,6 +23,7 @@
 
 #include "mysqlshdk/libs/utils/rate_limit.h"
 
+#include <algorithm>
 #include <ratio>
 
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -55,5 +56,35 @@ void Rate_limit::throttle(int64_t bytes) {
 
   shcore::sleep_ms(sleep_us / 1000);
 }
+
+void Shared_rate_limit::throttle(int64_t bytes) {
+  const auto bytes_limit = limit();
+
+  if (bytes_limit <= 0 || bytes <= 0) {
+    return;
+  }
+
+  constexpr int64_t k_nano = 1000000000;
+
+  const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+  const auto cost = static_cast<int64_t>(static_cast<double>(bytes) * k_nano /
+                                         bytes_limit);
+  // bucket holds at most one second worth of tokens
+  const auto full = now - k_nano;
+
+  auto replenished = m_replenished.load(std::memory_order_relaxed);
+  int64_t next;
+
+  do {
+    next = std::max(replenished, full) + cost;
+  } while (!m_replenished.compare_exchange_weak(replenished, next,
+                                                std::memory_order_relaxed));
+
+  if (next > now) {
+    shcore::sleep_ms((next - now) / 1000000);
+  }
+}
 } /* namespace utils */
 } /* namespace mysqlshdk */
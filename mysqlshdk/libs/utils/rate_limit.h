@@ -25,6 +25,7 @@
 #define MYSQLSHDK_LIBS_UTILS_RATE_LIMIT_H_
 
 #include <sys/types.h>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 
@@ -59,6 +60,55 @@ class Rate_limit final {
   std::chrono::high_resolution_clock::time_point m_last{};
 };
 
+/**
+ * Token bucket shared by multiple threads, enforces a single limit regardless
+ * of the number of threads which use it. Lock-free, limit can be changed while
+ * the bucket is in use.
+ */
+class Shared_rate_limit final {
+ public:
+  Shared_rate_limit() = default;
+
+  /**
+   * @param limit Maximum rate in bytes per second, 0 disables the limit.
+   */
+  explicit Shared_rate_limit(int64_t limit) { set_limit(limit); }
+
+  Shared_rate_limit(const Shared_rate_limit &other) = delete;
+  Shared_rate_limit(Shared_rate_limit &&other) = delete;
+
+  Shared_rate_limit &operator=(const Shared_rate_limit &other) = delete;
+  Shared_rate_limit &operator=(Shared_rate_limit &&other) = delete;
+
+  ~Shared_rate_limit() = default;
+
+  bool enabled() const { return limit() > 0; }
+
+  int64_t limit() const {
+    return m_bytes_limit.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Changes the limit, takes effect immediately in all threads.
+   *
+   * @param limit Maximum rate in bytes per second, 0 disables the limit.
+   */
+  void set_limit(int64_t limit) {
+    m_bytes_limit.store(limit, std::memory_order_relaxed);
+  }
+
+  /**
+   * Consumes the given number of bytes, sleeps if the bucket does not hold
+   * enough tokens.
+   */
+  void throttle(int64_t bytes);
+
+ private:
+  std::atomic<int64_t> m_bytes_limit{0};
+  // time (in nanoseconds) at which all consumed tokens are replenished
+  std::atomic<int64_t> m_replenished{0};
+};
+
 } /* namespace utils */
 } /* namespace mysqlshdk */
 
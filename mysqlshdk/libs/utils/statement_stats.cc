@@ -0,0 +1,482 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "mysqlshdk/libs/utils/statement_stats.h"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace shcore {
+
+namespace {
+
+// maximum number of distinct statements tracked by a single thread, the
+// remaining ones are grouped together
+constexpr std::size_t k_max_statements = 1024;
+
+constexpr std::string_view k_other_statements = "<other>";
+
+// statements are truncated to this length once normalized
+constexpr std::size_t k_max_fingerprint_length = 256;
+
+std::atomic<uint64_t> g_next_id{0};
+
+inline bool is_identifier_char(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || '_' == c || '$' == c ||
+         static_cast<unsigned char>(c) >= 0x80;
+}
+
+std::string format_ms(std::chrono::nanoseconds value) {
+  return str_format("%.3f", std::chrono::duration<double, std::milli>(value)
+                                .count());
+}
+
+}  // namespace
+
+void Latency_histogram::Data::merge(const Data &other) {
+  if (!other.count) {
+    return;
+  }
+
+  for (std::size_t i = 0; i < k_buckets; ++i) {
+    buckets[i] += other.buckets[i];
+  }
+
+  min = count ? std::min(min, other.min) : other.min;
+  max = std::max(max, other.max);
+  count += other.count;
+  total += other.total;
+}
+
+std::chrono::nanoseconds Latency_histogram::Data::percentile(
+    double percentile) const {
+  if (!count) {
+    return std::chrono::nanoseconds{0};
+  }
+
+  if (percentile <= 0.0) {
+    return min;
+  }
+
+  percentile = std::min(percentile, 100.0);
+
+  const auto target = std::max<uint64_t>(
+      1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * count)));
+  uint64_t seen = 0;
+
+  for (std::size_t i = 0; i < k_buckets; ++i) {
+    seen += buckets[i];
+
+    if (seen >= target) {
+      const std::chrono::nanoseconds limit{
+          std::chrono::microseconds{bucket_limit(i) + 1}};
+      return std::clamp(limit, min, max);
+    }
+  }
+
+  return max;
+}
+
+void Latency_histogram::record(std::chrono::nanoseconds value) {
+  const auto ns = static_cast<uint64_t>(std::max<int64_t>(0, value.count()));
+
+  m_buckets[bucket(ns / 1000)].fetch_add(1, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_total.fetch_add(ns, std::memory_order_relaxed);
+
+  auto current = m_min.load(std::memory_order_relaxed);
+
+  while (ns < current && !m_min.compare_exchange_weak(
+                             current, ns, std::memory_order_relaxed)) {
+  }
+
+  current = m_max.load(std::memory_order_relaxed);
+
+  while (ns > current && !m_max.compare_exchange_weak(
+                             current, ns, std::memory_order_relaxed)) {
+  }
+}
+
+Latency_histogram::Data Latency_histogram::data() const {
+  Data data;
+
+  for (std::size_t i = 0; i < k_buckets; ++i) {
+    data.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+  }
+
+  data.count = m_count.load(std::memory_order_relaxed);
+  data.total =
+      std::chrono::nanoseconds{m_total.load(std::memory_order_relaxed)};
+
+  if (data.count) {
+    data.min =
+        std::chrono::nanoseconds{m_min.load(std::memory_order_relaxed)};
+    data.max =
+        std::chrono::nanoseconds{m_max.load(std::memory_order_relaxed)};
+  }
+
+  return data;
+}
+
+void Latency_histogram::reset() {
+  for (auto &b : m_buckets) {
+    b.store(0, std::memory_order_relaxed);
+  }
+
+  m_count.store(0, std::memory_order_relaxed);
+  m_total.store(0, std::memory_order_relaxed);
+  m_min.store(UINT64_MAX, std::memory_order_relaxed);
+  m_max.store(0, std::memory_order_relaxed);
+}
+
+std::size_t Latency_histogram::bucket(uint64_t us) {
+  if (us < k_sub_buckets) {
+    return us;
+  }
+
+  const std::size_t exponent = std::bit_width(us) - 1;
+
+  if (exponent > k_max_exponent) {
+    return k_buckets - 1;
+  }
+
+  const auto shift = exponent - k_sub_bucket_bits;
+  const auto sub_bucket = (us >> shift) - k_sub_buckets;
+
+  return k_sub_buckets + shift * k_sub_buckets + sub_bucket;
+}
+
+uint64_t Latency_histogram::bucket_limit(std::size_t bucket) {
+  if (bucket < k_sub_buckets) {
+    return bucket;
+  }
+
+  const auto shift = (bucket - k_sub_buckets) / k_sub_buckets;
+  const auto sub_bucket = (bucket - k_sub_buckets) % k_sub_buckets;
+  const auto lower = static_cast<uint64_t>(k_sub_buckets + sub_bucket)
+                     << shift;
+
+  return lower + (uint64_t{1} << shift) - 1;
+}
+
+struct Statement_stats::Thread_stats {
+  // map is modified only by the owning thread, while holding the mutex, so
+  // the owner can read it without locking
+  std::mutex mutex;
+  // key is: context + '\0' + fingerprint
+  std::unordered_map<std::string, std::unique_ptr<Latency_histogram>>
+      histograms;
+};
+
+Statement_stats::Statement_stats() : m_id(g_next_id++) {}
+
+Statement_stats::~Statement_stats() = default;
+
+std::string Statement_stats::fingerprint(std::string_view sql) {
+  std::string result;
+  result.reserve(std::min(sql.length(), k_max_fingerprint_length) + 3);
+
+  bool space = false;
+
+  const auto append = [&](char c) {
+    if (space && !result.empty()) {
+      result += ' ';
+    }
+
+    space = false;
+    result += c;
+  };
+
+  const auto placeholder = [&]() {
+    // lists of literals are collapsed: (?, ?, ?) -> (?)
+    if (result.length() >= 2 && ',' == result.back() &&
+        '?' == result[result.length() - 2]) {
+      result.pop_back();
+      space = false;
+    } else {
+      append('?');
+    }
+  };
+
+  const auto length = sql.length();
+  std::size_t i = 0;
+
+  while (i < length && result.length() < k_max_fingerprint_length) {
+    const auto c = sql[i];
+
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      space = true;
+      ++i;
+    } else if ('\'' == c || '"' == c) {
+      // string literal
+      ++i;
+
+      while (i < length) {
+        if ('\\' == sql[i]) {
+          i += 2;
+        } else if (c == sql[i]) {
+          ++i;
+
+          if (i < length && c == sql[i]) {
+            // doubled quote
+            ++i;
+          } else {
+            break;
+          }
+        } else {
+          ++i;
+        }
+      }
+
+      placeholder();
+    } else if ('`' == c) {
+      // quoted identifier, copied verbatim
+      append(c);
+
+      for (++i; i < length; ++i) {
+        result += sql[i];
+
+        if ('`' == sql[i]) {
+          ++i;
+          break;
+        }
+      }
+    } else if ('/' == c && i + 1 < length && '*' == sql[i + 1]) {
+      const auto end = sql.find("*/", i + 2);
+      i = std::string_view::npos == end ? length : end + 2;
+      space = true;
+    } else if ('#' == c ||
+               ('-' == c && i + 2 < length && '-' == sql[i + 1] &&
+                std::isspace(static_cast<unsigned char>(sql[i + 2])))) {
+      const auto end = sql.find('\n', i);
+      i = std::string_view::npos == end ? length : end + 1;
+      space = true;
+    } else if ((std::isdigit(static_cast<unsigned char>(c)) &&
+                (result.empty() || space ||
+                 !is_identifier_char(result.back()))) ||
+               (('-' == c || '+' == c) && i + 1 < length &&
+                std::isdigit(static_cast<unsigned char>(sql[i + 1])) &&
+                (result.empty() ||
+                 std::string_view{"(,=<>"}.find(result.back()) !=
+                     std::string_view::npos))) {
+      // numeric literal, including hexadecimal and exponent notation
+      for (++i; i < length; ++i) {
+        const auto n = sql[i];
+
+        if (('+' == n || '-' == n) &&
+            ('e' == sql[i - 1] || 'E' == sql[i - 1])) {
+          continue;
+        }
+
+        if (!std::isalnum(static_cast<unsigned char>(n)) && '.' != n) {
+          break;
+        }
+      }
+
+      placeholder();
+    } else {
+      append(c);
+      ++i;
+    }
+  }
+
+  if (i < length) {
+    result += "...";
+  }
+
+  return result;
+}
+
+void Statement_stats::record(std::string_view context, std::string_view sql,
+                             std::chrono::nanoseconds elapsed) {
+  const auto stats = thread_stats();
+
+  std::string key;
+  key.reserve(context.length() + 1 + k_max_fingerprint_length);
+  key.append(context);
+  key += '\0';
+  key.append(fingerprint(sql));
+
+  auto it = stats->histograms.find(key);
+
+  if (stats->histograms.end() == it) {
+    if (stats->histograms.size() >= k_max_statements) {
+      key.resize(context.length() + 1);
+      key.append(k_other_statements);
+      it = stats->histograms.find(key);
+    }
+
+    if (stats->histograms.end() == it) {
+      std::lock_guard lock{stats->mutex};
+      it = stats->histograms
+               .emplace(std::move(key), std::make_unique<Latency_histogram>())
+               .first;
+    }
+  }
+
+  it->second->record(elapsed);
+}
+
+std::vector<Statement_stats::Entry> Statement_stats::entries() const {
+  std::vector<std::shared_ptr<Thread_stats>> threads;
+
+  {
+    std::lock_guard lock{m_mutex};
+    threads = m_threads;
+  }
+
+  std::map<std::string, Latency_histogram::Data> merged;
+
+  for (const auto &thread : threads) {
+    std::lock_guard lock{thread->mutex};
+
+    for (const auto &h : thread->histograms) {
+      merged[h.first].merge(h.second->data());
+    }
+  }
+
+  std::vector<Entry> result;
+  result.reserve(merged.size());
+
+  for (auto &m : merged) {
+    if (!m.second.count) {
+      continue;
+    }
+
+    const auto separator = m.first.find('\0');
+    auto &entry = result.emplace_back();
+
+    entry.context = m.first.substr(0, separator);
+    entry.fingerprint = m.first.substr(separator + 1);
+    entry.latency = std::move(m.second);
+  }
+
+  std::stable_sort(result.begin(), result.end(),
+                   [](const Entry &l, const Entry &r) {
+                     return l.latency.total > r.latency.total;
+                   });
+
+  return result;
+}
+
+std::string Statement_stats::format() const {
+  std::vector<std::vector<std::string>> rows;
+
+  rows.push_back({"Count", "Total (ms)", "Avg (ms)", "P50 (ms)", "P90 (ms)",
+                  "P99 (ms)", "Max (ms)", "Context", "Statement"});
+
+  for (const auto &entry : entries()) {
+    const auto &l = entry.latency;
+
+    rows.push_back({std::to_string(l.count), format_ms(l.total),
+                    format_ms(l.average()), format_ms(l.percentile(50)),
+                    format_ms(l.percentile(90)), format_ms(l.percentile(99)),
+                    format_ms(l.max), entry.context, entry.fingerprint});
+  }
+
+  const auto columns = rows.front().size();
+  std::vector<std::size_t> widths(columns, 0);
+
+  for (const auto &row : rows) {
+    for (std::size_t i = 0; i < columns; ++i) {
+      widths[i] = std::max(widths[i], row[i].length());
+    }
+  }
+
+  std::string result;
+
+  for (const auto &row : rows) {
+    std::string line;
+
+    for (std::size_t i = 0; i < columns; ++i) {
+      if (i) {
+        line += "  ";
+      }
+
+      // numbers are aligned to the right, text to the left
+      const auto padding = std::string(widths[i] - row[i].length(), ' ');
+
+      if (i < columns - 2) {
+        line += padding + row[i];
+      } else if (i < columns - 1) {
+        line += row[i] + padding;
+      } else {
+        line += row[i];
+      }
+    }
+
+    result += line;
+    result += '\n';
+  }
+
+  return result;
+}
+
+void Statement_stats::write(const std::string &path) const {
+  if (!create_file(path, format())) {
+    throw std::runtime_error("Failed to write statement statistics to '" +
+                             path + "': " + get_last_error());
+  }
+}
+
+void Statement_stats::reset() {
+  std::lock_guard lock{m_mutex};
+
+  for (const auto &thread : m_threads) {
+    std::lock_guard thread_lock{thread->mutex};
+
+    for (const auto &h : thread->histograms) {
+      h.second->reset();
+    }
+  }
+}
+
+Statement_stats::Thread_stats *Statement_stats::thread_stats() {
+  // statistics of the current thread, for each instance of this class; IDs
+  // are never reused, instance keeps its statistics alive
+  thread_local std::unordered_map<uint64_t, Thread_stats *> t_stats;
+
+  auto &stats = t_stats[m_id];
+
+  if (!stats) {
+    auto ptr = std::make_shared<Thread_stats>();
+    stats = ptr.get();
+
+    std::lock_guard lock{m_mutex};
+    m_threads.emplace_back(std::move(ptr));
+  }
+
+  return stats;
+}
+
+}  // namespace shcore
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#ifndef MYSQLSHDK_LIBS_UTILS_STATEMENT_STATS_H_
+#define MYSQLSHDK_LIBS_UTILS_STATEMENT_STATS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace shcore {
+
+/**
+ * Lock-free histogram of latencies, with log-linear buckets (HDR-style). Each
+ * power of two is divided into 16 buckets, providing ~6% precision, values
+ * are recorded with microsecond resolution.
+ */
+class Latency_histogram final {
+ public:
+  static constexpr std::size_t k_sub_bucket_bits = 4;
+  static constexpr std::size_t k_sub_buckets = 1 << k_sub_bucket_bits;
+  // values above 2^36 us (~19 hours) are recorded in the last bucket
+  static constexpr std::size_t k_max_exponent = 36;
+  static constexpr std::size_t k_buckets =
+      k_sub_buckets + (k_max_exponent - k_sub_bucket_bits + 1) * k_sub_buckets;
+
+  /**
+   * Snapshot of the histogram.
+   */
+  struct Data {
+    std::vector<uint64_t> buckets = std::vector<uint64_t>(k_buckets);
+    uint64_t count = 0;
+    std::chrono::nanoseconds total{0};
+    std::chrono::nanoseconds min{0};
+    std::chrono::nanoseconds max{0};
+
+    void merge(const Data &other);
+
+    /**
+     * Provides the highest value which is equivalent to the value at the
+     * given percentile.
+     *
+     * @param percentile Value in range [0, 100].
+     */
+    std::chrono::nanoseconds percentile(double percentile) const;
+
+    std::chrono::nanoseconds average() const {
+      return count ? total / static_cast<int64_t>(count) : total;
+    }
+  };
+
+  Latency_histogram() = default;
+
+  Latency_histogram(const Latency_histogram &) = delete;
+  Latency_histogram(Latency_histogram &&) = delete;
+
+  Latency_histogram &operator=(const Latency_histogram &) = delete;
+  Latency_histogram &operator=(Latency_histogram &&) = delete;
+
+  ~Latency_histogram() = default;
+
+  void record(std::chrono::nanoseconds value);
+
+  Data data() const;
+
+  void reset();
+
+  static std::size_t bucket(uint64_t us);
+
+  /**
+   * Highest value (in microseconds) which belongs to the given bucket.
+   */
+  static uint64_t bucket_limit(std::size_t bucket);
+
+ private:
+  std::array<std::atomic<uint64_t>, k_buckets> m_buckets{};
+  std::atomic<uint64_t> m_count{0};
+  std::atomic<uint64_t> m_total{0};
+  std::atomic<uint64_t> m_min{UINT64_MAX};
+  std::atomic<uint64_t> m_max{0};
+};
+
+/**
+ * Latency statistics of the executed statements, grouped by the SQL logging
+ * context and the statement fingerprint. Each thread records into its own
+ * set of histograms, these are merged when the statistics are read.
+ */
+class Statement_stats final {
+ public:
+  struct Entry {
+    std::string context;
+    std::string fingerprint;
+    Latency_histogram::Data latency;
+  };
+
+  Statement_stats();
+
+  Statement_stats(const Statement_stats &) = delete;
+  Statement_stats(Statement_stats &&) = delete;
+
+  Statement_stats &operator=(const Statement_stats &) = delete;
+  Statement_stats &operator=(Statement_stats &&) = delete;
+
+  ~Statement_stats();
+
+  /**
+   * Normalizes the statement: literals are replaced with '?', lists of
+   * literals are collapsed, comments are removed and whitespace is
+   * normalized. Only the beginning of long statements is used.
+   */
+  static std::string fingerprint(std::string_view sql);
+
+  void record(std::string_view context, std::string_view sql,
+              std::chrono::nanoseconds elapsed);
+
+  /**
+   * Provides the statistics merged from all threads, sorted by the total
+   * time, descending.
+   */
+  std::vector<Entry> entries() const;
+
+  /**
+   * Formats the statistics as a table, times are in milliseconds.
+   */
+  std::string format() const;
+
+  /**
+   * Writes the formatted statistics to the given file.
+   */
+  void write(const std::string &path) const;
+
+  void reset();
+
+ private:
+  struct Thread_stats;
+
+  Thread_stats *thread_stats();
+
+  const uint64_t m_id;
+  mutable std::mutex m_mutex;
+  std::vector<std::shared_ptr<Thread_stats>> m_threads;
+};
+
+}  // namespace shcore
+
+#endif  // MYSQLSHDK_LIBS_UTILS_STATEMENT_STATS_H_
@@ -79,6 +79,25 @@ class Synchronized_queue final {
     return {};
   }
 
+  /**
+   * Pops the first element only if it satisfies the given predicate, doesn't
+   * wait.
+   */
+  template <class Predicate>
+  std::optional<T> try_pop_if(Predicate &&pred) {
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    for (auto &queue : m_queues) {
+      if (!queue.empty()) {
+        if (!pred(std::as_const(queue.front()))) {
+          return {};
+        }
+
+        return unsynchronized_pop();
+      }
+    }
+    return {};
+  }
+
   /**
    * Method that push to the queue n guard objects that signals to consumer
    * threads to complete operation.
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/thread_affinity.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif  // __linux__
+
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+namespace {
+
+int to_cpu(std::string_view value, const std::string &list) {
+  int cpu = -1;
+  const auto end = value.data() + value.length();
+  const auto result = std::from_chars(value.data(), end, cpu);
+
+  if (result.ec != std::errc{} || result.ptr != end || cpu < 0) {
+    throw std::invalid_argument("Invalid CPU list: '" + list + "'");
+  }
+
+  return cpu;
+}
+
+std::string format_cpus(const std::vector<int> &cpus) {
+  return shcore::str_join(cpus, ",",
+                          [](int cpu) { return std::to_string(cpu); });
+}
+
+std::vector<int> allowed_cpus() {
+  std::vector<int> cpus;
+
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+
+  if (0 == sched_getaffinity(0, sizeof(set), &set)) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set)) {
+        cpus.emplace_back(cpu);
+      }
+    }
+  }
+#endif  // __linux__
+
+  if (cpus.empty()) {
+    const auto count = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned int cpu = 0; cpu < count; ++cpu) {
+      cpus.emplace_back(static_cast<int>(cpu));
+    }
+  }
+
+  return cpus;
+}
+
+Cpu_topology read_cpu_topology() {
+  const auto allowed = allowed_cpus();
+  Cpu_topology topology;
+
+#ifdef __linux__
+  try {
+    static constexpr auto k_node_dir = "/sys/devices/system/node/";
+    std::string data;
+
+    if (shcore::load_text_file(std::string{k_node_dir} + "online", data)) {
+      for (const auto node : parse_cpu_list(data)) {
+        if (!shcore::load_text_file(std::string{k_node_dir} + "node" +
+                                        std::to_string(node) + "/cpulist",
+                                    data)) {
+          continue;
+        }
+
+        auto cpus = parse_cpu_list(data);
+        std::vector<int> node_cpus;
+
+        std::set_intersection(cpus.begin(), cpus.end(), allowed.begin(),
+                              allowed.end(), std::back_inserter(node_cpus));
+
+        // nodes with memory only or with CPUs which are not available to
+        // this process are skipped
+        if (!node_cpus.empty()) {
+          topology.emplace_back(std::move(node_cpus));
+        }
+      }
+    }
+  } catch (const std::exception &e) {
+    log_warning("Failed to read the NUMA topology: %s", e.what());
+    topology.clear();
+  }
+#endif  // __linux__
+
+  if (topology.empty()) {
+    topology.emplace_back(allowed);
+  }
+
+  return topology;
+}
+
+}  // namespace
+
+Thread_affinity to_thread_affinity(const std::string &value) {
+  if (shcore::str_caseeq(value, "none")) return Thread_affinity::NONE;
+  if (shcore::str_caseeq(value, "node")) return Thread_affinity::NODE;
+  if (shcore::str_caseeq(value, "core")) return Thread_affinity::CORE;
+
+  throw std::invalid_argument(
+      "Invalid thread affinity '" + value +
+      "', allowed values: none, node, core");
+}
+
+std::string to_string(Thread_affinity affinity) {
+  switch (affinity) {
+    case Thread_affinity::NONE:
+      return "none";
+
+    case Thread_affinity::NODE:
+      return "node";
+
+    case Thread_affinity::CORE:
+      return "core";
+  }
+
+  throw std::logic_error("Unknown value of Thread_affinity");
+}
+
+std::vector<int> parse_cpu_list(const std::string &list) {
+  std::vector<int> cpus;
+
+  for (const auto &range : shcore::str_split(shcore::str_strip(list), ",")) {
+    const auto dash = range.find('-');
+    const auto first = to_cpu(std::string_view{range}.substr(0, dash), list);
+    const auto last =
+        std::string::npos == dash
+            ? first
+            : to_cpu(std::string_view{range}.substr(dash + 1), list);
+
+    if (last < first) {
+      throw std::invalid_argument("Invalid CPU list: '" + list + "'");
+    }
+
+    for (auto cpu = first; cpu <= last; ++cpu) {
+      cpus.emplace_back(cpu);
+    }
+  }
+
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+  return cpus;
+}
+
+const Cpu_topology &cpu_topology() {
+  static const Cpu_topology s_topology = read_cpu_topology();
+  return s_topology;
+}
+
+std::vector<int> worker_cpus(const Cpu_topology &topology,
+                             Thread_affinity affinity, std::size_t index) {
+  if (Thread_affinity::NONE == affinity || topology.empty()) {
+    return {};
+  }
+
+  const auto &node = topology[index % topology.size()];
+
+  if (node.empty() || Thread_affinity::NODE == affinity) {
+    return node;
+  }
+
+  return {node[(index / topology.size()) % node.size()]};
+}
+
+bool set_thread_affinity(const std::vector<int> &cpus) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+
+  for (const auto cpu : cpus) {
+    if (cpu < CPU_SETSIZE) {
+      CPU_SET(cpu, &set);
+    }
+  }
+
+  return CPU_COUNT(&set) > 0 &&
+         0 == pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else   // !__linux__
+  (void)cpus;
+  return false;
+#endif  // !__linux__
+}
+
+void pin_worker_thread(Thread_affinity affinity, std::size_t index) {
+  const auto cpus = worker_cpus(cpu_topology(), affinity, index);
+
+  if (cpus.empty()) {
+    return;
+  }
+
+  if (set_thread_affinity(cpus)) {
+    log_debug("Worker %zu pinned to CPUs: %s", index,
+              format_cpus(cpus).c_str());
+  } else {
+    log_warning("Failed to pin worker %zu to CPUs: %s", index,
+                format_cpus(cpus).c_str());
+  }
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
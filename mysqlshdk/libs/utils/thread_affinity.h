@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_THREAD_AFFINITY_H_
+#define MYSQLSHDK_LIBS_UTILS_THREAD_AFFINITY_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace mysqlshdk {
+namespace utils {
+
+/**
+ * How worker threads are placed on the CPUs of the host.
+ */
+enum class Thread_affinity {
+  // threads are not pinned, the OS scheduler is free to migrate them
+  NONE,
+  // threads are spread evenly over the NUMA nodes, each one is pinned to all
+  // CPUs of its node
+  NODE,
+  // like NODE, but each thread is pinned to a single CPU of its node
+  CORE,
+};
+
+/**
+ * Converts the value of the util.threadAffinity option.
+ *
+ * @throws std::invalid_argument If value is not valid.
+ */
+Thread_affinity to_thread_affinity(const std::string &value);
+
+std::string to_string(Thread_affinity affinity);
+
+/**
+ * CPUs which belong to each NUMA node.
+ */
+using Cpu_topology = std::vector<std::vector<int>>;
+
+/**
+ * Parses a list of CPUs in the format used by the kernel, i.e. "0-3,8,10-11".
+ *
+ * @throws std::invalid_argument If list is malformed.
+ */
+std::vector<int> parse_cpu_list(const std::string &list);
+
+/**
+ * Topology of the host, limited to the CPUs this process is allowed to run
+ * on. If information about NUMA nodes is not available, all CPUs are reported
+ * as a single node. Topology is read once.
+ */
+const Cpu_topology &cpu_topology();
+
+/**
+ * Selects CPUs for the worker with the given index. Consecutive workers are
+ * assigned to different nodes, so that they are spread evenly.
+ *
+ * @returns CPUs the worker should be pinned to, empty if it should not be
+ *          pinned.
+ */
+std::vector<int> worker_cpus(const Cpu_topology &topology,
+                             Thread_affinity affinity, std::size_t index);
+
+/**
+ * Pins the current thread to the given CPUs.
+ *
+ * @returns false if affinity could not be set or is not supported on this
+ *          platform.
+ */
+bool set_thread_affinity(const std::vector<int> &cpus);
+
+/**
+ * Pins the current worker thread according to the given affinity. This should
+ * be called before the worker allocates its buffers: memory is allocated on
+ * the node which first touches it, pinning the thread beforehand makes the
+ * buffers node-local.
+ */
+void pin_worker_thread(Thread_affinity affinity, std::size_t index);
+
+}  // namespace utils
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_UTILS_THREAD_AFFINITY_H_
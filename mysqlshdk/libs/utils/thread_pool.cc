@@ -23,15 +23,31 @@
 
 #include "mysqlshdk/libs/utils/thread_pool.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
 
 namespace shcore {
 
+namespace {
+
+// maximum number of tasks a worker takes from the global queue at once
+constexpr std::size_t k_max_batch_size = 16;
+
+}  // namespace
+
 Thread_pool::Thread_pool(uint64_t threads)
     : m_threads(threads),
       m_active_threads(threads),
       m_workers(threads),
-      m_worker_exceptions(threads) {}
+      m_worker_exceptions(threads) {
+  m_worker_queues.reserve(threads);
+
+  for (auto i = decltype(m_threads){0}; i < m_threads; ++i) {
+    m_worker_queues.emplace_back(std::make_unique<Worker_queue>());
+  }
+}
 
 Thread_pool::~Thread_pool() {
   kill_threads();
@@ -43,24 +59,38 @@ void Thread_pool::start_threads() {
     m_workers[i] = mysqlsh::spawn_scoped_thread(
         [this](auto id) {
           try {
+            // set once this worker receives the shutdown marker, remaining
+            // tasks which are in the queues of other workers are still
+            // executed
+            bool shutdown = false;
+
             while (true) {
-              auto task = m_worker_tasks.pop();
+              auto task = pop_local(id);
 
-              if (m_worker_interrupt) {
-                return;
+              if (!task) {
+                task = steal(id);
               }
 
-              if (!task.produce_data) {
-                break;
-              }
+              if (!task) {
+                if (shutdown) {
+                  break;
+                }
+
+                task = m_worker_tasks.pop();
 
-              auto data = task.produce_data();
+                if (m_worker_interrupt) {
+                  return;
+                }
 
-              m_main_thread_tasks.push(
-                  [data = std::move(data),
-                   process_data = std::move(task.process_data)]() mutable {
-                    process_data(std::move(data));
-                  });
+                if (!task->produce_data) {
+                  shutdown = true;
+                  continue;
+                }
+
+                fill_local(id, task->priority);
+              }
+
+              execute(&*task);
 
               if (m_worker_interrupt) {
                 return;
@@ -78,10 +108,11 @@ void Thread_pool::start_threads() {
 }
 
 void Thread_pool::add_task(Producer &&fetch_data, Processor &&process_data,
-                           Priority priority) {
+                           Priority priority, Processing processing) {
   if (!m_all_tasks_pushed) {
-    m_worker_tasks.push({std::move(fetch_data), std::move(process_data)},
-                        priority);
+    m_worker_tasks.push(
+        {std::move(fetch_data), std::move(process_data), processing, priority},
+        priority);
   } else {
     throw std::logic_error(
         "Cannot add a task after the worker queue has been shut down");
@@ -150,6 +181,94 @@ void Thread_pool::wait_for_process() {
   }
 }
 
+void Thread_pool::execute(Task *task) {
+  auto data = task->produce_data();
+
+  if (Processing::PARALLEL == task->processing) {
+    task->process_data(std::move(data));
+  } else {
+    m_main_thread_tasks.push(
+        [data = std::move(data),
+         process_data = std::move(task->process_data)]() mutable {
+          process_data(std::move(data));
+        });
+  }
+}
+
+std::optional<Thread_pool::Task> Thread_pool::pop_local(std::size_t id) {
+  auto &queue = *m_worker_queues[id];
+  std::lock_guard lock{queue.mutex};
+
+  if (queue.tasks.empty()) {
+    return {};
+  }
+
+  auto task = std::move(queue.tasks.front());
+  queue.tasks.pop_front();
+
+  return task;
+}
+
+std::optional<Thread_pool::Task> Thread_pool::steal(std::size_t id) {
+  // start with the next worker, so that victims are evenly distributed
+  for (std::size_t i = 1; i < m_threads; ++i) {
+    auto &queue = *m_worker_queues[(id + i) % m_threads];
+    std::lock_guard lock{queue.mutex};
+
+    if (!queue.tasks.empty()) {
+      // the owner takes tasks from the front, steal from the back
+      auto task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+
+      return task;
+    }
+  }
+
+  return {};
+}
+
+void Thread_pool::fill_local(std::size_t id, Priority priority) {
+  // take a fair share of the remaining tasks, if there's only a few of them,
+  // it is better to leave them for other workers
+  const auto batch = std::min<std::size_t>(k_max_batch_size,
+                                           m_worker_tasks.size() / m_threads);
+
+  if (0 == batch) {
+    return;
+  }
+
+  std::deque<Task> tasks;
+
+  for (std::size_t i = 0; i < batch; ++i) {
+    // stop at the first task with a different priority, shutdown markers are
+    // left in the global queue, they are received once local queue is empty
+    auto task = m_worker_tasks.try_pop_if([priority](const Task &t) {
+      return t.produce_data && priority == t.priority;
+    });
+
+    if (!task) {
+      break;
+    }
+
+    tasks.emplace_back(std::move(*task));
+  }
+
+  move_to_local(id, &tasks);
+}
+
+void Thread_pool::move_to_local(std::size_t id, std::deque<Task> *tasks) {
+  if (tasks->empty()) {
+    return;
+  }
+
+  auto &queue = *m_worker_queues[id];
+  std::lock_guard lock{queue.mutex};
+
+  for (auto &task : *tasks) {
+    queue.tasks.emplace_back(std::move(task));
+  }
+}
+
 void Thread_pool::emergency_shutdown() {
   if (!m_worker_interrupt) {
     m_worker_interrupt = true;
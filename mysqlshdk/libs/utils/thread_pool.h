@@ -25,9 +25,12 @@
 #define MYSQLSHDK_LIBS_UTILS_THREAD_POOL_H_
 
 #include <atomic>
+#include <deque>
 #include <exception>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <vector>
@@ -39,6 +42,11 @@ namespace shcore {
 /**
  * A pool of threads which allows to execute an operation in a pool, and
  * process the result of that operation in the calling thread.
+ *
+ * Tasks are added to a global queue, workers take them in batches to their own
+ * queues, idle workers steal tasks from queues of other workers. A batch holds
+ * tasks of a single priority, so that tasks of a higher priority which are
+ * added later do not wait for the tasks of a lower priority taken earlier.
  */
 class Thread_pool final {
  public:
@@ -46,6 +54,17 @@ class Thread_pool final {
   using Producer = std::function<std::string()>;
   using Processor = std::function<void(std::string &&)>;
 
+  /**
+   * Where the result of a task is processed.
+   */
+  enum class Processing {
+    // in the thread which calls process(), one task at a time
+    SERIAL,
+    // in the worker thread which executed the producer, caller guarantees
+    // that the processor can be safely executed concurrently
+    PARALLEL,
+  };
+
   enum class Async_state {
     IDLE,
     PRODUCING,
@@ -83,11 +102,15 @@ class Thread_pool final {
    *        pool.
    * @param process_data Operation which is going to be executed in the calling
    *        thread using the result of produce_data.
+   * @param priority Priority of the task.
+   * @param processing If PARALLEL, process_data is executed in the worker
+   *        thread.
    *
    * @throws logic_error If called after a call to tasks_done().
    */
   void add_task(Producer &&produce_data, Processor &&process_data,
-                Priority priority = Priority::MEDIUM);
+                Priority priority = Priority::MEDIUM,
+                Processing processing = Processing::SERIAL);
 
   /**
    * Notifies the thread pool that all tasks have been added.
@@ -136,8 +159,29 @@ class Thread_pool final {
   struct Task {
     Producer produce_data;
     Processor process_data;
+    Processing processing = Processing::SERIAL;
+    Priority priority = Priority::MEDIUM;
+  };
+
+  struct Worker_queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
   };
 
+  void execute(Task *task);
+
+  std::optional<Task> pop_local(std::size_t id);
+
+  std::optional<Task> steal(std::size_t id);
+
+  /**
+   * Moves a batch of tasks with the given priority from the global queue to
+   * the queue of the given worker.
+   */
+  void fill_local(std::size_t id, Priority priority);
+
+  void move_to_local(std::size_t id, std::deque<Task> *tasks);
+
   void emergency_shutdown();
 
   void wait_for_worker_threads();
@@ -164,8 +208,12 @@ class Thread_pool final {
 
   volatile bool m_all_tasks_pushed = false;
 
+  // global queue, all tasks are added here
   Synchronized_queue<Task> m_worker_tasks;
 
+  // per-worker queues
+  std::vector<std::unique_ptr<Worker_queue>> m_worker_queues;
+
   Synchronized_queue<std::function<void()>> m_main_thread_tasks;
 
   volatile Async_state m_async_state = Async_state::IDLE;
@@ -26,8 +26,11 @@
 
 #include <atomic>
 #include <functional>
+#include <future>
+#include <memory>
 #include <string>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
@@ -77,6 +80,82 @@ OutputT map_reduce(InputIter begin, InputIter end, MapF map, ReduceF reduce) {
   return result;
 }
 
+/**
+ * Result of a function executed by scoped_async(). Thread which executes the
+ * function is joined when the result is retrieved or when this object is
+ * destroyed, just like in case of the future returned by std::async().
+ */
+template <class R>
+class Scoped_future final {
+ public:
+  Scoped_future() = default;
+
+  Scoped_future(std::future<R> future, std::thread thread)
+      : m_future(std::move(future)), m_thread(std::move(thread)) {}
+
+  Scoped_future(const Scoped_future &) = delete;
+  Scoped_future(Scoped_future &&) = default;
+
+  Scoped_future &operator=(const Scoped_future &) = delete;
+
+  Scoped_future &operator=(Scoped_future &&other) {
+    if (this != &other) {
+      join();
+
+      m_future = std::move(other.m_future);
+      m_thread = std::move(other.m_thread);
+    }
+
+    return *this;
+  }
+
+  ~Scoped_future() { join(); }
+
+  bool valid() const { return m_future.valid(); }
+
+  /**
+   * Waits for the function to finish.
+   *
+   * @returns the value returned by the function
+   *
+   * @throws the exception thrown by the function
+   */
+  R get() {
+    join();
+    return m_future.get();
+  }
+
+ private:
+  void join() {
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+  }
+
+  std::future<R> m_future;
+  std::thread m_thread;
+};
+
+/**
+ * Executes the given function asynchronously, in a new thread which uses the
+ * scoped contexts (logger, interrupt handlers, console, ...) of the caller.
+ *
+ * Callers are responsible for limiting the number of functions which are
+ * executed at the same time.
+ */
+template <class Function>
+auto scoped_async(Function &&f) {
+  using Result = std::invoke_result_t<std::decay_t<Function>>;
+
+  auto task =
+      std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(f));
+  auto future = task->get_future();
+
+  return Scoped_future<Result>{
+      std::move(future),
+      mysqlsh::spawn_scoped_thread([task = std::move(task)]() { (*task)(); })};
+}
+
 }  // namespace utils
 }  // namespace mysqlshdk
 
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/tracing.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/utils_file.h"
+
+namespace mysqlshdk {
+namespace tracing {
+
+namespace detail {
+
+std::atomic<bool> g_enabled{false};
+
+}  // namespace detail
+
+namespace {
+
+using steady_clock = std::chrono::steady_clock;
+
+// limit of the number of recorded spans, with ~200 bytes per span this should
+// not use more than 1GB
+constexpr std::size_t k_max_events = 4 * 1024 * 1024;
+
+struct Event {
+  const char *category;
+  std::string name;
+  int thread;
+  steady_clock::time_point start;
+  steady_clock::duration duration;
+  std::vector<detail::Arg> args;
+};
+
+std::atomic<int> g_next_thread_id{1};
+
+int thread_id() {
+  thread_local const int id = g_next_thread_id++;
+  return id;
+}
+
+class Tracer final {
+ public:
+  static Tracer &instance() {
+    static Tracer s_instance;
+    return s_instance;
+  }
+
+  Tracer(const Tracer &) = delete;
+  Tracer(Tracer &&) = delete;
+
+  Tracer &operator=(const Tracer &) = delete;
+  Tracer &operator=(Tracer &&) = delete;
+
+  ~Tracer() {
+    try {
+      stop();
+    } catch (...) {
+      // ignore errors on exit
+    }
+  }
+
+  void start(const std::string &path) {
+    if (path.empty()) throw std::invalid_argument("Trace file cannot be empty");
+
+    std::lock_guard lock{m_mutex};
+
+    if (m_active) {
+      detail::g_enabled = false;
+      write();
+    }
+
+    m_path = path;
+    m_events.clear();
+    m_dropped = 0;
+    m_epoch = steady_clock::now();
+    ++m_session;
+    m_active = true;
+    detail::g_enabled = true;
+  }
+
+  void stop() {
+    std::lock_guard lock{m_mutex};
+
+    if (!m_active) return;
+
+    m_active = false;
+    detail::g_enabled = false;
+
+    write();
+  }
+
+  uint64_t session() const { return m_session; }
+
+  void add(uint64_t session, Event &&event) {
+    std::lock_guard lock{m_mutex};
+
+    // span which was started in a previous session
+    if (!m_active || session != m_session) return;
+
+    if (m_events.size() >= k_max_events) {
+      ++m_dropped;
+      return;
+    }
+
+    m_events.emplace_back(std::move(event));
+  }
+
+ private:
+  Tracer() = default;
+
+  void write() {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+
+    const auto string = [&writer](std::string_view str) {
+      writer.String(str.data(), static_cast<rapidjson::SizeType>(str.length()));
+    };
+
+    const auto us = [this](steady_clock::duration d) {
+      return std::chrono::duration<double, std::micro>(d).count();
+    };
+
+    writer.StartObject();
+
+    writer.Key("traceEvents");
+    writer.StartArray();
+
+    writer.StartObject();
+    writer.Key("ph");
+    string("M");
+    writer.Key("name");
+    string("process_name");
+    writer.Key("pid");
+    writer.Int(1);
+    writer.Key("args");
+    writer.StartObject();
+    writer.Key("name");
+    string("mysqlsh");
+    writer.EndObject();
+    writer.EndObject();
+
+    for (const auto &e : m_events) {
+      writer.StartObject();
+      writer.Key("ph");
+      string("X");
+      writer.Key("cat");
+      string(e.category);
+      writer.Key("name");
+      string(e.name);
+      writer.Key("pid");
+      writer.Int(1);
+      writer.Key("tid");
+      writer.Int(e.thread);
+      writer.Key("ts");
+      writer.Double(us(e.start - m_epoch));
+      writer.Key("dur");
+      writer.Double(us(e.duration));
+
+      if (!e.args.empty()) {
+        writer.Key("args");
+        writer.StartObject();
+
+        for (const auto &arg : e.args) {
+          writer.Key(arg.key);
+
+          if (arg.is_num) {
+            writer.Uint64(arg.num);
+          } else {
+            string(arg.str);
+          }
+        }
+
+        writer.EndObject();
+      }
+
+      writer.EndObject();
+    }
+
+    writer.EndArray();
+
+    writer.Key("displayTimeUnit");
+    string("ms");
+
+    writer.Key("otherData");
+    writer.StartObject();
+    writer.Key("droppedSpans");
+    writer.Uint64(m_dropped);
+    writer.EndObject();
+
+    writer.EndObject();
+
+    m_events.clear();
+    m_events.shrink_to_fit();
+
+    if (!shcore::create_file(m_path,
+                             std::string{buffer.GetString(), buffer.GetSize()},
+                             true)) {
+      throw std::runtime_error("Failed to write the trace file '" + m_path +
+                               "'");
+    }
+  }
+
+  std::mutex m_mutex;
+  bool m_active = false;
+  std::atomic<uint64_t> m_session{0};
+  std::string m_path;
+  steady_clock::time_point m_epoch;
+  std::vector<Event> m_events;
+  uint64_t m_dropped = 0;
+};
+
+}  // namespace
+
+void start(const std::string &path) { Tracer::instance().start(path); }
+
+void stop() { Tracer::instance().stop(); }
+
+void Span::do_begin(const char *category, std::string_view name) {
+  if (m_active) end();
+
+  m_active = true;
+  m_session = Tracer::instance().session();
+  m_category = category;
+  m_name = name;
+  m_thread = thread_id();
+  m_args.clear();
+  m_start = steady_clock::now();
+}
+
+void Span::do_end() {
+  const auto now = steady_clock::now();
+
+  m_active = false;
+
+  Tracer::instance().add(m_session, {m_category, std::move(m_name), m_thread,
+                                     m_start, now - m_start,
+                                     std::move(m_args)});
+}
+
+void Span::do_add_arg(const char *key, std::string_view value) {
+  m_args.push_back({key, std::string{value}, 0, false});
+}
+
+void Span::do_add_arg(const char *key, uint64_t value) {
+  m_args.push_back({key, {}, value, true});
+}
+
+}  // namespace tracing
+}  // namespace mysqlshdk
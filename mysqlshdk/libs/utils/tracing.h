@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_TRACING_H_
+#define MYSQLSHDK_LIBS_UTILS_TRACING_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mysqlshdk {
+
+/**
+ * This namespace provides the functions used to record trace spans, which
+ * are written in the Chrome trace event format (JSON), which can be viewed
+ * using chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Tracing is enabled using the "trace" shell option, which holds the path to
+ * the output file. The file is written when tracing is stopped (option is
+ * set to an empty value) or when the process exits.
+ *
+ * TO ADD A SPAN
+ * -------------
+ *
+ *  mysqlshdk::tracing::Span span{"storage", "read"};
+ *  span.add_arg("bytes", length);
+ *
+ * Span is recorded between its construction and destruction (or call to
+ * end()). If tracing is not enabled, span does nothing. Category has to be a
+ * string literal.
+ */
+namespace tracing {
+
+namespace detail {
+extern std::atomic<bool> g_enabled;
+
+struct Arg {
+  const char *key;
+  std::string str;
+  uint64_t num;
+  bool is_num;
+};
+}  // namespace detail
+
+/**
+ * Starts recording the spans, they are going to be written to the given
+ * file. If tracing is already enabled, recorded spans are written to the
+ * previous file first.
+ *
+ * @param path Output file.
+ */
+void start(const std::string &path);
+
+/**
+ * Stops recording the spans and writes the recorded ones to the output file.
+ * Does nothing if tracing is not enabled.
+ */
+void stop();
+
+/**
+ * Checks if spans are being recorded.
+ */
+inline bool enabled() {
+  return detail::g_enabled.load(std::memory_order_relaxed);
+}
+
+class Span final {
+ public:
+  /**
+   * Creates an inactive span, begin() needs to be called to start it.
+   */
+  Span() = default;
+
+  Span(const char *category, std::string_view name) { begin(category, name); }
+
+  Span(const Span &) = delete;
+  Span(Span &&) = delete;
+
+  Span &operator=(const Span &) = delete;
+  Span &operator=(Span &&) = delete;
+
+  ~Span() { end(); }
+
+  /**
+   * Starts the span, if tracing is enabled. Span is reported as executed by
+   * the calling thread.
+   *
+   * @param category Category of the span, must be a string literal.
+   * @param name Name of the span.
+   */
+  void begin(const char *category, std::string_view name) {
+    if (enabled()) do_begin(category, name);
+  }
+
+  /**
+   * Finishes the span. Does nothing if span was not started.
+   */
+  void end() {
+    if (m_active) do_end();
+  }
+
+  void add_arg(const char *key, std::string_view value) {
+    if (m_active) do_add_arg(key, value);
+  }
+
+  void add_arg(const char *key, uint64_t value) {
+    if (m_active) do_add_arg(key, value);
+  }
+
+  bool active() const { return m_active; }
+
+ private:
+  void do_begin(const char *category, std::string_view name);
+
+  void do_end();
+
+  void do_add_arg(const char *key, std::string_view value);
+
+  void do_add_arg(const char *key, uint64_t value);
+
+  bool m_active = false;
+  uint64_t m_session = 0;
+  const char *m_category = nullptr;
+  std::string m_name;
+  int m_thread = 0;
+  std::chrono::steady_clock::time_point m_start;
+  std::vector<detail::Arg> m_args;
+};
+
+}  // namespace tracing
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_UTILS_TRACING_H_
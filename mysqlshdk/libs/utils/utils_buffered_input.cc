@@ -32,11 +32,54 @@
 #include <unistd.h>
 #endif
 
+#include <cstdint>
+#include <cstring>
 #include <deque>
 #include <string>
 
 namespace shcore {
 
+namespace {
+
+constexpr uint64_t k_ones = 0x0101010101010101ULL;
+constexpr uint64_t k_highs = 0x8080808080808080ULL;
+
+/**
+ * Checks if any of the bytes of the given word is equal to zero.
+ */
+constexpr bool has_zero_byte(uint64_t v) {
+  return ((v - k_ones) & ~v & k_highs) != 0;
+}
+
+/**
+ * Checks if any of the bytes of the given word is equal to the given byte.
+ */
+constexpr bool has_byte(uint64_t v, unsigned char c) {
+  return has_zero_byte(v ^ (k_ones * c));
+}
+
+const unsigned char *find_quote_or_escape(const unsigned char *first,
+                                          const unsigned char *last) {
+  while (last - first >= static_cast<std::ptrdiff_t>(sizeof(uint64_t))) {
+    uint64_t word;
+    ::memcpy(&word, first, sizeof(word));
+
+    if (has_byte(word, '"') || has_byte(word, '\\')) {
+      break;
+    }
+
+    first += sizeof(word);
+  }
+
+  while (first != last && '"' != *first && '\\' != *first) {
+    ++first;
+  }
+
+  return first;
+}
+
+}  // namespace
+
 void Buffered_input::open(const std::string &filepath_) {
   close();
 #ifdef _WIN32
@@ -66,6 +109,10 @@ std::string Buffered_input::get_double_quoted_string() {
   s += get();
 
   while (!eof()) {
+    get_until_quote_or_escape(&s);
+
+    if (eof()) break;
+
     switch (peek()) {
       case '\\':
         s += get();
@@ -84,6 +131,29 @@ std::string Buffered_input::get_double_quoted_string() {
   throw std::out_of_range("Incomplete quoted string");
 }
 
+void Buffered_input::get_until_quote_or_escape(std::string *target) {
+  while (true) {
+    if (m_pos == m_end) {
+      fill_buffer();
+
+      if (m_eof) {
+        return;
+      }
+    }
+
+    const auto found = find_quote_or_escape(m_pos, m_end);
+    const auto length = found - m_pos;
+
+    target->append(reinterpret_cast<const char *>(m_pos), length);
+    m_pos += length;
+    m_bytes_processed += length;
+
+    if (m_pos != m_end) {
+      return;
+    }
+  }
+}
+
 void Buffered_input::fill_buffer() {
   if (m_eof) {
     return;
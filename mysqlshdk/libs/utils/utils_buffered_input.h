@@ -81,6 +81,15 @@ class Buffered_input {
 
   std::string get_double_quoted_string();
 
+  /**
+   * Appends to the target all the bytes up to (but not including) the first
+   * double quote or backslash, or up to the end of the input. Input is scanned
+   * a word at a time.
+   *
+   * @param target Where the bytes are appended to.
+   */
+  void get_until_quote_or_escape(std::string *target);
+
  private:
   void close();
 
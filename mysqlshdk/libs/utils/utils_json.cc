@@ -318,8 +318,12 @@ void JSON_dumper::append(const char *key, double data) const {
 }
 
 void JSON_dumper::append_json(const std::string &data) const {
+  append_json(data.c_str(), data.length());
+}
+
+void JSON_dumper::append_json(const char *data, size_t length) const {
   rapidjson::Document document;
-  document.Parse(data.c_str());
+  document.Parse(data, length);
   _writer->append_document(document);
 }
 
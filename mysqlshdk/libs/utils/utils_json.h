@@ -103,6 +103,12 @@ class SHCORE_PUBLIC Writer_base {
   virtual void append_float(double data) = 0;
   virtual void append_document(const rapidjson::Document &document) = 0;
 
+  /**
+   * Discards the output, allowing to write a new document. Memory allocated
+   * for the output is kept.
+   */
+  virtual void reset() = 0;
+
  public:
   const std::string &str() const { return _data.data; }
 };
@@ -133,6 +139,11 @@ class SHCORE_PUBLIC Raw_writer final : public Writer_base {
     document.Accept(_writer);
   };
 
+  virtual void reset() {
+    _data.data.clear();
+    _writer.Reset(_data);
+  }
+
  private:
   My_writer<SStream> _writer;
 };
@@ -164,6 +175,11 @@ class SHCORE_PUBLIC Pretty_writer final : public Writer_base {
     document.Accept(_writer);
   };
 
+  virtual void reset() {
+    _data.data.clear();
+    _writer.Reset(_data);
+  }
+
  private:
   My_pretty_writer<SStream> _writer;
 };
@@ -252,9 +268,19 @@ class SHCORE_PUBLIC JSON_dumper final {
   void append(const char *key, double data) const;
 
   void append_json(const std::string &data) const;
+  void append_json(const char *data, size_t length) const;
 
   int deep_level() const { return _deep_level; }
 
+  /**
+   * Discards everything written so far, the dumper can be then reused to
+   * write another document without reallocating its buffer.
+   */
+  void reset() {
+    _deep_level = 0;
+    _writer->reset();
+  }
+
   const std::string &str() const { return _writer->str(); }
 
  private:
@@ -273,6 +273,13 @@ inline size_t span_keyword(
   }
 }
 
+// Returns the leading keyword, skipping any spaces before it
+inline std::string_view first_keyword(std::string_view s) {
+  const auto start = span_spaces(s, 0);
+  if (start == std::string_view::npos) return {};
+  return s.substr(start, span_keyword(s, start) - start);
+}
+
 inline bool is_start_of_unquoted_identifier(char c) {
   return internal::k_dollar_quoted_string_span_chars[static_cast<int>(c)] ||
          c == '$';
@@ -28,6 +28,7 @@
 #include <sstream>
 #include <tuple>
 #include <utility>
+#include "mysqlshdk/libs/utils/find_first_of.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -36,38 +37,39 @@ namespace utils {
 
 namespace {
 
-template <const char skip_tables[2][256], const char quote>
+template <const char quote>
 inline char *span_string(char *p, const char *end, bool no_backslash_escapes) {
-  const char *target_table = skip_tables[no_backslash_escapes ? 1 : 0];
+  static constexpr char k_special_chars[] = {quote, '\\'};
 
-  // p must be inside the single quote string (after the ')
-  int last_ch = 0;
+  // p must be inside the quoted string (after the opening quote)
   for (;;) {
-    // Tight-loop to span until end or closing quote
-    while (p < end &&
-           target_table[last_ch = static_cast<unsigned char>(*p)] > 0) {
-      p += target_table[last_ch];
+    // jump to the closing quote or to an escape sequence
+    p = const_cast<char *>(
+        find_first_of(p, end, k_special_chars, no_backslash_escapes ? 1 : 2));
+
+    if (p >= end) {
+      // string is over and we didn't see a quote, so it's an unterminated
+      // string
+      return nullptr;
     }
 
-    // Now check why we exited the loop
-    if (last_ch == '\0' || p >= end) {
-      // there was a '\0', but the string is not over, continue spanning
-      if (p < end) {
-        ++p;
-        continue;
+    if ('\\' == *p) {
+      // skip the escaped character
+      p += 2;
+
+      if (p >= end) {
+        return nullptr;
       }
-      // string is over and we didn't see a ', so it's an unterminated string
-      // if the last char we saw was an escape we need to remember escaping
-      // the first char of the next block
-      return nullptr;
+
+      continue;
     }
-    // the only other possible way to exit the loop must be the end quote
-    assert(last_ch == quote);
+
     // continue if there's another quote following the quote
     if (*(p + 1) == quote) {
       p += 2;
       continue;
     }
+
     return p + 1;
   }
 }
@@ -255,6 +257,11 @@ bool Sql_splitter::next_range(Sql_splitter::Range *out_range,
     }
   }
 
+  // characters which can end the statement or change the context, all other
+  // characters of a statement are skipped
+  const char special_chars[] = {m_delimiter[0], '\\', '\'', '"', '`',
+                                '$',            '/',  '#',  '-', '*'};
+
   size_t line_count = 0;
   char *next_bol = bos;  // beginning of next line
   while (next_bol < m_end) {
@@ -299,6 +306,14 @@ bool Sql_splitter::next_range(Sql_splitter::Range *out_range,
 
     while (p && p < eol) {
       auto ctx = context();
+
+      if (ctx == Context::kStatement || ctx == Context::kCommentConditional) {
+        p = const_cast<char *>(find_first_of(p, eol, special_chars,
+                                             std::size(special_chars)));
+
+        if (p == eol) continue;
+      }
+
       if (ctx == Context::kNone || ctx == Context::kStatement ||
           ctx == Context::kIdentifier || ctx == Context::kCommentConditional) {
         if (ctx == Context::kCommentConditional) {
@@ -559,8 +574,7 @@ bool Sql_splitter::next_range(Sql_splitter::Range *out_range,
           break;
 
         case Context::kSQuoteString:
-          p = span_string<internal::k_quoted_string_span_skips_sq, '\''>(
-              p, eol, m_no_backslash_escapes);
+          p = span_string<'\''>(p, eol, m_no_backslash_escapes);
           if (!p) {  // closing quote missing
             if (has_complete_line) {
               p = eol;
@@ -573,8 +587,7 @@ bool Sql_splitter::next_range(Sql_splitter::Range *out_range,
           break;
 
         case Context::kDQuoteString:
-          p = span_string<internal::k_quoted_string_span_skips_dq, '"'>(
-              p, eol, m_no_backslash_escapes);
+          p = span_string<'"'>(p, eol, m_no_backslash_escapes);
           if (!p) {  // closing quote missing
             if (has_complete_line) {
               p = eol;
@@ -37,9 +37,13 @@
 #endif
 
 #include <list>
+#include <mutex>
 #include <stack>
 
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/memory_stats.h"
+#include "scripting/common.h"
 #include "scripting/module_registry.h"
 #include "scripting/object_factory.h"
 #include "scripting/object_registry.h"
@@ -93,9 +97,20 @@ namespace {
 using V8_args = v8::FunctionCallbackInfo<v8::Value>;
 
 std::unique_ptr<v8::Platform> g_platform;
+std::mutex g_platform_mutex;
 
 const std::string k_origin_shell = "(shell)";
 
+/**
+ * Name of the file, located in the share folder, which holds the startup
+ * snapshot created by the mysqlsh_js_snapshot executable.
+ */
+constexpr const char k_startup_snapshot_file[] = "js_startup_snapshot.bin";
+
+std::once_flag g_startup_snapshot_once;
+std::string g_startup_snapshot_data;
+v8::StartupData g_startup_snapshot{nullptr, 0};
+
 #ifdef ENABLE_V8_TRACING
 
 std::ofstream g_trace_file;
@@ -173,9 +188,12 @@ v8::MaybeLocal<v8::Value> evaluate_repl(v8::Isolate *isolate,
 
 /** Initializer for JS stuff
  *
- * Must be called once when the program is started.
+ * Called when the first JS context is created, so that V8 is not initialized
+ * if JavaScript is not used. Subsequent calls do nothing.
  */
 void SHCORE_PUBLIC JScript_context_init() {
+  std::lock_guard lock{g_platform_mutex};
+
   if (!g_platform) {
     g_platform = v8::platform::NewDefaultPlatform(
         1,  // number of worker threads to allocate for background jobs
@@ -187,6 +205,8 @@ void SHCORE_PUBLIC JScript_context_init() {
 }
 
 void SHCORE_PUBLIC JScript_context_fini() {
+  std::lock_guard lock{g_platform_mutex};
+
   if (g_platform) {
     v8::V8::Dispose();
     v8::V8::DisposePlatform();
@@ -256,12 +276,41 @@ class JScript_context::Impl {
 
   Script_scope enter_script(const std::string &s);
 
+  /**
+   * Creates the global context, with all the symbols and the core module,
+   * which is stored in the startup snapshot.
+   */
+  static v8::Local<v8::Context> create_global_context(v8::Isolate *isolate);
+
+  /*
+   * load_core_module loads the content of the given module file
+   * and inserts the definitions on the JS globals.
+   */
+  static void load_core_module(v8::Isolate *isolate,
+                               v8::Local<v8::Context> context);
+
+  /**
+   * Native functions referenced by the startup snapshot, array is terminated
+   * with a null entry.
+   */
+  static const intptr_t *external_references();
+
+  /**
+   * Returns the startup snapshot, or nullptr if it's not available or was
+   * created by a different version of the shell.
+   */
+  static const v8::StartupData *startup_snapshot();
+
+  static std::string startup_snapshot_signature();
+
  private:
   // global functions exposed to JS
   static void f_repr(const V8_args &args);
   static void f_unrepr(const V8_args &args);
   static void f_type(const V8_args &args);
-  static void f_print(const V8_args &args, bool new_line);
+  static void f_print(const V8_args &args);
+  static void f_println(const V8_args &args);
+  static void print(const V8_args &args, bool new_line);
   static void f_source(const V8_args &args);
   // private global functions
   static void f_list_native_modules(const V8_args &args);
@@ -269,16 +318,15 @@ class JScript_context::Impl {
   static void f_load_module(const V8_args &args);
   static void f_current_module_folder(const V8_args &args);
 
-  /*
-   * load_core_module loads the content of the given module file
-   * and inserts the definitions on the JS globals.
-   */
-  void load_core_module() const;
+  static void on_gc_epilogue(v8::Isolate *isolate, v8::GCType type,
+                             v8::GCCallbackFlags flags, void *data);
+
   void load_module(const std::string &path, v8::Local<v8::Value> module,
                    bool *js_exception = nullptr);
 
-  v8::Local<v8::FunctionTemplate> wrap_callback(
-      v8::FunctionCallback callback) const;
+  static v8::Local<v8::FunctionTemplate> wrap_callback(
+      v8::Isolate *isolate, v8::FunctionCallback callback);
+  static void call_wrapped_callback(const V8_args &args);
 
   v8::Local<v8::Context> copy_global_context() const;
   void delete_context(v8::Local<v8::Context> context) const;
@@ -294,6 +342,8 @@ class JScript_context::Impl {
   std::unique_ptr<v8::ArrayBuffer::Allocator> m_allocator;
   bool m_terminating = false;
   std::vector<v8::Global<v8::Context>> m_stored_contexts;
+  // heap size, as measured after the last garbage collection
+  shcore::Tracked_memory m_heap_memory{shcore::Memory_tag::SCRIPTING};
   std::list<std::shared_ptr<JScript_function_storage>> m_stored_functions;
   Current_script m_current_script;
 };
@@ -303,61 +353,162 @@ JScript_context::Impl::Impl(JScript_context *owner)
       m_allocator(v8::ArrayBuffer::Allocator::NewDefaultAllocator()) {
   JScript_context_init();
 
+  const auto snapshot = startup_snapshot();
+
   v8::Isolate::CreateParams params;
   params.array_buffer_allocator = m_allocator.get();
 
+  if (snapshot) {
+    params.snapshot_blob = snapshot;
+    params.external_references = external_references();
+  }
+
   m_isolate = v8::Isolate::New(params);
   m_isolate->SetData(0, this);
 
   m_isolate->SetCaptureStackTraceForUncaughtExceptions(true);
+  m_isolate->AddGCEpilogueCallback(&Impl::on_gc_epilogue, this);
 
   v8::Isolate::Scope isolate_scope(m_isolate);
   v8::HandleScope handle_scope(m_isolate);
 
-  v8::Local<v8::ObjectTemplate> globals = v8::ObjectTemplate::New(m_isolate);
+  v8::Local<v8::Context> lcontext;
+
+  if (snapshot) {
+    // the global context is stored at index 0, default context is empty
+    lcontext = v8::Context::FromSnapshot(m_isolate, 0).FromMaybe(lcontext);
+
+    if (lcontext.IsEmpty()) {
+      log_warning("Failed to restore the JavaScript startup snapshot.");
+    }
+  }
+
+  if (lcontext.IsEmpty()) {
+    lcontext = create_global_context(m_isolate);
+    // Loads the core module
+    load_core_module(m_isolate, lcontext);
+  }
+
+  m_context.Reset(m_isolate, lcontext);
+}
+
+v8::Local<v8::Context> JScript_context::Impl::create_global_context(
+    v8::Isolate *isolate) {
+  const auto globals = v8::ObjectTemplate::New(isolate);
+  const auto set = [isolate, &globals](const char *name,
+                                       v8::FunctionCallback callback) {
+    globals->Set(v8_string(isolate, name), wrap_callback(isolate, callback));
+  };
 
   // register symbols to be exported to JS in global namespace
 
   // repr(object) -> string
-  globals->Set(v8_string("repr"), wrap_callback(&Impl::f_repr));
+  set("repr", &Impl::f_repr);
 
   // unrepr(string) -> object
-  globals->Set(v8_string("unrepr"), wrap_callback(&Impl::f_unrepr));
+  set("unrepr", &Impl::f_unrepr);
 
   // type(object) -> string
-  globals->Set(v8_string("type"), wrap_callback(&Impl::f_type));
+  set("type", &Impl::f_type);
 
   // print('hello')
-  globals->Set(v8_string("print"), wrap_callback([](const V8_args &args) {
-                 f_print(args, false);
-               }));
+  set("print", &Impl::f_print);
 
   // println('hello')
-  globals->Set(v8_string("println"),
-               wrap_callback([](const V8_args &args) { f_print(args, true); }));
+  set("println", &Impl::f_println);
 
   // source('module')
-  globals->Set(v8_string("source"), wrap_callback(&Impl::f_source));
+  set("source", &Impl::f_source);
 
   // private functions
-  globals->Set(v8_string("__list_native_modules"),
-               wrap_callback(&Impl::f_list_native_modules));
+  set("__list_native_modules", &Impl::f_list_native_modules);
 
-  globals->Set(v8_string("__load_native_module"),
-               wrap_callback(&Impl::f_load_native_module));
+  set("__load_native_module", &Impl::f_load_native_module);
 
-  globals->Set(v8_string("__load_module"), wrap_callback(&Impl::f_load_module));
+  set("__load_module", &Impl::f_load_module);
 
-  globals->Set(v8_string("__current_module_folder"),
-               wrap_callback(&Impl::f_current_module_folder));
+  set("__current_module_folder", &Impl::f_current_module_folder);
 
   // create the global context
-  v8::Local<v8::Context> lcontext =
-      v8::Context::New(m_isolate, nullptr, globals);
-  m_context.Reset(m_isolate, lcontext);
+  return v8::Context::New(isolate, nullptr, globals);
+}
+
+const intptr_t *JScript_context::Impl::external_references() {
+  // all callbacks registered by create_global_context() need to be listed
+  // here, otherwise V8 is unable to serialize the global template
+  static const intptr_t references[] = {
+      reinterpret_cast<intptr_t>(&Impl::call_wrapped_callback),
+      reinterpret_cast<intptr_t>(&Impl::f_repr),
+      reinterpret_cast<intptr_t>(&Impl::f_unrepr),
+      reinterpret_cast<intptr_t>(&Impl::f_type),
+      reinterpret_cast<intptr_t>(&Impl::f_print),
+      reinterpret_cast<intptr_t>(&Impl::f_println),
+      reinterpret_cast<intptr_t>(&Impl::f_source),
+      reinterpret_cast<intptr_t>(&Impl::f_list_native_modules),
+      reinterpret_cast<intptr_t>(&Impl::f_load_native_module),
+      reinterpret_cast<intptr_t>(&Impl::f_load_module),
+      reinterpret_cast<intptr_t>(&Impl::f_current_module_folder),
+      0,
+  };
+
+  return references;
+}
+
+std::string JScript_context::Impl::startup_snapshot_signature() {
+  // size of the external references is included, so that a snapshot created
+  // by a development build with a different set of callbacks is not used
+  size_t references = 0;
+
+  for (auto ref = external_references(); *ref; ++ref) {
+    ++references;
+  }
+
+  return shcore::str_format("mysqlsh-js-snapshot/%s/%s/%zu\n",
+                            MYSH_FULL_VERSION, v8::V8::GetVersion(),
+                            references);
+}
 
-  // Loads the core module
-  load_core_module();
+const v8::StartupData *JScript_context::Impl::startup_snapshot() {
+  std::call_once(g_startup_snapshot_once, []() {
+    std::string path;
+
+    try {
+      path = path::join_path(get_share_folder(), k_startup_snapshot_file);
+    } catch (const std::exception &e) {
+      log_debug("JavaScript startup snapshot is not available: %s", e.what());
+      return;
+    }
+
+    if (!load_text_file(path, g_startup_snapshot_data)) {
+      log_debug("JavaScript startup snapshot is not available: %s",
+                path.c_str());
+      return;
+    }
+
+    const auto signature = startup_snapshot_signature();
+
+    if (!shcore::str_beginswith(g_startup_snapshot_data, signature)) {
+      log_info("Ignoring the JavaScript startup snapshot '%s': it was created "
+               "by a different version",
+               path.c_str());
+      g_startup_snapshot_data.clear();
+      return;
+    }
+
+    g_startup_snapshot.data = g_startup_snapshot_data.data() + signature.size();
+    g_startup_snapshot.raw_size =
+        static_cast<int>(g_startup_snapshot_data.size() - signature.size());
+
+    if (!g_startup_snapshot.IsValid()) {
+      log_warning("Ignoring the JavaScript startup snapshot '%s': checksum "
+                  "mismatch",
+                  path.c_str());
+      g_startup_snapshot = {nullptr, 0};
+      g_startup_snapshot_data.clear();
+    }
+  });
+
+  return g_startup_snapshot.data ? &g_startup_snapshot : nullptr;
 }
 
 JScript_context::Impl::~Impl() {
@@ -379,22 +530,33 @@ JScript_context::Impl::~Impl() {
   m_isolate->ContextDisposedNotification();
   // force GC
   m_isolate->LowMemoryNotification();
+  m_isolate->RemoveGCEpilogueCallback(&Impl::on_gc_epilogue, this);
   // dispose isolate
   m_isolate->Dispose();
 }
 
-void JScript_context::Impl::load_core_module() const {
-  v8::Isolate::Scope isolate_scope(m_isolate);
-  v8::HandleScope handle_scope(m_isolate);
-  v8::TryCatch try_catch{m_isolate};
-  const auto lcontext = context();
+void JScript_context::Impl::on_gc_epilogue(v8::Isolate *isolate, v8::GCType,
+                                           v8::GCCallbackFlags, void *data) {
+  v8::HeapStatistics stats;
+  isolate->GetHeapStatistics(&stats);
+
+  static_cast<Impl *>(data)->m_heap_memory.resize(stats.used_heap_size() +
+                                                  stats.external_memory());
+}
+
+void JScript_context::Impl::load_core_module(
+    v8::Isolate *isolate, v8::Local<v8::Context> lcontext) {
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::TryCatch try_catch{isolate};
   v8::Context::Scope context_scope(lcontext);
 
   shcore::Scoped_naming_style style(NamingStyle::LowerCamelCase);
 
-  v8::ScriptOrigin script_origin{m_isolate, v8_string("core.js")};
+  v8::ScriptOrigin script_origin{isolate, v8_string(isolate, "core.js")};
   auto script = v8::Script::Compile(
-      lcontext, v8_string("(function (){" + shcore::js_core_module + "})();"),
+      lcontext,
+      v8_string(isolate, "(function (){" + shcore::js_core_module + "})();"),
       &script_origin);
 
   v8::MaybeLocal<v8::Value> result;
@@ -544,7 +706,15 @@ void JScript_context::Impl::f_type(const V8_args &args) {
   }
 }
 
-void JScript_context::Impl::f_print(const V8_args &args, bool new_line) {
+void JScript_context::Impl::f_print(const V8_args &args) {
+  print(args, false);
+}
+
+void JScript_context::Impl::f_println(const V8_args &args) {
+  print(args, true);
+}
+
+void JScript_context::Impl::print(const V8_args &args, bool new_line) {
   const auto isolate = args.GetIsolate();
   const auto self = static_cast<Impl *>(isolate->GetData(0));
 
@@ -771,23 +941,24 @@ bool JScript_context::Impl::is_terminating() const { return m_terminating; }
 void JScript_context::Impl::clear_is_terminating() { m_terminating = false; }
 
 v8::Local<v8::FunctionTemplate> JScript_context::Impl::wrap_callback(
-    v8::FunctionCallback callback) const {
+    v8::Isolate *isolate, v8::FunctionCallback callback) {
   const auto data =
-      v8::External::New(m_isolate, reinterpret_cast<void *>(callback));
+      v8::External::New(isolate, reinterpret_cast<void *>(callback));
+
+  return v8::FunctionTemplate::New(isolate, &Impl::call_wrapped_callback,
+                                   data);
+}
 
-  return v8::FunctionTemplate::New(
-      m_isolate,
-      [](const V8_args &args) {
-        const auto isolate = args.GetIsolate();
-        const auto self = static_cast<Impl *>(isolate->GetData(0));
+void JScript_context::Impl::call_wrapped_callback(const V8_args &args) {
+  const auto isolate = args.GetIsolate();
+  const auto self = static_cast<Impl *>(isolate->GetData(0));
 
-        if (self->is_terminating()) return;
+  // self is not set while the startup snapshot is being created
+  if (self && self->is_terminating()) return;
 
-        const auto func = reinterpret_cast<v8::FunctionCallback>(
-            v8::External::Cast(*args.Data())->Value());
-        func(args);
-      },
-      data);
+  const auto func = reinterpret_cast<v8::FunctionCallback>(
+      v8::External::Cast(*args.Data())->Value());
+  func(args);
 }
 
 /**
@@ -883,6 +1054,41 @@ JScript_context::JScript_context(Object_registry *registry)
 
 JScript_context::~JScript_context() { m_types->dispose(); }
 
+std::string JScript_context::create_startup_snapshot() {
+  JScript_context_init();
+
+  v8::StartupData blob;
+
+  {
+    v8::SnapshotCreator creator{Impl::external_references()};
+    const auto isolate = creator.GetIsolate();
+
+    {
+      v8::HandleScope handle_scope(isolate);
+
+      // default context is used by v8::Context::New(), it needs to be empty
+      creator.SetDefaultContext(v8::Context::New(isolate));
+
+      const auto context = Impl::create_global_context(isolate);
+      Impl::load_core_module(isolate, context);
+      creator.AddContext(context);
+    }
+
+    blob = creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+  }
+
+  if (!blob.data) {
+    throw std::runtime_error(
+        "Failed to create the JavaScript startup snapshot");
+  }
+
+  std::string snapshot = Impl::startup_snapshot_signature();
+  snapshot.append(blob.data, blob.raw_size);
+  delete[] blob.data;
+
+  return snapshot;
+}
+
 void JScript_context::set_global_item(const std::string &global_name,
                                       const std::string &item_name,
                                       const Value &value) {
@@ -1139,10 +1139,15 @@ PyObject *Python_context::shell_print(PyObject *UNUSED(self), PyObject *args,
     }
   }
 
-  if (stream == "error")
-    mysqlsh::current_console()->print_diag(text);
-  else
-    mysqlsh::current_console()->print(text);
+  {
+    // output may be paged or written to a slow terminal
+    WillLeavePython lock;
+
+    if (stream == "error")
+      mysqlsh::current_console()->print_diag(text);
+    else
+      mysqlsh::current_console()->print(text);
+  }
 
   Py_INCREF(Py_None);
   return Py_None;
@@ -1182,8 +1187,16 @@ std::pair<shcore::Prompt_result, std::string> Python_context::read_line(
     }
   }
   std::string ret;
-  if (mysqlsh::current_console()->prompt(prompt, &ret) !=
-      shcore::Prompt_result::Ok) {
+  shcore::Prompt_result result;
+
+  {
+    // other Python threads can run while waiting for the input, buffer is
+    // only accessed while holding the GIL
+    WillLeavePython lock;
+    result = mysqlsh::current_console()->prompt(prompt, &ret);
+  }
+
+  if (result != shcore::Prompt_result::Ok) {
     return {shcore::Prompt_result::Cancel, ""};
   }
   _stdin_buffer.append(ret).append("\n");
@@ -32,9 +32,15 @@
 #pragma clang diagnostic pop
 #endif
 
+#include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 #include "mysqlshdk/include/shellcore/base_shell.h"  // TODO(alfredo) doesn't belong here
+#include "mysqlshdk/libs/db/arrow_batch.h"
+#include "mysqlshdk/libs/db/result.h"
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/utils/debug.h"
 #include "scripting/python_utils.h"
@@ -81,6 +87,9 @@ struct PyShMethodObject {
 
 struct PyMemberCache {
   std::map<std::string, py::Store> members;
+  // methods do not change once the object is created, the wrappers are reused
+  // on subsequent accesses
+  std::map<std::string, py::Store> methods;
 };
 
 /*
@@ -101,6 +110,169 @@ struct PyShObjIndexedObject {
   // clang-format on
 };
 
+/**
+ * Python implementation of the fetch_many() function of the result objects,
+ * creates the tuples directly from the row data.
+ */
+py::Release fetch_many(const mysqlshdk::db::IResult_source &source,
+                       uint64_t count) {
+  py::Release rows{PyList_New(0)};
+
+  if (!rows) return {};
+
+  mysqlshdk::db::IResult *result = nullptr;
+
+  {
+    WillLeavePython lock;
+
+    if (source.has_data()) result = source.get_result();
+  }
+
+  if (!result) return rows;
+
+  for (uint64_t i = 0; i < count; ++i) {
+    const mysqlshdk::db::IRow *row = nullptr;
+
+    {
+      // fetching a row may need to read from the network
+      WillLeavePython lock;
+      row = result->fetch_one();
+    }
+
+    if (!row) break;
+
+    auto tuple = py::convert(*row);
+
+    if (!tuple || PyList_Append(rows.get(), tuple.get())) return {};
+  }
+
+  return rows;
+}
+
+py::Release import_from_c(PyObject *module, const char *type, uintptr_t address,
+                          PyObject *schema = nullptr) {
+  py::Release cls{PyObject_GetAttrString(module, type)};
+  if (!cls) return {};
+
+  return py::Release{
+      schema ? PyObject_CallMethod(cls.get(), "_import_from_c", "KO",
+                                   static_cast<unsigned long long>(address),
+                                   schema)
+             : PyObject_CallMethod(cls.get(), "_import_from_c", "K",
+                                   static_cast<unsigned long long>(address))};
+}
+
+/**
+ * Python implementation of the to_arrow() function of the result objects,
+ * the Arrow record batches are built from the row data and imported into
+ * pyarrow using the Arrow C data interface.
+ */
+py::Release to_arrow(const mysqlshdk::db::IResult_source &source,
+                     uint64_t batch_size) {
+  if (0 == batch_size) {
+    Python_context::set_python_error(
+        PyExc_ValueError, "The batch size must be greater than zero.");
+    return {};
+  }
+
+  py::Release pyarrow{PyImport_ImportModule("pyarrow")};
+  if (!pyarrow) return {};
+
+  mysqlshdk::db::IResult *result = nullptr;
+
+  {
+    WillLeavePython lock;
+
+    if (source.has_data()) result = source.get_result();
+  }
+
+  const std::vector<mysqlshdk::db::Column> no_columns;
+  mysqlshdk::db::Arrow_batch_builder builder{result ? result->get_metadata()
+                                                    : no_columns};
+
+  ArrowSchema c_schema;
+  builder.export_schema(&c_schema);
+
+  auto schema = import_from_c(pyarrow.get(), "Schema",
+                              reinterpret_cast<uintptr_t>(&c_schema));
+
+  // the schema is not moved if import fails
+  if (c_schema.release) c_schema.release(&c_schema);
+
+  if (!schema) return {};
+
+  py::Release batches{PyList_New(0)};
+  if (!batches) return {};
+
+  for (bool has_rows = nullptr != result; has_rows;) {
+    {
+      // no Python objects are created while building a batch
+      WillLeavePython lock;
+
+      while (builder.size() < batch_size) {
+        const auto row = result->fetch_one();
+
+        if (!row) {
+          has_rows = false;
+          break;
+        }
+
+        builder.append(*row);
+      }
+    }
+
+    if (0 == builder.size()) break;
+
+    ArrowArray c_array;
+    builder.export_batch(&c_array);
+
+    auto batch =
+        import_from_c(pyarrow.get(), "RecordBatch",
+                      reinterpret_cast<uintptr_t>(&c_array), schema.get());
+
+    if (c_array.release) c_array.release(&c_array);
+
+    if (!batch || PyList_Append(batches.get(), batch.get())) return {};
+  }
+
+  py::Release table{PyObject_GetAttrString(pyarrow.get(), "Table")};
+  if (!table) return {};
+
+  return py::Release{PyObject_CallMethod(table.get(), "from_batches", "OO",
+                                         batches.get(), schema.get())};
+}
+
+/**
+ * Python implementation of the to_pandas() function of the result objects.
+ */
+py::Release to_pandas(const mysqlshdk::db::IResult_source &source,
+                      uint64_t batch_size) {
+  auto table = to_arrow(source, batch_size);
+  if (!table) return {};
+
+  return py::Release{PyObject_CallMethod(table.get(), "to_pandas", nullptr)};
+}
+
+/**
+ * Functions of the result objects which are implemented natively by the
+ * Python bridge, all of them receive a single unsigned integer argument.
+ */
+struct Native_result_method {
+  py::Release (*call)(const mysqlshdk::db::IResult_source &, uint64_t);
+  // value used if the argument is not given, argument is required if not set
+  std::optional<uint64_t> default_argument;
+};
+
+const std::unordered_map<std::string_view, Native_result_method>
+    k_native_result_methods = {
+        {"fetch_many", {fetch_many, {}}},
+        {"to_arrow",
+         {to_arrow, mysqlshdk::db::Arrow_batch_builder::k_default_batch_size}},
+        {"to_pandas",
+         {to_pandas,
+          mysqlshdk::db::Arrow_batch_builder::k_default_batch_size}},
+};
+
 py::Release call_object_method(std::shared_ptr<Cpp_object_bridge> object,
                                const char *method, PyObject *args,
                                PyObject *kwargs) {
@@ -123,6 +295,36 @@ py::Release call_object_method(std::shared_ptr<Cpp_object_bridge> object,
   auto keyword_args = py::convert(kwargs, &ctx);
 
   try {
+    // in case of any errors in the arguments, the regular call is made, so the
+    // error is reported in the same way as for other functions
+    if (const auto source =
+            std::dynamic_pointer_cast<mysqlshdk::db::IResult_source>(object);
+        source && !source->has_documents() && arglist.size() <= 1 &&
+        (!keyword_args || keyword_args.as_map()->empty())) {
+      shcore::Scoped_naming_style lower(shcore::LowerCaseUnderscores);
+
+      if (const auto native = k_native_result_methods.find(method);
+          k_native_result_methods.end() != native &&
+          object->has_method_advanced(method)) {
+        auto argument = native->second.default_argument;
+
+        if (!arglist.empty()) {
+          if (const auto &value = arglist[0];
+              Value_type::UInteger == value.get_type() ||
+              (Value_type::Integer == value.get_type() &&
+               value.as_int() >= 0)) {
+            argument = value.as_uint();
+          } else {
+            argument.reset();
+          }
+        }
+
+        if (argument.has_value()) {
+          return native->second.call(*source, *argument);
+        }
+      }
+    }
+
     Value result;
     {
       WillLeavePython lock;
@@ -352,10 +554,19 @@ PyObject *object_printable(PyShObjObject *self) {
 
   Value object(*self->object);
   std::string format = mysqlsh::current_shell_options()->get().wrap_json;
+  std::string text;
+
+  {
+    // i.e. description of a result fetches all of its rows
+    WillLeavePython lock;
 
-  if (format.find("json") == 0)
-    return PyString_FromString(object.json(format == "json").c_str());
-  return PyString_FromString(object.descr(true).c_str());
+    if (format.find("json") == 0)
+      text = object.json(format == "json");
+    else
+      text = object.descr(true);
+  }
+
+  return PyString_FromString(text.c_str());
 }
 
 PyObject *object_getattro(PyShObjObject *self, PyObject *attr_name) {
@@ -381,12 +592,23 @@ PyObject *object_getattro(PyShObjObject *self, PyObject *attr_name) {
 
   shcore::Scoped_naming_style lower(shcore::LowerCaseUnderscores);
 
-  if (cobj->has_method_advanced(attrname))
-    return wrap_method(cobj, attrname.c_str()).release();
+  auto &methods = self->cache->methods;
+
+  if (const auto method = methods.find(attrname); methods.end() != method) {
+    Py_INCREF(method->second.get());
+    return method->second.get();
+  }
+
+  if (cobj->has_method_advanced(attrname)) {
+    auto method = wrap_method(cobj, attrname.c_str());
+    if (method) methods.emplace(attrname, py::Store{method.get()});
+    return method.release();
+  }
 
   shcore::Value member;
   bool error_handled = false;
   try {
+    WillLeavePython lock;
     member = cobj->get_member_advanced(attrname);
   } catch (const Exception &exc) {
     if (!exc.is_attribute()) {
@@ -429,6 +651,7 @@ int object_setattro(PyShObjObject *self, PyObject *attr_name,
         return -1;
       }
       try {
+        WillLeavePython lock;
         cobj->set_member_advanced(attrname, value);
       } catch (...) {
         translate_python_exception();
@@ -558,6 +781,7 @@ the shcore class of the object.");
 PyDoc_STRVAR(call_doc, "callmethod(method_name, ...) -> value");
 
 Py_ssize_t object_length(PyShObjObject *self) {
+  WillLeavePython lock;
   return self->object->get()->get_member("length").as_uint();
 }
 
@@ -571,7 +795,14 @@ PyObject *object_item(PyShObjObject *self, Py_ssize_t index) {
   }
 
   try {
-    return py::convert(self->object->get()->get_member(index)).release();
+    Value item;
+
+    {
+      WillLeavePython lock;
+      item = self->object->get()->get_member(index);
+    }
+
+    return py::convert(item).release();
   } catch (...) {
     translate_python_exception();
   }
@@ -588,7 +819,12 @@ int object_assign(PyShObjObject *self, Py_ssize_t index, PyObject *value) {
   }
 
   try {
-    self->object->get()->set_member(index, py::convert(value));
+    auto item = py::convert(value);
+
+    {
+      WillLeavePython lock;
+      self->object->get()->set_member(index, std::move(item));
+    }
 
     return 0;
   } catch (...) {
@@ -25,6 +25,7 @@
 
 #include <cassert>
 
+#include "mysqlshdk/libs/db/row.h"
 #include "scripting/obj_date.h"
 #include "scripting/python_array_wrapper.h"
 #include "scripting/python_function_wrapper.h"
@@ -323,5 +324,90 @@ py::Release convert(const Value &value, Python_context * /*context*/) {
   return {};
 }
 
+py::Release convert(const mysqlshdk::db::IRow &row) {
+  using mysqlshdk::db::Type;
+
+  const auto fields = row.num_fields();
+  py::Release tuple{PyTuple_New(fields)};
+
+  if (!tuple) return {};
+
+  const auto string = [&row](uint32_t index) {
+    const auto data = row.get_string_data(index);
+    return py::Release{PyUnicode_FromStringAndSize(data.first, data.second)};
+  };
+
+  for (uint32_t i = 0; i < fields; ++i) {
+    py::Release item;
+
+    if (row.is_null(i)) {
+      item = py::Release::incref(Py_None);
+    } else {
+      switch (row.get_type(i)) {
+        case Type::Null:
+          item = py::Release::incref(Py_None);
+          break;
+
+        case Type::String:
+        case Type::Geometry:
+        case Type::Json:
+        case Type::Enum:
+        case Type::Set:
+          item = string(i);
+          break;
+
+        case Type::Integer:
+          item = py::Release{PyLong_FromLongLong(row.get_int(i))};
+          break;
+
+        case Type::UInteger:
+          item = py::Release{PyLong_FromUnsignedLongLong(row.get_uint(i))};
+          break;
+
+        case Type::Float:
+          item = py::Release{PyFloat_FromDouble(row.get_float(i))};
+          break;
+
+        case Type::Double:
+          item = py::Release{PyFloat_FromDouble(row.get_double(i))};
+          break;
+
+        case Type::Decimal: {
+          const auto decimal = row.get_as_string(i);
+          item = py::Release{
+              PyUnicode_FromStringAndSize(decimal.c_str(), decimal.length())};
+          break;
+        }
+
+        case Type::Date:
+        case Type::DateTime:
+        case Type::Time:
+          item = convert(Value::wrap(
+              std::make_shared<Date>(Date::unrepr(row.get_string(i)))));
+          break;
+
+        case Type::Bit:
+          item = py::Release{
+              PyLong_FromUnsignedLongLong(std::get<0>(row.get_bit(i)))};
+          break;
+
+        case Type::Bytes: {
+          const auto data = row.get_string_data(i);
+          item =
+              py::Release{PyBytes_FromStringAndSize(data.first, data.second)};
+          break;
+        }
+      }
+    }
+
+    if (!item) return {};
+
+    // steals the reference
+    PyTuple_SET_ITEM(tuple.get(), i, item.release());
+  }
+
+  return tuple;
+}
+
 }  // namespace py
 }  // namespace shcore
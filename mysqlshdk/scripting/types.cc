@@ -479,7 +479,7 @@ void unicode_codepoint_to_utf8(uint32_t uni, std::string *out) {
   } else {
     double d = 0;
     try {
-      d = std::stod(std::string{number}.c_str());
+      d = shcore::str_to_double(number);
     } catch (const std::invalid_argument &e) {
       throw Exception::parser_error(
           shcore::str_format("Error parsing float: %s", e.what()));
@@ -773,13 +773,13 @@ std::string type_description(Value_type type) {
 
 // --
 
-Value_type Value::Map_type::get_type(const std::string &k) const {
+Value_type Value::Map_type::get_type(std::string_view k) const {
   const_iterator iter = find(k);
   if (iter == end()) return Undefined;
   return iter->second.get_type();
 }
 
-std::string Value::Map_type::get_string(const std::string &k,
+std::string Value::Map_type::get_string(std::string_view k,
                                         const std::string &def) const {
   const_iterator iter = find(k);
   if (iter == end()) return def;
@@ -787,28 +787,28 @@ std::string Value::Map_type::get_string(const std::string &k,
   return iter->second.get_string();
 }
 
-bool Value::Map_type::get_bool(const std::string &k, bool def) const {
+bool Value::Map_type::get_bool(std::string_view k, bool def) const {
   const_iterator iter = find(k);
   if (iter == end()) return def;
   iter->second.check_type(Bool);
   return iter->second.as_bool();
 }
 
-int64_t Value::Map_type::get_int(const std::string &k, int64_t def) const {
+int64_t Value::Map_type::get_int(std::string_view k, int64_t def) const {
   const_iterator iter = find(k);
   if (iter == end()) return def;
   iter->second.check_type(Integer);
   return iter->second.as_int();
 }
 
-uint64_t Value::Map_type::get_uint(const std::string &k, uint64_t def) const {
+uint64_t Value::Map_type::get_uint(std::string_view k, uint64_t def) const {
   const_iterator iter = find(k);
   if (iter == end()) return def;
   iter->second.check_type(UInteger);
   return iter->second.as_uint();
 }
 
-double Value::Map_type::get_double(const std::string &k, double def) const {
+double Value::Map_type::get_double(std::string_view k, double def) const {
   const_iterator iter = find(k);
   if (iter == end()) return def;
   iter->second.check_type(Float);
@@ -816,7 +816,7 @@ double Value::Map_type::get_double(const std::string &k, double def) const {
 }
 
 std::shared_ptr<Value::Map_type> Value::Map_type::get_map(
-    const std::string &k, std::shared_ptr<Map_type> def) const {
+    std::string_view k, std::shared_ptr<Map_type> def) const {
   const_iterator iter = find(k);
   if (iter == end()) return def;
   iter->second.check_type(Map);
@@ -824,7 +824,7 @@ std::shared_ptr<Value::Map_type> Value::Map_type::get_map(
 }
 
 std::shared_ptr<Value::Array_type> Value::Map_type::get_array(
-    const std::string &k, std::shared_ptr<Array_type> def) const {
+    std::string_view k, std::shared_ptr<Array_type> def) const {
   const_iterator iter = find(k);
   if (iter == end()) return def;
   iter->second.check_type(Array);
@@ -898,7 +898,7 @@ Value::Value(float f) {
   // direct typecast from float to double works by just appending 0s to the
   // binary IEEE representation, which will result in a different number
   // So we convert through decimal instead
-  m_value = std::stod(shcore::ftoa(f));
+  m_value = shcore::str_to_double(shcore::ftoa(f));
 }
 
 Value::Value(double d) { m_value = d; }
@@ -1984,7 +1984,10 @@ void Option_unpacker::set_options(const Dictionary_t &options) {
   m_unknown.clear();
   m_missing.clear();
   if (m_options) {
-    for (const auto &opt : *m_options) m_unknown.insert(opt.first);
+    // keys are already sorted, insert them with a hint
+    for (const auto &opt : *m_options) {
+      m_unknown.emplace_hint(m_unknown.end(), opt.first);
+    }
   }
 }
 
@@ -2000,7 +2003,7 @@ Value Option_unpacker::get_required(const char *name, Value_type type) {
     return {};
   }
 
-  m_unknown.erase(name);
+  mark_known(name);
 
   if (type != Undefined && !is_compatible_type(opt->second.get_type(), type)) {
     throw Exception::type_error(str_format(
@@ -2028,7 +2031,7 @@ Value Option_unpacker::get_optional(const char *name, Value_type type,
 
   if (opt == m_options->end()) return {};
 
-  m_unknown.erase(name);
+  mark_known(name);
 
   if (type != Undefined && !is_compatible_type(opt->second.get_type(), type)) {
     throw Exception::type_error(str_format(
@@ -2056,7 +2059,7 @@ Value Option_unpacker::get_optional_exact(const char *name, Value_type type,
 
   if (opt == m_options->end()) return {};
 
-  m_unknown.erase(name);
+  mark_known(name);
 
   auto opt_type = opt->second.get_type();
 
@@ -2073,6 +2076,13 @@ Value Option_unpacker::get_optional_exact(const char *name, Value_type type,
 
 void Option_unpacker::end(std::string_view context) { validate(context); }
 
+void Option_unpacker::mark_known(std::string_view name) {
+  // erase(key) does not support heterogeneous lookup, avoid a temporary string
+  if (const auto it = m_unknown.find(name); it != m_unknown.end()) {
+    m_unknown.erase(it);
+  }
+}
+
 void Option_unpacker::validate(std::string_view context) {
   std::string msg;
   if (!m_unknown.empty() && !m_missing.empty()) {
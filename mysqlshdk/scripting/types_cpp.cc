@@ -236,8 +236,6 @@ std::tuple<bool, int, shcore::Exception> Cpp_function::match_signatures(
   }
 }
 
-using FunctionEntry = std::pair<std::string, std::shared_ptr<Cpp_function>>;
-
 std::map<std::string, Cpp_function::Metadata> Cpp_object_bridge::mdtable;
 std::mutex Cpp_object_bridge::s_mtx;
 
@@ -353,16 +351,62 @@ std::string Cpp_object_bridge::get_base_name(const std::string &member) const {
   if (auto func = lookup_function(member); func)
     return func->name(NamingStyle::LowerCamelCase);
 
-  auto prop = std::find_if(_properties.begin(), _properties.end(),
-                           [&member](const Cpp_property_name &p) {
-                             return p.name(current_naming_style()) == member;
-                           });
-  if (prop != _properties.end())
-    return (*prop).name(NamingStyle::LowerCamelCase);
+  if (const auto prop = find_property(member); prop)
+    return prop->name(NamingStyle::LowerCamelCase);
 
   return {};
 }
 
+void Cpp_object_bridge::index_function(Function_map::const_iterator func) {
+  for (const auto style : {LowerCamelCase, LowerCaseUnderscores}) {
+    const auto [it, inserted] =
+        m_function_index[style].emplace(func->second->name(style), func->first);
+
+    // the linear lookup used to pick the first matching entry, keep the same
+    // order in case different functions have the same name in this style
+    if (!inserted && func->first < it->second) it->second = func->first;
+  }
+}
+
+void Cpp_object_bridge::unindex_function(const std::string &name) {
+  if (_funcs.count(name)) return;
+
+  for (auto &index : m_function_index) {
+    for (auto it = index.begin(); it != index.end();) {
+      if (it->second == name)
+        it = index.erase(it);
+      else
+        ++it;
+    }
+  }
+}
+
+void Cpp_object_bridge::index_property(size_t index) {
+  for (const auto style : {LowerCamelCase, LowerCaseUnderscores}) {
+    m_property_index[style].emplace(_properties[index].name(style), index);
+  }
+}
+
+Cpp_object_bridge::Function_map::const_iterator
+Cpp_object_bridge::find_function(const std::string &name) const {
+  const auto &index = m_function_index[current_naming_style()];
+
+  if (const auto it = index.find(name); index.end() != it)
+    return _funcs.lower_bound(it->second);
+
+  return _funcs.end();
+}
+
+const Cpp_property_name *Cpp_object_bridge::find_property(
+    const std::string &name) const {
+  const auto &index = m_property_index[current_naming_style()];
+
+  if (const auto it = index.find(name); index.end() != it)
+    return &_properties[it->second];
+
+  return nullptr;
+}
+
 std::string Cpp_object_bridge::get_function_name(const std::string &member,
                                                  bool fully_specified) const {
   auto m = lookup_function(member);
@@ -388,21 +432,12 @@ shcore::Value Cpp_object_bridge::get_member_method(
 }
 
 Value Cpp_object_bridge::get_member_advanced(const std::string &prop) const {
-  auto func = std::find_if(
-      _funcs.begin(), _funcs.end(), [&prop](const FunctionEntry &f) {
-        return f.second->name(current_naming_style()) == prop;
-      });
-
-  if (func != _funcs.end())
+  if (const auto func = find_function(prop); func != _funcs.end())
     return Value(std::shared_ptr<Function_base>(func->second));
 
-  auto prop_index =
-      std::find_if(_properties.begin(), _properties.end(),
-                   [&prop](const Cpp_property_name &p) {
-                     return p.name(current_naming_style()) == prop;
-                   });
-  if (prop_index != _properties.end())
-    return get_member((*prop_index).base_name());
+  if (const auto property = find_property(prop); property)
+    return get_member(property->base_name());
+
   throw Exception::attrib_error("Invalid object member " + prop);
 }
 
@@ -414,14 +449,7 @@ Value Cpp_object_bridge::get_member(const std::string &prop) const {
 }
 
 bool Cpp_object_bridge::has_member_advanced(const std::string &prop) const {
-  if (lookup_function(prop)) return true;
-
-  auto prop_index =
-      std::find_if(_properties.begin(), _properties.end(),
-                   [&prop](const Cpp_property_name &p) {
-                     return p.name(current_naming_style()) == prop;
-                   });
-  return (prop_index != _properties.end());
+  return find_function(prop) != _funcs.end() || find_property(prop);
 }
 
 bool Cpp_object_bridge::has_member(const std::string &prop) const {
@@ -438,13 +466,8 @@ bool Cpp_object_bridge::has_member(const std::string &prop) const {
 
 void Cpp_object_bridge::set_member_advanced(const std::string &prop,
                                             Value value) {
-  auto prop_index =
-      std::find_if(_properties.begin(), _properties.end(),
-                   [&prop](const Cpp_property_name &p) {
-                     return p.name(current_naming_style()) == prop;
-                   });
-  if (prop_index != _properties.end()) {
-    set_member((*prop_index).base_name(), value);
+  if (const auto property = find_property(prop); property) {
+    set_member(property->base_name(), value);
   } else {
     throw Exception::attrib_error("Can't set object member " + prop);
   }
@@ -521,7 +544,7 @@ Cpp_function::Metadata *Cpp_object_bridge::expose(
 
   std::string registered_name = name.substr(0, name.find("|"));
   detect_overload_conflicts(registered_name, md);
-  _funcs.emplace(std::make_pair(
+  index_function(_funcs.emplace(std::make_pair(
       registered_name,
       std::shared_ptr<Cpp_function>(new Cpp_function(
           &md, [&md, func](const shcore::Argument_list &args) -> shcore::Value {
@@ -533,7 +556,7 @@ Cpp_function::Metadata *Cpp_object_bridge::expose(
             }
 
             return func->invoke(args);
-          }))));
+          })))));
 
   return &md;
 }
@@ -572,16 +595,18 @@ void Cpp_object_bridge::add_method_(
   auto function =
       std::shared_ptr<Cpp_function>(new Cpp_function(name, func, *signature));
   function->is_legacy = true;
-  _funcs.emplace(name.substr(0, name.find("|")), function);
+  index_function(_funcs.emplace(name.substr(0, name.find("|")), function));
 }
 
 void Cpp_object_bridge::add_constant(const std::string &name) {
   _properties.push_back(Cpp_property_name(name, true));
+  index_property(_properties.size() - 1);
 }
 
 void Cpp_object_bridge::add_property(const std::string &name,
                                      const std::string &getter) {
   _properties.push_back(Cpp_property_name(name));
+  index_property(_properties.size() - 1);
   if (!getter.empty())
     add_method(getter, std::bind(&Cpp_object_bridge::get_member_method, this,
                                  _1, getter, name));
@@ -595,7 +620,13 @@ void Cpp_object_bridge::delete_property(const std::string &name,
   if (prop_index != _properties.end()) {
     _properties.erase(prop_index);
 
-    if (!getter.empty()) _funcs.erase(getter);
+    for (auto &index : m_property_index) index.clear();
+    for (size_t i = 0; i < _properties.size(); ++i) index_property(i);
+
+    if (!getter.empty()) {
+      _funcs.erase(getter);
+      unindex_function(getter);
+    }
   }
 }
 
@@ -686,12 +717,7 @@ Value Cpp_object_bridge::call_function(
 
 std::shared_ptr<Cpp_function> Cpp_object_bridge::lookup_function(
     const std::string &method) const {
-  // NOTE this linear lookup is no good, but needed until the naming style
-  // mechanism is improved
-  std::multimap<std::string, std::shared_ptr<Cpp_function>>::const_iterator i;
-  for (i = _funcs.begin(); i != _funcs.end(); ++i) {
-    if (i->second->name(current_naming_style()) == method) break;
-  }
+  const auto i = find_function(method);
   if (i == _funcs.end()) {
     return std::shared_ptr<Cpp_function>(nullptr);
   }
@@ -702,12 +728,7 @@ std::shared_ptr<Cpp_function> Cpp_object_bridge::lookup_function(
 std::shared_ptr<Cpp_function> Cpp_object_bridge::lookup_function_overload(
     const std::string &method, const shcore::Argument_list &args,
     const shcore::Dictionary_t &kwds) const {
-  // NOTE this linear lookup is no good, but needed until the naming style
-  // mechanism is improved
-  std::multimap<std::string, std::shared_ptr<Cpp_function>>::const_iterator i;
-  for (i = _funcs.begin(); i != _funcs.end(); ++i) {
-    if (i->second->name(current_naming_style()) == method) break;
-  }
+  auto i = find_function(method);
   if (i == _funcs.end()) {
     throw Exception::attrib_error("Invalid object function " + method);
   }
@@ -1041,12 +1062,12 @@ Cpp_property_name::Cpp_property_name(const std::string &name, bool constant) {
   }
 }
 
-std::string Cpp_property_name::name(NamingStyle style) const {
+const std::string &Cpp_property_name::name(NamingStyle style) const {
   assert((style >= 0) && (style < _name.size()));
   return _name[style];
 }
 
-std::string Cpp_property_name::base_name() const {
+const std::string &Cpp_property_name::base_name() const {
   return _name[LowerCamelCase];
 }
 
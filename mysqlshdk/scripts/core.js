@@ -39,7 +39,18 @@ function Module(full_path) {
 
 function ModuleHandler() { }
 
-ModuleHandler.__native_modules = __list_native_modules();
+// The list of native modules is fetched on first use, this allows the core
+// module to be stored in the startup snapshot, which is created by a different
+// executable.
+ModuleHandler.__native_modules = undefined;
+
+ModuleHandler.__is_native_module = function (module) {
+  if (undefined === ModuleHandler.__native_modules) {
+    ModuleHandler.__native_modules = __list_native_modules();
+  }
+
+  return ModuleHandler.__native_modules.includes(module);
+};
 
 ModuleHandler.__find_module = function (module, paths) {
   for (let path of paths) {
@@ -86,7 +97,7 @@ ModuleHandler.prototype.__require = function (module) {
     throw new Error('The absolute path is disallowed.');
   }
 
-  if (ModuleHandler.__native_modules.includes(module)) {
+  if (ModuleHandler.__is_native_module(module)) {
     if (!(module in this.__cache)) {
       this.__cache[module] = __load_native_module(module);
     }
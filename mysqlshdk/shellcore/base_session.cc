@@ -243,41 +243,22 @@ void ShellBaseSession::enable_sql_mode_tracking() {
   if (session->get_server_version() < mysqlshdk::utils::Version(5, 7, 0))
     return;
 
-  std::string current_value;
+  // sql_mode is appended to the tracked variables (unless it's already there)
+  // using a single statement, to avoid an additional round trip
   try {
-    const auto res =
-        session->query("SELECT @@SESSION.session_track_system_variables");
-    const auto row = res->fetch_one();
-    if (!row)
-      throw std::logic_error(
-          "Unable to determine current session tracked system variables.");
-
-    current_value = shcore::str_lower(row->get_string(0));
-
-  } catch (const mysqlshdk::db::Error &) {
-    return;
-  }
-
-  m_is_sql_mode_tracking_enabled =
-      current_value.find("sql_mode") != std::string::npos ||
-      current_value == "*";
-
-  if (m_is_sql_mode_tracking_enabled) {
-    log_info("Already tracking 'sql_mode'system variable.");
-    return;
-  }
-
-  current_value.append(current_value.empty() ? "sql_mode" : ", sql_mode");
-
-  try {
-    session->executef("SET SESSION session_track_system_variables = ?;",
-                      current_value);
+    session->execute(
+        "SET @@SESSION.session_track_system_variables = IF("
+        "@@SESSION.session_track_system_variables = '*' OR "
+        "FIND_IN_SET('sql_mode', REPLACE(LOWER("
+        "@@SESSION.session_track_system_variables), ' ', '')), "
+        "@@SESSION.session_track_system_variables, CONCAT_WS(',', NULLIF("
+        "@@SESSION.session_track_system_variables, ''), 'sql_mode'))");
   } catch (const mysqlshdk::db::Error &) {
     return;
   }
 
   m_is_sql_mode_tracking_enabled = true;
-  log_info("Now tracking 'sql_mode' system variable.");
+  log_info("Tracking 'sql_mode' system variable.");
 }
 
 std::string ShellBaseSession::get_quoted_name(std::string_view name) {
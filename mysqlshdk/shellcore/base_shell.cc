@@ -118,7 +118,8 @@ void Base_shell::finish_init() {
   // again, because of this we don't need need any mode initialized by default
   // as it's very unlikely that we will be parsing any input directly. If
   // however this will be needed, switch_shell_mode can be used to fix this.
-  if (!mysqlshdk::utils::in_main_thread()) {
+  // Same happens if shell is going to execute a native CLI operation.
+  if (!mysqlshdk::utils::in_main_thread() || m_skip_initial_mode) {
     initial_mode = shcore::IShell_core::Mode::None;
   }
 
@@ -23,7 +23,16 @@
 
 #include "mysqlshdk/shellcore/credential_manager.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#else  // !_WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif  // !_WIN32
+
 #include <algorithm>
+#include <cstring>
+#include <limits>
 
 #include "mysql-secret-store/include/mysql-secret-store/api.h"
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
@@ -51,6 +60,7 @@ constexpr auto k_disabled_helper_name = "<disabled>";
 constexpr auto k_credential_helper_option = "credentialStore.helper";
 constexpr auto k_save_passwords_option = "credentialStore.savePasswords";
 constexpr auto k_exclude_filters_option = "credentialStore.excludeFilters";
+constexpr auto k_cache_ttl_option = "credentialStore.cacheTtl";
 
 constexpr auto k_credential_helper_cmdline = "--credential-store-helper=<h>";
 constexpr auto k_save_passwords_cmdline = "--save-passwords=<value>";
@@ -149,12 +159,111 @@ std::string to_string(Credential_manager::Save_passwords val) {
   throw std::runtime_error{"Unknown Save_passwords value"};
 }
 
+std::size_t page_size() {
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwPageSize;
+#else   // !_WIN32
+  return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif  // !_WIN32
+}
+
 }  // namespace
 
+/**
+ * A secret held in memory pages which are allocated for its exclusive use and
+ * locked in RAM, so that it's never written to the swap. Memory is cleared
+ * before it is released.
+ */
+class Credential_manager::Cached_secret final {
+ public:
+  Cached_secret() = delete;
+
+  Cached_secret(const std::string &secret,
+                std::chrono::steady_clock::time_point expires)
+      : m_length(secret.length()), m_expires(expires) {
+    const auto page = page_size();
+    m_size = (m_length / page + 1) * page;
+
+#ifdef _WIN32
+    m_data = static_cast<char *>(
+        VirtualAlloc(nullptr, m_size, MEM_COMMIT | MEM_RESERVE,
+                     PAGE_READWRITE));
+
+    if (!m_data) {
+      throw std::bad_alloc();
+    }
+
+    m_locked = VirtualLock(m_data, m_size);
+#else   // !_WIN32
+    const auto data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == data) {
+      throw std::bad_alloc();
+    }
+
+    m_data = static_cast<char *>(data);
+    m_locked = 0 == mlock(m_data, m_size);
+
+#ifdef MADV_DONTDUMP
+    // don't include the secret in the core dumps
+    madvise(m_data, m_size, MADV_DONTDUMP);
+#endif  // MADV_DONTDUMP
+#endif  // !_WIN32
+
+    if (!m_locked) {
+      log_debug2("Failed to lock the memory of a cached credential");
+    }
+
+    std::memcpy(m_data, secret.data(), m_length);
+  }
+
+  Cached_secret(const Cached_secret &) = delete;
+  Cached_secret(Cached_secret &&) = delete;
+
+  Cached_secret &operator=(const Cached_secret &) = delete;
+  Cached_secret &operator=(Cached_secret &&) = delete;
+
+  ~Cached_secret() {
+    clear_buffer(m_data, m_size);
+
+#ifdef _WIN32
+    if (m_locked) {
+      VirtualUnlock(m_data, m_size);
+    }
+
+    VirtualFree(m_data, 0, MEM_RELEASE);
+#else   // !_WIN32
+    if (m_locked) {
+      munlock(m_data, m_size);
+    }
+
+    munmap(m_data, m_size);
+#endif  // !_WIN32
+  }
+
+  bool expired() const {
+    return std::chrono::steady_clock::now() >= m_expires;
+  }
+
+  std::string get() const { return std::string(m_data, m_length); }
+
+ private:
+  char *m_data = nullptr;
+  std::size_t m_size = 0;
+  std::size_t m_length;
+  bool m_locked = false;
+  std::chrono::steady_clock::time_point m_expires;
+};
+
 Credential_manager::Credential_manager() {
   observe_notification(SN_SHELL_OPTION_CHANGED);
 }
 
+Credential_manager::~Credential_manager() = default;
+
 Credential_manager &Credential_manager::get() {
   static Credential_manager instance;
   return instance;
@@ -259,7 +368,11 @@ void Credential_manager::register_options(Options *options) {
         }
 
         return ret_val.json(false);
-      });
+      })(
+      &m_cache_ttl, 60, k_cache_ttl_option,
+      "Number of seconds the passwords fetched from the credential helper are "
+      "cached in memory, 0 disables the cache.",
+      opts::Range<int>(0, std::numeric_limits<int>::max()));
 }
 
 void Credential_manager::handle_notification(const std::string &name,
@@ -274,11 +387,15 @@ void Credential_manager::handle_notification(const std::string &name,
       log_info(
           "Credential store helper changed to: %s",
           m_helper ? m_helper->name().path().c_str() : k_disabled_helper_name);
+    } else if (data->get_string("option") == k_cache_ttl_option) {
+      clear_cache();
     }
   }
 }
 
 void Credential_manager::set_helper(const std::string &helper) {
+  clear_cache();
+
   if (k_disabled_helper_name == helper) {
     m_helper.reset(nullptr);
   } else {
@@ -298,11 +415,21 @@ std::vector<std::string> Credential_manager::list_credential_helpers() const {
 
 bool Credential_manager::get_password(mysqlshdk::IConnection *options) const {
   if (m_helper) {
+    const auto spec = get_secret_spec(*options);
     std::string password;
-    bool ret = m_helper->get(get_secret_spec(*options), &password);
+
+    if (get_cached(spec.url, &password)) {
+      options->set_password(password);
+      clear_buffer(&password);
+      return true;
+    }
+
+    bool ret = m_helper->get(spec, &password);
 
     if (ret) {
       options->set_password(password);
+      cache(spec.url, password);
+      clear_buffer(&password);
     } else {
       auto error = m_helper->get_last_error();
       if (k_no_such_secret_error != error) {
@@ -319,10 +446,13 @@ bool Credential_manager::get_password(mysqlshdk::IConnection *options) const {
 
 bool Credential_manager::save_password(const mysqlshdk::IConnection &options) {
   if (m_helper && should_save_password(get_url(options))) {
-    bool ret =
-        m_helper->store(get_secret_spec(options), options.get_password());
+    const auto spec = get_secret_spec(options);
+    bool ret = m_helper->store(spec, options.get_password());
 
-    if (!ret) {
+    if (ret) {
+      cache(spec.url, options.get_password());
+    } else {
+      uncache(spec.url);
       mysqlsh::current_console()->print_error("Failed to store the password: " +
                                               m_helper->get_last_error());
     }
@@ -336,7 +466,10 @@ bool Credential_manager::save_password(const mysqlshdk::IConnection &options) {
 bool Credential_manager::remove_password(
     const mysqlshdk::IConnection &options) {
   if (m_helper) {
-    bool ret = m_helper->erase(get_secret_spec(options));
+    const auto spec = get_secret_spec(options);
+    uncache(spec.url);
+
+    bool ret = m_helper->erase(spec);
 
     if (!ret) {
       mysqlsh::current_console()->print_error("Failed to erase the password: " +
@@ -374,6 +507,8 @@ void Credential_manager::store_credential(const std::string &url,
         "Cannot save the credential, current credential helper is invalid");
   }
 
+  uncache(url);
+
   if (!m_helper->store({Secret_type::PASSWORD, url}, credential)) {
     auto error = m_helper->get_last_error();
 
@@ -391,6 +526,8 @@ void Credential_manager::delete_credential(const std::string &url) {
         "Cannot delete the credential, current credential helper is invalid");
   }
 
+  uncache(url);
+
   if (!m_helper->erase({Secret_type::PASSWORD, url})) {
     auto error = m_helper->get_last_error();
 
@@ -409,6 +546,8 @@ void Credential_manager::delete_all_credentials() {
         "Cannot delete all credentials, current credential helper is invalid");
   }
 
+  clear_cache();
+
   std::vector<Secret_spec> specs;
 
   if (!m_helper->list(&specs)) {
@@ -508,4 +647,53 @@ bool Credential_manager::is_ignored_url(const std::string &url) const {
   return false;
 }
 
+bool Credential_manager::get_cached(const std::string &url,
+                                    std::string *secret) const {
+  std::lock_guard lock{m_cache_mutex};
+  const auto it = m_cache.find(url);
+
+  if (m_cache.end() == it) {
+    return false;
+  }
+
+  if (it->second->expired()) {
+    m_cache.erase(it);
+    return false;
+  }
+
+  *secret = it->second->get();
+  return true;
+}
+
+void Credential_manager::cache(const std::string &url,
+                               const std::string &secret) const {
+  if (m_cache_ttl <= 0) {
+    return;
+  }
+
+  const auto expires =
+      std::chrono::steady_clock::now() + std::chrono::seconds(m_cache_ttl);
+  std::unique_ptr<Cached_secret> cached;
+
+  try {
+    cached = std::make_unique<Cached_secret>(secret, expires);
+  } catch (const std::exception &e) {
+    log_debug2("Failed to cache a credential: %s", e.what());
+    return;
+  }
+
+  std::lock_guard lock{m_cache_mutex};
+  m_cache[url] = std::move(cached);
+}
+
+void Credential_manager::uncache(const std::string &url) const {
+  std::lock_guard lock{m_cache_mutex};
+  m_cache.erase(url);
+}
+
+void Credential_manager::clear_cache() const {
+  std::lock_guard lock{m_cache_mutex};
+  m_cache.clear();
+}
+
 }  // namespace shcore
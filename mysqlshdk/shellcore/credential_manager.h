@@ -24,8 +24,11 @@
 #ifndef MYSQLSHDK_SHELLCORE_CREDENTIAL_MANAGER_H_
 #define MYSQLSHDK_SHELLCORE_CREDENTIAL_MANAGER_H_
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "mysqlshdk/include/shellcore/shell_notifications.h"
@@ -89,18 +92,35 @@ class Credential_manager : public NotificationObserver {
   std::vector<std::string> list_credentials() const;
 
  private:
+  class Cached_secret;
+
   Credential_manager();
-  ~Credential_manager() = default;
+  ~Credential_manager();
 
   void add_ignore_filter(const std::string &filter);
 
   bool is_ignored_url(const std::string &url) const;
 
+  bool get_cached(const std::string &url, std::string *secret) const;
+
+  void cache(const std::string &url, const std::string &secret) const;
+
+  void uncache(const std::string &url) const;
+
+  void clear_cache() const;
+
   std::unique_ptr<::mysql::secret_store::api::Helper_interface> m_helper;
   std::string m_helper_string;
   Save_passwords m_save_passwords = Save_passwords::PROMPT;
   std::vector<std::string> m_ignore_filters;
   bool m_is_initialized = false;
+
+  // secrets fetched from the helper, so that the subsequent connections to
+  // the same URL do not have to execute it again
+  int m_cache_ttl = 60;
+  mutable std::mutex m_cache_mutex;
+  mutable std::unordered_map<std::string, std::unique_ptr<Cached_secret>>
+      m_cache;
 };
 
 }  // namespace shcore
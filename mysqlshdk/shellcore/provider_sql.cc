@@ -60,6 +60,10 @@ namespace {
 
 const Version k_current_version{MYSH_VERSION};
 
+// maximum number of schemas which have their objects cached, if this limit is
+// reached, objects of the least recently used schema are removed from cache
+constexpr std::size_t k_max_loaded_schemas = 16;
+
 struct Instance {
   class Object {
    public:
@@ -101,6 +105,20 @@ struct Instance {
     Tables tables;
     Objects triggers;
     Tables views;
+    // whether objects of this schema were fetched
+    bool loaded = false;
+    // when this schema was last used for completion
+    uint64_t last_used = 0;
+
+    void clear() {
+      events.clear();
+      functions.clear();
+      procedures.clear();
+      tables.clear();
+      triggers.clear();
+      views.clear();
+      loaded = false;
+    }
   };
   using Schemas = std::vector<Schema>;
 
@@ -152,6 +170,7 @@ class Provider_sql::Cache final {
   void refresh_schemas(
       const std::shared_ptr<mysqlshdk::db::ISession> &session) {
     m_cancelled = false;
+    m_session = session;
 
     fetch_schemas(session);
   }
@@ -159,6 +178,7 @@ class Provider_sql::Cache final {
   void refresh_schema(const std::shared_ptr<mysqlshdk::db::ISession> &session,
                       const std::string &schema, bool force) {
     m_cancelled = false;
+    m_session = session;
 
     // cache schema names if not done yet
     if (m_instance.schemas.empty() || force) {
@@ -178,28 +198,53 @@ class Provider_sql::Cache final {
     }
 
     if (auto s = find(&m_instance.schemas, schema)) {
-      if (s->tables.empty() || force) {
-        fetch_tables(session, s);
+      if (!s->loaded || force) {
+        load_schema(session, s);
       }
+    }
+  }
 
-      if (s->views.empty() || force) {
-        fetch_views(session, s);
-      }
+  /**
+   * Fetches objects of the schemas referenced by the completion result, which
+   * were not loaded yet. Uses the session which was used to refresh the
+   * cache, does nothing if cache was not refreshed.
+   */
+  void load_schemas(const mysqlshdk::Sql_completion_result &result) {
+    const auto session = m_session.lock();
 
-      if (s->functions.empty() || force) {
-        fetch_functions(session, s);
-      }
+    if (!session || !session->is_open()) {
+      return;
+    }
 
-      if (s->procedures.empty() || force) {
-        fetch_procedures(session, s);
-      }
+    Names schemas;
+
+    for (const auto names :
+         {&result.tables_from, &result.views_from, &result.functions_from,
+          &result.procedures_from, &result.triggers_from,
+          &result.events_from}) {
+      schemas.insert(names->begin(), names->end());
+    }
 
-      if (s->events.empty() || force) {
-        fetch_events(session, s);
+    for (const auto columns : {&result.columns, &result.internal_columns}) {
+      for (const auto &schema : *columns) {
+        schemas.emplace(schema.first);
       }
+    }
+
+    m_cancelled = false;
+
+    for (const auto &schema : schemas) {
+      if (auto s = find(&m_instance.schemas, schema)) {
+        s->last_used = ++m_use_counter;
 
-      if (s->triggers.empty() || force) {
-        fetch_triggers(session, s);
+        if (!s->loaded) {
+          try {
+            load_schema(session, s);
+          } catch (const std::exception &e) {
+            log_warning("Failed to fetch objects of schema %s: %s",
+                        shcore::quote_identifier(schema).c_str(), e.what());
+          }
+        }
       }
     }
   }
@@ -484,6 +529,7 @@ class Provider_sql::Cache final {
 
   void clear_cache() {
     m_instance.clear();
+    m_session.reset();
     set_system_functions(k_current_version);
   }
 
@@ -519,10 +565,20 @@ class Provider_sql::Cache final {
     return const_cast<T *>(find(*container, name));
   }
 
+  template <class T, is_instance_object<T> = 0>
+  static T *find(std::vector<T> *container, const std::wstring &name) {
+    return const_cast<T *>(find(*container, name));
+  }
+
   template <class T, is_instance_object<T> = 0>
   static const T *find(const std::vector<T> &container,
                        const std::string &name) {
-    const auto wname = shcore::utf8_to_wide(name);
+    return find(container, shcore::utf8_to_wide(name));
+  }
+
+  template <class T, is_instance_object<T> = 0>
+  static const T *find(const std::vector<T> &container,
+                       const std::wstring &wname) {
     const auto range = std::equal_range(container.begin(), container.end(),
                                         wname, Compare_ci{});
 
@@ -645,20 +701,107 @@ class Provider_sql::Cache final {
             std::string{target == &schema->tables ? "=" : "<>"} +
             "'BASE TABLE' AND TABLE_SCHEMA=" + quote_sql_string(schema->name()),
         target);
+  }
 
-    for (auto &table : *target) {
-      fetch_columns(session, schema, &table);
+  /**
+   * Fetches columns of all tables and views in the given schema using a single
+   * query.
+   */
+  void fetch_columns(const std::shared_ptr<mysqlshdk::db::ISession> &session,
+                     Instance::Schema *schema) {
+    if (m_cancelled || (schema->tables.empty() && schema->views.empty())) {
+      return;
+    }
+
+    for (auto tables : {&schema->tables, &schema->views}) {
+      for (auto &table : *tables) {
+        table.columns.clear();
+      }
+    }
+
+    if (const auto result = session->query(
+            "SELECT TABLE_NAME, COLUMN_NAME FROM INFORMATION_SCHEMA.COLUMNS "
+            "WHERE TABLE_SCHEMA=" +
+            quote_sql_string(schema->name()))) {
+      Instance::Table *table = nullptr;
+      std::wstring table_name;
+
+      while (!m_cancelled) {
+        const auto row = result->fetch_one();
+
+        if (!row) {
+          break;
+        }
+
+        auto name = row->get_wstring(0);
+
+        if (!table || name != table_name) {
+          table_name = std::move(name);
+          table = find(&schema->tables, table_name);
+
+          if (!table) {
+            table = find(&schema->views, table_name);
+          }
+        }
+
+        if (table) {
+          table->columns.emplace_back(row->get_wstring(1));
+        }
+      }
+    }
+
+    if (m_cancelled) {
+      return;
+    }
+
+    for (auto tables : {&schema->tables, &schema->views}) {
+      for (auto &table : *tables) {
+        sort(&table.columns);
+      }
     }
   }
 
-  void fetch_columns(const std::shared_ptr<mysqlshdk::db::ISession> &session,
-                     const Instance::Schema *schema, Instance::Table *table) {
-    fetch(session,
-          "SELECT COLUMN_NAME FROM INFORMATION_SCHEMA.COLUMNS WHERE "
-          "TABLE_SCHEMA=" +
-              quote_sql_string(schema->name()) +
-              " AND TABLE_NAME=" + quote_sql_string(table->name()),
-          &table->columns);
+  void load_schema(const std::shared_ptr<mysqlshdk::db::ISession> &session,
+                   Instance::Schema *schema) {
+    fetch_tables(session, schema);
+    fetch_views(session, schema);
+    fetch_columns(session, schema);
+    fetch_functions(session, schema);
+    fetch_procedures(session, schema);
+    fetch_events(session, schema);
+    fetch_triggers(session, schema);
+
+    if (m_cancelled) {
+      return;
+    }
+
+    schema->loaded = true;
+    schema->last_used = ++m_use_counter;
+
+    evict_schemas();
+  }
+
+  void evict_schemas() {
+    std::vector<Instance::Schema *> loaded;
+
+    for (auto &schema : m_instance.schemas) {
+      if (schema.loaded) {
+        loaded.emplace_back(&schema);
+      }
+    }
+
+    if (loaded.size() <= k_max_loaded_schemas) {
+      return;
+    }
+
+    std::sort(loaded.begin(), loaded.end(), [](const auto l, const auto r) {
+      return l->last_used < r->last_used;
+    });
+
+    for (std::size_t i = 0, count = loaded.size() - k_max_loaded_schemas;
+         i < count; ++i) {
+      loaded[i]->clear();
+    }
   }
 
   void fetch_functions(const std::shared_ptr<mysqlshdk::db::ISession> &session,
@@ -836,6 +979,9 @@ class Provider_sql::Cache final {
 
   Instance m_instance;
   volatile bool m_cancelled = false;
+  // session used to load objects of schemas on demand
+  std::weak_ptr<mysqlshdk::db::ISession> m_session;
+  uint64_t m_use_counter = 0;
 };
 
 Provider_sql::Provider_sql()
@@ -877,6 +1023,9 @@ Completion_list Provider_sql::complete(const std::string &buffer,
   // we can adjust compl_offset accordingly.
   auto result = m_completion_context.complete(sql, sql.length());
 
+  // objects of other schemas are fetched once they are needed
+  m_cache->load_schemas(result);
+
   if (result.context.prefix.full.length() <= line.length()) {
     *compl_offset = line.length() - result.context.prefix.full.length();
   } else {
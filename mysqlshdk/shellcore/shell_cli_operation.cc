@@ -160,6 +160,22 @@ void Shell_cli_operation::set_method_name(const std::string &name) {
   m_cli_mapper.set_operation_name(name);
 }
 
+std::vector<std::string> Shell_cli_operation::target_path() const {
+  auto path = m_cli_mapper.get_object_chain();
+
+  if (!m_method_name_original.empty()) {
+    path.emplace_back(m_method_name_original);
+  } else {
+    for (const auto &arg : m_cli_mapper.get_cmdline_args()) {
+      if (!arg.option.empty()) break;
+
+      path.emplace_back(arg.definition);
+    }
+  }
+
+  return path;
+}
+
 /**
  * Parses the command line to identify the operation to be executed as well as
  * to aggregate the received arguments into a list for further processing.
@@ -51,6 +51,13 @@ class Shell_cli_operation {
 
   bool help_requested() { return m_cli_mapper.help_requested(); }
 
+  /**
+   * Names of the objects and of the operation given in the command line,
+   * before the operation is identified (i.e. positional arguments may follow
+   * the operation name).
+   */
+  std::vector<std::string> target_path() const;
+
   void prepare();
 
   Value execute();
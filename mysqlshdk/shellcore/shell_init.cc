@@ -34,7 +34,6 @@
 
 #ifdef HAVE_V8
 namespace shcore {
-extern void JScript_context_init();
 extern void JScript_context_fini();
 }  // namespace shcore
 #endif
@@ -63,9 +62,7 @@ void thread_init() { mysql_thread_init(); }
 void thread_end() { mysql_thread_end(); }
 
 void global_init() {
-#ifdef HAVE_V8
-  shcore::JScript_context_init();
-#endif
+  // V8 is initialized once the first JS context is created
 
   mysql_library_init(0, nullptr, nullptr);
 
@@ -33,6 +33,9 @@
 #include "mysqlshdk/libs/db/uri_common.h"
 #include "mysqlshdk/libs/db/uri_parser.h"
 #include "mysqlshdk/libs/utils/log_sql.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/thread_affinity.h"
+#include "mysqlshdk/libs/utils/tracing.h"
 #include "mysqlshdk/shellcore/credential_manager.h"
 #include "shellcore/ishell_core.h"
 #include "shellcore/shell_notifications.h"
@@ -332,7 +335,33 @@ Shell_options::Shell_options(
       })
     (&storage.ssh.buffer_size, 10240, "ssh.bufferSize",
     "Set buffer size in bytes for data transfer, default is 10240 (10Kb)",
-      shcore::opts::Range<int>(0, std::numeric_limits<int>::max()));
+      shcore::opts::Range<int>(0, std::numeric_limits<int>::max()))
+    (&storage.ssh.tunnel_sessions, 1, "ssh.tunnelSessions",
+    "Number of SSH sessions opened for each tunnel, default is 1",
+      shcore::opts::Range<int>(1, 64));
+
+  add_named_options(!flags.is_set(Option_flags::CONNECTION_ONLY))
+    (&storage.util.max_threads, 0, "util.maxThreads",
+    "Maximum number of threads shared by all utility operations which are "
+    "running concurrently, default is 0 (not limited)",
+      shcore::opts::Range<int>(0, std::numeric_limits<int>::max()))
+    (&storage.util.max_rate, "", "util.maxRate",
+    "Maximum throughput in bytes per second shared by all utility operations "
+    "which are running concurrently, default is empty (not limited)",
+      [](const std::string &value, Source) {
+        if (!value.empty()) {
+          mysqlshdk::utils::expand_to_bytes(value);
+        }
+
+        return value;
+      })
+    (&storage.util.thread_affinity, "none", "util.threadAffinity",
+    "Placement of the worker threads of utility operations on the CPUs, one "
+    "of: none, node, core, default is none",
+      [](const std::string &value, Source) {
+        return mysqlshdk::utils::to_string(
+            mysqlshdk::utils::to_thread_affinity(value));
+      });
 
 #ifdef _WIN32
   add_startup_options()
@@ -566,14 +595,17 @@ Shell_options::Shell_options(
     (cmdline("--pym <module>"),
        "Run Python library module as a script. Remaining args are forwarded to it.")
     (&storage.wrap_json, "off", cmdline("--json[=<format>]"),
-        "Produce output in JSON format. Allowed values: raw, pretty, and off. "
-        "If no format is specified pretty format is produced.",
+        "Produce output in JSON format. Allowed values: raw, pretty, stream "
+        "and off. If no format is specified pretty format is produced. The "
+        "stream format is the same as raw, except that rows of the results "
+        "are written as soon as they are received, one per line.",
         [](const std::string &val, Source) {
           if (val == "off") return "off";
           if (val.empty() || val == "pretty") return "json";
           if (val == "raw") return "json/raw";
+          if (val == "stream") return "json/stream";
           throw std::invalid_argument(
-              "Value for --json must be either pretty, raw or off.");
+              "Value for --json must be either pretty, raw, stream or off.");
         })
     (cmdline("--table"),
         "Produce output in table format (default for interactive mode). This "
@@ -612,6 +644,17 @@ Shell_options::Shell_options(
                 " are: " RESULTSET_DUMPER_FORMATS);
           return val;
         })
+    (&storage.table_sample_rows, 1000, SHCORE_TABLE_SAMPLE_ROWS,
+        "Number of rows used to calculate the column widths of the table "
+        "output, if 0, widths are calculated using the column metadata.",
+        shcore::opts::Range<int>(0, std::numeric_limits<int>::max()))
+    (&storage.table_overflow, "expand", SHCORE_TABLE_OVERFLOW,
+        "Determines how the values which do not fit in the column of the "
+        "table output are printed. Allowed values: expand, truncate, wrap.",
+        [](const std::string &val, Source) {
+          Resultset_dumper_base::to_table_overflow(val);
+          return val;
+        })
     (&storage.interactive, false, SHCORE_INTERACTIVE,
         "Enables interactive mode", shcore::opts::Read_only<bool>())
     (&storage.db_name_cache, true, SHCORE_DB_NAME_CACHE,
@@ -626,7 +669,11 @@ Shell_options::Shell_options(
     (&storage.log_sql_ignore_unsafe, "*IDENTIFIED*:*PASSWORD*",
         SHCORE_LOG_SQL_IGNORE_UNSAFE,
         "Colon separated list of SQL statement patterns to filter out, unless logSql is set to 'unfiltered'."
-        "Default: *IDENTIFIED*:*PASSWORD*");
+        "Default: *IDENTIFIED*:*PASSWORD*")
+    (&storage.log_sql_stats_file, "", SHCORE_LOG_SQL_STATS_FILE,
+        "Path to a file where the latency statistics of the executed SQL "
+        "statements are written when the shell exits. Default: empty, "
+        "statistics are not written.");
 
   add_startup_options(true)
     (cmdline("--get-server-public-key"), "Request public key from the server "
@@ -704,6 +751,34 @@ Shell_options::Shell_options(
 
           return level;
         })
+    (&storage.log_async, "off", SHCORE_LOG_ASYNC,
+        cmdline("--log-async=off|drop|block"),
+        "Write the log file using a background thread: "
+        "off - messages are written by the thread which logs them; "
+        "drop - messages which do not fit in the buffer of the logging thread "
+        "are dropped; "
+        "block - logging thread waits until there is space in its buffer.",
+        [](const std::string &val, Source source) {
+          if (source == Source::User)
+            throw std::logic_error("This option is read only.");
+
+          shcore::Logger::Overflow_policy policy;
+          shcore::Logger::parse_async_mode(val, &policy);
+          return val;
+        })
+    (&storage.trace, "", SHCORE_TRACE, cmdline("--trace=<path>"),
+        "Write timings of sessions, storage, compression, REST requests, "
+        "dump and load operations to the given file, in the Chrome trace "
+        "event format. Default: empty, tracing is disabled.",
+        [](const std::string &val, Source) {
+          if (val.empty()) {
+            mysqlshdk::tracing::stop();
+          } else {
+            mysqlshdk::tracing::start(val);
+          }
+
+          return val;
+        })
     (&storage.dba_log_sql, 0, SHCORE_DBA_LOG_SQL,
         cmdline("--dba-log-sql[={0|1|2}]"),
         "Log SQL statements executed by AdminAPI operations: "
@@ -748,6 +823,13 @@ Shell_options::Shell_options(
         "Display column type information in SQL mode. Please be aware that "
         "output may depend on the protocol you are using to connect to the "
         "server, e.g. DbType field is approximated when using X protocol.")
+    (&storage.source_batch_size, 0, SHCORE_SOURCE_BATCH_SIZE,
+        cmdline("--source-batch-size=<bytes>"),
+        "Maximum size in bytes of a batch of consecutive INSERT, REPLACE, "
+        "UPDATE and DELETE statements which are sent to the server in a single "
+        "request when an SQL script is executed using a classic session. "
+        "Default: 0, statements are not batched.",
+        shcore::opts::Range<int>(0, std::numeric_limits<int>::max()))
     (&storage.history_max_size, 1000, SHCORE_HISTORY_MAX_SIZE,
         "Shell's history maximum size",
         shcore::opts::Range<int>(0, std::numeric_limits<int>::max()))
@@ -768,6 +850,16 @@ Shell_options::Shell_options(
         "Checks SSL settings and network connectivity between instances when "
         "creating a cluster, replicaset or clusterset, or adding an instance "
         "to one.")
+    (&storage.dba_max_concurrency, 16, SHCORE_DBA_MAX_CONCURRENCY,
+        "Maximum number of instances which are contacted at the same time "
+        "when the status of a Cluster, ClusterSet or ReplicaSet is checked.",
+        shcore::opts::Range<int>(1, 1024))
+    (&storage.dba_pool_idle_timeout, 0, SHCORE_DBA_POOL_IDLE_TIMEOUT,
+        "Time in seconds the sessions opened by an AdminAPI operation on a "
+        "Cluster, ClusterSet or ReplicaSet object are kept open to be reused "
+        "by the next operations on the same object. Default: 0, sessions are "
+        "closed at the end of each operation.",
+        shcore::opts::Range<int>(0, std::numeric_limits<int>::max()))
     (&storage.wizards, true, SHCORE_USE_WIZARDS, "Enables wizard mode.")
     (&storage.initial_mode, shcore::IShell_core::Mode::None,
         "defaultMode", "Specifies the shell mode to use when shell is started "
@@ -926,6 +1018,8 @@ Shell_options::Shell_options(
 #endif
         storage.dbug_options = value ? value : "";
       })
+      (cmdline("--debug-startup"),
+        assign_value(&storage.debug_startup, true))
 ;  // <-- Note this is on purpose: Mark the termination of the option definition.
   // clang-format on
 
@@ -49,6 +49,86 @@ static constexpr const int k_pre_fetch_result_rows = 1000;
 
 namespace mysqlsh {
 
+namespace {
+
+constexpr uint64_t k_ones = 0x0101010101010101ULL;
+constexpr uint64_t k_high_bits = 0x8080808080808080ULL;
+
+// non-zero if any of the bytes is equal to 0
+inline uint64_t has_zero_byte(uint64_t v) {
+  return (v - k_ones) & ~v & k_high_bits;
+}
+
+// non-zero if any of the bytes is equal to b
+inline uint64_t has_byte(uint64_t v, uint8_t b) {
+  return has_zero_byte(v ^ (k_ones * b));
+}
+
+/**
+ * Calculates sizes of a run of ASCII characters, starting at the given
+ * position. Eight bytes are checked at a time, bytes which require special
+ * handling are processed one by one.
+ *
+ * @returns end of the run, either end of text or first non-ASCII character
+ */
+const char *get_ascii_sizes(const char *index, const char *end,
+                            Print_flags flags, size_t *char_count,
+                            size_t *byte_count) {
+  const bool print_ctrl = flags.is_set(Print_flag::PRINT_CTRL);
+
+  const auto process = [&](char c) {
+    if ('\0' == c) {
+      if (flags.is_set(Print_flag::PRINT_0_AS_SPC)) {
+        ++*char_count;
+        ++*byte_count;
+      } else if (flags.is_set(Print_flag::PRINT_0_AS_ESC)) {
+        *char_count += 2;
+        *byte_count += 2;
+      } else {
+        ++*byte_count;
+      }
+    } else {
+      if (print_ctrl && ('\t' == c || '\n' == c || '\\' == c)) {
+        ++*char_count;
+        ++*byte_count;
+      }
+
+      ++*char_count;
+      ++*byte_count;
+    }
+  };
+
+  while (end - index >= 8) {
+    uint64_t word;
+    memcpy(&word, index, sizeof(word));
+
+    if (word & k_high_bits) {
+      break;
+    }
+
+    if (has_zero_byte(word) ||
+        (print_ctrl && (has_byte(word, '\t') || has_byte(word, '\n') ||
+                        has_byte(word, '\\')))) {
+      for (int i = 0; i < 8; ++i) {
+        process(index[i]);
+      }
+    } else {
+      *char_count += 8;
+      *byte_count += 8;
+    }
+
+    index += 8;
+  }
+
+  while (index < end && static_cast<unsigned char>(*index) < 0x80) {
+    process(*index++);
+  }
+
+  return index;
+}
+
+}  // namespace
+
 /* Calculates the required buffer size and display size considering:
  * - Some single byte characters may require injection of escaped sequence \\
  * - Some multibyte characters are displayed in the space of a single character
@@ -71,6 +151,14 @@ std::tuple<size_t, size_t> get_utf8_sizes(const char *text, size_t length,
   const char *index = text;
   const char *end = index + length;
 
+  // fast path for ASCII-only text
+  if (get_ascii_sizes(index, end, flags, &char_count, &byte_count) == end) {
+    return {char_count, byte_count};
+  }
+
+  char_count = 0;
+  byte_count = 0;
+
 #ifdef _WIN32
   // By default, we assume no multibyte content on the string and
   // no escaped characters.
@@ -154,6 +242,12 @@ std::tuple<size_t, size_t> get_utf8_sizes(const char *text, size_t length,
 #else
   std::mblen(NULL, 0);
   while (index < end) {
+    if (static_cast<unsigned char>(*index) < 0x80) {
+      // runs of ASCII characters are processed in bulk
+      index = get_ascii_sizes(index, end, flags, &char_count, &byte_count);
+      continue;
+    }
+
     int width = std::mblen(index, end - index);
 
     // handles single byte characters
@@ -309,47 +403,46 @@ class Field_formatter {
     }
   }
 
-  bool put(const mysqlshdk::db::IRow *row, size_t index) {
-    reset();
-
-    std::string tmp;
-    const char *data;
-    size_t length;
-
-    size_t display_size;
-    size_t buffer_size;
-
+  /**
+   * Provides the text representation of the given value, without any
+   * padding.
+   */
+  std::string text(const mysqlshdk::db::IRow *row, size_t index) {
     if (row->is_null(index)) {
-      data = "NULL";
-      display_size = buffer_size = length = 4;
+      return "NULL";
     } else if (m_is_numeric) {
-      tmp = get_number_string(row, index);
+      auto tmp = get_number_string(row, index);
 
       if (m_zerofill > tmp.length()) {
         tmp = std::string(m_zerofill - tmp.length(), '0').append(tmp);
       }
-      data = tmp.data();
-      display_size = buffer_size = length = tmp.length();
+
+      return tmp;
     } else if (m_type == mysqlshdk::db::Type::Bit) {
       auto [bit_value, bit_size] = row->get_bit(index);
-      tmp = shcore::bits_to_string_hex(bit_value, bit_size);
-
-      data = tmp.data();
-      display_size = buffer_size = length = tmp.length();
+      return shcore::bits_to_string_hex(bit_value, bit_size);
     } else if (m_type == mysqlshdk::db::Type::Bytes) {
-      std::tie(data, length) = row->get_string_data(index);
+      const auto [data, length] = row->get_string_data(index);
+      return shcore::string_to_hex({data, length});
+    } else {
+      return row->get_as_string(index);
+    }
+  }
 
-      tmp = shcore::string_to_hex({data, length});
-      data = tmp.data();
-      length = tmp.size();
+  bool put(const mysqlshdk::db::IRow *row, size_t index) {
+    reset();
 
-      std::tie(display_size, buffer_size) =
-          get_utf8_sizes(data, length, m_flags);
-    } else {
-      tmp = row->get_as_string(index);
-      data = tmp.data();
-      length = tmp.length();
+    const auto tmp = text(row, index);
+    const auto data = tmp.data();
+    const auto length = tmp.length();
+
+    size_t display_size;
+    size_t buffer_size;
 
+    if (row->is_null(index) || m_is_numeric ||
+        m_type == mysqlshdk::db::Type::Bit) {
+      display_size = buffer_size = length;
+    } else {
       std::tie(display_size, buffer_size) =
           get_utf8_sizes(data, length, m_flags);
     }
@@ -366,9 +459,51 @@ class Field_formatter {
     return true;
   }
 
+  /**
+   * Calculates the column width using its metadata, instead of the values.
+   */
+  void process_metadata(const mysqlshdk::db::Column &column) {
+    // This function is meant to be called only for tables
+    assert(m_format == ResultFormat::TABLE);
+    // string columns may be very wide, their width is limited
+    constexpr size_t k_max_string_width = 64;
+    const size_t length = column.get_length();
+    size_t width = length;
+    size_t bytes = length;
+
+    if (m_type == mysqlshdk::db::Type::Bit) {
+      width = bytes = shcore::bits_to_string_hex_size(length) + 2;
+    } else if (m_type == mysqlshdk::db::Type::Bytes) {
+      width = bytes = std::min(2 + length * 2, k_max_string_width);
+    } else if (!m_is_numeric) {
+      const auto charset = column.get_charset_name();
+      size_t char_size = 1;
+
+      if (shcore::str_beginswith(charset, "utf8mb4") ||
+          shcore::str_beginswith(charset, "utf32") ||
+          shcore::str_beginswith(charset, "utf16")) {
+        char_size = 4;
+      } else if (shcore::str_beginswith(charset, "utf8")) {
+        char_size = 3;
+      } else if (shcore::str_beginswith(charset, "ucs2")) {
+        char_size = 2;
+      }
+
+      width = std::min(length / char_size, k_max_string_width);
+      bytes = width * char_size;
+    }
+
+    m_max_display_length = std::max(m_max_display_length, width);
+    m_max_buffer_length =
+        std::max(m_max_buffer_length,
+                 std::min<size_t>(bytes, MAX_DISPLAY_LENGTH));
+    m_max_mb_holes = std::max(m_max_mb_holes, bytes - width);
+  }
+
   const std::string &str() const { return m_buffer; }
   size_t get_max_display_length() const { return m_max_display_length; }
   size_t get_max_buffer_length() const { return m_max_buffer_length; }
+  bool align_right() const { return m_align_right; }
 
  private:
   std::string m_buffer;
@@ -451,6 +586,113 @@ class Field_formatter {
   }
 };
 
+/**
+ * Splits the text into lines which fit in the given display width, new line
+ * characters always start a new line. If wrap is false, only the first line
+ * is returned, if text was truncated, it ends with "...".
+ *
+ * @returns lines and their display widths
+ */
+std::vector<std::pair<std::string, size_t>> fit_text(std::string_view text,
+                                                     size_t width, bool wrap) {
+  std::vector<std::pair<std::string, size_t>> lines(1);
+  // offsets and display widths of characters in the current line
+  std::vector<std::pair<size_t, size_t>> chars;
+  bool truncated = false;
+  size_t i = 0;
+
+  while (i < text.length()) {
+    auto &line = lines.back();
+    const auto c = static_cast<unsigned char>(text[i]);
+
+    if ('\n' == c) {
+      ++i;
+
+      if (!wrap) {
+        truncated = i < text.length();
+        break;
+      }
+
+      lines.emplace_back();
+      chars.clear();
+      continue;
+    }
+
+    size_t size = 1;
+    size_t char_width = 1;
+    char replacement = 0;
+
+    if (c >= 0x80) {
+      size = c >= 0xF8 ? 1 : c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+      char32_t code_point = c & (0x7F >> size);
+
+      for (size_t b = 1; b < size; ++b) {
+        const auto next = i + b < text.length()
+                              ? static_cast<unsigned char>(text[i + b])
+                              : 0;
+
+        if (0x80 != (next & 0xC0)) {
+          // invalid sequence, byte is printed as is
+          size = 1;
+          break;
+        }
+
+        code_point = (code_point << 6) | (next & 0x3F);
+      }
+
+      if (size > 1) {
+        const auto w = getWcwidth(code_point);
+        char_width = w < 0 ? 0 : w;
+      }
+    } else if ('\0' == c || '\t' == c || '\r' == c) {
+      replacement = ' ';
+    } else if (c < 0x20) {
+      char_width = 0;
+    }
+
+    // each line holds at least one character
+    if (line.second + char_width > width && !chars.empty()) {
+      if (wrap) {
+        lines.emplace_back();
+        chars.clear();
+        continue;
+      }
+
+      truncated = true;
+      break;
+    }
+
+    chars.emplace_back(line.first.length(), char_width);
+
+    if (replacement) {
+      line.first += replacement;
+    } else {
+      line.first.append(text.data() + i, size);
+    }
+
+    line.second += char_width;
+    i += size;
+  }
+
+  if (truncated) {
+    constexpr std::string_view k_ellipsis = "...";
+    auto &line = lines.back();
+
+    if (width >= k_ellipsis.length()) {
+      while (!chars.empty() && line.second + k_ellipsis.length() > width) {
+        line.first.resize(chars.back().first);
+        line.second -= chars.back().second;
+        chars.pop_back();
+      }
+
+      line.first += k_ellipsis;
+      line.second += k_ellipsis.length();
+    }
+  }
+
+  return lines;
+}
+
 class Console_printer : public Resultset_printer {
  public:
   Console_printer() : m_console(mysqlsh::current_console()) {}
@@ -495,6 +737,7 @@ Resultset_dumper_base::Resultset_dumper_base(
     const std::string &wrap_json, const std::string &format,
     bool show_column_type_info)
     : m_result(target),
+      m_table_sample_rows(k_pre_fetch_result_rows),
       m_wrap_json(wrap_json),
       m_format(format),
       m_printer(std::move(printer)),
@@ -519,7 +762,12 @@ Resultset_dumper::Resultset_dumper(mysqlshdk::db::IResult *target,
     : Resultset_dumper_base(target, std::make_unique<Console_printer>(),
                             wrap_json, format, show_column_type_info),
       m_show_warnings(show_warnings),
-      m_show_stats(show_stats) {}
+      m_show_stats(show_stats) {
+  const auto &options = mysqlsh::current_shell_options()->get();
+
+  m_table_sample_rows = options.table_sample_rows;
+  m_table_overflow = to_table_overflow(options.table_overflow);
+}
 
 size_t Resultset_dumper::dump(const std::string &item_label, bool is_query,
                               bool is_doc_result) {
@@ -606,14 +854,17 @@ size_t Resultset_dumper::dump(const std::string &item_label, bool is_query,
 /**
  * This utility function creates a JSON document including all the fields in a
  * given row and appends it to a JSON_dumper object.
+ *
+ * Values are written straight from the row buffers, without creating any
+ * intermediate objects.
  */
 void dump_json_row(shcore::JSON_dumper *dumper,
                    const std::vector<mysqlshdk::db::Column> &metadata,
-                   const mysqlshdk::db::IRow *row) {
+                   const mysqlshdk::db::IRow *row, size_t binary_limit) {
   dumper->start_object();
 
   for (size_t col_index = 0; col_index < metadata.size(); col_index++) {
-    auto column = metadata[col_index];
+    const auto &column = metadata[col_index];
 
     dumper->append_string(column.get_column_label());
     auto type = column.get_type();
@@ -621,15 +872,16 @@ void dump_json_row(shcore::JSON_dumper *dumper,
       dumper->append_null();
     } else if (mysqlshdk::db::is_string_type(type)) {
       if (type == mysqlshdk::db::Type::Json) {
-        dumper->append_json(row->get_string(col_index));
+        const char *data;
+        size_t length;
+        row->get_raw_data(col_index, &data, &length);
+        dumper->append_json(data, length);
       } else if (type == mysqlshdk::db::Type::Bytes) {
         auto data = row->get_string_data(col_index);
         std::string encoded;
-        size_t binary_limit = data.second;
-        if (mysqlsh::current_shell_options()->get().binary_limit > 0) {
-          binary_limit = std::min(
-              data.second,
-              mysqlsh::current_shell_options()->get().binary_limit + 1);
+        size_t limit = data.second;
+        if (binary_limit > 0) {
+          limit = std::min(data.second, binary_limit + 1);
         }
 
         shcore::encode_base64(
@@ -638,8 +890,11 @@ void dump_json_row(shcore::JSON_dumper *dumper,
             // At most binary-limit + 1 bytes shuold be sent, when the extra
             // byte is sent, it will be an indicator for the consumer of the
             // data that a truncation happened
-            binary_limit, &encoded);
+            limit, &encoded);
         dumper->append_string(encoded);
+      } else if (type == mysqlshdk::db::Type::String) {
+        const auto data = row->get_string_data(col_index);
+        dumper->append_string(data.first, data.second);
       } else {
         auto data = row->get_as_string(col_index);
         dumper->append_string(data.c_str(), data.length());
@@ -662,6 +917,14 @@ void dump_json_row(shcore::JSON_dumper *dumper,
   dumper->end_object();
 }
 
+void dump_json_document(shcore::JSON_dumper *dumper,
+                        const mysqlshdk::db::IRow *row) {
+  const char *data;
+  size_t length;
+  row->get_raw_data(0, &data, &length);
+  dumper->append_json(data, length);
+}
+
 /**
  * Dumps a JSON document for each row/document contained on the result
  * being processed.
@@ -675,10 +938,14 @@ size_t Resultset_dumper_base::dump_documents(bool is_doc_result) {
 
   if (!row) return row_count;
 
+  const auto binary_limit =
+      mysqlsh::current_shell_options()->get().binary_limit;
+  // the same dumper is used for all rows, so that its buffer is reused
+  shcore::JSON_dumper dumper(pretty, binary_limit);
+
   if (as_array) m_printer->raw_print("[\n");
   while (row) {
-    shcore::JSON_dumper dumper(
-        pretty, mysqlsh::current_shell_options()->get().binary_limit);
+    dumper.reset();
 
     if (row_count > 0) {
       if (as_array)
@@ -688,9 +955,9 @@ size_t Resultset_dumper_base::dump_documents(bool is_doc_result) {
     }
 
     if (is_doc_result)
-      dumper.append_json(row->get_string(0));
+      dump_json_document(&dumper, row);
     else
-      dump_json_row(&dumper, metadata, row);
+      dump_json_row(&dumper, metadata, row, binary_limit);
 
     m_printer->raw_print(dumper.str());
 
@@ -803,6 +1070,60 @@ size_t Resultset_dumper_base::format_vertical(bool has_header, bool align_right,
   return row_index;
 }
 
+void Resultset_dumper_base::append_json_summary(shcore::JSON_dumper *dumper,
+                                                bool is_doc_result) {
+  dumper->append_string("executionTime");
+  dumper->append_string(
+      mysqlshdk::utils::format_seconds(m_result->get_execution_time()));
+  if (!is_doc_result) {
+    dumper->append_string("affectedRowCount");
+    dumper->append_uint64(m_result->get_affected_row_count());
+  }
+  dumper->append_string("affectedItemsCount");
+  dumper->append_uint64(m_result->get_affected_row_count());
+  dumper->append_string("warningCount");
+  dumper->append_int64(m_result->get_warning_count());
+  dumper->append_string("warningsCount");
+  dumper->append_uint64(m_result->get_warning_count());
+  dumper->append_string("warnings");
+  dumper->start_array();
+  auto warning = m_result->fetch_one_warning();
+  while (warning) {
+    std::string level;
+    switch (warning->level) {
+      case mysqlshdk::db::Warning::Level::Note:
+        level = "Note";
+        break;
+      case mysqlshdk::db::Warning::Level::Warn:
+        level = "Warning";
+        break;
+      case mysqlshdk::db::Warning::Level::Error:
+        level = "Error";
+        break;
+    }
+    dumper->start_object();
+    dumper->append_string("Level", level);
+    dumper->append_string("Code");
+    dumper->append_int(warning->code);
+    dumper->append_string("Message", warning->msg);
+    dumper->end_object();
+    warning = m_result->fetch_one_warning();
+  }
+  dumper->end_array();
+
+  dumper->append_string("info");
+  dumper->append_string(m_result->get_info());
+
+  dumper->append_string("autoIncrementValue");
+  dumper->append_int64(m_result->get_auto_increment_value());
+
+  if (const auto statement_id = m_result->get_statement_id();
+      !statement_id.empty()) {
+    dumper->append_string("statementId");
+    dumper->append_string(statement_id);
+  }
+}
+
 /**
  * Creates a JSON Document including all the information in the result being
  * processd, this includes:
@@ -818,8 +1139,9 @@ std::string Resultset_dumper_base::format_json(const std::string &item_label,
                                                bool is_doc_result, bool pretty,
                                                int *row_count) {
   assert(row_count);
-  shcore::JSON_dumper dumper(
-      pretty, mysqlsh::current_shell_options()->get().binary_limit);
+  const auto binary_limit =
+      mysqlsh::current_shell_options()->get().binary_limit;
+  shcore::JSON_dumper dumper(pretty, binary_limit);
 
   dumper.start_object();
   dumper.append_string("hasData");
@@ -836,9 +1158,9 @@ std::string Resultset_dumper_base::format_json(const std::string &item_label,
     auto row = m_result->fetch_one();
     while (row) {
       if (is_doc_result) {
-        dumper.append_json(row->get_string(0));
+        dump_json_document(&dumper, row);
       } else {
-        dump_json_row(&dumper, metadata, row);
+        dump_json_row(&dumper, metadata, row, binary_limit);
       }
       (*row_count)++;
       row = m_result->fetch_one();
@@ -847,56 +1169,7 @@ std::string Resultset_dumper_base::format_json(const std::string &item_label,
 
   dumper.end_array();
 
-  dumper.append_string("executionTime");
-  dumper.append_string(
-      mysqlshdk::utils::format_seconds(m_result->get_execution_time()));
-  if (!is_doc_result) {
-    dumper.append_string("affectedRowCount");
-    dumper.append_uint64(m_result->get_affected_row_count());
-  }
-  dumper.append_string("affectedItemsCount");
-  dumper.append_uint64(m_result->get_affected_row_count());
-  dumper.append_string("warningCount");
-  dumper.append_int64(m_result->get_warning_count());
-  dumper.append_string("warningsCount");
-  dumper.append_uint64(m_result->get_warning_count());
-  dumper.append_string("warnings");
-  dumper.start_array();
-  auto warning = m_result->fetch_one_warning();
-  while (warning) {
-    std::string level;
-    switch (warning->level) {
-      case mysqlshdk::db::Warning::Level::Note:
-        level = "Note";
-        break;
-      case mysqlshdk::db::Warning::Level::Warn:
-        level = "Warning";
-        break;
-      case mysqlshdk::db::Warning::Level::Error:
-        level = "Error";
-        break;
-    }
-    dumper.start_object();
-    dumper.append_string("Level", level);
-    dumper.append_string("Code");
-    dumper.append_int(warning->code);
-    dumper.append_string("Message", warning->msg);
-    dumper.end_object();
-    warning = m_result->fetch_one_warning();
-  }
-  dumper.end_array();
-
-  dumper.append_string("info");
-  dumper.append_string(m_result->get_info());
-
-  dumper.append_string("autoIncrementValue");
-  dumper.append_int64(m_result->get_auto_increment_value());
-
-  if (const auto statement_id = m_result->get_statement_id();
-      !statement_id.empty()) {
-    dumper.append_string("statementId");
-    dumper.append_string(statement_id);
-  }
+  append_json_summary(&dumper, is_doc_result);
 
   dumper.end_object();
 
@@ -907,6 +1180,10 @@ size_t Resultset_dumper_base::dump_json(const std::string &item_label,
                                         bool is_doc_result) {
   int row_count = 0;
 
+  if ("json/stream" == m_wrap_json) {
+    return stream_json(item_label, is_doc_result);
+  }
+
   m_printer->raw_print(format_json(item_label, is_doc_result,
                                    m_wrap_json == "json", &row_count));
   m_printer->raw_print("\n");
@@ -914,6 +1191,77 @@ size_t Resultset_dumper_base::dump_json(const std::string &item_label,
   return row_count;
 }
 
+/**
+ * Streaming version of the JSON wrapping: each row is written as soon as it is
+ * fetched, in a separate line:
+ *
+ *   {"<item_label>": <row>}
+ *
+ * followed by a line with the summary of the result, which holds the same
+ * information as the non-streaming version, except that rows are replaced
+ * with their count. Memory usage does not depend on the number of rows.
+ */
+size_t Resultset_dumper_base::stream_json(const std::string &item_label,
+                                          bool is_doc_result) {
+  const auto binary_limit =
+      mysqlsh::current_shell_options()->get().binary_limit;
+  // the same dumper is used for all rows, so that its buffer is reused
+  shcore::JSON_dumper dumper(false, binary_limit);
+  size_t row_count = 0;
+
+  if (m_result->has_resultset()) {
+    if (show_column_type_info()) dump_metadata();
+
+    const auto &metadata = m_result->get_metadata();
+    auto row = m_result->fetch_one();
+
+    while (row && !m_cancelled) {
+      dumper.reset();
+      dumper.start_object();
+      dumper.append_string(item_label);
+
+      if (is_doc_result) {
+        dump_json_document(&dumper, row);
+      } else {
+        dump_json_row(&dumper, metadata, row, binary_limit);
+      }
+
+      dumper.end_object();
+
+      // rows are written right away, write blocks if consumer is not keeping
+      // up, so that rows are not accumulated in memory
+      m_printer->raw_print(dumper.str() + "\n");
+      ++row_count;
+
+      row = m_result->fetch_one();
+    }
+  }
+
+  dumper.reset();
+  dumper.start_object();
+  dumper.append_string("hasData");
+  dumper.append_bool(m_result->has_resultset());
+  dumper.append_string(item_label + "Count");
+  dumper.append_uint64(row_count);
+  append_json_summary(&dumper, is_doc_result);
+  dumper.end_object();
+
+  m_printer->raw_print(dumper.str() + "\n");
+
+  return row_count;
+}
+
+Table_overflow Resultset_dumper_base::to_table_overflow(
+    const std::string &value) {
+  if ("expand" == value || value.empty()) return Table_overflow::EXPAND;
+  if ("truncate" == value) return Table_overflow::TRUNCATE;
+  if ("wrap" == value) return Table_overflow::WRAP;
+
+  throw std::invalid_argument(
+      "The acceptable values for the option " SHCORE_TABLE_OVERFLOW
+      " are: expand, truncate, wrap");
+}
+
 size_t Resultset_dumper_base::dump_table() {
   const auto &metadata = m_result->get_metadata();
   std::vector<Field_formatter> fmt;
@@ -927,19 +1275,29 @@ size_t Resultset_dumper_base::dump_table() {
   for (size_t field_index = 0; field_index < field_count; field_index++) {
     auto column = metadata[field_index];
     fmt.emplace_back(ResultFormat::TABLE, column);
+
+    if (0 == m_table_sample_rows) {
+      fmt.back().process_metadata(column);
+    }
   }
 
-  pre_fetched_rows.reserve(k_pre_fetch_result_rows);
+  // at least one row is fetched, to check if there's anything to print
+  const auto sample_rows = std::max<size_t>(m_table_sample_rows, 1);
+
+  pre_fetched_rows.reserve(std::min<size_t>(sample_rows, 1000));
   {
     auto row = m_result->fetch_one();
     while (row && !m_cancelled) {
       pre_fetched_rows.emplace_back(*row);
 
-      for (size_t field_index = 0; field_index < field_count; field_index++) {
-        fmt[field_index].process(row, field_index);
+      if (m_table_sample_rows) {
+        for (size_t field_index = 0; field_index < field_count;
+             field_index++) {
+          fmt[field_index].process(row, field_index);
+        }
       }
 
-      if (pre_fetched_rows.size() >= k_pre_fetch_result_rows) break;
+      if (pre_fetched_rows.size() >= sample_rows) break;
 
       row = m_result->fetch_one();
     }
@@ -949,10 +1307,19 @@ size_t Resultset_dumper_base::dump_table() {
   //-----------
 
   size_t index = 0;
+  std::vector<size_t> widths(field_count);
+
+  for (index = 0; index < field_count; index++) {
+    widths[index] = fmt[index].get_max_display_length();
+
+    if (Table_overflow::EXPAND != m_table_overflow) {
+      widths[index] = std::min<size_t>(widths[index], MAX_DISPLAY_LENGTH);
+    }
+  }
 
   std::string separator("+");
   for (index = 0; index < field_count; index++) {
-    std::string field_separator(fmt[index].get_max_display_length() + 2, '-');
+    std::string field_separator(widths[index] + 2, '-');
     field_separator.append("+");
     separator.append(field_separator);
   }
@@ -963,7 +1330,7 @@ size_t Resultset_dumper_base::dump_table() {
   m_printer->print("| ");
   for (index = 0; index < field_count; index++) {
     std::string format = "%-";
-    format.append(std::to_string(fmt[index].get_max_display_length()));
+    format.append(std::to_string(widths[index]));
     format.append((index == field_count - 1) ? "s |\n" : "s | ");
     auto column = metadata[index];
     m_printer->print(
@@ -971,49 +1338,92 @@ size_t Resultset_dumper_base::dump_table() {
   }
   m_printer->print(separator);
 
-  // Print pre-fetched records
-  for (const auto &row : pre_fetched_rows) {
-    ++num_records;
+  const auto print_expanded = [&](const mysqlshdk::db::IRow *row) {
     m_printer->print("| ");
 
     for (size_t field_index = 0; field_index < field_count; field_index++) {
-      if (fmt[field_index].put(&row, field_index)) {
+      if (fmt[field_index].put(row, field_index)) {
         m_printer->print(fmt[field_index].str());
       } else {
         assert(mysqlshdk::db::is_string_type(metadata[field_index].get_type()));
-        if (row.get_type(field_index) == mysqlshdk::db::Type::Bytes) {
-          const char *data;
-          size_t length;
-          std::tie(data, length) = row.get_string_data(field_index);
-          m_printer->print(shcore::string_to_hex({data, length}));
-        } else {
-          m_printer->print(row.get_as_string(field_index));
-        }
+        m_printer->print(fmt[field_index].text(row, field_index));
       }
       if (field_index < field_count - 1) m_printer->print(" | ");
     }
     m_printer->print(" |\n");
+  };
+
+  std::vector<std::vector<std::pair<std::string, size_t>>> cells(field_count);
+
+  const auto print_fitted = [&](const mysqlshdk::db::IRow *row) {
+    size_t lines = 0;
+
+    for (size_t field_index = 0; field_index < field_count; field_index++) {
+      cells[field_index] =
+          fit_text(fmt[field_index].text(row, field_index), widths[field_index],
+                   Table_overflow::WRAP == m_table_overflow);
+      lines = std::max(lines, cells[field_index].size());
+    }
+
+    std::string output;
+
+    for (size_t line = 0; line < lines; ++line) {
+      output += "| ";
+
+      for (size_t field_index = 0; field_index < field_count; field_index++) {
+        const auto &cell = cells[field_index];
+        std::string_view text;
+        size_t width = 0;
+
+        if (line < cell.size()) {
+          text = cell[line].first;
+          width = cell[line].second;
+        }
+
+        const auto padding = widths[field_index] > width
+                                 ? widths[field_index] - width
+                                 : size_t{0};
+
+        if (fmt[field_index].align_right()) {
+          output.append(padding, ' ');
+          output += text;
+        } else {
+          output += text;
+          output.append(padding, ' ');
+        }
+
+        output += field_index < field_count - 1 ? " | " : " |\n";
+      }
+    }
+
+    m_printer->print(output);
+  };
+
+  const auto print_row = [&](const mysqlshdk::db::IRow *row) {
+    ++num_records;
+
+    if (Table_overflow::EXPAND == m_table_overflow) {
+      print_expanded(row);
+    } else {
+      print_fitted(row);
+    }
+  };
+
+  // Print pre-fetched records
+  for (const auto &row : pre_fetched_rows) {
+    print_row(&row);
 
     if (m_cancelled) break;
   }
+
+  // rows are not needed anymore
+  std::vector<mysqlshdk::db::Row_copy>().swap(pre_fetched_rows);
+
   // Now prints the remaining records
   if (!m_cancelled) {
     auto row = m_result->fetch_one();
     while (row && !m_cancelled) {
-      ++num_records;
-      m_printer->print("| ");
-
-      for (size_t field_index = 0; field_index < field_count; field_index++) {
-        if (fmt[field_index].put(row, field_index)) {
-          m_printer->print(fmt[field_index].str());
-        } else {
-          assert(
-              mysqlshdk::db::is_string_type(metadata[field_index].get_type()));
-          m_printer->print(row->get_as_string(field_index));
-        }
-        if (field_index < field_count - 1) m_printer->print(" | ");
-      }
-      m_printer->print(" |\n");
+      print_row(row);
       row = m_result->fetch_one();
     }
   }
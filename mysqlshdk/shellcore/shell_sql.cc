@@ -23,8 +23,14 @@
 
 #include "shellcore/shell_sql.h"
 #include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/utils_help.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
@@ -35,6 +41,7 @@
 #include "mysqlshdk/libs/utils/profiling.h"
 #include "shellcore/base_session.h"
 #include "shellcore/interrupt_handler.h"
+#include "shellcore/scoped_contexts.h"
 #include "shellcore/shell_options.h"
 #include "utils/utils_general.h"
 #include "utils/utils_lexing.h"
@@ -92,11 +99,134 @@ bool dollar_quoted_strings(
   return session->dollar_quoted_strings();
 }
 
+bool is_batchable(std::string_view stmt) {
+  mysqlshdk::utils::SQL_iterator it(stmt);
+  return shcore::str_caseeq(it.next_token(), "INSERT", "REPLACE", "UPDATE",
+                            "DELETE");
+}
+
+/**
+ * Reads the source stream in a background thread, a couple of chunks ahead of
+ * the reader, so that the file is read while statements are being executed.
+ */
+class Read_ahead_buffer final : public std::streambuf {
+ public:
+  Read_ahead_buffer(std::istream *source, std::size_t chunk_size)
+      : m_source(source), m_chunk_size(chunk_size) {
+    m_reader = mysqlsh::spawn_scoped_thread([this]() { read_chunks(); });
+  }
+
+  Read_ahead_buffer(const Read_ahead_buffer &) = delete;
+  Read_ahead_buffer(Read_ahead_buffer &&) = delete;
+
+  Read_ahead_buffer &operator=(const Read_ahead_buffer &) = delete;
+  Read_ahead_buffer &operator=(Read_ahead_buffer &&) = delete;
+
+  ~Read_ahead_buffer() override {
+    {
+      std::lock_guard lock{m_mutex};
+      m_stopped = true;
+    }
+
+    m_cv.notify_all();
+    m_reader.join();
+  }
+
+ protected:
+  int_type underflow() override {
+    {
+      std::unique_lock lock{m_mutex};
+
+      m_cv.wait(lock, [this]() { return !m_chunks.empty() || m_eof; });
+
+      if (m_chunks.empty()) {
+        return traits_type::eof();
+      }
+
+      m_current = std::move(m_chunks.front());
+      m_chunks.pop_front();
+    }
+
+    m_cv.notify_all();
+
+    setg(m_current.data(), m_current.data(),
+         m_current.data() + m_current.size());
+
+    return traits_type::to_int_type(*gptr());
+  }
+
+ private:
+  static constexpr std::size_t k_max_chunks = 4;
+
+  void read_chunks() {
+    while (true) {
+      {
+        std::unique_lock lock{m_mutex};
+
+        m_cv.wait(lock, [this]() {
+          return m_chunks.size() < k_max_chunks || m_stopped;
+        });
+
+        if (m_stopped) break;
+      }
+
+      std::string chunk;
+      chunk.resize(m_chunk_size);
+
+      m_source->read(chunk.data(), chunk.size());
+      chunk.resize(m_source->gcount());
+
+      const auto eof = chunk.empty();
+
+      {
+        std::lock_guard lock{m_mutex};
+
+        if (eof) {
+          m_eof = true;
+        } else {
+          m_chunks.emplace_back(std::move(chunk));
+        }
+      }
+
+      m_cv.notify_all();
+
+      if (eof) break;
+    }
+  }
+
+  std::istream *m_source;
+  const std::size_t m_chunk_size;
+  std::string m_current;
+  std::deque<std::string> m_chunks;
+  bool m_eof = false;
+  bool m_stopped = false;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::thread m_reader;
+};
+
 }  // namespace
 
 // How many bytes at a time to process when executing large SQL scripts
 static constexpr auto k_sql_chunk_size = 64 * 1024;
 
+// How often progress of batched statements is reported
+static constexpr auto k_batch_progress_interval = std::chrono::seconds(10);
+
+void Shell_sql::Sql_batch::add(std::string_view stmt, size_t line_num) {
+  offsets.emplace_back(sql.size());
+  lines.emplace_back(line_num);
+  sql.append(stmt);
+  // statement may end with a comment
+  sql.append("\n;\n");
+}
+
+void Shell_sql::Sql_batch::clear() {
+  sql.clear();
+  offsets.clear();
+  lines.clear();
+}
+
 Shell_sql::Context::Context(Shell_sql *parent_)
     : parent(parent_),
       splitter(
@@ -264,6 +394,66 @@ bool Shell_sql::process_sql(std::string_view query, std::string_view delimiter,
   return ret_val;
 }
 
+bool Shell_sql::process_batch(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    const Sql_batch &batch) {
+  const auto force = mysqlsh::current_shell_options()->get().force;
+  const auto conn_id = session->get_connection_id();
+  const auto &conn_opts = session->get_connection_options();
+  shcore::Interrupt_handler interrupt([this, conn_id, conn_opts]() {
+    kill_query(conn_id, conn_opts);
+    return true;
+  });
+  bool ret_val = true;
+  std::size_t first = 0;
+
+  while (first < batch.size()) {
+    std::size_t executed = 0;
+    std::optional<mysqlshdk::db::Error> error;
+
+    try {
+      session->set_multi_statements(true);
+
+      try {
+        const auto offset = batch.offsets[first];
+        const auto result = session->querys(batch.sql.data() + offset,
+                                            batch.sql.size() - offset);
+        ++executed;
+
+        while (result->next_resultset()) {
+          ++executed;
+        }
+      } catch (const mysqlshdk::db::Error &e) {
+        error = e;
+      }
+
+      session->set_multi_statements(false);
+    } catch (const mysqlshdk::db::Error &e) {
+      // enabling/disabling multi-statements has failed, connection is lost
+      print_exception(shcore::Exception::mysql_error_with_code_and_state(
+          e.what(), e.code(), e.sqlstate()));
+      return false;
+    }
+
+    if (!error) break;
+
+    // statements which follow the failed one were not executed
+    auto exc = shcore::Exception::mysql_error_with_code_and_state(
+        error->what(), error->code(), error->sqlstate());
+    exc.set_file_context("", batch.lines[first + executed]);
+    print_exception(exc);
+    ret_val = false;
+
+    if (!force || mysqlshdk::db::is_server_connection_error(error->code())) {
+      break;
+    }
+
+    first += executed + 1;
+  }
+
+  return ret_val;
+}
+
 bool Shell_sql::handle_input_stream(std::istream *istream) {
   std::shared_ptr<mysqlshdk::db::ISession> session;
   {
@@ -274,30 +464,98 @@ bool Shell_sql::handle_input_stream(std::istream *istream) {
       session = s->get_core_session();
   }
 
+  const auto &options = mysqlsh::current_shell_options()->get();
+  const auto force = options.force;
+  const auto batch_size = static_cast<size_t>(options.source_batch_size);
+  std::shared_ptr<mysqlshdk::db::mysql::Session> classic;
+
+  if (batch_size > 0) {
+    classic = std::dynamic_pointer_cast<mysqlshdk::db::mysql::Session>(session);
+  }
+
+  // in the bulk mode the script is read in the background, stdin is not read
+  // ahead, as it may be needed to answer prompts
+  std::unique_ptr<Read_ahead_buffer> read_ahead;
+  std::unique_ptr<std::istream> read_ahead_stream;
+
+  if (classic && &std::cin != istream) {
+    read_ahead = std::make_unique<Read_ahead_buffer>(istream, k_sql_chunk_size);
+    read_ahead_stream = std::make_unique<std::istream>(read_ahead.get());
+    istream = read_ahead_stream.get();
+  }
+
+  Sql_batch batch;
+  size_t batched = 0;
+  auto last_progress = std::chrono::steady_clock::now();
+
+  const auto report_progress = [&](bool done) {
+    if (!options.interactive || 0 == batched) return;
+
+    const auto now = std::chrono::steady_clock::now();
+
+    if (done || now - last_progress >= k_batch_progress_interval) {
+      last_progress = now;
+      mysqlsh::current_console()->print_info(shcore::str_format(
+          "-- %zu statements executed in batches", batched));
+    }
+  };
+
+  const auto flush_batch = [&]() {
+    if (batch.empty()) return true;
+
+    const auto ret = process_batch(classic, batch);
+    batched += batch.size();
+    batch.clear();
+    report_progress(false);
+
+    return ret;
+  };
+
   mysqlshdk::utils::Sql_splitter *splitter = nullptr;
-  if (!mysqlshdk::utils::iterate_sql_stream(
-          istream, k_sql_chunk_size,
-          [&](std::string_view s, std::string_view delim, size_t lnum, size_t) {
-            std::string_view file;
-
-            if (shcore::str_beginswith(s, "source"))
-              file = s.substr(6);
-            else if (shcore::str_beginswith(s, "\\."))
-              file = s.substr(2);
-
-            bool ret = false;
-            if (!file.empty())
-              ret =
-                  _owner->handle_shell_command("\\source " + std::string{file});
-            else if (!s.empty())
-              ret = process_sql(s, delim, lnum, session, splitter);
-            return ret ? ret : mysqlsh::current_shell_options()->get().force;
-          },
-          [](std::string_view err) {
-            mysqlsh::current_console()->print_error(std::string{err});
-          },
-          ansi_quotes_enabled(session), no_backslash_escapes_enabled(session),
-          dollar_quoted_strings(session), nullptr, &splitter)) {
+  bool ret_val = mysqlshdk::utils::iterate_sql_stream(
+      istream, k_sql_chunk_size,
+      [&](std::string_view s, std::string_view delim, size_t lnum, size_t) {
+        // statements are not kept, as scripts can be very large
+        _last_handled.clear();
+
+        if (classic && !delim.empty() && "\\G" != delim && is_batchable(s)) {
+          if (batch.sql.size() + s.size() > batch_size && !flush_batch() &&
+              !force) {
+            return false;
+          }
+
+          batch.add(s, lnum);
+          return true;
+        }
+
+        if (!flush_batch() && !force) return false;
+
+        std::string_view file;
+
+        if (shcore::str_beginswith(s, "source"))
+          file = s.substr(6);
+        else if (shcore::str_beginswith(s, "\\."))
+          file = s.substr(2);
+
+        bool ret = false;
+        if (!file.empty())
+          ret = _owner->handle_shell_command("\\source " + std::string{file});
+        else if (!s.empty())
+          ret = process_sql(s, delim, lnum, session, splitter);
+        return ret ? ret : force;
+      },
+      [](std::string_view err) {
+        mysqlsh::current_console()->print_error(std::string{err});
+      },
+      ansi_quotes_enabled(session), no_backslash_escapes_enabled(session),
+      dollar_quoted_strings(session), nullptr, &splitter);
+
+  // execute the remaining batched statements
+  if (!flush_batch() && !force) ret_val = false;
+
+  report_progress(true);
+
+  if (!ret_val) {
     // signal error during input processing
     _result_processor(nullptr, {});
     return false;
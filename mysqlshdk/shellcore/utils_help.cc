@@ -423,6 +423,20 @@ Help_registry *Help_registry::get() {
 void Help_registry::add_split_help(const std::string &prefix,
                                    const std::string &data, bool auto_brief,
                                    bool nosuffix, bool is_shell_command) {
+  auto lock = ensure_lock();
+
+  if (m_threaded) {
+    split_help(prefix, data, auto_brief, nosuffix, is_shell_command);
+  } else {
+    // parsing is postponed until the help is requested for the first time
+    m_pending_help.push_back(
+        {prefix, data, true, auto_brief, nosuffix, is_shell_command});
+  }
+}
+
+void Help_registry::split_help(const std::string &prefix,
+                               const std::string &data, bool auto_brief,
+                               bool nosuffix, bool is_shell_command) const {
   std::map<std::string, int> current_index;
 
   auto token = [&prefix, &current_index](const std::string &suffix) {
@@ -503,20 +517,21 @@ void Help_registry::add_split_help(const std::string &prefix,
 
   bool eos = false;
   std::string para;
-  if (auto_brief) add_help(token("BRIEF"), get_para(&eos));
+  if (auto_brief) set_help_data(token("BRIEF"), get_para(&eos));
 
   // params, return and deprecation warning
   para = get_para(&eos);
   while (!eos && !para.empty()) {
     if (shcore::str_beginswith(para, "@param")) {
-      add_help(token("PARAM"), para);
+      set_help_data(token("PARAM"), para);
     } else if (is_shell_command && shcore::str_beginswith(para, "@syntax")) {
-      add_help(token("SYNTAX"), para.substr(para.find_first_of(" \t") + 1));
+      set_help_data(token("SYNTAX"),
+                    para.substr(para.find_first_of(" \t") + 1));
     } else if (shcore::str_beginswith(para, "@return")) {
-      add_help(token("RETURNS"), para);
+      set_help_data(token("RETURNS"), para);
     } else if (shcore::str_beginswith(para, "@attention") &&
                para.find("will be removed") != std::string::npos) {
-      add_help(token("DEPRECATED"), para);
+      set_help_data(token("DEPRECATED"), para);
       break;
     } else {
       break;
@@ -531,9 +546,9 @@ void Help_registry::add_split_help(const std::string &prefix,
       break;
     }
     if (nosuffix)
-      add_help(token(""), para);
+      set_help_data(token(""), para);
     else
-      add_help(token("DETAIL"), para);
+      set_help_data(token("DETAIL"), para);
     para = get_para(&eos);
   }
 
@@ -544,9 +559,10 @@ void Help_registry::add_split_help(const std::string &prefix,
       break;
     }
     if (shcore::str_beginswith(para, "@throw"))
-      add_help(token("THROWS"), para.substr(para.find_first_of(" \t") + 1));
+      set_help_data(token("THROWS"),
+                    para.substr(para.find_first_of(" \t") + 1));
     else
-      add_help(token("THROWS"), para);
+      set_help_data(token("THROWS"), para);
     para = get_para(&eos);
   }
 
@@ -559,10 +575,11 @@ void Help_registry::add_split_help(const std::string &prefix,
         if (example_index > 0) eindex_str = std::to_string(example_index);
 
         example_index++;
-        add_help(token(shcore::str_format("EXAMPLE%s", eindex_str.c_str())),
-                 para.substr(para.find_first_of(" \t") + 1));
+        set_help_data(
+            token(shcore::str_format("EXAMPLE%s", eindex_str.c_str())),
+            para.substr(para.find_first_of(" \t") + 1));
       } else
-        add_help(
+        set_help_data(
             token(shcore::str_format("EXAMPLE%s_DESC", eindex_str.c_str())),
             para);
 
@@ -577,10 +594,44 @@ void Help_registry::add_help(const std::string &token, const std::string &data,
   if (loc == Keyword_location::LOCAL_CTX) {
     get_thread_context_help()->m_help_data[token] = data;
   } else if (loc == Keyword_location::GLOBAL_CTX) {
-    m_help_data[token] = data;
+    add_global_help(token, data);
   } else {
     get_thread_context_help()->m_help_data[token] = data;
+    add_global_help(token, data);
+  }
+}
+
+void Help_registry::add_global_help(const std::string &token,
+                                    const std::string &data) {
+  if (m_pending_help.empty()) {
     m_help_data[token] = data;
+  } else {
+    // keep the registration order, so that entries registered later override
+    // the ones which are still pending
+    m_pending_help.push_back({token, data, false, false, false, false});
+  }
+}
+
+void Help_registry::set_help_data(const std::string &token,
+                                  const std::string &data) const {
+  m_help_data[token] = data;
+}
+
+void Help_registry::load_pending_help() const {
+  std::lock_guard lock{m_mutex};
+
+  if (m_pending_help.empty()) return;
+
+  const auto pending = std::move(m_pending_help);
+  m_pending_help.clear();
+
+  for (const auto &entry : pending) {
+    if (entry.split) {
+      split_help(entry.token, entry.data, entry.auto_brief, entry.nosuffix,
+                 entry.is_shell_command);
+    } else {
+      set_help_data(entry.token, entry.data);
+    }
   }
 }
 
@@ -1026,6 +1077,8 @@ void Help_registry::register_keyword(const std::string &keyword,
 std::string Help_registry::get_token(const std::string &token) const {
   std::string ret_val;
 
+  load_pending_help();
+
   try {
     ret_val = m_help_data.at(token);
   } catch (const std::out_of_range &) {
@@ -35,6 +35,7 @@
 #define isatty _isatty
 #else
 #include <fcntl.h>
+#include <poll.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
 #endif
@@ -157,8 +158,15 @@ bool write_to_console(int fd, const char *text) {
     const int written = write(fd, p, flush_bytes);
     if (written == -1) {
       const int error_no = errno;
-      if ((error_no == EINTR) || (error_no == EWOULDBLOCK) ||
-          (error_no == EAGAIN)) {
+      if (error_no == EINTR) {
+        continue;
+      } else if ((error_no == EWOULDBLOCK) || (error_no == EAGAIN)) {
+#ifndef _WIN32
+        // descriptor is non-blocking and the reader is not keeping up, wait
+        // until it can accept more data instead of spinning
+        pollfd pfd{fd, POLLOUT, 0};
+        poll(&pfd, 1, -1);
+#endif
         continue;
       } else {
         break;
@@ -679,12 +687,12 @@ bool Command_line_shell::cmd_history(const std::vector<std::string> &args) {
     }
   } else if (args[1] == "save") {
     std::string path = history_file();
-    if (linenoiseHistorySave(path.c_str()) < 0) {
+    if (!_history.save_all(path)) {
       print_diag(shcore::str_format("Could not save command history to %s: %s",
                                     path.c_str(), strerror(errno)));
     } else {
-      println(shcore::str_format("Command history file saved with %i entries.",
-                                 linenoiseHistorySize()));
+      println(shcore::str_format("Command history file saved with %u entries.",
+                                 _history.size()));
     }
   } else if (args[1] == "delete" || args[1] == "del") {
     if (args.size() != 3) {
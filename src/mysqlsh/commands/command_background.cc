@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "src/mysqlsh/commands/command_background.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "modules/mod_utils.h"
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+
+namespace {
+
+constexpr std::size_t k_max_statement_length = 70;
+
+std::string plural(uint64_t count, const char *noun) {
+  return std::to_string(count) + " " + noun + (1 == count ? "" : "s");
+}
+
+double seconds(std::chrono::steady_clock::duration d) {
+  return std::chrono::duration_cast<std::chrono::duration<double>>(d).count();
+}
+
+}  // namespace
+
+Background_statements::~Background_statements() {
+  // statements which are still running are allowed to finish
+  for (const auto &job : m_jobs) {
+    if (job->thread.joinable()) {
+      job->thread.join();
+    }
+  }
+}
+
+bool Background_statements::start(
+    const std::shared_ptr<ShellBaseSession> &session,
+    const std::vector<std::string> &args) {
+  const auto console = current_console();
+
+  // arguments are not parsed, args[0] holds the full command
+  auto statement = shcore::str_strip(args[0]);
+  const auto pos = statement.find_first_of(" \t\r\n");
+  statement = pos == std::string::npos
+                  ? std::string{}
+                  : shcore::str_rstrip(shcore::str_strip(statement.substr(pos)),
+                                       "; \t\r\n");
+
+  if (statement.empty()) {
+    console->print_error("Usage: \\bg <statement>");
+    return true;
+  }
+
+  if (!session || !session->is_open()) {
+    console->print_error("Not connected.");
+    return true;
+  }
+
+  auto options = session->get_connection_options();
+
+  if (const auto schema = session->get_current_schema(); !schema.empty()) {
+    options.clear_schema();
+    options.set_schema(schema);
+  }
+
+  std::shared_ptr<mysqlshdk::db::ISession> bg_session;
+
+  try {
+    // connection errors are reported right away
+    bg_session = establish_session(options, false);
+  } catch (const shcore::Error &e) {
+    console->print_error(e.format());
+    return true;
+  } catch (const std::exception &e) {
+    console->print_error(e.what());
+    return true;
+  }
+
+  Job *job = nullptr;
+
+  {
+    std::lock_guard lock{m_mutex};
+
+    job = m_jobs.emplace_back(std::make_unique<Job>()).get();
+    job->id = m_next_id++;
+    job->statement = std::move(statement);
+    job->connection_id = bg_session->get_connection_id();
+    job->started = std::chrono::steady_clock::now();
+    job->thread = spawn_scoped_thread([this, job, bg_session]() {
+      execute(job, bg_session);
+    });
+  }
+
+  console->print_info("[" + std::to_string(job->id) +
+                      "] Started, connection id " +
+                      std::to_string(job->connection_id) + ".");
+
+  return true;
+}
+
+bool Background_statements::list(const std::vector<std::string> &args) {
+  if (args.size() > 1) {
+    current_console()->print_error("Usage: \\jobs");
+    return true;
+  }
+
+  std::lock_guard lock{m_mutex};
+
+  if (m_jobs.empty()) {
+    current_console()->print_info("There are no background statements.");
+    return true;
+  }
+
+  for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+    if ((*it)->done) {
+      report(it);
+      it = m_jobs.erase(it);
+    } else {
+      current_console()->print_info(describe(**it));
+      ++it;
+    }
+  }
+
+  return true;
+}
+
+bool Background_statements::wait(const std::vector<std::string> &args) {
+  const auto console = current_console();
+  uint32_t id = 0;
+
+  if (args.size() > 2) {
+    console->print_error("Usage: \\wait [id]");
+    return true;
+  }
+
+  if (2 == args.size()) {
+    try {
+      id = shcore::lexical_cast<uint32_t>(shcore::str_strip(args[1], "[]"));
+    } catch (const std::exception &) {
+      console->print_error("Invalid background statement id: " + args[1]);
+      return true;
+    }
+  }
+
+  {
+    std::unique_lock lock{m_mutex};
+
+    const auto finished = [this, id]() {
+      return std::all_of(m_jobs.begin(), m_jobs.end(), [id](const auto &job) {
+        return job->done || (0 != id && job->id != id);
+      });
+    };
+
+    if (0 != id && std::none_of(m_jobs.begin(), m_jobs.end(),
+                                [id](const auto &job) {
+                                  return job->id == id;
+                                })) {
+      console->print_error("Background statement [" + std::to_string(id) +
+                           "] does not exist.");
+      return true;
+    }
+
+    volatile bool interrupted = false;
+    shcore::Interrupt_handler inth([&interrupted]() {
+      interrupted = true;
+      return true;
+    });
+
+    while (!interrupted &&
+           !m_finished.wait_for(lock, std::chrono::milliseconds(100),
+                                finished)) {
+    }
+
+    if (interrupted) {
+      console->print_info(
+          "Interrupted, background statements continue to execute.");
+    }
+  }
+
+  report_finished();
+
+  return true;
+}
+
+void Background_statements::report_finished() {
+  std::lock_guard lock{m_mutex};
+
+  for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+    if ((*it)->done) {
+      report(it);
+      it = m_jobs.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void Background_statements::execute(
+    Job *job, const std::shared_ptr<mysqlshdk::db::ISession> &session) {
+  Mysql_thread mysql_thread;
+
+  uint64_t affected_rows = 0;
+  uint64_t fetched_rows = 0;
+  uint64_t warnings = 0;
+  std::string error;
+
+  try {
+    const auto result = session->query(job->statement);
+
+    do {
+      while (result->fetch_one()) {
+      }
+
+      if (result->has_resultset()) {
+        fetched_rows += result->get_fetched_row_count();
+      } else {
+        affected_rows += result->get_affected_row_count();
+      }
+
+      warnings += result->get_warning_count();
+    } while (result->next_resultset());
+  } catch (const shcore::Error &e) {
+    error = e.format();
+  } catch (const std::exception &e) {
+    error = e.what();
+  }
+
+  try {
+    session->close();
+  } catch (...) {
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
+
+    job->finished = std::chrono::steady_clock::now();
+    job->affected_rows = affected_rows;
+    job->fetched_rows = fetched_rows;
+    job->warnings = warnings;
+    job->error = std::move(error);
+    job->done = true;
+  }
+
+  m_finished.notify_all();
+}
+
+std::string Background_statements::describe(const Job &job) const {
+  auto statement = shcore::str_replace(job.statement, "\n", " ");
+
+  if (statement.length() > k_max_statement_length) {
+    statement = statement.substr(0, k_max_statement_length - 3) + "...";
+  }
+
+  std::string status;
+
+  if (!job.done) {
+    status = "Running, connection id " + std::to_string(job.connection_id) +
+             " (" +
+             mysqlshdk::utils::format_seconds(
+                 seconds(std::chrono::steady_clock::now() - job.started)) +
+             ")";
+  } else {
+    if (!job.error.empty()) {
+      status = "ERROR: " + job.error;
+    } else if (job.fetched_rows > 0) {
+      status = plural(job.fetched_rows, "row") + " in set, " +
+               plural(job.warnings, "warning");
+    } else {
+      status = "Query OK, " + plural(job.affected_rows, "row") +
+               " affected, " + plural(job.warnings, "warning");
+    }
+
+    status += " (" +
+              mysqlshdk::utils::format_seconds(seconds(job.finished -
+                                                       job.started)) +
+              ")";
+  }
+
+  return "[" + std::to_string(job.id) + "] " + statement + "\n    " + status;
+}
+
+void Background_statements::report(
+    std::vector<std::unique_ptr<Job>>::iterator job) {
+  // thread has already finished, this does not block
+  if ((*job)->thread.joinable()) {
+    (*job)->thread.join();
+  }
+
+  current_console()->print_info(describe(**job));
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef SRC_MYSQLSH_COMMANDS_COMMAND_BACKGROUND_H_
+#define SRC_MYSQLSH_COMMANDS_COMMAND_BACKGROUND_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/base_session.h"
+
+namespace mysqlsh {
+
+/**
+ * Keeps track of the SQL statements executed in the background by the \bg
+ * command. Each statement is executed in a separate thread, using a new
+ * session created with the connection options of the global session.
+ */
+class Background_statements final {
+ public:
+  Background_statements() = default;
+
+  Background_statements(const Background_statements &) = delete;
+  Background_statements(Background_statements &&) = delete;
+
+  Background_statements &operator=(const Background_statements &) = delete;
+  Background_statements &operator=(Background_statements &&) = delete;
+
+  ~Background_statements();
+
+  /**
+   * Handles the \bg command: starts execution of the given statement.
+   */
+  bool start(const std::shared_ptr<ShellBaseSession> &session,
+             const std::vector<std::string> &args);
+
+  /**
+   * Handles the \jobs command: lists the background statements.
+   */
+  bool list(const std::vector<std::string> &args);
+
+  /**
+   * Handles the \wait command: waits for the given (or all) background
+   * statements to finish.
+   */
+  bool wait(const std::vector<std::string> &args);
+
+  /**
+   * Prints a notification for each statement which has finished since the
+   * last call, and stops tracking these statements.
+   */
+  void report_finished();
+
+ private:
+  struct Job {
+    uint32_t id = 0;
+    std::string statement;
+    uint64_t connection_id = 0;
+    std::chrono::steady_clock::time_point started;
+    std::chrono::steady_clock::time_point finished;
+    bool done = false;
+    uint64_t affected_rows = 0;
+    uint64_t fetched_rows = 0;
+    uint64_t warnings = 0;
+    std::string error;
+    std::thread thread;
+  };
+
+  void execute(Job *job,
+               const std::shared_ptr<mysqlshdk::db::ISession> &session);
+
+  std::string describe(const Job &job) const;
+
+  void report(std::vector<std::unique_ptr<Job>>::iterator job);
+
+  std::mutex m_mutex;
+  std::condition_variable m_finished;
+  std::vector<std::unique_ptr<Job>> m_jobs;
+  uint32_t m_next_id = 1;
+};
+
+}  // namespace mysqlsh
+
+#endif  // SRC_MYSQLSH_COMMANDS_COMMAND_BACKGROUND_H_
@@ -23,8 +23,11 @@
 
 #include "src/mysqlsh/commands/command_watch.h"
 
+#include <utility>
+
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/libs/textui/term_vt100.h"
 #include "mysqlshdk/libs/textui/textui.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -54,6 +57,7 @@ bool Command_watch::execute(const std::vector<std::string> &args) {
           "Terminal does not support ANSI escape sequences, screen will not "
           "be cleared.");
       m_clear_screen = false;
+      m_incremental = false;
     }
 
     if (m_clear_screen) {
@@ -61,14 +65,28 @@ bool Command_watch::execute(const std::vector<std::string> &args) {
       current_console()->add_print_handler(&m_handler);
     }
 
-    const auto remove_handler = shcore::on_leave_scope(
-        [this]() { current_console()->remove_print_handler(&m_handler); });
+    if (m_incremental) {
+      // lines are painted at fixed positions, they must not wrap
+      mysqlshdk::vt100::disable_line_wrap();
+    }
+
+    const auto remove_handler = shcore::on_leave_scope([this]() {
+      current_console()->remove_print_handler(&m_handler);
+
+      if (m_incremental) {
+        mysqlshdk::vt100::enable_line_wrap();
+      }
+    });
 
     while (!iterrupted) {
       m_first_line = true;
 
       Command_show::execute(new_args);
 
+      if (m_incremental) {
+        repaint();
+      }
+
       if (!iterrupted) {
         shcore::sleep_ms(interval);
       }
@@ -82,6 +100,7 @@ std::vector<std::string> Command_watch::parse_arguments(
     const std::vector<std::string> &args) {
   // options handled by \watch
   static constexpr auto k_no_refresh = "--nocls";
+  static constexpr auto k_incremental = "--incremental";
   static constexpr auto k_interval_long = "--interval";
   static constexpr auto k_interval_short = "-i";
 
@@ -100,6 +119,8 @@ std::vector<std::string> Command_watch::parse_arguments(
   while (current != end) {
     if (*current == k_no_refresh) {
       m_clear_screen = false;
+    } else if (*current == k_incremental) {
+      m_incremental = true;
     } else if (shcore::str_beginswith(*current, k_interval_long) ||
                shcore::str_beginswith(*current, k_interval_short)) {
       const char *value = nullptr;
@@ -158,12 +179,61 @@ std::vector<std::string> Command_watch::parse_arguments(
     ++current;
   }
 
+  if (m_incremental && !m_clear_screen) {
+    throw shcore::Exception::argument_error(
+        std::string{"The '"} + k_incremental + "' and '" + k_no_refresh +
+        "' options cannot be used together.");
+  }
+
   return new_args;
 }
 
-bool Command_watch::print_hook(void *user_data, const char *) {
+void Command_watch::repaint() {
+  auto lines = shcore::str_split(m_output, "\n");
+  m_output.clear();
+
+  // output ends with a new line, it does not add a line to the screen
+  if (!lines.empty() && lines.back().empty()) {
+    lines.pop_back();
+  }
+
+  int rows = 0;
+  int columns = 0;
+
+  if (mysqlshdk::vt100::get_screen_size(&rows, &columns) && rows > 1 &&
+      lines.size() >= static_cast<std::size_t>(rows)) {
+    // lines which do not fit would scroll the screen, leave the last row for
+    // the cursor
+    lines.resize(rows - 1);
+  }
+
+  for (std::size_t i = 0; i < lines.size(); ++i) {
+    if (i >= m_screen.size() || lines[i] != m_screen[i]) {
+      mysqlshdk::vt100::cursor_home(static_cast<int>(i) + 1, 1);
+      mysqlshdk::vt100::erase_line();
+      mysqlshdk::vt100::send_escape(lines[i].c_str());
+    }
+  }
+
+  mysqlshdk::vt100::cursor_home(static_cast<int>(lines.size()) + 1, 1);
+
+  if (lines.size() < m_screen.size()) {
+    // remove lines which are no longer a part of the output
+    mysqlshdk::vt100::erase_down();
+  }
+
+  m_screen = std::move(lines);
+}
+
+bool Command_watch::print_hook(void *user_data, const char *msg) {
   const auto self = static_cast<Command_watch *>(user_data);
 
+  if (self->m_incremental) {
+    // output is captured and painted once the report finishes
+    self->m_output.append(msg);
+    return true;
+  }
+
   if (self->m_clear_screen && self->m_first_line) {
     self->m_first_line = false;
     mysqlshdk::textui::clear_screen();
@@ -46,13 +46,27 @@ class Command_watch : public Command_show {
   std::vector<std::string> parse_arguments(
       const std::vector<std::string> &args);
 
+  /**
+   * Paints the lines of the current output which differ from the previous
+   * one.
+   */
+  void repaint();
+
   shcore::Interpreter_print_handler m_handler;
 
   bool m_first_line = false;
 
+  // output of the report captured in incremental mode
+  std::string m_output;
+
+  // lines currently displayed on the screen in incremental mode
+  std::vector<std::string> m_screen;
+
   // default values of options handled by \watch
   bool m_clear_screen = true;
 
+  bool m_incremental = false;
+
   float m_refresh_interval = 2.0f;
 };
 
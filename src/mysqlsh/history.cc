@@ -23,43 +23,317 @@
 
 #include "mysqlsh/history.h"
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <vector>
 
 #include "ext/linenoise-ng/include/linenoise.h"
 
 namespace mysqlsh {
 
+namespace {
+
+/**
+ * History file which is exclusively locked while it's open, writes always
+ * append to the end of the file.
+ */
+class Locked_file final {
+ public:
+  Locked_file(const std::string &path, bool create) {
+#ifdef _WIN32
+    m_fd = _open(path.c_str(),
+                 _O_RDWR | _O_APPEND | _O_BINARY | (create ? _O_CREAT : 0),
+                 _S_IREAD | _S_IWRITE);
+
+    if (m_fd < 0) return;
+
+    OVERLAPPED overlapped{};
+
+    if (!LockFileEx(reinterpret_cast<HANDLE>(_get_osfhandle(m_fd)),
+                    LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD,
+                    &overlapped)) {
+      close();
+      errno = EACCES;
+    }
+#else
+    m_fd = ::open(path.c_str(), O_RDWR | O_APPEND | (create ? O_CREAT : 0),
+                  S_IRUSR | S_IWUSR);
+
+    if (m_fd < 0) return;
+
+    struct flock lock {};
+    lock.l_type = F_WRLCK;
+    lock.l_whence = SEEK_SET;
+
+    int rc;
+
+    while ((rc = ::fcntl(m_fd, F_SETLKW, &lock)) < 0 && EINTR == errno) {
+    }
+
+    if (rc < 0) {
+      const auto error = errno;
+      close();
+      errno = error;
+    }
+#endif
+  }
+
+  Locked_file(const Locked_file &) = delete;
+  Locked_file(Locked_file &&) = delete;
+
+  Locked_file &operator=(const Locked_file &) = delete;
+  Locked_file &operator=(Locked_file &&) = delete;
+
+  ~Locked_file() { close(); }
+
+  bool is_open() const { return m_fd >= 0; }
+
+  bool read(std::string *data) {
+    char buffer[4096];
+
+#ifdef _WIN32
+    if (_lseek(m_fd, 0, SEEK_SET) < 0) return false;
+
+    int bytes;
+
+    while ((bytes = _read(m_fd, buffer, sizeof(buffer))) > 0) {
+      data->append(buffer, bytes);
+    }
+#else
+    if (::lseek(m_fd, 0, SEEK_SET) < 0) return false;
+
+    ssize_t bytes;
+
+    while ((bytes = ::read(m_fd, buffer, sizeof(buffer))) > 0 ||
+           (bytes < 0 && EINTR == errno)) {
+      if (bytes > 0) data->append(buffer, bytes);
+    }
+#endif
+
+    return 0 == bytes;
+  }
+
+  bool write(const std::string &data) {
+    auto ptr = data.data();
+    auto left = data.size();
+
+    while (left > 0) {
+#ifdef _WIN32
+      const auto bytes = _write(
+          m_fd, ptr,
+          static_cast<unsigned int>(std::min<std::size_t>(left, 1 << 30)));
+#else
+      const auto bytes = ::write(m_fd, ptr, left);
+
+      if (bytes < 0 && EINTR == errno) continue;
+#endif
+
+      if (bytes <= 0) return false;
+
+      ptr += bytes;
+      left -= bytes;
+    }
+
+    return true;
+  }
+
+  bool truncate() {
+#ifdef _WIN32
+    return 0 == _chsize_s(m_fd, 0);
+#else
+    return 0 == ::ftruncate(m_fd, 0);
+#endif
+  }
+
+ private:
+  void close() {
+    if (m_fd >= 0) {
+#ifdef _WIN32
+      OVERLAPPED overlapped{};
+      UnlockFileEx(reinterpret_cast<HANDLE>(_get_osfhandle(m_fd)), 0, MAXDWORD,
+                   MAXDWORD, &overlapped);
+      _close(m_fd);
+#else
+      // closing the file releases the lock
+      ::close(m_fd);
+#endif
+      m_fd = -1;
+    }
+  }
+
+  int m_fd = -1;
+};
+
+std::vector<std::string> split_lines(const std::string &data) {
+  std::vector<std::string> lines;
+  std::string::size_type begin = 0;
+
+  while (begin < data.size()) {
+    auto end = data.find('\n', begin);
+
+    if (std::string::npos == end) end = data.size();
+
+    const auto line_end = static_cast<std::string::size_type>(
+        std::find(data.begin() + begin, data.begin() + end, '\r') -
+        data.begin());
+
+    if (line_end != begin) lines.emplace_back(data, begin, line_end - begin);
+
+    begin = end + 1;
+  }
+
+  return lines;
+}
+
+}  // namespace
+
 History::History() { linenoiseHistoryFree(); }
 
 bool History::load(const std::string &path) {
-  clear();
-  linenoiseHistorySetMaxLen(_limit);
-  if (linenoiseHistoryLoad(path.c_str()) < 0) {
-    linenoiseHistorySetMaxLen(_limit + 1);
-    return errno == ENOENT;  // file not found is OK
-  } else {
-    _serial = 0;
-    for (int c = linenoiseHistorySize(), i = 0; i < c; i++) {
-      _serials.push_back(++_serial);
+  reset();
+  _rewrite = false;
+  _file_entries = 0;
+
+  std::string data;
+
+  {
+    Locked_file file{path, false};
+
+    if (!file.is_open()) {
+      return errno == ENOENT;  // file not found is OK
     }
-    linenoiseHistorySetMaxLen(_limit + 1);
-    return true;
+
+    if (!file.read(&data)) return false;
+  }
+
+  const auto lines = split_lines(data);
+
+  linenoiseHistorySetMaxLen(_limit);
+
+  for (const auto &line : lines) {
+    linenoiseHistoryAdd(line.c_str());
+  }
+
+  for (int c = linenoiseHistorySize(), i = 0; i < c; i++) {
+    _serials.push_back(++_serial);
   }
+
+  linenoiseHistorySetMaxLen(_limit + 1);
+
+  _saved_serial = _serial;
+  _file_entries = static_cast<uint32_t>(lines.size());
+
+  return true;
 }
 
 bool History::save(const std::string &file) {
   clear_temporary();
 
-  return linenoiseHistorySave(file.c_str()) >= 0;
+  if (_rewrite) return save_all(file);
+
+  const auto first_unsaved = static_cast<uint32_t>(
+      std::upper_bound(_serials.begin(), _serials.end(), _saved_serial) -
+      _serials.begin());
+  std::vector<std::string> lines;
+
+  for (uint32_t i = first_unsaved, c = size(); i < c; ++i) {
+    const char *ptr = linenoiseHistoryLine(i);
+
+    if (ptr && *ptr) lines.emplace_back(ptr);
+  }
+
+  // compact the file once it holds twice as many entries as the limit
+  const bool compact =
+      uint64_t{_file_entries} + lines.size() > 2 * uint64_t{_limit};
+
+  if (lines.empty() && !compact) return true;
+
+  Locked_file f{file, true};
+
+  if (!f.is_open()) return false;
+
+  if (compact) {
+    // other shells could have appended their entries, reload the file
+    std::string data;
+
+    if (!f.read(&data)) return false;
+
+    auto all = split_lines(data);
+    std::move(lines.begin(), lines.end(), std::back_inserter(all));
+
+    if (all.size() > _limit) {
+      all.erase(all.begin(), all.end() - _limit);
+    }
+
+    lines = std::move(all);
+
+    if (!f.truncate()) return false;
+
+    _file_entries = 0;
+  }
+
+  std::string data;
+
+  for (const auto &line : lines) {
+    data.append(line).append(1, '\n');
+  }
+
+  if (!f.write(data)) return false;
+
+  _saved_serial = last_entry();
+  _file_entries += static_cast<uint32_t>(lines.size());
+
+  return true;
+}
+
+bool History::save_all(const std::string &file) {
+  clear_temporary();
+
+  std::string data;
+  uint32_t entries = 0;
+
+  for (uint32_t i = 0, c = size(); i < c; ++i) {
+    const char *ptr = linenoiseHistoryLine(i);
+
+    if (ptr && *ptr) {
+      data.append(ptr).append(1, '\n');
+      ++entries;
+    }
+  }
+
+  Locked_file f{file, true};
+
+  if (!f.is_open() || !f.truncate() || !f.write(data)) return false;
+
+  _rewrite = false;
+  _saved_serial = last_entry();
+  _file_entries = entries;
+
+  return true;
 }
 
 void History::clear() {
+  reset();
+  // entries stored in the file need to be removed as well
+  _rewrite = true;
+}
+
+void History::reset() {
   _last_entry_was_temporary = false;
   _serial = 0;
   _serials.clear();
+  _saved_serial = 0;
   linenoiseHistoryFree();
 }
 
@@ -170,6 +444,9 @@ void History::del(uint32_t serial_first, uint32_t serial_last) {
   assert(serial_last >= first_entry() && serial_last <= last_entry());
   assert(serial_first <= serial_last);
 
+  // removing entries which are already in the file requires a rewrite
+  const bool persisted = serial_first <= _saved_serial;
+
   auto iter = _serials.end();
   for (uint32_t ser = serial_last; ser >= serial_first; ser--) {
     iter = std::find(_serials.begin(), _serials.end(), ser);
@@ -180,9 +457,11 @@ void History::del(uint32_t serial_first, uint32_t serial_last) {
     }
   }
   if (_serials.empty())
-    clear();
+    reset();
   else if (_serials.back() < serial_last)
     _serial = _serials.back();
+
+  if (persisted) _rewrite = true;
 }
 
 }  // namespace mysqlsh
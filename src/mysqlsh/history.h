@@ -33,7 +33,21 @@ namespace mysqlsh {
 class History {
  public:
   History();
+
+  /**
+   * Persists the history. Only the entries which were added since the last
+   * load/save are appended to the file, the file is locked while this happens,
+   * so that multiple shells can share the same history file. Whole file is
+   * rewritten only if already persisted entries were removed, or if it grew
+   * much larger than the history limit.
+   */
   bool save(const std::string &file);
+
+  /**
+   * Rewrites the file with all the entries which are currently in memory.
+   */
+  bool save_all(const std::string &file);
+
   bool load(const std::string &file);
 
   void clear();
@@ -57,7 +71,14 @@ class History {
   uint32_t _serial = 0;
   int _paused = 0;
   bool _last_entry_was_temporary = false;
+  // serial of the newest entry which is already stored in the file
+  uint32_t _saved_serial = 0;
+  // number of entries stored in the file
+  uint32_t _file_entries = 0;
+  // set if entries stored in the file were removed from the history
+  bool _rewrite = false;
 
+  void reset();
   void clear_temporary();
 };
 
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Creates the startup snapshot of the JavaScript context, executed at build
+// time, see JScript_context::create_startup_snapshot().
+
+#include <cstdio>
+#include <exception>
+#include <string>
+
+#include "mysqlshdk/include/scripting/jscript_context.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+
+namespace shcore {
+extern void JScript_context_fini();
+}  // namespace shcore
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <output file>\n", argv[0]);
+    return 1;
+  }
+
+  try {
+    const auto snapshot = shcore::JScript_context::create_startup_snapshot();
+
+    if (!shcore::create_file(argv[1], snapshot, true)) {
+      fprintf(stderr, "Failed to write '%s'\n", argv[1]);
+      return 1;
+    }
+  } catch (const std::exception &e) {
+    fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+
+  shcore::JScript_context_fini();
+
+  return 0;
+}
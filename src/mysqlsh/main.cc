@@ -32,6 +32,7 @@
 #include "mysqlshdk/libs/textui/textui.h"
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/document_parser.h"
+#include "mysqlshdk/libs/utils/profiling.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
@@ -613,6 +614,36 @@ static void finalize_shell(mysqlsh::Command_line_shell *shell) {
   mysqlsh::global_end();
 }
 
+static constexpr const char *k_shell_startup_stage = "shell";
+
+/**
+ * Prints the time spent in each of the startup stages, enabled with
+ * --debug-startup.
+ */
+static void print_startup_timing(
+    const mysqlshdk::utils::Profile_timer &timer,
+    const mysqlshdk::utils::Profile_timer &shell_timer,
+    const mysqlshdk::utils::Duration &total) {
+  const auto print = [](int depth, const char *stage, double ms) {
+    fprintf(stderr, "%*s%-*s %10.3f ms\n", 2 + 2 * depth, "", 32 - 2 * depth,
+            stage, ms);
+  };
+
+  fprintf(stderr, "Startup timing:\n");
+
+  for (const auto &tp : timer.trace_points()) {
+    print(tp.depth, tp.note, tp.milliseconds_elapsed());
+
+    if (!strcmp(k_shell_startup_stage, tp.note)) {
+      for (const auto &stp : shell_timer.trace_points()) {
+        print(tp.depth + 1 + stp.depth, stp.note, stp.milliseconds_elapsed());
+      }
+    }
+  }
+
+  print(0, "total", total.milliseconds_elapsed());
+}
+
 static void setup_path_env() {
   std::string path;
 
@@ -661,6 +692,10 @@ int wmain(int argc, wchar_t **wargv) {
 #else
 int main(int argc, char **argv) {
 #endif
+  mysqlshdk::utils::Duration startup_time;
+  mysqlshdk::utils::Profile_timer startup_timer;
+  startup_time.start();
+
   tzset();
   std::string mysqlsh_path = shcore::get_binary_path();
   g_mysqlsh_path = mysqlsh_path.c_str();
@@ -709,10 +744,14 @@ int main(int argc, char **argv) {
   shcore::setenv("LC_ALL", "en_US.UTF-8");
 #endif  // _WIN32
 
+  startup_timer.stage_begin("global initialization");
+
   mysqlsh::global_init();
 
   setup_path_env();
 
+  startup_timer.stage_end();
+
   // Has to be called once in main so internal static variable is properly set
   // with the main thread id.
   mysqlshdk::utils::in_main_thread();
@@ -724,9 +763,11 @@ int main(int argc, char **argv) {
   mysqlsh::Scoped_interrupt interrupt_handler(
       shcore::Interrupts::create(&sighelper));
 
+  startup_timer.stage_begin("command line options");
   std::shared_ptr<mysqlsh::Shell_options> shell_options =
       process_args(&argc, &argv);
   const mysqlsh::Shell_options::Storage &options = shell_options->get();
+  startup_timer.stage_end();
 
   if (options.exit_code != 0) return options.exit_code;
 
@@ -743,6 +784,11 @@ int main(int argc, char **argv) {
     exit(1);
   }
 
+  if (shcore::Logger::Overflow_policy policy;
+      shcore::Logger::parse_async_mode(options.log_async, &policy)) {
+    logger->start_async(policy);
+  }
+
   mysqlsh::Scoped_logger scoped_logger(logger);
 
   log_info("%s", version_string(argv[0], true).c_str());
@@ -768,6 +814,8 @@ int main(int argc, char **argv) {
 
     bool valid_color_capability = detect_color_capability();
 
+    startup_timer.stage_begin(k_shell_startup_stage);
+
     // The Json_shell mode is enabled when this env variable is defined
     char *json_shell = getenv("MYSQLSH_JSON_SHELL");
     if (json_shell) {
@@ -789,6 +837,8 @@ int main(int argc, char **argv) {
 
     init_shell(shell);
 
+    startup_timer.stage_end();
+
     // Since log initialization errors are not critical but just warnings, they
     // get printed in a delayed way to have them properly formatted based on the
     // ourput format
@@ -842,6 +892,8 @@ int main(int argc, char **argv) {
 
       // Open the default shell session
       if (options.has_connection_data(true)) {
+        startup_timer.stage_begin("connection");
+
         try {
           auto restore_print_on_error =
               shcore::Scoped_callback([shell]() { shell->restore_print(); });
@@ -878,6 +930,8 @@ int main(int argc, char **argv) {
 
           // If redirect is requested, then reconnect to the right instance
           handle_redirect(shell, options.redirect_session);
+
+          startup_timer.stage_end();
         } catch (const mysqlshdk::db::Error &e) {
           std::string error = "MySQL Error ";
           error.append(std::to_string(e.code()));
@@ -911,18 +965,29 @@ int main(int argc, char **argv) {
       }
 
       try {
+        startup_timer.stage_begin("extra globals");
         // initialize globals requested via command line (i.e. --cluster,
         // --replicaset)
         shell->init_extra_globals();
+        startup_timer.stage_end();
       } catch (const shcore::Exception &e) {
         mysqlsh::current_console()->print_error(e.format());
         return 1;
       }
 
-      if (valid_color_capability) shell->load_prompt_theme(pick_prompt_theme());
-
       const auto shell_cli_operation = shell_options->get_shell_cli_operation();
 
+      // prompt is not used when executing a command line operation
+      if (valid_color_capability && !shell_cli_operation) {
+        shell->load_prompt_theme(pick_prompt_theme());
+      }
+
+      if (options.debug_startup) {
+        startup_time.finish();
+        print_startup_timing(startup_timer, shell->startup_timer(),
+                             startup_time);
+      }
+
       if (shell_cli_operation) {
         try {
           shell->print_result(shell_cli_operation->execute());
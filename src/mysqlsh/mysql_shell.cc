@@ -42,6 +42,7 @@
 #include "modules/devapi/mod_mysqlx_resultset.h"  // temporary
 #include "modules/devapi/mod_mysqlx_schema.h"
 #include "modules/devapi/mod_mysqlx_session.h"
+#include "modules/mod_lazy_plugin.h"
 #include "modules/mod_mysql.h"
 #include "modules/mod_mysql_resultset.h"  // temporary
 #include "modules/mod_mysql_session.h"
@@ -63,6 +64,7 @@
 #include "scripting/shexcept.h"
 #include "shellcore/interrupt_handler.h"
 #include "shellcore/shell_resultset_dumper.h"
+#include "src/mysqlsh/commands/command_background.h"
 #include "src/mysqlsh/commands/command_query_attributes.h"
 #include "src/mysqlsh/commands/command_show.h"
 #include "src/mysqlsh/commands/command_watch.h"
@@ -502,8 +504,12 @@ REGISTER_HELP(CMD_WATCH_DETAIL2,
 REGISTER_HELP(CMD_WATCH_DETAIL3,
               "@li --nocls - Don't clear the screen between refreshes.");
 REGISTER_HELP(CMD_WATCH_DETAIL4,
+              "@li --incremental - Repaint only the lines which changed since "
+              "the previous refresh, instead of clearing the screen. Output "
+              "which does not fit on the screen is not displayed.");
+REGISTER_HELP(CMD_WATCH_DETAIL5,
               "If executed without the report name, lists available reports.");
-REGISTER_HELP(CMD_WATCH_DETAIL5, "For more information see \\show command.");
+REGISTER_HELP(CMD_WATCH_DETAIL6, "For more information see \\show command.");
 REGISTER_HELP(CMD_WATCH_EXAMPLE, "<b>\\watch</b>");
 REGISTER_HELP(CMD_WATCH_EXAMPLE_DESC,
               "Lists available reports, both built-in and user-defined.");
@@ -562,6 +568,47 @@ SQL statement.
 Retrieves the value of the query attribute named "my attribute".
 )*");
 
+REGISTER_HELP_COMMAND_TEXT(CMD_BG, R"*(
+Executes the given SQL statement in the background, using a new session.
+
+@syntax <b>\bg</b> <statement>
+
+The statement is executed using a new session, which is created with the
+connection options of the global session and uses its current schema. The shell
+remains available while the statement is being executed. Results returned by the
+statement are discarded.
+
+When the statement finishes, a notification with its status is displayed before
+the next input is processed.
+
+The shell waits for the background statements to finish before exiting.
+
+@example <b>\bg</b> ALTER TABLE sakila.film ADD INDEX idx_length (length)
+
+Executes the ALTER TABLE statement in the background.
+)*");
+
+REGISTER_HELP_COMMAND_TEXT(CMD_JOBS, R"*(
+Lists the SQL statements executed in the background.
+
+@syntax <b>\jobs</b>
+
+Displays the statements which are still being executed, and the status of the
+statements which have finished since the last notification.
+)*");
+
+REGISTER_HELP_COMMAND_TEXT(CMD_WAIT, R"*(
+Waits for the SQL statements executed in the background to finish.
+
+@syntax <b>\wait</b> [id]
+
+If the id is given, waits for the specified statement, otherwise waits for all
+the background statements. Status of the finished statements is displayed.
+
+Press CTRL-C to stop waiting, the statements continue to execute in the
+background.
+)*");
+
 Mysql_shell::Mysql_shell(const std::shared_ptr<Shell_options> &cmdline_options,
                          shcore::Interpreter_delegate *custom_delegate)
     : mysqlsh::Base_shell(cmdline_options),
@@ -571,6 +618,8 @@ Mysql_shell::Mysql_shell(const std::shared_ptr<Shell_options> &cmdline_options,
               : std::make_shared<mysqlsh::Shell_console>(custom_delegate)} {
   DEBUG_OBJ_ALLOC(Mysql_shell);
 
+  m_startup_timer.stage_begin("global objects");
+
   // Registers the interactive objects if required
   _global_shell = std::make_shared<mysqlsh::Shell>(this);
   _global_js_sys = std::make_shared<mysqlsh::Sys>(_shell.get());
@@ -599,6 +648,9 @@ Mysql_shell::Mysql_shell(const std::shared_ptr<Shell_options> &cmdline_options,
   INIT_MODULE(mysqlsh::mysql::Mysql);
   INIT_MODULE(mysqlsh::mysqlx::Mysqlx);
 
+  m_startup_timer.stage_end();
+  m_startup_timer.stage_begin("shell commands");
+
   set_sql_safe_for_logging(get_options()->get(SHCORE_HISTIGNORE).descr());
   // completion provider for shell \commands (must be the 1st)
   completer()->add_provider(shcore::IShell_core::Mode_mask::any(),
@@ -701,31 +753,77 @@ Mysql_shell::Mysql_shell(const std::shared_ptr<Shell_options> &cmdline_options,
       },
       true, shcore::IShell_core::Mode_mask(shcore::IShell_core::Mode::SQL),
       true, "\"'`");
+
+  m_background_statements = std::make_unique<Background_statements>();
+  SET_CUSTOM_SHELL_COMMAND(
+      "\\bg", "CMD_BG",
+      [this](const std::vector<std::string> &args) {
+        return m_background_statements->start(_shell->get_dev_session(), args);
+      },
+      true, shcore::IShell_core::Mode_mask(shcore::IShell_core::Mode::SQL),
+      false);
+  SET_CUSTOM_SHELL_COMMAND(
+      "\\jobs", "CMD_JOBS",
+      [this](const std::vector<std::string> &args) {
+        return m_background_statements->list(args);
+      },
+      true, shcore::IShell_core::Mode_mask(shcore::IShell_core::Mode::SQL));
+  SET_CUSTOM_SHELL_COMMAND(
+      "\\wait", "CMD_WAIT",
+      [this](const std::vector<std::string> &args) {
+        return m_background_statements->wait(args);
+      },
+      true, shcore::IShell_core::Mode_mask(shcore::IShell_core::Mode::SQL));
+
+  m_startup_timer.stage_end();
+  m_startup_timer.stage_begin("credential helper");
+
   shcore::Credential_manager::get().initialize();
+
+  m_startup_timer.stage_end();
 }
 
 Mysql_shell::~Mysql_shell() { DEBUG_OBJ_DEALLOC(Mysql_shell); }
 
 void Mysql_shell::finish_init() {
-  // Python needs to be initialized in case there are python start files/plugins
-  // but we do this only once for the whole application.
-  if (mysqlshdk::utils::in_main_thread()) shell_context()->init_py();
+  // Scripting languages are initialized on first use: when switching to the
+  // initial mode, when loading startup scripts or plugins written in them, or
+  // when the user switches the mode. Python is initialized only in the main
+  // thread, as other threads create their shells with no initial mode.
+  // CLI calls to the native global objects do not need the scripting
+  // languages, startup scripts nor plugins.
+  m_skip_initial_mode =
+      mysqlshdk::utils::in_main_thread() && is_native_cli_operation();
+
+  if (m_skip_initial_mode) {
+    log_debug(
+        "Native command line operation, scripting languages, startup scripts "
+        "and plugins are not going to be loaded");
+  }
 
+  m_startup_timer.stage_begin("initial mode");
   Base_shell::finish_init();
+  m_startup_timer.stage_end();
 
-  // if Python is disabled it means we're creating another instance of shell in
-  // a thread. because of that we don't want to initialize everything again for
-  // the scripting languages.
+  // if this is not the main thread it means we're creating another instance of
+  // shell in a thread. because of that we don't want to initialize everything
+  // again for the scripting languages.
   // Also the shell_cli_operation is not needed as context won't need that.
 
   if (mysqlshdk::utils::in_main_thread()) {
-    File_list startup_files;
-    get_startup_scripts(&startup_files);
-    load_files(startup_files, "startup files");
-
-    File_list plugins;
-    get_plugins(&plugins);
-    load_files(plugins, "plugins");
+    if (!m_skip_initial_mode) {
+      m_startup_timer.stage_begin("startup files");
+      File_list startup_files;
+      get_startup_scripts(&startup_files);
+      load_files(startup_files, "startup files");
+      m_startup_timer.stage_end();
+
+      m_startup_timer.stage_begin("plugins");
+      File_list plugins;
+      get_plugins(&plugins);
+      load_files(plugins, "plugins");
+      m_startup_timer.stage_end();
+    }
 
     auto shell_cli_operation = m_shell_options.get()->get_shell_cli_operation();
     if (shell_cli_operation) {
@@ -789,6 +887,57 @@ void Mysql_shell::finish_init() {
   }
 }
 
+bool Mysql_shell::is_native_cli_operation() const {
+  const auto cli = get_options()->get_shell_cli_operation();
+
+  if (!cli) {
+    return false;
+  }
+
+  const auto path = cli->target_path();
+
+  // a list of objects which provide CLI operations includes the plugins
+  if (path.size() < 2) {
+    return false;
+  }
+
+  // these objects are created on demand and cannot be extended
+  if ("cluster" == path[0] || "rs" == path[0] || "clusterset" == path[0]) {
+    return true;
+  }
+
+  if ("dba" != path[0] && "shell" != path[0] && "util" != path[0]) {
+    return false;
+  }
+
+  auto object =
+      _shell->get_global(path[0]).as_object<shcore::Cpp_object_bridge>();
+
+  for (std::size_t i = 1; object && i < path.size(); ++i) {
+    const auto name = shcore::to_camel_case(path[i]);
+
+    // plugins may add members to the util and shell objects, but they cannot
+    // replace the existing ones
+    if (object->get_function_metadata(name, true)) {
+      return true;
+    }
+
+    if (!object->has_member(name)) {
+      return false;
+    }
+
+    const auto member = object->get_member(name);
+
+    if (shcore::Object != member.get_type()) {
+      return false;
+    }
+
+    object = member.as_object<shcore::Cpp_object_bridge>();
+  }
+
+  return false;
+}
+
 void Mysql_shell::load_files(const File_list &file_list,
                              const std::string &context) {
   // if plugins are found, switch to the appropriate mode and load all files
@@ -898,8 +1047,12 @@ bool Mysql_shell::get_plugins(File_list *file_list, const std::string &dir,
         } else if (is_js) {
           ret_val = true;
 #ifdef HAVE_V8
-          (*file_list)[shcore::IShell_core::Mode::JavaScript].emplace_back(
-              init_js, allow_recursive);
+          const auto mode = shcore::IShell_core::Mode::JavaScript;
+          shcore::Plugin_definition plugin{init_js, allow_recursive};
+
+          if (!register_lazy_plugin(mode, plugin, plugin_dir)) {
+            (*file_list)[mode].emplace_back(std::move(plugin));
+          }
 #else
           log_warning("Ignoring plugin at '%s', JavaScript is not available.",
                       plugin_dir.c_str());
@@ -907,8 +1060,12 @@ bool Mysql_shell::get_plugins(File_list *file_list, const std::string &dir,
         } else if (is_py) {
           ret_val = true;
 #ifdef HAVE_PYTHON
-          (*file_list)[shcore::IShell_core::Mode::Python].emplace_back(
-              init_py, allow_recursive);
+          const auto mode = shcore::IShell_core::Mode::Python;
+          shcore::Plugin_definition plugin{init_py, allow_recursive};
+
+          if (!register_lazy_plugin(mode, plugin, plugin_dir)) {
+            (*file_list)[mode].emplace_back(std::move(plugin));
+          }
 #else
           log_warning("Ignoring plugin at '%s', Python is not available.",
                         plugin_dir.c_str());
@@ -938,6 +1095,91 @@ bool Mysql_shell::get_plugins(File_list *file_list, const std::string &dir,
   return ret_val;
 }
 
+/**
+ * The manifest is a JSON document with the following format:
+ *
+ * {
+ *   "globals": {
+ *     "<name>": ["<member>", ...],
+ *     ...
+ *   }
+ * }
+ *
+ * Where each key is the name of a global object registered by the plugin, and
+ * the optional list holds the members of that object (in camelCase), used by
+ * the completion before the plugin is loaded. Plugins which register reports or
+ * have other side effects in their initialization file should not provide a
+ * manifest.
+ */
+bool Mysql_shell::register_lazy_plugin(shcore::IShell_core::Mode mode,
+                                       const shcore::Plugin_definition &plugin,
+                                       const std::string &plugin_dir) {
+  const auto manifest = shcore::path::join_path(plugin_dir, "plugin.json");
+
+  if (!shcore::is_file(manifest)) {
+    return false;
+  }
+
+  const auto name = shcore::path::basename(plugin_dir);
+  std::map<std::string, std::vector<std::string>> globals;
+
+  try {
+    const auto data = shcore::Value::parse(shcore::get_text_file(manifest));
+
+    if (shcore::Map != data.get_type()) {
+      throw std::invalid_argument("expected a JSON object");
+    }
+
+    const auto it = data.as_map()->find("globals");
+
+    if (data.as_map()->end() == it || shcore::Map != it->second.get_type() ||
+        it->second.as_map()->empty()) {
+      throw std::invalid_argument(
+          "expected a non-empty JSON object in the 'globals' key");
+    }
+
+    for (const auto &global : *it->second.as_map()) {
+      if (!shcore::is_valid_identifier(global.first) ||
+          _shell->is_global(global.first)) {
+        throw std::invalid_argument("the global object '" + global.first +
+                                    "' cannot be registered");
+      }
+
+      auto &members = globals[global.first];
+
+      if (shcore::Array == global.second.get_type()) {
+        for (const auto &member : *global.second.as_array()) {
+          members.emplace_back(member.as_string());
+        }
+      } else if (!global.second.is_null()) {
+        throw std::invalid_argument("members of the global object '" +
+                                    global.first + "' should be a list");
+      }
+    }
+  } catch (const std::exception &e) {
+    log_warning("Ignoring manifest of plugin '%s' at '%s', plugin will be "
+                "loaded at startup: %s",
+                name.c_str(), manifest.c_str(), e.what());
+    return false;
+  }
+
+  const auto lazy_plugin = std::make_shared<Lazy_plugin>(
+      name,
+      [this, mode, plugin]() { return _shell->load_plugin(mode, plugin); },
+      [this](const std::string &global) { return _shell->get_global(global); });
+
+  for (const auto &global : globals) {
+    _shell->set_global(global.first,
+                       shcore::Value(std::make_shared<Lazy_plugin_object>(
+                           global.first, global.second, lazy_plugin)),
+                       shcore::IShell_core::all_scripting_modes());
+  }
+
+  log_debug("Plugin '%s' is going to be loaded on first use", name.c_str());
+
+  return true;
+}
+
 void Mysql_shell::get_plugins(File_list *file_list) {
   const auto initial_mode = _shell->interactive_mode();
 
@@ -990,6 +1232,28 @@ void Mysql_shell::print_connection_message(
   println(message);
 }
 
+std::string Mysql_shell::server_version(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session) {
+  // version comment does not change unless server is upgraded, which also
+  // changes the version reported during the handshake, no need to query it
+  // each time user reconnects to the same endpoint
+  const auto key = session->get_connection_options().uri_endpoint() + '|' +
+                   session->get_server_version().get_full();
+  auto it = m_server_versions.find(key);
+
+  if (m_server_versions.end() == it) {
+    it = m_server_versions
+             .emplace(key, session
+                               ->query("select concat(@@version, ' ', "
+                                       "@@version_comment)")
+                               ->fetch_one()
+                               ->get_string(0))
+             .first;
+  }
+
+  return it->second;
+}
+
 std::shared_ptr<mysqlsh::ShellBaseSession> Mysql_shell::connect(
     const mysqlshdk::db::Connection_options &connection_options_,
     bool recreate_schema, bool shell_global_session,
@@ -1078,10 +1342,7 @@ std::shared_ptr<mysqlsh::ShellBaseSession> Mysql_shell::connect(
     if (session_type == "Session") message += " (X protocol)";
     try {
       message += "\nServer version: " +
-                 new_session->get_core_session()
-                     ->query("select concat(@@version, ' ', @@version_comment)")
-                     ->fetch_one()
-                     ->get_string(0);
+                 server_version(new_session->get_core_session());
     } catch (const mysqlshdk::db::Error &e) {
       // ignore password expired errors
       if (e.code() == ER_MUST_CHANGE_PASSWORD) {
@@ -1878,6 +2139,9 @@ void Mysql_shell::process_line(const std::string &line) {
   bool handled_as_command = false;
   std::string to_history;
 
+  // notify about the background statements which have finished in the meantime
+  m_background_statements->report_finished();
+
   // check if the line is an escape/shell command
   if (_input_buffer.empty() && !line.empty() &&
       _input_mode == shcore::Input_state::Ok) {
@@ -33,6 +33,7 @@
 #include "modules/mod_sys.h"
 #include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/ssh/ssh_manager.h"
+#include "mysqlshdk/libs/utils/profiling.h"
 #include "scripting/types.h"
 #include "shellcore/base_shell.h"
 #include "shellcore/shell_core.h"
@@ -42,6 +43,7 @@ namespace mysqlsh {
 class Shell;  // from modules
 class Util;
 class Os;
+class Background_statements;
 
 class Mysql_shell : public mysqlsh::Base_shell {
  public:
@@ -87,6 +89,12 @@ class Mysql_shell : public mysqlsh::Base_shell {
                              std::vector<shcore::Plugin_definition>>;
   void load_files(const File_list &file_list, const std::string &context);
 
+  /**
+   * Whether the command line operation calls a function of the native global
+   * objects (dba, cluster, rs, clusterset, shell, util).
+   */
+  bool is_native_cli_operation() const;
+
   /**
    * Gets all the startup files for the supported scripting languages at:
    *
@@ -105,12 +113,30 @@ class Mysql_shell : public mysqlsh::Base_shell {
   void get_plugins(File_list *list);
   bool get_plugins(File_list *list, const std::string &dir,
                    bool allow_recursive);
+
+  /**
+   * If the plugin directory contains a manifest (plugin.json), registers the
+   * global objects declared there as placeholders, the initialization file is
+   * executed when any of them is used for the first time.
+   *
+   * @returns true if plugin is going to be loaded on demand
+   */
+  bool register_lazy_plugin(shcore::IShell_core::Mode mode,
+                            const shcore::Plugin_definition &plugin,
+                            const std::string &plugin_dir);
   void finish_init() override;
 
   void init_extra_globals();
 
   std::shared_ptr<mysqlsh::Shell> get_shell() const { return _global_shell; }
 
+  /**
+   * Time spent in the stages of the shell initialization.
+   */
+  const mysqlshdk::utils::Profile_timer &startup_timer() const {
+    return m_startup_timer;
+  }
+
  protected:
   static void set_sql_safe_for_logging(const std::string &patterns);
 
@@ -153,12 +179,25 @@ class Mysql_shell : public mysqlsh::Base_shell {
 
   virtual void toggle_print() {}
 
+  std::string server_version(
+      const std::shared_ptr<mysqlshdk::db::ISession> &session);
+
+  mysqlshdk::utils::Profile_timer m_startup_timer;
+
+  /// Server version strings (including the comment), cached per endpoint and
+  /// version reported during the handshake.
+  std::map<std::string, std::string> m_server_versions;
+
+  /// SQL statements executed in the background via \bg command.
+  std::unique_ptr<Background_statements> m_background_statements;
+
 #ifdef FRIEND_TEST
   FRIEND_TEST(Cmdline_shell, check_password_history_linenoise);
   FRIEND_TEST(Cmdline_shell, check_history_overflow_del);
   FRIEND_TEST(Cmdline_shell, check_history_source);
   FRIEND_TEST(Cmdline_shell, history_autosave_int);
   FRIEND_TEST(Cmdline_shell, check_help_shows_history);
+  FRIEND_TEST(Cmdline_shell, server_version_is_cached);
   FRIEND_TEST(Interactive_dba_create_cluster, read_only_no_prompts);
 #endif
 };
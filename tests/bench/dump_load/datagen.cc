@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/**
+ * Generates synthetic data used by the dump_load_bench.py harness.
+ *
+ * Writes a schema.sql file with the DDL and a tab-separated file (default
+ * dialect of util.importTable()) for each table into the output directory,
+ * then prints a JSON summary of the generated tables to stdout. Output is
+ * deterministic for the given set of options.
+ */
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace {
+
+constexpr std::string_view k_usage =
+    R"(Usage: bench_datagen --shape=<shape> --output=<dir> [options]
+
+Shapes:
+  narrow   tables with a few small columns
+  wide     tables with 50 columns of different types
+  tiny     many tables with a few rows each
+  huge     a single table with a lot of rows
+  blob     tables with a large BLOB column
+
+Options:
+  --schema=<name>       name of the schema, default: bench_<shape>
+  --tables=<n>          number of tables, default depends on the shape
+  --rows=<n>            number of rows per table, default depends on the shape
+  --blob-size=<bytes>   average size of a BLOB value, default: 65536
+  --seed=<n>            seed of the random number generator, default: 1
+)";
+
+struct Options {
+  std::string shape;
+  std::string output;
+  std::string schema;
+  uint64_t tables = 0;
+  uint64_t rows = 0;
+  uint64_t blob_size = 64 * 1024;
+  uint64_t seed = 1;
+};
+
+struct Shape {
+  const char *name;
+  uint64_t tables;
+  uint64_t rows;
+};
+
+constexpr Shape k_shapes[] = {
+    {"narrow", 4, 1000000}, {"wide", 2, 100000}, {"tiny", 1000, 100},
+    {"huge", 1, 20000000},  {"blob", 2, 10000},
+};
+
+using Generator = std::mt19937_64;
+
+/**
+ * Writes a single row in the default dialect of LOAD DATA: fields terminated
+ * by tab, lines terminated by newline, escaped by backslash.
+ */
+class Row_writer final {
+ public:
+  explicit Row_writer(std::ofstream *out) : m_out(out) {}
+
+  void field(std::string_view value) {
+    separator();
+
+    for (const auto c : value) {
+      switch (c) {
+        case '\0':
+          m_row += "\\0";
+          break;
+        case '\b':
+          m_row += "\\b";
+          break;
+        case '\n':
+          m_row += "\\n";
+          break;
+        case '\r':
+          m_row += "\\r";
+          break;
+        case '\t':
+          m_row += "\\t";
+          break;
+        case '\x1a':
+          m_row += "\\Z";
+          break;
+        case '\\':
+          m_row += "\\\\";
+          break;
+        default:
+          m_row += c;
+      }
+    }
+  }
+
+  void field(uint64_t value) {
+    separator();
+    m_row += std::to_string(value);
+  }
+
+  void raw_field(std::string_view value) {
+    separator();
+    m_row += value;
+  }
+
+  void null() { raw_field("\\N"); }
+
+  void end_row() {
+    m_row += '\n';
+    m_out->write(m_row.data(), m_row.size());
+    m_bytes += m_row.size();
+    m_row.clear();
+    m_first = true;
+  }
+
+  uint64_t bytes() const { return m_bytes; }
+
+ private:
+  void separator() {
+    if (!m_first) m_row += '\t';
+    m_first = false;
+  }
+
+  std::ofstream *m_out;
+  std::string m_row;
+  bool m_first = true;
+  uint64_t m_bytes = 0;
+};
+
+std::string random_word(Generator *gen, std::size_t min, std::size_t max) {
+  static constexpr char k_chars[] =
+      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 ";
+  std::uniform_int_distribution<std::size_t> length{min, max};
+  std::uniform_int_distribution<std::size_t> chr{0, sizeof(k_chars) - 2};
+  std::string s(length(*gen), ' ');
+
+  for (auto &c : s) {
+    c = k_chars[chr(*gen)];
+  }
+
+  return s;
+}
+
+std::string random_bytes(Generator *gen, std::size_t length) {
+  std::string s(length, '\0');
+
+  for (std::size_t i = 0; i < length; i += sizeof(uint64_t)) {
+    const auto v = (*gen)();
+    std::memcpy(&s[i], &v, std::min(sizeof(uint64_t), length - i));
+  }
+
+  return s;
+}
+
+std::string random_datetime(Generator *gen) {
+  std::uniform_int_distribution<int> year{2000, 2030}, month{1, 12}, day{1, 28},
+      hour{0, 23}, minute{0, 59};
+  return shcore::str_format("%04d-%02d-%02d %02d:%02d:%02d", year(*gen),
+                            month(*gen), day(*gen), hour(*gen), minute(*gen),
+                            minute(*gen));
+}
+
+struct Table_shape {
+  std::string ddl;
+  std::function<void(uint64_t id, Generator *, Row_writer *)> row;
+};
+
+Table_shape narrow_table() {
+  return {"`id` BIGINT UNSIGNED NOT NULL PRIMARY KEY, `k` INT UNSIGNED NOT "
+          "NULL, `c` VARCHAR(32) NOT NULL, `pad` CHAR(16) NOT NULL, KEY(`k`)",
+          [](uint64_t id, Generator *gen, Row_writer *w) {
+            w->field(id);
+            w->field((*gen)() % 1000000);
+            w->field(random_word(gen, 8, 32));
+            w->field(random_word(gen, 16, 16));
+          }};
+}
+
+Table_shape wide_table() {
+  std::string ddl = "`id` BIGINT UNSIGNED NOT NULL PRIMARY KEY";
+
+  for (int i = 0; i < 10; ++i) {
+    ddl += shcore::str_format(", `i%d` INT", i);
+    ddl += shcore::str_format(", `d%d` DOUBLE", i);
+    ddl += shcore::str_format(", `t%d` DATETIME", i);
+    ddl += shcore::str_format(", `s%d` VARCHAR(64)", i);
+  }
+
+  for (int i = 0; i < 9; ++i) {
+    ddl += shcore::str_format(", `n%d` DECIMAL(12,2)", i);
+  }
+
+  return {std::move(ddl), [](uint64_t id, Generator *gen, Row_writer *w) {
+            w->field(id);
+
+            for (int i = 0; i < 10; ++i) {
+              // every 10th value is NULL
+              if (0 == (*gen)() % 10) {
+                w->null();
+              } else {
+                w->field((*gen)() % 2147483647);
+              }
+
+              w->raw_field(std::to_string(
+                  std::uniform_real_distribution<double>{-1e6, 1e6}(*gen)));
+              w->raw_field(random_datetime(gen));
+              w->field(random_word(gen, 0, 64));
+            }
+
+            for (int i = 0; i < 9; ++i) {
+              w->raw_field(shcore::str_format(
+                  "%" PRIu64 ".%02" PRIu64, (*gen)() % 10000000000,
+                  (*gen)() % 100));
+            }
+          }};
+}
+
+Table_shape huge_table() {
+  return {"`id` BIGINT UNSIGNED NOT NULL PRIMARY KEY, `k` INT UNSIGNED NOT "
+          "NULL, `ts` DATETIME NOT NULL, `payload` VARCHAR(200) NOT NULL",
+          [](uint64_t id, Generator *gen, Row_writer *w) {
+            w->field(id);
+            w->field((*gen)() % 1000000);
+            w->raw_field(random_datetime(gen));
+            w->field(random_word(gen, 50, 200));
+          }};
+}
+
+Table_shape blob_table(uint64_t blob_size) {
+  return {"`id` BIGINT UNSIGNED NOT NULL PRIMARY KEY, `name` VARCHAR(64) NOT "
+          "NULL, `data` LONGBLOB",
+          [blob_size](uint64_t id, Generator *gen, Row_writer *w) {
+            w->field(id);
+            w->field(random_word(gen, 8, 64));
+            // sizes are uniformly distributed in [blob_size/2, 3*blob_size/2]
+            std::uniform_int_distribution<uint64_t> size{blob_size / 2,
+                                                         blob_size * 3 / 2};
+            w->field(random_bytes(gen, size(*gen)));
+          }};
+}
+
+Table_shape table_shape(const Options &options) {
+  if ("wide" == options.shape) return wide_table();
+  if ("huge" == options.shape) return huge_table();
+  if ("blob" == options.shape) return blob_table(options.blob_size);
+  return narrow_table();
+}
+
+Options parse_options(int argc, char *argv[]) {
+  Options options;
+
+  const auto number = [](std::string_view name, std::string_view value) {
+    try {
+      return shcore::lexical_cast<uint64_t>(value);
+    } catch (const std::exception &) {
+      throw std::invalid_argument("Option " + std::string{name} +
+                                  " requires a number, got: " +
+                                  std::string{value});
+    }
+  };
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const auto p = arg.find('=');
+    const auto name = arg.substr(0, p);
+    const auto value = std::string_view::npos == p ? std::string_view{}
+                                                   : arg.substr(p + 1);
+
+    if ("--shape" == name) {
+      options.shape = value;
+    } else if ("--output" == name) {
+      options.output = value;
+    } else if ("--schema" == name) {
+      options.schema = value;
+    } else if ("--tables" == name) {
+      options.tables = number(name, value);
+    } else if ("--rows" == name) {
+      options.rows = number(name, value);
+    } else if ("--blob-size" == name) {
+      options.blob_size = number(name, value);
+    } else if ("--seed" == name) {
+      options.seed = number(name, value);
+    } else {
+      throw std::invalid_argument("Unknown option: " + std::string{arg});
+    }
+  }
+
+  const Shape *shape = nullptr;
+
+  for (const auto &s : k_shapes) {
+    if (options.shape == s.name) shape = &s;
+  }
+
+  if (!shape) {
+    throw std::invalid_argument("Unknown shape: '" + options.shape + "'");
+  }
+
+  if (options.output.empty()) {
+    throw std::invalid_argument("The --output option is required");
+  }
+
+  if (options.schema.empty()) options.schema = "bench_" + options.shape;
+  if (0 == options.tables) options.tables = shape->tables;
+  if (0 == options.rows) options.rows = shape->rows;
+  // a single table by definition
+  if ("huge" == options.shape) options.tables = 1;
+
+  return options;
+}
+
+void generate(const Options &options) {
+  const auto shape = table_shape(options);
+
+  shcore::create_directory(options.output, true);
+
+  std::ofstream ddl{shcore::path::join_path(options.output, "schema.sql")};
+  ddl << "CREATE SCHEMA IF NOT EXISTS `" << options.schema << "`;\n";
+
+  std::string summary = shcore::str_format(
+      "{\"schema\": \"%s\", \"shape\": \"%s\", \"seed\": %" PRIu64
+      ", \"tables\": [",
+      options.schema.c_str(), options.shape.c_str(), options.seed);
+
+  for (uint64_t t = 0; t < options.tables; ++t) {
+    const auto table = shcore::str_format("%s_%05" PRIu64,
+                                          options.shape.c_str(), t);
+    const auto file = shcore::path::join_path(options.output, table + ".tsv");
+
+    ddl << "CREATE TABLE `" << options.schema << "`.`" << table << "` ("
+        << shape.ddl << ");\n";
+
+    std::ofstream out{file, std::ios::binary};
+    Row_writer writer{&out};
+    Generator gen{options.seed * 1000003 + t};
+
+    for (uint64_t r = 1; r <= options.rows; ++r) {
+      shape.row(r, &gen, &writer);
+      writer.end_row();
+    }
+
+    out.close();
+
+    if (!out) {
+      throw std::runtime_error("Failed to write: " + file);
+    }
+
+    if (t) summary += ", ";
+    summary += shcore::str_format(
+        "{\"name\": \"%s\", \"file\": \"%s\", \"rows\": %" PRIu64
+        ", \"bytes\": %" PRIu64 "}",
+        table.c_str(), shcore::str_replace(file, "\\", "\\\\").c_str(),
+        options.rows, writer.bytes());
+  }
+
+  summary += "]}";
+
+  if (!ddl.flush()) {
+    throw std::runtime_error("Failed to write the schema.sql file");
+  }
+
+  std::cout << summary << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  try {
+    generate(parse_options(argc, argv));
+  } catch (const std::invalid_argument &e) {
+    std::cerr << e.what() << "\n\n" << k_usage;
+    return 2;
+  } catch (const std::exception &e) {
+    std::cerr << "ERROR: " << e.what() << '\n';
+    return 1;
+  }
+
+  return 0;
+}
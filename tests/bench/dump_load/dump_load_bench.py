@@ -0,0 +1,348 @@
+#
+# Copyright (c) 2023, Oracle and/or its affiliates.
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License, version 2.0,
+# as published by the Free Software Foundation.
+#
+# This program is also distributed with certain software (including
+# but not limited to OpenSSL) that is licensed under separate terms, as
+# designated in a particular file or component or in included license
+# documentation.  The authors of MySQL hereby grant you an additional
+# permission to link the program and your derivative works with the
+# separately licensed software that they have included with MySQL.
+# This program is distributed in the hope that it will be useful,  but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+# the GNU General Public License, version 2.0, for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+#
+
+"""
+End-to-end dump/load benchmark.
+
+Deploys two sandboxes, fills the source one with the data produced by
+bench_datagen and measures util.dumpSchemas(), util.loadDump() and
+util.copySchemas() for every combination of the given settings, using local
+directories, the in-memory storage of the copy utilities and an S3-compatible
+object storage (i.e. a local MinIO server).
+
+Needs to be executed by the shell:
+
+  mysqlsh --py --file dump_load_bench.py -- --datagen=<path> --shape=narrow \\
+      --threads=4,8 --bytes-per-chunk=64M,256M --compression=zstd,none \\
+      --output=results.json
+
+The results are written in a fixed JSON format (see FORMAT_VERSION) and can be
+compared between builds with --compare=<previous results>. Throughput is
+computed using the size of the generated data, so that it can be compared
+between the operations.
+"""
+
+import argparse
+import itertools
+import json
+import os
+import os.path
+import shutil
+import statistics
+import subprocess
+import sys
+import time
+
+FORMAT_VERSION = 1
+
+def parse_args():
+    parser = argparse.ArgumentParser(prog="dump_load_bench.py",
+                                     description="End-to-end dump/load benchmark")
+    parser.add_argument("--datagen", default="bench_datagen",
+                        help="path to the bench_datagen executable")
+    parser.add_argument("--shape", default="narrow",
+                        choices=["narrow", "wide", "tiny", "huge", "blob"])
+    parser.add_argument("--tables", type=int, default=0,
+                        help="number of tables, default depends on the shape")
+    parser.add_argument("--rows", type=int, default=0,
+                        help="rows per table, default depends on the shape")
+    parser.add_argument("--blob-size", type=int, default=0,
+                        help="average size of a BLOB value")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--work-dir", default=os.path.join(os.getcwd(), "dump_load_bench"),
+                        help="directory for the generated data and local dumps")
+    parser.add_argument("--sandbox-dir", default="",
+                        help="directory of the sandboxes, default: <work-dir>/sandboxes")
+    parser.add_argument("--source-port", type=int, default=3310)
+    parser.add_argument("--target-port", type=int, default=3320)
+    parser.add_argument("--password", default="root")
+    parser.add_argument("--keep-sandboxes", action="store_true",
+                        help="do not delete the sandboxes when finished")
+    parser.add_argument("--operations", default="dump,load,copy",
+                        help="comma separated list of: dump, load, copy")
+    parser.add_argument("--storage", default="local,memory",
+                        help="comma separated list of: local, memory, s3")
+    parser.add_argument("--threads", default="4",
+                        help="comma separated list of values of the threads option")
+    parser.add_argument("--bytes-per-chunk", default="64M",
+                        help="comma separated list of values of the bytesPerChunk option")
+    parser.add_argument("--compression", default="zstd",
+                        help="comma separated list of values of the compression option")
+    parser.add_argument("--max-bytes-per-transaction", default="",
+                        help="comma separated list of values of the maxBytesPerTransaction option, empty means not set")
+    parser.add_argument("--repeat", type=int, default=1,
+                        help="number of times each measurement is repeated, the median is reported")
+    parser.add_argument("--s3-bucket", default="", help="bucket used by the s3 storage")
+    parser.add_argument("--s3-endpoint", default="",
+                        help="endpoint of an S3-compatible server, i.e. http://127.0.0.1:9000")
+    parser.add_argument("--s3-profile", default="")
+    parser.add_argument("--s3-credentials-file", default="")
+    parser.add_argument("--s3-config-file", default="")
+    parser.add_argument("--output", default="", help="write results to this file instead of stdout")
+    parser.add_argument("--compare", default="",
+                        help="previous results, relative differences are printed to stderr")
+    args = parser.parse_args(sys.argv[1:])
+
+    def split(value):
+        return [v.strip() for v in value.split(",")] if value else []
+
+    args.operations = split(args.operations)
+    args.storage = split(args.storage)
+    args.threads = [int(v) for v in split(args.threads)]
+    args.bytes_per_chunk = split(args.bytes_per_chunk)
+    args.compression = split(args.compression)
+    args.max_bytes_per_transaction = split(args.max_bytes_per_transaction) or [None]
+
+    if "s3" in args.storage and not args.s3_bucket:
+        parser.error("--s3-bucket is required by the s3 storage")
+
+    if not args.sandbox_dir:
+        args.sandbox_dir = os.path.join(args.work_dir, "sandboxes")
+
+    return args
+
+def log(msg):
+    print(msg, file=sys.stderr)
+    sys.stderr.flush()
+
+def uri(args, port):
+    return f"root:{args.password}@127.0.0.1:{port}"
+
+def deploy_sandbox(args, port):
+    options = {"password": args.password, "sandboxDir": args.sandbox_dir,
+               "mysqldOptions": ["local_infile=ON", "skip-log-bin"]}
+    log(f"Deploying sandbox at port {port}")
+    dba.deploy_sandbox_instance(port, options)
+
+def delete_sandbox(args, port):
+    options = {"sandboxDir": args.sandbox_dir}
+    try:
+        dba.kill_sandbox_instance(port, options)
+    except Exception:
+        pass
+    dba.delete_sandbox_instance(port, options)
+
+def generate_data(args):
+    output = os.path.join(args.work_dir, "data", args.shape)
+    cmd = [args.datagen, f"--shape={args.shape}", f"--output={output}", f"--seed={args.seed}"]
+    if args.tables:
+        cmd.append(f"--tables={args.tables}")
+    if args.rows:
+        cmd.append(f"--rows={args.rows}")
+    if args.blob_size:
+        cmd.append(f"--blob-size={args.blob_size}")
+    log("Generating data: " + " ".join(cmd))
+    dataset = json.loads(subprocess.run(cmd, check=True, stdout=subprocess.PIPE).stdout)
+    dataset["ddl"] = os.path.join(output, "schema.sql")
+    return dataset
+
+def populate_source(args, dataset):
+    session = shell.open_session(uri(args, args.source_port))
+    session.run_sql("DROP SCHEMA IF EXISTS !", [dataset["schema"]])
+    with open(dataset["ddl"], encoding="utf-8") as f:
+        for stmt in f.read().split(";\n"):
+            if stmt.strip():
+                session.run_sql(stmt)
+    shell.set_session(session)
+    log(f"Importing {len(dataset['tables'])} table(s)")
+    for table in dataset["tables"]:
+        util.import_table(table["file"], {"schema": dataset["schema"], "table": table["name"],
+                                          "threads": 8, "showProgress": False})
+    session.run_sql("ANALYZE TABLE " + ", ".join(
+        f"`{dataset['schema']}`.`{t['name']}`" for t in dataset["tables"]))
+    return session
+
+def drop_target_schema(args, dataset):
+    s = shell.open_session(uri(args, args.target_port))
+    s.run_sql("DROP SCHEMA IF EXISTS !", [dataset["schema"]])
+    s.close()
+
+def s3_options(args):
+    options = {"s3BucketName": args.s3_bucket}
+    if args.s3_endpoint:
+        options["s3EndpointOverride"] = args.s3_endpoint
+    if args.s3_profile:
+        options["s3Profile"] = args.s3_profile
+    if args.s3_credentials_file:
+        options["s3CredentialsFile"] = args.s3_credentials_file
+    if args.s3_config_file:
+        options["s3ConfigFile"] = args.s3_config_file
+    return options
+
+def measure(fn):
+    start = time.monotonic()
+    fn()
+    return time.monotonic() - start
+
+class Benchmark:
+    def __init__(self, args, dataset, source):
+        self.args = args
+        self.dataset = dataset
+        self.source = source
+        self.run_id = time.strftime("%Y%m%d-%H%M%S")
+        self.results = []
+        self.counter = 0
+
+    def dump_location(self, storage):
+        self.counter += 1
+        name = f"dump-{self.run_id}-{self.counter}"
+        if storage == "s3":
+            return "dump_load_bench/" + name, s3_options(self.args)
+        return os.path.join(self.args.work_dir, name), {}
+
+    def remove_dump(self, storage, url):
+        # objects stored in a bucket are not removed, they all share the
+        # dump_load_bench/ prefix
+        if storage == "local":
+            shutil.rmtree(url, ignore_errors=True)
+
+    def record(self, operation, storage, settings, seconds):
+        rows = sum(t["rows"] for t in self.dataset["tables"])
+        data_bytes = sum(t["bytes"] for t in self.dataset["tables"])
+        median = statistics.median(seconds)
+        result = {"operation": operation, "storage": storage, **settings,
+                  "seconds": round(median, 3),
+                  "runs": [round(s, 3) for s in seconds],
+                  "rowsPerSecond": round(rows / median, 1),
+                  "bytesPerSecond": round(data_bytes / median, 1)}
+        log(f"{operation:>5} {storage:<6} {json.dumps(settings)}: {median:.3f}s, "
+            f"{data_bytes / median / 1024 / 1024:.1f} MB/s")
+        self.results.append(result)
+
+    def dump(self, storage, settings):
+        url, options = self.dump_location(storage)
+        options = {**options, "threads": settings["threads"],
+                   "bytesPerChunk": settings["bytesPerChunk"],
+                   "compression": settings["compression"], "showProgress": False}
+        shell.set_session(self.source)
+        seconds = measure(lambda: util.dump_schemas([self.dataset["schema"]], url, options))
+        return url, seconds
+
+    def load(self, storage, url, settings):
+        options = {"threads": settings["threads"], "showProgress": False,
+                   "resetProgress": True, "progressFile": "",
+                   **(s3_options(self.args) if storage == "s3" else {})}
+        if settings["maxBytesPerTransaction"] is not None:
+            options["maxBytesPerTransaction"] = settings["maxBytesPerTransaction"]
+        drop_target_schema(self.args, self.dataset)
+        target = shell.open_session(uri(self.args, self.args.target_port))
+        shell.set_session(target)
+        try:
+            return measure(lambda: util.load_dump(url, options))
+        finally:
+            target.close()
+
+    def copy(self, settings):
+        # data is not compressed by the copy utilities
+        options = {"threads": settings["threads"], "bytesPerChunk": settings["bytesPerChunk"],
+                   "showProgress": False}
+        if settings["maxBytesPerTransaction"] is not None:
+            options["maxBytesPerTransaction"] = settings["maxBytesPerTransaction"]
+        drop_target_schema(self.args, self.dataset)
+        shell.set_session(self.source)
+        return measure(lambda: util.copy_schemas([self.dataset["schema"]],
+                                                 uri(self.args, self.args.target_port),
+                                                 options))
+
+    def run(self):
+        args = self.args
+        copied = []
+        for threads, chunk, compression, max_trx in itertools.product(
+                args.threads, args.bytes_per_chunk, args.compression,
+                args.max_bytes_per_transaction):
+            settings = {"threads": threads, "bytesPerChunk": chunk,
+                        "compression": compression, "maxBytesPerTransaction": max_trx}
+            for storage in args.storage:
+                if storage == "memory":
+                    # copy utilities transfer the data using the in-memory storage
+                    copy_settings = {**settings, "compression": None}
+                    if "copy" in args.operations and copy_settings not in copied:
+                        copied.append(copy_settings)
+                        self.record("copy", storage, copy_settings,
+                                    [self.copy(copy_settings) for _ in range(args.repeat)])
+                    continue
+                if "dump" not in args.operations and "load" not in args.operations:
+                    continue
+                dump_seconds = []
+                load_seconds = []
+                for _ in range(args.repeat):
+                    url, seconds = self.dump(storage, settings)
+                    dump_seconds.append(seconds)
+                    if "load" in args.operations:
+                        load_seconds.append(self.load(storage, url, settings))
+                    self.remove_dump(storage, url)
+                if "dump" in args.operations:
+                    self.record("dump", storage, settings, dump_seconds)
+                if load_seconds:
+                    self.record("load", storage, settings, load_seconds)
+
+def result_key(r):
+    return (r["operation"], r["storage"], r["threads"], r["bytesPerChunk"],
+            r["compression"], r["maxBytesPerTransaction"])
+
+def compare(results, path):
+    with open(path, encoding="utf-8") as f:
+        previous = {result_key(r): r for r in json.load(f)["results"]}
+    for r in results:
+        p = previous.get(result_key(r))
+        if p:
+            change = (r["bytesPerSecond"] - p["bytesPerSecond"]) / p["bytesPerSecond"] * 100
+            log(f"{' '.join(str(k) for k in result_key(r))}: {change:+.1f}%")
+
+def main():
+    args = parse_args()
+    os.makedirs(args.work_dir, exist_ok=True)
+    dataset = generate_data(args)
+    ports = [args.source_port, args.target_port]
+    for port in ports:
+        deploy_sandbox(args, port)
+    try:
+        source = populate_source(args, dataset)
+        server_version = source.run_sql("SELECT @@version").fetch_one()[0]
+        benchmark = Benchmark(args, dataset, source)
+        benchmark.run()
+        source.close()
+    finally:
+        if not args.keep_sandboxes:
+            for port in ports:
+                delete_sandbox(args, port)
+    report = {
+        "formatVersion": FORMAT_VERSION,
+        "shellVersion": shell.version,
+        "serverVersion": server_version,
+        "dataset": {"shape": dataset["shape"], "schema": dataset["schema"],
+                    "seed": dataset["seed"], "tables": len(dataset["tables"]),
+                    "rows": sum(t["rows"] for t in dataset["tables"]),
+                    "bytes": sum(t["bytes"] for t in dataset["tables"])},
+        "results": benchmark.results,
+    }
+    text = json.dumps(report, indent=2, sort_keys=True)
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as f:
+            f.write(text + "\n")
+    else:
+        print(text)
+    if args.compare:
+        compare(benchmark.results, args.compare)
+
+main()
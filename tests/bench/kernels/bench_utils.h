@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef TESTS_BENCH_KERNELS_BENCH_UTILS_H_
+#define TESTS_BENCH_KERNELS_BENCH_UTILS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+namespace bench {
+
+/**
+ * Write-only file which discards all the data, used to measure the cost of
+ * producing the output without the cost of storing it.
+ */
+class Null_file final : public mysqlshdk::storage::IFile {
+ public:
+  void open(mysqlshdk::storage::Mode) override { m_open = true; }
+  bool is_open() const override { return m_open; }
+  int error() const override { return 0; }
+  void close() override { m_open = false; }
+
+  size_t file_size() const override { return m_size; }
+  mysqlshdk::Masked_string full_path() const override { return {"null"}; }
+  std::string filename() const override { return "null"; }
+  bool exists() const override { return true; }
+
+  std::unique_ptr<mysqlshdk::storage::IDirectory> parent() const override {
+    throw std::logic_error("Null_file::parent() - not implemented");
+  }
+
+  off64_t seek(off64_t) override { return m_size; }
+  off64_t tell() const override { return m_size; }
+
+  ssize_t read(void *, size_t) override { return -1; }
+
+  ssize_t write(const void *, size_t length) override {
+    m_size += length;
+    return length;
+  }
+
+  bool flush() override { return true; }
+  bool is_local() const override { return true; }
+
+  void rename(const std::string &) override {}
+  void remove() override {}
+
+ private:
+  bool m_open = false;
+  size_t m_size = 0;
+};
+
+/**
+ * Generates a deterministic text consisting of words and punctuation, which
+ * compresses similarly to the table data.
+ */
+inline std::string random_text(std::size_t length, uint32_t seed = 42) {
+  static constexpr const char *k_words[] = {
+      "lorem",   "ipsum", "dolor",   "sit",          "amet",    "consectetur",
+      "elit",    "sed",   "do",      "eiusmod",      "tempor",  "incididunt",
+      "ut",      "labore", "et",     "dolore",       "magna",   "aliqua",
+      "quis",    "nostrud", "exercitation", "ullamco", "laboris", "nisi"};
+  static constexpr std::size_t k_count = sizeof(k_words) / sizeof(k_words[0]);
+
+  std::mt19937 generator{seed};
+  std::uniform_int_distribution<std::size_t> distribution{0, k_count - 1};
+  std::string s;
+  s.reserve(length + 16);
+
+  while (s.length() < length) {
+    s += k_words[distribution(generator)];
+    s += ' ';
+  }
+
+  s.resize(length);
+  return s;
+}
+
+/**
+ * Generates deterministic binary data.
+ */
+inline std::string random_bytes(std::size_t length, uint32_t seed = 42) {
+  std::mt19937 generator{seed};
+  std::uniform_int_distribution<int> distribution{0, 255};
+  std::string s;
+  s.resize(length);
+
+  for (auto &c : s) {
+    c = static_cast<char>(distribution(generator));
+  }
+
+  return s;
+}
+
+}  // namespace bench
+}  // namespace mysqlsh
+
+#endif  // TESTS_BENCH_KERNELS_BENCH_UTILS_H_
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+#include "tests/bench/kernels/bench_utils.h"
+
+namespace mysqlsh {
+namespace bench {
+namespace {
+
+using mysqlshdk::storage::Compression;
+using mysqlshdk::storage::IFile;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+constexpr std::size_t k_data_size = 16 * 1024 * 1024;
+
+// size of the writes issued by the dump writer
+constexpr std::size_t k_io_size = 64 * 1024;
+
+enum class Data { TEXT, BINARY };
+
+std::string generate_data(Data data) {
+  return Data::TEXT == data ? random_text(k_data_size)
+                            : random_bytes(k_data_size);
+}
+
+std::unique_ptr<IFile> make_file(Compression compression,
+                                 const std::string &content = {}) {
+  auto file = std::make_unique<Memory_file>("");
+
+  if (!content.empty()) {
+    file->set_content(content);
+  }
+
+  return mysqlshdk::storage::make_file(std::move(file), compression);
+}
+
+void write_file(IFile *file, const std::string &data) {
+  file->open(Mode::WRITE);
+
+  for (std::size_t offset = 0; offset < data.length(); offset += k_io_size) {
+    file->write(data.data() + offset,
+                std::min(k_io_size, data.length() - offset));
+  }
+
+  file->close();
+}
+
+std::size_t read_file(IFile *file, std::vector<char> *buffer) {
+  std::size_t total = 0;
+  ssize_t bytes;
+
+  file->open(Mode::READ);
+
+  while ((bytes = file->read(buffer->data(), buffer->size())) > 0) {
+    total += bytes;
+  }
+
+  file->close();
+
+  return total;
+}
+
+const std::string &compressed_content(IFile *file) {
+  return static_cast<Memory_file *>(
+             static_cast<mysqlshdk::storage::Compressed_file *>(file)->file())
+      ->content();
+}
+
+// each iteration uses a new file, just like each chunk of a dump is written to
+// a separate file
+void compress(benchmark::State &state, Compression compression, Data type) {
+  const auto data = generate_data(type);
+  std::size_t compressed_length = 0;
+
+  for (auto _ : state) {
+    const auto file = make_file(compression);
+    write_file(file.get(), data);
+    compressed_length = compressed_content(file.get()).length();
+  }
+
+  state.SetBytesProcessed(state.iterations() * data.length());
+  state.counters["ratio"] =
+      static_cast<double>(data.length()) / compressed_length;
+}
+
+void decompress(benchmark::State &state, Compression compression, Data type) {
+  const auto data = generate_data(type);
+  std::string compressed;
+  std::vector<char> buffer(k_io_size);
+
+  {
+    const auto file = make_file(compression);
+    write_file(file.get(), data);
+    compressed = compressed_content(file.get());
+  }
+
+  for (auto _ : state) {
+    const auto file = make_file(compression, compressed);
+
+    if (read_file(file.get(), &buffer) != data.length()) {
+      state.SkipWithError("Decompressed data has wrong length");
+      break;
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * data.length());
+}
+
+#define COMPRESSION_BENCHMARK(function, compression, data)            \
+  BENCHMARK_CAPTURE(function, compression##_##data,                   \
+                    Compression::compression, Data::data)             \
+      ->Unit(benchmark::kMillisecond)
+
+COMPRESSION_BENCHMARK(compress, ZSTD, TEXT);
+COMPRESSION_BENCHMARK(compress, ZSTD, BINARY);
+COMPRESSION_BENCHMARK(compress, GZIP, TEXT);
+COMPRESSION_BENCHMARK(compress, GZIP, BINARY);
+COMPRESSION_BENCHMARK(compress, LZ4, TEXT);
+COMPRESSION_BENCHMARK(compress, LZ4, BINARY);
+
+COMPRESSION_BENCHMARK(decompress, ZSTD, TEXT);
+COMPRESSION_BENCHMARK(decompress, ZSTD, BINARY);
+COMPRESSION_BENCHMARK(decompress, GZIP, TEXT);
+COMPRESSION_BENCHMARK(decompress, GZIP, BINARY);
+COMPRESSION_BENCHMARK(decompress, LZ4, TEXT);
+COMPRESSION_BENCHMARK(decompress, LZ4, BINARY);
+
+#undef COMPRESSION_BENCHMARK
+
+}  // namespace
+}  // namespace bench
+}  // namespace mysqlsh
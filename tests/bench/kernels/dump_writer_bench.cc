@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "modules/util/dump/dialect_dump_writer.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+#include "tests/bench/kernels/bench_utils.h"
+
+namespace mysqlsh {
+namespace bench {
+namespace {
+
+using dump::Dump_writer;
+using mysqlshdk::db::Column;
+using mysqlshdk::db::Type;
+
+constexpr std::size_t k_rows = 10000;
+
+Column column(const std::string &name, Type type) {
+  return Column("def", "schema", "table", "table", name, name, 0, 0, type, 63,
+                false, false, Type::Bytes == type);
+}
+
+/**
+ * Encodes the data the same way server's TO_BASE64() does, with a newline
+ * after every 76 characters.
+ */
+std::string to_base64(const std::string &data) {
+  std::string encoded;
+  shcore::encode_base64(reinterpret_cast<const unsigned char *>(data.data()),
+                        static_cast<int>(data.length()), &encoded);
+
+  std::string result;
+  result.reserve(encoded.length() + encoded.length() / 76 + 1);
+
+  for (std::size_t offset = 0; offset < encoded.length(); offset += 76) {
+    if (offset) result += '\n';
+    result += encoded.substr(offset, 76);
+  }
+
+  return result;
+}
+
+class Rows final {
+ public:
+  explicit Rows(std::size_t length)
+      : m_id("1234567"),
+        m_text(random_text(length)),
+        m_base64(to_base64(random_bytes(length))),
+        m_hex(shcore::string_to_hex(random_bytes(length), false)) {
+    // characters which need to be escaped in every dialect
+    for (std::size_t i = 0; i < m_text.length(); i += 64) {
+      m_text[i] = "\t\n\"\\,"[(i / 64) % 5];
+    }
+
+    m_data = {m_id.c_str(), m_text.c_str(), nullptr, m_base64.c_str(),
+              m_hex.c_str()};
+    m_lengths = {m_id.length(), m_text.length(), 0, m_base64.length(),
+                 m_hex.length()};
+  }
+
+  const std::vector<Column> &metadata() const { return m_metadata; }
+
+  const std::vector<Dump_writer::Encoding_type> &encoding() const {
+    return m_encoding;
+  }
+
+  Dump_writer::Raw_row row() const { return {m_data.data(), m_lengths.data()}; }
+
+  std::size_t length() const {
+    std::size_t length = 0;
+
+    for (const auto l : m_lengths) {
+      length += l;
+    }
+
+    return length;
+  }
+
+ private:
+  std::vector<Column> m_metadata{
+      column("id", Type::Integer), column("text", Type::String),
+      column("null", Type::String), column("base64", Type::Bytes),
+      column("hex", Type::Bytes)};
+  std::vector<Dump_writer::Encoding_type> m_encoding{
+      Dump_writer::Encoding_type::NONE, Dump_writer::Encoding_type::NONE,
+      Dump_writer::Encoding_type::NONE, Dump_writer::Encoding_type::BASE64,
+      Dump_writer::Encoding_type::HEX};
+  std::string m_id;
+  std::string m_text;
+  std::string m_base64;
+  std::string m_hex;
+  std::vector<const char *> m_data;
+  std::vector<unsigned long> m_lengths;
+};
+
+template <typename Writer>
+void store_row(benchmark::State &state) {
+  const Rows rows{static_cast<std::size_t>(state.range(0))};
+  const auto row = rows.row();
+  Null_file output;
+  Writer writer;
+
+  writer.set_output_file(&output);
+  writer.open();
+  writer.write_preamble(rows.metadata(), rows.encoding());
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < k_rows; ++i) {
+      benchmark::DoNotOptimize(writer.write_row(row));
+    }
+  }
+
+  writer.write_postamble();
+  writer.close();
+
+  state.SetItemsProcessed(state.iterations() * k_rows);
+  state.SetBytesProcessed(state.iterations() * k_rows * rows.length());
+}
+
+void store_row_args(benchmark::internal::Benchmark *b) {
+  b->ArgName("length")->Arg(16)->Arg(256)->Arg(4096);
+  b->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK_TEMPLATE(store_row, dump::Default_dump_writer)->Apply(store_row_args);
+BENCHMARK_TEMPLATE(store_row, dump::Json_dump_writer)->Apply(store_row_args);
+BENCHMARK_TEMPLATE(store_row, dump::Csv_dump_writer)->Apply(store_row_args);
+BENCHMARK_TEMPLATE(store_row, dump::Tsv_dump_writer)->Apply(store_row_args);
+BENCHMARK_TEMPLATE(store_row, dump::Csv_unix_dump_writer)
+    ->Apply(store_row_args);
+
+/**
+ * Single pre-encoded column, measures the Dump_writer::Buffer handling of
+ * base64 (newlines are stripped) and hex (copied as is) data.
+ */
+void store_encoded(benchmark::State &state,
+                   Dump_writer::Encoding_type encoding) {
+  const auto length = static_cast<std::size_t>(state.range(0));
+  const auto data = Dump_writer::Encoding_type::BASE64 == encoding
+                        ? to_base64(random_bytes(length))
+                        : shcore::string_to_hex(random_bytes(length), false);
+  const char *fields[] = {data.c_str()};
+  const unsigned long lengths[] = {data.length()};
+  Null_file output;
+  dump::Default_dump_writer writer;
+
+  writer.set_output_file(&output);
+  writer.open();
+  writer.write_preamble({column("data", Type::Bytes)}, {encoding});
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < k_rows; ++i) {
+      benchmark::DoNotOptimize(writer.write_row({fields, lengths}));
+    }
+  }
+
+  writer.write_postamble();
+  writer.close();
+
+  state.SetBytesProcessed(state.iterations() * k_rows * data.length());
+}
+
+BENCHMARK_CAPTURE(store_encoded, base64, Dump_writer::Encoding_type::BASE64)
+    ->Apply(store_row_args);
+BENCHMARK_CAPTURE(store_encoded, hex, Dump_writer::Encoding_type::HEX)
+    ->Apply(store_row_args);
+
+}  // namespace
+}  // namespace bench
+}  // namespace mysqlsh
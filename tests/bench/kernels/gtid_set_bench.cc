@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "mysqlshdk/libs/mysql/gtid_utils.h"
+
+namespace mysqlsh {
+namespace bench {
+namespace {
+
+using mysqlshdk::mysql::Gtid_range;
+using mysqlshdk::mysql::Gtid_set;
+
+/**
+ * Generates a normalized GTID set with the given number of UUIDs, each one
+ * having the given number of ranges (i.e. a server with gaps in the executed
+ * transactions).
+ */
+std::string generate_gtid_set(int64_t uuids, int64_t ranges) {
+  std::string gtid_set;
+
+  for (int64_t u = 0; u < uuids; ++u) {
+    char uuid[37];
+    snprintf(uuid, sizeof(uuid), "8b8dc2ba-8803-11eb-af3d-%012llx",
+             static_cast<unsigned long long>(u));
+
+    if (!gtid_set.empty()) gtid_set += ",\n";
+    gtid_set += uuid;
+
+    for (int64_t r = 0; r < ranges; ++r) {
+      gtid_set += ':';
+      gtid_set += std::to_string(r * 100 + 1);
+      gtid_set += '-';
+      gtid_set += std::to_string(r * 100 + 90);
+    }
+  }
+
+  return gtid_set;
+}
+
+void gtid_set_args(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"uuids", "ranges"})
+      ->Args({1, 1})
+      ->Args({1, 1000})
+      ->Args({16, 100})
+      ->Args({128, 10});
+}
+
+void count(benchmark::State &state) {
+  const auto gtid_set = Gtid_set::from_normalized_string(
+      generate_gtid_set(state.range(0), state.range(1)));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(gtid_set.count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) *
+                          state.range(1));
+}
+
+BENCHMARK(count)->Apply(gtid_set_args);
+
+void enumerate_ranges(benchmark::State &state) {
+  const auto gtid_set = Gtid_set::from_normalized_string(
+      generate_gtid_set(state.range(0), state.range(1)));
+  uint64_t total = 0;
+
+  for (auto _ : state) {
+    gtid_set.enumerate_ranges([&total](Gtid_range r) { total += r.end; });
+    benchmark::DoNotOptimize(total);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) *
+                          state.range(1));
+}
+
+BENCHMARK(enumerate_ranges)->Apply(gtid_set_args);
+
+void get_gtids_from(benchmark::State &state) {
+  const auto gtid_set = Gtid_set::from_normalized_string(
+      generate_gtid_set(state.range(0), state.range(1)));
+  // last UUID, the whole set needs to be searched
+  char uuid[37];
+  snprintf(uuid, sizeof(uuid), "8b8dc2ba-8803-11eb-af3d-%012llx",
+           static_cast<unsigned long long>(state.range(0) - 1));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(gtid_set.get_gtids_from(uuid));
+  }
+}
+
+BENCHMARK(get_gtids_from)->Apply(gtid_set_args);
+
+void add(benchmark::State &state) {
+  const auto gtid_set = Gtid_set::from_normalized_string(
+      generate_gtid_set(state.range(0), state.range(1)));
+  const Gtid_range range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 1, 1000};
+
+  for (auto _ : state) {
+    auto result = gtid_set;
+    result.add(range);
+    result.add(gtid_set);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK(add)->Apply(gtid_set_args);
+
+}  // namespace
+}  // namespace bench
+}  // namespace mysqlsh
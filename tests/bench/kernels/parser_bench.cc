@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/parser/mysql_parser_utils.h"
+#include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
+
+namespace mysqlsh {
+namespace bench {
+namespace {
+
+using mysqlshdk::parser::internal::ParserErrorListener;
+
+/**
+ * DDL statements similar to the ones produced by the dumper and checked by the
+ * upgrade checker.
+ */
+std::vector<std::string> ddl_corpus() {
+  std::vector<std::string> corpus;
+
+  for (int i = 0; i < 50; ++i) {
+    const auto n = std::to_string(i);
+
+    corpus.emplace_back(
+        "CREATE TABLE IF NOT EXISTS `t" + n +
+        "` (\n"
+        "  `id` int unsigned NOT NULL AUTO_INCREMENT,\n"
+        "  `name` varchar(255) CHARACTER SET utf8mb4 COLLATE "
+        "utf8mb4_0900_ai_ci DEFAULT NULL COMMENT 'name',\n"
+        "  `price` decimal(10,2) NOT NULL DEFAULT '0.00',\n"
+        "  `created` timestamp NULL DEFAULT CURRENT_TIMESTAMP ON UPDATE "
+        "CURRENT_TIMESTAMP,\n"
+        "  `doc` json DEFAULT NULL,\n"
+        "  `v` int GENERATED ALWAYS AS ((`id` * 2)) VIRTUAL,\n"
+        "  PRIMARY KEY (`id`),\n"
+        "  UNIQUE KEY `u_name` (`name`),\n"
+        "  KEY `k_created` (`created`),\n"
+        "  CONSTRAINT `fk_" +
+        n +
+        "` FOREIGN KEY (`id`) REFERENCES `parent` (`id`) ON DELETE CASCADE,\n"
+        "  CONSTRAINT `c_" +
+        n +
+        "` CHECK ((`price` >= 0))\n"
+        ") ENGINE=InnoDB AUTO_INCREMENT=1000 DEFAULT CHARSET=utf8mb4 "
+        "COLLATE=utf8mb4_0900_ai_ci COMMENT='table " +
+        n +
+        "'\n"
+        "/*!50100 PARTITION BY RANGE (`id`)\n"
+        "(PARTITION p0 VALUES LESS THAN (1000) ENGINE = InnoDB,\n"
+        " PARTITION p1 VALUES LESS THAN MAXVALUE ENGINE = InnoDB) */;\n");
+
+    corpus.emplace_back(
+        "CREATE ALGORITHM=UNDEFINED DEFINER=`root`@`localhost` SQL SECURITY "
+        "DEFINER VIEW `v" +
+        n +
+        "` AS select `t`.`id` AS `id`,count(0) AS `c` from (`t" + n +
+        "` `t` left join `parent` `p` on((`p`.`id` = `t`.`id`))) where "
+        "(`t`.`price` > 10) group by `t`.`id` having (count(0) > 1);\n");
+
+    corpus.emplace_back("ALTER TABLE `t" + n +
+                        "` ADD INDEX `k_price` (`price`), ALGORITHM=INPLACE, "
+                        "LOCK=NONE;\n");
+
+    corpus.emplace_back(
+        "GRANT SELECT, INSERT, UPDATE ON `db`.`t" + n +
+        "` TO `user`@`%` WITH GRANT OPTION;\n");
+  }
+
+  return corpus;
+}
+
+std::string ddl_script(const std::vector<std::string> &corpus) {
+  std::string script;
+
+  for (const auto &statement : corpus) {
+    script += statement;
+  }
+
+  return script;
+}
+
+/**
+ * Parses all statements of a script using a single parser, either using the
+ * full LL prediction mode only, or using the two-stage SLL/LL strategy.
+ */
+void parse_script(const std::string &script, bool two_stage) {
+  ParserErrorListener error_listener;
+  antlr4::ANTLRInputStream input;
+  parsers::MySQLLexer lexer(&input);
+  antlr4::CommonTokenStream tokens(&lexer);
+  parsers::MySQLParser parser(&tokens);
+
+  lexer.addErrorListener(&error_listener);
+  mysqlshdk::parser::prepare_lexer_parser(&lexer, &parser, {}, true, false);
+
+  if (!two_stage) {
+    parser.removeErrorListeners();
+    parser.addErrorListener(&error_listener);
+    parser.getInterpreter<antlr4::atn::ParserATNSimulator>()->setPredictionMode(
+        antlr4::atn::PredictionMode::LL);
+  }
+
+  std::stringstream stream(script);
+  mysqlshdk::utils::iterate_sql_stream(
+      &stream, 4098,
+      [&](std::string_view stmt, std::string_view, size_t, size_t) {
+        parser.reset();
+        lexer.reset();
+        input.load(std::string(stmt));
+        lexer.setInputStream(&input);
+        tokens.setTokenSource(&lexer);
+        parser.setTokenStream(&tokens);
+
+        if (two_stage) {
+          mysqlshdk::parser::internal::parse_query(&parser, &error_listener);
+        } else {
+          parser.query();
+        }
+
+        return true;
+      },
+      [](std::string_view) {}, true, false);
+}
+
+void parse_ddl(benchmark::State &state) {
+  const auto corpus = ddl_corpus();
+  const auto script = ddl_script(corpus);
+  const auto two_stage = 0 != state.range(0);
+
+  // DFA cache is shared by all parsers of a process, warm it up, so that only
+  // the prediction mode is measured
+  parse_script(script, two_stage);
+
+  for (auto _ : state) {
+    parse_script(script, two_stage);
+  }
+
+  state.SetBytesProcessed(state.iterations() * script.length());
+  state.SetItemsProcessed(state.iterations() * corpus.size());
+}
+
+BENCHMARK(parse_ddl)
+    ->ArgName("two_stage")
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+
+void check_sql_syntax(benchmark::State &state) {
+  const auto corpus = ddl_corpus();
+
+  mysqlshdk::parser::check_sql_syntax(corpus.front());
+
+  // each statement is checked separately, as done by the upgrade checker,
+  // the lexer and parser are reused by all the calls
+  for (auto _ : state) {
+    for (const auto &statement : corpus) {
+      mysqlshdk::parser::check_sql_syntax(statement);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * corpus.size());
+}
+
+BENCHMARK(check_sql_syntax)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace bench
+}  // namespace mysqlsh
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+
+namespace mysqlsh {
+namespace bench {
+namespace {
+
+using shcore::Synchronized_queue;
+
+constexpr int k_items = 1000000;
+
+// Producers push the items, consumers pop them until they receive the
+// shutdown marker, as done by the dump and load workers. Contention on the
+// queue is the baseline any replacement of Synchronized_queue should be
+// compared against.
+void produce_consume(benchmark::State &state) {
+  const auto threads = static_cast<int>(state.range(0));
+  const auto items_per_producer = k_items / threads;
+
+  for (auto _ : state) {
+    Synchronized_queue<std::unique_ptr<uint64_t>> queue;
+    std::atomic<uint64_t> sum{0};
+    std::vector<std::thread> consumers;
+    std::vector<std::thread> producers;
+
+    for (int i = 0; i < threads; ++i) {
+      consumers.emplace_back([&queue, &sum]() {
+        while (const auto item = queue.pop()) {
+          sum += *item;
+        }
+      });
+    }
+
+    for (int i = 0; i < threads; ++i) {
+      producers.emplace_back([&queue, items_per_producer]() {
+        for (int j = 1; j <= items_per_producer; ++j) {
+          queue.push(std::make_unique<uint64_t>(j));
+        }
+      });
+    }
+
+    for (auto &t : producers) {
+      t.join();
+    }
+
+    queue.shutdown(threads);
+
+    for (auto &t : consumers) {
+      t.join();
+    }
+
+    benchmark::DoNotOptimize(sum.load());
+  }
+
+  state.SetItemsProcessed(state.iterations() * items_per_producer * threads);
+}
+
+BENCHMARK(produce_consume)
+    ->ArgName("threads")
+    ->Arg(8)
+    ->Arg(32)
+    ->Arg(128)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace bench
+}  // namespace mysqlsh
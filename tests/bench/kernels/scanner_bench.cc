@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+#include "modules/util/import_table/dialect.h"
+#include "modules/util/import_table/scanner.h"
+
+#include "tests/bench/kernels/bench_utils.h"
+
+namespace mysqlsh {
+namespace bench {
+namespace {
+
+using import_table::Dialect;
+using import_table::Scanner;
+
+constexpr std::size_t k_data_size = 16 * 1024 * 1024;
+
+/**
+ * Generates rows with a mix of numeric and text fields, text fields are
+ * enclosed (if dialect allows this) and contain characters which need to be
+ * escaped.
+ */
+std::string generate_rows(const Dialect &dialect, std::size_t text_length) {
+  const auto text = random_text(text_length);
+  const auto &enclosed = dialect.fields_enclosed_by;
+  const auto &escaped = dialect.fields_escaped_by;
+  std::string row;
+
+  row += "1234567";
+  row += dialect.fields_terminated_by;
+  row += enclosed;
+  row += text.substr(0, text.length() / 2);
+
+  // escaped field terminator and line terminator
+  row += escaped;
+  row += dialect.fields_terminated_by;
+  row += escaped;
+  row += dialect.lines_terminated_by;
+
+  if (!enclosed.empty()) {
+    // doubled enclosing character
+    row += enclosed;
+    row += enclosed;
+  }
+
+  row += text.substr(text.length() / 2);
+  row += enclosed;
+  row += dialect.fields_terminated_by;
+  row += "3.1415926";
+  row += dialect.lines_terminated_by;
+
+  std::string data;
+  data.reserve(k_data_size + row.length());
+
+  while (data.length() < k_data_size) {
+    data += row;
+  }
+
+  return data;
+}
+
+void scan(benchmark::State &state, const Dialect &dialect) {
+  const auto text_length = static_cast<std::size_t>(state.range(0));
+  const auto block_size = static_cast<std::size_t>(state.range(1));
+  const auto data = generate_rows(dialect, text_length);
+
+  for (auto _ : state) {
+    Scanner scanner{dialect, 0};
+
+    for (std::size_t offset = 0; offset < data.length(); offset += block_size) {
+      benchmark::DoNotOptimize(scanner.scan(
+          data.data() + offset, std::min(block_size, data.length() - offset)));
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * data.length());
+}
+
+void scan_args(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"text", "block"});
+
+  for (const auto text_length : {16, 256, 4096}) {
+    for (const auto block_size : {4 * 1024, 1024 * 1024}) {
+      b->Args({text_length, block_size});
+    }
+  }
+
+  b->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK_CAPTURE(scan, default, Dialect::default_())->Apply(scan_args);
+BENCHMARK_CAPTURE(scan, csv, Dialect::csv())->Apply(scan_args);
+BENCHMARK_CAPTURE(scan, csv_unix, Dialect::csv_unix())->Apply(scan_args);
+
+}  // namespace
+}  // namespace bench
+}  // namespace mysqlsh
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+#include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
+
+#include "tests/bench/kernels/bench_utils.h"
+
+namespace mysqlsh {
+namespace bench {
+namespace {
+
+constexpr std::size_t k_script_size = 16 * 1024 * 1024;
+
+std::string generate_script(std::size_t text_length) {
+  const auto text = random_text(text_length);
+  std::string statements;
+
+  // extended insert with escapes and comments, as produced by mysqldump
+  statements += "/*!40101 SET NAMES utf8mb4 */;\n";
+  statements += "-- data for table `t`\n";
+  statements += "INSERT INTO `t` VALUES (1,'" + text + "\\'s',NULL),(2,\"" +
+                text + "\",'it''s'),(3,'/* not a comment */','" + text +
+                "');\n";
+  statements += "SELECT * FROM `t` WHERE `c` = '" + text + "'; # comment\n";
+
+  std::string script;
+  script.reserve(k_script_size + statements.length());
+
+  while (script.length() < k_script_size) {
+    script += statements;
+  }
+
+  return script;
+}
+
+void split(benchmark::State &state) {
+  const auto script = generate_script(static_cast<std::size_t>(state.range(0)));
+  const auto chunk_size = static_cast<std::size_t>(state.range(1));
+  std::size_t statements = 0;
+
+  for (auto _ : state) {
+    std::istringstream stream{script};
+
+    mysqlshdk::utils::iterate_sql_stream(
+        &stream, chunk_size,
+        [&statements](std::string_view, std::string_view, size_t, size_t) {
+          ++statements;
+          return true;
+        },
+        [&state](std::string_view error) {
+          state.SkipWithError(std::string{error}.c_str());
+        });
+  }
+
+  state.SetBytesProcessed(state.iterations() * script.length());
+  state.SetItemsProcessed(statements);
+}
+
+void split_args(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"text", "chunk"});
+
+  for (const auto text_length : {16, 256, 4096}) {
+    // 64k is the chunk size used when running SQL scripts
+    for (const auto chunk_size : {16 * 1024, 64 * 1024}) {
+      b->Args({text_length, chunk_size});
+    }
+  }
+
+  b->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(split)->Apply(split_args);
+
+}  // namespace
+}  // namespace bench
+}  // namespace mysqlsh
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/utils/thread_affinity.h"
+
+#include "tests/bench/kernels/bench_utils.h"
+
+namespace mysqlsh {
+namespace bench {
+namespace {
+
+using mysqlshdk::storage::Compression;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::utils::Thread_affinity;
+
+constexpr std::size_t k_data_size = 8 * 1024 * 1024;
+
+// size of the writes issued by the dump writer
+constexpr std::size_t k_io_size = 64 * 1024;
+
+// Each worker copies the data to its own buffer and compresses it, just like
+// dump workers do with the rows they fetch. Buffers are allocated after the
+// worker is pinned, so with affinity enabled they are node-local, while
+// without it the worker can be migrated to another socket after the buffer is
+// allocated. On multi-socket hosts the difference in cross-socket traffic
+// shows up as a difference in throughput, the "nodes" counter reports the
+// number of NUMA nodes which were used.
+void compress_in_workers(benchmark::State &state, Thread_affinity affinity) {
+  const auto threads = static_cast<std::size_t>(state.range(0));
+  const auto data = random_text(k_data_size);
+
+  for (auto _ : state) {
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers.emplace_back([&data, affinity, i]() {
+        mysqlshdk::utils::pin_worker_thread(affinity, i);
+
+        const std::string buffer = data;
+        const auto file = mysqlshdk::storage::make_file(
+            std::make_unique<Null_file>(), Compression::ZSTD);
+
+        file->open(Mode::WRITE);
+
+        for (std::size_t offset = 0; offset < buffer.length();
+             offset += k_io_size) {
+          file->write(buffer.data() + offset,
+                      std::min(k_io_size, buffer.length() - offset));
+        }
+
+        file->close();
+      });
+    }
+
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * threads * data.length());
+  state.counters["nodes"] =
+      Thread_affinity::NONE == affinity
+          ? 0
+          : static_cast<double>(std::min(
+                threads, mysqlshdk::utils::cpu_topology().size()));
+}
+
+void worker_threads(benchmark::internal::Benchmark *b) {
+  const auto cpus = std::max(1u, std::thread::hardware_concurrency());
+
+  b->Arg(std::max(1u, cpus / 2));
+  b->Arg(cpus);
+}
+
+#define AFFINITY_BENCHMARK(affinity)               \
+  BENCHMARK_CAPTURE(compress_in_workers, affinity, \
+                    Thread_affinity::affinity)     \
+      ->Apply(worker_threads)                      \
+      ->Unit(benchmark::kMillisecond)              \
+      ->UseRealTime()
+
+AFFINITY_BENCHMARK(NONE);
+AFFINITY_BENCHMARK(NODE);
+AFFINITY_BENCHMARK(CORE);
+
+#undef AFFINITY_BENCHMARK
+
+}  // namespace
+}  // namespace bench
+}  // namespace mysqlsh
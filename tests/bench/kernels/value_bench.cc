@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "modules/mod_utils.h"
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+
+#include "tests/bench/kernels/bench_utils.h"
+
+namespace mysqlsh {
+namespace bench {
+namespace {
+
+/**
+ * Options similar to the ones passed to util.dumpInstance().
+ */
+shcore::Dictionary_t generate_options() {
+  auto options = shcore::make_dict();
+
+  options->set("threads", shcore::Value(8));
+  options->set("maxRate", shcore::Value("50M"));
+  options->set("showProgress", shcore::Value::False());
+  options->set("compression", shcore::Value("zstd;level=1"));
+  options->set("bytesPerChunk", shcore::Value("128M"));
+  options->set("consistent", shcore::Value::True());
+  options->set("dryRun", shcore::Value::False());
+  options->set("excludeSchemas",
+               shcore::Value(shcore::make_array("mysql_innodb_cluster_metadata",
+                                                "performance_schema")));
+  options->set("osBucketName", shcore::Value("bucket"));
+  options->set("ocimds", shcore::Value::True());
+
+  return options;
+}
+
+void unpack_options(benchmark::State &state) {
+  const auto options = generate_options();
+
+  for (auto _ : state) {
+    int64_t threads = 0;
+    std::string max_rate;
+    bool show_progress = true;
+    std::string compression;
+    std::string bytes_per_chunk;
+    bool consistent = false;
+    bool dry_run = true;
+    std::vector<std::string> exclude_schemas;
+    std::string bucket;
+    bool ocimds = false;
+    std::string missing;
+
+    shcore::Option_unpacker unpacker{options};
+    unpacker.optional("threads", &threads)
+        .optional("maxRate", &max_rate)
+        .optional("showProgress", &show_progress)
+        .optional("compression", &compression)
+        .optional("bytesPerChunk", &bytes_per_chunk)
+        .optional("consistent", &consistent)
+        .optional("dryRun", &dry_run)
+        .optional("excludeSchemas", &exclude_schemas)
+        .optional_ci("osBucketName", &bucket)
+        .optional("ocimds", &ocimds)
+        .optional("osNamespace", &missing)
+        .optional("ociConfigFile", &missing);
+    unpacker.end();
+
+    benchmark::DoNotOptimize(threads);
+  }
+}
+
+BENCHMARK(unpack_options);
+
+void lookup_options(benchmark::State &state) {
+  const auto options = generate_options();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(options->get_int("threads"));
+    benchmark::DoNotOptimize(options->get_string("compression"));
+    benchmark::DoNotOptimize(options->has_key("excludeSchemas"));
+    benchmark::DoNotOptimize(options->has_key("ociParManifestExpireTime"));
+    benchmark::DoNotOptimize(options->get_bool("ocimds"));
+  }
+}
+
+BENCHMARK(lookup_options);
+
+void convert_rows(benchmark::State &state) {
+  using mysqlshdk::db::Type;
+
+  const auto text = random_text(state.range(0));
+  const auto bytes = random_bytes(state.range(0));
+  const mysqlshdk::db::Mutable_row row{
+      {Type::Integer, Type::UInteger, Type::Double, Type::String, Type::Bytes,
+       Type::Decimal, Type::Null},
+      -12345,
+      67890u,
+      3.14159,
+      text,
+      bytes,
+      "123456.789",
+      nullptr};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(get_row_values(row));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(convert_rows)->ArgName("length")->Arg(8)->Arg(64)->Arg(1024);
+
+}  // namespace
+}  // namespace bench
+}  // namespace mysqlsh
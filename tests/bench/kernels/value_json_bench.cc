@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+#include "mysqlshdk/include/scripting/types.h"
+
+#include "tests/bench/kernels/bench_utils.h"
+
+namespace mysqlsh {
+namespace bench {
+namespace {
+
+/**
+ * Generates a JSON document similar to the dump metadata files: an array of
+ * objects holding strings (some of them need escaping), numbers, booleans,
+ * nulls and nested arrays.
+ */
+std::string generate_document(int64_t entries) {
+  const auto text = random_text(64);
+  std::string json = "{\"version\": \"2.0.1\", \"entries\": [";
+
+  for (int64_t i = 0; i < entries; ++i) {
+    if (i) json += ", ";
+
+    const auto n = std::to_string(i);
+
+    json += "{\"name\": \"table_" + n + "\", ";
+    json += "\"comment\": \"" + text + " \\\"quoted\\\" \\\\ \\n\", ";
+    json += "\"rows\": " + n + "00, ";
+    json += "\"ratio\": 0." + n + ", ";
+    json += "\"compressed\": true, ";
+    json += "\"partitions\": null, ";
+    json += "\"columns\": [\"id\", \"data_" + n + "\", \"ts\"]}";
+  }
+
+  json += "]}";
+
+  return json;
+}
+
+void entries_args(benchmark::internal::Benchmark *b) {
+  b->ArgName("entries")->Arg(10)->Arg(1000)->Arg(100000);
+  b->Unit(benchmark::kMicrosecond);
+}
+
+void parse(benchmark::State &state) {
+  const auto json = generate_document(state.range(0));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(shcore::Value::parse(json));
+  }
+
+  state.SetBytesProcessed(state.iterations() * json.length());
+}
+
+BENCHMARK(parse)->Apply(entries_args);
+
+void serialize(benchmark::State &state, bool pretty) {
+  const auto value = shcore::Value::parse(generate_document(state.range(0)));
+  std::size_t length = 0;
+
+  for (auto _ : state) {
+    const auto json = value.json(pretty);
+    length += json.length();
+    benchmark::DoNotOptimize(json.data());
+  }
+
+  state.SetBytesProcessed(length);
+}
+
+BENCHMARK_CAPTURE(serialize, compact, false)->Apply(entries_args);
+BENCHMARK_CAPTURE(serialize, pretty, true)->Apply(entries_args);
+
+void repr(benchmark::State &state) {
+  const auto value = shcore::Value::parse(generate_document(state.range(0)));
+  std::size_t length = 0;
+
+  for (auto _ : state) {
+    const auto repr = value.repr();
+    length += repr.length();
+    benchmark::DoNotOptimize(repr.data());
+  }
+
+  state.SetBytesProcessed(length);
+}
+
+BENCHMARK(repr)->Apply(entries_args);
+
+}  // namespace
+}  // namespace bench
+}  // namespace mysqlsh
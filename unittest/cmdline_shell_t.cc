@@ -33,8 +33,10 @@
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
+#include "mysqlshdk/libs/utils/version.h"
 #include "src/mysqlsh/cmdline_shell.h"
 #include "unittest/test_utils.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_session.h"
 
 extern "C" const char *g_test_home;
 
@@ -259,4 +261,58 @@ TEST(Cmdline_shell, cmd_edit_with_history) {
   shcore::unsetenv("EDITOR");
 }
 
+TEST(Cmdline_shell, server_version_is_cached) {
+  Command_line_shell shell(std::make_shared<Shell_options>());
+  Mysql_shell &base = shell;
+
+  const mysqlshdk::db::Connection_options first{"root@localhost:3306"};
+  const mysqlshdk::db::Connection_options second{"root@localhost:3307"};
+
+  const auto make_session = [](const mysqlshdk::db::Connection_options &co,
+                               const char *version) {
+    auto session = std::make_shared<testing::NiceMock<testing::Mock_session>>();
+    ON_CALL(*session, get_connection_options())
+        .WillByDefault(testing::ReturnRef(co));
+    ON_CALL(*session, get_server_version())
+        .WillByDefault(testing::Return(mysqlshdk::utils::Version(version)));
+    return session;
+  };
+
+  const auto expect_query = [](testing::Mock_session *session,
+                               const std::string &version) {
+    session->expect_query("select concat(@@version, ' ', @@version_comment)")
+        .then({"version"})
+        .add_row({version});
+  };
+
+  {
+    // version is queried once, unexpected queries throw
+    const auto session = make_session(first, "8.0.35");
+    expect_query(session.get(), "8.0.35 first");
+
+    EXPECT_EQ("8.0.35 first", base.server_version(session));
+    EXPECT_EQ("8.0.35 first", base.server_version(session));
+  }
+
+  {
+    // reconnecting to the same server does not query the version
+    const auto session = make_session(first, "8.0.35");
+    EXPECT_EQ("8.0.35 first", base.server_version(session));
+  }
+
+  {
+    // server was upgraded, version reported in the handshake is different
+    const auto session = make_session(first, "8.0.36");
+    expect_query(session.get(), "8.0.36 first");
+    EXPECT_EQ("8.0.36 first", base.server_version(session));
+  }
+
+  {
+    // a different server
+    const auto session = make_session(second, "8.0.35");
+    expect_query(session.get(), "8.0.35 second");
+    EXPECT_EQ("8.0.35 second", base.server_version(session));
+  }
+}
+
 }  // namespace mysqlsh
@@ -584,6 +584,20 @@ TEST_F(Completer_frontend, sql_table) {
   EXPECT_TAB_DOES_NOTHING("`cr");
 }
 
+TEST_F(Completer_frontend, sql_table_other_schema) {
+  connect_classic();
+  execute("\\use actest");
+  execute("\\sql");
+
+  // objects of other schemas are fetched when they are needed
+  EXPECT_AFTER_TAB("select * from mysql.plu", "select * from mysql.plugin");
+  EXPECT_AFTER_TAB("select * from performance_schema.rw",
+                   "select * from performance_schema.rwlock_instances");
+
+  // default schema is still available
+  EXPECT_AFTER_TAB("select * from peo", "select * from people");
+}
+
 // try different orders of mode switching
 TEST_F(Completer_frontend, sql_table_o1) {
   connect_classic();
@@ -696,7 +710,9 @@ TEST_F(Completer_frontend, js_shell) {
                                        "disablePager()",
                                        "disconnect()",
                                        "dumpRows()",
+                                       "dumpStatementStats()",
                                        "enablePager()",
+                                       "getMemoryStats()",
                                        "getSession()",
                                        "help()",
                                        "listCredentialHelpers()",
@@ -742,6 +758,7 @@ TEST_F(Completer_frontend, js_adminapi) {
 
   // TS_FR5.2_C02, TS_FR5.2_X02
   EXPECT_AFTER_TAB_TAB("dba.", strv({"checkInstanceConfiguration()",
+                                     "checkInstancesConfiguration()",
                                      "configureInstance()",
                                      "configureLocalInstance()",
                                      "configureReplicaSetInstance()",
@@ -749,6 +766,7 @@ TEST_F(Completer_frontend, js_adminapi) {
                                      "createReplicaSet()",
                                      "deleteSandboxInstance()",
                                      "deploySandboxInstance()",
+                                     "deploySandboxInstances()",
                                      "dropMetadataSchema()",
                                      "getCluster()",
                                      "getClusterSet()",
@@ -761,7 +779,7 @@ TEST_F(Completer_frontend, js_adminapi) {
                                      "stopSandboxInstance()",
                                      "upgradeMetadata()",
                                      "verbose"}));
-  EXPECT_AFTER_TAB("dba.depl", "dba.deploySandboxInstance()");
+  EXPECT_AFTER_TAB("dba.depl", "dba.deploySandboxInstance");
 }
 
 // TS_FR8_X01
@@ -1222,7 +1240,9 @@ TEST_F(Completer_frontend, py_shell) {
                                        "disable_pager()",
                                        "disconnect()",
                                        "dump_rows()",
+                                       "dump_statement_stats()",
                                        "enable_pager()",
+                                       "get_memory_stats()",
                                        "get_session()",
                                        "help()",
                                        "list_credential_helpers()",
@@ -1282,6 +1302,7 @@ TEST_F(Completer_frontend, py_adminapi) {
 
   // TS_FR5.2_C02, TS_FR5.2_X02
   EXPECT_AFTER_TAB_TAB("dba.", strv({"check_instance_configuration()",
+                                     "check_instances_configuration()",
                                      "configure_instance()",
                                      "configure_local_instance()",
                                      "configure_replica_set_instance()",
@@ -1289,6 +1310,7 @@ TEST_F(Completer_frontend, py_adminapi) {
                                      "create_replica_set()",
                                      "delete_sandbox_instance()",
                                      "deploy_sandbox_instance()",
+                                     "deploy_sandbox_instances()",
                                      "drop_metadata_schema()",
                                      "get_cluster()",
                                      "get_cluster_set()",
@@ -1301,7 +1323,7 @@ TEST_F(Completer_frontend, py_adminapi) {
                                      "stop_sandbox_instance()",
                                      "upgrade_metadata()",
                                      "verbose"}));
-  EXPECT_AFTER_TAB("dba.depl", "dba.deploy_sandbox_instance()");
+  EXPECT_AFTER_TAB("dba.depl", "dba.deploy_sandbox_instance");
 }
 
 TEST_F(Completer_frontend, py_devapi) {
@@ -27,6 +27,7 @@
 #include <string>
 #include <vector>
 
+#include "db/mysqlx/expr_cache.h"
 #include "db/mysqlx/expr_parser.h"
 #include "gtest_clean.h"
 #include "scripting/types_cpp.h"
@@ -602,5 +603,79 @@ TEST(Expr_parser_tests, too_many_parts) {
                    "                 ^    ");
 }
 
+TEST(Expr_parser_tests, cache) {
+  Expr_cache cache{2};
+
+  for (const auto document_mode : {false, true}) {
+    SCOPED_TRACE(document_mode);
+
+    for (const auto &expr : {"age > :a and name = :b", "a + 1", "[1, :a]"}) {
+      SCOPED_TRACE(expr);
+
+      std::vector<std::string> expected_placeholders;
+      const auto expected =
+          Expr_parser(expr, document_mode, false, &expected_placeholders)
+              .expr();
+
+      for (int i = 0; i < 2; ++i) {
+        std::vector<std::string> placeholders;
+        const auto actual = cache.parse(expr, document_mode, &placeholders);
+
+        EXPECT_EQ(expected->SerializeAsString(), actual->SerializeAsString());
+        EXPECT_EQ(expected_placeholders, placeholders);
+      }
+    }
+  }
+
+  // least recently used entries are evicted
+  EXPECT_EQ(2, cache.size());
+
+  // errors are reported each time
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_THROW(cache.parse("a +", false), Parser_error);
+  }
+
+  EXPECT_EQ(2, cache.size());
+
+  cache.clear();
+  EXPECT_EQ(0, cache.size());
+}
+
+TEST(Expr_parser_tests, cache_placeholders) {
+  Expr_cache cache;
+
+  const auto check = [&cache](const std::string &expr,
+                              std::vector<std::string> initial) {
+    SCOPED_TRACE(expr);
+
+    auto expected_placeholders = initial;
+    const auto expected =
+        Expr_parser(expr, true, false, &expected_placeholders).expr();
+
+    for (int i = 0; i < 2; ++i) {
+      auto placeholders = initial;
+      const auto actual = cache.parse(expr, true, &placeholders);
+
+      EXPECT_EQ(Expr_unparser::expr_to_string(*expected),
+                Expr_unparser::expr_to_string(*actual));
+      EXPECT_EQ(expected->SerializeAsString(), actual->SerializeAsString());
+      EXPECT_EQ(expected_placeholders, placeholders);
+    }
+  };
+
+  // positions are resolved using placeholders which are already defined
+  check(":b = :a or :c = :b", {});
+  check(":b = :a or :c = :b", {"a"});
+  check(":b = :a or :c = :b", {"x", "c"});
+  check("f(:a, {'k': :b})", {"b"});
+
+  // positional placeholders
+  check("? = ? or :a = ?", {});
+  check("? = ? or :a = ?", {"a"});
+  check(": = :a", {"x"});
+
+  EXPECT_EQ(3, cache.size());
+}
+
 }  // namespace expr_parser_tests
 }  // namespace shcore
@@ -0,0 +1,537 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/adminapi/common/instance_pool.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/mysql/group_replication.h"
+#include "unittest/test_utils/mocks/gmock_clean.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_result.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_session.h"
+
+namespace mysqlsh {
+namespace dba {
+
+namespace {
+
+/**
+ * Blocks the callers until the given number of them is waiting at the same
+ * time, returns false if that did not happen within a reasonable time.
+ */
+class Rendezvous final {
+ public:
+  explicit Rendezvous(std::size_t expected) : m_expected(expected) {}
+
+  bool arrive_and_wait() {
+    std::unique_lock lock{m_mutex};
+
+    if (++m_arrived >= m_expected) {
+      m_cv.notify_all();
+      return true;
+    }
+
+    return m_cv.wait_for(lock, std::chrono::seconds{30},
+                         [this]() { return m_arrived >= m_expected; });
+  }
+
+ private:
+  const std::size_t m_expected;
+  std::size_t m_arrived = 0;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+};
+
+/**
+ * Sets the dba.maxConcurrency option, restores the previous value when
+ * destroyed.
+ */
+class Scoped_max_concurrency final {
+ public:
+  explicit Scoped_max_concurrency(int value)
+      : m_previous(current_shell_options()->get().dba_max_concurrency) {
+    set(value);
+  }
+
+  Scoped_max_concurrency(const Scoped_max_concurrency &) = delete;
+  Scoped_max_concurrency(Scoped_max_concurrency &&) = delete;
+
+  Scoped_max_concurrency &operator=(const Scoped_max_concurrency &) = delete;
+  Scoped_max_concurrency &operator=(Scoped_max_concurrency &&) = delete;
+
+  ~Scoped_max_concurrency() { set(m_previous); }
+
+ private:
+  static void set(int value) {
+    current_shell_options()->set_and_notify(SHCORE_DBA_MAX_CONCURRENCY,
+                                            std::to_string(value));
+  }
+
+  const int m_previous;
+};
+
+}  // namespace
+
+TEST(Instance_pool_test, for_each_in_parallel_calls_each_index_once) {
+  for (const std::size_t count : {0, 1, 2, 15, 16, 17, 100}) {
+    SCOPED_TRACE("count: " + std::to_string(count));
+
+    std::vector<std::atomic<int>> calls(count);
+
+    const auto errors = for_each_in_parallel(
+        count, [&calls](std::size_t index) { ++calls[index]; });
+
+    ASSERT_EQ(count, errors.size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+      EXPECT_EQ(1, calls[i].load()) << "index: " << i;
+      EXPECT_EQ(nullptr, errors[i]) << "index: " << i;
+    }
+  }
+}
+
+TEST(Instance_pool_test, for_each_in_parallel_results_by_index) {
+  // each call writes only to its own slot, results are in the original order
+  constexpr std::size_t k_count = 50;
+  std::vector<std::string> results(k_count);
+
+  const auto errors = for_each_in_parallel(k_count, [&results](std::size_t i) {
+    results[i] = std::to_string(i);
+  });
+
+  for (std::size_t i = 0; i < k_count; ++i) {
+    EXPECT_EQ(std::to_string(i), results[i]);
+    EXPECT_EQ(nullptr, errors[i]);
+  }
+}
+
+TEST(Instance_pool_test, for_each_in_parallel_errors) {
+  // errors thrown by the workers are reported for the index which has thrown
+  // them, remaining calls are not affected
+  constexpr std::size_t k_count = 20;
+  std::vector<std::atomic<int>> calls(k_count);
+
+  const auto errors =
+      for_each_in_parallel(k_count, [&calls](std::size_t index) {
+        ++calls[index];
+
+        if (index % 3 == 0) {
+          throw std::runtime_error("error " + std::to_string(index));
+        } else if (index % 3 == 1) {
+          throw shcore::Exception::runtime_error("shell error " +
+                                                 std::to_string(index));
+        }
+      });
+
+  ASSERT_EQ(k_count, errors.size());
+
+  for (std::size_t i = 0; i < k_count; ++i) {
+    SCOPED_TRACE("index: " + std::to_string(i));
+
+    EXPECT_EQ(1, calls[i].load());
+
+    switch (i % 3) {
+      case 0:
+        ASSERT_NE(nullptr, errors[i]);
+        EXPECT_THROW_MSG(std::rethrow_exception(errors[i]), std::runtime_error,
+                         "error " + std::to_string(i));
+        break;
+
+      case 1:
+        ASSERT_NE(nullptr, errors[i]);
+        EXPECT_THROW_MSG(std::rethrow_exception(errors[i]), shcore::Exception,
+                         "shell error " + std::to_string(i));
+        break;
+
+      default:
+        EXPECT_EQ(nullptr, errors[i]);
+        break;
+    }
+  }
+}
+
+TEST(Instance_pool_test, for_each_in_parallel_is_concurrent) {
+  // an unreachable instance must not delay the remaining ones: all calls are
+  // blocked until every one of them has started
+  constexpr std::size_t k_count = 8;
+  Rendezvous rendezvous{k_count};
+  std::vector<int> met(k_count);
+
+  const auto errors =
+      for_each_in_parallel(k_count, [&rendezvous, &met](std::size_t index) {
+        met[index] = rendezvous.arrive_and_wait();
+      });
+
+  for (std::size_t i = 0; i < k_count; ++i) {
+    EXPECT_TRUE(met[i]) << "index: " << i;
+    EXPECT_EQ(nullptr, errors[i]) << "index: " << i;
+  }
+}
+
+TEST(Instance_pool_test, parallel_thread_count) {
+  {
+    Scoped_max_concurrency max_concurrency{4};
+
+    EXPECT_EQ(0, parallel_thread_count(0));
+    EXPECT_EQ(1, parallel_thread_count(1));
+    EXPECT_EQ(3, parallel_thread_count(3));
+    EXPECT_EQ(4, parallel_thread_count(4));
+    EXPECT_EQ(4, parallel_thread_count(100));
+  }
+
+  {
+    // instances are contacted one at a time
+    Scoped_max_concurrency max_concurrency{1};
+
+    EXPECT_EQ(1, parallel_thread_count(1));
+    EXPECT_EQ(1, parallel_thread_count(100));
+  }
+}
+
+TEST(Instance_pool_test, for_each_in_parallel_max_concurrency) {
+  for (const int limit : {1, 3}) {
+    SCOPED_TRACE("dba.maxConcurrency: " + std::to_string(limit));
+
+    Scoped_max_concurrency max_concurrency{limit};
+
+    constexpr std::size_t k_count = 20;
+    std::atomic<int> in_flight{0};
+    std::atomic<int> max_in_flight{0};
+    std::vector<std::atomic<int>> calls(k_count);
+
+    const auto errors = for_each_in_parallel(k_count, [&](std::size_t index) {
+      const auto current = ++in_flight;
+      auto max = max_in_flight.load();
+
+      while (current > max &&
+             !max_in_flight.compare_exchange_weak(max, current)) {
+      }
+
+      // give the remaining workers a chance to start
+      std::this_thread::sleep_for(std::chrono::milliseconds{2});
+
+      ++calls[index];
+      --in_flight;
+    });
+
+    EXPECT_GE(limit, max_in_flight.load());
+
+    for (std::size_t i = 0; i < k_count; ++i) {
+      EXPECT_EQ(1, calls[i].load()) << "index: " << i;
+      EXPECT_EQ(nullptr, errors[i]) << "index: " << i;
+    }
+  }
+}
+
+class Instance_pool_idle_test : public ::testing::Test {
+ protected:
+  /**
+   * Session kept by the pool, counts the pings and optionally fails them.
+   */
+  struct Pooled_session {
+    std::shared_ptr<testing::NiceMock<testing::Mock_session>> session =
+        std::make_shared<testing::NiceMock<testing::Mock_session>>();
+    int pings = 0;
+    bool fail_ping = false;
+  };
+
+  std::shared_ptr<Pooled_session> make_session() {
+    auto s = std::make_shared<Pooled_session>();
+
+    ON_CALL(*s->session, get_connection_options())
+        .WillByDefault(testing::ReturnRef(m_options));
+
+    s->session->set_query_handler([s = s.get()](const std::string &sql)
+                                      -> std::shared_ptr<
+                                          mysqlshdk::db::IResult> {
+      auto result = std::make_shared<testing::NiceMock<testing::Mock_result>>();
+
+      if ("SELECT 1" == sql) {
+        ++s->pings;
+
+        if (s->fail_ping) {
+          throw mysqlshdk::db::Error("Server shutdown in progress", 1053);
+        }
+
+        result->add_result({"1"}, {mysqlshdk::db::Type::Integer}, {{"1"}});
+      } else {
+        result->add_result({"host", "port"},
+                           {mysqlshdk::db::Type::String,
+                            mysqlshdk::db::Type::Integer},
+                           {{"localhost", "3306"}});
+      }
+
+      return result;
+    });
+
+    return s;
+  }
+
+  /**
+   * Adds an idle session to the pool, as if it was used by a previous
+   * operation.
+   */
+  std::shared_ptr<Instance> add_idle(Instance_pool *pool,
+                                     const Pooled_session &s) {
+    auto instance = pool->adopt(std::make_shared<Instance>(pool, s.session));
+    instance->release();
+    return instance;
+  }
+
+  mysqlshdk::db::Connection_options m_options{"root@localhost:3306"};
+};
+
+TEST_F(Instance_pool_idle_test, reuse_without_recycle) {
+  // session returned during the same operation is not checked
+  const auto s = make_session();
+  Instance_pool pool{false};
+  const auto instance = add_idle(&pool, *s);
+
+  EXPECT_EQ(instance, pool.connect_unchecked(m_options));
+  EXPECT_EQ(0, s->pings);
+
+  instance->release();
+}
+
+TEST_F(Instance_pool_idle_test, reuse_after_recycle) {
+  // session left over from a previous operation is pinged once when leased
+  const auto s = make_session();
+  Instance_pool pool{false};
+  const auto instance = add_idle(&pool, *s);
+
+  EXPECT_CALL(*s->session, do_close()).Times(0);
+  pool.recycle(std::chrono::hours{1});
+  testing::Mock::VerifyAndClearExpectations(s->session.get());
+
+  EXPECT_EQ(instance, pool.connect_unchecked(m_options));
+  EXPECT_EQ(1, s->pings);
+
+  instance->release();
+
+  // returned again during the same operation, not checked
+  EXPECT_EQ(instance, pool.connect_unchecked(m_options));
+  EXPECT_EQ(1, s->pings);
+
+  instance->release();
+}
+
+TEST_F(Instance_pool_idle_test, broken_session_is_discarded) {
+  // session which cannot be reused is closed, next idle one is used instead
+  const auto broken = make_session();
+  const auto healthy = make_session();
+  Instance_pool pool{false};
+  add_idle(&pool, *broken);
+  const auto instance = add_idle(&pool, *healthy);
+
+  pool.recycle(std::chrono::hours{1});
+
+  broken->fail_ping = true;
+  EXPECT_CALL(*broken->session, do_close()).Times(testing::AtLeast(1));
+
+  EXPECT_EQ(instance, pool.connect_unchecked(m_options));
+  EXPECT_EQ(1, broken->pings);
+  EXPECT_EQ(1, healthy->pings);
+  testing::Mock::VerifyAndClearExpectations(broken->session.get());
+
+  instance->release();
+
+  // discarded session is no longer in the pool
+  pool.recycle(std::chrono::hours{1});
+  EXPECT_EQ(instance, pool.connect_unchecked(m_options));
+  EXPECT_EQ(1, broken->pings);
+  EXPECT_EQ(2, healthy->pings);
+
+  instance->release();
+}
+
+TEST_F(Instance_pool_idle_test, idle_timeout) {
+  const auto idle = make_session();
+  const auto leased = make_session();
+  Instance_pool pool{false};
+  add_idle(&pool, *idle);
+  const auto instance =
+      pool.adopt(std::make_shared<Instance>(&pool, leased->session));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+  // only the idle session is closed, the one still in use is kept
+  EXPECT_CALL(*idle->session, do_close()).Times(testing::AtLeast(1));
+  EXPECT_CALL(*leased->session, do_close()).Times(0);
+
+  pool.recycle(std::chrono::seconds{0});
+
+  testing::Mock::VerifyAndClearExpectations(idle->session.get());
+  testing::Mock::VerifyAndClearExpectations(leased->session.get());
+
+  instance->release();
+  EXPECT_EQ(instance, pool.connect_unchecked(m_options));
+  EXPECT_EQ(0, idle->pings);
+
+  instance->release();
+}
+
+TEST_F(Instance_pool_idle_test, dropped_session_is_returned) {
+  // session which was not released by the previous operation is returned to
+  // the pool once nobody else references it
+  const auto s = make_session();
+  Instance_pool pool{false};
+  Instance *raw = nullptr;
+
+  {
+    const auto instance =
+        pool.adopt(std::make_shared<Instance>(&pool, s->session));
+    raw = instance.get();
+  }
+
+  pool.recycle(std::chrono::hours{1});
+
+  const auto instance = pool.connect_unchecked(m_options);
+  EXPECT_EQ(raw, instance.get());
+  EXPECT_EQ(1, s->pings);
+
+  instance->release();
+}
+
+TEST_F(Instance_pool_idle_test, parallel_leases) {
+  // members are connected to at the same time through the shared pool, each
+  // one has to get a different session
+  constexpr std::size_t k_count = 8;
+  std::vector<std::shared_ptr<Pooled_session>> sessions;
+
+  for (std::size_t i = 0; i < k_count; ++i) {
+    sessions.emplace_back(make_session());
+  }
+
+  Instance_pool pool{false};
+  std::set<Instance *> idle;
+
+  for (const auto &s : sessions) {
+    idle.emplace(add_idle(&pool, *s).get());
+  }
+
+  for (const auto recycle : {false, true}) {
+    SCOPED_TRACE(recycle ? "after recycle" : "same operation");
+
+    if (recycle) pool.recycle(std::chrono::hours{1});
+
+    std::vector<std::shared_ptr<Instance>> leased(k_count);
+
+    const auto errors =
+        for_each_in_parallel(k_count, [&](std::size_t index) {
+          leased[index] = pool.connect_unchecked(m_options);
+        });
+
+    std::set<Instance *> unique;
+
+    for (std::size_t i = 0; i < k_count; ++i) {
+      EXPECT_EQ(nullptr, errors[i]) << "index: " << i;
+      unique.emplace(leased[i].get());
+    }
+
+    EXPECT_EQ(idle, unique);
+
+    // sessions are also returned at the same time
+    for_each_in_parallel(k_count,
+                         [&](std::size_t index) { leased[index]->release(); });
+  }
+
+  // every session was pinged once, after the pool was recycled
+  for (const auto &s : sessions) {
+    EXPECT_EQ(1, s->pings);
+  }
+}
+
+TEST(Instance_pool_test, member_state_fan_out) {
+  // state of each member is read through its own session at the same time,
+  // results and errors are reported in the original member order
+  const std::vector<std::string> states = {"ONLINE", "RECOVERING", "",
+                                           "OFFLINE", "",      "ERROR"};
+  constexpr std::size_t k_failed = 2;
+  constexpr std::size_t k_missing = 4;
+
+  std::vector<std::shared_ptr<Instance>> instances;
+
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    const auto session =
+        std::make_shared<testing::NiceMock<testing::Mock_session>>();
+
+    session->expect_query(
+        "SELECT member_state FROM performance_schema.replication_group_members "
+        "WHERE member_id = @@server_uuid OR (member_id = '' AND member_state = "
+        "'OFFLINE')");
+
+    if (k_failed == i) {
+      session->then_throw("Lost connection to MySQL server during query",
+                          2013);
+    } else {
+      auto &result = session->then({"member_state"});
+
+      if (k_missing != i) result.add_row({states[i]});
+    }
+
+    instances.emplace_back(std::make_shared<Instance>(session));
+  }
+
+  std::vector<mysqlshdk::gr::Member_state> result(instances.size());
+
+  const auto errors =
+      for_each_in_parallel(instances.size(), [&](std::size_t index) {
+        result[index] = mysqlshdk::gr::get_member_state(*instances[index]);
+      });
+
+  for (std::size_t i = 0; i < instances.size(); ++i) {
+    SCOPED_TRACE("member: " + std::to_string(i));
+
+    if (k_failed == i) {
+      ASSERT_NE(nullptr, errors[i]);
+      EXPECT_THROW_MSG_CONTAINS(std::rethrow_exception(errors[i]),
+                                shcore::Error, "Lost connection");
+      continue;
+    }
+
+    EXPECT_EQ(nullptr, errors[i]);
+
+    if (k_missing == i) {
+      EXPECT_EQ(mysqlshdk::gr::Member_state::MISSING, result[i]);
+    } else {
+      EXPECT_EQ(mysqlshdk::gr::to_member_state(states[i]), result[i]);
+    }
+  }
+}
+
+}  // namespace dba
+}  // namespace mysqlsh
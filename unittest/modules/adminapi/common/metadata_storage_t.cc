@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/adminapi/common/instance_pool.h"
+#include "modules/adminapi/common/metadata_storage.h"
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "unittest/test_utils/mocks/gmock_clean.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_result.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_session.h"
+
+namespace mysqlsh {
+namespace dba {
+
+using mysqlshdk::db::Type;
+
+class Metadata_storage_snapshot_test : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_session = std::make_shared<testing::NiceMock<testing::Mock_session>>();
+    m_session->set_query_handler(
+        [this](const std::string &sql) { return handle_query(sql); });
+
+    m_md = std::make_shared<MetadataStorage>(
+        std::make_shared<Instance>(m_session));
+  }
+
+  void TearDown() override { m_md.reset(); }
+
+  std::shared_ptr<mysqlshdk::db::IResult> handle_query(const std::string &sql) {
+    ++m_queries[sql];
+
+    auto result = std::make_shared<testing::NiceMock<testing::Mock_result>>();
+    ON_CALL(*result, get_metadata())
+        .WillByDefault(testing::ReturnRef(m_columns));
+
+    if (shcore::str_beginswith(sql, "SELECT COALESCE(")) {
+      result->add_result({"host", "port"}, {Type::String, Type::Integer},
+                         {{"localhost", "3306"}});
+    } else if (shcore::str_beginswith(sql, "SELECT ")) {
+      // each execution returns a different value
+      result->add_result({"attribute"}, {Type::String},
+                         {{std::to_string(++m_selects)}});
+    }
+
+    return result;
+  }
+
+  int query_attribute(const std::string &attribute) const {
+    shcore::Value value;
+    EXPECT_TRUE(m_md->query_instance_attribute("uuid", attribute, &value));
+    return static_cast<int>(value.as_int());
+  }
+
+  int selects(const std::string &attribute) const {
+    for (const auto &query : m_queries) {
+      if (shcore::str_beginswith(query.first, "SELECT attributes->'$." +
+                                                  attribute + "'")) {
+        return query.second;
+      }
+    }
+
+    return 0;
+  }
+
+  std::shared_ptr<testing::Mock_session> m_session;
+  std::shared_ptr<MetadataStorage> m_md;
+  std::vector<mysqlshdk::db::Column> m_columns = {
+      mysqlshdk::db::Column("", "", "", "", "attribute", "attribute", 0, 0,
+                            Type::String, 0, false, false, false)};
+  std::map<std::string, int> m_queries;
+  int m_selects = 0;
+};
+
+TEST_F(Metadata_storage_snapshot_test, no_snapshot) {
+  // every query is executed
+  EXPECT_EQ(1, query_attribute("a"));
+  EXPECT_EQ(2, query_attribute("a"));
+  EXPECT_EQ(2, selects("a"));
+}
+
+TEST_F(Metadata_storage_snapshot_test, queries_are_cached) {
+  {
+    MetadataStorage::Snapshot snapshot{m_md};
+
+    EXPECT_EQ(1, query_attribute("a"));
+    EXPECT_EQ(1, query_attribute("a"));
+    EXPECT_EQ(1, selects("a"));
+
+    // results are kept by statement
+    EXPECT_EQ(2, query_attribute("b"));
+    EXPECT_EQ(1, query_attribute("a"));
+    EXPECT_EQ(2, query_attribute("b"));
+    EXPECT_EQ(1, selects("a"));
+    EXPECT_EQ(1, selects("b"));
+  }
+
+  // results are discarded once the snapshot is destroyed
+  EXPECT_EQ(3, query_attribute("a"));
+  EXPECT_EQ(2, selects("a"));
+}
+
+TEST_F(Metadata_storage_snapshot_test, nested_snapshots) {
+  MetadataStorage::Snapshot outer{m_md};
+
+  {
+    MetadataStorage::Snapshot inner{m_md};
+    EXPECT_EQ(1, query_attribute("a"));
+  }
+
+  // results are kept until the outermost snapshot is destroyed
+  EXPECT_EQ(1, query_attribute("a"));
+  EXPECT_EQ(1, selects("a"));
+}
+
+TEST_F(Metadata_storage_snapshot_test, write_discards_results) {
+  MetadataStorage::Snapshot snapshot{m_md};
+
+  EXPECT_EQ(1, query_attribute("a"));
+  EXPECT_EQ(2, query_attribute("b"));
+
+  // statement which may change the metadata discards all the results
+  m_md->remove_instance_attribute("uuid", "c");
+
+  EXPECT_EQ(3, query_attribute("a"));
+  EXPECT_EQ(4, query_attribute("b"));
+  EXPECT_EQ(2, selects("a"));
+  EXPECT_EQ(2, selects("b"));
+
+  // results are kept again
+  EXPECT_EQ(3, query_attribute("a"));
+  EXPECT_EQ(2, selects("a"));
+}
+
+class Metadata_storage_routing_options_test : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_session = std::make_shared<testing::NiceMock<testing::Mock_session>>();
+    m_session->set_query_handler(
+        [this](const std::string &sql) { return handle_query(sql); });
+
+    m_md = std::make_shared<MetadataStorage>(
+        std::make_shared<Instance>(m_session));
+  }
+
+  void TearDown() override { m_md.reset(); }
+
+  std::shared_ptr<mysqlshdk::db::IResult> handle_query(const std::string &sql) {
+    auto result = std::make_shared<testing::NiceMock<testing::Mock_result>>();
+
+    if (shcore::str_beginswith(sql, "SELECT COALESCE(")) {
+      result->add_result({"host", "port"}, {Type::String, Type::Integer},
+                         {{"localhost", "3306"}});
+    } else if (std::string::npos !=
+               sql.find("FROM mysql_innodb_cluster_metadata.routers")) {
+      m_routing_queries.emplace_back(sql);
+
+      // rows of all routers, unless server was asked to filter them
+      std::vector<std::vector<std::string>> rows;
+
+      for (const auto &router : {"host1::r1", "host2::r2"}) {
+        if (std::string::npos == sql.find(" WHERE concat(") ||
+            std::string::npos != sql.find(shcore::quote_sql_string(router))) {
+          rows.push_back({router, "{\"name\": \"" + std::string(router) +
+                                      "\"}",
+                          "___NULL___"});
+        }
+      }
+
+      rows.push_back({"___NULL___", "___NULL___", "10"});
+
+      result->add_result({"router_label", "tags", "stats_updates_frequency"},
+                         {Type::String, Type::String, Type::String}, rows);
+    }
+
+    return result;
+  }
+
+  std::shared_ptr<testing::Mock_session> m_session;
+  std::shared_ptr<MetadataStorage> m_md;
+  std::vector<std::string> m_routing_queries;
+};
+
+TEST_F(Metadata_storage_routing_options_test, all_routers) {
+  const auto options =
+      m_md->get_routing_options(Cluster_type::ASYNC_REPLICATION, "cid");
+
+  ASSERT_EQ(1, m_routing_queries.size());
+  EXPECT_EQ(std::string::npos, m_routing_queries[0].find(" WHERE concat("));
+  EXPECT_NE(std::string::npos,
+            m_routing_queries[0].find("WHERE cluster_id = 'cid'"));
+
+  ASSERT_EQ(2, options.routers.size());
+  EXPECT_EQ("host1::r1", options.routers.at("host1::r1")
+                             .at("tags")
+                             .as_map()
+                             ->get_string("name"));
+  EXPECT_EQ("host2::r2", options.routers.at("host2::r2")
+                             .at("tags")
+                             .as_map()
+                             ->get_string("name"));
+  // unset options of routers are not reported
+  EXPECT_EQ(0,
+            options.routers.at("host1::r1").count("stats_updates_frequency"));
+
+  // global options are filled in with defaults
+  EXPECT_EQ(10, options.global.at("stats_updates_frequency").as_int());
+  EXPECT_TRUE(options.global.at("tags").as_map()->empty());
+}
+
+TEST_F(Metadata_storage_routing_options_test, single_router) {
+  // only options of the requested router are fetched, filtering is done by the
+  // server
+  const auto options = m_md->get_routing_options(
+      Cluster_type::ASYNC_REPLICATION, "cid", "host2::r2");
+
+  ASSERT_EQ(1, m_routing_queries.size());
+  EXPECT_NE(std::string::npos,
+            m_routing_queries[0].find(
+                "FROM mysql_innodb_cluster_metadata.routers AS r WHERE "
+                "concat(r.address, '::', r.router_name) = 'host2::r2' UNION"));
+  EXPECT_NE(std::string::npos,
+            m_routing_queries[0].find("WHERE cluster_id = 'cid'"));
+
+  ASSERT_EQ(1, options.routers.size());
+  EXPECT_EQ("host2::r2", options.routers.at("host2::r2")
+                             .at("tags")
+                             .as_map()
+                             ->get_string("name"));
+  EXPECT_EQ(10, options.global.at("stats_updates_frequency").as_int());
+
+  // label is escaped
+  m_routing_queries.clear();
+  const auto none = m_md->get_routing_options(Cluster_type::ASYNC_REPLICATION,
+                                              "cid", "host'::r");
+
+  ASSERT_EQ(1, m_routing_queries.size());
+  EXPECT_NE(std::string::npos, m_routing_queries[0].find("= 'host\\'::r'"));
+  EXPECT_TRUE(none.routers.empty());
+}
+
+}  // namespace dba
+}  // namespace mysqlsh
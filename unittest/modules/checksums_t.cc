@@ -28,6 +28,7 @@
 #include <vector>
 
 #include <cstdlib>
+#include <cstring>
 
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils.h"
@@ -619,6 +620,58 @@ TEST_F(Checksums_test, sha2_hashes_5_6) {
   run_sha2_test(connect_session(uri));
 }
 
+TEST(Checksums_row_hasher, order_independent) {
+  const auto add_row = [](Checksums::Row_hasher *hasher, const char *first,
+                          const char *second) {
+    if (first) {
+      hasher->add_field(first, strlen(first));
+    } else {
+      hasher->add_null();
+    }
+
+    if (second) {
+      hasher->add_field(second, strlen(second));
+    } else {
+      hasher->add_null();
+    }
+
+    hasher->end_row();
+  };
+
+  Checksums::Row_hasher empty{Checksums::Hash::SHA_256};
+  EXPECT_EQ(0, empty.result().count);
+
+  Checksums::Row_hasher first{Checksums::Hash::SHA_256};
+  add_row(&first, "1", "abc");
+  add_row(&first, "2", nullptr);
+  add_row(&first, "3", "");
+
+  Checksums::Row_hasher second{Checksums::Hash::SHA_256};
+  add_row(&second, "3", "");
+  add_row(&second, "1", "abc");
+  add_row(&second, "2", nullptr);
+
+  EXPECT_EQ(3, first.result().count);
+  EXPECT_EQ(first.result(), second.result());
+  EXPECT_NE(empty.result().checksum, first.result().checksum);
+
+  // NULL, an empty value and field boundaries produce different hashes
+  Checksums::Row_hasher null_value{Checksums::Hash::SHA_256};
+  add_row(&null_value, "1", nullptr);
+
+  Checksums::Row_hasher empty_value{Checksums::Hash::SHA_256};
+  add_row(&empty_value, "1", "");
+
+  Checksums::Row_hasher moved_boundary{Checksums::Hash::SHA_256};
+  add_row(&moved_boundary, "1a", "bc");
+
+  Checksums::Row_hasher boundary{Checksums::Hash::SHA_256};
+  add_row(&boundary, "1", "abc");
+
+  EXPECT_NE(null_value.result().checksum, empty_value.result().checksum);
+  EXPECT_NE(moved_boundary.result().checksum, boundary.result().checksum);
+}
+
 }  // namespace
 }  // namespace common
 }  // namespace dump
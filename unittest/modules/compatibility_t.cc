@@ -1420,6 +1420,50 @@ TEST_F(Compatibility_test, check_create_table_for_indexes) {
        {}});
 }
 
+TEST_F(Compatibility_test, deferred_foreign_keys) {
+  const auto stmts = check_create_table_for_indexes(
+      R"(CREATE TABLE `child` (
+  `id` int NOT NULL,
+  `p1` int DEFAULT NULL,
+  `p2` int DEFAULT NULL,
+  `p3` int DEFAULT NULL,
+  PRIMARY KEY (`id`),
+  KEY `p1` (`p1`),
+  KEY `p2` (`p2`),
+  KEY `p3` (`p3`),
+  CONSTRAINT `fk1` FOREIGN KEY (`p1`) REFERENCES `parent` (`id`),
+  CONSTRAINT `fk (2)` FOREIGN KEY (`p2`) REFERENCES `other`.`t (x)` (`id`) ON DELETE CASCADE,
+  CONSTRAINT `references` FOREIGN KEY (`p3`) REFERENCES `child` (`id`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_0900_ai_ci)",
+      "`child`", false);
+
+  ASSERT_EQ(3, stmts.foreign_keys.size());
+
+  // referenced table is used to order the tables
+  EXPECT_EQ("`parent`", foreign_key_referenced_table(stmts.foreign_keys[0]));
+  EXPECT_EQ("`other`.`t (x)`",
+            foreign_key_referenced_table(stmts.foreign_keys[1]));
+  EXPECT_EQ("`child`", foreign_key_referenced_table(stmts.foreign_keys[2]));
+  EXPECT_EQ("", foreign_key_referenced_table("KEY `p1` (`p1`)"));
+  EXPECT_EQ("", foreign_key_referenced_table(""));
+
+  // all constraints of a table are added in a single statement
+  EXPECT_EQ(
+      "ALTER TABLE `child` ADD CONSTRAINT `fk1` FOREIGN KEY (`p1`) REFERENCES "
+      "`parent` (`id`),ADD CONSTRAINT `fk (2)` FOREIGN KEY (`p2`) REFERENCES "
+      "`other`.`t (x)` (`id`) ON DELETE CASCADE,ADD CONSTRAINT `references` "
+      "FOREIGN KEY (`p3`) REFERENCES `child` (`id`)",
+      add_foreign_keys_statement("`child`", stmts.foreign_keys));
+
+  // or one at a time, if that fails
+  EXPECT_EQ(
+      "ALTER TABLE `child` ADD CONSTRAINT `fk (2)` FOREIGN KEY (`p2`) "
+      "REFERENCES `other`.`t (x)` (`id`) ON DELETE CASCADE",
+      add_foreign_keys_statement(
+          "`child`", std::span<const std::string>{stmts.foreign_keys}.subspan(
+                         1, 1)));
+}
+
 TEST_F(Compatibility_test, indexes_recreation) {
   auto session = mysqlshdk::db::mysql::Session::create();
   session->connect(shcore::get_connection_options(_mysql_uri));
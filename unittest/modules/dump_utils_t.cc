@@ -23,6 +23,8 @@
 
 #include <gtest/gtest_prod.h>
 #include <cstdlib>
+#include <deque>
+#include <limits>
 #include "modules/util/common/dump/utils.h"
 #include "unittest/gtest_clean.h"
 
@@ -114,6 +116,107 @@ TEST(Dump_utils, encode_table_data_filename_chunks) {
                                     "csv", 4, true));
 }
 
+TEST(Dump_utils, tablespace_basename) {
+  EXPECT_EQ("sakila@actor@@0",
+            get_tablespace_basename(encode_table_basename("sakila", "actor"),
+                                    0));
+  EXPECT_EQ("sak%20ila@acto%20@@12.ibd",
+            get_table_data_filename(
+                get_tablespace_basename(
+                    encode_table_basename("sak ila", "acto "), 12),
+                "ibd"));
+}
+
+TEST(Dump_utils, encode_server_filename) {
+  EXPECT_EQ("", encode_server_filename(""));
+  EXPECT_EQ("sakila", encode_server_filename("sakila"));
+  EXPECT_EQ("Film_Text2", encode_server_filename("Film_Text2"));
+  EXPECT_EQ("my@002dtable", encode_server_filename("my-table"));
+  EXPECT_EQ("a@0020b@002ec@0040", encode_server_filename("a b.c@"));
+  EXPECT_EQ("t@0023p@0023p0", encode_server_filename("t#p#p0"));
+
+  EXPECT_THROW(encode_server_filename("sákila"), std::invalid_argument);
+}
+
+TEST(Dump_utils, metadata_index) {
+  std::string index;
+
+  index += metadata_index_entry("sakila.json", R"({"tables":["actor"]})");
+  index +=
+      metadata_index_entry("sakila@actor.json", R"({"includesData":true})");
+  index += metadata_index_entry("sak%20ila@%5B%5D.json", "{}");
+
+  EXPECT_EQ(
+      "[\"sakila.json\",{\"tables\":[\"actor\"]}]\n"
+      "[\"sakila@actor.json\",{\"includesData\":true}]\n"
+      "[\"sak%20ila@%5B%5D.json\",{}]\n",
+      index);
+
+  const auto entries = parse_metadata_index(index);
+
+  ASSERT_EQ(3, entries.size());
+  EXPECT_EQ(R"({"tables":["actor"]})", entries.at("sakila.json"));
+  EXPECT_EQ(R"({"includesData":true})", entries.at("sakila@actor.json"));
+  EXPECT_EQ("{}", entries.at("sak%20ila@%5B%5D.json"));
+
+  // empty lines are ignored, last line does not have to be terminated
+  EXPECT_EQ(1, parse_metadata_index("\n[\"a.json\",{}]").size());
+  EXPECT_TRUE(parse_metadata_index("").empty());
+
+  for (const auto malformed :
+       {"a.json", "[\"a.json\"]", "[\"a.json\",]", "[\"a.json\" {}]",
+        "[\"a.json\",{}", "[\"a.json,{}]"}) {
+    EXPECT_THROW(parse_metadata_index(malformed), std::runtime_error)
+        << malformed;
+  }
+}
+
+TEST(Dump_utils, journal) {
+  EXPECT_EQ("@.journal.1.ndjson", get_journal_segment_filename(1));
+  EXPECT_EQ(1, get_journal_segment(get_journal_segment_filename(1)));
+  EXPECT_EQ(1234, get_journal_segment(get_journal_segment_filename(1234)));
+
+  for (const auto other :
+       {"@.json", "@.journal.ndjson", "@.journal.1", "@.journal.x.ndjson",
+        "@.journal.1x.ndjson", "sakila@actor@@0.tsv.zst"}) {
+    EXPECT_EQ(0, get_journal_segment(other)) << other;
+  }
+
+  std::string segment;
+
+  segment += journal_entry("sakila.json", 123);
+  segment += journal_entry("sakila@actor@@0.tsv.zst", 0);
+  segment += journal_entry("sak%20ila@%5B%5D.json", 4567890123);
+
+  EXPECT_EQ(
+      "[\"sakila.json\",123]\n"
+      "[\"sakila@actor@@0.tsv.zst\",0]\n"
+      "[\"sak%20ila@%5B%5D.json\",4567890123]\n",
+      segment);
+
+  const auto entries = parse_journal_segment(segment);
+
+  ASSERT_EQ(3, entries.size());
+  EXPECT_EQ("sakila.json", entries[0].first);
+  EXPECT_EQ(123, entries[0].second);
+  EXPECT_EQ("sakila@actor@@0.tsv.zst", entries[1].first);
+  EXPECT_EQ(0, entries[1].second);
+  EXPECT_EQ("sak%20ila@%5B%5D.json", entries[2].first);
+  EXPECT_EQ(4567890123, entries[2].second);
+
+  // empty lines are ignored, last line does not have to be terminated
+  EXPECT_EQ(1, parse_journal_segment("\n[\"a.json\",1]").size());
+  EXPECT_TRUE(parse_journal_segment("").empty());
+
+  for (const auto malformed :
+       {"a.json", "[\"a.json\"]", "[\"a.json\",]", "[\"a.json\" 1]",
+        "[\"a.json\",1", "[\"a.json,1]", "[\"a.json\",-1]",
+        "[\"a.json\",1x]"}) {
+    EXPECT_THROW(parse_journal_segment(malformed), std::runtime_error)
+        << malformed;
+  }
+}
+
 }  // namespace common
 }  // namespace dump
 
@@ -160,7 +263,7 @@ class Dump_scheduler : public ::testing::Test {
     std::vector<std::string> schedule_order;
 
     std::unordered_multimap<std::string, size_t> tables_being_loaded;
-    std::unordered_set<Dump_reader::Table_data_info *> tables_with_data;
+    Dump_reader::Tables_with_data tables_with_data;
 
     auto copy = tables;
     for (auto &t : copy) {
@@ -172,27 +275,18 @@ class Dump_scheduler : public ::testing::Test {
 
     auto schedule_one = [&](std::string *out_table, std::string *out_file,
                             size_t *out_size) {
-      auto iter = f(tables_being_loaded, &tables_with_data, nthreads);
+      const auto table =
+          f(tables_being_loaded, tables_with_data, nthreads, std::nullopt);
 
-      if (iter != tables_with_data.end()) {
-        *out_table = (*iter)->key();
+      if (table) {
+        *out_table = table->key();
 
-        size_t chunk_index;
+        const auto chunk_index = table->chunked ? table->chunks_consumed : 0;
 
-        if ((*iter)->chunked) {
-          chunk_index = (*iter)->chunks_consumed;
-          (*iter)->chunks_consumed++;
-
-          *out_file = (*iter)->available_chunks[chunk_index]->name();
-          *out_size = (*iter)->available_chunks[chunk_index]->size();
-        } else {
-          chunk_index = 0;
-          (*iter)->chunks_consumed++;
+        *out_file = table->available_chunks[chunk_index]->name();
+        *out_size = table->available_chunks[chunk_index]->size();
 
-          *out_size = (*iter)->available_chunks[0]->size();
-          *out_file = (*iter)->available_chunks[0]->name();
-        }
-        if (!(*iter)->has_data_available()) tables_with_data.erase(iter);
+        tables_with_data.consume_chunk(table);
         return true;
       }
       return false;
@@ -216,10 +310,10 @@ class Dump_scheduler : public ::testing::Test {
       }
 
       std::cout << "\nTables with data:\n";
-      for (auto t : tables_with_data) {
+      tables_with_data.for_each([](const Dump_reader::Table_data_info *t) {
         std::cout << t->owner->schema << "." << t->owner->name << "\t"
                   << t->bytes_available() << "\n";
-      }
+      });
       std::cout << "\n";
     };
 
@@ -260,7 +354,8 @@ class Dump_scheduler : public ::testing::Test {
         // debug();
         // std::cout << "Proportion per table:\n";
         // check that all pending tables are scheduled
-        for (auto tbl : old_tables_with_data) {
+        old_tables_with_data.for_each([&](const Dump_reader::Table_data_info
+                                              *tbl) {
           const auto &table_key = tbl->key();
           if (std::count_if(threads.begin(), threads.end(),
                             [&](const Thread &thd) {
@@ -277,7 +372,7 @@ class Dump_scheduler : public ::testing::Test {
           // std::cout << table_key << "\t" << data_loaded[table_key] << " out
           // of "
           //           << tbl->bytes_available() << "\n";
-        }
+        });
       } else {
         // if there are fewer threads than tables
 
@@ -378,4 +473,173 @@ TEST_F(Dump_scheduler, load_scheduler) {
     test_scheduling(Dump_reader::schedule_chunk_proportionally, tables, 16);
   }
 }
+
+TEST_F(Dump_scheduler, load_scheduler_many_tables) {
+  constexpr std::size_t k_tables = 100000;
+  constexpr std::size_t k_threads = 16;
+
+  std::vector<Dump_reader::Table_info> tables;
+  tables.reserve(k_tables);
+
+  for (std::size_t i = 0; i < k_tables; ++i) {
+    tables.push_back(make_table("mytable-" + std::to_string(i), 0, 1, 1000));
+  }
+
+  Dump_reader::Tables_with_data tables_with_data;
+
+  for (auto &t : tables) {
+    for (auto &di : t.data_info) {
+      di.owner = &t;
+      tables_with_data.insert(&di);
+    }
+  }
+
+  std::unordered_multimap<std::string, size_t> tables_being_loaded;
+  std::deque<std::string> loading;
+  std::size_t scheduled = 0;
+  std::size_t previous_size = std::numeric_limits<std::size_t>::max();
+
+  while (const auto table = Dump_reader::schedule_chunk_proportionally(
+             tables_being_loaded, tables_with_data, k_threads, std::nullopt)) {
+    const auto size = table->available_chunks[0]->size();
+
+    // tables are not chunked, biggest ones are scheduled first
+    EXPECT_LE(size, previous_size);
+    previous_size = size;
+
+    tables_being_loaded.emplace(table->key(), size);
+    loading.emplace_back(table->key());
+    tables_with_data.consume_chunk(table);
+    ++scheduled;
+
+    if (loading.size() == k_threads) {
+      tables_being_loaded.erase(loading.front());
+      loading.pop_front();
+    }
+  }
+
+  EXPECT_EQ(k_tables, scheduled);
+  EXPECT_TRUE(tables_with_data.empty());
+}
+
+TEST_F(Dump_scheduler, load_scheduler_chunk_window) {
+  constexpr std::size_t k_threads = 4;
+  constexpr uint64_t k_window = 2;
+
+  auto table = make_table("mytable-1", 10, 20, 5);
+  auto &data = table.data_info.front();
+  data.owner = &table;
+
+  Dump_reader::Tables_with_data tables_with_data;
+  tables_with_data.insert(&data);
+
+  std::unordered_multimap<std::string, size_t> tables_being_loaded;
+
+  const auto schedule = [&]() {
+    const auto t = Dump_reader::schedule_chunk_proportionally(
+        tables_being_loaded, tables_with_data, k_threads, k_window);
+
+    if (t) {
+      const auto index = t->chunks_consumed;
+      tables_being_loaded.emplace(t->key(), 1);
+      t->chunks_in_flight.emplace(index);
+      tables_with_data.consume_chunk(t);
+    }
+
+    return t;
+  };
+
+  const auto loaded = [&](std::size_t index) {
+    tables_being_loaded.erase(tables_being_loaded.find(data.key()));
+    data.chunks_in_flight.erase(index);
+  };
+
+  // only two chunks can be loaded at the same time, even though there are
+  // more threads
+  EXPECT_EQ(&data, schedule());
+  EXPECT_EQ(&data, schedule());
+  EXPECT_EQ(nullptr, schedule());
+
+  // second chunk is loaded, window does not move until the first one is done
+  loaded(1);
+  EXPECT_EQ(nullptr, schedule());
+
+  loaded(0);
+  EXPECT_EQ(&data, schedule());
+  EXPECT_EQ(&data, schedule());
+  EXPECT_EQ(nullptr, schedule());
+  EXPECT_EQ(4, data.chunks_consumed);
+
+  // without the window, all threads are used
+  EXPECT_NE(nullptr,
+            Dump_reader::schedule_chunk_proportionally(
+                tables_being_loaded, tables_with_data, k_threads,
+                std::nullopt));
+}
+
+TEST_F(Dump_scheduler, chunk_loaded) {
+  auto table = make_table("mytable-1", 4, 20, 5);
+  auto &data = table.data_info.front();
+  data.owner = &table;
+
+  const auto schedule = [&data]() {
+    data.chunks_in_flight.emplace(data.chunks_consumed);
+    data.consume_chunk();
+  };
+
+  const auto loaded = [&data](std::size_t index) {
+    data.chunks_in_flight.erase(index);
+    ++data.chunks_loaded;
+  };
+
+  // nothing was loaded yet
+  for (int64_t i = -1; i < 5; ++i) {
+    EXPECT_FALSE(data.chunk_loaded(i)) << i;
+  }
+
+  schedule();
+  schedule();
+  schedule();
+
+  // checksums of chunks which are still being loaded cannot be verified
+  EXPECT_FALSE(data.chunk_loaded(0));
+  EXPECT_FALSE(data.chunk_loaded(1));
+  EXPECT_FALSE(data.chunk_loaded(2));
+
+  // chunks can finish out of order
+  loaded(1);
+  EXPECT_FALSE(data.chunk_loaded(0));
+  EXPECT_TRUE(data.chunk_loaded(1));
+  EXPECT_FALSE(data.chunk_loaded(2));
+  EXPECT_FALSE(data.chunk_loaded(3));
+
+  loaded(0);
+  loaded(2);
+  EXPECT_TRUE(data.chunk_loaded(0));
+  EXPECT_TRUE(data.chunk_loaded(2));
+  // not scheduled yet
+  EXPECT_FALSE(data.chunk_loaded(3));
+  // checksum of the whole table waits for all the chunks
+  EXPECT_FALSE(data.chunk_loaded(-1));
+
+  schedule();
+  loaded(3);
+  EXPECT_TRUE(data.chunk_loaded(3));
+  EXPECT_TRUE(data.chunk_loaded(-1));
+
+  // table which is not chunked is loaded at once
+  auto whole = make_table("mytable-2", 0, 20, 5);
+  auto &whole_data = whole.data_info.front();
+  whole_data.owner = &whole;
+
+  EXPECT_FALSE(whole_data.chunk_loaded(0));
+  EXPECT_FALSE(whole_data.chunk_loaded(-1));
+
+  whole_data.consume_chunk();
+  EXPECT_FALSE(whole_data.chunk_loaded(0));
+
+  ++whole_data.chunks_loaded;
+  EXPECT_TRUE(whole_data.chunk_loaded(0));
+  EXPECT_TRUE(whole_data.chunk_loaded(-1));
+}
 }  // namespace mysqlsh
@@ -24,13 +24,23 @@
 #include <iostream>
 #include <queue>
 #include <random>
+#include <string>
+#include <vector>
+
+#include <mysqld_error.h>
 
 #include "gtest_clean.h"
 
 #include "modules/util/import_table/chunk_file.h"
 #include "modules/util/import_table/import_table.h"
+#include "modules/util/import_table/load_data.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "mysqlshdk/libs/utils/version.h"
+#include "unittest/test_utils/mocks/gmock_clean.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_mysql_session.h"
 
 namespace mysqlsh {
 namespace import_table {
@@ -73,6 +83,17 @@ void TEST_CHUNKING(const std::string &path, const std::string &line_terminator,
   chunk_by_max_bytes(first, last, line_terminator, params..., on_new_chunk);
 
   validate_ranges(expected, &r);
+
+  // same, file mapped into memory
+  const auto contents = shcore::get_text_file(path);
+  const auto data = reinterpret_cast<const uint8_t *>(contents.data());
+  const auto end = data + contents.size();
+
+  chunk_by_max_bytes(Mapped_file_iterator{data, end, data},
+                     Mapped_file_iterator{data, end, end}, line_terminator,
+                     params..., on_new_chunk);
+
+  validate_ranges(expected, &r);
 }
 
 template <typename... Escape>
@@ -91,6 +112,22 @@ void TEST_SKIP_ROWS(const std::string &path, const std::string &line_terminator,
   }
 
   validate_ranges(expected, &r);
+
+  // same, file mapped into memory
+  const auto contents = shcore::get_text_file(path);
+  const auto data = reinterpret_cast<const uint8_t *>(contents.data());
+  const auto end = data + contents.size();
+  Mapped_file_iterator mapped_row{data, end, data};
+  const Mapped_file_iterator mapped_last{data, end, end};
+
+  while (mapped_row != mapped_last) {
+    auto previous = mapped_row;
+    mapped_row =
+        skip_rows(mapped_row, mapped_last, line_terminator, 1, escape...);
+    r.push(Range{previous.offset(), mapped_row.offset()});
+  }
+
+  validate_ranges(expected, &r);
 }
 
 TEST(import_table, double_buffer_iteration) {
@@ -613,6 +650,312 @@ TEST(import_table, twochar_aa_line_terminator_same_as_row_data) {
   shcore::delete_file(path, true);
 }
 
+TEST(import_table, chunk_file_marks_last_range) {
+  const std::string path{"import_table_chunk_file.dump"};
+  const std::string row_string = std::string(511, '_') + "\n";
+  std::string test_string{};
+
+  while (test_string.size() < 10 * kBufferSize) {
+    test_string += row_string;
+  }
+
+  shcore::create_file(path, test_string, true);
+
+  shcore::Synchronized_queue<File_import_info> queue;
+  Chunk_file chunk;
+  chunk.set_chunk_size(2 * kBufferSize);
+  chunk.set_handle_creator(
+      [&path]() { return mysqlshdk::storage::make_file(path); });
+  chunk.set_dialect(Dialect{});
+  chunk.set_rows_to_skip(1);
+  chunk.set_output_queue(&queue);
+  chunk.start();
+  queue.shutdown(1);
+
+  std::vector<File_import_info> ranges;
+
+  while (true) {
+    auto info = queue.pop();
+
+    if (info.is_guard) {
+      break;
+    }
+
+    ranges.emplace_back(std::move(info));
+  }
+
+  ASSERT_LT(1, ranges.size());
+
+  // first row is skipped
+  auto offset = row_string.size();
+
+  for (std::size_t i = 0; i < ranges.size(); ++i) {
+    SCOPED_TRACE(i);
+
+    EXPECT_TRUE(ranges[i].range_read);
+    EXPECT_EQ(offset, ranges[i].range.first);
+    EXPECT_EQ(i + 1 == ranges.size(), ranges[i].last_range);
+
+    offset = ranges[i].range.second;
+  }
+
+  EXPECT_EQ(test_string.size(), offset);
+
+  shcore::delete_file(path, true);
+}
+
+TEST(import_table, chunk_file_parallel) {
+  const std::string path{"import_table_chunk_file_parallel.dump"};
+  std::string test_string{};
+  std::size_t row = 0;
+
+  // rows of varying length, some of them longer than a chunk, with escaped
+  // line terminators
+  while (test_string.size() < 40 * kBufferSize) {
+    const auto length = 0 == row % 17 ? 3 * kBufferSize : 100 + row % 1000;
+    test_string += std::string(length / 2, 'a') + "\\\n" +
+                   std::string(length / 2, 'b') + "\n";
+    ++row;
+  }
+
+  shcore::create_file(path, test_string, true);
+
+  for (const auto mmap : {true, false}) {
+    for (const std::size_t threads : {1, 3, 8}) {
+      SCOPED_TRACE("mmap: " + std::to_string(mmap) +
+                   ", threads: " + std::to_string(threads));
+
+      shcore::Synchronized_queue<File_import_info> queue;
+      Chunk_file chunk;
+      chunk.set_chunk_size(2 * kBufferSize);
+      chunk.set_handle_creator(
+          [&path, &test_string,
+           mmap]() -> std::unique_ptr<mysqlshdk::storage::IFile> {
+            if (mmap) {
+              return mysqlshdk::storage::make_file(path);
+            }
+
+            // file which cannot be mapped into memory, read by File_handler
+            auto file =
+                std::make_unique<mysqlshdk::storage::backend::Memory_file>(
+                    path);
+            file->set_content(test_string);
+            return file;
+          });
+      chunk.set_dialect(Dialect{});
+      chunk.set_rows_to_skip(0);
+      chunk.set_output_queue(&queue);
+      chunk.set_threads(threads);
+      chunk.start();
+      queue.shutdown(1);
+
+      std::size_t offset = 0;
+      std::size_t ranges = 0;
+      bool last_range = false;
+
+      while (true) {
+        auto info = queue.pop();
+
+        if (info.is_guard) {
+          break;
+        }
+
+        ++ranges;
+
+        EXPECT_EQ(offset, info.range.first);
+        EXPECT_LT(info.range.first, info.range.second);
+        offset = info.range.second;
+        last_range = info.last_range;
+
+        // each range ends with an unescaped line terminator
+        ASSERT_LE(2, offset);
+        EXPECT_EQ('\n', test_string[offset - 1]);
+        EXPECT_NE('\\', test_string[offset - 2]);
+      }
+
+      EXPECT_LT(1, ranges);
+      EXPECT_TRUE(last_range);
+      EXPECT_EQ(test_string.size(), offset);
+    }
+  }
+
+  shcore::delete_file(path, true);
+}
+
 }  // namespace
+
+TEST(import_table, session_setup) {
+  using testing::_;
+  using testing::Invoke;
+  using testing::Return;
+
+  const auto setup = [](const char *version, const std::string &character_set,
+                        bool ready) {
+    Import_table_options options;
+    Import_table_options::options().unpack(
+        shcore::make_dict("schema", shcore::Value("sak'ila"), "table",
+                          shcore::Value("actor"), "characterSet",
+                          shcore::Value(character_set)),
+        &options);
+    options.set_session_ready(ready);
+
+    std::atomic<size_t> sent_bytes{0};
+    std::atomic<size_t> file_bytes{0};
+    volatile bool interrupt = false;
+    std::vector<std::exception_ptr> exceptions(1);
+    Stats stats;
+    Load_data_worker worker(options, 0, &sent_bytes, &file_bytes, &interrupt,
+                            nullptr, &exceptions, &stats);
+
+    auto session =
+        std::make_shared<testing::NiceMock<testing::Mock_mysql_session>>();
+    std::vector<std::string> statements;
+
+    ON_CALL(*session, get_server_version())
+        .WillByDefault(Return(mysqlshdk::utils::Version(version)));
+    ON_CALL(*session, executes(_, _))
+        .WillByDefault(Invoke([&statements](const char *sql, size_t len) {
+          statements.emplace_back(sql, len);
+        }));
+
+    worker.setup_session(session);
+
+    return statements;
+  };
+
+  // schema is selected and all variables are set using a single statement
+  EXPECT_EQ((std::vector<std::string>{
+                "USE `sak'ila`;",
+                "SET SQL_MODE = 'no_auto_value_on_zero', autocommit = 1, "
+                "unique_checks = 0, foreign_key_checks = 0, NAMES 'utf8mb4', "
+                "SESSION transaction_isolation = 'READ-UNCOMMITTED'",
+            }),
+            setup("8.0.35", "utf8mb4", false));
+
+  // character set is not set if it was not specified
+  EXPECT_EQ((std::vector<std::string>{
+                "USE `sak'ila`;",
+                "SET SQL_MODE = 'no_auto_value_on_zero', autocommit = 1, "
+                "unique_checks = 0, foreign_key_checks = 0, "
+                "SESSION transaction_isolation = 'READ-UNCOMMITTED'",
+            }),
+            setup("5.7.20", "", false));
+
+  // transaction_isolation is not available in older servers
+  EXPECT_EQ((std::vector<std::string>{
+                "USE `sak'ila`;",
+                "SET SQL_MODE = 'no_auto_value_on_zero', autocommit = 1, "
+                "unique_checks = 0, foreign_key_checks = 0, NAMES 'latin1'",
+                "SET SESSION TRANSACTION ISOLATION LEVEL READ UNCOMMITTED",
+            }),
+            setup("5.7.19", "latin1", false));
+
+  // session is already set up, nothing is executed
+  EXPECT_TRUE(setup("8.0.35", "utf8mb4", true).empty());
+}
+
+TEST(import_table, bulk_load_query) {
+  Import_table_options options;
+  Import_table_options::options().unpack(
+      shcore::make_dict("schema", shcore::Value("sak'ila"), "table",
+                        shcore::Value("actor"), "columns",
+                        shcore::Value(shcore::make_array("id", "first name"))),
+      &options);
+
+  std::atomic<size_t> sent_bytes{0};
+  std::atomic<size_t> file_bytes{0};
+  volatile bool interrupt = false;
+  std::vector<std::exception_ptr> exceptions(1);
+  Stats stats;
+  Load_data_worker worker(options, 0, &sent_bytes, &file_bytes, &interrupt,
+                          nullptr, &exceptions, &stats);
+
+  Bulk_load_options bulk;
+  bulk.url = "https://example.com/p/abc/o/sakila@actor.tsv.zst";
+  bulk.compression = mysqlshdk::storage::Compression::ZSTD;
+  bulk.in_primary_key_order = true;
+
+  // rows sorted by the primary key, compressed file
+  EXPECT_EQ(
+      "LOAD DATA FROM URL 'https://example.com/p/abc/o/sakila@actor.tsv.zst' "
+      "IN PRIMARY KEY ORDER INTO TABLE `sak'ila`.`actor` "
+      "COMPRESSION = 'ZSTD' " +
+          options.dialect().build_sql() +
+          " (`id`, `first name`) ALGORITHM = BULK",
+      worker.bulk_load_query(bulk));
+
+  // unsorted, uncompressed file
+  bulk.url = "https://example.com/p/abc/o/sakila@actor.tsv";
+  bulk.compression = mysqlshdk::storage::Compression::NONE;
+  bulk.in_primary_key_order = false;
+
+  EXPECT_EQ(
+      "LOAD DATA FROM URL 'https://example.com/p/abc/o/sakila@actor.tsv' "
+      "INTO TABLE `sak'ila`.`actor` " +
+          options.dialect().build_sql() +
+          " (`id`, `first name`) ALGORITHM = BULK",
+      worker.bulk_load_query(bulk));
+}
+
+TEST(import_table, bulk_load_failure) {
+  using testing::_;
+  using testing::Invoke;
+  using testing::Return;
+
+  Import_table_options options;
+  Import_table_options::options().unpack(
+      shcore::make_dict("schema", shcore::Value("sakila"), "table",
+                        shcore::Value("actor"), "characterSet",
+                        shcore::Value("utf8mb4")),
+      &options);
+
+  std::atomic<size_t> sent_bytes{0};
+  std::atomic<size_t> file_bytes{0};
+  volatile bool interrupt = false;
+  std::vector<std::exception_ptr> exceptions(1);
+  Stats stats;
+  Load_data_worker worker(options, 0, &sent_bytes, &file_bytes, &interrupt,
+                          nullptr, &exceptions, &stats);
+
+  auto session =
+      std::make_shared<testing::NiceMock<testing::Mock_mysql_session>>();
+  std::vector<std::string> statements;
+
+  ON_CALL(*session, get_server_version())
+      .WillByDefault(Return(mysqlshdk::utils::Version(8, 4, 0)));
+  ON_CALL(*session, executes(_, _))
+      .WillByDefault(Invoke([&statements](const char *sql, size_t len) {
+        statements.emplace_back(sql, len);
+
+        if (shcore::str_beginswith(statements.back(), "LOAD DATA FROM URL")) {
+          throw mysqlshdk::db::Error("This version of MySQL doesn't yet "
+                                     "support 'ALGORITHM = BULK'",
+                                     ER_NOT_SUPPORTED_YET);
+        }
+      }));
+
+  Bulk_load_options bulk;
+  bulk.url = "https://example.com/p/abc/o/sakila@actor.tsv";
+  bulk.data_bytes = 100;
+  bulk.file_bytes = 100;
+
+  int error = 0;
+
+  // failure is reported to the caller, data can be loaded using the fallback
+  EXPECT_FALSE(worker.execute_bulk(session, bulk, &error));
+  EXPECT_EQ(ER_NOT_SUPPORTED_YET, error);
+
+  // session was set up before the statement was executed
+  ASSERT_EQ(3, statements.size());
+  EXPECT_EQ("USE `sakila`;", statements[0]);
+  EXPECT_TRUE(shcore::str_beginswith(statements[2], "LOAD DATA FROM URL"));
+
+  // nothing was loaded
+  EXPECT_EQ(0, sent_bytes);
+  EXPECT_EQ(0, file_bytes);
+  EXPECT_EQ(0, stats.total_data_bytes);
+  EXPECT_EQ(0, stats.total_files_processed);
+}
+
 }  // namespace import_table
 }  // namespace mysqlsh
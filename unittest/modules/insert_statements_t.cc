@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/insert_statements.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace import_table {
+namespace {
+
+std::vector<Insert_statements::Column> columns(
+    const std::vector<std::string> &names) {
+  std::vector<Insert_statements::Column> result;
+
+  for (const auto &name : names) {
+    result.emplace_back(Insert_statements::Column{name, ""});
+  }
+
+  return result;
+}
+
+std::vector<std::string> convert(const std::string &data,
+                                 const Dialect &dialect,
+                                 std::vector<Insert_statements::Column> cols,
+                                 std::size_t max_size = 1024,
+                                 uint64_t skip_rows = 0) {
+  std::vector<std::string> result;
+
+  // the result should not depend on how data is split into blocks
+  for (std::size_t length : {1, 2, 3, 7, 1024}) {
+    SCOPED_TRACE("length: " + std::to_string(length));
+
+    std::vector<std::string> statements;
+    Insert_statements s{dialect, "INSERT INTO t", cols, max_size};
+    s.set_rows_to_skip(skip_rows);
+    s.on_statement([&statements](const std::string &stmt, std::size_t) {
+      statements.emplace_back(stmt);
+    });
+
+    for (std::size_t offset = 0; offset < data.length(); offset += length) {
+      s.append(data.data() + offset, std::min(length, data.length() - offset));
+    }
+
+    s.finish();
+
+    if (1 == length) {
+      result = std::move(statements);
+    } else {
+      EXPECT_EQ(result, statements);
+    }
+  }
+
+  return result;
+}
+
+TEST(Insert_statements, default_dialect) {
+  const auto dialect = Dialect::default_();
+
+  EXPECT_EQ(std::vector<std::string>{"INSERT INTO t (a,b) VALUES "
+                                     "('1','x'),('2',NULL),('3','y\tz\\n')"},
+            convert("1\tx\n2\t\\N\n3\ty\\tz\\n\n", dialect,
+                    columns({"a", "b"})));
+
+  // last row does not need to be terminated, missing fields are set to the
+  // default values, extra fields are ignored
+  EXPECT_EQ(std::vector<std::string>{"INSERT INTO t (a,b) VALUES "
+                                     "('1',DEFAULT),('2','x'),('3','')"},
+            convert("1\n2\tx\tz\n3\t", dialect, columns({"a", "b"})));
+
+  // escaped value which is not NULL, quotes are escaped
+  EXPECT_EQ(std::vector<std::string>{"INSERT INTO t (a) VALUES "
+                                     "('NN'),('\\'q\\''),('\\0')"},
+            convert("\\NN\n'q'\n\\0\n", dialect, columns({"a"})));
+}
+
+TEST(Insert_statements, csv_dialect) {
+  const auto dialect = Dialect::csv();
+
+  EXPECT_EQ(std::vector<std::string>{"INSERT INTO t (a,b) VALUES "
+                                     "('a,b','x\\\"y'),(NULL,'NULL'),"
+                                     "('q\\\"w','')"},
+            convert("\"a,b\",\"x\"\"y\"\r\nNULL,\"NULL\"\r\n\"q\"w\",\"\"\r\n",
+                    dialect, columns({"a", "b"})));
+}
+
+TEST(Insert_statements, json_dialect) {
+  const auto dialect = Dialect::json();
+
+  EXPECT_EQ(std::vector<std::string>{"INSERT INTO t (doc) VALUES "
+                                     "('{\\\"a\\\": 1}'),('{\\\"a\\\": 2}')"},
+            convert("{\"a\": 1}\n{\"a\": 2}\n", dialect, columns({"doc"})));
+}
+
+TEST(Insert_statements, lines_starting_by) {
+  auto dialect = Dialect::default_();
+  dialect.lines_starting_by = "xxx";
+
+  // lines without the prefix are skipped
+  EXPECT_EQ(std::vector<std::string>{"INSERT INTO t (a) VALUES ('1'),('3')"},
+            convert("xxx1\n2\nabcxxx3\n", dialect, columns({"a"})));
+}
+
+TEST(Insert_statements, decode_and_discard) {
+  std::vector<Insert_statements::Column> cols{
+      {"a", ""}, {"", ""}, {"b", "UNHEX"}};
+
+  EXPECT_EQ(std::vector<std::string>{"INSERT INTO t (a,b) VALUES "
+                                     "('1',UNHEX('41')),('2',NULL)"},
+            convert("1\tx\t41\n2\ty\t\\N\n", Dialect::default_(), cols));
+}
+
+TEST(Insert_statements, statement_size) {
+  const auto dialect = Dialect::default_();
+  const std::string data = "1\n2\n3\n4\n5\n";
+  const std::string prefix = "INSERT INTO t (a) VALUES ";
+
+  EXPECT_EQ((std::vector<std::string>{prefix + "('1'),('2')",
+                                      prefix + "('3'),('4')",
+                                      prefix + "('5')"}),
+            convert(data, dialect, columns({"a"}), prefix.length() + 11));
+
+  // rows longer than the limit are sent in separate statements
+  EXPECT_EQ((std::vector<std::string>{prefix + "('1')", prefix + "('2')",
+                                      prefix + "('3')", prefix + "('4')",
+                                      prefix + "('5')"}),
+            convert(data, dialect, columns({"a"}), 1));
+}
+
+TEST(Insert_statements, skip_rows) {
+  EXPECT_EQ(std::vector<std::string>{"INSERT INTO t (a) VALUES ('3')"},
+            convert("1\n2\n3\n", Dialect::default_(), columns({"a"}), 1024, 2));
+
+  EXPECT_TRUE(
+      convert("1\n2\n3\n", Dialect::default_(), columns({"a"}), 1024, 3)
+          .empty());
+}
+
+}  // namespace
+}  // namespace import_table
+}  // namespace mysqlsh
@@ -1468,6 +1468,91 @@ TEST_F(Instance_cache_test, table_columns) {
   }
 }
 
+TEST_F(Instance_cache_test, columns_order) {
+  {
+    // setup, columns are added and moved, so their ordinal positions differ
+    // from the order in which they were created
+    m_session->execute("CREATE SCHEMA first;");
+    m_session->execute(
+        "CREATE TABLE first.one (c3 INT, c5 INT, gen INT AS (c3 + 1), c6 "
+        "INT);");
+    m_session->execute("ALTER TABLE first.one ADD COLUMN c0 INT FIRST;");
+    m_session->execute("ALTER TABLE first.one ADD COLUMN c4 INT AFTER c3;");
+    m_session->execute("ALTER TABLE first.one ADD COLUMN c1 INT AFTER c0;");
+    m_session->execute("ALTER TABLE first.one ADD COLUMN c2 INT AFTER c1;");
+    m_session->execute("ALTER TABLE first.one MODIFY COLUMN c6 INT FIRST;");
+    m_session->execute(
+        "CREATE VIEW first.two AS SELECT c6, c2, c0, gen FROM first.one;");
+
+    // many tables, each one with many columns
+    for (int t = 0; t < 20; ++t) {
+      std::string columns;
+
+      for (int c = 0; c < 30; ++c) {
+        columns += ", c" + std::to_string(c) + " INT";
+      }
+
+      m_session->execute("CREATE TABLE first.t" + std::to_string(t) +
+                         " (id INT" + columns + ");");
+    }
+  }
+
+  {
+    SCOPED_TRACE("test order of columns");
+
+    Filtering_options filters;
+    filters.schemas().include("first");
+
+    const auto cache =
+        Instance_cache_builder(m_session, filters).metadata({}).build();
+
+    const auto validate = [](const auto &object,
+                             const std::vector<std::string> &expected) {
+      ASSERT_EQ(expected.size(), object.all_columns.size());
+
+      for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(expected[i], object.all_columns[i].name);
+      }
+
+      // non-generated columns point to the final location of the columns
+      std::vector<const Instance_cache::Column *> columns;
+
+      for (const auto &column : object.all_columns) {
+        if (!column.generated) {
+          columns.emplace_back(&column);
+        }
+      }
+
+      EXPECT_EQ(columns, object.columns);
+    };
+
+    const auto &schema = cache.schemas.at("first");
+
+    {
+      SCOPED_TRACE("testing table first.one");
+      validate(schema.tables.at("one"),
+               {"c6", "c0", "c1", "c2", "c3", "c4", "c5", "gen"});
+    }
+
+    {
+      SCOPED_TRACE("testing view first.two");
+      validate(schema.views.at("two"), {"c6", "c2", "c0", "gen"});
+    }
+
+    std::vector<std::string> expected = {"id"};
+
+    for (int c = 0; c < 30; ++c) {
+      expected.emplace_back("c" + std::to_string(c));
+    }
+
+    for (int t = 0; t < 20; ++t) {
+      const auto name = "t" + std::to_string(t);
+      SCOPED_TRACE("testing table first." + name);
+      validate(schema.tables.at(name), expected);
+    }
+  }
+}
+
 TEST_F(Instance_cache_test, table_indexes) {
   {
     // setup
@@ -1725,6 +1810,104 @@ TEST_F(Instance_cache_test, table_histograms) {
   }
 }
 
+TEST_F(Instance_cache_test, parallel_metadata) {
+  {
+    // setup
+    m_session->execute("CREATE SCHEMA first;");
+    m_session->execute(
+        "CREATE TABLE first.one (id INT PRIMARY KEY, data INT, gen INT AS "
+        "(data + 1));");
+    m_session->execute("CREATE VIEW first.two AS SELECT id FROM first.one;");
+    m_session->execute("CREATE SCHEMA second;");
+    m_session->execute(
+        "CREATE TABLE second.three (id INT NOT NULL, data INT, "
+        "UNIQUE INDEX (id)) PARTITION BY HASH(id) PARTITIONS 2;");
+    m_session->execute("CREATE TABLE second.four (id INT, data INT);");
+    m_session->execute("CREATE SCHEMA third;");
+    m_session->execute("CREATE TABLE third.five (id INT PRIMARY KEY);");
+  }
+
+  {
+    SCOPED_TRACE("test parallel fetching of metadata");
+
+    Filtering_options filters;
+    filters.schemas().include("first");
+    filters.schemas().include("second");
+    filters.schemas().include("third");
+
+    const auto expected =
+        Instance_cache_builder(m_session, filters).metadata({}).build();
+
+    Instance_cache_builder::Sessions sessions;
+
+    for (int i = 0; i < 2; ++i) {
+      sessions.emplace_back(connect_session());
+    }
+
+    const auto actual = Instance_cache_builder(m_session, filters)
+                            .metadata({}, sessions)
+                            .build();
+
+    for (const auto &session : sessions) {
+      session->close();
+    }
+
+    ASSERT_EQ(3, actual.schemas.size());
+
+    const auto columns = [](const auto &object) {
+      std::vector<std::string> result;
+
+      for (const auto &column : object.all_columns) {
+        result.emplace_back(column.name);
+      }
+
+      return result;
+    };
+
+    for (const auto &schema : expected.schemas) {
+      SCOPED_TRACE("testing schema " + schema.first);
+
+      verify(actual, schema.first, schema.second);
+
+      const auto &s = actual.schemas.at(schema.first);
+
+      for (const auto &table : schema.second.tables) {
+        SCOPED_TRACE("testing table " + table.first);
+
+        const auto &t = s.tables.at(table.first);
+
+        EXPECT_EQ(columns(table.second), columns(t));
+        EXPECT_EQ(table.second.columns.size(), t.columns.size());
+        EXPECT_EQ(table.second.indexes.size(), t.indexes.size());
+        EXPECT_EQ(table.second.partitions.size(), t.partitions.size());
+
+        const auto expected_index = select_index(table.second);
+        const auto actual_index = select_index(t);
+
+        EXPECT_EQ(expected_index.second, actual_index.second);
+        ASSERT_EQ(!!expected_index.first, !!actual_index.first);
+
+        if (expected_index.first) {
+          EXPECT_EQ(expected_index.first->columns_sql(),
+                    actual_index.first->columns_sql());
+        }
+      }
+
+      for (const auto &view : schema.second.views) {
+        SCOPED_TRACE("testing view " + view.first);
+
+        const auto &v = s.views.at(view.first);
+
+        EXPECT_EQ(columns(view.second), columns(v));
+        EXPECT_EQ(view.second.character_set_client, v.character_set_client);
+      }
+    }
+
+    EXPECT_EQ(
+        2, actual.schemas.at("second").tables.at("three").partitions.size());
+  }
+}
+
 #if defined(_WIN32) || defined(__APPLE__)
 TEST_F(Instance_cache_test, filter_schemas_and_tables_case_sensitive) {
   {
@@ -42,10 +42,13 @@
 extern "C" const char *g_test_home;
 
 using ::testing::_;
+using ::testing::AllOf;
 using ::testing::AtLeast;
 using ::testing::Exactly;
+using ::testing::HasSubstr;
 using ::testing::Return;
 using ::testing::ReturnRef;
+using ::testing::StartsWith;
 using ::testing::StrEq;
 
 using mysqlshdk::utils::Version;
@@ -120,6 +123,29 @@ TEST(Load_dump, sql_transforms_strip_sql_mode) {
             "sql_mode='ANSI_QUOTES,NO_AUTO_CREATE_USER,NO_ZERO_DATE' */"));
 }
 
+TEST(Load_dump, sql_transforms_chained) {
+  Dump_loader::Sql_transform tx;
+  tx.add_strip_removed_sql_modes();
+  tx.add_rename_schema("new");
+
+  const auto call = [&tx](std::string_view s) {
+    std::string tmp;
+    EXPECT_TRUE(tx(s, &tmp));
+    return tmp;
+  };
+
+  // statements which are not modified by any of the transforms
+  EXPECT_EQ("SELECT 1", call("SELECT 1"));
+  EXPECT_EQ("SET sql_mode='ANSI_QUOTES'", call("SET sql_mode='ANSI_QUOTES'"));
+  EXPECT_EQ("CREATE TABLE t (a int)", call("CREATE TABLE t (a int)"));
+
+  // statements modified by one of the transforms
+  EXPECT_EQ("SET sql_mode=''", call("SET sql_mode='NO_AUTO_CREATE_USER'"));
+  EXPECT_EQ("USE `new`", call("USE `old`"));
+  EXPECT_EQ("CREATE DATABASE IF NOT EXISTS `new` CHARSET utf8mb4",
+            call("CREATE DATABASE IF NOT EXISTS `old` CHARSET utf8mb4"));
+}
+
 TEST(Load_dump, add_execute_conditionally) {
   const auto call = [](const Dump_loader::Sql_transform &tx,
                        std::string_view s) {
@@ -430,15 +456,27 @@ class Load_dump_mocked : public Shell_core_test_wrapper {
               .WillRepeatedly(Return(m_session_count));
           EXPECT_CALL(*mock, is_open()).WillRepeatedly(Return(false));
 
+          // all session variables are set using a single statement
+          const auto setup =
+              AllOf(StartsWith("SET SESSION net_read_timeout = "),
+                    HasSubstr(", foreign_key_checks = 0, unique_checks = 0, "
+                              "SQL_MODE = 'NO_AUTO_VALUE_ON_ZERO'"));
+
           if (m_auto_generate_pk_value &&
               *m_auto_generate_pk_value != m_create_invisible_pks) {
-            // this query is executed only if the requested value is different
+            // this variable is set only if the requested value is different
             // from the current value
-            const auto query = shcore::sqlformat(
-                "SET @@SESSION.sql_generate_invisible_primary_key=?",
+            const auto variable = shcore::sqlformat(
+                ", @@SESSION.sql_generate_invisible_primary_key=?",
                 m_create_invisible_pks);
-            EXPECT_CALL(*mock, executes(StrEq(query.c_str()), _))
+            EXPECT_CALL(*mock, executes(AllOf(setup, HasSubstr(variable)), _))
                 .Times(Exactly(1));
+          } else {
+            EXPECT_CALL(*mock, executes(HasSubstr("sql_generate_invisible_"
+                                                  "primary_key"),
+                                        _))
+                .Times(Exactly(0));
+            EXPECT_CALL(*mock, executes(setup, _)).Times(Exactly(1));
           }
 
           {
@@ -549,6 +587,15 @@ class Load_dump_mocked : public Shell_core_test_wrapper {
           .add_row({"partial_revokes", "OFF"});
     }
 
+    if (Version(m_version) >= Version(8, 0, 0)) {
+      mock_main_session
+          ->expect_query(
+              "SELECT COUNT(*) FROM performance_schema.global_variables WHERE "
+              "VARIABLE_NAME LIKE 'bulk\\_loader.%'")
+          .then({"COUNT(*)"})
+          .add_row({m_bulk_loader_variables});
+    }
+
     mock_main_session
         ->expect_query(
             "SELECT VARIABLE_VALUE = 'OFF' FROM "
@@ -628,6 +675,7 @@ class Load_dump_mocked : public Shell_core_test_wrapper {
   std::function<void(const std::string &)> m_on_load_data;
 
   std::string m_version = "8.0.20";
+  std::string m_bulk_loader_variables = "0";
   mysqlshdk::null_bool m_auto_generate_pk_value;
   bool m_create_invisible_pks = false;
 };
@@ -677,6 +725,13 @@ TEST_F(Load_dump_mocked, filter_user_script_for_mds) {
       .then({"Variable_name", "Value"})
       .add_row({"partial_revokes", "OFF"});
 
+  mock_main_session
+      ->expect_query(
+          "SELECT COUNT(*) FROM performance_schema.global_variables WHERE "
+          "VARIABLE_NAME LIKE 'bulk\\_loader.%'")
+      .then({"COUNT(*)"})
+      .add_row({"0"});
+
   options.set_session(mock_main_session);
 
   Dump_loader loader(options);
@@ -761,4 +816,24 @@ TEST_F(Load_dump_mocked, bug_34110375) {
   load_dump(4, false, "createInvisiblePKs", m_create_invisible_pks);
 }
 
+TEST_F(Load_dump_mocked, bulk_load_supported) {
+  const auto bulk_load_supported = [this]() {
+    Load_dump_options options;
+    options.set_session(make_mock_main_session());
+    return options.bulk_load_supported();
+  };
+
+  // bulk loader variables are not present
+  m_bulk_loader_variables = "0";
+  EXPECT_FALSE(bulk_load_supported());
+
+  // bulk loader variables are present
+  m_bulk_loader_variables = "3";
+  EXPECT_TRUE(bulk_load_supported());
+
+  // bulk loader is not available in 5.7, server is not asked
+  m_version = "5.7.40";
+  EXPECT_FALSE(bulk_load_supported());
+}
+
 }  // namespace mysqlsh
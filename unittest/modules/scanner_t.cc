@@ -60,7 +60,8 @@ void test_scanner(const std::string &data,
   for (auto skip : skip_rows) {
     SCOPED_TRACE("skip: " + std::to_string(skip));
 
-    for (std::size_t length = 1; length < 5; ++length) {
+    // long blocks are scanned using the vectorized search
+    for (std::size_t length : {1, 2, 3, 4, 17, 64}) {
       SCOPED_TRACE("length: " + std::to_string(length));
 
       Scanner s{dialect, skip};
@@ -196,6 +197,47 @@ TEST(Scanner, rows) {
   }
 }
 
+TEST(Scanner, long_fields) {
+  const std::string a(40, 'a');
+  const std::string b(20, 'b');
+  // fields are longer than the vectorized search block
+  const std::string file_template =
+      // 126 + 2 * FT + LT
+      "'" + a + "'<ft>" + b + "<ft>'" + b + "\\'" + a + "'<lt>" +
+      // 101 + FT + 2 * LT
+      a + "\\<lt>" + b + "<ft>" + a + "<lt>" +
+      // 124 + FT + LT
+      "'" + b + "''" + a + "<lt>" + b + "'<ft>" + a;
+
+  for (const auto field_terminator : {"+,", ","}) {
+    for (const auto line_terminator : {"\r\n", "\n"}) {
+      const auto file = shcore::str_subvars(
+          file_template,
+          [&field_terminator, &line_terminator](std::string_view name) {
+            if (name == "ft") {
+              return field_terminator;
+            } else {
+              return line_terminator;
+            }
+          },
+          "<", ">");
+
+      Dialect dialect;
+      dialect.fields_enclosed_by = "'";
+      dialect.fields_escaped_by = "\\";
+      dialect.fields_terminated_by = field_terminator;
+      dialect.lines_terminated_by = line_terminator;
+
+      const auto ft = dialect.fields_terminated_by.length();
+      const auto lt = dialect.lines_terminated_by.length();
+
+      test_scanner(file,
+                   {126 + 2 * ft + lt, 101 + ft + 2 * lt, 124 + ft + lt},
+                   dialect, {0, 1, 2});
+    }
+  }
+}
+
 }  // namespace
 }  // namespace import_table
 }  // namespace mysqlsh
@@ -218,5 +218,22 @@ TEST(Transaction_buffer, test_subchunking) {
   std::cout << count << "\n";
 }
 
+TEST(Transaction_buffer, test_subchunking_in_place) {
+  // transactions are much bigger than the network buffer, most of the reads
+  // go directly to the network buffer
+  for (int max_trx_size = 40; max_trx_size < 60; max_trx_size += 3) {
+    for (int net_buffer = 10; net_buffer < 15; net_buffer++) {
+      for (int first_row_size = 0; first_row_size < 30; first_row_size += 2) {
+        for (int row_size = 0; row_size < 30; row_size++) {
+          for (int row_size_var = 0; row_size_var < 30; row_size_var += 5) {
+            test_subchunking(max_trx_size, net_buffer, first_row_size, 20,
+                             row_size, row_size_var);
+          }
+        }
+      }
+    }
+  }
+}
+
 }  // namespace import_table
 }  // namespace mysqlsh
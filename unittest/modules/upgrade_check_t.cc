@@ -1899,6 +1899,35 @@ TEST_F(MySQL_upgrade_check_test, deprecated_auth_method_json_check) {
   }
 }
 
+TEST_F(MySQL_upgrade_check_test, threads) {
+  SKIP_IF_NOT_5_7_UP_TO(Version(MYSH_VERSION));
+
+  Util util(_interactive_shell->shell_context().get());
+  const auto connection_options = shcore::get_connection_options(_mysql_uri);
+
+  shcore::Option_pack_ref<Upgrade_check_options> options;
+  options->output_format = "JSON";
+  options->threads = 0;
+
+  EXPECT_THROW_LIKE(util.check_for_server_upgrade(connection_options, options),
+                    shcore::Exception,
+                    "The value of 'threads' option must be greater than 0.");
+
+  const auto run = [&](uint64_t threads) {
+    wipe_all();
+    options->threads = threads;
+    EXPECT_NO_THROW(util.check_for_server_upgrade(connection_options, options));
+    return output_handler.std_out;
+  };
+
+  // checks executed concurrently are reported in the same order and with the
+  // same results
+  const auto serial = run(1);
+  ASSERT_FALSE(serial.empty());
+  EXPECT_EQ(serial, run(4));
+  EXPECT_EQ(serial, run(100));
+}
+
 const std::vector<std::string> k_auth_method_false_positives = {
     "root@localhost", "mysql.session@localhost", "mysql.sys@localhost",
     "root@%"};
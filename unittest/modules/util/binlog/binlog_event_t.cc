@@ -0,0 +1,470 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "modules/util/binlog/binlog_event.h"
+#include "mysqlshdk/libs/utils/crc32c.h"
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace binlog {
+
+namespace {
+
+using namespace std::string_literals;
+
+const auto k_sid =
+    "\x3e\x11\xfa\x47\x71\xca\x11\xe1\x9e\x33\xc8\x0a\xa9\x42\x95\x62"s;
+const auto k_uuid = "3e11fa47-71ca-11e1-9e33-c80aa9429562"s;
+
+void append_int(uint64_t value, std::size_t bytes, std::string *out) {
+  for (std::size_t i = 0; i < bytes; ++i) {
+    *out += static_cast<char>((value >> (8 * i)) & 0xFF);
+  }
+}
+
+void append_packed(uint64_t value, std::string *out) {
+  if (value < 251) {
+    append_int(value, 1, out);
+  } else if (value < 0x10000) {
+    *out += '\xFC';
+    append_int(value, 2, out);
+  } else if (value < 0x1000000) {
+    *out += '\xFD';
+    append_int(value, 3, out);
+  } else {
+    *out += '\xFE';
+    append_int(value, 8, out);
+  }
+}
+
+std::string event(Event_type type, const std::string &body, bool checksum,
+                  uint16_t flags = 0) {
+  std::string e;
+
+  append_int(1000, 4, &e);  // timestamp
+  append_int(static_cast<uint8_t>(type), 1, &e);
+  append_int(1, 4, &e);  // server ID
+  append_int(k_event_header_size + body.size() +
+                 (checksum ? k_event_checksum_size : 0),
+             4, &e);
+  append_int(0, 4, &e);  // log position
+  append_int(flags, 2, &e);
+
+  e += body;
+
+  if (checksum) {
+    append_int(mysqlshdk::utils::crc32(e.data(), e.size()), 4, &e);
+  }
+
+  return e;
+}
+
+std::string format_description(bool checksum, bool in_use = false) {
+  std::string body;
+
+  append_int(4, 2, &body);  // binlog version
+  body += "8.0.36"s + std::string(44, '\0');
+  append_int(0, 4, &body);                   // create timestamp
+  append_int(k_event_header_size, 1, &body);  // header length
+  body += std::string(41, '\0');             // post-header lengths
+  append_int(checksum ? 1 : 0, 1, &body);     // checksum algorithm
+
+  // the checksum is always present, computed without the "in use" flag
+  auto e = event(Event_type::FORMAT_DESCRIPTION, body, true);
+
+  if (in_use) {
+    e[17] |= 0x1;
+  }
+
+  return e;
+}
+
+std::string gtid(uint64_t gno, bool checksum, int64_t last_committed = 0,
+                 int64_t sequence_number = 1) {
+  std::string body;
+
+  append_int(1, 1, &body);  // flags
+  body += k_sid;
+  append_int(gno, 8, &body);
+  append_int(2, 1, &body);  // logical timestamp type code
+  append_int(last_committed, 8, &body);
+  append_int(sequence_number, 8, &body);
+
+  return event(Event_type::GTID, body, checksum);
+}
+
+std::string query(const std::string &q, bool checksum,
+                  const std::string &db = "test") {
+  std::string body;
+
+  append_int(7, 4, &body);  // thread ID
+  append_int(0, 4, &body);  // execution time
+  append_int(db.size(), 1, &body);
+  append_int(0, 2, &body);  // error code
+  append_int(0, 2, &body);  // status variables length
+  body += db;
+  body += '\0';
+  body += q;
+
+  return event(Event_type::QUERY, body, checksum);
+}
+
+std::string xid(bool checksum) {
+  std::string body;
+  append_int(1234, 8, &body);
+  return event(Event_type::XID, body, checksum);
+}
+
+std::string intvar(uint8_t type, uint64_t value, bool checksum) {
+  std::string body;
+  append_int(type, 1, &body);
+  append_int(value, 8, &body);
+  return event(Event_type::INTVAR, body, checksum);
+}
+
+std::string rows(Event_type type, bool statement_end, bool checksum) {
+  std::string body;
+  append_int(42, 6, &body);  // table ID
+  append_int(statement_end ? 1 : 0, 2, &body);
+  body += "row data";
+  return event(type, body, checksum);
+}
+
+std::string base64(const std::string &data) {
+  std::string encoded;
+  shcore::encode_base64(reinterpret_cast<const unsigned char *>(data.data()),
+                        static_cast<int>(data.size()), &encoded);
+  return encoded;
+}
+
+Transaction build(Transaction_builder *builder,
+                  const std::vector<std::string> &events) {
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    const auto completed = builder->add(events[i]);
+
+    if (i + 1 < events.size()) {
+      EXPECT_FALSE(completed) << "event #" << i;
+    } else {
+      EXPECT_TRUE(completed) << "event #" << i;
+    }
+  }
+
+  return builder->take();
+}
+
+std::string decimal(const std::string &bin, uint32_t precision,
+                    uint32_t scale) {
+  std::string_view data{bin};
+  auto result = decode_decimal(&data, precision, scale);
+  EXPECT_TRUE(data.empty());
+  return result;
+}
+
+}  // namespace
+
+TEST(Binlog_event_test, decode_decimal) {
+  EXPECT_EQ("123.45", decimal("\x80\x7B\x2D", 5, 2));
+  EXPECT_EQ("-123.45", decimal("\x7F\x84\xD2", 5, 2));
+  EXPECT_EQ("0.00", decimal("\x80\x00\x00"s, 5, 2));
+  EXPECT_EQ("1234.5678", decimal("\x80\x04\xD2\x16\x2E", 10, 4));
+  EXPECT_EQ("123456789.000000001",
+            decimal("\x87\x5B\xCD\x15\x00\x00\x00\x01"s, 18, 9));
+  EXPECT_EQ("42", decimal("\x80\x2A", 3, 0));
+
+  std::string_view truncated{"\x80\x7B"};
+  EXPECT_THROW(decode_decimal(&truncated, 5, 2), std::runtime_error);
+}
+
+TEST(Binlog_event_test, gtid_intervals) {
+  Gtid_intervals intervals{mysqlshdk::mysql::Gtid_set::from_string(
+      "3E11FA47-71CA-11E1-9E33-C80AA9429562:1-5:7")};
+
+  EXPECT_FALSE(intervals.empty());
+  EXPECT_EQ(6u, intervals.count());
+
+  EXPECT_TRUE(intervals.contains(k_uuid, 1));
+  EXPECT_TRUE(intervals.contains(k_uuid, 5));
+  EXPECT_FALSE(intervals.contains(k_uuid, 6));
+  EXPECT_TRUE(intervals.contains(k_uuid, 7));
+  EXPECT_FALSE(intervals.contains(k_uuid, 8));
+  EXPECT_FALSE(intervals.contains("00000000-0000-0000-0000-000000000000", 1));
+
+  intervals.add(k_uuid, 6);
+  intervals.add(k_uuid, 9);
+
+  EXPECT_EQ(k_uuid + ":1-7:9", intervals.to_gtid_set().str());
+  EXPECT_EQ(8u, intervals.count());
+}
+
+TEST(Binlog_event_test, format_description) {
+  {
+    const auto format = parse_format_description(format_description(true));
+    EXPECT_TRUE(format.checksum);
+    EXPECT_EQ("8.0.36", format.server_version);
+  }
+
+  {
+    const auto format = parse_format_description(format_description(false));
+    EXPECT_FALSE(format.checksum);
+  }
+
+  {
+    // the "in use" flag is cleared, checksum is still valid
+    const auto format =
+        parse_format_description(format_description(true, true));
+    EXPECT_TRUE(format.checksum);
+    EXPECT_EQ(format_description(true), format.event);
+  }
+
+  {
+    auto fde = format_description(true);
+    fde[k_event_header_size + 2] = 'X';
+    EXPECT_THROW(parse_format_description(fde), std::runtime_error);
+  }
+}
+
+TEST(Binlog_event_test, parse_gtid) {
+  const auto g = parse_gtid(gtid(17, true, 3, 5), true);
+
+  EXPECT_EQ(k_uuid, g.uuid);
+  EXPECT_EQ(17u, g.gno);
+  EXPECT_EQ(3, g.last_committed);
+  EXPECT_EQ(5, g.sequence_number);
+  EXPECT_EQ(k_uuid + ":17", g.gtid());
+
+  EXPECT_THROW(
+      parse_gtid(event(Event_type::ANONYMOUS_GTID, std::string(42, '\0'),
+                       false),
+                 false),
+      std::runtime_error);
+}
+
+TEST(Binlog_event_test, next_event) {
+  const auto first = query("BEGIN", true);
+  const auto second = xid(true);
+  const auto all = first + second;
+  std::string_view data{all};
+
+  EXPECT_EQ(first, next_event(&data));
+  EXPECT_EQ(second, next_event(&data));
+  EXPECT_TRUE(data.empty());
+
+  std::string_view truncated{all.data(), all.size() - 1};
+  next_event(&truncated);
+  EXPECT_THROW(next_event(&truncated), std::runtime_error);
+}
+
+TEST(Binlog_event_test, statement_transaction) {
+  for (const auto checksum : {true, false}) {
+    SCOPED_TRACE(checksum ? "checksum" : "no checksum");
+
+    Collations collations;
+    Transaction_builder builder{&collations};
+
+    const auto t = build(&builder, {
+                                       format_description(checksum),
+                                       gtid(1, checksum),
+                                       query("BEGIN", checksum),
+                                       intvar(2, 5, checksum),
+                                       query("INSERT INTO t VALUES (NULL)",
+                                             checksum),
+                                       xid(checksum),
+                                   });
+
+    EXPECT_EQ(k_uuid + ":1", t.gtid.gtid());
+    EXPECT_FALSE(t.has_row_events);
+    EXPECT_EQ(builder.format(), t.format);
+    EXPECT_FALSE(builder.in_transaction());
+
+    const std::vector<std::string> expected = {
+        "BEGIN",
+        "SET INSERT_ID=5",
+        "SET TIMESTAMP=1000, @@session.pseudo_thread_id=7",
+        "USE `test`",
+        "INSERT INTO t VALUES (NULL)",
+        "COMMIT",
+    };
+    EXPECT_EQ(expected, t.statements);
+  }
+}
+
+TEST(Binlog_event_test, ddl_transaction) {
+  Collations collations;
+  Transaction_builder builder{&collations};
+
+  builder.add(format_description(true));
+
+  const auto t = build(&builder, {
+                                     gtid(2, true),
+                                     query("CREATE TABLE t (a INT)", true),
+                                 });
+
+  const std::vector<std::string> expected = {
+      "SET TIMESTAMP=1000, @@session.pseudo_thread_id=7",
+      "USE `test`",
+      "CREATE TABLE t (a INT)",
+  };
+  EXPECT_EQ(expected, t.statements);
+}
+
+TEST(Binlog_event_test, row_transaction) {
+  Collations collations;
+  Transaction_builder builder{&collations};
+
+  builder.add(format_description(true));
+
+  const auto table_map = event(Event_type::TABLE_MAP, "table map", true);
+  const auto write_rows = rows(Event_type::WRITE_ROWS, true, true);
+
+  const auto t = build(&builder, {
+                                     gtid(3, true),
+                                     query("BEGIN", true),
+                                     table_map,
+                                     write_rows,
+                                     xid(true),
+                                 });
+
+  EXPECT_TRUE(t.has_row_events);
+
+  const std::vector<std::string> expected = {
+      "BEGIN",
+      "BINLOG '" + base64(table_map + write_rows) + "'",
+      "COMMIT",
+  };
+  EXPECT_EQ(expected, t.statements);
+}
+
+TEST(Binlog_event_test, transaction_payload) {
+  Collations collations;
+  Transaction_builder builder{&collations};
+
+  builder.add(format_description(true));
+
+  // events stored in the payload do not have checksums
+  const auto payload = query("BEGIN", false) + intvar(1, 9, false) +
+                       query("INSERT INTO t VALUES (1)", false) + xid(false);
+  std::string body;
+
+  append_packed(2, &body);  // compression
+  append_packed(3, &body);
+  append_packed(255, &body);
+  append_packed(1, &body);  // size
+  append_packed(payload.size() < 251 ? 1 : 3, &body);
+  append_packed(payload.size(), &body);
+  append_packed(0, &body);  // end mark
+  body += payload;
+
+  const auto t = build(&builder,
+                       {
+                           gtid(4, true),
+                           event(Event_type::TRANSACTION_PAYLOAD, body, true),
+                       });
+
+  const std::vector<std::string> expected = {
+      "BEGIN",
+      "SET LAST_INSERT_ID=9",
+      "SET TIMESTAMP=1000, @@session.pseudo_thread_id=7",
+      "USE `test`",
+      "INSERT INTO t VALUES (1)",
+      "COMMIT",
+  };
+  EXPECT_EQ(expected, t.statements);
+}
+
+TEST(Binlog_event_test, errors) {
+  Collations collations;
+
+  {
+    // checksum mismatch
+    Transaction_builder builder{&collations};
+    builder.add(format_description(true));
+
+    auto g = gtid(5, true);
+    g[k_event_header_size + 1] ^= 0x1;
+
+    EXPECT_THROW(builder.add(g), std::runtime_error);
+  }
+
+  {
+    // format description is missing
+    Transaction_builder builder{&collations};
+    EXPECT_THROW(builder.add(gtid(5, false)), std::runtime_error);
+  }
+
+  {
+    // event outside of a transaction
+    Transaction_builder builder{&collations};
+    builder.add(format_description(true));
+    EXPECT_THROW(builder.add(query("BEGIN", true)), std::runtime_error);
+  }
+
+  {
+    // XA transaction
+    Transaction_builder builder{&collations};
+    builder.add(format_description(true));
+    builder.add(gtid(6, true));
+    EXPECT_THROW(builder.add(query("XA START 'x'", true)),
+                 std::runtime_error);
+  }
+
+  {
+    // incomplete transaction
+    Transaction_builder builder{&collations};
+    builder.add(format_description(true));
+    builder.add(gtid(7, true));
+    builder.add(query("BEGIN", true));
+    EXPECT_TRUE(builder.in_transaction());
+    EXPECT_THROW(builder.add(gtid(8, true)), std::runtime_error);
+  }
+
+  {
+    // unknown event which cannot be ignored
+    Transaction_builder builder{&collations};
+    builder.add(format_description(true));
+    builder.add(gtid(9, true));
+    builder.add(query("BEGIN", true));
+    EXPECT_THROW(builder.add(event(static_cast<Event_type>(200), "", true)),
+                 std::runtime_error);
+  }
+
+  {
+    // unknown event which can be ignored
+    Transaction_builder builder{&collations};
+    builder.add(format_description(true));
+    builder.add(gtid(10, true));
+    builder.add(query("BEGIN", true));
+    EXPECT_FALSE(builder.add(event(static_cast<Event_type>(200), "", true,
+                                   k_event_ignorable_flag)));
+  }
+}
+
+}  // namespace binlog
+}  // namespace mysqlsh
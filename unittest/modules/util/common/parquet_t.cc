@@ -0,0 +1,671 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <lz4.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/common/parquet/compression.h"
+#include "modules/util/common/parquet/encoding.h"
+#include "modules/util/common/parquet/format.h"
+#include "modules/util/common/parquet/thrift_compact.h"
+#include "modules/util/common/parquet/utils.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+namespace mysqlsh {
+namespace parquet {
+
+namespace {
+
+std::string bytes(std::initializer_list<int> values) {
+  std::string result;
+
+  for (const auto v : values) {
+    result.push_back(static_cast<char>(v));
+  }
+
+  return result;
+}
+
+std::vector<uint32_t> decode_hybrid(const std::string &data, int width,
+                                    std::size_t count) {
+  std::vector<uint32_t> result(count);
+  Rle_decoder{data.data(), data.length(), width}.decode(count, result.data());
+  return result;
+}
+
+std::vector<int64_t> decode_delta(const std::string &data,
+                                  std::size_t max_values) {
+  Byte_reader in{data.data(), data.length()};
+  return decode_delta_binary_packed(&in, max_values);
+}
+
+std::string decompress(int32_t codec, const std::string &data,
+                       std::size_t uncompressed_length) {
+  std::string result;
+  parquet::decompress(codec, data, uncompressed_length, &result);
+  return result;
+}
+
+std::string lz4_block(const std::string &data) {
+  std::string result;
+  result.resize(LZ4_compressBound(static_cast<int>(data.length())));
+
+  const auto length =
+      LZ4_compress_default(data.data(), &result[0],
+                           static_cast<int>(data.length()),
+                           static_cast<int>(result.length()));
+  result.resize(length);
+
+  return result;
+}
+
+void write_be32(uint32_t value, std::string *out) {
+  for (int i = 3; i >= 0; --i) {
+    out->push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+std::string text(std::size_t length) {
+  std::string result;
+
+  while (result.length() < length) {
+    result += "row " + std::to_string(result.length() % 97) + "\tvalue\n";
+  }
+
+  result.resize(length);
+
+  return result;
+}
+
+}  // namespace
+
+TEST(Parquet_utils_test, uleb128) {
+  for (const auto value :
+       {uint64_t{0}, uint64_t{1}, uint64_t{127}, uint64_t{128}, uint64_t{300},
+        uint64_t{16383}, uint64_t{16384},
+        std::numeric_limits<uint64_t>::max()}) {
+    SCOPED_TRACE(value);
+
+    std::string encoded;
+    write_uleb128(value, &encoded);
+
+    Byte_reader in{encoded.data(), encoded.length()};
+    EXPECT_EQ(value, in.uleb128());
+    EXPECT_EQ(0, in.remaining());
+  }
+
+  {
+    std::string encoded;
+    write_uleb128(300, &encoded);
+    EXPECT_EQ(bytes({0xAC, 0x02}), encoded);
+  }
+
+  {
+    // truncated
+    const auto encoded = bytes({0x80, 0x80});
+    Byte_reader in{encoded.data(), encoded.length()};
+    EXPECT_THROW(in.uleb128(), std::runtime_error);
+  }
+
+  {
+    // longer than 64 bits
+    const std::string encoded(11, '\xFF');
+    Byte_reader in{encoded.data(), encoded.length()};
+    EXPECT_THROW(in.uleb128(), std::runtime_error);
+  }
+}
+
+TEST(Parquet_utils_test, zigzag) {
+  EXPECT_EQ(0, zigzag(0));
+  EXPECT_EQ(1, zigzag(-1));
+  EXPECT_EQ(2, zigzag(1));
+  EXPECT_EQ(3, zigzag(-2));
+  EXPECT_EQ(std::numeric_limits<uint64_t>::max(),
+            zigzag(std::numeric_limits<int64_t>::min()));
+
+  for (const auto value :
+       {int64_t{0}, int64_t{-1}, int64_t{1}, int64_t{-64}, int64_t{64},
+        std::numeric_limits<int64_t>::min(),
+        std::numeric_limits<int64_t>::max()}) {
+    EXPECT_EQ(value, unzigzag(zigzag(value)));
+  }
+}
+
+TEST(Parquet_utils_test, byte_reader_bounds) {
+  const auto data = bytes({0x01, 0x02, 0x03});
+  Byte_reader in{data.data(), data.length()};
+
+  EXPECT_THROW(in.le(4), std::runtime_error);
+  EXPECT_THROW(in.bytes(4), std::runtime_error);
+  EXPECT_THROW(in.skip(4), std::runtime_error);
+  // failed reads do not advance
+  EXPECT_EQ(0, in.offset());
+
+  EXPECT_EQ(0x0201, in.le(2));
+  EXPECT_EQ(3, in.byte());
+  EXPECT_THROW(in.byte(), std::runtime_error);
+}
+
+TEST(Parquet_thrift_test, compact_encoding) {
+  std::string out;
+  Thrift_compact_writer w{&out};
+
+  w.begin_struct();
+  // short form: delta 1, type i32, zigzag(5)
+  w.field_i32(1, 5);
+  // long form: delta is greater than 15
+  w.field_i64(20, -1);
+  w.field_binary(21, "ab");
+  w.field_list(22, thrift::k_i32, 2);
+  w.element_i32(1);
+  w.element_i32(-1);
+  // list of 15 or more elements stores its size as a varint
+  w.field_list(23, thrift::k_i32, 15);
+
+  for (int i = 0; i < 15; ++i) {
+    w.element_i32(0);
+  }
+
+  w.end_struct();
+
+  auto expected = bytes({0x15, 0x0A, 0x06, 0x28, 0x01, 0x18, 0x02, 'a', 'b',
+                         0x19, 0x25, 0x02, 0x01, 0x19, 0xF5, 0x0F});
+  expected.append(15, '\0');
+  // stop field
+  expected.push_back('\0');
+
+  EXPECT_EQ(expected, out);
+}
+
+TEST(Parquet_thrift_test, round_trip) {
+  std::string out;
+  Thrift_compact_writer w{&out};
+
+  w.begin_struct();
+  w.field_i32(1, std::numeric_limits<int32_t>::min());
+  w.field_struct(2);
+  w.field_i64(1, std::numeric_limits<int64_t>::max());
+  w.field_binary(2, "skipped");
+  w.end_struct();
+  w.field_list(3, thrift::k_struct, 20);
+
+  for (int i = 0; i < 20; ++i) {
+    w.begin_struct();
+    w.field_i32(7, i);
+    w.end_struct();
+  }
+
+  w.field_list(4, thrift::k_binary, 1);
+  w.element_binary("unknown");
+  w.field_binary(100, std::string(300, 'x'));
+  w.end_struct();
+
+  Thrift_compact_reader r{out.data(), out.length()};
+  int32_t i32 = 0;
+  int64_t i64 = 0;
+  std::vector<int64_t> list;
+  std::string binary;
+
+  read_struct(&r, [&](int16_t id, uint8_t type) {
+    switch (id) {
+      case 1:
+        i32 = r.read_i32(type);
+        return true;
+
+      case 2:
+        read_struct(&r, [&](int16_t field, uint8_t field_type) {
+          if (1 == field) {
+            i64 = r.read_int(field_type);
+            return true;
+          }
+
+          // skipped
+          return false;
+        });
+        return true;
+
+      case 3:
+        read_struct_list(&r, type, [&](std::size_t) {
+          read_struct(&r, [&](int16_t field, uint8_t field_type) {
+            EXPECT_EQ(7, field);
+            list.emplace_back(r.read_int(field_type));
+            return true;
+          });
+        });
+        return true;
+
+      case 100:
+        binary = r.read_binary(type);
+        return true;
+    }
+
+    // field 4 is skipped
+    return false;
+  });
+
+  EXPECT_EQ(out.length(), r.offset());
+  EXPECT_EQ(std::numeric_limits<int32_t>::min(), i32);
+  EXPECT_EQ(std::numeric_limits<int64_t>::max(), i64);
+  ASSERT_EQ(20, list.size());
+
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(i, list[i]);
+  }
+
+  EXPECT_EQ(std::string(300, 'x'), binary);
+}
+
+TEST(Parquet_thrift_test, corrupted) {
+  const auto read_all = [](const std::string &data) {
+    Thrift_compact_reader r{data.data(), data.length()};
+    r.skip(thrift::k_struct);
+  };
+
+  std::string valid;
+
+  {
+    Thrift_compact_writer w{&valid};
+    w.begin_struct();
+    w.field_i32(1, 1000);
+    w.field_binary(2, "value");
+    w.field_list(3, thrift::k_struct, 1);
+    w.begin_struct();
+    w.field_i64(1, -1000);
+    w.end_struct();
+    w.end_struct();
+  }
+
+  EXPECT_NO_THROW(read_all(valid));
+
+  // every truncated prefix fails
+  for (std::size_t length = 0; length < valid.length(); ++length) {
+    SCOPED_TRACE(length);
+    EXPECT_THROW(read_all(valid.substr(0, length)), std::runtime_error);
+  }
+
+  // structs nested too deeply
+  EXPECT_THROW(read_all(std::string(1000, '\x1C')), std::runtime_error);
+
+  // list longer than the data
+  EXPECT_THROW(read_all(bytes({0x19, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+                               0x00})),
+               std::runtime_error);
+
+  // unknown type
+  EXPECT_THROW(read_all(bytes({0x1D, 0x00})), std::runtime_error);
+
+  // binary longer than the data
+  EXPECT_THROW(read_all(bytes({0x18, 0x7F, 'a', 0x00})), std::runtime_error);
+
+  // type mismatch
+  {
+    const auto data = bytes({0x18, 0x01, 'a', 0x00});
+    Thrift_compact_reader r{data.data(), data.length()};
+
+    EXPECT_THROW(read_struct(&r,
+                             [&r](int16_t, uint8_t type) {
+                               r.read_int(type);
+                               return true;
+                             }),
+                 std::runtime_error);
+  }
+
+  {
+    const auto data = bytes({0x15, 0x02, 0x00});
+    Thrift_compact_reader r{data.data(), data.length()};
+
+    EXPECT_THROW(read_struct(&r,
+                             [&r](int16_t, uint8_t type) {
+                               r.read_binary(type);
+                               return true;
+                             }),
+                 std::runtime_error);
+  }
+}
+
+TEST(Parquet_encoding_test, hybrid_rle_run) {
+  const std::vector<uint32_t> values(10, 5);
+  std::string encoded;
+
+  encode_hybrid(values.data(), values.size(), 3, &encoded);
+
+  // header: run length << 1, value stored using one byte
+  EXPECT_EQ(bytes({0x14, 0x05}), encoded);
+  EXPECT_EQ(values, decode_hybrid(encoded, 3, values.size()));
+
+  // value is stored using (width + 7) / 8 bytes
+  encoded.clear();
+  encode_hybrid(values.data(), values.size(), 9, &encoded);
+  EXPECT_EQ(bytes({0x14, 0x05, 0x00}), encoded);
+  EXPECT_EQ(values, decode_hybrid(encoded, 9, values.size()));
+}
+
+TEST(Parquet_encoding_test, hybrid_bit_packed) {
+  // example from the specification
+  const std::vector<uint32_t> values = {0, 1, 2, 3, 4, 5, 6, 7};
+  std::string encoded;
+
+  encode_hybrid(values.data(), values.size(), 3, &encoded);
+
+  // header: number of groups << 1 | 1
+  EXPECT_EQ(bytes({0x03, 0x88, 0xC6, 0xFA}), encoded);
+  EXPECT_EQ(values, decode_hybrid(encoded, 3, values.size()));
+
+  // incomplete group is padded with zeros
+  encoded.clear();
+  encode_hybrid(values.data(), 3, 3, &encoded);
+  EXPECT_EQ(bytes({0x03, 0x88, 0x00, 0x00}), encoded);
+  EXPECT_EQ(std::vector<uint32_t>(values.begin(), values.begin() + 3),
+            decode_hybrid(encoded, 3, 3));
+}
+
+TEST(Parquet_encoding_test, hybrid_round_trip) {
+  for (int width = 1; width <= 32; ++width) {
+    SCOPED_TRACE(width);
+
+    const auto max = width < 32 ? (uint32_t{1} << width) - 1
+                                : std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> values;
+
+    // bit-packed values, more than fit in a single run
+    for (uint32_t i = 0; i < 1000; ++i) {
+      values.emplace_back((i * 2654435761u) & max);
+    }
+
+    // a run, followed by an incomplete bit-packed group
+    values.insert(values.end(), 100, max);
+    values.emplace_back(0);
+    values.emplace_back(1 & max);
+
+    std::string encoded;
+    encode_hybrid(values.data(), values.size(), width, &encoded);
+
+    // at most 63 groups are packed in a single run
+    EXPECT_EQ(0x7F, static_cast<uint8_t>(encoded[0]));
+
+    EXPECT_EQ(values, decode_hybrid(encoded, width, values.size()));
+  }
+}
+
+TEST(Parquet_encoding_test, hybrid_corrupted) {
+  {
+    const auto encoded = bytes({0x14, 0x05});
+    // not enough values
+    EXPECT_THROW(decode_hybrid(encoded, 3, 11), std::runtime_error);
+    // invalid bit width
+    EXPECT_THROW(decode_hybrid(encoded, 33, 1), std::runtime_error);
+    EXPECT_THROW(decode_hybrid(encoded, -1, 1), std::runtime_error);
+  }
+
+  // value of the RLE run is missing
+  EXPECT_THROW(decode_hybrid(bytes({0x14}), 3, 1), std::runtime_error);
+  EXPECT_THROW(decode_hybrid(bytes({0x14, 0x05}), 16, 1), std::runtime_error);
+  // truncated header
+  EXPECT_THROW(decode_hybrid(bytes({0x80}), 3, 1), std::runtime_error);
+
+  // missing bit-packed data is read as zeros, reads stay within the buffer
+  EXPECT_EQ(std::vector<uint32_t>({0, 1, 0, 0, 0, 0, 0, 0}),
+            decode_hybrid(bytes({0x03, 0x08}), 3, 8));
+  EXPECT_EQ(std::vector<uint32_t>(16, 0),
+            decode_hybrid(bytes({0xFF, 0xFF, 0xFF, 0x0F}), 32, 16));
+}
+
+TEST(Parquet_encoding_test, delta_binary_packed) {
+  // examples from the specification
+  {
+    // block size: 128, miniblocks: 4, values: 5, first value: 1
+    // min delta: 1, bit widths: 0
+    const auto encoded =
+        bytes({0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00});
+    EXPECT_EQ(std::vector<int64_t>({1, 2, 3, 4, 5}), decode_delta(encoded, 5));
+  }
+
+  {
+    // block size: 128, miniblocks: 4, values: 8, first value: 7
+    // min delta: -2, bit widths: 2, 0, 0, 0
+    auto encoded = bytes({0x80, 0x01, 0x04, 0x08, 0x0E, 0x03, 0x02, 0x00,
+                          0x00, 0x00, 0xC0, 0x3F});
+    // miniblock is padded to 32 values
+    encoded.append(6, '\0');
+
+    EXPECT_EQ(std::vector<int64_t>({7, 5, 3, 1, 2, 3, 4, 5}),
+              decode_delta(encoded, 8));
+
+    Byte_reader in{encoded.data(), encoded.length()};
+    decode_delta_binary_packed(&in, 8);
+    EXPECT_EQ(0, in.remaining());
+
+    // truncated miniblock
+    encoded.pop_back();
+    EXPECT_THROW(decode_delta(encoded, 8), std::runtime_error);
+  }
+
+  {
+    // deltas wrap around
+    const auto encoded = bytes({0x08, 0x01, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+                                0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x00});
+    EXPECT_EQ(std::vector<int64_t>({std::numeric_limits<int64_t>::max(),
+                                    std::numeric_limits<int64_t>::min()}),
+              decode_delta(encoded, 2));
+  }
+
+  // no values
+  EXPECT_TRUE(decode_delta(bytes({0x80, 0x01, 0x04, 0x00, 0x00}), 0).empty());
+}
+
+TEST(Parquet_encoding_test, delta_binary_packed_corrupted) {
+  // block size is zero
+  EXPECT_THROW(decode_delta(bytes({0x00, 0x04, 0x01, 0x00}), 1),
+               std::runtime_error);
+  // no miniblocks
+  EXPECT_THROW(decode_delta(bytes({0x80, 0x01, 0x00, 0x01, 0x00}), 1),
+               std::runtime_error);
+  // values in a miniblock are not a multiple of 8
+  EXPECT_THROW(decode_delta(bytes({0x0C, 0x01, 0x01, 0x00}), 1),
+               std::runtime_error);
+  // more values than expected
+  EXPECT_THROW(decode_delta(bytes({0x80, 0x01, 0x04, 0x06, 0x02, 0x02, 0x00,
+                                   0x00, 0x00, 0x00}),
+                            5),
+               std::runtime_error);
+  // invalid bit width
+  EXPECT_THROW(decode_delta(bytes({0x08, 0x01, 0x02, 0x00, 0x00, 0x41}), 2),
+               std::runtime_error);
+  // truncated header
+  EXPECT_THROW(decode_delta(bytes({0x80, 0x01, 0x04}), 1), std::runtime_error);
+  // bit widths are missing
+  EXPECT_THROW(decode_delta(bytes({0x80, 0x01, 0x04, 0x02, 0x00, 0x00}), 2),
+               std::runtime_error);
+  // huge block does not overflow the size of a miniblock
+  EXPECT_THROW(decode_delta(bytes({0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+                                   0x80, 0x40, 0x01, 0x02, 0x00, 0x00, 0x40}),
+                            2),
+               std::runtime_error);
+}
+
+TEST(Parquet_encoding_test, delta_length_byte_array) {
+  // lengths: 5, 5, 6, 6 (deltas: 0, 1, 0)
+  auto encoded = bytes({0x80, 0x01, 0x04, 0x04, 0x0A, 0x00, 0x01, 0x00, 0x00,
+                        0x00, 0x02, 0x00, 0x00, 0x00});
+  encoded += "HelloWorldFoobarABCDEF";
+
+  Byte_reader in{encoded.data(), encoded.length()};
+  const auto values = decode_delta_length_byte_array(&in, 4);
+
+  ASSERT_EQ(4, values.size());
+  EXPECT_EQ("Hello", values[0]);
+  EXPECT_EQ("World", values[1]);
+  EXPECT_EQ("Foobar", values[2]);
+  EXPECT_EQ("ABCDEF", values[3]);
+  EXPECT_EQ(0, in.remaining());
+
+  // data is truncated
+  encoded.pop_back();
+  Byte_reader truncated{encoded.data(), encoded.length()};
+  EXPECT_THROW(decode_delta_length_byte_array(&truncated, 4),
+               std::runtime_error);
+
+  // negative length
+  const auto negative = bytes({0x08, 0x01, 0x01, 0x01, 0x00});
+  Byte_reader in_negative{negative.data(), negative.length()};
+  EXPECT_THROW(decode_delta_length_byte_array(&in_negative, 1),
+               std::runtime_error);
+}
+
+TEST(Parquet_compression_test, uncompressed) {
+  const auto data = text(1000);
+  EXPECT_EQ(data, decompress(UNCOMPRESSED, data, data.length()));
+}
+
+TEST(Parquet_compression_test, snappy) {
+  // literal, literal with 1-byte length, copies with 1, 2 and 4-byte offsets
+  auto encoded = bytes({0x21, 0x0C});
+  encoded += "abcd";
+  encoded += bytes({0xF0, 0x09});
+  encoded += "0123456789";
+  // 1-byte offset: length 8, offset 14
+  encoded += bytes({0x11, 0x0E});
+  // 2-byte offset: length 6, offset 2 (source overlaps with the copy)
+  encoded += bytes({0x16, 0x02, 0x00});
+  // 4-byte offset: length 5, offset 25
+  encoded += bytes({0x13, 0x19, 0x00, 0x00, 0x00});
+
+  const std::string expected = "abcd0123456789abcd0123232323d0123";
+  ASSERT_EQ(33, expected.length());
+
+  EXPECT_EQ(expected, decompress(SNAPPY, encoded, expected.length()));
+
+  // length does not match the header
+  EXPECT_THROW(decompress(SNAPPY, encoded, expected.length() + 1),
+               std::runtime_error);
+
+  // data is shorter than the header says
+  {
+    auto shorter = encoded;
+    shorter[0] = 0x22;
+    EXPECT_THROW(decompress(SNAPPY, shorter, 34), std::runtime_error);
+  }
+
+  // every truncated prefix fails
+  for (std::size_t length = 0; length < encoded.length(); ++length) {
+    SCOPED_TRACE(length);
+    EXPECT_THROW(decompress(SNAPPY, encoded.substr(0, length), 33),
+                 std::runtime_error);
+  }
+
+  // literal longer than the output
+  EXPECT_THROW(decompress(SNAPPY, bytes({0x02, 0x08, 'a', 'b', 'c'}), 2),
+               std::runtime_error);
+  // copy with zero offset
+  EXPECT_THROW(decompress(SNAPPY, bytes({0x05, 0x00, 'a', 0x01, 0x00}), 5),
+               std::runtime_error);
+  // copy before the start of the output
+  EXPECT_THROW(decompress(SNAPPY, bytes({0x05, 0x00, 'a', 0x01, 0x02}), 5),
+               std::runtime_error);
+  // copy longer than the output
+  EXPECT_THROW(decompress(SNAPPY, bytes({0x03, 0x00, 'a', 0x01, 0x01}), 3),
+               std::runtime_error);
+}
+
+TEST(Parquet_compression_test, lz4_raw) {
+  const auto data = text(100000);
+  const auto compressed = lz4_block(data);
+
+  EXPECT_EQ(data, decompress(LZ4_RAW, compressed, data.length()));
+  // deprecated LZ4 codec also accepts a raw block
+  EXPECT_EQ(data, decompress(LZ4, compressed, data.length()));
+
+  EXPECT_THROW(decompress(LZ4_RAW, compressed, data.length() - 1),
+               std::runtime_error);
+  EXPECT_THROW(decompress(LZ4_RAW, compressed, data.length() + 1),
+               std::runtime_error);
+  EXPECT_THROW(
+      decompress(LZ4_RAW, compressed.substr(0, compressed.length() / 2),
+                 data.length()),
+      std::runtime_error);
+}
+
+TEST(Parquet_compression_test, lz4_hadoop) {
+  const auto first = text(70000);
+  const auto second = text(1234);
+  std::string framed;
+
+  for (const auto &block : {first, second}) {
+    const auto compressed = lz4_block(block);
+
+    write_be32(static_cast<uint32_t>(block.length()), &framed);
+    write_be32(static_cast<uint32_t>(compressed.length()), &framed);
+    framed += compressed;
+  }
+
+  const auto expected = first + second;
+
+  EXPECT_EQ(expected, decompress(LZ4, framed, expected.length()));
+
+  // neither Hadoop framing nor a raw block
+  EXPECT_THROW(decompress(LZ4, framed, expected.length() + 1),
+               std::runtime_error);
+  EXPECT_THROW(decompress(LZ4, framed.substr(0, framed.length() - 1),
+                          expected.length()),
+               std::runtime_error);
+}
+
+TEST(Parquet_compression_test, gzip_zstd) {
+  const auto data = text(100000);
+
+  for (const auto &[codec, compression] :
+       {std::make_pair(GZIP, mysqlshdk::storage::Compression::GZIP),
+        std::make_pair(ZSTD, mysqlshdk::storage::Compression::ZSTD)}) {
+    SCOPED_TRACE(codec);
+
+    std::string compressed;
+    mysqlshdk::storage::compress(compression, data.data(), data.length(),
+                                 &compressed);
+
+    EXPECT_EQ(data, decompress(codec, compressed, data.length()));
+
+    EXPECT_THROW(decompress(codec, compressed, data.length() - 1),
+                 std::runtime_error);
+    EXPECT_THROW(
+        decompress(codec, compressed.substr(0, compressed.length() / 2),
+                   data.length()),
+        std::runtime_error);
+    EXPECT_THROW(decompress(codec, text(100), 100), std::runtime_error);
+  }
+}
+
+TEST(Parquet_compression_test, unsupported) {
+  // LZO
+  EXPECT_THROW(decompress(3, "data", 4), std::runtime_error);
+  EXPECT_THROW(decompress(100, "data", 4), std::runtime_error);
+}
+
+}  // namespace parquet
+}  // namespace mysqlsh
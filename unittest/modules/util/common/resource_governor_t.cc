@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/common/resource_governor.h"
+
+namespace mysqlsh {
+namespace tests {
+
+TEST(Resource_governor_test, unlimited) {
+  Resource_governor governor{[]() { return Resource_governor::Limits{}; }};
+
+  const auto first = governor.acquire("first", 8, 1000);
+  const auto second = governor.acquire("second", 16);
+
+  EXPECT_EQ(2, governor.operations());
+
+  EXPECT_EQ(8, first->threads());
+  EXPECT_EQ(1000, first->rate_limit()->limit());
+
+  EXPECT_EQ(16, second->threads());
+  EXPECT_EQ(0, second->rate_limit()->limit());
+}
+
+TEST(Resource_governor_test, fair_share) {
+  Resource_governor::Limits limits;
+  limits.threads = 12;
+  limits.rate = 900;
+
+  Resource_governor governor{[&limits]() { return limits; }};
+
+  auto first = governor.acquire("first", 16);
+  EXPECT_EQ(12, first->threads());
+  EXPECT_EQ(900, first->rate_limit()->limit());
+
+  {
+    // asks for less than its share, the rest goes to the other operation
+    const auto second = governor.acquire("second", 2, 100);
+
+    EXPECT_EQ(10, first->threads());
+    EXPECT_EQ(800, first->rate_limit()->limit());
+
+    EXPECT_EQ(2, second->threads());
+    EXPECT_EQ(100, second->rate_limit()->limit());
+
+    const auto third = governor.acquire("third", 16);
+
+    EXPECT_EQ(5, first->threads());
+    EXPECT_EQ(400, first->rate_limit()->limit());
+
+    EXPECT_EQ(2, second->threads());
+    EXPECT_EQ(100, second->rate_limit()->limit());
+
+    EXPECT_EQ(5, third->threads());
+    EXPECT_EQ(400, third->rate_limit()->limit());
+
+    EXPECT_EQ(3, governor.operations());
+  }
+
+  // shares of the finished operations are returned
+  EXPECT_EQ(1, governor.operations());
+  EXPECT_EQ(12, first->threads());
+  EXPECT_EQ(900, first->rate_limit()->limit());
+
+  first.reset();
+  EXPECT_EQ(0, governor.operations());
+}
+
+TEST(Resource_governor_test, at_least_one_thread) {
+  Resource_governor::Limits limits;
+  limits.threads = 1;
+
+  Resource_governor governor{[&limits]() { return limits; }};
+
+  const auto first = governor.acquire("first", 4);
+  const auto second = governor.acquire("second", 4);
+
+  EXPECT_EQ(1, first->threads());
+  EXPECT_EQ(1, second->threads());
+}
+
+}  // namespace tests
+}  // namespace mysqlsh
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/common/dump/utils.h"
+#include "modules/util/dump/dump_journal.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysqlsh {
+namespace dump {
+
+using mysqlshdk::storage::Mode;
+
+class Dump_journal_test : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_path = shcore::path::join_path(getenv("TMPDIR"), "dump_journal");
+    m_dir = mysqlshdk::storage::make_directory(m_path);
+
+    if (m_dir->exists()) {
+      shcore::remove_directory(m_path, true);
+    }
+
+    m_dir->create();
+  }
+
+  void TearDown() override { shcore::remove_directory(m_path, true); }
+
+  void write_file(Dump_journal *journal, const std::string &name,
+                  const std::string &contents) {
+    const auto file = journal->track(m_dir->file(name));
+
+    file->open(Mode::WRITE);
+    file->write(contents.data(), contents.length());
+    file->close();
+  }
+
+  std::vector<std::pair<std::string, std::size_t>> read_journal(
+      uint64_t segments) const {
+    std::vector<std::pair<std::string, std::size_t>> result;
+
+    for (uint64_t i = 1; i <= segments; ++i) {
+      const auto file = m_dir->file(common::get_journal_segment_filename(i));
+
+      file->open(Mode::READ);
+      const auto contents = mysqlshdk::storage::read_file(file.get());
+      file->close();
+
+      for (auto &entry : common::parse_journal_segment(contents)) {
+        result.emplace_back(std::move(entry));
+      }
+    }
+
+    return result;
+  }
+
+  std::string m_path;
+  std::unique_ptr<mysqlshdk::storage::IDirectory> m_dir;
+};
+
+TEST_F(Dump_journal_test, files_in_order) {
+  Dump_journal journal{m_dir.get(), std::chrono::milliseconds{10}};
+
+  write_file(&journal, "@.json", "{}");
+  write_file(&journal, "sakila.json", "{\"tables\":[]}");
+
+  // wait for the first segment to be written
+  while (0 == journal.last_segment()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+
+  // file which is read is not recorded
+  {
+    const auto file = journal.track(m_dir->file("@.json"));
+    file->open(Mode::READ);
+    file->close();
+  }
+
+  journal.add("sakila@actor@@0.tsv.zst", 1234);
+  write_file(&journal, "@.done.json", "{\"end\":1}");
+
+  journal.close();
+
+  EXPECT_FALSE(
+      m_dir->file(common::get_journal_segment_filename(journal.last_segment() +
+                                                       1))
+          ->exists());
+
+  const std::vector<std::pair<std::string, std::size_t>> expected = {
+      {"@.json", 2},
+      {"sakila.json", 13},
+      {"sakila@actor@@0.tsv.zst", 1234},
+      {"@.done.json", 9},
+  };
+
+  EXPECT_EQ(expected, read_journal(journal.last_segment()));
+
+  // files closed after the journal was closed are not recorded
+  const auto segments = journal.last_segment();
+  write_file(&journal, "@.perf.json", "{}");
+  EXPECT_EQ(segments, journal.last_segment());
+}
+
+TEST_F(Dump_journal_test, renamed_file) {
+  Dump_journal journal{m_dir.get(), std::chrono::milliseconds{10}};
+
+  {
+    const auto file = journal.track(m_dir->file("data.tsv.dumping"));
+
+    file->open(Mode::WRITE);
+    file->write("abc", 3);
+    file->close();
+    file->rename("data.tsv");
+  }
+
+  journal.close();
+
+  const std::vector<std::pair<std::string, std::size_t>> expected = {
+      {"data.tsv.dumping", 3},
+      {"data.tsv", 3},
+  };
+
+  EXPECT_EQ(expected, read_journal(journal.last_segment()));
+}
+
+TEST_F(Dump_journal_test, nothing_written) {
+  {
+    Dump_journal journal{m_dir.get(), std::chrono::milliseconds{10}};
+    journal.close();
+    EXPECT_EQ(0, journal.last_segment());
+  }
+
+  {
+    // pending entries are discarded if journal is not closed
+    Dump_journal journal{m_dir.get(), std::chrono::hours{1}};
+    journal.add("@.json", 1);
+  }
+
+  EXPECT_FALSE(m_dir->file(common::get_journal_segment_filename(1))->exists());
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
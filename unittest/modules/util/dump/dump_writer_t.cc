@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "unittest/gprod_clean.h"
+
+#include "modules/util/dump/dump_writer.h"
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/utils/utils_net.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+namespace {
+
+class Test_dump_writer : public Dump_writer {
+ private:
+  void store_preamble(const std::vector<mysqlshdk::db::Column> &,
+                      const std::vector<Encoding_type> &) override {
+    append("preamble\n");
+  }
+
+  void store_row(const mysqlshdk::db::IRow *) override {}
+
+  void store_row(const Raw_row &row) override {
+    buffer()->will_write(row.lengths[0] + 1);
+    buffer()->append(row.data[0], row.lengths[0]);
+    buffer()->append('\n');
+  }
+
+  void store_postamble() override { append("postamble\n"); }
+
+  void append(const std::string &s) {
+    buffer()->will_write(s.length());
+    buffer()->append(s.c_str(), s.length());
+  }
+};
+
+class Failing_file : public Memory_file {
+ public:
+  using Memory_file::Memory_file;
+
+  ssize_t write(const void *, size_t) override { return -1; }
+};
+
+class Blocking_file : public Memory_file {
+ public:
+  using Memory_file::Memory_file;
+
+  ssize_t write(const void *buffer, size_t length) override {
+    m_released.wait();
+    return Memory_file::write(buffer, length);
+  }
+
+  void release() { m_release.set_value(); }
+
+ private:
+  std::promise<void> m_release;
+  std::shared_future<void> m_released = m_release.get_future().share();
+};
+
+Dump_write_result write_rows(Dump_writer *writer, int rows,
+                             std::string *expected) {
+  Dump_write_result result;
+
+  result += writer->write_preamble({});
+  *expected = "preamble\n";
+
+  for (int i = 0; i < rows; ++i) {
+    const auto value = std::to_string(i);
+    const char *data[] = {value.c_str()};
+    const unsigned long lengths[] = {value.length()};
+
+    result += writer->write_row(Dump_writer::Raw_row{data, lengths});
+    *expected += value + '\n';
+  }
+
+  result += writer->write_postamble();
+  *expected += "postamble\n";
+
+  return result;
+}
+
+}  // namespace
+
+TEST(Dump_writer_test, buffer_writes) {
+  for (const std::size_t size : {0, 1, 10, 100, 1024 * 1024}) {
+    SCOPED_TRACE("buffer size: " + std::to_string(size));
+
+    Memory_file output{"output"};
+    output.open(Mode::WRITE);
+
+    Test_dump_writer writer;
+    writer.buffer_writes(size);
+    writer.set_output_file(&output);
+    writer.open();
+
+    std::string expected;
+    const auto result = write_rows(&writer, 1000, &expected);
+    writer.close();
+
+    EXPECT_EQ(expected, output.content());
+    EXPECT_EQ(1000u, result.rows_written());
+    EXPECT_EQ(expected.length(), result.data_bytes());
+    // all data is written once write_postamble() returns
+    EXPECT_EQ(expected.length(), result.bytes_written());
+  }
+}
+
+TEST(Dump_writer_test, buffer_writes_failure) {
+  Failing_file output{"output"};
+  output.open(Mode::WRITE);
+
+  Test_dump_writer writer;
+  writer.buffer_writes(16);
+  writer.set_output_file(&output);
+  writer.open();
+
+  std::string expected;
+  EXPECT_THROW(write_rows(&writer, 100, &expected), shcore::Exception);
+}
+
+TEST(Dump_writer_test, buffer_writes_checkpoints) {
+  // write of the first buffer blocks until the output is released, rows
+  // should still be stored in the second buffer, even though a checkpoint
+  // is written in the meantime
+  constexpr std::size_t k_buffer_size = 1024 * 1024;
+  const std::string value(1023, 'x');
+  const auto rows = 3 * k_buffer_size / 2 / (value.length() + 1);
+
+  Blocking_file output{"output"};
+  output.open(Mode::WRITE);
+
+  auto index_file = std::make_unique<Memory_file>("index");
+  const auto index = index_file.get();
+
+  Test_dump_writer writer;
+  writer.buffer_writes(k_buffer_size);
+  writer.set_output_file(&output);
+  writer.set_index_file(std::move(index_file));
+  writer.open();
+
+  std::string expected;
+  std::promise<void> stored;
+  std::thread thread{[&]() {
+    writer.write_preamble({});
+    expected = "preamble\n";
+
+    for (std::size_t i = 0; i < rows; ++i) {
+      const char *data[] = {value.c_str()};
+      const unsigned long lengths[] = {value.length()};
+
+      writer.write_row(Dump_writer::Raw_row{data, lengths});
+      expected += value + '\n';
+    }
+
+    stored.set_value();
+  }};
+
+  EXPECT_EQ(std::future_status::ready,
+            stored.get_future().wait_for(std::chrono::seconds(10)));
+  // nothing was written yet
+  EXPECT_EQ("", output.content());
+
+  output.release();
+  thread.join();
+
+  writer.write_postamble();
+  expected += "postamble\n";
+  writer.close();
+
+  EXPECT_EQ(expected, output.content());
+
+  // marker, one checkpoint (rows, compressed offset, data offset), total size
+  const auto &content = index->content();
+  ASSERT_EQ(5 * sizeof(uint64_t), content.length());
+
+  std::vector<uint64_t> entries(5);
+  memcpy(entries.data(), content.data(), content.length());
+
+  for (auto &entry : entries) {
+    entry = mysqlshdk::utils::network_to_host(entry);
+  }
+
+  EXPECT_LT(0u, entries[1]);
+  EXPECT_GT(rows, entries[1]);
+  // checkpoint is written after the row which crossed the threshold
+  EXPECT_LE(k_buffer_size, entries[3]);
+  EXPECT_GT(k_buffer_size + value.length() + 1, entries[3]);
+  // output is not compressed
+  EXPECT_EQ(entries[3], entries[2]);
+  EXPECT_EQ(expected.length() - ::strlen("preamble\npostamble\n"),
+            entries[4]);
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
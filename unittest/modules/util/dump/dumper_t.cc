@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/dump/dumper.h"
+#include "mysqlshdk/libs/db/session.h"
+#include "unittest/test_utils/mocks/gmock_clean.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_session.h"
+
+namespace mysqlsh {
+namespace dump {
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+
+TEST(Dumper_test, worker_instance) {
+  // no read replicas, all workers use the source instance
+  for (std::size_t i = 0; i < 5; ++i) {
+    EXPECT_EQ(0, worker_instance(i, 0));
+  }
+
+  // workers are distributed evenly between the source and the replicas
+  const std::vector<std::size_t> expected = {0, 1, 2, 0, 1, 2, 0};
+
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(expected[i], worker_instance(i, 2)) << "worker: " << i;
+  }
+
+  // more replicas than workers, some replicas are not used
+  EXPECT_EQ(0, worker_instance(0, 4));
+  EXPECT_EQ(1, worker_instance(1, 4));
+  EXPECT_EQ(2, worker_instance(2, 4));
+}
+
+TEST(Dumper_test, worker_session_setup) {
+  // all variables are set using a single statement
+  EXPECT_EQ(
+      "SET SQL_MODE = '', NAMES 'utf8mb4', SESSION net_write_timeout = 1800, "
+      "SESSION wait_timeout = 31536000",
+      worker_session_setup("utf8mb4", false));
+
+  EXPECT_EQ(
+      "SET SQL_MODE = '', NAMES 'latin1', SESSION net_write_timeout = 1800, "
+      "SESSION wait_timeout = 31536000, TIME_ZONE = '+00:00'",
+      worker_session_setup("latin1", true));
+
+  // character set is escaped
+  EXPECT_EQ(
+      "SET SQL_MODE = '', NAMES 'a\\'b', SESSION net_write_timeout = 1800, "
+      "SESSION wait_timeout = 31536000",
+      worker_session_setup("a'b", false));
+}
+
+class Dumper_snapshots_test : public ::testing::Test {
+ protected:
+  /**
+   * Creates sessions which wait until all of them start their snapshots, the
+   * session with the given index fails.
+   */
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> make_sessions(
+      std::size_t count, std::size_t failing = SIZE_MAX) {
+    std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions;
+
+    m_expected = count;
+
+    for (std::size_t i = 0; i < count; ++i) {
+      auto session = std::make_shared<NiceMock<testing::Mock_session>>();
+
+      EXPECT_CALL(*session, executes(_, _))
+          .WillOnce(Invoke([this, i, failing](const char *sql, size_t len) {
+            EXPECT_EQ("START TRANSACTION WITH CONSISTENT SNAPSHOT;",
+                      std::string(sql, len));
+
+            if (!arrive_and_wait()) {
+              ADD_FAILURE() << "snapshots were not started concurrently";
+            }
+
+            if (i == failing) {
+              throw mysqlshdk::db::Error("Lost connection", 2013);
+            }
+          }));
+
+      sessions.emplace_back(std::move(session));
+    }
+
+    return sessions;
+  }
+
+ private:
+  bool arrive_and_wait() {
+    std::unique_lock lock{m_mutex};
+
+    if (++m_arrived >= m_expected) {
+      m_cv.notify_all();
+      return true;
+    }
+
+    return m_cv.wait_for(lock, std::chrono::seconds{30},
+                         [this]() { return m_arrived >= m_expected; });
+  }
+
+  std::size_t m_expected = 0;
+  std::size_t m_arrived = 0;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+};
+
+TEST_F(Dumper_snapshots_test, no_sessions) {
+  EXPECT_NO_THROW(start_consistent_snapshots({}));
+}
+
+TEST_F(Dumper_snapshots_test, started_concurrently) {
+  // each session blocks until all of them are starting their transactions
+  const auto sessions = make_sessions(8);
+
+  EXPECT_NO_THROW(start_consistent_snapshots(sessions));
+}
+
+TEST_F(Dumper_snapshots_test, error_is_rethrown) {
+  // all sessions start their transactions before the error is reported
+  const auto sessions = make_sessions(4, 2);
+
+  try {
+    start_consistent_snapshots(sessions);
+    FAIL() << "Expected an exception";
+  } catch (const mysqlshdk::db::Error &e) {
+    EXPECT_EQ(2013, e.code());
+    EXPECT_STREQ("Lost connection", e.what());
+  }
+}
+
+TEST(Dumper_test, parse_histogram_buckets_singleton) {
+  const auto buckets = parse_histogram_buckets(
+      "singleton", "[[-5, 0.25], [0, 0.5], [18446744073709551615, 1.0]]");
+
+  ASSERT_EQ(3, buckets.size());
+
+  EXPECT_EQ(-5, buckets[0].lower);
+  EXPECT_EQ(-5, buckets[0].upper);
+  EXPECT_EQ(0.25, buckets[0].frequency);
+
+  EXPECT_EQ(0, buckets[1].lower);
+  EXPECT_EQ(0, buckets[1].upper);
+  EXPECT_EQ(0.5, buckets[1].frequency);
+
+  EXPECT_EQ(18446744073709551615.0L, buckets[2].lower);
+  EXPECT_EQ(18446744073709551615.0L, buckets[2].upper);
+  EXPECT_EQ(1.0, buckets[2].frequency);
+}
+
+TEST(Dumper_test, parse_histogram_buckets_equi_height) {
+  const auto buckets = parse_histogram_buckets(
+      "equi-height", "[[1, 10, 0.4, 10], [11, 11, 0.5, 1], [20, 30, 1, 11]]");
+
+  ASSERT_EQ(3, buckets.size());
+
+  EXPECT_EQ(1, buckets[0].lower);
+  EXPECT_EQ(10, buckets[0].upper);
+  EXPECT_EQ(0.4, buckets[0].frequency);
+
+  EXPECT_EQ(11, buckets[1].lower);
+  EXPECT_EQ(11, buckets[1].upper);
+  EXPECT_EQ(0.5, buckets[1].frequency);
+
+  // frequency can be an integer
+  EXPECT_EQ(20, buckets[2].lower);
+  EXPECT_EQ(30, buckets[2].upper);
+  EXPECT_EQ(1.0, buckets[2].frequency);
+
+  // histogram without any buckets
+  EXPECT_TRUE(parse_histogram_buckets("equi-height", "[]").empty());
+}
+
+TEST(Dumper_test, parse_histogram_buckets_not_integer) {
+  // only histograms of integer columns are supported
+  EXPECT_TRUE(parse_histogram_buckets("singleton",
+                                      R"([["base64:type254:YQ==", 0.5],
+                                          ["base64:type254:Yg==", 1.0]])")
+                  .empty());
+  EXPECT_TRUE(
+      parse_histogram_buckets(
+          "equi-height",
+          R"([["base64:type254:YQ==", "base64:type254:Yg==", 1.0, 2]])")
+          .empty());
+  EXPECT_TRUE(parse_histogram_buckets("singleton",
+                                      R"([["2020-01-01 00:00:00.000000", 0.5],
+                                          ["2021-01-01 00:00:00.000000", 1]])")
+                  .empty());
+  EXPECT_TRUE(parse_histogram_buckets("equi-height",
+                                      R"([["2020-01-01", "2020-12-31", 0.5, 9],
+                                          ["2021-01-01", "2021-12-31", 1, 9]])")
+                  .empty());
+  EXPECT_TRUE(
+      parse_histogram_buckets("singleton", "[[0.5, 0.5], [1.5, 1.0]]").empty());
+}
+
+TEST(Dumper_test, parse_histogram_buckets_malformed) {
+  // unknown type
+  EXPECT_TRUE(parse_histogram_buckets("other", "[[1, 1.0]]").empty());
+  // invalid JSON
+  EXPECT_TRUE(parse_histogram_buckets("singleton", "[[1, 1.0]").empty());
+  EXPECT_TRUE(parse_histogram_buckets("singleton", "").empty());
+  // not an array
+  EXPECT_TRUE(parse_histogram_buckets("singleton", R"({"1": 1.0})").empty());
+  // bucket is not an array
+  EXPECT_TRUE(parse_histogram_buckets("singleton", "[1, 1.0]").empty());
+  // bucket is too short
+  EXPECT_TRUE(parse_histogram_buckets("singleton", "[[1]]").empty());
+  EXPECT_TRUE(parse_histogram_buckets("equi-height", "[[1, 2, 1.0]]").empty());
+  // frequency is not a number
+  EXPECT_TRUE(parse_histogram_buckets("singleton", R"([[1, "1.0"]])").empty());
+  // upper value is lower than the lower one
+  EXPECT_TRUE(
+      parse_histogram_buckets("equi-height", "[[2, 1, 1.0, 2]]").empty());
+  // frequency is decreasing
+  EXPECT_TRUE(
+      parse_histogram_buckets("singleton", "[[1, 0.5], [2, 0.4]]").empty());
+  // buckets overlap or are not ordered
+  EXPECT_TRUE(
+      parse_histogram_buckets("equi-height", "[[1, 5, 0.5, 5], [5, 9, 1.0, 5]]")
+          .empty());
+  EXPECT_TRUE(
+      parse_histogram_buckets("singleton", "[[2, 0.5], [1, 1.0]]").empty());
+}
+
+TEST(Dumper_test, histogram_boundaries) {
+  const bool interrupted = false;
+  const std::vector<Histogram_bucket> buckets = {{0, 99, 0.5},
+                                                 {100, 199, 1.0}};
+
+  // values are uniformly distributed within a bucket
+  EXPECT_EQ((std::vector<int>{49, 100, 149}),
+            histogram_boundaries(buckets, 50, 200, 0, 199, interrupted));
+
+  // boundaries are within [min, max)
+  EXPECT_EQ((std::vector<int>{100, 149}),
+            histogram_boundaries(buckets, 50, 200, 50, 199, interrupted));
+  EXPECT_EQ((std::vector<int>{49}),
+            histogram_boundaries(buckets, 50, 200, 0, 100, interrupted));
+
+  // single chunk
+  EXPECT_TRUE(
+      histogram_boundaries(buckets, 200, 200, 0, 199, interrupted).empty());
+  EXPECT_TRUE(
+      histogram_boundaries(buckets, 1000, 200, 0, 199, interrupted).empty());
+
+  // boundaries are strictly increasing
+  EXPECT_EQ((std::vector<int>{0, 1}),
+            histogram_boundaries(std::vector<Histogram_bucket>{{0, 2, 1.0}}, 1,
+                                 10, 0, 2, interrupted));
+
+  // frequencies do not include NULL values
+  EXPECT_EQ((std::vector<uint64_t>{49, 100, 149}),
+            histogram_boundaries(
+                std::vector<Histogram_bucket>{{0, 99, 0.4}, {100, 199, 0.8}},
+                50, 200, uint64_t{0}, uint64_t{199}, interrupted));
+
+  // histogram is not usable
+  EXPECT_TRUE(histogram_boundaries(std::vector<Histogram_bucket>{}, 50, 200, 0,
+                                   199, interrupted)
+                  .empty());
+  EXPECT_TRUE(histogram_boundaries(std::vector<Histogram_bucket>{{0, 99, 0.0}},
+                                   50, 200, 0, 199, interrupted)
+                  .empty());
+  EXPECT_TRUE(
+      histogram_boundaries(buckets, 0, 200, 0, 199, interrupted).empty());
+  EXPECT_TRUE(
+      histogram_boundaries(buckets, 50, 0, 0, 199, interrupted).empty());
+
+  // computation is interrupted
+  const bool interrupt = true;
+  EXPECT_TRUE(
+      histogram_boundaries(buckets, 50, 200, 0, 199, interrupt).empty());
+}
+
+TEST(Dumper_test, histogram_boundaries_singleton) {
+  const bool interrupted = false;
+  // values 1, 2, 3, 4, each of them is 25% of the rows
+  const std::vector<Histogram_bucket> buckets = {
+      {1, 1, 0.25}, {2, 2, 0.5}, {3, 3, 0.75}, {4, 4, 1.0}};
+
+  EXPECT_EQ(
+      (std::vector<int64_t>{2, 3, 4}),
+      histogram_boundaries(buckets, 1, 4, int64_t{1}, int64_t{5}, interrupted));
+  EXPECT_EQ(
+      (std::vector<int64_t>{3}),
+      histogram_boundaries(buckets, 2, 4, int64_t{1}, int64_t{4}, interrupted));
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
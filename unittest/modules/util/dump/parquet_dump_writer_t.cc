@@ -0,0 +1,754 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/common/parquet/encoding.h"
+#include "modules/util/common/parquet/format.h"
+#include "modules/util/common/parquet/thrift_compact.h"
+#include "modules/util/common/parquet/utils.h"
+#include "modules/util/dump/parquet_dump_writer.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+
+namespace mysqlsh {
+namespace dump {
+
+using mysqlshdk::db::Type;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+using parquet::read_le;
+using parquet::Thrift_compact_reader;
+
+namespace {
+
+// NULL values are represented by std::nullopt
+using Rows = std::vector<std::vector<std::optional<std::string>>>;
+
+std::string bytes(std::initializer_list<uint8_t> b) {
+  return std::string(b.begin(), b.end());
+}
+
+mysqlshdk::db::Column column(const std::string &name, Type type,
+                             uint32_t length = 0, int fractional = 0,
+                             bool is_unsigned = false) {
+  return mysqlshdk::db::Column("", "", "t", "t", name, name, length,
+                               fractional, type, 33, is_unsigned, false,
+                               false);
+}
+
+std::string write_file(const std::vector<mysqlshdk::db::Column> &columns,
+                       const Rows &rows) {
+  Memory_file output{"output.parquet"};
+  output.open(Mode::WRITE);
+
+  Parquet_dump_writer writer{mysqlshdk::storage::Compression::NONE};
+  writer.set_output_file(&output);
+  writer.open();
+  writer.write_preamble(columns);
+
+  for (const auto &row : rows) {
+    std::vector<const char *> data;
+    std::vector<unsigned long> lengths;
+
+    for (const auto &value : row) {
+      data.emplace_back(value.has_value() ? value->data() : nullptr);
+      lengths.emplace_back(value.has_value() ? value->length() : 0);
+    }
+
+    writer.write_row(Dump_writer::Raw_row{data.data(), lengths.data()});
+  }
+
+  writer.write_postamble();
+  writer.close();
+
+  return output.content();
+}
+
+struct Schema_element {
+  std::string name;
+  int32_t type = -1;
+  int32_t repetition = -1;
+  int32_t num_children = 0;
+  int32_t converted_type = parquet::NONE;
+  int32_t scale = 0;
+  int32_t precision = 0;
+};
+
+struct Column_chunk {
+  int64_t file_offset = 0;
+  int32_t type = -1;
+  std::vector<int32_t> encodings;
+  std::vector<std::string> path;
+  int32_t codec = -1;
+  int64_t num_values = 0;
+  int64_t uncompressed_size = 0;
+  int64_t compressed_size = 0;
+  int64_t data_page_offset = 0;
+  int64_t dictionary_page_offset = -1;
+};
+
+struct Row_group {
+  std::vector<Column_chunk> columns;
+  int64_t total_byte_size = 0;
+  int64_t num_rows = 0;
+};
+
+struct File_metadata {
+  int32_t version = 0;
+  std::vector<Schema_element> schema;
+  int64_t num_rows = 0;
+  std::vector<Row_group> row_groups;
+  std::string created_by;
+};
+
+std::vector<int32_t> read_i32_list(Thrift_compact_reader *t, uint8_t type) {
+  uint8_t element_type;
+  std::vector<int32_t> result(t->read_list(type, &element_type));
+
+  for (auto &v : result) {
+    v = t->read_i32(element_type);
+  }
+
+  return result;
+}
+
+std::vector<std::string> read_binary_list(Thrift_compact_reader *t,
+                                          uint8_t type) {
+  uint8_t element_type;
+  std::vector<std::string> result(t->read_list(type, &element_type));
+
+  for (auto &v : result) {
+    v = t->read_binary(element_type);
+  }
+
+  return result;
+}
+
+void read_column_chunk(Thrift_compact_reader *t, Column_chunk *chunk) {
+  parquet::read_struct(t, [&](int16_t id, uint8_t type) {
+    switch (id) {
+      case 2:
+        chunk->file_offset = t->read_int(type);
+        return true;
+
+      case 3:
+        parquet::read_struct(t, [&](int16_t f, uint8_t ft) {
+          switch (f) {
+            case 1:
+              chunk->type = t->read_i32(ft);
+              return true;
+            case 2:
+              chunk->encodings = read_i32_list(t, ft);
+              return true;
+            case 3:
+              chunk->path = read_binary_list(t, ft);
+              return true;
+            case 4:
+              chunk->codec = t->read_i32(ft);
+              return true;
+            case 5:
+              chunk->num_values = t->read_int(ft);
+              return true;
+            case 6:
+              chunk->uncompressed_size = t->read_int(ft);
+              return true;
+            case 7:
+              chunk->compressed_size = t->read_int(ft);
+              return true;
+            case 9:
+              chunk->data_page_offset = t->read_int(ft);
+              return true;
+            case 11:
+              chunk->dictionary_page_offset = t->read_int(ft);
+              return true;
+          }
+
+          ADD_FAILURE() << "Unexpected ColumnMetaData field: " << f;
+          return false;
+        });
+        return true;
+    }
+
+    ADD_FAILURE() << "Unexpected ColumnChunk field: " << id;
+    return false;
+  });
+}
+
+/**
+ * Checks the layout of the footer: PAR1, FileMetaData, its length, PAR1.
+ */
+File_metadata read_footer(const std::string &file, uint64_t *metadata_offset) {
+  EXPECT_GE(file.length(), 12);
+  EXPECT_EQ("PAR1", file.substr(0, 4));
+  EXPECT_EQ("PAR1", file.substr(file.length() - 4));
+
+  const auto length = read_le(file.data() + file.length() - 8, 4);
+  *metadata_offset = file.length() - 8 - length;
+
+  Thrift_compact_reader t{file.data() + *metadata_offset, length};
+  File_metadata metadata;
+
+  parquet::read_struct(&t, [&](int16_t id, uint8_t type) {
+    switch (id) {
+      case 1:
+        metadata.version = t.read_i32(type);
+        return true;
+
+      case 2:
+        parquet::read_struct_list(&t, type, [&](std::size_t) {
+          auto &e = metadata.schema.emplace_back();
+
+          parquet::read_struct(&t, [&](int16_t f, uint8_t ft) {
+            switch (f) {
+              case 1:
+                e.type = t.read_i32(ft);
+                return true;
+              case 3:
+                e.repetition = t.read_i32(ft);
+                return true;
+              case 4:
+                e.name = t.read_binary(ft);
+                return true;
+              case 5:
+                e.num_children = t.read_i32(ft);
+                return true;
+              case 6:
+                e.converted_type = t.read_i32(ft);
+                return true;
+              case 7:
+                e.scale = t.read_i32(ft);
+                return true;
+              case 8:
+                e.precision = t.read_i32(ft);
+                return true;
+            }
+
+            ADD_FAILURE() << "Unexpected SchemaElement field: " << f;
+            return false;
+          });
+        });
+        return true;
+
+      case 3:
+        metadata.num_rows = t.read_int(type);
+        return true;
+
+      case 4:
+        parquet::read_struct_list(&t, type, [&](std::size_t) {
+          auto &g = metadata.row_groups.emplace_back();
+
+          parquet::read_struct(&t, [&](int16_t f, uint8_t ft) {
+            switch (f) {
+              case 1:
+                parquet::read_struct_list(&t, ft, [&](std::size_t) {
+                  read_column_chunk(&t, &g.columns.emplace_back());
+                });
+                return true;
+              case 2:
+                g.total_byte_size = t.read_int(ft);
+                return true;
+              case 3:
+                g.num_rows = t.read_int(ft);
+                return true;
+            }
+
+            ADD_FAILURE() << "Unexpected RowGroup field: " << f;
+            return false;
+          });
+        });
+        return true;
+
+      case 6:
+        metadata.created_by = t.read_binary(type);
+        return true;
+    }
+
+    ADD_FAILURE() << "Unexpected FileMetaData field: " << id;
+    return false;
+  });
+
+  // whole footer was consumed
+  EXPECT_EQ(length, t.offset());
+
+  return metadata;
+}
+
+struct Page {
+  int32_t type = -1;
+  int32_t uncompressed_size = 0;
+  int32_t compressed_size = 0;
+  int32_t num_values = 0;
+  int32_t encoding = -1;
+  int32_t definition_level_encoding = -1;
+  int32_t repetition_level_encoding = -1;
+  // offset of the next page
+  uint64_t end = 0;
+  std::string data;
+};
+
+Page read_page(const std::string &file, uint64_t offset) {
+  Thrift_compact_reader t{file.data() + offset, file.length() - offset};
+  Page page;
+
+  parquet::read_struct(&t, [&](int16_t id, uint8_t type) {
+    switch (id) {
+      case 1:
+        page.type = t.read_i32(type);
+        return true;
+
+      case 2:
+        page.uncompressed_size = t.read_i32(type);
+        return true;
+
+      case 3:
+        page.compressed_size = t.read_i32(type);
+        return true;
+
+      case 5:
+      case 7:
+        parquet::read_struct(&t, [&](int16_t f, uint8_t ft) {
+          switch (f) {
+            case 1:
+              page.num_values = t.read_i32(ft);
+              return true;
+            case 2:
+              page.encoding = t.read_i32(ft);
+              return true;
+            case 3:
+              page.definition_level_encoding = t.read_i32(ft);
+              return true;
+            case 4:
+              page.repetition_level_encoding = t.read_i32(ft);
+              return true;
+          }
+
+          ADD_FAILURE() << "Unexpected page header field: " << f;
+          return false;
+        });
+        return true;
+    }
+
+    ADD_FAILURE() << "Unexpected PageHeader field: " << id;
+    return false;
+  });
+
+  const auto data = offset + t.offset();
+  page.data = file.substr(data, page.compressed_size);
+  page.end = data + page.compressed_size;
+
+  return page;
+}
+
+/**
+ * Reads all pages of the column chunk, checks that they are contiguous and
+ * their sizes match the metadata.
+ */
+std::vector<Page> read_pages(const std::string &file,
+                             const Column_chunk &chunk) {
+  std::vector<Page> pages;
+  auto offset = static_cast<uint64_t>(chunk.file_offset);
+  int64_t uncompressed_size = 0;
+
+  while (offset < static_cast<uint64_t>(chunk.file_offset +
+                                        chunk.compressed_size)) {
+    auto page = read_page(file, offset);
+
+    uncompressed_size += page.end - offset - page.compressed_size +
+                         page.uncompressed_size;
+    offset = page.end;
+    pages.emplace_back(std::move(page));
+  }
+
+  EXPECT_EQ(chunk.file_offset + chunk.compressed_size,
+            static_cast<int64_t>(offset));
+  EXPECT_EQ(chunk.uncompressed_size, uncompressed_size);
+
+  return pages;
+}
+
+std::string plain(const std::string &value) {
+  std::string result;
+  parquet::write_le(value.length(), 4, &result);
+  return result + value;
+}
+
+std::string decimal(const std::string &value) {
+  std::string result;
+  parquet::encode_decimal(value.data(), value.length(), &result);
+  return result;
+}
+
+}  // namespace
+
+TEST(Parquet_dump_writer_test, footer_layout) {
+  const auto file = write_file(
+      {column("id", Type::Integer), column("name", Type::String)},
+      {{"1", "a"}, {"2", std::nullopt}, {"3", "a"}});
+
+  uint64_t metadata_offset = 0;
+  const auto metadata = read_footer(file, &metadata_offset);
+
+  EXPECT_EQ(1, metadata.version);
+  EXPECT_EQ(3, metadata.num_rows);
+  EXPECT_EQ("MySQL Shell " MYSH_VERSION, metadata.created_by);
+
+  // flat schema: root with two optional columns
+  ASSERT_EQ(3, metadata.schema.size());
+  EXPECT_EQ("schema", metadata.schema[0].name);
+  EXPECT_EQ(-1, metadata.schema[0].type);
+  EXPECT_EQ(2, metadata.schema[0].num_children);
+
+  EXPECT_EQ("id", metadata.schema[1].name);
+  EXPECT_EQ(parquet::INT64, metadata.schema[1].type);
+  EXPECT_EQ(parquet::OPTIONAL, metadata.schema[1].repetition);
+  EXPECT_EQ(parquet::NONE, metadata.schema[1].converted_type);
+
+  EXPECT_EQ("name", metadata.schema[2].name);
+  EXPECT_EQ(parquet::BYTE_ARRAY, metadata.schema[2].type);
+  EXPECT_EQ(parquet::OPTIONAL, metadata.schema[2].repetition);
+  EXPECT_EQ(parquet::UTF8, metadata.schema[2].converted_type);
+
+  ASSERT_EQ(1, metadata.row_groups.size());
+
+  const auto &group = metadata.row_groups[0];
+  EXPECT_EQ(3, group.num_rows);
+  ASSERT_EQ(2, group.columns.size());
+
+  // column chunks follow the magic and each other, metadata follows the last
+  // chunk
+  uint64_t offset = parquet::k_magic_length;
+  int64_t total_byte_size = 0;
+
+  for (std::size_t i = 0; i < group.columns.size(); ++i) {
+    SCOPED_TRACE(i);
+
+    const auto &chunk = group.columns[i];
+
+    EXPECT_EQ(static_cast<int64_t>(offset), chunk.file_offset);
+    EXPECT_EQ(metadata.schema[i + 1].type, chunk.type);
+    EXPECT_EQ(std::vector<std::string>{metadata.schema[i + 1].name},
+              chunk.path);
+    EXPECT_EQ(parquet::UNCOMPRESSED, chunk.codec);
+    EXPECT_EQ(3, chunk.num_values);
+    EXPECT_EQ(chunk.uncompressed_size, chunk.compressed_size);
+
+    // dictionary page is first, followed by the data page
+    EXPECT_EQ(std::vector<int32_t>(
+                  {parquet::PLAIN_DICTIONARY, parquet::PLAIN, parquet::RLE}),
+              chunk.encodings);
+    EXPECT_EQ(chunk.file_offset, chunk.dictionary_page_offset);
+
+    const auto pages = read_pages(file, chunk);
+    ASSERT_EQ(2, pages.size());
+
+    EXPECT_EQ(parquet::DICTIONARY_PAGE, pages[0].type);
+    EXPECT_EQ(static_cast<int64_t>(pages[0].end), chunk.data_page_offset);
+    EXPECT_EQ(parquet::DATA_PAGE, pages[1].type);
+    EXPECT_EQ(3, pages[1].num_values);
+    EXPECT_EQ(parquet::RLE, pages[1].definition_level_encoding);
+    EXPECT_EQ(parquet::RLE, pages[1].repetition_level_encoding);
+
+    offset += chunk.compressed_size;
+    total_byte_size += chunk.uncompressed_size;
+  }
+
+  EXPECT_EQ(offset, metadata_offset);
+  EXPECT_EQ(total_byte_size, group.total_byte_size);
+
+  // empty file: magic, metadata without row groups, length, magic
+  const auto empty = write_file({column("id", Type::Integer)}, {});
+  const auto empty_metadata = read_footer(empty, &metadata_offset);
+
+  EXPECT_EQ(parquet::k_magic_length, metadata_offset);
+  EXPECT_EQ(0, empty_metadata.num_rows);
+  EXPECT_EQ(2, empty_metadata.schema.size());
+  EXPECT_TRUE(empty_metadata.row_groups.empty());
+}
+
+TEST(Parquet_dump_writer_test, hybrid_runs) {
+  {
+    // 100 equal values, single-entry dictionary
+    const auto file =
+        write_file({column("c", Type::Integer)}, Rows(100, {"7"}));
+
+    uint64_t metadata_offset = 0;
+    const auto metadata = read_footer(file, &metadata_offset);
+    const auto pages = read_pages(file, metadata.row_groups[0].columns[0]);
+    ASSERT_EQ(2, pages.size());
+
+    EXPECT_EQ(1, pages[0].num_values);
+    EXPECT_EQ(parquet::PLAIN_DICTIONARY, pages[0].encoding);
+    EXPECT_EQ(bytes({0x07, 0, 0, 0, 0, 0, 0, 0}), pages[0].data);
+
+    EXPECT_EQ(100, pages[1].num_values);
+    EXPECT_EQ(parquet::PLAIN_DICTIONARY, pages[1].encoding);
+    EXPECT_EQ(bytes({
+                  // length of definition levels
+                  0x03, 0x00, 0x00, 0x00,
+                  // RLE run: 100 << 1, value 1
+                  0xC8, 0x01, 0x01,
+                  // bit width of indices is at least 1
+                  0x01,
+                  // RLE run: 100 << 1, index 0
+                  0xC8, 0x01, 0x00,
+              }),
+              pages[1].data);
+  }
+
+  {
+    // bit-packed group followed by a run
+    Rows rows = {
+        {std::nullopt}, {"x"}, {"y"}, {std::nullopt},
+        {"x"},          {"x"}, {"x"}, {"x"},
+    };
+    rows.insert(rows.end(), 8, {"x"});
+
+    const auto file = write_file({column("c", Type::String)}, rows);
+
+    uint64_t metadata_offset = 0;
+    const auto metadata = read_footer(file, &metadata_offset);
+    const auto pages = read_pages(file, metadata.row_groups[0].columns[0]);
+    ASSERT_EQ(2, pages.size());
+
+    EXPECT_EQ(2, pages[0].num_values);
+    EXPECT_EQ(plain("x") + plain("y"), pages[0].data);
+
+    EXPECT_EQ(16, pages[1].num_values);
+    EXPECT_EQ(bytes({
+                  // length of definition levels
+                  0x04, 0x00, 0x00, 0x00,
+                  // one bit-packed group: 0, 1, 1, 0, 1, 1, 1, 1
+                  0x03, 0xF6,
+                  // RLE run: 8 << 1, value 1
+                  0x10, 0x01,
+                  // bit width of indices
+                  0x01,
+                  // 14 values, two bit-packed groups: 0, 1, 0, ..., the last
+                  // one is padded with zeros
+                  0x05, 0x02, 0x00,
+              }),
+              pages[1].data);
+  }
+
+  {
+    // all values are NULL, no dictionary
+    const auto file =
+        write_file({column("c", Type::String)}, Rows(20, {std::nullopt}));
+
+    uint64_t metadata_offset = 0;
+    const auto metadata = read_footer(file, &metadata_offset);
+    const auto &chunk = metadata.row_groups[0].columns[0];
+
+    EXPECT_EQ(-1, chunk.dictionary_page_offset);
+    EXPECT_EQ(std::vector<int32_t>({parquet::PLAIN, parquet::RLE}),
+              chunk.encodings);
+
+    const auto pages = read_pages(file, chunk);
+    ASSERT_EQ(1, pages.size());
+
+    EXPECT_EQ(parquet::PLAIN, pages[0].encoding);
+    EXPECT_EQ(20, pages[0].num_values);
+    EXPECT_EQ(bytes({0x02, 0x00, 0x00, 0x00, 0x28, 0x00}), pages[0].data);
+  }
+}
+
+TEST(Parquet_dump_writer_test, decimal_encoding) {
+  // length prefix, followed by big-endian two's complement, using the minimum
+  // number of bytes
+  const auto encoded = [](std::initializer_list<uint8_t> b) {
+    std::string result;
+    parquet::write_le(b.size(), 4, &result);
+    return result + bytes(b);
+  };
+
+  EXPECT_EQ(encoded({0x00}), decimal("0"));
+  EXPECT_EQ(encoded({0x00}), decimal("-0.00"));
+  EXPECT_EQ(encoded({0x01}), decimal("0.01"));
+  EXPECT_EQ(encoded({0xFF}), decimal("-0.01"));
+  EXPECT_EQ(encoded({0xCF, 0xC7}), decimal("-123.45"));
+  EXPECT_EQ(encoded({0x30, 0x39}), decimal("123.45"));
+
+  // byte boundaries
+  EXPECT_EQ(encoded({0x7F}), decimal("127"));
+  EXPECT_EQ(encoded({0x00, 0x80}), decimal("128"));
+  EXPECT_EQ(encoded({0x80}), decimal("-128"));
+  EXPECT_EQ(encoded({0xFF, 0x7F}), decimal("-129"));
+  EXPECT_EQ(encoded({0x00, 0xFF}), decimal("255"));
+  EXPECT_EQ(encoded({0x01, 0x00}), decimal("256"));
+  EXPECT_EQ(encoded({0x7F, 0xFF}), decimal("327.67"));
+  EXPECT_EQ(encoded({0x00, 0x80, 0x00}), decimal("327.68"));
+  EXPECT_EQ(encoded({0x80, 0x00}), decimal("-327.68"));
+  EXPECT_EQ(encoded({0xFF, 0x7F, 0xFF}), decimal("-327.69"));
+  EXPECT_EQ(encoded({0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}),
+            decimal("9223372036854775807"));
+  EXPECT_EQ(encoded({0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}),
+            decimal("9223372036854775808"));
+  EXPECT_EQ(encoded({0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}),
+            decimal("-9223372036854775808"));
+
+  // DECIMAL(65)
+  EXPECT_EQ(encoded({0x00, 0xF3, 0x16, 0x27, 0x1C, 0x7F, 0xC3, 0x90, 0x8A, 0x8B,
+                     0xEF, 0x46, 0x4E, 0x39, 0x45, 0xEF, 0x7A, 0x25, 0x36, 0x09,
+                     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}),
+            decimal(std::string(35, '9') + "." + std::string(30, '9')));
+  EXPECT_EQ(encoded({0xFF, 0x0C, 0xE9, 0xD8, 0xE3, 0x80, 0x3C, 0x6F, 0x75, 0x74,
+                     0x10, 0xB9, 0xB1, 0xC6, 0xBA, 0x10, 0x85, 0xDA, 0xC9, 0xF6,
+                     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01}),
+            decimal("-" + std::string(65, '9')));
+}
+
+TEST(Parquet_dump_writer_test, decimal_columns) {
+  // length reported by the server includes the sign and the decimal point
+  const auto file = write_file(
+      {
+          column("d_10_2", Type::Decimal, 12, 2),
+          column("d_10_0", Type::Decimal, 11, 0),
+          column("d_65_30", Type::Decimal, 67, 30),
+          column("d_5_5_unsigned", Type::Decimal, 6, 5, true),
+          column("d_1_0_unsigned", Type::Decimal, 1, 0, true),
+      },
+      {
+          {"-12345678.90", "-9999999999",
+           "-" + std::string(35, '9') + "." + std::string(30, '9'), "0.12345",
+           "9"},
+          {"99999999.99", "9999999999",
+           std::string(35, '9') + "." + std::string(30, '9'), "0.99999", "0"},
+      });
+
+  uint64_t metadata_offset = 0;
+  const auto metadata = read_footer(file, &metadata_offset);
+
+  const std::vector<std::pair<int32_t, int32_t>> precision_scale = {
+      {10, 2}, {10, 0}, {65, 30}, {5, 5}, {1, 0}};
+
+  ASSERT_EQ(precision_scale.size() + 1, metadata.schema.size());
+
+  for (std::size_t i = 0; i < precision_scale.size(); ++i) {
+    const auto &e = metadata.schema[i + 1];
+    SCOPED_TRACE(e.name);
+
+    EXPECT_EQ(parquet::BYTE_ARRAY, e.type);
+    EXPECT_EQ(parquet::DECIMAL, e.converted_type);
+    EXPECT_EQ(precision_scale[i].first, e.precision);
+    EXPECT_EQ(precision_scale[i].second, e.scale);
+  }
+
+  // values are stored in the dictionary
+  const auto &columns = metadata.row_groups[0].columns;
+
+  EXPECT_EQ(decimal("-1234567890") + decimal("9999999999"),
+            read_pages(file, columns[0])[0].data);
+  EXPECT_EQ(decimal("-9999999999") + decimal("9999999999"),
+            read_pages(file, columns[1])[0].data);
+  EXPECT_EQ(decimal("-" + std::string(65, '9')) +
+                decimal(std::string(65, '9')),
+            read_pages(file, columns[2])[0].data);
+  EXPECT_EQ(bytes({2, 0, 0, 0, 0x30, 0x39, 3, 0, 0, 0, 0x01, 0x86, 0x9F}),
+            read_pages(file, columns[3])[0].data);
+  EXPECT_EQ(bytes({1, 0, 0, 0, 0x09, 1, 0, 0, 0, 0x00}),
+            read_pages(file, columns[4])[0].data);
+}
+
+TEST(Parquet_dump_writer_test, dictionary_fallback) {
+  // distinct values exceed the maximum size of a dictionary (1 MiB)
+  Rows rows;
+  std::string expected_values;
+
+  for (int i = 0; i < 1200; ++i) {
+    auto value = std::to_string(i);
+    value.resize(1000, 'a');
+
+    expected_values += plain(value);
+    rows.push_back({value, "same"});
+  }
+
+  const auto file = write_file(
+      {column("distinct", Type::String), column("same", Type::String)}, rows);
+
+  uint64_t metadata_offset = 0;
+  const auto metadata = read_footer(file, &metadata_offset);
+  const auto &columns = metadata.row_groups[0].columns;
+
+  {
+    // plain encoding, data pages only
+    const auto &chunk = columns[0];
+
+    EXPECT_EQ(-1, chunk.dictionary_page_offset);
+    EXPECT_EQ(chunk.file_offset, chunk.data_page_offset);
+    EXPECT_EQ(std::vector<int32_t>({parquet::PLAIN, parquet::RLE}),
+              chunk.encodings);
+
+    const auto pages = read_pages(file, chunk);
+    // values are split into pages of approximately 1 MiB
+    ASSERT_EQ(2, pages.size());
+
+    std::string values;
+    int32_t num_values = 0;
+
+    for (const auto &page : pages) {
+      EXPECT_EQ(parquet::DATA_PAGE, page.type);
+      EXPECT_EQ(parquet::PLAIN, page.encoding);
+
+      num_values += page.num_values;
+
+      // all values are set: a single RLE run of definition levels
+      std::string levels;
+      parquet::write_uleb128(static_cast<uint64_t>(page.num_values) << 1,
+                             &levels);
+      levels.push_back('\x01');
+
+      const auto length = read_le(page.data.data(), 4);
+      EXPECT_EQ(levels, page.data.substr(4, length));
+
+      values += page.data.substr(4 + length);
+    }
+
+    EXPECT_EQ(1200, num_values);
+    EXPECT_EQ(expected_values, values);
+  }
+
+  {
+    // column with repeated values still uses a dictionary
+    const auto &chunk = columns[1];
+
+    EXPECT_EQ(chunk.file_offset, chunk.dictionary_page_offset);
+    EXPECT_EQ(std::vector<int32_t>(
+                  {parquet::PLAIN_DICTIONARY, parquet::PLAIN, parquet::RLE}),
+              chunk.encodings);
+
+    const auto pages = read_pages(file, chunk);
+    ASSERT_EQ(2, pages.size());
+    EXPECT_EQ(plain("same"), pages[0].data);
+    EXPECT_EQ(parquet::PLAIN_DICTIONARY, pages[1].encoding);
+  }
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
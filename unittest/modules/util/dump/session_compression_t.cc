@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "unittest/gprod_clean.h"
+
+#include "modules/util/common/dump/session_compression.h"
+#include "mysqlshdk/libs/db/utils_connection.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+using mysqlshdk::db::Connection_options;
+
+TEST(Session_compression_test, parse) {
+  EXPECT_EQ(Session_compression::AUTO, to_session_compression("auto"));
+  EXPECT_EQ(Session_compression::OFF, to_session_compression("OFF"));
+  EXPECT_EQ(Session_compression::ZSTD, to_session_compression("zstd"));
+  EXPECT_EQ(Session_compression::ZLIB, to_session_compression("Zlib"));
+
+  EXPECT_THROW(to_session_compression(""), std::invalid_argument);
+  EXPECT_THROW(to_session_compression("lz4"), std::invalid_argument);
+
+  for (const auto c :
+       {Session_compression::AUTO, Session_compression::OFF,
+        Session_compression::ZSTD, Session_compression::ZLIB}) {
+    EXPECT_EQ(c, to_session_compression(to_string(c)));
+  }
+}
+
+TEST(Session_compression_test, set) {
+  const auto options = [](const std::string &uri) {
+    return Connection_options{uri};
+  };
+
+  {
+    auto co = options("root@host:3306?compression=REQUIRED");
+    set_session_compression(Session_compression::ZSTD, nullptr, &co);
+    EXPECT_FALSE(co.has_compression());
+    EXPECT_EQ("zstd,uncompressed", co.get_compression_algorithms());
+  }
+
+  {
+    auto co = options("root@host:3306?compression-algorithms=zstd");
+    set_session_compression(Session_compression::ZLIB, nullptr, &co);
+    EXPECT_EQ("zlib,uncompressed", co.get_compression_algorithms());
+  }
+
+  {
+    auto co = options(
+        "root@host:3306?compression=REQUIRED&compression-algorithms=zstd&"
+        "compression-level=5");
+    set_session_compression(Session_compression::OFF, nullptr, &co);
+    EXPECT_FALSE(co.has_compression());
+    EXPECT_FALSE(co.has_compression_algorithms());
+    EXPECT_FALSE(co.has_compression_level());
+  }
+
+  {
+    // explicit configuration is kept, connection is not measured
+    auto co = options("root@host:3306?compression=DISABLED");
+    set_session_compression(Session_compression::AUTO, nullptr, &co);
+    EXPECT_EQ(mysqlshdk::db::kCompressionDisabled, co.get_compression());
+    EXPECT_FALSE(co.has_compression_algorithms());
+  }
+
+  {
+    // local connection is not measured
+    auto co = options("root@(/tmp/mysql.sock)");
+    set_session_compression(Session_compression::AUTO, nullptr, &co);
+    EXPECT_FALSE(co.has_compression());
+    EXPECT_FALSE(co.has_compression_algorithms());
+  }
+}
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
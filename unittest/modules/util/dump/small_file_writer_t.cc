@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/dump/small_file_writer.h"
+
+namespace mysqlsh {
+namespace dump {
+
+TEST(Small_file_writer, all_files_written) {
+  std::mutex mutex;
+  std::map<std::string, std::string> files;
+
+  Small_file_writer writer{
+      4, [&](const std::string &filename, const std::string &contents) {
+        std::lock_guard lock{mutex};
+        files.emplace(filename, contents);
+      }};
+
+  for (int i = 0; i < 100; ++i) {
+    writer.write("file" + std::to_string(i), std::to_string(i));
+  }
+
+  writer.wait();
+
+  ASSERT_EQ(100, files.size());
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(std::to_string(i), files["file" + std::to_string(i)]);
+  }
+
+  EXPECT_FALSE(writer.aborted());
+}
+
+TEST(Small_file_writer, writes_are_concurrent) {
+  constexpr int k_threads = 4;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  int started = 0;
+
+  // each write waits until all threads are writing, this finishes only if
+  // writes are executed concurrently
+  Small_file_writer writer{
+      k_threads, [&](const std::string &, const std::string &) {
+        std::unique_lock lock{mutex};
+        ++started;
+        cv.notify_all();
+
+        EXPECT_TRUE(cv.wait_for(lock, std::chrono::seconds{10},
+                                [&]() { return started >= k_threads; }));
+      }};
+
+  for (int i = 0; i < k_threads; ++i) {
+    writer.write("file" + std::to_string(i), "");
+  }
+
+  writer.wait();
+
+  EXPECT_EQ(k_threads, started);
+}
+
+TEST(Small_file_writer, error_is_rethrown) {
+  std::atomic<int> written{0};
+
+  Small_file_writer writer{
+      1, [&](const std::string &filename, const std::string &) {
+        if ("bad" == filename) {
+          throw std::runtime_error("write failed");
+        }
+
+        ++written;
+      }};
+
+  writer.write("good", "");
+  writer.write("bad", "");
+
+  EXPECT_THROW_MSG(writer.wait(), std::runtime_error, "write failed");
+  EXPECT_TRUE(writer.aborted());
+
+  // no more writes are accepted
+  EXPECT_THROW(writer.write("next", ""), std::runtime_error);
+  EXPECT_EQ(1, written);
+}
+
+TEST(Small_file_writer, terminate) {
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool release = false;
+  std::atomic<int> written{0};
+
+  Small_file_writer writer{
+      1, [&](const std::string &, const std::string &) {
+        std::unique_lock lock{mutex};
+        cv.wait(lock, [&]() { return release; });
+        ++written;
+      }};
+
+  for (int i = 0; i < 10; ++i) {
+    writer.write("file" + std::to_string(i), "");
+  }
+
+  writer.terminate();
+  EXPECT_TRUE(writer.aborted());
+
+  {
+    std::lock_guard lock{mutex};
+    release = true;
+  }
+
+  cv.notify_all();
+
+  EXPECT_NO_THROW(writer.wait());
+  // write which was in progress is finished, the remaining ones are abandoned
+  EXPECT_GT(10, written);
+  EXPECT_THROW(writer.write("next", ""), std::runtime_error);
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/dump/table_chunks.h"
+
+namespace mysqlsh {
+namespace dump {
+
+TEST(Table_chunks_test, final_chunk) {
+  Table_chunks chunks;
+
+  // no chunks, no final chunk
+  EXPECT_FALSE(chunks.finish_chunking().has_value());
+
+  Table_chunks other;
+
+  EXPECT_EQ(0, other.create_chunk());
+  EXPECT_EQ(1, other.create_chunk());
+  EXPECT_FALSE(other.chunk_finished().has_value());
+  // chunking is not finished yet
+  EXPECT_FALSE(other.chunk_finished().has_value());
+
+  const auto idx = other.finish_chunking();
+  ASSERT_TRUE(idx.has_value());
+  EXPECT_EQ(2, *idx);
+}
+
+TEST(Table_chunks_test, split) {
+  const auto chunks = std::make_shared<Table_chunks>();
+  Chunk_range range{chunks, 0, 10000};
+
+  EXPECT_EQ(0, chunks->create_chunk());
+  EXPECT_DOUBLE_EQ(1.0, range.remaining());
+
+  uint64_t begin = 0;
+  uint64_t end = 0;
+  std::size_t idx = 0;
+  bool split = false;
+
+  std::thread thief{[&]() { split = range.split(&begin, &end, &idx); }};
+
+  // owner reads rows until split request is handled
+  while (range.remaining() > 0.75) {
+    EXPECT_TRUE(range.accept(0));
+  }
+
+  thief.join();
+
+  ASSERT_TRUE(split);
+  EXPECT_EQ(5001, begin);
+  EXPECT_EQ(10000, end);
+  EXPECT_EQ(1, idx);
+
+  EXPECT_TRUE(range.accept(5000));
+  EXPECT_FALSE(range.accept(5001));
+  EXPECT_TRUE(range.stopped());
+
+  range.finish();
+
+  // chunk is finished, it cannot be split anymore
+  EXPECT_FALSE(range.split(&begin, &end, &idx));
+}
+
+TEST(Table_chunks_test, split_races_with_final_chunk) {
+  // owner finishes its chunk right after the split is handled, before the
+  // thread which has stolen the range has a chance to run, final chunk has to
+  // wait for the stolen one
+  for (int i = 0; i < 100; ++i) {
+    SCOPED_TRACE(i);
+
+    const auto chunks = std::make_shared<Table_chunks>();
+    const auto owned = chunks->create_chunk();
+    Chunk_range range{chunks, 0, 10000};
+
+    EXPECT_FALSE(chunks->finish_chunking().has_value());
+
+    uint64_t begin = 0;
+    uint64_t end = 0;
+    std::size_t stolen = 0;
+    bool split = false;
+    std::optional<std::size_t> final_from_thief;
+
+    std::thread thief{[&]() {
+      split = range.split(&begin, &end, &stolen);
+
+      if (split) {
+        final_from_thief = chunks->chunk_finished();
+      }
+    }};
+
+    while (range.remaining() > 0.75) {
+      range.accept(0);
+    }
+
+    range.finish();
+    const auto final_from_owner = chunks->chunk_finished();
+
+    thief.join();
+
+    ASSERT_TRUE(split);
+    EXPECT_EQ(0, owned);
+    EXPECT_EQ(1, stolen);
+
+    // final chunk is created exactly once, after both chunks are finished,
+    // using the next index
+    ASSERT_NE(final_from_owner.has_value(), final_from_thief.has_value());
+    EXPECT_EQ(2, final_from_owner.has_value() ? *final_from_owner
+                                              : *final_from_thief);
+  }
+}
+
+TEST(Table_chunks_test, ordered) {
+  EXPECT_LT(Chunk_range::to_ordered(-1), Chunk_range::to_ordered(0));
+  EXPECT_LT(Chunk_range::to_ordered(INT64_MIN), Chunk_range::to_ordered(-1));
+  EXPECT_LT(Chunk_range::to_ordered(0), Chunk_range::to_ordered(INT64_MAX));
+  EXPECT_EQ(-12345, Chunk_range::from_ordered(Chunk_range::to_ordered(-12345)));
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,557 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+#include "unittest/test_utils/mocks/gmock_clean.h"
+
+#include "modules/util/import_table/arrow_ipc_reader.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+using ::testing::HasSubstr;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+namespace {
+
+using Rows = std::vector<std::vector<std::string>>;
+
+std::string le(uint64_t value, int bytes) {
+  std::string result;
+
+  for (int i = 0; i < bytes; ++i) {
+    result.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+
+  return result;
+}
+
+void patch_le(uint64_t value, int bytes, std::size_t position,
+              std::string *out) {
+  out->replace(position, bytes, le(value, bytes));
+}
+
+/**
+ * Table of a flatbuffer, fields are indexed by their IDs.
+ */
+struct Fb_table {
+  struct Field {
+    enum class Kind { SCALAR, STRING, TABLE, TABLES, STRUCTS };
+
+    Kind kind = Kind::SCALAR;
+    // SCALAR: inline value, STRING: contents, STRUCTS: all elements
+    std::string bytes;
+    // STRUCTS: number of elements
+    std::size_t count = 0;
+    // TABLE: single element, TABLES: all elements
+    std::vector<Fb_table> tables;
+  };
+
+  Fb_table &scalar(std::size_t id, uint64_t value, int bytes) {
+    return set(id, {Field::Kind::SCALAR, le(value, bytes)});
+  }
+
+  Fb_table &string(std::size_t id, const std::string &s) {
+    return set(id, {Field::Kind::STRING, s});
+  }
+
+  Fb_table &table(std::size_t id, const Fb_table &t) {
+    return set(id, {Field::Kind::TABLE, {}, 0, {t}});
+  }
+
+  Fb_table &tables(std::size_t id, const std::vector<Fb_table> &t) {
+    return set(id, {Field::Kind::TABLES, {}, 0, t});
+  }
+
+  Fb_table &structs(std::size_t id, const std::string &bytes,
+                    std::size_t count) {
+    return set(id, {Field::Kind::STRUCTS, bytes, count});
+  }
+
+  std::vector<std::optional<Field>> fields;
+
+ private:
+  Fb_table &set(std::size_t id, Field field) {
+    if (fields.size() <= id) {
+      fields.resize(id + 1);
+    }
+
+    fields[id] = std::move(field);
+    return *this;
+  }
+};
+
+/**
+ * Writes the table after its vtable, children are written after their parents,
+ * returns position of the table.
+ */
+std::size_t write_table(const Fb_table &t, std::string *out) {
+  using Kind = Fb_table::Field::Kind;
+
+  const auto vtable = out->size();
+  std::vector<std::size_t> offsets;
+  std::size_t table_size = 4;
+
+  for (const auto &f : t.fields) {
+    if (f.has_value()) {
+      offsets.emplace_back(table_size);
+      table_size += Kind::SCALAR == f->kind ? f->bytes.size() : 4;
+    } else {
+      offsets.emplace_back(0);
+    }
+  }
+
+  *out += le(4 + 2 * offsets.size(), 2);
+  *out += le(table_size, 2);
+
+  for (const auto o : offsets) {
+    *out += le(o, 2);
+  }
+
+  const auto position = out->size();
+  *out += le(position - vtable, 4);
+
+  for (const auto &f : t.fields) {
+    if (f.has_value()) {
+      *out += Kind::SCALAR == f->kind ? f->bytes : le(0, 4);
+    }
+  }
+
+  for (std::size_t i = 0; i < t.fields.size(); ++i) {
+    const auto &f = t.fields[i];
+
+    if (!f.has_value() || Kind::SCALAR == f->kind) {
+      continue;
+    }
+
+    const auto field = position + offsets[i];
+    const auto child = out->size();
+
+    switch (f->kind) {
+      case Kind::SCALAR:
+        break;
+
+      case Kind::STRING:
+        *out += le(f->bytes.size(), 4) + f->bytes + '\0';
+        break;
+
+      case Kind::STRUCTS:
+        *out += le(f->count, 4) + f->bytes;
+        break;
+
+      case Kind::TABLE:
+        patch_le(write_table(f->tables[0], out) - field, 4, field, out);
+        continue;
+
+      case Kind::TABLES: {
+        *out += le(f->tables.size(), 4);
+        const auto slots = out->size();
+        out->append(4 * f->tables.size(), '\0');
+
+        for (std::size_t e = 0; e < f->tables.size(); ++e) {
+          const auto slot = slots + 4 * e;
+          patch_le(write_table(f->tables[e], out) - slot, 4, slot, out);
+        }
+
+        break;
+      }
+    }
+
+    patch_le(child - field, 4, field, out);
+  }
+
+  return position;
+}
+
+std::string flatbuffer(const Fb_table &root) {
+  std::string result = le(0, 4);
+  patch_le(write_table(root, &result), 4, 0, &result);
+  return result;
+}
+
+// Type union
+constexpr uint64_t k_int = 2;
+constexpr uint64_t k_utf8 = 5;
+
+// MessageHeader union
+constexpr uint64_t k_dictionary_batch = 2;
+constexpr uint64_t k_record_batch = 3;
+
+Fb_table field(const std::string &name, uint64_t type, const Fb_table &t) {
+  // nullable field
+  return Fb_table{}
+      .string(0, name)
+      .scalar(1, 1, 1)
+      .scalar(2, type, 1)
+      .table(3, t);
+}
+
+Fb_table int_type(uint64_t bits) {
+  return Fb_table{}.scalar(0, bits, 4).scalar(1, 1, 1);
+}
+
+struct Buffer {
+  std::string data;
+  // if set, buffer is written with this length instead of its actual one
+  std::optional<uint64_t> length;
+};
+
+struct Batch {
+  uint64_t length = 0;
+  // lengths of the columns
+  std::vector<uint64_t> nodes;
+  std::vector<Buffer> buffers;
+  bool compressed = false;
+};
+
+/**
+ * Writes an encapsulated message with a record batch, returns the Block struct.
+ */
+std::string write_batch(const Batch &batch, std::optional<int64_t> dictionary,
+                        std::string *out) {
+  std::string nodes;
+
+  for (const auto n : batch.nodes) {
+    nodes += le(n, 8) + le(0, 8);
+  }
+
+  std::string buffers;
+  std::string body;
+
+  for (const auto &b : batch.buffers) {
+    auto data = b.data;
+
+    if (batch.compressed && !data.empty()) {
+      std::string compressed;
+      mysqlshdk::storage::compress(mysqlshdk::storage::Compression::ZSTD,
+                                   data.data(), data.size(), &compressed);
+      data = le(data.size(), 8) + compressed;
+    }
+
+    buffers += le(body.size(), 8) + le(b.length.value_or(data.size()), 8);
+    body += data;
+    body.append((8 - body.size() % 8) % 8, '\0');
+  }
+
+  auto record_batch = Fb_table{}
+                          .scalar(0, batch.length, 8)
+                          .structs(1, nodes, batch.nodes.size())
+                          .structs(2, buffers, batch.buffers.size());
+
+  if (batch.compressed) {
+    // ZSTD
+    record_batch.table(3, Fb_table{}.scalar(0, 1, 1));
+  }
+
+  auto message = Fb_table{}.scalar(0, 4, 2);
+
+  if (dictionary.has_value()) {
+    message.scalar(1, k_dictionary_batch, 1)
+        .table(2, Fb_table{}.scalar(0, *dictionary, 8).table(1, record_batch));
+  } else {
+    message.scalar(1, k_record_batch, 1).table(2, record_batch);
+  }
+
+  message.scalar(3, body.size(), 8);
+
+  auto metadata = flatbuffer(message);
+  metadata.append((8 - metadata.size() % 8) % 8, '\0');
+
+  const auto offset = out->size();
+  *out += le(0xFFFFFFFF, 4) + le(metadata.size(), 4) + metadata;
+  const auto metadata_length = out->size() - offset;
+  *out += body;
+
+  return le(offset, 8) + le(metadata_length, 4) + le(0, 4) +
+         le(body.size(), 8);
+}
+
+std::string bitmap(const std::vector<bool> &bits) {
+  std::string result((bits.size() + 7) / 8, '\0');
+
+  for (std::size_t i = 0; i < bits.size(); ++i) {
+    if (bits[i]) {
+      result[i / 8] |= 1 << (i % 8);
+    }
+  }
+
+  return result;
+}
+
+std::string offsets(const std::vector<std::string> &values) {
+  std::string result = le(0, 4);
+  uint64_t offset = 0;
+
+  for (const auto &v : values) {
+    offset += v.size();
+    result += le(offset, 4);
+  }
+
+  return result;
+}
+
+std::string concat(const std::vector<std::string> &values) {
+  std::string result;
+
+  for (const auto &v : values) {
+    result += v;
+  }
+
+  return result;
+}
+
+/**
+ * Writes a file with three columns: nullable int64 "id", utf8 "name" and
+ * dictionary-encoded utf8 "tag", using the given record batches.
+ */
+std::string arrow_file(const std::vector<Batch> &batches,
+                       bool compressed = false) {
+  std::string file = "ARROW1";
+  file.append(2, '\0');
+
+  const std::vector<std::string> dictionary = {"red", "green"};
+  const auto dictionaries = write_batch(
+      {2,
+       {2},
+       {{""}, {offsets(dictionary)}, {concat(dictionary)}},
+       compressed},
+      7, &file);
+
+  std::string blocks;
+
+  for (const auto &b : batches) {
+    blocks += write_batch(b, {}, &file);
+  }
+
+  auto tag = field("tag", k_utf8, Fb_table{});
+  tag.table(4, Fb_table{}.scalar(0, 7, 8).table(1, int_type(8)));
+
+  const auto schema =
+      Fb_table{}.scalar(0, 0, 2).tables(1, {field("id", k_int, int_type(64)),
+                                            field("name", k_utf8, Fb_table{}),
+                                            tag});
+  const auto footer = flatbuffer(Fb_table{}
+                                     .scalar(0, 4, 2)
+                                     .table(1, schema)
+                                     .structs(2, dictionaries, 1)
+                                     .structs(3, blocks, batches.size()));
+
+  return file + footer + le(footer.size(), 4) + "ARROW1";
+}
+
+Batch test_batch(uint64_t first, uint64_t rows, bool compressed = false) {
+  std::vector<bool> valid;
+  std::string ids;
+  std::vector<std::string> names;
+  std::string tags;
+
+  for (uint64_t i = first; i < first + rows; ++i) {
+    valid.emplace_back(0 != i % 3);
+    ids += le(i * 1000, 8);
+    names.emplace_back(i % 2 ? "a\tb" : std::string(i % 5, 'x'));
+    tags += le(i % 2, 1);
+  }
+
+  return {rows,
+          {rows, rows, rows},
+          {{bitmap(valid)},
+           {ids},
+           {""},
+           {offsets(names)},
+           {concat(names)},
+           {""},
+           {tags}},
+          compressed};
+}
+
+Rows test_rows(uint64_t first, uint64_t rows) {
+  Rows result;
+
+  for (uint64_t i = first; i < first + rows; ++i) {
+    result.push_back({0 != i % 3 ? std::to_string(i * 1000) : "\\N",
+                      i % 2 ? "a\\tb" : std::string(i % 5, 'x'),
+                      i % 2 ? "green" : "red"});
+  }
+
+  return result;
+}
+
+Rows read_rows(const std::string &contents) {
+  Memory_file file{"test.arrow"};
+  file.set_content(contents);
+  file.open(Mode::READ);
+
+  Arrow_ipc_reader reader{&file};
+  Rows rows;
+
+  for (std::size_t i = 0; i < reader.chunk_bytes().size(); ++i) {
+    auto chunk = reader.read_chunk(i);
+
+    for (uint64_t r = 0; r < chunk.rows; ++r) {
+      auto &row = rows.emplace_back();
+
+      for (const auto &column : chunk.columns) {
+        column->next(&row.emplace_back());
+      }
+    }
+  }
+
+  return rows;
+}
+
+/**
+ * Reads the file, returns the error message, or an empty string if file was
+ * read.
+ */
+std::string read_error(const std::string &contents) {
+  try {
+    read_rows(contents);
+    return {};
+  } catch (const std::runtime_error &e) {
+    return e.what();
+  }
+}
+
+bool try_read(const std::string &contents) {
+  return read_error(contents).empty();
+}
+
+}  // namespace
+
+TEST(Arrow_ipc_reader_test, read) {
+  for (const auto compressed : {false, true}) {
+    SCOPED_TRACE(compressed);
+
+    auto expected = test_rows(0, 10);
+    const auto second = test_rows(10, 17);
+    expected.insert(expected.end(), second.begin(), second.end());
+
+    EXPECT_EQ(expected,
+              read_rows(arrow_file({test_batch(0, 10, compressed),
+                                    test_batch(10, 17, compressed)},
+                                   compressed)));
+  }
+}
+
+TEST(Arrow_ipc_reader_test, corrupted_file) {
+  const auto valid = arrow_file({test_batch(0, 10), test_batch(10, 17)});
+  ASSERT_TRUE(try_read(valid));
+
+  EXPECT_FALSE(try_read(""));
+  EXPECT_FALSE(try_read("ARROW1"));
+
+  // every truncated file fails
+  for (std::size_t length = 0; length < valid.size(); ++length) {
+    SCOPED_TRACE(length);
+    EXPECT_FALSE(try_read(valid.substr(0, length)));
+  }
+
+  // every modified byte either fails to read or is read, but never results in
+  // a read outside of the buffers
+  for (std::size_t i = 0; i < valid.size(); ++i) {
+    for (const auto mask : {0x01, 0x80, 0xFF}) {
+      auto file = valid;
+      file[i] ^= mask;
+      try_read(file);
+    }
+  }
+}
+
+TEST(Arrow_ipc_reader_test, corrupted_record_batch) {
+  const auto read_batch = [](const Batch &batch) {
+    return try_read(arrow_file({batch}));
+  };
+
+  ASSERT_TRUE(read_batch(test_batch(0, 10)));
+
+  // lengths which overflow when multiplied by the size of a value
+  for (const auto length :
+       {uint64_t{11}, uint64_t{1} << 61, uint64_t{1} << 62, UINT64_MAX}) {
+    SCOPED_TRACE(length);
+
+    auto batch = test_batch(0, 10);
+    batch.length = length;
+    // no validity bitmap, sizes of values are checked
+    batch.buffers[0].data.clear();
+    // dictionary indices are one byte wide, their size cannot overflow
+    batch.nodes[0] = batch.nodes[1] = length;
+
+    // buffers are shorter than the length, values past them are never read
+    EXPECT_THAT(read_error(arrow_file({batch})),
+                HasSubstr("corrupted record batch: buffer is too short"));
+  }
+
+  {
+    // validity bitmap is too short
+    auto batch = test_batch(0, 10);
+    batch.buffers[0].data.resize(1);
+    EXPECT_FALSE(read_batch(batch));
+  }
+
+  {
+    // offsets are too short
+    auto batch = test_batch(0, 10);
+    batch.buffers[3].data.resize(40);
+    EXPECT_FALSE(read_batch(batch));
+  }
+
+  {
+    // offset points outside of the data
+    auto batch = test_batch(0, 10);
+    patch_le(1000, 4, 20, &batch.buffers[3].data);
+    EXPECT_FALSE(read_batch(batch));
+  }
+
+  {
+    // buffer outside of the body
+    auto batch = test_batch(0, 10);
+    batch.buffers[1].length = 1000;
+    EXPECT_FALSE(read_batch(batch));
+  }
+
+  {
+    // dictionary index out of range
+    auto batch = test_batch(0, 10);
+    batch.buffers[6].data[3] = '\x02';
+    EXPECT_FALSE(read_batch(batch));
+  }
+
+  {
+    // missing buffers
+    auto batch = test_batch(0, 10);
+    batch.buffers.pop_back();
+    EXPECT_FALSE(read_batch(batch));
+  }
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
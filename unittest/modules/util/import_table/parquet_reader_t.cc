@@ -0,0 +1,961 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <lz4.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/common/parquet/encoding.h"
+#include "modules/util/common/parquet/format.h"
+#include "modules/util/common/parquet/thrift_compact.h"
+#include "modules/util/common/parquet/utils.h"
+#include "modules/util/dump/parquet_dump_writer.h"
+#include "modules/util/import_table/parquet_reader.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+using parquet::Thrift_compact_writer;
+
+namespace {
+
+using Rows = std::vector<std::vector<std::string>>;
+
+struct Page {
+  int32_t type = parquet::DATA_PAGE;
+  int32_t encoding = parquet::PLAIN;
+  int32_t num_values = 0;
+  // uncompressed contents of the page, for v2 pages: values only
+  std::string data;
+  // v2 pages: definition levels, these are never compressed
+  std::string levels;
+};
+
+struct Test_column {
+  std::string name;
+  int32_t type = parquet::INT64;
+  bool optional = false;
+  int32_t converted_type = parquet::NONE;
+  int32_t scale = 0;
+  int32_t precision = 0;
+  int32_t type_length = 0;
+  std::vector<Page> pages;
+};
+
+std::string snappy_compress(const std::string &data) {
+  // literals only
+  std::string result;
+  parquet::write_uleb128(data.length(), &result);
+
+  for (std::size_t offset = 0; offset < data.length(); offset += 60) {
+    const auto length = std::min<std::size_t>(60, data.length() - offset);
+    result.push_back(static_cast<char>((length - 1) << 2));
+    result.append(data, offset, length);
+  }
+
+  return result;
+}
+
+std::string lz4_compress(const std::string &data) {
+  std::string result;
+  result.resize(LZ4_compressBound(static_cast<int>(data.length())));
+
+  const auto length =
+      LZ4_compress_default(data.data(), &result[0],
+                           static_cast<int>(data.length()),
+                           static_cast<int>(result.length()));
+  result.resize(length);
+
+  return result;
+}
+
+std::string compress(int32_t codec, const std::string &data) {
+  std::string result;
+
+  switch (codec) {
+    case parquet::UNCOMPRESSED:
+      return data;
+
+    case parquet::SNAPPY:
+      return snappy_compress(data);
+
+    case parquet::GZIP:
+      mysqlshdk::storage::compress(mysqlshdk::storage::Compression::GZIP,
+                                   data.data(), data.length(), &result);
+      return result;
+
+    case parquet::LZ4: {
+      // Hadoop framing, big-endian sizes
+      const auto block = lz4_compress(data);
+
+      for (const auto size : {data.length(), block.length()}) {
+        for (int i = 3; i >= 0; --i) {
+          result.push_back(static_cast<char>((size >> (8 * i)) & 0xFF));
+        }
+      }
+
+      return result + block;
+    }
+
+    case parquet::ZSTD:
+      mysqlshdk::storage::compress(mysqlshdk::storage::Compression::ZSTD,
+                                   data.data(), data.length(), &result);
+      return result;
+
+    case parquet::LZ4_RAW:
+      return lz4_compress(data);
+  }
+
+  throw std::logic_error("unknown codec");
+}
+
+/**
+ * Writes a Parquet file with a single row group.
+ */
+std::string parquet_file(const std::vector<Test_column> &columns, int64_t rows,
+                         int32_t codec = parquet::UNCOMPRESSED) {
+  std::string file{parquet::k_magic, parquet::k_magic_length};
+  std::vector<std::pair<uint64_t, uint64_t>> chunks;
+
+  for (const auto &column : columns) {
+    const auto offset = file.length();
+
+    for (const auto &page : column.pages) {
+      const auto is_v2 = parquet::DATA_PAGE_V2 == page.type;
+      const auto compressed = page.levels + compress(codec, page.data);
+      std::string header;
+      Thrift_compact_writer t{&header};
+
+      t.begin_struct();
+      t.field_i32(1, page.type);
+      t.field_i32(2,
+                  static_cast<int32_t>(page.levels.length() +
+                                       page.data.length()));
+      t.field_i32(3, static_cast<int32_t>(compressed.length()));
+
+      if (parquet::DICTIONARY_PAGE == page.type) {
+        t.field_struct(7);
+        t.field_i32(1, page.num_values);
+        t.field_i32(2, page.encoding);
+        t.end_struct();
+      } else if (is_v2) {
+        t.field_struct(8);
+        t.field_i32(1, page.num_values);
+        t.field_i32(2, 0);
+        t.field_i32(3, page.num_values);
+        t.field_i32(4, page.encoding);
+        t.field_i32(5, static_cast<int32_t>(page.levels.length()));
+        t.field_i32(6, 0);
+        t.end_struct();
+      } else {
+        t.field_struct(5);
+        t.field_i32(1, page.num_values);
+        t.field_i32(2, page.encoding);
+        t.field_i32(3, parquet::RLE);
+        t.field_i32(4, parquet::RLE);
+        t.end_struct();
+      }
+
+      t.end_struct();
+
+      file += header;
+      file += compressed;
+    }
+
+    chunks.emplace_back(offset, file.length() - offset);
+  }
+
+  std::string metadata;
+  Thrift_compact_writer t{&metadata};
+
+  t.begin_struct();
+  t.field_i32(1, 1);
+
+  t.field_list(2, parquet::thrift::k_struct, columns.size() + 1);
+  t.begin_struct();
+  t.field_binary(4, "schema");
+  t.field_i32(5, static_cast<int32_t>(columns.size()));
+  t.end_struct();
+
+  for (const auto &column : columns) {
+    t.begin_struct();
+    t.field_i32(1, column.type);
+
+    if (column.type_length) {
+      t.field_i32(2, column.type_length);
+    }
+
+    t.field_i32(3, column.optional ? parquet::OPTIONAL : parquet::REQUIRED);
+    t.field_binary(4, column.name);
+
+    if (parquet::NONE != column.converted_type) {
+      t.field_i32(6, column.converted_type);
+    }
+
+    if (parquet::DECIMAL == column.converted_type) {
+      t.field_i32(7, column.scale);
+      t.field_i32(8, column.precision);
+    }
+
+    t.end_struct();
+  }
+
+  t.field_i64(3, rows);
+
+  t.field_list(4, parquet::thrift::k_struct, 1);
+  t.begin_struct();
+  t.field_list(1, parquet::thrift::k_struct, columns.size());
+
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    t.begin_struct();
+    t.field_i64(2, chunks[i].first);
+    t.field_struct(3);
+    t.field_i32(1, columns[i].type);
+    t.field_list(2, parquet::thrift::k_i32, 1);
+    t.element_i32(parquet::PLAIN);
+    t.field_list(3, parquet::thrift::k_binary, 1);
+    t.element_binary(columns[i].name);
+    t.field_i32(4, codec);
+    t.field_i64(5, rows);
+    t.field_i64(6, chunks[i].second);
+    t.field_i64(7, chunks[i].second);
+    t.field_i64(9, chunks[i].first);
+    t.end_struct();
+    t.end_struct();
+  }
+
+  t.field_i64(2, static_cast<int64_t>(file.length()));
+  t.field_i64(3, rows);
+  t.end_struct();
+
+  t.end_struct();
+
+  file += metadata;
+  parquet::write_le(metadata.length(), 4, &file);
+  file.append(parquet::k_magic, parquet::k_magic_length);
+
+  return file;
+}
+
+std::string plain_integers(const std::vector<int64_t> &values,
+                           int bytes = 8) {
+  std::string result;
+
+  for (const auto v : values) {
+    parquet::write_le(static_cast<uint64_t>(v), bytes, &result);
+  }
+
+  return result;
+}
+
+std::string plain_strings(const std::vector<std::string> &values) {
+  std::string result;
+
+  for (const auto &v : values) {
+    parquet::write_le(v.length(), 4, &result);
+    result += v;
+  }
+
+  return result;
+}
+
+std::string plain_doubles(const std::vector<double> &values) {
+  std::string result;
+
+  for (const auto v : values) {
+    uint64_t bits;
+    ::memcpy(&bits, &v, sizeof(bits));
+    parquet::write_le(bits, 8, &result);
+  }
+
+  return result;
+}
+
+/**
+ * Definition levels of a v1 data page, prefixed with their length.
+ */
+std::string definition_levels(const std::vector<uint32_t> &levels) {
+  std::string encoded;
+  parquet::encode_hybrid(levels.data(), levels.size(), 1, &encoded);
+
+  std::string result;
+  parquet::write_le(encoded.length(), 4, &result);
+
+  return result + encoded;
+}
+
+std::string dictionary_indices(const std::vector<uint32_t> &indices,
+                               int width) {
+  std::string result(1, static_cast<char>(width));
+  parquet::encode_hybrid(indices.data(), indices.size(), width, &result);
+  return result;
+}
+
+/**
+ * Encodes values using DELTA_BINARY_PACKED, blocks of 128 values, 4 miniblocks
+ * each.
+ */
+std::string delta_binary_packed(const std::vector<int64_t> &values) {
+  constexpr std::size_t k_block = 128;
+  constexpr std::size_t k_miniblock = 32;
+
+  std::string result;
+  parquet::write_uleb128(k_block, &result);
+  parquet::write_uleb128(k_block / k_miniblock, &result);
+  parquet::write_uleb128(values.size(), &result);
+  parquet::write_uleb128(parquet::zigzag(values.empty() ? 0 : values[0]),
+                         &result);
+
+  std::vector<uint64_t> deltas;
+
+  for (std::size_t i = 1; i < values.size(); ++i) {
+    deltas.emplace_back(static_cast<uint64_t>(values[i]) -
+                        static_cast<uint64_t>(values[i - 1]));
+  }
+
+  for (std::size_t block = 0; block < deltas.size(); block += k_block) {
+    const auto end = std::min(block + k_block, deltas.size());
+    const auto min_delta = *std::min_element(
+        deltas.begin() + block, deltas.begin() + end,
+        [](uint64_t a, uint64_t b) {
+          return static_cast<int64_t>(a) < static_cast<int64_t>(b);
+        });
+
+    parquet::write_uleb128(parquet::zigzag(static_cast<int64_t>(min_delta)),
+                           &result);
+
+    std::string widths;
+    std::string packed;
+
+    for (std::size_t mini = block; mini < block + k_block;
+         mini += k_miniblock) {
+      int width = 0;
+
+      for (std::size_t i = mini; i < std::min(mini + k_miniblock, end); ++i) {
+        const auto relative = deltas[i] - min_delta;
+
+        while (width < 64 && (relative >> width)) {
+          ++width;
+        }
+      }
+
+      widths.push_back(static_cast<char>(width));
+
+      if (mini >= end) {
+        continue;
+      }
+
+      // LSB first, padded to the full miniblock
+      std::vector<bool> bits;
+
+      for (std::size_t i = mini; i < mini + k_miniblock; ++i) {
+        const auto relative = i < end ? deltas[i] - min_delta : 0;
+
+        for (int b = 0; b < width; ++b) {
+          bits.push_back((relative >> b) & 1);
+        }
+      }
+
+      for (std::size_t i = 0; i < bits.size(); i += 8) {
+        uint8_t byte = 0;
+
+        for (std::size_t b = 0; b < 8; ++b) {
+          byte |= bits[i + b] << b;
+        }
+
+        packed.push_back(static_cast<char>(byte));
+      }
+    }
+
+    result += widths;
+    result += packed;
+  }
+
+  return result;
+}
+
+Rows read_rows(const std::string &contents) {
+  Memory_file file{"test.parquet"};
+  file.set_content(contents);
+  file.open(Mode::READ);
+
+  Parquet_reader reader{&file};
+  Rows rows;
+
+  for (std::size_t i = 0; i < reader.chunk_bytes().size(); ++i) {
+    auto chunk = reader.read_chunk(i);
+
+    for (uint64_t r = 0; r < chunk.rows; ++r) {
+      auto &row = rows.emplace_back();
+
+      for (const auto &column : chunk.columns) {
+        column->next(&row.emplace_back());
+      }
+    }
+  }
+
+  return rows;
+}
+
+/**
+ * Reads the file, returns true if it was read, false if an exception was
+ * thrown.
+ */
+bool try_read(const std::string &contents) {
+  try {
+    read_rows(contents);
+    return true;
+  } catch (const std::runtime_error &) {
+    return false;
+  }
+}
+
+Rows single_column(const std::vector<std::string> &values) {
+  Rows rows;
+
+  for (const auto &v : values) {
+    rows.push_back({v});
+  }
+
+  return rows;
+}
+
+/**
+ * A file with two columns: required INT64 values and optional strings stored
+ * using a dictionary, 300 rows in two data pages.
+ */
+std::vector<Test_column> test_columns(Rows *expected) {
+  Test_column numbers{"id"};
+  Test_column strings{"name", parquet::BYTE_ARRAY, true, parquet::UTF8};
+
+  const std::vector<std::string> dictionary = {"one", "two", "three"};
+  strings.pages.push_back({parquet::DICTIONARY_PAGE, parquet::PLAIN, 3,
+                           plain_strings(dictionary)});
+
+  for (int page = 0; page < 2; ++page) {
+    std::vector<int64_t> ids;
+    std::vector<uint32_t> levels;
+    std::vector<uint32_t> indices;
+
+    for (int i = 0; i < 150; ++i) {
+      const auto id = page * 150 + i;
+      auto &row = expected->emplace_back();
+
+      ids.emplace_back(id);
+      row.emplace_back(std::to_string(id));
+
+      // NULLs and runs of repeated values
+      if (0 == id % 7) {
+        levels.emplace_back(0);
+        row.emplace_back("\\N");
+      } else {
+        const auto index = id < 200 ? (id / 3) % 3 : 2;
+        levels.emplace_back(1);
+        indices.emplace_back(index);
+        row.emplace_back(dictionary[index]);
+      }
+    }
+
+    numbers.pages.push_back({parquet::DATA_PAGE, parquet::PLAIN, 150,
+                             plain_integers(ids)});
+    strings.pages.push_back({parquet::DATA_PAGE, parquet::RLE_DICTIONARY, 150,
+                             definition_levels(levels) +
+                                 dictionary_indices(indices, 2)});
+  }
+
+  return {numbers, strings};
+}
+
+}  // namespace
+
+TEST(Parquet_reader_test, codecs) {
+  for (const auto codec :
+       {parquet::UNCOMPRESSED, parquet::SNAPPY, parquet::GZIP, parquet::LZ4,
+        parquet::ZSTD, parquet::LZ4_RAW}) {
+    SCOPED_TRACE(codec);
+
+    Rows expected;
+    const auto file = parquet_file(test_columns(&expected), 300, codec);
+
+    EXPECT_EQ(expected, read_rows(file));
+  }
+}
+
+TEST(Parquet_reader_test, plain_encoding) {
+  const std::vector<std::string> strings = {"a\tb", "", "c\\d", {"\0", 1}};
+
+  Test_column booleans{"b", parquet::BOOLEAN};
+  // 1, 0, 0, 1
+  booleans.pages.push_back(
+      {parquet::DATA_PAGE, parquet::PLAIN, 4, std::string(1, '\x09')});
+
+  Test_column int32{"i32", parquet::INT32};
+  int32.pages.push_back({parquet::DATA_PAGE, parquet::PLAIN, 4,
+                         plain_integers({-1, 0, 1, 2147483647}, 4)});
+
+  Test_column uint32{"u32", parquet::INT32, false, parquet::UINT_32};
+  uint32.pages.push_back({parquet::DATA_PAGE, parquet::PLAIN, 4,
+                          plain_integers({-1, 0, 1, 2}, 4)});
+
+  Test_column int64{"i64", parquet::INT64};
+  int64.pages.push_back({parquet::DATA_PAGE, parquet::PLAIN, 4,
+                         plain_integers({INT64_MIN, -1, 0, INT64_MAX})});
+
+  Test_column doubles{"d", parquet::DOUBLE};
+  doubles.pages.push_back({parquet::DATA_PAGE, parquet::PLAIN, 4,
+                           plain_doubles({1.5, -0.25, 0.0, 8.0})});
+
+  Test_column bytes{"s", parquet::BYTE_ARRAY};
+  bytes.pages.push_back(
+      {parquet::DATA_PAGE, parquet::PLAIN, 4, plain_strings(strings)});
+
+  Test_column fixed{"f", parquet::FIXED_LEN_BYTE_ARRAY};
+  fixed.type_length = 2;
+  fixed.pages.push_back({parquet::DATA_PAGE, parquet::PLAIN, 4, "abcdefgh"});
+
+  Test_column decimal{"dec", parquet::BYTE_ARRAY, true, parquet::DECIMAL, 2, 5};
+  decimal.pages.push_back(
+      {parquet::DATA_PAGE, parquet::PLAIN, 4,
+       definition_levels({1, 1, 0, 1}) +
+           plain_strings({"\x30\x39", "\xCF\xC7", std::string(1, '\0')})});
+
+  const Rows expected = {
+      {"1", "-1", "4294967295", "-9223372036854775808", "1.5", "a\\tb", "ab",
+       "123.45"},
+      {"0", "0", "0", "-1", "-0.25", "", "cd", "-123.45"},
+      {"0", "1", "1", "0", "0", "c\\\\d", "ef", "\\N"},
+      {"1", "2147483647", "2", "9223372036854775807", "8", "\\0", "gh",
+       "0.00"},
+  };
+
+  EXPECT_EQ(expected,
+            read_rows(parquet_file({booleans, int32, uint32, int64, doubles,
+                                    bytes, fixed, decimal},
+                                   4)));
+}
+
+TEST(Parquet_reader_test, dictionary_encoding) {
+  const std::vector<std::string> dictionary = {"x", "y", "z"};
+
+  for (const auto encoding :
+       {parquet::PLAIN_DICTIONARY, parquet::RLE_DICTIONARY}) {
+    SCOPED_TRACE(encoding);
+
+    Test_column column{"c", parquet::BYTE_ARRAY};
+    column.pages.push_back({parquet::DICTIONARY_PAGE,
+                            parquet::PLAIN_DICTIONARY, 3,
+                            plain_strings(dictionary)});
+
+    std::vector<uint32_t> indices;
+    std::vector<std::string> expected;
+
+    // bit-packed values, followed by a run
+    for (uint32_t i = 0; i < 20; ++i) {
+      indices.emplace_back(i % 3);
+    }
+
+    indices.insert(indices.end(), 30, 1);
+
+    for (const auto i : indices) {
+      expected.emplace_back(dictionary[i]);
+    }
+
+    column.pages.push_back({parquet::DATA_PAGE, encoding, 50,
+                            dictionary_indices(indices, 2)});
+    // dictionary is shared by all pages of a column chunk
+    column.pages.push_back({parquet::DATA_PAGE, encoding, 50,
+                            dictionary_indices(indices, 5)});
+    const auto first_page = expected;
+    expected.insert(expected.end(), first_page.begin(), first_page.end());
+
+    EXPECT_EQ(single_column(expected), read_rows(parquet_file({column}, 100)));
+  }
+
+  {
+    // all values are NULL, bit width is not written
+    Test_column column{"c", parquet::BYTE_ARRAY, true};
+    column.pages.push_back({parquet::DICTIONARY_PAGE,
+                            parquet::PLAIN_DICTIONARY, 0, ""});
+    column.pages.push_back({parquet::DATA_PAGE, parquet::RLE_DICTIONARY, 3,
+                            definition_levels({0, 0, 0})});
+
+    EXPECT_EQ(single_column({"\\N", "\\N", "\\N"}),
+              read_rows(parquet_file({column}, 3)));
+  }
+}
+
+TEST(Parquet_reader_test, delta_encoding) {
+  std::vector<int64_t> values = {7,         5,         3, 1, 2, 3, 4, 5,
+                                 INT64_MIN, INT64_MAX, 0};
+
+  for (int64_t i = 0; i < 300; ++i) {
+    values.emplace_back(i * i * (i % 2 ? -1 : 1));
+  }
+
+  std::vector<std::string> expected;
+
+  for (const auto v : values) {
+    expected.emplace_back(std::to_string(v));
+  }
+
+  const auto count = static_cast<int32_t>(values.size());
+
+  {
+    Test_column column{"c", parquet::INT64};
+    column.pages.push_back({parquet::DATA_PAGE, parquet::DELTA_BINARY_PACKED,
+                            count, delta_binary_packed(values)});
+
+    EXPECT_EQ(single_column(expected),
+              read_rows(parquet_file({column}, count)));
+  }
+
+  {
+    // DELTA_LENGTH_BYTE_ARRAY: lengths, followed by concatenated values
+    std::vector<int64_t> lengths;
+    std::string data;
+
+    for (const auto &v : expected) {
+      lengths.emplace_back(v.length());
+      data += v;
+    }
+
+    Test_column column{"c", parquet::BYTE_ARRAY};
+    column.pages.push_back({parquet::DATA_PAGE,
+                            parquet::DELTA_LENGTH_BYTE_ARRAY, count,
+                            delta_binary_packed(lengths) + data});
+
+    EXPECT_EQ(single_column(expected),
+              read_rows(parquet_file({column}, count)));
+  }
+
+  {
+    // DELTA_BYTE_ARRAY: prefix lengths, followed by DELTA_LENGTH_BYTE_ARRAY
+    // encoded suffixes
+    const std::vector<std::string> strings = {"apple", "applesauce", "apricot",
+                                              "banana"};
+    Test_column column{"c", parquet::BYTE_ARRAY};
+    column.pages.push_back(
+        {parquet::DATA_PAGE, parquet::DELTA_BYTE_ARRAY, 4,
+         delta_binary_packed({0, 5, 2, 0}) + delta_binary_packed({5, 5, 5, 6}) +
+             "applesaucericotbanana"});
+
+    EXPECT_EQ(single_column(strings), read_rows(parquet_file({column}, 4)));
+  }
+}
+
+TEST(Parquet_reader_test, data_page_v2) {
+  std::string levels;
+  const std::vector<uint32_t> defined = {1, 0, 1, 1};
+  parquet::encode_hybrid(defined.data(), defined.size(), 1, &levels);
+
+  Test_column column{"c", parquet::INT64, true};
+  column.pages.push_back({parquet::DATA_PAGE_V2, parquet::PLAIN, 4,
+                          plain_integers({10, 20, 30}), levels});
+
+  EXPECT_EQ(single_column({"10", "\\N", "20", "30"}),
+            read_rows(parquet_file({column}, 4, parquet::ZSTD)));
+}
+
+TEST(Parquet_reader_test, corrupted_footer) {
+  Rows expected;
+  const auto valid = parquet_file(test_columns(&expected), 300);
+  ASSERT_TRUE(try_read(valid));
+
+  // file is too small
+  EXPECT_FALSE(try_read("PAR1PAR1"));
+  EXPECT_FALSE(try_read(""));
+
+  // not a Parquet file
+  {
+    auto file = valid;
+    file.back() = 'X';
+    EXPECT_FALSE(try_read(file));
+  }
+
+  // encrypted footer
+  {
+    auto file = valid;
+    file.back() = 'E';
+
+    try {
+      read_rows(file);
+      ADD_FAILURE() << "Exception not thrown";
+    } catch (const std::runtime_error &e) {
+      EXPECT_NE(
+          std::string::npos,
+          std::string{e.what()}.find("Encrypted footer is not supported"));
+    }
+  }
+
+  // footer length is larger than the file
+  {
+    auto file = valid;
+    file[file.length() - 5] = '\x7F';
+    EXPECT_FALSE(try_read(file));
+  }
+
+  // footer is truncated, length points into the middle of the metadata
+  {
+    const auto footer_length =
+        parquet::read_le(valid.data() + valid.length() - 8, 4);
+
+    for (uint64_t length = 0; length < footer_length; ++length) {
+      SCOPED_TRACE(length);
+
+      auto file = valid.substr(0, valid.length() - 8 - footer_length);
+      file += valid.substr(valid.length() - 8 - length, length);
+      parquet::write_le(length, 4, &file);
+      file += "PAR1";
+
+      EXPECT_FALSE(try_read(file));
+    }
+  }
+
+  // every truncated file fails
+  for (std::size_t length = 0; length < valid.length(); length += 7) {
+    SCOPED_TRACE(length);
+    EXPECT_FALSE(try_read(valid.substr(0, length)));
+  }
+}
+
+TEST(Parquet_reader_test, corrupted_bytes) {
+  Rows expected;
+  const auto valid =
+      parquet_file(test_columns(&expected), 300, parquet::SNAPPY);
+
+  // every modified byte either fails to read or is read, but never results in
+  // a read outside of the buffers
+  for (std::size_t i = 0; i < valid.length(); ++i) {
+    for (const auto mask : {0x01, 0x80, 0xFF}) {
+      auto file = valid;
+      file[i] ^= mask;
+      try_read(file);
+    }
+  }
+}
+
+TEST(Parquet_reader_test, corrupted_pages) {
+  const auto read_column = [](const Test_column &column, int64_t rows) {
+    return try_read(parquet_file({column}, rows));
+  };
+
+  {
+    // more rows than values
+    Test_column column{"c"};
+    column.pages.push_back(
+        {parquet::DATA_PAGE, parquet::PLAIN, 2, plain_integers({1, 2})});
+    EXPECT_TRUE(read_column(column, 2));
+    EXPECT_FALSE(read_column(column, 3));
+  }
+
+  {
+    // values are missing
+    Test_column column{"c"};
+    column.pages.push_back(
+        {parquet::DATA_PAGE, parquet::PLAIN, 3, plain_integers({1, 2})});
+    EXPECT_FALSE(read_column(column, 3));
+  }
+
+  {
+    // dictionary index out of range
+    Test_column column{"c", parquet::BYTE_ARRAY};
+    column.pages.push_back({parquet::DICTIONARY_PAGE, parquet::PLAIN, 1,
+                            plain_strings({"a"})});
+    column.pages.push_back({parquet::DATA_PAGE, parquet::RLE_DICTIONARY, 2,
+                            dictionary_indices({0, 1}, 1)});
+    EXPECT_FALSE(read_column(column, 2));
+  }
+
+  {
+    // data page which uses a dictionary, without a dictionary page
+    Test_column column{"c", parquet::BYTE_ARRAY};
+    column.pages.push_back({parquet::DATA_PAGE, parquet::RLE_DICTIONARY, 2,
+                            dictionary_indices({0, 0}, 1)});
+    EXPECT_FALSE(read_column(column, 2));
+  }
+
+  {
+    // definition levels are longer than the page
+    Test_column column{"c", parquet::INT64, true};
+    auto data = definition_levels({1, 1}) + plain_integers({1, 2});
+    data[0] = '\x7F';
+    column.pages.push_back({parquet::DATA_PAGE, parquet::PLAIN, 2, data});
+    EXPECT_FALSE(read_column(column, 2));
+  }
+
+  {
+    // bit width of dictionary indices is too large
+    Test_column column{"c", parquet::BYTE_ARRAY};
+    column.pages.push_back({parquet::DICTIONARY_PAGE, parquet::PLAIN, 1,
+                            plain_strings({"a"})});
+    column.pages.push_back({parquet::DATA_PAGE, parquet::RLE_DICTIONARY, 1,
+                            dictionary_indices({0}, 33)});
+    EXPECT_FALSE(read_column(column, 1));
+  }
+
+  {
+    // BYTE_ARRAY value longer than the page
+    Test_column column{"c", parquet::BYTE_ARRAY};
+    auto data = plain_strings({"abc"});
+    data[0] = '\x04';
+    column.pages.push_back({parquet::DATA_PAGE, parquet::PLAIN, 1, data});
+    EXPECT_FALSE(read_column(column, 1));
+  }
+
+  {
+    // unsupported encoding for the type
+    Test_column column{"c", parquet::BYTE_ARRAY};
+    column.pages.push_back({parquet::DATA_PAGE, parquet::BYTE_STREAM_SPLIT, 1,
+                            plain_strings({"a"})});
+    EXPECT_FALSE(read_column(column, 1));
+  }
+
+  {
+    // DELTA_BINARY_PACKED page with more values than the page
+    Test_column column{"c"};
+    column.pages.push_back({parquet::DATA_PAGE, parquet::DELTA_BINARY_PACKED, 2,
+                            delta_binary_packed({1, 2, 3})});
+    EXPECT_FALSE(read_column(column, 2));
+  }
+
+  {
+    // invalid length of a fixed-length type
+    Test_column column{"c", parquet::FIXED_LEN_BYTE_ARRAY};
+    column.type_length = -1;
+    column.pages.push_back({parquet::DATA_PAGE, parquet::PLAIN, 1, "a"});
+    EXPECT_FALSE(read_column(column, 1));
+  }
+
+  {
+    // page does not fit in the column chunk
+    Test_column column{"c"};
+    column.pages.push_back(
+        {parquet::DATA_PAGE, parquet::PLAIN, 1, plain_integers({1})});
+
+    auto file = parquet_file({column}, 1);
+    // compressed_page_size is the third field of the header
+    ASSERT_EQ(0x15, file[parquet::k_magic_length + 4]);
+    file[parquet::k_magic_length + 5] = '\x7E';
+    EXPECT_FALSE(try_read(file));
+  }
+}
+
+TEST(Parquet_reader_test, dump_writer_round_trip) {
+  using mysqlshdk::db::Type;
+
+  const auto column = [](const std::string &name, Type type,
+                         uint32_t length = 0, int fractional = 0,
+                         bool is_unsigned = false) {
+    return mysqlshdk::db::Column("", "", "t", "t", name, name, length,
+                                 fractional, type, 33, is_unsigned, false,
+                                 false);
+  };
+
+  const std::vector<mysqlshdk::db::Column> columns = {
+      column("i", Type::Integer),
+      column("u", Type::UInteger, 20, 0, true),
+      column("bit", Type::Bit, 16),
+      column("d", Type::Double),
+      column("dec", Type::Decimal, 12, 2),
+      column("s", Type::String),
+      column("b", Type::Bytes),
+      column("j", Type::Json),
+  };
+
+  for (const auto compression :
+       {mysqlshdk::storage::Compression::NONE,
+        mysqlshdk::storage::Compression::GZIP,
+        mysqlshdk::storage::Compression::ZSTD}) {
+    SCOPED_TRACE(mysqlshdk::storage::to_string(compression));
+
+    Memory_file output{"output.parquet"};
+    output.open(Mode::WRITE);
+
+    dump::Parquet_dump_writer writer{compression};
+    writer.set_output_file(&output);
+    writer.open();
+    writer.write_preamble(columns);
+
+    Rows expected;
+
+    for (int i = 0; i < 1000; ++i) {
+      const auto number = std::to_string(i - 500);
+      const auto unsigned_number = std::to_string(18446744073709551615ULL - i);
+      const char bit[] = {static_cast<char>(i >> 8), static_cast<char>(i)};
+      const auto decimal = std::to_string(i - 500) + "." +
+                           std::to_string(10 + i % 90);
+      // few distinct values, stored using a dictionary
+      const auto string = "value\t" + std::to_string(i % 10);
+      const auto json = "{\"a\": " + std::to_string(i) + "}";
+      const bool is_null = 0 == i % 13;
+
+      const char *data[] = {
+          number.c_str(),
+          unsigned_number.c_str(),
+          bit,
+          is_null ? nullptr : "1.5",
+          decimal.c_str(),
+          string.c_str(),
+          is_null ? nullptr : "\x00\x01",
+          json.c_str(),
+      };
+      const unsigned long lengths[] = {
+          number.length(),
+          unsigned_number.length(),
+          sizeof(bit),
+          is_null ? 0ul : 3ul,
+          decimal.length(),
+          string.length(),
+          is_null ? 0ul : 2ul,
+          json.length(),
+      };
+
+      writer.write_row(dump::Dump_writer::Raw_row{data, lengths});
+
+      expected.push_back({number, unsigned_number, std::to_string(i),
+                          is_null ? "\\N" : "1.5", decimal,
+                          "value\\t" + std::to_string(i % 10),
+                          is_null ? "\\N" : "\\0\x01", json});
+    }
+
+    writer.write_postamble();
+    writer.close();
+
+    EXPECT_EQ(expected, read_rows(output.content()));
+  }
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
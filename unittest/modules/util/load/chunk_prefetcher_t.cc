@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/load/chunk_prefetcher.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysqlsh {
+namespace tests {
+
+class Chunk_prefetcher_test : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_path = shcore::path::join_path(getenv("TMPDIR"), "chunk_prefetcher");
+    m_dir = mysqlshdk::storage::make_directory(m_path);
+
+    if (m_dir->exists()) {
+      shcore::remove_directory(m_path, true);
+    }
+
+    m_dir->create();
+  }
+
+  void TearDown() override { shcore::remove_directory(m_path, true); }
+
+  void write(const std::string &name, const std::string &contents) {
+    const auto file = m_dir->file(name);
+    file->open(mysqlshdk::storage::Mode::WRITE);
+    file->write(contents.c_str(), contents.length());
+    file->close();
+  }
+
+  static std::string read(mysqlshdk::storage::IFile *file) {
+    file->open(mysqlshdk::storage::Mode::READ);
+    auto contents = mysqlshdk::storage::read_file(file);
+    file->close();
+    return contents;
+  }
+
+  std::string m_path;
+  std::unique_ptr<mysqlshdk::storage::IDirectory> m_dir;
+};
+
+TEST_F(Chunk_prefetcher_test, prefetch) {
+  const std::string first(1024 * 1024 + 7, 'a');
+  const std::string second = "second";
+  const std::string third = "third";
+
+  write("first.tsv", first);
+  write("second.tsv", second);
+  write("third.tsv", third);
+
+  Chunk_prefetcher prefetcher{2, first.length() + second.length()};
+
+  EXPECT_TRUE(prefetcher.prefetch(m_dir->file("first.tsv"), first.length()));
+  EXPECT_TRUE(prefetcher.prefetch(m_dir->file("second.tsv"), second.length()));
+  // already scheduled
+  EXPECT_FALSE(
+      prefetcher.prefetch(m_dir->file("second.tsv"), second.length()));
+  // does not fit in the memory budget
+  EXPECT_FALSE(prefetcher.prefetch(m_dir->file("third.tsv"), third.length()));
+
+  EXPECT_TRUE(prefetcher.is_prefetched("first.tsv"));
+  EXPECT_FALSE(prefetcher.is_prefetched("third.tsv"));
+  EXPECT_EQ(nullptr, prefetcher.file("third.tsv"));
+  EXPECT_EQ(first.length() + second.length(), prefetcher.memory_used());
+
+  {
+    const auto file = prefetcher.file("first.tsv");
+    ASSERT_NE(nullptr, file);
+    EXPECT_EQ("first.tsv", file->filename());
+    EXPECT_EQ(first.length(), file->file_size());
+    EXPECT_EQ(first, read(file.get()));
+    // file can be obtained only once
+    EXPECT_FALSE(prefetcher.is_prefetched("first.tsv"));
+    EXPECT_EQ(second.length(), prefetcher.memory_used());
+  }
+
+  // memory was released, there's space for another file
+  EXPECT_TRUE(prefetcher.prefetch(m_dir->file("third.tsv"), third.length()));
+
+  {
+    const auto file = prefetcher.file("second.tsv");
+    ASSERT_NE(nullptr, file);
+    EXPECT_EQ(second, read(file.get()));
+  }
+
+  {
+    const auto file = prefetcher.file("third.tsv");
+    ASSERT_NE(nullptr, file);
+    EXPECT_EQ(third, read(file.get()));
+  }
+
+  EXPECT_EQ(0, prefetcher.memory_used());
+}
+
+TEST_F(Chunk_prefetcher_test, missing_file) {
+  // file cannot be fetched, it's read directly when handle is opened
+  Chunk_prefetcher prefetcher{1, 1024};
+
+  EXPECT_TRUE(prefetcher.prefetch(m_dir->file("missing.tsv"), 10));
+
+  const auto file = prefetcher.file("missing.tsv");
+  ASSERT_NE(nullptr, file);
+  EXPECT_THROW(file->open(mysqlshdk::storage::Mode::READ), std::exception);
+  EXPECT_EQ(0, prefetcher.memory_used());
+}
+
+}  // namespace tests
+}  // namespace mysqlsh
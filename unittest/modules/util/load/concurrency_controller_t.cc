@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/load/concurrency_controller.h"
+
+namespace mysqlsh {
+namespace tests {
+
+using Metrics = Concurrency_controller::Metrics;
+
+TEST(Concurrency_controller_test, increase_and_decrease) {
+  Concurrency_controller controller{2, 8};
+
+  EXPECT_EQ(2, controller.limit());
+
+  // no metrics, no pressure
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ("", controller.update({}));
+  }
+
+  EXPECT_EQ(8, controller.limit());
+
+  Metrics metrics;
+  metrics.history_length = 2000000;
+
+  EXPECT_EQ("history list length is 2000000", controller.update(metrics));
+  EXPECT_EQ(4, controller.limit());
+
+  EXPECT_NE("", controller.update(metrics));
+  EXPECT_EQ(2, controller.limit());
+
+  // never goes below the minimum
+  EXPECT_NE("", controller.update(metrics));
+  EXPECT_EQ(2, controller.limit());
+
+  metrics.history_length = 100;
+  EXPECT_EQ("", controller.update(metrics));
+  EXPECT_EQ(3, controller.limit());
+}
+
+TEST(Concurrency_controller_test, buffer_pool_wait_free) {
+  Concurrency_controller controller{1, 4};
+
+  Metrics metrics;
+  metrics.buffer_pool_wait_free = 10;
+
+  // first sample is only remembered
+  EXPECT_EQ("", controller.update(metrics));
+  EXPECT_EQ(2, controller.limit());
+
+  EXPECT_EQ("", controller.update(metrics));
+  EXPECT_EQ(3, controller.limit());
+
+  metrics.buffer_pool_wait_free = 11;
+  EXPECT_EQ("threads are waiting for free pages in the buffer pool",
+            controller.update(metrics));
+  EXPECT_EQ(1, controller.limit());
+
+  EXPECT_EQ("", controller.update(metrics));
+  EXPECT_EQ(2, controller.limit());
+}
+
+TEST(Concurrency_controller_test, checkpoint_age_and_replica_lag) {
+  Concurrency_controller controller{1, 4};
+
+  for (int i = 0; i < 3; ++i) {
+    controller.update({});
+  }
+
+  EXPECT_EQ(4, controller.limit());
+
+  Metrics metrics;
+  metrics.checkpoint_age = 100;
+
+  // threshold is not known
+  EXPECT_EQ("", controller.update(metrics));
+
+  metrics.max_checkpoint_age = 50;
+  EXPECT_EQ("checkpoint age is 100", controller.update(metrics));
+  EXPECT_EQ(2, controller.limit());
+
+  metrics = {};
+  metrics.replica_lag = 31;
+  EXPECT_EQ("replication lag is 31 seconds", controller.update(metrics));
+  EXPECT_EQ(1, controller.limit());
+
+  metrics.replica_lag = 30;
+  EXPECT_EQ("", controller.update(metrics));
+  EXPECT_EQ(2, controller.limit());
+}
+
+}  // namespace tests
+}  // namespace mysqlsh
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/load/ddl_batch.h"
+
+namespace mysqlsh {
+namespace tests {
+
+namespace {
+
+void throw_on_error(std::string_view error) {
+  throw std::runtime_error(std::string{error});
+}
+
+}  // namespace
+
+TEST(Ddl_batch_test, tables_to_add) {
+  // not enough tables to keep all threads busy
+  EXPECT_EQ(0, Ddl_batch::tables_to_add(0, 4));
+  EXPECT_EQ(0, Ddl_batch::tables_to_add(3, 4));
+
+  // remaining tables are split between the threads
+  EXPECT_EQ(1, Ddl_batch::tables_to_add(4, 4));
+  EXPECT_EQ(2, Ddl_batch::tables_to_add(11, 4));
+  EXPECT_EQ(10, Ddl_batch::tables_to_add(10, 1));
+
+  // batch is limited
+  EXPECT_EQ(Ddl_batch::k_max_tables - 1, Ddl_batch::tables_to_add(1000, 4));
+  EXPECT_EQ(Ddl_batch::k_max_tables - 1, Ddl_batch::tables_to_add(16, 1));
+
+  // no threads is treated as a single thread
+  EXPECT_EQ(5, Ddl_batch::tables_to_add(5, 0));
+}
+
+TEST(Ddl_batch_test, statements_are_joined) {
+  Ddl_batch batch;
+
+  EXPECT_EQ(0, batch.scripts());
+  EXPECT_EQ(0, batch.statements());
+  EXPECT_EQ("", batch.sql());
+
+  batch.add(
+      "CREATE TABLE IF NOT EXISTS `t1` (`id` int PRIMARY KEY);\n"
+      "ALTER TABLE `t1` COMMENT = 'a;b';\n",
+      {}, throw_on_error);
+  // script without any statements
+  batch.add("", {}, throw_on_error);
+  batch.add("CREATE TABLE IF NOT EXISTS `t2` (`id` int) -- trailing\n;\n", {},
+            throw_on_error);
+
+  EXPECT_EQ(3, batch.scripts());
+  EXPECT_EQ(3, batch.statements());
+  EXPECT_EQ(
+      "CREATE TABLE IF NOT EXISTS `t1` (`id` int PRIMARY KEY)\n;\n"
+      "ALTER TABLE `t1` COMMENT = 'a;b'\n;\n"
+      "CREATE TABLE IF NOT EXISTS `t2` (`id` int) -- trailing\n\n;\n",
+      batch.sql());
+}
+
+TEST(Ddl_batch_test, statements_are_transformed) {
+  Ddl_batch batch;
+  const auto transform = [](std::string_view s, std::string *out) {
+    if (0 == s.find("SET")) {
+      // statement is removed
+      out->clear();
+      return true;
+    }
+
+    if (0 == s.find("CREATE")) {
+      *out = std::string{s} + " ENGINE=InnoDB";
+      return true;
+    }
+
+    return false;
+  };
+
+  batch.add(
+      "SET @x = 1;\n"
+      "CREATE TABLE `t1` (`id` int);\n"
+      "ALTER TABLE `t1` ADD INDEX (`id`);\n",
+      transform, throw_on_error);
+
+  EXPECT_EQ(1, batch.scripts());
+  EXPECT_EQ(2, batch.statements());
+  EXPECT_EQ(
+      "CREATE TABLE `t1` (`id` int) ENGINE=InnoDB\n;\n"
+      "ALTER TABLE `t1` ADD INDEX (`id`)\n;\n",
+      batch.sql());
+}
+
+TEST(Ddl_batch_test, failed_script) {
+  Ddl_batch batch;
+
+  // statements: 0, 1 | 2 | - | 3, 4, 5
+  batch.add("CREATE TABLE a (id int);\nALTER TABLE a ENGINE=InnoDB;\n", {},
+            throw_on_error);
+  batch.add("CREATE TABLE b (id int);\n", {}, throw_on_error);
+  batch.add("", {}, throw_on_error);
+  batch.add("CREATE TABLE c (id int);\nSELECT 1;\nSELECT 2;\n", {},
+            throw_on_error);
+
+  ASSERT_EQ(6, batch.statements());
+
+  // first statement has failed
+  EXPECT_EQ(0, batch.failed_script(0));
+  // second statement of the first script has failed
+  EXPECT_EQ(0, batch.failed_script(1));
+  // first (and only) statement of the second script has failed
+  EXPECT_EQ(1, batch.failed_script(2));
+  // scripts without statements cannot fail
+  EXPECT_EQ(3, batch.failed_script(3));
+  EXPECT_EQ(3, batch.failed_script(5));
+}
+
+TEST(Ddl_batch_test, split_error) {
+  Ddl_batch batch;
+
+  EXPECT_THROW_MSG(batch.add("DELIMITER a\\b\n", {}, throw_on_error),
+                   std::runtime_error,
+                   "DELIMITER cannot contain a backslash character");
+}
+
+}  // namespace tests
+}  // namespace mysqlsh
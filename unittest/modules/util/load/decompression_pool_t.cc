@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/load/decompression_pool.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysqlsh {
+namespace tests {
+
+using mysqlshdk::storage::Compression;
+using mysqlshdk::storage::Mode;
+
+class Decompression_pool_test : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_path = shcore::path::join_path(getenv("TMPDIR"), "decompression_pool");
+    m_dir = mysqlshdk::storage::make_directory(m_path);
+
+    if (m_dir->exists()) {
+      shcore::remove_directory(m_path, true);
+    }
+
+    m_dir->create();
+  }
+
+  void TearDown() override { shcore::remove_directory(m_path, true); }
+
+  std::unique_ptr<mysqlshdk::storage::IFile> file(const std::string &name,
+                                                  Compression c) {
+    return mysqlshdk::storage::make_file(m_dir->file(name), c);
+  }
+
+  void write(const std::string &name, Compression c,
+             const std::string &contents) {
+    const auto f = file(name, c);
+    f->open(Mode::WRITE);
+    f->write(contents.c_str(), contents.length());
+    f->close();
+  }
+
+  static std::string read(mysqlshdk::storage::IFile *file) {
+    file->open(Mode::READ);
+    auto contents = mysqlshdk::storage::read_file(file);
+    file->close();
+    return contents;
+  }
+
+  static std::string contents(std::size_t size) {
+    std::string result;
+    result.reserve(size);
+
+    for (std::size_t i = 0; result.size() < size; ++i) {
+      result += std::to_string(i) + "\tvalue " + std::to_string(i * 7) + "\n";
+    }
+
+    result.resize(size);
+    return result;
+  }
+
+  std::string m_path;
+  std::unique_ptr<mysqlshdk::storage::IDirectory> m_dir;
+};
+
+TEST_F(Decompression_pool_test, read) {
+  const auto first = contents(1024 * 1024 + 7);
+  const auto second = contents(100);
+  const auto third = contents(3 * 1024 + 1);
+
+  write("first.tsv.zst", Compression::ZSTD, first);
+  write("second.tsv.gz", Compression::GZIP, second);
+  write("third.tsv", Compression::NONE, third);
+
+  // small buffers, so that ring is refilled multiple times
+  Decompression_pool pool{2, 3, 1000};
+
+  const auto f1 = pool.wrap(file("first.tsv.zst", Compression::ZSTD));
+  const auto f2 = pool.wrap(file("second.tsv.gz", Compression::GZIP));
+  const auto f3 = pool.wrap(file("third.tsv", Compression::NONE));
+
+  EXPECT_EQ("first.tsv.zst", f1->filename());
+
+  EXPECT_EQ(first, read(f1.get()));
+  EXPECT_EQ(second, read(f2.get()));
+  EXPECT_EQ(third, read(f3.get()));
+
+  // file can be read again
+  EXPECT_EQ(second, read(f2.get()));
+}
+
+TEST_F(Decompression_pool_test, close_before_eof) {
+  const auto data = contents(100 * 1024);
+  write("data.tsv.zst", Compression::ZSTD, data);
+
+  Decompression_pool pool{1, 2, 512};
+
+  {
+    const auto f = pool.wrap(file("data.tsv.zst", Compression::ZSTD));
+    f->open(Mode::READ);
+
+    char buffer[100];
+    ASSERT_EQ(100, f->read(buffer, sizeof(buffer)));
+    EXPECT_EQ(data.substr(0, 100), std::string(buffer, sizeof(buffer)));
+    EXPECT_EQ(100, f->tell());
+
+    // seek is not supported once reading has started
+    EXPECT_THROW(f->seek(0), std::logic_error);
+
+    f->close();
+  }
+
+  // file destroyed while open
+  {
+    const auto f = pool.wrap(file("data.tsv.zst", Compression::ZSTD));
+    f->open(Mode::READ);
+
+    char buffer[10];
+    ASSERT_EQ(10, f->read(buffer, sizeof(buffer)));
+  }
+}
+
+TEST_F(Decompression_pool_test, read_error) {
+  Decompression_pool pool{1};
+
+  const auto f = pool.wrap(file("not_there.tsv.zst", Compression::ZSTD));
+
+  EXPECT_ANY_THROW(read(f.get()));
+}
+
+}  // namespace tests
+}  // namespace mysqlsh
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/load/memory_budget.h"
+
+namespace mysqlsh {
+namespace tests {
+
+TEST(Memory_budget_test, try_acquire) {
+  Memory_budget budget{100};
+
+  auto first = budget.try_acquire(60);
+  EXPECT_TRUE(first);
+  EXPECT_EQ(60, budget.used());
+
+  // does not fit
+  EXPECT_FALSE(budget.try_acquire(50));
+  EXPECT_EQ(60, budget.used());
+
+  {
+    const auto second = budget.try_acquire(40);
+    EXPECT_TRUE(second);
+    EXPECT_EQ(100, budget.used());
+  }
+
+  EXPECT_EQ(60, budget.used());
+
+  first.reset();
+  EXPECT_EQ(0, budget.used());
+  EXPECT_EQ(100, budget.peak());
+}
+
+TEST(Memory_budget_test, unlimited) {
+  Memory_budget budget;
+
+  const auto first = budget.try_acquire(1000);
+  const auto second = budget.acquire(1000);
+
+  EXPECT_TRUE(first);
+  EXPECT_TRUE(second);
+  EXPECT_EQ(2000, budget.used());
+  EXPECT_EQ(2000, budget.peak());
+}
+
+TEST(Memory_budget_test, acquire_waits_for_memory) {
+  Memory_budget budget{100};
+
+  auto first = budget.acquire(80);
+  EXPECT_TRUE(first);
+
+  std::atomic<bool> acquired{false};
+
+  std::thread t{[&budget, &acquired]() {
+    const auto second = budget.acquire(40);
+    EXPECT_TRUE(second);
+    acquired = true;
+  }};
+
+  std::this_thread::sleep_for(std::chrono::milliseconds{100});
+  EXPECT_FALSE(acquired);
+
+  first.reset();
+  t.join();
+
+  EXPECT_TRUE(acquired);
+  EXPECT_EQ(0, budget.used());
+  EXPECT_EQ(80, budget.peak());
+}
+
+TEST(Memory_budget_test, acquire_does_not_wait_for_non_blocking) {
+  Memory_budget budget{100};
+
+  // whole budget is held by non-blocking consumers
+  const auto prefetched = budget.try_acquire(100);
+  EXPECT_TRUE(prefetched);
+
+  // request is granted, as otherwise nothing would release the memory
+  const auto first = budget.acquire(50);
+  EXPECT_TRUE(first);
+  EXPECT_EQ(150, budget.used());
+
+  // oversized request is also granted
+  Memory_budget small{10};
+  EXPECT_TRUE(small.acquire(50));
+}
+
+TEST(Memory_budget_test, interrupt) {
+  Memory_budget budget{100};
+
+  const auto first = budget.acquire(100);
+
+  std::thread t{[&budget]() { EXPECT_FALSE(budget.acquire(10)); }};
+
+  budget.interrupt();
+  t.join();
+
+  EXPECT_FALSE(budget.acquire(10));
+  EXPECT_EQ(100, budget.used());
+}
+
+TEST(Memory_budget_test, move_reservation) {
+  Memory_budget budget{100};
+
+  auto first = budget.try_acquire(30);
+  Memory_budget::Reservation second{std::move(first)};
+
+  EXPECT_FALSE(first);
+  EXPECT_TRUE(second);
+  EXPECT_EQ(30, second.bytes());
+  EXPECT_EQ(30, budget.used());
+
+  second = budget.try_acquire(50);
+  EXPECT_EQ(50, budget.used());
+
+  second.reset();
+  EXPECT_EQ(0, budget.used());
+}
+
+}  // namespace tests
+}  // namespace mysqlsh
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/load/prefetch_queue.h"
+
+namespace mysqlsh {
+namespace tests {
+
+TEST(Prefetch_queue_test, nothing_queued) {
+  Prefetch_queue queue{4};
+
+  queue.start();
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(0, queue.in_flight());
+}
+
+TEST(Prefetch_queue_test, fetches_are_bounded) {
+  Prefetch_queue queue{3};
+  std::vector<int> started;
+
+  for (int i = 0; i < 7; ++i) {
+    queue.push([&started, i]() { started.emplace_back(i); });
+  }
+
+  // nothing is started until asked to
+  EXPECT_TRUE(started.empty());
+  EXPECT_FALSE(queue.empty());
+
+  queue.start();
+  EXPECT_EQ((std::vector<int>{0, 1, 2}), started);
+  EXPECT_EQ(3, queue.in_flight());
+
+  // limit is reached, nothing more is started
+  queue.start();
+  EXPECT_EQ(3, started.size());
+
+  // consuming an item makes room for exactly one more fetch
+  queue.consumed();
+  EXPECT_EQ(2, queue.in_flight());
+  EXPECT_EQ(3, started.size());
+
+  queue.start();
+  EXPECT_EQ((std::vector<int>{0, 1, 2, 3}), started);
+  EXPECT_EQ(3, queue.in_flight());
+
+  // consume everything, remaining fetches are started in order
+  while (!queue.empty() || queue.in_flight() > 0) {
+    queue.consumed();
+    queue.start();
+    EXPECT_LE(queue.in_flight(), 3);
+  }
+
+  EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5, 6}), started);
+}
+
+TEST(Prefetch_queue_test, fetches_added_while_running) {
+  Prefetch_queue queue{2};
+  std::vector<int> started;
+
+  const auto push = [&queue, &started](int i) {
+    queue.push([&started, i]() { started.emplace_back(i); });
+  };
+
+  push(0);
+  queue.start();
+  EXPECT_EQ(1, queue.in_flight());
+  EXPECT_TRUE(queue.empty());
+
+  // room is available, new fetches are started as soon as they are added
+  push(1);
+  push(2);
+  queue.start();
+  EXPECT_EQ((std::vector<int>{0, 1}), started);
+  EXPECT_FALSE(queue.empty());
+
+  queue.consumed();
+  queue.consumed();
+  queue.start();
+  EXPECT_EQ((std::vector<int>{0, 1, 2}), started);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(1, queue.in_flight());
+}
+
+TEST(Prefetch_queue_test, zero_depth) {
+  // at least one item is always fetched, otherwise the consumer would wait
+  // forever
+  Prefetch_queue queue{0};
+  std::size_t started = 0;
+
+  queue.push([&started]() { ++started; });
+  queue.push([&started]() { ++started; });
+
+  queue.start();
+  EXPECT_EQ(1, started);
+
+  queue.consumed();
+  queue.start();
+  EXPECT_EQ(2, started);
+}
+
+}  // namespace tests
+}  // namespace mysqlsh
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/load/segmented_progress_file.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysqlsh {
+namespace tests {
+
+using mysqlshdk::storage::Mode;
+
+class Segmented_progress_file_test : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_path = shcore::path::join_path(getenv("TMPDIR"), "segmented_progress");
+    m_dir = mysqlshdk::storage::make_directory(m_path);
+
+    if (m_dir->exists()) {
+      shcore::remove_directory(m_path, true);
+    }
+
+    m_dir->create();
+  }
+
+  void TearDown() override { shcore::remove_directory(m_path, true); }
+
+  std::unique_ptr<Segmented_progress_file> file(std::size_t segment_size,
+                                                std::size_t max_segments) {
+    return std::make_unique<Segmented_progress_file>(m_dir->file("progress"),
+                                                     segment_size,
+                                                     max_segments);
+  }
+
+  static void write_lines(Segmented_progress_file *file, int first, int last,
+                          std::string *expected) {
+    for (int i = first; i < last; ++i) {
+      const auto line = "line " + std::to_string(i) + "\n";
+      file->write(line.data(), line.size());
+      file->flush();
+      *expected += line;
+    }
+  }
+
+  static std::string read(mysqlshdk::storage::IFile *file) {
+    file->open(Mode::READ);
+    auto contents = mysqlshdk::storage::read_file(file);
+    file->close();
+    return contents;
+  }
+
+  bool exists(const std::string &name) const {
+    return m_dir->file(name)->exists();
+  }
+
+  std::string m_path;
+  std::unique_ptr<mysqlshdk::storage::IDirectory> m_dir;
+};
+
+TEST_F(Segmented_progress_file_test, write_and_read) {
+  std::string expected;
+
+  {
+    const auto f = file(16, 1000);
+    EXPECT_FALSE(f->exists());
+
+    f->open(Mode::WRITE);
+    write_lines(f.get(), 0, 10, &expected);
+    f->close();
+
+    // each full segment holds three lines, no compaction
+    EXPECT_EQ(4, f->current_segment());
+    EXPECT_TRUE(f->exists());
+  }
+
+  EXPECT_FALSE(exists("progress"));
+  EXPECT_TRUE(exists("progress.1"));
+  EXPECT_TRUE(exists("progress.4"));
+  EXPECT_FALSE(exists("progress.5"));
+
+  EXPECT_EQ(expected, read(file(16, 1000).get()));
+}
+
+TEST_F(Segmented_progress_file_test, compaction) {
+  std::string expected;
+
+  {
+    const auto f = file(16, 2);
+
+    f->open(Mode::WRITE);
+    write_lines(f.get(), 0, 10, &expected);
+    f->close();
+    f->wait_for_compaction();
+  }
+
+  EXPECT_TRUE(exists("progress"));
+  EXPECT_FALSE(exists("progress.1"));
+  EXPECT_FALSE(exists("progress.2"));
+
+  const auto f = file(16, 2);
+  EXPECT_EQ(expected, read(f.get()));
+
+  // continue writing after the existing data
+  f->open(Mode::APPEND);
+  write_lines(f.get(), 10, 25, &expected);
+  f->close();
+  f->wait_for_compaction();
+
+  EXPECT_EQ(expected, read(file(16, 2).get()));
+}
+
+TEST_F(Segmented_progress_file_test, merged_segments_are_skipped) {
+  std::string expected;
+
+  {
+    const auto f = file(16, 2);
+
+    f->open(Mode::WRITE);
+    write_lines(f.get(), 0, 7, &expected);
+    f->close();
+    f->wait_for_compaction();
+  }
+
+  EXPECT_TRUE(exists("progress"));
+  EXPECT_FALSE(exists("progress.1"));
+
+  // simulate compaction which was interrupted before segments were removed
+  {
+    const auto segment = m_dir->file("progress.1");
+    segment->open(Mode::WRITE);
+    segment->write("line 0\n", 7);
+    segment->close();
+  }
+
+  EXPECT_EQ(expected, read(file(16, 2).get()));
+}
+
+TEST_F(Segmented_progress_file_test, remove) {
+  std::string expected;
+  const auto f = file(16, 2);
+
+  f->open(Mode::WRITE);
+  write_lines(f.get(), 0, 7, &expected);
+  f->close();
+
+  f->remove();
+
+  EXPECT_FALSE(f->exists());
+  EXPECT_FALSE(exists("progress"));
+
+  for (int i = 1; i <= 5; ++i) {
+    EXPECT_FALSE(exists("progress." + std::to_string(i)));
+  }
+
+  // file can be written to again
+  expected.clear();
+  f->open(Mode::WRITE);
+  write_lines(f.get(), 0, 3, &expected);
+  f->close();
+
+  EXPECT_EQ(expected, read(file(16, 2).get()));
+}
+
+}  // namespace tests
+}  // namespace mysqlsh
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/load/shared_chunk_cache.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysqlsh {
+namespace tests {
+
+using mysqlshdk::storage::Compression;
+
+class Shared_chunk_cache_test : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_path = shcore::path::join_path(getenv("TMPDIR"), "shared_chunk_cache");
+    m_dir = mysqlshdk::storage::make_directory(m_path);
+
+    if (m_dir->exists()) {
+      shcore::remove_directory(m_path, true);
+    }
+
+    m_dir->create();
+  }
+
+  void TearDown() override { shcore::remove_directory(m_path, true); }
+
+  void write(const std::string &name, const std::string &contents,
+             Compression compression = Compression::NONE) {
+    const auto file =
+        mysqlshdk::storage::make_file(m_dir->file(name), compression);
+    file->open(mysqlshdk::storage::Mode::WRITE);
+    file->write(contents.c_str(), contents.length());
+    file->close();
+  }
+
+  static std::string read(mysqlshdk::storage::IFile *file) {
+    file->open(mysqlshdk::storage::Mode::READ);
+    auto contents = mysqlshdk::storage::read_file(file);
+    file->close();
+    return contents;
+  }
+
+  std::unique_ptr<mysqlshdk::storage::IFile> get(
+      Shared_chunk_cache *cache, const std::string &name, std::size_t size,
+      Compression compression = Compression::NONE) {
+    auto file = m_dir->file(name);
+    auto result = cache->file(&file, size, compression, {});
+
+    if (result) {
+      EXPECT_EQ(nullptr, file);
+    } else {
+      EXPECT_NE(nullptr, file);
+    }
+
+    return result;
+  }
+
+  std::string m_path;
+  std::unique_ptr<mysqlshdk::storage::IDirectory> m_dir;
+};
+
+TEST_F(Shared_chunk_cache_test, share) {
+  const std::string first(1024 * 1024 + 7, 'a');
+  const std::string second = "second";
+
+  write("first.tsv.zst", first, Compression::ZSTD);
+  write("second.tsv", second);
+
+  Shared_chunk_cache cache{2, first.length() + second.length()};
+
+  {
+    // decompressed by the first consumer
+    const auto file = get(&cache, "first.tsv.zst", first.length(),
+                          Compression::ZSTD);
+    ASSERT_NE(nullptr, file);
+    EXPECT_EQ("first.tsv.zst", file->filename());
+    EXPECT_FALSE(file->is_compressed());
+    EXPECT_EQ(first.length(), file->file_size());
+    EXPECT_EQ(first, read(file.get()));
+    EXPECT_EQ(first.length(), cache.memory_used());
+    EXPECT_EQ(0, cache.bytes_reused());
+  }
+
+  // size is not accurate
+  auto second_file = get(&cache, "second.tsv", 2);
+  ASSERT_NE(nullptr, second_file);
+  EXPECT_EQ(second, read(second_file.get()));
+  EXPECT_EQ(first.length() + second.length(), cache.memory_used());
+
+  {
+    // read from memory by the second consumer
+    const auto file = get(&cache, "first.tsv.zst", first.length(),
+                          Compression::ZSTD);
+    ASSERT_NE(nullptr, file);
+    EXPECT_EQ(first, read(file.get()));
+    EXPECT_EQ(first.length(), cache.bytes_reused());
+  }
+
+  // all consumers have read the file, memory is released
+  EXPECT_EQ(second.length(), cache.memory_used());
+  EXPECT_EQ(first.length() + second.length(), cache.peak_memory());
+
+  // released files are read directly
+  EXPECT_EQ(nullptr, get(&cache, "first.tsv.zst", first.length(),
+                         Compression::ZSTD));
+
+  // the second consumer is not going to read the file
+  second_file.reset();
+  cache.consumer_finished();
+  EXPECT_EQ(0, cache.memory_used());
+
+  // nothing is cached if there's just one consumer
+  write("third.tsv", second);
+  EXPECT_EQ(nullptr, get(&cache, "third.tsv", second.length()));
+}
+
+TEST_F(Shared_chunk_cache_test, memory_limit) {
+  const std::string contents = "contents";
+
+  write("first.tsv", contents);
+  write("second.tsv", contents);
+
+  Shared_chunk_cache cache{3, contents.length()};
+
+  const auto first = get(&cache, "first.tsv", contents.length());
+  ASSERT_NE(nullptr, first);
+
+  // does not fit in memory
+  EXPECT_EQ(nullptr, get(&cache, "second.tsv", contents.length()));
+}
+
+TEST_F(Shared_chunk_cache_test, missing_file) {
+  Shared_chunk_cache cache{2, 1024};
+
+  // the first consumer gets the error
+  auto file = m_dir->file("missing.tsv");
+  EXPECT_THROW(cache.file(&file, 10, Compression::NONE, {}), std::exception);
+  EXPECT_EQ(0, cache.memory_used());
+
+  // the remaining ones read the file directly
+  EXPECT_EQ(nullptr, get(&cache, "missing.tsv", 10));
+}
+
+}  // namespace tests
+}  // namespace mysqlsh
@@ -1869,4 +1869,56 @@ shell.registerGlobal('gl', gl);
   delete_user_plugin("bug31693096");
 }
 
+TEST_F(Mysqlsh_plugin_test, lazy_plugin) {
+  // plugin with a manifest is loaded on first use of its global object
+  write_user_plugin("lazy-py", R"(print('lazy plugin loaded')
+
+def hello():
+  print('hello from lazy plugin')
+
+obj = shell.create_extension_object()
+shell.add_extension_object_member(obj, "sayHello", hello)
+shell.register_global('lazyObject', obj)
+)",
+                    ".py");
+  shcore::create_file(
+      join_path(get_user_plugin_folder(), "lazy-py", "plugin.json"),
+      R"({"globals": {"lazyObject": ["sayHello"]}})");
+
+  // manifest declares an object which is not registered by the plugin
+  write_user_plugin("missing-js", R"(println('missing plugin loaded');
+)",
+                    ".js");
+  shcore::create_file(
+      join_path(get_user_plugin_folder(), "missing-js", "plugin.json"),
+      R"({"globals": {"missingObject": []}})");
+
+  add_expected_py_log("Plugin 'lazy-py' is going to be loaded on first use");
+  add_expected_py_log("Loading plugin 'lazy-py' on first use of 'lazyObject'");
+  add_expected_js_log("Plugin 'missing-js' is going to be loaded on first use");
+
+  // plugin is not loaded at startup
+  add_js_test("println('before first use')", "before first use");
+  add_js_test("lazyObject.sayHello()",
+              "lazy plugin loaded\nhello from lazy plugin");
+  add_py_test("\\py", "Switching to Python mode...");
+  // plugin is loaded only once
+  add_py_test("lazyObject.say_hello()", "hello from lazy plugin");
+  add_js_test("\\js", "Switching to JavaScript mode...");
+  add_js_test("missingObject.test()", "missing plugin loaded");
+
+  run({"--log-level=debug"});
+
+  MY_EXPECT_CMD_OUTPUT_CONTAINS(expected_output());
+#ifdef HAVE_V8
+  MY_EXPECT_CMD_OUTPUT_CONTAINS(
+      "The plugin 'missing-js' did not register the global object "
+      "'missingObject' declared in its manifest.");
+#endif  // HAVE_V8
+  validate_log();
+
+  delete_user_plugin("lazy-py");
+  delete_user_plugin("missing-js");
+}
+
 }  // namespace tests
@@ -52,8 +52,11 @@ class Aws_signer_test : public testing::Test {
   static void test_sign_request(
       const rest::Signed_request *request, const std::string &signature,
       const std::string &sha256 =
-          "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855") {
-    const auto headers = create_signer().sign_request(request, k_now);
+          "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+      bool unsigned_payload = false) {
+    auto signer = create_signer();
+    signer.m_unsigned_payload = unsigned_payload;
+    const auto headers = signer.sign_request(request, k_now);
 
     ASSERT_NE(headers.end(), headers.find("Host"));
     EXPECT_EQ(k_host, headers.at("Host"));
@@ -90,6 +93,37 @@ class Aws_signer_test : public testing::Test {
     EXPECT_EQ(authorization, headers.at("Authorization"));
   }
 
+  static void test_signing_key_cache() {
+    rest::Signed_request request{"/test.txt"};
+    request.type = rest::Type::GET;
+
+    const auto sign = [&request](const Aws_signer &signer, time_t now) {
+      return signer.sign_request(&request, now).at("Authorization");
+    };
+
+    const auto signer = create_signer();
+    const auto first = sign(signer, k_now);
+    // cached key produces the same signature as a freshly derived one
+    EXPECT_EQ(sign(create_signer(), k_now + 10), sign(signer, k_now + 10));
+    // key is derived again when the date changes
+    EXPECT_EQ(sign(create_signer(), k_now + 86400),
+              sign(signer, k_now + 86400));
+
+    // key is derived again when the credentials change
+    auto other = create_signer();
+    sign(other, k_now);
+    other.set_credentials(std::make_shared<Aws_credentials>(
+        k_access_key_id, "another/secret/access/key"));
+    EXPECT_NE(first, sign(other, k_now));
+
+    // copies do not share the key
+    auto copy = other;
+    copy.set_credentials(std::make_shared<Aws_credentials>(
+        k_access_key_id, "wJalrXUtnFEMI/K7MDENG/bPxRfiCYEXAMPLEKEY"));
+    EXPECT_EQ(first, sign(copy, k_now));
+    EXPECT_NE(first, sign(other, k_now));
+  }
+
  private:
   // Friday, 24 May 2013 00:00:00
   static constexpr time_t k_now = 1369353600;
@@ -128,6 +162,36 @@ TEST_F(Aws_signer_test, put_object) {
       "44ce7dd67c959e0d3524ffac1771dfbba87d2b6b4b4e99e42034a8b803f8b072");
 }
 
+TEST_F(Aws_signer_test, put_object_unsigned_payload) {
+  rest::Signed_request request{"/test%24file.text",
+                               {{"Date", "Fri, 24 May 2013 00:00:00 GMT"},
+                                {"x-amz-storage-class", "REDUCED_REDUNDANCY"}}};
+  request.type = rest::Type::PUT;
+
+  const std::string data = "Welcome to Amazon S3.";
+  request.body = data.c_str();
+  request.size = data.length();
+
+  test_sign_request(
+      &request,
+      "91c6efc02b5801e55e03b4a83a22d6b4f85a6010fa94d5a87f88e41c5ee1bf46",
+      "UNSIGNED-PAYLOAD", true);
+}
+
+TEST_F(Aws_signer_test, get_object_unsigned_payload) {
+  // requests without a payload use the hash of an empty payload
+  rest::Signed_request request{"/test.txt", {{"Range", "bytes=0-9"}}};
+  request.type = rest::Type::GET;
+
+  test_sign_request(
+      &request,
+      "f0e8bdb87c964420e857bd35b5d6ed310bd44f0170aba48dd91039c6036bdb41",
+      "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+      true);
+}
+
+TEST_F(Aws_signer_test, signing_key_cache) { test_signing_key_cache(); }
+
 TEST_F(Aws_signer_test, get_bucket_lifecycle) {
   rest::Signed_request request{"/?lifecycle"};
   request.type = rest::Type::GET;
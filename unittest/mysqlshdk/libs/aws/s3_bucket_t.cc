@@ -148,6 +148,36 @@ TEST_P(Bucket_test, list_objects) {
   clean_bucket(bucket);
 }
 
+TEST_P(Bucket_test, delete_all_objects) {
+  SKIP_IF_NO_AWS_CONFIGURATION;
+
+  S3_bucket bucket(get_config());
+
+  create_objects(bucket);
+
+  bucket.create_multipart_upload("sakila/film.csv");
+  const auto other_upload = bucket.create_multipart_upload("world.sql");
+
+  // only objects and uploads with the given prefix are removed
+  EXPECT_EQ(6, bucket.delete_all_objects("sakila/"));
+
+  auto objects = bucket.list_objects("", 0, true, Object_details::NAME);
+  ASSERT_EQ(5, objects.size());
+  EXPECT_EQ("sakila.sql", objects[0].name);
+  EXPECT_EQ("sakila_metadata.txt", objects[1].name);
+
+  auto uploads = bucket.list_multipart_uploads();
+  ASSERT_EQ(1, uploads.size());
+  EXPECT_EQ(other_upload.name, uploads[0].name);
+
+  EXPECT_EQ(0, bucket.delete_all_objects("sakila/"));
+
+  // empty prefix removes everything
+  EXPECT_EQ(5, bucket.delete_all_objects());
+  EXPECT_TRUE(bucket.list_objects().empty());
+  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+}
+
 TEST_P(Bucket_test, multipart_uploads) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
@@ -232,6 +232,54 @@ TEST_P(Object_storage_test, file_write_multipart_upload) {
   bucket.delete_object("test/sample\".txt");
 }
 
+TEST_P(Object_storage_test, file_write_background_uploads) {
+  SKIP_IF_NO_AWS_CONFIGURATION;
+
+  auto config = get_config();
+  config->set_part_size(k_min_part_size);
+  config->set_upload_concurrency(3);
+  S3_bucket bucket(config);
+  Directory root(config, "test");
+
+  auto file = root.file("background.txt");
+
+  // each part has different contents, parts need to be committed in order
+  const auto data =
+      multipart_file_data() + multipart_file_data() + multipart_file_data();
+  size_t offset = 0;
+
+  file->open(Mode::WRITE);
+
+  while (offset < data.size()) {
+    offset += file->write(data.data() + offset,
+                          std::min<size_t>(1000, data.size() - offset));
+  }
+
+  // upload is committed once the file is closed
+  EXPECT_FALSE(bucket.list_multipart_uploads().empty());
+
+  // close() waits for all the parts and commits them in order
+  file->close();
+  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+
+  file->open(Mode::READ);
+  std::string buffer;
+  buffer.resize(data.size() + 5);
+  size_t read = 0;
+
+  while (const auto bytes =
+             file->read(buffer.data() + read, buffer.size() - read)) {
+    read += bytes;
+  }
+
+  EXPECT_EQ(data.size(), read);
+  buffer.resize(read);
+  EXPECT_EQ(data, buffer);
+  file->close();
+
+  bucket.delete_object("test/background.txt");
+}
+
 TEST_P(Object_storage_test, file_append_new_file) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
@@ -388,6 +436,52 @@ TEST_P(Object_storage_test, file_write_multipart_errors) {
   EXPECT_NO_THROW(file->close());
 }
 
+TEST_P(Object_storage_test, file_write_background_upload_errors) {
+  SKIP_IF_NO_AWS_CONFIGURATION;
+
+  auto config = get_config();
+  config->set_part_size(3);
+  config->set_upload_concurrency(2);
+  S3_bucket bucket(config);
+  Directory root(config);
+  auto mpo1 = bucket.create_multipart_upload("sample.txt");
+  auto file = root.file("sample.txt");
+
+  file->open(Mode::APPEND);
+
+  bucket.abort_multipart_upload(mpo1);
+
+  // part is uploaded in the background, write does not wait for it
+  EXPECT_NO_THROW(file->write("67890", 5));
+
+  // error is reported once the writer waits for the part
+  EXPECT_THROW_LIKE(file->close(), shcore::Exception,
+                    "Failed to upload part 1 for object 'sample.txt': ");
+  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+
+  // close has failed and file state has been reset, there's not going to be
+  // any more communication with the server
+  EXPECT_NO_THROW(file->close());
+
+  // error is reported by write, once it needs to wait for the failed part
+  mpo1 = bucket.create_multipart_upload("sample.txt");
+  file->open(Mode::APPEND);
+
+  bucket.abort_multipart_upload(mpo1);
+
+  const auto write_parts = [&file]() {
+    // last write schedules the third part, waits for the first one
+    for (int i = 0; i < 4; ++i) {
+      file->write("678", 3);
+    }
+  };
+
+  EXPECT_THROW_LIKE(write_parts(), shcore::Exception,
+                    "Failed to upload part 1 for object 'sample.txt': ");
+  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+  EXPECT_NO_THROW(file->close());
+}
+
 TEST_P(Object_storage_test, file_writing) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
@@ -445,6 +539,66 @@ TEST_P(Object_storage_test, file_writing) {
   bucket.delete_object("sample.txt");
 }
 
+TEST_P(Object_storage_test, file_read_ahead) {
+  SKIP_IF_NO_AWS_CONFIGURATION;
+
+  const auto config = get_config();
+  // small ranges, so that a single read spans multiple requests
+  config->set_read_part_size(100);
+  config->set_read_concurrency(3);
+
+  Directory root(config);
+
+  std::string contents;
+
+  for (int i = 0; i < 200; ++i) {
+    contents += std::to_string(i) + "\n";
+  }
+
+  {
+    auto file = root.file("read_ahead.txt");
+    file->open(Mode::WRITE);
+    file->write(contents.data(), contents.size());
+    file->close();
+  }
+
+  auto file = root.file("read_ahead.txt");
+  file->open(Mode::READ);
+
+  const auto read_all = [&file](std::size_t chunk) {
+    std::string result;
+    std::string buffer;
+    buffer.resize(chunk);
+
+    while (const auto read = file->read(buffer.data(), buffer.size())) {
+      result.append(buffer.data(), read);
+    }
+
+    return result;
+  };
+
+  EXPECT_EQ(contents, read_all(7));
+
+  // seek within the fetched ranges
+  file->seek(250);
+  EXPECT_EQ(contents.substr(250), read_all(333));
+
+  // positional reads do not interfere with the read-ahead
+  file->seek(10);
+  std::string buffer;
+  buffer.resize(20);
+  EXPECT_EQ(20, file->read(buffer.data(), buffer.size()));
+  EXPECT_EQ(contents.substr(10, 20), buffer);
+  EXPECT_EQ(20, file->pread(buffer.data(), buffer.size(), 500));
+  EXPECT_EQ(contents.substr(500, 20), buffer);
+  EXPECT_EQ(contents.substr(30), read_all(50));
+
+  file->close();
+
+  S3_bucket bucket(config);
+  bucket.delete_object("read_ahead.txt");
+}
+
 TEST_P(Object_storage_test, file_rename) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
@@ -26,6 +26,7 @@
 #include "mysqlshdk/libs/storage/backend/object_storage.h"
 
 using mysqlshdk::azure::Blob_container;
+using mysqlshdk::azure::Blob_storage_config;
 using mysqlshdk::rest::Response_error;
 using mysqlshdk::storage::Mode;
 using mysqlshdk::storage::backend::object_storage::Directory;
@@ -240,6 +241,58 @@ TEST_F(Azure_blob_storage_tests, file_write_multipart_upload) {
   container.delete_object("test/sample\".txt");
 }
 
+TEST_F(Azure_blob_storage_tests, file_write_concurrent_block_uploads) {
+  SKIP_IF_NO_AZURE_CONFIGURATION;
+
+  auto config = get_config();
+  EXPECT_EQ(0, config->upload_concurrency());
+  config->enable_background_uploads();
+  EXPECT_EQ(Blob_storage_config::DEFAULT_BLOB_UPLOAD_CONCURRENCY,
+            config->upload_concurrency());
+  EXPECT_EQ(Blob_storage_config::DEFAULT_BLOB_READ_CONCURRENCY,
+            config->read_concurrency());
+
+  // small blocks, so that multiple of them are in flight
+  config->set_part_size(k_min_part_size / 4);
+  // small ranges, so that the blob is read using multiple requests
+  config->set_read_part_size(k_min_part_size / 4);
+  Blob_container container(config);
+  Directory root(config, "test");
+
+  auto file = root.file("concurrent.txt");
+
+  const auto data = multipart_file_data();
+  size_t offset = 0;
+
+  file->open(Mode::WRITE);
+
+  while (offset < data.size()) {
+    offset += file->write(data.data() + offset,
+                          std::min<size_t>(1000, data.size() - offset));
+  }
+
+  // close() waits for all the blocks, then commits the block list in order
+  file->close();
+  EXPECT_TRUE(container.list_multipart_uploads().empty());
+
+  file->open(Mode::READ);
+  std::string buffer;
+  buffer.resize(k_multipart_file_size + 5);
+  size_t read = 0;
+
+  while (const auto bytes =
+             file->read(buffer.data() + read, buffer.size() - read)) {
+    read += bytes;
+  }
+
+  EXPECT_EQ(k_multipart_file_size, read);
+  buffer.resize(read);
+  EXPECT_EQ(data, buffer);
+  file->close();
+
+  container.delete_object("test/concurrent.txt");
+}
+
 TEST_F(Azure_blob_storage_tests, file_append_new_file) {
   SKIP_IF_NO_AZURE_CONFIGURATION;
 
@@ -420,6 +473,40 @@ TEST_F(Azure_blob_storage_tests, file_write_multipart_errors) {
   file->close();
 }
 
+TEST_F(Azure_blob_storage_tests, file_write_background_upload_errors) {
+  SKIP_IF_NO_AZURE_CONFIGURATION;
+
+  auto config = get_config();
+  config->set_part_size(3);
+  config->set_upload_concurrency(2);
+  Blob_container container(config);
+  Directory root(config);
+  auto mpo1 = container.create_multipart_upload("sample.txt");
+  container.upload_part(mpo1, 1, "123", 3);
+
+  auto file = root.file("sample.txt");
+
+  file->open(Mode::APPEND);
+
+  container.abort_multipart_upload(mpo1);
+
+  // blocks are uploaded in the background, the block list is invalid because
+  // the abort operation wiped out the first block, failure is reported when
+  // the commit is attempted, after all the pending blocks are uploaded
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_NO_THROW(file->write("456", 3));
+  }
+
+  EXPECT_THROW_MSG_CONTAINS(
+      file->close(), shcore::Error,
+      "Failed to commit multipart upload for object 'sample.txt': The "
+      "specified block list is invalid.");
+
+  // close has failed and file state has been reset, there's not going to be
+  // any more communication with the server
+  EXPECT_NO_THROW(file->close());
+}
+
 TEST_F(Azure_blob_storage_tests, file_writing) {
   SKIP_IF_NO_AZURE_CONFIGURATION;
 
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/db/arrow_batch.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+
+namespace mysqlshdk {
+namespace db {
+
+namespace {
+
+Column column(const std::string &name, Type type) {
+  return Column("def", "schema", "table", "table", name, name, 0, 0, type, 0,
+                Type::UInteger == type, false, Type::Bytes == type);
+}
+
+template <typename T>
+T value(const ArrowArray &array, int64_t index) {
+  T v;
+  memcpy(&v, static_cast<const char *>(array.buffers[1]) + index * sizeof(T),
+         sizeof(T));
+  return v;
+}
+
+std::string string(const ArrowArray &array, int64_t index) {
+  const auto offsets = static_cast<const int64_t *>(array.buffers[1]);
+  return std::string(static_cast<const char *>(array.buffers[2]) +
+                         offsets[index],
+                     offsets[index + 1] - offsets[index]);
+}
+
+bool is_valid(const ArrowArray &array, int64_t index) {
+  if (!array.buffers[0]) return true;
+  return static_cast<const uint8_t *>(array.buffers[0])[index / 8] &
+         (1 << (index % 8));
+}
+
+}  // namespace
+
+TEST(Arrow_batch_builder_test, schema) {
+  Arrow_batch_builder builder{{column("i", Type::Integer),
+                               column("u", Type::UInteger),
+                               column("f", Type::Float),
+                               column("d", Type::Double),
+                               column("dec", Type::Decimal),
+                               column("s", Type::String),
+                               column("b", Type::Bytes),
+                               column("date", Type::Date),
+                               column("dt", Type::DateTime),
+                               column("t", Type::Time),
+                               column("bit", Type::Bit),
+                               column("n", Type::Null)}};
+
+  ArrowSchema schema;
+  builder.export_schema(&schema);
+
+  EXPECT_STREQ("+s", schema.format);
+  ASSERT_EQ(12, schema.n_children);
+
+  const std::vector<std::pair<std::string, std::string>> expected = {
+      {"i", "l"},  {"u", "L"},    {"f", "f"},     {"d", "g"},
+      {"dec", "U"}, {"s", "U"},   {"b", "Z"},     {"date", "tdD"},
+      {"dt", "tsu:"}, {"t", "tDu"}, {"bit", "L"}, {"n", "n"}};
+
+  for (int64_t i = 0; i < schema.n_children; ++i) {
+    SCOPED_TRACE(expected[i].first);
+    EXPECT_EQ(expected[i].first, schema.children[i]->name);
+    EXPECT_EQ(expected[i].second, schema.children[i]->format);
+    EXPECT_EQ(ARROW_FLAG_NULLABLE, schema.children[i]->flags);
+  }
+
+  schema.release(&schema);
+  EXPECT_EQ(nullptr, schema.release);
+}
+
+TEST(Arrow_batch_builder_test, batches) {
+  const std::vector<Type> types = {Type::Integer, Type::UInteger, Type::Double,
+                                   Type::String,  Type::Bytes,    Type::Date,
+                                   Type::DateTime, Type::Time};
+  std::vector<Column> columns;
+
+  for (const auto type : types) {
+    columns.emplace_back(column(to_string(type), type));
+  }
+
+  Arrow_batch_builder builder{columns};
+
+  builder.append(Mutable_row(types, -5, 7u, 1.5, "abc",
+                             std::string{"\0\xff", 2}, "1970-01-02",
+                             "1970-01-01 00:00:01.5", "-01:00:00"));
+
+  Mutable_row nulls{types};
+  builder.append(nulls);
+
+  builder.append(Mutable_row(types, 1, 2u, 3.0, "", "", "0000-00-00",
+                             "2000-01-01 00:00:00", "838:59:59.000001"));
+
+  EXPECT_EQ(3, builder.size());
+
+  ArrowArray batch;
+  builder.export_batch(&batch);
+
+  EXPECT_EQ(0, builder.size());
+  EXPECT_EQ(3, batch.length);
+  EXPECT_EQ(0, batch.null_count);
+  ASSERT_EQ(8, batch.n_children);
+
+  for (int64_t i = 0; i < batch.n_children; ++i) {
+    EXPECT_EQ(3, batch.children[i]->length);
+    EXPECT_TRUE(is_valid(*batch.children[i], 0));
+    EXPECT_FALSE(is_valid(*batch.children[i], 1));
+  }
+
+  EXPECT_EQ(-5, value<int64_t>(*batch.children[0], 0));
+  EXPECT_EQ(1, value<int64_t>(*batch.children[0], 2));
+  EXPECT_EQ(7, value<uint64_t>(*batch.children[1], 0));
+  EXPECT_EQ(2, value<uint64_t>(*batch.children[1], 2));
+  EXPECT_DOUBLE_EQ(1.5, value<double>(*batch.children[2], 0));
+  EXPECT_DOUBLE_EQ(3.0, value<double>(*batch.children[2], 2));
+
+  EXPECT_EQ(3, batch.children[3]->n_buffers);
+  EXPECT_EQ("abc", string(*batch.children[3], 0));
+  EXPECT_EQ("", string(*batch.children[3], 1));
+  EXPECT_EQ("", string(*batch.children[3], 2));
+  EXPECT_EQ(std::string("\0\xff", 2), string(*batch.children[4], 0));
+
+  EXPECT_EQ(1, value<int32_t>(*batch.children[5], 0));
+  // zero dates are converted to nulls
+  EXPECT_FALSE(is_valid(*batch.children[5], 2));
+  EXPECT_EQ(2, batch.children[5]->null_count);
+
+  EXPECT_EQ(1500000, value<int64_t>(*batch.children[6], 0));
+  EXPECT_EQ(int64_t{946684800} * 1000000,
+            value<int64_t>(*batch.children[6], 2));
+
+  EXPECT_EQ(int64_t{-3600} * 1000000, value<int64_t>(*batch.children[7], 0));
+  EXPECT_EQ((int64_t{838} * 3600 + 59 * 60 + 59) * 1000000 + 1,
+            value<int64_t>(*batch.children[7], 2));
+
+  batch.release(&batch);
+  EXPECT_EQ(nullptr, batch.release);
+
+  // next batch starts from scratch
+  builder.append(Mutable_row(types, 10, 20u, 30.0, "xyz", "", "1969-12-31",
+                             "1969-12-31 23:59:59", "00:00:00"));
+
+  builder.export_batch(&batch);
+
+  EXPECT_EQ(1, batch.length);
+  EXPECT_EQ(nullptr, batch.children[0]->buffers[0]);
+  EXPECT_EQ(10, value<int64_t>(*batch.children[0], 0));
+  EXPECT_EQ("xyz", string(*batch.children[3], 0));
+  EXPECT_EQ(-1, value<int32_t>(*batch.children[5], 0));
+  EXPECT_EQ(-1000000, value<int64_t>(*batch.children[6], 0));
+
+  // consumer can move the children out, releasing them independently
+  ArrowArray child = *batch.children[3];
+  batch.children[3]->release = nullptr;
+  batch.release(&batch);
+  child.release(&child);
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
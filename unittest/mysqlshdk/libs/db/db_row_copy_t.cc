@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include <string>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/db/row_copy.h"
+
+namespace mysqlshdk {
+namespace db {
+
+TEST(Row_copy_test, mutable_row) {
+  Mutable_row row{{Type::Integer, Type::UInteger, Type::String, Type::Double,
+                   Type::Float, Type::Bytes, Type::Decimal}};
+
+  ASSERT_EQ(7, row.num_fields());
+
+  for (uint32_t i = 0; i < row.num_fields(); ++i) {
+    EXPECT_TRUE(row.is_null(i));
+  }
+
+  row.set_row_values(-5, 7u, "abc", 1.5, 2.5f, std::string{"\0x", 2},
+                     "12.34");
+
+  EXPECT_EQ(Type::String, row.get_type(2));
+  EXPECT_EQ(-5, row.get_int(0));
+  EXPECT_EQ(7, row.get_uint(1));
+  EXPECT_EQ(7, row.get_int(1));
+  EXPECT_EQ("abc", row.get_string(2));
+  EXPECT_DOUBLE_EQ(1.5, row.get_double(3));
+  EXPECT_FLOAT_EQ(2.5f, row.get_float(4));
+  EXPECT_EQ(std::string("\0x", 2), row.get_string(5));
+  EXPECT_EQ("12.34", row.get_as_string(6));
+  EXPECT_DOUBLE_EQ(12.34, row.get_double(6));
+
+  const auto data = row.get_string_data(2);
+  EXPECT_EQ("abc", std::string(data.first, data.second));
+
+  // values of different sizes, the following values are moved
+  row.set_field(2, std::string(1000, 'x'));
+  EXPECT_EQ(std::string(1000, 'x'), row.get_string(2));
+  EXPECT_DOUBLE_EQ(1.5, row.get_double(3));
+  EXPECT_EQ(std::string("\0x", 2), row.get_string(5));
+
+  row.set_field(2, "y");
+  EXPECT_EQ("y", row.get_string(2));
+  EXPECT_EQ("12.34", row.get_as_string(6));
+
+  row.set_field(2, nullptr);
+  EXPECT_TRUE(row.is_null(2));
+  EXPECT_EQ("NULL", row.get_as_string(2));
+  EXPECT_THROW(row.get_string(2), std::invalid_argument);
+  EXPECT_EQ(-5, row.get_int(0));
+  EXPECT_EQ(std::string("\0x", 2), row.get_string(5));
+
+  // double stored in a float field
+  row.set_field(4, 0.25);
+  EXPECT_FLOAT_EQ(0.25f, row.get_float(4));
+
+  EXPECT_THROW(row.set_field(0, "abc"), std::invalid_argument);
+  EXPECT_THROW(row.set_field(2, 1), std::invalid_argument);
+  EXPECT_THROW(row.get_int(2), std::invalid_argument);
+  EXPECT_THROW(row.get_string(0), std::invalid_argument);
+  EXPECT_THROW(row.is_null(7), std::invalid_argument);
+}
+
+TEST(Row_copy_test, add_field) {
+  Mutable_row row{{Type::Integer, Type::String}};
+  row.set_row_values(1, "two");
+
+  row.add_field(Type::String, 1);
+  row.add_field(Type::Integer);
+
+  ASSERT_EQ(4, row.num_fields());
+  EXPECT_EQ(Type::Integer, row.get_type(0));
+  EXPECT_EQ(Type::String, row.get_type(1));
+  EXPECT_EQ(Type::String, row.get_type(2));
+  EXPECT_EQ(Type::Integer, row.get_type(3));
+
+  EXPECT_EQ(1, row.get_int(0));
+  EXPECT_TRUE(row.is_null(1));
+  EXPECT_EQ("two", row.get_string(2));
+  EXPECT_TRUE(row.is_null(3));
+
+  row.set_field(1, "one and a half");
+  row.set_field(3, 3);
+  EXPECT_EQ("one and a half", row.get_string(1));
+  EXPECT_EQ("two", row.get_string(2));
+  EXPECT_EQ(3, row.get_int(3));
+
+  EXPECT_THROW(row.add_field(Type::Integer, 5), std::invalid_argument);
+}
+
+TEST(Row_copy_test, copy) {
+  Row_copy empty;
+  EXPECT_EQ(0, empty.num_fields());
+
+  Mutable_row source{{Type::Integer, Type::String, Type::Null, Type::Bytes}};
+  source.set_row_values(42, "text", nullptr, "");
+
+  Row_copy copy{source};
+  ASSERT_EQ(4, copy.num_fields());
+  EXPECT_EQ(42, copy.get_int(0));
+  EXPECT_EQ("text", copy.get_string(1));
+  EXPECT_TRUE(copy.is_null(2));
+  EXPECT_FALSE(copy.is_null(3));
+  EXPECT_EQ("", copy.get_string(3));
+
+  Row_copy moved = std::move(copy);
+  EXPECT_EQ("text", moved.get_string(1));
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
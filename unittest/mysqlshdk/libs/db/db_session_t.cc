@@ -21,6 +21,11 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/db/mysql/result.h"
+#include "mysqlshdk/libs/db/mysql/row_block.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -228,6 +233,204 @@ TEST_F(Db_tests, auto_close) {
   } while (switch_proto());
 }
 
+TEST_F(Db_tests, fetch_block) {
+  session->connect(shcore::get_connection_options(uri()));
+
+  const auto EXPECT_ROWS = [this](bool buffered) {
+    SCOPED_TRACE(buffered ? "buffered" : "unbuffered");
+
+    const auto result = session->query(
+        std::string{"WITH RECURSIVE t(n) AS (SELECT 1 UNION ALL SELECT n + 1 "
+                    "FROM t WHERE n < 2500) SELECT n, IF(n % 2, NULL, "
+                    "REPEAT('x', n % 7)) FROM t"},
+        buffered);
+    const auto classic = dynamic_cast<mysql::Result *>(result.get());
+    ASSERT_NE(nullptr, classic);
+
+    mysql::Row_block block{2, 1000};
+    std::vector<std::size_t> blocks;
+    int n = 0;
+
+    while (const auto rows = classic->fetch_block(&block)) {
+      blocks.emplace_back(rows);
+      EXPECT_EQ(rows, block.rows());
+
+      for (std::size_t i = 0; i < block.rows(); ++i) {
+        ++n;
+        EXPECT_EQ(std::to_string(n), block.get(i, 0));
+
+        if (n % 2) {
+          EXPECT_TRUE(block.is_null(i, 1));
+        } else {
+          EXPECT_FALSE(block.is_null(i, 1));
+          EXPECT_EQ(std::string(n % 7, 'x'), block.get(i, 1));
+          EXPECT_EQ(n % 7, block.lengths(i)[1]);
+        }
+      }
+
+      block.clear();
+    }
+
+    EXPECT_EQ(2500, n);
+    EXPECT_EQ((std::vector<std::size_t>{1000, 1000, 500}), blocks);
+    EXPECT_EQ(nullptr, result->fetch_one());
+  };
+
+  EXPECT_ROWS(false);
+  EXPECT_ROWS(true);
+
+  session->close();
+}
+
+TEST_F(Db_tests, prepared_statement_cache) {
+  const auto classic = mysql::Session::create();
+  classic->connect(shcore::get_connection_options(_mysql_uri));
+
+  const auto status = [&classic](const std::string &name) {
+    return std::stoull(
+        classic->query("SHOW SESSION STATUS LIKE 'Com_stmt_" + name + "'")
+            ->fetch_one_or_throw()
+            ->get_string(1));
+  };
+
+  classic->set_prepared_statement_cache_size(2);
+  EXPECT_TRUE(classic->prepared_statement_cache_enabled());
+
+  const auto prepared = status("prepare");
+  const auto executed = status("execute");
+
+  for (int i = 0; i < 3; ++i) {
+    const auto result = classic->queryf("SELECT ? + 1, ?, ?, ?", i, "abc",
+                                        nullptr, 1.5);
+    const auto row = result->fetch_one_or_throw();
+
+    EXPECT_EQ(i + 1, row->get_int(0));
+    EXPECT_EQ("abc", row->get_string(1));
+    EXPECT_TRUE(row->is_null(2));
+    EXPECT_DOUBLE_EQ(1.5, row->get_double(3));
+    EXPECT_EQ(nullptr, result->fetch_one());
+  }
+
+  // statement is prepared once
+  EXPECT_EQ(prepared + 1, status("prepare"));
+  EXPECT_EQ(executed + 3, status("execute"));
+
+  // identifiers cannot be bound, such templates are formatted
+  EXPECT_EQ(7, classic->queryf("SELECT ! FROM (SELECT 7 AS a) t", "a")
+                   ->fetch_one_or_throw()
+                   ->get_int(0));
+  EXPECT_EQ(prepared + 1, status("prepare"));
+
+  // values which do not fit in the initial buffer
+  EXPECT_EQ(1000, classic->queryf("SELECT REPEAT('x', ?)", 1000)
+                      ->fetch_one_or_throw()
+                      ->get_string(0)
+                      .length());
+
+  classic->executef("SET @a = ?", 5);
+  EXPECT_EQ(5, classic->queryf("SELECT @a")->fetch_one_or_throw()->get_int(0));
+
+  // errors are reported
+  EXPECT_THROW(classic->queryf("SELECT * FROM mysql.no_such_table WHERE a = ?",
+                               1),
+               mysqlshdk::db::Error);
+
+  // disabling the cache closes the statements
+  classic->set_prepared_statement_cache_size(0);
+  EXPECT_FALSE(classic->prepared_statement_cache_enabled());
+  EXPECT_EQ(0, classic->query("SELECT COUNT(*) FROM "
+                              "performance_schema.prepared_statements_instances"
+                              " WHERE OWNER_THREAD_ID = PS_CURRENT_THREAD_ID()")
+                   ->fetch_one_or_throw()
+                   ->get_int(0));
+
+  classic->close();
+}
+
+TEST_F(Db_tests, shared_result_metadata) {
+  const auto classic = mysql::Session::create();
+  classic->connect(shcore::get_connection_options(_mysql_uri));
+
+  const auto first = classic->query("SELECT 1 AS a, 'x' AS b");
+  const auto second = classic->query("SELECT 1 AS a, 'x' AS b");
+
+  // identical columns share the metadata
+  EXPECT_EQ(&first->get_metadata(), &second->get_metadata());
+  EXPECT_EQ(first->field_names(), second->field_names());
+  EXPECT_EQ(1, second->field_names()->field_index("b"));
+
+  // different labels result in different metadata
+  const auto third = classic->query("SELECT 1 AS a, 'x' AS c");
+  EXPECT_NE(&first->get_metadata(), &third->get_metadata());
+  EXPECT_NE(first->field_names(), third->field_names());
+  EXPECT_TRUE(third->field_names()->has_field("c"));
+
+  // different types result in different metadata
+  const auto fourth = classic->query("SELECT 1.5 AS a, 'x' AS b");
+  EXPECT_NE(&first->get_metadata(), &fourth->get_metadata());
+  EXPECT_EQ(mysqlshdk::db::Type::Decimal,
+            fourth->get_metadata()[0].get_type());
+
+  // duplicate labels are still reported
+  EXPECT_THROW(classic->query("SELECT 1 AS a, 2 AS a")->field_names(),
+               std::invalid_argument);
+
+  classic->close();
+}
+
+TEST_F(Db_tests, x_pipeline) {
+  const auto x = mysqlx::Session::create();
+  x->connect(shcore::get_connection_options(_uri));
+
+  x->execute("CREATE SCHEMA IF NOT EXISTS xtest");
+  x->execute("DROP TABLE IF EXISTS xtest.pipeline");
+  x->execute("CREATE TABLE xtest.pipeline (a INT PRIMARY KEY)");
+
+  // small window, replies are read while messages are being queued
+  x->start_pipeline(2);
+  EXPECT_TRUE(x->pipeline_active());
+
+  x->enqueue("INSERT INTO xtest.pipeline VALUES (1)");
+  x->enqueue("INSERT INTO xtest.pipeline VALUES (1)");
+  x->enqueue("INSERT INTO xtest.pipeline VALUES (2), (3)");
+  x->enqueue("SELECT COUNT(*) FROM xtest.pipeline");
+
+  // other statements cannot be executed while pipeline is active
+  EXPECT_THROW(x->execute("SELECT 1"), std::logic_error);
+
+  const auto results = x->flush_pipeline();
+  EXPECT_FALSE(x->pipeline_active());
+  ASSERT_EQ(4, results.size());
+
+  ASSERT_NE(nullptr, results[0].result);
+  EXPECT_FALSE(results[0].error.has_value());
+  EXPECT_EQ(1, results[0].result->get_affected_row_count());
+
+  // failed statement does not affect the following ones
+  EXPECT_EQ(nullptr, results[1].result);
+  ASSERT_TRUE(results[1].error.has_value());
+  EXPECT_EQ(1062, results[1].error->code());
+
+  ASSERT_NE(nullptr, results[2].result);
+  EXPECT_EQ(2, results[2].result->get_affected_row_count());
+
+  ASSERT_NE(nullptr, results[3].result);
+  EXPECT_EQ(3, results[3].result->fetch_one_or_throw()->get_int(0));
+
+  // session is usable once pipeline is flushed
+  EXPECT_EQ(3, x->query("SELECT COUNT(*) FROM xtest.pipeline")
+                   ->fetch_one_or_throw()
+                   ->get_int(0));
+
+  EXPECT_THROW(x->flush_pipeline(), std::logic_error);
+  EXPECT_THROW(x->enqueue("SELECT 1"), std::logic_error);
+
+  // closing the session discards the queued messages
+  x->start_pipeline();
+  x->enqueue("SELECT 1");
+  EXPECT_NO_THROW(x->close());
+}
+
 TEST_F(Db_tests, connect_read_timeout) {
   auto connection_options = shcore::get_connection_options(uri());
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2019, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -21,6 +21,9 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <limits>
+#include <string>
+
 #include "mysqlshdk/libs/mysql/clone.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -153,4 +156,69 @@ TEST_F(Clone_test, plugin_installation) {
   }
 }
 
+TEST_F(Clone_test, probe_clone_donor) {
+  using mysqlshdk::db::Type;
+
+  auto mock_session = std::make_shared<Mock_session>();
+  mysqlshdk::mysql::Instance instance{mock_session};
+
+  const std::string load_query =
+      "SELECT CAST(SUM(VARIABLE_VALUE) AS UNSIGNED) FROM "
+      "performance_schema.global_status WHERE VARIABLE_NAME IN "
+      "('Threads_running', 'Innodb_data_pending_reads', "
+      "'Innodb_data_pending_writes')";
+
+  // TEST: latency is sampled, load is summed by the server.
+  {
+    SCOPED_TRACE("latency is sampled, load is summed by the server.");
+
+    for (int i = 0; i < 3; ++i) {
+      mock_session->expect_query("SELECT 1")
+          .then_return({{"", {"1"}, {Type::Integer}, {{"1"}}}});
+    }
+
+    mock_session->expect_query(load_query).then_return(
+        {{"", {"load"}, {Type::UInteger}, {{"7"}}}});
+
+    const auto probe = mysqlshdk::mysql::probe_clone_donor(instance);
+
+    EXPECT_EQ(7, probe.load);
+    EXPECT_LE(0.0, probe.latency_ms);
+    EXPECT_GT(std::numeric_limits<double>::max(), probe.latency_ms);
+  }
+
+  // TEST: instance which cannot be probed is the worst candidate.
+  {
+    SCOPED_TRACE("instance which cannot be probed is the worst candidate.");
+
+    mock_session->expect_query("SELECT 1")
+        .then_throw("Lost connection to MySQL server during query", 2013);
+
+    const auto probe = mysqlshdk::mysql::probe_clone_donor(instance);
+
+    EXPECT_EQ(0, probe.load);
+    EXPECT_EQ(std::numeric_limits<double>::max(), probe.latency_ms);
+  }
+
+  // TEST: score prefers responsive donors with less load.
+  {
+    SCOPED_TRACE("score prefers responsive donors with less load.");
+
+    mysqlshdk::mysql::Clone_donor_probe idle;
+    idle.latency_ms = 1.0;
+    idle.load = 0;
+
+    mysqlshdk::mysql::Clone_donor_probe busy;
+    busy.latency_ms = 1.0;
+    busy.load = 10;
+
+    mysqlshdk::mysql::Clone_donor_probe slow;
+    slow.latency_ms = 20.0;
+    slow.load = 0;
+
+    EXPECT_LT(idle.score(), busy.score());
+    EXPECT_LT(busy.score(), slow.score());
+  }
+}
+
 }  // namespace testing
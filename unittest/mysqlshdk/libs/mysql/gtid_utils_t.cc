@@ -79,12 +79,8 @@ TEST_F(Gtid_utils, gtid_set_basics) {
 
   EXPECT_THROW(gs2_s.count(), std::invalid_argument);
 
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-  mysqlshdk::mysql::Instance server(session);
-
-  gs2_s.normalize(server);
-  gs6.normalize(server);
+  gs2_s.normalize();
+  gs6.normalize();
 
   EXPECT_EQ(gs2_r, gs2_s);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2_r.str());
@@ -109,32 +105,24 @@ TEST_F(Gtid_utils, gtid_set_basics) {
   EXPECT_FALSE(gs2.empty());
   EXPECT_EQ(43, gs2.count());
 
-  EXPECT_TRUE(gs2_r.contains(gs2_s, server));
-  EXPECT_TRUE(gs2_r.contains(gs2_s, server));
-  EXPECT_TRUE(gs2.contains(gs3, server));
-  EXPECT_FALSE(gs3.contains(gs2, server));
+  EXPECT_TRUE(gs2_r.contains(gs2_s));
+  EXPECT_TRUE(gs2_r.contains(gs2_s));
+  EXPECT_TRUE(gs2.contains(gs3));
+  EXPECT_FALSE(gs3.contains(gs2));
 
-  EXPECT_FALSE(gs2.contains(gs4, server));
-  EXPECT_FALSE(gs4.contains(gs2, server));
+  EXPECT_FALSE(gs2.contains(gs4));
+  EXPECT_FALSE(gs4.contains(gs2));
 
-  EXPECT_FALSE(gs2.contains(gs5, server));
-  EXPECT_FALSE(gs5.contains(gs2, server));
+  EXPECT_FALSE(gs2.contains(gs5));
+  EXPECT_FALSE(gs5.contains(gs2));
 
-  EXPECT_TRUE(gs6.contains(gs2, server));
-  EXPECT_TRUE(gs6.contains(gs5, server));
+  EXPECT_TRUE(gs6.contains(gs2));
+  EXPECT_TRUE(gs6.contains(gs5));
 
   EXPECT_EQ(50, gs6.count());
 }
 
 TEST_F(Gtid_utils, gtid_set_basics_tag_support) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-  mysqlshdk::mysql::Instance server(session);
-
-  if (server.get_version() < mysqlshdk::utils::Version(8, 3, 0)) {
-    return;
-  }
-
   Gtid_set gs1;
   Gtid_set gs2_r(
       Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", "tagA", 1, 43});
@@ -156,9 +144,9 @@ TEST_F(Gtid_utils, gtid_set_basics_tag_support) {
 
   EXPECT_THROW(gs2_s.count(), std::invalid_argument);
 
-  gs2_s.normalize(server);
-  gs6_taga.normalize(server);
-  gs6_tagb.normalize(server);
+  gs2_s.normalize();
+  gs6_taga.normalize();
+  gs6_tagb.normalize();
 
   EXPECT_EQ(gs2_r, gs2_s);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:taga:1-43", gs2_r.str());
@@ -177,34 +165,29 @@ TEST_F(Gtid_utils, gtid_set_basics_tag_support) {
   EXPECT_FALSE(gs2.empty());
   EXPECT_EQ(43, gs2.count());
 
-  EXPECT_TRUE(gs2_r.contains(gs2_s, server));
-  EXPECT_TRUE(gs2_r.contains(gs2_s, server));
-  EXPECT_TRUE(gs2.contains(gs3_taga, server));
-  EXPECT_FALSE(gs2.contains(gs3_tagb, server));
-  EXPECT_FALSE(gs3_taga.contains(gs2, server));
-  EXPECT_FALSE(gs3_tagb.contains(gs2, server));
+  EXPECT_TRUE(gs2_r.contains(gs2_s));
+  EXPECT_TRUE(gs2_r.contains(gs2_s));
+  EXPECT_TRUE(gs2.contains(gs3_taga));
+  EXPECT_FALSE(gs2.contains(gs3_tagb));
+  EXPECT_FALSE(gs3_taga.contains(gs2));
+  EXPECT_FALSE(gs3_tagb.contains(gs2));
 
-  EXPECT_FALSE(gs2.contains(gs4, server));
-  EXPECT_FALSE(gs4.contains(gs2, server));
+  EXPECT_FALSE(gs2.contains(gs4));
+  EXPECT_FALSE(gs4.contains(gs2));
 
-  EXPECT_FALSE(gs2.contains(gs5, server));
-  EXPECT_FALSE(gs5.contains(gs2, server));
+  EXPECT_FALSE(gs2.contains(gs5));
+  EXPECT_FALSE(gs5.contains(gs2));
 
-  EXPECT_TRUE(gs6_taga.contains(gs2, server));
-  EXPECT_TRUE(gs6_taga.contains(gs5, server));
-  EXPECT_FALSE(gs6_tagb.contains(gs2, server));
-  EXPECT_FALSE(gs6_tagb.contains(gs5, server));
+  EXPECT_TRUE(gs6_taga.contains(gs2));
+  EXPECT_TRUE(gs6_taga.contains(gs5));
+  EXPECT_FALSE(gs6_tagb.contains(gs2));
+  EXPECT_FALSE(gs6_tagb.contains(gs5));
 
   EXPECT_EQ(50, gs6_taga.count());
   EXPECT_EQ(50, gs6_tagb.count());
 }
 
 TEST_F(Gtid_utils, gtid_set_ops) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   Gtid_set gs1;
   Gtid_set gs2_r(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 1, 43});
   Gtid_set gs2_s(
@@ -223,7 +206,7 @@ TEST_F(Gtid_utils, gtid_set_ops) {
 
   gs2 = gs2_r;
   gs2.add(gs2_s);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
   gs2 = gs2_r;
@@ -239,28 +222,28 @@ TEST_F(Gtid_utils, gtid_set_ops) {
       },
       std::invalid_argument);
   EXPECT_THROW(gs2.count(), std::invalid_argument);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs4);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-44", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs5);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43:45-70", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs4);
   gs2.add(gs5);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-70", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs8);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "88888888-8803-11eb-af3d-a1178d81dccc:1-8,\n8b8dc2ba-8803-11eb-af3d-"
       "a1178d81dccc:1-43",
@@ -270,12 +253,12 @@ TEST_F(Gtid_utils, gtid_set_ops) {
   gs2.add(Gtid_range("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 99, 99));
   EXPECT_THROW({ [[maybe_unused]] bool x = gs1 == gs2; },
                std::invalid_argument);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43:99", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("9b8dc2ba-0000-11eb-af3d-a1178d81dccc", {}, 99, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43,\n9b8dc2ba-0000-11eb-af3d-"
       "a1178d81dccc:99",
@@ -283,7 +266,7 @@ TEST_F(Gtid_utils, gtid_set_ops) {
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("9b8dc2ba-0000-11eb-af3d-a1178d81dccc", {}, 10, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43,\n9b8dc2ba-0000-11eb-af3d-"
       "a1178d81dccc:10-99",
@@ -291,39 +274,31 @@ TEST_F(Gtid_utils, gtid_set_ops) {
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 10, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-99", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs1, server);
+  gs2.subtract(gs1);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs2, server);
+  gs2.subtract(gs2);
   EXPECT_EQ("", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs5, server);
+  gs2.subtract(gs5);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs3, server);
+  gs2.subtract(gs3);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:6-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs7, server);
+  gs2.subtract(gs7);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-9:21-43", gs2.str());
 }
 
 TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-  mysqlshdk::mysql::Instance server(session);
-
-  if (server.get_version() < mysqlshdk::utils::Version(8, 3, 0)) {
-    return;
-  }
-
   Gtid_set gs1;
   Gtid_set gs2_r(
       Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", "foo", 1, 43});
@@ -350,7 +325,7 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
 
   gs2 = gs2_r;
   gs2.add(gs2_s);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
@@ -362,33 +337,33 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
   EXPECT_THROW({ [[maybe_unused]] bool res = gs3_no_tag == gs2; },
                std::invalid_argument);
   EXPECT_THROW(gs2.count(), std::invalid_argument);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-5:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs4);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-44", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs5);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43:45-70", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs5_no_tag);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:45-70:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs4);
   gs2.add(gs5);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-70", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs8_no_tag);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "88888888-8803-11eb-af3d-a1178d81dccc:1-8,\n8b8dc2ba-8803-11eb-af3d-"
       "a1178d81dccc:foo:1-43",
@@ -396,7 +371,7 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
 
   gs2 = gs2_r;
   gs2.add(gs8);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "88888888-8803-11eb-af3d-a1178d81dccc:bar:1-8,\n8b8dc2ba-8803-11eb-af3d-"
       "a1178d81dccc:foo:1-43",
@@ -406,12 +381,12 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
   gs2.add(Gtid_range("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", "foo", 99, 99));
   EXPECT_THROW({ [[maybe_unused]] bool x = gs1 == gs2; },
                std::invalid_argument);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43:99", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("9b8dc2ba-0000-11eb-af3d-a1178d81dccc", "bar", 99, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43,\n9b8dc2ba-0000-11eb-af3d-"
       "a1178d81dccc:bar:99",
@@ -419,7 +394,7 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("9b8dc2ba-0000-11eb-af3d-a1178d81dccc", {}, 10, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43,\n9b8dc2ba-0000-11eb-af3d-"
       "a1178d81dccc:10-99",
@@ -427,36 +402,31 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", "foo", 10, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-99", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs1, server);
+  gs2.subtract(gs1);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs2, server);
+  gs2.subtract(gs2);
   EXPECT_EQ("", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs5, server);
+  gs2.subtract(gs5);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs3_no_tag, server);
+  gs2.subtract(gs3_no_tag);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs7, server);
+  gs2.subtract(gs7);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-9:21-43", gs2.str());
 }
 
 TEST_F(Gtid_utils, gtid_set_enumerate) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   Gtid_set gs1(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 1, 9});
   Gtid_set gs2(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 1, 1});
   Gtid_set gs3(
@@ -470,7 +440,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs1, result);
     EXPECT_EQ(gs1.count(), calls);
   }
@@ -481,13 +451,13 @@ TEST_F(Gtid_utils, gtid_set_enumerate) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs2.str(), result.str());
     EXPECT_EQ(gs2.count(), calls);
   }
 
   EXPECT_THROW(gs3.enumerate([&](const auto &) {}), std::invalid_argument);
-  gs3.normalize(server);
+  gs3.normalize();
 
   {
     int calls = 0;
@@ -496,21 +466,13 @@ TEST_F(Gtid_utils, gtid_set_enumerate) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs3.str(), result.str());
     EXPECT_EQ(gs3.count(), calls);
   }
 }
 
 TEST_F(Gtid_utils, gtid_set_enumerate_tag_support) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-  mysqlshdk::mysql::Instance server(session);
-
-  if (server.get_version() < mysqlshdk::utils::Version(8, 3, 0)) {
-    return;
-  }
-
   Gtid_set gs1(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", "foo", 1, 9});
   Gtid_set gs2(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", "bar", 1, 1});
   Gtid_set gs3(Gtid_set::from_string(
@@ -527,7 +489,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_tag_support) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs1, result);
     EXPECT_EQ(gs1.count(), calls);
   }
@@ -538,13 +500,13 @@ TEST_F(Gtid_utils, gtid_set_enumerate_tag_support) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs2.str(), result.str());
     EXPECT_EQ(gs2.count(), calls);
   }
 
   EXPECT_THROW(gs3.enumerate([&](const auto &) {}), std::invalid_argument);
-  gs3.normalize(server);
+  gs3.normalize();
 
   {
     int calls = 0;
@@ -553,13 +515,13 @@ TEST_F(Gtid_utils, gtid_set_enumerate_tag_support) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs3.str(), result.str());
     EXPECT_EQ(gs3.count(), calls);
   }
 
   EXPECT_THROW(gs4.enumerate([&](const auto &) {}), std::invalid_argument);
-  gs4.normalize(server);
+  gs4.normalize();
 
   {
     int calls = 0;
@@ -568,7 +530,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_tag_support) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:taga:30-40:tagb:1-20",
               result.str());
     EXPECT_EQ(gs4.count(), calls);
@@ -576,11 +538,6 @@ TEST_F(Gtid_utils, gtid_set_enumerate_tag_support) {
 }
 
 TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   Gtid_set gs1(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 1, 9});
   Gtid_set gs2(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 1, 1});
   Gtid_set gs3(
@@ -594,7 +551,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
       result.add(gtids);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs1, result);
     EXPECT_EQ(1, calls);
   }
@@ -605,14 +562,14 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
       result.add(gtids);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs2.str(), result.str());
     EXPECT_EQ(1, calls);
   }
 
   EXPECT_THROW(gs3.enumerate_ranges([&](const auto &) {}),
                std::invalid_argument);
-  gs3.normalize(server);
+  gs3.normalize();
 
   {
     int calls = 0;
@@ -623,7 +580,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
       ranges.push_back(gtids);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs3.str(), result.str());
     EXPECT_EQ(3, calls);
     EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", ranges[0].uuid_tag);
@@ -639,14 +596,6 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
 }
 
 TEST_F(Gtid_utils, gtid_set_enumerate_ranges_tag_support) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-  mysqlshdk::mysql::Instance server(session);
-
-  if (server.get_version() < mysqlshdk::utils::Version(8, 3, 0)) {
-    return;
-  }
-
   Gtid_set gs1(
       Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-9:20-30,"
                             "\n8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:13-17,"
@@ -654,7 +603,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges_tag_support) {
 
   EXPECT_THROW(gs1.enumerate_ranges([&](const auto &) {}),
                std::invalid_argument);
-  gs1.normalize(server);
+  gs1.normalize();
 
   {
     int calls = 0;
@@ -665,7 +614,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges_tag_support) {
       ranges.push_back(gtids);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs1.str(), result.str());
     EXPECT_EQ(4, calls);
     EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", ranges[0].uuid_tag);
@@ -684,21 +633,16 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges_tag_support) {
 }
 
 TEST_F(Gtid_utils, subtract_view_changes) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   auto gtid_set = Gtid_set::from_string(
       "ec32d2c0-d3f0-11eb-abf3-eb7171e21adc:1-79,\nec32e076-d3f0-11eb-abf3-"
       "eb7171e21adc:1-3,\nf37283fa-d3f0-11eb-84e6-06d82947e5a7:1-2");
 
-  gtid_set.normalize(server);
+  gtid_set.normalize();
 
   auto view_changes =
       gtid_set.get_gtids_from("f37283fa-d3f0-11eb-84e6-06d82947e5a7");
 
-  gtid_set.subtract(view_changes, server);
+  gtid_set.subtract(view_changes);
 
   EXPECT_EQ(
       "ec32d2c0-d3f0-11eb-abf3-eb7171e21adc:1-79,\nec32e076-d3f0-11eb-abf3-"
@@ -707,19 +651,11 @@ TEST_F(Gtid_utils, subtract_view_changes) {
 }
 
 TEST_F(Gtid_utils, subtract_view_changes_tag_support) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-  mysqlshdk::mysql::Instance server(session);
-
-  if (server.get_version() < mysqlshdk::utils::Version(8, 3, 0)) {
-    return;
-  }
-
   auto gtid_set = Gtid_set::from_string(
       "ec32e076-d3f0-11eb-abf3-eb7171e21adc:1-79,\nec32e076-d3f0-11eb-abf3-"
       "eb7171e21adc:foo:1-3,\nf37283fa-d3f0-11eb-84e6-06d82947e5a7:bar:1-2");
 
-  gtid_set.normalize(server);
+  gtid_set.normalize();
 
   EXPECT_EQ(
       "ec32e076-d3f0-11eb-abf3-eb7171e21adc:1-79,ec32e076-d3f0-11eb-abf3-"
@@ -746,5 +682,248 @@ TEST_F(Gtid_utils, subtract_view_changes_tag_support) {
               .str());
 }
 
+TEST_F(Gtid_utils, gtid_set_normalize) {
+  EXPECT_EQ("", Gtid_set::from_string("").normalize().str());
+  EXPECT_EQ("", Gtid_set::from_string(" ,\n").normalize().str());
+
+  // UUIDs and tags are sorted and lowercased, untagged GTIDs come first
+  EXPECT_EQ(
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-5:bar:3:foo:1-2,\n"
+      "9b8dc2ba-0000-11eb-af3d-a1178d81dccc:7",
+      Gtid_set::from_string("9B8DC2BA-0000-11EB-AF3D-A1178D81DCCC:7,"
+                            "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:FOO:2:1,"
+                            "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:bar:3,"
+                            "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:4-5:1-3")
+          .normalize()
+          .str());
+
+  // overlapping and adjacent ranges are merged
+  EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-20:30",
+            Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:"
+                                  "10-15:1-9:30:12-20:16")
+                .normalize()
+                .str());
+
+  EXPECT_THROW(Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc")
+                   .normalize(),
+               std::invalid_argument);
+  EXPECT_THROW(Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:0")
+                   .normalize(),
+               std::invalid_argument);
+  EXPECT_THROW(
+      Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:5-1")
+          .normalize(),
+      std::invalid_argument);
+  EXPECT_THROW(
+      Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-x")
+          .normalize(),
+      std::invalid_argument);
+  EXPECT_THROW(Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc::1")
+                   .normalize(),
+               std::invalid_argument);
+}
+
+TEST_F(Gtid_utils, gtid_set_intersect) {
+  const auto gs1 = Gtid_set::from_string(
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-10:20-30:foo:1-5,"
+      "9b8dc2ba-0000-11eb-af3d-a1178d81dccc:1-100");
+  const auto gs2 = Gtid_set::from_string(
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:5-25:foo:5-9:bar:1-5,"
+      "88888888-8803-11eb-af3d-a1178d81dccc:1-100");
+
+  EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:5-10:20-25:foo:5",
+            Gtid_set{gs1}.intersect(gs2).str());
+  EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:5-10:20-25:foo:5",
+            Gtid_set{gs2}.intersect(gs1).str());
+
+  EXPECT_EQ("", Gtid_set{gs1}.intersect(Gtid_set()).str());
+  EXPECT_EQ("", Gtid_set().intersect(gs1).str());
+  EXPECT_EQ(0, Gtid_set().intersect(gs1).count());
+
+  EXPECT_EQ("", Gtid_set{gs1}
+                    .intersect(Gtid_set::from_string(
+                        "88888888-8803-11eb-af3d-a1178d81dccc:1-100"))
+                    .str());
+
+  EXPECT_EQ(Gtid_set{gs1}.normalize(), Gtid_set{gs1}.intersect(gs1));
+}
+
+TEST_F(Gtid_utils, gtid_set_subtract_fragmented) {
+  auto gs1 = Gtid_set::from_string(
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-100:200-300,"
+      "9b8dc2ba-0000-11eb-af3d-a1178d81dccc:foo:1-10");
+
+  gs1.subtract(Gtid_set::from_string(
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1:10-20:50:90-210:250:300-400,"
+      "9b8dc2ba-0000-11eb-af3d-a1178d81dccc:1-10"));
+
+  EXPECT_EQ(
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:2-9:21-49:51-89:211-249:251-299,\n"
+      "9b8dc2ba-0000-11eb-af3d-a1178d81dccc:foo:1-10",
+      gs1.str());
+
+  gs1.subtract(Gtid_set::from_string(
+      "9b8dc2ba-0000-11eb-af3d-a1178d81dccc:FOO:1-10,"
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-1000"));
+  EXPECT_EQ("", gs1.str());
+  EXPECT_EQ(0, gs1.count());
+}
+
+TEST_F(Gtid_utils, gtid_set_contains) {
+  const auto gs1 = Gtid_set::from_string(
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-10:20-30:foo:1-5,"
+      "9b8dc2ba-0000-11eb-af3d-a1178d81dccc:1-100");
+
+  EXPECT_TRUE(gs1.contains(Gtid_set()));
+  EXPECT_TRUE(gs1.contains(gs1));
+  EXPECT_FALSE(Gtid_set().contains(gs1));
+
+  EXPECT_TRUE(gs1.contains(Gtid_set::from_string(
+      "9b8dc2ba-0000-11eb-af3d-a1178d81dccc:5:50-60,"
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:2-3:25:30:FOO:5")));
+
+  // ranges spanning a gap
+  EXPECT_FALSE(gs1.contains(
+      Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:10-20")));
+  EXPECT_FALSE(gs1.contains(
+      Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-11")));
+  // UUIDs or tags which aren't there
+  EXPECT_FALSE(gs1.contains(
+      Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:bar:1")));
+  EXPECT_FALSE(gs1.contains(
+      Gtid_set::from_string("88888888-8803-11eb-af3d-a1178d81dccc:1")));
+}
+
+TEST_F(Gtid_utils, gtid_set_interval_merging) {
+  const auto normalize = [](const std::string &gtid_set) {
+    return Gtid_set::from_string(gtid_set).normalize().str();
+  };
+  const std::string uuid = "8b8dc2ba-8803-11eb-af3d-a1178d81dccc";
+
+  // adjacent intervals
+  EXPECT_EQ(uuid + ":1-10", normalize(uuid + ":1-5:6-10"));
+  EXPECT_EQ(uuid + ":1-10", normalize(uuid + ":6-10:1-5"));
+  EXPECT_EQ(uuid + ":1-3", normalize(uuid + ":3:1:2"));
+  EXPECT_EQ(uuid + ":1-10", normalize(uuid + ":1-5," + uuid + ":6-10"));
+
+  // overlapping intervals
+  EXPECT_EQ(uuid + ":1-15", normalize(uuid + ":5-15:1-10"));
+  EXPECT_EQ(uuid + ":1-100", normalize(uuid + ":20-30:1-100:50"));
+  EXPECT_EQ(uuid + ":1-5", normalize(uuid + ":1-5:1-5"));
+  EXPECT_EQ(uuid + ":1-40", normalize(uuid + ":1-10:30-40:5-35"));
+
+  // n-n intervals are the same as single GTIDs
+  EXPECT_EQ(uuid + ":5", normalize(uuid + ":5-5"));
+  EXPECT_EQ(uuid + ":5-6", normalize(uuid + ":5-5:6-6"));
+  EXPECT_EQ(uuid + ":5:7", normalize(uuid + ":7-7:5-5"));
+  EXPECT_EQ(uuid + ":1-10", normalize(uuid + ":1-9:10-10"));
+
+  // intervals separated by a gap are not merged
+  EXPECT_EQ(uuid + ":1-5:7-10", normalize(uuid + ":7-10:1-5"));
+
+  // the maximum GNO
+  EXPECT_EQ(uuid + ":1-9223372036854775807",
+            normalize(uuid + ":9223372036854775807:1-9223372036854775806"));
+
+  // intervals are merged when a lazily added set is normalized
+  {
+    Gtid_set gtids(Gtid_range{uuid, {}, 1, 5});
+    gtids.add(Gtid_range{uuid, {}, 6, 6});
+    gtids.add(Gtid_range{uuid, {}, 4, 20});
+    gtids.add(Gtid_range{uuid, {}, 22, 22});
+    EXPECT_EQ(uuid + ":1-20:22", gtids.normalize().str());
+    EXPECT_EQ(21, gtids.count());
+  }
+}
+
+TEST_F(Gtid_utils, gtid_set_tagged_gtids) {
+  const auto normalize = [](const std::string &gtid_set) {
+    return Gtid_set::from_string(gtid_set).normalize().str();
+  };
+  const std::string uuid = "8b8dc2ba-8803-11eb-af3d-a1178d81dccc";
+
+  // intervals are merged per tag, tags are case insensitive
+  EXPECT_EQ(uuid + ":foo:1-10", normalize(uuid + ":foo:1-5:FOO:6-10"));
+  EXPECT_EQ(uuid + ":foo:1-6",
+            normalize(uuid + ":foo:4-6," + uuid + ":Foo:1-3"));
+  EXPECT_EQ(uuid + ":1-5:foo:1-10",
+            normalize(uuid + ":foo:6-10:1-5," + uuid + ":1-5"));
+
+  // untagged and tagged GTIDs are not merged
+  EXPECT_EQ(uuid + ":1-5:foo:6-10", normalize(uuid + ":1-5:foo:6-10"));
+  EXPECT_EQ(uuid + ":1-5:foo:6-10",
+            normalize(uuid + ":foo:6-10," + uuid + ":1-5"));
+
+  // all kinds of valid tags
+  EXPECT_EQ(uuid + ":_:1:a_1:2:abcdefghijklmnopqrstuvwxyz_01234:3",
+            normalize(uuid +
+                      ":A_1:2:ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234:3:_:1"));
+
+  // tag without any intervals is ignored
+  EXPECT_EQ(uuid + ":bar:1", normalize(uuid + ":foo:bar:1"));
+  EXPECT_EQ(uuid + ":bar:1", normalize(uuid + ":bar:1:foo"));
+
+  auto gtids = Gtid_set::from_string(uuid + ":1-10:foo:1-10:bar:1-10");
+  EXPECT_EQ(30, gtids.normalize().count());
+
+  gtids.subtract(Gtid_set::from_string(uuid + ":FOO:5-6:bar:1-10"));
+  EXPECT_EQ(uuid + ":1-10:foo:1-4:7-10", gtids.str());
+  EXPECT_EQ(18, gtids.count());
+
+  EXPECT_TRUE(gtids.contains(Gtid_set::from_string(uuid + ":foo:1-2:8")));
+  EXPECT_FALSE(gtids.contains(Gtid_set::from_string(uuid + ":foo:5")));
+  EXPECT_FALSE(gtids.contains(Gtid_set::from_string(uuid + ":bar:1")));
+
+  EXPECT_EQ(uuid + ":foo:3-4:7", Gtid_set{gtids}
+                                     .intersect(Gtid_set::from_string(
+                                         uuid + ":11-20:foo:3-7:baz:1-10"))
+                                     .str());
+}
+
+TEST_F(Gtid_utils, gtid_set_malformed) {
+  const std::string uuid = "8b8dc2ba-8803-11eb-af3d-a1178d81dccc";
+
+  for (const auto &gtid_set : {
+           // missing intervals
+           uuid,
+           uuid + ":",
+           uuid + ":1-5:",
+           uuid + "::1",
+           uuid + ":1,2",
+           // missing UUID
+           std::string{":1-5"},
+           // invalid intervals
+           uuid + ":0",
+           uuid + ":0-5",
+           uuid + ":5-1",
+           uuid + ":1-",
+           uuid + ":-5",
+           uuid + ":1-2-3",
+           uuid + ":1-x",
+           uuid + ":9223372036854775808",
+           // invalid tags
+           uuid + ":foo-bar:1",
+           uuid + ":1foo:1",
+           uuid + ":f#o:1",
+           uuid + ":abcdefghijklmnopqrstuvwxyz_012345:1",
+       }) {
+    SCOPED_TRACE(gtid_set);
+
+    EXPECT_THROW_LIKE(Gtid_set::from_string(gtid_set).normalize(),
+                      std::invalid_argument,
+                      "Invalid GTID set: '" + gtid_set + "'");
+
+    // operations report malformed sets too
+    const auto valid = Gtid_set::from_string(uuid + ":1-10");
+
+    EXPECT_THROW(Gtid_set{valid}.subtract(Gtid_set::from_string(gtid_set)),
+                 std::invalid_argument);
+    EXPECT_THROW(Gtid_set{valid}.intersect(Gtid_set::from_string(gtid_set)),
+                 std::invalid_argument);
+    EXPECT_THROW(valid.contains(Gtid_set::from_string(gtid_set)),
+                 std::invalid_argument);
+  }
+}
+
 }  // namespace mysql
 }  // namespace mysqlshdk
@@ -20,6 +20,8 @@
  51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA */
 
 #include <optional>
+#include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/utils/utils_time.h"
 #include "unittest/mysqlshdk/libs/oci/oci_tests.h"
@@ -51,6 +53,30 @@ TEST_F(Oci_os_tests, bucket_create_and_delete) {
   EXPECT_TRUE(objects.empty());
 }
 
+TEST_F(Oci_os_tests, bucket_concurrent_head_and_delete) {
+  SKIP_IF_NO_OCI_CONFIGURATION;
+
+  Oci_bucket bucket(get_config());
+  std::vector<std::string> names;
+  std::vector<size_t> expected;
+
+  for (int i = 0; i < 40; ++i) {
+    const auto data = std::string(i, 'x');
+    names.emplace_back("sample" + std::to_string(i) + ".txt");
+    expected.emplace_back(data.size());
+    bucket.put_object(names.back(), data.c_str(), data.size());
+  }
+
+  EXPECT_EQ(expected, bucket.head_objects(names));
+
+  bucket.delete_objects(names);
+  EXPECT_TRUE(bucket.list_objects().empty());
+
+  // errors are reported by the synchronous fallback
+  EXPECT_THROW_LIKE(bucket.head_objects({"sample.txt"}), Response_error,
+                    "Failed to get summary for object 'sample.txt': Not Found");
+}
+
 TEST_F(Oci_os_tests, bucket_list_objects) {
   SKIP_IF_NO_OCI_CONFIGURATION;
 
@@ -121,6 +147,47 @@ TEST_F(Oci_os_tests, bucket_list_objects) {
   clean_bucket(bucket);
 }
 
+TEST_F(Oci_os_tests, bucket_list_objects_range) {
+  SKIP_IF_NO_OCI_CONFIGURATION;
+
+  Oci_bucket bucket(get_config());
+
+  create_objects(bucket);
+
+  const auto names = [](const std::vector<Object_details> &objects) {
+    std::vector<std::string> result;
+
+    for (const auto &object : objects) {
+      result.emplace_back(object.name);
+    }
+
+    return result;
+  };
+
+  // no bounds: everything
+  EXPECT_EQ(m_objects, names(bucket.list_objects_range("", "", "")));
+
+  // lower bound is exclusive, upper bound is inclusive
+  EXPECT_EQ(std::vector<std::string>(m_objects.begin() + 2,
+                                     m_objects.begin() + 5),
+            names(bucket.list_objects_range("", m_objects[1], m_objects[4])));
+
+  // only lower bound
+  EXPECT_EQ(std::vector<std::string>(m_objects.begin() + 5, m_objects.end()),
+            names(bucket.list_objects_range("", m_objects[4], "")));
+
+  // only upper bound
+  EXPECT_EQ(std::vector<std::string>(m_objects.begin(), m_objects.begin() + 1),
+            names(bucket.list_objects_range("", "", m_objects[0])));
+
+  // not recursive, with prefix
+  EXPECT_EQ((std::vector<std::string>{"sakila/address.csv",
+                                      "sakila/address_metadata.txt"}),
+            names(bucket.list_objects_range("sakila/", "sakila/actor.csv",
+                                            "sakila/address_metadata.txt",
+                                            false)));
+}
+
 TEST_F(Oci_os_tests, bucket_multipart_uploads) {
   SKIP_IF_NO_OCI_CONFIGURATION;
 
@@ -225,6 +225,49 @@ TEST_F(Oci_os_tests, file_write_multipart_upload) {
   bucket.delete_object("test/sample\".txt");
 }
 
+TEST_F(Oci_os_tests, file_write_background_uploads) {
+  SKIP_IF_NO_OCI_CONFIGURATION;
+
+  auto config = get_config();
+  config->set_part_size(3);
+  config->set_upload_concurrency(3);
+  Oci_bucket bucket(config);
+  Directory root(config, "test");
+
+  auto file = root.file("background.txt");
+
+  // each part has different contents, parts need to be committed in order
+  std::string data;
+
+  for (int i = 0; i < 40; ++i) {
+    data += std::to_string(i) + ",";
+  }
+
+  size_t offset = 0;
+
+  file->open(Mode::WRITE);
+
+  while (offset < data.size()) {
+    offset += file->write(data.data() + offset,
+                          std::min<size_t>(5, data.size() - offset));
+  }
+
+  // close() waits for all the parts and commits them in order
+  file->close();
+  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+
+  file->open(Mode::READ);
+  std::string buffer;
+  buffer.resize(data.size() + 5);
+  size_t read = file->read(buffer.data(), buffer.size());
+  EXPECT_EQ(data.size(), read);
+  buffer.resize(read);
+  EXPECT_EQ(data, buffer);
+  file->close();
+
+  bucket.delete_object("test/background.txt");
+}
+
 TEST_F(Oci_os_tests, file_append_new_file) {
   SKIP_IF_NO_OCI_CONFIGURATION;
 
@@ -368,6 +411,54 @@ TEST_F(Oci_os_tests, file_write_multipart_errors) {
   EXPECT_NO_THROW(file->close());
 }
 
+TEST_F(Oci_os_tests, file_write_background_upload_errors) {
+  SKIP_IF_NO_OCI_CONFIGURATION;
+
+  auto config = get_config();
+  config->set_part_size(3);
+  config->set_upload_concurrency(2);
+  Oci_bucket bucket(config);
+  Directory root(config);
+  auto mpo1 = bucket.create_multipart_upload("sample.txt");
+  auto file = root.file("sample.txt");
+
+  file->open(Mode::APPEND);
+
+  bucket.abort_multipart_upload(mpo1);
+
+  // part is uploaded in the background, write does not wait for it
+  EXPECT_NO_THROW(file->write("67890", 5));
+
+  // error is reported once the writer waits for the part
+  EXPECT_THROW_LIKE(
+      file->close(), shcore::Exception,
+      "Failed to upload part 1 for object 'sample.txt': No such upload (404)");
+  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+
+  // close has failed and file state has been reset, there's not going to be
+  // any more communication with the server
+  EXPECT_NO_THROW(file->close());
+
+  // error is reported by write, once it needs to wait for the failed part
+  mpo1 = bucket.create_multipart_upload("sample.txt");
+  file->open(Mode::APPEND);
+
+  bucket.abort_multipart_upload(mpo1);
+
+  const auto write_parts = [&file]() {
+    // last write schedules the third part, waits for the first one
+    for (int i = 0; i < 4; ++i) {
+      file->write("678", 3);
+    }
+  };
+
+  EXPECT_THROW_LIKE(
+      write_parts(), shcore::Exception,
+      "Failed to upload part 1 for object 'sample.txt': No such upload (404)");
+  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+  EXPECT_NO_THROW(file->close());
+}
+
 TEST_F(Oci_os_tests, file_writing) {
   SKIP_IF_NO_OCI_CONFIGURATION;
 
@@ -21,6 +21,10 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "unittest/gtest_clean.h"
 
 // hack to workaround antlr4 trying to include Token.h but getting token.h from
@@ -132,5 +136,39 @@ DELIMITER ;
                Sql_syntax_error);
 }
 
+TEST(MysqlParserUtils, check_syntax_reuse) {
+  // parser is reused by subsequent calls, an error must not affect them
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_THROW(check_sql_syntax("select from where"), Sql_syntax_error);
+    EXPECT_NO_THROW(check_sql_syntax("select 1 from dual where 1 = 1"));
+    EXPECT_THROW(check_sql_syntax("create table rows (a int)"),
+                 Sql_syntax_error);
+    EXPECT_NO_THROW(
+        check_sql_syntax("create table `rows` (a int primary key)"));
+  }
+
+  // each thread uses its own parser
+  std::vector<std::thread> threads;
+  std::atomic<int> failures{0};
+
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&failures]() {
+      for (int j = 0; j < 50; ++j) {
+        try {
+          check_sql_syntax("select a, b from t where c in (select d from e)");
+        } catch (...) {
+          ++failures;
+        }
+      }
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(0, failures);
+}
+
 }  // namespace parser
 }  // namespace mysqlshdk
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/rest/concurrency_limiter.h"
+
+namespace mysqlshdk {
+namespace rest {
+namespace {
+
+using Outcome = Concurrency_limiter::Outcome;
+
+TEST(Concurrency_limiter_test, additive_increase) {
+  Concurrency_limiter limiter{4, 1, 5};
+  std::vector<Concurrency_limiter::Permit> permits;
+
+  for (int i = 0; i < 4; ++i) {
+    permits.emplace_back(limiter.acquire());
+  }
+
+  EXPECT_EQ(4, limiter.in_flight());
+
+  // limit is reached, each success increases it by 1/limit
+  permits[0].release(Outcome::SUCCESS);
+  EXPECT_DOUBLE_EQ(4.25, limiter.limit());
+  EXPECT_EQ(3, limiter.in_flight());
+
+  // other errors do not change the limit
+  permits[1].release(Outcome::OTHER);
+  EXPECT_DOUBLE_EQ(4.25, limiter.limit());
+
+  // permit which was already released is not released again
+  permits[1].release(Outcome::SUCCESS);
+  EXPECT_EQ(2, limiter.in_flight());
+
+  // limit is not reached, successes do not increase it
+  permits.clear();
+  EXPECT_DOUBLE_EQ(4.25, limiter.limit());
+  EXPECT_EQ(0, limiter.in_flight());
+
+  // limit does not exceed the maximum
+  for (int i = 0; i < 100; ++i) {
+    std::vector<Concurrency_limiter::Permit> batch;
+
+    for (int j = 0; j < static_cast<int>(limiter.limit()); ++j) {
+      batch.emplace_back(limiter.acquire());
+    }
+
+    for (auto &permit : batch) {
+      permit.release(Outcome::SUCCESS);
+    }
+  }
+
+  EXPECT_DOUBLE_EQ(5, limiter.limit());
+}
+
+TEST(Concurrency_limiter_test, multiplicative_decrease) {
+  Concurrency_limiter limiter{100, 2, 100};
+  std::vector<Concurrency_limiter::Permit> permits;
+
+  for (int i = 0; i < 16; ++i) {
+    permits.emplace_back(limiter.acquire());
+  }
+
+  // limit is decreased based on the number of requests in flight
+  permits[0].release(Outcome::THROTTLED);
+  EXPECT_DOUBLE_EQ(8, limiter.limit());
+
+  // requests started before the decrease do not decrease the limit again
+  permits[1].release(Outcome::THROTTLED);
+  permits[2].release(Outcome::THROTTLED);
+  EXPECT_DOUBLE_EQ(8, limiter.limit());
+
+  permits.clear();
+
+  // new requests do
+  for (int i = 0; i < 2; ++i) {
+    auto permit = limiter.acquire();
+    permit.release(Outcome::THROTTLED);
+  }
+
+  // limit does not go below the minimum
+  EXPECT_DOUBLE_EQ(2, limiter.limit());
+}
+
+TEST(Concurrency_limiter_test, acquire_waits) {
+  Concurrency_limiter limiter{1, 1, 1};
+  auto permit = limiter.acquire();
+  std::atomic<bool> acquired{false};
+
+  std::thread thread{[&]() {
+    auto p = limiter.acquire();
+    acquired = true;
+  }};
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_FALSE(acquired);
+
+  permit.release(Outcome::SUCCESS);
+  thread.join();
+
+  EXPECT_TRUE(acquired);
+  EXPECT_EQ(0, limiter.in_flight());
+}
+
+}  // namespace
+}  // namespace rest
+}  // namespace mysqlshdk
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "unittest/gprod_clean.h"
+#include "unittest/gtest_clean.h"
+
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/checksummed_file.h"
+#include "mysqlshdk/libs/utils/crc32c.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace tests {
+
+using backend::Memory_file;
+
+namespace {
+
+std::unique_ptr<Checksummed_file> reader(const std::string &contents,
+                                         uint32_t expected) {
+  auto memfile = std::make_unique<Memory_file>("data");
+  memfile->set_content(contents);
+  return std::make_unique<Checksummed_file>(std::move(memfile), expected);
+}
+
+std::string read_all(IFile *file, std::size_t buffer_size) {
+  std::string result;
+  std::string buffer;
+  buffer.resize(buffer_size);
+
+  for (auto bytes = file->read(buffer.data(), buffer.size()); bytes > 0;
+       bytes = file->read(buffer.data(), buffer.size())) {
+    result.append(buffer.data(), bytes);
+  }
+
+  return result;
+}
+
+}  // namespace
+
+TEST(Checksummed_file_test, write) {
+  const std::string data = "The quick brown fox jumps over the lazy dog";
+  auto memfile = std::make_unique<Memory_file>("data");
+  const auto memfile_ptr = memfile.get();
+  Checksummed_file file{std::move(memfile)};
+
+  EXPECT_FALSE(file.checksum().has_value());
+
+  file.open(Mode::WRITE);
+  file.write(data.data(), 10);
+  file.write(data.data() + 10, data.size() - 10);
+  file.close();
+
+  EXPECT_EQ(data, memfile_ptr->content());
+  ASSERT_TRUE(file.checksum().has_value());
+  EXPECT_EQ(utils::crc32c(data.data(), data.size()), *file.checksum());
+
+  // checksum is not known if data was not written sequentially
+  file.open(Mode::WRITE);
+  file.write(data.data(), data.size());
+  file.seek(1);
+  EXPECT_FALSE(file.checksum().has_value());
+  file.close();
+}
+
+TEST(Checksummed_file_test, read) {
+  const std::string data(100000, 'x');
+  const auto crc = utils::crc32c(data.data(), data.size());
+
+  {
+    SCOPED_TRACE("valid");
+    const auto file = reader(data, crc);
+    file->open(Mode::READ);
+    EXPECT_EQ(data, read_all(file.get(), 4096));
+    EXPECT_NO_THROW(file->close());
+  }
+
+  {
+    SCOPED_TRACE("corrupted, detected at the end of file");
+    auto corrupted = data;
+    corrupted[5000] = 'y';
+    const auto file = reader(corrupted, crc);
+    file->open(Mode::READ);
+    EXPECT_THROW(read_all(file.get(), 4096), std::runtime_error);
+    file->close();
+  }
+
+  {
+    SCOPED_TRACE("corrupted, detected when closing a fully read file");
+    auto corrupted = data;
+    corrupted[5000] = 'y';
+    const auto file = reader(corrupted, crc);
+    std::string buffer;
+    buffer.resize(data.size());
+    file->open(Mode::READ);
+    EXPECT_EQ(data.size(), file->read(buffer.data(), buffer.size()));
+    EXPECT_THROW(file->close(), std::runtime_error);
+  }
+
+  {
+    SCOPED_TRACE("partially read file is not verified");
+    const auto file = reader(data, crc + 1);
+    std::string buffer;
+    buffer.resize(100);
+    file->open(Mode::READ);
+    EXPECT_EQ(100, file->read(buffer.data(), buffer.size()));
+    EXPECT_NO_THROW(file->close());
+  }
+
+  {
+    SCOPED_TRACE("file which was not read sequentially is not verified");
+    const auto file = reader(data, crc + 1);
+    file->open(Mode::READ);
+    file->seek(10);
+    EXPECT_EQ(data.substr(10), read_all(file.get(), 4096));
+    EXPECT_NO_THROW(file->close());
+  }
+}
+
+}  // namespace tests
+}  // namespace storage
+}  // namespace mysqlshdk
@@ -25,11 +25,13 @@
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/shell_test_env.h"
 
+#include <zlib.h>
 #include <memory>
 #include <random>
 #include <utility>
 #include "mysqlshdk/libs/storage/backend/memory_file.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 
 namespace mysqlshdk {
@@ -180,8 +182,9 @@ class Compression
     }
   }
 
-  void compress_decompress(const std::string &input_data,
-                           mysqlshdk::storage::Compression ctype) {
+  void compress_decompress(
+      const std::string &input_data, mysqlshdk::storage::Compression ctype,
+      const mysqlshdk::storage::Compression_options &options = {}) {
     using Memory_file = mysqlshdk::storage::backend::Memory_file;
     using Mode = mysqlshdk::storage::Mode;
 
@@ -198,8 +201,8 @@ class Compression
     compress_storage = make_output_file();
 
     auto compress_storage_ptr = compress_storage.get();
-    auto compress =
-        mysqlshdk::storage::make_file(std::move(compress_storage), ctype);
+    auto compress = mysqlshdk::storage::make_file(std::move(compress_storage),
+                                                  ctype, options);
 
 #ifdef _WIN32
     if (std::get<1>(GetParam()) == "required") {
@@ -248,6 +251,14 @@ class Compression
         EXPECT_EQ(static_cast<std::string::value_type>(0xfd), header[3]);
         break;
 
+      case mysqlshdk::storage::Compression::LZ4:
+        // is lz4? (lz4 frame header startswith "\x04\x22\x4d\x18")
+        EXPECT_EQ(static_cast<std::string::value_type>(0x04), header[0]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x22), header[1]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x4d), header[2]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x18), header[3]);
+        break;
+
       case mysqlshdk::storage::Compression::NONE:
         break;
     }
@@ -313,6 +324,501 @@ TEST_P(Compression, binary_data) {
   }
 }
 
+TEST_P(Compression, compression_options) {
+  Generate_text g;
+  const auto input_text = g.bytes(4 * 1024 * 1024);
+
+  for (const auto level : {1, 3, 9}) {
+    for (const auto threads : {0, 1, 4}) {
+      SCOPED_TRACE("level: " + std::to_string(level) +
+                   ", threads: " + std::to_string(threads));
+
+      Compression_options options;
+      options.level = level;
+      options.threads = threads;
+
+      compress_decompress(input_text, std::get<0>(GetParam()), options);
+    }
+  }
+}
+
+TEST(Compression_options, to_compression) {
+  {
+    Compression_options options;
+    EXPECT_EQ(mysqlshdk::storage::Compression::ZSTD,
+              to_compression("zstd", &options));
+    EXPECT_FALSE(options.level.has_value());
+  }
+
+  {
+    Compression_options options;
+    EXPECT_EQ(mysqlshdk::storage::Compression::ZSTD,
+              to_compression("zstd;level=9", &options));
+    EXPECT_EQ(9, options.level.value_or(0));
+  }
+
+  {
+    Compression_options options;
+    EXPECT_EQ(mysqlshdk::storage::Compression::GZIP,
+              to_compression("gzip; level = 6 ;", &options));
+    EXPECT_EQ(6, options.level.value_or(0));
+  }
+
+  {
+    Compression_options options;
+    EXPECT_EQ(mysqlshdk::storage::Compression::LZ4,
+              to_compression("lz4;level=12", &options));
+    EXPECT_EQ(12, options.level.value_or(0));
+  }
+
+  {
+    Compression_options options;
+    EXPECT_EQ(mysqlshdk::storage::Compression::ZSTD,
+              to_compression("zstd;level=auto", &options));
+    EXPECT_FALSE(options.level.has_value());
+    ASSERT_NE(nullptr, options.level_tuner);
+    EXPECT_EQ(1, options.level_tuner->level());
+    EXPECT_EQ(1, options.level_tuner->min_level());
+    EXPECT_EQ(9, options.level_tuner->max_level());
+  }
+
+  {
+    Compression_options options;
+    EXPECT_THROW(to_compression("zstd;level=0", &options),
+                 std::invalid_argument);
+    EXPECT_THROW(to_compression("zstd;level=100", &options),
+                 std::invalid_argument);
+    EXPECT_THROW(to_compression("gzip;level=10", &options),
+                 std::invalid_argument);
+    EXPECT_THROW(to_compression("lz4;level=13", &options),
+                 std::invalid_argument);
+    EXPECT_THROW(to_compression("zstd;level=", &options),
+                 std::invalid_argument);
+    EXPECT_THROW(to_compression("zstd;level=1x", &options),
+                 std::invalid_argument);
+    EXPECT_THROW(to_compression("zstd;speed=1", &options),
+                 std::invalid_argument);
+    EXPECT_THROW(to_compression("gzip;level=auto", &options),
+                 std::invalid_argument);
+    EXPECT_THROW(to_compression("lz4;level=auto", &options),
+                 std::invalid_argument);
+    EXPECT_THROW(to_compression("none;level=1", &options),
+                 std::invalid_argument);
+    EXPECT_THROW(to_compression("lzma;level=1", &options),
+                 std::invalid_argument);
+  }
+}
+
+TEST(Compression_options, level_tuner) {
+  using mysqlshdk::storage::Compression_level_tuner;
+  using std::chrono::milliseconds;
+
+  Compression_level_tuner tuner{1, 3, 2};
+  EXPECT_EQ(2, tuner.level());
+
+  // not enough samples
+  tuner.report(milliseconds(10), milliseconds(500));
+  EXPECT_EQ(2, tuner.level());
+
+  // writes are the bottleneck
+  tuner.report(milliseconds(10), milliseconds(500));
+  EXPECT_EQ(3, tuner.level());
+
+  // upper bound
+  tuner.report(milliseconds(100), milliseconds(1000));
+  EXPECT_EQ(3, tuner.level());
+
+  // compression and writes take similar time
+  tuner.report(milliseconds(400), milliseconds(600));
+  EXPECT_EQ(3, tuner.level());
+
+  // compression is the bottleneck
+  tuner.report(milliseconds(800), milliseconds(200));
+  EXPECT_EQ(2, tuner.level());
+
+  tuner.report(milliseconds(1000), milliseconds(0));
+  EXPECT_EQ(1, tuner.level());
+
+  // lower bound
+  tuner.report(milliseconds(1000), milliseconds(0));
+  EXPECT_EQ(1, tuner.level());
+}
+
+TEST(Compression_options, zstd_dictionary) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+  using Mode = mysqlshdk::storage::Mode;
+
+  Generate_text g;
+  std::string samples;
+  std::vector<std::size_t> sample_sizes;
+
+  for (int i = 0; i < 2000; ++i) {
+    const auto sample = g.words(20) + "\n";
+    samples += sample;
+    sample_sizes.emplace_back(sample.size());
+  }
+
+  EXPECT_TRUE(compression::train_zstd_dictionary("", {}, 1024).empty());
+
+  const auto dictionary =
+      compression::train_zstd_dictionary(samples, sample_sizes, 4096);
+  ASSERT_FALSE(dictionary.empty());
+  EXPECT_GE(4096, dictionary.size());
+
+  Compression_options options;
+  options.dictionary = std::make_shared<const std::string>(dictionary);
+
+  const auto input_data = g.words(20);
+
+  const auto compress = [&input_data](const Compression_options &o) {
+    auto memfile = std::make_unique<Memory_file>("");
+    const auto memfile_ptr = memfile.get();
+    auto file = make_file(std::move(memfile),
+                          mysqlshdk::storage::Compression::ZSTD, o);
+
+    file->open(Mode::WRITE);
+    file->write(input_data.data(), input_data.size());
+    file->close();
+
+    return memfile_ptr->content();
+  };
+
+  const auto plain = compress({});
+  const auto with_dictionary = compress(options);
+
+  EXPECT_GT(plain.size(), with_dictionary.size());
+
+  {
+    auto memfile = std::make_unique<Memory_file>("");
+    memfile->set_content(with_dictionary);
+    auto file = make_file(std::move(memfile),
+                          mysqlshdk::storage::Compression::ZSTD, options);
+
+    std::string buffer;
+    buffer.resize(input_data.size() + 1);
+
+    file->open(Mode::READ);
+    EXPECT_EQ(static_cast<ssize_t>(input_data.size()),
+              file->read(&buffer[0], buffer.size()));
+    file->close();
+
+    buffer.resize(input_data.size());
+    EXPECT_EQ(input_data, buffer);
+  }
+}
+
+TEST(Compression_options, zstd_frames) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+  using Mode = mysqlshdk::storage::Mode;
+
+  Generate_text g;
+  std::vector<std::string> parts;
+  std::string input_data;
+
+  for (int i = 0; i < 4; ++i) {
+    parts.emplace_back(g.words(2000));
+    input_data += parts.back();
+  }
+
+  std::vector<Compressed_file::Frame> frames;
+  std::string compressed;
+
+  {
+    auto memfile = std::make_unique<Memory_file>("");
+    const auto memfile_ptr = memfile.get();
+    auto file = make_file(std::move(memfile),
+                          mysqlshdk::storage::Compression::ZSTD);
+    const auto zstd = dynamic_cast<Compressed_file *>(file.get());
+    ASSERT_NE(nullptr, zstd);
+    EXPECT_TRUE(zstd->supports_frames());
+
+    uint64_t compressed_offset = 0;
+    uint64_t offset = 0;
+
+    file->open(Mode::WRITE);
+
+    for (const auto &part : parts) {
+      if (offset) {
+        frames.push_back({compressed_offset, offset});
+      }
+
+      file->write(part.data(), part.size());
+      compressed_offset += zstd->latest_io_size();
+      zstd->end_frame();
+      compressed_offset += zstd->latest_io_size();
+      offset += part.size();
+    }
+
+    file->close();
+
+    compressed = memfile_ptr->content();
+    EXPECT_LE(compressed_offset, compressed.size());
+  }
+
+  const auto read_from = [&](off64_t offset, bool use_frames) {
+    auto memfile = std::make_unique<Memory_file>("");
+    memfile->set_content(compressed);
+    auto file = make_file(std::move(memfile),
+                          mysqlshdk::storage::Compression::ZSTD);
+
+    if (use_frames) {
+      dynamic_cast<Compressed_file *>(file.get())->set_frames(frames);
+    }
+
+    std::string buffer;
+    buffer.resize(input_data.size() + 1);
+
+    file->open(Mode::READ);
+    EXPECT_EQ(offset, file->seek(offset));
+    EXPECT_EQ(offset, file->tell());
+    buffer.resize(file->read(&buffer[0], buffer.size()));
+    file->close();
+
+    return buffer;
+  };
+
+  for (const auto offset :
+       {off64_t{0}, off64_t{1}, static_cast<off64_t>(frames[0].offset),
+        static_cast<off64_t>(frames[1].offset + 7),
+        static_cast<off64_t>(input_data.size() - 1)}) {
+    SCOPED_TRACE("offset: " + std::to_string(offset));
+    EXPECT_EQ(input_data.substr(offset), read_from(offset, true));
+  }
+
+  // seek is not supported if frames were not set
+  EXPECT_THROW(read_from(1, false), std::logic_error);
+}
+
+TEST(Compression_options, gzip_members) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+  using Mode = mysqlshdk::storage::Mode;
+
+  Generate_text g;
+  const auto input_data = g.bytes(3 * 1024 * 1024 + 512 * 1024);
+
+  const auto compress = [&input_data](int threads) {
+    auto memfile = std::make_unique<Memory_file>("");
+    const auto memfile_ptr = memfile.get();
+    Compression_options options;
+    options.threads = threads;
+    auto file = make_file(std::move(memfile),
+                          mysqlshdk::storage::Compression::GZIP, options);
+
+    file->open(Mode::WRITE);
+
+    // write in pieces which do not match the size of a block
+    for (std::size_t offset = 0; offset < input_data.size();
+         offset += 100000) {
+      const auto length =
+          std::min<std::size_t>(100000, input_data.size() - offset);
+      EXPECT_EQ(length, file->write(input_data.data() + offset, length));
+    }
+
+    EXPECT_EQ(input_data.size(), file->tell());
+    file->close();
+
+    return memfile_ptr->content();
+  };
+
+  // decompresses the data using zlib, returns number of gzip members
+  const auto count_members = [](const std::string &compressed,
+                                std::string *out) {
+    z_stream stream{};
+    EXPECT_EQ(Z_OK, inflateInit2(&stream, 15 + 16));
+
+    std::string buffer;
+    buffer.resize(1 << 16);
+    stream.next_in =
+        reinterpret_cast<Bytef *>(const_cast<char *>(compressed.data()));
+    stream.avail_in = compressed.size();
+
+    int members = 0;
+
+    while (stream.avail_in > 0) {
+      stream.next_out = reinterpret_cast<Bytef *>(buffer.data());
+      stream.avail_out = buffer.size();
+
+      const auto result = inflate(&stream, Z_NO_FLUSH);
+      EXPECT_TRUE(Z_OK == result || Z_STREAM_END == result);
+      out->append(buffer.data(), buffer.size() - stream.avail_out);
+
+      if (Z_STREAM_END == result) {
+        ++members;
+        inflateReset(&stream);
+      } else if (Z_OK != result) {
+        break;
+      }
+    }
+
+    inflateEnd(&stream);
+
+    return members;
+  };
+
+  const auto read = [](const std::string &compressed) {
+    auto memfile = std::make_unique<Memory_file>("");
+    memfile->set_content(compressed);
+    auto file = make_file(std::move(memfile),
+                          mysqlshdk::storage::Compression::GZIP);
+
+    std::string result;
+    std::string buffer;
+    buffer.resize(BUFSIZE);
+
+    file->open(Mode::READ);
+
+    for (auto bytes = file->read(buffer.data(), buffer.size()); bytes > 0;
+         bytes = file->read(buffer.data(), buffer.size())) {
+      result.append(buffer.data(), bytes);
+    }
+
+    EXPECT_EQ(result.size(), file->tell());
+    file->close();
+
+    return result;
+  };
+
+  {
+    SCOPED_TRACE("single stream");
+    const auto compressed = compress(0);
+    std::string decompressed;
+    EXPECT_EQ(1, count_members(compressed, &decompressed));
+    EXPECT_EQ(input_data, decompressed);
+    EXPECT_EQ(input_data, read(compressed));
+  }
+
+  {
+    SCOPED_TRACE("parallel");
+    const auto compressed = compress(3);
+    std::string decompressed;
+    // 1 MiB blocks
+    EXPECT_EQ(4, count_members(compressed, &decompressed));
+    EXPECT_EQ(input_data, decompressed);
+    EXPECT_EQ(input_data, read(compressed));
+  }
+
+  {
+    SCOPED_TRACE("concatenated files");
+    std::string first;
+    std::string second;
+    mysqlshdk::storage::compress(mysqlshdk::storage::Compression::GZIP,
+                                 input_data.data(), 1000, &first);
+    mysqlshdk::storage::compress(mysqlshdk::storage::Compression::GZIP,
+                                 input_data.data() + 1000, 2000, &second);
+    EXPECT_EQ(input_data.substr(0, 3000), read(first + second));
+  }
+}
+
+TEST(Compression_options, find_zstd_frames) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+  using Mode = mysqlshdk::storage::Mode;
+
+  Generate_text g;
+  std::vector<uint64_t> frames;
+  std::vector<uint32_t> compressed_sizes;
+  std::vector<uint32_t> sizes;
+  std::string compressed;
+
+  {
+    auto memfile = std::make_unique<Memory_file>("");
+    const auto memfile_ptr = memfile.get();
+    auto file = make_file(std::move(memfile),
+                          mysqlshdk::storage::Compression::ZSTD);
+    const auto zstd = dynamic_cast<Compressed_file *>(file.get());
+    uint64_t compressed_offset = 0;
+
+    file->open(Mode::WRITE);
+
+    for (int i = 0; i < 5; ++i) {
+      const auto part = g.words(1000 * (i + 1));
+
+      if (i) {
+        // closing the file ends the last frame
+        zstd->end_frame();
+        compressed_offset += zstd->latest_io_size();
+        compressed_sizes.emplace_back(compressed_offset - frames.back());
+      }
+
+      frames.emplace_back(compressed_offset);
+      sizes.emplace_back(part.size());
+
+      file->write(part.data(), part.size());
+      compressed_offset += zstd->latest_io_size();
+    }
+
+    file->close();
+
+    compressed = memfile_ptr->content();
+    compressed_sizes.emplace_back(compressed.size() - frames.back());
+  }
+
+  const auto find_frames = [](const std::string &contents) {
+    Memory_file file{""};
+    file.set_content(contents);
+
+    file.open(Mode::READ);
+    auto result = compression::find_zstd_frames(&file);
+    EXPECT_EQ(0, file.tell());
+    file.close();
+
+    return result;
+  };
+
+  // frames are found by walking the headers
+  EXPECT_EQ(frames, find_frames(compressed));
+
+  // truncated file
+  EXPECT_TRUE(find_frames(compressed.substr(0, compressed.size() - 1)).empty());
+
+  // not a zstd file
+  EXPECT_TRUE(find_frames(std::string(100, 'x')).empty());
+  EXPECT_TRUE(find_frames("").empty());
+
+  // zstd seekable format, frames are listed in a seek table
+  std::string seekable = compressed;
+
+  {
+    const auto append = [](uint32_t value, std::string *out) {
+      for (int i = 0; i < 4; ++i) {
+        *out += static_cast<char>((value >> (8 * i)) & 0xFF);
+      }
+    };
+
+    std::string table;
+
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+      append(compressed_sizes[i], &table);
+      append(sizes[i], &table);
+    }
+
+    append(frames.size(), &table);
+    // descriptor, no checksums
+    table += '\0';
+    append(0x8F92EAB1, &table);
+
+    append(0x184D2A5E, &seekable);
+    append(table.size(), &seekable);
+    seekable += table;
+  }
+
+  EXPECT_EQ(frames, find_frames(seekable));
+
+  // seek table is used even if frame headers cannot be walked
+  {
+    auto broken = seekable;
+    broken[frames[2]] = 'x';
+    EXPECT_EQ(frames, find_frames(broken));
+  }
+
+  // seek table which does not describe the file is not used
+  {
+    auto broken = seekable;
+    broken[frames[2]] = 'x';
+    broken.erase(frames[1], 1);
+    EXPECT_TRUE(find_frames(broken).empty());
+  }
+}
+
 extern "C" const char *g_test_home;
 TEST_P(Compression, compress_decompress_bigdata) {
   SKIP_TEST("Slow test");
@@ -392,7 +898,8 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, ""),
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "off"),
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "on"),
-        std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "required")),
+        std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "required"),
+        std::make_tuple(mysqlshdk::storage::Compression::LZ4, "")),
     fmt_compr);
 
 }  // namespace tests
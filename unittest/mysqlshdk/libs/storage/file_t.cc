@@ -21,9 +21,12 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <algorithm>
 #include <memory>
 #include <random>
+#include <string>
 #include <utility>
+#include <vector>
 #ifndef _WIN32
 #include <unistd.h>
 #endif
@@ -340,6 +343,101 @@ TEST(Storage, file_mmap_read) {
 }
 #endif
 
+TEST(Storage, file_pread) {
+  const auto path = shcore::path::join_path(getenv("TMPDIR"), "testfile.txt");
+  std::string contents;
+
+  for (int i = 0; i < 10000; ++i) {
+    contents += std::to_string(i) + "\n";
+  }
+
+  shcore::create_file(path, contents);
+
+  const auto file = make_file(path);
+  file->open(Mode::READ);
+
+  std::string buffer;
+  buffer.resize(10);
+
+  // reads do not use nor modify the current position
+  file->seek(5);
+  EXPECT_EQ(10, file->pread(&buffer[0], buffer.size(), 100));
+  EXPECT_EQ(contents.substr(100, 10), buffer);
+  EXPECT_EQ(5, file->tell());
+
+  EXPECT_EQ(3, file->pread(&buffer[0], buffer.size(), contents.size() - 3));
+  EXPECT_EQ(contents.substr(contents.size() - 3), buffer.substr(0, 3));
+
+  EXPECT_EQ(0, file->pread(&buffer[0], buffer.size(), contents.size() + 10));
+  EXPECT_EQ(5, file->tell());
+
+  // handle with native positional reads can be shared between threads
+  if (file->supports_pread()) {
+    constexpr std::size_t k_chunk = 1000;
+    std::string result;
+    result.resize(contents.size());
+    std::vector<mysqlshdk::utils::Scoped_future<ssize_t>> reads;
+
+    for (std::size_t offset = 0; offset < contents.size(); offset += k_chunk) {
+      reads.emplace_back(file->pread_async(
+          &result[offset], std::min(k_chunk, contents.size() - offset),
+          offset));
+    }
+
+    ssize_t total = 0;
+
+    for (auto &read : reads) {
+      total += read.get();
+    }
+
+    EXPECT_EQ(contents.size(), total);
+    EXPECT_EQ(contents, result);
+  }
+
+  file->close();
+  file->remove();
+}
+
+TEST(Storage, file_page_cache_option) {
+  const auto path = shcore::path::join_path(getenv("TMPDIR"), "testfile.txt");
+
+  EXPECT_THROW(make_file(path, {{"file.page_cache", "invalid"}}),
+               std::invalid_argument);
+
+  // data spans multiple page cache windows
+  std::string contents;
+
+  while (contents.size() < 20 * 1024 * 1024) {
+    contents += std::to_string(contents.size()) + "\n";
+  }
+
+  const auto file = make_file(path, {{"file.page_cache", "drop"}});
+
+  file->open(Mode::WRITE);
+
+  for (std::size_t offset = 0; offset < contents.size(); offset += 65536) {
+    const auto length = std::min<std::size_t>(65536, contents.size() - offset);
+    EXPECT_EQ(length, file->write(contents.data() + offset, length));
+  }
+
+  file->close();
+
+  EXPECT_EQ(contents.size(), file->file_size());
+
+  // append after the existing data
+  file->open(Mode::APPEND);
+  EXPECT_EQ(4, file->write("end\n", 4));
+  file->close();
+
+  contents += "end\n";
+
+  file->open(Mode::READ);
+  EXPECT_EQ(contents, read_file(file.get()));
+  file->close();
+
+  file->remove();
+}
+
 }  // namespace tests
 }  // namespace storage
 }  // namespace mysqlshdk
@@ -25,6 +25,10 @@
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/shell_test_env.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include "mysqlshdk/libs/storage/backend/http.h"
 
 namespace mysqlshdk {
@@ -57,6 +61,87 @@ TEST(Http_object_test, full_path_constructor) {
   EXPECT_BASE_AND_PATH("https://example.com/dir/dir2/", "exe.txt");
 }
 
+namespace {
+
+class Test_object : public Http_object {
+ public:
+  explicit Test_object(std::string contents)
+      : Http_object(std::string{"https://example.com/file"}),
+        m_contents(std::move(contents)) {
+    m_open_mode = Mode::READ;
+  }
+
+  size_t file_size() const override { return m_contents.size(); }
+
+  ssize_t pread(void *buffer, size_t length, off64_t offset) override {
+    // Http_object does not send a request when reading past the end
+    if (offset >= static_cast<off64_t>(m_contents.size())) return 0;
+
+    requests.emplace_back(length);
+
+    length = std::min(length, m_contents.size() - offset);
+    m_contents.copy(static_cast<char *>(buffer), length, offset);
+
+    return length;
+  }
+
+  std::vector<size_t> requests;
+
+ private:
+  std::string m_contents;
+};
+
+}  // namespace
+
+TEST(Http_object_test, read_ahead) {
+  std::string contents;
+
+  for (int i = 0; i < 100000; ++i) {
+    contents += std::to_string(i) + "\n";
+  }
+
+  Test_object object{contents};
+  std::string result;
+  char buffer[100];
+
+  while (const auto bytes = object.read(buffer, sizeof(buffer))) {
+    result.append(buffer, bytes);
+  }
+
+  EXPECT_EQ(contents, result);
+
+  // small reads are coalesced, request size doubles with each request
+  ASSERT_EQ(4, object.requests.size());
+  EXPECT_EQ(Http_object::MIN_READ_AHEAD, object.requests[0]);
+  EXPECT_EQ(2 * Http_object::MIN_READ_AHEAD, object.requests[1]);
+  EXPECT_EQ(4 * Http_object::MIN_READ_AHEAD, object.requests[2]);
+  EXPECT_EQ(8 * Http_object::MIN_READ_AHEAD, object.requests[3]);
+
+  // seek within the buffered data does not result in a request
+  object.requests.clear();
+  object.seek(contents.size() - 10);
+  EXPECT_EQ(10, object.read(buffer, sizeof(buffer)));
+  EXPECT_EQ(contents.substr(contents.size() - 10), std::string(buffer, 10));
+  EXPECT_TRUE(object.requests.empty());
+
+  // seek elsewhere starts with a small request again
+  object.seek(0);
+  EXPECT_EQ(sizeof(buffer), object.read(buffer, sizeof(buffer)));
+  EXPECT_EQ(contents.substr(0, sizeof(buffer)),
+            std::string(buffer, sizeof(buffer)));
+  ASSERT_EQ(1, object.requests.size());
+  EXPECT_EQ(Http_object::MIN_READ_AHEAD, object.requests[0]);
+
+  // large reads bypass the buffer
+  object.requests.clear();
+  object.seek(300000);
+  std::string large(Http_object::MIN_READ_AHEAD + 1000, '\0');
+  EXPECT_EQ(large.size(), object.read(large.data(), large.size()));
+  EXPECT_EQ(contents.substr(300000, large.size()), large);
+  ASSERT_EQ(1, object.requests.size());
+  EXPECT_EQ(large.size(), object.requests[0]);
+}
+
 }  // namespace backend
 }  // namespace storage
 }  // namespace mysqlshdk
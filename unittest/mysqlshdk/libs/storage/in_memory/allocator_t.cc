@@ -137,6 +137,46 @@ TEST(In_memory_allocator, allocate_free) {
   }
 }
 
+TEST(In_memory_allocator, memory_limit) {
+  constexpr std::size_t number_of_blocks = 4;
+  constexpr std::size_t block_size = 512;
+
+  Allocator a{number_of_blocks * block_size, block_size};
+  EXPECT_EQ(0, a.memory_used());
+  EXPECT_EQ(0, a.peak_memory());
+
+  // no limit
+  auto blocks = a.try_allocate(3 * number_of_blocks * block_size);
+  EXPECT_EQ(3 * number_of_blocks, blocks.size());
+  EXPECT_EQ(3 * number_of_blocks * block_size, a.memory_used());
+  a.free(blocks);
+  EXPECT_EQ(0, a.memory_used());
+  EXPECT_EQ(3 * number_of_blocks * block_size, a.peak_memory());
+
+  // limit is rounded down to the block size
+  a.set_memory_limit(2 * block_size + 1);
+
+  blocks = a.try_allocate(block_size + 1);
+  EXPECT_EQ(2, blocks.size());
+  EXPECT_EQ(0, a.try_allocate(1).size());
+
+  // allocate() ignores the limit
+  const auto more = a.allocate(block_size);
+  EXPECT_EQ(1, more.size());
+  EXPECT_EQ(3 * block_size, a.memory_used());
+
+  a.free(more);
+  a.free(blocks.back());
+  blocks.pop_back();
+
+  blocks.emplace_back(a.try_allocate(1).front());
+  EXPECT_EQ(0, a.try_allocate(1).size());
+  a.free(blocks);
+
+  EXPECT_EQ(0, a.memory_used());
+  EXPECT_EQ(3 * number_of_blocks * block_size, a.peak_memory());
+}
+
 TEST(In_memory_allocator, threads) {
   constexpr std::size_t number_of_blocks = 4;
   constexpr std::size_t block_size = 1;
@@ -23,6 +23,8 @@
 
 #include "mysqlshdk/libs/storage/backend/in_memory/threaded_file.h"
 
+#include <cstdio>
+
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils.h"
 
@@ -32,6 +34,7 @@
 #include "mysqlshdk/libs/storage/backend/in_memory/allocated_file.h"
 #include "mysqlshdk/libs/storage/backend/in_memory/allocator.h"
 #include "mysqlshdk/libs/storage/backend/in_memory/virtual_file_adapter.h"
+#include "mysqlshdk/libs/storage/backend/stdin_file.h"
 
 namespace mysqlshdk {
 namespace storage {
@@ -198,6 +201,47 @@ TEST(Threaded_file, read_long) {
   test_file->remove();
 }
 
+TEST(Threaded_file, read_stdin) {
+  const std::string filename{"threaded-file-read-stdin.txt"};
+  constexpr std::size_t length = 1024 * 1024 + 7;
+  const std::string contents =
+      shcore::get_random_string(length, "abcdefghijklmnopqrstuvwxyz");
+  const auto test_file = make_file(filename);
+
+  test_file->open(Mode::WRITE);
+  test_file->write(contents.c_str(), length);
+  test_file->close();
+
+  // standard input is redirected, it's not used by any other test
+  ASSERT_NE(nullptr, std::freopen(filename.c_str(), "rb", stdin));
+
+  Allocator allocator{1000, 100};
+  Threaded_file_config config;
+  config.allocator = &allocator;
+  config.max_memory = 500;
+  config.threads = 4;
+  config.file_path = "-";
+  config.config = backend::stdin_config();
+  config.sequential = true;
+
+  const auto file = threaded_file(std::move(config));
+  // size is not known
+  EXPECT_EQ(0, file->file_size());
+
+  std::string buffer;
+  buffer.resize(length + 1);
+
+  file->open(Mode::READ);
+  EXPECT_EQ(length, file->read(buffer.data(), buffer.size()));
+  EXPECT_EQ(0, file->read(buffer.data(), buffer.size()));
+  file->close();
+
+  buffer.resize(length);
+  EXPECT_EQ(contents, buffer);
+
+  test_file->remove();
+}
+
 TEST(Threaded_file, read_compressed) {
   const std::string filename{"threaded-file-read.zst"};
   constexpr std::size_t length = 23;
@@ -362,6 +406,63 @@ TEST(Threaded_file, extract) {
   test_file->remove();
 }
 
+TEST(Threaded_file, read_compressed_frames) {
+  const std::string filename{"threaded-file-read-frames.zst"};
+  constexpr std::size_t frames = 20;
+  constexpr std::size_t threads = 4;
+  std::string contents;
+
+  {
+    const auto test_file = make_file(make_file(filename), Compression::ZSTD);
+    const auto zstd = dynamic_cast<Compressed_file *>(test_file.get());
+
+    test_file->open(Mode::WRITE);
+
+    for (std::size_t i = 0; i < frames; ++i) {
+      const auto frame = shcore::get_random_string(
+          1000 + 17 * i, "abcdefghijklmnopqrstuvwxyz");
+      test_file->write(frame.c_str(), frame.size());
+      contents += frame;
+      zstd->end_frame();
+    }
+
+    test_file->close();
+  }
+
+  for (std::size_t max : {100, 3000, 1000000}) {
+    for (std::size_t read : {99, 1024}) {
+      SCOPED_TRACE("max memory: " + std::to_string(max) +
+                   ", read size: " + std::to_string(read));
+
+      Allocator allocator{1000, 100};
+      Threaded_file_config config;
+      config.allocator = &allocator;
+      config.max_memory = max;
+      config.threads = threads;
+      config.file_path = filename;
+
+      const auto file = threaded_file(std::move(config));
+      EXPECT_TRUE(file->is_compressed());
+
+      std::string buffer;
+      buffer.resize(read);
+      std::string result;
+
+      file->open(Mode::READ);
+
+      while (const auto bytes = file->read(buffer.data(), read)) {
+        result.append(buffer.data(), bytes);
+      }
+
+      file->close();
+
+      EXPECT_EQ(contents, result);
+    }
+  }
+
+  make_file(filename)->remove();
+}
+
 }  // namespace
 }  // namespace in_memory
 }  // namespace storage
@@ -37,9 +37,12 @@
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/ssl_keygen.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
+#include "mysqlshdk/libs/storage/backend/in_memory/allocated_file.h"
 #include "mysqlshdk/libs/storage/backend/in_memory/synchronized_file.h"
 
 namespace mysqlshdk {
@@ -582,6 +585,70 @@ TEST(Virtual_fs, file_seek_tell) {
   EXPECT_EQ(data_length, file->tell());
 }
 
+TEST(Virtual_fs, memory_limit) {
+  const auto spill_dir =
+      shcore::path::join_path(getenv("TMPDIR"), "virtual_fs_spill");
+  const auto data = shcore::get_random_string(100, "0123456789ABCDEF");
+
+  const auto read_contents = [](Virtual_fs::IFile *f) {
+    std::string result;
+    result.resize(f->size());
+
+    f->open(true);
+    EXPECT_EQ(result.length(), f->read(result.data(), result.length()));
+    f->close();
+
+    return result;
+  };
+
+  {
+    Virtual_fs fs{1024, 10};
+    fs.set_memory_limit(50, spill_dir);
+    EXPECT_TRUE(shcore::is_folder(spill_dir));
+
+    const auto dir = fs.create_directory("dir");
+
+    // fits in memory
+    const auto small = dir->create_file("small");
+    small->open(false);
+    small->write(data.data(), 30);
+    small->close();
+    EXPECT_FALSE(dynamic_cast<Allocated_file *>(small)->is_spilled());
+    EXPECT_EQ(0, fs.spilled_bytes());
+
+    // exceeds the limit, contents are moved to disk
+    const auto big = dir->create_file("big");
+    big->open(false);
+    big->write(data.data(), 10);
+    EXPECT_FALSE(dynamic_cast<Allocated_file *>(big)->is_spilled());
+    big->write(data.data() + 10, 90);
+    EXPECT_TRUE(dynamic_cast<Allocated_file *>(big)->is_spilled());
+    EXPECT_EQ(100, big->size());
+
+    // overwrite some of the data
+    big->seek(5);
+    big->write("xyz", 3);
+    EXPECT_EQ(100, big->size());
+    big->close();
+
+    EXPECT_EQ(100 + 3, fs.spilled_bytes());
+    EXPECT_EQ(40, fs.peak_memory());
+
+    auto expected = data;
+    expected.replace(5, 3, "xyz");
+
+    EXPECT_EQ(data.substr(0, 30), read_contents(small));
+    EXPECT_EQ(expected, read_contents(big));
+
+    // spilled file is removed along with the virtual one
+    dir->remove_file("big");
+    EXPECT_TRUE(shcore::is_folder(spill_dir));
+  }
+
+  // directory is removed along with the file system
+  EXPECT_FALSE(shcore::path_exists(spill_dir));
+}
+
 TEST(Virtual_fs, threads) {
   constexpr int thread_count = 2;
   using shcore::ssl::restricted::md5;
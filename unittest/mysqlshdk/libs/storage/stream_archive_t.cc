@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/storage/backend/stream_archive.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+namespace tests {
+
+TEST(Stream_archive, round_trip) {
+  const auto path =
+      shcore::path::join_path(getenv("TMPDIR"), "stream_archive.bin");
+  const auto url = "stream://" + path;
+
+  ASSERT_TRUE(is_stream_archive(url));
+  EXPECT_FALSE(is_stream_archive(path));
+
+  const std::string large(1024 * 1024 + 13, 'x');
+
+  {
+    const auto dir = make_directory(url, stream_archive_writer_config(url));
+    EXPECT_FALSE(dir->exists());
+    dir->create();
+    EXPECT_TRUE(dir->exists());
+
+    // data of two files is interleaved
+    const auto first = dir->file("first.tsv.dumping");
+    const auto second = dir->file("second.txt");
+
+    first->open(Mode::WRITE);
+    second->open(Mode::WRITE);
+
+    first->write(large.c_str(), large.length());
+    second->write("second", 6);
+    first->write("end", 3);
+
+    second->close();
+    first->close();
+    first->rename("first.tsv");
+
+    EXPECT_EQ(large.length() + 3, first->file_size());
+    EXPECT_EQ(2, dir->list_files().size());
+    EXPECT_EQ(1, dir->filter_files("*.tsv").size());
+
+    const auto removed = dir->file("removed");
+    removed->open(Mode::WRITE);
+    removed->close();
+    removed->remove();
+
+    EXPECT_THROW(removed->open(Mode::READ), std::runtime_error);
+
+    const auto last = dir->file("@.json");
+    last->open(Mode::WRITE);
+    last->write("{}", 2);
+    last->close();
+  }
+
+  {
+    const auto dir =
+        make_directory(url, stream_archive_reader_config(url, "@.json"));
+
+    EXPECT_EQ(3, dir->list_files().size());
+
+    const auto first = dir->file("first.tsv");
+    first->open(Mode::READ);
+    EXPECT_EQ(large + "end", read_file(first.get()));
+    first->close();
+
+    const auto second = dir->file("second.txt");
+    second->open(Mode::READ);
+    EXPECT_EQ("second", read_file(second.get()));
+    second->close();
+
+    EXPECT_FALSE(dir->file("removed")->exists());
+  }
+
+  shcore::delete_file(path);
+}
+
+TEST(Stream_archive, truncated) {
+  const auto path =
+      shcore::path::join_path(getenv("TMPDIR"), "stream_archive.bin");
+  const auto url = "stream://" + path;
+
+  {
+    const auto dir = make_directory(url, stream_archive_writer_config(url));
+    dir->create();
+
+    const auto file = dir->file("@.json");
+    file->open(Mode::WRITE);
+    file->write("{}", 2);
+    file->close();
+  }
+
+  // drop the end record
+  auto contents = shcore::get_text_file(path);
+  contents.resize(contents.size() - 9);
+  shcore::create_file(path, contents);
+
+  // reader waits for a file which is never received, stream ends with an error
+  EXPECT_THROW(
+      make_directory(url, stream_archive_reader_config(url, "missing")),
+      std::runtime_error);
+
+  shcore::delete_file(path);
+}
+
+TEST(Stream_archive, data_files_are_released) {
+  const auto path =
+      shcore::path::join_path(getenv("TMPDIR"), "stream_archive.bin");
+  const auto url = "stream://" + path;
+
+  {
+    const auto dir = make_directory(url, stream_archive_writer_config(url));
+    dir->create();
+
+    // @.json is written last, reader waits for it
+    for (const auto name : {"s@t@@0.tsv.zst", "s@t@@0.tsv.zst.idx", "@.json"}) {
+      const auto file = dir->file(name);
+      file->open(Mode::WRITE);
+      file->write("data", 4);
+      file->close();
+    }
+  }
+
+  {
+    const auto dir =
+        make_directory(url, stream_archive_reader_config(url, "@.json"));
+
+    const auto read = [&dir](const std::string &name) {
+      const auto file = dir->file(name);
+      file->open(Mode::READ);
+      auto contents = read_file(file.get());
+      file->close();
+      return contents;
+    };
+
+    EXPECT_EQ(3, dir->list_files().size());
+
+    // data file is removed once it's read
+    EXPECT_EQ("data", read("s@t@@0.tsv.zst"));
+    EXPECT_FALSE(dir->file("s@t@@0.tsv.zst")->exists());
+    EXPECT_EQ(2, dir->list_files().size());
+
+    // metadata and index files are kept
+    EXPECT_EQ("data", read("@.json"));
+    EXPECT_EQ("data", read("s@t@@0.tsv.zst.idx"));
+
+    EXPECT_TRUE(dir->file("@.json")->exists());
+    EXPECT_TRUE(dir->file("s@t@@0.tsv.zst.idx")->exists());
+    EXPECT_EQ(2, dir->list_files().size());
+  }
+
+  shcore::delete_file(path);
+}
+
+#ifndef _WIN32
+
+TEST(Stream_archive, standard_streams) {
+  const auto path =
+      shcore::path::join_path(getenv("TMPDIR"), "stream_archive.bin");
+  const auto url = std::string{"stream://-"};
+
+  const auto redirect = [](const std::string &file, int flags, int fd) {
+    const auto redirected = ::open(file.c_str(), flags, 0600);
+    EXPECT_LE(0, redirected);
+    const auto saved = ::dup(fd);
+    EXPECT_LE(0, saved);
+    EXPECT_LE(0, ::dup2(redirected, fd));
+    ::close(redirected);
+    return saved;
+  };
+
+  const auto restore = [](int saved, int fd) {
+    EXPECT_LE(0, ::dup2(saved, fd));
+    ::close(saved);
+  };
+
+  {
+    fflush(stdout);
+    const auto saved = redirect(path, O_WRONLY | O_CREAT | O_TRUNC, 1);
+
+    {
+      const auto dir = make_directory(url, stream_archive_writer_config(url));
+      dir->create();
+
+      // messages written while archive is written do not end up in the stream
+      printf("message printed while archive is written\n");
+
+      const auto file = dir->file("@.json");
+      file->open(Mode::WRITE);
+      file->write("{}", 2);
+      file->close();
+    }
+
+    restore(saved, 1);
+  }
+
+  {
+    const auto saved = redirect(path, O_RDONLY, 0);
+
+    {
+      const auto dir =
+          make_directory(url, stream_archive_reader_config(url, "@.json"));
+
+      const auto file = dir->file("@.json");
+      file->open(Mode::READ);
+      EXPECT_EQ("{}", read_file(file.get()));
+      file->close();
+    }
+
+    restore(saved, 0);
+  }
+
+  shcore::delete_file(path);
+}
+
+#endif  // !_WIN32
+
+}  // namespace tests
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/storage/backend/tee_directory.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+namespace tests {
+
+class Tee_directory_test : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (const auto name : {"tee_primary", "tee_first", "tee_second"}) {
+      m_paths.emplace_back(shcore::path::join_path(getenv("TMPDIR"), name));
+
+      if (shcore::is_folder(m_paths.back())) {
+        shcore::remove_directory(m_paths.back());
+      }
+    }
+  }
+
+  void TearDown() override {
+    for (const auto &path : m_paths) {
+      if (shcore::is_folder(path)) {
+        shcore::remove_directory(path);
+      }
+    }
+  }
+
+  std::unique_ptr<Tee_directory> make_tee(std::size_t max_lag) const {
+    std::vector<std::unique_ptr<IDirectory>> mirrors;
+
+    for (std::size_t i = 1; i < m_paths.size(); ++i) {
+      mirrors.emplace_back(make_directory(m_paths[i]));
+    }
+
+    return std::make_unique<Tee_directory>(make_directory(m_paths[0]),
+                                           std::move(mirrors), max_lag);
+  }
+
+  std::string read(const std::string &path, const std::string &name) const {
+    const auto file = make_directory(path)->file(name);
+    file->open(Mode::READ);
+    auto contents = read_file(file.get());
+    file->close();
+    return contents;
+  }
+
+  std::vector<std::string> m_paths;
+};
+
+TEST_F(Tee_directory_test, write) {
+  // lag smaller than a single write, mirrors have to catch up all the time
+  const auto dir = make_tee(16);
+
+  EXPECT_FALSE(dir->exists());
+  dir->create();
+  EXPECT_TRUE(dir->exists());
+
+  for (const auto &path : m_paths) {
+    EXPECT_TRUE(shcore::is_folder(path));
+  }
+
+  std::string expected;
+
+  {
+    const auto file = dir->file("data.tsv.dumping");
+    file->open(Mode::WRITE);
+
+    for (int i = 0; i < 1000; ++i) {
+      const auto line = "line " + std::to_string(i) + "\n";
+      EXPECT_EQ(line.length(), file->write(line.c_str(), line.length()));
+      expected += line;
+    }
+
+    const std::string large(3 * 1024 * 1024 + 7, 'x');
+    file->write(large.c_str(), large.length());
+    expected += large;
+
+    EXPECT_TRUE(file->flush());
+    EXPECT_THROW(file->seek(0), std::logic_error);
+
+    file->close();
+    file->rename("data.tsv");
+  }
+
+  EXPECT_EQ(1, dir->list_files().size());
+
+  for (const auto &path : m_paths) {
+    EXPECT_EQ(expected, read(path, "data.tsv"));
+  }
+
+  {
+    // reading uses just the primary file
+    const auto file = dir->file("data.tsv");
+    file->open(Mode::READ);
+    EXPECT_EQ(expected.length(), file->file_size());
+    EXPECT_EQ(5, file->seek(5));
+    file->close();
+
+    file->remove();
+  }
+
+  for (const auto &path : m_paths) {
+    EXPECT_FALSE(make_directory(path)->file("data.tsv")->exists());
+  }
+}
+
+TEST_F(Tee_directory_test, mirror_exists) {
+  shcore::create_directory(m_paths[2]);
+
+  const auto dir = make_tee(1024);
+
+  EXPECT_FALSE(dir->exists());
+  dir->create();
+  EXPECT_TRUE(dir->exists());
+  EXPECT_TRUE(dir->is_local());
+}
+
+TEST_F(Tee_directory_test, missing_mirror) {
+  const auto dir = make_tee(1024);
+  dir->create();
+
+  // file cannot be created if one of the mirrors is gone
+  shcore::remove_directory(m_paths[1]);
+
+  const auto file = dir->file("data.tsv");
+  EXPECT_THROW(file->open(Mode::WRITE), std::runtime_error);
+}
+
+}  // namespace tests
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
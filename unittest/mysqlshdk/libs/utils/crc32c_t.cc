@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "unittest/gprod_clean.h"
+
+#include <random>
+#include <string>
+
+#include "mysqlshdk/libs/utils/crc32c.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+namespace {
+
+uint32_t crc32c_bitwise(const std::string &data) {
+  uint32_t crc = ~uint32_t{0};
+
+  for (const auto c : data) {
+    crc ^= static_cast<unsigned char>(c);
+
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ ((crc & 1) ? 0x82F63B78 : 0);
+    }
+  }
+
+  return ~crc;
+}
+
+}  // namespace
+
+TEST(Crc32c_test, known_values) {
+  EXPECT_EQ(0u, crc32c("", 0));
+  EXPECT_EQ(0xE3069283u, crc32c("123456789", 9));
+  // test vectors from RFC 3720
+  EXPECT_EQ(0x8A9136AAu, crc32c(std::string(32, '\0').data(), 32));
+  EXPECT_EQ(0x62A8AB43u, crc32c(std::string(32, '\xFF').data(), 32));
+}
+
+TEST(Crc32c_test, matches_reference) {
+  std::mt19937 gen{0};
+  std::uniform_int_distribution<int> byte{0, 255};
+  std::string data;
+
+  for (std::size_t i = 0; i < 1000; ++i) {
+    data += static_cast<char>(byte(gen));
+  }
+
+  // check all offsets, so that both aligned and unaligned data is used
+  for (std::size_t offset = 0; offset < 16; ++offset) {
+    for (std::size_t length = 0; length < 100; ++length) {
+      SCOPED_TRACE("offset: " + std::to_string(offset) +
+                   ", length: " + std::to_string(length));
+      EXPECT_EQ(crc32c_bitwise(data.substr(offset, length)),
+                crc32c(data.data() + offset, length));
+    }
+  }
+
+  EXPECT_EQ(crc32c_bitwise(data), crc32c(data.data(), data.size()));
+}
+
+TEST(Crc32c_test, incremental) {
+  const std::string data = "The quick brown fox jumps over the lazy dog";
+  const auto expected = crc32c(data.data(), data.size());
+
+  for (std::size_t split = 0; split <= data.size(); ++split) {
+    SCOPED_TRACE("split: " + std::to_string(split));
+    const auto first = crc32c(data.data(), split);
+    EXPECT_EQ(expected,
+              crc32c(data.data() + split, data.size() - split, first));
+  }
+}
+
+TEST(Crc32c_test, crc32) {
+  EXPECT_EQ(0u, crc32("", 0));
+  EXPECT_EQ(0xCBF43926u, crc32("123456789", 9));
+
+  const std::string data = "The quick brown fox jumps over the lazy dog";
+  EXPECT_EQ(0x414FA339u, crc32(data.data(), data.size()));
+  EXPECT_EQ(0x414FA339u,
+            crc32(data.data() + 10, data.size() - 10, crc32(data.data(), 10)));
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
@@ -22,6 +22,9 @@
  */
 
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 #include "mysqlshdk/libs/utils/document_parser.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -167,4 +170,56 @@ TEST(Document_parser, bom_utf32be) {
                       "UTF-32BE encoded document is not supported.");
   }
 }
+
+TEST(Document_parser, long_strings) {
+  const std::string filename{"test.json"};
+  auto exit_scope =
+      shcore::on_leave_scope([&]() { shcore::delete_file(filename); });
+
+  // strings span multiple input buffers, escapes are placed at different
+  // offsets within a word
+  std::vector<std::string> expected;
+  std::string content;
+
+  for (int i = 0; i < 8; ++i) {
+    std::string value;
+
+    for (int j = 0; j < 20000; ++j) {
+      value += "abcdefg";
+      value.append(j % 7 + 1, 'x');
+
+      if (0 == j % 13) {
+        value += "\\\"";
+      } else if (0 == (j + i) % 17) {
+        value += "\\\\";
+      }
+    }
+
+    // whitespace which follows the document is included
+    expected.emplace_back("{\"key\": \"" + value + "\"}\n");
+    content += expected.back();
+  }
+
+  shcore::create_file(filename, content, true);
+
+  shcore::Buffered_input input{filename};
+  shcore::Document_reader_options options{};
+  shcore::Json_reader reader(&input, options);
+  reader.parse_bom();
+
+  std::vector<std::string> documents;
+
+  while (!reader.eof()) {
+    if (auto jd = reader.next(); !jd.empty()) {
+      documents.emplace_back(std::move(jd));
+    }
+  }
+
+  EXPECT_EQ(expected, documents);
+
+  // unterminated string
+  EXPECT_THROW_LIKE(process_input("{\"key\": \"" + std::string(100000, 'a')),
+                    shcore::invalid_json, "Premature end of input stream");
+}
+
 }  // namespace shcore
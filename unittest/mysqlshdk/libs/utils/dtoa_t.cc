@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <bit>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/dtoa.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+namespace {
+
+void expect_same_output(double x, my_gcvt_arg_type type) {
+  // the minimal supported width is 7, narrower fields are used by the
+  // truncation paths of my_gcvt()
+  for (const int width : {31, 30, 24, 17, 12, 10, 8, 7, 5, 3, 2, 1}) {
+    char expected[64];
+    char actual[64];
+    bool expected_error = false;
+    bool actual_error = false;
+
+    const auto expected_len =
+        my_gcvt_legacy(x, type, width, expected, &expected_error);
+    const auto actual_len = my_gcvt(x, type, width, actual, &actual_error);
+
+    ASSERT_EQ(std::string(expected, expected_len),
+              std::string(actual, actual_len))
+        << "value: " << std::hexfloat << x << ", width: " << width
+        << ", float: " << (MY_GCVT_ARG_FLOAT == type);
+    ASSERT_EQ(expected_error, actual_error);
+  }
+}
+
+std::vector<double> special_values() {
+  return {0.0,
+          -0.0,
+          1.0,
+          -1.0,
+          0.1,
+          0.5,
+          0.125,
+          0.375,
+          1.5,
+          2.5,
+          1e15,
+          1e16,
+          1e17,
+          123456789012345678.0,
+          9007199254740993.0,
+          // ties when rounding small integers
+          2480670500000.0,
+          -2480670500000.0,
+          1234565.0,
+          24500.0,
+          1e-5,
+          1e-7,
+          0.000123456,
+          5e-324,
+          -5e-324,
+          2.2250738585072014e-308,
+          2.2250738585072009e-308,
+          1.7976931348623157e308,
+          -1.7976931348623157e308,
+          1e100,
+          1e-100,
+          9.999999999999999e22,
+          1e23,
+          FLT_MAX,
+          FLT_MIN,
+          FLT_EPSILON,
+          DBL_EPSILON,
+          3.14159265358979,
+          2.718281828459045,
+          0.30000000000000004,
+          std::numeric_limits<double>::infinity(),
+          -std::numeric_limits<double>::infinity(),
+          std::numeric_limits<double>::quiet_NaN()};
+}
+
+}  // namespace
+
+TEST(Dtoa, conformance_special_values) {
+  for (const auto x : special_values()) {
+    expect_same_output(x, MY_GCVT_ARG_DOUBLE);
+    expect_same_output(x, MY_GCVT_ARG_FLOAT);
+  }
+}
+
+TEST(Dtoa, conformance_random_bits) {
+  std::mt19937_64 rng{20240101};
+
+  for (int i = 0; i < 200000; ++i) {
+    const auto x = std::bit_cast<double>(rng());
+
+    expect_same_output(x, MY_GCVT_ARG_DOUBLE);
+  }
+
+  std::uniform_int_distribution<uint32_t> bits;
+
+  for (int i = 0; i < 200000; ++i) {
+    const auto x = std::bit_cast<float>(bits(rng));
+
+    expect_same_output(x, MY_GCVT_ARG_FLOAT);
+  }
+}
+
+TEST(Dtoa, conformance_decimal_values) {
+  // values typically stored in FLOAT/DOUBLE columns: a few decimal digits
+  std::mt19937_64 rng{20240102};
+  std::uniform_int_distribution<int64_t> mantissa{-99999999, 99999999};
+  std::uniform_int_distribution<int> exponent{-12, 12};
+
+  for (int i = 0; i < 200000; ++i) {
+    const auto x = static_cast<double>(mantissa(rng)) *
+                   std::pow(10.0, static_cast<double>(exponent(rng)));
+
+    expect_same_output(x, MY_GCVT_ARG_DOUBLE);
+    expect_same_output(static_cast<float>(x), MY_GCVT_ARG_FLOAT);
+  }
+}
+
+TEST(Dtoa, dtoa) {
+  EXPECT_EQ("0", dtoa(0.0));
+  EXPECT_EQ("-0", dtoa(-0.0));
+  EXPECT_EQ("0.1", dtoa(0.1));
+  EXPECT_EQ("0.30000000000000004", dtoa(0.1 + 0.2));
+  EXPECT_EQ("-1.5", dtoa(-1.5));
+  EXPECT_EQ("1.2345678901234568e17", dtoa(123456789012345678.0));
+  EXPECT_EQ("1e16", dtoa(1e16));
+  EXPECT_EQ("1.7976931348623157e308", dtoa(DBL_MAX));
+  EXPECT_EQ("5e-324", dtoa(5e-324));
+  EXPECT_EQ("0.0001", dtoa(1e-4));
+  EXPECT_EQ("0", dtoa(std::numeric_limits<double>::infinity()));
+
+  EXPECT_EQ("0.1", ftoa(0.1f));
+  EXPECT_EQ("3.14159", ftoa(3.14159265f));
+  EXPECT_EQ("16777200", ftoa(16777216.0f));
+  EXPECT_EQ("3.40282e38", ftoa(FLT_MAX));
+}
+
+TEST(Dtoa, str_to_double) {
+  std::size_t consumed = 0;
+
+  EXPECT_EQ(1.5, str_to_double("1.5"));
+  EXPECT_EQ(-1.5, str_to_double("-1.5"));
+  EXPECT_EQ(150.0, str_to_double("+1.5e2"));
+  EXPECT_EQ(0.1, str_to_double("  0.1"));
+  EXPECT_EQ(1e-3, str_to_double("1E-3"));
+
+  EXPECT_EQ(12.5, str_to_double("12.5abc", &consumed));
+  EXPECT_EQ(4, consumed);
+
+  EXPECT_EQ(0.25, str_to_double(" +0.25", &consumed));
+  EXPECT_EQ(6, consumed);
+
+  // values which are too small are converted to 0, like strtod() does
+  EXPECT_EQ(0.0, str_to_double("1e-400"));
+  EXPECT_TRUE(std::signbit(str_to_double("-1e-400")));
+
+  EXPECT_THROW(str_to_double(""), std::invalid_argument);
+  EXPECT_THROW(str_to_double("abc"), std::invalid_argument);
+  EXPECT_THROW(str_to_double("+-1"), std::invalid_argument);
+  EXPECT_THROW(str_to_double("1e400"), std::out_of_range);
+  EXPECT_THROW(str_to_double("-1e400"), std::out_of_range);
+
+  // round trip, same result as strtod()
+  std::mt19937_64 rng{20240103};
+
+  for (int i = 0; i < 100000; ++i) {
+    const auto x = std::bit_cast<double>(rng());
+    if (!std::isfinite(x)) continue;
+
+    const auto s = dtoa(x);
+
+    EXPECT_EQ(std::strtod(s.c_str(), nullptr), str_to_double(s)) << s;
+    EXPECT_EQ(x, str_to_double(s)) << s;
+  }
+}
+
+}  // namespace shcore
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include "mysqlshdk/libs/utils/find_first_of.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+TEST(Find_first_of_test, find) {
+  const char chars[] = {'\0', '\b', '\n', '\r', '\t', 0x1A, '\\', ',', '"'};
+  const auto chars_end = chars + sizeof(chars);
+
+  std::mt19937 gen{0};
+  std::uniform_int_distribution<int> letter{'a', 'z'};
+  std::uniform_int_distribution<std::size_t> special{0, sizeof(chars) - 1};
+
+  for (std::size_t length = 0; length < 200; ++length) {
+    for (int density : {0, 5, 50}) {
+      std::string data;
+
+      for (std::size_t i = 0; i < length; ++i) {
+        if (density && 0 == gen() % density) {
+          data += chars[special(gen)];
+        } else {
+          data += static_cast<char>(letter(gen));
+        }
+      }
+
+      // check all offsets, so that both aligned and unaligned data is used
+      for (std::size_t offset = 0; offset < std::min<std::size_t>(length, 33);
+           ++offset) {
+        SCOPED_TRACE("length: " + std::to_string(length) +
+                     ", offset: " + std::to_string(offset));
+
+        const auto begin = data.data() + offset;
+        const auto end = data.data() + length;
+
+        EXPECT_EQ(std::find_first_of(begin, end, chars, chars_end),
+                  find_first_of(begin, end, chars, sizeof(chars)));
+      }
+    }
+  }
+
+  {
+    // character matching the last byte of the range
+    const std::string data = std::string(64, 'a') + '\n';
+
+    EXPECT_EQ(data.data() + 64, find_first_of(data.data(),
+                                              data.data() + data.length(),
+                                              chars, sizeof(chars)));
+  }
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
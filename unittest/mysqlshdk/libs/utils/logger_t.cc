@@ -24,6 +24,8 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/mocks/gmock_clean.h"
@@ -320,6 +322,89 @@ class Stderr_reader final {
 
 }  // namespace
 
+TEST_F(Logger_test, async) {
+  const auto name = get_log_file("mylog.txt");
+  shcore::on_leave_scope scope_leave([&name]() {
+    if (!shcore::is_folder(name)) {
+      shcore::delete_file(name);
+    }
+  });
+
+  constexpr int k_threads = 8;
+  constexpr int k_messages = 5000;
+
+  for (const auto policy :
+       {Logger::Overflow_policy::BLOCK, Logger::Overflow_policy::DROP}) {
+    SCOPED_TRACE(Logger::Overflow_policy::BLOCK == policy ? "block" : "drop");
+
+    if (shcore::is_file(name)) {
+      shcore::delete_file(name);
+    }
+
+    uint64_t dropped = 0;
+
+    {
+      mysqlsh::Scoped_logger logger(
+          Logger::create_instance(name.c_str(), false, Logger::LOG_DEBUG));
+
+      const auto l = current_logger();
+      l->start_async(policy);
+      EXPECT_TRUE(l->is_async());
+
+      std::vector<std::thread> threads;
+
+      for (int i = 0; i < k_threads; ++i) {
+        threads.emplace_back([i]() {
+          for (int j = 0; j < k_messages; ++j) {
+            log_info("thread %d message %d", i, j);
+          }
+        });
+      }
+
+      for (auto &t : threads) {
+        t.join();
+      }
+
+      l->flush();
+      dropped = l->dropped_messages();
+
+      if (Logger::Overflow_policy::BLOCK == policy) {
+        EXPECT_EQ(0, dropped);
+      }
+    }
+
+    std::string contents;
+    ASSERT_TRUE(get_log_file_contents("mylog.txt", &contents));
+
+    std::vector<int> last(k_threads, -1);
+    uint64_t written = 0;
+    bool dropped_reported = false;
+
+    for (const auto &line : shcore::str_split(contents, "\n")) {
+      if (line.empty()) continue;
+
+      int thread = 0;
+      int message = 0;
+
+      if (const auto pos = line.find("Info: thread ");
+          std::string::npos != pos &&
+          2 == sscanf(line.c_str() + pos, "Info: thread %d message %d", &thread,
+                      &message)) {
+        // messages of a single thread are in order
+        ASSERT_LT(last[thread], message);
+        last[thread] = message;
+        ++written;
+      } else if (std::string::npos !=
+                 line.find("log messages were dropped, buffer was full")) {
+        dropped_reported = true;
+      }
+    }
+
+    EXPECT_EQ(k_threads * k_messages, written + dropped);
+    EXPECT_EQ(dropped > 0, dropped_reported);
+  }
+}
+
 TEST_F(Logger_test, stderr_output) {
   Stderr_reader reader;
 
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/memory_stats.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+// other tests may hold some memory, only the differences are checked
+
+TEST(Memory_stats_test, tracked_memory) {
+  const auto tag = Memory_tag::REST;
+  const auto before = Memory_stats::entry(tag);
+  const auto total_before = Memory_stats::total_used();
+
+  {
+    Tracked_memory memory{tag, 100};
+
+    EXPECT_EQ(100, memory.size());
+    EXPECT_EQ(before.used + 100, Memory_stats::entry(tag).used);
+    EXPECT_EQ(total_before + 100, Memory_stats::total_used());
+
+    memory.grow(50);
+    EXPECT_EQ(before.used + 150, Memory_stats::entry(tag).used);
+
+    memory.shrink(100);
+    EXPECT_EQ(before.used + 50, Memory_stats::entry(tag).used);
+
+    // cannot go below zero
+    memory.shrink(100);
+    EXPECT_EQ(0, memory.size());
+    EXPECT_EQ(before.used, Memory_stats::entry(tag).used);
+
+    memory.resize(1000);
+    EXPECT_EQ(before.used + 1000, Memory_stats::entry(tag).used);
+    EXPECT_LE(before.used + 1000, Memory_stats::entry(tag).peak);
+    EXPECT_LE(total_before + 1000, Memory_stats::total_peak());
+  }
+
+  const auto after = Memory_stats::entry(tag);
+
+  EXPECT_EQ(before.used, after.used);
+  EXPECT_EQ(total_before, Memory_stats::total_used());
+  // only growth counts as an allocation
+  EXPECT_EQ(before.allocations + 3, after.allocations);
+}
+
+TEST(Memory_stats_test, copy_and_move) {
+  const auto tag = Memory_tag::RESULTS;
+  const auto before = Memory_stats::entry(tag).used;
+
+  {
+    Tracked_memory first{tag, 10};
+    Tracked_memory second{first};
+
+    EXPECT_EQ(10, second.size());
+    EXPECT_EQ(before + 20, Memory_stats::entry(tag).used);
+
+    Tracked_memory third{std::move(first)};
+
+    EXPECT_EQ(0, first.size());
+    EXPECT_EQ(10, third.size());
+    EXPECT_EQ(before + 20, Memory_stats::entry(tag).used);
+
+    Tracked_memory fourth{Memory_tag::DUMP, 5};
+    fourth = third;
+
+    EXPECT_EQ(before + 30, Memory_stats::entry(tag).used);
+
+    fourth = std::move(second);
+
+    EXPECT_EQ(0, second.size());
+    EXPECT_EQ(before + 20, Memory_stats::entry(tag).used);
+  }
+
+  EXPECT_EQ(before, Memory_stats::entry(tag).used);
+}
+
+TEST(Memory_stats_test, reset_peak) {
+  const auto tag = Memory_tag::VIRTUAL_FS;
+
+  {
+    Tracked_memory memory{tag, 1000000};
+  }
+
+  const auto used = Memory_stats::entry(tag).used;
+  EXPECT_LE(used + 1000000, Memory_stats::entry(tag).peak);
+
+  Memory_stats::reset_peak();
+
+  EXPECT_EQ(used, Memory_stats::entry(tag).peak);
+  EXPECT_EQ(Memory_stats::total_used(), Memory_stats::total_peak());
+}
+
+TEST(Memory_stats_test, concurrent) {
+  const auto tag = Memory_tag::LOAD;
+  const auto before = Memory_stats::entry(tag).used;
+
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([tag]() {
+      for (int j = 0; j < 10000; ++j) {
+        Tracked_memory memory{tag, 64};
+        memory.grow(64);
+      }
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(before, Memory_stats::entry(tag).used);
+}
+
+TEST(Memory_stats_test, entries) {
+  const auto entries = Memory_stats::entries();
+
+  ASSERT_EQ(Memory_stats::k_tags, entries.size());
+
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    EXPECT_EQ(static_cast<Memory_tag>(i), entries[i].tag);
+    EXPECT_EQ(Memory_stats::name(entries[i].tag), entries[i].name);
+  }
+
+  EXPECT_EQ("virtualFs", Memory_stats::name(Memory_tag::VIRTUAL_FS));
+}
+
+}  // namespace shcore
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/rate_limit.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+namespace {
+
+double consume(Shared_rate_limit *limit, int threads, int64_t bytes_per_thread,
+               int64_t block) {
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+
+  for (int i = 0; i < threads; ++i) {
+    workers.emplace_back([limit, bytes_per_thread, block]() {
+      for (int64_t bytes = 0; bytes < bytes_per_thread; bytes += block) {
+        limit->throttle(block);
+      }
+    });
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+}  // namespace
+
+TEST(Shared_rate_limit, disabled) {
+  Shared_rate_limit limit;
+  EXPECT_FALSE(limit.enabled());
+
+  // no limit, nothing is throttled
+  EXPECT_GT(1.0, consume(&limit, 4, 1024 * 1024 * 1024, 64 * 1024));
+}
+
+TEST(Shared_rate_limit, limit_is_shared) {
+  constexpr int64_t k_rate = 4 * 1024 * 1024;
+
+  // bucket holds one second worth of data, remaining two seconds are throttled
+  // regardless of the number of threads
+  for (const int threads : {1, 4}) {
+    SCOPED_TRACE("threads: " + std::to_string(threads));
+
+    Shared_rate_limit limit{k_rate};
+    EXPECT_TRUE(limit.enabled());
+
+    const auto elapsed =
+        consume(&limit, threads, 3 * k_rate / threads, 16 * 1024);
+
+    EXPECT_LE(1.8, elapsed);
+    EXPECT_GE(3.0, elapsed);
+  }
+}
+
+TEST(Shared_rate_limit, set_limit) {
+  Shared_rate_limit limit{1024};
+
+  // drain the bucket
+  consume(&limit, 1, 1024, 1024);
+
+  // limit is increased, the remaining data is consumed quickly
+  limit.set_limit(1024 * 1024 * 1024);
+  EXPECT_GT(1.0, consume(&limit, 2, 1024 * 1024, 1024));
+
+  limit.set_limit(0);
+  EXPECT_FALSE(limit.enabled());
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/statement_stats.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+TEST(Statement_stats_test, histogram_buckets) {
+  // small values have dedicated buckets
+  for (uint64_t us = 0; us < Latency_histogram::k_sub_buckets; ++us) {
+    EXPECT_EQ(us, Latency_histogram::bucket(us));
+    EXPECT_EQ(us, Latency_histogram::bucket_limit(us));
+  }
+
+  // every value is not greater than the limit of its bucket, and greater than
+  // the limit of the previous bucket
+  for (uint64_t us = 1; us < 10000000; us = us * 3 / 2 + 1) {
+    const auto b = Latency_histogram::bucket(us);
+
+    EXPECT_LE(us, Latency_histogram::bucket_limit(b));
+    EXPECT_GT(us, Latency_histogram::bucket_limit(b - 1));
+    // precision is ~6%
+    EXPECT_LE(Latency_histogram::bucket_limit(b) - us, us / 16 + 1);
+  }
+
+  EXPECT_EQ(Latency_histogram::k_buckets - 1,
+            Latency_histogram::bucket(UINT64_MAX));
+}
+
+TEST(Statement_stats_test, histogram_percentiles) {
+  Latency_histogram histogram;
+
+  for (int i = 1; i <= 100; ++i) {
+    histogram.record(milliseconds{i});
+  }
+
+  const auto data = histogram.data();
+
+  EXPECT_EQ(100, data.count);
+  EXPECT_EQ(milliseconds{5050}, data.total);
+  EXPECT_EQ(milliseconds{1}, data.min);
+  EXPECT_EQ(milliseconds{100}, data.max);
+
+  const auto near = [](std::chrono::nanoseconds actual, int expected_ms) {
+    const auto ms = std::chrono::duration<double, std::milli>(actual).count();
+    EXPECT_NEAR(expected_ms, ms, expected_ms * 0.07);
+  };
+
+  near(data.percentile(50), 50);
+  near(data.percentile(90), 90);
+  near(data.percentile(99), 99);
+  EXPECT_EQ(milliseconds{100}, data.percentile(100));
+  EXPECT_EQ(milliseconds{1}, data.percentile(0));
+
+  histogram.reset();
+  EXPECT_EQ(0, histogram.data().count);
+  EXPECT_EQ(std::chrono::nanoseconds{0}, histogram.data().percentile(50));
+}
+
+TEST(Statement_stats_test, fingerprint) {
+  EXPECT_EQ("SELECT ?", Statement_stats::fingerprint("SELECT 1"));
+  EXPECT_EQ("SELECT * FROM t WHERE a = ? AND b = ?",
+            Statement_stats::fingerprint(
+                "SELECT  *\n FROM t WHERE a = 'x''y' AND b = \"z\\\"\""));
+  EXPECT_EQ("SELECT * FROM t1 WHERE c IN (?)",
+            Statement_stats::fingerprint(
+                "SELECT * FROM t1 WHERE c IN (1, 2.5, -3e-2, 0xFF, 'a')"));
+  EXPECT_EQ("SELECT `a 1`, b2 FROM `t``3`",
+            Statement_stats::fingerprint("SELECT `a 1`, b2 FROM `t``3`"));
+  EXPECT_EQ("SELECT ? FROM dual",
+            Statement_stats::fingerprint(
+                "SELECT /* comment */ 1 -- comment\n FROM dual # comment"));
+  EXPECT_EQ("INSERT INTO t VALUES (?),(?)",
+            Statement_stats::fingerprint("INSERT INTO t VALUES (1,2),(3,4)"));
+
+  const auto fp = Statement_stats::fingerprint(
+      "SELECT " + std::string(1000, 'a') + " FROM t");
+  EXPECT_EQ(259, fp.length());
+  EXPECT_EQ("...", fp.substr(fp.length() - 3));
+}
+
+TEST(Statement_stats_test, record) {
+  Statement_stats stats;
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&stats, t]() {
+      for (int i = 0; i < 100; ++i) {
+        stats.record("util.dumpInstance",
+                     "SELECT * FROM t WHERE id = " + std::to_string(i),
+                     microseconds{100 * (t + 1)});
+      }
+
+      stats.record("main", "SHOW DATABASES", milliseconds{1});
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  const auto entries = stats.entries();
+  ASSERT_EQ(2, entries.size());
+
+  EXPECT_EQ("util.dumpInstance", entries[0].context);
+  EXPECT_EQ("SELECT * FROM t WHERE id = ?", entries[0].fingerprint);
+  EXPECT_EQ(400, entries[0].latency.count);
+  EXPECT_EQ(microseconds{100 * 100 * (1 + 2 + 3 + 4)},
+            entries[0].latency.total);
+  EXPECT_EQ(microseconds{100}, entries[0].latency.min);
+  EXPECT_EQ(microseconds{400}, entries[0].latency.max);
+
+  EXPECT_EQ("main", entries[1].context);
+  EXPECT_EQ("SHOW DATABASES", entries[1].fingerprint);
+  EXPECT_EQ(4, entries[1].latency.count);
+
+  const auto text = stats.format();
+  EXPECT_NE(std::string::npos, text.find("P99 (ms)"));
+  EXPECT_NE(std::string::npos,
+            text.find("util.dumpInstance  SELECT * FROM t WHERE id = ?\n"));
+  EXPECT_NE(std::string::npos, text.find("  1.000  main  "));
+
+  stats.reset();
+  EXPECT_TRUE(stats.entries().empty());
+}
+
+}  // namespace shcore
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/thread_affinity.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+TEST(Thread_affinity_test, to_thread_affinity) {
+  EXPECT_EQ(Thread_affinity::NONE, to_thread_affinity("none"));
+  EXPECT_EQ(Thread_affinity::NODE, to_thread_affinity("node"));
+  EXPECT_EQ(Thread_affinity::CORE, to_thread_affinity("CORE"));
+
+  EXPECT_THROW(to_thread_affinity(""), std::invalid_argument);
+  EXPECT_THROW(to_thread_affinity("numa"), std::invalid_argument);
+
+  for (const auto affinity :
+       {Thread_affinity::NONE, Thread_affinity::NODE, Thread_affinity::CORE}) {
+    EXPECT_EQ(affinity, to_thread_affinity(to_string(affinity)));
+  }
+}
+
+TEST(Thread_affinity_test, parse_cpu_list) {
+  using Cpus = std::vector<int>;
+
+  EXPECT_EQ(Cpus{}, parse_cpu_list(""));
+  EXPECT_EQ(Cpus{}, parse_cpu_list("\n"));
+  EXPECT_EQ(Cpus{0}, parse_cpu_list("0\n"));
+  EXPECT_EQ((Cpus{0, 1, 2, 3}), parse_cpu_list("0-3"));
+  EXPECT_EQ((Cpus{0, 1, 2, 3, 8, 10, 11}), parse_cpu_list("0-3,8,10-11\n"));
+  EXPECT_EQ((Cpus{1, 2, 3}), parse_cpu_list("3,1-2,2"));
+
+  EXPECT_THROW(parse_cpu_list("a"), std::invalid_argument);
+  EXPECT_THROW(parse_cpu_list("1-"), std::invalid_argument);
+  EXPECT_THROW(parse_cpu_list("-1"), std::invalid_argument);
+  EXPECT_THROW(parse_cpu_list("3-1"), std::invalid_argument);
+  EXPECT_THROW(parse_cpu_list("1,,2"), std::invalid_argument);
+  EXPECT_THROW(parse_cpu_list("1 2"), std::invalid_argument);
+}
+
+TEST(Thread_affinity_test, worker_cpus) {
+  using Cpus = std::vector<int>;
+  const Cpu_topology topology = {{0, 1, 2}, {4, 5, 6}};
+
+  for (std::size_t i = 0; i < 8; ++i) {
+    EXPECT_EQ(Cpus{}, worker_cpus(topology, Thread_affinity::NONE, i));
+  }
+
+  // workers alternate between the nodes
+  EXPECT_EQ((Cpus{0, 1, 2}), worker_cpus(topology, Thread_affinity::NODE, 0));
+  EXPECT_EQ((Cpus{4, 5, 6}), worker_cpus(topology, Thread_affinity::NODE, 1));
+  EXPECT_EQ((Cpus{0, 1, 2}), worker_cpus(topology, Thread_affinity::NODE, 2));
+  EXPECT_EQ((Cpus{4, 5, 6}), worker_cpus(topology, Thread_affinity::NODE, 3));
+
+  // each worker gets a different CPU, until all of them are used
+  const std::vector<Cpus> expected = {{0}, {4}, {1}, {5}, {2}, {6}, {0}, {4}};
+
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    SCOPED_TRACE(i);
+    EXPECT_EQ(expected[i], worker_cpus(topology, Thread_affinity::CORE, i));
+  }
+
+  EXPECT_EQ(Cpus{}, worker_cpus({}, Thread_affinity::CORE, 0));
+}
+
+TEST(Thread_affinity_test, cpu_topology) {
+  const auto &topology = cpu_topology();
+
+  ASSERT_FALSE(topology.empty());
+
+  for (const auto &node : topology) {
+    EXPECT_FALSE(node.empty());
+  }
+
+  // same instance is returned
+  EXPECT_EQ(&topology, &cpu_topology());
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
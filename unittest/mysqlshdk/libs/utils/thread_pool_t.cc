@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/thread_pool.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+TEST(Thread_pool, serial_processing) {
+  Thread_pool pool{4};
+  pool.start_threads();
+
+  const auto main_thread = std::this_thread::get_id();
+  std::set<std::string> results;
+
+  for (int i = 0; i < 1000; ++i) {
+    pool.add_task([i]() { return std::to_string(i); },
+                  [&results, main_thread](std::string &&data) {
+                    EXPECT_EQ(main_thread, std::this_thread::get_id());
+                    results.emplace(std::move(data));
+                  });
+  }
+
+  pool.tasks_done();
+  pool.process();
+
+  EXPECT_EQ(1000, results.size());
+}
+
+TEST(Thread_pool, parallel_processing) {
+  Thread_pool pool{4};
+  pool.start_threads();
+
+  const auto main_thread = std::this_thread::get_id();
+  std::atomic<int> serial{0};
+  std::atomic<int> parallel{0};
+
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 2) {
+      pool.add_task([]() { return std::string{}; },
+                    [&parallel, main_thread](std::string &&) {
+                      EXPECT_NE(main_thread, std::this_thread::get_id());
+                      ++parallel;
+                    },
+                    Thread_pool::Priority::MEDIUM,
+                    Thread_pool::Processing::PARALLEL);
+    } else {
+      pool.add_task([]() { return std::string{}; },
+                    [&serial, main_thread](std::string &&) {
+                      EXPECT_EQ(main_thread, std::this_thread::get_id());
+                      ++serial;
+                    });
+    }
+  }
+
+  pool.tasks_done();
+  pool.process();
+
+  EXPECT_EQ(500, serial);
+  EXPECT_EQ(500, parallel);
+}
+
+TEST(Thread_pool, exception) {
+  {
+    Thread_pool pool{4};
+    pool.start_threads();
+
+    for (int i = 0; i < 100; ++i) {
+      pool.add_task(
+          [i]() {
+            if (50 == i) throw std::runtime_error("producer");
+            return std::string{};
+          },
+          [](std::string &&) {});
+    }
+
+    pool.tasks_done();
+    EXPECT_THROW(pool.process(), std::runtime_error);
+  }
+
+  {
+    Thread_pool pool{4};
+    pool.start_threads();
+
+    for (int i = 0; i < 100; ++i) {
+      pool.add_task([i]() { return std::to_string(i); },
+                    [](std::string &&data) {
+                      if ("50" == data) throw std::runtime_error("processor");
+                    },
+                    Thread_pool::Priority::MEDIUM,
+                    Thread_pool::Processing::PARALLEL);
+    }
+
+    pool.tasks_done();
+    EXPECT_THROW(pool.process(), std::runtime_error);
+  }
+}
+
+TEST(Thread_pool, add_task_after_done) {
+  Thread_pool pool{2};
+  pool.start_threads();
+  pool.tasks_done();
+
+  EXPECT_THROW(pool.add_task([]() { return std::string{}; },
+                             [](std::string &&) {}),
+               std::logic_error);
+
+  pool.process();
+}
+
+TEST(Thread_pool, priority) {
+  // a single worker executes a blocking HIGH priority task, while the global
+  // queue holds LOW priority tasks, HIGH priority task added in the meantime
+  // needs to be executed before them
+  Thread_pool pool{1};
+
+  std::vector<std::string> order;
+  std::promise<void> started;
+  std::promise<void> release;
+
+  const auto add_task = [&pool, &order](const std::string &name,
+                                        Thread_pool::Priority priority,
+                                        std::function<void()> produce = {}) {
+    pool.add_task(
+        [&order, name, produce = std::move(produce)]() {
+          order.emplace_back(name);
+
+          if (produce) {
+            produce();
+          }
+
+          return std::string{};
+        },
+        [](std::string &&) {}, priority);
+  };
+
+  add_task("high-1", Thread_pool::Priority::HIGH, [&started, &release]() {
+    started.set_value();
+    release.get_future().wait();
+  });
+
+  for (int i = 0; i < 20; ++i) {
+    add_task("low", Thread_pool::Priority::LOW);
+  }
+
+  pool.start_threads();
+  started.get_future().wait();
+
+  add_task("high-2", Thread_pool::Priority::HIGH);
+  release.set_value();
+
+  pool.tasks_done();
+  pool.process();
+
+  ASSERT_EQ(22, order.size());
+  EXPECT_EQ("high-1", order[0]);
+  EXPECT_EQ("high-2", order[1]);
+}
+
+}  // namespace shcore
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/threads.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+TEST(Threads, scoped_async_result) {
+  auto future = scoped_async([]() { return std::string{"result"}; });
+
+  EXPECT_TRUE(future.valid());
+  EXPECT_EQ("result", future.get());
+  EXPECT_FALSE(future.valid());
+
+  auto nothing = scoped_async([]() {});
+
+  EXPECT_TRUE(nothing.valid());
+  EXPECT_NO_THROW(nothing.get());
+}
+
+TEST(Threads, scoped_async_exception) {
+  auto future = scoped_async([]() -> int { throw std::runtime_error("fail"); });
+
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(Threads, scoped_async_joins) {
+  std::atomic<bool> finished = false;
+  const auto task = [&finished]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    finished = true;
+  };
+
+  {
+    auto future = scoped_async(task);
+  }
+
+  // destructor waits for the function to finish
+  EXPECT_TRUE(finished);
+
+  finished = false;
+  auto future = scoped_async(task);
+  future = scoped_async([]() {});
+
+  // move-assignment waits for the previous function to finish
+  EXPECT_TRUE(finished);
+}
+
+TEST(Threads, scoped_async_order) {
+  std::vector<Scoped_future<int>> futures;
+
+  for (int i = 0; i < 8; ++i) {
+    futures.emplace_back(scoped_async([i]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(8 - i));
+      return i;
+    }));
+  }
+
+  // results are retrieved in the order of submission, regardless of the
+  // order in which the functions finish
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(i, futures[i].get());
+  }
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
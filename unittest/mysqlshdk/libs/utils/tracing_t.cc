@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <rapidjson/document.h>
+
+#include <map>
+#include <string>
+#include <thread>
+
+#include "mysqlshdk/libs/utils/tracing.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace tracing {
+
+namespace {
+
+std::string trace_file() {
+  return shcore::path::join_path(getenv("TMPDIR"), "tracing_t.json");
+}
+
+rapidjson::Document read_trace() {
+  std::string contents;
+  EXPECT_TRUE(shcore::load_text_file(trace_file(), contents));
+
+  rapidjson::Document doc;
+  doc.Parse(contents.c_str(), contents.length());
+  EXPECT_FALSE(doc.HasParseError());
+
+  return doc;
+}
+
+// returns complete events, indexed by name
+std::map<std::string, const rapidjson::Value *> spans(
+    const rapidjson::Document &doc) {
+  std::map<std::string, const rapidjson::Value *> result;
+
+  for (const auto &e : doc["traceEvents"].GetArray()) {
+    if (std::string{"X"} == e["ph"].GetString()) {
+      result.emplace(e["name"].GetString(), &e);
+    }
+  }
+
+  return result;
+}
+
+}  // namespace
+
+TEST(Tracing_test, disabled) {
+  EXPECT_FALSE(enabled());
+
+  Span span{"test", "disabled"};
+  span.add_arg("arg", "value");
+
+  EXPECT_FALSE(span.active());
+}
+
+TEST(Tracing_test, spans) {
+  shcore::on_leave_scope cleanup([]() {
+    stop();
+    shcore::delete_file(trace_file());
+  });
+
+  // started before tracing is enabled, not recorded
+  Span before{"test", "before"};
+
+  start(trace_file());
+  EXPECT_TRUE(enabled());
+
+  {
+    Span outer{"test", "outer"};
+    outer.add_arg("string", "value");
+    outer.add_arg("number", static_cast<uint64_t>(1234));
+
+    EXPECT_TRUE(outer.active());
+
+    {
+      Span inner{"test", "inner"};
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::thread([]() { Span thread{"other", "thread"}; }).join();
+  }
+
+  Span manual;
+  manual.begin("test", "manual");
+  manual.end();
+  EXPECT_FALSE(manual.active());
+
+  before.end();
+
+  // started, but not finished while tracing is enabled
+  Span after{"test", "after"};
+
+  stop();
+  EXPECT_FALSE(enabled());
+
+  after.end();
+
+  const auto doc = read_trace();
+  const auto s = spans(doc);
+
+  ASSERT_EQ(4, s.size());
+  ASSERT_EQ(1, s.count("outer"));
+  ASSERT_EQ(1, s.count("inner"));
+  ASSERT_EQ(1, s.count("thread"));
+  ASSERT_EQ(1, s.count("manual"));
+
+  const auto &outer = *s.at("outer");
+  const auto &inner = *s.at("inner");
+  const auto &thread = *s.at("thread");
+
+  EXPECT_STREQ("test", outer["cat"].GetString());
+  EXPECT_STREQ("value", outer["args"]["string"].GetString());
+  EXPECT_EQ(1234, outer["args"]["number"].GetUint64());
+  EXPECT_FALSE(inner.HasMember("args"));
+
+  // inner span is nested in the outer one
+  EXPECT_LE(outer["ts"].GetDouble(), inner["ts"].GetDouble());
+  EXPECT_GE(outer["ts"].GetDouble() + outer["dur"].GetDouble(),
+            inner["ts"].GetDouble() + inner["dur"].GetDouble());
+  EXPECT_LE(1000.0, inner["dur"].GetDouble());
+
+  EXPECT_EQ(outer["tid"].GetInt(), inner["tid"].GetInt());
+  EXPECT_NE(outer["tid"].GetInt(), thread["tid"].GetInt());
+  EXPECT_STREQ("other", thread["cat"].GetString());
+
+  EXPECT_EQ(0, doc["otherData"]["droppedSpans"].GetUint64());
+}
+
+TEST(Tracing_test, restart) {
+  const auto second = trace_file() + ".2";
+  shcore::on_leave_scope cleanup([&second]() {
+    stop();
+    shcore::delete_file(trace_file());
+    shcore::delete_file(second);
+  });
+
+  start(trace_file());
+  { Span span{"test", "first"}; }
+
+  // restarting writes spans recorded so far
+  start(second);
+  { Span span{"test", "second"}; }
+
+  {
+    const auto doc = read_trace();
+    const auto s = spans(doc);
+
+    EXPECT_EQ(1, s.size());
+    EXPECT_EQ(1, s.count("first"));
+  }
+
+  stop();
+  shcore::rename_file(second, trace_file());
+
+  {
+    const auto doc = read_trace();
+    const auto s = spans(doc);
+
+    EXPECT_EQ(1, s.size());
+    EXPECT_EQ(1, s.count("second"));
+  }
+}
+
+}  // namespace tracing
+}  // namespace mysqlshdk
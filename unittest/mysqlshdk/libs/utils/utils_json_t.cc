@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#include "mysqlshdk/libs/utils/utils_json.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+TEST(Utils_json, dumper_reset) {
+  for (const auto pretty : {false, true}) {
+    SCOPED_TRACE(pretty ? "pretty" : "raw");
+
+    JSON_dumper dumper(pretty);
+
+    dumper.start_object();
+    dumper.append("first", 1);
+    dumper.end_object();
+    const auto first = dumper.str();
+
+    dumper.reset();
+    EXPECT_EQ("", dumper.str());
+    EXPECT_EQ(0, dumper.deep_level());
+
+    // a new root value can be written after reset
+    dumper.start_object();
+    dumper.append("first", 1);
+    dumper.end_object();
+    EXPECT_EQ(first, dumper.str());
+
+    dumper.reset();
+    dumper.start_array();
+    dumper.append_json(R"({"a": [1, 2]})");
+    dumper.end_array();
+    EXPECT_EQ(pretty ? "[\n    {\n        \"a\": [\n            1,\n"
+                       "            2\n        ]\n    }\n]"
+                     : R"([{"a":[1,2]}])",
+              dumper.str());
+  }
+}
+
+TEST(Utils_json, dumper_append_json_length) {
+  JSON_dumper dumper;
+  const char data[] = R"({"a": "b"}garbage)";
+  dumper.append_json(data, 10);
+  EXPECT_EQ(R"({"a":"b"})", dumper.str());
+}
+
+}  // namespace shcore
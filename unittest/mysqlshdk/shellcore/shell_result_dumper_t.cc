@@ -67,3 +67,24 @@ TEST(Resultset_dumper, get_data_sizes) {
   // Multibyte character 3 bytes represented in 2 spaces
   TEST_DATA_SIZES("I 爱 MySQL Shell\0", 17, Print_flags(), 16, 17);
 }
+
+TEST(Resultset_dumper, get_data_sizes_long_text) {
+  // ASCII text is processed in blocks of 8 bytes, special characters need to
+  // be detected in any position
+  TEST_DATA_SIZES("0123456789ABCDEFGHIJ", 20, Print_flags(), 20, 20);
+  TEST_DATA_SIZES("0123456789\0BCDEFGHIJ", 20, Print_flags(), 19, 20);
+  TEST_DATA_SIZES("0123456789\0BCDEFGHIJ", 20,
+                  Print_flags(Print_flag::PRINT_0_AS_SPC), 20, 20);
+  TEST_DATA_SIZES("0123456789\0BCDEFGHIJ", 20,
+                  Print_flags(Print_flag::PRINT_0_AS_ESC), 21, 21);
+  TEST_DATA_SIZES("0123456\t89ABCDE\nGHIJ\\", 21, Print_flags(), 21, 21);
+  TEST_DATA_SIZES("0123456\t89ABCDE\nGHIJ\\", 21,
+                  Print_flags(Print_flag::PRINT_CTRL), 24, 24);
+
+  // multibyte characters mixed with long runs of ASCII characters
+  TEST_DATA_SIZES("0123456789 ❤ 0123456789 爱 0123456789", 40, Print_flags(),
+                  37, 40);
+  TEST_DATA_SIZES("❤0123456789\0" "0123456789", 24, Print_flags(), 21, 24);
+  TEST_DATA_SIZES("❤0123456789\0" "0123456789", 24,
+                  Print_flags(Print_flag::PRINT_0_AS_ESC), 23, 25);
+}
@@ -106,6 +106,27 @@ dba.checkInstanceConfiguration(__sandbox_uri2);
 dba.checkInstanceConfiguration(__sandbox_uri1, {mycnfPath: "/this/path/is/invalid"});
 EXPECT_STDOUT_CONTAINS("Configuration file /this/path/is/invalid doesn't exist.");
 
+//@<> dba.checkInstancesConfiguration() argument errors
+EXPECT_THROWS(function(){dba.checkInstancesConfiguration([])}, "The list of instances cannot be empty.");
+EXPECT_THROWS(function(){dba.checkInstancesConfiguration([__sandbox_uri1, __sandbox_uri1])}, `The instance 'localhost:${__mysql_sandbox_port1}' is included more than once in the list of instances.`);
+EXPECT_THROWS(function(){dba.checkInstancesConfiguration([__sandbox_uri1], {mycnfPath: "/this/path/is/invalid"})}, "The options 'mycnfPath' and 'verifyMyCnf' are not supported when checking several instances.");
+
+//@<> dba.checkInstancesConfiguration() validates all instances, even if some of them fail
+var single = dba.checkInstanceConfiguration(__sandbox_uri1);
+WIPE_OUTPUT();
+
+var report = dba.checkInstancesConfiguration([__sandbox_uri1, __sandbox_uri2, `root:root@localhost:${__mysql_sandbox_port3}`]);
+
+EXPECT_EQ("error", report.status);
+EXPECT_EQ(single, report.instances[`localhost:${__mysql_sandbox_port1}`]);
+EXPECT_EQ("error", report.instances[`localhost:${__mysql_sandbox_port3}`].status);
+EXPECT_NE(undefined, report.instances[`localhost:${__mysql_sandbox_port3}`].error);
+
+EXPECT_STDOUT_CONTAINS(`Validating local MySQL instance listening at port ${__mysql_sandbox_port1} for use in an InnoDB Cluster...`);
+EXPECT_STDOUT_CONTAINS(`Validating local MySQL instance listening at port ${__mysql_sandbox_port2} for use in an InnoDB Cluster...`);
+EXPECT_STDOUT_CONTAINS(`Unable to validate instance 'localhost:${__mysql_sandbox_port3}'`);
+EXPECT_STDOUT_CONTAINS("out of 3 instances are valid for InnoDB Cluster usage.");
+
 //@<> BUG#29305551: Finalization
 session.close();
 testutil.destroySandbox(__mysql_sandbox_port1);
@@ -28,6 +28,12 @@ cluster.help("addInstance")
 //@ Add Instance \? [USE:Add Instance]
 \? cluster.addinstance
 
+//@ Add Instances
+cluster.help("addInstances")
+
+//@ Add Instances \? [USE:Add Instances]
+\? cluster.addinstances
+
 //@ Check Instance State
 cluster.help("checkInstanceState")
 
@@ -76,6 +82,12 @@ cluster.help("listRouters")
 //@ listRouters. \? [USE:listRouters]
 \? cluster.listRouters
 
+//@ monitor
+cluster.help("monitor")
+
+//@ monitor. \? [USE:monitor]
+\? cluster.monitor
+
 //@ removeRouterMetadata
 cluster.help("removeRouterMetadata")
 
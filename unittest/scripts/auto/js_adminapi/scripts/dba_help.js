@@ -16,6 +16,12 @@ dba.help('checkInstanceConfiguration');
 //@ Check Instance Configuration, \? [USE:Check Instance Configuration]
 \? checkInstanceConfiguration
 
+//@ Check Instances Configuration
+dba.help('checkInstancesConfiguration');
+
+//@ Check Instances Configuration, \? [USE:Check Instances Configuration]
+\? checkInstancesConfiguration
+
 //@ Configure Instance
 dba.help('configureInstance');
 
@@ -58,6 +64,12 @@ dba.help('deploySandboxInstance');
 //@ Deploy Sandbox, \? [USE: Deploy Sandbox]
 \? deploySandboxInstance
 
+//@ Deploy Sandboxes
+dba.help('deploySandboxInstances');
+
+//@ Deploy Sandboxes, \? [USE: Deploy Sandboxes]
+\? deploySandboxInstances
+
 //@ Drop Metadata
 dba.help('dropMetadataSchema');
 
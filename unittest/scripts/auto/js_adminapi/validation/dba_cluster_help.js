@@ -21,6 +21,9 @@ FUNCTIONS
       addInstance(instance[, options])
             Adds an Instance to the cluster.
 
+      addInstances(instances[, options])
+            Adds several Instances to the cluster at the same time.
+
       addReplicaInstance(instance[, options])
             Adds a Read Replica Instance to the Cluster.
 
@@ -64,6 +67,9 @@ FUNCTIONS
       listRouters([options])
             Lists the Router instances.
 
+      monitor([options])
+            Returns a monitor which keeps the Cluster status in memory.
+
       options([options])
             Lists the cluster configuration options.
 
@@ -307,6 +313,41 @@ DESCRIPTION
 
       ATTENTION: The password option will be removed in a future release.
 
+//@<OUT> Add Instances
+NAME
+      addInstances - Adds several Instances to the cluster at the same time.
+
+SYNTAX
+      <Cluster>.addInstances(instances[, options])
+
+WHERE
+      instances: List with the connection options of the target instances to be
+                 added.
+      options: Dictionary with options for the operation.
+
+RETURNS
+      nothing
+
+DESCRIPTION
+      This function adds a group of Instances to a InnoDB cluster. The instances
+      are validated and joined to the cluster one at a time, in the given order,
+      but the recovery of each instance (e.g. clone) runs in the background
+      while the next ones are being added, and the command waits for all of them
+      at the end.
+
+      If an instance fails to be added, the instances that follow it in the list
+      are not added, while the ones that already joined the cluster are waited
+      for.
+
+      The options dictionary accepts the same attributes as addInstance(),
+      except for label, localAddress and certSubject, which have to be unique
+      for each instance. The maximum number of instances recovering at the same
+      time is limited by the shell.options["dba.maxConcurrency"] option.
+
+      When more than one instance is recovering, no progress information is
+      shown while waiting for the recovery to finish, if the recoveryProgress
+      option is not 0.
+
 //@<OUT> Check Instance State
 NAME
       checkInstanceState - Verifies the instance gtid state in relation to the
@@ -533,6 +574,32 @@ DESCRIPTION
         instances that support older version of the Metadata Schema and require
         upgrade are included.
 
+//@<OUT> monitor
+NAME
+      monitor - Returns a monitor which keeps the Cluster status in memory.
+
+SYNTAX
+      <Cluster>.monitor([options])
+
+WHERE
+      options: Optional dictionary with options.
+
+RETURNS
+      A ClusterMonitor object.
+
+DESCRIPTION
+      This function is meant to be used by tools which check the status of the
+      Cluster periodically. Instead of connecting to all the members and
+      gathering the full status on each call, the returned object keeps its
+      sessions open and only refreshes the replication lag and the transaction
+      counters of the members, as long as the group membership, the state of the
+      members and the primary member do not change. The following options may be
+      given:
+
+      - extended: verbosity level of the status, the same as in status().
+      - refreshInterval: the status is returned from memory if it was refreshed
+        less than this many seconds ago. Default: 10.
+
 //@<OUT> removeRouterMetadata
 NAME
       removeRouterMetadata - Removes metadata for a router instance.
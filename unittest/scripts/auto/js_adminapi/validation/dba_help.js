@@ -51,6 +51,10 @@ FUNCTIONS
       checkInstanceConfiguration(instance[, options])
             Validates an instance for MySQL InnoDB Cluster usage.
 
+      checkInstancesConfiguration(instances[, options])
+            Validates several instances for MySQL InnoDB Cluster usage at the
+            same time.
+
       configureInstance([instance][, options])
             Validates and configures an instance for MySQL InnoDB Cluster
             usage.
@@ -79,6 +83,10 @@ FUNCTIONS
       deploySandboxInstance(port[, options])
             Creates a new MySQL Server instance on localhost.
 
+      deploySandboxInstances(ports[, options])
+            Creates several new MySQL Server instances on localhost at the same
+            time.
+
       dropMetadataSchema(options)
             Drops the Metadata Schema.
 
@@ -198,6 +206,51 @@ DESCRIPTION
 
       ATTENTION: The password option will be removed in a future release.
 
+//@<OUT> Check Instances Configuration
+NAME
+      checkInstancesConfiguration - Validates several instances for MySQL InnoDB
+                                    Cluster usage at the same time.
+
+SYNTAX
+      dba.checkInstancesConfiguration(instances[, options])
+
+WHERE
+      instances: List with the connection options of the target instances.
+      options: Data for the operation.
+
+RETURNS
+      A JSON object with the aggregated result of the validations.
+
+DESCRIPTION
+      This function performs the same validations as
+      checkInstanceConfiguration() on each of the given instances. The instances
+      are validated at the same time, with the maximum number of instances being
+      validated at once limited by the shell.options["dba.maxConcurrency"]
+      option. The output of the validations is printed in the order of the given
+      list, once all of them complete.
+
+      A failure to connect to or to validate an instance doesn't interrupt the
+      validation of the remaining ones, the error is included in the result
+      instead.
+
+      The options dictionary may contain the following options:
+
+      - password: The password to get connected to the instances. Deprecated.
+
+      Passwords are not prompted for, they have to be given either in the
+      instance definitions or in the password option.
+
+      The returned JSON object contains the following attributes:
+
+      - status: "ok" if all instances are valid for InnoDB Cluster usage,
+        "error" otherwise.
+      - instances: a dictionary with the result of each instance, which has the
+        same attributes as the result of checkInstanceConfiguration(), indexed
+        by the instance address. If the instance could not be validated, the
+        result contains the "error" attribute with the error message.
+
+      ATTENTION: The password option will be removed in a future release.
+
 //@<OUT> Configure Instance
 NAME
       configureInstance - Validates and configures an instance for MySQL InnoDB
@@ -1025,6 +1078,40 @@ DESCRIPTION
       ignoreSslError option to false to ensure the new instance is deployed
       with SSL support.
 
+//@<OUT> Deploy Sandboxes
+NAME
+      deploySandboxInstances - Creates several new MySQL Server instances on
+                               localhost at the same time.
+
+SYNTAX
+      dba.deploySandboxInstances(ports[, options])
+
+WHERE
+      ports: List of the ports where the new instances will listen for
+             connections.
+      options: Dictionary with options affecting the new deployed instances.
+
+RETURNS
+      Nothing.
+
+DESCRIPTION
+      This function deploys a new MySQL Server instance on each of the given
+      ports, in the same way as deploySandboxInstance() does. The instances are
+      initialized and started at the same time, with the maximum number of
+      instances being deployed at once limited by the
+      shell.options["dba.maxConcurrency"] option. The output of each deployment
+      is printed in the order of the given list, once all of them complete.
+
+      The options are the same as the ones supported by deploySandboxInstance(),
+      with the exception of the portx option: each instance listens for X
+      Protocol connections on a port which is 10 times the value of its MySQL
+      port. All instances use the same root password, which is prompted for only
+      once in interactive mode.
+
+      A failure to deploy an instance doesn't interrupt the deployment of the
+      remaining ones. Once all deployments complete, an error is reported if any
+      of them failed.
+
 //@<OUT> Drop Metadata
 NAME
       dropMetadataSchema - Drops the Metadata Schema.
@@ -0,0 +1,31 @@
+//@<> Initialization
+shell.options["credentialStore.helper"] = "plaintext";
+shell.options["credentialStore.savePasswords"] = "never";
+shell.deleteAllCredentials();
+
+//@<> credentialStore.cacheTtl option
+EXPECT_EQ(60, shell.options["credentialStore.cacheTtl"]);
+EXPECT_THROWS(function () { shell.options["credentialStore.cacheTtl"] = -1; }, "value out of range");
+
+//@<> password fetched from the helper is cached
+shell.storeCredential(__cred.x.uri, __cred.pwd);
+EXPECT_NO_THROWS(function () { shell.connect(__cred.x.uri); });
+session.close();
+
+// the cached password is used
+EXPECT_NO_THROWS(function () { shell.connect(__cred.x.uri); });
+session.close();
+
+//@<> deleting the credential removes it from the cache
+shell.deleteCredential(__cred.x.uri);
+EXPECT_THROWS(function () { shell.connect(__cred.x.uri); }, "Access denied");
+
+//@<> cache can be disabled
+shell.options["credentialStore.cacheTtl"] = 0;
+shell.storeCredential(__cred.x.uri, __cred.pwd);
+EXPECT_NO_THROWS(function () { shell.connect(__cred.x.uri); });
+session.close();
+
+//@<> Cleanup
+shell.deleteAllCredentials();
+shell.options["credentialStore.cacheTtl"] = 60;
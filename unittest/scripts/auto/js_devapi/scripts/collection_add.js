@@ -139,6 +139,27 @@ var result = collection.add({ "_id": "1E9C92FDA74ED311944E00059A3C7A49", "name":
 EXPECT_EQ(2, result.affectedItemCount);
 EXPECT_EQ(2, result.affectedItemsCount);
 
+//@<> Collection.add split into multiple messages {VER(>=8.0.11)}
+var max_packet = mySession.sql('SELECT @@global.mysqlx_max_allowed_packet').execute().fetchOne()[0];
+mySession.sql('SET GLOBAL mysqlx_max_allowed_packet = 2097152').execute();
+
+var batchSession = mysqlx.getSession(__uripwd);
+var batchCollection = batchSession.getSchema('js_shell_test').createCollection('batches');
+var docs = [];
+
+for (var i = 0; i < 500; ++i) {
+  docs.push({ index: i, data: 'x'.repeat(10240) });
+}
+
+var result = batchCollection.add(docs).execute();
+EXPECT_EQ(500, result.affectedItemsCount);
+EXPECT_EQ(500, result.generatedIds.length);
+EXPECT_EQ(500, batchCollection.count());
+EXPECT_EQ(500, new Set(result.generatedIds).size);
+
+batchSession.close();
+mySession.sql('SET GLOBAL mysqlx_max_allowed_packet = ?').bind(max_packet).execute();
+
 // Cleanup
 mySession.dropSchema('js_shell_test');
 mySession.close();
@@ -47,6 +47,12 @@ result.help('fetchAll');
 //@ Help on fetchAll, \? [USE:Help on fetchAll]
 \? DocResult.fetchAll
 
+//@ Help on fetchMany
+result.help('fetchMany');
+
+//@ Help on fetchMany, \? [USE:Help on fetchMany]
+\? DocResult.fetchMany
+
 //@ Help on fetchOne
 result.help('fetchOne');
 
@@ -63,12 +63,24 @@ result.help('fetchAll');
 //@ Help on fetchAll, \? [USE:Help on fetchAll]
 \? RowResult.fetchAll
 
+//@ Help on fetchMany
+result.help('fetchMany');
+
+//@ Help on fetchMany, \? [USE:Help on fetchMany]
+\? RowResult.fetchMany
+
 //@ Help on fetchOne
 result.help('fetchOne');
 
 //@ Help on fetchOne, \? [USE:Help on fetchOne]
 \? RowResult.fetchOne
 
+//@ Help on fetchOneInto
+result.help('fetchOneInto');
+
+//@ Help on fetchOneInto, \? [USE:Help on fetchOneInto]
+\? RowResult.fetchOneInto
+
 //@ Help on fetchOneObject
 result.help('fetchOneObject');
 
@@ -75,12 +75,24 @@ result.help('fetchAll');
 //@ Help on fetchAll, \? [USE:Help on fetchAll]
 \? SqlResult.fetchAll
 
+//@ Help on fetchMany
+result.help('fetchMany');
+
+//@ Help on fetchMany, \? [USE:Help on fetchMany]
+\? SqlResult.fetchMany
+
 //@ Help on fetchOne
 result.help('fetchOne');
 
 //@ Help on fetchOne, \? [USE:Help on fetchOne]
 \? SqlResult.fetchOne
 
+//@ Help on fetchOneInto
+result.help('fetchOneInto');
+
+//@ Help on fetchOneInto, \? [USE:Help on fetchOneInto]
+\? SqlResult.fetchOneInto
+
 //@ Help on fetchOneObject
 result.help('fetchOneObject');
 
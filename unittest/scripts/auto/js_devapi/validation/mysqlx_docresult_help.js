@@ -34,6 +34,9 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetchMany(count)
+            Returns a list with up to count documents left on the result.
+
       fetchOne()
             Retrieves the next DbDoc on the DocResult.
 
@@ -117,6 +120,26 @@ DESCRIPTION
       it will return a DbDoc for each of the remaining documents on the
       resultset.
 
+//@<OUT> Help on fetchMany
+NAME
+      fetchMany - Returns a list with up to count documents left on the result.
+
+SYNTAX
+      <DocResult>.fetchMany(count)
+
+WHERE
+      count: The maximum number of documents to be returned.
+
+RETURNS
+      A List of DbDoc objects.
+
+DESCRIPTION
+      Only the requested documents are read from the server, this allows
+      processing large results in batches, without holding all the documents in
+      memory.
+
+      If there are no documents left on the result, an empty list is returned.
+
 //@<OUT> Help on fetchOne
 NAME
       fetchOne - Retrieves the next DbDoc on the DocResult.
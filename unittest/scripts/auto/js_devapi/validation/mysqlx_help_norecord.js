@@ -533,6 +533,9 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetchMany(count)
+            Returns a list with up to count documents left on the result.
+
       fetchOne()
             Retrieves the next DbDoc on the DocResult.
 
@@ -682,9 +685,15 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetchMany(count)
+            Returns a list with up to count rows left on the result.
+
       fetchOne()
             Retrieves the next Row on the RowResult.
 
+      fetchOneInto(row)
+            Reads the next row of the result into the given Row object.
+
       fetchOneObject()
             Retrieves the next Row on the result and returns it as an object.
 
@@ -0,0 +1,32 @@
+//@<> Setup
+testutil.deployRawSandbox(__mysql_sandbox_port1, "root");
+shell.connect(__sandbox_uri1);
+session.runSql("CREATE SCHEMA bg_test");
+session.runSql("CREATE TABLE bg_test.t (id INT PRIMARY KEY)");
+\sql
+\use bg_test
+
+//@ Statement executed in the background
+\bg INSERT INTO t VALUES (1), (2), (3);
+\wait
+
+//@ Background statement uses the current schema
+\bg SELECT * FROM t;
+\wait 2
+
+//@ Background statement which fails
+\bg INSERT INTO t VALUES (1);
+\wait [3]
+
+//@ No background statements
+\jobs
+
+//@ Invalid arguments
+\bg
+\wait 100
+\wait invalid
+
+//@<> Cleanup
+\js
+session.runSql("DROP SCHEMA bg_test");
+testutil.destroySandbox(__mysql_sandbox_port1);
@@ -0,0 +1,19 @@
+//@<> --debug-startup prints the startup timing
+testutil.callMysqlsh(["--sql", "--debug-startup", "-e", "SELECT 1"]);
+EXPECT_OUTPUT_CONTAINS("Startup timing:");
+EXPECT_OUTPUT_CONTAINS("  global initialization");
+EXPECT_OUTPUT_CONTAINS("  command line options");
+EXPECT_OUTPUT_CONTAINS("  shell");
+EXPECT_OUTPUT_CONTAINS("    initial mode");
+EXPECT_OUTPUT_CONTAINS("    plugins");
+EXPECT_OUTPUT_CONTAINS("  total");
+EXPECT_OUTPUT_NOT_CONTAINS("  connection");
+
+//@<> --debug-startup includes the connection
+testutil.callMysqlsh(["--sql", "--debug-startup", "--uri", __uripwd, "-e", "SELECT 1"]);
+EXPECT_OUTPUT_CONTAINS("Startup timing:");
+EXPECT_OUTPUT_CONTAINS("  connection");
+
+//@<> timing is not printed by default
+testutil.callMysqlsh(["--sql", "-e", "SELECT 1"]);
+EXPECT_OUTPUT_NOT_CONTAINS("Startup timing:");
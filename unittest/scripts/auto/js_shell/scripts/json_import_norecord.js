@@ -387,6 +387,23 @@ EXPECT_STDOUT_CONTAINS("Total successfully imported documents 25359 ");
 //@<OUT> E2 count
 session.sql("select count(1) from `" + target_schema + "`.`primer-dataset-id`");
 
+//@<> importJson using multiple threads
+util.importJson(__import_data_path + '/primer-dataset-id.json', {
+  schema : target_schema,
+  collection: 'primer-dataset-threads',
+  threads: 4
+});
+EXPECT_STDOUT_CONTAINS("Total successfully imported documents 25359 ");
+EXPECT_EQ(25359, session.getSchema(target_schema).getCollection('primer-dataset-threads').count());
+
+//@<> importJson using multiple threads - invalid value
+EXPECT_THROWS(function() {
+  util.importJson(__import_data_path + '/sample.json', {
+    schema : target_schema,
+    threads: 0
+  });
+}, "Util.importJson: The value of 'threads' option must be greater than 0.");
+
 //@ E3
 /// E3  Validate if user call mysqlsh user@host/mydb --import c:\bla.js blubb, we
 /// will create collection blubb if neither collection nor table exits. - DEV
@@ -80,12 +80,24 @@ result.help('fetchAll')
 //@ Help on fetchAll, \? [USE:Help on fetchAll]
 \? classicresult.fetchAll
 
+//@ Help on fetchMany
+result.help('fetchMany')
+
+//@ Help on fetchMany, \? [USE:Help on fetchMany]
+\? classicresult.fetchMany
+
 //@ Help on fetchOne
 result.help('fetchOne')
 
 //@ Help on fetchOne, \? [USE:Help on fetchOne]
 \? classicresult.fetchOne
 
+//@ Help on fetchOneInto
+result.help('fetchOneInto')
+
+//@ Help on fetchOneInto, \? [USE:Help on fetchOneInto]
+\? classicresult.fetchOneInto
+
 //@ Help on fetchOneObject
 result.help('fetchOneObject')
 
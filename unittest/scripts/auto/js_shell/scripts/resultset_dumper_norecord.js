@@ -187,6 +187,50 @@ EXPECT_STDOUT_CONTAINS_MULTILINE(`+------+------+------+------+------+----------
 | 0x01 | 0x02 | 0x05 | 0x09 | 0x11 | 0x00000000015695 | 0x00000000002AFC0C |
 +------+------+------+------+------+------------------+--------------------+`);
 
+//@<> table output with truncated values
+shell.options["resultFormat.tableSampleRows"] = 1;
+shell.options["resultFormat.tableOverflow"] = "truncate";
+testutil.wipeAllOutput();
+
+session.runSql("select 'abcde' as a, 1 as number union all select 'abcdefghij', 1234567");
+EXPECT_STDOUT_CONTAINS_MULTILINE(`+-------+--------+
+| a     | number |
++-------+--------+
+| abcde |      1 |
+| ab... | 123... |
++-------+--------+`);
+
+//@<> table output with wrapped values
+shell.options["resultFormat.tableOverflow"] = "wrap";
+testutil.wipeAllOutput();
+
+session.runSql("select 'abcde' as a, 1 as number union all select 'abcdefghij\\nxyz', 1234567");
+EXPECT_STDOUT_CONTAINS_MULTILINE(`+-------+--------+
+| a     | number |
++-------+--------+
+| abcde |      1 |
+| abcde | 123456 |
+| fghij |      7 |
+| xyz   |        |
++-------+--------+`);
+
+//@<> table output with widths from metadata
+shell.options["resultFormat.tableSampleRows"] = 0;
+testutil.wipeAllOutput();
+
+session.runSql("select cast('abc' as char(10)) as c");
+EXPECT_STDOUT_CONTAINS_MULTILINE(`+------------+
+| c          |
++------------+
+| abc        |
++------------+`);
+
+//@<> invalid table overflow
+EXPECT_THROWS(function () { shell.options["resultFormat.tableOverflow"] = "cut"; }, "The acceptable values for the option resultFormat.tableOverflow are: expand, truncate, wrap");
+
+shell.options["resultFormat.tableSampleRows"] = 1000;
+shell.options["resultFormat.tableOverflow"] = "expand";
+
 //@ Show Column Info Multiple Results
 function callMysqlsh(additional_args) {
   base_args = [__mysqluripwd, "--quiet-start=2"]
@@ -200,6 +244,9 @@ callMysqlsh(["--column-type-info", "--sql", "-e", "call bug34716739.my_proc()"])
 //@<> Multiple Results JSON Mode
 callMysqlsh(["--json=raw", "--sql", "-e", "call bug34716739.my_proc()"])
 
+//@<> Multiple Results JSON Stream Mode
+callMysqlsh(["--json=stream", "--sql", "-e", "call bug34716739.my_proc()"])
+
 //@<> cleanup
 session.runSql("DROP SCHEMA IF EXISTS bug34716739");
 session.runSql("DROP SCHEMA IF EXISTS resultset_dumper");
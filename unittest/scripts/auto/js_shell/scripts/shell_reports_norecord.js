@@ -116,6 +116,9 @@ shell.connect(__uripwd);
 //@ WL11263_TSF5_5 - use \watch command with an invalid -i value (above threshold) [USE: WL11263_TSF5_5 - use \watch command with an invalid --interval value (above threshold)]
 \watch query -i 86400.1
 
+//@ use \watch command with both --incremental and --nocls options
+\watch query --incremental --nocls SELECT 1
+
 // -----------------------------------------------------------------------------
 // WL11263_TSF2_5 - Validate that a report registered with an all lower-case name can be invoked by the \show command using all upper-case name.
 
@@ -297,6 +300,9 @@ shell.registerReport('invalid_report', 'print', function (){}, {'options' : [{'n
 //@ WL11263_TSF9_9 - Option duplicates --nocls
 shell.registerReport('invalid_report', 'print', function (){}, {'options' : [{'name': 'nocls'}]})
 
+//@ WL11263_TSF9_9 - Option duplicates --incremental
+shell.registerReport('invalid_report', 'print', function (){}, {'options' : [{'name': 'incremental'}]})
+
 //@ WL11263_TSF9_9 - Option duplicates --vertical in a 'list' type report
 shell.registerReport('invalid_report', 'list', function (){}, {'options' : [{'name': 'vertical'}]})
 
@@ -96,6 +96,9 @@ EXPECT_STDOUT_CONTAINS("--desc");
 // WL11651-TSFR11_1 - Display the help entry for the threads report, validate that the info include an entry for the --limit (-l) option.
 EXPECT_STDOUT_CONTAINS("--limit=integer, -l");
 
+EXPECT_STDOUT_CONTAINS("--sample=float");
+EXPECT_STDOUT_CONTAINS("--rate=integer");
+
 EXPECT_STDERR_EMPTY();
 
 //@ WL11651-TSFR2_2 - Run the threads report with the --foreground (-f) option, validate that the info displayed list all foreground threads.
@@ -875,6 +878,26 @@ var limit = 5;
 var result = shell.reports.threads(session, [], {'all': true, 'limit': limit}).report;
 EXPECT_EQ(limit, result.length - 1);
 
+//@ sample - statements are aggregated
+var result = shell.reports.threads(session, [], {'all': true, 'sample': 0.5, 'rate': 10, 'limit': 3}).report;
+EXPECT_EQ(["digest", "digesttxt", "user", "state", "samples", "load"], result[0]);
+EXPECT_TRUE(result.length <= 4);
+
+//@ sample - invalid value
+\show threads --sample 0
+
+//@ sample - cannot be used with format
+\show threads --sample 1 -o tid
+
+//@ sample - cannot be used with order-by
+\show threads --sample 1 --order-by tid
+
+//@ sample - invalid rate
+\show threads --sample 1 --rate 1001
+
+//@ sample - rate without sample
+\show threads --rate 10
+
 // -----------------------------------------------------------------------------
 // cleanup
 
@@ -0,0 +1,67 @@
+//@<> Initialization
+shell.connect(__mysqluripwd);
+session.runSql("drop schema if exists source_batch");
+session.runSql("create schema source_batch");
+session.runSql("create table source_batch.t (id int primary key, data text)");
+
+var script = os.path.join(__tmp_dir, "source_batch_size.sql");
+
+function callMysqlsh(args) {
+  WIPE_OUTPUT();
+  return testutil.callMysqlsh([__mysqluripwd, "--sql", "--file", script].concat(args));
+}
+
+function count_rows() {
+  return session.runSql("select count(*) from source_batch.t").fetchOne()[0];
+}
+
+//@<> statements are batched
+var lines = ["use source_batch;"];
+for (var i = 1; i <= 100; ++i) {
+  lines.push(`insert into t values (${i}, 'row ${i};');`);
+}
+lines.push("update t set data = 'updated' where id > 50;");
+lines.push("delete from t where id > 90; -- trailing comment");
+lines.push("select count(*) as total from t;");
+testutil.createFile(script, lines.join("\n"));
+
+EXPECT_EQ(0, callMysqlsh(["--source-batch-size=1000"]));
+EXPECT_OUTPUT_CONTAINS("90");
+EXPECT_EQ(90, count_rows());
+EXPECT_EQ(40, session.runSql("select count(*) from source_batch.t where data = 'updated'").fetchOne()[0]);
+
+//@<> error in a batch is reported with the line of the failed statement
+session.runSql("delete from source_batch.t");
+testutil.createFile(script, [
+  "use source_batch;",
+  "insert into t values (1, 'a');",
+  "insert into t values (2, 'b');",
+  "insert into t values (1, 'c');",
+  "insert into t values (3, 'd');"
+].join("\n"));
+
+EXPECT_EQ(1, callMysqlsh(["--source-batch-size=1000"]));
+EXPECT_OUTPUT_CONTAINS("at line 4: Duplicate entry '1' for key");
+EXPECT_EQ(2, count_rows());
+
+//@<> remaining statements are executed with --force
+session.runSql("delete from source_batch.t");
+callMysqlsh(["--source-batch-size=1000", "--force"]);
+EXPECT_OUTPUT_CONTAINS("at line 4: Duplicate entry '1' for key");
+EXPECT_EQ(3, count_rows());
+
+//@<> statements larger than the batch size are executed one by one
+session.runSql("delete from source_batch.t");
+testutil.createFile(script, [
+  "use source_batch;",
+  "insert into t values (1, 'a');",
+  "insert into t values (2, 'b');"
+].join("\n"));
+
+EXPECT_EQ(0, callMysqlsh(["--source-batch-size=1"]));
+EXPECT_EQ(2, count_rows());
+
+//@<> Cleanup
+session.runSql("drop schema source_batch");
+testutil.rmfile(script);
+session.close();
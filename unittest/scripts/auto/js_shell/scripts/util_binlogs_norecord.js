@@ -0,0 +1,140 @@
+//@<> Setup
+testutil.deploySandbox(__mysql_sandbox_port1, "root");
+testutil.deploySandbox(__mysql_sandbox_port2, "root");
+
+const schema = "binlogs_test";
+const tables = ["row_based", "statement_based", "types"];
+const dump_dir = __tmp_dir + "/binlogs_test";
+const instance_dump = dump_dir + "/instance";
+const binlogs_dump_1 = dump_dir + "/binlogs-1";
+const binlogs_dump_2 = dump_dir + "/binlogs-2";
+
+try { testutil.rmdir(dump_dir, true); } catch {}
+testutil.mkdir(dump_dir);
+
+shell.connect(__sandbox_uri1);
+
+session.runSql("DROP SCHEMA IF EXISTS !", [schema]);
+session.runSql("CREATE SCHEMA !", [schema]);
+session.runSql("CREATE TABLE !.row_based (id INT AUTO_INCREMENT PRIMARY KEY, data VARCHAR(32))", [schema]);
+session.runSql("CREATE TABLE !.statement_based (id INT AUTO_INCREMENT PRIMARY KEY, data VARCHAR(32))", [schema]);
+session.runSql("CREATE TABLE !.types (id INT PRIMARY KEY, d DECIMAL(10,4), f DOUBLE, j JSON, t DATETIME(6))", [schema]);
+session.runSql("INSERT INTO !.row_based (data) WITH RECURSIVE seq (n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < 1000) SELECT md5(n) FROM seq", [schema]);
+
+util.dumpInstance(instance_dump, { includeSchemas: [schema], showProgress: false });
+
+const target = mysql.getSession(__sandbox_uri2);
+target.runSql("SET GLOBAL local_infile = 1");
+
+shell.connect(__sandbox_uri2);
+util.loadDump(instance_dump, { showProgress: false, updateGtidSet: "append" });
+
+shell.connect(__sandbox_uri1);
+
+function write_transactions(offset) {
+  session.runSql("UPDATE !.row_based SET data = md5(data) WHERE id % 7 = ?", [schema, offset]);
+  session.runSql("DELETE FROM !.row_based WHERE id % 11 = ?", [schema, offset]);
+  session.runSql("INSERT INTO !.row_based (data) VALUES ('a'), ('b'), (NULL)", [schema]);
+  session.runSql("INSERT INTO !.types VALUES (?, -123.4567, 1.5e10, '{\"a\": [1, 2]}', NOW(6))", [schema, offset]);
+
+  session.runSql("SET SESSION binlog_format = 'STATEMENT'");
+  session.runSql("SET @v = 'variable'");
+  session.runSql("INSERT INTO !.statement_based (data) VALUES (@v)", [schema]);
+  session.runSql("INSERT INTO !.statement_based (data) VALUES (CONCAT('x', LAST_INSERT_ID()))", [schema]);
+  session.runSql("SET SESSION binlog_format = 'ROW'");
+
+  session.runSql("ALTER TABLE !.statement_based ADD COLUMN ! INT", [schema, "c" + offset]);
+}
+
+write_transactions(1);
+
+//@<> argument errors
+EXPECT_THROWS(function () { util.dumpBinlogs(binlogs_dump_1); }, "One of the 'since' or 'startFrom' options must be set.");
+EXPECT_THROWS(function () { util.dumpBinlogs(binlogs_dump_1, { since: instance_dump, startFrom: "binlog.000001" }); }, "The 'since' and 'startFrom' options cannot be both set.");
+EXPECT_THROWS(function () { util.dumpBinlogs(binlogs_dump_1, { since: instance_dump, threads: 0 }); }, "The value of 'threads' option must be greater than 0.");
+EXPECT_THROWS(function () { util.dumpBinlogs(binlogs_dump_1, { since: instance_dump, bytesPerChunk: "1k" }); }, "The value of 'bytesPerChunk' option must be greater than or equal to 128k.");
+EXPECT_THROWS(function () { util.dumpBinlogs(binlogs_dump_1, { since: dump_dir }); }, "given in the 'since' option does not contain a dump.");
+EXPECT_THROWS(function () { util.dumpBinlogs(binlogs_dump_1, { startFrom: "missing.000001" }); }, "The binary log file 'missing.000001' given in the 'startFrom' option does not exist.");
+EXPECT_THROWS(function () { util.dumpBinlogs(binlogs_dump_1, { since: instance_dump, invalid: 0 }); }, "Invalid options: invalid");
+
+EXPECT_THROWS(function () { util.loadBinlogs(binlogs_dump_1, { threads: 0 }); }, "The value of 'threads' option must be greater than 0.");
+EXPECT_THROWS(function () { util.loadBinlogs(binlogs_dump_1, { stopBefore: "invalid" }); }, "The value of 'stopBefore' option must be a single GTID without a tag.");
+EXPECT_THROWS(function () { util.loadBinlogs(instance_dump); }, "does not contain a complete dump of binary logs.");
+
+//@<> dryRun
+util.dumpBinlogs(binlogs_dump_1, { since: instance_dump, dryRun: true, showProgress: false });
+EXPECT_OUTPUT_CONTAINS("dryRun enabled, no data will be dumped.");
+EXPECT_FALSE(os.path.exists(binlogs_dump_1));
+
+//@<> dump binary logs since the dump of the instance
+session.runSql("FLUSH BINARY LOGS");
+write_transactions(2);
+
+util.dumpBinlogs(binlogs_dump_1, { since: instance_dump, threads: 2, showProgress: false });
+EXPECT_OUTPUT_CONTAINS("GTID set of the dumped transactions: ");
+EXPECT_TRUE(os.path.exists(binlogs_dump_1 + "/@.binlogs.json"));
+
+//@<> the output directory must be empty
+EXPECT_THROWS(function () { util.dumpBinlogs(binlogs_dump_1, { since: instance_dump, showProgress: false }); }, "already exists at the target location");
+
+//@<> load the dump of binary logs
+shell.connect(__sandbox_uri2);
+
+util.loadBinlogs(binlogs_dump_1, { dryRun: true, showProgress: false });
+EXPECT_OUTPUT_CONTAINS("dryRun enabled, no data will be loaded.");
+
+util.loadBinlogs(binlogs_dump_1, { showProgress: false });
+EXPECT_OUTPUT_CONTAINS("Loaded ");
+
+shell.connect(__sandbox_uri1);
+EXPECT_TRUE(util.compareTables(schema, tables, __sandbox_uri2).identical);
+EXPECT_EQ(1, target.runSql("SELECT GTID_SUBSET(?, @@GLOBAL.gtid_executed)", [session.runSql("SELECT @@GLOBAL.gtid_executed").fetchOne()[0]]).fetchOne()[0]);
+
+//@<> loading the same dump again skips all transactions
+shell.connect(__sandbox_uri2);
+util.loadBinlogs(binlogs_dump_1, { showProgress: false });
+EXPECT_OUTPUT_CONTAINS("All transactions in the dump were already executed by the target instance, nothing to load.");
+
+//@<> incremental dump since the previous dump of binary logs
+shell.connect(__sandbox_uri1);
+write_transactions(3);
+
+util.dumpBinlogs(binlogs_dump_2, { since: binlogs_dump_1, showProgress: false });
+
+//@<> stopBefore
+const gtids = session.runSql("SELECT GTID_SUBTRACT(@@GLOBAL.gtid_executed, ?)", [target.runSql("SELECT @@GLOBAL.gtid_executed").fetchOne()[0]]).fetchOne()[0];
+const uuid = gtids.split(":")[0];
+const last = gtids.match(/(\d+)$/)[1];
+const stop = `${uuid}:${last}`;
+
+shell.connect(__sandbox_uri2);
+util.loadBinlogs(binlogs_dump_2, { stopBefore: stop, showProgress: false });
+EXPECT_OUTPUT_CONTAINS(`Load was stopped before transaction ${stop}`);
+EXPECT_EQ(0, target.runSql("SELECT GTID_SUBSET(?, @@GLOBAL.gtid_executed)", [stop]).fetchOne()[0]);
+
+//@<> load the rest of the incremental dump
+util.loadBinlogs(binlogs_dump_2, { showProgress: false });
+
+shell.connect(__sandbox_uri1);
+EXPECT_TRUE(util.compareTables(schema, tables, __sandbox_uri2).identical);
+
+//@<> missing transactions are detected
+shell.connect(__sandbox_uri1);
+write_transactions(4);
+
+const binlogs_dump_3 = dump_dir + "/binlogs-3";
+util.dumpBinlogs(binlogs_dump_3, { since: binlogs_dump_2, showProgress: false });
+write_transactions(5);
+
+const binlogs_dump_4 = dump_dir + "/binlogs-4";
+util.dumpBinlogs(binlogs_dump_4, { since: binlogs_dump_3, showProgress: false });
+
+shell.connect(__sandbox_uri2);
+EXPECT_THROWS(function () { util.loadBinlogs(binlogs_dump_4, { showProgress: false }); }, "The target instance is missing transactions which were executed by the source instance before the first transaction in the dump");
+
+//@<> Cleanup
+target.close();
+session.close();
+testutil.rmdir(dump_dir, true);
+testutil.destroySandbox(__mysql_sandbox_port1);
+testutil.destroySandbox(__mysql_sandbox_port2);
@@ -0,0 +1,107 @@
+//@<> Setup
+testutil.deploySandbox(__mysql_sandbox_port1, "root");
+testutil.deploySandbox(__mysql_sandbox_port2, "root");
+
+const schema = "compare_test";
+
+function setup_instance(uri) {
+  const s = mysql.getSession(uri);
+  s.runSql("DROP SCHEMA IF EXISTS !", [schema]);
+  s.runSql("CREATE SCHEMA !", [schema]);
+  s.runSql("CREATE TABLE !.int_pk (id INT PRIMARY KEY, data VARCHAR(32))", [schema]);
+  s.runSql("CREATE TABLE !.str_pk (id VARCHAR(32) PRIMARY KEY, data INT)", [schema]);
+  s.runSql("CREATE TABLE !.no_pk (id INT, data INT)", [schema]);
+  s.runSql("INSERT INTO !.int_pk WITH RECURSIVE seq (n) AS (SELECT -5000 UNION ALL SELECT n + 1 FROM seq WHERE n < 4999) SELECT n, md5(n) FROM seq", [schema]);
+  s.runSql("INSERT INTO !.str_pk SELECT md5(id), id FROM !.int_pk", [schema, schema]);
+  s.runSql("INSERT INTO !.no_pk SELECT id, id FROM !.int_pk", [schema, schema]);
+  s.close();
+}
+
+setup_instance(__sandbox_uri1);
+setup_instance(__sandbox_uri2);
+
+shell.connect(__sandbox_uri1);
+
+//@<> argument errors
+EXPECT_THROWS(function () { util.compareTables(schema, [], __sandbox_uri2); }, "The tables parameter cannot be empty.");
+EXPECT_THROWS(function () { util.compareTables(schema, ["missing"], __sandbox_uri2); }, "The table `compare_test`.`missing` does not exist in the source instance.");
+EXPECT_THROWS(function () { util.compareTables(schema, ["int_pk"], __sandbox_uri2, { threads: 0 }); }, "The value of 'threads' option must be greater than 0.");
+EXPECT_THROWS(function () { util.compareTables(schema, ["int_pk"], __sandbox_uri2, { rangeRows: 0 }); }, "The value of 'rangeRows' option must be greater than 0.");
+EXPECT_THROWS(function () { util.compareTables(schema, ["int_pk"], __sandbox_uri2, { invalid: 0 }); }, "Invalid options: invalid");
+
+//@<> identical tables
+var result = util.compareTables(schema, ["int_pk", "str_pk", "no_pk"], __sandbox_uri2);
+
+EXPECT_TRUE(result.identical);
+
+for (const table of ["int_pk", "str_pk", "no_pk"]) {
+  EXPECT_TRUE(result.tables[table].identical);
+  EXPECT_EQ(10000, result.tables[table].sourceRows);
+  EXPECT_EQ(10000, result.tables[table].targetRows);
+  EXPECT_EQ(1, result.tables[table].rangesCompared);
+  EXPECT_EQ([], result.tables[table].differences);
+  EXPECT_OUTPUT_CONTAINS(`Table \`${schema}\`.\`${table}\` is identical.`);
+}
+
+//@<> differences are found by comparing the ranges
+const target = mysql.getSession(__sandbox_uri2);
+target.runSql("DELETE FROM !.int_pk WHERE id = -4321", [schema]);
+target.runSql("UPDATE !.int_pk SET data = 'changed' WHERE id = 17", [schema]);
+target.runSql("INSERT INTO !.int_pk VALUES (7777, 'extra')", [schema]);
+
+result = util.compareTables(schema, ["int_pk"], __sandbox_uri2, { rangeRows: 100 });
+
+EXPECT_FALSE(result.identical);
+EXPECT_FALSE(result.tables.int_pk.identical);
+EXPECT_EQ(10000, result.tables.int_pk.sourceRows);
+EXPECT_EQ(10000, result.tables.int_pk.targetRows);
+EXPECT_FALSE(result.tables.int_pk.truncated);
+EXPECT_EQ([
+  { key: { id: -4321 }, type: "missing" },
+  { key: { id: 17 }, type: "different" },
+  { key: { id: 7777 }, type: "extra" },
+], result.tables.int_pk.differences.sort((a, b) => a.key.id - b.key.id));
+// only the ranges which differ are compared row by row
+EXPECT_LT(result.tables.int_pk.rowsCompared, 1000);
+EXPECT_GT(result.tables.int_pk.rangesCompared, 1);
+EXPECT_OUTPUT_CONTAINS(`Table \`${schema}\`.\`int_pk\` differs, 3 row differences found after comparing`);
+
+//@<> maxDifferences
+result = util.compareTables(schema, ["int_pk"], __sandbox_uri2, { rangeRows: 100, maxDifferences: 1, threads: 1 });
+
+EXPECT_FALSE(result.identical);
+EXPECT_EQ(1, result.tables.int_pk.differences.length);
+EXPECT_TRUE(result.tables.int_pk.truncated);
+
+//@<> table with a non-integer key is compared row by row
+target.runSql("UPDATE !.str_pk SET data = 0 WHERE data = 100", [schema]);
+
+result = util.compareTables(schema, ["str_pk"], __sandbox_uri2);
+
+EXPECT_FALSE(result.identical);
+EXPECT_EQ(1, result.tables.str_pk.rangesCompared);
+EXPECT_EQ(10000, result.tables.str_pk.rowsCompared);
+EXPECT_EQ([{ key: { id: session.runSql("SELECT md5(100)").fetchOne()[0] }, type: "different" }], result.tables.str_pk.differences);
+
+//@<> table without a key
+target.runSql("UPDATE !.no_pk SET data = 0 WHERE data = 100", [schema]);
+
+result = util.compareTables(schema, ["no_pk"], __sandbox_uri2);
+
+EXPECT_FALSE(result.identical);
+EXPECT_EQ([], result.tables.no_pk.differences);
+EXPECT_CONTAINS("rows which differ cannot be identified", result.tables.no_pk.warning);
+
+//@<> table missing in the target instance
+target.runSql("DROP TABLE !.no_pk", [schema]);
+
+result = util.compareTables(schema, ["no_pk"], __sandbox_uri2);
+
+EXPECT_FALSE(result.identical);
+EXPECT_EQ("Table does not exist in the target instance.", result.tables.no_pk.warning);
+
+//@<> Cleanup
+target.close();
+session.close();
+testutil.destroySandbox(__mysql_sandbox_port1);
+testutil.destroySandbox(__mysql_sandbox_port2);
@@ -59,6 +59,18 @@ EXPECT_THROWS(function () {
 }, "Invalid preconditions");
 EXPECT_STDOUT_CONTAINS("The 'local_infile' global system variable must be set to ON in the target server, after the server is verified to be trusted.");
 
+//@<> Load using INSERT statements if MySQL Server config option local_infile is false
+WIPE_STDOUT();
+util.importTable(__import_data_path + '/world_x_cities.dump', { schema: target_schema, table: 'cities', fallbackToInsert: true, showProgress: false });
+EXPECT_STDOUT_CONTAINS("NOTE: The 'local_infile' global system variable is set to OFF in the target server, data is going to be loaded using INSERT statements.");
+EXPECT_STDOUT_CONTAINS("Total rows affected in " + target_schema + ".cities: Records: 4079  Deleted: 0  Skipped: 0  Warnings: 0");
+EXPECT_EQ(4079, session.runSql(`SELECT COUNT(*) FROM ${target_schema}.cities`).fetchOne()[0]);
+session.runSql(`TRUNCATE TABLE ${target_schema}.cities`);
+
+//@<> columns with user variable bindings cannot be loaded using INSERT statements
+EXPECT_THROWS(function () {
+    util.importTable(__import_data_path + '/world_x_cities.dump', { schema: target_schema, table: 'cities', fallbackToInsert: true, columns: ['ID', 1] });
+}, "User variable bindings in the 'columns' option are not supported when data is loaded using INSERT statements.");
 
 //@<> Set local_infile to true
 session.runSql('SET GLOBAL local_infile = true');
@@ -662,6 +674,43 @@ EXPECT_THROWS(function () {
     });
 }, "Util.importTable: Argument #2: The 'columns' option must be a non-empty list.");
 
+//@<> deferTableIndexes - invalid value
+EXPECT_THROWS(function () {
+    util.importTable(__import_data_path + '/world_x_cities.dump', { schema: target_schema, table: 'cities', deferTableIndexes: 'xxx' });
+}, "Util.importTable: Argument #2: Invalid value 'xxx' for deferTableIndexes option");
+
+//@<> deferTableIndexes - setup
+session.runSql("CREATE TABLE !.`cities_indexes` (`ID` int NOT NULL AUTO_INCREMENT, `Name` char(64) NOT NULL DEFAULT '', `CountryCode` char(3) NOT NULL DEFAULT '', `District` char(64) NOT NULL DEFAULT '', `Info` json DEFAULT NULL, PRIMARY KEY (`ID`), UNIQUE KEY `id_name` (`ID`, `Name`), KEY `code` (`CountryCode`), FULLTEXT KEY `district` (`District`), FULLTEXT KEY `name` (`Name`)) ENGINE=InnoDB", [target_schema]);
+const indexes_ddl = session.runSql("SHOW CREATE TABLE !.`cities_indexes`", [target_schema]).fetchOne()[1];
+
+//@<> deferTableIndexes - fulltext
+WIPE_OUTPUT();
+EXPECT_NO_THROWS(() => util.importTable(__import_data_path + '/world_x_cities.dump', { schema: target_schema, table: 'cities_indexes', deferTableIndexes: 'fulltext' }));
+EXPECT_OUTPUT_CONTAINS("Dropping 2 secondary indexes of table `wl12193`.`cities_indexes`, they will be recreated after the import.");
+EXPECT_OUTPUT_CONTAINS("Recreating indexes of table `wl12193`.`cities_indexes`");
+EXPECT_OUTPUT_CONTAINS("Indexes were recreated in ");
+EXPECT_EQ(4079, session.runSql("SELECT COUNT(*) FROM !.`cities_indexes`", [target_schema]).fetchOne()[0]);
+EXPECT_EQ(indexes_ddl, session.runSql("SHOW CREATE TABLE !.`cities_indexes`", [target_schema]).fetchOne()[1]);
+
+//@<> deferTableIndexes - all
+session.runSql("TRUNCATE TABLE !.`cities_indexes`", [target_schema]);
+WIPE_OUTPUT();
+EXPECT_NO_THROWS(() => util.importTable(__import_data_path + '/world_x_cities.dump', { schema: target_schema, table: 'cities_indexes', deferTableIndexes: 'all' }));
+// unique key is not dropped
+EXPECT_OUTPUT_CONTAINS("Dropping 3 secondary indexes of table `wl12193`.`cities_indexes`, they will be recreated after the import.");
+EXPECT_EQ(4079, session.runSql("SELECT COUNT(*) FROM !.`cities_indexes`", [target_schema]).fetchOne()[0]);
+EXPECT_EQ(indexes_ddl, session.runSql("SHOW CREATE TABLE !.`cities_indexes`", [target_schema]).fetchOne()[1]);
+
+//@<> deferTableIndexes - table without secondary indexes
+WIPE_OUTPUT();
+session.runSql("TRUNCATE TABLE !.`cities`", [target_schema]);
+EXPECT_NO_THROWS(() => util.importTable(__import_data_path + '/world_x_cities.dump', { schema: target_schema, table: 'cities', deferTableIndexes: 'all' }));
+EXPECT_OUTPUT_NOT_CONTAINS("Dropping ");
+EXPECT_OUTPUT_NOT_CONTAINS("Recreating indexes");
+
+//@<> deferTableIndexes - cleanup
+session.runSql("DROP TABLE !.`cities_indexes`", [target_schema]);
+
 //@<> Teardown
 session.runSql("DROP SCHEMA IF EXISTS " + target_schema);
 session.close();
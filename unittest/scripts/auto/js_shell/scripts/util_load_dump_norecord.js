@@ -299,6 +299,16 @@ if(__version_num<80000) session.runSql("SET GLOBAL local_infile=0");
 EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump");}, "Util.loadDump: local_infile disabled in server");
 EXPECT_OUTPUT_CONTAINS("ERROR: The 'local_infile' global system variable must be set to ON in the target server, after the server is verified to be trusted.");
 
+//@<> Load the dump using INSERT statements with local-infile disabled
+WIPE_OUTPUT();
+EXPECT_NO_THROWS(function () { util.loadDump(__tmp_dir+"/ldtest/dump", { fallbackToInsert: true, progressFile: "", showProgress: false }); });
+EXPECT_OUTPUT_CONTAINS("NOTE: The 'local_infile' global system variable is set to OFF in the target server, data is going to be loaded using INSERT statements.");
+
+// users not loaded, so don't compare accounts list
+EXPECT_DUMP_LOADED_IGNORE_ACCOUNTS(session);
+
+wipe_instance(session);
+
 //@<> Enable local-infile for the remaining tests
 session.runSql("SET GLOBAL local_infile=1");
 
@@ -1100,6 +1110,26 @@ if(__version_num>80000) {
   EXPECT_OUTPUT_CONTAINS("WARNING: Histogram creation enabled but MySQL Server "+__version+" does not support it.");
 }
 
+//@<> Load everything and analyze tables once data and indexes are loaded
+wipe_instance(session);
+testutil.rmfile(__tmp_dir+"/ldtest/dump-sakila/load-progress*");
+WIPE_SHELL_LOG();
+WIPE_OUTPUT();
+util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {analyzeTables: "on", deferTableAnalysis: true, deferTableIndexes: "all"});
+
+EXPECT_OUTPUT_CONTAINS("Data and indexes are loaded, the database is ready to be used.");
+EXPECT_OUTPUT_CONTAINS("Analyzing tables in the background using 1 thread");
+EXPECT_SHELL_LOG_CONTAINS("Recreating indexes for `sakila`.`store`");
+EXPECT_SHELL_LOG_CONTAINS("Analyzing table `sakila`.`store`");
+EXPECT_SHELL_LOG_CONTAINS("Analyzing table `sakila`.`film_actor`");
+
+//@<> Deferred table analysis is resumed
+WIPE_SHELL_LOG();
+util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {analyzeTables: "on", deferTableAnalysis: true, deferTableIndexes: "all"});
+
+EXPECT_SHELL_LOG_CONTAINS("Table `sakila`.`store` was already analyzed");
+EXPECT_SHELL_LOG_NOT_CONTAINS("Analyzing table `sakila`.`store`");
+
 //@<> Load everything with fulltext index deferment (the default)
 wipe_instance(session);
 testutil.rmfile(__tmp_dir+"/ldtest/dump-sakila/load-progress*");
@@ -1342,6 +1372,200 @@ EXPECT_FILE_NOT_EXISTS(__tmp_dir+"/ldtest/dump/load-progress."+uuid+".json");
 EXPECT_EQ(old_gtid_executed, new_gtid_executed);
 EXPECT_STDOUT_CONTAINS("Appending dumped gtid set to GTID_PURGED");
 
+//@<> prefetchMemory option
+shell.connect(__sandbox_uri1);
+wipe_instance(session);
+
+EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump", {prefetchMemory: ""});}, "Util.loadDump: Argument #2: The option 'prefetchMemory' cannot be set to an empty string.");
+EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump", {prefetchMemory: "xyz"});}, 'Util.loadDump: Argument #2: Wrong input number "xyz"');
+
+// option is ignored when loading from a local directory
+EXPECT_NO_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump", {prefetchMemory: "1M", dryRun: true});});
+EXPECT_NO_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump", {prefetchMemory: "0", dryRun: true});});
+
+//@<> indexThreads and indexBufferSize options
+EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump", {indexThreads: -1});}, "Util.loadDump: Argument #2: Option 'indexThreads' UInteger expected, but Integer value is out of range");
+EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump", {indexBufferSize: ""});}, "Util.loadDump: Argument #2: The option 'indexBufferSize' cannot be set to an empty string.");
+EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump", {indexBufferSize: "xyz"});}, 'Util.loadDump: Argument #2: Wrong input number "xyz"');
+
+if (__version_num < 80027) {
+  EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump", {indexBufferSize: "1M"});}, "Util.loadDump: Argument #2: The 'indexBufferSize' option requires the target server to be MySQL 8.0.27 or newer.");
+}
+
+let index_count = undefined;
+
+for (const index_threads of [0, 1, 4]) {
+  wipe_instance(session);
+  testutil.rmfile(__tmp_dir+"/ldtest/dump-sakila/load-progress*");
+  WIPE_SHELL_LOG();
+
+  const options = {deferTableIndexes: "all", indexThreads: index_threads, showProgress: false};
+
+  if (__version_num >= 80027) {
+    options.indexBufferSize = "2M";
+  }
+
+  EXPECT_NO_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", options);}, `indexThreads: ${index_threads}`);
+  EXPECT_SHELL_LOG_CONTAINS("Recreating indexes for `sakila`.`film_text`");
+
+  const count = session.runSql("SELECT COUNT(*) FROM information_schema.statistics WHERE table_schema = 'sakila'").fetchOne()[0];
+
+  if (undefined === index_count) {
+    index_count = count;
+  } else {
+    EXPECT_EQ(index_count, count, `indexThreads: ${index_threads}`);
+  }
+}
+
+//@<> fastLoad option
+function redo_log_enabled() {
+  return session.runSql("SELECT VARIABLE_VALUE FROM performance_schema.global_status WHERE variable_name = 'Innodb_redo_log_enabled'").fetchOne()[0];
+}
+
+wipe_instance(session);
+testutil.rmfile(__tmp_dir+"/ldtest/dump-sakila/load-progress*");
+
+if (__version_num < 80021) {
+  EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {fastLoad: true});}, "Util.loadDump: Argument #2: The 'fastLoad' option requires the target server to be MySQL 8.0.21 or newer.");
+} else {
+  // other connections are not allowed
+  const other = mysql.getSession(__sandbox_uri1);
+  EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {fastLoad: true});}, "Util.loadDump: Argument #2: The 'fastLoad' option cannot be used, the target instance has 1 other client connection(s).");
+  other.close();
+
+  WIPE_OUTPUT();
+  EXPECT_NO_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {fastLoad: true, showProgress: false});});
+  EXPECT_OUTPUT_CONTAINS("WARNING: The redo log has been disabled, MySQL is not crash safe until the load completes and the redo log is enabled again.");
+  EXPECT_OUTPUT_CONTAINS("Enabling the redo log");
+  EXPECT_OUTPUT_NOT_CONTAINS("The redo log is currently disabled");
+  EXPECT_EQ("ON", redo_log_enabled());
+
+  if (__version_num >= 80030) {
+    EXPECT_EQ("ON", session.runSql("SELECT @@GLOBAL.innodb_doublewrite").fetchOne()[0]);
+  }
+}
+
+//@<> minThreads option
+EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {minThreads: 0});}, "Util.loadDump: Argument #2: The value of the 'minThreads' option must be a positive integer not greater than the value of the 'threads' option.");
+EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {threads: 2, minThreads: 3});}, "Util.loadDump: Argument #2: The value of the 'minThreads' option must be a positive integer not greater than the value of the 'threads' option.");
+
+wipe_instance(session);
+testutil.rmfile(__tmp_dir+"/ldtest/dump-sakila/load-progress*");
+
+WIPE_OUTPUT();
+EXPECT_NO_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {threads: 4, minThreads: 1, showProgress: false});});
+EXPECT_OUTPUT_CONTAINS("NOTE: The number of threads is going to be adjusted between 1 and 4, depending on the load of the target instance.");
+EXPECT_OUTPUT_CONTAINS("0 warnings were reported during the load.");
+
+//@<> maxMemory option
+EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {maxMemory: ""});}, "Util.loadDump: Argument #2: The option 'maxMemory' cannot be set to an empty string.");
+
+wipe_instance(session);
+testutil.rmfile(__tmp_dir+"/ldtest/dump-sakila/load-progress*");
+
+// limit which is lower than the memory needed by a single thread
+WIPE_OUTPUT();
+EXPECT_NO_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {threads: 4, maxMemory: "1k", showProgress: false});});
+EXPECT_OUTPUT_CONTAINS("Peak memory usage of the data buffers: ");
+EXPECT_OUTPUT_CONTAINS("0 warnings were reported during the load.");
+
+//@<> chunkWindow option
+EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {chunkWindow: 0});}, "Util.loadDump: Argument #2: The value of the 'chunkWindow' option must be a positive integer.");
+
+wipe_instance(session);
+testutil.rmfile(__tmp_dir+"/ldtest/dump-sakila/load-progress*");
+
+WIPE_OUTPUT();
+EXPECT_NO_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {threads: 4, chunkWindow: 1, showProgress: false});});
+EXPECT_OUTPUT_CONTAINS("0 warnings were reported during the load.");
+
+//@<> performanceReport option
+wipe_instance(session);
+testutil.rmfile(__tmp_dir+"/ldtest/dump-sakila/load-progress*");
+
+const report_file = __tmp_dir+"/ldtest/load-perf.json";
+
+WIPE_OUTPUT();
+EXPECT_NO_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {threads: 4, performanceReport: report_file, showProgress: false});});
+EXPECT_OUTPUT_CONTAINS("Thread utilization: ");
+
+const report = JSON.parse(os.loadTextFile(report_file));
+EXPECT_EQ(4, report.threads);
+EXPECT_EQ(4, report.workers.length);
+EXPECT_LT(0, report.tasks.loadChunk.count);
+EXPECT_LT(0, report.tasks.tableDdl.count);
+EXPECT_EQ(report.tasks.loadChunk.count, report.workers.reduce((sum, w) => sum + w.tasks.loadChunk.count, 0));
+// dump is stored locally
+EXPECT_EQ(0, report.storageSeconds);
+
+testutil.rmfile(report_file);
+
+//@<> statusFile option
+wipe_instance(session);
+testutil.rmfile(__tmp_dir+"/ldtest/dump-sakila/load-progress*");
+
+const status_file = __tmp_dir+"/ldtest/load-status.json";
+
+WIPE_OUTPUT();
+EXPECT_NO_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {threads: 4, statusFile: status_file, showProgress: false});});
+EXPECT_OUTPUT_CONTAINS("0 warnings were reported during the load.");
+
+// final status is written once the load completes
+const status = JSON.parse(os.loadTextFile(status_file));
+EXPECT_EQ("Load dump", status.operation);
+EXPECT_EQ("completed", status.state);
+EXPECT_EQ(4, status.details.threads.total);
+EXPECT_EQ(4, status.details.workers.length);
+EXPECT_TRUE(status.details.workers.every(w => w.task == "idle"));
+EXPECT_EQ(0, status.details.pendingTasks);
+EXPECT_EQ(0, status.details.bytesInFlight);
+EXPECT_LT(0, status.details.bytesLoaded);
+EXPECT_LT(0, status.details.rowsLoaded);
+
+// status file can be displayed using a report
+const status_report = shell.reports.dump_progress(session, [status_file]);
+EXPECT_EQ(status.state, status_report.report[0].state);
+EXPECT_EQ(status.details.bytesLoaded, status_report.report[0].details.bytesLoaded);
+
+testutil.rmfile(status_file);
+
+EXPECT_THROWS(function () {shell.reports.dump_progress(session, [status_file]);}, `Could not read the status file '${status_file}'`);
+
+//@<> progressFormat option
+EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {progressFd: 2});}, "Util.loadDump: Argument #2: The 'progressFd' option requires the 'progressFormat' option to be set to 'jsonl'.");
+EXPECT_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {progressFormat: "jsonl", progressFd: -1});}, "Util.loadDump: Argument #2: The value of 'progressFd' option must be an open file descriptor.");
+EXPECT_THROWS(function () {util.dumpSchemas(["sakila"], __tmp_dir+"/ldtest/dump-jsonl", {progressFd: 2});}, "Util.dumpSchemas: Argument #3: The 'progressFd' option requires the 'progressFormat' option to be set to 'jsonl'.");
+
+wipe_instance(session);
+testutil.rmfile(__tmp_dir+"/ldtest/dump-sakila/load-progress*");
+
+WIPE_OUTPUT();
+EXPECT_NO_THROWS(function () {util.loadDump(__tmp_dir+"/ldtest/dump-sakila", {progressFormat: "jsonl", showProgress: true});});
+EXPECT_OUTPUT_CONTAINS("0 warnings were reported during the load.");
+
+//@<> chunk file checksums
+const crc_dump = __tmp_dir+"/ldtest/dump-crc";
+util.dumpSchemas(["sakila"], crc_dump, {compression: "none", showProgress: false});
+
+const done = JSON.parse(os.loadTextFile(crc_dump + "/@.done.json"));
+EXPECT_EQ(Object.keys(done.chunkFileBytes).sort(), Object.keys(done.chunkFileCrc32c).sort());
+
+// dump is verified while it's loaded
+wipe_instance(session);
+EXPECT_NO_THROWS(function () {util.loadDump(crc_dump, {showProgress: false});});
+
+// corrupt one of the data files, keep its size
+const corrupted_file = crc_dump + "/" + Object.keys(done.chunkFileBytes).filter(f => f.startsWith("sakila@actor@"))[0];
+const contents = os.loadTextFile(corrupted_file);
+testutil.createFile(corrupted_file, contents.substring(0, 10) + (contents[10] == "X" ? "Y" : "X") + contents.substring(11));
+
+wipe_instance(session);
+EXPECT_THROWS(function () {util.loadDump(crc_dump, {showProgress: false});}, "Error loading dump");
+EXPECT_OUTPUT_CONTAINS("Checksum mismatch of file");
+
+testutil.rmdir(crc_dump, true);
+wipe_instance(session);
+
 //@<> Cleanup
 testutil.destroySandbox(__mysql_sandbox_port1);
 testutil.rmdir(__tmp_dir+"/ldtest", true);
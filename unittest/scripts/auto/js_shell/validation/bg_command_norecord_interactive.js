@@ -0,0 +1,22 @@
+//@ Statement executed in the background
+|[1] Started, connection id|
+|[1] INSERT INTO t VALUES (1), (2), (3)|
+|Query OK, 3 rows affected, 0 warnings|
+
+//@ Background statement uses the current schema
+|[2] Started, connection id|
+|[2] SELECT * FROM t|
+|3 rows in set, 0 warnings|
+
+//@ Background statement which fails
+|[3] Started, connection id|
+|[3] INSERT INTO t VALUES (1)|
+|Duplicate entry '1' for key|
+
+//@ No background statements
+|There are no background statements.|
+
+//@ Invalid arguments
+||Usage: \bg <statement>
+||Background statement [100] does not exist.
+||Invalid background statement id: invalid
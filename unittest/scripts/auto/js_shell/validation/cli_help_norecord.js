@@ -84,6 +84,10 @@ The following operations are available at 'util':
       instance. Requires an open global Shell session to the source instance,
       if there is none, an exception is raised.
 
+   dump-binlogs
+      Dumps binary logs generated since a specific point in time to the given
+      local or remote directory.
+
    dump-instance
       Dumps the whole database to files in the output directory.
 
@@ -105,6 +109,10 @@ The following operations are available at 'util':
       Import table dump stored in files to target table using LOAD DATA LOCAL
       INFILE calls in parallel connections.
 
+   load-binlogs
+      Loads binary log dumps created by MySQL Shell from a local or remote
+      directory.
+
    load-dump
       Loads database dumps created by MySQL Shell.
 
@@ -217,6 +225,10 @@ OPTIONS
 --configPath=<str>
             Full path to MySQL server configuration file.
 
+--threads=<uint>
+            Number of concurrent sessions used to execute the checks
+            (default=1).
+
 //@<OUT> CLI util copy-instance --help
 NAME
       copy-instance - Copies a source instance to the target instance. Requires
@@ -235,10 +247,30 @@ OPTIONS
             Limit data read throughput to maximum rate, measured in bytes per
             second per thread. Use maxRate="0" to set no limit. Default: "0".
 
+--maxTotalRate=<str>
+            Limit the combined data read throughput of all threads, measured in
+            bytes per second, regardless of the number of threads. Can be used
+            together with maxRate. Use maxTotalRate="0" to set no limit.
+            Default: "0".
+
 --showProgress=<bool>
             Enable or disable copy progress information. Default: true if
             stdout is a TTY device, false otherwise.
 
+--pipelinedFetch=<bool>
+            Use an additional thread for each thread reading the data to fetch
+            rows from the source server, while that thread writes the previously
+            fetched rows. Has no effect if the X Protocol is used. Default:
+            false.
+
+--sessionCompression=<str>
+            Protocol compression used by the sessions which read the data from
+            the source instance and by the sessions which load it into the
+            target instance. Allowed values: auto, off, zstd, zlib. When set to
+            auto, zstd compression is enabled if the connection to the server is
+            slow, unless compression was already configured in the connection
+            options. Default: "auto".
+
 --defaultCharacterSet=<str>
             Character set used for the copy. Default: "utf8mb4".
 
@@ -249,6 +281,16 @@ OPTIONS
             Sets average estimated number of bytes to be copied in each chunk,
             enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Adjust the number of rows in each chunk using the throughput
+            measured on the already copied chunks of the same table, so that all
+            chunks take a similar amount of time to copy. Default: false.
+
+--stealChunks=<bool>
+            Allow threads which have no more work to take over the uncopied part
+            of the chunks which are being copied by other threads. Default:
+            false.
+
 --threads=<uint>
             Use N threads to read the data from the source server and
             additional N threads to write the data to the target server.
@@ -420,6 +462,19 @@ OPTIONS
             continues, "ignore": ignores the error and continues copying the
             account.
 
+--memoryLimit=<str>
+            Limits the memory used to hold the DDL and metadata files which are
+            waiting to be loaded. Once the limit is reached, contents of these
+            files are moved to a scratch directory. Table data is streamed
+            directly to the target instance and is not subject to this limit.
+            Supports unit suffixes: k (kilobytes), M (Megabytes), G (Gigabytes).
+            Use memoryLimit="0" to set no limit. Default: "0".
+
+--spillDirectory=<str>
+            Directory where the scratch files are created once memoryLimit is
+            reached. They are removed when the copy finishes. Default: the
+            system temporary directory.
+
 //@<OUT> CLI util copy-schemas --help
 NAME
       copy-schemas - Copies schemas from the source instance to the target
@@ -439,10 +494,30 @@ OPTIONS
             Limit data read throughput to maximum rate, measured in bytes per
             second per thread. Use maxRate="0" to set no limit. Default: "0".
 
+--maxTotalRate=<str>
+            Limit the combined data read throughput of all threads, measured in
+            bytes per second, regardless of the number of threads. Can be used
+            together with maxRate. Use maxTotalRate="0" to set no limit.
+            Default: "0".
+
 --showProgress=<bool>
             Enable or disable copy progress information. Default: true if
             stdout is a TTY device, false otherwise.
 
+--pipelinedFetch=<bool>
+            Use an additional thread for each thread reading the data to fetch
+            rows from the source server, while that thread writes the previously
+            fetched rows. Has no effect if the X Protocol is used. Default:
+            false.
+
+--sessionCompression=<str>
+            Protocol compression used by the sessions which read the data from
+            the source instance and by the sessions which load it into the
+            target instance. Allowed values: auto, off, zstd, zlib. When set to
+            auto, zstd compression is enabled if the connection to the server is
+            slow, unless compression was already configured in the connection
+            options. Default: "auto".
+
 --defaultCharacterSet=<str>
             Character set used for the copy. Default: "utf8mb4".
 
@@ -453,6 +528,16 @@ OPTIONS
             Sets average estimated number of bytes to be copied in each chunk,
             enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Adjust the number of rows in each chunk using the throughput
+            measured on the already copied chunks of the same table, so that all
+            chunks take a similar amount of time to copy. Default: false.
+
+--stealChunks=<bool>
+            Allow threads which have no more work to take over the uncopied part
+            of the chunks which are being copied by other threads. Default:
+            false.
+
 --threads=<uint>
             Use N threads to read the data from the source server and
             additional N threads to write the data to the target server.
@@ -604,6 +689,19 @@ OPTIONS
             continues, "ignore": ignores the error and continues copying the
             account.
 
+--memoryLimit=<str>
+            Limits the memory used to hold the DDL and metadata files which are
+            waiting to be loaded. Once the limit is reached, contents of these
+            files are moved to a scratch directory. Table data is streamed
+            directly to the target instance and is not subject to this limit.
+            Supports unit suffixes: k (kilobytes), M (Megabytes), G (Gigabytes).
+            Use memoryLimit="0" to set no limit. Default: "0".
+
+--spillDirectory=<str>
+            Directory where the scratch files are created once memoryLimit is
+            reached. They are removed when the copy finishes. Default: the
+            system temporary directory.
+
 //@<OUT> CLI util copy-tables --help
 NAME
       copy-tables - Copies tables and views from schema in the source instance
@@ -625,10 +723,30 @@ OPTIONS
             Limit data read throughput to maximum rate, measured in bytes per
             second per thread. Use maxRate="0" to set no limit. Default: "0".
 
+--maxTotalRate=<str>
+            Limit the combined data read throughput of all threads, measured in
+            bytes per second, regardless of the number of threads. Can be used
+            together with maxRate. Use maxTotalRate="0" to set no limit.
+            Default: "0".
+
 --showProgress=<bool>
             Enable or disable copy progress information. Default: true if
             stdout is a TTY device, false otherwise.
 
+--pipelinedFetch=<bool>
+            Use an additional thread for each thread reading the data to fetch
+            rows from the source server, while that thread writes the previously
+            fetched rows. Has no effect if the X Protocol is used. Default:
+            false.
+
+--sessionCompression=<str>
+            Protocol compression used by the sessions which read the data from
+            the source instance and by the sessions which load it into the
+            target instance. Allowed values: auto, off, zstd, zlib. When set to
+            auto, zstd compression is enabled if the connection to the server is
+            slow, unless compression was already configured in the connection
+            options. Default: "auto".
+
 --defaultCharacterSet=<str>
             Character set used for the copy. Default: "utf8mb4".
 
@@ -639,6 +757,16 @@ OPTIONS
             Sets average estimated number of bytes to be copied in each chunk,
             enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Adjust the number of rows in each chunk using the throughput
+            measured on the already copied chunks of the same table, so that all
+            chunks take a similar amount of time to copy. Default: false.
+
+--stealChunks=<bool>
+            Allow threads which have no more work to take over the uncopied part
+            of the chunks which are being copied by other threads. Default:
+            false.
+
 --threads=<uint>
             Use N threads to read the data from the source server and
             additional N threads to write the data to the target server.
@@ -763,6 +891,19 @@ OPTIONS
             continues, "ignore": ignores the error and continues copying the
             account.
 
+--memoryLimit=<str>
+            Limits the memory used to hold the DDL and metadata files which are
+            waiting to be loaded. Once the limit is reached, contents of these
+            files are moved to a scratch directory. Table data is streamed
+            directly to the target instance and is not subject to this limit.
+            Supports unit suffixes: k (kilobytes), M (Megabytes), G (Gigabytes).
+            Use memoryLimit="0" to set no limit. Default: "0".
+
+--spillDirectory=<str>
+            Directory where the scratch files are created once memoryLimit is
+            reached. They are removed when the copy finishes. Default: the
+            system temporary directory.
+
 //@<OUT> CLI util dump-instance --help
 NAME
       dump-instance - Dumps the whole database to files in the output
@@ -779,13 +920,57 @@ OPTIONS
             Limit data read throughput to maximum rate, measured in bytes per
             second per thread. Use maxRate="0" to set no limit. Default: "0".
 
+--maxTotalRate=<str>
+            Limit the combined data read throughput of all threads, measured in
+            bytes per second, regardless of the number of threads. Can be used
+            together with maxRate. Use maxTotalRate="0" to set no limit.
+            Default: "0".
+
 --showProgress=<bool>
             Enable or disable dump progress information. Default: true if
             stdout is a TTY device, false otherwise.
 
+--progressFormat=<str>
+            Format of the progress information. Allowed values: text, jsonl.
+            When set to jsonl, progress is not displayed, instead it is written
+            as a stream of events, one JSON document per line, to the file
+            descriptor specified by the progressFd option. Default: "text".
+
+--progressFd=<int>
+            File descriptor the progress events are written to. Can only be used
+            if progressFormat is set to jsonl. Default: 2.
+
+--pipelinedFetch=<bool>
+            Use an additional thread for each dump thread to fetch rows from the
+            server, while the dump thread writes the previously fetched rows.
+            Has no effect if the X Protocol is used. Default: false.
+
+--sessionCompression=<str>
+            Protocol compression used by the sessions which read the data.
+            Allowed values: auto, off, zstd, zlib. When set to auto, zstd
+            compression is enabled if the connection to the server is slow,
+            unless compression was already configured in the connection options.
+            Default: "auto".
+
+--dropPageCache=<bool>
+            Advise the operating system to evict the data files from the page
+            cache once they are written, so that a dump to a local directory
+            does not push out other cached data. Dump is written without using
+            mmap(). Has no effect on the remote storage. Default: false.
+
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "zstd".
+            "gzip", "zstd", "lz4". Compression level may be specified as an
+            option, i.e.: "zstd;level=9". Level of the "zstd" compression may
+            be set to "auto", it is then adjusted while the data is dumped,
+            depending on whether compressing or writing the data takes longer.
+            Default: "zstd".
+
+--compressionThreads=<uint>
+            Number of threads used by each dump thread to compress the data, if
+            set to 0, data is compressed by the dump thread. Can only be used
+            with the "zstd" or "gzip" compression. Gzip files are then written
+            as multiple independently compressed members. Default: 0.
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -828,6 +1013,21 @@ OPTIONS
             Sets average estimated number of bytes to be written to each chunk
             file, enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Adjust the number of rows in each chunk using the throughput
+            measured on the already dumped chunks of the same table, so that all
+            chunks take a similar amount of time to dump. Default: false.
+
+--stealChunks=<bool>
+            Allow threads which have no more work to take over the unread part
+            of the chunks which are being dumped by other threads, writing it to
+            new chunk files. Default: false.
+
+--compressionDictionary=<bool>
+            Train a compression dictionary for each table using its initial
+            rows, and use it to compress all data files of that table. Can only
+            be used with the "zstd" compression. Default: false.
+
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
@@ -894,9 +1094,36 @@ OPTIONS
             a list of valid partition names used to limit the data export to
             just the specified partitions. Default: not set.
 
+--watermarkColumns=<key>[:<type>]=<value>
+            A key-value pair of a table name in the format of schema.table and a
+            name of a column which is updated each time a row is inserted or
+            modified, maximum value of this column is recorded in the dump.
+            Default: not set.
+
+--incrementalBase=<str>
+            Location of a complete dump, only the data which has changed since
+            that dump was created is going to be dumped. Default: not set.
+
+--previousDump=<str>
+            Location of a complete dump, data of the tables which did not change
+            since that dump was created is not dumped again. Default: not set.
+
 --checksum=<bool>
             Compute and include checksum of the dumped data. Default: false.
 
+--streamingChecksum=<bool>
+            Compute the checksums from the rows which are being dumped, instead
+            of using separate queries, requires checksum. Default: false.
+
+--performanceReport=<bool>
+            Write the @.perf.json file with timings and throughput of each
+            table, partition and chunk. Default: false.
+
+--rawBinary=<bool>
+            Write the contents of binary columns as-is, escaping only the
+            special characters, instead of encoding them using base64. Default:
+            false.
+
 --osBucketName=<str>
             Use specified OCI bucket for the location of the dump. Default: not
             set.
@@ -1020,13 +1247,57 @@ OPTIONS
             Limit data read throughput to maximum rate, measured in bytes per
             second per thread. Use maxRate="0" to set no limit. Default: "0".
 
+--maxTotalRate=<str>
+            Limit the combined data read throughput of all threads, measured in
+            bytes per second, regardless of the number of threads. Can be used
+            together with maxRate. Use maxTotalRate="0" to set no limit.
+            Default: "0".
+
 --showProgress=<bool>
             Enable or disable dump progress information. Default: true if
             stdout is a TTY device, false otherwise.
 
+--progressFormat=<str>
+            Format of the progress information. Allowed values: text, jsonl.
+            When set to jsonl, progress is not displayed, instead it is written
+            as a stream of events, one JSON document per line, to the file
+            descriptor specified by the progressFd option. Default: "text".
+
+--progressFd=<int>
+            File descriptor the progress events are written to. Can only be used
+            if progressFormat is set to jsonl. Default: 2.
+
+--pipelinedFetch=<bool>
+            Use an additional thread for each dump thread to fetch rows from the
+            server, while the dump thread writes the previously fetched rows.
+            Has no effect if the X Protocol is used. Default: false.
+
+--sessionCompression=<str>
+            Protocol compression used by the sessions which read the data.
+            Allowed values: auto, off, zstd, zlib. When set to auto, zstd
+            compression is enabled if the connection to the server is slow,
+            unless compression was already configured in the connection options.
+            Default: "auto".
+
+--dropPageCache=<bool>
+            Advise the operating system to evict the data files from the page
+            cache once they are written, so that a dump to a local directory
+            does not push out other cached data. Dump is written without using
+            mmap(). Has no effect on the remote storage. Default: false.
+
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "zstd".
+            "gzip", "zstd", "lz4". Compression level may be specified as an
+            option, i.e.: "zstd;level=9". Level of the "zstd" compression may
+            be set to "auto", it is then adjusted while the data is dumped,
+            depending on whether compressing or writing the data takes longer.
+            Default: "zstd".
+
+--compressionThreads=<uint>
+            Number of threads used by each dump thread to compress the data, if
+            set to 0, data is compressed by the dump thread. Can only be used
+            with the "zstd" or "gzip" compression. Gzip files are then written
+            as multiple independently compressed members. Default: 0.
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -1069,6 +1340,21 @@ OPTIONS
             Sets average estimated number of bytes to be written to each chunk
             file, enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Adjust the number of rows in each chunk using the throughput
+            measured on the already dumped chunks of the same table, so that all
+            chunks take a similar amount of time to dump. Default: false.
+
+--stealChunks=<bool>
+            Allow threads which have no more work to take over the unread part
+            of the chunks which are being dumped by other threads, writing it to
+            new chunk files. Default: false.
+
+--compressionDictionary=<bool>
+            Train a compression dictionary for each table using its initial
+            rows, and use it to compress all data files of that table. Can only
+            be used with the "zstd" compression. Default: false.
+
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
@@ -1135,9 +1421,36 @@ OPTIONS
             a list of valid partition names used to limit the data export to
             just the specified partitions. Default: not set.
 
+--watermarkColumns=<key>[:<type>]=<value>
+            A key-value pair of a table name in the format of schema.table and a
+            name of a column which is updated each time a row is inserted or
+            modified, maximum value of this column is recorded in the dump.
+            Default: not set.
+
+--incrementalBase=<str>
+            Location of a complete dump, only the data which has changed since
+            that dump was created is going to be dumped. Default: not set.
+
+--previousDump=<str>
+            Location of a complete dump, data of the tables which did not change
+            since that dump was created is not dumped again. Default: not set.
+
 --checksum=<bool>
             Compute and include checksum of the dumped data. Default: false.
 
+--streamingChecksum=<bool>
+            Compute the checksums from the rows which are being dumped, instead
+            of using separate queries, requires checksum. Default: false.
+
+--performanceReport=<bool>
+            Write the @.perf.json file with timings and throughput of each
+            table, partition and chunk. Default: false.
+
+--rawBinary=<bool>
+            Write the contents of binary columns as-is, escaping only the
+            special characters, instead of encoding them using base64. Default:
+            false.
+
 --osBucketName=<str>
             Use specified OCI bucket for the location of the dump. Default: not
             set.
@@ -1242,13 +1555,57 @@ OPTIONS
             Limit data read throughput to maximum rate, measured in bytes per
             second per thread. Use maxRate="0" to set no limit. Default: "0".
 
+--maxTotalRate=<str>
+            Limit the combined data read throughput of all threads, measured in
+            bytes per second, regardless of the number of threads. Can be used
+            together with maxRate. Use maxTotalRate="0" to set no limit.
+            Default: "0".
+
 --showProgress=<bool>
             Enable or disable dump progress information. Default: true if
             stdout is a TTY device, false otherwise.
 
+--progressFormat=<str>
+            Format of the progress information. Allowed values: text, jsonl.
+            When set to jsonl, progress is not displayed, instead it is written
+            as a stream of events, one JSON document per line, to the file
+            descriptor specified by the progressFd option. Default: "text".
+
+--progressFd=<int>
+            File descriptor the progress events are written to. Can only be used
+            if progressFormat is set to jsonl. Default: 2.
+
+--pipelinedFetch=<bool>
+            Use an additional thread for each dump thread to fetch rows from the
+            server, while the dump thread writes the previously fetched rows.
+            Has no effect if the X Protocol is used. Default: false.
+
+--sessionCompression=<str>
+            Protocol compression used by the sessions which read the data.
+            Allowed values: auto, off, zstd, zlib. When set to auto, zstd
+            compression is enabled if the connection to the server is slow,
+            unless compression was already configured in the connection options.
+            Default: "auto".
+
+--dropPageCache=<bool>
+            Advise the operating system to evict the data files from the page
+            cache once they are written, so that a dump to a local directory
+            does not push out other cached data. Dump is written without using
+            mmap(). Has no effect on the remote storage. Default: false.
+
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "zstd".
+            "gzip", "zstd", "lz4". Compression level may be specified as an
+            option, i.e.: "zstd;level=9". Level of the "zstd" compression may
+            be set to "auto", it is then adjusted while the data is dumped,
+            depending on whether compressing or writing the data takes longer.
+            Default: "zstd".
+
+--compressionThreads=<uint>
+            Number of threads used by each dump thread to compress the data, if
+            set to 0, data is compressed by the dump thread. Can only be used
+            with the "zstd" or "gzip" compression. Gzip files are then written
+            as multiple independently compressed members. Default: 0.
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -1291,6 +1648,21 @@ OPTIONS
             Sets average estimated number of bytes to be written to each chunk
             file, enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Adjust the number of rows in each chunk using the throughput
+            measured on the already dumped chunks of the same table, so that all
+            chunks take a similar amount of time to dump. Default: false.
+
+--stealChunks=<bool>
+            Allow threads which have no more work to take over the unread part
+            of the chunks which are being dumped by other threads, writing it to
+            new chunk files. Default: false.
+
+--compressionDictionary=<bool>
+            Train a compression dictionary for each table using its initial
+            rows, and use it to compress all data files of that table. Can only
+            be used with the "zstd" compression. Default: false.
+
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
@@ -1357,9 +1729,36 @@ OPTIONS
             a list of valid partition names used to limit the data export to
             just the specified partitions. Default: not set.
 
+--watermarkColumns=<key>[:<type>]=<value>
+            A key-value pair of a table name in the format of schema.table and a
+            name of a column which is updated each time a row is inserted or
+            modified, maximum value of this column is recorded in the dump.
+            Default: not set.
+
+--incrementalBase=<str>
+            Location of a complete dump, only the data which has changed since
+            that dump was created is going to be dumped. Default: not set.
+
+--previousDump=<str>
+            Location of a complete dump, data of the tables which did not change
+            since that dump was created is not dumped again. Default: not set.
+
 --checksum=<bool>
             Compute and include checksum of the dumped data. Default: false.
 
+--streamingChecksum=<bool>
+            Compute the checksums from the rows which are being dumped, instead
+            of using separate queries, requires checksum. Default: false.
+
+--performanceReport=<bool>
+            Write the @.perf.json file with timings and throughput of each
+            table, partition and chunk. Default: false.
+
+--rawBinary=<bool>
+            Write the contents of binary columns as-is, escaping only the
+            special characters, instead of encoding them using base64. Default:
+            false.
+
 --osBucketName=<str>
             Use specified OCI bucket for the location of the dump. Default: not
             set.
@@ -1417,6 +1816,10 @@ OPTIONS
             Dump all views and tables from the specified schema. Default:
             false.
 
+--format=<str>
+            Format of the data dump files, one of: "text", "parquet". Default:
+            "text".
+
 //@<OUT> CLI util export-table --help
 NAME
       export-table - Exports the specified table to the data dump file.
@@ -1433,13 +1836,57 @@ OPTIONS
             Limit data read throughput to maximum rate, measured in bytes per
             second per thread. Use maxRate="0" to set no limit. Default: "0".
 
+--maxTotalRate=<str>
+            Limit the combined data read throughput of all threads, measured in
+            bytes per second, regardless of the number of threads. Can be used
+            together with maxRate. Use maxTotalRate="0" to set no limit.
+            Default: "0".
+
 --showProgress=<bool>
             Enable or disable dump progress information. Default: true if
             stdout is a TTY device, false otherwise.
 
+--progressFormat=<str>
+            Format of the progress information. Allowed values: text, jsonl.
+            When set to jsonl, progress is not displayed, instead it is written
+            as a stream of events, one JSON document per line, to the file
+            descriptor specified by the progressFd option. Default: "text".
+
+--progressFd=<int>
+            File descriptor the progress events are written to. Can only be used
+            if progressFormat is set to jsonl. Default: 2.
+
+--pipelinedFetch=<bool>
+            Use an additional thread for each dump thread to fetch rows from the
+            server, while the dump thread writes the previously fetched rows.
+            Has no effect if the X Protocol is used. Default: false.
+
+--sessionCompression=<str>
+            Protocol compression used by the sessions which read the data.
+            Allowed values: auto, off, zstd, zlib. When set to auto, zstd
+            compression is enabled if the connection to the server is slow,
+            unless compression was already configured in the connection options.
+            Default: "auto".
+
+--dropPageCache=<bool>
+            Advise the operating system to evict the data files from the page
+            cache once they are written, so that a dump to a local directory
+            does not push out other cached data. Dump is written without using
+            mmap(). Has no effect on the remote storage. Default: false.
+
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "none".
+            "gzip", "zstd", "lz4". Compression level may be specified as an
+            option, i.e.: "zstd;level=9". Level of the "zstd" compression may
+            be set to "auto", it is then adjusted while the data is dumped,
+            depending on whether compressing or writing the data takes longer.
+            Default: "none".
+
+--compressionThreads=<uint>
+            Number of threads used by each dump thread to compress the data, if
+            set to 0, data is compressed by the dump thread. Can only be used
+            with the "zstd" or "gzip" compression. Gzip files are then written
+            as multiple independently compressed members. Default: 0.
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -1483,6 +1930,20 @@ OPTIONS
             A list of valid partition names used to limit the data export to
             just the specified partitions. Default: not set.
 
+--threads=<int>
+            Use N threads to export the data. If greater than 1, the table is
+            divided into chunks which are exported in parallel to temporary part
+            files, these are merged into the output file once all the data is
+            exported. Cannot be used with the "parquet" format. Default: 1.
+
+--bytesPerChunk=<str>
+            Sets average estimated number of bytes to be written to each chunk,
+            used if threads is greater than 1. Default: "64M".
+
+--format=<str>
+            Format of the data dump files, one of: "text", "parquet". Default:
+            "text".
+
 --osBucketName=<str>
             Use specified OCI bucket for the location of the dump. Default: not
             set.
@@ -1561,6 +2022,12 @@ OPTIONS
             Name of column in target table where the imported JSON documents
             will be stored. Default: "doc".
 
+--threads=<int>
+            Number of threads, each one using its own X Protocol session, used
+            to insert the documents. If greater than 1, documents are not
+            guaranteed to be imported in the order they appear in the file.
+            Default: 1.
+
 --convertBsonTypes=<bool>
             Enables the BSON data type conversion. Default: false.
 
@@ -1656,6 +2123,12 @@ OPTIONS
             Gigabytes (n * 1'000'000'000 bytes), maxRate="2k" - limit to 2
             kilobytes per second. Default: "0".
 
+--maxTotalRate=<str>
+            Limit the combined data send throughput of all threads to
+            maxTotalRate in bytes per second, regardless of the number of
+            threads. Can be used together with maxRate. Supports the same unit
+            suffixes as maxRate. maxTotalRate="0" - no limit. Default: "0".
+
 --showProgress=<bool>
             Enable or disable import progress information. Default: true if
             stdout is a tty, false otherwise.
@@ -1682,13 +2155,29 @@ OPTIONS
             Execute the given list of SQL statements in each session about to
             load data. Default: [].
 
+--fallbackToInsert=<bool>
+            If the 'local_infile' global system variable is set to OFF in the
+            target server, load the data using multi-row INSERT statements
+            instead of failing. This is slower than LOAD DATA LOCAL INFILE. User
+            variable bindings in the columns option and custom SQL expressions
+            in the decodeColumns option are not supported in this mode. Default:
+            false.
+
+--deferTableIndexes=<str>
+            "off", "fulltext", "all" (default: off) - If "all", secondary
+            indexes of the target table, except for the UNIQUE ones, are
+            dropped before the import and recreated once all the data is
+            loaded, which in many cases can reduce import times. If the table
+            has foreign keys, only the full-text and spatial indexes are
+            deferred. If "fulltext", only full-text indexes will be deferred.
+
 --dialect=<str>
             Setup fields and lines options that matches specific data file
             format. Can be used as base dialect and customized with
             fieldsTerminatedBy, fieldsEnclosedBy, fieldsOptionallyEnclosed,
             fieldsEscapedBy and linesTerminatedBy options. Must be one of the
-            following values: default, csv, tsv, json or csv-unix. Default:
-            "default".
+            following values: default, csv, tsv, json, csv-unix, parquet or
+            arrow. Default: "default".
 
 --fieldsTerminatedBy=<str>
             This option has the same meaning as the corresponding clause for
@@ -1819,10 +2308,20 @@ OPTIONS
             Discards progress information of previous load attempts to the
             destination server and loads the whole dump again. Default: false.
 
+--progressFd=<int>
+            File descriptor the progress events are written to. Can only be used
+            if progressFormat is set to jsonl. Default: 2.
+
 --progressFile=<str>
             Stores load progress information in the given local file path.
             Default: load-progress.<server_uuid>.progress.
 
+--progressFormat=<str>
+            Format of the progress information. Allowed values: text, jsonl.
+            When set to jsonl, progress is not displayed, instead it is written
+            as a stream of events, one JSON document per line, to the file
+            descriptor specified by the progressFd option. Default: "text".
+
 --excludeEvents=<str list>
             Skip loading specified events from the dump. Strings are in format
             schema.event, quoted using backtick characters when required.
@@ -1879,6 +2378,15 @@ OPTIONS
             default, the same character set used for dumping will be used
             (utf8mb4 if not set on dump). Default: taken from dump.
 
+--chunkWindow=<int>
+            If set, a chunk of a table is loaded only if it is less than the
+            given number of chunks past the oldest chunk of that table which is
+            still being loaded. Chunks are dumped and loaded in the primary key
+            order, limiting the window keeps the concurrent inserts close to
+            each other in the clustered index, which reduces the number of page
+            splits. Must be a positive integer, setting it to 1 loads chunks of
+            each table one at a time. Default: not set.
+
 --skipBinlog=<bool>
             Disables the binary log for the MySQL sessions used by the loader
             (set sql_log_bin=0). Default: false.
@@ -1902,12 +2410,24 @@ OPTIONS
             analyzed. This option can be used even if all 'load' options are
             disabled.
 
+--deferTableAnalysis=<bool>
+            If true, tables are analyzed once all data and indexes are loaded
+            and the database is ready to be used, using a single thread.
+            Progress of the analysis is stored in the progress file, an
+            interrupted analysis is resumed by the next load. Has no effect if
+            analyzeTables is set to "off". Default: false.
+
 --deferTableIndexes=<str>
             "off", "fulltext", "all" (default: fulltext) - If "all", creation
             of "all" indexes except PRIMARY is deferred until after table data
             is loaded, which in many cases can reduce load times. If
             "fulltext", only full-text indexes will be deferred.
 
+--dropPageCache=<bool>
+            Advise the operating system to evict the data files from the page
+            cache once they are read, when loading a dump from a local
+            directory. Default: false.
+
 --loadIndexes=<bool>
             Use together with deferTableIndexes to control whether secondary
             indexes should be recreated at the end of the load. Useful when
@@ -1924,12 +2444,38 @@ OPTIONS
             the accounts with the given user name are excluded. Default: not
             set.
 
+--fallbackToInsert=<bool>
+            If the 'local_infile' global system variable is set to OFF in the
+            target server, load the data using multi-row INSERT statements
+            instead of failing. This is slower than LOAD DATA LOCAL INFILE.
+            Default: false.
+
+--fastLoad=<bool>
+            Disables the InnoDB redo log and the doublewrite buffer for the
+            duration of the load, both are restored once the load completes or
+            is aborted. The target instance must not have any other client
+            connections and must not be a replication source. Requires MySQL
+            8.0.21 or newer, the doublewrite buffer is changed only on MySQL
+            8.0.30 or newer. Default: false.
+
 --includeUsers=<str list>
             Load only the specified users from the dump. Each user is in the
             format of 'user_name'[@'host']. If the host is not specified, all
             the accounts with the given user name are included. By default, all
             users are included. Default: not set.
 
+--indexBufferSize=<str>
+            Sets the innodb_ddl_buffer_size session variable used when
+            recreating the deferred indexes. Supports unit suffixes: k
+            (kilobytes), M (Megabytes), G (Gigabytes). Requires MySQL 8.0.27 or
+            newer. Default: not set.
+
+--indexThreads=<int>
+            Maximum number of threads used to recreate the deferred indexes of
+            tables which are fully loaded, while data of other tables is still
+            being loaded. Setting it to 0 postpones recreation of indexes until
+            all data is loaded. Default: half of threads, rounded up.
+
 --updateGtidSet=<str>
             "off", "replace", "append" (default: off) - if set to a value other
             than 'off' updates GTID_PURGED by either replacing its contents or
@@ -1954,6 +2500,54 @@ OPTIONS
             files with data size greater than 1.5 * bytesPerChunk. Default:
             taken from dump.
 
+--maxMemory=<str>
+            Maximum amount of memory held by the data buffers of the load
+            operation: prefetched data files, decompressed data and transaction
+            buffers of the threads which load the data. Threads wait for the
+            memory to become available, prefetching and decompression of the
+            data ahead of the threads are skipped if there's not enough memory.
+            Supports unit suffixes: k (kilobytes), M (Megabytes), G (Gigabytes).
+            Setting it to 0 disables the limit. Default: not set.
+
+--maxTotalRate=<str>
+            Limit the combined data throughput of all threads which load the
+            data, measured in bytes per second, regardless of the number of
+            threads. Supports unit suffixes: k (kilobytes), M (Megabytes), G
+            (Gigabytes). Setting it to 0 disables the limit. Default: not set.
+
+--sessionCompression=<str>
+            Protocol compression used by the sessions which load the data.
+            Allowed values: auto, off, zstd, zlib. When set to auto, zstd
+            compression is enabled if the connection to the server is slow,
+            unless compression was already configured in the connection options.
+            Default: "auto".
+
+--minThreads=<int>
+            If set, the number of threads which load the data is adjusted
+            automatically between this value and the value of the threads
+            option, depending on the load of the target instance. The number of
+            threads is reduced if the InnoDB history list grows, threads wait
+            for free pages in the buffer pool, the checkpoint age is too high
+            or, if the target instance is a replica, its replication lag grows,
+            and it is increased otherwise. Default: not set.
+
+--performanceReport=<str>
+            Writes a JSON report with the time each thread spent executing the
+            tasks, per task type, waiting for the tasks to be scheduled and
+            reading the data files from a remote storage to the given local file
+            path. Default: not set.
+
+--statusFile=<str>
+            Periodically writes the status of the load to the given local file
+            path, as a JSON document which is replaced atomically. It can be
+            displayed using the \show dump_progress report. Default: not set.
+
+--prefetchMemory=<str>
+            Maximum amount of memory used to download the data files before they
+            are loaded, when loading a dump which is not stored in a local
+            directory. Supports unit suffixes: k (kilobytes), M (Megabytes), G
+            (Gigabytes). Setting it to 0 disables prefetching. Default: 256M.
+
 --sessionInitSql=<str list>
             Execute the given list of SQL statements in each session about to
             load data. Default: [].
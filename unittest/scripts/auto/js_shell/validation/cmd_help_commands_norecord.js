@@ -423,6 +423,9 @@ DESCRIPTION
       - --interval=float, -i float - Number of seconds to wait between
         refreshes. Default 2. Allowed values are in range [0.1, 86400].
       - --nocls - Don't clear the screen between refreshes.
+      - --incremental - Repaint only the lines which changed since the previous
+        refresh, instead of clearing the screen. Output which does not fit on
+        the screen is not displayed.
 
       If executed without the report name, lists available reports.
 
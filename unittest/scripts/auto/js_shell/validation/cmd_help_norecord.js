@@ -163,6 +163,8 @@ shell configuration.
 The following shell commands are available:
 
  - \                         Start multi-line input when in SQL mode.
+ - \bg                       Executes the given SQL statement in the
+                             background, using a new session.
  - \connect          (\c)    Connects the shell to a MySQL server and assigns
                              the global session.
  - \disconnect               Disconnects the global session.
@@ -174,6 +176,8 @@ The following shell commands are available:
  - \g                        Send command to mysql server.
  - \help             (\?,\h) Prints help information about a specific topic.
  - \history                  View and edit command line history.
+ - \jobs                     Lists the SQL statements executed in the
+                             background.
  - \js                       Switches to JavaScript processing mode.
  - \nopager                  Disables the current pager.
  - \nowarnings       (\w)    Don't show warnings after every statement.
@@ -194,6 +198,8 @@ The following shell commands are available:
                              session.
  - \system           (\!)    Execute a system shell command.
  - \use              (\u)    Sets the active schema.
+ - \wait                     Waits for the SQL statements executed in the
+                             background to finish.
  - \warnings         (\W)    Show warnings after every statement.
  - \watch                    Executes the given report with provided options
                              and arguments in a loop.
@@ -309,9 +315,10 @@ OBJECTS
  - dba InnoDB Cluster, ReplicaSet, and ClusterSet management functions.
 
 CLASSES
- - Cluster    Represents an InnoDB Cluster.
- - ClusterSet Represents an InnoDB ClusterSet.
- - ReplicaSet Represents an InnoDB ReplicaSet.
+ - Cluster        Represents an InnoDB Cluster.
+ - ClusterMonitor Keeps the status of an InnoDB Cluster in memory.
+ - ClusterSet     Represents an InnoDB ClusterSet.
+ - ReplicaSet     Represents an InnoDB ReplicaSet.
 
 //@<OUT> Help on shell commands
 The shell commands allow executing specific operations including updating the
@@ -539,6 +546,7 @@ The following topics were found at the AdminAPI category:
 
 - dba.deleteSandboxInstance
 - dba.deploySandboxInstance
+- dba.deploySandboxInstances
 - dba.killSandboxInstance
 - dba.startSandboxInstance
 - dba.stopSandboxInstance
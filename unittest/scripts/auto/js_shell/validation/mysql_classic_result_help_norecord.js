@@ -59,9 +59,15 @@ FUNCTIONS
             Returns a list of Row objects which contains an element for every
             record left on the result.
 
+      fetchMany(count)
+            Returns a list with up to count records left on the result.
+
       fetchOne()
             Retrieves the next Row on the ClassicResult.
 
+      fetchOneInto(row)
+            Reads the next row of the result into the given Row object.
+
       fetchOneObject()
             Retrieves the next Row on the result and returns it as an object.
 
@@ -233,6 +239,29 @@ DESCRIPTION
       If fetchOne is called before this function, when this function is called
       it will return a Row for each of the remaining records on the resultset.
 
+//@<OUT> Help on fetchMany
+NAME
+      fetchMany - Returns a list with up to count records left on the result.
+
+SYNTAX
+      <ClassicResult>.fetchMany(count)
+
+WHERE
+      count: The maximum number of records to be returned.
+
+RETURNS
+      A List of records.
+
+DESCRIPTION
+      Each record is a list with the values of its fields, in the same order as
+      the columns of the result.
+
+      In Python each record is returned as a tuple, which is created directly
+      from the data received from the server, this is the fastest way to
+      retrieve large results.
+
+      If there are no records left on the result, an empty list is returned.
+
 //@<OUT> Help on fetchOne
 NAME
       fetchOne - Retrieves the next Row on the ClassicResult.
@@ -243,6 +272,29 @@ SYNTAX
 RETURNS
       A Row object representing the next record in the result.
 
+//@<OUT> Help on fetchOneInto
+NAME
+      fetchOneInto - Reads the next row of the result into the given Row object.
+
+SYNTAX
+      <ClassicResult>.fetchOneInto(row)
+
+WHERE
+      row: A Row object previously returned by fetchOne() on this result.
+
+RETURNS
+      A boolean value indicating whether a row was read.
+
+DESCRIPTION
+      The values of the given row are replaced with the ones of the next row, no
+      new Row object is created. This allows iterating over large results
+      without creating an object for each of the rows.
+
+      If there are no rows left on the result, false is returned and the row is
+      not modified.
+
+      An error is thrown if the given row has different columns than the result.
+
 //@<OUT> Help on fetchOneObject
 NAME
       fetchOneObject - Retrieves the next Row on the result and returns it as
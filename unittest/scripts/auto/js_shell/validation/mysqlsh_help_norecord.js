@@ -132,8 +132,12 @@ Usage: mysqlsh [OPTIONS] [URI]
   --pym <module>                   Run Python library module as a script.
                                    Remaining args are forwarded to it.
   --json[=<format>]                Produce output in JSON format. Allowed
-                                   values: raw, pretty, and off. If no format
-                                   is specified pretty format is produced.
+                                   values: raw, pretty, stream and off. If no
+                                   format is specified pretty format is
+                                   produced. The stream format is the same as
+                                   raw, except that rows of the results are
+                                   written as soon as they are received, one
+                                   per line.
   --table                          Produce output in table format (default for
                                    interactive mode). This option can be used
                                    to force that format when running in batch
@@ -168,6 +172,17 @@ Usage: mysqlsh [OPTIONS] [URI]
                                    be an integer between 1 and 8 or any of
                                    [none, internal, error, warning, info,
                                    debug, debug2, debug3] respectively.
+  --log-async=off|drop|block       Write the log file using a background thread:
+                                   off - messages are written by the thread
+                                   which logs them; drop - messages which do not
+                                   fit in the buffer of the logging thread are
+                                   dropped; block - logging thread waits until
+                                   there is space in its buffer.
+  --trace=<path>                   Write timings of sessions, storage,
+                                   compression, REST requests, dump and load
+                                   operations to the given file, in the Chrome
+                                   trace event format. Default: empty, tracing
+                                   is disabled.
   --dba-log-sql[={0|1|2}]          Log SQL statements executed by AdminAPI
                                    operations: 0 - logging disabled; 1 - log
                                    statements other than SELECT and SHOW; 2 -
@@ -204,6 +219,12 @@ Usage: mysqlsh [OPTIONS] [URI]
                                    the protocol you are using to connect to the
                                    server, e.g. DbType field is approximated
                                    when using X protocol.
+  --source-batch-size=<bytes>      Maximum size in bytes of a batch of
+                                   consecutive INSERT, REPLACE, UPDATE and
+                                   DELETE statements which are sent to the
+                                   server in a single request when an SQL
+                                   script is executed using a classic session.
+                                   Default: 0, statements are not batched.
   --histignore=<filters>           Shell's history ignore list.
   --pager=<value>                  Pager used to display text output of
                                    statements executed in SQL mode as well as
@@ -15,6 +15,10 @@ DESCRIPTION
         execution of an SQL script in batch mode shall continue if errors occur
       - connectTimeout: float, default connection timeout used by Shell
         sessions, in seconds
+      - credentialStore.cacheTtl: integer, number of seconds the passwords
+        fetched from the credential helper are cached in memory, so that
+        subsequent connections to the same URL do not have to execute the helper
+        again. 0 disables the cache. Default is 60.
       - credentialStore.excludeFilters: array of URLs for which automatic
         password storage is disabled, supports glob characters '*' and '?'
       - credentialStore.helper: name of the credential helper to use to
@@ -34,6 +38,13 @@ DESCRIPTION
         - logging disabled; 1 - log statements other than SELECT and SHOW; 2 -
         log all statements. Option takes precedence over --log-sql in Dba.*
         context if enabled.
+      - dba.maxConcurrency: 1..1024, maximum number of instances which are
+        contacted at the same time when the status of a Cluster, ClusterSet or
+        ReplicaSet is checked. Default: 16.
+      - dba.poolIdleTimeout: time in seconds the sessions opened by an AdminAPI
+        operation on a Cluster, ClusterSet or ReplicaSet object are kept open to
+        be reused by the next operations on the same object. Default: 0,
+        sessions are closed at the end of each operation.
       - dba.restartWaitTimeout: timeout in seconds to wait for MySQL server to
         come back after a restart during clone recovery
       - defaultCompress: Enable compression in client/server protocol by
@@ -51,6 +62,11 @@ DESCRIPTION
         history.sql.ignorePattern
       - interactive: read-only, boolean value that indicates if the shell is
         running in interactive mode
+      - logAsync: read-only, write the log file using a background thread: off
+        (default) - messages are written by the thread which logs them; drop -
+        messages which do not fit in the buffer of the logging thread are
+        dropped, the number of dropped messages is written to the log file;
+        block - logging thread waits until there is space in its buffer.
       - logLevel: current log level
       - logSql: Log SQL statements: off - none of SQL statements will be
         logged; error (default) - SQL statement with error message will be
@@ -65,6 +81,8 @@ DESCRIPTION
       - logSql.ignorePatternUnsafe: Colon separated list of glob patterns to
         filter out SQL queries to be logged when logSql is set to "all".
         Default: *IDENTIFIED*:*PASSWORD*
+      - logSql.statsFile: Path to a file where the latency statistics of the
+        executed SQL statements are written when the shell exits.
       - mysqlPluginDir: Directory for client-side authentication plugins
       - oci.configFile: Path to OCI (Oracle Cloud Infrastructure) configuration
         file
@@ -75,6 +93,14 @@ DESCRIPTION
       - passwordsFromStdin: boolean value that indicates if the shell should
         read passwords from stdin instead of the tty
       - resultFormat: controls the type of output produced for SQL results.
+      - resultFormat.tableOverflow: determines how the values which do not fit
+        in the column of the table output are printed: expand (default) - value
+        is printed in full, breaking the alignment of the table; truncate -
+        value is truncated; wrap - value is wrapped into multiple lines.
+      - resultFormat.tableSampleRows: number of rows used to calculate the
+        column widths of the table output, if 0, widths are calculated using the
+        column metadata and rows are printed as soon as they are received.
+        Default: 1000.
       - sandboxDir: default path where the new sandbox instances for InnoDB
         cluster will be deployed
       - showColumnTypeInfo: display column type information in SQL mode. Please
@@ -83,9 +109,31 @@ DESCRIPTION
         protocol.
       - showWarnings: boolean value to indicate whether warnings shall be
         included when printing a SQL result
+      - sourceBatchSize: maximum size in bytes of a batch of consecutive INSERT,
+        REPLACE, UPDATE and DELETE statements which are sent to the server in a
+        single request when an SQL script is executed using a classic session.
+        Should not exceed the max_allowed_packet of the server. Default: 0,
+        statements are not batched.
+      - trace: path to a file where timings of sessions, storage, compression,
+        REST requests, dump and load operations are written, in the Chrome trace
+        event format (can be viewed using chrome://tracing or
+        https://ui.perfetto.dev). Tracing is enabled while this option is set,
+        file is written when the option is changed or when the shell exits.
+        Default: empty, tracing is disabled.
       - useWizards: read-only, boolean value to indicate if interactive
         prompting and wizards are enabled by default in AdminAPI and others.
         Use --no-wizard to disable.
+      - util.maxRate: maximum throughput in bytes per second shared by all dump,
+        load and import operations which are running concurrently, each one gets
+        a fair share of this limit. Default: empty, throughput is not limited.
+      - util.maxThreads: maximum number of threads shared by all dump, load and
+        import operations which are running concurrently, each one gets a fair
+        share of this limit. Default: 0, number of threads is not limited.
+      - util.threadAffinity: placement of the worker threads of dump and load
+        operations on the CPUs. Allowed values: none - threads are not pinned,
+        node - threads are spread evenly over the NUMA nodes and pinned to the
+        CPUs of their node, core - like node, but each thread is pinned to a
+        single CPU. Default: none.
       - verbose: 0..4, verbose output level. If >0, additional output that may
         help diagnose issues is printed to the screen. Larger values mean more
         verbose. Default is 0.
@@ -94,6 +142,10 @@ DESCRIPTION
         (~/.ssh/config).
       - ssh.bufferSize integer default 10240 bytes, used for tunnel data
         transfer
+      - ssh.tunnelSessions integer default 1, number of SSH sessions opened to
+        the SSH server for each tunnel. Connections which use the tunnel are
+        distributed between these sessions, each of them is served by a separate
+        thread.
 
       The resultFormat option supports the following values to modify the
       format of printed query results:
@@ -570,4 +570,11 @@ Name:      `2`
 //@<OUT> Multiple Results JSON Mode
 {"hasData":true,"rows":[{"1":1}],"executionTime":"[[*]] sec","affectedRowCount":0,"affectedItemsCount":0,"warningCount":0,"warningsCount":0,"warnings":[],"info":"","autoIncrementValue":0}
 {"hasData":true,"rows":[{"2":2}],"executionTime":"[[*]] sec","affectedRowCount":0,"affectedItemsCount":0,"warningCount":0,"warningsCount":0,"warnings":[],"info":"","autoIncrementValue":0}
-{"hasData":false,"rows":[],"executionTime":"[[*]] sec","affectedRowCount":0,"affectedItemsCount":0,"warningCount":0,"warningsCount":0,"warnings":[],"info":"","autoIncrementValue":0}
\ No newline at end of file
+{"hasData":false,"rows":[],"executionTime":"[[*]] sec","affectedRowCount":0,"affectedItemsCount":0,"warningCount":0,"warningsCount":0,"warnings":[],"info":"","autoIncrementValue":0}
+
+//@<OUT> Multiple Results JSON Stream Mode
+{"row":{"1":1}}
+{"hasData":true,"rowCount":1,"executionTime":"[[*]] sec","affectedRowCount":0,"affectedItemsCount":0,"warningCount":0,"warningsCount":0,"warnings":[],"info":"","autoIncrementValue":0}
+{"row":{"2":2}}
+{"hasData":true,"rowCount":1,"executionTime":"[[*]] sec","affectedRowCount":0,"affectedItemsCount":0,"warningCount":0,"warningsCount":0,"warnings":[],"info":"","autoIncrementValue":0}
+{"hasData":false,"rowCount":0,"executionTime":"[[*]] sec","affectedRowCount":0,"affectedItemsCount":0,"warningCount":0,"warningsCount":0,"warnings":[],"info":"","autoIncrementValue":0}
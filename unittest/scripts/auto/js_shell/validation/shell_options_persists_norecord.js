@@ -303,6 +303,7 @@
  autocomplete.nameCache          true
  batchContinueOnError            false
  connectTimeout                  10
+ credentialStore.cacheTtl        60
  credentialStore.excludeFilters  []
  credentialStore.helper          default
  credentialStore.savePasswords   prompt
@@ -310,6 +311,8 @@
  dba.connectivityChecks          true
  dba.gtidWaitTimeout             60
  dba.logSql                      0
+ dba.maxConcurrency              16
+ dba.poolIdleTimeout             0
  dba.restartWaitTimeout          60
  defaultCompress                 false
  defaultMode                     none
@@ -319,11 +322,13 @@
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD*
  history.sql.syslog              false
  interactive                     true
+ logAsync                        off
  logFile                         <<<testutil.getShellLogPath()>>>
  logLevel                        5
  logSql                          error
  logSql.ignorePattern            *SELECT*:SHOW*
  logSql.ignorePatternUnsafe      *IDENTIFIED*:*PASSWORD*
+ logSql.statsFile                ""
  mysqlPluginDir                  [[*]]plugins
  oci.configFile                  <<<_defaultOciConfigFile>>>
  oci.profile                     DEFAULT
@@ -331,18 +336,27 @@
  pager                           ""
  passwordsFromStdin              false
  resultFormat                    table
+ resultFormat.tableOverflow      expand
+ resultFormat.tableSampleRows    1000
  sandboxDir                      <<<_defaultSandboxDir>>>
  showColumnTypeInfo              false
  showWarnings                    true
+ sourceBatchSize                 0
  ssh.bufferSize                  10240
  ssh.configFile                  ""
+ ssh.tunnelSessions              1
+ trace                           ""
  useWizards                      true
+ util.maxRate                    ""
+ util.maxThreads                 0
+ util.threadAffinity             "none"
  verbose                         0
 
 //@<OUT> List all the options using \option and show-origin
  autocomplete.nameCache          true (Compiled default)
  batchContinueOnError            false (Compiled default)
  connectTimeout                  10 (Compiled default)
+ credentialStore.cacheTtl        60 (Compiled default)
  credentialStore.excludeFilters  [] (Compiled default)
  credentialStore.helper          default (Compiled default)
  credentialStore.savePasswords   prompt (Compiled default)
@@ -350,6 +364,8 @@
  dba.connectivityChecks          true (Compiled default)
  dba.gtidWaitTimeout             60 (Compiled default)
  dba.logSql                      0 (Compiled default)
+ dba.maxConcurrency              16 (Compiled default)
+ dba.poolIdleTimeout             0 (Compiled default)
  dba.restartWaitTimeout          60 (Compiled default)
  defaultCompress                 false (Compiled default)
  defaultMode                     none (Compiled default)
@@ -359,11 +375,13 @@
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD* (Compiled default)
  history.sql.syslog              false (Compiled default)
  interactive                     true (Compiled default)
+ logAsync                        off (Compiled default)
  logFile                         <<<testutil.getShellLogPath()>>> (Compiled default)
  logLevel                        5 (Compiled default)
  logSql                          error (Compiled default)
  logSql.ignorePattern            *SELECT*:SHOW* (Compiled default)
  logSql.ignorePatternUnsafe      *IDENTIFIED*:*PASSWORD* (Compiled default)
+ logSql.statsFile                "" (Compiled default)
  mysqlPluginDir                  [[*]]plugins (Compiled default)
  oci.configFile                  <<<_defaultOciConfigFile>>> (Compiled default)
  oci.profile                     DEFAULT (Compiled default)
@@ -371,12 +389,20 @@
  pager                           "" (Compiled default)
  passwordsFromStdin              false (Compiled default)
  resultFormat                    table (Compiled default)
+ resultFormat.tableOverflow      expand (Compiled default)
+ resultFormat.tableSampleRows    1000 (Compiled default)
  sandboxDir                      <<<_defaultSandboxDir>>> (Compiled default)
  showColumnTypeInfo              false (Compiled default)
  showWarnings                    true (Compiled default)
+ sourceBatchSize                 0 (Compiled default)
  ssh.bufferSize                  10240 (Compiled default)
  ssh.configFile                  "" (Compiled default)
+ ssh.tunnelSessions              1 (Compiled default)
+ trace                           "" (Compiled default)
  useWizards                      true (Compiled default)
+ util.maxRate                    "" (Compiled default)
+ util.maxThreads                 0 (Compiled default)
+ util.threadAffinity             "none" (Compiled default)
  verbose                         0 (Compiled default)
 
 //@ List an option which origin is Compiled default
@@ -464,6 +490,7 @@
  autocomplete.nameCache          true
  batchContinueOnError            false
  connectTimeout                  10
+ credentialStore.cacheTtl        60
  credentialStore.excludeFilters  []
  credentialStore.helper          default
  credentialStore.savePasswords   prompt
@@ -471,6 +498,8 @@
  dba.connectivityChecks          true
  dba.gtidWaitTimeout             60
  dba.logSql                      0
+ dba.maxConcurrency              16
+ dba.poolIdleTimeout             0
  dba.restartWaitTimeout          60
  defaultCompress                 false
  defaultMode                     none
@@ -480,11 +509,13 @@
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD*
  history.sql.syslog              false
  interactive                     true
+ logAsync                        off
  logFile                         <<<testutil.getShellLogPath()>>>
  logLevel                        5
  logSql                          error
  logSql.ignorePattern            *SELECT*:SHOW*
  logSql.ignorePatternUnsafe      *IDENTIFIED*:*PASSWORD*
+ logSql.statsFile                ""
  mysqlPluginDir                  [[*]]plugins
  oci.configFile                  <<<_defaultOciConfigFile>>>
  oci.profile                     DEFAULT
@@ -492,12 +523,20 @@
  pager                           ""
  passwordsFromStdin              false
  resultFormat                    table
+ resultFormat.tableOverflow      expand
+ resultFormat.tableSampleRows    1000
  sandboxDir                      <<<_defaultSandboxDir>>>
  showColumnTypeInfo              false
  showWarnings                    true
+ sourceBatchSize                 0
  ssh.bufferSize                  10240
  ssh.configFile                  ""
+ ssh.tunnelSessions              1
+ trace                           ""
  useWizards                      true
+ util.maxRate                    ""
+ util.maxThreads                 0
+ util.threadAffinity             "none"
  verbose                         0
 
 //@<OUT> List all the options using \option and show-origin for SQL mode
@@ -505,6 +544,7 @@ Switching to SQL mode... Commands end with ;
  autocomplete.nameCache          true (Compiled default)
  batchContinueOnError            false (Compiled default)
  connectTimeout                  10 (Compiled default)
+ credentialStore.cacheTtl        60 (Compiled default)
  credentialStore.excludeFilters  [] (Compiled default)
  credentialStore.helper          default (Compiled default)
  credentialStore.savePasswords   prompt (Compiled default)
@@ -512,6 +552,8 @@ Switching to SQL mode... Commands end with ;
  dba.connectivityChecks          true (Compiled default)
  dba.gtidWaitTimeout             60 (Compiled default)
  dba.logSql                      0 (Compiled default)
+ dba.maxConcurrency              16 (Compiled default)
+ dba.poolIdleTimeout             0 (Compiled default)
  dba.restartWaitTimeout          60 (Compiled default)
  defaultCompress                 false (Compiled default)
  defaultMode                     none (Compiled default)
@@ -521,11 +563,13 @@ Switching to SQL mode... Commands end with ;
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD* (Compiled default)
  history.sql.syslog              false (Compiled default)
  interactive                     true (Compiled default)
+ logAsync                        off (Compiled default)
  logFile                         <<<testutil.getShellLogPath()>>> (Compiled default)
  logLevel                        5 (Compiled default)
  logSql                          error (Compiled default)
  logSql.ignorePattern            *SELECT*:SHOW* (Compiled default)
  logSql.ignorePatternUnsafe      *IDENTIFIED*:*PASSWORD* (Compiled default)
+ logSql.statsFile                "" (Compiled default)
  mysqlPluginDir                  [[*]]plugins (Compiled default)
  oci.configFile                  <<<_defaultOciConfigFile>>> (Compiled default)
  oci.profile                     DEFAULT (Compiled default)
@@ -533,12 +577,20 @@ Switching to SQL mode... Commands end with ;
  pager                           "" (Compiled default)
  passwordsFromStdin              false (Compiled default)
  resultFormat                    table (Compiled default)
+ resultFormat.tableOverflow      expand (Compiled default)
+ resultFormat.tableSampleRows    1000 (Compiled default)
  sandboxDir                      <<<_defaultSandboxDir>>> (Compiled default)
  showColumnTypeInfo              false (Compiled default)
  showWarnings                    true (Compiled default)
+ sourceBatchSize                 0 (Compiled default)
  ssh.bufferSize                  10240 (Compiled default)
  ssh.configFile                  "" (Compiled default)
+ ssh.tunnelSessions              1 (Compiled default)
+ trace                           "" (Compiled default)
  useWizards                      true (Compiled default)
+ util.maxRate                    "" (Compiled default)
+ util.maxThreads                 0 (Compiled default)
+ util.threadAffinity             "none" (Compiled default)
  verbose                         0 (Compiled default)
 
 //@<OUT> Verify options persistence WL#14246 TSFR_10_5
@@ -72,7 +72,7 @@ DESCRIPTION
 ||Unknown report: unknown_report
 
 //@ WL11263_TSF2_4 - Validate that using the \show command without a report name list the reports available.
-|Available reports: query, thread, threads.|
+|Available reports: dump_progress, query, thread, threads.|
 
 //@ WL11263_TSF5_4 - use \watch command with an invalid --interval value (below threshold)
 ||The value of '--interval' option should be a float in range [0.1, 86400], got: '0.09'.
@@ -80,6 +80,9 @@ DESCRIPTION
 //@ WL11263_TSF5_5 - use \watch command with an invalid --interval value (above threshold)
 ||The value of '--interval' option should be a float in range [0.1, 86400], got: '86400.1'.
 
+//@ use \watch command with both --incremental and --nocls options
+||The '--incremental' and '--nocls' options cannot be used together.
+
 // -----------------------------------------------------------------------------
 // WL11263_TSF2_5 - Validate that a report registered with an all lower-case name can be invoked by the \show command using all upper-case name.
 
@@ -215,6 +218,9 @@ DESCRIPTION
 //@ WL11263_TSF9_9 - Option duplicates --nocls
 ||Shell.registerReport: Option 'nocls' is reserved for use with the \watch command. (ArgumentError)
 
+//@ WL11263_TSF9_9 - Option duplicates --incremental
+||Shell.registerReport: Option 'incremental' is reserved for use with the \watch command. (ArgumentError)
+
 //@ WL11263_TSF9_9 - Option duplicates --vertical in a 'list' type report
 ||Shell.registerReport: Error while adding option 'vertical' its cmdline name '--vertical' clashes with existing option. (ArgumentError)
 
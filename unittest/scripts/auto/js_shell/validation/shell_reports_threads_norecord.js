@@ -164,6 +164,24 @@ in: one two
 //@ WL11651-TSFR11_2 - When using the --limit option, validate that the output is limited to the number of threads specified.
 ||
 
+//@ sample - statements are aggregated
+||
+
+//@ sample - invalid value
+||reports.threads: The 'sample' parameter must be a number of seconds in range (0, 3600].
+
+//@ sample - cannot be used with format
+||reports.threads: The 'format' parameter cannot be used with the 'sample' parameter.
+
+//@ sample - cannot be used with order-by
+||reports.threads: The 'order-by' parameter cannot be used with the 'sample' parameter.
+
+//@ sample - invalid rate
+||reports.threads: The 'rate' parameter must be in range [1, 1000].
+
+//@ sample - rate without sample
+||reports.threads: The 'rate' parameter can only be used with the 'sample' parameter.
+
 //@ cleanup - delete the database
 ||
 
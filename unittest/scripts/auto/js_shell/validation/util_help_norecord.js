@@ -16,6 +16,11 @@ FUNCTIONS
             Performs series of tests on specified MySQL server to check if the
             upgrade process will succeed.
 
+      compareTables(schema, tables, connectionData[, options])
+            Compares contents of tables in the source instance with the same
+            tables in the target instance. Requires an open global Shell session
+            to the source instance, if there is none, an exception is raised.
+
       copyInstance(connectionData[, options])
             Copies a source instance to the target instance. Requires an open
             global Shell session to the source instance, if there is none, an
@@ -31,6 +36,10 @@ FUNCTIONS
             target instance. Requires an open global Shell session to the
             source instance, if there is none, an exception is raised.
 
+      dumpBinlogs(outputUrl[, options])
+            Dumps binary logs generated since a specific point in time to the
+            given local or remote directory.
+
       dumpInstance(outputUrl[, options])
             Dumps the whole database to files in the output directory.
 
@@ -55,9 +64,17 @@ FUNCTIONS
             Import table dump stored in files to target table using LOAD DATA
             LOCAL INFILE calls in parallel connections.
 
+      loadBinlogs(url[, options])
+            Loads binary log dumps created by MySQL Shell from a local or remote
+            directory.
+
       loadDump(url[, options])
             Loads database dumps created by MySQL Shell.
 
+      loadDumpToInstances(url, instances[, options])
+            Loads a dump created by MySQL Shell into several instances at the
+            same time.
+
 //@<OUT> util checkForServerUpgrade help
 NAME
       checkForServerUpgrade - Performs series of tests on specified MySQL
@@ -81,6 +98,8 @@ DESCRIPTION
       - outputFormat - value can be either TEXT (default) or JSON.
       - targetVersion - version to which upgrade will be checked
         (default=<<<__mysh_version>>>)
+      - threads - number of concurrent sessions used to execute the checks
+        (default=1).
       - password - password for connection.
 
       The connection data may be specified in the following formats:
@@ -270,16 +289,46 @@ DESCRIPTION
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be copied in each chunk, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust the number of rows in
+        each chunk using the throughput measured on the already copied chunks of
+        the same table, so that all chunks take a similar amount of time to
+        copy.
+      - stealChunks: bool (default: false) - Allow threads which have no more
+        work to take over the uncopied part of the chunks which are being copied
+        by other threads.
       - threads: int (default: 4) - Use N threads to read the data from the
         source server and additional N threads to write the data to the target
         server.
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxTotalRate: string (default: "0") - Limit the combined data read
+        throughput of all threads, measured in bytes per second, regardless of
+        the number of threads. Can be used together with maxRate. Use
+        maxTotalRate="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
+      - pipelinedFetch: bool (default: false) - Use an additional thread for
+        each thread reading the data to fetch rows from the source server, while
+        that thread writes the previously fetched rows. Has no effect if the X
+        Protocol is used.
+      - sessionCompression: string (default: "auto") - Protocol compression used
+        by the sessions which read the data from the source instance and by the
+        sessions which load it into the target instance. Allowed values: auto,
+        off, zstd, zlib. When set to auto, zstd compression is enabled if the
+        connection to the server is slow, unless compression was already
+        configured in the connection options.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the copy.
+      - memoryLimit: string (default: "0") - Limits the memory used to hold the
+        DDL and metadata files which are waiting to be loaded. Once the limit is
+        reached, contents of these files are moved to a scratch directory. Table
+        data is streamed directly to the target instance and is not subject to
+        this limit. Supports unit suffixes: k (kilobytes), M (Megabytes), G
+        (Gigabytes). Use memoryLimit="0" to set no limit.
+      - spillDirectory: string (default: the system temporary directory) -
+        Directory where the scratch files are created once memoryLimit is
+        reached. They are removed when the copy finishes.
       - analyzeTables: "off", "on", "histogram" (default: off) - If 'on',
         executes ANALYZE TABLE for all tables, once copied. If set to
         'histogram', only tables that have histogram information stored in the
@@ -395,16 +444,46 @@ DESCRIPTION
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be copied in each chunk, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust the number of rows in
+        each chunk using the throughput measured on the already copied chunks of
+        the same table, so that all chunks take a similar amount of time to
+        copy.
+      - stealChunks: bool (default: false) - Allow threads which have no more
+        work to take over the uncopied part of the chunks which are being copied
+        by other threads.
       - threads: int (default: 4) - Use N threads to read the data from the
         source server and additional N threads to write the data to the target
         server.
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxTotalRate: string (default: "0") - Limit the combined data read
+        throughput of all threads, measured in bytes per second, regardless of
+        the number of threads. Can be used together with maxRate. Use
+        maxTotalRate="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
+      - pipelinedFetch: bool (default: false) - Use an additional thread for
+        each thread reading the data to fetch rows from the source server, while
+        that thread writes the previously fetched rows. Has no effect if the X
+        Protocol is used.
+      - sessionCompression: string (default: "auto") - Protocol compression used
+        by the sessions which read the data from the source instance and by the
+        sessions which load it into the target instance. Allowed values: auto,
+        off, zstd, zlib. When set to auto, zstd compression is enabled if the
+        connection to the server is slow, unless compression was already
+        configured in the connection options.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the copy.
+      - memoryLimit: string (default: "0") - Limits the memory used to hold the
+        DDL and metadata files which are waiting to be loaded. Once the limit is
+        reached, contents of these files are moved to a scratch directory. Table
+        data is streamed directly to the target instance and is not subject to
+        this limit. Supports unit suffixes: k (kilobytes), M (Megabytes), G
+        (Gigabytes). Use memoryLimit="0" to set no limit.
+      - spillDirectory: string (default: the system temporary directory) -
+        Directory where the scratch files are created once memoryLimit is
+        reached. They are removed when the copy finishes.
       - analyzeTables: "off", "on", "histogram" (default: off) - If 'on',
         executes ANALYZE TABLE for all tables, once copied. If set to
         'histogram', only tables that have histogram information stored in the
@@ -509,16 +588,46 @@ DESCRIPTION
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be copied in each chunk, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust the number of rows in
+        each chunk using the throughput measured on the already copied chunks of
+        the same table, so that all chunks take a similar amount of time to
+        copy.
+      - stealChunks: bool (default: false) - Allow threads which have no more
+        work to take over the uncopied part of the chunks which are being copied
+        by other threads.
       - threads: int (default: 4) - Use N threads to read the data from the
         source server and additional N threads to write the data to the target
         server.
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxTotalRate: string (default: "0") - Limit the combined data read
+        throughput of all threads, measured in bytes per second, regardless of
+        the number of threads. Can be used together with maxRate. Use
+        maxTotalRate="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
+      - pipelinedFetch: bool (default: false) - Use an additional thread for
+        each thread reading the data to fetch rows from the source server, while
+        that thread writes the previously fetched rows. Has no effect if the X
+        Protocol is used.
+      - sessionCompression: string (default: "auto") - Protocol compression used
+        by the sessions which read the data from the source instance and by the
+        sessions which load it into the target instance. Allowed values: auto,
+        off, zstd, zlib. When set to auto, zstd compression is enabled if the
+        connection to the server is slow, unless compression was already
+        configured in the connection options.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the copy.
+      - memoryLimit: string (default: "0") - Limits the memory used to hold the
+        DDL and metadata files which are waiting to be loaded. Once the limit is
+        reached, contents of these files are moved to a scratch directory. Table
+        data is streamed directly to the target instance and is not subject to
+        this limit. Supports unit suffixes: k (kilobytes), M (Megabytes), G
+        (Gigabytes). Use memoryLimit="0" to set no limit.
+      - spillDirectory: string (default: the system temporary directory) -
+        Directory where the scratch files are created once memoryLimit is
+        reached. They are removed when the copy finishes.
       - analyzeTables: "off", "on", "histogram" (default: off) - If 'on',
         executes ANALYZE TABLE for all tables, once copied. If set to
         'histogram', only tables that have histogram information stored in the
@@ -575,6 +684,7 @@ DESCRIPTION
       - The path to the target location in a local filesystem or one of the
         supported cloud storage buckets
       - A Pre-Authenticated Request (PAR) to a bucket in OCI Object Storage
+      - A stream archive, using the stream:// scheme
 
       By default, a local directory is used, and in this case outputUrl can be
       prefixed with file:// scheme. If a relative path is given, the absolute
@@ -588,6 +698,16 @@ DESCRIPTION
       For additional details on using PARs see the Dumping to OCI Object
       Storage using Pre-Authenticated Request (PAR) section.
 
+      If the stream:// scheme is used, all dump files are multiplexed into a
+      single stream, which is written to the local file, pipe or FIFO given
+      after the scheme, i.e. stream:///dev/fd/3. Such stream can be loaded while
+      it is being created, using the same URL and the 'waitDumpTimeout' option
+      of the load dump utility. If stream://- is used, the stream is written to
+      the standard output and messages are printed to the standard error while
+      the dump is running. This allows to pipe the dump to another instance of
+      the shell, which loads it using the same URL. Standard streams are not
+      supported on Windows.
+
       The following options are supported:
 
       - excludeSchemas: list of strings (default: empty) - List of schemas to
@@ -644,6 +764,16 @@ DESCRIPTION
       - partitions: dictionary (default: not set) - A key-value pair of a table
         name in the format of schema.table and a list of valid partition names
         used to limit the data export to just the specified partitions.
+      - watermarkColumns: dictionary (default: not set) - A key-value pair of a
+        table name in the format of schema.table and a name of a column which is
+        updated each time a row is inserted or modified, maximum value of this
+        column is recorded in the dump.
+      - incrementalBase: string (default: not set) - Location of a complete
+        dump, only the data which has changed since that dump was created is
+        going to be dumped.
+      - previousDump: string (default: not set) - Location of a complete dump,
+        data of the tables which did not change since that dump was created is
+        not dumped again.
       - tzUtc: bool (default: true) - Convert TIMESTAMP data to UTC.
       - consistent: bool (default: true) - Enable or disable consistent data
         dumps. When enabled, produces a transactionally consistent dump at a
@@ -656,12 +786,33 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - checksum: bool (default: false) - Compute and include checksum of the
         dumped data.
+      - streamingChecksum: bool (default: false) - Compute the checksums from
+        the rows which are being dumped, instead of using separate queries,
+        requires checksum.
+      - performanceReport: bool (default: false) - Write the @.perf.json file
+        with timings and throughput of each table, partition and chunk.
+      - rawBinary: bool (default: false) - Write the contents of binary columns
+        as-is, escaping only the special characters, instead of encoding them
+        using base64.
+      - readReplicas: list of strings (default: not set) - URIs of the replicas
+        of the source instance which are used to read the table data.
+      - mirrorOutputUrls: list of strings (default: not set) - Additional
+        locations which receive a copy of each file of the dump.
+      - mirrorMaxLag: string (default: "64M") - Maximum number of bytes buffered
+        for each file written to a mirror location.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything. If ocimds is enabled, also checks for
         compatibility issues with MySQL HeatWave Service.
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust the number of rows in
+        each chunk using the throughput measured on the already dumped chunks of
+        the same table, so that all chunks take a similar amount of time to
+        dump.
+      - stealChunks: bool (default: false) - Allow threads which have no more
+        work to take over the unread part of the chunks which are being dumped
+        by other threads, writing it to new chunk files.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
@@ -685,12 +836,49 @@ DESCRIPTION
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxTotalRate: string (default: "0") - Limit the combined data read
+        throughput of all threads, measured in bytes per second, regardless of
+        the number of threads. Can be used together with maxRate. Use
+        maxTotalRate="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
+      - progressFormat: string (default: "text") - Format of the progress
+        information. Allowed values: text, jsonl. When set to jsonl, progress is
+        not displayed, instead it is written as a stream of events, one JSON
+        document per line, to the file descriptor specified by the progressFd
+        option.
+      - progressFd: int (default: 2) - File descriptor the progress events are
+        written to. Can only be used if progressFormat is set to jsonl.
+      - pipelinedFetch: bool (default: false) - Use an additional thread for
+        each dump thread to fetch rows from the server, while the dump thread
+        writes the previously fetched rows. Has no effect if the X Protocol is
+        used.
+      - sessionCompression: string (default: "auto") - Protocol compression used
+        by the sessions which read the data. Allowed values: auto, off, zstd,
+        zlib. When set to auto, zstd compression is enabled if the connection to
+        the server is slow, unless compression was already configured in the
+        connection options.
+      - dropPageCache: bool (default: false) - Advise the operating system to
+        evict the data files from the page cache once they are written, so that
+        a dump to a local directory does not push out other cached data. Dump is
+        written without using mmap(). Has no effect on the remote storage.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression
+        level may be specified as an option, i.e.: "zstd;level=9". Level of the
+        "zstd" compression may be set to "auto", it is then adjusted while the
+        data is dumped, depending on whether compressing or writing the data
+        takes longer.
+      - compressionThreads: int (default: 0) - Number of threads used by each
+        dump thread to compress the data, if set to 0, data is compressed by the
+        dump thread. Can only be used with the "zstd" or "gzip" compression.
+        Gzip files are then written as multiple independently compressed
+        members.
+      - compressionDictionary: bool (default: false) - Train a compression
+        dictionary for each table using its initial rows, and use it to compress
+        all data files of that table. Can only be used with the "zstd"
+        compression.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -809,6 +997,76 @@ DESCRIPTION
 
       The value of the threads option must be a positive number.
 
+      The stealChunks option can only be used with tables which are chunked
+      using an integer column, and cannot be used together with the checksum
+      option. Chunk files of such tables are followed by an additional empty
+      chunk file.
+
+      The streamingChecksum option hashes the rows while they are being written,
+      so the tables are scanned only once. Such dumps can only be loaded by a
+      version of the Shell which supports this checksum algorithm. It cannot be
+      used if the tzUtc option is set to false.
+
+      The performanceReport option records, for each table and partition, the
+      time it took to chunk it and the worker which did it. For each chunk, it
+      records the worker which dumped it, the time to receive the first row,
+      rows and bytes per second, the compression ratio and the time spent
+      writing to the output file.
+
+      The rawBinary option avoids the size overhead of base64 encoding and the
+      cost of encoding and decoding the BINARY, VARBINARY, BLOB, BIT and
+      GEOMETRY columns. It can only be used if the defaultCharacterSet option is
+      set to one of: ascii, binary, latin1, utf8, utf8mb3, utf8mb4, and the
+      fieldsEscapedBy option is not empty.
+
+      The readReplicas option spreads the worker threads between the source
+      instance and its replicas. When running a consistent dump, each replica
+      has to apply all the transactions of the source while the global read lock
+      is held, before the workers start their transactions, so all the workers
+      see the same data. This requires GTIDs to be enabled. If a replica URI
+      does not specify the user or the password, the ones of the source
+      connection are used.
+
+      The mirrorOutputUrls option writes the same dump to multiple locations at
+      the same time, each of them can be a local directory or an OCI prefix PAR.
+      Data is read from the source instance only once, each mirror is written by
+      a separate background thread. If a mirror falls behind by more than
+      mirrorMaxLag bytes, the dump waits until it catches up. The dump fails if
+      any of the locations cannot be written.
+
+      The compressionDictionary option improves the compression ratio of dumps
+      with many small chunk files. The dictionary of each table is stored in a
+      separate file, which is required to load the data files of that table.
+
+      The incrementalBase option creates an incremental dump, which contains
+      only the table data and is meant to be loaded into an instance which
+      already contains the data of the base dump. The base dump is read using
+      the same storage options as the output location. Tables whose watermark
+      was recorded by the base dump include only the rows with the value of the
+      watermark column greater than the recorded one, remaining tables are
+      dumped in full. All tables need to have a primary key or an equivalent
+      unique index, rows which already exist are replaced when the dump is
+      loaded. The watermark column should be indexed, i.e. a TIMESTAMP column
+      with the ON UPDATE CURRENT_TIMESTAMP attribute.
+
+      Incremental dumps do not capture deleted rows, nor the rows committed by
+      transactions which were in progress when the base dump was created, if
+      their watermark values are lower than the recorded ones. The number of
+      rows in each table is recorded: the load operation refuses to load an
+      incremental dump into tables whose rows were deleted, and warns about
+      tables which still contain rows deleted from the source instance. Use
+      util.dumpBinlogs() and util.loadBinlogs() to capture and apply all the
+      changes, deletes included, from the binary log.
+
+      The previousDump option compares each table with its copy in a complete
+      dump created earlier. Fingerprint of a table is computed using the
+      CHECKSUM TABLE statement and the options which affect the contents of the
+      data files. Data of the tables whose fingerprints did not change is not
+      dumped again, metadata of such tables refers to the data files of the
+      previous dump, which has to be available when the new dump is loaded,
+      using the same storage options. This option cannot be used together with
+      the ddlOnly, incrementalBase and checksum options.
+
       The dialect option predefines the set of options fieldsTerminatedBy (FT),
       fieldsEnclosedBy (FE), fieldsOptionallyEnclosed (FOE), fieldsEscapedBy
       (FESC) and linesTerminatedBy (LT) in the following manner:
@@ -1228,6 +1486,7 @@ DESCRIPTION
       - The path to the target location in a local filesystem or one of the
         supported cloud storage buckets
       - A Pre-Authenticated Request (PAR) to a bucket in OCI Object Storage
+      - A stream archive, using the stream:// scheme
 
       By default, a local directory is used, and in this case outputUrl can be
       prefixed with file:// scheme. If a relative path is given, the absolute
@@ -1241,6 +1500,16 @@ DESCRIPTION
       For additional details on using PARs see the Dumping to OCI Object
       Storage using Pre-Authenticated Request (PAR) section.
 
+      If the stream:// scheme is used, all dump files are multiplexed into a
+      single stream, which is written to the local file, pipe or FIFO given
+      after the scheme, i.e. stream:///dev/fd/3. Such stream can be loaded while
+      it is being created, using the same URL and the 'waitDumpTimeout' option
+      of the load dump utility. If stream://- is used, the stream is written to
+      the standard output and messages are printed to the standard error while
+      the dump is running. This allows to pipe the dump to another instance of
+      the shell, which loads it using the same URL. Standard streams are not
+      supported on Windows.
+
       The following options are supported:
 
       - excludeTables: list of strings (default: empty) - List of tables or
@@ -1283,6 +1552,16 @@ DESCRIPTION
       - partitions: dictionary (default: not set) - A key-value pair of a table
         name in the format of schema.table and a list of valid partition names
         used to limit the data export to just the specified partitions.
+      - watermarkColumns: dictionary (default: not set) - A key-value pair of a
+        table name in the format of schema.table and a name of a column which is
+        updated each time a row is inserted or modified, maximum value of this
+        column is recorded in the dump.
+      - incrementalBase: string (default: not set) - Location of a complete
+        dump, only the data which has changed since that dump was created is
+        going to be dumped.
+      - previousDump: string (default: not set) - Location of a complete dump,
+        data of the tables which did not change since that dump was created is
+        not dumped again.
       - tzUtc: bool (default: true) - Convert TIMESTAMP data to UTC.
       - consistent: bool (default: true) - Enable or disable consistent data
         dumps. When enabled, produces a transactionally consistent dump at a
@@ -1295,12 +1574,33 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - checksum: bool (default: false) - Compute and include checksum of the
         dumped data.
+      - streamingChecksum: bool (default: false) - Compute the checksums from
+        the rows which are being dumped, instead of using separate queries,
+        requires checksum.
+      - performanceReport: bool (default: false) - Write the @.perf.json file
+        with timings and throughput of each table, partition and chunk.
+      - rawBinary: bool (default: false) - Write the contents of binary columns
+        as-is, escaping only the special characters, instead of encoding them
+        using base64.
+      - readReplicas: list of strings (default: not set) - URIs of the replicas
+        of the source instance which are used to read the table data.
+      - mirrorOutputUrls: list of strings (default: not set) - Additional
+        locations which receive a copy of each file of the dump.
+      - mirrorMaxLag: string (default: "64M") - Maximum number of bytes buffered
+        for each file written to a mirror location.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything. If ocimds is enabled, also checks for
         compatibility issues with MySQL HeatWave Service.
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust the number of rows in
+        each chunk using the throughput measured on the already dumped chunks of
+        the same table, so that all chunks take a similar amount of time to
+        dump.
+      - stealChunks: bool (default: false) - Allow threads which have no more
+        work to take over the unread part of the chunks which are being dumped
+        by other threads, writing it to new chunk files.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
@@ -1324,12 +1624,49 @@ DESCRIPTION
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxTotalRate: string (default: "0") - Limit the combined data read
+        throughput of all threads, measured in bytes per second, regardless of
+        the number of threads. Can be used together with maxRate. Use
+        maxTotalRate="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
+      - progressFormat: string (default: "text") - Format of the progress
+        information. Allowed values: text, jsonl. When set to jsonl, progress is
+        not displayed, instead it is written as a stream of events, one JSON
+        document per line, to the file descriptor specified by the progressFd
+        option.
+      - progressFd: int (default: 2) - File descriptor the progress events are
+        written to. Can only be used if progressFormat is set to jsonl.
+      - pipelinedFetch: bool (default: false) - Use an additional thread for
+        each dump thread to fetch rows from the server, while the dump thread
+        writes the previously fetched rows. Has no effect if the X Protocol is
+        used.
+      - sessionCompression: string (default: "auto") - Protocol compression used
+        by the sessions which read the data. Allowed values: auto, off, zstd,
+        zlib. When set to auto, zstd compression is enabled if the connection to
+        the server is slow, unless compression was already configured in the
+        connection options.
+      - dropPageCache: bool (default: false) - Advise the operating system to
+        evict the data files from the page cache once they are written, so that
+        a dump to a local directory does not push out other cached data. Dump is
+        written without using mmap(). Has no effect on the remote storage.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression
+        level may be specified as an option, i.e.: "zstd;level=9". Level of the
+        "zstd" compression may be set to "auto", it is then adjusted while the
+        data is dumped, depending on whether compressing or writing the data
+        takes longer.
+      - compressionThreads: int (default: 0) - Number of threads used by each
+        dump thread to compress the data, if set to 0, data is compressed by the
+        dump thread. Can only be used with the "zstd" or "gzip" compression.
+        Gzip files are then written as multiple independently compressed
+        members.
+      - compressionDictionary: bool (default: false) - Train a compression
+        dictionary for each table using its initial rows, and use it to compress
+        all data files of that table. Can only be used with the "zstd"
+        compression.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -1437,6 +1774,76 @@ DESCRIPTION
 
       The value of the threads option must be a positive number.
 
+      The stealChunks option can only be used with tables which are chunked
+      using an integer column, and cannot be used together with the checksum
+      option. Chunk files of such tables are followed by an additional empty
+      chunk file.
+
+      The streamingChecksum option hashes the rows while they are being written,
+      so the tables are scanned only once. Such dumps can only be loaded by a
+      version of the Shell which supports this checksum algorithm. It cannot be
+      used if the tzUtc option is set to false.
+
+      The performanceReport option records, for each table and partition, the
+      time it took to chunk it and the worker which did it. For each chunk, it
+      records the worker which dumped it, the time to receive the first row,
+      rows and bytes per second, the compression ratio and the time spent
+      writing to the output file.
+
+      The rawBinary option avoids the size overhead of base64 encoding and the
+      cost of encoding and decoding the BINARY, VARBINARY, BLOB, BIT and
+      GEOMETRY columns. It can only be used if the defaultCharacterSet option is
+      set to one of: ascii, binary, latin1, utf8, utf8mb3, utf8mb4, and the
+      fieldsEscapedBy option is not empty.
+
+      The readReplicas option spreads the worker threads between the source
+      instance and its replicas. When running a consistent dump, each replica
+      has to apply all the transactions of the source while the global read lock
+      is held, before the workers start their transactions, so all the workers
+      see the same data. This requires GTIDs to be enabled. If a replica URI
+      does not specify the user or the password, the ones of the source
+      connection are used.
+
+      The mirrorOutputUrls option writes the same dump to multiple locations at
+      the same time, each of them can be a local directory or an OCI prefix PAR.
+      Data is read from the source instance only once, each mirror is written by
+      a separate background thread. If a mirror falls behind by more than
+      mirrorMaxLag bytes, the dump waits until it catches up. The dump fails if
+      any of the locations cannot be written.
+
+      The compressionDictionary option improves the compression ratio of dumps
+      with many small chunk files. The dictionary of each table is stored in a
+      separate file, which is required to load the data files of that table.
+
+      The incrementalBase option creates an incremental dump, which contains
+      only the table data and is meant to be loaded into an instance which
+      already contains the data of the base dump. The base dump is read using
+      the same storage options as the output location. Tables whose watermark
+      was recorded by the base dump include only the rows with the value of the
+      watermark column greater than the recorded one, remaining tables are
+      dumped in full. All tables need to have a primary key or an equivalent
+      unique index, rows which already exist are replaced when the dump is
+      loaded. The watermark column should be indexed, i.e. a TIMESTAMP column
+      with the ON UPDATE CURRENT_TIMESTAMP attribute.
+
+      Incremental dumps do not capture deleted rows, nor the rows committed by
+      transactions which were in progress when the base dump was created, if
+      their watermark values are lower than the recorded ones. The number of
+      rows in each table is recorded: the load operation refuses to load an
+      incremental dump into tables whose rows were deleted, and warns about
+      tables which still contain rows deleted from the source instance. Use
+      util.dumpBinlogs() and util.loadBinlogs() to capture and apply all the
+      changes, deletes included, from the binary log.
+
+      The previousDump option compares each table with its copy in a complete
+      dump created earlier. Fingerprint of a table is computed using the
+      CHECKSUM TABLE statement and the options which affect the contents of the
+      data files. Data of the tables whose fingerprints did not change is not
+      dumped again, metadata of such tables refers to the data files of the
+      previous dump, which has to be available when the new dump is loaded,
+      using the same storage options. This option cannot be used together with
+      the ddlOnly, incrementalBase and checksum options.
+
       The dialect option predefines the set of options fieldsTerminatedBy (FT),
       fieldsEnclosedBy (FE), fieldsOptionallyEnclosed (FOE), fieldsEscapedBy
       (FESC) and linesTerminatedBy (LT) in the following manner:
@@ -1857,6 +2264,7 @@ DESCRIPTION
       - The path to the target location in a local filesystem or one of the
         supported cloud storage buckets
       - A Pre-Authenticated Request (PAR) to a bucket in OCI Object Storage
+      - A stream archive, using the stream:// scheme
 
       By default, a local directory is used, and in this case outputUrl can be
       prefixed with file:// scheme. If a relative path is given, the absolute
@@ -1870,10 +2278,24 @@ DESCRIPTION
       For additional details on using PARs see the Dumping to OCI Object
       Storage using Pre-Authenticated Request (PAR) section.
 
+      If the stream:// scheme is used, all dump files are multiplexed into a
+      single stream, which is written to the local file, pipe or FIFO given
+      after the scheme, i.e. stream:///dev/fd/3. Such stream can be loaded while
+      it is being created, using the same URL and the 'waitDumpTimeout' option
+      of the load dump utility. If stream://- is used, the stream is written to
+      the standard output and messages are printed to the standard error while
+      the dump is running. This allows to pipe the dump to another instance of
+      the shell, which loads it using the same URL. Standard streams are not
+      supported on Windows.
+
       The following options are supported:
 
       - all: bool (default: false) - Dump all views and tables from the
         specified schema.
+      - format: enum (default: "text") - Format of the data dump files, one of:
+        "text", "parquet".
+      - physical: bool (default: false) - Dump the data of the tables as copies
+        of their InnoDB tablespace files, instead of as text files.
       - ocimds: bool (default: false) - Enable checks for compatibility with
         MySQL HeatWave Service.
       - compatibility: list of strings (default: empty) - Apply MySQL HeatWave
@@ -1899,6 +2321,16 @@ DESCRIPTION
       - partitions: dictionary (default: not set) - A key-value pair of a table
         name in the format of schema.table and a list of valid partition names
         used to limit the data export to just the specified partitions.
+      - watermarkColumns: dictionary (default: not set) - A key-value pair of a
+        table name in the format of schema.table and a name of a column which is
+        updated each time a row is inserted or modified, maximum value of this
+        column is recorded in the dump.
+      - incrementalBase: string (default: not set) - Location of a complete
+        dump, only the data which has changed since that dump was created is
+        going to be dumped.
+      - previousDump: string (default: not set) - Location of a complete dump,
+        data of the tables which did not change since that dump was created is
+        not dumped again.
       - tzUtc: bool (default: true) - Convert TIMESTAMP data to UTC.
       - consistent: bool (default: true) - Enable or disable consistent data
         dumps. When enabled, produces a transactionally consistent dump at a
@@ -1911,12 +2343,33 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - checksum: bool (default: false) - Compute and include checksum of the
         dumped data.
+      - streamingChecksum: bool (default: false) - Compute the checksums from
+        the rows which are being dumped, instead of using separate queries,
+        requires checksum.
+      - performanceReport: bool (default: false) - Write the @.perf.json file
+        with timings and throughput of each table, partition and chunk.
+      - rawBinary: bool (default: false) - Write the contents of binary columns
+        as-is, escaping only the special characters, instead of encoding them
+        using base64.
+      - readReplicas: list of strings (default: not set) - URIs of the replicas
+        of the source instance which are used to read the table data.
+      - mirrorOutputUrls: list of strings (default: not set) - Additional
+        locations which receive a copy of each file of the dump.
+      - mirrorMaxLag: string (default: "64M") - Maximum number of bytes buffered
+        for each file written to a mirror location.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything. If ocimds is enabled, also checks for
         compatibility issues with MySQL HeatWave Service.
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust the number of rows in
+        each chunk using the throughput measured on the already dumped chunks of
+        the same table, so that all chunks take a similar amount of time to
+        dump.
+      - stealChunks: bool (default: false) - Allow threads which have no more
+        work to take over the unread part of the chunks which are being dumped
+        by other threads, writing it to new chunk files.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
@@ -1940,12 +2393,49 @@ DESCRIPTION
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxTotalRate: string (default: "0") - Limit the combined data read
+        throughput of all threads, measured in bytes per second, regardless of
+        the number of threads. Can be used together with maxRate. Use
+        maxTotalRate="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
+      - progressFormat: string (default: "text") - Format of the progress
+        information. Allowed values: text, jsonl. When set to jsonl, progress is
+        not displayed, instead it is written as a stream of events, one JSON
+        document per line, to the file descriptor specified by the progressFd
+        option.
+      - progressFd: int (default: 2) - File descriptor the progress events are
+        written to. Can only be used if progressFormat is set to jsonl.
+      - pipelinedFetch: bool (default: false) - Use an additional thread for
+        each dump thread to fetch rows from the server, while the dump thread
+        writes the previously fetched rows. Has no effect if the X Protocol is
+        used.
+      - sessionCompression: string (default: "auto") - Protocol compression used
+        by the sessions which read the data. Allowed values: auto, off, zstd,
+        zlib. When set to auto, zstd compression is enabled if the connection to
+        the server is slow, unless compression was already configured in the
+        connection options.
+      - dropPageCache: bool (default: false) - Advise the operating system to
+        evict the data files from the page cache once they are written, so that
+        a dump to a local directory does not push out other cached data. Dump is
+        written without using mmap(). Has no effect on the remote storage.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression
+        level may be specified as an option, i.e.: "zstd;level=9". Level of the
+        "zstd" compression may be set to "auto", it is then adjusted while the
+        data is dumped, depending on whether compressing or writing the data
+        takes longer.
+      - compressionThreads: int (default: 0) - Number of threads used by each
+        dump thread to compress the data, if set to 0, data is compressed by the
+        dump thread. Can only be used with the "zstd" or "gzip" compression.
+        Gzip files are then written as multiple independently compressed
+        members.
+      - compressionDictionary: bool (default: false) - Train a compression
+        dictionary for each table using its initial rows, and use it to compress
+        all data files of that table. Can only be used with the "zstd"
+        compression.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -2019,6 +2509,29 @@ DESCRIPTION
       be dumped. If the tables parameter is not set to an empty array, an
       exception is thrown.
 
+      If the format option is set to "parquet", table data is written using the
+      Apache Parquet format, each data file holds a single row group. Columns
+      use the dictionary encoding, unless the dictionary grows too big, then the
+      plain encoding is used. The data pages are compressed using the codec
+      specified by the compression option, the data files themselves are not
+      compressed. This format cannot be used together with the dialect, fields*
+      and lines* options. Dumps which use this format cannot be loaded using the
+      util.loadDump() function.
+
+      If the physical option is set to true, the tables are locked using FLUSH
+      TABLES ... FOR EXPORT and their InnoDB tablespace files are copied to the
+      dump, while the tables remain locked. The shell has to run on the same
+      host as the server, and all tables need to use file-per-table tablespaces.
+      This option cannot be used together with the format, where, partitions,
+      checksum, dataOnly, ocimds, compatibility, incrementalBase and
+      previousDump options.
+
+      When such dump is loaded, the tables are created, their tablespaces are
+      discarded and replaced with the dumped copies using ALTER TABLE ... IMPORT
+      TABLESPACE. The shell has to run on the same host as the target server,
+      the target server needs to have the same major and minor version as the
+      source server, and the dump needs to be complete before it is loaded.
+
       The names given in the exclude{object}, include{object}, where or
       partitions options should be valid MySQL identifiers, quoted using
       backtick characters when required.
@@ -2059,6 +2572,76 @@ DESCRIPTION
 
       The value of the threads option must be a positive number.
 
+      The stealChunks option can only be used with tables which are chunked
+      using an integer column, and cannot be used together with the checksum
+      option. Chunk files of such tables are followed by an additional empty
+      chunk file.
+
+      The streamingChecksum option hashes the rows while they are being written,
+      so the tables are scanned only once. Such dumps can only be loaded by a
+      version of the Shell which supports this checksum algorithm. It cannot be
+      used if the tzUtc option is set to false.
+
+      The performanceReport option records, for each table and partition, the
+      time it took to chunk it and the worker which did it. For each chunk, it
+      records the worker which dumped it, the time to receive the first row,
+      rows and bytes per second, the compression ratio and the time spent
+      writing to the output file.
+
+      The rawBinary option avoids the size overhead of base64 encoding and the
+      cost of encoding and decoding the BINARY, VARBINARY, BLOB, BIT and
+      GEOMETRY columns. It can only be used if the defaultCharacterSet option is
+      set to one of: ascii, binary, latin1, utf8, utf8mb3, utf8mb4, and the
+      fieldsEscapedBy option is not empty.
+
+      The readReplicas option spreads the worker threads between the source
+      instance and its replicas. When running a consistent dump, each replica
+      has to apply all the transactions of the source while the global read lock
+      is held, before the workers start their transactions, so all the workers
+      see the same data. This requires GTIDs to be enabled. If a replica URI
+      does not specify the user or the password, the ones of the source
+      connection are used.
+
+      The mirrorOutputUrls option writes the same dump to multiple locations at
+      the same time, each of them can be a local directory or an OCI prefix PAR.
+      Data is read from the source instance only once, each mirror is written by
+      a separate background thread. If a mirror falls behind by more than
+      mirrorMaxLag bytes, the dump waits until it catches up. The dump fails if
+      any of the locations cannot be written.
+
+      The compressionDictionary option improves the compression ratio of dumps
+      with many small chunk files. The dictionary of each table is stored in a
+      separate file, which is required to load the data files of that table.
+
+      The incrementalBase option creates an incremental dump, which contains
+      only the table data and is meant to be loaded into an instance which
+      already contains the data of the base dump. The base dump is read using
+      the same storage options as the output location. Tables whose watermark
+      was recorded by the base dump include only the rows with the value of the
+      watermark column greater than the recorded one, remaining tables are
+      dumped in full. All tables need to have a primary key or an equivalent
+      unique index, rows which already exist are replaced when the dump is
+      loaded. The watermark column should be indexed, i.e. a TIMESTAMP column
+      with the ON UPDATE CURRENT_TIMESTAMP attribute.
+
+      Incremental dumps do not capture deleted rows, nor the rows committed by
+      transactions which were in progress when the base dump was created, if
+      their watermark values are lower than the recorded ones. The number of
+      rows in each table is recorded: the load operation refuses to load an
+      incremental dump into tables whose rows were deleted, and warns about
+      tables which still contain rows deleted from the source instance. Use
+      util.dumpBinlogs() and util.loadBinlogs() to capture and apply all the
+      changes, deletes included, from the binary log.
+
+      The previousDump option compares each table with its copy in a complete
+      dump created earlier. Fingerprint of a table is computed using the
+      CHECKSUM TABLE statement and the options which affect the contents of the
+      data files. Data of the tables whose fingerprints did not change is not
+      dumped again, metadata of such tables refers to the data files of the
+      previous dump, which has to be available when the new dump is loaded,
+      using the same storage options. This option cannot be used together with
+      the ddlOnly, incrementalBase and checksum options.
+
       The dialect option predefines the set of options fieldsTerminatedBy (FT),
       fieldsEnclosedBy (FE), fieldsOptionallyEnclosed (FOE), fieldsEscapedBy
       (FESC) and linesTerminatedBy (LT) in the following manner:
@@ -2489,6 +3072,14 @@ DESCRIPTION
       - partitions: list of strings (default: not set) - A list of valid
         partition names used to limit the data export to just the specified
         partitions.
+      - threads: int (default: 1) - Use N threads to export the data. If greater
+        than 1, the table is divided into chunks which are exported in parallel
+        to temporary part files, these are merged into the output file once all
+        the data is exported. Cannot be used with the "parquet" format.
+      - bytesPerChunk: string (default: "64M") - Sets average estimated number
+        of bytes to be written to each chunk, used if threads is greater than 1.
+      - format: enum (default: "text") - Format of the data dump files, one of:
+        "text", "parquet".
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -2510,12 +3101,45 @@ DESCRIPTION
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxTotalRate: string (default: "0") - Limit the combined data read
+        throughput of all threads, measured in bytes per second, regardless of
+        the number of threads. Can be used together with maxRate. Use
+        maxTotalRate="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
+      - progressFormat: string (default: "text") - Format of the progress
+        information. Allowed values: text, jsonl. When set to jsonl, progress is
+        not displayed, instead it is written as a stream of events, one JSON
+        document per line, to the file descriptor specified by the progressFd
+        option.
+      - progressFd: int (default: 2) - File descriptor the progress events are
+        written to. Can only be used if progressFormat is set to jsonl.
+      - pipelinedFetch: bool (default: false) - Use an additional thread for
+        each dump thread to fetch rows from the server, while the dump thread
+        writes the previously fetched rows. Has no effect if the X Protocol is
+        used.
+      - sessionCompression: string (default: "auto") - Protocol compression used
+        by the sessions which read the data. Allowed values: auto, off, zstd,
+        zlib. When set to auto, zstd compression is enabled if the connection to
+        the server is slow, unless compression was already configured in the
+        connection options.
+      - dropPageCache: bool (default: false) - Advise the operating system to
+        evict the data files from the page cache once they are written, so that
+        a dump to a local directory does not push out other cached data. Dump is
+        written without using mmap(). Has no effect on the remote storage.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "none") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression
+        level may be specified as an option, i.e.: "zstd;level=9". Level of the
+        "zstd" compression may be set to "auto", it is then adjusted while the
+        data is dumped, depending on whether compressing or writing the data
+        takes longer.
+      - compressionThreads: int (default: 0) - Number of threads used by each
+        dump thread to compress the data, if set to 0, data is compressed by the
+        dump thread. Can only be used with the "zstd" or "gzip" compression.
+        Gzip files are then written as multiple independently compressed
+        members.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -2559,6 +3183,12 @@ DESCRIPTION
 
       This operation writes table data dump to the specified by the user files.
 
+      If the threads option is greater than 1, each thread uses its own session
+      to read the data and the export is not consistent if the table is modified
+      while it is being exported. Part files are written to the directory of the
+      output file, which needs to have enough space to hold both the parts and
+      the output file.
+
       Requires an open, global Shell session, and uses its connection options,
       such as compression, ssl-mode, etc., to establish additional connections.
 
@@ -2577,6 +3207,15 @@ DESCRIPTION
       - csv-unix: fully quoted, comma-separated, LF line endings. (LT=<LF>,
         FESC='\', FT=",", FE='"', FOE=false)
 
+      If the format option is set to "parquet", table data is written using the
+      Apache Parquet format, each data file holds a single row group. Columns
+      use the dictionary encoding, unless the dictionary grows too big, then the
+      plain encoding is used. The data pages are compressed using the codec
+      specified by the compression option, the data files themselves are not
+      compressed. This format cannot be used together with the dialect, fields*
+      and lines* options. Dumps which use this format cannot be loaded using the
+      util.loadDump() function.
+
       The maxRate option supports unit suffixes:
 
       - k - for kilobytes,
@@ -2831,6 +3470,10 @@ DESCRIPTION
       - table: string - name of table where the data will be imported.
       - tableColumn: string (default: "doc") - name of column in target table
         where the imported JSON documents will be stored.
+      - threads: int (default: 1) - number of threads, each one using its own X
+        Protocol session, used to insert the documents. If greater than 1,
+        documents are not guaranteed to be imported in the order they appear in
+        the file.
       - convertBsonTypes: bool (default: false) - enables the BSON data type
         conversion.
       - convertBsonOid: bool (default: the value of convertBsonTypes) - enables
@@ -2929,6 +3572,17 @@ DESCRIPTION
       the scheme part of a filename is omitted, then file:// transport backend
       will be chosen.
 
+      When multiple files are imported, local uncompressed files which are
+      bigger than 50M are split into chunks, just like a single file would be.
+      Biggest units of work are loaded first, so that all threads are kept busy
+      until the end of the import.
+
+      If the path is set to "-", data is read from the standard input (i.e.
+      zstdcat data.tsv.zst | mysqlsh -- util import-table - --table=t). The
+      stream is split into chunks while it is being read, chunks are loaded in
+      parallel by all the threads. The table option is required in this case,
+      the standard input cannot be combined with other files.
+
       Supported filename formats:
 
       - /path/to/file - Path to a locally or remotely (e.g. in OCI Object
@@ -3007,6 +3661,10 @@ DESCRIPTION
         k - for Kilobytes (n * 1'000 bytes), M - for Megabytes (n * 1'000'000
         bytes), G - for Gigabytes (n * 1'000'000'000 bytes), maxRate="2k" -
         limit to 2 kilobytes per second.
+      - maxTotalRate: string (default: "0") - Limit the combined data send
+        throughput of all threads to maxTotalRate in bytes per second,
+        regardless of the number of threads. Can be used together with maxRate.
+        Supports the same unit suffixes as maxRate. maxTotalRate="0" - no limit.
       - showProgress: bool (default: true if stdout is a tty, false otherwise)
         - Enable or disable import progress information.
       - skipRows: int (default: 0) - Skip first N physical lines from each of
@@ -3016,8 +3674,8 @@ DESCRIPTION
         that matches specific data file format. Can be used as base dialect and
         customized with fieldsTerminatedBy, fieldsEnclosedBy,
         fieldsOptionallyEnclosed, fieldsEscapedBy and linesTerminatedBy
-        options. Must be one of the following values: default, csv, tsv, json
-        or csv-unix.
+        options. Must be one of the following values: default, csv, tsv, json,
+        csv-unix, parquet or arrow.
       - decodeColumns: map (default: not set) - a map between columns names and
         SQL expressions to be applied on the loaded data. Column value captured
         in 'columns' by integer is available as user variable '@i', where `i`
@@ -3029,6 +3687,18 @@ DESCRIPTION
         to interpret the information in the file.
       - sessionInitSql: list of strings (default: []) - execute the given list
         of SQL statements in each session about to load data.
+      - fallbackToInsert: bool (default: false) - If the 'local_infile' global
+        system variable is set to OFF in the target server, load the data using
+        multi-row INSERT statements instead of failing. This is slower than LOAD
+        DATA LOCAL INFILE. User variable bindings in the columns option and
+        custom SQL expressions in the decodeColumns option are not supported in
+        this mode.
+      - deferTableIndexes: "off", "fulltext", "all" (default: off) - If "all",
+        secondary indexes of the target table, except for the UNIQUE ones, are
+        dropped before the import and recreated once all the data is loaded,
+        which in many cases can reduce import times. If the table has foreign
+        keys, only the full-text and spatial indexes are deferred. If
+        "fulltext", only full-text indexes will be deferred.
 
       OCI Object Storage Options
 
@@ -3230,6 +3900,15 @@ DESCRIPTION
         FE=<empty>, FOE=false)
       - csv-unix: fully quoted, comma-separated, lf line endings. (LT=<LF>,
         FESC='\', FT=",", FE='"', FOE=false)
+      - parquet: Apache Parquet files with a flat schema.
+      - arrow: Apache Arrow IPC (Feather V2) files with a flat schema.
+
+      The parquet and arrow dialects cannot be customized with the field and
+      line options, and cannot be used together with the skipRows option or to
+      read from the standard input. If columns are not set, names of the columns
+      stored in the first file are used. Each row group of a Parquet file and
+      each record batch of an Arrow file is loaded as a separate chunk, in
+      parallel.
 
       If the schema is not provided, an active schema on the global session, if
       set, will be used.
@@ -3240,6 +3919,13 @@ DESCRIPTION
       If you specify one separator that is the same as or a prefix of another,
       LOAD DATA INFILE cannot interpret the input properly.
 
+      A single zstd compressed file is decompressed using multiple threads if it
+      consists of multiple independent frames, i.e. it was written in the zstd
+      seekable format or by a parallel compressor which writes independent
+      frames. Frames of a remote file are detected only when the zstd seekable
+      format is used. Other compressed files are decompressed by a single
+      thread.
+
       Connection options set in the global session, such as compression,
       ssl-mode, etc. are used in parallel connections.
 
@@ -3280,6 +3966,8 @@ DESCRIPTION
         created with the ociParManifest option
       - PAR to the dump location - to load a dump from OCI Object Storage using
         a single PAR
+      - stream://path - to load a dump from a stream archive read from the given
+        local file, pipe or FIFO, stream://- reads it from the standard input
 
       loadDump() will load a dump from the specified path. It transparently
       handles compressed files and directly streams data when loading from
@@ -3288,6 +3976,13 @@ DESCRIPTION
       load a dump on-the-fly, loading table data chunks as the dumper produces
       them.
 
+      When loading a stream archive, files are received in the order in which
+      they were written by the dumper and are kept in memory until they are
+      loaded, data files are released once they are loaded. Files which do not
+      fit in 512MB of memory are moved to a scratch directory in the system
+      temporary directory. The 'waitDumpTimeout' option should be set, so that
+      the dump is loaded while it's being received.
+
       Table data will be loaded in parallel using the configured number of
       threads (4 by default). Multiple threads per table can be used if the
       dump was created with table chunking enabled. Data loads are scheduled
@@ -3346,16 +4041,31 @@ DESCRIPTION
         character set to be used for loading dump data. By default, the same
         character set used for dumping will be used (utf8mb4 if not set on
         dump).
+      - chunkWindow: int (default: not set) - If set, a chunk of a table is
+        loaded only if it is less than the given number of chunks past the
+        oldest chunk of that table which is still being loaded. Chunks are
+        dumped and loaded in the primary key order, limiting the window keeps
+        the concurrent inserts close to each other in the clustered index, which
+        reduces the number of page splits. Must be a positive integer, setting
+        it to 1 loads chunks of each table one at a time.
       - checksum: bool (default: false) - Verify tables against checksums that
         were computed during dump.
       - createInvisiblePKs: bool (default taken from dump) - Automatically
         create an invisible Primary Key for each table which does not have one.
         By default, set to true if dump was created with create_invisible_pks
         compatibility option, false otherwise. Requires server 8.0.24 or newer.
+      - deferTableAnalysis: bool (default: false) - If true, tables are analyzed
+        once all data and indexes are loaded and the database is ready to be
+        used, using a single thread. Progress of the analysis is stored in the
+        progress file, an interrupted analysis is resumed by the next load. Has
+        no effect if analyzeTables is set to "off".
       - deferTableIndexes: "off", "fulltext", "all" (default: fulltext) - If
         "all", creation of "all" indexes except PRIMARY is deferred until after
         table data is loaded, which in many cases can reduce load times. If
         "fulltext", only full-text indexes will be deferred.
+      - dropPageCache: bool (default: false) - Advise the operating system to
+        evict the data files from the page cache once they are read, when
+        loading a dump from a local directory.
       - dryRun: bool (default: false) - Scans the dump and prints everything
         that would be performed, without actually doing so.
       - excludeEvents: array of strings (default not set) - Skip loading
@@ -3377,6 +4087,16 @@ DESCRIPTION
         specified users from the dump. Each user is in the format of
         'user_name'[@'host']. If the host is not specified, all the accounts
         with the given user name are excluded.
+      - fallbackToInsert: bool (default: false) - If the 'local_infile' global
+        system variable is set to OFF in the target server, load the data using
+        multi-row INSERT statements instead of failing. This is slower than LOAD
+        DATA LOCAL INFILE.
+      - fastLoad: bool (default: false) - Disables the InnoDB redo log and the
+        doublewrite buffer for the duration of the load, both are restored once
+        the load completes or is aborted. The target instance must not have any
+        other client connections and must not be a replication source. Requires
+        MySQL 8.0.21 or newer, the doublewrite buffer is changed only on MySQL
+        8.0.30 or newer.
       - handleGrantErrors: "abort", "drop_account", "ignore" (default: abort) -
         Specifies action to be performed in case of errors related to the
         GRANT/REVOKE statements, "abort": throws an error and aborts the load,
@@ -3415,6 +4135,15 @@ DESCRIPTION
         'user_name'[@'host']. If the host is not specified, all the accounts
         with the given user name are included. By default, all users are
         included.
+      - indexBufferSize: string (default: not set) - Sets the
+        innodb_ddl_buffer_size session variable used when recreating the
+        deferred indexes. Supports unit suffixes: k (kilobytes), M (Megabytes),
+        G (Gigabytes). Requires MySQL 8.0.27 or newer.
+      - indexThreads: int (default: half of threads, rounded up) - Maximum
+        number of threads used to recreate the deferred indexes of tables which
+        are fully loaded, while data of other tables is still being loaded.
+        Setting it to 0 postpones recreation of indexes until all data is
+        loaded.
       - loadData: bool (default: true) - Loads table data from the dump.
       - loadDdl: bool (default: true) - Executes DDL/SQL scripts in the dump.
       - loadIndexes: bool (default: true) - use together with deferTableIndexes
@@ -3430,8 +4159,48 @@ DESCRIPTION
         not specified explicitly, the value of the bytesPerChunk dump option is
         used, but only in case of the files with data size greater than 1.5 *
         bytesPerChunk.
+      - maxMemory: string (default: not set) - Maximum amount of memory held by
+        the data buffers of the load operation: prefetched data files,
+        decompressed data and transaction buffers of the threads which load the
+        data. Threads wait for the memory to become available, prefetching and
+        decompression of the data ahead of the threads are skipped if there's
+        not enough memory. Supports unit suffixes: k (kilobytes), M (Megabytes),
+        G (Gigabytes). Setting it to 0 disables the limit.
+      - maxTotalRate: string (default: not set) - Limit the combined data
+        throughput of all threads which load the data, measured in bytes per
+        second, regardless of the number of threads. Supports unit suffixes: k
+        (kilobytes), M (Megabytes), G (Gigabytes). Setting it to 0 disables the
+        limit.
+      - sessionCompression: string (default: "auto") - Protocol compression used
+        by the sessions which load the data. Allowed values: auto, off, zstd,
+        zlib. When set to auto, zstd compression is enabled if the connection to
+        the server is slow, unless compression was already configured in the
+        connection options.
+      - minThreads: int (default: not set) - If set, the number of threads which
+        load the data is adjusted automatically between this value and the value
+        of the threads option, depending on the load of the target instance. The
+        number of threads is reduced if the InnoDB history list grows, threads
+        wait for free pages in the buffer pool, the checkpoint age is too high
+        or, if the target instance is a replica, its replication lag grows, and
+        it is increased otherwise.
+      - performanceReport: path (default: not set) - Writes a JSON report with
+        the time each thread spent executing the tasks, per task type, waiting
+        for the tasks to be scheduled and reading the data files from a remote
+        storage to the given local file path.
+      - prefetchMemory: string (default: 256M) - Maximum amount of memory used
+        to download the data files before they are loaded, when loading a dump
+        which is not stored in a local directory. Supports unit suffixes: k
+        (kilobytes), M (Megabytes), G (Gigabytes). Setting it to 0 disables
+        prefetching.
+      - progressFd: int (default: 2) - File descriptor the progress events are
+        written to. Can only be used if progressFormat is set to jsonl.
       - progressFile: path (default: load-progress.<server_uuid>.progress) -
         Stores load progress information in the given local file path.
+      - progressFormat: string (default: "text") - Format of the progress
+        information. Allowed values: text, jsonl. When set to jsonl, progress is
+        not displayed, instead it is written as a stream of events, one JSON
+        document per line, to the file descriptor specified by the progressFd
+        option.
       - resetProgress: bool (default: false) - Discards progress information of
         previous load attempts to the destination server and loads the whole
         dump again.
@@ -3446,6 +4215,10 @@ DESCRIPTION
         - Enable or disable import progress information.
       - skipBinlog: bool (default: false) - Disables the binary log for the
         MySQL sessions used by the loader (set sql_log_bin=0).
+      - statusFile: path (default: not set) - Periodically writes the status of
+        the load to the given local file path, as a JSON document which is
+        replaced atomically. It can be displayed using the \show dump_progress
+        report.
       - threads: int (default: 4) - Number of threads to use to import table
         data.
       - updateGtidSet: "off", "replace", "append" (default: off) - if set to a
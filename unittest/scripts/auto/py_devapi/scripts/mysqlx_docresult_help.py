@@ -40,6 +40,15 @@ docresult.help('fetch_all')
 #@ global help for fetch_all[USE:docresult.fetch_all]
 \help DocResult.fetch_all
 
+#@ docresult.fetch_many
+docresult.help('fetch_many')
+
+#@ global ? for fetch_many[USE:docresult.fetch_many]
+\? DocResult.fetch_many
+
+#@ global help for fetch_many[USE:docresult.fetch_many]
+\help DocResult.fetch_many
+
 #@ docresult.fetch_one
 docresult.help('fetch_one')
 
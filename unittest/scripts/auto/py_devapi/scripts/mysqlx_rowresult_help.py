@@ -65,6 +65,15 @@ rowresult.help('fetch_all')
 #@ global help for fetch_all[USE:rowresult.fetch_all]
 \help RowResult.fetch_all
 
+#@ rowresult.fetch_many
+rowresult.help('fetch_many')
+
+#@ global ? for fetch_many[USE:rowresult.fetch_many]
+\? RowResult.fetch_many
+
+#@ global help for fetch_many[USE:rowresult.fetch_many]
+\help RowResult.fetch_many
+
 #@ rowresult.fetch_one
 rowresult.help('fetch_one')
 
@@ -74,6 +83,15 @@ rowresult.help('fetch_one')
 #@ global help for fetch_one[USE:rowresult.fetch_one]
 \help RowResult.fetch_one
 
+#@ rowresult.fetch_one_into
+rowresult.help('fetch_one_into')
+
+#@ global ? for fetch_one_into[USE:rowresult.fetch_one_into]
+\? RowResult.fetch_one_into
+
+#@ global help for fetch_one_into[USE:rowresult.fetch_one_into]
+\help RowResult.fetch_one_into
+
 #@ rowresult.fetch_one_object
 rowresult.help('fetch_one_object')
 
@@ -190,3 +208,21 @@ rowresult.help('warnings_count')
 
 #@ global help for warnings_count[USE:rowresult.warnings_count]
 \help RowResult.warnings_count
+
+#@ rowresult.to_arrow
+rowresult.help('to_arrow')
+
+#@ global ? for to_arrow[USE:rowresult.to_arrow]
+\? RowResult.to_arrow
+
+#@ global help for to_arrow[USE:rowresult.to_arrow]
+\help RowResult.to_arrow
+
+#@ rowresult.to_pandas
+rowresult.help('to_pandas')
+
+#@ global ? for to_pandas[USE:rowresult.to_pandas]
+\? RowResult.to_pandas
+
+#@ global help for to_pandas[USE:rowresult.to_pandas]
+\help RowResult.to_pandas
@@ -83,6 +83,15 @@ sqlresult.help('fetch_all')
 #@ global help for fetch_all[USE:sqlresult.fetch_all]
 \help SqlResult.fetch_all
 
+#@ sqlresult.fetch_many
+sqlresult.help('fetch_many')
+
+#@ global ? for fetch_many[USE:sqlresult.fetch_many]
+\? SqlResult.fetch_many
+
+#@ global help for fetch_many[USE:sqlresult.fetch_many]
+\help SqlResult.fetch_many
+
 #@ sqlresult.fetch_one
 sqlresult.help('fetch_one')
 
@@ -92,6 +101,15 @@ sqlresult.help('fetch_one')
 #@ global help for fetch_one[USE:sqlresult.fetch_one]
 \help SqlResult.fetch_one
 
+#@ sqlresult.fetch_one_into
+sqlresult.help('fetch_one_into')
+
+#@ global ? for fetch_one_into[USE:sqlresult.fetch_one_into]
+\? SqlResult.fetch_one_into
+
+#@ global help for fetch_one_into[USE:sqlresult.fetch_one_into]
+\help SqlResult.fetch_one_into
+
 #@ sqlresult.fetch_one_object
 sqlresult.help('fetch_one_object')
 
@@ -253,3 +271,21 @@ sqlresult.help('warnings_count')
 
 #@ global help for warnings_count[USE:sqlresult.warnings_count]
 \help SqlResult.warnings_count
+
+#@ sqlresult.to_arrow
+sqlresult.help('to_arrow')
+
+#@ global ? for to_arrow[USE:sqlresult.to_arrow]
+\? SqlResult.to_arrow
+
+#@ global help for to_arrow[USE:sqlresult.to_arrow]
+\help SqlResult.to_arrow
+
+#@ sqlresult.to_pandas
+sqlresult.help('to_pandas')
+
+#@ global ? for to_pandas[USE:sqlresult.to_pandas]
+\? SqlResult.to_pandas
+
+#@ global help for to_pandas[USE:sqlresult.to_pandas]
+\help SqlResult.to_pandas
@@ -81,6 +81,13 @@ SYNTAX
 RETURNS
       A Result object.
 
+DESCRIPTION
+      If the documents do not fit into a single message, as limited by the
+      mysqlx_max_allowed_packet system variable, they are inserted using
+      multiple statements. If any of these statements fails, documents inserted
+      by the other ones are not removed, a transaction should be used if the
+      whole operation needs to be atomic.
+
 #@<OUT> colladd.help
 NAME
       help - Provides help about this class and it's members
@@ -700,6 +700,9 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetch_many(count)
+            Returns a list with up to count documents left on the result.
+
       fetch_one()
             Retrieves the next DbDoc on the DocResult.
 
@@ -849,9 +852,15 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetch_many(count)
+            Returns a list with up to count rows left on the result.
+
       fetch_one()
             Retrieves the next Row on the RowResult.
 
+      fetch_one_into(row)
+            Reads the next row of the result into the given Row object.
+
       fetch_one_object()
             Retrieves the next Row on the result and returns it as an object.
 
@@ -886,6 +895,12 @@ FUNCTIONS
       help([member])
             Provides help about this class and it's members
 
+      to_arrow([batchSize])
+            Returns the rows left on the result as a pyarrow Table.
+
+      to_pandas([batchSize])
+            Returns the rows left on the result as a pandas DataFrame.
+
 #@<OUT> Help on Schema
 NAME
       Schema - Represents a Schema as retrieved from a session created using
@@ -42,9 +42,15 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetch_many(count)
+            Returns a list with up to count rows left on the result.
+
       fetch_one()
             Retrieves the next Row on the RowResult.
 
+      fetch_one_into(row)
+            Reads the next row of the result into the given Row object.
+
       fetch_one_object()
             Retrieves the next Row on the result and returns it as an object.
 
@@ -79,6 +85,12 @@ FUNCTIONS
       help([member])
             Provides help about this class and it's members
 
+      to_arrow([batchSize])
+            Returns the rows left on the result as a pyarrow Table.
+
+      to_pandas([batchSize])
+            Returns the rows left on the result as a pandas DataFrame.
+
 #@<OUT> rowresult.affected_items_count
 NAME
       affected_items_count - Same as get_affected_items_count
@@ -125,6 +137,29 @@ SYNTAX
 RETURNS
       A List of DbDoc objects.
 
+#@<OUT> rowresult.fetch_many
+NAME
+      fetch_many - Returns a list with up to count rows left on the result.
+
+SYNTAX
+      <RowResult>.fetch_many(count)
+
+WHERE
+      count: The maximum number of rows to be returned.
+
+RETURNS
+      A List of rows.
+
+DESCRIPTION
+      Each row is a list with the values of its fields, in the same order as
+      the columns of the result.
+
+      In Python each row is returned as a tuple, which is created directly from
+      the data received from the server, this is the fastest way to retrieve
+      large results.
+
+      If there are no rows left on the result, an empty list is returned.
+
 #@<OUT> rowresult.fetch_one
 NAME
       fetch_one - Retrieves the next Row on the RowResult.
@@ -135,6 +170,30 @@ SYNTAX
 RETURNS
       A Row object representing the next record on the result.
 
+#@<OUT> rowresult.fetch_one_into
+NAME
+      fetch_one_into - Reads the next row of the result into the given Row
+                       object.
+
+SYNTAX
+      <RowResult>.fetch_one_into(row)
+
+WHERE
+      row: A Row object previously returned by fetch_one() on this result.
+
+RETURNS
+      A boolean value indicating whether a row was read.
+
+DESCRIPTION
+      The values of the given row are replaced with the ones of the next row, no
+      new Row object is created. This allows iterating over large results
+      without creating an object for each of the rows.
+
+      If there are no rows left on the result, false is returned and the row is
+      not modified.
+
+      An error is thrown if the given row has different columns than the result.
+
 #@<OUT> rowresult.fetch_one_object
 NAME
       fetch_one_object - Retrieves the next Row on the result and returns it as
@@ -302,3 +361,52 @@ NAME
 SYNTAX
       <RowResult>.warnings_count
 
+#@<OUT> rowresult.to_arrow
+NAME
+      to_arrow - Returns the rows left on the result as a pyarrow Table.
+
+SYNTAX
+      <RowResult>.to_arrow([batchSize])
+
+WHERE
+      batchSize: Optional maximum number of rows in each record batch of the
+                 table, default: 65536.
+
+RETURNS
+      A pyarrow.Table object.
+
+DESCRIPTION
+      The rows are read from the server in batches and written directly to the
+      columnar Arrow buffers, the resulting table consists of a record batch
+      for each of the batches.
+
+      The columns are converted to the following Arrow types:
+
+      - integer types and BIT - int64, or uint64 if unsigned
+      - FLOAT, DOUBLE - float, double
+      - DATE - date32, zero dates are converted to nulls
+      - DATETIME, TIMESTAMP - timestamp[us], zero dates are converted to nulls
+      - TIME - duration[us]
+      - binary strings and geometry - large_binary
+      - other types (including DECIMAL) - large_string
+
+      This function requires the pyarrow module.
+
+#@<OUT> rowresult.to_pandas
+NAME
+      to_pandas - Returns the rows left on the result as a pandas DataFrame.
+
+SYNTAX
+      <RowResult>.to_pandas([batchSize])
+
+WHERE
+      batchSize: Optional maximum number of rows in each record batch of the
+                 intermediate pyarrow Table, default: 65536.
+
+RETURNS
+      A pandas.DataFrame object.
+
+DESCRIPTION
+      Converts the pyarrow Table returned by to_arrow() to a DataFrame.
+
+      This function requires the pyarrow and pandas modules.
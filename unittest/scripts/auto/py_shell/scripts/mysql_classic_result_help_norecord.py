@@ -83,6 +83,15 @@ classicresult.help('fetch_all')
 #@ global help for fetch_all[USE:classicresult.fetch_all]
 \help ClassicResult.fetch_all
 
+#@ classicresult.fetch_many
+classicresult.help('fetch_many')
+
+#@ global ? for fetch_many[USE:classicresult.fetch_many]
+\? ClassicResult.fetch_many
+
+#@ global help for fetch_many[USE:classicresult.fetch_many]
+\help ClassicResult.fetch_many
+
 #@ classicresult.fetch_one
 classicresult.help('fetch_one')
 
@@ -92,6 +101,15 @@ classicresult.help('fetch_one')
 #@ global help for fetch_one[USE:classicresult.fetch_one]
 \help ClassicResult.fetch_one
 
+#@ classicresult.fetch_one_into
+classicresult.help('fetch_one_into')
+
+#@ global ? for fetch_one_into[USE:classicresult.fetch_one_into]
+\? ClassicResult.fetch_one_into
+
+#@ global help for fetch_one_into[USE:classicresult.fetch_one_into]
+\help ClassicResult.fetch_one_into
+
 #@ classicresult.fetch_one_object
 classicresult.help('fetch_one_object')
 
@@ -271,3 +289,21 @@ classicresult.help('warnings')
 
 #@ global help for warnings[USE:classicresult.warnings]
 \help ClassicResult.warnings
+
+#@ classicresult.to_arrow
+classicresult.help('to_arrow')
+
+#@ global ? for to_arrow[USE:classicresult.to_arrow]
+\? ClassicResult.to_arrow
+
+#@ global help for to_arrow[USE:classicresult.to_arrow]
+\help ClassicResult.to_arrow
+
+#@ classicresult.to_pandas
+classicresult.help('to_pandas')
+
+#@ global ? for to_pandas[USE:classicresult.to_pandas]
+\? ClassicResult.to_pandas
+
+#@ global help for to_pandas[USE:classicresult.to_pandas]
+\help ClassicResult.to_pandas
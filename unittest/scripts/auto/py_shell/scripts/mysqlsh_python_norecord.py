@@ -1,2 +1,29 @@
 #@ Python in interactive mode properly initializes sys.argv
-testutil.call_mysqlsh(["--py", "-i" ,"-e", "import sys; print('sys.argv = {0}'.format(sys.argv))"])
\ No newline at end of file
+testutil.call_mysqlsh(["--py", "-i" ,"-e", "import sys; print('sys.argv = {0}'.format(sys.argv))"])
+
+#@<> Python threads run while a native function is executed
+import threading
+
+ticks = []
+stop = threading.Event()
+
+def tick():
+    while not stop.is_set():
+        ticks.append(1)
+        stop.wait(0.01)
+
+thread = threading.Thread(target=tick)
+thread.start()
+
+shell.connect(__mysqluripwd)
+
+before = len(ticks)
+session.run_sql("SELECT SLEEP(1)")
+after = len(ticks)
+
+stop.set()
+thread.join()
+session.close()
+
+# GIL is released for the whole native call, thread ticks every 10ms
+EXPECT_LT(10, after - before)
@@ -0,0 +1,26 @@
+#@<> results are returned in order
+EXPECT_EQ([0, 2, 4, 6, 8, 10, 12, 14], shell.parallel(lambda x: 2 * x, list(range(8))))
+EXPECT_EQ([0, 2, 4, 6, 8, 10, 12, 14], shell.parallel(lambda x: 2 * x, list(range(8)), 3))
+EXPECT_EQ([], shell.parallel(lambda x: x, []))
+
+#@<> invalid arguments
+EXPECT_THROWS(lambda: shell.parallel(lambda x: x, [1], -1), "The number of threads must be a non-negative integer.")
+
+#@<> exceptions are propagated
+def fail(x):
+    if x == 3:
+        raise Exception("failed on 3")
+    return x
+
+EXPECT_THROWS(lambda: shell.parallel(fail, list(range(8)), 2), "failed on 3")
+
+#@<> each call uses its own session
+def server_id(uri):
+    session = shell.open_session(uri)
+    result = session.run_sql("SELECT @@server_id").fetch_one()[0]
+    session.close()
+    return result
+
+ids = shell.parallel(server_id, [__mysql_uri] * 4)
+EXPECT_EQ(4, len(ids))
+EXPECT_EQ(1, len(set(ids)))
@@ -773,5 +773,29 @@ src_session.run_sql("SET @@GLOBAL.time_zone = SYSTEM")
 #@<> WL15947 - cleanup
 src_session.run_sql("DROP SCHEMA IF EXISTS !;", [schema_name])
 
+#@<> memoryLimit and spillDirectory options
+TEST_STRING_OPTION("memoryLimit")
+TEST_STRING_OPTION("spillDirectory")
+
+EXPECT_FAIL("ValueError", f"Argument #{options_arg_no}: The option 'memoryLimit' cannot be set to an empty string.", __sandbox_uri2, { "memoryLimit": "" })
+EXPECT_FAIL("ValueError", f"Argument #{options_arg_no}: The option 'spillDirectory' cannot be set to an empty string.", __sandbox_uri2, { "spillDirectory": "" })
+
+spill_dir = os.path.join(__tmp_dir, "copy_spill")
+shutil.rmtree(spill_dir, True)
+os.mkdir(spill_dir)
+
+EXPECT_SUCCESS(__sandbox_uri2, { "memoryLimit": "16k", "spillDirectory": spill_dir })
+EXPECT_STDOUT_CONTAINS("Peak memory used by the copy buffers: ")
+EXPECT_STDOUT_CONTAINS(", spilled to disk: ")
+# scratch directory is removed
+EXPECT_EQ([], os.listdir(spill_dir))
+
+WIPE_OUTPUT()
+EXPECT_SUCCESS(__sandbox_uri2, { "memoryLimit": "0" })
+EXPECT_STDOUT_CONTAINS("Peak memory used by the copy buffers: ")
+EXPECT_STDOUT_NOT_CONTAINS(", spilled to disk: ")
+
+shutil.rmtree(spill_dir, True)
+
 #@<> Cleanup
 cleanup_copy_tests()
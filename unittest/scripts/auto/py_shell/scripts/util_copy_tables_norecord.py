@@ -695,5 +695,18 @@ src_session.run_sql("SET @@GLOBAL.time_zone = SYSTEM")
 #@<> WL15947 - cleanup
 src_session.run_sql("DROP SCHEMA IF EXISTS !;", [schema_name])
 
+#@<> binary data is copied without being encoded
+binary_schema = "binary_copy"
+binary_table = "data"
+src_session.run_sql("DROP SCHEMA IF EXISTS !", [binary_schema])
+src_session.run_sql("CREATE SCHEMA !", [binary_schema])
+src_session.run_sql("CREATE TABLE !.! (id INT PRIMARY KEY, b BINARY(4), vb VARBINARY(300), lb LONGBLOB, bt BIT(64), g GEOMETRY)", [binary_schema, binary_table])
+src_session.run_sql("INSERT INTO !.! VALUES (1, 0x00090A0D, 0x" + "".join([f"{i:02x}" for i in range(256)]) + ", REPEAT(0x5C000A09221A, 10000), b'1000000000000000000000000000000000000000000000000000000000001010', ST_GeomFromText('POINT(1 1)')), (2, NULL, '', '', NULL, NULL)", [binary_schema, binary_table])
+
+EXPECT_SUCCESS(__sandbox_uri2, { "checksum": True }, schema = binary_schema, tables = [binary_table])
+EXPECT_STDOUT_NOT_CONTAINS("Checksum verification failed")
+
+src_session.run_sql("DROP SCHEMA !", [binary_schema])
+
 #@<> Cleanup
 cleanup_copy_tests()
@@ -652,9 +652,9 @@ EXPECT_SUCCESS([test_schema], test_output_absolute, { "showProgress": False })
 # WL13807-FR4.12.1 - If the `chunking` option is set to `true` and the index column cannot be selected automatically as described in FR3.1, the data must to written to a single dump file. A warning should be displayed to the user.
 # WL13807-FR3.1 - For each table dumped, its index column (name of the column used to order the data and perform the chunking) must be selected automatically as the first column used in the primary key, or if there is no primary key, as the first column used in the first unique index. If the table to be dumped does not contain a primary key and does not contain an unique index, the index column will not be defined.
 # WL13807-TSFR_3_521_1
-# BUG#34195250 - if index column cannot be selected, table is dumped to multiple files by a single thread
-EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_non_unique}`. Data will be dumped to multiple files by a single thread.")
-EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_no_index}`. Data will be dumped to multiple files by a single thread.")
+# BUG#34195250 - if index column cannot be selected, table is dumped to multiple files
+EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_non_unique}`. Data will be dumped to multiple files, rows will be split between the threads using a hash.")
+EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_no_index}`. Data will be dumped to multiple files, rows will be split between the threads using a hash.")
 
 EXPECT_TRUE(has_file_with_basename(test_output_absolute, encode_table_basename(test_schema, test_table_non_unique) + "@"))
 EXPECT_TRUE(has_file_with_basename(test_output_absolute, encode_table_basename(test_schema, test_table_no_index) + "@"))
@@ -691,6 +691,9 @@ EXPECT_FAIL("ValueError", 'Argument #2: Input number "-1G" cannot be negative',
 EXPECT_FAIL("ValueError", "Argument #2: The option 'bytesPerChunk' cannot be set to an empty string.", test_output_absolute, { "bytesPerChunk": "" })
 # WL13807-TSFR_3_532_2
 EXPECT_FAIL("ValueError", "Argument #2: The option 'bytesPerChunk' cannot be used if the 'chunking' option is set to false.", test_output_absolute, { "bytesPerChunk": "128k", "chunking": False })
+EXPECT_FAIL("ValueError", "Argument #2: The option 'adaptiveChunking' cannot be used if the 'chunking' option is set to false.", test_output_absolute, { "adaptiveChunking": True, "chunking": False })
+EXPECT_FAIL("ValueError", "Argument #2: The option 'stealChunks' cannot be used if the 'chunking' option is set to false.", test_output_absolute, { "stealChunks": True, "chunking": False })
+EXPECT_FAIL("ValueError", "Argument #2: The 'stealChunks' and 'checksum' options cannot be both set to true.", test_output_absolute, { "stealChunks": True, "checksum": True })
 
 #@<> WL13807-TSFR_3_532_1
 EXPECT_SUCCESS([types_schema], test_output_absolute, { "bytesPerChunk": "1000k", "ddlOnly": True, "showProgress": False })
@@ -838,6 +841,232 @@ EXPECT_FAIL("ValueError", "Argument #2: Unknown compression type: dummy", test_o
 EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "zstd", "chunking": False, "showProgress": False })
 EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, types_schema_tables[0]) + ".tsv.zst")))
 
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "lz4", "chunking": False, "showProgress": False })
+EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, types_schema_tables[0]) + ".tsv.lz4")))
+
+#@<> lz4 compression - dump and load
+TEST_DUMP_AND_LOAD([types_schema], { "compression": "lz4;level=9", "bytesPerChunk": "128k", "showProgress": False })
+
+#@<> pipelinedFetch option
+TEST_BOOL_OPTION("pipelinedFetch")
+
+TEST_DUMP_AND_LOAD([types_schema], { "pipelinedFetch": True, "bytesPerChunk": "128k", "showProgress": False })
+TEST_DUMP_AND_LOAD([types_schema], { "pipelinedFetch": True, "chunking": False, "compression": "none", "showProgress": False })
+
+#@<> rawBinary option
+TEST_BOOL_OPTION("rawBinary")
+
+EXPECT_FAIL("ValueError", "Argument #2: The option 'rawBinary' cannot be used with the 'gbk' character set.", test_output_absolute, { "rawBinary": True, "defaultCharacterSet": "gbk" })
+EXPECT_FAIL("ValueError", "Argument #2: The option 'rawBinary' cannot be used if the 'fieldsEscapedBy' option is set to an empty string.", test_output_absolute, { "rawBinary": True, "fieldsEscapedBy": "" })
+
+#@<> rawBinary - dump and load
+TEST_DUMP_AND_LOAD([types_schema], { "rawBinary": True, "bytesPerChunk": "128k", "showProgress": False })
+
+for table in types_schema_tables:
+    EXPECT_FALSE("decodeColumns" in read_json(os.path.join(test_output_absolute, encode_table_basename(types_schema, table) + ".json"))["options"])
+
+TEST_DUMP_AND_LOAD([types_schema], { "rawBinary": True, "dialect": "csv", "pipelinedFetch": True, "showProgress": False })
+
+#@<> performanceReport option
+TEST_BOOL_OPTION("performanceReport")
+
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "bytesPerChunk": "128k", "showProgress": False })
+EXPECT_FALSE(os.path.isfile(os.path.join(test_output_absolute, "@.perf.json")))
+
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "performanceReport": True, "bytesPerChunk": "128k", "showProgress": False })
+report = read_json(os.path.join(test_output_absolute, "@.perf.json"))
+done = read_json(os.path.join(test_output_absolute, "@.done.json"))
+
+for table, rows in done["tableRows"][types_schema].items():
+    partitions = report["schemas"][types_schema][table].values()
+    EXPECT_EQ(rows, sum(p["rows"] for p in partitions))
+    EXPECT_EQ(done["tableDataBytes"][types_schema][table], sum(p["dataBytes"] for p in partitions))
+    for performance in partitions:
+        EXPECT_LE(0, performance["chunkingSeconds"])
+        EXPECT_EQ(performance["rows"], sum(chunk["rows"] for chunk in performance["chunks"]))
+        for chunk in performance["chunks"]:
+            EXPECT_TRUE(chunk["file"].startswith(encode_table_basename(types_schema, table)))
+            EXPECT_LE(chunk["firstRowSeconds"], chunk["seconds"])
+            EXPECT_LE(0, chunk["writeSeconds"])
+
+#@<> incremental dumps - setup
+incremental_schema = "incremental_dump"
+incremental_base = os.path.join(__tmp_dir, "incremental_base")
+shutil.rmtree(incremental_base, True)
+
+session.run_sql("DROP SCHEMA IF EXISTS !", [ incremental_schema ])
+session.run_sql("CREATE SCHEMA !", [ incremental_schema ])
+session.run_sql("CREATE TABLE !.tracked (id INT PRIMARY KEY, data VARCHAR(32), version INT NOT NULL, KEY (version))", [ incremental_schema ])
+session.run_sql("CREATE TABLE !.untracked (id INT PRIMARY KEY, data VARCHAR(32))", [ incremental_schema ])
+session.run_sql("CREATE TABLE !.no_pk (data VARCHAR(32))", [ incremental_schema ])
+
+for i in range(1, 101):
+    session.run_sql("INSERT INTO !.tracked VALUES (?, ?, 1)", [ incremental_schema, i, f"row {i}" ])
+    session.run_sql("INSERT INTO !.untracked VALUES (?, ?)", [ incremental_schema, i, f"row {i}" ])
+
+tracked_table = quote_identifier(incremental_schema, "tracked")
+no_pk_table = quote_identifier(incremental_schema, "no_pk")
+
+#@<> incremental dumps - options
+TEST_MAP_OF_STRINGS_OPTION("watermarkColumns")
+TEST_STRING_OPTION("incrementalBase")
+
+EXPECT_FAIL("ValueError", "Argument #2: The option 'incrementalBase' cannot be set to an empty string.", test_output_relative, { "incrementalBase": "" })
+EXPECT_FAIL("ValueError", "Argument #2: The 'incrementalBase' option cannot be used if the 'ddlOnly' option is set to true.", test_output_relative, { "incrementalBase": incremental_base, "ddlOnly": True })
+EXPECT_FAIL("ValueError", f"Argument #2: The watermark column of table '{incremental_schema}'.'tracked' given in the 'watermarkColumns' option cannot be empty.", test_output_relative, { "watermarkColumns": { tracked_table: "" } })
+EXPECT_FAIL("ValueError", f"The column 'dummy' given in the 'watermarkColumns' option does not exist in table {tracked_table}.", test_output_relative, { "includeSchemas": [ incremental_schema ], "watermarkColumns": { tracked_table: "dummy" }, "showProgress": False })
+EXPECT_FAIL("ValueError", f"The location '{absolute_path_for_output(incremental_base)}' given in the 'incrementalBase' option does not contain a dump.", test_output_relative, { "includeSchemas": [ incremental_schema ], "incrementalBase": incremental_base, "showProgress": False })
+
+#@<> incremental dumps - base dump records the watermark
+util.dump_instance(incremental_base, { "includeSchemas": [ incremental_schema ], "excludeTables": [ no_pk_table ], "watermarkColumns": { tracked_table: "version" }, "showProgress": False })
+
+with open(os.path.join(incremental_base, "@.done.json"), encoding="utf-8") as json_file:
+    metadata = json.load(json_file)
+    EXPECT_EQ({ incremental_schema: { "tracked": { "column": "version", "value": "1" } } }, metadata["watermarks"])
+    # only the tables with a watermark are counted
+    EXPECT_EQ({ incremental_schema: { "tracked": 100 } }, metadata["sourceRows"])
+
+#@<> incremental dumps - tables without a primary key
+EXPECT_FAIL("ValueError", f"Table {no_pk_table} does not have a primary key or an equivalent unique index, its rows cannot be dumped incrementally. Use the 'excludeTables' option to exclude it from the dump.", test_output_relative, { "includeSchemas": [ incremental_schema ], "incrementalBase": incremental_base, "showProgress": False })
+
+#@<> incremental dumps - dump the changes
+session.run_sql("UPDATE !.tracked SET data = 'changed', version = 2 WHERE id <= 10", [ incremental_schema ])
+session.run_sql("INSERT INTO !.tracked VALUES (101, 'new', 2)", [ incremental_schema ])
+session.run_sql("UPDATE !.untracked SET data = 'changed' WHERE id <= 10", [ incremental_schema ])
+
+EXPECT_SUCCESS([ incremental_schema ], test_output_absolute, { "excludeTables": [ no_pk_table ], "incrementalBase": incremental_base, "watermarkColumns": { tracked_table: "version" }, "showProgress": False })
+EXPECT_STDOUT_CONTAINS("Dumping rows which have changed since the dump started at ")
+
+with open(os.path.join(test_output_absolute, "@.json"), encoding="utf-8") as json_file:
+    metadata = json.load(json_file)
+    EXPECT_TRUE("incrementalBase" in metadata)
+    EXPECT_EQ({ incremental_schema: { "tracked": 100 } }, metadata["incrementalBase"]["sourceRows"])
+
+with open(os.path.join(test_output_absolute, "@.done.json"), encoding="utf-8") as json_file:
+    metadata = json.load(json_file)
+    # only the changed rows of the tracked table are dumped
+    EXPECT_EQ(11, metadata["tableRows"][incremental_schema]["tracked"])
+    EXPECT_EQ(100, metadata["tableRows"][incremental_schema]["untracked"])
+    EXPECT_EQ({ incremental_schema: { "tracked": { "column": "version", "value": "2" } } }, metadata["watermarks"])
+    # all rows of the source tables are counted
+    EXPECT_EQ({ incremental_schema: { "tracked": 101, "untracked": 100 } }, metadata["sourceRows"])
+
+#@<> incremental dumps - load the base and the incremental dump
+recreate_verification_schema()
+WIPE_STDOUT()
+
+EXPECT_NO_THROWS(lambda: util.load_dump(incremental_base, { "schema": verification_schema, "loadUsers": False, "showProgress": False, "resetProgress": True }), "loading the base dump should not throw")
+EXPECT_NO_THROWS(lambda: util.load_dump(test_output_absolute, { "schema": verification_schema, "loadUsers": False, "showProgress": False, "resetProgress": True }), "loading the incremental dump should not throw")
+EXPECT_STDOUT_CONTAINS("Loading an incremental dump")
+
+for table in [ "tracked", "untracked" ]:
+    EXPECT_EQ(md5_table(session, incremental_schema, table), md5_table(session, verification_schema, table))
+
+#@<> incremental dumps - rows deleted from the target instance
+session.run_sql("DELETE FROM !.tracked WHERE id <= 2", [ verification_schema ])
+WIPE_STDOUT()
+
+EXPECT_THROWS(lambda: util.load_dump(test_output_absolute, { "schema": verification_schema, "loadUsers": False, "showProgress": False, "resetProgress": True }), "The incremental dump cannot be loaded into tables whose rows were deleted")
+EXPECT_STDOUT_CONTAINS(f"Table {quote_identifier(verification_schema, 'tracked')} contains 99 rows, fewer than the 100 rows recorded by the base dump, rows were deleted from it after the base dump was loaded.")
+
+#@<> incremental dumps - rows deleted from the source instance
+session.run_sql("DELETE FROM !.tracked WHERE id = 50", [ incremental_schema ])
+
+EXPECT_SUCCESS([ incremental_schema ], test_output_absolute, { "excludeTables": [ no_pk_table ], "incrementalBase": incremental_base, "watermarkColumns": { tracked_table: "version" }, "showProgress": False })
+
+recreate_verification_schema()
+EXPECT_NO_THROWS(lambda: util.load_dump(incremental_base, { "schema": verification_schema, "loadUsers": False, "showProgress": False, "resetProgress": True }), "loading the base dump should not throw")
+WIPE_STDOUT()
+
+EXPECT_NO_THROWS(lambda: util.load_dump(test_output_absolute, { "schema": verification_schema, "loadUsers": False, "showProgress": False, "resetProgress": True }), "loading the incremental dump should not throw")
+EXPECT_STDOUT_CONTAINS(f"Table {quote_identifier(verification_schema, 'tracked')} contains 101 rows, while the source table contained 100 rows when the incremental dump was created.")
+EXPECT_STDOUT_CONTAINS("1 table(s) contain rows which were deleted from the source instance after the base dump was created, incremental dumps do not remove such rows.")
+
+#@<> incremental dumps - cleanup
+session.run_sql("DROP SCHEMA IF EXISTS !", [ incremental_schema ])
+shutil.rmtree(incremental_base, True)
+
+#@<> previous dump - setup
+previous_schema = "previous_dump"
+previous_dump = os.path.join(__tmp_dir, "previous_dump")
+shutil.rmtree(previous_dump, True)
+
+session.run_sql("DROP SCHEMA IF EXISTS !", [ previous_schema ])
+session.run_sql("CREATE SCHEMA !", [ previous_schema ])
+session.run_sql("CREATE TABLE !.static (id INT PRIMARY KEY, data VARCHAR(32))", [ previous_schema ])
+session.run_sql("CREATE TABLE !.dynamic (id INT PRIMARY KEY, data VARCHAR(32))", [ previous_schema ])
+
+for i in range(1, 101):
+    session.run_sql("INSERT INTO !.static VALUES (?, ?)", [ previous_schema, i, f"row {i}" ])
+    session.run_sql("INSERT INTO !.dynamic VALUES (?, ?)", [ previous_schema, i, f"row {i}" ])
+
+#@<> previous dump - options
+TEST_STRING_OPTION("previousDump")
+
+EXPECT_FAIL("ValueError", "Argument #2: The option 'previousDump' cannot be set to an empty string.", test_output_relative, { "previousDump": "" })
+EXPECT_FAIL("ValueError", "Argument #2: The 'previousDump' option cannot be used together with the 'ddlOnly' option.", test_output_relative, { "previousDump": previous_dump, "ddlOnly": True })
+EXPECT_FAIL("ValueError", "Argument #2: The 'previousDump' option cannot be used together with the 'checksum' option.", test_output_relative, { "previousDump": previous_dump, "checksum": True })
+EXPECT_FAIL("ValueError", f"The location '{absolute_path_for_output(previous_dump)}' given in the 'previousDump' option does not contain a dump.", test_output_relative, { "includeSchemas": [ previous_schema ], "previousDump": previous_dump, "showProgress": False })
+
+#@<> previous dump - fingerprints are recorded
+util.dump_instance(previous_dump, { "includeSchemas": [ previous_schema ], "showProgress": False })
+
+with open(os.path.join(previous_dump, "@.done.json"), encoding="utf-8") as json_file:
+    fingerprints = json.load(json_file)["tableFingerprints"][previous_schema]
+    EXPECT_EQ([ "dynamic", "static" ], sorted(fingerprints.keys()))
+    EXPECT_FALSE("location" in fingerprints["static"])
+
+#@<> previous dump - only the changed tables are dumped
+session.run_sql("UPDATE !.dynamic SET data = 'changed' WHERE id <= 10", [ previous_schema ])
+
+EXPECT_SUCCESS([ previous_schema ], test_output_absolute, { "previousDump": previous_dump, "showProgress": False })
+EXPECT_STDOUT_CONTAINS("Data of the tables which did not change since the previous dump is going to be reused")
+
+EXPECT_FALSE([ f for f in os.listdir(test_output_absolute) if f.startswith(encode_table_basename(previous_schema, "static")) and f.endswith(".zst") ])
+EXPECT_TRUE([ f for f in os.listdir(test_output_absolute) if f.startswith(encode_table_basename(previous_schema, "dynamic")) and f.endswith(".zst") ])
+
+with open(os.path.join(test_output_absolute, encode_table_basename(previous_schema, "static") + ".json"), encoding="utf-8") as json_file:
+    EXPECT_EQ(absolute_path_for_output(previous_dump), json.load(json_file)["dataReference"]["location"])
+
+with open(os.path.join(test_output_absolute, "@.done.json"), encoding="utf-8") as json_file:
+    metadata = json.load(json_file)
+    EXPECT_EQ(100, metadata["tableRows"][previous_schema]["static"])
+    EXPECT_EQ(absolute_path_for_output(previous_dump), metadata["tableFingerprints"][previous_schema]["static"]["location"])
+    EXPECT_FALSE("location" in metadata["tableFingerprints"][previous_schema]["dynamic"])
+
+#@<> previous dump - load the dump which refers to the previous one
+recreate_verification_schema()
+
+EXPECT_NO_THROWS(lambda: util.load_dump(test_output_absolute, { "schema": verification_schema, "loadUsers": False, "showProgress": False, "resetProgress": True }), "loading the dump should not throw")
+
+for table in [ "static", "dynamic" ]:
+    EXPECT_EQ(md5_table(session, previous_schema, table), md5_table(session, verification_schema, table))
+
+#@<> previous dump - cleanup
+session.run_sql("DROP SCHEMA IF EXISTS !", [ previous_schema ])
+shutil.rmtree(previous_dump, True)
+
+#@<> DDL of tables is written in batches
+batched_ddl_schema = "batched_ddl"
+session.run_sql("DROP SCHEMA IF EXISTS !", [ batched_ddl_schema ])
+session.run_sql("CREATE SCHEMA !", [ batched_ddl_schema ])
+
+for i in range(150):
+    session.run_sql(f"CREATE TABLE !.t{i} (id INT PRIMARY KEY)", [ batched_ddl_schema ])
+
+session.run_sql("CREATE TRIGGER !.t0_trigger BEFORE INSERT ON !.t0 FOR EACH ROW SET NEW.id = NEW.id + 1", [ batched_ddl_schema, batched_ddl_schema ])
+session.run_sql("CREATE TRIGGER !.t149_trigger BEFORE INSERT ON !.t149 FOR EACH ROW SET NEW.id = NEW.id + 1", [ batched_ddl_schema, batched_ddl_schema ])
+
+EXPECT_SUCCESS([ batched_ddl_schema ], test_output_absolute, { "ddlOnly": True, "showProgress": False })
+
+for i in range(150):
+    EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(batched_ddl_schema, f"t{i}") + ".sql")))
+
+EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(batched_ddl_schema, "t0") + ".triggers.sql")))
+EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(batched_ddl_schema, "t149") + ".triggers.sql")))
+
+session.run_sql("DROP SCHEMA IF EXISTS !", [ batched_ddl_schema ])
+
 #@<> WL13807: WL13804-FR5.3.2 - If the `compression` option is not given, a default value of `"none"` must be used instead.
 # WL13807-FR3 - Both new functions must accept the following options specified in WL#13804, FR5:
 # * The `compression` option specified in WL#13804, FR5.3, with the modification of FR5.3.2, the default value must be`"zstd"`.
@@ -3955,6 +4184,46 @@ EXPECT_TRUE(test_table_unique_null in checksums["data"][schema_name])
 EXPECT_SUCCESS([ schema_name ], test_output_absolute, { "dryRun": True, "checksum": True, "includeTables": [ quote_identifier(schema_name, test_table_unique_null) ], "showProgress": False })
 EXPECT_STDOUT_CONTAINS("Checksumming enabled.")
 
+#@<> streamingChecksum option
+TEST_BOOL_OPTION("streamingChecksum")
+
+EXPECT_FAIL("ValueError", "Argument #2: The option 'streamingChecksum' cannot be used if the 'checksum' option is set to false.", test_output_absolute, { "streamingChecksum": True })
+EXPECT_FAIL("ValueError", "Argument #2: The option 'streamingChecksum' cannot be used if the 'tzUtc' option is set to false.", test_output_absolute, { "streamingChecksum": True, "checksum": True, "tzUtc": False })
+
+#@<> streamingChecksum - dump and load
+session.run_sql("SET GLOBAL local_infile = true;")
+
+for options in [ { "chunking": True }, { "chunking": False }, { "pipelinedFetch": True } ]:
+    options.update({ "checksum": True, "streamingChecksum": True, "showProgress": False })
+    EXPECT_SUCCESS([ schema_name ], test_output_absolute, options)
+    checksums = read_json(checksum_file)
+    EXPECT_EQ("streaming", checksums["algorithm"])
+    EXPECT_EQ("base64", checksums["binaryEncoding"])
+    EXPECT_TRUE(test_table_primary in checksums["data"][schema_name])
+    session.run_sql("DROP SCHEMA IF EXISTS !;", [schema_name])
+    WIPE_OUTPUT()
+    EXPECT_NO_THROWS(lambda: util.load_dump(test_output_absolute, { "checksum": True, "showProgress": False }), "load should not fail")
+    EXPECT_STDOUT_CONTAINS("checksums were verified in")
+    EXPECT_STDOUT_NOT_CONTAINS("Checksum verification failed")
+
+#@<> stream archive - dump and load
+stream_archive = os.path.join(__tmp_dir, "stream_archive.bin")
+stream_url = "stream://" + stream_archive
+
+EXPECT_THROWS(lambda: util.dump_instance(stream_url, { "s3BucketName": "bucket" }), "The option 's3BucketName' can not be used when using a stream archive as the target output url.")
+
+EXPECT_NO_THROWS(lambda: util.dump_schemas([ schema_name ], stream_url, { "checksum": True, "showProgress": False }), "dump should not fail")
+EXPECT_TRUE(os.path.isfile(stream_archive))
+EXPECT_FALSE(os.path.isdir(test_output_absolute))
+
+session.run_sql("DROP SCHEMA IF EXISTS !;", [schema_name])
+WIPE_OUTPUT()
+EXPECT_NO_THROWS(lambda: util.load_dump(stream_url, { "checksum": True, "waitDumpTimeout": 1, "showProgress": False }), "load should not fail")
+EXPECT_STDOUT_CONTAINS("checksums were verified in")
+EXPECT_STDOUT_NOT_CONTAINS("Checksum verification failed")
+
+os.remove(stream_archive)
+
 #@<> WL15947 - cleanup
 session.run_sql("DROP SCHEMA IF EXISTS !;", [schema_name])
 
@@ -466,9 +466,9 @@ EXPECT_SUCCESS([test_schema], test_output_absolute, { "showProgress": False })
 # WL13807-FR4.12.1 - If the `chunking` option is set to `true` and the index column cannot be selected automatically as described in FR3.1, the data must to written to a single dump file. A warning should be displayed to the user.
 # WL13807-FR3.1 - For each table dumped, its index column (name of the column used to order the data and perform the chunking) must be selected automatically as the first column used in the primary key, or if there is no primary key, as the first column used in the first unique index. If the table to be dumped does not contain a primary key and does not contain an unique index, the index column will not be defined.
 # WL13807-TSFR_3_521_1
-# BUG#34195250 - if index column cannot be selected, table is dumped to multiple files by a single thread
-EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_non_unique}`. Data will be dumped to multiple files by a single thread.")
-EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_no_index}`. Data will be dumped to multiple files by a single thread.")
+# BUG#34195250 - if index column cannot be selected, table is dumped to multiple files
+EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_non_unique}`. Data will be dumped to multiple files, rows will be split between the threads using a hash.")
+EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_no_index}`. Data will be dumped to multiple files, rows will be split between the threads using a hash.")
 
 EXPECT_TRUE(has_file_with_basename(test_output_absolute, encode_table_basename(test_schema, test_table_non_unique) + "@"))
 EXPECT_TRUE(has_file_with_basename(test_output_absolute, encode_table_basename(test_schema, test_table_no_index) + "@"))
@@ -505,6 +505,9 @@ EXPECT_FAIL("ValueError", 'Argument #3: Input number "-1G" cannot be negative',
 EXPECT_FAIL("ValueError", "Argument #3: The option 'bytesPerChunk' cannot be set to an empty string.", [types_schema], test_output_absolute, { "bytesPerChunk": "" })
 # WL13807-TSFR_3_532_2
 EXPECT_FAIL("ValueError", "Argument #3: The option 'bytesPerChunk' cannot be used if the 'chunking' option is set to false.", [types_schema], test_output_absolute, { "bytesPerChunk": "128k", "chunking": False })
+EXPECT_FAIL("ValueError", "Argument #3: The option 'adaptiveChunking' cannot be used if the 'chunking' option is set to false.", [types_schema], test_output_absolute, { "adaptiveChunking": True, "chunking": False })
+EXPECT_FAIL("ValueError", "Argument #3: The option 'stealChunks' cannot be used if the 'chunking' option is set to false.", [types_schema], test_output_absolute, { "stealChunks": True, "chunking": False })
+EXPECT_FAIL("ValueError", "Argument #3: The 'stealChunks' and 'checksum' options cannot be both set to true.", [types_schema], test_output_absolute, { "stealChunks": True, "checksum": True })
 
 #@<> WL13807-TSFR_3_532_1
 EXPECT_SUCCESS([types_schema], test_output_absolute, { "bytesPerChunk": "1000k", "ddlOnly": True, "showProgress": False })
@@ -2746,6 +2749,30 @@ EXPECT_STDOUT_CONTAINS("Checksumming enabled.")
 #@<> WL15947 - cleanup
 session.run_sql("DROP SCHEMA IF EXISTS !;", [schema_name])
 
+#@<> table without an index is dumped by several threads
+tested_schema = "tested_schema"
+tested_table = "no_index"
+
+session.run_sql("DROP SCHEMA IF EXISTS !;", [tested_schema])
+session.run_sql("CREATE SCHEMA !;", [tested_schema])
+session.run_sql("CREATE TABLE !.! (a INT, b VARCHAR(100), c BLOB)", [tested_schema, tested_table])
+session.run_sql("SET @@SESSION.cte_max_recursion_depth = 20000;")
+session.run_sql("INSERT INTO !.! WITH RECURSIVE seq (n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < 20000) SELECT n % 100, IF(n % 7 = 0, NULL, REPEAT(MD5(n), 2)), IF(n % 3 = 0, NULL, MD5(n)) FROM seq;", [tested_schema, tested_table])
+session.run_sql("ANALYZE TABLE !.!;", [tested_schema, tested_table])
+
+WIPE_SHELL_LOG()
+EXPECT_SUCCESS([tested_schema], test_output_absolute, { "bytesPerChunk": "128k", "threads": 4, "checksum": True, "showProgress": False })
+EXPECT_SHELL_LOG_CONTAINS(f"Table `{tested_schema}`.`{tested_table}` does not have a valid index, rows are going to be dumped in 4 slices, selected using a hash of the row")
+
+# all rows are loaded and the checksum matches
+recreate_verification_schema()
+EXPECT_NO_THROWS(lambda: util.load_dump(test_output_absolute, { "checksum": True, "schema": verification_schema, "showProgress": False, "resetProgress": True }), "loading should not throw")
+EXPECT_EQ(md5_table(session, tested_schema, tested_table), md5_table(session, verification_schema, tested_table))
+
+#@<> table without an index is dumped by several threads - cleanup
+session.run_sql("DROP SCHEMA IF EXISTS !;", [tested_schema])
+session.run_sql("DROP SCHEMA IF EXISTS !;", [verification_schema])
+
 #@<> Cleanup
 drop_all_schemas()
 session.run_sql("SET GLOBAL local_infile = false;")
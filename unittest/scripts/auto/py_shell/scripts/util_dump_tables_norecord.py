@@ -602,6 +602,35 @@ EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basen
 EXPECT_FAIL("ValueError", "Argument #4: The option 'compression' cannot be set to an empty string.", types_schema, types_schema_tables, test_output_relative, { "compression": "" })
 EXPECT_FAIL("ValueError", "Argument #4: Unknown compression type: dummy", types_schema, types_schema_tables, test_output_relative, { "compression": "dummy" })
 
+#@<> compression options
+EXPECT_SUCCESS(types_schema, types_schema_tables, test_output_absolute, { "compression": "zstd;level=9", "compressionThreads": 2, "chunking": False, "showProgress": False })
+EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, types_schema_tables[0]) + ".tsv.zst")))
+
+EXPECT_SUCCESS(types_schema, types_schema_tables, test_output_absolute, { "compression": "gzip;level=9", "chunking": False, "showProgress": False })
+EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, types_schema_tables[0]) + ".tsv.gz")))
+
+EXPECT_SUCCESS(types_schema, types_schema_tables, test_output_absolute, { "compression": "gzip;level=6", "compressionThreads": 2, "chunking": False, "showProgress": False })
+EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, types_schema_tables[0]) + ".tsv.gz")))
+
+EXPECT_FAIL("ValueError", "Argument #4: The 'compressionThreads' option can only be used with the 'zstd' or 'gzip' compression.", types_schema, types_schema_tables, test_output_absolute, { "compression": "lz4", "compressionThreads": 2 })
+EXPECT_FAIL("ValueError", "Argument #4: The value of compression option 'level' for 'zstd' compression must be in range [1, 22], got: 30", types_schema, types_schema_tables, test_output_absolute, { "compression": "zstd;level=30" })
+EXPECT_FAIL("ValueError", "Argument #4: Unknown compression option: speed", types_schema, types_schema_tables, test_output_absolute, { "compression": "zstd;speed=1" })
+EXPECT_FAIL("ValueError", "Argument #4: The value of compression option 'level' for 'lz4' compression must be in range [1, 12], got: 13", types_schema, types_schema_tables, test_output_absolute, { "compression": "lz4;level=13" })
+EXPECT_FAIL("ValueError", "Argument #4: The 'compressionThreads' option can only be used with the 'zstd' compression.", types_schema, types_schema_tables, test_output_absolute, { "compression": "lz4", "compressionThreads": 2 })
+
+#@<> compression dictionary
+TEST_BOOL_OPTION("compressionDictionary")
+
+EXPECT_SUCCESS(types_schema, types_schema_tables, test_output_absolute, { "compressionDictionary": True, "showProgress": False })
+EXPECT_CAPABILITIES(os.path.join(test_output_absolute, "@.json"), [ compression_dictionary_capability ])
+
+EXPECT_SUCCESS(types_schema, types_schema_tables, test_output_absolute, { "showProgress": False })
+EXPECT_NO_CAPABILITIES(os.path.join(test_output_absolute, "@.json"), [ compression_dictionary_capability ])
+
+EXPECT_FAIL("ValueError", "Argument #4: The 'compressionDictionary' option can only be used with the 'zstd' compression.", types_schema, types_schema_tables, test_output_absolute, { "compression": "gzip", "compressionDictionary": True })
+EXPECT_FAIL("ValueError", "The 'compressionDictionary' option cannot be used if the 'format' option is set to 'parquet'.", types_schema, types_schema_tables, test_output_absolute, { "format": "parquet", "compressionDictionary": True })
+EXPECT_FAIL("ValueError", "The 'lz4' compression cannot be used if the 'format' option is set to 'parquet'.", types_schema, types_schema_tables, test_output_absolute, { "format": "parquet", "compression": "lz4" })
+
 #@<> WL13804-FR5.3.2 - If the `compression` option is not given, a default value of `"none"` must be used instead.
 # * The `compression` option specified in WL#13804, FR5.3, with the modification of FR5.3.2, the default value must be`"zstd"`.
 EXPECT_SUCCESS(types_schema, types_schema_tables, test_output_absolute, { "chunking": False, "showProgress": False })
@@ -794,9 +823,9 @@ EXPECT_SUCCESS(test_schema, test_schema_tables, test_output_absolute, { "showPro
 
 # WL13804: WL13807-FR4.12.1 - If the `chunking` option is set to `true` and the index column cannot be selected automatically as described in FR3.1, the data must to written to a single dump file. A warning should be displayed to the user.
 # WL13804: WL13807-FR3.1 - For each table dumped, its index column (name of the column used to order the data and perform the chunking) must be selected automatically as the first column used in the primary key, or if there is no primary key, as the first column used in the first unique index. If the table to be dumped does not contain a primary key and does not contain an unique index, the index column will not be defined.
-# BUG#34195250 - if index column cannot be selected, table is dumped to multiple files by a single thread
-EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_non_unique}`. Data will be dumped to multiple files by a single thread.")
-EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_no_index}`. Data will be dumped to multiple files by a single thread.")
+# BUG#34195250 - if index column cannot be selected, table is dumped to multiple files
+EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_non_unique}`. Data will be dumped to multiple files, rows will be split between the threads using a hash.")
+EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{test_schema}`.`{test_table_no_index}`. Data will be dumped to multiple files, rows will be split between the threads using a hash.")
 
 EXPECT_TRUE(has_file_with_basename(test_output_absolute, encode_table_basename(test_schema, test_table_non_unique) + "@"))
 EXPECT_TRUE(has_file_with_basename(test_output_absolute, encode_table_basename(test_schema, test_table_no_index) + "@"))
@@ -832,6 +861,11 @@ EXPECT_FAIL("ValueError", 'Argument #4: Wrong input number "hello"', types_schem
 EXPECT_FAIL("ValueError", "Argument #4: The option 'bytesPerChunk' cannot be set to an empty string.", types_schema, types_schema_tables, test_output_absolute, { "bytesPerChunk": "" })
 # WL13804-TSFR_11_2_28
 EXPECT_FAIL("ValueError", "Argument #4: The option 'bytesPerChunk' cannot be used if the 'chunking' option is set to false.", types_schema, types_schema_tables, test_output_absolute, { "bytesPerChunk": "128k", "chunking": False })
+EXPECT_FAIL("ValueError", "Argument #4: The option 'adaptiveChunking' cannot be used if the 'chunking' option is set to false.", types_schema, types_schema_tables, test_output_absolute, { "adaptiveChunking": True, "chunking": False })
+EXPECT_FAIL("ValueError", "Argument #4: The option 'stealChunks' cannot be used if the 'chunking' option is set to false.", types_schema, types_schema_tables, test_output_absolute, { "stealChunks": True, "chunking": False })
+EXPECT_FAIL("ValueError", "Argument #4: The 'stealChunks' and 'checksum' options cannot be both set to true.", types_schema, types_schema_tables, test_output_absolute, { "stealChunks": True, "checksum": True })
+EXPECT_FAIL("ValueError", "Argument #4: Invalid value 'dummy' for format option, allowed values: 'parquet' and 'text'.", types_schema, types_schema_tables, test_output_absolute, { "format": "dummy" })
+EXPECT_FAIL("ValueError", "The 'dialect' and 'fields*'/'lines*' options cannot be used if the 'format' option is set to 'parquet'.", types_schema, types_schema_tables, test_output_absolute, { "format": "parquet", "dialect": "csv" })
 
 # WL13804-TSFR_11_2_29
 EXPECT_SUCCESS(types_schema, types_schema_tables, test_output_absolute, { "bytesPerChunk": "1000k", "ddlOnly": True, "showProgress": False })
@@ -2249,8 +2283,8 @@ session.run_sql("INSERT INTO !.! VALUES (1), (2), (3);", [ tested_schema, tested
 
 WIPE_SHELL_LOG()
 EXPECT_SUCCESS(tested_schema, [tested_table], test_output_absolute, { "chunking": True, "showProgress": False })
-# BUG#34195250 - if index column cannot be selected, table is dumped to multiple files by a single thread
-EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{tested_schema}`.`{tested_table}`. Data will be dumped to multiple files by a single thread.")
+# BUG#34195250 - if index column cannot be selected, table is dumped to multiple files
+EXPECT_SHELL_LOG_CONTAINS(f"Could not select columns to be used as an index for table `{tested_schema}`.`{tested_table}`. Data will be dumped to multiple files, rows will be split between the threads using a hash.")
 EXPECT_TRUE(has_file_with_basename(test_output_absolute, encode_table_basename(tested_schema, tested_table) + "@"))
 
 session.run_sql("DROP SCHEMA !;", [ tested_schema ])
@@ -660,6 +660,11 @@ for dialect in [ "default", "csv", "tsv", "csv-unix" ]:
 
 #@<> WL13804-FR5.9.1 - The JSON dialect must not be supported.
 EXPECT_FAIL("ValueError", "Argument #3: The 'json' dialect is not supported.", quote(test_schema, test_table_json), test_output_relative, { "dialect": "json" })
+
+#@<> format option
+EXPECT_FAIL("ValueError", "Argument #3: Invalid value 'dummy' for format option, allowed values: 'parquet' and 'text'.", quote(types_schema, types_schema_tables[0]), test_output_relative, { "format": "dummy" })
+EXPECT_FAIL("ValueError", "The 'dialect' and 'fields*'/'lines*' options cannot be used if the 'format' option is set to 'parquet'.", quote(types_schema, types_schema_tables[0]), test_output_relative, { "format": "parquet", "dialect": "csv" })
+EXPECT_FAIL("ValueError", "The 'dialect' and 'fields*'/'lines*' options cannot be used if the 'format' option is set to 'parquet'.", quote(types_schema, types_schema_tables[0]), test_output_relative, { "format": "parquet", "fieldsTerminatedBy": "," })
 #@<> WL13804-FR5.9 - custom dialect
 for table in types_schema_tables:
     TEST_LOAD(types_schema, table, { "fieldsTerminatedBy": "a", "fieldsEnclosedBy": "b", "fieldsEscapedBy": "c", "linesTerminatedBy": "d", "fieldsOptionallyEnclosed": True })
@@ -1317,6 +1322,20 @@ session.run_sql("CREATE VIEW !.! AS SELECT * FROM !.!", [ schema_name, test_view
 TEST_LOAD(schema_name, test_view, source_table = no_partitions_table_name)
 TEST_LOAD(schema_name, test_view, { "where": "id > 12345" }, source_table = no_partitions_table_name)
 
+#@<> export using multiple threads
+for table in [ no_partitions_table_name, subpartitions_table_name ]:
+    TEST_LOAD(schema_name, table, { "threads": 4, "bytesPerChunk": "128k" })
+    EXPECT_EQ(count_rows(schema_name, table), count_rows(verification_schema, verification_table))
+    EXPECT_EQ([], [f for f in os.listdir(test_output_absolute_parent) if f.endswith(".part")])
+
+TEST_LOAD(schema_name, no_partitions_table_name, { "threads": 4, "bytesPerChunk": "128k", "where": "id > 12345" })
+EXPECT_GT(count_rows(schema_name, no_partitions_table_name), count_rows(verification_schema, verification_table))
+
+#@<> export using multiple threads - invalid options
+EXPECT_FAIL("ValueError", "The value of 'threads' option must be greater than 0.", quote(schema_name, no_partitions_table_name), test_output_absolute, { "threads": 0 })
+EXPECT_FAIL("ValueError", "The 'threads' option cannot be set to a value greater than 1 when exporting to the 'parquet' format.", quote(schema_name, no_partitions_table_name), test_output_absolute, { "threads": 2, "format": "parquet" })
+EXPECT_FAIL("ValueError", "The value of 'bytesPerChunk' option must be greater than or equal to 128k.", quote(schema_name, no_partitions_table_name), test_output_absolute, { "bytesPerChunk": "1k" })
+
 #@<> WL15311 - cleanup
 session.run_sql("DROP SCHEMA !;", [schema_name])
 
@@ -160,6 +160,8 @@ shell configuration.
 The following shell commands are available:
 
  - \                         Start multi-line input when in SQL mode.
+ - \bg                       Executes the given SQL statement in the
+                             background, using a new session.
  - \connect          (\c)    Connects the shell to a MySQL server and assigns
                              the global session.
  - \disconnect               Disconnects the global session.
@@ -171,6 +173,8 @@ The following shell commands are available:
  - \g                        Send command to mysql server.
  - \help             (\?,\h) Prints help information about a specific topic.
  - \history                  View and edit command line history.
+ - \jobs                     Lists the SQL statements executed in the
+                             background.
  - \js                       Switches to JavaScript processing mode.
  - \nopager                  Disables the current pager.
  - \nowarnings       (\w)    Don't show warnings after every statement.
@@ -191,6 +195,8 @@ The following shell commands are available:
                              session.
  - \system           (\!)    Execute a system shell command.
  - \use              (\u)    Sets the active schema.
+ - \wait                     Waits for the SQL statements executed in the
+                             background to finish.
  - \warnings         (\W)    Show warnings after every statement.
  - \watch                    Executes the given report with provided options
                              and arguments in a loop.
@@ -306,9 +312,10 @@ OBJECTS
  - dba InnoDB Cluster, ReplicaSet, and ClusterSet management functions.
 
 CLASSES
- - Cluster    Represents an InnoDB Cluster.
- - ClusterSet Represents an InnoDB ClusterSet.
- - ReplicaSet Represents an InnoDB ReplicaSet.
+ - Cluster        Represents an InnoDB Cluster.
+ - ClusterMonitor Keeps the status of an InnoDB Cluster in memory.
+ - ClusterSet     Represents an InnoDB ClusterSet.
+ - ReplicaSet     Represents an InnoDB ReplicaSet.
 
 #@<OUT> Help on shell commands
 The shell commands allow executing specific operations including updating the
@@ -419,6 +426,7 @@ The following topics were found at the AdminAPI category:
 
 - dba.delete_sandbox_instance
 - dba.deploy_sandbox_instance
+- dba.deploy_sandbox_instances
 - dba.kill_sandbox_instance
 - dba.start_sandbox_instance
 - dba.stop_sandbox_instance
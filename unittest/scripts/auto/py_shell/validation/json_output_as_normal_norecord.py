@@ -21,6 +21,7 @@ Dump duration: [[*]]
 Total duration: [[*]]
 Schemas dumped: 1
 Tables dumped: 3
+Peak DDL memory: [[*]]
 Uncompressed data size: [[*]] bytes
 Compressed data size: [[*]] bytes
 Compression ratio: [[*]]
@@ -53,6 +54,7 @@ ${*}
 {"status":"Total duration: [[*]]\n"}
 {"status":"Schemas dumped: [[*]]\n"}
 {"status":"Tables dumped: [[*]]\n"}
+{"status":"Peak DDL memory: [[*]]\n"}
 {"status":"Uncompressed data size: [[*]]\n"}
 {"status":"Compressed data size: [[*]]\n"}
 {"status":"Compression ratio: [[*]]\n"}
@@ -62,9 +62,15 @@ FUNCTIONS
             Returns a list of Row objects which contains an element for every
             record left on the result.
 
+      fetch_many(count)
+            Returns a list with up to count records left on the result.
+
       fetch_one()
             Retrieves the next Row on the ClassicResult.
 
+      fetch_one_into(row)
+            Reads the next row of the result into the given Row object.
+
       fetch_one_object()
             Retrieves the next Row on the result and returns it as an object.
 
@@ -130,6 +136,12 @@ FUNCTIONS
             Prepares the SqlResult to start reading data from the next Result
             (if many results were returned).
 
+      to_arrow([batchSize])
+            Returns the records left on the result as a pyarrow Table.
+
+      to_pandas([batchSize])
+            Returns the records left on the result as a pandas DataFrame.
+
 #@<OUT> classicresult.affected_items_count
 NAME
       affected_items_count - Same as get_affected_items_count
@@ -203,6 +215,29 @@ DESCRIPTION
       If fetchOne is called before this function, when this function is called
       it will return a Row for each of the remaining records on the resultset.
 
+#@<OUT> classicresult.fetch_many
+NAME
+      fetch_many - Returns a list with up to count records left on the result.
+
+SYNTAX
+      <ClassicResult>.fetch_many(count)
+
+WHERE
+      count: The maximum number of records to be returned.
+
+RETURNS
+      A List of records.
+
+DESCRIPTION
+      Each record is a list with the values of its fields, in the same order as
+      the columns of the result.
+
+      In Python each record is returned as a tuple, which is created directly
+      from the data received from the server, this is the fastest way to
+      retrieve large results.
+
+      If there are no records left on the result, an empty list is returned.
+
 #@<OUT> classicresult.fetch_one
 NAME
       fetch_one - Retrieves the next Row on the ClassicResult.
@@ -213,6 +248,30 @@ SYNTAX
 RETURNS
       A Row object representing the next record in the result.
 
+#@<OUT> classicresult.fetch_one_into
+NAME
+      fetch_one_into - Reads the next row of the result into the given Row
+                       object.
+
+SYNTAX
+      <ClassicResult>.fetch_one_into(row)
+
+WHERE
+      row: A Row object previously returned by fetch_one() on this result.
+
+RETURNS
+      A boolean value indicating whether a row was read.
+
+DESCRIPTION
+      The values of the given row are replaced with the ones of the next row, no
+      new Row object is created. This allows iterating over large results
+      without creating an object for each of the rows.
+
+      If there are no rows left on the result, false is returned and the row is
+      not modified.
+
+      An error is thrown if the given row has different columns than the result.
+
 #@<OUT> classicresult.fetch_one_object
 NAME
       fetch_one_object - Retrieves the next Row on the result and returns it as
@@ -455,3 +514,52 @@ NAME
 SYNTAX
       <ClassicResult>.warnings
 
+#@<OUT> classicresult.to_arrow
+NAME
+      to_arrow - Returns the records left on the result as a pyarrow Table.
+
+SYNTAX
+      <ClassicResult>.to_arrow([batchSize])
+
+WHERE
+      batchSize: Optional maximum number of records in each record batch of the
+                 table, default: 65536.
+
+RETURNS
+      A pyarrow.Table object.
+
+DESCRIPTION
+      The records are read from the server in batches and written directly to
+      the columnar Arrow buffers, the resulting table consists of a record
+      batch for each of the batches.
+
+      The columns are converted to the following Arrow types:
+
+      - integer types and BIT - int64, or uint64 if unsigned
+      - FLOAT, DOUBLE - float, double
+      - DATE - date32, zero dates are converted to nulls
+      - DATETIME, TIMESTAMP - timestamp[us], zero dates are converted to nulls
+      - TIME - duration[us]
+      - binary strings and geometry - large_binary
+      - other types (including DECIMAL) - large_string
+
+      This function requires the pyarrow module.
+
+#@<OUT> classicresult.to_pandas
+NAME
+      to_pandas - Returns the records left on the result as a pandas DataFrame.
+
+SYNTAX
+      <ClassicResult>.to_pandas([batchSize])
+
+WHERE
+      batchSize: Optional maximum number of records in each record batch of the
+                 intermediate pyarrow Table, default: 65536.
+
+RETURNS
+      A pandas.DataFrame object.
+
+DESCRIPTION
+      Converts the pyarrow Table returned by to_arrow() to a DataFrame.
+
+      This function requires the pyarrow and pandas modules.
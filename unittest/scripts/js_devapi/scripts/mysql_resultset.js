@@ -35,6 +35,8 @@ validateMembers(result, [
 'fetchOne',
 'fetchOneObject',
 'fetchAll',
+'fetchMany',
+'fetchOneInto',
 'hasData',
 'nextDataSet',
 'nextResult',
@@ -128,4 +130,25 @@ println(row[1])
 println(row[2])
 println(row[3])
 
+//@<> fetchMany() returns lists with the field values
+var result = mySession.runSql("select name, age from js_shell_test.buffer_table order by name")
+EXPECT_EQ([['adam', 15], ['alma', 13]], result.fetchMany(2))
+EXPECT_EQ([], result.fetchMany(0))
+EXPECT_EQ('angel', result.fetchOne()[0])
+EXPECT_EQ(4, result.fetchMany(100).length)
+EXPECT_EQ([], result.fetchMany(1))
+
+//@<> fetchOneInto() reads the next row into the given one
+var result = mySession.runSql("select name, age from js_shell_test.buffer_table order by name")
+var row = result.fetchOne()
+EXPECT_EQ('adam', row.name)
+EXPECT_TRUE(result.fetchOneInto(row))
+EXPECT_EQ('alma', row.name)
+EXPECT_EQ(13, row[1])
+var other = mySession.runSql("select 1 as a").fetchOne()
+EXPECT_THROWS(function() { result.fetchOneInto(other) }, "Argument #1 has to be a Row with the same columns as this result")
+EXPECT_EQ(5, result.fetchAll().length)
+EXPECT_FALSE(result.fetchOneInto(row))
+EXPECT_EQ('alma', row.name)
+
 mySession.close()
\ No newline at end of file
@@ -29,6 +29,8 @@ validateMembers(result, [
     'fetchOne',
     'fetchOneObject',
     'fetchAll',
+    'fetchMany',
+    'fetchOneInto',
     'help',
     'hasData',
     'nextDataSet',
@@ -94,7 +96,9 @@ validateMembers(result, [
     'help',
     'fetchOne',
     'fetchOneObject',
-    'fetchAll'])
+    'fetchAll',
+    'fetchMany',
+    'fetchOneInto'])
 
 //@<> DocResult member validation
 var result = collection.find().execute();
@@ -112,7 +116,8 @@ validateMembers(result, [
     'getWarningsCount',
     'help',
     'fetchOne',
-    'fetchAll'])
+    'fetchAll',
+    'fetchMany'])
 
 
 //@ Resultset hasData false
@@ -261,5 +266,30 @@ mySession.sql('CREATE PROCEDURE my_proc() BEGIN SELECT name FROM js_shell_test.b
 var res = mySession.sql('CALL my_proc();').execute();
 var res2 = mySession.sql('SELECT 1;').execute();
 
+//@<> RowResult.fetchOneInto() reads the next row into the given one
+var result = table.select('name', 'age').orderBy('name').execute();
+var row = result.fetchOne();
+EXPECT_EQ('adam', row.name);
+EXPECT_TRUE(result.fetchOneInto(row));
+EXPECT_EQ('alma', row.name);
+EXPECT_EQ(13, row[1]);
+var other = table.select('name').execute().fetchOne();
+EXPECT_THROWS(function() { result.fetchOneInto(other) }, "Argument #1 has to be a Row with the same columns as this result");
+EXPECT_EQ(5, result.fetchAll().length);
+EXPECT_FALSE(result.fetchOneInto(row));
+EXPECT_EQ('alma', row.name);
+
+//@<> DocResult.fetchMany() returns the documents
+collection.add([{_id: '1', n: 1}, {_id: '2', n: 2}, {_id: '3', n: 3}]).execute();
+var result = collection.find().sort('n').execute();
+var docs = result.fetchMany(2);
+EXPECT_EQ(2, docs.length);
+EXPECT_EQ(1, docs[0].n);
+EXPECT_EQ(2, docs[1].n);
+EXPECT_EQ([], result.fetchMany(0));
+EXPECT_EQ(3, result.fetchMany(10)[0].n);
+EXPECT_EQ([], result.fetchMany(10));
+collection.remove('true').execute();
+
 //@<> cleanup
 mySession.close()
@@ -36,6 +36,10 @@ validate_members(result, [
   'fetch_one',
   'fetch_one_object',
   'fetch_all',
+  'fetch_many',
+  'fetch_one_into',
+  'to_arrow',
+  'to_pandas',
   'has_data',
   'next_data_set',
   'next_result',
@@ -171,3 +175,87 @@ print(row[1])
 print(row[2])
 print(row[3])
 
+
+#@<> fetch_many() returns tuples created from the row data
+import datetime
+
+result = mySession.run_sql("select 1, -2, 'text', 0x00FF, null, cast('2000-01-01' as date), 1.25")
+EXPECT_EQ([(1, -2, 'text', b'\x00\xff', None, datetime.date(2000, 1, 1), '1.25')], result.fetch_many(10))
+EXPECT_EQ([], result.fetch_many(10))
+
+result = mySession.run_sql("select name, age from js_shell_test.buffer_table order by name")
+EXPECT_EQ([('adam', 15), ('alma', 13)], result.fetch_many(2))
+EXPECT_EQ([], result.fetch_many(0))
+EXPECT_EQ('angel', result.fetch_one()[0])
+EXPECT_EQ(4, len(result.fetch_many(100)))
+
+result = mySession.run_sql("use js_shell_test")
+EXPECT_EQ([], result.fetch_many(1))
+
+EXPECT_THROWS(lambda: result.fetch_many('1'), "Argument #1 is expected to be an unsigned integer")
+
+#@<> fetch_one_into() reads the next row into the given one
+result = mySession.run_sql("select name, age from js_shell_test.buffer_table order by name")
+row = result.fetch_one()
+EXPECT_EQ('adam', row.name)
+EXPECT_TRUE(result.fetch_one_into(row))
+EXPECT_EQ('alma', row.name)
+EXPECT_EQ(13, row[1])
+other = mySession.run_sql("select 1 as a").fetch_one()
+EXPECT_THROWS(lambda: result.fetch_one_into(other), "Argument #1 has to be a Row with the same columns as this result")
+EXPECT_EQ(5, len(result.fetch_all()))
+EXPECT_FALSE(result.fetch_one_into(row))
+EXPECT_EQ('alma', row.name)
+
+#@<> to_arrow()/to_pandas() setup
+import importlib.util
+has_pyarrow = importlib.util.find_spec("pyarrow") is not None
+has_pandas = has_pyarrow and importlib.util.find_spec("pandas") is not None
+
+#@<> to_arrow() requires pyarrow {not has_pyarrow}
+result = mySession.run_sql("select 1")
+EXPECT_THROWS(lambda: result.to_arrow(), "No module named 'pyarrow'")
+
+#@<> to_arrow() builds the table straight from the row data {has_pyarrow}
+import pyarrow
+result = mySession.run_sql("select name, age, 0x00FF as b, cast('2000-01-01' as date) as d, cast('2000-01-01 01:02:03.5' as datetime(1)) as dt, cast('-01:00:00' as time) as t, 1.25 as dec, null as n from js_shell_test.buffer_table order by name")
+table = result.to_arrow(3)
+EXPECT_EQ(7, table.num_rows)
+EXPECT_EQ(['name', 'age', 'b', 'd', 'dt', 't', 'dec', 'n'], table.column_names)
+EXPECT_EQ(3, len(table.to_batches()))
+EXPECT_EQ(pyarrow.large_string(), table.schema.field('name').type)
+EXPECT_EQ(pyarrow.int64(), table.schema.field('age').type)
+EXPECT_EQ(pyarrow.large_binary(), table.schema.field('b').type)
+EXPECT_EQ(pyarrow.date32(), table.schema.field('d').type)
+EXPECT_EQ(pyarrow.timestamp('us'), table.schema.field('dt').type)
+EXPECT_EQ(pyarrow.duration('us'), table.schema.field('t').type)
+EXPECT_EQ(pyarrow.null(), table.schema.field('n').type)
+EXPECT_EQ(['adam', 'alma', 'angel', 'brian', 'carol', 'donna', 'jack'], table.column('name').to_pylist())
+EXPECT_EQ([15, 13, 14, 14, 14, 16, 17], table.column('age').to_pylist())
+
+row = table.slice(0, 1).to_pylist()[0]
+EXPECT_EQ(b'\x00\xff', row['b'])
+EXPECT_EQ(datetime.date(2000, 1, 1), row['d'])
+EXPECT_EQ(datetime.datetime(2000, 1, 1, 1, 2, 3, 500000), row['dt'])
+EXPECT_EQ(datetime.timedelta(hours=-1), row['t'])
+EXPECT_EQ('1.25', row['dec'])
+EXPECT_EQ(None, row['n'])
+
+# result is consumed
+EXPECT_EQ(0, result.to_arrow().num_rows)
+
+#@<> to_arrow() with no result set {has_pyarrow}
+result = mySession.run_sql("use js_shell_test")
+EXPECT_EQ(0, result.to_arrow().num_columns)
+
+#@<> to_arrow() invalid batch size {has_pyarrow}
+result = mySession.run_sql("select 1")
+EXPECT_THROWS(lambda: result.to_arrow(0), "ValueError: The batch size must be greater than zero.")
+EXPECT_THROWS(lambda: result.to_arrow('1'), "Argument #1 is expected to be an unsigned integer")
+
+#@<> to_pandas() {has_pandas}
+result = mySession.run_sql("select name, age from js_shell_test.buffer_table order by name")
+df = result.to_pandas()
+EXPECT_EQ((7, 2), df.shape)
+EXPECT_EQ('adam', df['name'][0])
+EXPECT_EQ(17, df['age'][6])
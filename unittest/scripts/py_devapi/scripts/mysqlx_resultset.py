@@ -29,6 +29,10 @@ validate_members(result, [
   'fetch_one',
   'fetch_one_object',
   'fetch_all',
+  'fetch_many',
+  'fetch_one_into',
+  'to_arrow',
+  'to_pandas',
   'has_data',
   'help',
   'next_data_set',
@@ -116,7 +120,11 @@ validate_members(result, [
   'get_column_names',
   'get_columns',
   'fetch_one',
-  'fetch_all'])
+  'fetch_all',
+  'fetch_many',
+  'fetch_one_into',
+  'to_arrow',
+  'to_pandas'])
 
 #@<> DocResult member validation
 result = collection.find().execute()
@@ -134,7 +142,8 @@ validate_members(result, [
   'get_warnings_count',
   'help',
   'fetch_one',
-  'fetch_all'])
+  'fetch_all',
+  'fetch_many'])
 
 #@ Resultset has_data() False
 result = mySession.sql('use js_shell_test').execute()
@@ -305,5 +314,30 @@ result = mySession.run_sql("select NULL")
 print([c.column_label for c in result.columns])
 print(result.column_names)
 
+#@<> RowResult.fetch_one_into() reads the next row into the given one
+result = table.select('name', 'age').order_by('name').execute()
+row = result.fetch_one()
+EXPECT_EQ('adam', row.name)
+EXPECT_TRUE(result.fetch_one_into(row))
+EXPECT_EQ('alma', row.name)
+EXPECT_EQ(13, row[1])
+other = table.select('name').execute().fetch_one()
+EXPECT_THROWS(lambda: result.fetch_one_into(other), "Argument #1 has to be a Row with the same columns as this result")
+EXPECT_EQ(5, len(result.fetch_all()))
+EXPECT_FALSE(result.fetch_one_into(row))
+EXPECT_EQ('alma', row.name)
+
+#@<> DocResult.fetch_many() returns the documents
+collection.add([{'_id': '1', 'n': 1}, {'_id': '2', 'n': 2}, {'_id': '3', 'n': 3}]).execute()
+result = collection.find().sort('n').execute()
+docs = result.fetch_many(2)
+EXPECT_EQ(2, len(docs))
+EXPECT_EQ(1, docs[0]['n'])
+EXPECT_EQ(2, docs[1]['n'])
+EXPECT_EQ([], result.fetch_many(0))
+EXPECT_EQ(3, result.fetch_many(10)[0]['n'])
+EXPECT_EQ([], result.fetch_many(10))
+collection.remove('true').execute()
+
 #@<> cleanup
 mySession.close()
@@ -647,6 +647,37 @@ TEST_F(Shell_cli_operation_test, parse_commandline) {
   }
 }
 
+TEST_F(Shell_cli_operation_test, target_path) {
+  {
+    const char *args[] = {"util", "dump-instance", "/tmp/dump", "--threads=4"};
+    Options::Cmdline_iterator it(4, args, 0);
+    parse(&it);
+    EXPECT_EQ(std::vector<std::string>({"util", "dump-instance", "/tmp/dump"}),
+              target_path());
+  }
+  {
+    const char *args[] = {"shell", "options", "set-persist", "history.autoSave",
+                          "true"};
+    Options::Cmdline_iterator it(5, args, 0);
+    parse(&it);
+    EXPECT_EQ(std::vector<std::string>({"shell", "options", "set-persist",
+                                        "history.autoSave", "true"}),
+              target_path());
+  }
+  {
+    const char *args[] = {"dba", "--help"};
+    Options::Cmdline_iterator it(2, args, 0);
+    parse(&it);
+    EXPECT_EQ(std::vector<std::string>({"dba"}), target_path());
+  }
+  {
+    const char *args[] = {"--help"};
+    Options::Cmdline_iterator it(1, args, 0);
+    parse(&it);
+    EXPECT_TRUE(target_path().empty());
+  }
+}
+
 TEST_F(Shell_cli_operation_test, local_dict) {
   {
     const char *arg1[] = {"util", "check-for-server-upgrade",
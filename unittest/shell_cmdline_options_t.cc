@@ -930,6 +930,7 @@ TEST_F(Shell_cmdline_options, app) {
   test_option_with_no_value("--json", "wrap_json", "json");
   test_option_equal_value("json", "pretty", false, "wrap_json", "json");
   test_option_equal_value("json", "raw", false, "wrap_json", "json/raw");
+  test_option_equal_value("json", "stream", false, "wrap_json", "json/stream");
   test_option_equal_value("json", "off", false, "wrap_json", "off");
 
   test_option_with_no_value("--trace-proto", "trace_protocol", "1");
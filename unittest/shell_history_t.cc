@@ -1598,6 +1598,52 @@ TEST_F(Shell_history, never_filter_latest) {
   EXPECT_STREQ("select 2;", linenoiseHistoryLine(1));
 }
 
+TEST_F(Shell_history, history_save_appends) {
+  mysqlsh::Command_line_shell shell(
+      std::make_shared<Shell_options>(0, nullptr, _options_file));
+
+  shell._history.set_limit(3);
+  shcore::create_file("testhistory", "print(1);\n");
+  ASSERT_TRUE(shell._history.load("testhistory"));
+
+  shell.process_line("print(2);");
+
+  // entries stored by another shell are kept
+  shcore::create_file("testhistory", "print(1);\nprint(10);\n");
+  ASSERT_TRUE(shell._history.save("testhistory"));
+  EXPECT_EQ("print(1);\nprint(10);\nprint(2);\n",
+            shcore::get_text_file("testhistory", false));
+
+  // nothing new to save
+  ASSERT_TRUE(shell._history.save("testhistory"));
+  EXPECT_EQ("print(1);\nprint(10);\nprint(2);\n",
+            shcore::get_text_file("testhistory", false));
+
+  shell.process_line("print(3);");
+  shell.process_line("print(4);");
+  shell.process_line("print(5);");
+  ASSERT_TRUE(shell._history.save("testhistory"));
+  EXPECT_EQ(
+      "print(1);\nprint(10);\nprint(2);\nprint(3);\nprint(4);\nprint(5);\n",
+      shcore::get_text_file("testhistory", false));
+
+  // file is compacted once it holds twice as many entries as the limit
+  shell.process_line("print(6);");
+  shell.process_line("print(7);");
+  ASSERT_TRUE(shell._history.save("testhistory"));
+  EXPECT_EQ("print(5);\nprint(6);\nprint(7);\n",
+            shcore::get_text_file("testhistory", false));
+
+  // deleting a stored entry rewrites the file
+  shell._history.del(shell._history.first_entry(),
+                     shell._history.first_entry());
+  ASSERT_TRUE(shell._history.save("testhistory"));
+  EXPECT_EQ("print(6);\nprint(7);\n",
+            shcore::get_text_file("testhistory", false));
+
+  shcore::delete_file("testhistory");
+}
+
 TEST_F(Shell_history, history_split_by_mode) {
   std::string sql_history_file;
   std::string scripting_history_file;
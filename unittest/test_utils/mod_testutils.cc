@@ -2869,7 +2869,7 @@ void Testutils::inject_gtid_set(int port, const std::string &gtid_set) {
   auto instance = mysqlshdk::mysql::Instance(session);
 
   auto gtids = mysqlshdk::mysql::Gtid_set::from_string(gtid_set);
-  gtids.normalize(instance);
+  gtids.normalize();
 
   mysqlshdk::mysql::inject_gtid_set(instance, gtids);
 }
@@ -4668,16 +4668,7 @@ bool Testutils::clean_s3_bucket(const shcore::Dictionary_t &opts) {
   const auto bucket = s3_bucket(opts);
 
   if (bucket->exists()) {
-    const auto objects = bucket->list_objects();
-
-    if (!objects.empty()) {
-      bucket->delete_objects(objects);
-    }
-
-    for (const auto &upload : bucket->list_multipart_uploads()) {
-      bucket->abort_multipart_upload(upload);
-    }
-
+    bucket->delete_all_objects();
     return true;
   } else {
     return false;
@@ -107,6 +107,16 @@ class Test_object : public Cpp_object_bridge {
                                       "a");
   }
 
+  void do_expose_members() {
+    add_property("count", "getCount");
+    add_constant("MAX_COUNT");
+    expose("formatNumber", &Test_object::f_s_i, "iarg");
+    expose("overload", &Test_object::f_overload);
+    expose<int, int>("overload", &Test_object::f_overload, "i");
+  }
+
+  void do_delete_members() { delete_property("count", "getCount"); }
+
   int f_i_v() { return std::numeric_limits<int>::min(); }
 
   unsigned int f_ui_v() { return std::numeric_limits<unsigned int>::max(); }
@@ -308,6 +318,56 @@ TEST_F(Types_cpp, expose) {
             obj.call("f_s_ii_op", make_args(32, 20)).get_string());
 }
 
+TEST_F(Types_cpp, member_lookup) {
+  obj.do_expose_members();
+
+  {
+    Scoped_naming_style style(NamingStyle::LowerCamelCase);
+
+    EXPECT_TRUE(obj.has_member_advanced("count"));
+    EXPECT_TRUE(obj.has_member_advanced("MAX_COUNT"));
+    EXPECT_TRUE(obj.has_method_advanced("getCount"));
+    EXPECT_TRUE(obj.has_method_advanced("formatNumber"));
+    EXPECT_FALSE(obj.has_method_advanced("format_number"));
+    EXPECT_FALSE(obj.has_member_advanced("get_count"));
+
+    EXPECT_EQ("42",
+              obj.call_advanced("formatNumber", make_args(42)).get_string());
+    EXPECT_EQ(10, obj.call_advanced("overload", make_args()).as_int());
+    EXPECT_EQ(11, obj.call_advanced("overload", make_args(1)).as_int());
+    EXPECT_EQ(Value_type::Function,
+              obj.get_member_advanced("formatNumber").get_type());
+  }
+
+  {
+    Scoped_naming_style style(NamingStyle::LowerCaseUnderscores);
+
+    EXPECT_TRUE(obj.has_member_advanced("count"));
+    EXPECT_TRUE(obj.has_member_advanced("MAX_COUNT"));
+    EXPECT_TRUE(obj.has_method_advanced("get_count"));
+    EXPECT_TRUE(obj.has_method_advanced("format_number"));
+    EXPECT_FALSE(obj.has_method_advanced("formatNumber"));
+    EXPECT_FALSE(obj.has_member_advanced("getCount"));
+
+    EXPECT_EQ("42",
+              obj.call_advanced("format_number", make_args(42)).get_string());
+    EXPECT_EQ(11, obj.call_advanced("overload", make_args(1)).as_int());
+    EXPECT_EQ(Value_type::Function,
+              obj.get_member_advanced("format_number").get_type());
+  }
+
+  obj.do_delete_members();
+
+  {
+    Scoped_naming_style style(NamingStyle::LowerCamelCase);
+
+    EXPECT_FALSE(obj.has_member_advanced("count"));
+    EXPECT_FALSE(obj.has_method_advanced("getCount"));
+    EXPECT_TRUE(obj.has_member_advanced("MAX_COUNT"));
+    EXPECT_TRUE(obj.has_method_advanced("formatNumber"));
+  }
+}
+
 TEST_F(Types_cpp, arg_check_optional) {
   // Check a1, ?a2, a3 and other combinations
 
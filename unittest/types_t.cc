@@ -383,6 +383,52 @@ TEST(ValueTests, to_string_container) {
                std::exception);
 }
 
+TEST(ValueTests, map_lookup) {
+  const auto map = make_dict();
+  map->set("threads", Value(4));
+  map->set("compression", Value("zstd"));
+
+  // keys can be looked up without creating a std::string
+  const std::string_view key = "compression;level=1";
+  EXPECT_TRUE(map->has_key(key.substr(0, 11)));
+  EXPECT_EQ("zstd", map->get_string(key.substr(0, 11)));
+  EXPECT_EQ("zstd", map->at(key.substr(0, 11)).get_string());
+  EXPECT_FALSE(map->has_key(key));
+  EXPECT_EQ(0, map->count(key));
+  EXPECT_THROW(map->at(key), std::out_of_range);
+
+  EXPECT_EQ(4, map->get_int(std::string{"threads"}));
+  EXPECT_EQ(1, map->count("threads"));
+
+  EXPECT_EQ(0, map->erase(key));
+  EXPECT_EQ(1, map->erase("threads"));
+  EXPECT_FALSE(map->has_key("threads"));
+  EXPECT_EQ(1, map->size());
+}
+
+TEST(ValueTests, option_unpacker) {
+  const auto options = make_dict();
+  options->set("threads", Value(4));
+  options->set("Compression", Value("zstd"));
+  options->set("unknown", Value::True());
+
+  int64_t threads = 0;
+  std::string compression;
+  std::string missing;
+
+  Option_unpacker unpacker{options};
+  unpacker.optional("threads", &threads)
+      .optional_ci("compression", &compression)
+      .optional("missing", &missing);
+
+  EXPECT_EQ(4, threads);
+  EXPECT_EQ("zstd", compression);
+  EXPECT_EQ("", missing);
+
+  EXPECT_THROW_LIKE(unpacker.end(), shcore::Exception,
+                    "Invalid options: unknown");
+}
+
 TEST(Functions, function_wrappers) {
   std::shared_ptr<Function_base> f(Cpp_function::create(
       "test", do_test, {{"test_index", Integer}, {"test_arg", String}}));
@@ -1126,6 +1126,32 @@ select 1;
 )*"));
 }
 
+TEST_P(Statement_splitter, long_strings) {
+  // special characters are searched in blocks, place them at every offset
+  // around the block boundaries
+  for (std::size_t i = 0; i < 70; ++i) {
+    const std::string pad(i, 'x');
+
+    for (const auto &s : {"'" + pad + "\\';" + pad + "'",
+                          "'" + pad + "'';" + pad + "'",
+                          "\"" + pad + "\\\";" + pad + "\"",
+                          "\"" + pad + "\"\";" + pad + "\"",
+                          "'" + pad + "\\\\'", "'" + pad + "\\\\\\\\'"}) {
+      SCOPED_TRACE(s);
+      EXPECT_EQ(strv({"select " + s + ";", "select 1;"}),
+                split_batch("select " + s + "; select 1;"));
+    }
+
+    SCOPED_TRACE(pad);
+    EXPECT_EQ(strv({"select " + pad + ";", "-- ;", "select " + pad + "-1;",
+                    "select " + pad + "/ 1;"}),
+              split_batch("select " + pad + "; -- ;\nselect " + pad +
+                          "-1;select " + pad + "/ 1;"));
+    EXPECT_EQ(strv({"select " + pad + "/*; '*/ 1;"}),
+              split_batch("select " + pad + "/*; '*/ 1;"));
+  }
+}
+
 TEST_P(Statement_splitter, ansi_quotes) {
   // if ansi_quotes then "" is handled the same way as ``
   EXPECT_EQ(strv({R"*("a"";b";)*", "'a'';b';", "`a``;b`;"}),
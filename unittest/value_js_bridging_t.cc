@@ -542,5 +542,21 @@ TEST_F(JavaScript, js_date_object) {
   ASSERT_TRUE(object.as_object()->class_name() == "Date");
   ASSERT_EQ("\"2014-01-01 00:00:00\"", object.repr());
 }
+
+TEST(JavaScript_startup_snapshot, create) {
+  const auto snapshot = JScript_context::create_startup_snapshot();
+
+  // signature is followed by the snapshot blob
+  ASSERT_TRUE(shcore::str_beginswith(snapshot, "mysqlsh-js-snapshot/"));
+
+  const auto pos = snapshot.find('\n');
+  ASSERT_NE(std::string::npos, pos);
+  ASSERT_LT(pos + 1, snapshot.size());
+
+  v8::StartupData blob{snapshot.data() + pos + 1,
+                       static_cast<int>(snapshot.size() - pos - 1)};
+  EXPECT_TRUE(blob.IsValid());
+}
+
 }  // namespace tests
 }  // namespace shcore